@@ -2,7 +2,8 @@
 #include <client/test/requests.hpp>
 
 #include <userver/chaotic/openapi/parameters_write.hpp>
-#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/serialize/write_to_stream.hpp>
 
 namespace clients::test {
 
@@ -16,9 +17,11 @@ void SerializeRequest(const Request& request, USERVER_NAMESPACE::clients::http::
     openapi::ParameterSinkHttpClient sink(http_request, "/testme");
 
     WriteParameter<openapi::TrivialParameter<openapi::In::kQuery, knumber, int>>(request.number, sink);
+    sink.Flush();
 
-    // http_request.data(ToJsonString(request.body));
-    http_request.data(ToString(USERVER_NAMESPACE::formats::json::ValueBuilder(request.body).ExtractValue()));
+    USERVER_NAMESPACE::formats::json::StringBuilder body_builder;
+    WriteToStream(request.body, body_builder);
+    http_request.data(body_builder.GetString());
 }
 
 }  // namespace testme_post
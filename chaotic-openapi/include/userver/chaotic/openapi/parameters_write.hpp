@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fmt/args.h>
 #include <fmt/ranges.h>
 
 #include <userver/chaotic/convert.hpp>
@@ -55,12 +54,17 @@ public:
     void Flush();
 
 private:
+    void AppendQuery(std::string_view name, std::string_view value);
+    std::string MakeUrl() const;
+
     std::string url_pattern_;
     clients::http::Request& request_;
     clients::http::Headers headers_;
-    http::MultiArgs query_args_;
+    // Encoded query arguments, appended as they come
+    std::string query_;
     std::unordered_map<std::string, std::string> cookies_;
-    fmt::dynamic_format_arg_store<fmt::format_context> path_vars_;
+    // Names are the static openapi::Name of the parameters
+    std::vector<std::pair<std::string_view, std::string>> path_vars_;
 };
 
 void ValidatePathVariableValue(std::string_view name, std::string_view value);
@@ -1,5 +1,7 @@
 #include <userver/chaotic/openapi/parameters_write.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,27 +20,65 @@ void ParameterSinkHttpClient::SetHeader(std::string_view name, std::string&& val
 }
 
 void ParameterSinkHttpClient::SetPath(Name& name, std::string&& value) {
-    // Note: passing tmp value to fmt::arg() is OK and not a UAF
-    // since fmt::dynamic_format_arg_store copies the data into itself.
-    path_vars_.push_back(fmt::arg(name, std::move(value)));
+    path_vars_.emplace_back(name, std::move(value));
 }
 
-void ParameterSinkHttpClient::SetQuery(std::string_view name, std::string&& value) {
-    query_args_.insert({std::string{name}, std::move(value)});
-}
+void ParameterSinkHttpClient::SetQuery(std::string_view name, std::string&& value) { AppendQuery(name, value); }
 
 void ParameterSinkHttpClient::SetMultiQuery(std::string_view name, std::vector<std::string>&& value) {
-    for (auto&& item : value) {
-        query_args_.insert({std::string{name}, std::move(item)});
+    for (const auto& item : value) {
+        AppendQuery(name, item);
     }
 }
 
 void ParameterSinkHttpClient::Flush() {
-    request_.url(http::MakeUrl(fmt::vformat(url_pattern_, path_vars_), {}, query_args_));
+    request_.url(MakeUrl());
     request_.headers(std::move(headers_));
     request_.cookies(std::move(cookies_));
 }
 
+void ParameterSinkHttpClient::AppendQuery(std::string_view name, std::string_view value) {
+    if (!query_.empty()) query_ += '&';
+    query_ += http::UrlEncode(name);
+    query_ += '=';
+    query_ += http::UrlEncode(value);
+}
+
+// Substitutes the {name} placeholders of the pattern in a single pass
+std::string ParameterSinkHttpClient::MakeUrl() const {
+    std::size_t size = url_pattern_.size() + 1 + query_.size();
+    for (const auto& [name, value] : path_vars_) size += value.size();
+
+    std::string url;
+    url.reserve(size);
+
+    std::string_view pattern = url_pattern_;
+    for (auto open = pattern.find('{'); open != std::string_view::npos; open = pattern.find('{')) {
+        const auto close = pattern.find('}', open);
+        if (close == std::string_view::npos) {
+            throw std::runtime_error(fmt::format("Unterminated path variable in '{}'", url_pattern_));
+        }
+
+        const auto name = pattern.substr(open + 1, close - open - 1);
+        const auto it =
+            std::find_if(path_vars_.begin(), path_vars_.end(), [name](const auto& var) { return var.first == name; });
+        if (it == path_vars_.end()) {
+            throw std::runtime_error(fmt::format("Missing path variable '{}' for '{}'", name, url_pattern_));
+        }
+
+        url.append(pattern.substr(0, open));
+        url.append(it->second);
+        pattern.remove_prefix(close + 1);
+    }
+    url.append(pattern);
+
+    if (!query_.empty()) {
+        url += '?';
+        url += query_;
+    }
+    return url;
+}
+
 std::string ToStrParameter(bool value) noexcept { return value ? "true" : "false"; }
 
 std::string ToStrParameter(double value) noexcept { return fmt::to_string(value); }
@@ -185,6 +185,39 @@ UTEST(OpenapiParameters, SinkHttpClient) {
     EXPECT_TRUE(called);
 }
 
+UTEST(OpenapiParameters, SinkHttpClientPathTemplate) {
+    auto http_client_ptr = utest::CreateHttpClient();
+    auto request = http_client_ptr->CreateRequest();
+    bool called = false;
+    utest::HttpServerMock http_server([&called](const utest::HttpServerMock::HttpRequest& request) {
+        EXPECT_EQ(request.path, "/v1/foo/items/bar");
+        EXPECT_EQ(request.query, (std::multimap<std::string, std::string>{{"name", "a b&c"}}));
+        called = true;
+
+        return utest::HttpServerMock::HttpResponse{};
+    });
+
+    co::ParameterSinkHttpClient sink(request, http_server.GetBaseUrl() + "/v1/{var1}/items/{var2}");
+
+    co::WriteParameter<co::TrivialParameter<co::In::kPath, kVar2, std::string>>("bar", sink);
+    co::WriteParameter<co::TrivialParameter<co::In::kPath, kVar1, std::string>>("foo", sink);
+    co::WriteParameter<co::TrivialParameter<co::In::kQuery, kName, std::string>>("a b&c", sink);
+    sink.Flush();
+
+    auto response = request.perform();
+    EXPECT_TRUE(called);
+}
+
+UTEST(OpenapiParameters, SinkHttpClientMissingPathVariable) {
+    auto http_client_ptr = utest::CreateHttpClient();
+    auto request = http_client_ptr->CreateRequest();
+
+    co::ParameterSinkHttpClient sink(request, "http://localhost/{var1}/{var2}");
+    co::WriteParameter<co::TrivialParameter<co::In::kPath, kVar1, std::string>>("foo", sink);
+
+    EXPECT_THROW(sink.Flush(), std::runtime_error);
+}
+
 UTEST(OpenapiParameters, InvalidPathVariable) {
     ParameterSinkMock sink;
 
@@ -108,6 +108,17 @@ def cpp_struct_is_strict_parsing(struct: cpp_types.CppStruct) -> bool:
     return struct.strict_parsing and struct.extra_type is False
 
 
+def cpp_struct_has_known_members(struct: cpp_types.CppStruct) -> bool:
+    # Objects without any members to look for are parsed as is
+    assert isinstance(struct, cpp_types.CppStruct)
+    return bool(struct.fields) or bool(struct.extra_type) or cpp_struct_is_strict_parsing(struct)
+
+
+def cpp_struct_has_sax_parser(struct: cpp_types.CppType) -> bool:
+    # Objects with additionalProperties are parsed via DOM
+    return struct.get_py_type() == 'CppStruct' and not struct.extra_type
+
+
 def make_env() -> jinja2.Environment:
     env = jinja_env.make_env(
         'chaotic/chaotic/back/cpp', os.path.join(PARENT_DIR),
@@ -116,6 +127,8 @@ def make_env() -> jinja2.Environment:
     env.globals['enumerate'] = enumerate
 
     env.globals['cpp_struct_is_strict_parsing'] = cpp_struct_is_strict_parsing
+    env.globals['cpp_struct_has_sax_parser'] = cpp_struct_has_sax_parser
+    env.globals['cpp_struct_has_known_members'] = cpp_struct_has_known_members
 
     env.globals['declaration_includes'] = declaration_includes
     env.globals['definition_includes'] = definition_includes
@@ -145,12 +158,14 @@ class OneToOneFileRenderer:
         clang_format_bin: str,
         parse_extra_formats: bool = False,
         generate_serializer: bool = False,
+        generate_sax_parser: bool = False,
     ) -> None:
         self._relative_to = relative_to
         self._vfilepath_to_relfilepath_map = vfilepath_to_relfilepath
         self._clang_format_bin = clang_format_bin
         self._parse_extra_formats = parse_extra_formats
         self._generate_serializer = generate_serializer
+        self._generate_sax_parser = generate_sax_parser
 
     @staticmethod
     def filepath_wo_ext(filepath: str) -> str:
@@ -243,6 +258,7 @@ class OneToOneFileRenderer:
                 'external_includes': external_includes,
                 'parse_formats': parse_formats,
                 'generate_serializer': self._generate_serializer,
+                'generate_sax_parser': self._generate_sax_parser,
             }
 
             tpl = JINJA_ENV.get_template('templates/type_fwd.hpp.jinja')
@@ -764,8 +764,8 @@ class CppStruct(CppType):
             'userver/chaotic/primitive.hpp',
             'userver/chaotic/with_type.hpp',
         ]
-        if self.extra_type or self.strict_parsing:
-            # for ExtractAdditionalProperties/ValidateNoAdditionalProperties
+        if self.fields or self.extra_type or self.strict_parsing:
+            # for FindKnownMembers and the additional properties handlers
             includes.append('userver/chaotic/object.hpp')
 
         if self.extra_type:
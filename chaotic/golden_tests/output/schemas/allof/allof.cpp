@@ -114,4 +114,53 @@ Serialize([[maybe_unused]] const ns::AllOf& value, USERVER_NAMESPACE::formats::s
     return vb.ExtractValue();
 }
 
+void
+WriteToStream([[maybe_unused]] const ns::AllOf::Foo__P0& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.foo}, sw);
+    }
+
+    if (value.extra.IsObject()) {
+        for (const auto& [field_key, field_value] : USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+            if (kns__AllOf__Foo__P0_PropertiesNames.Contains(field_key)) continue;
+            sw.Key(field_key);
+            WriteToStream(field_value, sw);
+        }
+    }
+}
+
+void
+WriteToStream([[maybe_unused]] const ns::AllOf::Foo__P1& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.bar) {
+        sw.Key("bar");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<int>{*value.bar}, sw);
+    }
+
+    if (value.extra.IsObject()) {
+        for (const auto& [field_key, field_value] : USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+            if (kns__AllOf__Foo__P1_PropertiesNames.Contains(field_key)) continue;
+            sw.Key(field_key);
+            WriteToStream(field_value, sw);
+        }
+    }
+}
+
+void WriteToStream(const ns::AllOf::Foo& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    sw.WriteValue(Serialize(value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>{}));
+}
+
+void WriteToStream([[maybe_unused]] const ns::AllOf& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>{*value.foo}, sw);
+    }
+}
+
 }  // namespace ns
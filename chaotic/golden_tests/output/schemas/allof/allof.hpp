@@ -81,4 +81,12 @@ Serialize(const ns::AllOf::Foo& value, USERVER_NAMESPACE::formats::serialize::To
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::AllOf& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::AllOf::Foo__P0& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
+void WriteToStream(const ns::AllOf::Foo__P1& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
+void WriteToStream(const ns::AllOf::Foo& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
+void WriteToStream(const ns::AllOf& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
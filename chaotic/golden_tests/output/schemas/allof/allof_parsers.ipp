@@ -17,12 +17,20 @@ static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__AllOf__Foo__P0_Proper
     return selector().template Type<std::string_view>().Case("foo");
 };
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__AllOf__Foo__P0_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("foo", 0);
+};
+
 static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__AllOf__Foo__P1_PropertiesNames = [](auto selector) {
     return selector().template Type<std::string_view>().Case("bar");
 };
 
-static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__AllOf_PropertiesNames = [](auto selector) {
-    return selector().template Type<std::string_view>().Case("foo");
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__AllOf__Foo__P1_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("bar", 0);
+};
+
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__AllOf_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("foo", 0);
 };
 
 template <typename Value>
@@ -32,9 +40,13 @@ ns::AllOf::Foo__P0 Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::
 
     ns::AllOf::Foo__P0 res;
 
-    res.foo = value["foo"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
+    USERVER_NAMESPACE::chaotic::AdditionalPropertiesTrue<Value> extra;
+    const auto members =
+        USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__AllOf__Foo__P0_PropertiesIndexes>(value, extra);
+
+    res.foo = members[0].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
 
-    res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(value, kns__AllOf__Foo__P0_PropertiesNames);
+    res.extra = std::move(extra).Extract();
 
     return res;
 }
@@ -46,9 +58,13 @@ ns::AllOf::Foo__P1 Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::
 
     ns::AllOf::Foo__P1 res;
 
-    res.bar = value["bar"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+    USERVER_NAMESPACE::chaotic::AdditionalPropertiesTrue<Value> extra;
+    const auto members =
+        USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__AllOf__Foo__P1_PropertiesIndexes>(value, extra);
 
-    res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(value, kns__AllOf__Foo__P1_PropertiesNames);
+    res.bar = members[0].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+
+    res.extra = std::move(extra).Extract();
 
     return res;
 }
@@ -65,9 +81,12 @@ ns::AllOf Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::AllOf>) {
 
     ns::AllOf res;
 
-    res.foo = value["foo"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>>>();
+    USERVER_NAMESPACE::chaotic::NoAdditionalProperties extra;
+    const auto members = USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__AllOf_PropertiesIndexes>(value, extra);
+
+    res.foo = members[0].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>>>();
 
-    USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(value, kns__AllOf_PropertiesNames);
+    extra.Validate();
 
     return res;
 }
@@ -20,8 +20,8 @@ static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__Enum__Foo_Mapping =
         .Case(ns::Enum::Foo::kThree, "three");
 };
 
-static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__Enum_PropertiesNames = [](auto selector) {
-    return selector().template Type<std::string_view>().Case("foo");
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__Enum_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("foo", 0);
 };
 
 template <typename Value>
@@ -43,9 +43,12 @@ ns::Enum Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::Enum>) {
 
     ns::Enum res;
 
-    res.foo = value["foo"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::Enum::Foo>>>();
+    USERVER_NAMESPACE::chaotic::NoAdditionalProperties extra;
+    const auto members = USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__Enum_PropertiesIndexes>(value, extra);
 
-    USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(value, kns__Enum_PropertiesNames);
+    res.foo = members[0].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::Enum::Foo>>>();
+
+    extra.Validate();
 
     return res;
 }
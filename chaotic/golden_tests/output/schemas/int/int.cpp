@@ -35,4 +35,13 @@ Serialize([[maybe_unused]] const ns::Int& value, USERVER_NAMESPACE::formats::ser
     return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::Int& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<int>{*value.foo}, sw);
+    }
+}
+
 }  // namespace ns
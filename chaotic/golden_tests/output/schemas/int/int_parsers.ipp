@@ -11,8 +11,8 @@
 
 namespace ns {
 
-static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__Int_PropertiesNames = [](auto selector) {
-    return selector().template Type<std::string_view>().Case("foo");
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__Int_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("foo", 0);
 };
 
 template <typename Value>
@@ -22,9 +22,12 @@ ns::Int Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::Int>) {
 
     ns::Int res;
 
-    res.foo = value["foo"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+    USERVER_NAMESPACE::chaotic::NoAdditionalProperties extra;
+    const auto members = USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__Int_PropertiesIndexes>(value, extra);
 
-    USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(value, kns__Int_PropertiesNames);
+    res.foo = members[0].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+
+    extra.Validate();
 
     return res;
 }
@@ -37,4 +37,18 @@ Serialize([[maybe_unused]] const ns::OneOf& value, USERVER_NAMESPACE::formats::s
     return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::OneOf& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(
+            USERVER_NAMESPACE::chaotic::Variant<
+                USERVER_NAMESPACE::chaotic::Primitive<int>,
+                USERVER_NAMESPACE::chaotic::Primitive<std::string>>{*value.foo},
+            sw
+        );
+    }
+}
+
 }  // namespace ns
@@ -31,4 +31,6 @@ OneOf Parse(USERVER_NAMESPACE::yaml_config::Value json, USERVER_NAMESPACE::forma
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::OneOf& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::OneOf& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
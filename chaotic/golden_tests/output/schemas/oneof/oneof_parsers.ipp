@@ -13,8 +13,8 @@
 
 namespace ns {
 
-static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__OneOf_PropertiesNames = [](auto selector) {
-    return selector().template Type<std::string_view>().Case("foo");
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__OneOf_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("foo", 0);
 };
 
 template <typename Value>
@@ -24,12 +24,15 @@ ns::OneOf Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::OneOf>) {
 
     ns::OneOf res;
 
-    res.foo = value["foo"]
+    USERVER_NAMESPACE::chaotic::NoAdditionalProperties extra;
+    const auto members = USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__OneOf_PropertiesIndexes>(value, extra);
+
+    res.foo = members[0]
                   .template As<std::optional<USERVER_NAMESPACE::chaotic::Variant<
                       USERVER_NAMESPACE::chaotic::Primitive<int>,
                       USERVER_NAMESPACE::chaotic::Primitive<std::string>>>>();
 
-    USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(value, kns__OneOf_PropertiesNames);
+    extra.Validate();
 
     return res;
 }
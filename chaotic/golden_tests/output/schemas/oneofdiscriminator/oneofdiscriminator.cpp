@@ -39,6 +39,28 @@ Serialize([[maybe_unused]] const ns::A& value, USERVER_NAMESPACE::formats::seria
     return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::A& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.type) {
+        sw.Key("type");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.type}, sw);
+    }
+
+    if (value.a_prop) {
+        sw.Key("a_prop");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<int>{*value.a_prop}, sw);
+    }
+
+    if (value.extra.IsObject()) {
+        for (const auto& [field_key, field_value] : USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+            if (kns__A_PropertiesNames.Contains(field_key)) continue;
+            sw.Key(field_key);
+            WriteToStream(field_value, sw);
+        }
+    }
+}
+
 bool operator==(const ns::B& lhs, const ns::B& rhs) {
     return lhs.type == rhs.type && lhs.b_prop == rhs.b_prop && lhs.extra == rhs.extra &&
 
@@ -72,6 +94,28 @@ Serialize([[maybe_unused]] const ns::B& value, USERVER_NAMESPACE::formats::seria
     return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::B& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.type) {
+        sw.Key("type");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.type}, sw);
+    }
+
+    if (value.b_prop) {
+        sw.Key("b_prop");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<int>{*value.b_prop}, sw);
+    }
+
+    if (value.extra.IsObject()) {
+        for (const auto& [field_key, field_value] : USERVER_NAMESPACE::formats::common::Items(value.extra)) {
+            if (kns__B_PropertiesNames.Contains(field_key)) continue;
+            sw.Key(field_key);
+            WriteToStream(field_value, sw);
+        }
+    }
+}
+
 bool operator==(const ns::OneOfDiscriminator& lhs, const ns::OneOfDiscriminator& rhs) {
     return lhs.foo == rhs.foo && true;
 }
@@ -106,4 +150,20 @@ Serialize([[maybe_unused]] const ns::OneOfDiscriminator& value, USERVER_NAMESPAC
     return vb.ExtractValue();
 }
 
+void
+WriteToStream([[maybe_unused]] const ns::OneOfDiscriminator& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(
+            USERVER_NAMESPACE::chaotic::OneOfWithDiscriminator<
+                &ns::OneOfDiscriminator::kFoo_Settings,
+                USERVER_NAMESPACE::chaotic::Primitive<ns::A>,
+                USERVER_NAMESPACE::chaotic::Primitive<ns::B>>{*value.foo},
+            sw
+        );
+    }
+}
+
 }  // namespace ns
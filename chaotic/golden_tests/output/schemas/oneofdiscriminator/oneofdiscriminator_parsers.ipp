@@ -17,6 +17,10 @@ static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__A_PropertiesNames = [
     return selector().template Type<std::string_view>().Case("type").Case("a_prop");
 };
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__A_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("type", 0).Case("a_prop", 1);
+};
+
 template <typename Value>
 ns::A Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::A>) {
     value.CheckNotMissing();
@@ -24,10 +28,13 @@ ns::A Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::A>) {
 
     ns::A res;
 
-    res.type = value["type"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
-    res.a_prop = value["a_prop"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+    USERVER_NAMESPACE::chaotic::AdditionalPropertiesTrue<Value> extra;
+    const auto members = USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__A_PropertiesIndexes>(value, extra);
 
-    res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(value, kns__A_PropertiesNames);
+    res.type = members[0].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
+    res.a_prop = members[1].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+
+    res.extra = std::move(extra).Extract();
 
     return res;
 }
@@ -36,6 +43,10 @@ static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__B_PropertiesNames = [
     return selector().template Type<std::string_view>().Case("type").Case("b_prop");
 };
 
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__B_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("type", 0).Case("b_prop", 1);
+};
+
 template <typename Value>
 ns::B Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::B>) {
     value.CheckNotMissing();
@@ -43,16 +54,19 @@ ns::B Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::B>) {
 
     ns::B res;
 
-    res.type = value["type"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
-    res.b_prop = value["b_prop"].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+    USERVER_NAMESPACE::chaotic::AdditionalPropertiesTrue<Value> extra;
+    const auto members = USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__B_PropertiesIndexes>(value, extra);
+
+    res.type = members[0].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
+    res.b_prop = members[1].template As<std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
 
-    res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(value, kns__B_PropertiesNames);
+    res.extra = std::move(extra).Extract();
 
     return res;
 }
 
-static constexpr USERVER_NAMESPACE::utils::TrivialSet kns__OneOfDiscriminator_PropertiesNames = [](auto selector) {
-    return selector().template Type<std::string_view>().Case("foo");
+static constexpr USERVER_NAMESPACE::utils::TrivialBiMap kns__OneOfDiscriminator_PropertiesIndexes = [](auto selector) {
+    return selector().template Type<std::string_view, std::size_t>().Case("foo", 0);
 };
 
 template <typename Value>
@@ -62,13 +76,17 @@ ns::OneOfDiscriminator Parse(Value value, USERVER_NAMESPACE::formats::parse::To<
 
     ns::OneOfDiscriminator res;
 
-    res.foo = value["foo"]
+    USERVER_NAMESPACE::chaotic::NoAdditionalProperties extra;
+    const auto members =
+        USERVER_NAMESPACE::chaotic::FindKnownMembers<kns__OneOfDiscriminator_PropertiesIndexes>(value, extra);
+
+    res.foo = members[0]
                   .template As<std::optional<USERVER_NAMESPACE::chaotic::OneOfWithDiscriminator<
                       &ns::OneOfDiscriminator::kFoo_Settings,
                       USERVER_NAMESPACE::chaotic::Primitive<ns::A>,
                       USERVER_NAMESPACE::chaotic::Primitive<ns::B>>>>();
 
-    USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(value, kns__OneOfDiscriminator_PropertiesNames);
+    extra.Validate();
 
     return res;
 }
@@ -35,4 +35,13 @@ Serialize([[maybe_unused]] const ns::String& value, USERVER_NAMESPACE::formats::
     return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::String& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.foo}, sw);
+    }
+}
+
 }  // namespace ns
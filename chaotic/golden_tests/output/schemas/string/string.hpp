@@ -26,4 +26,6 @@ String Parse(USERVER_NAMESPACE::yaml_config::Value json, USERVER_NAMESPACE::form
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::String& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::String& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 
 #include <fmt/format.h>
 
 #include <userver/formats/common/items.hpp>
+#include <userver/formats/json/value.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utils/trivial_map.hpp>
 
@@ -47,6 +53,116 @@ ExtractAdditionalProperties(const Value& json, const utils::TrivialSet<BuilderFu
     return map;
 }
 
+/// Handler of the unknown members for objects without `additionalProperties`
+/// that are not parsed strictly
+class IgnoreAdditionalProperties final {
+public:
+    template <typename Value>
+    void Add(std::string&&, const Value&) {}
+};
+
+/// Handler of the unknown members for strictly parsed objects. The error is
+/// reported by Validate() to keep the errors of the properties first.
+class NoAdditionalProperties final {
+public:
+    template <typename Value>
+    void Add(std::string&& name, const Value&) {
+        if (!unknown_name_) unknown_name_ = std::move(name);
+    }
+
+    void Validate() const {
+        if (unknown_name_) throw std::runtime_error(fmt::format("Unknown property '{}'", *unknown_name_));
+    }
+
+private:
+    std::optional<std::string> unknown_name_;
+};
+
+/// Handler of the unknown members for `additionalProperties: true`
+template <typename Value>
+class AdditionalPropertiesTrue final {
+public:
+    void Add(std::string&& name, const Value& member) { builder_[std::move(name)] = member; }
+
+    Value Extract() && { return builder_.ExtractValue(); }
+
+private:
+    typename Value::Builder builder_{formats::common::Type::kObject};
+};
+
+/// Handler of the unknown members for typed `additionalProperties`
+template <typename Value, typename T, template <typename...> typename Map>
+class AdditionalProperties final {
+public:
+    void Add(std::string&& name, const Value& member) { map_.emplace(std::move(name), member.template As<T>()); }
+
+    Map<std::string, formats::common::ParseType<Value, T>> Extract() && { return std::move(map_); }
+
+private:
+    Map<std::string, formats::common::ParseType<Value, T>> map_;
+};
+
+/// Members of an object that correspond to the properties listed in `Indexes`,
+/// a utils::TrivialBiMap from the property name to its index.
+template <const auto& Indexes, typename Value>
+class KnownMembers final {
+public:
+    explicit KnownMembers(const Value& json) : json_(json) {}
+
+    /// Returns the member for the property with the `index`. A missing member
+    /// is looked up in the object as usual to get the same path and the same
+    /// behavior for the missing values.
+    Value operator[](std::size_t index) const {
+        if (members_[index]) return *members_[index];
+        return json_[*Indexes.TryFindBySecond(index)];
+    }
+
+private:
+    template <const auto& Indexes2, typename Value2, typename AdditionalPropertiesHandler>
+    friend KnownMembers<Indexes2, Value2> FindKnownMembers(const Value2&, AdditionalPropertiesHandler&);
+
+    const Value& json_;
+    std::array<std::optional<Value>, Indexes.size()> members_;
+};
+
+/// Finds the members of the properties in `Indexes` and passes the rest of
+/// the members to `additional_properties`.
+///
+/// A formats::json::Value is iterated once, with the member names dispatched
+/// to the property indexes by the compile time utils::TrivialBiMap instead of
+/// looking up each property separately. Other values, like
+/// yaml_config::YamlConfig that substitutes the members on lookup, are iterated
+/// only for the additional properties and their properties are looked up by
+/// name.
+template <const auto& Indexes, typename Value, typename AdditionalPropertiesHandler>
+KnownMembers<Indexes, Value> FindKnownMembers(const Value& json, AdditionalPropertiesHandler& additional_properties) {
+    constexpr bool kIsSinglePass = std::is_same_v<Value, formats::json::Value>;
+    constexpr bool kIsIgnored = std::is_same_v<AdditionalPropertiesHandler, IgnoreAdditionalProperties>;
+
+    KnownMembers<Indexes, Value> members{json};
+    if constexpr (!kIsSinglePass && kIsIgnored) return members;
+
+    for (auto it = json.begin(); it != json.end(); ++it) {
+        auto name = it.GetName();
+        const auto index = Indexes.TryFindByFirst(name);
+        if (!index) {
+            additional_properties.Add(std::move(name), *it);
+        } else if constexpr (kIsSinglePass) {
+            // The first of the duplicate members wins, as in the lookup by name
+            auto& member = members.members_[*index];
+            if (!member) member.emplace(*it);
+        }
+    }
+    return members;
+}
+
+/// @overload
+template <const auto& Indexes, typename Value>
+KnownMembers<Indexes, Value> FindKnownMembers(const Value& json) {
+    IgnoreAdditionalProperties ignore;
+    return FindKnownMembers<Indexes>(json, ignore);
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
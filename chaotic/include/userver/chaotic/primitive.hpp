@@ -25,6 +25,11 @@ Value Serialize(const Primitive<RawType, Validators...>& ps, formats::serialize:
     return typename Value::Builder{ps.value}.ExtractValue();
 }
 
+template <typename RawType, typename... Validators, typename StringBuilder>
+void WriteToStream(const Primitive<RawType, Validators...>& ps, StringBuilder& sw) {
+    WriteToStream(ps.value, sw);
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,467 @@
+#pragma once
+
+/// @file userver/chaotic/sax_parser.hpp
+/// @brief SAX parsers for the chaotic-generated types
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/chaotic/array.hpp>
+#include <userver/chaotic/primitive.hpp>
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/parser_state.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief SAX parsers that fill the chaotic-generated structs directly from
+/// the JSON text, without building a formats::json::Value first.
+///
+/// The parsers are generated by chaotic with `--generate-sax-parsers` for
+/// the objects without `additionalProperties`. Primitives, arrays of them and
+/// the nested generated objects are parsed natively; all other types
+/// (formats, enums, variants, allOf, objects with additional properties,
+/// custom C++ types, ...) are parsed through a DOM of their subtree with the
+/// regular `Parse`, so the validation semantics are the same as for
+/// `formats::json::Value::As<T>()`.
+///
+/// Errors are reported as formats::json::parser::ParseError with the position
+/// and the path of the error.
+namespace chaotic::sax {
+
+/// Result type of `formats::json::Value::As<ParseType>()`
+template <typename ParseType>
+using ResultOf = decltype(std::declval<const formats::json::Value&>().template As<ParseType>());
+
+namespace impl {
+
+template <typename T, typename = void>
+inline constexpr bool kHasSaxParser = false;
+
+// MakeSaxParser(To<T>) is generated in the namespace of T and found by ADL
+template <typename T>
+inline constexpr bool kHasSaxParser<T, std::void_t<decltype(MakeSaxParser(formats::parse::To<T>{}))>> = true;
+
+}  // namespace impl
+
+/// Proxy parser that builds a DOM of the value and parses it with the regular
+/// `Parse`.
+template <typename ParseType>
+class DomParser final : private formats::json::parser::Subscriber<formats::json::Value> {
+public:
+    using ResultType = ResultOf<ParseType>;
+
+    DomParser() { parser_.Subscribe(*this); }
+
+    void Reset() { parser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return parser_.GetParser(); }
+
+private:
+    void OnSend(formats::json::Value&& value) override {
+        auto result = value.template As<ParseType>();
+        if (subscriber_) subscriber_->OnSend(std::move(result));
+    }
+
+    formats::json::parser::JsonValueParser parser_;
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// Proxy parser that runs the chaotic validators over the result of `Subparser`.
+template <typename Subparser, typename... Validators>
+class ValidatingParser final : private formats::json::parser::Subscriber<typename Subparser::ResultType> {
+public:
+    using ResultType = typename Subparser::ResultType;
+
+    ValidatingParser() { parser_.Subscribe(*this); }
+
+    void Reset() { parser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return parser_.GetParser(); }
+
+private:
+    void OnSend(ResultType&& value) override {
+        (Validators::Validate(value), ...);
+        if (subscriber_) subscriber_->OnSend(std::move(value));
+    }
+
+    Subparser parser_;
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// Proxy parser for a generated struct. The actual parser is created on first
+/// use, that allows recursive types.
+template <typename T>
+class StructParserHolder final {
+public:
+    using ResultType = T;
+
+    void Reset() { GetParser().Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<T>& subscriber) {
+        subscriber_ = &subscriber;
+        if (parser_) parser_->Subscribe(subscriber);
+    }
+
+    formats::json::parser::TypedParser<T>& GetParser() {
+        if (!parser_) {
+            parser_ = MakeSaxParser(formats::parse::To<T>{});
+            if (subscriber_) parser_->Subscribe(*subscriber_);
+        }
+        return *parser_;
+    }
+
+private:
+    std::unique_ptr<formats::json::parser::TypedParser<T>> parser_;
+    formats::json::parser::Subscriber<T>* subscriber_{nullptr};
+};
+
+namespace impl {
+
+template <typename RawType, typename = void>
+struct NativeParser {
+    using type = void;
+};
+
+template <>
+struct NativeParser<bool> {
+    using type = formats::json::parser::BoolParser;
+};
+
+template <>
+struct NativeParser<std::int32_t> {
+    using type = formats::json::parser::Int32Parser;
+};
+
+template <>
+struct NativeParser<std::int64_t> {
+    using type = formats::json::parser::Int64Parser;
+};
+
+template <>
+struct NativeParser<double> {
+    using type = formats::json::parser::DoubleParser;
+};
+
+template <>
+struct NativeParser<std::string> {
+    using type = formats::json::parser::StringParser;
+};
+
+template <typename T>
+struct NativeParser<T, std::enable_if_t<kHasSaxParser<T>>> {
+    using type = StructParserHolder<T>;
+};
+
+template <typename ParseType>
+struct ParserSelector {
+    using type = DomParser<ParseType>;
+};
+
+template <typename RawType, typename... Validators>
+struct ParserSelector<Primitive<RawType, Validators...>> {
+    using Native = typename NativeParser<RawType>::type;
+
+    using type = std::conditional_t<
+        std::is_void_v<Native>,
+        DomParser<Primitive<RawType, Validators...>>,
+        std::conditional_t<sizeof...(Validators) == 0, Native, ValidatingParser<Native, Validators...>>>;
+};
+
+}  // namespace impl
+
+/// SAX parser (typed or proxy) for `ParseType`
+template <typename ParseType>
+using Parser = typename impl::ParserSelector<ParseType>::type;
+
+/// Proxy parser for chaotic::Array stored in a std::vector
+template <typename ItemType, typename... Validators>
+class ArrayParser final : private formats::json::parser::Subscriber<std::vector<ResultOf<ItemType>>> {
+public:
+    using ResultType = std::vector<ResultOf<ItemType>>;
+
+    ArrayParser() { parser_.Subscribe(*this); }
+
+    void Reset() { parser_.Reset(); }
+
+    void Subscribe(formats::json::parser::Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return parser_.GetParser(); }
+
+private:
+    void OnSend(ResultType&& value) override {
+        (Validators::Validate(value), ...);
+        if (subscriber_) subscriber_->OnSend(std::move(value));
+    }
+
+    Parser<ItemType> item_parser_;
+    formats::json::parser::ArrayParser<ResultOf<ItemType>, Parser<ItemType>> parser_{item_parser_};
+    formats::json::parser::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+namespace impl {
+
+template <typename ItemType, typename UserType, typename... Validators>
+struct ParserSelector<Array<ItemType, UserType, Validators...>> {
+    using type = std::conditional_t<
+        std::is_same_v<UserType, std::vector<ResultOf<ItemType>>>,
+        sax::ArrayParser<ItemType, Validators...>,
+        DomParser<Array<ItemType, UserType, Validators...>>>;
+};
+
+}  // namespace impl
+
+/// Type-erased struct field, see chaotic::sax::StructParser
+class FieldBase {
+public:
+    /// Resets the value parser and returns it
+    virtual formats::json::parser::BaseParser& Start() = 0;
+
+    /// Returns true if JSON `null` does not require parsing and means the
+    /// absence of the value.
+    virtual bool TrySetNull() = 0;
+
+protected:
+    ~FieldBase() = default;
+};
+
+/// @brief Struct field parsed as `ParseType`.
+///
+/// Mirrors `value["name"].As<ParseType>()` and
+/// `value["name"].As<ParseType>(default)` if `kHasDefault` is true.
+template <typename ParseType, bool kHasDefault = false>
+class Field final : public FieldBase {
+    static constexpr bool kIsOptional = meta::kIsOptional<ParseType>;
+
+    using ValueParseType = typename std::conditional_t<
+        kIsOptional,
+        ParseType,
+        std::optional<ParseType>>::value_type;
+    using ValueParser = Parser<ValueParseType>;
+    using ValueType = typename ValueParser::ResultType;
+
+public:
+    using ResultType = ResultOf<ParseType>;
+
+    explicit Field(std::string_view name) : name_(name) { parser_.Subscribe(sink_); }
+
+    void Reset() { value_.reset(); }
+
+    formats::json::parser::BaseParser& Start() override {
+        parser_.Reset();
+        return parser_.GetParser();
+    }
+
+    bool TrySetNull() override {
+        if constexpr (kHasDefault || kIsOptional) {
+            value_.reset();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    ResultType Extract() {
+        static_assert(!kHasDefault);
+        if constexpr (kIsOptional) {
+            return std::move(value_);
+        } else {
+            if (!value_) throw std::runtime_error(fmt::format("Field '{}' is missing", name_));
+            return std::move(*value_);
+        }
+    }
+
+    template <typename Default>
+    ResultType Extract(Default&& default_value) {
+        static_assert(kHasDefault);
+        if (value_) return std::move(*value_);
+        return ResultType(std::forward<Default>(default_value));
+    }
+
+private:
+    std::string_view name_;
+    std::optional<ValueType> value_;
+    formats::json::parser::SubscriberSinkOptional<ValueType> sink_{value_};
+    ValueParser parser_;
+};
+
+/// Parser that skips a value of any type
+class SkipParser final : public formats::json::parser::BaseParser {
+public:
+    void Reset() { depth_ = 0; }
+
+protected:
+    void Null() override { MaybeFinish(); }
+    void Bool(bool) override { MaybeFinish(); }
+    void Int64(std::int64_t) override { MaybeFinish(); }
+    void Uint64(std::uint64_t) override { MaybeFinish(); }
+    void Double(double) override { MaybeFinish(); }
+    void String(std::string_view) override { MaybeFinish(); }
+    void StartObject() override { ++depth_; }
+    void Key(std::string_view) override {}
+    void EndObject() override;
+    void StartArray() override { ++depth_; }
+    void EndArray() override;
+
+    std::string GetPathItem() const override { return {}; }
+    std::string Expected() const override { return "value"; }
+
+private:
+    void MaybeFinish();
+
+    std::size_t depth_{0};
+};
+
+/// @brief Base class for the generated struct parsers.
+///
+/// Mirrors the generated `Parse(Value, To<T>)`: `null` is parsed as an empty
+/// object, unknown properties are rejected if the parsing is strict, skipped
+/// otherwise. In case of duplicate keys the last one wins.
+template <typename T>
+class StructParser : public formats::json::parser::TypedParser<T> {
+public:
+    void Reset() override {
+        state_ = State::kStart;
+        field_ = nullptr;
+        key_.clear();
+        ResetFields();
+    }
+
+protected:
+    explicit StructParser(bool strict) : strict_(strict) {}
+
+    /// Returns the field for the `key`, nullptr for the unknown property
+    virtual FieldBase* FindField(std::string_view key) = 0;
+
+    /// Resets all the fields
+    virtual void ResetFields() = 0;
+
+    /// Extracts all the fields into the result
+    virtual T BuildResult() = 0;
+
+    void Null() override {
+        if (state_ == State::kStart) {
+            Finish();
+            return;
+        }
+        if (state_ == State::kInside && field_->TrySetNull()) return;
+        PushField("null").Null();
+    }
+    void Bool(bool b) override { PushField("bool").Bool(b); }
+    void Int64(std::int64_t i) override { PushField("integer").Int64(i); }
+    void Uint64(std::uint64_t i) override { PushField("integer").Uint64(i); }
+    void Double(double d) override { PushField("double").Double(d); }
+    void String(std::string_view sw) override { PushField("string").String(sw); }
+    void StartArray() override { PushField("array").StartArray(); }
+
+    void StartObject() override {
+        if (state_ == State::kStart) {
+            state_ = State::kInside;
+            return;
+        }
+        PushField("object").StartObject();
+    }
+
+    void Key(std::string_view key) override {
+        key_ = key;
+        field_ = FindField(key);
+        if (!field_) {
+            if (strict_) throw std::runtime_error(fmt::format("Unknown property '{}'", key));
+            field_ = &skip_field_;
+        }
+    }
+
+    void EndObject() override { Finish(); }
+
+    std::string GetPathItem() const override { return key_; }
+    std::string Expected() const override { return "object"; }
+
+private:
+    class SkipField final : public FieldBase {
+    public:
+        formats::json::parser::BaseParser& Start() override {
+            parser_.Reset();
+            return parser_;
+        }
+
+        bool TrySetNull() override { return true; }
+
+    private:
+        SkipParser parser_;
+    };
+
+    enum class State {
+        kStart,
+        kInside,
+    };
+
+    formats::json::parser::BaseParser& PushField(std::string_view what) {
+        if (state_ != State::kInside) {
+            // Error path must not include the key - we're not inside an object yet
+            this->parser_state_->PopMe(*this);
+            this->Throw(std::string{what});
+        }
+        auto& parser = field_->Start();
+        this->parser_state_->PushParser(parser);
+        return parser;
+    }
+
+    void Finish() {
+        key_.clear();
+        this->SetResult(BuildResult());
+    }
+
+    const bool strict_;
+    State state_{State::kStart};
+    FieldBase* field_{nullptr};
+    std::string key_;
+    SkipField skip_field_;
+};
+
+/// @brief Parses the generated type `T` from the JSON text with its SAX parser.
+/// @throws formats::json::parser::ParseError
+template <typename T>
+T FromJsonString(std::string_view json) {
+    static_assert(impl::kHasSaxParser<T>, "SAX parser is not generated for the type, see --generate-sax-parsers");
+
+    auto parser = MakeSaxParser(formats::parse::To<T>{});
+    std::optional<T> result;
+    formats::json::parser::SubscriberSinkOptional<T> sink(result);
+
+    parser->Reset();
+    parser->Subscribe(sink);
+
+    formats::json::parser::ParserState state;
+    state.PushParser(*parser);
+    state.ProcessInput(json);
+
+    UASSERT(result);
+    return std::move(*result);
+}
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
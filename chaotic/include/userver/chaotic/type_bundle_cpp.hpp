@@ -1,5 +1,6 @@
 #pragma once
 
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/yaml/value.hpp>
@@ -0,0 +1,80 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/chaotic/sax_parser.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+#include <schemas/int_minmax.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/recursion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+void ExpectSameAsDom(std::string_view json) {
+    EXPECT_EQ(chaotic::sax::FromJsonString<T>(json), formats::json::FromString(json).As<T>()) << json;
+}
+
+}  // namespace
+
+TEST(Sax, Simple) {
+    ExpectSameAsDom<ns::SimpleObject>(R"({"int3": 1})");
+    ExpectSameAsDom<ns::SimpleObject>(R"({"int3": 1, "integer": 3, "int": 5})");
+    ExpectSameAsDom<ns::SimpleObject>(R"({"int3": 1, "integer": null, "int": null})");
+
+    auto obj = chaotic::sax::FromJsonString<ns::SimpleObject>(R"({"int3": 1})");
+    EXPECT_EQ(obj.int_, 1);
+    EXPECT_EQ(obj.int3, 1);
+    EXPECT_EQ(obj.integer, std::nullopt);
+}
+
+TEST(Sax, ObjectTypes) {
+    ExpectSameAsDom<ns::ObjectTypes>(
+        R"({"integer": 1, "boolean": true, "number": 1.1, "string": "foo", "string-enum": "1",
+            "object": {}, "array": [1, 2, 3]})"
+    );
+    ExpectSameAsDom<ns::ObjectWithRef>(R"({"integer": 3, "object": {"int3": 2, "int": 10}})");
+    ExpectSameAsDom<ns::ObjectWithRef>(R"({"object": null})");
+}
+
+TEST(Sax, NotStrict) {
+    ExpectSameAsDom<ns::ObjectWithAdditionalPropertiesTrueExtraMemberFalse>(
+        R"({"two": 2, "one": 3, "object": {"a": [1, {"b": null}]}})"
+    );
+}
+
+TEST(Sax, Recursion) {
+    ExpectSameAsDom<ns::RecursiveObject>(R"({"data": "a", "next": [{"data": "b", "next": [{"data": "c"}]}]})");
+}
+
+TEST(Sax, Errors) {
+    using formats::json::parser::ParseError;
+
+    UEXPECT_THROW_MSG(
+        chaotic::sax::FromJsonString<ns::SimpleObject>("{}"), ParseError, "Field 'int3' is missing"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::FromJsonString<ns::SimpleObject>(R"({"int3": 1, "int": 11})"),
+        ParseError,
+        "path 'int': Invalid value, maximum=10, given=11"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::FromJsonString<ns::SimpleObject>(R"({"int3": 1, "unknown": 1})"),
+        ParseError,
+        "Unknown property 'unknown'"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::FromJsonString<ns::IntegerObject>(R"({"zoo": [1]})"),
+        ParseError,
+        "path 'zoo': Too short array, minimum length=2, given=1"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::FromJsonString<ns::IntegerObject>(R"({"bar": 1})"),
+        ParseError,
+        "path 'bar': string was expected, but integer found"
+    );
+}
+
+USERVER_NAMESPACE_END
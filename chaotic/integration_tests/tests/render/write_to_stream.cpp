@@ -0,0 +1,71 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <schemas/all_of.hpp>
+#include <schemas/custom_cpp_type.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/one_of.hpp>
+#include <schemas/recursion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+void ExpectSameAsDom(std::string_view json) {
+    const auto value = formats::json::FromString(json).As<T>();
+
+    formats::json::StringBuilder sw;
+    WriteToStream(value, sw);
+
+    EXPECT_EQ(formats::json::FromString(sw.GetString()), formats::json::ValueBuilder{value}.ExtractValue()) << json;
+}
+
+}  // namespace
+
+TEST(WriteToStream, Simple) {
+    ExpectSameAsDom<ns::SimpleObject>(R"({"int3": 3})");
+    ExpectSameAsDom<ns::SimpleObject>(R"({"int3": 3, "integer": -1, "int": 10})");
+}
+
+TEST(WriteToStream, Types) {
+    ExpectSameAsDom<ns::ObjectTypes>(
+        R"({"boolean": true, "integer": 1, "number": 1.5, "string": "s\"tr",
+            "object": {}, "array": [1, 2, 3], "int-enum": 3, "string-enum": "bar"})"
+    );
+}
+
+TEST(WriteToStream, Ref) {
+    ExpectSameAsDom<ns::ObjectWithRef>(R"({})");
+    ExpectSameAsDom<ns::ObjectWithRef>(R"({"integer": 5, "object": {"int3": 1}})");
+}
+
+TEST(WriteToStream, AdditionalProperties) {
+    ExpectSameAsDom<ns::ObjectWithAdditionalPropertiesTrue>(R"({"one": 2, "two": {"x": [null]}})");
+    ExpectSameAsDom<ns::ObjectWithAdditionalPropertiesInt>(R"({"one": 2, "two": 3, "three": 4})");
+    ExpectSameAsDom<ns::ObjectWithAdditionalProperties>(R"({"foo": "a", "x": {"bar": "b"}})");
+}
+
+TEST(WriteToStream, OneOf) {
+    ExpectSameAsDom<ns::OneOf>(R"(true)");
+    ExpectSameAsDom<ns::OneOf>(R"(1.5)");
+    ExpectSameAsDom<ns::ObjectOneOfWithDiscriminator>(R"({"oneof": {"type": "ObjectFoo", "foo": 1}})");
+    ExpectSameAsDom<ns::ObjectOneOfWithDiscriminator>(R"({"oneof": {"type": "ObjectBar", "bar": "b"}})");
+}
+
+TEST(WriteToStream, AllOf) { ExpectSameAsDom<ns::AllOf>(R"({"foo": 1, "bar": 2, "baz": "extra"})"); }
+
+TEST(WriteToStream, Recursion) {
+    ExpectSameAsDom<ns::RecursiveObject>(R"({"data": "1", "next": [{"data": "2", "next": [{"data": "3"}]}]})");
+}
+
+TEST(WriteToStream, Custom) {
+    ExpectSameAsDom<ns::ObjWithCustom>(
+        R"({"integer": 12, "string": "make love", "decimal": "12.3456789", "object": {"foo": "bar"}})"
+    );
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,23 @@
+#include <userver/chaotic/sax_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace chaotic::sax {
+
+void SkipParser::EndObject() {
+    --depth_;
+    MaybeFinish();
+}
+
+void SkipParser::EndArray() {
+    --depth_;
+    MaybeFinish();
+}
+
+void SkipParser::MaybeFinish() {
+    if (depth_ == 0) parser_state_->PopMe(*this);
+}
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
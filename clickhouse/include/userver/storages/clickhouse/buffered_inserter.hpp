@@ -0,0 +1,237 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// Settings of storages::clickhouse::BufferedInserter
+struct BufferedInserterSettings final {
+    /// Maximum number of rows in a single INSERT
+    std::size_t max_batch_rows{100'000};
+
+    /// Maximum time a row waits in the buffer before being sent
+    std::chrono::milliseconds max_batch_delay{1000};
+
+    /// Maximum number of rows being buffered or sent, Insert() is rejected after
+    std::size_t max_buffered_rows{1'000'000};
+
+    /// Maximum number of INSERTs running in parallel over the pool connections
+    std::size_t max_concurrent_flushes{2};
+};
+
+/// Statistics of storages::clickhouse::BufferedInserter
+struct BufferedInserterStatistics final {
+    std::atomic<std::uint64_t> rows_inserted{0};
+    std::atomic<std::uint64_t> rows_rejected{0};
+    std::atomic<std::uint64_t> rows_sent{0};
+    std::atomic<std::uint64_t> rows_failed{0};
+    std::atomic<std::uint64_t> flushes{0};
+    std::atomic<std::uint64_t> flush_errors{0};
+    std::atomic<std::uint64_t> rows_buffered{0};
+};
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const BufferedInserterStatistics& stats);
+
+/// @brief Accumulates rows inserted by many tasks and sends them to a table
+/// of the cluster in large batches.
+///
+/// `Row` is expected to be a clickhouse-mapped type, as for
+/// storages::clickhouse::Cluster::InsertRows. The rows are sent when
+/// `max_batch_rows` rows are buffered or `max_batch_delay` passes since the
+/// first buffered row. Up to `max_concurrent_flushes` batches are sent in
+/// parallel, each over its own pool connection; the compression of the batches
+/// is configured by the `compression` option of the components::ClickHouse.
+///
+/// Insert() does not wait for the rows to be sent. If `max_buffered_rows` rows
+/// are already buffered or being sent, Insert() rejects the row and returns
+/// `false`, so the producers can slow down or drop data. Rows of a failed
+/// INSERT are dropped and accounted in the statistics.
+///
+/// The buffered rows are sent by Flush() and by the destructor.
+template <typename Row>
+class BufferedInserter final {
+public:
+    BufferedInserter(
+        ClusterPtr cluster,
+        std::string table_name,
+        std::vector<std::string> column_names,
+        BufferedInserterSettings settings
+    );
+    ~BufferedInserter();
+
+    BufferedInserter(const BufferedInserter&) = delete;
+    BufferedInserter& operator=(const BufferedInserter&) = delete;
+
+    /// @brief Adds the row to the buffer
+    /// @returns `false` if the row is rejected due to `max_buffered_rows`
+    [[nodiscard]] bool Insert(Row row);
+
+    /// Sends all the buffered rows and waits for all the running INSERTs
+    void Flush();
+
+    const BufferedInserterStatistics& GetStatistics() const noexcept { return stats_; }
+
+private:
+    void Run();
+    void SendBuffer();
+    void Send(std::vector<Row>&& rows, engine::SemaphoreLock&& flush_lock);
+    void WaitForFlushes();
+
+    const ClusterPtr cluster_;
+    const std::string table_name_;
+    const std::vector<std::string> column_names_;
+    const std::vector<std::string_view> column_name_views_;
+    const BufferedInserterSettings settings_;
+
+    BufferedInserterStatistics stats_;
+
+    engine::Mutex mutex_;
+    std::vector<Row> buffer_;
+
+    engine::SingleConsumerEvent has_rows_;
+    engine::SingleConsumerEvent batch_full_;
+    engine::Semaphore flushes_semaphore_;
+
+    concurrent::BackgroundTaskStorage flushes_;
+    engine::TaskWithResult<void> task_;
+};
+
+template <typename Row>
+BufferedInserter<Row>::BufferedInserter(
+    ClusterPtr cluster,
+    std::string table_name,
+    std::vector<std::string> column_names,
+    BufferedInserterSettings settings
+)
+    : cluster_(std::move(cluster)),
+      table_name_(std::move(table_name)),
+      column_names_(std::move(column_names)),
+      column_name_views_(column_names_.begin(), column_names_.end()),
+      settings_(settings),
+      flushes_semaphore_(settings_.max_concurrent_flushes) {
+    UASSERT(cluster_);
+    UINVARIANT(settings_.max_batch_rows > 0, "max_batch_rows must be positive");
+    UINVARIANT(settings_.max_concurrent_flushes > 0, "max_concurrent_flushes must be positive");
+    task_ = USERVER_NAMESPACE::utils::CriticalAsync("clickhouse_buffered_inserter", [this] { Run(); });
+}
+
+template <typename Row>
+BufferedInserter<Row>::~BufferedInserter() {
+    task_.SyncCancel();
+    // Rows accepted by Insert() should not be lost
+    Flush();
+}
+
+template <typename Row>
+bool BufferedInserter<Row>::Insert(Row row) {
+    if (stats_.rows_buffered.load() >= settings_.max_buffered_rows) {
+        ++stats_.rows_rejected;
+        return false;
+    }
+
+    const std::lock_guard lock{mutex_};
+    buffer_.push_back(std::move(row));
+    ++stats_.rows_buffered;
+    ++stats_.rows_inserted;
+
+    if (buffer_.size() == 1) has_rows_.Send();
+    if (buffer_.size() >= settings_.max_batch_rows) batch_full_.Send();
+    return true;
+}
+
+template <typename Row>
+void BufferedInserter<Row>::Flush() {
+    SendBuffer();
+    WaitForFlushes();
+}
+
+template <typename Row>
+void BufferedInserter<Row>::Run() {
+    while (has_rows_.WaitForEvent()) {
+        // A signal left from the previous batch only makes the next one early
+        [[maybe_unused]] const auto is_full =
+            batch_full_.WaitForEventUntil(engine::Deadline::FromDuration(settings_.max_batch_delay));
+        if (engine::current_task::ShouldCancel()) break;
+        SendBuffer();
+    }
+}
+
+template <typename Row>
+void BufferedInserter<Row>::SendBuffer() {
+    while (true) {
+        // Waits for a connection to start a new INSERT before taking the rows,
+        // so the batches keep growing while all the flushes are busy
+        engine::SemaphoreLock flush_lock{flushes_semaphore_};
+
+        std::vector<Row> rows;
+        {
+            const std::lock_guard lock{mutex_};
+            if (buffer_.empty()) return;
+            if (buffer_.size() <= settings_.max_batch_rows) {
+                rows.swap(buffer_);
+            } else {
+                const auto batch_end = buffer_.begin() + settings_.max_batch_rows;
+                rows.assign(std::make_move_iterator(buffer_.begin()), std::make_move_iterator(batch_end));
+                buffer_.erase(buffer_.begin(), batch_end);
+            }
+        }
+        Send(std::move(rows), std::move(flush_lock));
+    }
+}
+
+template <typename Row>
+void BufferedInserter<Row>::Send(std::vector<Row>&& rows, engine::SemaphoreLock&& flush_lock) {
+    flushes_.AsyncDetach(
+        "clickhouse_buffered_insert",
+        [this, rows = std::move(rows), flush_lock = std::move(flush_lock)]() mutable {
+            ++stats_.flushes;
+            try {
+                cluster_->InsertRows(table_name_, column_name_views_, rows);
+                stats_.rows_sent += rows.size();
+            } catch (const std::exception& e) {
+                LOG_LIMITED_ERROR() << "Failed to insert " << rows.size() << " rows into '" << table_name_
+                                    << "': " << e;
+                ++stats_.flush_errors;
+                stats_.rows_failed += rows.size();
+            }
+            stats_.rows_buffered -= rows.size();
+            flush_lock.Unlock();
+        }
+    );
+}
+
+template <typename Row>
+void BufferedInserter<Row>::WaitForFlushes() {
+    flushes_semaphore_.lock_shared_count(settings_.max_concurrent_flushes);
+    flushes_semaphore_.unlock_shared_count(settings_.max_concurrent_flushes);
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
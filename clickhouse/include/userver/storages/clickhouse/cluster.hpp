@@ -6,6 +6,8 @@
 #include <atomic>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -61,6 +63,38 @@ public:
     template <typename... Args>
     ExecutionResult Execute(OptionalCommandControl, const Query& query, const Args&... args) const;
 
+    /// @brief Execute a statement at some host of the cluster with args as
+    /// query parameters and pass the result to `callback` block by block,
+    /// as the blocks arrive from the server.
+    ///
+    /// Unlike Execute, the whole result is never held in memory, which makes
+    /// it possible to process results of any size. Each received block is
+    /// converted to `T`, a struct of vectors of same length, and passed to
+    /// `callback` as `T&&`. See @ref clickhouse_io for better understanding of
+    /// `T`'s requirements.
+    ///
+    /// `callback` is invoked in the current task. The next block is not read
+    /// from the network until the callback returns, so a slow consumer
+    /// throttles the server. An exception thrown from `callback` aborts the
+    /// query and is rethrown from ExecuteStreaming.
+    ///
+    /// @note CommandControl::execute limits the whole query including all the
+    /// callback invocations.
+    ///
+    /// @snippet storages/tests/execute_chtest.cpp  Sample ExecuteStreaming usage
+    template <typename T, typename Callback, typename... Args>
+    void ExecuteStreaming(const Query& query, Callback&& callback, const Args&... args) const;
+
+    /// @brief Execute a statement with specified command control settings
+    /// at some host of the cluster with args as query parameters and pass the
+    /// result to `callback` block by block, as the blocks arrive from the
+    /// server.
+    ///
+    /// See ExecuteStreaming above for the details.
+    template <typename T, typename Callback, typename... Args>
+    void ExecuteStreaming(OptionalCommandControl, const Query& query, Callback&& callback, const Args&... args)
+        const;
+
     /// @brief Insert data at some host of the cluster;
     /// `T` is expected to be a struct of vectors of same length.
     /// @param table_name table to insert into
@@ -136,6 +170,8 @@ private:
 
     ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+    void DoExecuteStreaming(OptionalCommandControl, const Query& query, impl::BlockCallback callback) const;
+
     const impl::Pool& GetPool() const;
 
     std::vector<impl::Pool> pools_;
@@ -194,6 +230,26 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc, const Query
     return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename T, typename Callback, typename... Args>
+void Cluster::ExecuteStreaming(const Query& query, Callback&& callback, const Args&... args) const {
+    ExecuteStreaming<T>(OptionalCommandControl{}, query, std::forward<Callback>(callback), args...);
+}
+
+template <typename T, typename Callback, typename... Args>
+void Cluster::ExecuteStreaming(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    Callback&& callback,
+    const Args&... args
+) const {
+    static_assert(std::is_invocable_v<Callback&, T&&>, "Callback must be invocable with T&&");
+
+    const auto formatted_query = query.WithArgs(args...);
+    DoExecuteStreaming(optional_cc, formatted_query, [&callback](ExecutionResult&& block) {
+        callback(std::move(block).As<T>());
+    });
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <userver/storages/clickhouse/options.hpp>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/utils/function_ref.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +20,8 @@ class PoolImpl;
 struct PoolSettings;
 class InsertionRequest;
 
+using BlockCallback = USERVER_NAMESPACE::utils::function_ref<void(ExecutionResult&&)>;
+
 class Pool final {
 public:
     Pool(clients::dns::Resolver&, PoolSettings&&);
@@ -29,6 +32,8 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+    void ExecuteStreaming(OptionalCommandControl, const Query& query, BlockCallback callback) const;
+
     void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
     void WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
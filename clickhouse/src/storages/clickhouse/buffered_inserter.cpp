@@ -0,0 +1,21 @@
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const BufferedInserterStatistics& stats) {
+    writer["rows"]["inserted"] = stats.rows_inserted.load();
+    writer["rows"]["rejected"] = stats.rows_rejected.load();
+    writer["rows"]["sent"] = stats.rows_sent.load();
+    writer["rows"]["failed"] = stats.rows_failed.load();
+    writer["rows"]["buffered"] = stats.rows_buffered.load();
+    writer["flushes"]["total"] = stats.flushes.load();
+    writer["flushes"]["errors"] = stats.flush_errors.load();
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
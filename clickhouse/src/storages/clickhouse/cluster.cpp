@@ -54,6 +54,11 @@ ExecutionResult Cluster::DoExecute(OptionalCommandControl optional_cc, const Que
     return GetPool().Execute(optional_cc, query);
 }
 
+void Cluster::DoExecuteStreaming(OptionalCommandControl optional_cc, const Query& query, impl::BlockCallback callback)
+    const {
+    GetPool().ExecuteStreaming(optional_cc, query, callback);
+}
+
 void Cluster::DoInsert(OptionalCommandControl optional_cc, const impl::InsertionRequest& request) const {
     GetPool().Insert(optional_cc, request);
 }
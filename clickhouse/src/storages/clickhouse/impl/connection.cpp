@@ -100,6 +100,29 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc, const Qu
     return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc, const Query& query, BlockCallback callback) {
+    clickhouse_cpp::Query native_query{query.QueryText()};
+    native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+        // we must return 'true' if we don't want to cancel query
+        return !engine::current_task::ShouldCancel();
+    });
+
+    auto& span = tracing::Span::CurrentSpan();
+    auto scope = span.CreateScopeTime(scopes::kExec);
+
+    // The callback is invoked from within the socket reading loop, so the next
+    // block is not read until the previous one is processed
+    native_query.OnData([&callback, &scope](const NativeBlock& data) {
+        scope.Reset(scopes::kExec);
+        if (data.GetRowCount() == 0) return;
+
+        auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+        callback(ExecutionResult{BlockWrapperPtr{block_ptr.release()}});
+    });
+
+    DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) {
     const auto& block = request.GetBlock();
 
@@ -4,6 +4,7 @@
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/impl/pool.hpp>
 #include <userver/storages/clickhouse/options.hpp>
 
 #include <storages/clickhouse/impl/native_client_factory.hpp>
@@ -27,6 +28,9 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+    // Calls `callback` with every non-empty block as soon as it is received
+    void ExecuteStreaming(OptionalCommandControl, const Query&, BlockCallback callback);
+
     void Insert(OptionalCommandControl, const InsertionRequest&);
 
     void Ping();
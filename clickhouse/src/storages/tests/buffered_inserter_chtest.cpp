@@ -0,0 +1,130 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/execution_result.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct EventRow final {
+    uint64_t id;
+    std::string value;
+};
+
+struct EventIds final {
+    std::vector<uint64_t> ids;
+};
+
+storages::clickhouse::ClusterPtr MakeClusterPtr(ClusterWrapper& cluster) {
+    // The wrapper owns the cluster and outlives the inserter
+    return storages::clickhouse::ClusterPtr{std::shared_ptr<void>{}, &*cluster};
+}
+
+// Temporary tables are not shared between the connections of the pool
+void RecreateTable(ClusterWrapper& cluster) {
+    cluster->Execute("DROP TABLE IF EXISTS buffered_inserter_events");
+    cluster->Execute("CREATE TABLE buffered_inserter_events (id UInt64, value String) ENGINE = Memory");
+}
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<EventRow> {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<EventIds> {
+    using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST_MT(BufferedInserter, ConcurrentInserts, 4) {
+    ClusterWrapper cluster{};
+    RecreateTable(cluster);
+
+    constexpr std::size_t kTasks = 8;
+    constexpr std::size_t kRowsPerTask = 1000;
+    {
+        storages::clickhouse::BufferedInserter<EventRow> inserter{
+            MakeClusterPtr(cluster),
+            "buffered_inserter_events",
+            {"id", "value"},
+            {/*max_batch_rows=*/500,
+             /*max_batch_delay=*/std::chrono::milliseconds{10},
+             /*max_buffered_rows=*/kTasks * kRowsPerTask,
+             /*max_concurrent_flushes=*/3}};
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        for (std::size_t i = 0; i < kTasks; ++i) {
+            tasks.push_back(engine::AsyncNoSpan([&inserter, i] {
+                for (std::size_t j = 0; j < kRowsPerTask; ++j) {
+                    ASSERT_TRUE(inserter.Insert(EventRow{i * kRowsPerTask + j, "value"}));
+                }
+            }));
+        }
+        engine::WaitAllChecked(tasks);
+        inserter.Flush();
+
+        const auto& stats = inserter.GetStatistics();
+        EXPECT_EQ(stats.rows_inserted.load(), kTasks * kRowsPerTask);
+        EXPECT_EQ(stats.rows_sent.load(), kTasks * kRowsPerTask);
+        EXPECT_EQ(stats.rows_buffered.load(), 0);
+        EXPECT_EQ(stats.flush_errors.load(), 0);
+        EXPECT_GE(stats.flushes.load(), kTasks * kRowsPerTask / 500);
+    }
+
+    const auto result = cluster->Execute("SELECT id FROM buffered_inserter_events ORDER BY id").As<EventIds>();
+    ASSERT_EQ(result.ids.size(), kTasks * kRowsPerTask);
+    for (std::size_t i = 0; i < result.ids.size(); ++i) {
+        EXPECT_EQ(result.ids[i], i);
+    }
+}
+
+UTEST(BufferedInserter, Backpressure) {
+    ClusterWrapper cluster{};
+    RecreateTable(cluster);
+
+    storages::clickhouse::BufferedInserter<EventRow> inserter{
+        MakeClusterPtr(cluster),
+        "buffered_inserter_events",
+        {"id", "value"},
+        {/*max_batch_rows=*/100,
+         /*max_batch_delay=*/std::chrono::hours{1},
+         /*max_buffered_rows=*/10,
+         /*max_concurrent_flushes=*/1}};
+
+    for (uint64_t i = 0; i < 10; ++i) {
+        EXPECT_TRUE(inserter.Insert(EventRow{i, "value"}));
+    }
+    EXPECT_FALSE(inserter.Insert(EventRow{10, "value"}));
+    EXPECT_EQ(inserter.GetStatistics().rows_rejected.load(), 1);
+
+    inserter.Flush();
+    EXPECT_TRUE(inserter.Insert(EventRow{10, "value"}));
+}
+
+UTEST(BufferedInserter, FlushedOnDestruction) {
+    ClusterWrapper cluster{};
+    RecreateTable(cluster);
+
+    {
+        storages::clickhouse::BufferedInserter<EventRow> inserter{
+            MakeClusterPtr(cluster), "buffered_inserter_events", {"id", "value"}, {}};
+        EXPECT_TRUE(inserter.Insert(EventRow{1, "value"}));
+    }
+
+    const auto result = cluster->Execute("SELECT id FROM buffered_inserter_events").As<EventIds>();
+    EXPECT_EQ(result.ids, std::vector<uint64_t>{1});
+}
+
+USERVER_NAMESPACE_END
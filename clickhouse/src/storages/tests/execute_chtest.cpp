@@ -72,6 +72,54 @@ UTEST(Execute, MappingWorks) {
     EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+UTEST(Execute, Streaming) {
+    ClusterWrapper cluster{};
+
+    const storages::clickhouse::Query query{
+        "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+        "FROM numbers(0, 100000) c "
+        "SETTINGS max_block_size = 1000"};
+
+    /// [Sample ExecuteStreaming usage]
+    std::size_t blocks = 0;
+    std::size_t rows = 0;
+    uint64_t sum = 0;
+    cluster->ExecuteStreaming<Data>(query, [&](Data&& block) {
+        ++blocks;
+        rows += block.numbers.size();
+        for (const auto number : block.numbers) sum += number;
+    });
+    /// [Sample ExecuteStreaming usage]
+
+    EXPECT_GT(blocks, 1);
+    EXPECT_EQ(rows, 100000);
+    EXPECT_EQ(sum, uint64_t{100000} * (100000 - 1) / 2);
+}
+
+UTEST(Execute, StreamingCallbackThrows) {
+    ClusterWrapper cluster{};
+
+    const storages::clickhouse::Query query{
+        "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+        "FROM system.numbers c "
+        "SETTINGS max_block_size = 1000"};
+
+    std::size_t blocks = 0;
+    EXPECT_THROW(
+        cluster->ExecuteStreaming<Data>(
+            query,
+            [&blocks](Data&&) {
+                if (++blocks == 3) throw std::runtime_error{"enough"};
+            }
+        ),
+        std::runtime_error
+    );
+    EXPECT_EQ(blocks, 3);
+
+    const auto result = cluster->Execute(common_query).As<Data>();
+    EXPECT_EQ(result.numbers.size(), 10000);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
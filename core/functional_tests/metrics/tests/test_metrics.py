@@ -10,8 +10,13 @@ def _normalize_metrics(metrics: str) -> str:
             continue
 
         left, _ = line.rsplit('\t', 1)
-        if sys.platform == 'darwin' and left.startswith('io_'):
-            # MacOS does not provide some of the io_* metrics
+        if sys.platform == 'darwin' and (
+            left.startswith('io_') or left.startswith('anon_huge_pages_kb')
+        ):
+            # MacOS does not provide some of the io_* metrics and THP
+            continue
+        if left.startswith('cgroup.'):
+            # Depend on the container the service runs in
             continue
         left = re.sub('localhost:\\d+', 'localhost:00000', left + '\t' + '0')
         result.append(left)
@@ -0,0 +1,57 @@
+#pragma once
+
+/// @file userver/baggage/lazy_baggage.hpp
+/// @brief @copybrief baggage::TryGetInheritedBaggage
+
+#include <atomic>
+#include <memory>
+#include <string_view>
+
+#include <userver/baggage/baggage.hpp>
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace baggage {
+
+/// @brief Baggage of the current task hierarchy: the one set via
+/// baggage::BaggageManager, or the baggage header of the incoming request that
+/// is parsed on the first call.
+/// @returns nullptr if there is no baggage or the header is invalid
+const Baggage* TryGetInheritedBaggage();
+
+/// @cond
+namespace impl {
+
+// Raw baggage header of the incoming request, parsed on the first access so
+// that the requests without outgoing calls do not pay for the parsing
+class LazyBaggage final {
+public:
+    // `owner` keeps the `header` alive
+    LazyBaggage(std::shared_ptr<const void> owner, std::string_view header, dynamic_config::Snapshot config);
+
+    LazyBaggage(LazyBaggage&&) = delete;
+    LazyBaggage& operator=(LazyBaggage&&) = delete;
+    ~LazyBaggage();
+
+    // Safe to call concurrently from the tasks that inherited the baggage
+    const Baggage* Get() const;
+
+private:
+    struct Parsed;
+
+    const std::shared_ptr<const void> owner_;
+    const std::string_view header_;
+    const dynamic_config::Snapshot config_;
+    mutable std::atomic<const Parsed*> parsed_{nullptr};
+};
+
+inline engine::TaskInheritedVariable<LazyBaggage> kLazyInheritedBaggage;
+
+}  // namespace impl
+/// @endcond
+
+}  // namespace baggage
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <userver/cache/cache_statistics.hpp>
 #include <userver/cache/update_type.hpp>
@@ -152,6 +153,10 @@ private:
 
     virtual void ReadAndSet(dump::Reader& reader);
 
+    virtual bool GetAndWriteDelta(dump::Writer& writer) const;
+
+    virtual void ReadAndSetWithDeltas(dump::Reader& reader, const std::vector<std::unique_ptr<dump::Reader>>& deltas);
+
     class Impl;
     std::unique_ptr<Impl> impl_;
 };
@@ -3,18 +3,25 @@
 /// @file userver/cache/caching_component_base.hpp
 /// @brief @copybrief components::CachingComponentBase
 
+#include <atomic>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include <userver/cache/cache_update_trait.hpp>
+#include <userver/cache/change_set.hpp>
 #include <userver/cache/exceptions.hpp>
 #include <userver/compiler/demangle.hpp>
 #include <userver/components/component_base.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/concurrent/async_event_channel.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/dump/common.hpp>
 #include <userver/dump/helpers.hpp>
 #include <userver/dump/meta.hpp>
 #include <userver/dump/operations.hpp>
@@ -30,6 +37,68 @@ USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
+namespace impl {
+
+/// Key type of the ChangeSet for the containers without `key_type`
+struct NoChangeSetKey final {};
+
+template <typename T>
+using CacheKeyTypeImpl = typename T::key_type;
+
+template <typename T>
+using CacheKeyType = meta::DetectedOr<NoChangeSetKey, CacheKeyTypeImpl, T>;
+
+template <typename T>
+using MapInsertOrAssignResult = decltype(std::declval<T&>().insert_or_assign(
+    std::declval<typename T::key_type>(),
+    std::declval<typename T::mapped_type>()
+));
+
+template <typename T>
+using MapEraseResult = decltype(std::declval<T&>().erase(std::declval<const typename T::key_type&>()));
+
+template <typename T>
+using MapFindResult = decltype(std::declval<const T&>().find(std::declval<const typename T::key_type&>()));
+
+/// Whether delta dumps may be written for the cache contents
+template <typename T, typename = void>
+inline constexpr bool kSupportsDumpDeltas = false;
+
+template <typename T>
+inline constexpr bool kSupportsDumpDeltas<
+    T,
+    std::void_t<MapInsertOrAssignResult<T>, MapEraseResult<T>, MapFindResult<T>>> =
+    dump::kIsDumpable<typename T::key_type> && dump::kIsDumpable<typename T::mapped_type>;
+
+/// The changes of the cache contents since the latest dump
+template <typename Key>
+struct DumpDeltaTracking final {
+    void Reset(bool track) {
+        is_complete = track;
+        changes = {};
+    }
+
+    void Add(const cache::ChangeSet<Key>& new_changes, std::size_t max_keys) {
+        if (!is_complete) return;
+
+        const auto keys = changes.updated.size() + changes.removed.size() + new_changes.updated.size() +
+                          new_changes.removed.size();
+        if (keys > max_keys) {
+            // A full dump is cheaper than the delta
+            Reset(false);
+            return;
+        }
+        changes.updated.insert(changes.updated.end(), new_changes.updated.begin(), new_changes.updated.end());
+        changes.removed.insert(changes.removed.end(), new_changes.removed.begin(), new_changes.removed.end());
+    }
+
+    // Whether `changes` contain all the changes since the latest dump
+    bool is_complete{false};
+    cache::ChangeSet<Key> changes;
+};
+
+}  // namespace impl
+
 // clang-format off
 
 /// @ingroup userver_components userver_base_classes
@@ -101,6 +170,13 @@ namespace components {
 ///
 /// full-update-interval = (size-of-database * 20% / removal-rate) = 400s
 ///
+/// ### Big caches and TLB misses
+///
+/// Lookups in caches of several gigabytes miss the TLB a lot. Consider
+/// utils::HugePageAllocator for the big contiguous parts of the data, e.g.
+/// `std::vector<Item, utils::HugePageAllocator<Item>>`, and watch the
+/// `anon_huge_pages_kb` metric of components::SystemStatisticsCollector.
+///
 /// ### Dealing with nullptr data in CachingComponentBase
 ///
 /// The cache can become `nullptr` through multiple ways:
@@ -132,6 +208,27 @@ namespace components {
 /// `required`    | make a synchronous update of type `first-update-type`, stop the service on failure
 /// `best-effort` | make a synchronous update of type `first-update-type`, keep working and use data from dump on failure
 ///
+/// ### Change sets and derived caches
+///
+/// A cache that knows which keys an update has changed may publish them via
+/// the @ref Set overload with a cache::ChangeSet. Caches and other components
+/// that are derived from it subscribe with @ref UpdateAndListenChanges and
+/// update only the affected entries. A `nullptr` change set means that the
+/// changes are unknown (e.g. after a full update, or on subscription) and
+/// the subscriber should recompute everything. cache::MakeChangeSet computes
+/// the change set between two snapshots of a map.
+///
+/// @snippet cache/change_set_test.cpp  Sample change set subscriber
+///
+/// ### Delta dumps
+///
+/// If `dump.max-delta-count` is set, a map-like cache with dumpable keys and
+/// values writes only the entries changed since the previous dump, as long as
+/// all the updates since then have been published via the @ref Set overload
+/// with a cache::ChangeSet and have changed less than a half of the entries.
+/// Otherwise a full dump is written. On load the full dump is read with
+/// @ref ReadContents and the deltas are applied on top of it.
+///
 /// ### testsuite-force-periodic-update
 ///  use it to enable periodic cache update for a component in testsuite environment
 ///  where testsuite-periodic-update-enabled from TestsuiteSupport config is false
@@ -161,6 +258,8 @@ public:
 
     using DataType = T;
 
+    using ChangeSetType = cache::ChangeSet<impl::CacheKeyType<T>>;
+
     /// @return cache contents. May be `nullptr` if and only if @ref MayReturnNull
     /// returns `true`.
     /// @throws cache::EmptyCacheError if the contents are `nullptr`, and
@@ -178,6 +277,17 @@ public:
 
     concurrent::AsyncEventChannel<const std::shared_ptr<const T>&>& GetEventChannel();
 
+    /// Subscribes to cache updates together with their change sets using
+    /// a member function. Also immediately invokes the function with
+    /// the current cache contents and a `nullptr` change set.
+    /// @note The change set is `nullptr` if the update has not provided it.
+    template <class Class>
+    concurrent::AsyncEventSubscriberScope UpdateAndListenChanges(
+        Class* obj,
+        std::string name,
+        void (Class::*func)(const std::shared_ptr<const T>&, const ChangeSetType*)
+    );
+
     static yaml_config::Schema GetStaticConfigSchema();
 
 protected:
@@ -191,6 +301,11 @@ protected:
     /// @overload
     void Set(T&& value);
 
+    /// @brief Sets the new value of cache, and notifies the subscribers of
+    /// @ref UpdateAndListenChanges about the keys that have changed relative to
+    /// the previous value.
+    void Set(std::unique_ptr<const T> value_ptr, ChangeSetType changes);
+
     /// @overload Set()
     template <typename... Args>
     void Emplace(Args&&... args);
@@ -222,11 +337,20 @@ private:
 
     void GetAndWrite(dump::Writer& writer) const final;
     void ReadAndSet(dump::Reader& reader) final;
+    bool GetAndWriteDelta(dump::Writer& writer) const final;
+    void ReadAndSetWithDeltas(dump::Reader& reader, const std::vector<std::unique_ptr<dump::Reader>>& deltas) final;
 
     std::shared_ptr<const T> TransformNewValue(std::unique_ptr<const T> new_value);
 
+    void DoSet(std::unique_ptr<const T> value_ptr, const ChangeSetType* changes);
+
     rcu::Variable<std::shared_ptr<const T>> cache_;
     concurrent::AsyncEventChannel<const std::shared_ptr<const T>&> event_channel_;
+    concurrent::AsyncEventChannel<const std::shared_ptr<const T>&, const ChangeSetType*> changes_channel_;
+    mutable concurrent::Variable<impl::DumpDeltaTracking<impl::CacheKeyType<T>>> dump_delta_tracking_;
+    // Set once the Dumper asks for a delta, so that the changes are not
+    // tracked if deltas are disabled
+    mutable std::atomic<bool> are_dump_deltas_requested_{false};
     utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
@@ -234,9 +358,16 @@ template <typename T>
 CachingComponentBase<T>::CachingComponentBase(const ComponentConfig& config, const ComponentContext& context)
     : ComponentBase(config, context),
       cache::CacheUpdateTrait(config, context),
-      event_channel_(components::GetCurrentComponentName(config), [this](auto& function) {
+      event_channel_(
+          components::GetCurrentComponentName(config),
+          [this](auto& function) {
+              const auto ptr = cache_.ReadCopy();
+              if (ptr) function(ptr);
+          }
+      ),
+      changes_channel_(components::GetCurrentComponentName(config), [this](auto& function) {
           const auto ptr = cache_.ReadCopy();
-          if (ptr) function(ptr);
+          if (ptr) function(ptr, nullptr);
       }) {
     const auto initial_config = GetConfig();
 }
@@ -277,6 +408,19 @@ concurrent::AsyncEventChannel<const std::shared_ptr<const T>&>& CachingComponent
     return event_channel_;
 }
 
+template <typename T>
+template <typename Class>
+concurrent::AsyncEventSubscriberScope CachingComponentBase<T>::UpdateAndListenChanges(
+    Class* obj,
+    std::string name,
+    void (Class::*func)(const std::shared_ptr<const T>&, const ChangeSetType*)
+) {
+    return changes_channel_.DoUpdateAndListen(obj, std::move(name), func, [&] {
+        auto ptr = Get();
+        (obj->*func)(ptr, nullptr);
+    });
+}
+
 template <typename T>
 utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
     return utils::SharedReadablePtr<T>(cache_.ReadCopy());
@@ -284,6 +428,16 @@ utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
 
 template <typename T>
 void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
+    DoSet(std::move(value_ptr), nullptr);
+}
+
+template <typename T>
+void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr, ChangeSetType changes) {
+    DoSet(std::move(value_ptr), &changes);
+}
+
+template <typename T>
+void CachingComponentBase<T>::DoSet(std::unique_ptr<const T> value_ptr, const ChangeSetType* changes) {
     const std::shared_ptr<const T> new_value = TransformNewValue(std::move(value_ptr));
 
     if (HasPreAssignCheck()) {
@@ -291,8 +445,20 @@ void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
         PreAssignCheck(old_value->get(), new_value.get());
     }
 
-    cache_.Assign(new_value);
+    if constexpr (impl::kSupportsDumpDeltas<T>) {
+        // Under the lock, so that a dump never misses the changes of its snapshot
+        auto tracking = dump_delta_tracking_.Lock();
+        cache_.Assign(new_value);
+        if (changes && new_value) {
+            tracking->Add(*changes, std::size(*new_value) / 2);
+        } else {
+            tracking->Reset(false);
+        }
+    } else {
+        cache_.Assign(new_value);
+    }
     event_channel_.SendEvent(new_value);
+    changes_channel_.SendEvent(new_value, changes);
     OnCacheModified();
 }
 
@@ -309,7 +475,13 @@ void CachingComponentBase<T>::Emplace(Args&&... args) {
 
 template <typename T>
 void CachingComponentBase<T>::Clear() {
-    cache_.Assign(std::make_unique<const T>());
+    if constexpr (impl::kSupportsDumpDeltas<T>) {
+        auto tracking = dump_delta_tracking_.Lock();
+        cache_.Assign(std::make_unique<const T>());
+        tracking->Reset(false);
+    } else {
+        cache_.Assign(std::make_unique<const T>());
+    }
 }
 
 template <typename T>
@@ -319,11 +491,61 @@ bool CachingComponentBase<T>::MayReturnNull() const {
 
 template <typename T>
 void CachingComponentBase<T>::GetAndWrite(dump::Writer& writer) const {
-    const auto contents = GetUnsafe();
+    const auto contents = [this] {
+        if constexpr (impl::kSupportsDumpDeltas<T>) {
+            auto tracking = dump_delta_tracking_.Lock();
+            tracking->Reset(are_dump_deltas_requested_.load());
+            return GetUnsafe();
+        } else {
+            return GetUnsafe();
+        }
+    }();
     if (!contents) throw cache::EmptyCacheError(Name());
     WriteContents(writer, *contents);
 }
 
+template <typename T>
+bool CachingComponentBase<T>::GetAndWriteDelta(dump::Writer& writer) const {
+    if constexpr (impl::kSupportsDumpDeltas<T>) {
+        are_dump_deltas_requested_ = true;
+
+        ChangeSetType changes;
+        const auto contents = [&] {
+            auto tracking = dump_delta_tracking_.Lock();
+            if (!tracking->is_complete) return utils::SharedReadablePtr<T>{nullptr};
+            changes = std::exchange(tracking->changes, {});
+            return GetUnsafe();
+        }();
+        if (!contents) return false;
+
+        std::vector<decltype(&*contents->begin())> updated;
+        std::vector<const typename T::key_type*> removed;
+        for (const auto& key : changes.updated) {
+            const auto it = contents->find(key);
+            if (it == contents->end()) {
+                removed.push_back(&key);
+            } else {
+                updated.push_back(&*it);
+            }
+        }
+        for (const auto& key : changes.removed) {
+            if (contents->find(key) == contents->end()) removed.push_back(&key);
+        }
+
+        writer.Write(updated.size());
+        for (const auto* item : updated) {
+            writer.Write(item->first);
+            writer.Write(item->second);
+        }
+        writer.Write(removed.size());
+        for (const auto* key : removed) writer.Write(*key);
+        return true;
+    } else {
+        static_cast<void>(writer);
+        return false;
+    }
+}
+
 template <typename T>
 void CachingComponentBase<T>::ReadAndSet(dump::Reader& reader) {
     auto data = ReadContents(reader);
@@ -335,6 +557,43 @@ void CachingComponentBase<T>::ReadAndSet(dump::Reader& reader) {
     Set(std::move(data));
 }
 
+template <typename T>
+void CachingComponentBase<T>::ReadAndSetWithDeltas(
+    dump::Reader& reader,
+    const std::vector<std::unique_ptr<dump::Reader>>& deltas
+) {
+    if constexpr (impl::kSupportsDumpDeltas<T>) {
+        auto base = ReadContents(reader);
+        if (!base) throw cache::EmptyCacheError(Name());
+        // ReadContents may be overridden to return a const object
+        auto data = std::make_unique<T>(*base);
+        base.reset();
+
+        for (const auto& delta : deltas) {
+            const auto updated_count = delta->Read<std::size_t>();
+            for (std::size_t i = 0; i < updated_count; ++i) {
+                auto key = delta->Read<typename T::key_type>();
+                auto value = delta->Read<typename T::mapped_type>();
+                data->insert_or_assign(std::move(key), std::move(value));
+            }
+            const auto removed_count = delta->Read<std::size_t>();
+            for (std::size_t i = 0; i < removed_count; ++i) {
+                data->erase(delta->Read<typename T::key_type>());
+            }
+        }
+
+        SetDataSizeStatistic(std::size(*data));
+        Set(std::move(data));
+        are_dump_deltas_requested_ = true;
+        auto tracking = dump_delta_tracking_.Lock();
+        tracking->Reset(true);
+    } else {
+        static_cast<void>(reader);
+        static_cast<void>(deltas);
+        dump::ThrowDumpUnimplemented(Name());
+    }
+}
+
 template <typename T>
 void CachingComponentBase<T>::WriteContents(dump::Writer& writer, const T& contents) const {
     if constexpr (dump::kIsDumpable<T>) {
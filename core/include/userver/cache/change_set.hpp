@@ -0,0 +1,66 @@
+#pragma once
+
+/// @file userver/cache/change_set.hpp
+/// @brief @copybrief cache::ChangeSet
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Keys changed by a cache update relative to the previously published
+/// cache contents.
+///
+/// Published by components::CachingComponentBase::Set alongside the new
+/// contents, so that the caches derived from it may update only the affected
+/// entries instead of recomputing everything.
+///
+/// A key may be listed more than once, e.g. if the update has fetched several
+/// versions of the same row.
+///
+/// @see components::CachingComponentBase::UpdateAndListenChanges
+template <typename Key>
+struct ChangeSet final {
+    using KeyType = Key;
+
+    /// Keys that were inserted or whose values were replaced
+    std::vector<Key> updated;
+
+    /// Keys that were removed
+    std::vector<Key> removed;
+
+    bool empty() const noexcept { return updated.empty() && removed.empty(); }
+};
+
+/// @brief Computes the change set between two snapshots of a map-like cache
+/// container, e.g. before and after a full update.
+///
+/// Takes O(old_map.size() + new_map.size()) lookups and value comparisons,
+/// which is cheaper than recomputing a derived cache from scratch in most
+/// cases.
+template <typename Map>
+ChangeSet<typename Map::key_type> MakeChangeSet(const Map& old_map, const Map& new_map) {
+    static_assert(
+        meta::kIsEqualityComparable<typename Map::mapped_type>,
+        "Values of the map must be comparable with operator== to compute the change set"
+    );
+
+    ChangeSet<typename Map::key_type> changes;
+    for (const auto& [key, value] : new_map) {
+        const auto it = old_map.find(key);
+        if (it == old_map.end() || !(it->second == value)) changes.updated.push_back(key);
+    }
+    for (const auto& [key, value] : old_map) {
+        if (new_map.find(key) == new_map.end()) changes.removed.push_back(key);
+    }
+    return changes;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
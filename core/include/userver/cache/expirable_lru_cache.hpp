@@ -5,18 +5,26 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
+#include <userver/cache/negative_cache_filter.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
 #include <userver/concurrent/mutex_set.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/datetime.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/cached_time.hpp>
-#include <userver/utils/impl/wait_token_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -47,6 +55,13 @@ impl::ExpirableValue<Value> Read(dump::Reader& reader, dump::To<impl::ExpirableV
 
 }  // namespace impl
 
+template <typename Value>
+struct SizeEstimator<impl::ExpirableValue<Value>> {
+    std::size_t operator()(const impl::ExpirableValue<Value>& value) const noexcept {
+        return SizeEstimator<Value>{}(value.value) + sizeof(value.update_time);
+    }
+};
+
 /// @ingroup userver_containers
 /// @brief Class for expirable LRU cache. Use cache::LruMap for not expirable
 /// LRU Cache.
@@ -69,12 +84,25 @@ public:
     /// see the cache::NWayLRU::NWayLRU constructor.
     ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(), const Equal& equal = Equal());
 
+    /// @param policy is the eviction policy, see cache::CachePolicy
+    ExpirableLruCache(
+        size_t ways,
+        size_t way_size,
+        CachePolicy policy,
+        const Hash& hash = Hash(),
+        const Equal& equal = Equal()
+    );
+
     ~ExpirableLruCache();
 
     /// For the description of `way_size`,
     /// see the cache::NWayLRU::NWayLRU constructor.
     void SetWaySize(size_t way_size);
 
+    /// For the description of `way_max_bytes`,
+    /// see the cache::NWayLRU::UpdateWayMaxBytes.
+    void SetWayMaxBytes(size_t way_max_bytes);
+
     std::chrono::milliseconds GetMaxLifetime() const noexcept;
 
     void SetMaxLifetime(std::chrono::milliseconds max_lifetime);
@@ -86,10 +114,57 @@ public:
      */
     void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+    /**
+     * Sets the fraction of the lifetime in (0, 1): a value that is read when
+     * less than `refresh_ahead * lifetime` is left before its expiration is
+     * updated in background, if background updates are enabled. So the keys
+     * that are read at least once per that period never expire on the
+     * request path. The default is 0.5.
+     */
+    void SetRefreshAhead(double refresh_ahead);
+
+    /**
+     * Limits the count of concurrent background updates, the updates above the
+     * limit are skipped and accounted in statistics. 0 is unlimited, the
+     * default.
+     */
+    void SetMaxBackgroundUpdates(std::size_t max_background_updates);
+
+    /**
+     * Sets for how long after the expiration a value is still returned by
+     * Get() and GetOptional() while it is being updated in background
+     * (stale-while-revalidate). 0 disables returning of expired values.
+     */
+    void SetMaxStaleness(std::chrono::milliseconds max_staleness);
+
+    /**
+     * Enables the negative cache: keys for which update_func returned an empty
+     * value (std::nullopt or nullptr) are remembered in a compact rotating
+     * Bloom filter instead of the LRU, and Get() returns an empty value for
+     * them without calling update_func. So the keys that are absent in the
+     * database neither go to the database on each lookup nor evict the useful
+     * entries.
+     *
+     * A key that is not in the LRU may be falsely reported as not found with
+     * the probability of `config.false_positive_rate`. A key is remembered for
+     * `config.lifetime / 2` to `config.lifetime`, InvalidateByKey() and
+     * Invalidate() forget all the remembered keys.
+     *
+     * Value must be std::optional or std::shared_ptr. This method is not
+     * thread-safe.
+     */
+    void SetNegativeCache(const NegativeCacheConfig& config, const Hash& hash = Hash());
+
+    /// Negative cache statistics, nullptr if SetNegativeCache() was not called
+    const impl::NegativeCacheFilter<Key, Hash>* GetNegativeCache() const noexcept;
+
     /**
      * @returns GetOptional("key", update_func) if it is not std::nullopt.
      * Otherwise the result of update_func(key) is returned, and additionally
      * stored in cache if "read_mode" is kUseCache.
+     *
+     * Concurrent misses on the same key wait for a single update_func(key)
+     * call and get its result or its exception.
      */
     Value Get(const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode = ReadMode::kUseCache);
 
@@ -97,7 +172,8 @@ public:
      * Update value in cache by "update_func" if background update mode is
      * kEnabled and "key" is in cache and not expired but its lifetime ends soon.
      * @returns value by key if key is in cache and not expired, or std::nullopt
-     * otherwise
+     * otherwise. Values that are expired for less than SetMaxStaleness() are
+     * also returned, and are updated in background.
      */
     std::optional<Value> GetOptional(const Key& key, const UpdateValueFunc& update_func);
 
@@ -128,13 +204,23 @@ public:
 
     size_t GetSizeApproximate() const;
 
+    /// Returns the estimated size of the values, see
+    /// cache::NWayLRU::GetBytesUsed
+    size_t GetBytesUsedApproximate() const;
+
+    /// Returns the count of keys that were evicted by the admission policy
+    /// instead of the least used ones, see cache::CachePolicy::kTinyLFU
+    size_t GetAdmissionRejectsApproximate() const;
+
     /// Clear cache
     void Invalidate();
 
     /// Erase key from cache
     void InvalidateByKey(const Key& key);
 
-    /// Add async task for updating value by update_func(key)
+    /// Add async task for updating value by update_func(key). Does nothing if
+    /// the key is already being updated in background or if the
+    /// SetMaxBackgroundUpdates() limit is reached.
     void UpdateInBackground(const Key& key, UpdateValueFunc update_func);
 
     void Write(dump::Writer& writer) const;
@@ -146,17 +232,39 @@ public:
     void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
 private:
+    struct InFlightUpdate final {
+        engine::SharedTaskWithResult<Value> task;
+        ReadMode read_mode;
+    };
+
     bool IsExpired(std::chrono::steady_clock::time_point update_time, std::chrono::steady_clock::time_point now) const;
 
+    bool IsStaleUsable(std::chrono::steady_clock::time_point update_time, std::chrono::steady_clock::time_point now)
+        const;
+
+    InFlightUpdate JoinOrStartUpdate(const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode);
+
     bool ShouldUpdate(std::chrono::steady_clock::time_point update_time, std::chrono::steady_clock::time_point now)
         const;
 
+    // Returns true if the value is empty and the key was remembered by the
+    // negative cache instead of the LRU
+    bool RememberIfNotFound(const Key& key, const Value& value);
+
     cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
     std::atomic<std::chrono::milliseconds> max_lifetime_{std::chrono::milliseconds(0)};
     std::atomic<BackgroundUpdateMode> background_update_mode_{BackgroundUpdateMode::kDisabled};
+    std::atomic<std::chrono::milliseconds> max_staleness_{std::chrono::milliseconds(0)};
+    std::atomic<double> refresh_ahead_{0.5};
+    std::atomic<std::size_t> max_background_updates_{0};
+    std::unique_ptr<impl::NegativeCacheFilter<Key, Hash>> negative_cache_;
     impl::ExpirableLruCacheStatistics stats_;
     concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
-    utils::impl::WaitTokenStorage wait_token_storage_;
+    concurrent::Variable<std::unordered_set<Key, Hash, Equal>> background_update_keys_;
+    // Cancels the background updates, they use the fields above
+    concurrent::BackgroundTaskStorageCore background_updates_;
+    // Destroyed first, cancels the updates that nobody waits for
+    concurrent::Variable<std::unordered_map<Key, InFlightUpdate, Hash, Equal>> in_flight_updates_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -166,11 +274,23 @@ ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
     const Hash& hash,
     const Equal& equal
 )
-    : lru_(ways, way_size, hash, equal), mutex_set_{ways, way_size, hash, equal} {}
+    : ExpirableLruCache(ways, way_size, CachePolicy::kLRU, hash, equal) {}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
+    size_t ways,
+    size_t way_size,
+    CachePolicy policy,
+    const Hash& hash,
+    const Equal& equal
+)
+    : lru_(ways, way_size, policy, hash, equal),
+      mutex_set_{ways, way_size, hash, equal},
+      background_update_keys_(0, hash, equal) {}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
-    wait_token_storage_.WaitForAllTokens();
+    background_updates_.CancelAndWait();
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -178,6 +298,11 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
     lru_.UpdateWaySize(way_size);
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWayMaxBytes(size_t way_max_bytes) {
+    lru_.UpdateWayMaxBytes(way_max_bytes);
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::chrono::milliseconds ExpirableLruCache<Key, Value, Hash, Equal>::GetMaxLifetime() const noexcept {
     return max_lifetime_.load();
@@ -193,34 +318,97 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(BackgroundU
     background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetRefreshAhead(double refresh_ahead) {
+    UASSERT(refresh_ahead > 0 && refresh_ahead < 1);
+    refresh_ahead_ = refresh_ahead;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetMaxBackgroundUpdates(std::size_t max_background_updates) {
+    max_background_updates_ = max_background_updates;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetMaxStaleness(std::chrono::milliseconds max_staleness) {
+    max_staleness_ = max_staleness;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetNegativeCache(const NegativeCacheConfig& config, const Hash& hash) {
+    static_assert(impl::kIsNullable<Value>, "Negative cache requires std::optional or std::shared_ptr Value");
+    negative_cache_ = std::make_unique<impl::NegativeCacheFilter<Key, Hash>>(config, hash);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const impl::NegativeCacheFilter<Key, Hash>* ExpirableLruCache<Key, Value, Hash, Equal>::GetNegativeCache(
+) const noexcept {
+    return negative_cache_.get();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key,
     const UpdateValueFunc& update_func,
     ReadMode read_mode
 ) {
-    auto now = utils::datetime::SteadyNow();
     auto opt_old_value = GetOptional(key, update_func);
     if (opt_old_value) {
         return std::move(*opt_old_value);
     }
 
-    auto mutex = mutex_set_.GetMutexForKey(key);
-    std::lock_guard lock(mutex);
-    // Test one more time - concurrent ExpirableLruCache::Get()
-    // might have put the value
-    auto old_value = lru_.Get(key);
-    if (old_value && !IsExpired(old_value->update_time, now)) {
-        return std::move(old_value->value);
+    if constexpr (impl::kIsNullable<Value>) {
+        if (negative_cache_ && read_mode == ReadMode::kUseCache && negative_cache_->Has(key)) {
+            return Value{};
+        }
     }
 
-    auto value = update_func(key);
-    if (read_mode == ReadMode::kUseCache) {
-        lru_.Put(key, {value, now});
+    auto update = JoinOrStartUpdate(key, update_func, read_mode);
+    const utils::FastScopeGuard erase_finished_guard([this, &key]() noexcept {
+        auto in_flight_updates = in_flight_updates_.Lock();
+        const auto it = in_flight_updates->find(key);
+        if (it != in_flight_updates->end() && it->second.task.IsFinished()) in_flight_updates->erase(it);
+    });
+
+    auto value = update.task.Get();
+    if (read_mode == ReadMode::kUseCache && update.read_mode == ReadMode::kSkipCache &&
+        !RememberIfNotFound(key, value)) {
+        lru_.Put(key, {value, utils::datetime::SteadyNow()});
     }
     return value;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename ExpirableLruCache<Key, Value, Hash, Equal>::InFlightUpdate
+ExpirableLruCache<Key, Value, Hash, Equal>::JoinOrStartUpdate(
+    const Key& key,
+    const UpdateValueFunc& update_func,
+    ReadMode read_mode
+) {
+    auto in_flight_updates = in_flight_updates_.Lock();
+    auto& update = (*in_flight_updates)[key];
+    if (update.task.IsValid() && !update.task.IsFinished()) return update;
+
+    update.read_mode = read_mode;
+    update.task = utils::SharedAsync("expirable-lru-cache-update", [this, key, update_func, read_mode] {
+        auto mutex = mutex_set_.GetMutexForKey(key);
+        std::lock_guard lock(mutex);
+        const auto now = utils::datetime::SteadyNow();
+        // Test one more time - a background update might have put the value
+        auto old_value = lru_.Get(key);
+        if (old_value && !IsExpired(old_value->update_time, now)) {
+            return std::move(old_value->value);
+        }
+
+        auto value = update_func(key);
+        if (read_mode == ReadMode::kUseCache && !RememberIfNotFound(key, value)) {
+            lru_.Put(key, {value, now});
+        }
+        return value;
+    });
+    return update;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::optional<Value>
 ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(const Key& key, const UpdateValueFunc& update_func) {
@@ -238,6 +426,11 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(const Key& key, const Up
             return std::move(old_value->value);
         } else {
             impl::CacheStale(stats_);
+
+            if (IsStaleUsable(old_value->update_time, now)) {
+                UpdateInBackground(key, update_func);
+                return std::move(old_value->value);
+            }
         }
     }
     impl::CacheMiss(stats_);
@@ -319,23 +512,52 @@ size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
     return lru_.GetSize();
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetBytesUsedApproximate() const {
+    return lru_.GetBytesUsed();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetAdmissionRejectsApproximate() const {
+    return lru_.GetAdmissionRejects();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
     lru_.Invalidate();
+    if (negative_cache_) negative_cache_->Clear();
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::InvalidateByKey(const Key& key) {
     lru_.InvalidateByKey(key);
+    // A single key could not be removed from a Bloom filter
+    if (negative_cache_) negative_cache_->Clear();
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(const Key& key, UpdateValueFunc update_func) {
+    const auto max_background_updates = max_background_updates_.load();
+    if (max_background_updates != 0 &&
+        static_cast<std::size_t>(background_updates_.ActiveTasksApprox()) >= max_background_updates) {
+        impl::CacheBackgroundUpdateSkipped(stats_);
+        return;
+    }
+    {
+        // A hot key is read many times before its update finishes
+        auto keys = background_update_keys_.Lock();
+        if (!keys->insert(key).second) return;
+    }
+
     stats_.total.background_updates++;
     stats_.recent.GetCurrentCounter().background_updates++;
 
-    // cache will wait for all detached tasks in ~ExpirableLruCache()
-    engine::AsyncNoSpan([token = wait_token_storage_.GetToken(), this, key, update_func = std::move(update_func)] {
+    background_updates_.Detach(engine::AsyncNoSpan([this, key, update_func = std::move(update_func)] {
+        const utils::FastScopeGuard erase_key_guard([this, &key]() noexcept {
+            auto keys = background_update_keys_.Lock();
+            keys->erase(key);
+        });
+
         auto mutex = mutex_set_.GetMutexForKey(key);
         std::unique_lock lock(mutex, std::try_to_lock);
         if (!lock) {
@@ -345,8 +567,12 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(const Key& k
 
         auto now = utils::datetime::SteadyNow();
         auto value = update_func(key);
-        lru_.Put(key, {value, now});
-    }).Detach();
+        if (RememberIfNotFound(key, value)) {
+            lru_.InvalidateByKey(key);
+        } else {
+            lru_.Put(key, {value, now});
+        }
+    }));
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -358,14 +584,37 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::IsExpired(
     return max_lifetime.count() != 0 && update_time + max_lifetime < now;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::IsStaleUsable(
+    std::chrono::steady_clock::time_point update_time,
+    std::chrono::steady_clock::time_point now
+) const {
+    auto max_lifetime = max_lifetime_.load();
+    auto max_staleness = max_staleness_.load();
+    return max_lifetime.count() != 0 && max_staleness.count() != 0 && update_time + max_lifetime + max_staleness >= now;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
     std::chrono::steady_clock::time_point update_time,
     std::chrono::steady_clock::time_point now
 ) const {
     auto max_lifetime = max_lifetime_.load();
+    const auto update_after =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(max_lifetime * (1 - refresh_ahead_.load()));
     return (background_update_mode_.load() == BackgroundUpdateMode::kEnabled) && max_lifetime.count() != 0 &&
-           update_time + max_lifetime / 2 < now;
+           update_time + update_after < now;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::RememberIfNotFound(const Key& key, const Value& value) {
+    if constexpr (impl::kIsNullable<Value>) {
+        if (negative_cache_ && !value) {
+            negative_cache_->Add(key);
+            return true;
+        }
+    }
+    return false;
 }
 
 template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
@@ -418,7 +667,12 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetDumper(std::shared_ptr<dump:
 template <typename Key, typename Value, typename Hash, typename Equal>
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCache<Key, Value, Hash, Equal>& cache) {
     writer["current-documents-count"] = cache.GetSizeApproximate();
+    writer["admission-rejects"] = cache.GetAdmissionRejectsApproximate();
+    writer["bytes-used"] = cache.GetBytesUsedApproximate();
     writer = cache.GetStatistics();
+    if (const auto* negative_cache = cache.GetNegativeCache()) {
+        writer["negative-cache"] = *negative_cache;
+    }
 }
 
 }  // namespace cache
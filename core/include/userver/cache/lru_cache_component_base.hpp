@@ -4,6 +4,7 @@
 /// @brief @copybrief cache::LruCacheComponent
 
 #include <functional>
+#include <stdexcept>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/cache/lru_cache_config.hpp>
@@ -57,9 +58,18 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
+/// max-bytes | max estimated size of the values in bytes, see cache::SizeEstimator; only for the `lru` policy (0 is unlimited) | 0
 /// ways | number of ways for associative cache | --
+/// policy | eviction policy: `lru` or `tiny-lfu` (W-TinyLFU, see cache::CachePolicy::kTinyLFU) | lru
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
+/// background-update | enables asynchronous updates for expiring values | false
+/// refresh-ahead | a value read when less than this fraction of `lifetime` is left is updated in background, see cache::ExpirableLruCache::SetRefreshAhead | 0.5
+/// max-background-updates | max count of concurrent background updates (0 is unlimited) | 0
+/// max-staleness | for how long expired values are returned while they are updated in background (0 is never) | 0
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
+/// negative-cache.size | expected count of the not found keys per `negative-cache.lifetime`, enables the negative cache for std::optional and std::shared_ptr values, see cache::ExpirableLruCache::SetNegativeCache | --
+/// negative-cache.false-positive-rate | probability of a found key being reported as not found | 0.01
+/// negative-cache.lifetime | for how long a not found key is remembered | 60s
 ///
 /// ## Example usage:
 ///
@@ -90,13 +100,17 @@ public:
 protected:
     virtual Value DoGetByKey(const Key& key) = 0;
 
+    /// Called on a cache miss, calls DoGetByKey by default. May be overridden
+    /// to consult another cache tier before DoGetByKey.
+    virtual Value GetByKey(const Key& key);
+
     std::shared_ptr<Cache> GetCacheRaw() { return cache_; }
 
+    const std::string& GetName() const noexcept { return name_; }
+
 private:
     void DropCache();
 
-    Value GetByKey(const Key& key);
-
     void OnConfigUpdate(const dynamic_config::Snapshot& cfg);
 
     void UpdateConfig(const LruCacheConfig& config);
@@ -126,7 +140,9 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
     : ComponentBase(config, context),
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
-      cache_(std::make_shared<Cache>(static_config_.ways, static_config_.GetWaySize())) {
+      cache_(std::make_shared<Cache>(static_config_.ways, static_config_.GetWaySize(), static_config_.policy)) {
+    cache_->SetWayMaxBytes(static_config_.config.GetWayMaxBytes(static_config_.ways));
+
     if (impl::IsDumpSupportEnabled(config)) {
         dumper_ = std::make_shared<dump::Dumper>(config, context, static_cast<dump::DumpableEntity&>(*this));
         cache_->SetDumper(dumper_);
@@ -135,6 +151,17 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
     cache_->SetMaxLifetime(static_config_.config.lifetime);
     cache_->SetBackgroundUpdate(static_config_.config.background_update);
+    cache_->SetRefreshAhead(static_config_.config.refresh_ahead);
+    cache_->SetMaxBackgroundUpdates(static_config_.config.max_background_updates);
+    cache_->SetMaxStaleness(static_config_.config.max_staleness);
+
+    if (static_config_.negative_cache) {
+        if constexpr (impl::kIsNullable<Value>) {
+            cache_->SetNegativeCache(*static_config_.negative_cache);
+        } else {
+            throw std::runtime_error("negative-cache requires std::optional or std::shared_ptr values, cache=" + name_);
+        }
+    }
 
     if (static_config_.use_dynamic_config) {
         LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -199,6 +226,12 @@ void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(const LruCacheConf
     cache_->SetWaySize(config.GetWaySize(static_config_.ways));
     cache_->SetMaxLifetime(config.lifetime);
     cache_->SetBackgroundUpdate(config.background_update);
+    cache_->SetRefreshAhead(config.refresh_ahead);
+    cache_->SetMaxBackgroundUpdates(config.max_background_updates);
+    cache_->SetMaxStaleness(config.max_staleness);
+    if (static_config_.policy == CachePolicy::kLRU) {
+        cache_->SetWayMaxBytes(config.GetWayMaxBytes(static_config_.ways));
+    }
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -5,6 +5,7 @@
 #include <optional>
 #include <unordered_map>
 
+#include <userver/cache/policy.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -27,13 +28,40 @@ struct LruCacheConfig final {
 
     std::size_t GetWaySize(std::size_t ways) const;
 
+    /// 0 if the size in bytes is not limited
+    std::size_t GetWayMaxBytes(std::size_t ways) const;
+
     std::size_t size;
+    std::size_t max_bytes;
     std::chrono::milliseconds lifetime;
     BackgroundUpdateMode background_update;
+    std::chrono::milliseconds max_staleness;
+    /// Background update starts when less than this fraction of the lifetime
+    /// is left
+    double refresh_ahead;
+    /// 0 if the count of concurrent background updates is not limited
+    std::size_t max_background_updates;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCacheConfig>);
 
+CachePolicy Parse(const yaml_config::YamlConfig& value, formats::parse::To<CachePolicy>);
+
+/// Settings of the not found keys filter, see
+/// cache::ExpirableLruCache::SetNegativeCache
+struct NegativeCacheConfig final {
+    /// Expected count of the not found keys per `lifetime`
+    std::size_t size{0};
+    /// Probability that a key is falsely reported as not found when `size`
+    /// keys are remembered
+    double false_positive_rate{0.01};
+    /// For how long a not found key is remembered, a key is forgotten after
+    /// `lifetime / 2` at the earliest
+    std::chrono::milliseconds lifetime{std::chrono::seconds{60}};
+};
+
+NegativeCacheConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<NegativeCacheConfig>);
+
 struct LruCacheConfigStatic final {
     explicit LruCacheConfigStatic(const yaml_config::YamlConfig& config);
     explicit LruCacheConfigStatic(const components::ComponentConfig& config);
@@ -42,7 +70,9 @@ struct LruCacheConfigStatic final {
 
     LruCacheConfig config;
     std::size_t ways;
+    CachePolicy policy;
     bool use_dynamic_config;
+    std::optional<NegativeCacheConfig> negative_cache;
 };
 
 extern const dynamic_config::Key<std::unordered_map<std::string, LruCacheConfig>> kLruCacheConfigSet;
@@ -16,6 +16,7 @@ struct ExpirableLruCacheStatisticsBase final {
     std::atomic<std::size_t> misses{0};
     std::atomic<std::size_t> stale{0};
     std::atomic<std::size_t> background_updates{0};
+    std::atomic<std::size_t> background_updates_skipped{0};
 
     ExpirableLruCacheStatisticsBase();
 
@@ -39,6 +40,8 @@ void CacheMiss(ExpirableLruCacheStatistics& stats);
 
 void CacheStale(ExpirableLruCacheStatistics& stats);
 
+void CacheBackgroundUpdateSkipped(ExpirableLruCacheStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatistics& stats);
 
 }  // namespace cache::impl
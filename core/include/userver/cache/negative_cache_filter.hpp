@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+#include <userver/cache/lru_cache_config.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/filter_bloom.hpp>
+#include <userver/utils/meta_light.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// Values that may represent a not found key: an empty value means
+/// "not found".
+template <typename Value>
+inline constexpr bool kIsNullable =
+    meta::kIsInstantiationOf<std::optional, Value> || meta::kIsInstantiationOf<std::shared_ptr, Value>;
+
+/// Count of the filter counters to get `false_positive_rate` with `size` keys
+std::size_t GetNegativeCacheCountersCount(std::size_t size, double false_positive_rate);
+
+// FilterBloom requires two different hash functions, the second one is derived
+// from the user-provided one to avoid any requirements on the Key type
+template <typename Key, typename Hash>
+struct NegativeCacheSecondHash final {
+    auto operator()(const Key& key) const {
+        auto hash_value = hash(key);
+        // murmur3 finalizer
+        std::uint64_t mixed = hash_value;
+        mixed ^= mixed >> 33;
+        mixed *= 0xff51afd7ed558ccdULL;
+        mixed ^= mixed >> 33;
+        mixed *= 0xc4ceb9fe1a85ec53ULL;
+        mixed ^= mixed >> 33;
+        return static_cast<decltype(hash_value)>(mixed);
+    }
+
+    Hash hash;
+};
+
+/// Remembers not found keys for `lifetime / 2` to `lifetime`.
+///
+/// Two Bloom filter generations are kept: keys are added to the current one
+/// and looked up in both. Every `lifetime / 2` the older generation is cleared
+/// and becomes the current one, so the filter never saturates and forgets the
+/// keys that were created in the database meanwhile.
+template <typename Key, typename Hash>
+class NegativeCacheFilter final {
+public:
+    NegativeCacheFilter(const NegativeCacheConfig& config, const Hash& hash)
+        : counters_count_(GetNegativeCacheCountersCount(config.size, config.false_positive_rate)),
+          generation_lifetime_(config.lifetime / 2),
+          generations_{
+              Filter{counters_count_, hash, SecondHash{hash}},
+              Filter{counters_count_, hash, SecondHash{hash}}},
+          rotated_at_(utils::datetime::SteadyNow()) {}
+
+    /// Returns true if the key was remembered as not found, may be a false
+    /// positive
+    bool Has(const Key& key) {
+        std::lock_guard lock(mutex_);
+        RotateIfNeeded();
+        const bool has = generations_[current_].Has(key) || generations_[current_ ^ 1].Has(key);
+        if (has) ++hits_;
+        return has;
+    }
+
+    void Add(const Key& key) {
+        std::lock_guard lock(mutex_);
+        RotateIfNeeded();
+        auto& current = generations_[current_];
+        if (current.Has(key)) return;
+        current.Increment(key);
+        ++current_keys_;
+    }
+
+    void Clear() {
+        std::lock_guard lock(mutex_);
+        for (auto& generation : generations_) generation.Clear();
+        current_keys_ = 0;
+        previous_keys_ = 0;
+        rotated_at_ = utils::datetime::SteadyNow();
+    }
+
+    /// Count of the remembered keys, including the ones in the previous
+    /// generation
+    std::size_t GetSizeApproximate() const noexcept { return current_keys_.load() + previous_keys_.load(); }
+
+    std::size_t GetHits() const noexcept { return hits_.load(); }
+
+    std::size_t GetBytesUsed() const noexcept { return counters_count_ * sizeof(Counter) * 2; }
+
+private:
+    // Overflow of a counter makes a false negative, that only costs an extra
+    // update of the key
+    using Counter = std::uint8_t;
+    using SecondHash = NegativeCacheSecondHash<Key, Hash>;
+    using Filter = utils::FilterBloom<Key, Counter, Hash, SecondHash>;
+
+    void RotateIfNeeded() {
+        const auto now = utils::datetime::SteadyNow();
+        if (now - rotated_at_ < generation_lifetime_) return;
+
+        current_ ^= 1;
+        generations_[current_].Clear();
+        if (now - rotated_at_ < generation_lifetime_ * 2) {
+            previous_keys_ = current_keys_.load();
+        } else {
+            // Both generations are outdated
+            generations_[current_ ^ 1].Clear();
+            previous_keys_ = 0;
+        }
+        current_keys_ = 0;
+        rotated_at_ = now;
+    }
+
+    const std::size_t counters_count_;
+    const std::chrono::milliseconds generation_lifetime_;
+
+    engine::Mutex mutex_;
+    Filter generations_[2];
+    std::size_t current_{0};
+    std::chrono::steady_clock::time_point rotated_at_;
+
+    std::atomic<std::size_t> current_keys_{0};
+    std::atomic<std::size_t> previous_keys_{0};
+    std::atomic<std::size_t> hits_{0};
+};
+
+template <typename Key, typename Hash>
+void DumpMetric(utils::statistics::Writer& writer, const NegativeCacheFilter<Key, Hash>& filter) {
+    writer["hits"] = filter.GetHits();
+    writer["keys"] = filter.GetSizeApproximate();
+    writer["bytes-used"] = filter.GetBytesUsed();
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
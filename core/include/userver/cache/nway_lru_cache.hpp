@@ -2,14 +2,19 @@
 
 #include <functional>
 #include <optional>
+#include <stdexcept>
+#include <variant>
 #include <vector>
 
 #include <boost/container_hash/hash.hpp>
 
 #include <userver/cache/lru_map.hpp>
+#include <userver/cache/policy.hpp>
+#include <userver/cache/size_estimator.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,6 +39,15 @@ public:
     /// The maximum total number of elements is `ways * way_size`.
     NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(), const Equal& equal = Equal());
 
+    /// @param policy is the eviction policy of each way, see cache::CachePolicy
+    NWayLRU(
+        size_t ways,
+        size_t way_size,
+        CachePolicy policy,
+        const Hash& hash = Hash(),
+        const Equal& equal = Equal()
+    );
+
     void Put(const T& key, U value);
 
     template <typename Validator>
@@ -55,10 +69,27 @@ public:
 
     size_t GetSize() const;
 
+    /// Returns the count of keys that were evicted by the admission policy
+    /// instead of the least used ones, see cache::CachePolicy::kTinyLFU
+    size_t GetAdmissionRejects() const;
+
     /// For the description of `way_size`,
     /// see the cache::NWayLRU::NWayLRU constructor.
     void UpdateWaySize(size_t way_size);
 
+    /// @brief Limits the total size of the values per way, as estimated by
+    /// cache::SizeEstimator. When the limit is reached, the least recently
+    /// used elements are evicted. The values larger than the limit are not
+    /// stored at all. 0 means no limit.
+    ///
+    /// The maximum total size of the values is `ways * way_max_bytes`.
+    /// @throws std::logic_error if the policy is not CachePolicy::kLRU
+    void UpdateWayMaxBytes(size_t way_max_bytes);
+
+    /// Returns the estimated total size of the values, always 0 if the size
+    /// is not limited, see cache::NWayLRU::UpdateWayMaxBytes.
+    size_t GetBytesUsed() const;
+
     void Write(dump::Writer& writer) const;
     void Read(dump::Reader& reader);
 
@@ -68,17 +99,45 @@ public:
 
 private:
     struct Way {
-        Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
+        using Lru = LruMap<T, U, Hash, Equal, CachePolicy::kLRU>;
+        using TinyLfu = LruMap<T, U, Hash, Equal, CachePolicy::kTinyLFU>;
+
+        Way(Way&& other) noexcept
+            : cache(std::move(other.cache)), bytes_used(other.bytes_used), max_bytes(other.max_bytes) {}
 
         // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-        Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+        Way(CachePolicy policy, const Hash& hash, const Equal& equal) : cache(MakeCache(policy, hash, equal)) {}
+
+        template <typename Func>
+        decltype(auto) Visit(Func&& func) {
+            return std::visit(std::forward<Func>(func), cache);
+        }
+
+        template <typename Func>
+        decltype(auto) Visit(Func&& func) const {
+            return std::visit(std::forward<Func>(func), cache);
+        }
+
+        static std::variant<Lru, TinyLfu> MakeCache(CachePolicy policy, const Hash& hash, const Equal& equal) {
+            if (policy == CachePolicy::kTinyLFU) {
+                return std::variant<Lru, TinyLfu>{std::in_place_type<TinyLfu>, 1, hash, equal};
+            }
+            return std::variant<Lru, TinyLfu>{std::in_place_type<Lru>, 1, hash, equal};
+        }
 
         mutable engine::Mutex mutex;
-        LruMap<T, U, Hash, Equal> cache;
+        std::variant<Lru, TinyLfu> cache;
+        // Only tracked if max_bytes is set, the policy is kLRU then
+        size_t bytes_used{0};
+        size_t max_bytes{0};
     };
 
     Way& GetWay(const T& key);
 
+    static void PutLimitedInBytes(Way& way, const T& key, U value);
+    static void EraseLimitedInBytes(Way& way, const T& key);
+    static void EvictLeastUsed(Way& way);
+
     void NotifyDumper();
 
     std::vector<Way> caches_;
@@ -88,12 +147,18 @@ private:
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash, const Eq& equal)
+    : NWayLRU(ways, way_size, CachePolicy::kLRU, hash, equal) {}
+
+template <typename T, typename U, typename Hash, typename Eq>
+NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, CachePolicy policy, const Hash& hash, const Eq& equal)
     : caches_(), hash_fn_(hash) {
     caches_.reserve(ways);
-    for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+    for (size_t i = 0; i < ways; ++i) caches_.emplace_back(policy, hash, equal);
     if (ways == 0) throw std::logic_error("Ways must be positive");
 
-    for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+    for (auto& way : caches_) {
+        way.Visit([way_size](auto& cache) { cache.SetMaxSize(way_size); });
+    }
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -101,7 +166,11 @@ void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
     auto& way = GetWay(key);
     {
         std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Put(key, std::move(value));
+        if (way.max_bytes != 0) {
+            PutLimitedInBytes(way, key, std::move(value));
+        } else {
+            way.Visit([&](auto& cache) { cache.Put(key, std::move(value)); });
+        }
     }
     NotifyDumper();
 }
@@ -111,14 +180,17 @@ template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key, Validator validator) {
     auto& way = GetWay(key);
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    auto* value = way.cache.Get(key);
+    return way.Visit([&](auto& cache) -> std::optional<U> {
+        auto* value = cache.Get(key);
 
-    if (value) {
-        if (validator(*value)) return *value;
-        way.cache.Erase(key);
-    }
+        if (value) {
+            if (validator(*value)) return *value;
+            way.bytes_used -= way.max_bytes != 0 ? SizeEstimator<U>{}(*value) : 0;
+            cache.Erase(key);
+        }
 
-    return std::nullopt;
+        return std::nullopt;
+    });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -126,7 +198,11 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
     auto& way = GetWay(key);
     {
         std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Erase(key);
+        if (way.max_bytes != 0) {
+            EraseLimitedInBytes(way, key);
+        } else {
+            way.Visit([&key](auto& cache) { cache.Erase(key); });
+        }
     }
     NotifyDumper();
 }
@@ -135,14 +211,15 @@ template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
     auto& way = GetWay(key);
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    return way.cache.GetOr(key, default_value);
+    return way.Visit([&](auto& cache) { return cache.GetOr(key, default_value); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
     for (auto& way : caches_) {
         std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Clear();
+        way.Visit([](auto& cache) { cache.Clear(); });
+        way.bytes_used = 0;
     }
     NotifyDumper();
 }
@@ -152,7 +229,7 @@ template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
     for (const auto& way : caches_) {
         std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.VisitAll(func);
+        way.Visit([&func](const auto& cache) { cache.VisitAll(func); });
     }
 }
 
@@ -161,19 +238,101 @@ size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
     size_t size{0};
     for (const auto& way : caches_) {
         std::unique_lock<engine::Mutex> lock(way.mutex);
-        size += way.cache.GetSize();
+        size += way.Visit([](const auto& cache) { return cache.GetSize(); });
     }
     return size;
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetAdmissionRejects() const {
+    size_t rejects{0};
+    for (const auto& way : caches_) {
+        std::unique_lock<engine::Mutex> lock(way.mutex);
+        rejects += way.Visit([](const auto& cache) { return cache.GetAdmissionRejects(); });
+    }
+    return rejects;
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
     for (auto& way : caches_) {
         std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.SetMaxSize(way_size);
+        if (way.max_bytes != 0) {
+            // Evict explicitly to keep bytes_used in sync
+            auto& cache = std::get<typename Way::Lru>(way.cache);
+            while (cache.GetSize() > way_size) EvictLeastUsed(way);
+        }
+        way.Visit([way_size](auto& cache) { cache.SetMaxSize(way_size); });
     }
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::UpdateWayMaxBytes(size_t way_max_bytes) {
+    for (auto& way : caches_) {
+        std::unique_lock<engine::Mutex> lock(way.mutex);
+        auto* cache = std::get_if<typename Way::Lru>(&way.cache);
+        if (!cache) {
+            if (way_max_bytes == 0) continue;
+            throw std::logic_error("Size limit in bytes is only supported for the LRU policy");
+        }
+
+        if (way.max_bytes == 0 && way_max_bytes != 0) {
+            way.bytes_used = 0;
+            cache->VisitAll([&way](const T&, const U& value) { way.bytes_used += SizeEstimator<U>{}(value); });
+        }
+        way.max_bytes = way_max_bytes;
+        if (way_max_bytes == 0) {
+            way.bytes_used = 0;
+            continue;
+        }
+        while (way.bytes_used > way.max_bytes) EvictLeastUsed(way);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetBytesUsed() const {
+    size_t bytes_used{0};
+    for (const auto& way : caches_) {
+        std::unique_lock<engine::Mutex> lock(way.mutex);
+        bytes_used += way.bytes_used;
+    }
+    return bytes_used;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::PutLimitedInBytes(Way& way, const T& key, U value) {
+    auto& cache = std::get<typename Way::Lru>(way.cache);
+    EraseLimitedInBytes(way, key);
+
+    const auto value_bytes = SizeEstimator<U>{}(value);
+    if (value_bytes > way.max_bytes) return;
+
+    // LruMap must not evict by itself, otherwise the evicted bytes are lost
+    while (cache.GetSize() >= cache.GetCapacity() || way.bytes_used + value_bytes > way.max_bytes) {
+        EvictLeastUsed(way);
+    }
+    cache.Put(key, std::move(value));
+    way.bytes_used += value_bytes;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::EraseLimitedInBytes(Way& way, const T& key) {
+    auto& cache = std::get<typename Way::Lru>(way.cache);
+    if (const auto* value = cache.Get(key)) {
+        way.bytes_used -= SizeEstimator<U>{}(*value);
+        cache.Erase(key);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::EvictLeastUsed(Way& way) {
+    auto& cache = std::get<typename Way::Lru>(way.cache);
+    const auto* key = cache.GetLeastUsedKey();
+    UASSERT(key);
+    way.bytes_used -= SizeEstimator<U>{}(*cache.GetLeastUsed());
+    cache.Erase(*key);
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(const T& key) {
     /// It is needed to twist hash because there is hash map in LruMap. Otherwise
@@ -193,11 +352,13 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
     for (const Way& way : caches_) {
         std::unique_lock<engine::Mutex> lock(way.mutex);
 
-        writer.Write(way.cache.GetSize());
+        way.Visit([&writer](const auto& cache) {
+            writer.Write(cache.GetSize());
 
-        way.cache.VisitAll([&writer](const T& key, const U& value) {
-            writer.Write(key);
-            writer.Write(value);
+            cache.VisitAll([&writer](const T& key, const U& value) {
+                writer.Write(key);
+                writer.Write(value);
+            });
         });
     }
 }
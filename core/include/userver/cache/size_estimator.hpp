@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file userver/cache/size_estimator.hpp
+/// @brief @copybrief cache::SizeEstimator
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Estimates the memory used by a cache value, used by the caches
+/// limited in bytes, see cache::NWayLRU::UpdateWayMaxBytes.
+///
+/// The default estimation is `sizeof(T)`. Specialize the template for the
+/// value types that own heap memory:
+/// @code
+/// template <>
+/// struct cache::SizeEstimator<MyValue> {
+///     std::size_t operator()(const MyValue& value) const noexcept {
+///         return sizeof(value) + value.payload.capacity();
+///     }
+/// };
+/// @endcode
+template <typename T>
+struct SizeEstimator {
+    std::size_t operator()(const T& value) const noexcept { return sizeof(value); }
+};
+
+template <typename Char, typename Traits, typename Allocator>
+struct SizeEstimator<std::basic_string<Char, Traits, Allocator>> {
+    std::size_t operator()(const std::basic_string<Char, Traits, Allocator>& value) const noexcept {
+        return sizeof(value) + value.capacity() * sizeof(Char);
+    }
+};
+
+template <typename T, typename Allocator>
+struct SizeEstimator<std::vector<T, Allocator>> {
+    std::size_t operator()(const std::vector<T, Allocator>& value) const noexcept {
+        std::size_t size = sizeof(value) + (value.capacity() - value.size()) * sizeof(T);
+        for (const auto& item : value) size += SizeEstimator<T>{}(item);
+        return size;
+    }
+};
+
+template <typename T>
+struct SizeEstimator<std::shared_ptr<T>> {
+    std::size_t operator()(const std::shared_ptr<T>& value) const noexcept {
+        return sizeof(value) + (value ? SizeEstimator<std::remove_const_t<T>>{}(*value) : 0);
+    }
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
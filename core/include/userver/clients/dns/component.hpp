@@ -33,6 +33,9 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-negative-ttl | TTL for caching of the replies stating that the name does not exist | 5s
+/// preload-names | names to resolve on startup and to refresh in background before their expiration | []
+/// preload-refresh-interval | interval of the preloaded names expiration checks | 1s
 ///
 /// ## Static configuration example:
 ///
@@ -39,6 +39,15 @@ struct ResolverConfig {
 
     /// Network cache failure TTL
     std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+    /// Network cache TTL for the replies stating that the name does not exist
+    std::chrono::milliseconds cache_negative_ttl{std::chrono::seconds{5}};
+
+    /// Names to resolve on startup and to keep fresh in the network cache
+    std::vector<std::string> preload_names;
+
+    /// Interval of the preloaded names expiration checks
+    std::chrono::milliseconds preload_refresh_interval{std::chrono::seconds{1}};
 };
 
 }  // namespace clients::dns
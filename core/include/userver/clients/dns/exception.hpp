@@ -27,6 +27,12 @@ public:
     using ResolverException::ResolverException;
 };
 
+/// Authoritative negative reply: the name does not exist or has no addresses
+class NameNotFoundException : public NotResolvedException {
+public:
+    using NotResolvedException::NotResolvedException;
+};
+
 /// Configuration error
 class InvalidConfigException : public ResolverException {
 public:
@@ -64,7 +64,7 @@ public:
 
 private:
     class Impl;
-    constexpr static size_t kSize = 1728;
+    constexpr static size_t kSize = 2400;
     constexpr static size_t kAlignment = 16;
     utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
@@ -7,7 +7,9 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -33,6 +35,7 @@ namespace curl {
 class easy;
 class multi;
 class ConnectRateLimiter;
+class share;
 }  // namespace curl
 
 namespace engine::ev {
@@ -124,7 +127,23 @@ public:
     /// (most likely getaddrinfo).
     void SetDnsResolver(clients::dns::Resolver* resolver);
 
+    /// @brief Opens `connections_per_thread` connections to the host of `url`
+    /// in each of the IO threads by sending HEAD requests to it, so that the
+    /// following requests reuse the connections and do not wait for TCP and
+    /// TLS handshakes.
+    ///
+    /// Waits for all the requests to finish, errors are logged and ignored.
+    void WarmUpConnections(
+        const std::string& url,
+        std::size_t connections_per_thread,
+        std::chrono::milliseconds timeout
+    );
+
 private:
+    Request DoCreateRequest(std::optional<std::size_t> multi_index);
+
+    void WarmUpConnections(const ConnectionsWarmUpSettings& settings);
+
     void ReinitEasy();
 
     InstanceStatistics GetMultiStatistics(size_t n) const;
@@ -163,12 +182,15 @@ private:
 
     utils::SwappingSmart<const curl::easy> easy_;
     utils::PeriodicTask easy_reinit_task_;
+    utils::PeriodicTask warm_up_task_;
 
     // Testsuite support
     std::shared_ptr<const TestsuiteConfig> testsuite_config_;
     rcu::Variable<std::vector<std::string>> allowed_urls_extra_;
 
     std::shared_ptr<curl::ConnectRateLimiter> connect_rate_limiter_;
+    // TLS sessions of all the IO threads, nullptr if disabled
+    std::shared_ptr<curl::share> tls_session_share_;
 
     clients::dns::Resolver* resolver_{nullptr};
     utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
@@ -48,6 +48,18 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// connections-warm-up.urls | URLs to open connections to in advance with HEAD requests, see clients::http::Client::WarmUpConnections() | []
+/// connections-warm-up.connections-per-thread | connections to open to each URL in each of the IO threads | 1
+/// connections-warm-up.timeout | timeout of a warm-up request | 1s
+/// connections-warm-up.refresh-interval | how often to repeat the warm-up to keep the connections from being closed as idle | 1m
+/// tls-session-cache | share TLS sessions between all the IO threads, so that new connections resume them instead of doing full handshakes | true
+/// destination-concurrency-limit.enabled | limit the requests in flight to each destination of the destination metrics adaptively (AIMD), the requests over the limit fail with clients::http::NetworkProblemException without being sent | false
+/// destination-concurrency-limit.initial-limit | the limit for a new destination | 100
+/// destination-concurrency-limit.min-limit | the limit is never decreased below this value | 1
+/// destination-concurrency-limit.max-limit | the limit is never increased above this value | 1000
+/// destination-concurrency-limit.decrease-ratio | the limit is multiplied by this value on a timeout, a 429 or 503 response or a slow response, at most once per the latency of that response | 0.9
+/// destination-concurrency-limit.latency-percentile | percentile of the recent destination timings that is considered the usual latency | 95
+/// destination-concurrency-limit.latency-ratio | a response is slow if its latency is more than this many usual latencies | 2
 ///
 /// ## Static configuration example:
 ///
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -27,12 +28,39 @@ enum class CancellationPolicy {
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>);
 
 // Static config
+struct ConnectionsWarmUpSettings final {
+    std::vector<std::string> urls;
+    std::size_t connections_per_thread{1};
+    std::chrono::milliseconds timeout{1000};
+    std::chrono::milliseconds refresh_interval{std::chrono::seconds{60}};
+};
+
+ConnectionsWarmUpSettings
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<ConnectionsWarmUpSettings>);
+
+// Static config
+struct DestinationConcurrencyLimitSettings final {
+    bool enabled{false};
+    std::size_t initial_limit{100};
+    std::size_t min_limit{1};
+    std::size_t max_limit{1000};
+    double decrease_ratio{0.9};
+    double latency_percentile{95};
+    double latency_ratio{2};
+};
+
+DestinationConcurrencyLimitSettings
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<DestinationConcurrencyLimitSettings>);
+
 struct ClientSettings final {
     std::string thread_name_prefix{};
     size_t io_threads{8};
     DeadlinePropagationConfig deadline_propagation{};
     const tracing::TracingManagerBase* tracing_manager{nullptr};
     CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+    ConnectionsWarmUpSettings warm_up{};
+    bool tls_session_cache{true};
+    DestinationConcurrencyLimitSettings destination_concurrency_limit{};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>);
@@ -123,6 +123,16 @@ public:
     ~HttpServerException() override = default;
 };
 
+/// @brief Error of a request performed without exceptions, see
+/// clients::http::Request::TryPerform()
+struct RequestError final {
+    ErrorKind kind{ErrorKind::kNetwork};
+    /// curl error code of the request, std::errc::operation_canceled if the
+    /// waiting task was cancelled
+    std::error_code error_code;
+    LocalStats stats;
+};
+
 /// map error_code to exceptions
 std::exception_ptr PrepareException(std::error_code ec, std::string_view url, const LocalStats& stats);
 
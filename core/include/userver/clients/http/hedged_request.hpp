@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/clients/http/hedged_request.hpp
+/// @brief @copybrief clients::http::PerformHedged
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class Client;
+
+/// @brief Settings of clients::http::PerformHedged()
+struct HedgingSettings final {
+    /// Maximum count of attempts, including the first one
+    std::size_t max_attempts{2};
+
+    /// Delay before each backup attempt. If not set, the `percentile` of the
+    /// recent timings of the request destination is used.
+    std::optional<std::chrono::milliseconds> delay{};
+
+    /// Percentile of the destination timings to use as the delay
+    double percentile{95.0};
+
+    /// Delay to use while the destination has too few recent timings
+    std::chrono::milliseconds default_delay{50};
+
+    /// The delay never goes below this value
+    std::chrono::milliseconds min_delay{1};
+
+    /// If set, backup attempts are sent only while the budget allows retries.
+    /// Results of all the attempts are accounted in the budget.
+    utils::RetryBudget* retry_budget{nullptr};
+};
+
+/// Fills a request made by clients::http::Client::CreateRequest()
+using RequestSetup = std::function<void(Request&)>;
+
+/// @brief Performs a request with hedging.
+///
+/// The request is created with `client` and filled by `setup`. If there's no
+/// response after the hedging delay, a backup copy of the request is sent
+/// without cancelling the first one, and so on up to
+/// HedgingSettings::max_attempts. The first successful response wins, the
+/// rest of the attempts are cancelled.
+///
+/// Attempts that fail with network errors or with 5xx statuses make the
+/// next attempt start right away.
+///
+/// Use hedging instead of Request::retry(), as the total time to wait is
+/// computed from Request::timeout().
+///
+/// @returns the successful response, or the response of the last attempt if
+/// all of them got 5xx statuses
+/// @throws the exception of the last attempt if all of the attempts failed
+/// otherwise
+std::shared_ptr<Response> PerformHedged(Client& client, const RequestSetup& setup, const HedgingSettings& settings);
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
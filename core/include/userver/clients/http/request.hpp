@@ -4,6 +4,7 @@
 /// @brief @copybrief clients::http::Request
 
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -16,6 +17,7 @@
 #include <userver/crypto/certificate.hpp>
 #include <userver/crypto/private_key.hpp>
 #include <userver/http/http_version.hpp>
+#include <userver/utils/expected.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +33,7 @@ class RequestState;
 class StreamedResponse;
 class ConnectTo;
 class Form;
+class ResponseBodySink;
 struct DeadlinePropagationConfig;
 class RequestStats;
 class DestinationStatistics;
@@ -151,6 +154,28 @@ public:
     /// form for POST request
     Request& form(Form&& form) &;
     Request form(Form&& form) &&;
+    /// @brief Body for POST, PUT or PATCH request that is read from the `queue`
+    /// while the request is being sent, so that the whole body is never kept
+    /// in memory.
+    ///
+    /// The body ends when the producer of the queue is destroyed. Chunked
+    /// transfer encoding is used unless the body `size` is known. The queue is
+    /// consumed by the request, it should be set again to perform the request
+    /// once more. Requests with a streamed body are not retried.
+    ///
+    /// @snippet src/clients/http/client_test.cpp HTTP Client - streamed request body
+    Request& data_stream(
+        std::shared_ptr<concurrent::StringStreamQueue> queue,
+        std::optional<std::size_t> size = std::nullopt
+    ) &;
+    Request data_stream(
+        std::shared_ptr<concurrent::StringStreamQueue> queue,
+        std::optional<std::size_t> size = std::nullopt
+    ) &&;
+    /// @brief Pass the response body to the `sink` instead of storing it in
+    /// Response::body(). Requests with a body sink are not retried.
+    Request& body_sink(std::shared_ptr<ResponseBodySink> sink) &;
+    Request body_sink(std::shared_ptr<ResponseBodySink> sink) &&;
     /// Headers for request as map
     Request& headers(const Headers& headers) &;
     Request headers(const Headers& headers) &&;
@@ -264,6 +289,12 @@ public:
 
     // Set deadline propagation settings. For internal use only.
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) &;
+
+    // For internal use only.
+    std::chrono::milliseconds GetTimeout() const;
+
+    // For internal use only.
+    const std::string& GetDestinationMetricName() const&;
     /// @endcond
 
     /// Disable auto-decoding of received replies.
@@ -295,6 +326,10 @@ public:
     ///
     /// The HTTP client uses queue producer.
     /// StreamedResponse uses queue consumer.
+    ///
+    /// Receiving of the body is paused while the queue is full, so the memory
+    /// usage is bounded by the queue capacity. The capacity is raised to at
+    /// least 16 KiB (CURL_MAX_WRITE_SIZE), the max size of a received chunk.
     [[nodiscard]] StreamedResponse async_perform_stream_body(
         const std::shared_ptr<concurrent::StringStreamQueue>& queue,
         utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
@@ -311,6 +346,18 @@ public:
         utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
     );
 
+    /// @brief Performs the request and waits for the response like perform(),
+    /// but returns the errors instead of throwing them.
+    ///
+    /// Timeouts, network errors, deadline expiration and cancellation of the
+    /// waiting task are returned as clients::http::RequestError without
+    /// creating and unwinding exceptions, which matters when a degraded
+    /// dependency makes errors the common case. HTTP error statuses are not
+    /// errors of the request, check Response::IsError().
+    [[nodiscard]] utils::expected<std::shared_ptr<Response>, RequestError> TryPerform(
+        utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
+    );
+
     /// Returns a reference to the original URL of a request
     const std::string& GetUrl() const&;
     const std::string& GetUrl() && = delete;
@@ -0,0 +1,53 @@
+#pragma once
+
+/// @file userver/clients/http/response_body_sink.hpp
+/// @brief @copybrief clients::http::ResponseBodySink
+
+#include <cstddef>
+#include <string_view>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Receiver of the HTTP response body, see Request::body_sink().
+///
+/// The body chunks are passed to the sink right from the buffers of the HTTP
+/// client, the body is not stored in clients::http::Response.
+///
+/// @warning Write() is called from the HTTP client thread, it must not block
+/// or suspend. For relaying the body from a coroutine use
+/// Request::async_perform_stream_body().
+class ResponseBodySink {
+public:
+    virtual ~ResponseBodySink();
+
+    /// @brief Consumes the next part of the response body.
+    /// @returns false to abort the request, the request fails with an error.
+    virtual bool Write(std::string_view chunk) = 0;
+};
+
+/// @brief Writes the response body into a caller provided buffer, aborts the
+/// request if the body does not fit into the buffer.
+class BufferResponseBodySink final : public ResponseBodySink {
+public:
+    explicit BufferResponseBodySink(utils::span<char> buffer) noexcept;
+
+    bool Write(std::string_view chunk) override;
+
+    /// @returns the received part of the body
+    std::string_view GetBody() const noexcept;
+
+    /// @brief Makes the buffer ready for a new request
+    void Reset() noexcept;
+
+private:
+    utils::span<char> buffer_;
+    std::size_t size_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
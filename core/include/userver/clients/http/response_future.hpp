@@ -8,11 +8,13 @@
 #include <type_traits>
 
 #include <userver/clients/http/config.hpp>
+#include <userver/clients/http/error.hpp>
 #include <userver/clients/http/response.hpp>
 #include <userver/compiler/select.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
+#include <userver/utils/expected.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -42,6 +44,14 @@ public:
 
     std::shared_ptr<Response> Get();
 
+    /// @brief Waits for the response like Get(), but returns the errors
+    /// instead of throwing them.
+    ///
+    /// Exceptions are not created for the futures of
+    /// clients::http::Request::TryPerform(), the errors of other futures are
+    /// converted from the exceptions.
+    utils::expected<std::shared_ptr<Response>, RequestError> TryGet();
+
     void SetCancellationPolicy(CancellationPolicy cp);
 
     /// @cond
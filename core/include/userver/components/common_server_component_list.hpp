@@ -24,6 +24,7 @@ namespace components {
 /// * server::handlers::LogLevel
 /// * server::handlers::OnLogRotate
 /// * server::handlers::ServerMonitor
+/// * server::handlers::TaskProfiler
 /// * server::handlers::TestsControl
 /// * components::AuthCheckerSettings
 /// * congestion_control::Component
@@ -23,6 +23,7 @@ namespace components {
 /// dir               | directory to cache files from                        | /var/www
 /// update-period     | Update period (0 - fill the cache only at startup)   | 0
 /// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// keep-open-min-size | files of at least this size are kept open instead of being loaded into memory | all the files are loaded into memory
 
 // clang-format on
 
@@ -34,8 +34,12 @@ class Manager;
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | 4000
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
 /// coro_pool.local_cache_size | local coroutine cache size per thread | 32
-/// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
+/// coro_pool.stack_reclaim_interval | interval of returning the stack memory of idle coroutines to the OS, 0 disables | 0
+/// coro_pool.huge_pages | carve the stacks out of 2 MiB chunks backed by transparent huge pages to reduce TLB misses; a single guard page per chunk, so an overflow may corrupt a neighbouring stack instead of crashing | false
+/// big_stack_coro_pool.* | optional pool of coroutines for the task processors with `big-stack: true`, has the same options as `coro_pool` | - (not created)
+/// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev), or `auto` for one thread per 4 available CPUs | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
+/// event_thread_pool.backend | libev backend for the ev loops: `auto`, `epoll` or `io_uring` (falls back to `epoll` if unsupported by the kernel) | auto
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | -
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
@@ -43,18 +47,23 @@ class Manager;
 /// disable_phdr_cache | whether to disable caching of phdr_info objects. Usable if rebuilding with cmake variable USERVER_DISABLE_PHDR_CACHE is off limits, and has the same effect | false
 /// static_config_validation.validate_all_components | whether to validate static config according to schema; should be `true` for all new services | true
 /// preheat_stacktrace_collector | whether to collect a dummy stacktrace at server start up (usable to avoid loading debug info at random point at runtime) | true
+/// async_stacktrace_symbolization | whether to symbolize the stacktraces of LogExtra and of the logged exceptions on a background thread; a stacktrace is logged as raw frame addresses until its symbolized text is cached | false
 /// userver_experiments.*NAME* | whether to enable certain userver experiments; these are gradually enabled by userver team, for internal use only | false
 /// graceful_shutdown_interval | at shutdown, first hang for this duration with /ping 5xx to give the balancer a chance to redirect new requests to other hosts | 0s
+/// startup_timeline_path | path to write the JSON report on the components construction to (per-component start, self and wait times, critical path); the summary is always logged | -
 ///
 /// ## Static task_processor options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// guess-cpu-limit | guess optimal threads count | false
 /// thread_name | set OS thread name to this value | Part of the task_processor name before the first '-' symbol with '-worker' appended; for example 'fs-worker' or 'main-worker'
-/// worker_threads | threads count for the task processor | -
+/// worker_threads | threads count for the task processor, or `auto` for the number of CPUs available to the process (see hostinfo::CpuLimit, falls back to the hardware concurrency) | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
-/// task-processor-queue | Task queue mode for the task processor. `global-task-queue` default task queue. `work-stealing-task-queue` experimental with potentially better scalability than `global-task-queue`. | global-task-queue
+/// task-processor-queue | Task queue mode for the task processor. `global-task-queue` default task queue. `work-stealing-task-queue` experimental with potentially better scalability than `global-task-queue`. `priority-task-queue` takes the tasks of higher engine::TaskPriority more often. | global-task-queue
+/// cpu-set | CPUs to pin the worker threads to in Linux cpulist format, e.g. `0-7,16-23` | - (no pinning)
+/// big-stack | run the tasks on the coroutines of `big_stack_coro_pool`, so that `coro_pool.stack_size` could be kept small for the rest of the task processors | false
+/// numa-node | NUMA node whose CPUs the worker threads are pinned to; `work-stealing-task-queue` prefers stealing from workers of the same node | - (no pinning)
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
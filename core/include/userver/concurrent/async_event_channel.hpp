@@ -3,6 +3,8 @@
 /// @file userver/concurrent/async_event_channel.hpp
 /// @brief @copybrief concurrent::AsyncEventChannel
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <string>
 #include <string_view>
@@ -132,6 +134,9 @@ public:
 
     /// Send the next event and wait until all the listeners process it.
     ///
+    /// The listeners are called concurrently in separate tasks, at most
+    /// GetMaxParallelism() of them at once.
+    ///
     /// Strict FIFO serialization is guaranteed, i.e. only after this event is
     /// processed a new event may be delivered for the subscribers, same
     /// listener/subscriber is never called concurrently.
@@ -139,21 +144,39 @@ public:
         std::lock_guard lock(event_mutex_);
         auto data = data_.Lock();
         auto& listeners = data->listeners;
+        const auto max_parallelism = max_parallelism_.load();
 
         std::vector<engine::TaskWithResult<void>> tasks;
+        std::vector<const Listener*> task_listeners;
         tasks.reserve(listeners.size());
+        task_listeners.reserve(listeners.size());
 
+        std::size_t finished = 0;
         for (const auto& [_, listener] : listeners) {
+            if (max_parallelism != 0 && tasks.size() - finished >= max_parallelism) {
+                impl::WaitForTask(task_listeners[finished]->name, tasks[finished]);
+                ++finished;
+            }
             tasks.push_back(utils::Async(listener.task_name, [&, &callback = listener.callback] { callback(args...); })
             );
+            task_listeners.push_back(&listener);
         }
 
-        std::size_t i = 0;
-        for (const auto& [_, listener] : listeners) {
-            impl::WaitForTask(listener.name, tasks[i++]);
+        for (; finished < tasks.size(); ++finished) {
+            impl::WaitForTask(task_listeners[finished]->name, tasks[finished]);
         }
     }
 
+    /// @brief Limits the number of listeners that process an event
+    /// concurrently, 0 means no limit (the default).
+    ///
+    /// A limit is useful for channels with many heavy listeners, e.g. a cache
+    /// with a lot of dependent caches, to not overload the task processor.
+    void SetMaxParallelism(std::size_t max_parallelism) noexcept { max_parallelism_.store(max_parallelism); }
+
+    /// @returns the limit set by SetMaxParallelism, 0 if unlimited
+    std::size_t GetMaxParallelism() const noexcept { return max_parallelism_.load(); }
+
     /// @returns the name of this event channel
     const std::string& Name() const noexcept { return name_; }
 
@@ -208,6 +231,7 @@ private:
     const std::string name_;
     concurrent::Variable<ListenersData> data_;
     mutable engine::Mutex event_mutex_;
+    std::atomic<std::size_t> max_parallelism_{0};
 };
 
 }  // namespace concurrent
@@ -4,8 +4,10 @@
 /// @brief @copybrief concurrent::GenericQueue
 
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -17,6 +19,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/atomic.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -289,11 +292,39 @@ private:
         return producer_side_.PushNoblock(token, std::move(value), value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] std::size_t PushBatch(Token& token, utils::span<T> values, engine::Deadline deadline) {
+        if (values.empty()) return 0;
+
+        std::size_t total_size = 0;
+        for (const auto& value : values) {
+            const std::size_t value_size = QueuePolicy::GetElementSize(value);
+            UASSERT(value_size > 0);
+            total_size += value_size;
+        }
+        if (producer_side_.PushBatchNoblock(token, values, total_size)) return values.size();
+
+        // Not enough space for the whole batch, wait for it element by element
+        std::size_t pushed = 0;
+        for (auto& value : values) {
+            if (!Push(token, std::move(value), deadline)) break;
+            ++pushed;
+        }
+        return pushed;
+    }
+
     template <typename Token>
     [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
         return consumer_side_.Pop(token, value, deadline);
     }
 
+    template <typename Token>
+    [[nodiscard]] std::size_t
+    PopBatch(Token& token, std::vector<T>& values, std::size_t max_count, engine::Deadline deadline) {
+        UASSERT(max_count > 0);
+        return consumer_side_.PopBatch(token, values, max_count, deadline);
+    }
+
     template <typename Token>
     [[nodiscard]] bool PopNoblock(Token& token, T& value) {
         return consumer_side_.PopNoblock(token, value);
@@ -368,6 +399,24 @@ private:
         consumer_side_.OnElementPushed();
     }
 
+    template <typename Token>
+    void DoPushBatch(Token& token, utils::span<T> values) {
+        const auto first = std::make_move_iterator(values.begin());
+        if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            queue_.enqueue_bulk(token, first, values.size());
+        } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            queue_.enqueue_bulk(first, values.size());
+        } else {
+            static_assert(std::is_same_v<Token, impl::NoToken>);
+            static_assert(!QueuePolicy::kIsMultipleProducer);
+            queue_.enqueue_bulk(single_producer_token_, first, values.size());
+        }
+
+        consumer_side_.OnElementsPushed(values.size());
+    }
+
     template <typename Token>
     [[nodiscard]] bool DoPop(Token& token, T& value) {
         bool success{};
@@ -392,6 +441,35 @@ private:
         return false;
     }
 
+    // Appends up to max_count elements to values
+    template <typename Token>
+    [[nodiscard]] std::size_t DoPopBatch(Token& token, std::vector<T>& values, std::size_t max_count) {
+        const auto old_size = values.size();
+        auto inserter = std::back_inserter(values);
+
+        if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            queue_.try_dequeue_bulk(token, inserter, max_count);
+        } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            queue_.try_dequeue_bulk(inserter, max_count);
+        } else {
+            static_assert(std::is_same_v<Token, impl::NoToken>);
+            static_assert(!QueuePolicy::kIsMultipleProducer);
+            queue_.try_dequeue_bulk_from_producer(single_producer_token_, inserter, max_count);
+        }
+
+        const auto popped = values.size() - old_size;
+        if (popped != 0) {
+            std::size_t released_capacity = 0;
+            for (auto it = values.begin() + old_size; it != values.end(); ++it) {
+                released_capacity += QueuePolicy::GetElementSize(*it);
+            }
+            producer_side_.OnElementPopped(released_capacity);
+        }
+        return popped;
+    }
+
     moodycamel::ConcurrentQueue<T> queue_{1};
     std::atomic<std::size_t> consumers_count_{0};
     std::atomic<std::size_t> producers_count_{0};
@@ -434,6 +512,17 @@ public:
         return !queue_.NoMoreConsumers() && DoPush(token, std::move(value), value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PushBatchNoblock(Token& token, utils::span<T> values, std::size_t total_size) {
+        if (queue_.NoMoreConsumers() || used_capacity_.load() + total_size > total_capacity_.load()) {
+            return false;
+        }
+
+        used_capacity_.fetch_add(total_size);
+        queue_.DoPushBatch(token, values);
+        return true;
+    }
+
     void OnElementPopped(std::size_t released_capacity) {
         used_capacity_.fetch_sub(released_capacity);
         non_full_event_.Send();
@@ -489,6 +578,19 @@ public:
         return remaining_capacity_.try_lock_shared_count(value_size) && DoPush(token, std::move(value), value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PushBatchNoblock(Token& token, utils::span<T> values, std::size_t total_size) {
+        if (!remaining_capacity_.try_lock_shared_count(total_size)) return false;
+
+        if (queue_.NoMoreConsumers()) {
+            remaining_capacity_.unlock_shared_count(total_size);
+            return false;
+        }
+
+        queue_.DoPushBatch(token, values);
+        return true;
+    }
+
     void OnElementPopped(std::size_t value_size) { remaining_capacity_.unlock_shared_count(value_size); }
 
     void StopBlockingOnPush() { remaining_capacity_control_.SetCapacityOverride(0); }
@@ -538,6 +640,16 @@ public:
         return Push(token, std::move(value), engine::Deadline{}, value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PushBatchNoblock(Token& token, utils::span<T> values, std::size_t /*total_size*/) {
+        if (queue_.NoMoreConsumers()) {
+            return false;
+        }
+
+        queue_.DoPushBatch(token, values);
+        return true;
+    }
+
     void OnElementPopped(std::size_t /*released_capacity*/) {}
 
     void StopBlockingOnPush() {}
@@ -588,11 +700,36 @@ public:
         return DoPop(token, value);
     }
 
+    // Blocks only if queue is empty
+    template <typename Token>
+    [[nodiscard]] std::size_t
+    PopBatch(Token& token, std::vector<T>& values, std::size_t max_count, engine::Deadline deadline) {
+        std::size_t popped = 0;
+        const bool success = nonempty_event_.WaitUntil(deadline, [&] {
+            popped = DoPopBatch(token, values, max_count);
+            if (popped != 0) {
+                return true;
+            }
+            if (queue_.NoMoreProducers()) {
+                // Same TOCTOU as in Pop()
+                popped = DoPopBatch(token, values, max_count);
+                return true;
+            }
+            return false;
+        });
+        return success ? popped : 0;
+    }
+
     void OnElementPushed() {
         ++element_count_;
         nonempty_event_.Send();
     }
 
+    void OnElementsPushed(std::size_t count) {
+        element_count_ += count;
+        nonempty_event_.Send();
+    }
+
     void StopBlockingOnPop() { nonempty_event_.Send(); }
 
     void ResumeBlockingOnPop() {}
@@ -610,6 +747,16 @@ private:
         return false;
     }
 
+    template <typename Token>
+    [[nodiscard]] std::size_t DoPopBatch(Token& token, std::vector<T>& values, std::size_t max_count) {
+        const auto popped = queue_.DoPopBatch(token, values, max_count);
+        if (popped != 0) {
+            element_count_ -= popped;
+            nonempty_event_.Reset();
+        }
+        return popped;
+    }
+
     GenericQueue& queue_;
     engine::SingleConsumerEvent nonempty_event_;
     std::atomic<std::size_t> element_count_;
@@ -637,8 +784,24 @@ public:
         return element_count_.try_lock_shared() && DoPop(token, value);
     }
 
+    // Blocks only if queue is empty
+    template <typename Token>
+    [[nodiscard]] std::size_t
+    PopBatch(Token& token, std::vector<T>& values, std::size_t max_count, engine::Deadline deadline) {
+        if (!element_count_.try_lock_shared_until(deadline)) return 0;
+
+        // One element is reserved, reserve the rest of the available ones at once
+        std::size_t reserved = 1;
+        const auto available = std::min(max_count - 1, GetElementCount());
+        if (available != 0 && element_count_.try_lock_shared_count(available)) reserved += available;
+
+        return DoPopBatch(token, values, reserved);
+    }
+
     void OnElementPushed() { element_count_.unlock_shared(); }
 
+    void OnElementsPushed(std::size_t count) { element_count_.unlock_shared_count(count); }
+
     void StopBlockingOnPop() { element_count_control_.SetCapacityOverride(kUnbounded + kSemaphoreUnlockValue); }
 
     void ResumeBlockingOnPop() { element_count_control_.RemoveCapacityOverride(); }
@@ -669,6 +832,21 @@ private:
         }
     }
 
+    // Pops exactly `reserved` elements unless there are no more producers
+    template <typename Token>
+    [[nodiscard]] std::size_t DoPopBatch(Token& token, std::vector<T>& values, std::size_t reserved) {
+        std::size_t popped = 0;
+        while (popped != reserved) {
+            const auto count = queue_.DoPopBatch(token, values, reserved - popped);
+            popped += count;
+            if (count == 0 && queue_.NoMoreProducers()) {
+                element_count_.unlock_shared_count(reserved - popped);
+                break;
+            }
+        }
+        return popped;
+    }
+
     GenericQueue& queue_;
     engine::CancellableSemaphore element_count_;
     concurrent::impl::SemaphoreCapacityControl element_count_control_;
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/task/current_task.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -69,6 +72,19 @@ public:
         return queue_->PushNoblock(token_, std::move(value));
     }
 
+    /// Push elements into queue in their order. If the queue has enough space
+    /// for all the elements, they are pushed with a single synchronization and
+    /// consumer wakeup, otherwise the elements are pushed one by one as
+    /// the space frees up. May wait asynchronously if the queue is full.
+    /// @returns the number of the leading `values` that were pushed before the
+    /// deadline and before the task was canceled. The pushed elements are
+    /// moved-from, the rest are left unmodified.
+    [[nodiscard]] std::size_t PushBatch(utils::span<ValueType> values, engine::Deadline deadline = {}) const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Producer");
+        UASSERT_MSG(engine::current_task::IsTaskProcessorThread(), "Use PushNoblock for non-coroutine producers");
+        return queue_->PushBatch(token_, values, deadline);
+    }
+
     void Reset() && noexcept {
         if (queue_) queue_->MarkProducerIsDead();
         queue_.reset();
@@ -138,6 +154,19 @@ public:
         return queue_->PopNoblock(token_, value);
     }
 
+    /// Pop up to `max_count` elements from queue and append them to `values`
+    /// with a single synchronization. May wait asynchronously if the queue is
+    /// empty, but the producer is alive.
+    /// @returns the number of popped elements, 0 if nothing was popped before
+    /// the deadline or the producer is no longer alive.
+    /// @see Pop for the deadline usage warning
+    [[nodiscard]] std::size_t
+    PopBatch(std::vector<ValueType>& values, std::size_t max_count, engine::Deadline deadline = {}) const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Consumer");
+        UASSERT_MSG(engine::current_task::IsTaskProcessorThread(), "Use PopNoblock for non-coroutine consumers");
+        return queue_->PopBatch(token_, values, max_count, deadline);
+    }
+
     void Reset() && {
         if (queue_) queue_->MarkConsumerIsDead();
         queue_.reset();
@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/concurrent/striped_shared_mutex.hpp
+/// @brief @copybrief concurrent::StripedSharedMutex
+
+#include <atomic>
+
+#include <userver/concurrent/striped_counter.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// @ingroup userver_concurrency
+///
+/// @brief A reader-writer lock for read-mostly data, with write performance
+/// traded for read scalability.
+///
+/// Readers only account themselves in per-CPU concurrent::StripedCounter
+/// counters and read a flag that is not modified until a writer comes, so the
+/// readers never write to shared cache lines. A writer sets the flag and waits
+/// until all the current readers leave, so `lock` is approx. `nproc` times
+/// slower than that of engine::SharedMutex.
+///
+/// Writers have priority: new readers wait while a writer holds or waits for
+/// the lock.
+///
+/// @see concurrent::ReadMostlyVariable
+class StripedSharedMutex final {
+public:
+    StripedSharedMutex();
+    ~StripedSharedMutex();
+
+    StripedSharedMutex(const StripedSharedMutex&) = delete;
+    StripedSharedMutex& operator=(const StripedSharedMutex&) = delete;
+
+    void lock();
+    void unlock();
+    bool try_lock();
+
+    void lock_shared();
+    void unlock_shared();
+    bool try_lock_shared();
+
+private:
+    bool HasReaders() const noexcept;
+    bool TryEnterShared();
+
+    // Both counters only grow, the difference is the number of readers
+    StripedCounter shared_locks_;
+    StripedCounter shared_unlocks_;
+
+    std::atomic<bool> writer_active_{false};
+    engine::Mutex writer_mutex_;
+    engine::SingleConsumerEvent readers_left_event_;
+};
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief concurrent::Variable for read-mostly data, use `SharedLock` for
+/// reading
+template <typename Data>
+using ReadMostlyVariable = Variable<Data, StripedSharedMutex>;
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <userver/congestion_control/controllers/linear_config.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/congestion_control/sensor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// Latency based limit estimation in the spirit of TCP Vegas and Netflix's
+/// gradient2. The long term RTT is learned while there is no congestion;
+/// the in-flight limit is scaled by `rtt_tolerance * long_rtt / short_rtt`
+/// and is given a `sqrt(limit)` headroom, so the load is shed as soon as the
+/// timings start to grow, before the timeouts appear.
+///
+/// Used by LinearController if Config::algorithm is Algorithm::kGradient.
+class GradientEstimator final {
+public:
+    Limit Update(const Sensor::Data& current, const Config& config);
+
+    void Reset() noexcept;
+
+private:
+    void UpdateLongRtt(double rtt) noexcept;
+
+    std::size_t epochs_passed_{0};
+    double long_rtt_ms_{0};
+    double estimated_limit_{0};
+    std::optional<std::size_t> current_limit_;
+};
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <optional>
 
+#include <userver/congestion_control/controllers/gradient.hpp>
 #include <userver/congestion_control/controllers/linear_config.hpp>
 #include <userver/congestion_control/controllers/v2.hpp>
 #include <userver/congestion_control/limiter.hpp>
@@ -14,6 +15,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace congestion_control::v2 {
 
+/// Controller for the Config::algorithm selected by the dynamic config
 class LinearController final : public Controller {
 public:
     using StaticConfig = Controller::Config;
@@ -38,6 +40,9 @@ private:
     std::optional<std::size_t> current_limit_;
     std::size_t epochs_passed_{0};
 
+    Algorithm algorithm_{Algorithm::kLinear};
+    GradientEstimator gradient_;
+
     dynamic_config::Source config_source_;
     std::function<v2::Config(const dynamic_config::Snapshot&)> config_getter_;
 };
@@ -9,13 +9,23 @@ USERVER_NAMESPACE_BEGIN
 
 namespace congestion_control::v2 {
 
+enum class Algorithm {
+    kLinear,
+    kGradient,
+};
+
 struct Config {
+    Algorithm algorithm{Algorithm::kLinear};
     double errors_threshold_percent{5.0};  // 5%
     std::size_t safe_delta_limit{10};
     std::size_t timings_burst_threshold{5};
     std::chrono::milliseconds min_timings{20};
     std::size_t min_limit{10};
     std::size_t min_qps{10};
+
+    // Algorithm::kGradient only
+    double rtt_tolerance{1.5};
+    double smoothing{0.2};
 };
 
 Config Parse(const formats::json::Value& value, formats::parse::To<Config>);
@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/dist_lock/dist_lock_group.hpp
+/// @brief @copybrief dist_lock::DistLockGroup
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <userver/dist_lock/dist_lock_group_strategy.hpp>
+#include <userver/dist_lock/dist_lock_strategy.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+namespace impl {
+
+class LockBatcher;
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief A set of distributed locks that are acquired and prolonged in
+/// batches.
+///
+/// Each dist_lock::DistLockedWorker or dist_lock::DistLockedTask of a service
+/// with many locks issues its own storage request per `prolong_interval`.
+/// Workers that use strategies from MakeStrategy() of the same group instead
+/// have their requests collected for up to `max_batch_delay` and sent in a
+/// single dist_lock::DistLockGroupStrategyBase::AcquireMany() call.
+///
+/// `max_batch_delay` is added to the lock acquisition latency, so it should be
+/// well below `lock_ttl - prolong_interval - forced_stop_margin`.
+///
+/// ## Example
+///
+/// @snippet core/src/dist_lock/dist_lock_group_test.cpp Sample distlock group
+class DistLockGroup final {
+public:
+    static constexpr std::chrono::milliseconds kDefaultMaxBatchDelay{50};
+
+    /// Starts the batching task, must be called from a coroutine.
+    explicit DistLockGroup(
+        std::shared_ptr<DistLockGroupStrategyBase> strategy,
+        std::chrono::milliseconds max_batch_delay = kDefaultMaxBatchDelay
+    );
+
+    DistLockGroup(DistLockGroup&&) noexcept;
+    DistLockGroup& operator=(DistLockGroup&&) noexcept;
+    ~DistLockGroup();
+
+    /// @returns the strategy for the lock `lock_name` of the group to pass into
+    /// dist_lock::DistLockedWorker or dist_lock::DistLockedTask.
+    /// @note The strategy shares the batching task with the group and keeps it
+    /// alive after the group is destroyed.
+    std::shared_ptr<DistLockStrategyBase> MakeStrategy(std::string lock_name) const;
+
+private:
+    std::shared_ptr<impl::LockBatcher> batcher_;
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
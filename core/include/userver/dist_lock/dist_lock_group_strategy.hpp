@@ -0,0 +1,55 @@
+#pragma once
+
+/// @file userver/dist_lock/dist_lock_group_strategy.hpp
+/// @brief @copybrief dist_lock::DistLockGroupStrategyBase
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+/// A request to acquire or prolong a single lock of a dist_lock::DistLockGroup
+struct GroupLockRequest {
+    std::string lock_name;
+    std::string locker_id;
+    std::chrono::milliseconds lock_ttl{};
+};
+
+/// @ingroup userver_base_classes userver_concurrency
+///
+/// @brief Interface for distributed lock strategies that acquire and prolong
+/// many locks in a single request to the storage.
+///
+/// Used by dist_lock::DistLockGroup.
+///
+/// ## Example
+///
+/// @snippet core/src/dist_lock/dist_lock_group_test.cpp Sample distlock group strategy
+class DistLockGroupStrategyBase {
+public:
+    virtual ~DistLockGroupStrategyBase() = default;
+
+    /// Acquires or prolongs the distributed locks.
+    ///
+    /// A lock name is never repeated within a single call.
+    ///
+    /// @returns for each of the `requests` whether the lock is now held by its
+    /// `locker_id`
+    /// @throws anything when the whole batch fails, Release won't be invoked.
+    virtual std::vector<bool> AcquireMany(const std::vector<GroupLockRequest>& requests) = 0;
+
+    /// Releases the lock.
+    ///
+    /// @param lock_name Name of the lock, same as in AcquireMany().
+    /// @param locker_id Globally unique ID of the locking entity, must be the
+    /// same as in AcquireMany().
+    /// @note Exceptions are ignored.
+    virtual void Release(const std::string& lock_name, const std::string& locker_id) = 0;
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/components/component_fwd.hpp>
 #include <userver/dump/helpers.hpp>
@@ -43,6 +44,18 @@ public:
     virtual void GetAndWrite(dump::Writer& writer) const = 0;
 
     virtual void ReadAndSet(dump::Reader& reader) = 0;
+
+    /// @brief Writes the changes since the previous `GetAndWrite` or
+    /// `GetAndWriteDelta`, used if `max-delta-count` is set
+    /// @returns `false` if the changes are unknown, then a full dump is written
+    virtual bool GetAndWriteDelta(dump::Writer& writer) const;
+
+    /// @brief Reads a full dump followed by its deltas, oldest first, used if
+    /// `max-delta-count` is set
+    virtual void ReadAndSetWithDeltas(
+        dump::Reader& reader,
+        const std::vector<std::unique_ptr<dump::Reader>>& deltas
+    );
 };
 
 enum class UpdateType {
@@ -85,6 +98,9 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `mmap-reads` | `boolean` | Whether to read dumps via `mmap`, allows dump::MappedArray to use the data in place, not supported for encrypted and compressed dumps | `false`
+/// `compressed` | `boolean` | Whether to compress the dump with zstd. The dump is split into chunks that are compressed and decompressed in parallel on `fs-task-processor`, before encryption if any. Uncompressed dumps are still readable | `false`
+/// `max-delta-count` | `integer` | Max count of delta dumps written after a full dump, each of them only contains the changes since the previous dump. Only used if the `DumpableEntity` is able to write deltas, `0` disables deltas | `0`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -171,7 +187,7 @@ private:
     Dumper(const Config& initial_config, const components::ComponentContext& context, DumpableEntity& dumpable);
 
     class Impl;
-    utils::FastPimpl<Impl, 1088, 16> impl_;
+    utils::FastPimpl<Impl, 1248, 16> impl_;
 };
 
 }  // namespace dump
@@ -0,0 +1,109 @@
+#pragma once
+
+/// @file userver/dump/mapped_array.hpp
+/// @brief @copybrief dump::MappedArray
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Immutable array of trivially copyable elements, dumped as raw bytes.
+///
+/// When read from a memory-mapped dump (`mmap-reads: true` in dump config),
+/// the array points directly into the dump file without copying or
+/// deserializing the elements, so loading a cache of such arrays takes
+/// milliseconds regardless of its size. Otherwise or if the data in the dump
+/// is misaligned for `T`, the elements are copied into an owned buffer.
+///
+/// The data of the first array written to a dump is always aligned for types
+/// with alignment up to 8 bytes.
+///
+/// @warning The elements are dumped as is, so `T` must not contain pointers,
+/// and its layout must not change between the writing and the reading
+/// binaries, bump `format-version` of the dump otherwise.
+template <typename T>
+class MappedArray final {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedArray elements are dumped as raw bytes");
+
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    MappedArray() = default;
+
+    explicit MappedArray(std::vector<T> items) {
+        auto storage = std::make_shared<const std::vector<T>>(std::move(items));
+        data_ = storage->data();
+        size_ = storage->size();
+        storage_ = std::move(storage);
+    }
+
+    const T* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const T* begin() const noexcept { return data_; }
+    const T* end() const noexcept { return data_ + size_; }
+
+    const T& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+    /// Returns true if the elements are used in place from a dump
+    bool IsMapped() const noexcept { return is_mapped_; }
+
+private:
+    template <typename U>
+    friend MappedArray<U> Read(Reader& reader, To<MappedArray<U>>);
+
+    MappedArray(std::shared_ptr<const void> storage, const T* data, std::size_t size) noexcept
+        : storage_(std::move(storage)), data_(data), size_(size), is_mapped_(true) {}
+
+    std::shared_ptr<const void> storage_;
+    const T* data_{nullptr};
+    std::size_t size_{0};
+    bool is_mapped_{false};
+};
+
+/// @brief MappedArray serialization support
+template <typename T>
+void Write(Writer& writer, const MappedArray<T>& value) {
+    // Fixed-size prefix keeps the data of the first array aligned
+    impl::WriteTrivial(writer, static_cast<std::uint64_t>(value.size()));
+    WriteStringViewUnsafe(writer, {reinterpret_cast<const char*>(value.data()), value.size() * sizeof(T)});
+}
+
+/// @brief MappedArray deserialization support
+template <typename T>
+MappedArray<T> Read(Reader& reader, To<MappedArray<T>>) {
+    const auto size = impl::ReadTrivial<std::uint64_t>(reader);
+    if (size > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw Error(fmt::format("Too big MappedArray in dump: size={}", size));
+    }
+
+    const auto bytes = ReadStringViewUnsafe(reader, size * sizeof(T));
+    auto owner = reader.GetStableMemoryOwner();
+    if (owner && reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(T) == 0) {
+        return MappedArray<T>{std::move(owner), reinterpret_cast<const T*>(bytes.data()), size};
+    }
+
+    std::vector<T> items(size);
+    if (size != 0) std::memcpy(items.data(), bytes.data(), bytes.size());
+    return MappedArray<T>{std::move(items)};
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
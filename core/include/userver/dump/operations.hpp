@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -60,6 +61,12 @@ public:
     /// @throws `Error` on read operation failure or if there is leftover data
     virtual void Finish() = 0;
 
+    /// @brief Returns the owner of the memory returned by `ReadRaw` if that
+    /// memory stays valid and unchanged while the owner is alive, e.g. for
+    /// memory-mapped dumps; returns nullptr otherwise
+    /// @see dump::MappedArray
+    virtual std::shared_ptr<const void> GetStableMemoryOwner() const { return {}; }
+
 protected:
     /// @brief Reads binary data
     /// @note Invalidates the memory returned by the previous call of `ReadRaw`
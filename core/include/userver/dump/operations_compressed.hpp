@@ -0,0 +1,99 @@
+#pragma once
+
+/// @file userver/dump/operations_compressed.hpp
+/// @brief Chunked zstd compression of dumps
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Splits the dump data into chunks and compresses them with zstd
+/// in parallel, on the current task processor, before passing them to the
+/// underlying Writer
+///
+/// Serialization stays sequential, but the chunks are compressed by separate
+/// tasks, and each compressed chunk is passed to the underlying Writer in
+/// a single large write.
+class CompressedWriter final : public Writer {
+public:
+    static constexpr std::size_t kDefaultChunkSize = 4 * 1024 * 1024;
+
+    /// @brief Wraps `sink`, which receives the compressed chunks
+    CompressedWriter(std::unique_ptr<Writer> sink, std::size_t chunk_size = kDefaultChunkSize);
+
+    ~CompressedWriter() override;
+
+    void Finish() override;
+
+private:
+    struct CompressedChunk final {
+        std::size_t raw_size;
+        engine::TaskWithResult<std::string> compressed;
+    };
+
+    void WriteRaw(std::string_view data) override;
+
+    void StartCompression();
+    void WriteCompressed(std::size_t max_chunks_in_flight);
+
+    std::unique_ptr<Writer> sink_;
+    const std::size_t chunk_size_;
+    std::string chunk_;
+    std::deque<CompressedChunk> chunks_in_flight_;
+};
+
+/// @brief Reads the dumps written by CompressedWriter, decompressing the
+/// chunks that are read ahead in parallel on the current task processor
+///
+/// Dumps without compression are read as is.
+class CompressedReader final : public Reader {
+public:
+    /// @brief Wraps `source`, which provides the compressed chunks
+    explicit CompressedReader(std::unique_ptr<Reader> source);
+
+    ~CompressedReader() override;
+
+    void Finish() override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    void ReadAhead();
+    bool NextChunk();
+
+    std::unique_ptr<Reader> source_;
+    bool is_compressed_{false};
+    bool source_exhausted_{false};
+    std::string chunk_;
+    std::size_t chunk_pos_{0};
+    std::string stitched_;
+    std::deque<engine::TaskWithResult<std::string>> chunks_in_flight_;
+};
+
+/// @brief Compresses the dumps of the `base` operations, e.g. before
+/// encrypting them
+class CompressedOperationsFactory final : public OperationsFactory {
+public:
+    explicit CompressedOperationsFactory(std::unique_ptr<OperationsFactory> base);
+
+    std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+    std::unique_ptr<Writer> CreateWriter(std::string full_path, tracing::ScopeTime& scope) override;
+
+private:
+    const std::unique_ptr<OperationsFactory> base_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
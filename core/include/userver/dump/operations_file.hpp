@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -13,21 +14,33 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs::impl {
+class AsyncFileWriter;
+}  // namespace fs::impl
+
 namespace dump {
 
-/// A handle to a dump file. File operations block the thread.
+/// A handle to a dump file. If io_uring is available, the writes are buffered
+/// and suspend the coroutine instead of blocking the thread. Otherwise file
+/// operations block the thread.
 class FileWriter final : public Writer {
 public:
     /// @brief Creates a new dump file and opens it
     /// @throws `Error` on a filesystem error
     explicit FileWriter(std::string path, boost::filesystem::perms perms, tracing::ScopeTime& scope);
 
+    ~FileWriter() override;
+
     void Finish() override;
 
 private:
     void WriteRaw(std::string_view data) override;
 
+    void FlushAsyncBuffer();
+
     fs::blocking::CFile file_;
+    std::unique_ptr<fs::impl::AsyncFileWriter> async_file_;
+    std::string async_buffer_;
     std::string final_path_;
     std::string path_;
     boost::filesystem::perms perms_;
@@ -51,9 +64,35 @@ private:
     std::string curr_chunk_;
 };
 
+/// @brief A handle to a memory-mapped dump file.
+///
+/// The data is not copied on reads, and the memory returned by reads stays
+/// valid while the owner from `GetStableMemoryOwner` is alive, which allows
+/// dump::MappedArray to use the data in place. Pages of the file are read
+/// from disk on the first access, which blocks the thread.
+class MmapFileReader final : public Reader {
+public:
+    /// @brief Opens an existing dump file and maps it into memory
+    /// @throws `Error` on a filesystem error
+    explicit MmapFileReader(std::string path);
+
+    void Finish() override;
+
+    std::shared_ptr<const void> GetStableMemoryOwner() const override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    std::string path_;
+    std::shared_ptr<const void> mapping_;
+    std::size_t mapping_size_{0};
+    std::size_t position_{0};
+};
+
 class FileOperationsFactory final : public OperationsFactory {
 public:
-    explicit FileOperationsFactory(boost::filesystem::perms perms);
+    /// @param mmap_reads whether to read dumps via MmapFileReader
+    explicit FileOperationsFactory(boost::filesystem::perms perms, bool mmap_reads = false);
 
     std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -61,6 +100,7 @@ public:
 
 private:
     const boost::filesystem::perms perms_;
+    const bool mmap_reads_;
 };
 
 }  // namespace dump
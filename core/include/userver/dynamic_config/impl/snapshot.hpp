@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -54,6 +55,10 @@ public:
 
     SnapshotData(const SnapshotData& defaults, const std::vector<KeyValue>& overrides);
 
+    // Parses the configs of `docs_map`, reusing the ones of `previous` parsed
+    // from the same JSON values
+    SnapshotData(const DocsMap& docs_map, const SnapshotData& previous);
+
     SnapshotData(SnapshotData&&) noexcept = default;
     SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -68,13 +73,19 @@ public:
 
     bool IsEmpty() const noexcept;
 
+    // True if the config was not reparsed since the `other` snapshot
+    bool IsSameConfig(const SnapshotData& other, ConfigId id) const noexcept;
+
 private:
+    struct UserConfig;
+
     const std::any& DoGet(ConfigId id) const;
 
-    std::vector<std::any> user_configs_;
+    std::vector<std::shared_ptr<const UserConfig>> user_configs_;
 };
 
 class StorageData;
+class KeysDiffChannel;
 
 }  // namespace dynamic_config::impl
 
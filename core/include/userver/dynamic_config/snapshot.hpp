@@ -160,6 +160,7 @@ private:
     // for the constructor
     friend class Source;
     friend class impl::StorageData;
+    friend class impl::KeysDiffChannel;
 
     explicit Snapshot(const impl::StorageData& storage);
 
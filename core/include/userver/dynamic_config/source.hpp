@@ -6,10 +6,12 @@
 #include <optional>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -93,10 +95,17 @@ public:
         return VariableSnapshotPtr{GetSnapshot(), key};
     }
 
+    /// @brief Returns a copy of the config variable.
+    ///
+    /// Faster than `GetSnapshot()[key]`: the config is read from a
+    /// thread-local copy that is refreshed only after the config updates.
     template <typename VariableType>
     VariableType GetCopy(const Key<VariableType>& key) const {
-        const auto snapshot = GetSnapshot();
-        return snapshot[key];
+        std::optional<VariableType> result;
+        ReadCached([&](const impl::SnapshotData& data) {
+            result.emplace(data.Get<VariableType>(impl::ConfigIdGetter::Get(key)));
+        });
+        return std::move(*result);
     }
 
     /// Subscribes to dynamic-config updates using a member function. Also
@@ -175,7 +184,9 @@ public:
     /// snapshot (this invocation will be executed synchronously).
     ///
     /// @note Сallbacks occur only if one of the passed config is changed. This is
-    /// true under any components::DynamicConfigClientUpdater options.
+    /// true under any components::DynamicConfigClientUpdater options. Updates
+    /// that do not change the JSON values of the passed configs do not wake up
+    /// the subscriber at all.
     ///
     /// @warning To use this function, configs must have the `operator==`.
     ///
@@ -200,7 +211,9 @@ public:
             if (!HasChanged(diff, keys...)) return;
             (obj->*func)(diff.current);
         };
-        return DoUpdateAndListen(concurrent::FunctionId(obj), name, std::move(wrapper));
+        return DoUpdateAndListen(
+            concurrent::FunctionId(obj), name, {impl::ConfigIdGetter::Get(keys)...}, std::move(wrapper)
+        );
     }
 
     SnapshotEventSource& GetEventChannel();
@@ -220,12 +233,21 @@ private:
         return !is_equal;
     }
 
+    void ReadCached(utils::function_ref<void(const impl::SnapshotData&)> func) const;
+
     concurrent::AsyncEventSubscriberScope
     DoUpdateAndListen(concurrent::FunctionId id, std::string_view name, SnapshotEventSource::Function&& func);
 
     concurrent::AsyncEventSubscriberScope
     DoUpdateAndListen(concurrent::FunctionId id, std::string_view name, DiffEventSource::Function&& func);
 
+    concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
+        concurrent::FunctionId id,
+        std::string_view name,
+        std::vector<impl::ConfigId> config_ids,
+        DiffEventSource::Function&& func
+    );
+
     impl::StorageData* storage_;
 };
 
@@ -6,6 +6,7 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/task_context_factory.hpp>
 #include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utils/impl/wrapped_call.hpp>
@@ -21,6 +22,7 @@ template <template <typename> typename TaskType, typename Function, typename...
     TaskProcessor& task_processor,
     Task::Importance importance,
     Deadline deadline,
+    std::optional<TaskPriority> priority,
     Function&& f,
     Args&&... args
 ) {
@@ -28,7 +30,9 @@ template <template <typename> typename TaskType, typename Function, typename...
     constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
 
     return TaskType<ResultType>{MakeTask(
-        {task_processor, importance, kWaitMode, deadline}, std::forward<Function>(f), std::forward<Args>(args)...
+        {task_processor, importance, kWaitMode, deadline, priority},
+        std::forward<Function>(f),
+        std::forward<Args>(args)...
     )};
 }
 
@@ -38,7 +42,7 @@ template <template <typename> typename TaskType, typename Function, typename...
 template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor, Function&& f, Args&&... args) {
     return impl::MakeTaskWithResult<TaskWithResult>(
-        task_processor, Task::Importance::kNormal, {}, std::forward<Function>(f), std::forward<Args>(args)...
+        task_processor, Task::Importance::kNormal, {}, {}, std::forward<Function>(f), std::forward<Args>(args)...
     );
 }
 
@@ -46,7 +50,7 @@ template <typename Function, typename... Args>
 template <typename Function, typename... Args>
 [[nodiscard]] auto SharedAsyncNoSpan(TaskProcessor& task_processor, Function&& f, Args&&... args) {
     return impl::MakeTaskWithResult<SharedTaskWithResult>(
-        task_processor, Task::Importance::kNormal, {}, std::forward<Function>(f), std::forward<Args>(args)...
+        task_processor, Task::Importance::kNormal, {}, {}, std::forward<Function>(f), std::forward<Args>(args)...
     );
 }
 
@@ -55,7 +59,7 @@ template <typename Function, typename... Args>
 template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor, Deadline deadline, Function&& f, Args&&... args) {
     return impl::MakeTaskWithResult<TaskWithResult>(
-        task_processor, Task::Importance::kNormal, deadline, std::forward<Function>(f), std::forward<Args>(args)...
+        task_processor, Task::Importance::kNormal, deadline, {}, std::forward<Function>(f), std::forward<Args>(args)...
     );
 }
 
@@ -64,7 +68,17 @@ template <typename Function, typename... Args>
 template <typename Function, typename... Args>
 [[nodiscard]] auto SharedAsyncNoSpan(TaskProcessor& task_processor, Deadline deadline, Function&& f, Args&&... args) {
     return impl::MakeTaskWithResult<SharedTaskWithResult>(
-        task_processor, Task::Importance::kNormal, deadline, std::forward<Function>(f), std::forward<Args>(args)...
+        task_processor, Task::Importance::kNormal, deadline, {}, std::forward<Function>(f), std::forward<Args>(args)...
+    );
+}
+
+/// Runs an asynchronous function call with the specified priority using
+/// specified task processor
+/// @see engine::TaskPriority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor, TaskPriority priority, Function&& f, Args&&... args) {
+    return impl::MakeTaskWithResult<TaskWithResult>(
+        task_processor, Task::Importance::kNormal, {}, priority, std::forward<Function>(f), std::forward<Args>(args)...
     );
 }
 
@@ -98,13 +112,23 @@ template <typename Function, typename... Args>
     );
 }
 
+/// Runs an asynchronous function call with the specified priority using task
+/// processor of the caller
+/// @see engine::TaskPriority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskPriority priority, Function&& f, Args&&... args) {
+    return AsyncNoSpan(
+        current_task::GetTaskProcessor(), priority, std::forward<Function>(f), std::forward<Args>(args)...
+    );
+}
+
 /// @brief Runs an asynchronous function call that will start regardless of
 /// cancellations using specified task processor
 /// @see Task::Importance::Critical
 template <typename Function, typename... Args>
 [[nodiscard]] auto CriticalAsyncNoSpan(TaskProcessor& task_processor, Function&& f, Args&&... args) {
     return impl::MakeTaskWithResult<TaskWithResult>(
-        task_processor, Task::Importance::kCritical, {}, std::forward<Function>(f), std::forward<Args>(args)...
+        task_processor, Task::Importance::kCritical, {}, {}, std::forward<Function>(f), std::forward<Args>(args)...
     );
 }
 
@@ -114,7 +138,7 @@ template <typename Function, typename... Args>
 template <typename Function, typename... Args>
 [[nodiscard]] auto SharedCriticalAsyncNoSpan(TaskProcessor& task_processor, Function&& f, Args&&... args) {
     return impl::MakeTaskWithResult<SharedTaskWithResult>(
-        task_processor, Task::Importance::kCritical, {}, std::forward<Function>(f), std::forward<Args>(args)...
+        task_processor, Task::Importance::kCritical, {}, {}, std::forward<Function>(f), std::forward<Args>(args)...
     );
 }
 
@@ -147,6 +171,7 @@ template <typename Function, typename... Args>
         current_task::GetTaskProcessor(),
         Task::Importance::kCritical,
         deadline,
+        {},
         std::forward<Function>(f),
         std::forward<Args>(args)...
     );
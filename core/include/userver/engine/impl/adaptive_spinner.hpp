@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// @brief Spin-waits on a contended lock before the waiter is suspended.
+///
+/// The number of spins is bounded by a running estimate of the spins that
+/// were needed to acquire the lock recently, like PTHREAD_MUTEX_ADAPTIVE_NP
+/// does: locks with short critical sections are acquired without a context
+/// switch, and the spinning on locks with long critical sections is bounded
+/// by a small constant.
+///
+/// Spinning is skipped on single-threaded task processors, where the lock
+/// owner can not make progress while the waiter spins.
+class AdaptiveSpinner final {
+public:
+    /// Calls `try_lock` until it succeeds or the spin limit is reached
+    bool Spin(utils::function_ref<bool()> try_lock) noexcept;
+
+private:
+    // Averaged number of spins that were required to acquire the lock
+    std::atomic<std::uint32_t> spins_estimate_{0};
+};
+
+/// Spinner for the mutexes that should suspend the waiters immediately
+class NoSpinner final {
+public:
+    bool Spin(utils::function_ref<bool()>) noexcept { return false; }
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
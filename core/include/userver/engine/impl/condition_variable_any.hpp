@@ -33,7 +33,7 @@ public:
     void NotifyAll();
 
 private:
-    FastPimplWaitList waiters_;
+    FastPimplFlatCombiningWaitList waiters_;
 };
 
 template <typename MutexType>
@@ -3,10 +3,12 @@
 #include <cstddef>
 #include <memory>
 #include <new>
+#include <optional>
 #include <utility>
 
 #include <userver/engine/impl/task_context_holder.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/wrapped_call.hpp>
 
@@ -24,15 +26,22 @@ struct TaskConfig final {
     Task::Importance importance{Task::Importance::kNormal};
     Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
     engine::Deadline deadline;
+    // Inherited from the current task if not set
+    std::optional<TaskPriority> priority{};
 };
 
-[[nodiscard]] TaskContext&
-PlacementNewTaskContext(std::byte* storage, TaskConfig config, utils::impl::WrappedCallBase& payload);
+[[nodiscard]] TaskContext& PlacementNewTaskContext(
+    std::byte* storage,
+    std::size_t total_size,
+    TaskConfig config,
+    utils::impl::WrappedCallBase& payload
+);
 
-// Never returns nullptr, may throw.
+// Never returns nullptr, may throw. The storage for small payloads is taken
+// from a thread-local free list.
 std::byte* AllocateFusedTaskContext(std::size_t total_size);
 
-void DeleteFusedTaskContext(std::byte* storage) noexcept;
+void DeleteFusedTaskContext(std::byte* storage, std::size_t total_size) noexcept;
 
 // The allocations for TaskContext and WrappedCall are manually fused. The
 // layout is as follows:
@@ -57,7 +66,7 @@ TaskContextHolder MakeTask(TaskConfig config, Function&& f, Args&&... args) {
     const auto total_size = task_context_size + kPayloadSize;
 
     std::byte* const storage = AllocateFusedTaskContext(total_size);
-    utils::FastScopeGuard delete_guard{[&]() noexcept { DeleteFusedTaskContext(storage); }};
+    utils::FastScopeGuard delete_guard{[&]() noexcept { DeleteFusedTaskContext(storage, total_size); }};
 
     std::byte* const payload_storage = storage + task_context_size;
 
@@ -65,7 +74,7 @@ TaskContextHolder MakeTask(TaskConfig config, Function&& f, Args&&... args) {
         utils::impl::PlacementNewWrapCall(payload_storage, std::forward<Function>(f), std::forward<Args>(args)...);
     utils::FastScopeGuard destroy_payload_guard{[&]() noexcept { std::destroy_at(&payload); }};
 
-    auto& context = PlacementNewTaskContext(storage, config, payload);
+    auto& context = PlacementNewTaskContext(storage, total_size, config, payload);
 
     destroy_payload_guard.Release();
     delete_guard.Release();
@@ -11,6 +11,9 @@ class TaskContext;
 class WaitList;
 using FastPimplWaitList = utils::FastPimpl<WaitList, 88, alignof(void*)>;
 
+class FlatCombiningWaitList;
+using FastPimplFlatCombiningWaitList = utils::FastPimpl<FlatCombiningWaitList, 48, alignof(void*)>;
+
 class WaitListLight;
 using FastPimplWaitListLight = utils::FastPimpl<WaitListLight, 16, 16>;
 
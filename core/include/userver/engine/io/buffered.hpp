@@ -3,8 +3,10 @@
 /// @file userver/engine/io/buffered.hpp
 /// @brief Buffered I/O wrappers
 
+#include <cstddef>
 #include <functional>
 #include <string>
+#include <string_view>
 
 #include <userver/compiler/select.hpp>
 #include <userver/engine/deadline.hpp>
@@ -27,6 +29,12 @@ public:
     TerminatorNotFoundException();
 };
 
+/// Thrown by BufferedReader on a malformed frame
+class FrameException : public IoException {
+public:
+    using IoException::IoException;
+};
+
 /// Wrapper for buffered input
 class BufferedReader final {
 public:
@@ -71,7 +79,53 @@ public:
     /// Discards the specified number of bytes from the buffer.
     void Discard(size_t num_bytes, Deadline deadline = {});
 
+    /// @name Zero-copy access
+    /// Views over the internal buffer, valid until the next call to a
+    /// non-const method of the reader. Viewed bytes stay in the buffer until
+    /// they are removed by Consume, so protocol parsers may work in place:
+    /// @code
+    /// const auto frame = reader.PeekLengthPrefixedFrame(4, kMaxFrameSize);
+    /// if (frame.empty()) return;  // EOF
+    /// Parse(frame.substr(4));
+    /// reader.Consume(frame.size());
+    /// @endcode
+    /// @{
+
+    /// @brief Returns a view of the buffered bytes, reading some bytes from the
+    /// input stream if the buffer is empty.
+    /// @returns an empty view on EOF
+    std::string_view PeekSome(Deadline deadline = {});
+
+    /// @brief Returns a view of the exact number of bytes from the input
+    /// stream, reading the missing ones.
+    /// @note May return less bytes than requested in case of EOF.
+    std::string_view PeekAll(size_t num_bytes, Deadline deadline = {});
+
+    /// @brief Returns a view of the stream up to and including the specified
+    /// character, reading the stream until it is encountered.
+    /// @throws TerminatorNotFoundException on EOF before the terminator
+    std::string_view PeekUntil(char terminator, Deadline deadline = {});
+
+    /// @brief Returns a view of a frame prefixed with its payload length,
+    /// including the prefix.
+    /// @param prefix_size the size of the big-endian (network byte order)
+    /// unsigned payload length, from 1 to 8 bytes
+    /// @param max_payload_size the biggest allowed payload length
+    /// @returns an empty view on EOF before the frame
+    /// @throws FrameException on EOF in the middle of the frame or a payload
+    /// length above max_payload_size
+    std::string_view PeekLengthPrefixedFrame(size_t prefix_size, size_t max_payload_size, Deadline deadline = {});
+
+    /// @brief Removes the specified number of already buffered bytes,
+    /// e.g. the ones returned by one of the Peek* methods.
+    void Consume(size_t num_bytes);
+
+    /// @}
+
 private:
+    // Returns false on EOF before `num_bytes` are buffered
+    bool EnsureAvailable(size_t num_bytes, Deadline deadline);
+
     size_t FillBuffer(Deadline deadline);
 
     ReadableBasePtr source_;
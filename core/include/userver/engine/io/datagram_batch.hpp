@@ -0,0 +1,67 @@
+#pragma once
+
+/// @file userver/engine/io/datagram_batch.hpp
+/// @brief @copybrief engine::io::DatagramBatch
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include <userver/engine/io/sockaddr.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+class Socket;
+
+/// @brief Reusable storage for the datagrams received by
+/// engine::io::Socket::RecvSomeBatchFrom.
+///
+/// Buffers are allocated once in the constructor and are reused by all the
+/// receives, so a single instance should be kept for the lifetime of a
+/// receiving loop. The received data is valid until the next receive.
+class DatagramBatch final {
+public:
+    /// @param max_messages the maximum number of messages received by a
+    /// single system call
+    /// @param message_size the buffer size for each message, longer datagrams
+    /// are truncated. With `UDP_GRO` enabled on the socket a message may hold
+    /// many coalesced datagrams, so the size should be 64KiB.
+    DatagramBatch(std::size_t max_messages, std::size_t message_size);
+
+    DatagramBatch(DatagramBatch&&) noexcept;
+    DatagramBatch& operator=(DatagramBatch&&) noexcept;
+    ~DatagramBatch();
+
+    /// Number of the datagrams received
+    std::size_t Size() const noexcept;
+
+    bool IsEmpty() const noexcept { return Size() == 0; }
+
+    /// Data of the `index`-th datagram
+    std::string_view GetData(std::size_t index) const;
+
+    /// Source address of the `index`-th datagram
+    const Sockaddr& GetSourceAddress(std::size_t index) const;
+
+    /// Whether the `index`-th datagram did not fit into the message buffer
+    bool IsTruncated(std::size_t index) const;
+
+private:
+    friend class Socket;
+
+    std::size_t MaxMessages() const noexcept;
+
+    // Receives the available messages without waiting, recvmmsg-like
+    [[nodiscard]] ssize_t Receive(int fd);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
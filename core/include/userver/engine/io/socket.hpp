@@ -5,10 +5,12 @@
 
 #include <sys/socket.h>
 
+#include <chrono>
 #include <initializer_list>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/common.hpp>
+#include <userver/engine/io/datagram_batch.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/fd_control_holder.hpp>
 #include <userver/engine/io/sockaddr.hpp>
@@ -112,6 +114,15 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Sends exactly len bytes of the file `file_fd` starting from
+    /// `offset` to the socket without copying them to the userspace, using
+    /// sendfile(2) where available.
+    /// @note Can return less than len if socket is closed by peer or if the
+    /// file is shorter than expected.
+    /// @note Reading the file blocks the calling task processor worker, so the
+    /// file should reside in page cache.
+    [[nodiscard]] size_t SendFileAll(int file_fd, std::size_t offset, std::size_t len, Deadline deadline);
+
     /// @brief Accepts a connection from a listening socket.
     /// @see engine::io::Listen
     [[nodiscard]] Socket Accept(Deadline);
@@ -129,6 +140,32 @@ public:
     /// @note Not for SocketType::kStream connections, see `man sendto`.
     [[nodiscard]] size_t SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Receives at least one datagram into `batch`, and all the other
+    /// immediately available ones that fit, using recvmmsg(2) where available.
+    /// @returns the number of the received datagrams, see DatagramBatch
+    /// @note Datagrams coalesced by the kernel with `UDP_GRO` socket option
+    /// are split back.
+    /// @note Not for SocketType::kStream connections.
+    [[nodiscard]] std::size_t RecvSomeBatchFrom(DatagramBatch& batch, Deadline deadline);
+
+    /// @brief Sends each of `count` buffers as a separate datagram to the
+    /// specified address, using sendmmsg(2) where available.
+    /// @returns the number of datagrams sent, less than `count` if the socket
+    /// is closed by peer.
+    /// @note Sockaddr domain must match the socket's domain.
+    /// @note Not for SocketType::kStream connections.
+    [[nodiscard]] std::size_t
+    SendAllBatchTo(const Sockaddr& dest_addr, const IoData* datagrams, std::size_t count, Deadline deadline);
+
+    /// @brief Sends exactly len bytes to the specified address as datagrams of
+    /// `segment_size` bytes (the last one may be shorter), letting the kernel
+    /// split the buffer with UDP GSO where available.
+    /// @note Can return less than len in bytes_sent if socket is closed by peer.
+    /// @note Sockaddr domain must match the socket's domain.
+    /// @note Not for SocketType::kStream connections.
+    [[nodiscard]] size_t
+    SendAllSegmentedTo(const Sockaddr& dest_addr, const void* buf, size_t len, size_t segment_size, Deadline deadline);
+
     /// File descriptor corresponding to this socket.
     int Fd() const;
 
@@ -146,6 +183,17 @@ public:
     /// sometimes but it's loosely predictable.
     void Close();
 
+    /// @brief Trades CPU for latency: makes the kernel busy poll the device
+    /// queue for up to `busy_poll` waiting for the data (`SO_BUSY_POLL` and
+    /// `SO_PREFER_BUSY_POLL`), and makes TCP acknowledge each received segment
+    /// without a delay (`TCP_QUICKACK`, rearmed after each receive).
+    /// Zero `busy_poll` leaves the busy polling settings intact.
+    /// @note Does nothing for the options not supported by the platform.
+    /// @note Increasing `busy_poll` above the `net.core.busy_read` sysctl
+    /// value requires `CAP_NET_ADMIN`, `SO_PREFER_BUSY_POLL` is silently
+    /// skipped without it.
+    void EnableLowLatency(std::chrono::microseconds busy_poll);
+
     /// Retrieves a socket option.
     int GetOption(int layer, int optname) const;
 
@@ -185,6 +233,7 @@ private:
     impl::FdControlHolder fd_control_;
     Sockaddr peername_;
     Sockaddr sockname_;
+    bool quick_ack_{false};
 };
 
 }  // namespace engine::io
@@ -17,6 +17,26 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// @brief Additional settings of TlsWrapper::StartTlsServer()
+struct TlsServerSettings final {
+    /// @brief Keys of stateless TLS session tickets, 80 bytes each: 16 bytes of
+    /// the key name, 32 bytes of the HMAC secret and 32 bytes of the AES key.
+    ///
+    /// New tickets are encrypted with the first key and any of the keys decrypts
+    /// them. To rotate the keys put a new key first and keep the previous ones
+    /// for the lifetime of the issued tickets. No tickets are issued if empty.
+    std::vector<std::string> session_ticket_keys;
+
+    /// @brief Whether to move the encryption of the sent data to the kernel
+    /// (kTLS) after the handshake. Silently falls back to the userspace
+    /// encryption if the kernel, OpenSSL or the negotiated cipher do not
+    /// support it.
+    ///
+    /// The received data is decrypted in userspace anyway. TlsWrapper::StopTls()
+    /// is not supported if kernel TLS is enabled.
+    bool kernel_tls_tx{false};
+};
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe. E.g. you MAY NOT read and write concurrently from multiple
@@ -48,6 +68,16 @@ public:
         const std::vector<crypto::Certificate>& extra_cert_authorities = {}
     );
 
+    /// Starts a TLS server with additional settings on an opened socket
+    static TlsWrapper StartTlsServer(
+        Socket&& socket,
+        const crypto::Certificate& cert,
+        const crypto::PrivateKey& key,
+        Deadline deadline,
+        const std::vector<crypto::Certificate>& extra_cert_authorities,
+        const TlsServerSettings& settings
+    );
+
     ~TlsWrapper() override;
 
     TlsWrapper(const TlsWrapper&) = delete;
@@ -78,6 +108,16 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// Whether the sent data is encrypted by the kernel, see
+    /// TlsServerSettings::kernel_tls_tx
+    bool IsKernelTlsTxEnabled() const noexcept;
+
+    /// @brief Sends exactly len bytes of the file starting from offset with
+    /// sendfile(2).
+    /// @note Can return less than len if socket is closed by peer.
+    /// @throws TlsException if IsKernelTlsTxEnabled() is false.
+    [[nodiscard]] size_t SendFileAll(int file_fd, std::size_t offset, std::size_t len, Deadline deadline);
+
     /// @brief Finishes TLS session and returns the socket.
     /// @warning Wrapper becomes invalid on entry and can only be used to retry
     ///   socket extraction if interrupted.
@@ -113,7 +153,7 @@ private:
 
     class Impl;
     class ReadContextAccessor;
-    constexpr static size_t kSize = 336;
+    constexpr static size_t kSize = 344;
     constexpr static size_t kAlignment = 8;
     utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
@@ -20,6 +20,11 @@ struct TaskProcessorPoolsConfig final {
     std::size_t ev_threads_num = 1;
     std::string ev_thread_name = "ev";
     bool ev_default_loop_disabled = false;
+    /// libev backend of the ev threads: "auto", "epoll" or "io_uring"
+    std::string ev_backend = "auto";
+    /// ev threads spin instead of sleeping in the backend, see the
+    /// `event_thread_pool.busy_poll` option of components::ManagerControllerComponent
+    bool ev_busy_poll = false;
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
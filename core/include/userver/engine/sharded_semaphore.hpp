@@ -0,0 +1,113 @@
+#pragma once
+
+/// @file userver/engine/sharded_semaphore.hpp
+/// @brief @copybrief engine::ShardedSemaphore
+
+#include <atomic>
+#include <chrono>
+#include <shared_mutex>  // for std locks
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::Semaphore for a single lock per user, intended for
+/// concurrency limits that are hammered by many threads, e.g. in-flight
+/// request limits.
+///
+/// The locks are taken from the shared engine::Semaphore in batches and are
+/// cached in per-CPU slices, so most of the lock_shared() and unlock_shared()
+/// calls only touch the cache line of the current CPU. If both the slice of
+/// the current CPU and the shared semaphore are empty, the locks cached by
+/// other CPUs are taken before going to sleep, and unlock_shared() stops
+/// caching the locks while someone is waiting.
+///
+/// At most 1/8 of the capacity is cached in the slices, so the semaphores with
+/// a small capacity compared to the number of CPUs do not cache at all.
+///
+/// Like engine::Semaphore, it ignores task cancellation and may be used with
+/// std::shared_lock.
+///
+/// @note Per-CPU slices require rseq (x86_64 Linux). Otherwise all the calls
+/// go to the shared semaphore directly.
+class ShardedSemaphore final {
+public:
+    using Counter = Semaphore::Counter;
+
+    /// Creates a semaphore with predefined number of available locks
+    /// @param capacity initial number of available locks
+    explicit ShardedSemaphore(Counter capacity);
+
+    ~ShardedSemaphore();
+
+    ShardedSemaphore(ShardedSemaphore&&) = delete;
+    ShardedSemaphore(const ShardedSemaphore&) = delete;
+    ShardedSemaphore& operator=(ShardedSemaphore&&) = delete;
+    ShardedSemaphore& operator=(const ShardedSemaphore&) = delete;
+
+    /// @copydoc Semaphore::SetCapacity
+    void SetCapacity(Counter capacity);
+
+    /// @copydoc Semaphore::GetCapacity
+    [[nodiscard]] Counter GetCapacity() const noexcept;
+
+    /// @copydoc Semaphore::RemainingApprox
+    [[nodiscard]] std::size_t RemainingApprox() const;
+
+    /// @copydoc Semaphore::UsedApprox
+    [[nodiscard]] std::size_t UsedApprox() const;
+
+    /// @copydoc Semaphore::lock_shared
+    void lock_shared();
+
+    /// @copydoc Semaphore::unlock_shared
+    void unlock_shared();
+
+    /// @copydoc Semaphore::try_lock_shared
+    [[nodiscard]] bool try_lock_shared();
+
+    template <typename Rep, typename Period>
+    [[nodiscard]] bool try_lock_shared_for(std::chrono::duration<Rep, Period>);
+
+    template <typename Clock, typename Duration>
+    [[nodiscard]] bool try_lock_shared_until(std::chrono::time_point<Clock, Duration>);
+
+    [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+private:
+    using Slice = concurrent::impl::InterferenceShield<std::atomic<Counter>>;
+
+    bool TryLockSlow(std::size_t slice_index);
+    template <typename SharedLock>
+    bool LockOrWait(SharedLock&& shared_lock);
+    bool TryTakeFromSlices(std::size_t first_slice_index) noexcept;
+    void CacheLocks(Slice& slice, Counter count);
+    void FlushSlice(Slice& slice);
+    void FlushSlices();
+
+    Semaphore shared_;
+    std::atomic<std::size_t> batch_size_;
+    std::atomic<std::size_t> waiters_{0};
+    utils::FixedArray<Slice> slices_;
+};
+
+template <typename Rep, typename Period>
+bool ShardedSemaphore::try_lock_shared_for(std::chrono::duration<Rep, Period> duration) {
+    return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool ShardedSemaphore::try_lock_shared_until(std::chrono::time_point<Clock, Duration> until) {
+    return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
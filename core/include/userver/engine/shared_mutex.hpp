@@ -4,6 +4,7 @@
 /// @brief @copybrief engine::SharedMutex
 
 #include <userver/engine/condition_variable.hpp>
+#include <userver/engine/impl/adaptive_spinner.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/semaphore.hpp>
 
@@ -117,6 +118,10 @@ private:
 
     void DecWaitingWriters();
 
+    bool SpinLock();
+
+    bool SpinLockShared();
+
     /* Semaphore can be get by 1 or by SIZE_MAX.
      * 1 = reader, SIZE_MAX = writer.
      *
@@ -127,6 +132,9 @@ private:
      */
     Semaphore semaphore_;
 
+    /* Short critical sections are waited for without suspending the task */
+    impl::AdaptiveSpinner spinner_;
+
     /* Readers don't try to hold semaphore_ if there is at least one
      * waiting writer => writers don't starve.
      */
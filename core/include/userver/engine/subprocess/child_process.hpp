@@ -13,6 +13,11 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::io {
+class PipeReader;
+class PipeWriter;
+}  // namespace engine::io
+
 namespace engine::subprocess {
 
 class ChildProcessImpl;
@@ -63,8 +68,23 @@ public:
     /// Send a signal to the child process.
     void SendSignal(int signum);
 
+    /// @brief Returns the writing end of the pipe connected to stdin of the
+    /// child process. Close it to send EOF to the child process.
+    /// @throws std::logic_error if ExecOptions::stdin_pipe was not set
+    io::PipeWriter& GetStdin();
+
+    /// @brief Returns the reading end of the pipe connected to stdout of the
+    /// child process.
+    /// @throws std::logic_error if ExecOptions::stdout_pipe was not set
+    io::PipeReader& GetStdout();
+
+    /// @brief Returns the reading end of the pipe connected to stderr of the
+    /// child process.
+    /// @throws std::logic_error if ExecOptions::stderr_pipe was not set
+    io::PipeReader& GetStderr();
+
 private:
-    static constexpr std::size_t kImplSize = compiler::SelectSize().For64Bit(24).For32Bit(12);
+    static constexpr std::size_t kImplSize = compiler::SelectSize().For64Bit(120).For32Bit(60);
     static constexpr std::size_t kImplAlignment = alignof(void*);
     utils::FastPimpl<ChildProcessImpl, kImplSize, kImplAlignment> impl_;
 };
@@ -40,11 +40,24 @@ struct ExecOptions final {
     /// If `true`, and `executable_path` contains `/`, `executable_path` is treated as absolute
     /// path or a relative path.
     bool use_path{false};
+    /// If `true`, stdin of the child process is connected to a pipe, see
+    /// ChildProcess::GetStdin(). Otherwise the service's stdin is inherited.
+    bool stdin_pipe{false};
+    /// If `true`, stdout of the child process is connected to a pipe, see
+    /// ChildProcess::GetStdout(). Must not be used together with `stdout_file`.
+    bool stdout_pipe{false};
+    /// If `true`, stderr of the child process is connected to a pipe, see
+    /// ChildProcess::GetStderr(). Must not be used together with `stderr_file`.
+    bool stderr_pipe{false};
 };
 
 /// @ingroup userver_clients
 ///
 /// @brief Creates a new OS subprocess and executes a command in it.
+///
+/// On Linux the subprocess is created with `clone(CLONE_VM | CLONE_VFORK)`,
+/// so the page tables of the service are not copied and the start time does
+/// not depend on the memory consumption of the service.
 class ProcessStarter {
 public:
     /// @param task_processor will be used for executing asynchronous fork + exec.
@@ -58,7 +71,8 @@ public:
     /// @param args exact args passed to the executable
     /// @param options @ref ExecOptions settings
     /// @throws std::runtime_error if `use_path` is `true`, `executable_path` contains `/`
-    /// and PATH not in environment variables
+    /// and PATH not in environment variables, or if both a pipe and a file are
+    /// requested for stdout or stderr
     ChildProcess
     Exec(const std::string& executable_path, const std::vector<std::string>& args, ExecOptions&& options = {});
 
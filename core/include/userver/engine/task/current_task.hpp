@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -29,6 +30,15 @@ TaskProcessor& GetTaskProcessor();
 /// Returns task coroutine stack size
 std::size_t GetStackSize();
 
+/// Returns the priority of the current task
+TaskPriority GetPriority();
+
+/// @brief Sets the priority of the current task.
+///
+/// Affects the following wakeups of the task and the child tasks created
+/// after the call.
+void SetPriority(TaskPriority priority);
+
 /// @cond
 // Returns ev thread handle, internal use only
 ev::ThreadControl& GetEventThread();
@@ -0,0 +1,31 @@
+#pragma once
+
+/// @file userver/engine/task/task_priority.hpp
+/// @brief @copybrief engine::TaskPriority
+
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @brief Request class of a task.
+///
+/// With `task-processor-queue: priority-task-queue` the tasks of higher
+/// priority are taken from the queue more often. Whatever the queue is, on
+/// wait time overload the tasks of the lower priority are cancelled earlier.
+///
+/// Child tasks inherit the priority of the task that created them.
+enum class TaskPriority : std::uint8_t {
+    kHigh,
+    kNormal,
+    kLow,
+};
+
+/// Count of the engine::TaskPriority values
+inline constexpr std::size_t kTaskPriorityCount = 3;
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,127 @@
+#pragma once
+
+/// @file userver/engine/task_group.hpp
+/// @brief @copybrief engine::TaskGroup
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <userver/engine/impl/task_context_factory.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+
+class TaskGroupState;
+
+class TaskGroupChildToken final {
+public:
+    explicit TaskGroupChildToken(std::shared_ptr<TaskGroupState> state) noexcept;
+
+    TaskGroupChildToken(TaskGroupChildToken&&) noexcept = default;
+    TaskGroupChildToken& operator=(TaskGroupChildToken&&) = delete;
+    ~TaskGroupChildToken();
+
+    void SetException(std::exception_ptr&& exception) noexcept;
+
+private:
+    std::shared_ptr<TaskGroupState> state_;
+};
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief A group of child tasks that are started and waited together.
+///
+/// Compared to a vector of engine::TaskWithResult and engine::GetAll:
+/// * the children spawned before Start() or Wait() are pushed into the task
+///   queue in a single operation;
+/// * the completions are counted with a single atomic, and the waiting parent
+///   is woken up once, when all the children are finished or when the first
+///   of them fails;
+/// * on the first failure the rest of the children are cancelled.
+///
+/// The results of the children are not stored, the children should write
+/// them to the storage provided by the caller. The children are spawned
+/// without spans, like engine::AsyncNoSpan, so create a tracing::Span
+/// in the child if it needs one.
+///
+/// ## Example usage:
+///
+/// @snippet engine/task_group_test.cpp  Sample engine::TaskGroup usage
+///
+/// @note TaskGroup is not thread-safe, all of its methods should be called
+/// from the task that owns it.
+class TaskGroup final {
+public:
+    /// Spawns the children on the current task processor
+    TaskGroup();
+
+    explicit TaskGroup(TaskProcessor& task_processor);
+
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    /// Starts the pending children, cancels all the unfinished children and
+    /// waits for them
+    ~TaskGroup();
+
+    /// Creates a child task that runs `f(args...)`. The child is started by
+    /// the next Start() or Wait()
+    template <typename Function, typename... Args>
+    void Spawn(Function&& f, Args&&... args);
+
+    /// Pushes all the pending children into the task queue at once
+    void Start();
+
+    /// @brief Starts the pending children and waits for all children to finish.
+    ///
+    /// @throws std::exception the first exception of a child, after the rest
+    /// of the children are cancelled and finished
+    /// @throws WaitInterruptedException if the current task is cancelled, after
+    /// the children are cancelled and finished
+    void Wait();
+
+    /// Cancels all the started unfinished children
+    void RequestCancel();
+
+    /// Returns the number of the spawned children that are not finished yet
+    std::size_t GetUnfinishedCount() const noexcept;
+
+private:
+    impl::TaskGroupChildToken MakeChildToken();
+
+    void AddChild(impl::TaskContextHolder&& context);
+
+    void WaitFinished(bool rethrow);
+
+    TaskProcessor& task_processor_;
+    std::shared_ptr<impl::TaskGroupState> state_;
+};
+
+template <typename Function, typename... Args>
+void TaskGroup::Spawn(Function&& f, Args&&... args) {
+    AddChild(impl::MakeTask(
+        {task_processor_},
+        [token = MakeChildToken()](auto&& func, auto&&... func_args) mutable {
+            try {
+                std::invoke(std::forward<decltype(func)>(func), std::forward<decltype(func_args)>(func_args)...);
+            } catch (const std::exception&) {
+                token.SetException(std::current_exception());
+            }
+        },
+        std::forward<Function>(f),
+        std::forward<Args>(args)...
+    ));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
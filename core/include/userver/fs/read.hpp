@@ -3,6 +3,8 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -15,15 +17,28 @@ USERVER_NAMESPACE_BEGIN
 /// @brief filesystem support
 namespace fs {
 
+namespace blocking {
+class FileDescriptor;
+}  // namespace blocking
+
 /// @brief Struct file with load data
 struct FileInfoWithData {
+    /// File contents, empty if the file is kept open in `file` instead
     std::string data;
     std::string extension;
+    /// File size in bytes
+    std::size_t size{0};
+    /// Opened file for the files that are not loaded into memory, e.g. to be
+    /// sent with sendfile(2) directly from the page cache
+    std::shared_ptr<const blocking::FileDescriptor> file;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
 using FileInfoWithDataMap = std::unordered_map<std::string, FileInfoWithDataConstPtr>;
 
+/// Passed as `keep_open_min_size` to always load the file contents
+inline constexpr std::size_t kAlwaysLoadContents = std::numeric_limits<std::size_t>::max();
+
 enum class SettingsReadFile {
     kNone = 0,
     /// Skip hidden files,
@@ -41,13 +56,29 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir);
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path to directory to traverse recursively
 /// @param flags settings read files
+/// @param keep_open_min_size files of at least this size are kept open
+/// instead of being loaded into memory, see fs::ReadFileInfoWithData
 /// @returns map with relative to `path` filepaths and file info
 /// @throws std::runtime_error if read fails for any reason (e.g. no such file,
 /// read error, etc.),
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp,
     const std::string& path,
-    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden}
+    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden},
+    std::size_t keep_open_min_size = kAlwaysLoadContents
+);
+
+/// @brief Reads file info asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @param keep_open_min_size files of at least this size are kept open in
+/// FileInfoWithData::file instead of being loaded into FileInfoWithData::data
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithData ReadFileInfoWithData(
+    engine::TaskProcessor& async_tp,
+    const std::string& path,
+    std::size_t keep_open_min_size = kAlwaysLoadContents
 );
 
 /// @brief Reads file contents asynchronously
@@ -4,9 +4,11 @@
 /// @brief @copybrief rcu::Variable
 
 #include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <mutex>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
@@ -28,6 +30,25 @@ USERVER_NAMESPACE_BEGIN
 /// with modified API
 namespace rcu {
 
+/// @brief The way rcu::Variable finds out that a retired version of the value
+/// is no longer read.
+/// @see rcu::DefaultRcuTraits
+enum class ReclamationMode {
+    /// Each version has its own read indicator, and a reader re-checks that the
+    /// version is still current after locking it. A writer commit checks
+    /// the indicators of all the retired versions.
+    kHazardPointers,
+
+    /// Readers lock one of the two read indicators of the current epoch without
+    /// retrying, and a writer commit advances the epoch checking at most two
+    /// indicators regardless of the count of retired versions. A version is
+    /// reclaimed after two epoch advancements.
+    /// @warning A long-living rcu::ReadablePtr delays the reclamation of all
+    /// the versions retired after its creation, not only of the one it
+    /// references.
+    kEpochs,
+};
+
 namespace impl {
 
 template <typename T>
@@ -36,6 +57,7 @@ struct SnapshotRecord final {
     concurrent::impl::StripedReadIndicator indicator;
     concurrent::impl::SinglyLinkedHook<SnapshotRecord> free_list_hook;
     SnapshotRecord* next_retired{nullptr};
+    std::uint64_t reclaim_epoch{0};
 };
 
 // Used instead of concurrent::impl::MemberHook to avoid instantiating
@@ -88,6 +110,61 @@ private:
     SnapshotRecord<T>* head_{nullptr};
 };
 
+// Read indicators of ReclamationMode::kEpochs.
+//
+// Readers lock the indicator of the epoch parity they have observed. An epoch
+// is completed when, after advancing to it, the indicator of the previous
+// parity is observed free. A retired version can't be reached by new readers,
+// and the readers that could have obtained it have locked one of the two
+// indicators. So it is reclaimed once both parities were observed free after
+// the retirement, i.e. two epochs after the last completed one.
+class EpochReadIndicators final {
+public:
+    concurrent::impl::StripedReadIndicatorLock Lock() const noexcept {
+        return indicators_[epoch_.load(std::memory_order_acquire) & 1].Lock();
+    }
+
+    // The methods below must be called under the writer's mutex
+
+    std::uint64_t GetReclaimEpoch() const noexcept { return completed_epoch_ + 2; }
+
+    bool IsReclaimable(std::uint64_t reclaim_epoch) const noexcept { return reclaim_epoch <= completed_epoch_; }
+
+    // Completes up to 2 epochs, which is enough to reclaim all the versions
+    // retired so far, unless some readers hold the indicators
+    void TryAdvance() noexcept {
+        for (int i = 0; i < 2; ++i) {
+            auto epoch = epoch_.load(std::memory_order_relaxed);
+            if (!is_draining_) {
+                ++epoch;
+                epoch_.store(epoch, std::memory_order_seq_cst);
+                is_draining_ = true;
+            }
+
+            // Pairs with AsymmetricThreadFenceLight in ReadablePtr, see the
+            // comments there
+            concurrent::impl::AsymmetricThreadFenceHeavy();
+            if (!indicators_[(epoch - 1) & 1].IsFree()) return;
+
+            is_draining_ = false;
+            completed_epoch_ = epoch;
+        }
+    }
+
+    bool AreAllFree() const noexcept { return concurrent::impl::StripedReadIndicator::AreAllFree(indicators_); }
+
+private:
+    mutable concurrent::impl::StripedReadIndicator indicators_[2];
+    std::atomic<std::uint64_t> epoch_{0};
+    std::uint64_t completed_epoch_{0};
+    bool is_draining_{false};
+};
+
+struct NoEpochReadIndicators final {};
+
+template <typename RcuTraits>
+inline constexpr bool kUsesEpochs = RcuTraits::kReclamationMode == ReclamationMode::kEpochs;
+
 }  // namespace impl
 
 /// @brief A handle to the retired object version, which an RCU deleter should
@@ -175,6 +252,10 @@ struct DefaultRcuTraits {
     /// 1. should contain `void Delete(SnapshotHandle<T>) noexcept`;
     /// 2. force synchronous cleanup of remaining handles on destruction.
     using DeleterType = AsyncDeleter;
+
+    /// `kReclamationMode` selects how the readers are tracked,
+    /// see rcu::ReclamationMode.
+    static constexpr ReclamationMode kReclamationMode = ReclamationMode::kHazardPointers;
 };
 
 /// @brief Deletes garbage synchronously.
@@ -197,6 +278,14 @@ struct BlockingRcuTraits : public DefaultRcuTraits {
     using DeleterType = SyncDeleter;
 };
 
+/// @brief Default RCU traits with ReclamationMode::kEpochs.
+/// Designed for the values that are read very often by many threads, and are
+/// not held by the readers for long.
+/// @see rcu::DefaultRcuTraits
+struct EpochRcuTraits : public DefaultRcuTraits {
+    static constexpr ReclamationMode kReclamationMode = ReclamationMode::kEpochs;
+};
+
 /// Reader smart pointer for rcu::Variable<T>. You may use operator*() or
 /// operator->() to do something with the stored value. Once created,
 /// ReadablePtr references the same immutable value: if Variable's value is
@@ -206,6 +295,15 @@ template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
 public:
     explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) {
+        if constexpr (impl::kUsesEpochs<RcuTraits>) {
+            // The same reasoning as for the hazard pointers below. Either the
+            // writer observes the lock, or we observe the value it has stored.
+            lock_ = ptr.epoch_indicators_.Lock();
+            concurrent::impl::AsymmetricThreadFenceLight();
+            ptr_ = &*ptr.current_.load(std::memory_order_seq_cst)->data;
+            return;
+        }
+
         auto* record = ptr.current_.load();
 
         while (true) {
@@ -393,6 +491,10 @@ public:
     Variable& operator=(Variable&&) = delete;
 
     ~Variable() {
+        if constexpr (impl::kUsesEpochs<RcuTraits>) {
+            UASSERT_MSG(epoch_indicators_.AreAllFree(), "RCU variable is destroyed while being used");
+        }
+
         {
             auto* record = current_.load();
             UASSERT_MSG(record->indicator.IsFree(), "RCU variable is destroyed while being used");
@@ -460,6 +562,9 @@ private:
         current_.store(&new_snapshot, std::memory_order_seq_cst);
 
         UASSERT(old_snapshot);
+        if constexpr (impl::kUsesEpochs<RcuTraits>) {
+            old_snapshot->reclaim_epoch = epoch_indicators_.GetReclaimEpoch();
+        }
         retired_list_.Push(*old_snapshot);
         ScanRetiredList(lock);
     }
@@ -484,6 +589,15 @@ private:
         UASSERT(lock.owns_lock());
         if (retired_list_.IsEmpty()) return;
 
+        if constexpr (impl::kUsesEpochs<RcuTraits>) {
+            epoch_indicators_.TryAdvance();
+            retired_list_.RemoveAndDisposeIf(
+                [&](impl::SnapshotRecord<T>& record) { return epoch_indicators_.IsReclaimable(record.reclaim_epoch); },
+                [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); }
+            );
+            return;
+        }
+
         concurrent::impl::AsymmetricThreadFenceHeavy();
 
         retired_list_.RemoveAndDisposeIf(
@@ -499,8 +613,11 @@ private:
         deleter_.Delete(SnapshotHandle<T>{record, free_list_});
     }
 
-    // Covers current_ writes, free_list_.Pop, retired_list_
+    // Covers current_ writes, free_list_.Pop, retired_list_ and the writer's
+    // state of epoch_indicators_
     MutexType mutex_{};
+    std::conditional_t<impl::kUsesEpochs<RcuTraits>, impl::EpochReadIndicators, impl::NoEpochReadIndicators>
+        epoch_indicators_;
     impl::SnapshotRecordFreeList<T> free_list_;
     impl::SnapshotRecordRetiredList<T> retired_list_;
     // Must be placed after 'free_list_' to force sync cleanup before
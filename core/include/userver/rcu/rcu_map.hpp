@@ -23,6 +23,7 @@ template <typename RcuMapTraits>
 struct RcuTraitsFromRcuMapTraits : public DefaultRcuTraits {
     using MutexType = typename RcuMapTraits::MutexType;
     using DeleterType = typename RcuMapTraits::DeleterType;
+    static constexpr ReclamationMode kReclamationMode = RcuMapTraits::kReclamationMode;
 };
 
 struct ShouldInheritFromDefaultRcuMapTraits {};
@@ -42,12 +43,15 @@ public:
 /// type `Key`
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `DeleterType` and `kReclamationMode` are passed to rcu::Variable,
+/// see rcu::DefaultRcuTraits
 template <typename Key>
 struct DefaultRcuMapTraits : public impl::ShouldInheritFromDefaultRcuMapTraits {
     using Hash = std::hash<Key>;
     using KeyEqual = std::equal_to<Key>;
     using MutexType = engine::Mutex;
     using DeleterType = AsyncDeleter;
+    static constexpr ReclamationMode kReclamationMode = ReclamationMode::kHazardPointers;
 };
 
 /// @brief Forward iterator for the rcu::RcuMap
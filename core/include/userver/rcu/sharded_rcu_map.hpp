@@ -0,0 +1,200 @@
+#pragma once
+
+/// @file userver/rcu/sharded_rcu_map.hpp
+/// @brief @copybrief rcu::ShardedRcuMap
+
+#include <cstddef>
+#include <utility>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Map-like structure allowing RCU keyset updates, that splits the keys
+/// into independent rcu::RcuMap shards by their hash.
+///
+/// A keyset change copies only the shard of the key and takes only its writer
+/// mutex, so big maps with frequent inserts are updated proportionally faster,
+/// and the writers of different shards do not wait for each other.
+/// BulkInsert() and Assign() publish many changes with a single copy of each
+/// affected shard.
+///
+/// Keyset changes of different shards are not atomic, e.g. GetSnapshot() may
+/// observe a part of a concurrent BulkInsert().
+///
+/// ## Example usage:
+///
+/// @snippet rcu/sharded_rcu_map_test.cpp  Sample rcu::ShardedRcuMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, typename RcuMapTraits = DefaultRcuMapTraits<Key>>
+class ShardedRcuMap final {
+public:
+    using Shard = RcuMap<Key, Value, RcuMapTraits>;
+    using Hash = typename Shard::Hash;
+    using KeyEqual = typename Shard::KeyEqual;
+    using ValuePtr = typename Shard::ValuePtr;
+    using ConstValuePtr = typename Shard::ConstValuePtr;
+    using RawMap = typename Shard::RawMap;
+    using Snapshot = typename Shard::Snapshot;
+    using InsertReturnType = typename Shard::InsertReturnType;
+
+    static constexpr std::size_t kDefaultShardCount = 16;
+
+    explicit ShardedRcuMap(std::size_t shard_count = kDefaultShardCount, const Hash& hash = Hash())
+        : shards_(shard_count), hash_(hash) {
+        UINVARIANT(shard_count > 0, "ShardedRcuMap must have at least one shard");
+    }
+
+    ShardedRcuMap(const ShardedRcuMap&) = delete;
+    ShardedRcuMap(ShardedRcuMap&&) = delete;
+    ShardedRcuMap& operator=(const ShardedRcuMap&) = delete;
+    ShardedRcuMap& operator=(ShardedRcuMap&&) = delete;
+
+    /// Returns an estimated size of the map at some point in time
+    std::size_t SizeApprox() const {
+        std::size_t size = 0;
+        for (const auto& shard : shards_) size += shard.SizeApprox();
+        return size;
+    }
+
+    /// @brief Returns a readonly value pointer by its key if exists
+    /// @throws MissingKeyException if the key is not present
+    const ConstValuePtr operator[](const Key& key) const { return GetShard(key)[key]; }
+
+    /// @brief Returns a modifiable value pointer by key if exists or
+    /// default-creates one
+    /// @note Copies the shard if the key doesn't exist.
+    const ValuePtr operator[](const Key& key) { return GetShard(key)[key]; }
+
+    /// @brief Returns a readonly value pointer by its key or an empty pointer
+    const ConstValuePtr Get(const Key& key) const { return GetShard(key).Get(key); }
+
+    /// @brief Returns a modifiable value pointer by key or an empty pointer
+    const ValuePtr Get(const Key& key) { return GetShard(key).Get(key); }
+
+    /// @see rcu::RcuMap::Insert
+    /// @note Copies the shard if the key doesn't exist.
+    InsertReturnType Insert(const Key& key, ValuePtr value) { return GetShard(key).Insert(key, std::move(value)); }
+
+    /// @see rcu::RcuMap::Emplace
+    /// @note Copies the shard if the key doesn't exist.
+    template <typename... Args>
+    InsertReturnType Emplace(const Key& key, Args&&... args) {
+        return GetShard(key).Emplace(key, std::forward<Args>(args)...);
+    }
+
+    /// @see rcu::RcuMap::TryEmplace
+    /// @note Copies the shard if the key doesn't exist.
+    template <typename... Args>
+    InsertReturnType TryEmplace(const Key& key, Args&&... args) {
+        return GetShard(key).TryEmplace(key, std::forward<Args>(args)...);
+    }
+
+    /// @see rcu::RcuMap::InsertOrAssign
+    /// @note Copies the shard.
+    template <typename RawKey>
+    void InsertOrAssign(RawKey&& key, ValuePtr value) {
+        auto& shard = GetShard(key);
+        shard.InsertOrAssign(std::forward<RawKey>(key), std::move(value));
+    }
+
+    /// @brief Inserts or replaces all the `items`, copying each of the affected
+    /// shards once
+    void BulkInsert(RawMap items) {
+        auto parts = Split(std::move(items));
+        for (std::size_t i = 0; i < shards_.size(); ++i) {
+            if (parts[i].empty()) continue;
+
+            auto txn = shards_[i].StartWrite();
+            for (auto& [key, value] : parts[i]) txn->insert_or_assign(key, std::move(value));
+            txn.Commit();
+        }
+    }
+
+    /// @brief Removes a key from the map
+    /// @returns whether the key was present
+    /// @note Copies the shard if the key is present.
+    bool Erase(const Key& key) { return GetShard(key).Erase(key); }
+
+    /// @brief Removes a key from the map returning its value
+    /// @returns a value if the key was present, empty pointer otherwise
+    /// @note Copies the shard if the key is present.
+    ValuePtr Pop(const Key& key) { return GetShard(key).Pop(key); }
+
+    /// Resets the map to an empty state
+    void Clear() {
+        for (auto& shard : shards_) shard.Clear();
+    }
+
+    /// Replace current data by data from `new_map`, each shard is replaced
+    /// without copying
+    void Assign(RawMap new_map) {
+        auto parts = Split(std::move(new_map));
+        for (std::size_t i = 0; i < shards_.size(); ++i) shards_[i].Assign(std::move(parts[i]));
+    }
+
+    /// @brief Starts a transaction for the shard of `key`, used to perform
+    /// a series of arbitrary changes to the keys of that shard.
+    /// @details The shard is copied. Don't forget to `Commit` to apply the
+    /// changes.
+    /// @warning Only the keys with the same GetShardIndex() may be changed.
+    auto StartWrite(const Key& key) { return GetShard(key).StartWrite(); }
+
+    /// @brief Returns a readonly copy of the map
+    Snapshot GetSnapshot() const {
+        Snapshot result;
+        result.reserve(SizeApprox());
+        for (const auto& shard : shards_) {
+            for (const auto& [key, value] : shard) result.emplace(key, value);
+        }
+        return result;
+    }
+
+    /// @brief Calls `func(const Key&, const ConstValuePtr&)` for all the
+    /// elements, holding a snapshot of one shard at a time
+    template <typename Func>
+    void VisitAll(Func&& func) const {
+        for (const auto& shard : shards_) {
+            for (const auto& [key, value] : shard) func(key, value);
+        }
+    }
+
+    std::size_t GetShardCount() const noexcept { return shards_.size(); }
+
+    std::size_t GetShardIndex(const Key& key) const {
+        // Twists the hash as the shards use it as well
+        auto seed = hash_(key);
+        boost::hash_combine(seed, 0);
+        return seed % shards_.size();
+    }
+
+private:
+    Shard& GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+    const Shard& GetShard(const Key& key) const { return shards_[GetShardIndex(key)]; }
+
+    utils::FixedArray<RawMap> Split(RawMap items) const {
+        utils::FixedArray<RawMap> parts(shards_.size());
+        for (auto& part : parts) part.reserve(items.size() / shards_.size() + 1);
+        while (!items.empty()) {
+            auto node = items.extract(items.begin());
+            parts[GetShardIndex(node.key())].insert(std::move(node));
+        }
+        return parts;
+    }
+
+    utils::FixedArray<Shard> shards_;
+    Hash hash_;
+};
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
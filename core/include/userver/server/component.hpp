@@ -66,6 +66,8 @@ namespace components {
 /// tls.cert | path to TLS server certificate | -
 /// tls.private-key | path to TLS server certificate private key | -
 /// tls.private-key-passphrase-name | passphrase name located in secdist's "passphrases" section | -
+/// tls.session-ticket-keys-name | name of the base64 encoded 80 byte keys list in secdist's "tls_session_ticket_keys" section, the first key encrypts new tickets, see engine::io::TlsServerSettings | -
+/// tls.kernel-tls-tx | encrypt the sent data in kernel (kTLS) if supported, allows sendfile(2) for TLS | false
 /// handler-defaults.max_url_size | max path/URL size or empty to not limit | 8192
 /// handler-defaults.max_request_size | max size of the whole request | 1024 * 1024
 /// handler-defaults.max_headers_size | max request headers size | 65536
@@ -76,6 +78,8 @@ namespace components {
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
+/// connection.pipeline_depth | max count of the pipelined HTTP/1.1 requests of a connection that are processed concurrently, the responses are still sent in order | 1
+/// connection.pipeline_max_buffered_size | the pipelined requests are not started ahead of their turn while the ready responses waiting for the preceding ones take more bytes than this value | 1024 * 1024
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
 /// connection.http-version | the HTTP protocol version | '1.1'
 /// connection.http2-session.max_concurrent_streams | max number of concurrent open streams | 100
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <variant>
@@ -41,10 +42,14 @@ struct HandlerConfig {
     bool decompress_request{true};
     bool throttling_enabled{true};
     bool response_body_stream{false};
+    bool request_body_stream{false};
+    bool run_inline{false};
     std::optional<bool> set_response_server_hostname;
     bool set_tracing_headers{true};
     bool deadline_propagation_enabled{true};
     http::HttpStatus deadline_expired_status_code{498};
+    bool deadline_early_rejection_enabled{false};
+    std::chrono::milliseconds deadline_propagation_reserve{0};
 };
 
 HandlerConfig ParseHandlerConfigsWithDefaults(
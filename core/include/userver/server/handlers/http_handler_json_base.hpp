@@ -3,6 +3,8 @@
 /// @file userver/server/handlers/http_handler_json_base.hpp
 /// @brief @copybrief server::handlers::HttpHandlerJsonBase
 
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/string_builder_fwd.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,6 +18,18 @@ namespace server::handlers {
 /// @brief Convenient base for handlers that accept requests with body in
 /// JSON format and respond with body in JSON format.
 ///
+/// Requests with `Content-Type: application/msgpack` are decoded by
+/// formats::msgpack::FromString and get the response in the same encoding,
+/// see formats::msgpack.
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds the
+/// following ones:
+///
+/// Name              | Description                                                 | Default value
+/// ----------------- | ----------------------------------------------------------- | -------------
+/// lazy-request-json | only validate the request body and provide it via GetRequestLazyJson() instead of building formats::json::Value | false
+///
 /// ## Example usage:
 ///
 /// @snippet samples/config_service/config_service.cpp Config service sample - component
@@ -38,6 +52,22 @@ public:
         request::RequestContext& context
     ) const = 0;
 
+    /// @brief Writes the response body into `sw`.
+    ///
+    /// Override it to serialize the response straight into the
+    /// formats::json::StringBuilder, e.g. via the WriteToStream functions
+    /// generated by chaotic, without building the formats::json::Value.
+    /// GetResponseJson() returns nullptr for such responses.
+    ///
+    /// The default implementation writes the result of HandleRequestJsonThrow().
+    /// MessagePack responses are always built from HandleRequestJsonThrow().
+    virtual void WriteResponseJsonThrow(
+        const http::HttpRequest& request,
+        const formats::json::Value& request_json,
+        request::RequestContext& context,
+        formats::json::StringBuilder& sw
+    ) const;
+
     static yaml_config::Schema GetStaticConfigSchema();
 
 protected:
@@ -45,6 +75,12 @@ protected:
     /// nullptr otherwise.
     static const formats::json::Value* GetRequestJson(const request::RequestContext& context);
 
+    /// @returns A pointer to the on-demand view of the json request if the
+    /// handler has `lazy-request-json: true` and the request was parsed
+    /// successfully, nullptr otherwise. The `request_json` passed to
+    /// HandleRequestJsonThrow() is null for such handlers.
+    static const formats::json::LazyValue* GetRequestLazyJson(const request::RequestContext& context);
+
     /// @returns a pointer to json response if it was returned successfully by
     /// `HandleRequestJsonThrow()` or nullptr otherwise.
     static const formats::json::Value* GetResponseJson(const request::RequestContext& context);
@@ -53,6 +89,8 @@ protected:
 
 private:
     FormattedErrorData GetFormattedExternalErrorBody(const CustomHandlerException& exc) const final;
+
+    const bool lazy_request_json_;
 };
 
 }  // namespace server::handlers
@@ -0,0 +1,124 @@
+#pragma once
+
+/// @file userver/server/handlers/http_handler_proxy.hpp
+/// @brief @copybrief server::handlers::HttpHandlerProxy
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+class Client;
+}  // namespace clients::http
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that forwards requests to an upstream and relays the
+/// responses back as is, e.g. for API gateways.
+///
+/// The URL of the upstream request is `upstream` + the request URL with
+/// the `strip-path-prefix` removed. The request body is moved into the
+/// upstream request without copying. Hop-by-hop headers (Connection,
+/// Keep-Alive, TE, Transfer-Encoding, Upgrade, etc. and the ones listed in
+/// Connection) are not forwarded in both directions, the response body is
+/// passed without decoding.
+///
+/// With `response-body-stream: true` and @ref USERVER_HANDLER_STREAM_API_ENABLED
+/// the response body is relayed chunk by chunk as it arrives from the
+/// upstream, only `response-queue-size` bytes of it are kept in memory.
+/// Otherwise the whole response is received first.
+///
+/// The upstream connections are reused by the clients::http::Client. The
+/// deadline of the incoming request is propagated to the upstream request,
+/// see @ref scripts/docs/en/userver/deadline_propagation.md "deadline propagation".
+///
+/// Upstream timeouts are reported with HTTP 504, other errors that happen
+/// before the upstream response headers are received are reported with
+/// HTTP 502.
+///
+/// \ref userver_http_handlers "Userver HTTP Handlers".
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds the
+/// following ones:
+///
+/// Name                       | Description                                              | Default value
+/// -------------------------- | -------------------------------------------------------- | -------------
+/// upstream                   | base URL of the upstream, e.g. `http://backend:8080`     | -
+/// strip-path-prefix          | prefix removed from the request path before forwarding   | ''
+/// http-client                | name of the components::HttpClient to use                | http-client
+/// timeout                    | timeout of the upstream request                          | 10s
+/// response-queue-size        | max bytes of the streamed response body kept in memory   | 65536
+/// request-headers-to-remove  | headers that are not forwarded to the upstream           | []
+/// request-headers-to-set     | headers that are added or replaced in upstream requests  | {}
+/// response-headers-to-remove | headers that are not relayed to the client               | []
+/// response-headers-to-set    | headers that are added or replaced in responses          | {}
+///
+/// ## Static config example:
+///
+/// @code
+/// handler-proxy:
+///     path: /api/*
+///     method: GET,POST,PUT,PATCH,DELETE
+///     task_processor: main-task-processor
+///     response-body-stream: true
+///     upstream: http://backend:8080
+///     strip-path-prefix: /api
+///     request-headers-to-remove:
+///       - Cookie
+///     response-headers-to-set:
+///       X-Proxied-By: gateway
+/// @endcode
+
+// clang-format on
+
+class HttpHandlerProxy final : public HttpHandlerBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of server::handlers::HttpHandlerProxy
+    static constexpr std::string_view kName = "handler-proxy";
+
+    HttpHandlerProxy(const components::ComponentConfig& config, const components::ComponentContext& context);
+
+    std::string HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    void HandleStreamRequest(http::HttpRequest& request, request::RequestContext& context, http::ResponseBodyStream&)
+        const override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    struct HeaderRules final {
+        std::vector<std::string> to_remove;
+        std::vector<std::pair<std::string, std::string>> to_set;
+    };
+
+    clients::http::Request MakeUpstreamRequest(http::HttpRequest& request) const;
+
+    void RelayResponseHeaders(
+        const clients::http::Headers& upstream_headers,
+        const clients::http::Response::CookiesMap& upstream_cookies,
+        http::HttpResponse& response
+    ) const;
+
+    clients::http::Client& http_client_;
+    const std::string upstream_;
+    const std::string strip_path_prefix_;
+    const std::chrono::milliseconds timeout_;
+    const std::size_t response_queue_size_;
+    const HeaderRules request_rules_;
+    const HeaderRules response_rules_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
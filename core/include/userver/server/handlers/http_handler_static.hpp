@@ -19,6 +19,9 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// Files that components::FsCache keeps open instead of loading them into
+/// memory (see its `keep-open-min-size` option) are sent with sendfile(2).
+///
 /// ## HttpHandlerStatic Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
@@ -28,9 +31,10 @@ namespace server::handlers {
 /// Inherits all the options from server::handlers::HttpHandlerBase and adds the
 /// following ones:
 ///
-/// Name               | Description                   | Default value
-/// ------------------ | ----------------------------- | -------------
-/// fs-cache-component | Name of the FsCache component | fs-cache-component
+/// Name                | Description                   | Default value
+/// ------------------- | ----------------------------- | -------------
+/// fs-cache-component  | Name of the FsCache component | fs-cache-component
+/// serve-precompressed | serve pre-compressed 'file.zst' and 'file.gz' variants of 'file' chosen by Accept-Encoding | false
 ///
 /// ## Example usage:
 ///
@@ -53,8 +57,12 @@ public:
     static yaml_config::Schema GetStaticConfigSchema();
 
 private:
+    fs::FileInfoWithDataConstPtr
+    TryGetPrecompressedVariant(const http::HttpRequest& request, const std::string& path) const;
+
     dynamic_config::Source config_;
     const fs::FsCacheClient& storage_;
+    const bool serve_precompressed_;
 };
 
 }  // namespace server::handlers
@@ -28,6 +28,10 @@ namespace server::handlers {
 /// * `enable` - to start memory profiling
 /// * `disable` - to stop memory profiling
 /// * `dump` - to get jemalloc profiling dump
+/// * `prof_span_filter` - to sample only the allocations of the task execution
+///   slices that start within a span named as the `span` argument, e.g.
+///   `span=http/handler-foo`; other threads and spans are not sampled
+/// * `prof_span_filter_reset` - to sample all the allocations again
 /// * `bg_threads_set_max` - to set maximum number of background threads
 /// * `bg_threads_enable` - to start background threads
 /// * `bg_threads_disable` - to *synchronously* stop background threads
@@ -41,6 +45,8 @@ public:
         kEnable,
         kDisable,
         kDump,
+        kProfSpanFilter,
+        kProfSpanFilterReset,
         kBgThreadsSetMax,
         kBgThreadsEnable,
         kBgThreadsDisable,
@@ -30,6 +30,9 @@ enum class StatsFormat;
 ///   utils::statistics::ToPrometheusFormatUntyped, utils::statistics::ToGraphiteFormat, utils::statistics::ToJsonFormat,
 ///   utils::statistics::ToSolomonFormat, utils::statistics::ToPrettyFormat.
 ///
+/// With 'gzip: true' option the Prometheus formats are compressed chunk by chunk
+/// as they are written, if the request has an appropriate 'Accept-Encoding' header.
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_server_component_list_test.cpp  Sample handler server monitor component config
@@ -69,6 +72,7 @@ private:
     using CommonLabels = std::unordered_map<std::string, std::string>;
     const CommonLabels common_labels_;
     const std::optional<impl::StatsFormat> default_format_;
+    const bool gzip_;
 };
 
 }  // namespace server::handlers
@@ -0,0 +1,54 @@
+#pragma once
+
+/// @file userver/server/handlers/task_profiler.hpp
+/// @brief @copybrief server::handlers::TaskProfiler
+
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns the stacktraces of the too long task execution
+/// slices.
+///
+/// The stacktraces are collected for the task processors with
+/// `collect-stacktraces: true` in @ref USERVER_TASK_PROCESSOR_PROFILER_DEBUG.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler task profiler component config
+///
+/// ## Scheme
+/// GET request returns the collected stacktraces in the folded format of the
+/// flame graph tools, one `outer_frame;...;inner_frame count` per line.
+/// DELETE request drops the collected stacktraces.
+
+// clang-format on
+
+class TaskProfiler final : public HttpHandlerBase {
+public:
+    TaskProfiler(const components::ComponentConfig& config, const components::ComponentContext& component_context);
+
+    /// @ingroup userver_component_names
+    /// @brief The default name of server::handlers::TaskProfiler
+    static constexpr std::string_view kName = "handler-task-profiler";
+
+    std::string HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::TaskProfiler> = true;
+
+USERVER_NAMESPACE_END
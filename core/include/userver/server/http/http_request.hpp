@@ -12,6 +12,7 @@
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/server/http/form_data_arg.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 #include <userver/utils/impl/internal_tag.hpp>
@@ -28,6 +29,10 @@ class HttpHandlerBase;
 /// Server parts of the HTTP protocol implementation.
 namespace server::http {
 
+namespace impl {
+class RequestBodyStreamProducer;
+}  // namespace impl
+
 /// @brief HTTP Request data.
 /// @note do not create HttpRequest by hand in tests,
 ///       use HttpRequestBuilder instead.
@@ -221,6 +226,16 @@ public:
     /// Equivalent to this->GetHttpResponse().SetStatus(status).
     void SetResponseStatus(HttpStatus status) const;
 
+    /// @return true if the body is delivered via GetBodyStream() rather than
+    /// RequestBody(), see the `request-body-stream` static option of a handler.
+    bool IsBodyStreamed() const;
+
+    /// @return the body of the request as a stream of chunks that arrive
+    /// while the handler is running. The stream is available only while the
+    /// request is being handled.
+    /// @throws std::logic_error if IsBodyStreamed() is false
+    RequestBodyStream& GetBodyStream() const;
+
     /// @return true if the body of the request is still compressed. In other
     /// words returns true if the static option `decompress_request` of a handler
     /// was set to `false` and this is a compressed request.
@@ -260,6 +275,8 @@ public:
     bool IsUpgradeWebsocket() const;
     void SetUpgradeWebsocket(UpgradeCallback cb) const;
     void DoUpgrade(std::unique_ptr<engine::io::RwBase>&& socket, engine::io::Sockaddr&& peer_name) const;
+
+    impl::RequestBodyStreamProducer* GetBodyStreamProducer() const;
     /// @endcond
 
 private:
@@ -279,6 +296,10 @@ private:
     void SetResponseStreamId(std::int32_t);
     void SetStreamProducer(impl::Http2StreamEventProducer&& producer);
 
+    void SetBodyStreamProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer);
+    // Lets the connection know that the handler will not read the body anymore
+    void ResetBodyStream() noexcept;
+
     void SetTaskCreateTime();
     void SetTaskStartTime();
     void SetResponseNotifyTime();
@@ -288,7 +309,7 @@ private:
     friend class HttpRequestHandler;
 
     struct Impl;
-    utils::FastPimpl<Impl, 1648, 16> pimpl_;
+    utils::FastPimpl<Impl, 2520, 16> pimpl_;
 };
 
 }  // namespace server::http
@@ -0,0 +1,58 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <memory>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace impl {
+struct RequestBodyStreamState;
+}  // namespace impl
+
+/// @brief Chunks of the request body that are read from the connection while
+/// the handler is already running.
+///
+/// Available via HttpRequest::GetBodyStream() for the handlers with the
+/// `request-body-stream` static option set to `true`. Only a limited amount of
+/// the body is buffered: the connection stops reading the socket (HTTP/1.1) or
+/// stops extending the flow-control window of the stream (HTTP/2) until the
+/// handler reads the chunks. If the handler does not read the whole body, the
+/// connection is closed after the response is sent.
+class RequestBodyStream final {
+public:
+    RequestBodyStream(RequestBodyStream&&) noexcept;
+    RequestBodyStream& operator=(RequestBodyStream&&) noexcept;
+    ~RequestBodyStream();
+
+    /// @brief Reads the next chunk of the body into `output`, waits for the
+    /// data to arrive if needed.
+    /// @returns `false` if the whole body was read, if the client has gone
+    /// or on deadline/task cancellation; use IsComplete() to tell those apart.
+    [[nodiscard]] bool ReadChunk(std::string& output, engine::Deadline deadline = {});
+
+    /// @returns whether the whole body was received and read by ReadChunk()
+    bool IsComplete() const;
+
+    /// @cond
+    using Queue = concurrent::StringStreamQueue;
+
+    RequestBodyStream(Queue::Consumer&& consumer, std::shared_ptr<impl::RequestBodyStreamState> state);
+    /// @endcond
+
+private:
+    Queue::Consumer consumer_;
+    std::shared_ptr<impl::RequestBodyStreamState> state_;
+    bool is_complete_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -47,6 +47,8 @@ public:
     /// @cond
     HttpRequestBuilder& SetIsFinal(bool is_final);
 
+    HttpRequestBuilder& ReserveHeaders(std::size_t count);
+
     HttpRequestBuilder& SetFormDataArgs(
         utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash>&& form_data_args
     );
@@ -65,6 +67,8 @@ public:
 
     HttpRequestBuilder& SetResponseStatus(HttpStatus status);
 
+    HttpRequestBuilder& SetBodyStreamProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer);
+
     const HttpRequest& GetRef() const;
 
     HttpResponse& GetHttpResponse();
@@ -4,6 +4,9 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -20,6 +23,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs::blocking {
+class FileDescriptor;
+}  // namespace fs::blocking
+
 namespace server::http {
 
 // RFC 9110 states that in case of missing Content-Type it may be assumed to be
@@ -83,6 +90,14 @@ public:
     /// @brief Add or rewrite the Content-Encoding header.
     void SetContentEncoding(std::string encoding);
 
+    /// @brief Sets the response body to `size` bytes of the `file` starting
+    /// from `offset`.
+    ///
+    /// On plaintext HTTP/1.x connections the body is sent with sendfile(2)
+    /// directly from the page cache, otherwise it is read from the file right
+    /// before sending. Ignored if a non-empty body was set via SetData().
+    void SetFileBody(std::shared_ptr<const fs::blocking::FileDescriptor> file, std::size_t offset, std::size_t size);
+
     /// @brief Set the HTTP response status code.
     /// @returns true if the status was set. Returns false if headers
     /// were already sent for stream'ed response and the new status was not set.
@@ -153,6 +168,18 @@ private:
     // Returns total size of the response
     std::size_t SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+    // Returns total size of the response
+    std::size_t SetBodyFromFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+    // Reads the whole file body into memory, for transports without sendfile
+    std::string ReadFileBody() const;
+
+    struct FileBody final {
+        std::shared_ptr<const fs::blocking::FileDescriptor> file;
+        std::size_t offset{0};
+        std::size_t size{0};
+    };
+
     const HttpRequest& request_;
     HttpStatus status_ = HttpStatus::kOk;
     HeadersMap headers_;
@@ -161,6 +188,7 @@ private:
     engine::SingleConsumerEvent headers_end_{engine::SingleConsumerEvent::NoAutoReset()};
     std::optional<Queue::Consumer> body_stream_;
     Producer body_stream_producer_;
+    std::optional<FileBody> file_body_;
     bool is_stream_body_{false};
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <userver/server/http/http_response.hpp>
@@ -13,9 +14,13 @@ class HttpHandlerBase;
 
 namespace server::http {
 
+namespace impl {
+class ResponseBodyEncoder;
+}  // namespace impl
+
 class ResponseBodyStream final {
 public:
-    ResponseBodyStream(ResponseBodyStream&&) = default;
+    ResponseBodyStream(ResponseBodyStream&&) noexcept;
     ~ResponseBodyStream();
 
     // Send a chunk of response data. It may NOT generate
@@ -37,7 +42,15 @@ private:
 
     ResponseBodyStream(HttpResponse::Producer&& queue_producer, HttpResponse& http_response);
 
+    void SetEncoder(std::unique_ptr<impl::ResponseBodyEncoder>&& encoder);
+
+    // Pushes the tail of the encoded body, if any
+    void Finish(engine::Deadline deadline);
+
+    void DoPushBodyChunk(std::string&& chunk, engine::Deadline deadline);
+
     bool headers_ended_{false};
+    std::unique_ptr<impl::ResponseBodyEncoder> encoder_;
     HttpResponse::Producer queue_producer_;
     HttpResponse& http_response_;
 };
@@ -22,6 +22,9 @@ struct Http2StreamEvent {
     std::int32_t stream_id{-1};
     std::string body_part{};
     bool is_end{false};
+    // Request body bytes read by the handler, the stream window is extended
+    // by that amount
+    std::size_t consumed_body_size{0};
 };
 
 // The order is fifo in the context of a single producer. So we are tolerant to
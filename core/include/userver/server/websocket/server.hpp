@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <optional>
+#include <string_view>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -45,9 +46,22 @@ struct Message {
 
 class WebSocketConnectionImpl;
 
+/// @brief Settings of the permessage-deflate extension (RFC 7692)
+struct DeflateConfig final {
+    bool enabled = false;
+    bool server_no_context_takeover = false;
+    bool client_no_context_takeover = false;
+    int server_max_window_bits = 15;  // 9..15
+    int compression_level = 6;        // 0..9
+    unsigned min_message_size = 128;  // smaller messages are not compressed
+};
+
+DeflateConfig Parse(const yaml_config::YamlConfig&, formats::parse::To<DeflateConfig>);
+
 struct Config final {
     unsigned max_remote_payload = 65536;
     unsigned fragment_size = 65536;  // 0 - do not fragment
+    DeflateConfig deflate{};
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
@@ -59,6 +73,31 @@ struct Statistics final {
     std::atomic<int64_t> bytes_recv{0};
 };
 
+/// @brief A data message that is serialized into WebSocket frames once and
+/// could be sent to any number of connections without copying, e.g. for
+/// broadcasting.
+///
+/// If the permessage-deflate extension is enabled, the message is also
+/// compressed once. The compressed frames are used for connections without
+/// server context takeover, other connections get the uncompressed frames.
+///
+/// The message is immutable and could be shared between threads.
+class PreparedMessage final {
+public:
+    /// @param config should match the config of the connections the message
+    /// is sent to
+    PreparedMessage(std::string_view data, bool is_text, const Config& config);
+
+    /// @brief Payload size of the message
+    std::size_t GetPayloadSize() const noexcept;
+
+private:
+    friend class WebSocketConnectionImpl;
+
+    struct Frames;
+    std::shared_ptr<const Frames> frames_;
+};
+
 /// @brief Main class for Websocket connection
 class WebSocketConnection {
 public:
@@ -90,10 +129,10 @@ public:
     /// @brief Send a message to websocket.
     /// @param message message to send
     /// @throws engine::io::IoException in case of socket errors
-    /// @note Send() is not thread-safe by itself (you may not call Send() from
-    /// multiple coroutines at once), but it is safe to call Recv() and Send()
-    /// from different coroutines at once thus implementing full-duplex socket
-    /// connection.
+    /// @note It is safe to call Recv() and Send() from different coroutines at
+    /// once thus implementing full-duplex socket connection. Send() could also
+    /// be called from multiple coroutines at once: the messages queued while
+    /// the socket is busy are written together with a single socket write.
     virtual void Send(const Message& message) = 0;
     virtual void SendText(std::string_view message) = 0;
 
@@ -108,6 +147,12 @@ public:
         ));
     }
 
+    /// @brief Send a message prepared for broadcasting, does not serialize or
+    /// copy the message.
+    /// @throws engine::io::IoException in case of socket errors
+    /// @note Same thread-safety guarantees as for Send().
+    virtual void SendPrepared(const PreparedMessage& message) = 0;
+
     virtual void Close(CloseStatus status_code) = 0;
 
     virtual const engine::io::Sockaddr& RemoteAddr() const = 0;
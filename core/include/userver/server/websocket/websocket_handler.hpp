@@ -28,6 +28,12 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate.enabled | accept the permessage-deflate (RFC 7692) offers of clients | false
+/// permessage-deflate.server-no-context-takeover | reset the compression context after each message, lets connections use the compressed websocket::PreparedMessage frames | false
+/// permessage-deflate.client-no-context-takeover | ask clients to reset their compression context after each message | false
+/// permessage-deflate.server-max-window-bits | max compression window size (log2), 9..15 | 15
+/// permessage-deflate.compression-level | zlib compression level, 0..9 | 6
+/// permessage-deflate.min-message-size | messages smaller than this are sent uncompressed | 128
 ///
 /// ## Example usage:
 ///
@@ -49,6 +55,11 @@ public:
         return true;
     }
 
+    /// @brief Serializes (and compresses if permessage-deflate is enabled) the
+    /// message once for sending it to many connections of this handler via
+    /// WebSocketConnection::SendPrepared().
+    PreparedMessage PrepareMessage(std::string_view data, bool is_text) const;
+
     /// @cond
     void WriteMetrics(utils::statistics::Writer& writer) const;
 
@@ -198,6 +198,9 @@ public:
     const std::string& GetSpanId() const;
     const std::string& GetParentId() const;
 
+    /// Name of the span that was passed to the constructor
+    const std::string& GetName() const;
+
     /// @returns true if this span would be logged with the current local and
     /// global log levels to the default logger.
     bool ShouldLogDefault() const noexcept;
@@ -17,6 +17,11 @@ std::string ToLimitedHex(std::string_view data, size_t limit);
 /// otherwise returns stub
 std::string ToLimitedUtf8(std::string_view data, size_t limit);
 
+/// @brief same as ToLimitedUtf8(data, limit) for a `total_size` bytes long
+/// `data` of which only the first `prefix` is known, `prefix` should hold at
+/// least `limit` bytes if there are as many
+std::string ToLimitedUtf8(std::string_view prefix, size_t limit, size_t total_size);
+
 }  // namespace utils::log
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,192 @@
+#pragma once
+
+/// @file userver/utils/statistics/hdr_percentile.hpp
+/// @brief @copybrief utils::statistics::HdrPercentile
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/** @brief Percentiles with a bounded relative error and a small memory
+ * footprint, a drop-in replacement for utils::statistics::Percentile.
+ *
+ * Values in `[0, 2^PrecisionBits)` are counted precisely. Each of the bigger
+ * power-of-two ranges `[2^k, 2^(k+1))` is split into `2^(PrecisionBits-1)`
+ * equal buckets, like in the HDR histogram. So the reported percentile differs
+ * from the real one by no more than `2^-PrecisionBits` of its value, while the
+ * number of buckets grows logarithmically with `MaxValue`:
+ *
+ * | MaxValue   | PrecisionBits | max error | buckets |
+ * | ---------- | ------------- | --------- | ------- |
+ * | 2^16 - 1   | 5             | 3.1%      | 208     |
+ * | 2^16 - 1   | 7             | 0.8%      | 704     |
+ * | 2^20 - 1   | 5             | 3.1%      | 272     |
+ * | 2^32 - 1   | 5             | 3.1%      | 464     |
+ *
+ * Compare with `Percentile<2048, unsigned, 120>` that stores 2168 buckets and
+ * has no precision at all above ~62000.
+ *
+ * Values above `MaxValue` are accounted as `MaxValue`.
+ *
+ * The sketches are mergeable with `Add`, so the type works as both `Counter`
+ * and `Result` of utils::statistics::RecentPeriod:
+ *
+ * @code
+ * using Percentile = utils::statistics::HdrPercentile<60'000>;
+ * using Timings = utils::statistics::RecentPeriod<Percentile, Percentile>;
+ * @endcode
+ *
+ * Type is safe to read/write concurrently from different threads/coroutines.
+ *
+ * @tparam MaxValue the biggest value to distinguish
+ * @tparam PrecisionBits precision of the values, see above
+ * @tparam Counter type of all the buckets
+ */
+template <std::size_t MaxValue, std::size_t PrecisionBits = 5, typename Counter = std::uint32_t>
+class HdrPercentile final {
+    static_assert(MaxValue > 0, "MaxValue must be positive");
+    static_assert(
+        PrecisionBits >= 1 && PrecisionBits < sizeof(std::size_t) * 8,
+        "PrecisionBits must be in [1, bit size of std::size_t)"
+    );
+
+public:
+    HdrPercentile() noexcept { Reset(); }
+
+    HdrPercentile(const HdrPercentile& other) noexcept { *this = other; }
+
+    HdrPercentile& operator=(const HdrPercentile& rhs) noexcept {
+        if (this == &rhs) return *this;
+
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < values_.size(); i++) {
+            const auto value = rhs.values_[i].load(std::memory_order_relaxed);
+            values_[i].store(value, std::memory_order_relaxed);
+            sum += value;
+        }
+
+        count_ = sum;
+        return *this;
+    }
+
+    /// @brief Account for another value.
+    void Account(std::size_t value) noexcept {
+        values_[BucketIndex(std::min(value, MaxValue))].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_release);
+    }
+
+    /// @brief Get X percentile - min value P so that total number
+    /// of accounted values that are not greater than P is no less than X percent.
+    ///
+    /// @param percent - value in [0..100] - requested percentile.
+    /// If outside of 100, then returns the biggest accounted value.
+    std::size_t GetPercentile(double percent) const {
+        if (count_ == 0) return 0;
+
+        std::size_t sum = 0;
+        std::size_t want_sum = count_.load(std::memory_order_acquire) * percent;
+        std::size_t max_value = 0;
+        for (std::size_t i = 0; i < values_.size(); i++) {
+            const auto value = values_[i].load(std::memory_order_relaxed);
+            sum += value;
+            if (sum * 100 > want_sum) return BucketToValue(i);
+
+            if (value) max_value = BucketToValue(i);
+        }
+
+        return max_value;
+    }
+
+    template <class Duration = std::chrono::seconds>
+    void Add(
+        const HdrPercentile& other,
+        [[maybe_unused]] Duration this_epoch_duration = Duration(),
+        [[maybe_unused]] Duration before_this_epoch_duration = Duration()
+    ) {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < values_.size(); i++) {
+            const auto value = other.values_[i].load(std::memory_order_relaxed);
+            sum += value;
+            values_[i].fetch_add(value, std::memory_order_relaxed);
+        }
+        count_.fetch_add(sum, std::memory_order_release);
+    }
+
+    /// @brief Zero out all the buckets and total number of elements.
+    void Reset() noexcept {
+        for (auto& value : values_) value.store(0, std::memory_order_relaxed);
+        count_ = 0;
+    }
+
+    /// @brief Total number of elements
+    Counter Count() const noexcept { return count_; }
+
+    /// @brief Number of the buckets stored
+    static constexpr std::size_t BucketsCount() noexcept { return kBucketsCount; }
+
+private:
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << PrecisionBits;
+    static constexpr std::size_t kHalfSubBuckets = kSubBuckets / 2;
+
+    static constexpr std::size_t BitWidth(std::size_t value) noexcept {
+        std::size_t result = 0;
+        for (; value; value >>= 1) ++result;
+        return result;
+    }
+
+    static constexpr std::size_t BucketIndex(std::size_t value) noexcept {
+        if (value < kSubBuckets) return value;
+
+        const auto shift = BitWidth(value) - PrecisionBits;
+        return kSubBuckets + (shift - 1) * kHalfSubBuckets + ((value >> shift) - kHalfSubBuckets);
+    }
+
+    // Middle of the bucket, so that the error is symmetric
+    static constexpr std::size_t BucketToValue(std::size_t index) noexcept {
+        if (index < kSubBuckets) return index;
+
+        const auto offset = index - kSubBuckets;
+        const auto shift = offset / kHalfSubBuckets + 1;
+        const auto lower_bound = (kHalfSubBuckets + offset % kHalfSubBuckets) << shift;
+        return std::min(lower_bound + ((std::size_t{1} << shift) - 1) / 2, MaxValue);
+    }
+
+    static constexpr std::size_t kBucketsCount = BucketIndex(MaxValue) + 1;
+
+    static_assert(
+        std::atomic<Counter>::is_always_lock_free,
+        "`std::atomic<Counter>` is not lock-free. Please choose some "
+        "other `Counter` type"
+    );
+
+    std::array<std::atomic<Counter>, kBucketsCount> values_;
+    std::atomic<Counter> count_;
+};
+
+template <std::size_t MaxValue, std::size_t PrecisionBits, typename Counter>
+void DumpMetric(
+    Writer& writer,
+    const HdrPercentile<MaxValue, PrecisionBits, Counter>& perc,
+    std::initializer_list<double> percents = {0, 50, 90, 95, 98, 99, 99.6, 99.9, 100}
+) {
+    for (double percent : percents) {
+        writer.ValueWithLabels(
+            perc.GetPercentile(percent), {"percentile", statistics::GetPercentileFieldName(percent)}
+        );
+    }
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -60,6 +60,9 @@ struct BoundsBlock;
 ///
 /// Histogram can be used in utils::statistics::MetricTag:
 /// @snippet utils/statistics/histogram_test.cpp  metric tag
+///
+/// @see utils::statistics::StripedHistogram for histograms that are written
+/// concurrently by many threads
 class Histogram final {
 public:
     /// Sets upper bounds for each non-"infinite" bucket. The lowest bound is
@@ -90,8 +93,13 @@ public:
     /// @endcond
 
 private:
+    friend class StripedHistogram;
+
     void UpdateBounds();
 
+    // Returns the index in `buckets_`, 0 for the "infinity" bucket.
+    std::size_t GetBucketIndex(double value) const noexcept;
+
     std::unique_ptr<impl::histogram::Bucket[]> buckets_;
     // B+ tree of bucket bounds for optimization of Account.
     std::unique_ptr<impl::histogram::BoundsBlock[]> bounds_;
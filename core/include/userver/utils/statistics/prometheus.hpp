@@ -4,7 +4,9 @@
 /// @brief Statistics output in Prometheus format.
 
 #include <string>
+#include <string_view>
 
+#include <userver/utils/function_ref.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +36,25 @@ ToPrometheusFormat(const utils::statistics::Storage& statistics, const utils::st
 std::string
 ToPrometheusFormatUntyped(const utils::statistics::Storage& statistics, const utils::statistics::Request& request = {});
 
+/// @brief Output `statistics` in Prometheus format by chunks of a few dozen
+/// kilobytes, without materializing the whole output.
+///
+/// The chunk passed to `consumer` is only valid during the call, its buffer is
+/// reused for the next chunk. Useful for compressing big outputs on the fly.
+void ToPrometheusFormat(
+    const utils::statistics::Storage& statistics,
+    const utils::statistics::Request& request,
+    utils::function_ref<void(std::string_view)> consumer
+);
+
+/// @brief Output `statistics` in Prometheus format without metric types by
+/// chunks, see the ToPrometheusFormat overload with `consumer`.
+void ToPrometheusFormatUntyped(
+    const utils::statistics::Storage& statistics,
+    const utils::statistics::Request& request,
+    utils::function_ref<void(std::string_view)> consumer
+);
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/utils/statistics/striped_histogram.hpp
+/// @brief @copybrief utils::statistics::StripedHistogram
+
+#include <cstdint>
+
+#include <userver/concurrent/striped_counter.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief A histogram with split per-CPU buckets, with memory consumption and
+/// read performance traded for write performance.
+///
+/// This class is represented as a histogram metric when serializing to
+/// statistics, see utils::statistics::Histogram for the semantics.
+///
+/// Differences from utils::statistics::Histogram:
+///
+/// 1. StripedHistogram takes `8 * N_CORES` memory per bucket, while Histogram
+///    takes 16 bytes per bucket.
+/// 2. Each bucket of StripedHistogram is a concurrent::StripedCounter, so
+///    Account() does not bounce cache lines between the threads, even if all
+///    of them hit the same bucket.
+/// 3. The buckets are summed up lazily by Aggregate() at scrape time, which is
+///    approx. `N_CORES` times slower than Histogram::GetView().
+///
+/// Use StripedHistogram instead of Histogram sparingly, in places where a lot
+/// of threads are supposed to be hammering on the same metrics.
+class StripedHistogram final {
+public:
+    /// Sets upper bounds for each non-"infinite" bucket. The lowest bound is
+    /// always 0.
+    explicit StripedHistogram(utils::span<const double> upper_bounds);
+
+    StripedHistogram(StripedHistogram&&) noexcept;
+    StripedHistogram& operator=(StripedHistogram&&) noexcept;
+    ~StripedHistogram();
+
+    /// Increment the bucket corresponding to the given value, the addition is
+    /// done with a relaxed memory order.
+    void Account(double value, std::uint64_t count = 1) noexcept;
+
+    /// Sums up the per-CPU counters of each bucket.
+    HistogramAggregator Aggregate() const;
+
+    /// Reset all counters to zero. Concurrent Account() calls may or may not be
+    /// reset.
+    friend void ResetMetric(StripedHistogram& histogram) noexcept;
+
+private:
+    // Only the bounds and the bucket lookup of `bounds_` are used, its counters
+    // always stay zero.
+    Histogram bounds_;
+    // 0th counter is the "infinity" bucket.
+    utils::FixedArray<USERVER_NAMESPACE::concurrent::StripedCounter> counters_;
+};
+
+/// Metric serialization support for StripedHistogram.
+void DumpMetric(Writer& writer, const StripedHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
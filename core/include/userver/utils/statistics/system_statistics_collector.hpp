@@ -29,6 +29,13 @@ namespace components {
 /// Note that `with-nginx` is a relatively expensive option as it requires full
 /// process list scan.
 ///
+/// In a container the CPU quota and the CFS throttling of the cgroup are
+/// reported as `cgroup.cpu_limit`, `cgroup.cpu_periods`,
+/// `cgroup.cpu_throttled_periods` and `cgroup.cpu_throttled_sec`. A growing
+/// `cgroup.cpu_throttled_sec` means that the service has more busy threads
+/// than the quota allows, see `worker_threads: auto` of
+/// components::ManagerControllerComponent.
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_component_list_test.cpp  Sample system statistics component config
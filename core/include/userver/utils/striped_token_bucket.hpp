@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/utils/striped_token_bucket.hpp
+/// @brief @copybrief utils::StripedTokenBucket
+
+#include <atomic>
+#include <cstdint>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/token_bucket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Thread safe ratelimiter with the same semantics as
+/// utils::TokenBucket, intended for buckets that are hammered by many threads.
+///
+/// The tokens are taken from the shared utils::TokenBucket in batches and are
+/// cached in per-CPU slices, so most of the Obtain() calls only touch the cache
+/// line of the current CPU. If both the slice of the current CPU and the
+/// shared bucket are empty, the tokens cached by other CPUs are taken, so the
+/// tokens never get stuck on an idle CPU.
+///
+/// At most 1/8 of `max_size` is cached in the slices. The cached tokens are not
+/// accounted by the shared bucket, so the bucket may hold up to that many more
+/// tokens than `max_size` after a long idle period.
+///
+/// @note Per-CPU slices require rseq (x86_64 Linux). Otherwise all the calls
+/// go to the shared bucket directly.
+class StripedTokenBucket final {
+public:
+    using Duration = TokenBucket::Duration;
+    using RefillPolicy = TokenBucket::RefillPolicy;
+
+    /// Create an initially always empty token bucket
+    StripedTokenBucket();
+
+    /// Create a token bucket with max_size tokens and a specified refill policy
+    StripedTokenBucket(std::size_t max_size, RefillPolicy policy);
+
+    /// Create an initially unbounded token bucket (largest size, instant refill)
+    static StripedTokenBucket MakeUnbounded();
+
+    StripedTokenBucket(const StripedTokenBucket&) = delete;
+    StripedTokenBucket(StripedTokenBucket&&) = delete;
+    StripedTokenBucket& operator=(const StripedTokenBucket&) = delete;
+    StripedTokenBucket& operator=(StripedTokenBucket&&) = delete;
+
+    ~StripedTokenBucket();
+
+    bool IsUnbounded() const;
+
+    /// Get current token limit (might be inaccurate as the result is stale)
+    std::size_t GetMaxSizeApprox() const;
+
+    /// Get rate (tokens per second)
+    double GetRatePs() const;
+
+    /// Get current token count including the tokens cached in the slices
+    /// (might be inaccurate as the result is stale)
+    std::size_t GetTokensApprox();
+
+    /// Set max token count, drops the cached tokens
+    void SetMaxSize(std::size_t max_size);
+
+    /// Set refill policy for the bucket, drops the cached tokens
+    void SetRefillPolicy(RefillPolicy policy);
+
+    /// @returns true if token was successfully obtained
+    [[nodiscard]] bool Obtain();
+
+private:
+    using Slice = concurrent::impl::InterferenceShield<std::atomic<std::int64_t>>;
+
+    bool ObtainSlow(std::size_t slice_index);
+    void ResetSlices() noexcept;
+
+    TokenBucket shared_;
+    std::atomic<std::size_t> batch_size_{1};
+    FixedArray<Slice> slices_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
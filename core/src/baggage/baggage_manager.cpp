@@ -1,5 +1,6 @@
 #include <userver/baggage/baggage_manager.hpp>
 #include <userver/baggage/baggage_settings.hpp>
+#include <userver/baggage/lazy_baggage.hpp>
 
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
@@ -61,7 +62,7 @@ void BaggageManager::AddEntry(std::string key, std::string value, BaggagePropert
     kInheritedBaggage.Set(std::move(baggage));
 }
 
-const Baggage* BaggageManager::TryGetBaggage() { return kInheritedBaggage.GetOptional(); }
+const Baggage* BaggageManager::TryGetBaggage() { return TryGetInheritedBaggage(); }
 
 void BaggageManager::SetBaggage(std::string header) const {
     if (!IsEnabled()) {
@@ -76,7 +77,10 @@ void BaggageManager::SetBaggage(std::string header) const {
     }
 }
 
-void BaggageManager::ResetBaggage() { kInheritedBaggage.Erase(); }
+void BaggageManager::ResetBaggage() {
+    kInheritedBaggage.Erase();
+    impl::kLazyInheritedBaggage.Erase();
+}
 
 }  // namespace baggage
 
@@ -4,6 +4,8 @@
 #include <userver/formats/json.hpp>
 
 #include <userver/baggage/baggage_manager.hpp>
+#include <userver/baggage/lazy_baggage.hpp>
+#include <userver/engine/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -93,4 +95,23 @@ UTEST_F(BaggageManagerTest, ResetBaggage) {
     ASSERT_EQ(baggage, nullptr);
 }
 
+UTEST_F(BaggageManagerTest, LazyBaggage) {
+    auto header = std::make_shared<const std::string>("key1=value1,unknown=value");
+    baggage::impl::kLazyInheritedBaggage.Emplace(header, *header, source_.GetSnapshot());
+
+    const auto* baggage = baggage::BaggageManager::TryGetBaggage();
+    ASSERT_NE(baggage, nullptr);
+    EXPECT_EQ(baggage->ToString(), "key1=value1");
+
+    // Parsed once for the whole task hierarchy
+    engine::AsyncNoSpan([baggage] { EXPECT_EQ(baggage::BaggageManager::TryGetBaggage(), baggage); }).Get();
+
+    // The explicitly set baggage takes precedence
+    baggage_manager_.AddEntry("key2", "value2", {});
+    EXPECT_EQ(baggage::BaggageManager::TryGetBaggage()->ToString(), "key1=value1,key2=value2");
+
+    baggage::BaggageManager::ResetBaggage();
+    EXPECT_EQ(baggage::BaggageManager::TryGetBaggage(), nullptr);
+}
+
 USERVER_NAMESPACE_END
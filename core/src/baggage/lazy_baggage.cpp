@@ -0,0 +1,53 @@
+#include <userver/baggage/lazy_baggage.hpp>
+
+#include <optional>
+#include <string>
+
+#include <userver/baggage/baggage_settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace baggage {
+
+const Baggage* TryGetInheritedBaggage() {
+    const auto* baggage = kInheritedBaggage.GetOptional();
+    if (baggage != nullptr) {
+        return baggage;
+    }
+    const auto* lazy_baggage = impl::kLazyInheritedBaggage.GetOptional();
+    if (lazy_baggage == nullptr) {
+        return nullptr;
+    }
+    return lazy_baggage->Get();
+}
+
+namespace impl {
+
+struct LazyBaggage::Parsed final {
+    std::optional<Baggage> baggage;
+};
+
+LazyBaggage::LazyBaggage(std::shared_ptr<const void> owner, std::string_view header, dynamic_config::Snapshot config)
+    : owner_(std::move(owner)), header_(header), config_(std::move(config)) {}
+
+LazyBaggage::~LazyBaggage() { delete parsed_.load(); }
+
+const Baggage* LazyBaggage::Get() const {
+    const auto* parsed = parsed_.load();
+    if (parsed == nullptr) {
+        auto new_parsed = std::make_unique<Parsed>(
+            Parsed{TryMakeBaggage(std::string{header_}, config_[kBaggageSettings].allowed_keys)}
+        );
+        // Concurrent parsers race, the first one wins
+        if (parsed_.compare_exchange_strong(parsed, new_parsed.get())) {
+            parsed = new_parsed.release();
+        }
+    }
+    return parsed->baggage ? &*parsed->baggage : nullptr;
+}
+
+}  // namespace impl
+
+}  // namespace baggage
+
+USERVER_NAMESPACE_END
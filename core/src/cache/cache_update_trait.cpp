@@ -55,6 +55,12 @@ void CacheUpdateTrait::GetAndWrite(dump::Writer&) const { dump::ThrowDumpUnimple
 
 void CacheUpdateTrait::ReadAndSet(dump::Reader&) { dump::ThrowDumpUnimplemented(Name()); }
 
+bool CacheUpdateTrait::GetAndWriteDelta(dump::Writer&) const { return false; }
+
+void CacheUpdateTrait::ReadAndSetWithDeltas(dump::Reader&, const std::vector<std::unique_ptr<dump::Reader>>&) {
+    dump::ThrowDumpUnimplemented(Name());
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
@@ -469,6 +469,17 @@ void CacheUpdateTrait::Impl::DumpableEntityProxy::GetAndWrite(dump::Writer& writ
 
 void CacheUpdateTrait::Impl::DumpableEntityProxy::ReadAndSet(dump::Reader& reader) { cache_.ReadAndSet(reader); }
 
+bool CacheUpdateTrait::Impl::DumpableEntityProxy::GetAndWriteDelta(dump::Writer& writer) const {
+    return cache_.GetAndWriteDelta(writer);
+}
+
+void CacheUpdateTrait::Impl::DumpableEntityProxy::ReadAndSetWithDeltas(
+    dump::Reader& reader,
+    const std::vector<std::unique_ptr<dump::Reader>>& deltas
+) {
+    cache_.ReadAndSetWithDeltas(reader, deltas);
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
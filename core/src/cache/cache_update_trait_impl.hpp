@@ -75,6 +75,11 @@ private:
 
         void ReadAndSet(dump::Reader& reader) override;
 
+        bool GetAndWriteDelta(dump::Writer& writer) const override;
+
+        void ReadAndSetWithDeltas(dump::Reader& reader, const std::vector<std::unique_ptr<dump::Reader>>& deltas)
+            override;
+
     private:
         CacheUpdateTrait& cache_;
     };
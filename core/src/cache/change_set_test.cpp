@@ -0,0 +1,82 @@
+#include <userver/cache/change_set.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <userver/cache/caching_component_base.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = std::unordered_map<int, std::string>;
+
+/// [Sample change set subscriber]
+using NamesCache = components::CachingComponentBase<std::unordered_map<int, std::string>>;
+
+// Keeps the lengths of the names from NamesCache
+class NameLengths final {
+public:
+    explicit NameLengths(NamesCache& names)
+        : subscription_(names.UpdateAndListenChanges(this, "name-lengths", &NameLengths::OnNamesUpdate)) {}
+
+    ~NameLengths() { subscription_.Unsubscribe(); }
+
+private:
+    void OnNamesUpdate(const std::shared_ptr<const NamesCache::DataType>& names, const NamesCache::ChangeSetType* changes) {
+        auto lengths = lengths_.Lock();
+        if (!changes) {
+            // The changes are unknown, recompute everything
+            lengths->clear();
+            for (const auto& [id, name] : *names) lengths->emplace(id, name.size());
+            return;
+        }
+
+        for (const auto& id : changes->removed) lengths->erase(id);
+        for (const auto& id : changes->updated) (*lengths)[id] = names->at(id).size();
+    }
+
+    concurrent::Variable<std::unordered_map<int, std::size_t>> lengths_;
+    concurrent::AsyncEventSubscriberScope subscription_;
+};
+/// [Sample change set subscriber]
+
+template <typename Key>
+void Sort(cache::ChangeSet<Key>& changes) {
+    std::sort(changes.updated.begin(), changes.updated.end());
+    std::sort(changes.removed.begin(), changes.removed.end());
+}
+
+}  // namespace
+
+TEST(CacheChangeSet, MakeChangeSet) {
+    const Map old_map{{1, "one"}, {2, "two"}, {3, "three"}};
+    const Map new_map{{1, "one"}, {2, "TWO"}, {4, "four"}};
+
+    auto changes = cache::MakeChangeSet(old_map, new_map);
+    Sort(changes);
+    EXPECT_EQ(changes.updated, (std::vector<int>{2, 4}));
+    EXPECT_EQ(changes.removed, (std::vector<int>{3}));
+    EXPECT_FALSE(changes.empty());
+}
+
+TEST(CacheChangeSet, NoChanges) {
+    const std::map<std::string, int> map{{"a", 1}, {"b", 2}};
+    const auto changes = cache::MakeChangeSet(map, map);
+    EXPECT_TRUE(changes.empty());
+
+    const auto from_empty = cache::MakeChangeSet({}, map);
+    EXPECT_EQ(from_empty.updated, (std::vector<std::string>{"a", "b"}));
+    EXPECT_TRUE(from_empty.removed.empty());
+}
+
+static_assert(std::is_same_v<NamesCache::ChangeSetType, cache::ChangeSet<int>>);
+static_assert(std::is_same_v<
+              components::CachingComponentBase<std::vector<int>>::ChangeSetType::KeyType,
+              components::impl::NoChangeSetKey>);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,152 @@
+#include <userver/cache/columnar_table.hpp>
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Order {
+    int id{0};
+    std::string city;
+    double price{0};
+    int quantity{0};
+};
+
+bool operator==(const Order& lhs, const Order& rhs) {
+    return lhs.id == rhs.id && lhs.city == rhs.city && lhs.price == rhs.price && lhs.quantity == rhs.quantity;
+}
+
+using Orders = cache::ColumnarTable<Order>;
+
+Orders MakeOrders(int count) {
+    Orders orders;
+    for (int i = 0; i < count; ++i) {
+        orders.insert_or_assign(i, Order{i, i % 2 ? "moscow" : "london", i * 1.5, i % 10});
+    }
+    return orders;
+}
+
+}  // namespace
+
+TEST(ColumnarTable, InsertGet) {
+    Orders orders;
+    EXPECT_TRUE(orders.empty());
+    EXPECT_TRUE(orders.insert_or_assign(1, Order{1, "moscow", 10, 1}));
+    EXPECT_TRUE(orders.insert_or_assign(2, Order{2, "london", 20, 2}));
+    EXPECT_FALSE(orders.insert_or_assign(1, Order{1, "paris", 30, 3}));
+    EXPECT_EQ(orders.size(), 2);
+
+    EXPECT_TRUE(orders.contains(1));
+    EXPECT_FALSE(orders.contains(3));
+    EXPECT_EQ(orders.Get(1), (Order{1, "paris", 30, 3}));
+    EXPECT_EQ(orders.Get(3), std::nullopt);
+
+    const auto row = orders.FindRow(2);
+    ASSERT_TRUE(row);
+    EXPECT_EQ(orders.GetField<1>(*row), "london");
+    EXPECT_EQ(orders.GetColumn<0>().size(), 2);
+
+    orders.clear();
+    EXPECT_TRUE(orders.empty());
+    EXPECT_FALSE(orders.contains(1));
+}
+
+TEST(ColumnarTable, Erase) {
+    auto orders = MakeOrders(10);
+    EXPECT_EQ(orders.erase(3), 1);
+    EXPECT_EQ(orders.erase(3), 0);
+    EXPECT_EQ(orders.erase(9), 1);
+    EXPECT_EQ(orders.size(), 8);
+
+    for (int i = 0; i < 10; ++i) {
+        if (i == 3 || i == 9) {
+            EXPECT_FALSE(orders.Get(i)) << i;
+        } else {
+            EXPECT_EQ(orders.Get(i), (Order{i, i % 2 ? "moscow" : "london", i * 1.5, i % 10})) << i;
+        }
+    }
+
+    std::size_t visited = 0;
+    orders.VisitAll([&](const Order& order) {
+        EXPECT_EQ(orders.Get(order.id), order);
+        ++visited;
+    });
+    EXPECT_EQ(visited, 8);
+}
+
+TEST(ColumnarTable, FilterAndSum) {
+    /// [Sample columnar table]
+    struct Order {
+        int id;
+        std::string city;
+        double price;
+        int quantity;
+    };
+    cache::ColumnarTable<Order> orders;
+    orders.insert_or_assign(1, Order{1, "moscow", 100, 2});
+    orders.insert_or_assign(2, Order{2, "london", 200, 5});
+    orders.insert_or_assign(3, Order{3, "moscow", 300, 7});
+
+    // SELECT sum(price) FROM orders WHERE city = 'moscow' AND quantity > 5
+    auto selection = orders.Filter<1>([](const std::string& city) { return city == "moscow"; });
+    orders.Refine<3>(selection, [](int quantity) { return quantity > 5; });
+
+    EXPECT_EQ(selection.Count(), 1);
+    EXPECT_EQ(orders.Sum<2>(selection), 300);
+    /// [Sample columnar table]
+}
+
+TEST(ColumnarTable, Selection) {
+    const auto orders = MakeOrders(1000);
+
+    auto cheap = orders.Filter<2>([](double price) { return price < 150; });
+    EXPECT_EQ(cheap.Count(), 100);
+    EXPECT_EQ(orders.Sum<0>(cheap), 99 * 100 / 2);
+
+    const auto even = orders.Filter<0>([](int id) { return id % 2 == 0; });
+    auto cheap_or_even = cheap;
+    cheap_or_even |= even;
+    EXPECT_EQ(cheap_or_even.Count(), 550);
+
+    cheap &= even;
+    EXPECT_EQ(cheap.Count(), 50);
+    std::size_t rows = 0;
+    cheap.ForEach([&](std::size_t row) {
+        EXPECT_EQ(orders.GetField<0>(row) % 2, 0);
+        ++rows;
+    });
+    EXPECT_EQ(rows, 50);
+
+    const cache::RowSelection all{orders.size()};
+    EXPECT_EQ((orders.Sum<3, long>(all)), 4500);
+}
+
+TEST(ColumnarTable, SumSkipsUnselectedNan) {
+    Orders orders;
+    orders.insert_or_assign(1, Order{1, "", 1.0, 0});
+    orders.insert_or_assign(2, Order{2, "", std::numeric_limits<double>::quiet_NaN(), 0});
+
+    const auto selection = orders.Filter<2>([](double price) { return !std::isnan(price); });
+    EXPECT_EQ(orders.Sum<2>(selection), 1.0);
+}
+
+TEST(ColumnarTable, Equality) {
+    auto lhs = MakeOrders(10);
+    auto rhs = MakeOrders(10);
+    EXPECT_TRUE(lhs == rhs);
+
+    // Same rows in a different order
+    rhs.erase(0);
+    rhs.insert_or_assign(0, Order{0, "london", 0, 0});
+    EXPECT_TRUE(lhs == rhs);
+
+    rhs.insert_or_assign(0, Order{0, "london", 1, 0});
+    EXPECT_FALSE(lhs == rhs);
+}
+
+USERVER_NAMESPACE_END
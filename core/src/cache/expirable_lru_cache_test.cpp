@@ -1,10 +1,14 @@
+#include <atomic>
 #include <string>
+#include <vector>
 
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/dump/operations_mock.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/mock_now.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -324,6 +328,53 @@ UTEST(ExpirableLruCache, BackgroundUpdate) {
     EXPECT_EQ(2, cache.Get(key, UpdateNever()));
 }
 
+UTEST(ExpirableLruCache, RefreshAhead) {
+    auto counter = std::make_shared<Counter>();
+
+    auto cache = CreateSimpleCache();
+    cache.SetMaxLifetime(std::chrono::seconds(10));
+    cache.SetBackgroundUpdate(cache::BackgroundUpdateMode::kEnabled);
+    cache.SetRefreshAhead(0.2);
+    SimpleCacheKey key = "my-key";
+
+    utils::datetime::MockNowSet(std::chrono::system_clock::now());
+    cache.Put(key, 1);
+
+    counter->Flush();
+    utils::datetime::MockSleep(std::chrono::seconds(7));
+    EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+    EngineYield();
+    EXPECT_EQ(Counter::Zero(), *counter);
+
+    utils::datetime::MockSleep(std::chrono::seconds(2));
+    EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+    EngineYield();
+    EXPECT_EQ(Counter::One(), *counter);
+    EXPECT_EQ(2, cache.Get(key, UpdateNever()));
+}
+
+UTEST(ExpirableLruCache, MaxBackgroundUpdates) {
+    auto cache = CreateSimpleCache();
+    cache.SetMaxBackgroundUpdates(1);
+
+    engine::SingleConsumerEvent update_started;
+    engine::SingleConsumerEvent finish_update;
+    cache.UpdateInBackground("first", [&](const SimpleCacheKey&) {
+        update_started.Send();
+        EXPECT_TRUE(finish_update.WaitForEvent());
+        return 1;
+    });
+    ASSERT_TRUE(update_started.WaitForEventFor(utest::kMaxTestWaitTime));
+
+    cache.UpdateInBackground("second", UpdateNever());
+    EXPECT_EQ(1u, cache.GetStatistics().total.background_updates.load());
+    EXPECT_EQ(1u, cache.GetStatistics().total.background_updates_skipped.load());
+
+    finish_update.Send();
+    EngineYield();
+    EXPECT_EQ(1, cache.GetOptionalNoUpdate("first"));
+}
+
 UTEST(ExpirableLruCache, Example) {
     /// [Sample ExpirableLruCache]
     using Key = std::string;
@@ -351,6 +402,139 @@ UTEST(ExpirableLruCache, Example) {
     /// [Sample ExpirableLruCache]
 }
 
+UTEST_MT(ExpirableLruCache, SingleFlight, 4) {
+    std::atomic<int> calls{0};
+    const auto update = [&calls](const SimpleCacheKey&) {
+        ++calls;
+        engine::SleepFor(std::chrono::milliseconds{50});
+        return 42;
+    };
+
+    for (const auto read_mode : {SimpleCache::ReadMode::kSkipCache, SimpleCache::ReadMode::kUseCache}) {
+        auto cache = CreateSimpleCache();
+        calls = 0;
+
+        std::vector<engine::TaskWithResult<SimpleCacheValue>> tasks;
+        for (int i = 0; i < 10; ++i) {
+            tasks.push_back(utils::Async("get", [&] { return cache.Get("my-key", update, read_mode); }));
+        }
+        for (auto& task : tasks) EXPECT_EQ(42, task.Get());
+        EXPECT_EQ(1, calls.load());
+    }
+}
+
+UTEST_MT(ExpirableLruCache, SingleFlightException, 4) {
+    auto cache = CreateSimpleCache();
+    std::atomic<int> calls{0};
+    const auto update = [&calls](const SimpleCacheKey&) -> SimpleCacheValue {
+        ++calls;
+        engine::SleepFor(std::chrono::milliseconds{50});
+        throw std::runtime_error("update failed");
+    };
+
+    std::vector<engine::TaskWithResult<SimpleCacheValue>> tasks;
+    for (int i = 0; i < 10; ++i) {
+        tasks.push_back(utils::Async("get", [&] { return cache.Get("my-key", update); }));
+    }
+    for (auto& task : tasks) UEXPECT_THROW(task.Get(), std::runtime_error);
+    EXPECT_EQ(1, calls.load());
+
+    // Failures are not cached
+    EXPECT_EQ(1, cache.Get("my-key", [](const SimpleCacheKey&) { return 1; }));
+}
+
+UTEST(ExpirableLruCache, StaleWhileRevalidate) {
+    auto counter = std::make_shared<Counter>();
+
+    auto cache = CreateSimpleCache();
+    cache.SetMaxLifetime(std::chrono::seconds(2));
+    cache.SetMaxStaleness(std::chrono::seconds(2));
+    SimpleCacheKey key = "my-key";
+
+    utils::datetime::MockNowSet(std::chrono::system_clock::now());
+    counter->Flush();
+    cache.Put(key, 1);
+
+    // Expired, but stale value is still usable
+    utils::datetime::MockSleep(std::chrono::seconds(3));
+    EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+
+    EngineYield();
+    EXPECT_EQ(Counter::One(), *counter);
+    EXPECT_EQ(2, cache.Get(key, UpdateNever()));
+
+    // Too stale
+    utils::datetime::MockSleep(std::chrono::seconds(5));
+    EXPECT_EQ(3, cache.Get(key, UpdateValue(counter, 3)));
+}
+
+UTEST(ExpirableLruCache, NegativeCache) {
+    using OptionalCache = cache::ExpirableLruCache<SimpleCacheKey, std::optional<int>>;
+    OptionalCache cache(1, 1);
+    cache.SetNegativeCache({/*size=*/100, /*false_positive_rate=*/0.01, /*lifetime=*/std::chrono::seconds(10)});
+
+    utils::datetime::MockNowSet(std::chrono::system_clock::now());
+    std::atomic<int> updates{0};
+    const auto not_found = [&updates](const SimpleCacheKey&) -> std::optional<int> {
+        ++updates;
+        return std::nullopt;
+    };
+
+    EXPECT_EQ(std::nullopt, cache.Get("missing", not_found));
+    EXPECT_EQ(1, updates.load());
+    // Not found values do not take place in the LRU
+    EXPECT_EQ(0u, cache.GetSizeApproximate());
+
+    EXPECT_EQ(std::nullopt, cache.Get("missing", not_found));
+    EXPECT_EQ(1, updates.load());
+    ASSERT_NE(nullptr, cache.GetNegativeCache());
+    EXPECT_EQ(1u, cache.GetNegativeCache()->GetHits());
+    EXPECT_EQ(1u, cache.GetNegativeCache()->GetSizeApproximate());
+
+    EXPECT_EQ(1, cache.Get("found", [](const SimpleCacheKey&) { return std::optional<int>{1}; }));
+    EXPECT_EQ(1u, cache.GetSizeApproximate());
+
+    // Skipping the cache always calls the update function
+    EXPECT_EQ(std::nullopt, cache.Get("missing", not_found, OptionalCache::ReadMode::kSkipCache));
+    EXPECT_EQ(2, updates.load());
+
+    // The key was created meanwhile
+    cache.InvalidateByKey("missing");
+    EXPECT_EQ(2, cache.Get("missing", [](const SimpleCacheKey&) { return std::optional<int>{2}; }));
+}
+
+UTEST(ExpirableLruCache, NegativeCacheExpires) {
+    cache::ExpirableLruCache<SimpleCacheKey, std::shared_ptr<int>> cache(1, 1);
+    cache.SetNegativeCache({/*size=*/100, /*false_positive_rate=*/0.01, /*lifetime=*/std::chrono::seconds(10)});
+
+    utils::datetime::MockNowSet(std::chrono::system_clock::now());
+    std::atomic<int> updates{0};
+    const auto not_found = [&updates](const SimpleCacheKey&) -> std::shared_ptr<int> {
+        ++updates;
+        return nullptr;
+    };
+
+    EXPECT_EQ(nullptr, cache.Get("missing", not_found));
+    EXPECT_EQ(1, updates.load());
+
+    // Remembered for at least a half of the lifetime
+    utils::datetime::MockSleep(std::chrono::seconds(5));
+    EXPECT_EQ(nullptr, cache.Get("missing", not_found));
+    EXPECT_EQ(1, updates.load());
+
+    // Forgotten after the lifetime
+    utils::datetime::MockSleep(std::chrono::seconds(10));
+    EXPECT_EQ(nullptr, cache.Get("missing", not_found));
+    EXPECT_EQ(2, updates.load());
+}
+
+TEST(ExpirableLruCache, NegativeCacheCounters) {
+    // ~10.5 counters per key for 1%, ~20.4 for 0.1%
+    EXPECT_EQ(10523u, cache::impl::GetNegativeCacheCountersCount(1000, 0.01));
+    EXPECT_EQ(20429u, cache::impl::GetNegativeCacheCountersCount(1000, 0.001));
+    EXPECT_EQ(64u, cache::impl::GetNegativeCacheCountersCount(1, 0.01));
+}
+
 UTEST(LruCacheWrapper, HitWrapper) {
     auto counter = std::make_shared<Counter>();
 
@@ -52,9 +52,20 @@ properties:
     size:
         type: integer
         description: max amount of items to store in cache
+    max-bytes:
+        type: integer
+        description: max estimated size of the values in bytes, only for the 'lru' policy (0 is unlimited)
+        defaultDescription: 0
     ways:
         type: integer
         description: number of ways for associative cache
+    policy:
+        type: string
+        description: eviction policy, 'tiny-lfu' protects frequently used entries from scans
+        defaultDescription: lru
+        enum:
+          - lru
+          - tiny-lfu
     lifetime:
         type: string
         description: TTL for cache entries (0 is unlimited)
@@ -63,10 +74,38 @@ properties:
         type: boolean
         description: enables asynchronous updates for expiring values
         defaultDescription: false
+    refresh-ahead:
+        type: number
+        description: a value read when less than this fraction of lifetime is left is updated in background
+        defaultDescription: 0.5
+    max-background-updates:
+        type: integer
+        description: max count of concurrent background updates (0 is unlimited)
+        defaultDescription: 0
+    max-staleness:
+        type: string
+        description: for how long expired values are returned while they are updated in background (0 is never)
+        defaultDescription: 0
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
         defaultDescription: true
+    negative-cache:
+        type: object
+        description: remembers the not found keys in a Bloom filter instead of the cache
+        additionalProperties: false
+        properties:
+            size:
+                type: integer
+                description: expected count of the not found keys per lifetime
+            false-positive-rate:
+                type: number
+                description: probability of a found key being reported as not found
+                defaultDescription: 0.01
+            lifetime:
+                type: string
+                description: for how long a not found key is remembered
+                defaultDescription: 60s
 )");
 }
 
@@ -6,6 +6,8 @@
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,21 +17,62 @@ namespace {
 
 constexpr std::string_view kWays = "ways";
 constexpr std::string_view kSize = "size";
+constexpr std::string_view kMaxBytes = "max-bytes";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kMaxStaleness = "max-staleness";
+constexpr std::string_view kMaxStalenessMs = "max-staleness-ms";
+constexpr std::string_view kPolicy = "policy";
+constexpr std::string_view kRefreshAhead = "refresh-ahead";
+constexpr std::string_view kMaxBackgroundUpdates = "max-background-updates";
+constexpr std::string_view kNegativeCache = "negative-cache";
+constexpr std::string_view kFalsePositiveRate = "false-positive-rate";
+
+constexpr double kDefaultRefreshAhead = 0.5;
+
+constexpr utils::TrivialBiMap kCachePolicyMap([](auto selector) {
+    return selector().Case(CachePolicy::kLRU, "lru").Case(CachePolicy::kTinyLFU, "tiny-lfu");
+});
+
+void ValidateRefreshAhead(double refresh_ahead) {
+    if (!(refresh_ahead > 0 && refresh_ahead < 1)) throw std::runtime_error("refresh-ahead is not in (0, 1)");
+}
 
 }  // namespace
 
+CachePolicy Parse(const yaml_config::YamlConfig& value, formats::parse::To<CachePolicy>) {
+    return utils::ParseFromValueString(value, kCachePolicyMap);
+}
+
+NegativeCacheConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<NegativeCacheConfig>) {
+    NegativeCacheConfig config;
+    config.size = value[kSize].As<std::size_t>();
+    config.false_positive_rate = value[kFalsePositiveRate].As<double>(config.false_positive_rate);
+    config.lifetime = value[kLifetime].As<std::chrono::milliseconds>(config.lifetime);
+
+    if (config.size == 0) throw std::runtime_error("negative-cache.size is non-positive");
+    if (!(config.false_positive_rate > 0 && config.false_positive_rate < 1)) {
+        throw std::runtime_error("negative-cache.false-positive-rate is not in (0, 1)");
+    }
+    if (config.lifetime.count() <= 0) throw std::runtime_error("negative-cache.lifetime is non-positive");
+    return config;
+}
+
 using dump::impl::ParseMs;
 
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
+      max_bytes(config[kMaxBytes].As<std::size_t>(0)),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(
           config[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
-      ) {
+      ),
+      max_staleness(config[kMaxStaleness].As<std::chrono::milliseconds>(0)),
+      refresh_ahead(config[kRefreshAhead].As<double>(kDefaultRefreshAhead)),
+      max_background_updates(config[kMaxBackgroundUpdates].As<std::size_t>(0)) {
     if (size == 0) throw std::runtime_error("cache-size is non-positive");
+    ValidateRefreshAhead(refresh_ahead);
 }
 
 LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
@@ -37,11 +80,16 @@ LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
 
 LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
     : size(value[kSize].As<std::size_t>()),
+      max_bytes(value[kMaxBytes].As<std::size_t>(0)),
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(
           value[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
-      ) {
+      ),
+      max_staleness(ParseMs(value[kMaxStalenessMs], std::chrono::milliseconds::zero())),
+      refresh_ahead(value[kRefreshAhead].As<double>(kDefaultRefreshAhead)),
+      max_background_updates(value[kMaxBackgroundUpdates].As<std::size_t>(0)) {
     if (size == 0) throw std::runtime_error("cache-size is non-positive");
+    ValidateRefreshAhead(refresh_ahead);
 }
 
 std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
@@ -49,6 +97,12 @@ std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
     return way_size == 0 ? 1 : way_size;
 }
 
+std::size_t LruCacheConfig::GetWayMaxBytes(std::size_t ways) const {
+    if (max_bytes == 0) return 0;
+    const auto way_max_bytes = max_bytes / ways;
+    return way_max_bytes == 0 ? 1 : way_max_bytes;
+}
+
 LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCacheConfig>) {
     return LruCacheConfig{value};
 }
@@ -56,8 +110,13 @@ LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCa
 LruCacheConfigStatic::LruCacheConfigStatic(const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
-      use_dynamic_config(config["config-settings"].As<bool>(true)) {
+      policy(config[kPolicy].As<CachePolicy>(CachePolicy::kLRU)),
+      use_dynamic_config(config["config-settings"].As<bool>(true)),
+      negative_cache(config[kNegativeCache].As<std::optional<NegativeCacheConfig>>()) {
     if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
+    if (this->config.max_bytes != 0 && policy != CachePolicy::kLRU) {
+        throw std::runtime_error("max-bytes is only supported for the 'lru' policy");
+    }
 }
 
 LruCacheConfigStatic::LruCacheConfigStatic(const components::ComponentConfig& config)
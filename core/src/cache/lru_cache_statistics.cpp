@@ -12,13 +12,15 @@ ExpirableLruCacheStatisticsBase::ExpirableLruCacheStatisticsBase(const Expirable
     : hits(other.hits.load()),
       misses(other.misses.load()),
       stale(other.stale.load()),
-      background_updates(other.background_updates.load()) {}
+      background_updates(other.background_updates.load()),
+      background_updates_skipped(other.background_updates_skipped.load()) {}
 
 void ExpirableLruCacheStatisticsBase::Reset() {
     hits = 0;
     misses = 0;
     stale = 0;
     background_updates = 0;
+    background_updates_skipped = 0;
 }
 
 ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
@@ -28,6 +30,7 @@ ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
     misses += other.misses.load();
     stale += other.stale.load();
     background_updates += other.background_updates.load();
+    background_updates_skipped += other.background_updates_skipped.load();
     return *this;
 }
 
@@ -49,11 +52,18 @@ void CacheStale(ExpirableLruCacheStatistics& stats) {
     LOG_TRACE() << "stale cache";
 }
 
+void CacheBackgroundUpdateSkipped(ExpirableLruCacheStatistics& stats) {
+    ++stats.total.background_updates_skipped;
+    ++stats.recent.GetCurrentCounter().background_updates_skipped;
+    LOG_TRACE() << "cache background update skipped";
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatistics& stats) {
     writer["hits"] = stats.total.hits.load();
     writer["misses"] = stats.total.misses.load();
     writer["stale"] = stats.total.stale.load();
     writer["background-updates"] = stats.total.background_updates.load();
+    writer["background-updates-skipped"] = stats.total.background_updates_skipped.load();
 
     auto s1min = stats.recent.GetStatsForPeriod();
     double s1min_hits = s1min.hits.load();
@@ -0,0 +1,30 @@
+#include <userver/cache/negative_cache_filter.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+namespace {
+
+// utils::FilterBloom sets 4 counters per key
+constexpr double kHashFunctionsCount = 4;
+constexpr std::size_t kMinCountersCount = 64;
+
+}  // namespace
+
+std::size_t GetNegativeCacheCountersCount(std::size_t size, double false_positive_rate) {
+    UASSERT(false_positive_rate > 0 && false_positive_rate < 1);
+    // p = (1 - e^(-kn/m))^k  =>  m = -kn / ln(1 - p^(1/k))
+    const auto counters =
+        -kHashFunctionsCount * size / std::log(1 - std::pow(false_positive_rate, 1 / kHashFunctionsCount));
+    return std::max(static_cast<std::size_t>(std::ceil(counters)), kMinCountersCount);
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
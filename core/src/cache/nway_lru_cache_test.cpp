@@ -2,6 +2,8 @@
 
 #include <userver/cache/nway_lru_cache.hpp>
 
+#include <string>
+
 USERVER_NAMESPACE_BEGIN
 
 using Cache = cache::NWayLRU<int, int>;
@@ -54,6 +56,95 @@ UTEST(NWayLRU, SetMultipleWays) {
     EXPECT_EQ(1, cache.Get(1));
 }
 
+UTEST(NWayLRU, TinyLfu) {
+    Cache cache(2, 10, cache::CachePolicy::kTinyLFU);
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 5; ++j) cache.Put(i, i);
+    }
+
+    for (int i = 100; i < 1000; ++i) cache.Put(i, i);
+    EXPECT_LE(cache.GetSize(), 20);
+    EXPECT_GT(cache.GetAdmissionRejects(), 0);
+
+    std::size_t hot_keys_found = 0;
+    for (int i = 0; i < 10; ++i) hot_keys_found += cache.Get(i).has_value();
+    EXPECT_GE(hot_keys_found, 8);
+
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayLRU, MaxBytes) {
+    using StringCache = cache::NWayLRU<int, std::string>;
+    const auto value_bytes = [](std::size_t length) {
+        return cache::SizeEstimator<std::string>{}(std::string(length, 'x'));
+    };
+
+    StringCache cache(1, 100);
+    cache.UpdateWayMaxBytes(value_bytes(1000) + value_bytes(100) + value_bytes(10));
+    EXPECT_EQ(0, cache.GetBytesUsed());
+
+    cache.Put(1, std::string(1000, 'x'));
+    cache.Put(2, std::string(100, 'x'));
+    cache.Put(3, std::string(10, 'x'));
+    EXPECT_EQ(3, cache.GetSize());
+    EXPECT_EQ(value_bytes(1000) + value_bytes(100) + value_bytes(10), cache.GetBytesUsed());
+
+    // Evicts the least recently used large value
+    cache.Put(4, std::string(500, 'x'));
+    EXPECT_FALSE(cache.Get(1).has_value());
+    EXPECT_EQ(3, cache.GetSize());
+    EXPECT_EQ(value_bytes(500) + value_bytes(100) + value_bytes(10), cache.GetBytesUsed());
+
+    // Rewrites the value
+    cache.Put(2, std::string(10, 'x'));
+    EXPECT_EQ(value_bytes(500) + value_bytes(10) + value_bytes(10), cache.GetBytesUsed());
+
+    // Too large values are not cached
+    cache.Put(5, std::string(10000, 'x'));
+    EXPECT_FALSE(cache.Get(5).has_value());
+    EXPECT_EQ(3, cache.GetSize());
+
+    cache.InvalidateByKey(4);
+    EXPECT_EQ(value_bytes(10) + value_bytes(10), cache.GetBytesUsed());
+
+    EXPECT_FALSE(cache.Get(3, [](const std::string&) { return false; }).has_value());
+    EXPECT_EQ(value_bytes(10), cache.GetBytesUsed());
+
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetSize());
+    EXPECT_EQ(0, cache.GetBytesUsed());
+}
+
+UTEST(NWayLRU, MaxBytesUpdate) {
+    using StringCache = cache::NWayLRU<int, std::string>;
+    const auto value_bytes = cache::SizeEstimator<std::string>{}(std::string(100, 'x'));
+
+    StringCache cache(1, 100);
+    for (int i = 0; i < 10; ++i) cache.Put(i, std::string(100, 'x'));
+    EXPECT_EQ(0, cache.GetBytesUsed());
+
+    cache.UpdateWayMaxBytes(value_bytes * 5);
+    EXPECT_EQ(5, cache.GetSize());
+    EXPECT_EQ(value_bytes * 5, cache.GetBytesUsed());
+    for (int i = 5; i < 10; ++i) EXPECT_TRUE(cache.Get(i).has_value());
+
+    // Count limit evicts with the bytes accounted
+    cache.UpdateWaySize(2);
+    EXPECT_EQ(2, cache.GetSize());
+    EXPECT_EQ(value_bytes * 2, cache.GetBytesUsed());
+    cache.Put(100, std::string(100, 'x'));
+    EXPECT_EQ(2, cache.GetSize());
+    EXPECT_EQ(value_bytes * 2, cache.GetBytesUsed());
+
+    cache.UpdateWayMaxBytes(0);
+    EXPECT_EQ(0, cache.GetBytesUsed());
+    EXPECT_EQ(2, cache.GetSize());
+
+    StringCache tiny_lfu(1, 100, cache::CachePolicy::kTinyLFU);
+    UEXPECT_THROW(tiny_lfu.UpdateWayMaxBytes(1000), std::logic_error);
+}
+
 UTEST(NWayLRU, HashCombine) {
     for (const auto seed : std::vector<std::size_t>{0, 1, 7, 42, 100, 1000}) {
         /// @note: checking for seed used in way selection to not be equal after
@@ -23,11 +23,16 @@ ResolverConfig ParseResolverConfig(const components::ComponentConfig& component_
     config.network_custom_servers =
         component_config["network-custom-servers"].As<std::vector<std::string>>(config.network_custom_servers);
     config.cache_ways = component_config["cache-ways"].As<size_t>(config.cache_ways);
-    config.cache_size_per_way = component_config["cache_size_per_way"].As<size_t>(config.cache_size_per_way);
+    config.cache_size_per_way = component_config["cache-size-per-way"].As<size_t>(config.cache_size_per_way);
     config.cache_max_reply_ttl =
-        component_config["cache_max_reply_ttl"].As<std::chrono::milliseconds>(config.cache_max_reply_ttl);
+        component_config["cache-max-reply-ttl"].As<std::chrono::milliseconds>(config.cache_max_reply_ttl);
     config.cache_failure_ttl =
-        component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(config.cache_failure_ttl);
+        component_config["cache-failure-ttl"].As<std::chrono::milliseconds>(config.cache_failure_ttl);
+    config.cache_negative_ttl =
+        component_config["cache-negative-ttl"].As<std::chrono::milliseconds>(config.cache_negative_ttl);
+    config.preload_names = component_config["preload-names"].As<std::vector<std::string>>(config.preload_names);
+    config.preload_refresh_interval =
+        component_config["preload-refresh-interval"].As<std::chrono::milliseconds>(config.preload_refresh_interval);
     return config;
 }
 
@@ -100,6 +105,21 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-negative-ttl:
+        type: string
+        description: TTL for caching of the replies stating that the name does not exist
+        defaultDescription: 5s
+    preload-names:
+        type: array
+        description: names to resolve on startup and to refresh in background before their expiration
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: name to preload
+    preload-refresh-interval:
+        type: string
+        description: interval of the preloaded names expiration checks
+        defaultDescription: 1s
 )");
 }
 
@@ -44,6 +44,12 @@ std::exception_ptr MakeNotResolvedException(std::string_view name, std::string_v
     return std::make_exception_ptr(NotResolvedException{fmt::format("Could not resolve {}: {}", name, reason)});
 }
 
+std::exception_ptr MakeNameNotFoundException(std::string_view name, std::string_view reason) {
+    return std::make_exception_ptr(NameNotFoundException{fmt::format("Could not resolve {}: {}", name, reason)});
+}
+
+bool IsNegativeReply(int status) { return status == ARES_ENOTFOUND || status == ARES_ENODATA; }
+
 }  // namespace
 
 class NetResolver::Impl {
@@ -189,7 +195,11 @@ public:
     void ProcessResponses() {
         for (auto& request : responses_queue) {
             if (request->status != ARES_SUCCESS) {
-                request->promise.set_exception(MakeNotResolvedException(request->name, ares_strerror(request->status)));
+                const auto* reason = ares_strerror(request->status);
+                request->promise.set_exception(
+                    IsNegativeReply(request->status) ? MakeNameNotFoundException(request->name, reason)
+                                                     : MakeNotResolvedException(request->name, reason)
+                );
                 continue;
             }
 
@@ -213,7 +223,7 @@ public:
                             << response.received_at << ", ttl=" << node->ai_ttl;
             }
             if (response.addrs.empty()) {
-                request->promise.set_exception(MakeNotResolvedException(request->name, "Empty address list"));
+                request->promise.set_exception(MakeNameNotFoundException(request->name, "Empty address list"));
                 continue;
             }
             impl::SortAddrs(response.addrs);
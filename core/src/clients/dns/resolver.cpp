@@ -5,6 +5,7 @@
 #include <cctype>
 #include <chrono>
 #include <string_view>
+#include <vector>
 
 #include <clients/dns/file_resolver.hpp>
 #include <clients/dns/helpers.hpp>
@@ -13,11 +14,13 @@
 #include <userver/clients/dns/exception.hpp>
 #include <userver/concurrent/mutex_set.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/from_string.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 #include <userver/utils/mock_now.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -152,6 +155,10 @@ public:
     void StartBackgroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex, const std::string& name);
 
 private:
+    // Resolves the preloaded names that are missing from the cache or expire
+    // before the next check, so that requests for them never wait
+    void RefreshPreloadedNames();
+
     struct NetCacheEntry {
         AddrVector addrs;
         std::chrono::steady_clock::time_point expiration;
@@ -182,9 +189,13 @@ private:
     const std::chrono::milliseconds net_cache_update_margin_;
     const std::chrono::milliseconds net_cache_max_reply_ttl_;
     const std::chrono::milliseconds net_cache_failure_ttl_;
+    const std::chrono::milliseconds net_cache_negative_ttl_;
     cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
     concurrent::MutexSet<std::string> net_cache_update_mutexes_;
     utils::impl::WaitTokenStorage wait_token_storage_;
+    const std::vector<std::string> preload_names_;
+    const std::chrono::milliseconds preload_refresh_interval_;
+    utils::PeriodicTask preload_task_;
 };
 
 Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor, const ResolverConfig& config)
@@ -193,10 +204,25 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor, const ResolverCon
       net_cache_update_margin_{config.network_timeout},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
+      net_cache_negative_ttl_{config.cache_negative_ttl},
       net_cache_{config.cache_ways, config.cache_size_per_way},
-      net_cache_update_mutexes_(config.cache_ways) {}
+      net_cache_update_mutexes_(config.cache_ways),
+      preload_names_{config.preload_names},
+      preload_refresh_interval_{config.preload_refresh_interval} {
+    if (preload_names_.empty()) return;
+
+    RefreshPreloadedNames();
+    preload_task_.Start(
+        "dns-resolver-preload", utils::PeriodicTask::Settings{preload_refresh_interval_}, [this] {
+            RefreshPreloadedNames();
+        }
+    );
+}
 
-Resolver::Impl::~Impl() { wait_token_storage_.WaitForAllTokens(); }
+Resolver::Impl::~Impl() {
+    preload_task_.Stop();
+    wait_token_storage_.WaitForAllTokens();
+}
 
 const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters() const { return source_counters_; }
 
@@ -249,6 +275,39 @@ auto Resolver::Impl::GetUpdateMutex(const std::string& name) { return net_cache_
 
 void Resolver::Impl::AccountNetUpdateFailure() { ++source_counters_.network_failure; }
 
+void Resolver::Impl::RefreshPreloadedNames() {
+    const auto refresh_deadline =
+        utils::datetime::MockSteadyNow() + net_cache_update_margin_ + preload_refresh_interval_;
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (const auto& name : preload_names_) {
+        const auto cached = net_cache_.Get(name);
+        const bool has_reply = cached && !cached->is_failure;
+        if (has_reply && cached->expiration > refresh_deadline) continue;
+
+        tasks.push_back(engine::CriticalAsyncNoSpan([this, &name, has_reply] {
+            auto mutex = GetUpdateMutex(name);
+            std::unique_lock lock{mutex, std::try_to_lock};
+            if (!lock) {
+                LOG_TRACE() << "Record for '" << name << "' is already updating, skipping";
+                return;
+            }
+
+            LOG_TRACE() << "Refreshing preloaded record for '" << name << '\'';
+            try {
+                // stale reply is better than none, keeping it on failures
+                FinishNetUpdate(
+                    lock, net_resolver_.Resolve(name), name, nullptr, has_reply ? FailureMode::kIgnore : FailureMode::kCache
+                );
+            } catch (const ResolverException&) {
+                // already logged and accounted, will retry on the next check
+            }
+        }));
+    }
+
+    for (auto& task : tasks) task.Wait();
+}
+
 template <typename Mutex>
 AddrVector Resolver::Impl::DoForegroundQuery(
     std::unique_lock<Mutex>& lock,
@@ -327,6 +386,15 @@ void Resolver::Impl::FinishNetUpdate(
     NetResolver::Response response;
     try {
         response = future.get();
+    } catch (const NameNotFoundException& ex) {
+        // RFC2308: negative replies are cached separately from server failures
+        LOG_LIMITED_WARNING() << "Resolving of '" << name << "' failed: " << ex;
+        if (failure_mode == FailureMode::kCache) {
+            LOG_TRACE() << "Caching negative reply for '" << name << '\'';
+            net_cache_.Put(name, NetCacheEntry{{}, utils::datetime::MockSteadyNow() + net_cache_negative_ttl_, true});
+        }
+        ++source_counters_.network_failure;
+        throw;
     } catch (const ResolverException& ex) {
         LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
         if (failure_mode == FailureMode::kCache) {
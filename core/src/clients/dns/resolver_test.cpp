@@ -1,3 +1,4 @@
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -59,7 +60,7 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
     using ServerMock = utest::DnsServerMock;
 
-    MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+    MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way, std::vector<std::string> preload_names = {})
         : hosts_file{[] {
               auto file = fs::blocking::TempFile::Create();
               fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -86,6 +87,7 @@ struct MockedResolver {
                        config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl}, config.cache_ways = 1;
                        config.cache_size_per_way = cache_size_per_way;
                        config.network_custom_servers = {server_mock.GetServerAddress()};
+                       config.preload_names = std::move(preload_names);
                        return config;
                    }()} {}
 
@@ -372,6 +374,26 @@ UTEST(Resolver, CacheFailures) {
     EXPECT_EQ(counters.network_failure, 2);
 }
 
+UTEST(Resolver, Preload) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    MockedResolver resolver{1000, 1, {"preloaded"}};
+
+    const auto& counters = resolver->GetLookupSourceCounters();
+    EXPECT_EQ(counters.network, 1);
+
+    EXPECT_PRED_FORMAT2(
+        CheckAddrs, resolver->Resolve("preloaded", test_deadline), (Expected{kNetV6String, kNetV4String})
+    );
+
+    EXPECT_EQ(counters.file, 0);
+    EXPECT_EQ(counters.cached, 1);
+    EXPECT_EQ(counters.cached_stale, 0);
+    EXPECT_EQ(counters.cached_failure, 0);
+    EXPECT_EQ(counters.network, 1);
+    EXPECT_EQ(counters.network_failure, 0);
+}
+
 UTEST(Resolver, FileDoesNotCache) {
     const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
 
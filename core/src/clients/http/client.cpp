@@ -7,6 +7,7 @@
 #include <moodycamel/concurrentqueue.h>
 
 #include <userver/crypto/openssl.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/manager.hpp>
 #include <userver/utils/async.hpp>
@@ -19,6 +20,7 @@
 #include <clients/http/testsuite.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -28,6 +30,7 @@ namespace {
 
 const std::string kIoThreadName = "curl";
 const auto kEasyReinitPeriod = std::chrono::minutes{1};
+constexpr short kWarmUpRetries = 1;
 
 // cURL accepts options as long, but we use size_t to avoid writing checks.
 // Clamp too high values to LONG_MAX, it shouldn't matter for these magnitudes.
@@ -47,7 +50,7 @@ Client::Client(
 )
     : deadline_propagation_config_(settings.deadline_propagation),
       cancellation_policy_(settings.cancellation_policy),
-      destination_statistics_(std::make_shared<DestinationStatistics>()),
+      destination_statistics_(std::make_shared<DestinationStatistics>(settings.destination_concurrency_limit)),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
@@ -64,6 +67,13 @@ Client::Client(
 
     ReinitEasy();
 
+    if (settings.tls_session_cache) {
+        // Lets the new connections of any IO thread resume TLS sessions
+        // instead of doing full handshakes
+        tls_session_share_ = std::make_shared<curl::share>();
+        tls_session_share_->set_share_ssl_session(true);
+    }
+
     multis_.reserve(io_threads);
 
     // libcurl synchronously reads some of /etc/* files.
@@ -80,9 +90,21 @@ Client::Client(
     });
 
     SetConfig({});
+
+    if (!settings.warm_up.urls.empty()) {
+        // Connections are dropped after some idle time, so they are refreshed
+        // periodically. That also opens the connections to the new addresses
+        // after the DNS changes.
+        warm_up_task_.Start(
+            "http_connections_warm_up",
+            utils::PeriodicTask::Settings(settings.warm_up.refresh_interval, utils::PeriodicTask::Flags::kNow),
+            [this, warm_up = std::move(settings.warm_up)] { WarmUpConnections(warm_up); }
+        );
+    }
 }
 
 Client::~Client() {
+    warm_up_task_.Stop();
     easy_reinit_task_.Stop();
 
     // We have to destroy *this only when all the requests are finished, because
@@ -106,12 +128,17 @@ Client::~Client() {
     thread_pool_.reset();
 }
 
-Request Client::CreateRequest() {
-    auto request = [this] {
-        auto easy = TryDequeueIdle();
+Request Client::CreateRequest() { return DoCreateRequest(std::nullopt); }
+
+Request Client::DoCreateRequest(std::optional<std::size_t> multi_index) {
+    auto request = [this, multi_index] {
+        // Idle easy handles are bound to random multis
+        std::shared_ptr<curl::easy> easy;
+        if (!multi_index) easy = TryDequeueIdle();
         if (easy) {
             auto idx = FindMultiIndex(easy->GetMulti());
             auto wrapper = impl::EasyWrapper{std::move(easy), *this};
+            wrapper.Easy().set_share(tls_session_share_);
             return Request{
                 std::move(wrapper),
                 statistics_[idx].CreateRequestStats(),
@@ -120,13 +147,15 @@ Request Client::CreateRequest() {
                 plugin_pipeline_,
                 *tracing_manager_.GetBase()};
         } else {
-            auto i = utils::RandRange(multis_.size());
+            const auto i = multi_index.value_or(utils::RandRange(multis_.size()));
+            UASSERT(i < multis_.size());
             auto& multi = multis_[i];
 
             try {
                 auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
                                    return impl::EasyWrapper{easy_.Get()->GetBoundBlocking(*multi), *this};
                                }).Get();
+                wrapper.Easy().set_share(tls_session_share_);
                 return Request{
                     std::move(wrapper),
                     statistics_[i].CreateRequestStats(),
@@ -270,6 +299,48 @@ void Client::SetConfig(const impl::Config& config) {
 
 void Client::ResetUserAgent(std::optional<std::string> user_agent) { user_agent_ = std::move(user_agent); }
 
+void Client::WarmUpConnections(
+    const std::string& url,
+    std::size_t connections_per_thread,
+    std::chrono::milliseconds timeout
+) {
+    // Concurrent requests of a multi open separate connections
+    std::vector<ResponseFuture> futures;
+    futures.reserve(multis_.size() * connections_per_thread);
+    for (std::size_t i = 0; i < multis_.size(); ++i) {
+        for (std::size_t j = 0; j < connections_per_thread; ++j) {
+            auto request = DoCreateRequest(i);
+            request.head(url);
+            request.timeout(timeout);
+            request.retry(kWarmUpRetries);
+            futures.push_back(request.async_perform());
+        }
+    }
+
+    std::size_t failed = 0;
+    for (auto& future : futures) {
+        try {
+            future.Get();
+        } catch (const std::exception& e) {
+            if (engine::current_task::ShouldCancel()) throw;
+            LOG_DEBUG() << "Failed to warm up a connection to " << url << ": " << e;
+            ++failed;
+        }
+    }
+
+    if (failed != 0) {
+        LOG_WARNING() << "Failed to warm up " << failed << " out of " << futures.size() << " connections to " << url;
+    } else {
+        LOG_INFO() << "Warmed up " << futures.size() << " connections to " << url;
+    }
+}
+
+void Client::WarmUpConnections(const ConnectionsWarmUpSettings& settings) {
+    for (const auto& url : settings.urls) {
+        WarmUpConnections(url, settings.connections_per_thread, settings.timeout);
+    }
+}
+
 }  // namespace clients::http
 
 USERVER_NAMESPACE_END
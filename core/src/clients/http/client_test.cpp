@@ -1,5 +1,6 @@
 #include <userver/clients/http/client.hpp>
 
+#include <atomic>
 #include <set>
 
 #include <fmt/format.h>
@@ -11,6 +12,8 @@
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/hedged_request.hpp>
+#include <userver/clients/http/response_body_sink.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/crypto/certificate.hpp>
@@ -292,6 +295,43 @@ HttpResponse huge_data_callback(const HttpRequest& request) {
         HttpResponse::kWriteAndClose};
 }
 
+// Waits for the whole body, which may be sent with chunked encoding
+HttpResponse streamed_body_echo_callback(const HttpRequest& request) {
+    const auto headers_end = request.find("\r\n\r\n");
+    if (headers_end == std::string::npos) return {{}, HttpResponse::kTryReadMore};
+
+    const auto headers = request.substr(0, headers_end);
+    const auto body = request.substr(headers_end + 4);
+    std::string payload;
+
+    const auto content_length_pos = headers.find("Content-Length: ");
+    if (content_length_pos != std::string::npos) {
+        const auto content_length = std::stoul(headers.substr(content_length_pos + 16));
+        if (body.size() < content_length) return {{}, HttpResponse::kTryReadMore};
+        payload = body;
+    } else {
+        EXPECT_NE(headers.find("Transfer-Encoding: chunked"), std::string::npos) << request;
+        if (body.size() < 5 || body.compare(body.size() - 5, 5, "0\r\n\r\n") != 0) {
+            return {{}, HttpResponse::kTryReadMore};
+        }
+
+        // Decode the chunks
+        std::size_t pos = 0;
+        while (true) {
+            const auto size_end = body.find("\r\n", pos);
+            const auto chunk_size = std::stoul(body.substr(pos, size_end - pos), nullptr, 16);
+            if (chunk_size == 0) break;
+            payload += body.substr(size_end + 2, chunk_size);
+            pos = size_end + 2 + chunk_size + 2;
+        }
+    }
+
+    return {
+        "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " + std::to_string(payload.size()) + "\r\n\r\n" +
+            payload,
+        HttpResponse::kWriteAndClose};
+}
+
 std::string TryGetHeader(const HttpRequest& request, std::string_view header) {
     const auto first_pos = request.find(header);
     if (first_pos == std::string::npos) return {};
@@ -595,6 +635,53 @@ UTEST(HttpClient, PostEcho) {
     }
 }
 
+UTEST(HttpClient, WarmUpConnections) {
+    const utest::SimpleServer http_server{[](const HttpRequest&) {
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+    }};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    http_client_ptr->WarmUpConnections(http_server.GetBaseUrl(), 1, kTimeout);
+
+    // Whatever IO thread serves the request, it has a connection in the pool
+    for (int i = 0; i < 10; ++i) {
+        const auto response = http_client_ptr->CreateRequest()
+                                  .get(http_server.GetBaseUrl())
+                                  .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                                  .timeout(kTimeout)
+                                  .perform();
+        EXPECT_EQ(response->status_code(), clients::http::Status::kOk);
+        EXPECT_EQ(response->GetStats().open_socket_count, 0);
+    }
+}
+
+UTEST(HttpClient, HedgedRequest) {
+    std::atomic<int> requests{0};
+    const utest::SimpleServer http_server{[&requests](const HttpRequest& request) {
+        // The first attempt hangs, the backup one answers right away
+        if (requests.fetch_add(1) == 0) {
+            return sleep_callback(request);
+        }
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+    }};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    clients::http::HedgingSettings settings;
+    settings.delay = kSmallTimeout;
+
+    const auto response = clients::http::PerformHedged(
+        *http_client_ptr,
+        [&http_server](clients::http::Request& request) {
+            request.get(http_server.GetBaseUrl())
+                .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                .timeout(kTimeout);
+        },
+        settings
+    );
+    EXPECT_EQ(response->status_code(), clients::http::Status::kOk);
+    EXPECT_EQ(requests.load(), 2);
+}
+
 UTEST(HttpClient, StatsOnTimeout) {
     const int kRetries = 5;
     const utest::SimpleServer http_server{&sleep_callback};
@@ -784,6 +871,94 @@ UTEST(HttpClient, PutEcho) {
     EXPECT_EQ(request.perform()->body(), kTestData);
 }
 
+UTEST(HttpClient, StreamedRequestBody) {
+    const utest::SimpleServer http_server{&streamed_body_echo_callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    for (const bool is_size_known : {true, false}) {
+        std::vector<std::string> chunks;
+        std::string expected_body;
+        for (unsigned i = 0; i < kFewRepetitions; ++i) {
+            chunks.push_back(std::string(1 << (i * 2), static_cast<char>('a' + i)));
+            expected_body += chunks.back();
+        }
+
+        /// [HTTP Client - streamed request body]
+        auto queue = concurrent::StringStreamQueue::Create(kFewRepetitions * 1024);
+        auto producer_task = engine::AsyncNoSpan([producer = queue->GetProducer(), chunks] {
+            const auto deadline = engine::Deadline::FromDuration(kTimeout);
+            for (auto chunk : chunks) {
+                if (!producer.Push(std::move(chunk), deadline)) return;
+                // The client waits for the producer
+                engine::Yield();
+            }
+            // The body ends when the producer is destroyed
+        });
+
+        auto request = http_client_ptr->CreateRequest()
+                           .post(http_server.GetBaseUrl())
+                           .data_stream(queue, is_size_known ? std::optional{expected_body.size()} : std::nullopt)
+                           .retry(1)
+                           .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                           .timeout(kTimeout);
+        const auto response = request.perform();
+        /// [HTTP Client - streamed request body]
+        producer_task.Get();
+
+        EXPECT_TRUE(response->IsOk());
+        EXPECT_EQ(response->body(), expected_body);
+    }
+}
+
+UTEST(HttpClient, StreamedResponseBackpressure) {
+    const utest::SimpleServer http_server{&huge_data_callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    // Much smaller than the body
+    auto queue = concurrent::StringStreamQueue::Create(1024);
+    auto response = http_client_ptr->CreateRequest()
+                        .get(http_server.GetBaseUrl())
+                        .retry(1)
+                        .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                        .timeout(kTimeout)
+                        .async_perform_stream_body(queue);
+    EXPECT_EQ(response.StatusCode(), clients::http::Status::OK);
+
+    std::string chunk;
+    std::string body;
+    const auto deadline = engine::Deadline::FromDuration(kTimeout);
+    while (response.ReadChunk(chunk, deadline)) {
+        EXPECT_LE(queue->GetSizeApproximate(), queue->GetSoftMaxSize());
+        body += chunk;
+        // Slow consumer
+        engine::Yield();
+    }
+    EXPECT_EQ(body, std::string(100000, '@'));
+}
+
+UTEST(HttpClient, ResponseBodySink) {
+    const utest::SimpleServer http_server{&huge_data_callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    std::string buffer(200000, '\0');
+    auto sink = std::make_shared<clients::http::BufferResponseBodySink>(utils::span<char>{buffer});
+    auto request = http_client_ptr->CreateRequest()
+                       .get(http_server.GetBaseUrl())
+                       .body_sink(sink)
+                       .retry(1)
+                       .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                       .timeout(kTimeout);
+
+    const auto response = request.perform();
+    EXPECT_TRUE(response->IsOk());
+    EXPECT_TRUE(response->body().empty());
+    EXPECT_EQ(sink->GetBody(), std::string(100000, '@'));
+
+    // Does not fit
+    auto small_sink = std::make_shared<clients::http::BufferResponseBodySink>(utils::span<char>{buffer.data(), 1000});
+    EXPECT_ANY_THROW(request.body_sink(small_sink).perform());
+}
+
 UTEST(HttpClient, PutValidateHeader) {
     const utest::SimpleServer http_server{&put_validate_callback};
     auto http_client_ptr = utest::CreateHttpClient();
@@ -1255,6 +1430,29 @@ UTEST(HttpClient, TinyTimeout) {
     }
 }
 
+UTEST(HttpClient, TryPerform) {
+    auto http_client_ptr = utest::CreateHttpClient();
+    const utest::SimpleServer http_server{EchoCallback{}};
+    const utest::SimpleServer sleep_server{&sleep_callback};
+
+    auto request = http_client_ptr->CreateRequest().post(http_server.GetBaseUrl(), kTestData).timeout(kTimeout);
+    auto result = request.TryPerform();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value()->body(), kTestData);
+
+    // The request is reusable after an error as well
+    request.url(sleep_server.GetBaseUrl()).timeout(kSmallTimeout);
+    result = request.TryPerform();
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().kind, clients::http::ErrorKind::kTimeout);
+    EXPECT_GE(result.error().stats.time_to_process, kSmallTimeout);
+
+    request.url(http_server.GetBaseUrl()).timeout(kTimeout);
+    result = request.TryPerform();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value()->body(), kTestData);
+}
+
 UTEST(HttpClient, UsingResolver) {
     const utest::SimpleServer http_server{EchoCallback{}, utest::SimpleServer::kTcpIpV6};
 
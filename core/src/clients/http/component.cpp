@@ -231,6 +231,70 @@ properties:
         enum:
           - cancel
           - ignore
+    connections-warm-up:
+        type: object
+        description: connections to open in advance and to keep open, so that the requests do not wait for TCP and TLS handshakes
+        additionalProperties: false
+        properties:
+            urls:
+                type: array
+                description: URLs to send HEAD requests to
+                items:
+                    type: string
+                    description: URL
+            connections-per-thread:
+                type: integer
+                description: connections to open to each URL in each of the IO threads
+                defaultDescription: 1
+                minimum: 1
+            timeout:
+                type: string
+                description: timeout of a warm-up request
+                defaultDescription: 1s
+            refresh-interval:
+                type: string
+                description: how often to repeat the warm-up to keep the connections from being closed as idle
+                defaultDescription: 1m
+    tls-session-cache:
+        type: boolean
+        description: share TLS sessions between all the IO threads, so that new connections resume them instead of doing full handshakes
+        defaultDescription: true
+    destination-concurrency-limit:
+        type: object
+        description: adaptive limit of the requests in flight to each destination, the requests over the limit fail fast
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: enable the limit
+                defaultDescription: false
+            initial-limit:
+                type: integer
+                description: the limit for a new destination
+                defaultDescription: 100
+                minimum: 1
+            min-limit:
+                type: integer
+                description: the limit is never decreased below this value
+                defaultDescription: 1
+                minimum: 1
+            max-limit:
+                type: integer
+                description: the limit is never increased above this value
+                defaultDescription: 1000
+                minimum: 1
+            decrease-ratio:
+                type: number
+                description: the limit is multiplied by this value on a timeout, a 429 or 503 response or a slow response
+                defaultDescription: 0.9
+            latency-percentile:
+                type: number
+                description: percentile of the recent destination timings that is considered the usual latency
+                defaultDescription: 95
+            latency-ratio:
+                type: number
+                description: a response is slow if its latency is more than this many usual latencies
+                defaultDescription: 2
 )");
 }
 
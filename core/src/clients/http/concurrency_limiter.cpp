@@ -0,0 +1,96 @@
+#include <clients/http/concurrency_limiter.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::chrono::seconds kBaselineUpdateInterval{1};
+
+std::chrono::steady_clock::rep Now() noexcept { return std::chrono::steady_clock::now().time_since_epoch().count(); }
+
+}  // namespace
+
+ConcurrencyLimiter::ConcurrencyLimiter(const DestinationConcurrencyLimitSettings& settings)
+    : settings_(settings), limit_(static_cast<double>(settings.initial_limit)) {}
+
+bool ConcurrencyLimiter::TryAcquire() noexcept {
+    if (!IsEnabled()) return true;
+
+    const auto limit = GetLimit();
+    auto in_flight = in_flight_.load();
+    do {
+        if (in_flight >= limit) {
+            ++rejected_;
+            return false;
+        }
+    } while (!in_flight_.compare_exchange_weak(in_flight, in_flight + 1));
+    return true;
+}
+
+void ConcurrencyLimiter::Release() noexcept {
+    if (!IsEnabled()) return;
+
+    UASSERT(in_flight_.load() > 0);
+    --in_flight_;
+}
+
+void ConcurrencyLimiter::Release(std::chrono::milliseconds latency, bool overloaded) noexcept {
+    if (!IsEnabled()) return;
+
+    const auto baseline_ms = baseline_ms_.load();
+    if (baseline_ms > 0 && latency.count() > baseline_ms * settings_.latency_ratio) overloaded = true;
+
+    if (overloaded) {
+        Decrease(latency);
+    } else if (in_flight_.load() * 2 >= GetLimit()) {
+        // Do not grow the limit that is far from being used
+        Increase();
+    }
+    Release();
+}
+
+bool ConcurrencyLimiter::IsBaselineOutdated() const noexcept {
+    if (!IsEnabled()) return false;
+    return Now() - baseline_updated_at_.load() >=
+           std::chrono::duration_cast<std::chrono::steady_clock::duration>(kBaselineUpdateInterval).count();
+}
+
+void ConcurrencyLimiter::SetBaseline(std::optional<std::chrono::milliseconds> baseline) noexcept {
+    baseline_ms_ = baseline ? baseline->count() : 0;
+    baseline_updated_at_ = Now();
+}
+
+std::size_t ConcurrencyLimiter::GetLimit() const noexcept { return static_cast<std::size_t>(limit_.load()); }
+
+void ConcurrencyLimiter::Increase() noexcept {
+    const auto max_limit = static_cast<double>(settings_.max_limit);
+    auto limit = limit_.load();
+    while (limit < max_limit && !limit_.compare_exchange_weak(limit, std::min(limit + 1 / limit, max_limit))) {
+    }
+}
+
+void ConcurrencyLimiter::Decrease(std::chrono::milliseconds latency) noexcept {
+    const auto now = Now();
+    auto decreased_at = decreased_at_.load();
+    do {
+        if (decreased_at != 0 &&
+            now - decreased_at < std::chrono::duration_cast<std::chrono::steady_clock::duration>(latency).count()) {
+            return;
+        }
+    } while (!decreased_at_.compare_exchange_weak(decreased_at, now));
+
+    const auto min_limit = static_cast<double>(settings_.min_limit);
+    auto limit = limit_.load();
+    while (!limit_.compare_exchange_weak(limit, std::max(limit * settings_.decrease_ratio, min_limit))) {
+    }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
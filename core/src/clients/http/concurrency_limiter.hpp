@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <userver/clients/http/config.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+// AIMD limit of the requests in flight to a single destination.
+//
+// While the limit is in use it grows by one per `limit` requests that
+// completed without overload signs. On a timeout, a 429 or 503 response, or a
+// latency above `latency-ratio` times the recent `latency-percentile` of the
+// destination, the limit is multiplied by `decrease-ratio`, at most once per
+// the latency of the failed request so that a burst of timeouts is a single
+// congestion event.
+class ConcurrencyLimiter final {
+public:
+    explicit ConcurrencyLimiter(const DestinationConcurrencyLimitSettings& settings = {});
+
+    bool IsEnabled() const noexcept { return settings_.enabled; }
+
+    const DestinationConcurrencyLimitSettings& GetSettings() const noexcept { return settings_; }
+
+    // Returns false and accounts a rejection if the limit is reached
+    bool TryAcquire() noexcept;
+
+    // Releases the slot of a request that was not sent
+    void Release() noexcept;
+
+    // Releases the slot and adjusts the limit by the outcome of the request
+    void Release(std::chrono::milliseconds latency, bool overloaded) noexcept;
+
+    bool IsBaselineOutdated() const noexcept;
+
+    // Sets the usual latency of the destination, std::nullopt if unknown
+    void SetBaseline(std::optional<std::chrono::milliseconds> baseline) noexcept;
+
+    std::size_t GetLimit() const noexcept;
+
+    std::size_t GetInFlight() const noexcept { return in_flight_.load(); }
+
+    utils::statistics::Rate GetRejected() const noexcept { return rejected_.Load(); }
+
+private:
+    void Increase() noexcept;
+    void Decrease(std::chrono::milliseconds latency) noexcept;
+
+    const DestinationConcurrencyLimitSettings settings_;
+    std::atomic<double> limit_;
+    std::atomic<std::size_t> in_flight_{0};
+    // Zero if unknown
+    std::atomic<std::chrono::milliseconds::rep> baseline_ms_{0};
+    std::atomic<std::chrono::steady_clock::rep> baseline_updated_at_{0};
+    // Zero if never
+    std::atomic<std::chrono::steady_clock::rep> decreased_at_{0};
+    utils::statistics::RateCounter rejected_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <clients/http/concurrency_limiter.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::ConcurrencyLimiter;
+using clients::http::DestinationConcurrencyLimitSettings;
+
+DestinationConcurrencyLimitSettings MakeSettings() {
+    DestinationConcurrencyLimitSettings settings;
+    settings.enabled = true;
+    settings.initial_limit = 2;
+    settings.min_limit = 1;
+    settings.max_limit = 3;
+    settings.decrease_ratio = 0.5;
+    return settings;
+}
+
+}  // namespace
+
+TEST(HttpClientConcurrencyLimiter, Disabled) {
+    ConcurrencyLimiter limiter;
+    for (int i = 0; i < 1000; ++i) EXPECT_TRUE(limiter.TryAcquire());
+    EXPECT_EQ(limiter.GetInFlight(), 0u);
+    EXPECT_EQ(limiter.GetRejected(), utils::statistics::Rate{0});
+}
+
+TEST(HttpClientConcurrencyLimiter, Rejects) {
+    ConcurrencyLimiter limiter{MakeSettings()};
+    EXPECT_TRUE(limiter.TryAcquire());
+    EXPECT_TRUE(limiter.TryAcquire());
+    EXPECT_FALSE(limiter.TryAcquire());
+    EXPECT_EQ(limiter.GetInFlight(), 2u);
+    EXPECT_EQ(limiter.GetRejected(), utils::statistics::Rate{1});
+
+    limiter.Release();
+    EXPECT_TRUE(limiter.TryAcquire());
+}
+
+TEST(HttpClientConcurrencyLimiter, AdditiveIncrease) {
+    ConcurrencyLimiter limiter{MakeSettings()};
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(limiter.TryAcquire());
+        ASSERT_TRUE(limiter.TryAcquire());
+        limiter.Release(std::chrono::milliseconds{1}, false);
+        limiter.Release(std::chrono::milliseconds{1}, false);
+    }
+    EXPECT_EQ(limiter.GetLimit(), 3u);
+    EXPECT_EQ(limiter.GetInFlight(), 0u);
+}
+
+TEST(HttpClientConcurrencyLimiter, NoIncreaseWhenUnused) {
+    DestinationConcurrencyLimitSettings settings = MakeSettings();
+    settings.initial_limit = 3;
+    settings.max_limit = 10;
+    ConcurrencyLimiter limiter{settings};
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(limiter.TryAcquire());
+        limiter.Release(std::chrono::milliseconds{1}, false);
+    }
+    EXPECT_EQ(limiter.GetLimit(), 3u);
+}
+
+TEST(HttpClientConcurrencyLimiter, MultiplicativeDecrease) {
+    ConcurrencyLimiter limiter{MakeSettings()};
+    ASSERT_TRUE(limiter.TryAcquire());
+    limiter.Release(std::chrono::milliseconds{0}, true);
+    EXPECT_EQ(limiter.GetLimit(), 1u);
+
+    ASSERT_TRUE(limiter.TryAcquire());
+    limiter.Release(std::chrono::milliseconds{0}, true);
+    EXPECT_EQ(limiter.GetLimit(), 1u) << "min-limit must be respected";
+}
+
+TEST(HttpClientConcurrencyLimiter, DecreaseOncePerLatency) {
+    DestinationConcurrencyLimitSettings settings = MakeSettings();
+    settings.initial_limit = 8;
+    settings.max_limit = 10;
+    ConcurrencyLimiter limiter{settings};
+    ASSERT_TRUE(limiter.TryAcquire());
+    ASSERT_TRUE(limiter.TryAcquire());
+    limiter.Release(std::chrono::hours{1}, true);
+    // The second timeout belongs to the same congestion event
+    limiter.Release(std::chrono::hours{1}, true);
+    EXPECT_EQ(limiter.GetLimit(), 4u);
+
+    ASSERT_TRUE(limiter.TryAcquire());
+    limiter.Release(std::chrono::milliseconds{0}, true);
+    EXPECT_EQ(limiter.GetLimit(), 2u);
+}
+
+TEST(HttpClientConcurrencyLimiter, SlowResponse) {
+    ConcurrencyLimiter limiter{MakeSettings()};
+    EXPECT_TRUE(limiter.IsBaselineOutdated());
+    limiter.SetBaseline(std::chrono::milliseconds{10});
+    EXPECT_FALSE(limiter.IsBaselineOutdated());
+
+    ASSERT_TRUE(limiter.TryAcquire());
+    limiter.Release(std::chrono::milliseconds{20}, false);
+    EXPECT_EQ(limiter.GetLimit(), 2u) << "twice the baseline is still fine";
+
+    ASSERT_TRUE(limiter.TryAcquire());
+    limiter.Release(std::chrono::milliseconds{21}, false);
+    EXPECT_EQ(limiter.GetLimit(), 1u);
+}
+
+USERVER_NAMESPACE_END
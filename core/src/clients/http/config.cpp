@@ -1,9 +1,11 @@
 #include <userver/clients/http/config.hpp>
 
+#include <stdexcept>
 #include <string_view>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -47,11 +49,58 @@ CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<Cance
     throw std::runtime_error("Invalid CancellationPolicy value: " + str);
 }
 
+ConnectionsWarmUpSettings
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<ConnectionsWarmUpSettings>) {
+    ConnectionsWarmUpSettings result;
+    result.urls = value["urls"].As<std::vector<std::string>>(result.urls);
+    result.connections_per_thread = value["connections-per-thread"].As<std::size_t>(result.connections_per_thread);
+    result.timeout = value["timeout"].As<std::chrono::milliseconds>(result.timeout);
+    result.refresh_interval = value["refresh-interval"].As<std::chrono::milliseconds>(result.refresh_interval);
+    if (result.refresh_interval.count() <= 0) {
+        throw std::runtime_error("Invalid 'refresh-interval' of connections warm-up, it must be positive");
+    }
+    return result;
+}
+
+DestinationConcurrencyLimitSettings
+Parse(const yaml_config::YamlConfig& value, formats::parse::To<DestinationConcurrencyLimitSettings>) {
+    DestinationConcurrencyLimitSettings result;
+    result.enabled = value["enabled"].As<bool>(result.enabled);
+    result.initial_limit = value["initial-limit"].As<std::size_t>(result.initial_limit);
+    result.min_limit = value["min-limit"].As<std::size_t>(result.min_limit);
+    result.max_limit = value["max-limit"].As<std::size_t>(result.max_limit);
+    result.decrease_ratio = value["decrease-ratio"].As<double>(result.decrease_ratio);
+    result.latency_percentile = value["latency-percentile"].As<double>(result.latency_percentile);
+    result.latency_ratio = value["latency-ratio"].As<double>(result.latency_ratio);
+
+    if (result.min_limit == 0 || result.min_limit > result.initial_limit || result.initial_limit > result.max_limit) {
+        throw std::runtime_error(
+            "Invalid destination concurrency limits, 0 < 'min-limit' <= 'initial-limit' <= 'max-limit' must hold"
+        );
+    }
+    if (result.decrease_ratio <= 0 || result.decrease_ratio >= 1) {
+        throw std::runtime_error("Invalid 'decrease-ratio' of destination concurrency limit, it must be in (0, 1)");
+    }
+    if (result.latency_percentile <= 0 || result.latency_percentile > 100 || result.latency_ratio < 1) {
+        throw std::runtime_error(
+            "Invalid destination concurrency limit latency settings, 'latency-percentile' must be in (0, 100] and "
+            "'latency-ratio' must be at least 1"
+        );
+    }
+    return result;
+}
+
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>) {
     ClientSettings result;
     result.thread_name_prefix = value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
     result.io_threads = value["threads"].As<size_t>(result.io_threads);
     result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+    result.warm_up = value["connections-warm-up"].As<ConnectionsWarmUpSettings>(result.warm_up);
+    result.tls_session_cache = value["tls-session-cache"].As<bool>(result.tls_session_cache);
+    result.destination_concurrency_limit =
+        value["destination-concurrency-limit"].As<DestinationConcurrencyLimitSettings>(
+            result.destination_concurrency_limit
+        );
     return result;
 }
 
@@ -7,6 +7,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 
+DestinationStatistics::DestinationStatistics(const DestinationConcurrencyLimitSettings& concurrency_limit)
+    : concurrency_limit_(concurrency_limit) {}
+
 std::shared_ptr<RequestStats> DestinationStatistics::GetStatisticsForDestination(const std::string& destination) {
     auto ptr = GetExistingStatisticsForDestination(destination);
     if (ptr) return ptr;
@@ -15,7 +18,7 @@ std::shared_ptr<RequestStats> DestinationStatistics::GetStatisticsForDestination
 }
 
 std::shared_ptr<RequestStats> DestinationStatistics::CreateStatisticsForDestination(const std::string& destination) {
-    return std::make_shared<RequestStats>(*rcu_map_[destination]);
+    return std::make_shared<RequestStats>(*rcu_map_.TryEmplace(destination, concurrency_limit_).value);
 }
 
 std::shared_ptr<RequestStats> DestinationStatistics::GetExistingStatisticsForDestination(const std::string& destination
@@ -59,6 +62,16 @@ void DestinationStatistics::SetAutoMaxSize(size_t max_auto_destinations) {
     max_auto_destinations_ = max_auto_destinations;
 }
 
+std::optional<std::chrono::milliseconds> DestinationStatistics::GetTimingsPercentile(
+    const std::string& destination,
+    double percent,
+    std::size_t min_count
+) const {
+    const auto stats = rcu_map_.Get(destination);
+    if (!stats) return std::nullopt;
+    return stats->GetTimingsPercentile(percent, min_count);
+}
+
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::begin() const { return rcu_map_.begin(); }
 
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::end() const { return rcu_map_.end(); }
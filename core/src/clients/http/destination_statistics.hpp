@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include <userver/rcu/rcu_map.hpp>
@@ -14,6 +16,10 @@ namespace clients::http {
 
 class DestinationStatistics final {
 public:
+    DestinationStatistics() = default;
+
+    explicit DestinationStatistics(const DestinationConcurrencyLimitSettings& concurrency_limit);
+
     // Return pointer to related RequestStats
     std::shared_ptr<RequestStats> GetStatisticsForDestination(const std::string& destination);
 
@@ -23,6 +29,11 @@ public:
 
     void SetAutoMaxSize(size_t max_auto_destinations);
 
+    // Returns std::nullopt for unknown destinations and for the destinations
+    // with fewer than `min_count` recent timings
+    std::optional<std::chrono::milliseconds>
+    GetTimingsPercentile(const std::string& destination, double percent, std::size_t min_count) const;
+
     using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
 
     DestinationsMap::ConstIterator begin() const;
@@ -34,6 +45,7 @@ private:
     std::shared_ptr<RequestStats> CreateStatisticsForDestination(const std::string& destination);
 
     rcu::RcuMap<std::string, Statistics> rcu_map_;
+    const DestinationConcurrencyLimitSettings concurrency_limit_{};
     size_t max_auto_destinations_{0};
     std::atomic<size_t> current_auto_destinations_{0};
 };
@@ -0,0 +1,131 @@
+#include <userver/clients/http/hedged_request.hpp>
+
+#include <algorithm>
+#include <exception>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/hedged_request.hpp>
+
+#include <clients/http/destination_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+// Percentiles of fewer timings are too noisy
+constexpr std::size_t kMinTimingsForDelay = 100;
+
+bool IsRetryableStatus(const Response& response) {
+    return static_cast<std::uint16_t>(response.status_code()) >= 500;
+}
+
+std::chrono::milliseconds
+GetHedgingDelay(const Client& client, const Request& request, const HedgingSettings& settings) {
+    auto delay = settings.delay;
+    if (!delay) {
+        delay = client.GetDestinationStatistics().GetTimingsPercentile(
+            request.GetDestinationMetricName(), settings.percentile, kMinTimingsForDelay
+        );
+    }
+    return std::max(delay.value_or(settings.default_delay), settings.min_delay);
+}
+
+class HedgingStrategy final {
+public:
+    HedgingStrategy(Client& client, const RequestSetup& setup, const HedgingSettings& settings, Request&& first)
+        : client_(&client), setup_(&setup), retry_budget_(settings.retry_budget), first_(std::move(first)) {}
+
+    std::optional<ResponseFuture> Create(std::size_t attempt) {
+        if (attempt == 0) {
+            UASSERT(first_);
+            return first_->async_perform();
+        }
+        if (retry_budget_ && !retry_budget_->CanRetry()) {
+            return std::nullopt;
+        }
+
+        auto request = client_->CreateRequest();
+        (*setup_)(request);
+        return request.async_perform();
+    }
+
+    std::optional<std::chrono::milliseconds> ProcessReply(ResponseFuture&& future) {
+        try {
+            auto response = future.Get();
+            if (IsRetryableStatus(*response)) {
+                AccountFail();
+                last_response_ = std::move(response);
+                return std::chrono::milliseconds{0};
+            }
+
+            AccountOk();
+            response_ = std::move(response);
+            return std::nullopt;
+        } catch (const std::exception&) {
+            AccountFail();
+            last_exception_ = std::current_exception();
+            return std::chrono::milliseconds{0};
+        }
+    }
+
+    std::optional<std::shared_ptr<Response>> ExtractReply() {
+        if (response_) return std::move(response_);
+        if (last_response_) return std::move(last_response_);
+        if (last_exception_) std::rethrow_exception(last_exception_);
+        return std::nullopt;
+    }
+
+    // Cancels the request in curl
+    void Finish(ResponseFuture&& future) { future.Cancel(); }
+
+private:
+    void AccountOk() noexcept {
+        if (retry_budget_) retry_budget_->AccountOk();
+    }
+
+    void AccountFail() noexcept {
+        if (retry_budget_) retry_budget_->AccountFail();
+    }
+
+    Client* client_;
+    const RequestSetup* setup_;
+    utils::RetryBudget* retry_budget_;
+    std::optional<Request> first_;
+
+    std::shared_ptr<Response> response_;
+    std::shared_ptr<Response> last_response_;
+    std::exception_ptr last_exception_;
+};
+
+}  // namespace
+
+std::shared_ptr<Response> PerformHedged(Client& client, const RequestSetup& setup, const HedgingSettings& settings) {
+    UINVARIANT(settings.max_attempts > 0, "At least one attempt is required");
+
+    auto first = client.CreateRequest();
+    setup(first);
+
+    const auto delay = GetHedgingDelay(client, first, settings);
+    const auto timeout = first.GetTimeout();
+
+    utils::hedging::HedgingSettings hedging_settings;
+    hedging_settings.max_attempts = settings.max_attempts;
+    hedging_settings.hedging_delay = delay;
+    hedging_settings.timeout_all = timeout + delay * (settings.max_attempts - 1);
+
+    auto response = utils::hedging::HedgeRequest(
+        HedgingStrategy{client, setup, settings, std::move(first)}, std::move(hedging_settings)
+    );
+    if (!response) {
+        throw TimeoutException("hedged request timed out", {});
+    }
+    return std::move(*response);
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
+#include <userver/clients/http/response_body_sink.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -241,6 +242,10 @@ std::shared_ptr<Response> Request::perform(utils::impl::SourceLocation location)
     return async_perform(location).Get();
 }
 
+utils::expected<std::shared_ptr<Response>, RequestError> Request::TryPerform(utils::impl::SourceLocation location) {
+    return ResponseFuture{pimpl_->async_try_perform(location), pimpl_}.TryGet();
+}
+
 Request& Request::url(const std::string& url) & {
     if (!IsAllowedSchemaInUrl(url)) {
         throw BadArgumentException(curl::errc::EasyErrorCode::kUnsupportedProtocol, "Bad URL", url, {});
@@ -337,6 +342,7 @@ Request& Request::connect_to(const ConnectTo& connect_to) & {
 Request Request::connect_to(const ConnectTo& connect_to) && { return std::move(this->connect_to(connect_to)); }
 
 Request& Request::data(std::string data) & {
+    pimpl_->ResetBodyStream();
     if (!data.empty()) pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
     pimpl_->easy().set_post_fields(std::move(data));
     return *this;
@@ -344,12 +350,31 @@ Request& Request::data(std::string data) & {
 Request Request::data(std::string data) && { return std::move(this->data(std::move(data))); }
 
 Request& Request::form(Form&& form) & {
+    pimpl_->ResetBodyStream();
     pimpl_->easy().set_http_post(std::move(form).GetNative());
     pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
     return *this;
 }
 Request Request::form(Form&& form) && { return std::move(this->form(std::move(form))); }
 
+Request& Request::data_stream(std::shared_ptr<concurrent::StringStreamQueue> queue, std::optional<std::size_t> size) & {
+    UINVARIANT(queue, "Queue should not be null");
+    pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
+    pimpl_->body_stream(std::move(queue), size);
+    return *this;
+}
+Request Request::data_stream(std::shared_ptr<concurrent::StringStreamQueue> queue, std::optional<std::size_t> size) && {
+    return std::move(this->data_stream(std::move(queue), size));
+}
+
+Request& Request::body_sink(std::shared_ptr<ResponseBodySink> sink) & {
+    pimpl_->body_sink(std::move(sink));
+    return *this;
+}
+Request Request::body_sink(std::shared_ptr<ResponseBodySink> sink) && {
+    return std::move(this->body_sink(std::move(sink)));
+}
+
 Request& Request::headers(const Headers& headers) & {
     SetHeaders(pimpl_->easy(), headers);
     return *this;
@@ -440,7 +465,7 @@ Request& Request::method(HttpMethod method) & {
         case HttpMethod::kPatch:
             pimpl_->easy().set_custom_request(ToString(method));
             // ensure a body as we should send Content-Length for this method
-            if (!pimpl_->easy().has_post_data()) data({});
+            if (!pimpl_->easy().has_post_data() && !pimpl_->HasBodyStream()) data({});
             break;
     };
     return *this;
@@ -555,6 +580,10 @@ Request Request::SetTracingManager(const tracing::TracingManagerBase& tracing_ma
 
 const std::string& Request::GetUrl() const& { return pimpl_->easy().get_original_url(); }
 
+std::chrono::milliseconds Request::GetTimeout() const { return std::chrono::milliseconds{pimpl_->timeout()}; }
+
+const std::string& Request::GetDestinationMetricName() const& { return pimpl_->GetDestinationMetricName(); }
+
 const std::string& Request::GetData() const& { return pimpl_->easy().get_post_data(); }
 
 std::string Request::ExtractData() { return pimpl_->easy().extract_post_data(); }
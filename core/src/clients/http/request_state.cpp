@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <map>
 #include <string_view>
 
@@ -16,6 +17,7 @@
 
 #include <curl-ev/error_code.hpp>
 #include <userver/baggage/baggage.hpp>
+#include <userver/baggage/lazy_baggage.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
@@ -44,6 +46,9 @@ constexpr long kMaxRedirectCount = 10;
 constexpr int kEBMaxPower = 5;
 /// Base time for exponential backoff algorithm
 constexpr auto kEBBaseTime = std::chrono::milliseconds{25};
+
+/// Delay before checking the streamed request body queue again
+constexpr auto kBodyStreamPollInterval = std::chrono::milliseconds{1};
 /// Least http code that we treat as bad for exponential backoff algorithm
 constexpr Status kLeastBadHttpCodeForEB{500};
 /// Least http code the the downstream service can use to report propagated
@@ -103,7 +108,7 @@ char* rfind_not_space(char* ptr, size_t size) {
 
 // TODO: very low-level, do it in another place
 void SetBaggageHeader(curl::easy& e) {
-    const auto* baggage = baggage::kInheritedBaggage.GetOptional();
+    const auto* baggage = baggage::TryGetInheritedBaggage();
     if (baggage != nullptr) {
         LOG_DEBUG() << fmt::format("Send baggage: {}", baggage->ToString());
         e.add_header(
@@ -456,6 +461,7 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     }
 
     holder->AccountResponse(err);
+    holder->ReleaseConcurrency(err, status_code);
     const auto sockets = easy.get_num_connects();
     holder->WithRequestStats([sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
 
@@ -485,7 +491,12 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
                 { [[maybe_unused]] const auto cleanup = holder->response_move(); }
                 auto promise = std::move(buffered_data.promise_);
                 // The task will wake up and may reuse RequestState.
-                promise.set_exception(holder->PrepareException(err));
+                if (buffered_data.errors_as_values) {
+                    holder->last_error_ = holder->PrepareError(err);
+                    promise.set_value(nullptr);
+                } else {
+                    promise.set_exception(holder->PrepareException(err));
+                }
             },
             [](StreamData& stream_data) {
                 auto producer = std::move(stream_data.queue_producer);
@@ -532,7 +543,9 @@ void RequestState::on_retry(std::shared_ptr<RequestState> holder, std::error_cod
     // - if this request was cancelled
     const bool not_need_retry = (!err && !holder->ShouldRetryResponse()) ||
                                 (holder->retry_.current >= holder->retry_.retries) ||
-                                (err && !holder->retry_.on_fails) || holder->is_cancelled_.load();
+                                (err && !holder->retry_.on_fails) || holder->is_cancelled_.load() ||
+                                // the streamed body could not be sent again
+                                holder->body_stream_ || holder->body_sink_;
 
     if (not_need_retry) {
         // finish if no need to retry
@@ -592,6 +605,7 @@ void RequestState::parse_header(char* ptr, size_t size) try {
     if (ptr == end) {
         const auto status_code = static_cast<Status>(easy().get_response_code());
         response()->SetStatusCode(status_code);
+        AccountTlsHandshake();
         return;
     }
     *end = '\0';
@@ -628,6 +642,19 @@ void RequestState::parse_header(char* ptr, size_t size) try {
     LOG_ERROR() << "Failed to parse header: " << e.what();
 }
 
+void RequestState::AccountTlsHandshake() {
+    // The connection is still attached to the easy handle only while the
+    // response is being received
+    if (tls_handshake_accounted_ || easy().get_num_connects() == 0) return;
+
+    auto* ssl = static_cast<SSL*>(easy().get_openssl_ssl_ptr());
+    if (!ssl) return;
+
+    tls_handshake_accounted_ = true;
+    const bool resumed = SSL_session_reused(ssl) == 1;
+    WithRequestStats([resumed](RequestStats& stats) { stats.AccountTlsHandshake(resumed); });
+}
+
 void RequestState::SetLoggedUrl(std::string url) { log_url_ = std::move(url); }
 
 const std::string& RequestState::GetLoggedOriginalUrl() const noexcept {
@@ -642,7 +669,16 @@ std::string_view RequestState::GetLoggedEffectiveUrl() noexcept {
 }
 
 engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::impl::SourceLocation location) {
-    data_.emplace<FullBufferedData>();
+    return DoAsyncPerform(location, false);
+}
+
+engine::Future<std::shared_ptr<Response>> RequestState::async_try_perform(utils::impl::SourceLocation location) {
+    return DoAsyncPerform(location, true);
+}
+
+engine::Future<std::shared_ptr<Response>>
+RequestState::DoAsyncPerform(utils::impl::SourceLocation location, bool errors_as_values) {
+    data_.emplace<FullBufferedData>().errors_as_values = errors_as_values;
 
     StartNewSpan(location);
     ResetDataForNewRequest();
@@ -650,12 +686,17 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
     auto& span = span_storage_->Get();
     span.AddTag("stream_api", 0);
 
-    // set place for response body
-    easy().set_sink(&response_->sink_string());
+    if (body_sink_) {
+        easy().set_write_function(&RequestState::SinkWriteFunction);
+        easy().set_write_data(this);
+    } else {
+        // set place for response body
+        easy().set_sink(&response_->sink_string());
+    }
 
     auto future = std::get_if<FullBufferedData>(&data_)->promise_.get_future();
 
-    if (UpdateTimeoutFromDeadlineAndCheck()) {
+    if (UpdateTimeoutFromDeadlineAndCheck() && AcquireConcurrency()) {
         perform_request([holder = shared_from_this()](std::error_code err) mutable {
             RequestState::on_retry(std::move(holder), err);
         });
@@ -666,6 +707,9 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
 
 engine::Future<void>
 RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue, utils::impl::SourceLocation location) {
+    // The transfer is paused until a whole received chunk fits into the queue,
+    // a smaller queue would never accept it
+    if (queue->GetSoftMaxSize() < CURL_MAX_WRITE_SIZE) queue->SetSoftMaxSize(CURL_MAX_WRITE_SIZE);
     data_.emplace<StreamData>(queue->GetProducer());
 
     StartNewSpan(location);
@@ -681,7 +725,7 @@ RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue, utils::i
 
     auto future = std::get_if<StreamData>(&data_)->headers_promise.get_future();
 
-    if (UpdateTimeoutFromDeadlineAndCheck()) {
+    if (UpdateTimeoutFromDeadlineAndCheck() && AcquireConcurrency()) {
         perform_request([holder = shared_from_this()](std::error_code err) mutable {
             RequestState::on_completed(std::move(holder), err);
         });
@@ -698,6 +742,7 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
     response_->body().clear();
 
     UpdateTimeoutHeader();
+    tls_handshake_accounted_ = false;
 
     plugin_pipeline_.HookPerformRequest(*this);
 
@@ -707,12 +752,14 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
                 ResolveTargetAddress(*resolver_);
                 easy().async_perform(std::move(handler));
             } catch (const clients::dns::ResolverException& ex) {
+                if (dest_req_stats_) dest_req_stats_->ReleaseConcurrency();
                 // TODO: should retry - TAXICOMMON-4932
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
                 if (buffered_data) {
                     buffered_data->promise_.set_exception(std::current_exception());
                 }
             } catch (const BaseException& ex) {
+                if (dest_req_stats_) dest_req_stats_->ReleaseConcurrency();
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
                 if (buffered_data) {
                     buffered_data->promise_.set_exception(std::current_exception());
@@ -782,19 +829,58 @@ void RequestState::HandleDeadlineAlreadyPassed() {
 
     WithRequestStats([](RequestStats& stats) { stats.AccountCancelledByDeadline(); });
 
-    auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(), easy().get_local_stats());
+    const auto stats = easy().get_local_stats();
+    FailBeforePerform(
+        RequestError{ErrorKind::kDeadlinePropagation, curl::errc::EasyErrorCode::kOperationTimedout, stats},
+        [this, &stats] { return PrepareDeadlinePassedException(GetLoggedOriginalUrl(), stats); }
+    );
+}
+
+bool RequestState::AcquireConcurrency() {
+    if (!dest_req_stats_ || dest_req_stats_->TryAcquireConcurrency()) return true;
+
+    auto& span = span_storage_->Get();
+    span.AddTag(tracing::kAttempts, 0);
+    span.AddTag(tracing::kErrorFlag, true);
+    span.AddTag("concurrency_limited", 1);
+
+    const std::error_code ec{curl::errc::RateLimitErrorCode::kDestinationConcurrencyLimit};
+    FailBeforePerform(RequestError{ErrorKind::kNetwork, ec, LocalStats{}}, [this, &ec] {
+        return http::PrepareException(ec, GetLoggedOriginalUrl(), LocalStats{});
+    });
+    return false;
+}
+
+void RequestState::ReleaseConcurrency(std::error_code err, Status status_code) {
+    if (!dest_req_stats_) return;
 
+    // Running out of our own deadline says nothing about the destination
+    const bool overloaded = !deadline_expired_ &&
+                            (err == curl::errc::EasyErrorCode::kOperationTimedout ||
+                             status_code == Status::kTooManyRequests || status_code == Status::kServiceUnavailable);
+    const auto attempt_time =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::microseconds{easy().get_total_time_usec()});
+    dest_req_stats_->ReleaseConcurrency(attempt_time, overloaded);
+}
+
+template <typename ExceptionFactory>
+void RequestState::FailBeforePerform(RequestError&& error, const ExceptionFactory& make_exception) {
     const utils::Overloaded visitor{
-        [&exc](FullBufferedData& buffered_data) {
+        [this, &error, &make_exception](FullBufferedData& buffered_data) {
             auto promise = std::move(buffered_data.promise_);
             // The task will wake up and may reuse RequestState.
-            promise.set_exception(std::move(exc));
+            if (buffered_data.errors_as_values) {
+                last_error_ = std::move(error);
+                promise.set_value(nullptr);
+            } else {
+                promise.set_exception(make_exception());
+            }
         },
-        [&exc](StreamData& stream_data) {
+        [&make_exception](StreamData& stream_data) {
             if (!stream_data.headers_promise_set.exchange(true)) {
                 auto promise = std::move(stream_data.headers_promise);
                 // The task will wake up and may reuse RequestState.
-                promise.set_exception(std::move(exc));
+                promise.set_exception(make_exception());
             }
         }};
     std::visit(visitor, data_);
@@ -871,6 +957,18 @@ std::exception_ptr RequestState::PrepareException(std::error_code err) {
     return http::PrepareException(err, GetLoggedEffectiveUrl(), easy().get_local_stats());
 }
 
+RequestError RequestState::PrepareError(std::error_code err) {
+    if (deadline_expired_) {
+        return {ErrorKind::kDeadlinePropagation, err, easy().get_local_stats()};
+    }
+
+    const auto kind =
+        err == curl::errc::EasyErrorCode::kOperationTimedout ? ErrorKind::kTimeout : ErrorKind::kNetwork;
+    return {kind, err, easy().get_local_stats()};
+}
+
+const RequestError& RequestState::GetLastError() const noexcept { return last_error_; }
+
 void RequestState::ThrowDeadlineExpiredException() {
     // This method may be called in parallel with request handling, fetching
     // effective_url_ or local stats is unsafe.
@@ -931,13 +1029,119 @@ size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb, v
         return actual_size;
     }
 
-    LOG_DEBUG() << "There are some alive consumers";
-
-    UINVARIANT(false, "not implemented CURL_WRITEFUNC_PAUSE TAXICOMMON-5611");
+    // The flag is set before the second attempt, so that the consumer either
+    // sees it after freeing the space or we succeed in pushing
+    stream_data->paused = true;
+    if (queue_producer.PushNoblock(std::string(ptr, actual_size))) {
+        // A concurrent ResumeStreamedResponse() is harmless
+        return actual_size;
+    }
 
+    LOG_DEBUG() << "The queue is full, pausing the transfer";
     return CURL_WRITEFUNC_PAUSE;
 }
 
+size_t RequestState::SinkWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata) {
+    const size_t actual_size = size * nmemb;
+    RequestState& rs = *static_cast<RequestState*>(userdata);
+    UASSERT(rs.body_sink_);
+
+    try {
+        if (rs.body_sink_->Write({ptr, actual_size})) return actual_size;
+        LOG_DEBUG() << "Response body sink has rejected the data"
+                    << tracing::impl::LogSpanAsLastNoCurrent{rs.span_storage_->Get()};
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Response body sink has failed: " << ex
+                      << tracing::impl::LogSpanAsLastNoCurrent{rs.span_storage_->Get()};
+    }
+
+    // Anything but actual_size fails the request with CURLE_WRITE_ERROR
+    return 0;
+}
+
+size_t RequestState::BodyStreamReadFunction(void* ptr, size_t size, size_t nmemb, void* userdata) {
+    const size_t buffer_size = size * nmemb;
+    RequestState& rs = *static_cast<RequestState*>(userdata);
+    UASSERT(rs.body_stream_);
+    auto& stream = *rs.body_stream_;
+
+    while (stream.offset == stream.chunk.size()) {
+        stream.chunk.clear();
+        stream.offset = 0;
+        if (stream.consumer.PopNoblock(stream.chunk)) continue;
+
+        if (stream.consumer.Queue()->NoMoreProducers()) {
+            // The producer may have pushed the last chunk right before leaving
+            if (stream.consumer.PopNoblock(stream.chunk)) continue;
+            return 0;  // end of the body
+        }
+
+        // Curl can not wait for the producer, so the transfer is paused and
+        // resumed a bit later to check the queue again
+        if (!stream.resume_timer) stream.resume_timer.emplace(rs.easy().GetThreadControl());
+        stream.resume_timer->SingleshotAsync(kBodyStreamPollInterval, [holder = rs.shared_from_this()](std::error_code err) {
+            if (!err) holder->easy().unpause();
+        });
+        return CURL_READFUNC_PAUSE;
+    }
+
+    const auto bytes = std::min(buffer_size, stream.chunk.size() - stream.offset);
+    std::memcpy(ptr, stream.chunk.data() + stream.offset, bytes);
+    stream.offset += bytes;
+    return bytes;
+}
+
+void RequestState::body_stream(std::shared_ptr<Queue> queue, std::optional<std::size_t> size) {
+    body_stream_.emplace(queue->GetConsumer());
+
+    // Drop the buffered body, curl reads the body with the read function if
+    // CURLOPT_POSTFIELDS is null
+    [[maybe_unused]] const auto old_data = easy().extract_post_data();
+    easy().set_post(true);
+    easy().set_post_fields(static_cast<void*>(nullptr));
+    easy().set_read_function(&RequestState::BodyStreamReadFunction);
+    easy().set_read_data(this);
+
+    if (size) {
+        easy().set_post_field_size_large(static_cast<curl::native::curl_off_t>(*size));
+        easy().add_header(
+            USERVER_NAMESPACE::http::headers::kTransferEncoding,
+            "",
+            curl::easy::EmptyHeaderAction::kDoNotSend,
+            curl::easy::DuplicateHeaderAction::kReplace
+        );
+    } else {
+        easy().set_post_field_size_large(-1);
+        easy().add_header(
+            USERVER_NAMESPACE::http::headers::kTransferEncoding,
+            "chunked",
+            curl::easy::EmptyHeaderAction::kSend,
+            curl::easy::DuplicateHeaderAction::kReplace
+        );
+    }
+}
+
+void RequestState::ResetBodyStream() {
+    if (!body_stream_) return;
+
+    body_stream_.reset();
+    easy().add_header(
+        USERVER_NAMESPACE::http::headers::kTransferEncoding,
+        "",
+        curl::easy::EmptyHeaderAction::kDoNotSend,
+        curl::easy::DuplicateHeaderAction::kReplace
+    );
+}
+
+void RequestState::body_sink(std::shared_ptr<ResponseBodySink> sink) { body_sink_ = std::move(sink); }
+
+void RequestState::ResumeStreamedResponse() {
+    auto* stream_data = std::get_if<StreamData>(&data_);
+    if (!stream_data || !stream_data->paused.exchange(false)) return;
+
+    easy().GetThreadControl().RunInEvLoopAsync([holder = shared_from_this()] { holder->easy().unpause(); });
+}
+
 void RequestState::ApplyTestsuiteConfig() {
     if (!testsuite_config_) {
         return;
@@ -12,6 +12,7 @@
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/response_body_sink.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/crypto/certificate.hpp>
@@ -58,6 +59,12 @@ public:
         utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
     );
 
+    /// Perform async http request, the errors are reported by the nullptr
+    /// response and GetLastError() instead of the exceptions
+    engine::Future<std::shared_ptr<Response>> async_try_perform(
+        utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
+    );
+
     /// Perform streaming http request, returns headers future
     engine::Future<void> async_perform_stream(
         const std::shared_ptr<Queue>& queue,
@@ -92,6 +99,13 @@ public:
     void proxy_auth_type(curl::easy::proxyauth_t value);
     /// sets proxy auth type and credentials to use
     void http_auth_type(curl::easy::httpauth_t value, bool auth_only, std::string_view user, std::string_view password);
+    /// read the request body from the queue while sending the request
+    void body_stream(std::shared_ptr<Queue> queue, std::optional<std::size_t> size);
+    /// drop the body stream set by body_stream(), if any
+    void ResetBodyStream();
+    bool HasBodyStream() const noexcept { return body_stream_.has_value(); }
+    /// pass the response body to the sink instead of the Response
+    void body_sink(std::shared_ptr<ResponseBodySink> sink);
 
     /// get timeout value in milliseconds
     long timeout() const { return original_timeout_.count(); }
@@ -104,6 +118,9 @@ public:
 
     [[noreturn]] void ThrowDeadlineExpiredException();
 
+    /// The error of the last request performed by async_try_perform()
+    const RequestError& GetLastError() const noexcept;
+
     /// cancel request
     void Cancel();
 
@@ -111,6 +128,8 @@ public:
 
     void SetDestinationMetricName(const std::string& destination);
 
+    const std::string& GetDestinationMetricName() const noexcept { return destination_metric_name_; }
+
     void SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& config);
 
     void SetAllowedUrlsExtra(const std::vector<std::string>& urls);
@@ -123,6 +142,10 @@ public:
 
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config);
 
+    /// resume receiving of the streamed response body if it was paused
+    /// because of the full queue
+    void ResumeStreamedResponse();
+
     curl::easy& easy() { return easy_.Easy(); }
     const curl::easy& easy() const { return easy_.Easy(); }
     std::shared_ptr<Response> response() const { return response_; }
@@ -149,6 +172,8 @@ private:
     /// parse one header
     void parse_header(char* ptr, size_t size);
     void ParseSingleCookie(const char* ptr, size_t size);
+    /// account the TLS handshake of a new connection, if any
+    void AccountTlsHandshake();
     /// simply run perform_request if there is now errors from timer
     void on_retry_timer(std::error_code err);
     /// run curl async_request, called once per attempt
@@ -158,6 +183,14 @@ private:
     [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(std::chrono::milliseconds backoff = {});
     void UpdateTimeoutHeader();
     void HandleDeadlineAlreadyPassed();
+    [[nodiscard]] bool AcquireConcurrency();
+    void ReleaseConcurrency(std::error_code err, Status status_code);
+    template <typename ExceptionFactory>
+    void FailBeforePerform(RequestError&& error, const ExceptionFactory& make_exception);
+    engine::Future<std::shared_ptr<Response>> DoAsyncPerform(
+        utils::impl::SourceLocation location,
+        bool errors_as_values
+    );
     void CheckResponseDeadline(std::error_code& err, Status status_code);
     bool IsDeadlineExpiredResponse(Status status_code);
     bool ShouldRetryResponse();
@@ -166,9 +199,12 @@ private:
     std::string_view GetLoggedEffectiveUrl() noexcept;
 
     static size_t StreamWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata);
+    static size_t SinkWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata);
+    static size_t BodyStreamReadFunction(void* ptr, size_t size, size_t nmemb, void* userdata);
 
     void AccountResponse(std::error_code err);
     std::exception_ptr PrepareException(std::error_code err);
+    RequestError PrepareError(std::error_code err);
 
     void ResetDataForNewRequest();
     void ApplyTestsuiteConfig();
@@ -209,6 +245,7 @@ private:
     engine::Deadline deadline_;
     bool timeout_updated_by_deadline_{false};
     bool deadline_expired_{false};
+    bool tls_handshake_accounted_{false};
 
     utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
     /// struct for reties
@@ -239,13 +276,32 @@ private:
         Queue::Producer queue_producer;
         std::atomic<bool> headers_promise_set{false};
         engine::Promise<void> headers_promise;
+        // the transfer is paused until the consumer frees some queue space
+        std::atomic<bool> paused{false};
     };
 
+    struct BodyStream {
+        explicit BodyStream(Queue::Consumer&& consumer) : consumer(std::move(consumer)) {}
+
+        Queue::Consumer consumer;
+        // the chunk that is being sent
+        std::string chunk;
+        std::size_t offset{0};
+        // resumes the transfer paused waiting for the producer
+        std::optional<engine::ev::TimerWatcher> resume_timer;
+    };
+
+    std::optional<BodyStream> body_stream_;
+    std::shared_ptr<ResponseBodySink> body_sink_;
+
     struct FullBufferedData {
         engine::Promise<std::shared_ptr<Response>> promise_;
+        // The errors are reported by the nullptr response and last_error_
+        bool errors_as_values{false};
     };
 
     std::variant<FullBufferedData, StreamData> data_;
+    RequestError last_error_;
 };
 
 }  // namespace clients::http
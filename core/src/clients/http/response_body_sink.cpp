@@ -0,0 +1,27 @@
+#include <userver/clients/http/response_body_sink.hpp>
+
+#include <cstring>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+ResponseBodySink::~ResponseBodySink() = default;
+
+BufferResponseBodySink::BufferResponseBodySink(utils::span<char> buffer) noexcept : buffer_(buffer) {}
+
+bool BufferResponseBodySink::Write(std::string_view chunk) {
+    if (chunk.size() > buffer_.size() - size_) return false;
+
+    std::memcpy(buffer_.data() + size_, chunk.data(), chunk.size());
+    size_ += chunk.size();
+    return true;
+}
+
+std::string_view BufferResponseBodySink::GetBody() const noexcept { return {buffer_.data(), size_}; }
+
+void BufferResponseBodySink::Reset() noexcept { size_ = 0; }
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
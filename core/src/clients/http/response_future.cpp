@@ -3,6 +3,8 @@
 #include <algorithm>
 
 #include <clients/http/request_state.hpp>
+#include <curl-ev/error_code.hpp>
+#include <userver/clients/dns/exception.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
@@ -136,6 +138,62 @@ std::shared_ptr<Response> ResponseFuture::Get() {
     throw TimeoutException("Future timeout", {});  // no local stats available
 }
 
+utils::expected<std::shared_ptr<Response>, RequestError> ResponseFuture::TryGet() {
+    const std::error_code timeout_error{curl::errc::EasyErrorCode::kOperationTimedout};
+
+    switch (future_.wait_until(deadline_)) {
+        case engine::FutureStatus::kCancelled: {
+            RequestError error{
+                ErrorKind::kCancel,
+                std::make_error_code(std::errc::operation_canceled),
+                request_state_->easy().get_local_stats()};
+
+            // request_ has armed timers to retry the request. Stopping those ASAP.
+            CancelOrDetach();
+            return utils::unexpected{std::move(error)};
+        }
+        case engine::FutureStatus::kTimeout:
+            if (was_deadline_propagated_) {
+                server::request::MarkTaskInheritedDeadlineExpired();
+
+                // We allow the physical HTTP request to complete in the background to
+                // avoid closing the connection.
+                Detach();
+                return utils::unexpected{RequestError{ErrorKind::kDeadlinePropagation, timeout_error, {}}};
+            }
+            return utils::unexpected{RequestError{ErrorKind::kTimeout, timeout_error, {}}};
+        case engine::FutureStatus::kReady:
+            break;
+    }
+
+    if (request_state_->IsDeadlineExpired()) {
+        server::request::MarkTaskInheritedDeadlineExpired();
+    }
+
+    std::shared_ptr<Response> response;
+    try {
+        response = future_.get();
+    } catch (const BaseCodeException& ex) {
+        Detach();
+        return utils::unexpected{RequestError{ex.GetErrorKind(), ex.error_code(), ex.GetStats()}};
+    } catch (const BaseException& ex) {
+        Detach();
+        return utils::unexpected{RequestError{ex.GetErrorKind(), {}, ex.GetStats()}};
+    } catch (const clients::dns::ResolverException&) {
+        Detach();
+        return utils::unexpected{
+            RequestError{ErrorKind::kNetwork, curl::errc::EasyErrorCode::kCouldNotResolveHost, {}}};
+    }
+
+    if (!response) {
+        auto error = request_state_->GetLastError();
+        Detach();
+        return utils::unexpected{std::move(error)};
+    }
+    Detach();
+    return response;
+}
+
 engine::impl::ContextAccessor* ResponseFuture::TryGetContextAccessor() noexcept {
     return future_.TryGetContextAccessor();
 }
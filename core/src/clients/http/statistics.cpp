@@ -22,6 +22,8 @@ T SumToMean(T sum, U count) {
     return sum / static_cast<T>(count);
 }
 
+constexpr std::size_t kConcurrencyBaselineMinTimings = 100;
+
 }  // namespace
 
 RequestStats::RequestStats(Statistics& stats) : stats_(&stats) { stats_->easy_handles_++; }
@@ -29,10 +31,14 @@ RequestStats::RequestStats(Statistics& stats) : stats_(&stats) { stats_->easy_ha
 RequestStats::~RequestStats() {
     if (stats_) {
         stats_->easy_handles_--;
+        if (concurrency_acquired_) stats_->concurrency_limiter_.Release();
     }
 }
 
-RequestStats::RequestStats(RequestStats&& other) noexcept : stats_{std::exchange(other.stats_, nullptr)} {}
+RequestStats::RequestStats(RequestStats&& other) noexcept
+    : stats_{std::exchange(other.stats_, nullptr)},
+      start_time_{other.start_time_},
+      concurrency_acquired_{std::exchange(other.concurrency_acquired_, false)} {}
 
 void RequestStats::Start() { start_time_ = std::chrono::steady_clock::now(); }
 
@@ -70,6 +76,20 @@ void RequestStats::StoreTimeToStart(std::chrono::microseconds micro_seconds) noe
 void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
     UASSERT(stats_);
     stats_->socket_open_ += utils::statistics::Rate{sockets};
+    if (sockets == 0) {
+        ++stats_->connection_pool_hits_;
+    } else {
+        ++stats_->connection_pool_misses_;
+    }
+}
+
+void RequestStats::AccountTlsHandshake(bool resumed) noexcept {
+    UASSERT(stats_);
+    if (resumed) {
+        ++stats_->tls_handshakes_resumed_;
+    } else {
+        ++stats_->tls_handshakes_full_;
+    }
 }
 
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
@@ -82,6 +102,36 @@ void RequestStats::AccountCancelledByDeadline() noexcept {
     ++stats_->cancelled_by_deadline_;
 }
 
+bool RequestStats::TryAcquireConcurrency() noexcept {
+    UASSERT(stats_);
+    if (concurrency_acquired_) return true;
+    concurrency_acquired_ = stats_->concurrency_limiter_.TryAcquire();
+    return concurrency_acquired_;
+}
+
+void RequestStats::ReleaseConcurrency() noexcept {
+    UASSERT(stats_);
+    if (!std::exchange(concurrency_acquired_, false)) return;
+    stats_->concurrency_limiter_.Release();
+}
+
+void RequestStats::ReleaseConcurrency(std::chrono::milliseconds latency, bool overloaded) noexcept {
+    UASSERT(stats_);
+    if (!std::exchange(concurrency_acquired_, false)) return;
+
+    auto& limiter = stats_->concurrency_limiter_;
+    if (limiter.IsBaselineOutdated()) {
+        // Percentiles of the recent period are too heavy to compute per request
+        limiter.SetBaseline(stats_->GetTimingsPercentile(
+            limiter.GetSettings().latency_percentile, kConcurrencyBaselineMinTimings
+        ));
+    }
+    limiter.Release(latency, overloaded);
+}
+
+Statistics::Statistics(const DestinationConcurrencyLimitSettings& concurrency_limit)
+    : concurrency_limiter_(concurrency_limit) {}
+
 Statistics::ErrorGroup Statistics::ErrorCodeToGroup(std::error_code ec) {
     using ErrorCode = curl::errc::EasyErrorCode;
 
@@ -149,6 +199,13 @@ void Statistics::AccountError(ErrorGroup error) { ++error_count_[static_cast<int
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+std::optional<std::chrono::milliseconds> Statistics::GetTimingsPercentile(double percent, std::size_t min_count)
+    const {
+    const auto timings = timings_percentile_.GetStatsForPeriod();
+    if (timings.Count() < min_count) return std::nullopt;
+    return std::chrono::milliseconds{timings.GetPercentile(percent)};
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsView& view) {
     const auto& stats = view.stats;
 
@@ -168,6 +225,18 @@ void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsVi
     writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
     writer["sockets"]["open"] = stats.multi.socket_open;
+
+    writer["connection-pool"]["hit"] = stats.connection_pool_hits;
+    writer["connection-pool"]["miss"] = stats.connection_pool_misses;
+
+    writer["tls-handshakes"]["full"] = stats.tls_handshakes_full;
+    writer["tls-handshakes"]["resumed"] = stats.tls_handshakes_resumed;
+
+    if (stats.concurrency_limit_enabled) {
+        writer["concurrency-limit"]["current"] = stats.concurrency_limit;
+        writer["concurrency-limit"]["in-flight"] = stats.concurrency_in_flight;
+        writer["concurrency-limit"]["rejected"] = stats.concurrency_limit_rejected;
+    }
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats) {
@@ -200,9 +269,17 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       last_time_to_start_us(other.last_time_to_start_us_.load()),
       timings_percentile(other.timings_percentile_.GetStatsForPeriod()),
       retries(other.retries_.Load()),
+      connection_pool_hits(other.connection_pool_hits_.Load()),
+      connection_pool_misses(other.connection_pool_misses_.Load()),
+      tls_handshakes_full(other.tls_handshakes_full_.Load()),
+      tls_handshakes_resumed(other.tls_handshakes_resumed_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
-      reply_status(other.reply_status_) {
+      reply_status(other.reply_status_),
+      concurrency_limit_enabled(other.concurrency_limiter_.IsEnabled()),
+      concurrency_limit(other.concurrency_limiter_.GetLimit()),
+      concurrency_in_flight(other.concurrency_limiter_.GetInFlight()),
+      concurrency_limit_rejected(other.concurrency_limiter_.GetRejected()) {
     for (size_t i = 0; i < error_count.size(); i++) error_count[i] = other.error_count_[i].Load();
     multi.socket_open = other.socket_open_.Load();
 }
@@ -231,6 +308,10 @@ InstanceStatistics& InstanceStatistics::operator+=(const InstanceStatistics& sta
         error_count[i] += stat.error_count[i];
     }
     retries += stat.retries;
+    connection_pool_hits += stat.connection_pool_hits;
+    connection_pool_misses += stat.connection_pool_misses;
+    tls_handshakes_full += stat.tls_handshakes_full;
+    tls_handshakes_resumed += stat.tls_handshakes_resumed;
 
     timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
     cancelled_by_deadline += stat.cancelled_by_deadline;
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -13,6 +14,8 @@
 #include <userver/utils/statistics/writer.hpp>
 #include <utils/statistics/http_codes.hpp>
 
+#include <clients/http/concurrency_limiter.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
@@ -38,14 +41,25 @@ public:
 
     void AccountOpenSockets(size_t sockets) noexcept;
 
+    void AccountTlsHandshake(bool resumed) noexcept;
+
     void AccountTimeoutUpdatedByDeadline() noexcept;
     void AccountCancelledByDeadline() noexcept;
 
+    // Takes a slot of the destination concurrency limit, returns false if the
+    // limit is reached. Does nothing if the slot is already taken.
+    bool TryAcquireConcurrency() noexcept;
+    // Gives back the slot of a request that was not sent
+    void ReleaseConcurrency() noexcept;
+    // Gives back the slot and adjusts the limit by the outcome of the request
+    void ReleaseConcurrency(std::chrono::milliseconds latency, bool overloaded) noexcept;
+
 private:
     void StoreTiming() noexcept;
 
     Statistics* stats_;
     std::chrono::steady_clock::time_point start_time_;
+    bool concurrency_acquired_{false};
 };
 
 struct MultiStats {
@@ -73,6 +87,8 @@ class Statistics {
 public:
     Statistics() = default;
 
+    explicit Statistics(const DestinationConcurrencyLimitSettings& concurrency_limit);
+
     RequestStats CreateRequestStats() { return RequestStats{*this}; }
 
     enum class ErrorGroup {
@@ -96,6 +112,9 @@ public:
 
     void AccountStatus(int);
 
+    // Returns std::nullopt if there are fewer than `min_count` recent timings
+    std::optional<std::chrono::milliseconds> GetTimingsPercentile(double percent, std::size_t min_count) const;
+
 private:
     std::atomic<uint64_t> easy_handles_{0};
     std::atomic<uint64_t> last_time_to_start_us_{0};
@@ -103,9 +122,15 @@ private:
     std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
     utils::statistics::RateCounter retries_;
     utils::statistics::RateCounter socket_open_{0};
+    // Requests that reused a pooled connection and that opened a new one
+    utils::statistics::RateCounter connection_pool_hits_;
+    utils::statistics::RateCounter connection_pool_misses_;
+    utils::statistics::RateCounter tls_handshakes_full_;
+    utils::statistics::RateCounter tls_handshakes_resumed_;
     utils::statistics::RateCounter timeout_updated_by_deadline_;
     utils::statistics::RateCounter cancelled_by_deadline_;
     utils::statistics::HttpCodes reply_status_;
+    ConcurrencyLimiter concurrency_limiter_;
 
     friend struct InstanceStatistics;
     friend class RequestStats;
@@ -130,10 +155,23 @@ struct InstanceStatistics {
     std::array<utils::statistics::Rate, Statistics::kErrorGroupCount> error_count;
     utils::statistics::Rate retries{0};
 
+    utils::statistics::Rate connection_pool_hits;
+    utils::statistics::Rate connection_pool_misses;
+
+    utils::statistics::Rate tls_handshakes_full;
+    utils::statistics::Rate tls_handshakes_resumed;
+
     utils::statistics::Rate timeout_updated_by_deadline;
     utils::statistics::Rate cancelled_by_deadline;
     utils::statistics::HttpCodes::Snapshot reply_status;
 
+    // Only the destination statistics have the concurrency limit, they are
+    // never summed up
+    bool concurrency_limit_enabled{false};
+    std::size_t concurrency_limit{0};
+    std::size_t concurrency_in_flight{0};
+    utils::statistics::Rate concurrency_limit_rejected;
+
     MultiStats multi;
 };
 
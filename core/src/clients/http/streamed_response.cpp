@@ -78,7 +78,10 @@ const Response::CookiesMap& StreamedResponse::GetCookies() {
 bool StreamedResponse::ReadChunk(std::string& output, engine::Deadline deadline) {
     WaitForHeadersOrThrow(deadline_);
 
-    return queue_consumer_.Pop(output, deadline);
+    if (!queue_consumer_.Pop(output, deadline)) return false;
+
+    request_state_->ResumeStreamedResponse();
+    return true;
 }
 
 }  // namespace clients::http
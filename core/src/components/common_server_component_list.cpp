@@ -11,6 +11,7 @@
 #include <userver/server/handlers/log_level.hpp>
 #include <userver/server/handlers/on_log_rotate.hpp>
 #include <userver/server/handlers/server_monitor.hpp>
+#include <userver/server/handlers/task_profiler.hpp>
 #include <userver/server/handlers/tests_control.hpp>
 #include <userver/server/middlewares/configuration.hpp>
 #include <userver/tracing/manager_component.hpp>
@@ -30,6 +31,7 @@ ComponentList CommonServerComponentList() {
         .Append<server::handlers::LogLevel>()
         .Append<server::handlers::OnLogRotate>()
         .Append<server::handlers::ServerMonitor>()
+        .Append<server::handlers::TaskProfiler>()
         .Append<server::handlers::TestsControl>()
         .Append<congestion_control::Component>()
         .Append<components::AuthCheckerSettings>()
@@ -179,6 +179,13 @@ components_manager:
         method: POST
         task_processor: monitor-task-processor
 # /// [Sample handler on log rotate component config]
+# /// [Sample handler task profiler component config]
+# yaml
+    handler-task-profiler:
+        path: /service/task-profiler/
+        method: GET,DELETE
+        task_processor: monitor-task-processor
+# /// [Sample handler task profiler component config]
 # /// [Sample handler inspect requests component config]
 # yaml
     handler-inspect-requests:
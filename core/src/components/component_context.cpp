@@ -34,6 +34,8 @@ void ComponentContext::OnAllComponentsAreStopping() { impl_->OnAllComponentsAreS
 
 void ComponentContext::ClearComponents() { impl_->ClearComponents(); }
 
+impl::StartupTimeline ComponentContext::GetStartupTimeline() const { return impl_->GetStartupTimeline(); }
+
 engine::TaskProcessor& ComponentContext::GetTaskProcessor(const std::string& name) const {
     return impl_->GetTaskProcessor(name);
 }
@@ -158,6 +158,26 @@ std::string ComponentInfo::GetDependencies() const {
     return fmt::format(R"("{}" -> "{}" )", name_, fmt::join(it_depends_on_, delimiter));
 }
 
+void ComponentInfo::OnLoadStarted() {
+    std::lock_guard lock{mutex_};
+    load_timings_.start = std::chrono::steady_clock::now();
+}
+
+void ComponentInfo::OnLoadFinished() {
+    std::lock_guard lock{mutex_};
+    load_timings_.finish = std::chrono::steady_clock::now();
+}
+
+void ComponentInfo::AddLoadWaitDuration(std::chrono::steady_clock::duration duration) {
+    std::lock_guard lock{mutex_};
+    load_timings_.wait += duration;
+}
+
+ComponentLoadTimings ComponentInfo::GetLoadTimings() const {
+    std::lock_guard lock{mutex_};
+    return load_timings_;
+}
+
 bool ComponentInfo::HasComponent() const {
     std::lock_guard lock{mutex_};
     return !!component_;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -10,6 +11,7 @@
 #include <userver/engine/mutex.hpp>
 
 #include "impl/component_name_from_info.hpp"
+#include "impl/startup_timeline.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -91,6 +93,11 @@ public:
 
     std::string GetDependencies() const;
 
+    void OnLoadStarted();
+    void OnLoadFinished();
+    void AddLoadWaitDuration(std::chrono::steady_clock::duration duration);
+    ComponentLoadTimings GetLoadTimings() const;
+
 private:
     bool HasComponent() const;
     std::unique_ptr<RawComponentBase> ExtractComponent();
@@ -105,6 +112,7 @@ private:
     ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
     bool stage_switching_cancelled_{false};
     std::atomic<bool> on_loading_cancelled_called_{false};
+    ComponentLoadTimings load_timings_;
 };
 
 }  // namespace components::impl
@@ -13,6 +13,7 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <components/component_context_component_info.hpp>
 #include <components/impl/component_name_from_info.hpp>
@@ -114,7 +115,11 @@ ComponentContextImpl::AddComponent(std::string_view name, const ComponentFactory
     if (component_info.GetComponent())
         throw std::runtime_error("trying to add component " + std::string{name} + " multiple times");
 
-    component_info.SetComponent(factory(context));
+    component_info.OnLoadStarted();
+    auto created_component = factory(context);
+    component_info.OnLoadFinished();
+
+    component_info.SetComponent(std::move(created_component));
     auto* component = component_info.GetComponent();
     if (component) {
         // Call the following command on logs to get the component dependencies:
@@ -302,6 +307,20 @@ bool ComponentContextImpl::Contains(std::string_view name) const noexcept {
     return components_.count(impl::ComponentNameFromInfo{name}) != 0;
 }
 
+StartupTimeline ComponentContextImpl::GetStartupTimeline() const {
+    std::vector<ComponentStartupInfo> components;
+    components.reserve(components_.size());
+    for (const auto& [name, component_info] : components_) {
+        auto& component = components.emplace_back();
+        component.name = std::string{name.StringViewName()};
+        component.timings = component_info.GetLoadTimings();
+        component_info.ForEachItDependsOn([&component](impl::ComponentNameFromInfo dependency) {
+            component.dependencies.emplace_back(dependency.StringViewName());
+        });
+    }
+    return StartupTimeline{std::move(components)};
+}
+
 void ComponentContextImpl::ThrowNonRegisteredComponent(std::string_view name, std::string_view type) const {
     auto data = shared_data_.Lock();
     throw std::runtime_error(fmt::format(
@@ -433,6 +452,10 @@ RawComponentBase* ComponentContextImpl::DoFindComponent(std::string_view name) {
     }
     SearchingComponentScope finder(*this, this_component_name);
 
+    const auto wait_start = std::chrono::steady_clock::now();
+    utils::FastScopeGuard account_wait{[&]() noexcept {
+        components_.at(this_component_name).AddLoadWaitDuration(std::chrono::steady_clock::now() - wait_start);
+    }};
     return component_info.WaitAndGetComponent();
 }
 
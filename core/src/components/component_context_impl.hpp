@@ -18,6 +18,7 @@
 
 #include <components/component_context_component_info.hpp>
 #include <components/impl/component_name_from_info.hpp>
+#include <components/impl/startup_timeline.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -51,6 +52,8 @@ public:
 
     bool Contains(std::string_view name) const noexcept;
 
+    StartupTimeline GetStartupTimeline() const;
+
     [[noreturn]] void ThrowNonRegisteredComponent(std::string_view name, std::string_view type) const;
     [[noreturn]] void
     ThrowComponentTypeMismatch(std::string_view name, std::string_view type, RawComponentBase* component) const;
@@ -14,7 +14,8 @@ FsCache::FsCache(const components::ComponentConfig& config, const components::Co
       client_(
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
-          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor"))
+          context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor")),
+          config["keep-open-min-size"].As<std::size_t>(fs::kAlwaysLoadContents)
       ) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
@@ -36,6 +37,14 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    keep-open-min-size:
+        type: integer
+        description: |
+            files of at least this size are not loaded into memory, only an
+            opened file descriptor is kept. Such files are sent with sendfile(2)
+            by server::handlers::HttpHandlerStatic
+        defaultDescription: all the files are loaded into memory
+        minimum: 0
 )");
 }
 
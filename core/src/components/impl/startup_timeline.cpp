@@ -0,0 +1,145 @@
+#include <components/impl/startup_timeline.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+constexpr std::size_t kSlowestComponentsInSummary = 5;
+
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+double ToMilliseconds(std::chrono::steady_clock::duration duration) { return Milliseconds{duration}.count(); }
+
+std::chrono::steady_clock::duration GetSelfTime(const ComponentLoadTimings& timings) {
+    return std::max(timings.finish - timings.start - timings.wait, std::chrono::steady_clock::duration::zero());
+}
+
+}  // namespace
+
+StartupTimeline::StartupTimeline(std::vector<ComponentStartupInfo> components) : components_(std::move(components)) {
+    std::sort(components_.begin(), components_.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.timings.start < rhs.timings.start;
+    });
+    if (components_.empty()) return;
+    origin_ = components_.front().timings.start;
+
+    std::unordered_map<std::string_view, const ComponentStartupInfo*> by_name;
+    by_name.reserve(components_.size());
+    for (const auto& component : components_) by_name.emplace(component.name, &component);
+
+    const auto finished_earlier = [](const ComponentStartupInfo* lhs, const ComponentStartupInfo* rhs) {
+        return lhs->timings.finish < rhs->timings.finish;
+    };
+
+    const ComponentStartupInfo* current = &*std::max_element(
+        components_.begin(),
+        components_.end(),
+        [&finished_earlier](const auto& lhs, const auto& rhs) { return finished_earlier(&lhs, &rhs); }
+    );
+    while (current) {
+        critical_path_.push_back(current->name);
+        const ComponentStartupInfo* latest_dependency = nullptr;
+        for (const auto& dependency : current->dependencies) {
+            const auto it = by_name.find(dependency);
+            if (it == by_name.end()) continue;
+            if (!latest_dependency || finished_earlier(latest_dependency, it->second)) latest_dependency = it->second;
+        }
+        current = latest_dependency;
+    }
+    std::reverse(critical_path_.begin(), critical_path_.end());
+}
+
+std::string StartupTimeline::GetSummary() const {
+    if (components_.empty()) return "no components loaded";
+
+    std::string critical_path;
+    for (const auto& name : critical_path_) {
+        if (!critical_path.empty()) critical_path += " -> ";
+        critical_path += fmt::format("{} ({:.0f}ms)", name, ToMilliseconds(GetSelfTime(GetComponent(name).timings)));
+    }
+
+    std::vector<const ComponentStartupInfo*> slowest;
+    slowest.reserve(components_.size());
+    for (const auto& component : components_) slowest.push_back(&component);
+    const auto slowest_count = std::min(kSlowestComponentsInSummary, slowest.size());
+    std::partial_sort(
+        slowest.begin(),
+        slowest.begin() + slowest_count,
+        slowest.end(),
+        [](const auto* lhs, const auto* rhs) { return GetSelfTime(lhs->timings) > GetSelfTime(rhs->timings); }
+    );
+
+    std::string slowest_components;
+    for (std::size_t i = 0; i < slowest_count; ++i) {
+        if (!slowest_components.empty()) slowest_components += ", ";
+        const auto& timings = slowest[i]->timings;
+        slowest_components += fmt::format(
+            "{} (self {:.0f}ms, wait {:.0f}ms)",
+            slowest[i]->name,
+            ToMilliseconds(GetSelfTime(timings)),
+            ToMilliseconds(timings.wait)
+        );
+    }
+
+    const auto& last = GetComponent(critical_path_.back()).timings;
+    return fmt::format(
+        "components constructed in {:.0f}ms, critical path: {}; slowest components: {}",
+        ToMilliseconds(last.finish - origin_),
+        critical_path,
+        slowest_components
+    );
+}
+
+formats::json::Value StartupTimeline::ToJson() const {
+    formats::json::ValueBuilder result{formats::common::Type::kObject};
+
+    const auto make_component = [this](const ComponentStartupInfo& component) {
+        formats::json::ValueBuilder item;
+        item["name"] = component.name;
+        item["start_ms"] = ToMilliseconds(component.timings.start - origin_);
+        item["finish_ms"] = ToMilliseconds(component.timings.finish - origin_);
+        item["self_ms"] = ToMilliseconds(GetSelfTime(component.timings));
+        item["wait_ms"] = ToMilliseconds(component.timings.wait);
+        return item;
+    };
+
+    auto components = result["components"];
+    components = formats::common::Type::kArray;
+    for (const auto& component : components_) {
+        auto item = make_component(component);
+        item["dependencies"] = component.dependencies;
+        components.PushBack(std::move(item));
+    }
+
+    auto critical_path = result["critical_path"];
+    critical_path = formats::common::Type::kArray;
+    for (const auto& name : critical_path_) critical_path.PushBack(make_component(GetComponent(name)));
+
+    result["total_ms"] =
+        critical_path_.empty() ? 0.0 : ToMilliseconds(GetComponent(critical_path_.back()).timings.finish - origin_);
+    return result.ExtractValue();
+}
+
+const ComponentStartupInfo& StartupTimeline::GetComponent(const std::string& name) const {
+    const auto it = std::find_if(components_.begin(), components_.end(), [&name](const auto& component) {
+        return component.name == name;
+    });
+    UASSERT(it != components_.end());
+    return *it;
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+struct ComponentLoadTimings final {
+    std::chrono::steady_clock::time_point start{};
+    std::chrono::steady_clock::time_point finish{};
+    // Time spent in FindComponent() waiting for the dependencies to load
+    std::chrono::steady_clock::duration wait{};
+};
+
+struct ComponentStartupInfo final {
+    std::string name;
+    ComponentLoadTimings timings;
+    std::vector<std::string> dependencies;
+};
+
+// Report on the components construction, built after all the components are
+// loaded. The critical path is the chain of the latest loaded dependencies
+// ending with the component that was loaded last, speeding up anything else
+// does not shorten the startup.
+class StartupTimeline final {
+public:
+    explicit StartupTimeline(std::vector<ComponentStartupInfo> components);
+
+    const std::vector<std::string>& GetCriticalPath() const noexcept { return critical_path_; }
+
+    std::string GetSummary() const;
+
+    formats::json::Value ToJson() const;
+
+private:
+    const ComponentStartupInfo& GetComponent(const std::string& name) const;
+
+    std::vector<ComponentStartupInfo> components_;
+    std::chrono::steady_clock::time_point origin_{};
+    std::vector<std::string> critical_path_;
+};
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#include <components/impl/startup_timeline.hpp>
+
+#include <gmock/gmock.h>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using components::impl::ComponentStartupInfo;
+using std::chrono::milliseconds;
+
+ComponentStartupInfo MakeComponent(
+    std::string name,
+    milliseconds start,
+    milliseconds finish,
+    milliseconds wait,
+    std::vector<std::string> dependencies
+) {
+    const std::chrono::steady_clock::time_point origin{};
+    return {std::move(name), {origin + start, origin + finish, wait}, std::move(dependencies)};
+}
+
+}  // namespace
+
+TEST(StartupTimeline, CriticalPath) {
+    const components::impl::StartupTimeline timeline{{
+        MakeComponent("server", milliseconds{0}, milliseconds{700}, milliseconds{600}, {"cache-a", "cache-b"}),
+        MakeComponent("cache-a", milliseconds{0}, milliseconds{300}, milliseconds{100}, {"logging"}),
+        MakeComponent("cache-b", milliseconds{0}, milliseconds{600}, milliseconds{100}, {"logging"}),
+        MakeComponent("logging", milliseconds{0}, milliseconds{100}, milliseconds{0}, {}),
+        MakeComponent("tracer", milliseconds{0}, milliseconds{50}, milliseconds{0}, {}),
+    }};
+
+    EXPECT_THAT(timeline.GetCriticalPath(), testing::ElementsAre("logging", "cache-b", "server"));
+
+    const auto json = timeline.ToJson();
+    EXPECT_DOUBLE_EQ(json["total_ms"].As<double>(), 700);
+    EXPECT_EQ(json["components"].GetSize(), 5);
+    ASSERT_EQ(json["critical_path"].GetSize(), 3);
+    EXPECT_EQ(json["critical_path"][1]["name"].As<std::string>(), "cache-b");
+    EXPECT_DOUBLE_EQ(json["critical_path"][1]["self_ms"].As<double>(), 500);
+    EXPECT_DOUBLE_EQ(json["critical_path"][1]["wait_ms"].As<double>(), 100);
+
+    EXPECT_THAT(timeline.GetSummary(), testing::HasSubstr("logging (100ms) -> cache-b (500ms) -> server (100ms)"));
+}
+
+TEST(StartupTimeline, Empty) {
+    const components::impl::StartupTimeline timeline{{}};
+    EXPECT_TRUE(timeline.GetCriticalPath().empty());
+    EXPECT_DOUBLE_EQ(timeline.ToJson()["total_ms"].As<double>(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <userver/components/component.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
@@ -29,6 +30,17 @@ const dynamic_config::Key<tracing::NoLogSpans> kNoLogSpans{
 )"}};
 /// [key]
 
+const dynamic_config::Key<tracing::TailSamplingConfig> kTailSampling{
+    "USERVER_TRACING_TAIL_SAMPLING",
+    dynamic_config::DefaultAsJsonString{R"(
+  {
+    "enabled": false,
+    "slow-threshold-ms": 1000,
+    "sample-rate": 0.05,
+    "max-spans-per-trace": 1000
+  }
+)"}};
+
 const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
     "USERVER_LOG_DYNAMIC_DEBUG",
     dynamic_config::DefaultAsJsonString{R"(
@@ -54,6 +66,7 @@ LoggingConfigurator::~LoggingConfigurator() { config_subscription_.Unsubscribe()
 void LoggingConfigurator::OnConfigUpdate(const dynamic_config::Snapshot& config) {
     (void)this;  // silence clang-tidy
     tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans{config[kNoLogSpans]});
+    tracing::Tracer::SetTailSampling(tracing::TailSamplingConfig{config[kTailSampling]});
 
     try {
         const auto& dd = config[kDynamicDebugConfig];
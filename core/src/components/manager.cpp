@@ -11,12 +11,15 @@
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <components/impl/startup_timeline.hpp>
 #include <components/manager_config.hpp>
 #include <engine/task/exception_hacks.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_pools.hpp>
 #include <userver/components/component_list.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/hostinfo/cpu_limit.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/logging/log.hpp>
@@ -52,12 +55,12 @@ std::optional<size_t> GuessCpuLimit(const std::string& tp_name) {
         // TODO: hack for https://st.yandex-team.ru/TAXICOMMON-2132
         if (cpu < 3) cpu = 3;
 
-        LOG_INFO() << "Using CPU limit from env CPU_LIMIT (" << cpu << ") for worker_threads "
+        LOG_INFO() << "Using CPU limit (" << cpu << ") for worker_threads "
                    << "of task processor '" << tp_name << "', ignoring config value ";
         return cpu;
     }
 
-    LOG_WARNING() << "CPU limit from env CPU_LIMIT (" << cpu_f
+    LOG_WARNING() << "CPU limit (" << *cpu_f
                   << ") looks very different from the estimated number of "
                      "hardware threads ("
                   << hw_threads_estimate << "), worker_threads from the static config will be used";
@@ -141,7 +144,11 @@ void Manager::TaskProcessorsStorage::WaitForAllTasksBlocking() const noexcept {
 Manager::Manager(std::unique_ptr<ManagerConfig>&& config, const ComponentList& component_list)
     : config_(std::move(config)),
       task_processors_storage_(
-          std::make_shared<engine::impl::TaskProcessorPools>(config_->coro_pool, config_->event_thread_pool)
+          std::make_shared<engine::impl::TaskProcessorPools>(
+              config_->coro_pool,
+              config_->event_thread_pool,
+              config_->big_stack_coro_pool
+          )
       ),
       start_time_(std::chrono::steady_clock::now()) {
     LOG_INFO() << "Starting components manager";
@@ -370,6 +377,24 @@ void Manager::AddComponents(const ComponentList& component_list) {
     load_duration_ = std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time);
 
     LOG_INFO() << "All components loaded";
+    ReportStartupTimeline();
+}
+
+void Manager::ReportStartupTimeline() const {
+    const auto timeline = component_context_.GetStartupTimeline();
+    LOG_INFO() << "Startup timeline: " << timeline.GetSummary();
+
+    if (!config_->startup_timeline_path) return;
+    try {
+        fs::blocking::RewriteFileContentsAtomically(
+            *config_->startup_timeline_path,
+            formats::json::ToString(timeline.ToJson()),
+            boost::filesystem::perms::owner_read | boost::filesystem::perms::owner_write |
+                boost::filesystem::perms::group_read | boost::filesystem::perms::others_read
+        );
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to write the startup timeline to " << *config_->startup_timeline_path << ": " << ex;
+    }
 }
 
 void Manager::AddComponentImpl(
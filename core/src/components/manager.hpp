@@ -73,6 +73,7 @@ private:
 
     void CreateComponentContext(const ComponentList& component_list);
     void AddComponents(const ComponentList& component_list);
+    void ReportStartupTimeline() const;
 
     friend void impl::AddComponentImpl(
         Manager& manager,
@@ -111,16 +111,89 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+            stack_reclaim_interval:
+                type: string
+                description: |
+                    Interval of returning the stack memory of idle coroutines
+                    to the OS and of destroying the coroutines that were not
+                    used for the whole interval, 0 disables the reclamation.
+                defaultDescription: 0
+            huge_pages:
+                type: boolean
+                description: |
+                    Carve the stacks out of 2 MiB chunks backed by transparent
+                    huge pages to reduce the TLB misses. There is a single
+                    guard page per chunk, so a stack overflow may corrupt a
+                    neighbouring stack instead of crashing. The stack memory
+                    is not returned to the OS by stack_reclaim_interval.
+                defaultDescription: false
+    big_stack_coro_pool:
+        type: object
+        description: |
+            pool of coroutines for the task processors with `big-stack: true`,
+            allows keeping small stacks in coro_pool for the rest of the tasks.
+            Not created if missing.
+        additionalProperties: false
+        properties:
+            initial_size:
+                type: integer
+                description: amount of coroutines to preallocate on startup
+                defaultDescription: 1000
+            max_size:
+                type: integer
+                description: max amount of coroutines to keep preallocated
+                defaultDescription: 4000
+            stack_size:
+                type: integer
+                description: size of a single coroutine, bytes
+                defaultDescription: 256 * 1024
+            local_cache_size:
+                type: integer
+                description: local coroutine cache size per worker thread, see coro_pool
+                defaultDescription: 8
+            stack_reclaim_interval:
+                type: string
+                description: see coro_pool
+                defaultDescription: 0
+            huge_pages:
+                type: boolean
+                description: see coro_pool
+                defaultDescription: false
     event_thread_pool:
         type: object
         description: event thread pool options
         additionalProperties: false
         properties:
             threads:
-                type: integer
+                type: string
                 description: >
                     number of threads to process low level IO system calls
-                    (number of ev loops to start in libev)
+                    (number of ev loops to start in libev), or `auto` for
+                    one thread per 4 CPUs available to the process (at least
+                    one)
+            backend:
+                type: string
+                description: |
+                    libev backend to use for the event loops.
+                    `auto` lets libev choose the recommended backend.
+                    `io_uring` batches the readiness notifications via
+                    io_uring and falls back to `epoll` if the kernel or
+                    libev lacks the support.
+                defaultDescription: auto
+                enum:
+                  - auto
+                  - epoll
+                  - io_uring
+            busy_poll:
+                type: boolean
+                description: |
+                    set to true to make the ev threads spin in non-blocking
+                    event loop iterations instead of sleeping in the backend.
+                    Lowers the IO wakeup latency at the cost of a whole CPU
+                    per ev thread, the ev threads report 100% load. Makes sense
+                    only with dedicated CPUs, e.g. together with the
+                    `low_latency` mode of the server listener.
+                defaultDescription: false
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -138,8 +211,12 @@ properties:
                     type: string
                     description: set OS thread name to this value
                 worker_threads:
-                    type: integer
-                    description: threads count for the task processor
+                    type: string
+                    description: |
+                        threads count for the task processor, or `auto` for
+                        the number of CPUs available to the process: the
+                        CPU_LIMIT env, the cgroup CPU quota or the hardware
+                        concurrency
                 guess-cpu-limit:
                     type: boolean
                     description: .
@@ -169,10 +246,69 @@ properties:
                         `global-task-queue` default task queue.
                         `work-stealing-task-queue` experimental with
                         potentially better scalability than `global-task-queue`.
+                        `priority-task-queue` takes the tasks of higher
+                        engine::TaskPriority more often.
                     defaultDescription: global-task-queue
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                      - priority-task-queue
+                lifo-slot:
+                    type: boolean
+                    description: |
+                        `global-task-queue` only: a task spawned or woken up
+                        by a worker is run next by the same worker, bypassing
+                        the queue. Speeds up `Async` + `Get` pairs, but the
+                        task waits until the current task of the worker yields
+                        or blocks.
+                    defaultDescription: false
+                work-stealing:
+                    type: object
+                    description: |
+                        tuning of the idle workers of
+                        `work-stealing-task-queue`, see the `work-stealing`
+                        metrics of the task processor
+                    additionalProperties: false
+                    properties:
+                        spin-before-sleep-us:
+                            type: integer
+                            description: |
+                                how long an idle worker keeps looking for
+                                tasks before going to sleep, in microseconds.
+                                Reduces the wakeup latency and the futex calls
+                                under bursty load at the cost of CPU time.
+                            defaultDescription: 0
+                            minimum: 0
+                        spinning-workers:
+                            type: integer
+                            description: |
+                                how many idle workers keep looking for tasks
+                                without going to sleep. Each of them burns a
+                                CPU while the task processor is idle. At most
+                                a half of the workers look for tasks at the
+                                same time.
+                            defaultDescription: 0
+                cpu-set:
+                    type: string
+                    description: |
+                        CPUs to pin the worker threads to, in Linux cpulist
+                        format, e.g. `0-7,16-23`. Each worker is pinned to
+                        the CPUs of the set from a single NUMA node, workers
+                        are spread over the nodes in proportion to their CPUs.
+                        The task processor fails to start if pinning fails.
+                        Mutually exclusive with `numa-node`.
+                big-stack:
+                    type: boolean
+                    description: |
+                        take the coroutines of the tasks from
+                        big_stack_coro_pool instead of coro_pool
+                    defaultDescription: false
+                numa-node:
+                    type: integer
+                    description: |
+                        NUMA node to pin the worker threads to, all the CPUs
+                        of the node are used. Mutually exclusive with
+                        `cpu-set`.
                 task-trace:
                     type: object
                     description: .
@@ -205,6 +341,10 @@ properties:
         type: boolean
         description: whether to collect a dummy stacktrace at server start up
         defaultDescription: true
+    async_stacktrace_symbolization:
+        type: boolean
+        description: whether to symbolize the logged stacktraces on a background thread
+        defaultDescription: false
     static_config_validation:
         type: object
         description: settings for basic syntax validation in config.yaml
@@ -228,6 +368,12 @@ properties:
             the balancer a chance to redirect new requests to other hosts and
             to give the service a chance to finish handling old requests.
         defaultDescription: 0s
+    startup_timeline_path:
+        type: string
+        description: |
+            path to write the JSON report on the components construction to:
+            per-component start, self and wait times, the critical path
+        defaultDescription: the report is not written, only logged
 )");
 }
 
@@ -237,6 +383,7 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Man
     ManagerConfig config;
 
     config.coro_pool = value["coro_pool"].As<engine::coro::PoolConfig>({});
+    config.big_stack_coro_pool = value["big_stack_coro_pool"].As<std::optional<engine::coro::PoolConfig>>();
     config.event_thread_pool = value["event_thread_pool"].As<engine::ev::ThreadPoolConfig>();
     if (config.event_thread_pool.threads < 1) {
         throw std::runtime_error(
@@ -258,8 +405,11 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Man
     config.disable_phdr_cache = value["disable_phdr_cache"].As<bool>(config.disable_phdr_cache);
     config.preheat_stacktrace_collector =
         value["preheat_stacktrace_collector"].As<bool>(config.preheat_stacktrace_collector);
+    config.async_stacktrace_symbolization =
+        value["async_stacktrace_symbolization"].As<bool>(config.async_stacktrace_symbolization);
     config.graceful_shutdown_interval =
         value["graceful_shutdown_interval"].As<std::chrono::milliseconds>(config.graceful_shutdown_interval);
+    config.startup_timeline_path = value["startup_timeline_path"].As<std::optional<std::string>>();
 
     return config;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -19,6 +20,7 @@ enum class ValidationMode;
 
 struct ManagerConfig {
     engine::coro::PoolConfig coro_pool;
+    std::optional<engine::coro::PoolConfig> big_stack_coro_pool;
     engine::ev::ThreadPoolConfig event_thread_pool;
     std::vector<components::ComponentConfig> components;
     std::vector<engine::TaskProcessorConfig> task_processors;
@@ -29,6 +31,8 @@ struct ManagerConfig {
     bool mlock_debug_info{true};
     bool disable_phdr_cache{false};
     bool preheat_stacktrace_collector{true};
+    bool async_stacktrace_symbolization{false};
+    std::optional<std::string> startup_timeline_path;
 
     static ManagerConfig FromString(
         const std::string&,
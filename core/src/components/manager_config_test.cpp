@@ -21,12 +21,16 @@ components_manager:
     max_size#fallback: 50000
     stack_size#env: USERVER_STACK_SIZE
     local_cache_size: 32
+  big_stack_coro_pool:
+    initial_size: 10
+    stack_size: 1048576
   default_task_processor: main-task-processor
   mlock_debug_info: $variable_does_not_exist
   mlock_debug_info#env: MLOCK_DEBUG_INFO
   event_thread_pool:
     threads: $event_threads
     threads#fallback: 2
+    backend: io_uring
   task_processors:
     bg-task-processor:
       thread_name: bg-worker
@@ -34,12 +38,17 @@ components_manager:
       worker_threads#fallback: 2
       os-scheduling: low-priority
       task-processor-queue: global-task-queue
+      big-stack: true
     fs-task-processor:
       thread_name: fs-worker
       worker_threads: $fs_worker_threads
     main-task-processor:
       thread_name: main-worker
       worker_threads: $main_worker_threads
+      task-processor-queue: work-stealing-task-queue
+      work-stealing:
+        spin-before-sleep-us: 50
+        spinning-workers: 1
     monitor-task-processor:
       thread_name: mon-worker
       worker_threads: $monitor_worker_threads
@@ -213,8 +222,29 @@ TEST(ManagerConfig, Basic) {
     EXPECT_EQ(mc.coro_pool.initial_size, 5000) << "#fallback does not work";
     EXPECT_FALSE(mc.mlock_debug_info) << "#env does not work with missing substitution vars";
     EXPECT_EQ(mc.coro_pool.stack_size, 1024) << "#env does not work";
+    ASSERT_TRUE(mc.big_stack_coro_pool);
+    EXPECT_EQ(mc.big_stack_coro_pool->initial_size, 10);
+    EXPECT_EQ(mc.big_stack_coro_pool->stack_size, 1048576);
+    EXPECT_EQ(mc.event_thread_pool.threads, 3);
+    EXPECT_EQ(mc.event_thread_pool.backend, engine::ev::EvBackend::kIoUring);
 
     EXPECT_EQ(mc.task_processors.size(), 5);
+    EXPECT_EQ(
+        std::count_if(
+            mc.task_processors.begin(),
+            mc.task_processors.end(),
+            [](const auto& config) { return config.use_big_stack_coro_pool; }
+        ),
+        1
+    );
+
+    const auto main_it = std::find_if(mc.task_processors.begin(), mc.task_processors.end(), [](const auto& config) {
+        return config.name == "main-task-processor";
+    });
+    ASSERT_NE(main_it, mc.task_processors.end());
+    EXPECT_EQ(main_it->task_processor_queue, engine::TaskQueueType::kWorkStealingTaskQueue);
+    EXPECT_EQ(main_it->work_stealing_spin_before_sleep, std::chrono::microseconds{50});
+    EXPECT_EQ(main_it->work_stealing_spinning_workers, 1);
 
     ASSERT_EQ(mc.components.size(), 28);
 
@@ -8,6 +8,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/logging/component.hpp>
+#include <userver/utils/statistics/rate.hpp>
 
 #include <components/manager.hpp>
 
@@ -15,6 +16,25 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
+namespace coro {
+
+void DumpMetric(utils::statistics::Writer& writer, const PoolStats& stats) {
+    if (auto coro_stats = writer["coroutines"]) {
+        coro_stats["active"] = stats.active_coroutines;
+        coro_stats["total"] = stats.total_coroutines;
+    }
+    if (auto stack_usage_stats = writer["stack-usage"]) {
+        stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
+        stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
+    }
+    if (auto stack_reclaim_stats = writer["stack-reclaim"]) {
+        stack_reclaim_stats["reclaimed-bytes"] = utils::statistics::Rate{stats.reclaimed_stack_bytes};
+        stack_reclaim_stats["destroyed-idle-coroutines"] = utils::statistics::Rate{stats.destroyed_idle_coroutines};
+    }
+}
+
+}  // namespace coro
+
 void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor& task_processor) {
     const auto& counter = task_processor.GetTaskCounter();
 
@@ -47,6 +67,25 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
     }
 
     writer["worker-threads"] = task_processor.GetWorkerCount();
+    task_processor.WriteTaskQueueStatistics(writer);
+
+    task_processor.GetCpuAccounting().Visit([&writer](std::string_view span_name, std::chrono::nanoseconds cpu_time) {
+        const auto cpu_time_us = std::chrono::duration_cast<std::chrono::microseconds>(cpu_time).count();
+        writer["cpu-time-us"].ValueWithLabels(
+            utils::statistics::Rate{static_cast<std::uint64_t>(cpu_time_us)}, {{"span_name", span_name}}
+        );
+    });
+
+    task_processor.GetAllocationAccounting().Visit(
+        [&writer](std::string_view span_name, std::uint64_t allocated_bytes, std::uint64_t deallocated_bytes) {
+            writer["allocated-bytes"].ValueWithLabels(
+                utils::statistics::Rate{allocated_bytes}, {{"span_name", span_name}}
+            );
+            writer["deallocated-bytes"].ValueWithLabels(
+                utils::statistics::Rate{deallocated_bytes}, {{"span_name", span_name}}
+            );
+        }
+    );
 }
 
 }  // namespace engine
@@ -93,16 +132,9 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
     writer["ev-threads"]["cpu-load-percent"] = pools_ptr->EventThreadPool();
 
     // coroutines
-    if (auto coro_pool = writer["coro-pool"]) {
-        const auto stats = components_manager_.GetTaskProcessorPools()->GetCoroPool().GetStats();
-        if (auto coro_stats = coro_pool["coroutines"]) {
-            coro_stats["active"] = stats.active_coroutines;
-            coro_stats["total"] = stats.total_coroutines;
-        }
-        if (auto stack_usage_stats = coro_pool["stack-usage"]) {
-            stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
-            stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
-        }
+    writer["coro-pool"] = pools_ptr->GetCoroPool().GetStats();
+    if (auto* big_stack_pool = pools_ptr->GetBigStackCoroPool()) {
+        writer["big-stack-coro-pool"] = big_stack_pool->GetStats();
     }
 
     // misc
@@ -56,6 +56,9 @@ ManagerControllerDynamicConfig ManagerControllerDynamicConfig::Parse(const dynam
             tp_settings.profiler_execution_slice_threshold =
                 std::chrono::microseconds{value["execution-slice-threshold-us"].As<int>()};
             tp_settings.profiler_force_stacktrace = value["profiler-force-stacktrace"].As<bool>(false);
+            tp_settings.profiler_cpu_accounting = value["cpu-accounting"].As<bool>(false);
+            tp_settings.profiler_allocation_accounting = value["allocation-accounting"].As<bool>(false);
+            tp_settings.profiler_collect_stacktraces = value["collect-stacktraces"].As<bool>(false);
         }
     }
 
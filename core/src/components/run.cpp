@@ -30,6 +30,7 @@
 #include <components/manager.hpp>
 #include <components/manager_config.hpp>
 #include <logging/config.hpp>
+#include <logging/log_extra_stacktrace.hpp>
 #include <logging/tp_logger_utils.hpp>
 #include <utils/ignore_signal_scope.hpp>
 #include <utils/jemalloc.hpp>
@@ -206,6 +207,7 @@ void DoRun(
         experiments_scope.EnableOnly(manager_config.enabled_experiments);
 
         HandleJemallocSettings();
+        logging::impl::SetAsyncStacktraceSymbolization(manager_config.async_stacktrace_symbolization);
         if (manager_config.preheat_stacktrace_collector) {
             PreheatStacktraceCollector();
         }
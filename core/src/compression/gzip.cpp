@@ -3,13 +3,22 @@
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <zlib.h>
+
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
 namespace {
 constexpr auto kDecompressBufferSize = 1024;
-}
+constexpr auto kCompressBufferSize = 16 * 1024;
+
+// 15 is the max window size, +16 asks zlib for gzip header and trailer
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+}  // namespace
 
 std::string Decompress(std::string_view compressed, size_t max_size) {
     std::string decompressed;
@@ -41,6 +50,73 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+    StreamCompressor compressor{level};
+    auto result = compressor.Compress(data);
+    result += compressor.Finish();
+    return result;
+}
+
+struct StreamCompressor::Impl final {
+    z_stream stream{};
+    bool finished{false};
+};
+
+StreamCompressor::StreamCompressor(int level) : impl_(std::make_unique<Impl>()) {
+    const auto ret = deflateInit2(&impl_->stream, level, Z_DEFLATED, kGzipWindowBits, kMemLevel, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        throw CompressionError(impl_->stream.msg ? impl_->stream.msg : "deflateInit2 failed");
+    }
+}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() {
+    if (impl_) deflateEnd(&impl_->stream);
+}
+
+std::string StreamCompressor::Compress(std::string_view chunk) {
+    if (chunk.empty()) return {};
+    return Deflate(chunk, Z_SYNC_FLUSH);
+}
+
+std::string StreamCompressor::Finish() {
+    UASSERT_MSG(!impl_->finished, "Finish() was already called");
+    auto result = Deflate({}, Z_FINISH);
+    impl_->finished = true;
+    return result;
+}
+
+std::string StreamCompressor::Deflate(std::string_view chunk, int flush) {
+    UASSERT_MSG(!impl_->finished, "StreamCompressor is used after Finish()");
+    auto& stream = impl_->stream;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(chunk.data()));
+    stream.avail_in = static_cast<uInt>(chunk.size());
+
+    std::string result;
+    result.reserve(std::min<std::size_t>(deflateBound(&stream, chunk.size()), kCompressBufferSize));
+    char buf[kCompressBufferSize];
+    while (true) {
+        stream.next_out = reinterpret_cast<Bytef*>(buf);
+        stream.avail_out = sizeof(buf);
+
+        const auto ret = deflate(&stream, flush);
+        if (ret == Z_STREAM_ERROR) {
+            throw CompressionError(stream.msg ? stream.msg : "deflate failed");
+        }
+        result.append(buf, sizeof(buf) - stream.avail_out);
+
+        if (ret == Z_STREAM_END) break;
+        // Output buffer was not filled up, so all the pending output is flushed
+        if (stream.avail_out != 0 && stream.avail_in == 0 && flush != Z_FINISH) break;
+    }
+    return result;
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
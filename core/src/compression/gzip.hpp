@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +10,44 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
+/// Default zlib compression level, a good speed/ratio trade-off
+inline constexpr int kDefaultLevel = 6;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a single gzip member.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// Incremental gzip compressor. Output of each Compress() call is flushed, so
+/// the peer is able to decompress it without waiting for the rest of the data.
+class StreamCompressor final {
+public:
+    /// @throws CompressionError
+    explicit StreamCompressor(int level = kDefaultLevel);
+
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// Compresses the next chunk of data.
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// Finishes the gzip member, no Compress() calls are allowed after that.
+    /// @throws CompressionError
+    std::string Finish();
+
+private:
+    struct Impl;
+
+    std::string Deflate(std::string_view chunk, int flush);
+
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -28,4 +28,28 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundTrip) {
+    std::string data;
+    for (int i = 0; i < 10000; ++i) {
+        data += std::to_string(i % 97);
+    }
+
+    const auto compressed = compression::gzip::Compress(data);
+    EXPECT_LT(compressed.size(), data.size());
+    EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+    EXPECT_EQ(compression::gzip::Decompress(compression::gzip::Compress(""), 1), "");
+}
+
+TEST(Gzip, StreamCompressor) {
+    const std::string data(10000, 'x');
+    compression::gzip::StreamCompressor compressor;
+
+    std::string compressed = compressor.Compress(std::string_view{data}.substr(0, 100));
+    EXPECT_FALSE(compressed.empty()) << "Every chunk should be flushed";
+    compressed += compressor.Compress(std::string_view{data}.substr(100));
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+}
+
 USERVER_NAMESPACE_END
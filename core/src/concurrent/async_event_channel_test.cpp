@@ -1,9 +1,12 @@
 #include <userver/utest/utest.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <stdexcept>
+#include <vector>
 
 #include <userver/concurrent/async_event_channel.hpp>
+#include <userver/engine/sleep.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -89,6 +92,43 @@ UTEST(AsyncEventChannel, PublishException) {
     sub1.Unsubscribe();
 }
 
+UTEST_MT(AsyncEventChannel, MaxParallelism, 4) {
+    concurrent::AsyncEventChannel<int> channel("channel");
+    channel.SetMaxParallelism(2);
+    EXPECT_EQ(channel.GetMaxParallelism(), 2);
+
+    struct X {
+        void OnEvent(int) {
+            const auto running = ++concurrent_calls;
+            auto max = max_concurrent_calls.load();
+            while (max < running && !max_concurrent_calls.compare_exchange_weak(max, running)) {
+            }
+            engine::SleepFor(std::chrono::milliseconds{10});
+            --concurrent_calls;
+            ++calls;
+        }
+
+        std::atomic<int>& concurrent_calls;
+        std::atomic<int>& max_concurrent_calls;
+        int calls{0};
+    };
+
+    std::atomic<int> concurrent_calls{0};
+    std::atomic<int> max_concurrent_calls{0};
+    std::vector<X> listeners(5, X{concurrent_calls, max_concurrent_calls});
+    std::vector<concurrent::AsyncEventSubscriberScope> subscriptions;
+    for (auto& listener : listeners) {
+        subscriptions.push_back(channel.AddListener(&listener, "subscriber", &X::OnEvent));
+    }
+
+    channel.SendEvent(1);
+    channel.SendEvent(2);
+    EXPECT_LE(max_concurrent_calls.load(), 2);
+    for (const auto& listener : listeners) EXPECT_EQ(listener.calls, 2);
+
+    for (auto& subscription : subscriptions) subscription.Unsubscribe();
+}
+
 UTEST(AsyncEventChannel, OnListenerRemoval) {
     int counter = 0;
     auto on_remove = [&counter](std::function<void(int)> func) {
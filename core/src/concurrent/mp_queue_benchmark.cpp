@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -28,7 +30,29 @@ auto GetConsumerTask(Consumer consumer) {
     });
 }
 
+template <typename Producer>
+auto GetBatchProducerTask(Producer producer, const std::atomic<bool>& run, std::size_t batch_size) {
+    return engine::CriticalAsyncNoSpan([producer = std::move(producer), &run, batch_size] {
+        std::vector<std::size_t> batch(batch_size);
+        while (run && producer.PushBatch(batch) == batch_size) {
+        }
+    });
+}
+
+template <typename Consumer>
+auto GetBatchConsumerTask(Consumer consumer, std::size_t batch_size) {
+    return engine::CriticalAsyncNoSpan([consumer = std::move(consumer), batch_size] {
+        std::vector<std::size_t> values;
+        values.reserve(batch_size);
+        while (consumer.PopBatch(values, batch_size) != 0) {
+            benchmark::DoNotOptimize(values.data());
+            values.clear();
+        }
+    });
+}
+
 constexpr auto kUnbounded = concurrent::NonFifoMpmcQueue<std::size_t>::kUnbounded;
+constexpr std::size_t kBatchQueueMaxSize = 1024;
 
 }  // namespace
 
@@ -117,6 +141,97 @@ void QueueConsume(benchmark::State& state) {
     });
 }
 
+// QueueProduceBatch reports the time per element and QueueConsumeBatch
+// reports the rate of the consumed elements, as the batches may be partial
+template <typename QueueType>
+void QueueProduceBatch(benchmark::State& state) {
+    engine::RunStandalone(state.range(0) + state.range(1), [&] {
+        const std::size_t producers_count = state.range(0);
+        const std::size_t consumers_count = state.range(1);
+        const std::size_t batch_size = state.range(2);
+
+        auto queue = QueueType::Create(kBatchQueueMaxSize);
+        std::atomic<bool> run{true};
+
+        std::vector<engine::TaskWithResult<void>> producer_tasks;
+        producer_tasks.reserve(producers_count - 1);
+        for (std::size_t i = 0; i < producers_count - 1; ++i) {
+            producer_tasks.push_back(GetBatchProducerTask(queue->GetProducer(), run, batch_size));
+        }
+
+        std::vector<engine::TaskWithResult<void>> consumer_tasks;
+        consumer_tasks.reserve(consumers_count);
+        for (std::size_t i = 0; i < consumers_count; ++i) {
+            consumer_tasks.push_back(GetBatchConsumerTask(queue->GetConsumer(), batch_size));
+        }
+
+        {
+            std::vector<std::size_t> batch(batch_size);
+            auto producer = queue->GetProducer();
+            while (state.KeepRunningBatch(batch_size)) {
+                auto res = producer.PushBatch(batch);
+                benchmark::DoNotOptimize(res);
+            }
+        }
+
+        run = false;
+
+        for (auto& task : producer_tasks) {
+            task.RequestCancel();
+            task.Get();
+        }
+        for (auto& task : consumer_tasks) {
+            task.Get();
+        }
+    });
+}
+
+template <typename QueueType>
+void QueueConsumeBatch(benchmark::State& state) {
+    engine::RunStandalone(state.range(0) + state.range(1), [&] {
+        const std::size_t producers_count = state.range(0);
+        const std::size_t consumers_count = state.range(1);
+        const std::size_t batch_size = state.range(2);
+
+        auto queue = QueueType::Create(kBatchQueueMaxSize);
+        std::atomic<bool> run{true};
+
+        std::vector<engine::TaskWithResult<void>> producer_tasks;
+        producer_tasks.reserve(producers_count);
+        for (std::size_t i = 0; i < producers_count; ++i) {
+            producer_tasks.push_back(GetBatchProducerTask(queue->GetProducer(), run, batch_size));
+        }
+
+        std::vector<engine::TaskWithResult<void>> consumer_tasks;
+        consumer_tasks.reserve(consumers_count - 1);
+        for (std::size_t i = 0; i < consumers_count - 1; ++i) {
+            consumer_tasks.push_back(GetBatchConsumerTask(queue->GetConsumer(), batch_size));
+        }
+
+        {
+            std::vector<std::size_t> values;
+            values.reserve(batch_size);
+            auto consumer = queue->GetConsumer();
+            std::int64_t popped = 0;
+            for ([[maybe_unused]] auto _ : state) {
+                values.clear();
+                popped += consumer.PopBatch(values, batch_size);
+                benchmark::DoNotOptimize(values.data());
+            }
+            state.SetItemsProcessed(popped);
+        }
+
+        run = false;
+        for (auto& task : producer_tasks) {
+            task.RequestCancel();
+            task.Get();
+        }
+        for (auto& task : consumer_tasks) {
+            task.Get();
+        }
+    });
+}
+
 BENCHMARK_TEMPLATE(QueueProduce, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 1}, {1, 4}, {128, 512}});
@@ -205,4 +320,28 @@ BENCHMARK_TEMPLATE(QueueConsume, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {kUnbounded, kUnbounded}});
 
+BENCHMARK_TEMPLATE(QueueProduceBatch, concurrent::NonFifoMpmcQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 4}, {1, 64}});
+
+BENCHMARK_TEMPLATE(QueueConsumeBatch, concurrent::NonFifoMpmcQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 4}, {1, 64}});
+
+BENCHMARK_TEMPLATE(QueueProduceBatch, concurrent::NonFifoMpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 1}, {1, 64}});
+
+BENCHMARK_TEMPLATE(QueueConsumeBatch, concurrent::NonFifoMpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 1}, {1, 64}});
+
+BENCHMARK_TEMPLATE(QueueProduceBatch, concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {1, 64}});
+
+BENCHMARK_TEMPLATE(QueueConsumeBatch, concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {1, 64}});
+
 USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include <boost/range/irange.hpp>
 
@@ -46,6 +47,19 @@ using TestQueueTypes = testing::Types<
     concurrent::SpmcQueue<std::size_t>,
     concurrent::SpscQueue<std::size_t>>;
 
+template <typename T>
+class BatchQueueTest : public ::testing::Test {};
+
+using TestBatchQueueTypes = testing::Types<
+    concurrent::NonFifoMpmcQueue<std::size_t>,
+    concurrent::NonFifoMpscQueue<std::size_t>,
+    concurrent::SpmcQueue<std::size_t>,
+    concurrent::SpscQueue<std::size_t>,
+    concurrent::impl::UnfairUnboundedNonFifoMpmcQueue<std::size_t>,
+    concurrent::UnboundedNonFifoMpscQueue<std::size_t>,
+    concurrent::UnboundedSpmcQueue<std::size_t>,
+    concurrent::UnboundedSpscQueue<std::size_t>>;
+
 }  // namespace
 
 INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpmcQueue, QueueFixture, concurrent::NonFifoMpmcQueue<int>);
@@ -80,6 +94,134 @@ TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
     EXPECT_EQ(value, 2);
 }
 
+TYPED_UTEST_SUITE(BatchQueueTest, TestBatchQueueTypes);
+
+TYPED_UTEST(BatchQueueTest, PushPopBatch) {
+    auto queue = TypeParam::Create();
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<std::size_t> values{0, 1, 2, 3, 4};
+    EXPECT_EQ(producer.PushBatch(values), 5);
+    EXPECT_EQ(queue->GetSizeApproximate(), 5);
+
+    std::vector<std::size_t> popped;
+    EXPECT_EQ(consumer.PopBatch(popped, 3), 3);
+    EXPECT_EQ(consumer.PopBatch(popped, 10), 2);
+    EXPECT_EQ(popped, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(queue->GetSizeApproximate(), 0);
+
+    EXPECT_EQ(consumer.PopBatch(popped, 10, engine::Deadline::Passed()), 0);
+    EXPECT_EQ(popped.size(), 5);
+}
+
+TYPED_UTEST(BatchQueueTest, PopBatchAfterProducerIsDead) {
+    auto queue = TypeParam::Create();
+    auto consumer = queue->GetConsumer();
+
+    {
+        auto producer = queue->GetProducer();
+        std::vector<std::size_t> values{0, 1, 2};
+        EXPECT_EQ(producer.PushBatch(values), 3);
+    }
+
+    std::vector<std::size_t> popped;
+    EXPECT_EQ(consumer.PopBatch(popped, 10), 3);
+    EXPECT_EQ(consumer.PopBatch(popped, 10), 0);
+    EXPECT_EQ(popped, (std::vector<std::size_t>{0, 1, 2}));
+}
+
+TYPED_UTEST(BatchQueueTest, PushBatchConsumerIsDead) {
+    auto queue = TypeParam::Create();
+    auto producer = queue->GetProducer();
+    (void)(queue->GetConsumer());
+
+    std::vector<std::size_t> values{0, 1, 2};
+    EXPECT_EQ(producer.PushBatch(values), 0);
+}
+
+UTEST(BatchQueue, PushBatchPartial) {
+    auto queue = concurrent::NonFifoMpscQueue<std::unique_ptr<int>>::Create(2);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<std::unique_ptr<int>> values;
+    for (int i = 0; i < 3; ++i) values.push_back(std::make_unique<int>(i));
+
+    // Only 2 elements fit into the queue
+    EXPECT_EQ(producer.PushBatch(values, engine::Deadline::FromDuration(std::chrono::milliseconds{10})), 2);
+    EXPECT_FALSE(values[0]);
+    EXPECT_FALSE(values[1]);
+    ASSERT_TRUE(values[2]);
+    EXPECT_EQ(*values[2], 2);
+
+    std::vector<std::unique_ptr<int>> popped;
+    EXPECT_EQ(consumer.PopBatch(popped, 10), 2);
+    ASSERT_EQ(popped.size(), 2);
+    EXPECT_EQ(*popped[0], 0);
+    EXPECT_EQ(*popped[1], 1);
+}
+
+UTEST(BatchQueue, PushBatchByElementSize) {
+    auto queue = concurrent::StringStreamQueue::Create(10);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<std::string> values{"abc", "defg", "hi"};
+    EXPECT_EQ(producer.PushBatch(values), 3);
+    EXPECT_EQ(queue->GetSizeApproximate(), 9);
+
+    std::vector<std::string> popped;
+    EXPECT_EQ(consumer.PopBatch(popped, 2), 2);
+    EXPECT_EQ(queue->GetSizeApproximate(), 2);
+    EXPECT_EQ(consumer.PopBatch(popped, 2), 1);
+    EXPECT_EQ(popped, (std::vector<std::string>{"abc", "defg", "hi"}));
+}
+
+UTEST_MT(BatchQueue, MpmcBatches, kProducersCount + kConsumersCount) {
+    constexpr std::size_t kBatchSize = 16;
+    auto queue = concurrent::NonFifoMpmcQueue<std::size_t>::Create(kBatchSize * 4);
+    auto producer = queue->GetMultiProducer();
+    auto consumer = queue->GetMultiConsumer();
+
+    auto producer_tasks = utils::GenerateFixedArray(kProducersCount, [&](std::size_t producer_id) {
+        return engine::AsyncNoSpan([&, producer_id] {
+            std::vector<std::size_t> batch;
+            for (const auto message :
+                 boost::irange<std::size_t>(kMessageCount * producer_id, kMessageCount * (producer_id + 1))) {
+                batch.push_back(message);
+                if (batch.size() == kBatchSize) {
+                    ASSERT_EQ(producer.PushBatch(batch), kBatchSize);
+                    batch.clear();
+                }
+            }
+            ASSERT_EQ(producer.PushBatch(batch), batch.size());
+        });
+    });
+
+    auto consumer_tasks = utils::GenerateFixedArray(kConsumersCount, [&](std::size_t /*consumer_id*/) {
+        return engine::AsyncNoSpan([&] {
+            std::vector<std::size_t> received;
+            while (consumer.PopBatch(received, kBatchSize) != 0) {
+            }
+            return received;
+        });
+    });
+
+    for (auto& task : producer_tasks) {
+        UEXPECT_NO_THROW(task.Get());
+    }
+    std::move(producer).Reset();
+
+    std::unordered_set<std::size_t> total;
+    for (auto& task : consumer_tasks) {
+        for (const auto message : task.Get()) {
+            EXPECT_TRUE(total.insert(message).second) << "Duplicate message " << message;
+        }
+    }
+    EXPECT_EQ(total.size(), kProducersCount * kMessageCount) << "Likely missing messages";
+}
+
 UTEST(NonFifoMpmcQueue, ConsumerIsDead) {
     auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
     auto producer = queue->GetProducer();
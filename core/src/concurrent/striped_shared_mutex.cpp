@@ -0,0 +1,98 @@
+#include <userver/concurrent/striped_shared_mutex.hpp>
+
+#include <mutex>
+
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+// The algorithm is a variation of brlock with the counters of SRCU.
+//
+// A reader increments `shared_locks_` and then checks `writer_active_`, a
+// writer sets `writer_active_` and then checks the counters. The seq_cst fences
+// guarantee that either the reader sees the writer or the writer sees the
+// reader.
+//
+// A reader may increment the counters on different CPUs, so they can not be
+// read in a single snapshot. Because both counters only grow, reading
+// `shared_unlocks_` before `shared_locks_` gives an upper bound on the number
+// of unlocks and a lower bound on the number of locks, and their equality
+// means that there were no readers in between.
+
+StripedSharedMutex::StripedSharedMutex() = default;
+
+StripedSharedMutex::~StripedSharedMutex() = default;
+
+void StripedSharedMutex::lock() {
+    writer_mutex_.lock();
+    writer_active_.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const engine::TaskCancellationBlocker blocker;
+    while (HasReaders()) {
+        [[maybe_unused]] const bool is_signaled = readers_left_event_.WaitForEvent();
+    }
+}
+
+void StripedSharedMutex::unlock() {
+    writer_active_.store(false);
+    writer_mutex_.unlock();
+}
+
+bool StripedSharedMutex::try_lock() {
+    if (!writer_mutex_.try_lock()) return false;
+
+    writer_active_.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (HasReaders()) {
+        unlock();
+        return false;
+    }
+    return true;
+}
+
+void StripedSharedMutex::lock_shared() {
+    while (!TryEnterShared()) {
+        // Wait for the writer
+        const std::lock_guard lock(writer_mutex_);
+    }
+}
+
+void StripedSharedMutex::unlock_shared() {
+    // Orders the critical section before the unlock
+    std::atomic_thread_fence(std::memory_order_release);
+    shared_unlocks_.Add(1);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writer_active_.load(std::memory_order_relaxed)) {
+        readers_left_event_.Send();
+    }
+}
+
+bool StripedSharedMutex::try_lock_shared() { return TryEnterShared(); }
+
+bool StripedSharedMutex::HasReaders() const noexcept {
+    const auto unlocks = shared_unlocks_.Read();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto locks = shared_locks_.Read();
+    return locks != unlocks;
+}
+
+bool StripedSharedMutex::TryEnterShared() {
+    shared_locks_.Add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!writer_active_.load(std::memory_order_relaxed)) {
+        // Orders the critical section after the lock
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+
+    unlock_shared();
+    return false;
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#include <userver/concurrent/striped_shared_mutex.hpp>
+
+#include <mutex>
+#include <shared_mutex>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+template <typename Mutex>
+void shared_mutex_read_only(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        Mutex mutex;
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                const std::shared_lock lock(mutex);
+                benchmark::DoNotOptimize(lock);
+            }
+        });
+    });
+}
+BENCHMARK_TEMPLATE(shared_mutex_read_only, engine::SharedMutex)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK_TEMPLATE(shared_mutex_read_only, concurrent::StripedSharedMutex)->RangeMultiplier(2)->Range(1, 32);
+
+template <typename Mutex>
+void shared_mutex_read_mostly(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        Mutex mutex;
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            std::size_t i = 0;
+            for ([[maybe_unused]] auto _ : range) {
+                if (++i % 1000 == 0) {
+                    const std::lock_guard lock(mutex);
+                    benchmark::DoNotOptimize(lock);
+                } else {
+                    const std::shared_lock lock(mutex);
+                    benchmark::DoNotOptimize(lock);
+                }
+            }
+        });
+    });
+}
+BENCHMARK_TEMPLATE(shared_mutex_read_mostly, engine::SharedMutex)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK_TEMPLATE(shared_mutex_read_mostly, concurrent::StripedSharedMutex)->RangeMultiplier(2)->Range(1, 32);
+
+USERVER_NAMESPACE_END
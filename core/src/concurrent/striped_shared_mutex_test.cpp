@@ -0,0 +1,98 @@
+#include <userver/concurrent/striped_shared_mutex.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kThreads = 8;
+
+struct Pair final {
+    int first{0};
+    int second{0};
+};
+
+}  // namespace
+
+UTEST(StripedSharedMutex, LockShared) {
+    concurrent::StripedSharedMutex mutex;
+
+    std::shared_lock lock1(mutex);
+    std::shared_lock lock2(mutex);
+    EXPECT_FALSE(mutex.try_lock());
+
+    lock1.unlock();
+    EXPECT_FALSE(mutex.try_lock());
+
+    lock2.unlock();
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+UTEST(StripedSharedMutex, Lock) {
+    concurrent::StripedSharedMutex mutex;
+
+    std::unique_lock lock(mutex);
+    EXPECT_FALSE(mutex.try_lock_shared());
+    EXPECT_FALSE(mutex.try_lock());
+
+    lock.unlock();
+    EXPECT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+}
+
+UTEST(StripedSharedMutex, WriterWaitsForReaders) {
+    concurrent::StripedSharedMutex mutex;
+    std::shared_lock shared_lock(mutex);
+
+    auto writer = engine::AsyncNoSpan([&] { const std::lock_guard lock(mutex); });
+    engine::SleepFor(std::chrono::milliseconds{10});
+    EXPECT_FALSE(writer.IsFinished());
+
+    shared_lock.unlock();
+    UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST_MT(StripedSharedMutex, Stress, kThreads + 1) {
+    const auto test_deadline = engine::Deadline::FromDuration(std::chrono::milliseconds{100});
+    std::atomic<bool> keep_running{true};
+    concurrent::ReadMostlyVariable<Pair> data;
+
+    auto readers = utils::GenerateFixedArray(kThreads - 1, [&](std::size_t) {
+        return engine::AsyncNoSpan([&] {
+            while (keep_running) {
+                const auto value = data.SharedLock();
+                ASSERT_EQ(value->first, value->second);
+            }
+        });
+    });
+    auto writer = engine::AsyncNoSpan([&] {
+        while (keep_running) {
+            auto value = data.Lock();
+            ++value->first;
+            engine::Yield();
+            ++value->second;
+        }
+    });
+
+    engine::SleepUntil(test_deadline);
+    keep_running = false;
+    for (auto& reader : readers) UEXPECT_NO_THROW(reader.Get());
+    UEXPECT_NO_THROW(writer.Get());
+
+    const auto value = data.SharedLock();
+    EXPECT_GT(value->first, 0);
+    EXPECT_EQ(value->first, value->second);
+}
+
+USERVER_NAMESPACE_END
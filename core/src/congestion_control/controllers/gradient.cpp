@@ -0,0 +1,83 @@
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+
+// Same warm up as for the linear algorithm
+constexpr std::size_t kWarmUpEpochs = 30;
+
+// Exponential moving average over ~kWarmUpEpochs epochs
+constexpr double kLongRttFactor = 2.0 / (kWarmUpEpochs + 1);
+
+constexpr double kMinGradient = 0.5;
+constexpr double kErrorsBackoff = 0.9;
+
+}  // namespace
+
+Limit GradientEstimator::Update(const Sensor::Data& current, const Config& config) {
+    const auto current_load = current.current_load;
+    if (current.total < config.min_qps && !current_limit_) {
+        // Too little QPS, timings avg data is VERY noisy
+        return {current_limit_, current_load};
+    }
+
+    // Tiny timings are mostly noise
+    const auto rtt = static_cast<double>(std::max<std::size_t>(current.timings_avg_ms, config.min_timings.count()));
+
+    if (epochs_passed_ < kWarmUpEpochs) {
+        ++epochs_passed_;
+        UpdateLongRtt(rtt);
+        return {std::nullopt, current_load};
+    }
+
+    const bool has_errors = 100 * current.GetRate() > config.errors_threshold_percent;
+    const double gradient = std::clamp(config.rtt_tolerance * long_rtt_ms_ / rtt, kMinGradient, 1.0);
+    const bool is_congested = has_errors || gradient < 1.0;
+
+    if (!is_congested) {
+        // The long RTT is sticky to "good" timings
+        UpdateLongRtt(rtt);
+    }
+
+    if (!current_limit_) {
+        if (!is_congested) return {std::nullopt, current_load};
+        estimated_limit_ = std::max<double>(current_load, config.min_limit);
+    }
+
+    double new_limit = has_errors ? estimated_limit_ * kErrorsBackoff
+                                  : estimated_limit_ * gradient + std::sqrt(estimated_limit_);
+    if (new_limit > estimated_limit_ && current_load * 2 < estimated_limit_) {
+        // Do not grow the limit that the load does not reach
+        new_limit = estimated_limit_;
+    }
+    estimated_limit_ = estimated_limit_ * (1 - config.smoothing) + new_limit * config.smoothing;
+    estimated_limit_ = std::max<double>(estimated_limit_, config.min_limit);
+
+    if (!is_congested && estimated_limit_ > current_load + config.safe_delta_limit) {
+        current_limit_.reset();
+    } else {
+        current_limit_ = std::lround(estimated_limit_);
+    }
+
+    return {current_limit_, current_load};
+}
+
+void GradientEstimator::Reset() noexcept { *this = GradientEstimator{}; }
+
+void GradientEstimator::UpdateLongRtt(double rtt) noexcept {
+    if (long_rtt_ms_ == 0) {
+        long_rtt_ms_ = rtt;
+    } else {
+        long_rtt_ms_ += (rtt - long_rtt_ms_) * kLongRttFactor;
+    }
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Simulated dependency: the timings grow linearly with the in-flight count
+// above kCapacity, requests slower than kTimeoutMs time out.
+constexpr std::size_t kCapacity = 100;
+constexpr std::size_t kBaseTimingsMs = 50;
+constexpr std::size_t kTimeoutMs = 5 * kBaseTimingsMs;
+constexpr std::size_t kRequestsPerEpoch = 1000;
+
+struct EpochResult final {
+    congestion_control::v2::Sensor::Data data;
+    std::size_t served{0};
+};
+
+EpochResult SimulateEpoch(std::size_t offered_load, std::optional<std::size_t> limit) {
+    const auto in_flight = limit ? std::min(offered_load, *limit) : offered_load;
+    const auto timings = kBaseTimingsMs * std::max<std::size_t>(in_flight, kCapacity) / kCapacity;
+
+    EpochResult result;
+    result.data.current_load = in_flight;
+    result.data.timings_avg_ms = timings;
+    result.data.total = kRequestsPerEpoch * in_flight / std::max<std::size_t>(offered_load, 1);
+    result.data.timeouts = timings > kTimeoutMs ? result.data.total : 0;
+    result.served = result.data.total - result.data.timeouts;
+    return result;
+}
+
+// Args: offered load in percents of kCapacity, rtt-tolerance * 10, smoothing * 100
+void GradientSimulation(benchmark::State& state) {
+    const std::size_t overload = kCapacity * state.range(0) / 100;
+    congestion_control::v2::Config config;
+    config.algorithm = congestion_control::v2::Algorithm::kGradient;
+    config.rtt_tolerance = state.range(1) / 10.0;
+    config.smoothing = state.range(2) / 100.0;
+
+    congestion_control::v2::GradientEstimator estimator;
+    std::optional<std::size_t> limit;
+    std::size_t epochs = 0;
+    std::size_t served = 0;
+    std::size_t timings_sum = 0;
+    std::size_t limit_sum = 0;
+
+    for ([[maybe_unused]] auto _ : state) {
+        // Normal load for warm up, then a sustained overload
+        const auto offered_load = (epochs < 60 ? kCapacity / 2 : overload);
+        const auto result = SimulateEpoch(offered_load, limit);
+        limit = estimator.Update(result.data, config).load_limit;
+
+        ++epochs;
+        served += result.served;
+        timings_sum += result.data.timings_avg_ms;
+        limit_sum += limit.value_or(offered_load);
+    }
+
+    state.counters["served_per_epoch"] = static_cast<double>(served) / epochs;
+    state.counters["avg_timings_ms"] = static_cast<double>(timings_sum) / epochs;
+    state.counters["avg_limit"] = static_cast<double>(limit_sum) / epochs;
+}
+
+}  // namespace
+
+BENCHMARK(GradientSimulation)->ArgsProduct({{150, 300, 1000}, {11, 15, 20}, {10, 20, 50}})->Iterations(10000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,132 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+congestion_control::v2::Config MakeGradientConfig() {
+    congestion_control::v2::Config config;
+    config.algorithm = congestion_control::v2::Algorithm::kGradient;
+    return config;
+}
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t timings_ms, std::size_t load) {
+    congestion_control::v2::Sensor::Data data;
+    data.timings_avg_ms = timings_ms;
+    data.current_load = load;
+    data.total = 1000;
+    return data;
+}
+
+void WarmUp(congestion_control::v2::GradientEstimator& estimator, const congestion_control::v2::Config& config) {
+    for (std::size_t i = 0; i < 30; ++i) {
+        EXPECT_EQ(estimator.Update(MakeData(100, 100), config).load_limit, std::nullopt) << i;
+    }
+}
+
+}  // namespace
+
+TEST(CCGradient, Zero) {
+    congestion_control::v2::GradientEstimator estimator;
+    const auto config = MakeGradientConfig();
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(estimator.Update({}, config).load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCGradient, StableTimings) {
+    congestion_control::v2::GradientEstimator estimator;
+    const auto config = MakeGradientConfig();
+    WarmUp(estimator, config);
+
+    // Timings within the tolerance are not a congestion
+    for (std::size_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(estimator.Update(MakeData(140, 100), config).load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCGradient, TimingsGrowth) {
+    congestion_control::v2::GradientEstimator estimator;
+    const auto config = MakeGradientConfig();
+    WarmUp(estimator, config);
+
+    auto limit = estimator.Update(MakeData(300, 200), config).load_limit;
+    ASSERT_NE(limit, std::nullopt);
+    EXPECT_LT(*limit, 200);
+
+    for (std::size_t i = 0; i < 100; ++i) {
+        const auto new_limit = estimator.Update(MakeData(300, 200), config).load_limit;
+        ASSERT_NE(new_limit, std::nullopt) << i;
+        EXPECT_LE(*new_limit, *limit) << i;
+        EXPECT_GE(*new_limit, config.min_limit) << i;
+        limit = new_limit;
+    }
+    EXPECT_EQ(limit, config.min_limit);
+
+    // Back to normal, the limit grows and is dropped
+    bool deactivated = false;
+    for (std::size_t i = 0; i < 1000 && !deactivated; ++i) {
+        deactivated = !estimator.Update(MakeData(100, 50), config).load_limit;
+    }
+    EXPECT_TRUE(deactivated);
+
+    for (std::size_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(estimator.Update(MakeData(100, 50), config).load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCGradient, Errors) {
+    congestion_control::v2::GradientEstimator estimator;
+    const auto config = MakeGradientConfig();
+    WarmUp(estimator, config);
+
+    auto data = MakeData(100, 100);
+    data.timeouts = data.total / 10;
+    const auto limit = estimator.Update(data, config).load_limit;
+    ASSERT_NE(limit, std::nullopt);
+    EXPECT_LT(*limit, 100);
+}
+
+TEST(CCGradient, SelectedByConfig) {
+    class FakeSensor final : public congestion_control::v2::Sensor {
+        Data GetCurrent() override { return {}; }
+    } sensor;
+    class FakeLimiter final : public congestion_control::Limiter {
+        void SetLimit(const congestion_control::Limit&) override {}
+    } limiter;
+    congestion_control::v2::Stats stats;
+
+    congestion_control::v2::LinearController controller(
+        "test", sensor, limiter, stats, {}, dynamic_config::GetDefaultSource(), [](auto) { return MakeGradientConfig(); }
+    );
+
+    for (std::size_t i = 0; i < 30; ++i) {
+        EXPECT_EQ(controller.Update(MakeData(100, 100)).load_limit, std::nullopt) << i;
+    }
+
+    // The linear algorithm waits for 5 times growth of the timings
+    EXPECT_NE(controller.Update(MakeData(300, 100)).load_limit, std::nullopt);
+}
+
+TEST(CCGradient, ConfigParsing) {
+    const auto config = formats::json::FromString(R"({"algorithm": "gradient", "rtt-tolerance": 2.5, "smoothing": 0.5})")
+                            .As<congestion_control::v2::Config>();
+    EXPECT_EQ(config.algorithm, congestion_control::v2::Algorithm::kGradient);
+    EXPECT_DOUBLE_EQ(config.rtt_tolerance, 2.5);
+    EXPECT_DOUBLE_EQ(config.smoothing, 0.5);
+
+    EXPECT_EQ(
+        formats::json::FromString("{}").As<congestion_control::v2::Config>().algorithm,
+        congestion_control::v2::Algorithm::kLinear
+    );
+    EXPECT_ANY_THROW(formats::json::FromString(R"({"algorithm": "vegas"})").As<congestion_control::v2::Config>());
+    EXPECT_ANY_THROW(formats::json::FromString(R"({"smoothing": 0})").As<congestion_control::v2::Config>());
+}
+
+USERVER_NAMESPACE_END
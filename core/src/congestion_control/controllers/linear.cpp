@@ -33,6 +33,23 @@ Limit LinearController::Update(const Sensor::Data& current) {
     auto dyn_config = config_source_.GetSnapshot();
     v2::Config config = config_getter_(dyn_config);
 
+    if (config.algorithm != algorithm_) {
+        LOG_WARNING() << GetName() << " Congestion Control algorithm is switched, restarting the estimation";
+        algorithm_ = config.algorithm;
+        current_limit_.reset();
+        epochs_passed_ = 0;
+        gradient_.Reset();
+    }
+    if (algorithm_ == Algorithm::kGradient) {
+        const bool was_active = current_limit_.has_value();
+        auto limit = gradient_.Update(current, config);
+        current_limit_ = limit.load_limit;
+        if (was_active != current_limit_.has_value()) {
+            LOG_ERROR() << GetName() << " Congestion Control is " << (was_active ? "deactivated" : "activated");
+        }
+        return limit;
+    }
+
     auto rate = current.GetRate();
 
     short_timings_.Update(current.timings_avg_ms);
@@ -1,19 +1,39 @@
 #include <userver/congestion_control/controllers/linear_config.hpp>
 
 #include <userver/dynamic_config/value.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace congestion_control::v2 {
 
+namespace {
+
+constexpr utils::TrivialBiMap kAlgorithms = [](auto selector) {
+    return selector().Case("linear", Algorithm::kLinear).Case("gradient", Algorithm::kGradient);
+};
+
+}  // namespace
+
 Config Parse(const formats::json::Value& value, formats::parse::To<Config>) {
     Config result;
+    if (!value["algorithm"].IsMissing()) {
+        result.algorithm = utils::ParseFromValueString(value["algorithm"], kAlgorithms);
+    }
     result.errors_threshold_percent = value["errors-threshold-percent"].As<double>(5.0);
     result.safe_delta_limit = value["deactivate-delta"].As<std::size_t>(10);
     result.timings_burst_threshold = value["timings-burst-times-threshold"].As<double>(5);
     result.min_timings = std::chrono::milliseconds(value["min-timings-ms"].As<std::size_t>(20));
     result.min_limit = value["min-limit"].As<std::size_t>(10);
     result.min_qps = value["min-qps"].As<std::size_t>(10);
+    result.rtt_tolerance = value["rtt-tolerance"].As<double>(result.rtt_tolerance);
+    result.smoothing = value["smoothing"].As<double>(result.smoothing);
+    if (result.rtt_tolerance < 1.0) {
+        throw formats::json::ParseException("rtt-tolerance must be at least 1.0 at " + value.GetPath());
+    }
+    if (result.smoothing <= 0.0 || result.smoothing > 1.0) {
+        throw formats::json::ParseException("smoothing must be in (0, 1] at " + value.GetPath());
+    }
     return result;
 }
 
@@ -220,6 +220,17 @@ void easy::do_ev_cancel(size_t request_num) {
     }
 }
 
+void easy::unpause() {
+    UASSERT(GetThreadControl().IsInEvThread());
+    if (!multi_registered_) return;
+
+    // May synchronously invoke the read and write callbacks
+    const auto code = native::curl_easy_pause(handle_, CURLPAUSE_CONT);
+    if (code != native::CURLE_OK) {
+        LOG_WARNING() << "Failed to resume the paused transfer: " << native::curl_easy_strerror(code);
+    }
+}
+
 void easy::reset() {
     LOG_TRACE() << "easy::reset start " << this;
 
@@ -230,7 +241,6 @@ void easy::reset() {
     if (proxy_headers_) proxy_headers_->clear();
     if (http200_aliases_) http200_aliases_->clear();
     if (resolved_hosts_) resolved_hosts_->clear();
-    share_.reset();
     retries_count_ = 0;
     sockets_opened_ = 0;
     rate_limit_error_.clear();
@@ -250,6 +260,8 @@ void easy::reset() {
 
     UASSERT(!multi_registered_);
     native::curl_easy_reset(handle_);
+    // Detached from the share by curl_easy_reset(), so it may be destroyed now
+    share_.reset();
     set_private(this);
 
     LOG_TRACE() << "easy::reset finished " << this;
@@ -590,7 +602,7 @@ void easy::set_share(std::shared_ptr<share> share) {
 void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
     share_ = std::move(share);
 
-    if (share) {
+    if (share_) {
         ec = std::error_code{static_cast<errc::EasyErrorCode>(
             native::curl_easy_setopt(handle_, native::CURLOPT_SHARE, share_->native_handle())
         )};
@@ -600,6 +612,15 @@ void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
     }
 }
 
+void* easy::get_openssl_ssl_ptr() {
+    native::curl_tlssessioninfo* info = nullptr;
+    const auto code = native::curl_easy_getinfo(handle_, native::CURLINFO_TLS_SSL_PTR, &info);
+    if (code != native::CURLE_OK || !info || info->backend != native::CURLSSLBACKEND_OPENSSL) {
+        return nullptr;
+    }
+    return info->internals;
+}
+
 bool easy::has_post_data() const { return !post_fields_.empty() || form_; }
 
 const std::string& easy::get_post_data() const { return post_fields_; }
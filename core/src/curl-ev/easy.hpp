@@ -223,6 +223,9 @@ public:
     void perform(std::error_code& ec);
     void async_perform(handler_type handler);
     void cancel();
+    // Resumes the transfer paused by CURL_READFUNC_PAUSE or CURL_WRITEFUNC_PAUSE
+    // returned from the callbacks. Should be called from the ev thread.
+    void unpause();
     void reset();
     void set_source(std::shared_ptr<std::istream> source);
     void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
@@ -649,7 +652,9 @@ public:
     IMPLEMENT_CURL_OPTION_GET_LONG(get_local_port, native::CURLINFO_LOCAL_PORT);
     // CURLINFO_TLS_SESSION
     // CURLINFO_ACTIVESOCKET
-    // CURLINFO_TLS_SSL_PTR
+    // Returns the OpenSSL `SSL*` of the connection in use or nullptr if there
+    // is none, if it is not a TLS one or if other TLS backend is used
+    void* get_openssl_ssl_ptr();
     IMPLEMENT_CURL_OPTION_GET_LONG(get_http_version, native::CURLINFO_HTTP_VERSION);
     IMPLEMENT_CURL_OPTION_GET_LONG(get_proxy_ssl_verifyresult, native::CURLINFO_PROXY_SSL_VERIFYRESULT);
     IMPLEMENT_CURL_OPTION_GET_LONG(get_protocol, native::CURLINFO_PROTOCOL);
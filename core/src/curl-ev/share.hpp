@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <mutex>
 
@@ -41,7 +42,9 @@ private:
     static void unlock(native::CURL* handle, native::curl_lock_data data, void* userptr);
 
     native::CURLSH* handle_;
-    std::mutex mutex_;
+    // Separate locks let the IO threads resolve names and resume TLS sessions
+    // concurrently
+    std::array<std::mutex, native::CURL_LOCK_DATA_LAST> mutexes_;
 };
 }  // namespace curl
 
@@ -0,0 +1,176 @@
+#include <userver/dist_lock/dist_lock_group.hpp>
+
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+namespace impl {
+
+class LockBatcher final {
+public:
+    LockBatcher(std::shared_ptr<DistLockGroupStrategyBase> strategy, std::chrono::milliseconds max_batch_delay)
+        : strategy_(std::move(strategy)), max_batch_delay_(max_batch_delay) {
+        UASSERT(strategy_);
+        task_ = engine::CriticalAsyncNoSpan([this] { Run(); });
+    }
+
+    engine::Future<void> Enqueue(GroupLockRequest&& request) {
+        engine::Promise<void> promise;
+        auto future = promise.get_future();
+        {
+            std::lock_guard lock(mutex_);
+            pending_.push_back({std::move(request), std::move(promise)});
+        }
+        cv_.NotifyOne();
+        return future;
+    }
+
+    void Release(const std::string& lock_name, const std::string& locker_id) {
+        strategy_->Release(lock_name, locker_id);
+    }
+
+private:
+    struct Pending {
+        GroupLockRequest request;
+        engine::Promise<void> promise;
+    };
+
+    void Run() {
+        while (!engine::current_task::ShouldCancel()) {
+            {
+                std::unique_lock lock(mutex_);
+                if (!cv_.Wait(lock, [this] { return !pending_.empty(); })) break;
+            }
+
+            // Let the other lockers join the batch
+            engine::InterruptibleSleepFor(max_batch_delay_);
+            if (engine::current_task::ShouldCancel()) break;
+
+            Flush(TakeBatch());
+        }
+        // Remaining promises are broken on destruction
+    }
+
+    // Same lock from different lockers goes into different batches, as a single
+    // upsert may not touch the same row twice
+    std::vector<Pending> TakeBatch() {
+        std::vector<Pending> batch;
+        std::lock_guard lock(mutex_);
+
+        std::unordered_set<std::string> lock_names;
+        std::vector<Pending> postponed;
+        for (auto& pending : pending_) {
+            if (lock_names.insert(pending.request.lock_name).second) {
+                batch.push_back(std::move(pending));
+            } else {
+                postponed.push_back(std::move(pending));
+            }
+        }
+        pending_ = std::move(postponed);
+        return batch;
+    }
+
+    void Flush(std::vector<Pending>&& batch) {
+        tracing::Span span("dist_lock_group_acquire");
+        span.AddTag("batch_size", batch.size());
+
+        std::vector<GroupLockRequest> requests;
+        requests.reserve(batch.size());
+        for (const auto& pending : batch) requests.push_back(pending.request);
+
+        std::vector<bool> acquired;
+        try {
+            acquired = strategy_->AcquireMany(requests);
+            if (acquired.size() != batch.size()) {
+                throw std::logic_error(fmt::format(
+                    "AcquireMany returned {} results for {} requests", acquired.size(), batch.size()
+                ));
+            }
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "Batched lock acquisition of " << batch.size() << " locks failed: " << ex;
+            const auto exception = std::current_exception();
+            for (auto& pending : batch) pending.promise.set_exception(exception);
+            return;
+        }
+
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            if (acquired[i]) {
+                batch[i].promise.set_value();
+            } else {
+                batch[i].promise.set_exception(std::make_exception_ptr(LockIsAcquiredByAnotherHostException{}));
+            }
+        }
+    }
+
+    const std::shared_ptr<DistLockGroupStrategyBase> strategy_;
+    const std::chrono::milliseconds max_batch_delay_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable cv_;
+    std::vector<Pending> pending_;
+
+    // Must be the last member, the task is stopped first on destruction
+    engine::TaskWithResult<void> task_;
+};
+
+}  // namespace impl
+
+namespace {
+
+class GroupMemberStrategy final : public DistLockStrategyBase {
+public:
+    GroupMemberStrategy(std::shared_ptr<impl::LockBatcher> batcher, std::string lock_name)
+        : batcher_(std::move(batcher)), lock_name_(std::move(lock_name)) {}
+
+    void Acquire(std::chrono::milliseconds lock_ttl, const std::string& locker_id) override {
+        batcher_->Enqueue({lock_name_, locker_id, lock_ttl}).get();
+    }
+
+    void Release(const std::string& locker_id) override { batcher_->Release(lock_name_, locker_id); }
+
+private:
+    const std::shared_ptr<impl::LockBatcher> batcher_;
+    const std::string lock_name_;
+};
+
+}  // namespace
+
+DistLockGroup::DistLockGroup(
+    std::shared_ptr<DistLockGroupStrategyBase> strategy,
+    std::chrono::milliseconds max_batch_delay
+)
+    : batcher_(std::make_shared<impl::LockBatcher>(std::move(strategy), max_batch_delay)) {}
+
+DistLockGroup::DistLockGroup(DistLockGroup&&) noexcept = default;
+
+DistLockGroup& DistLockGroup::operator=(DistLockGroup&&) noexcept = default;
+
+DistLockGroup::~DistLockGroup() = default;
+
+std::shared_ptr<DistLockStrategyBase> DistLockGroup::MakeStrategy(std::string lock_name) const {
+    UASSERT(batcher_);
+    return std::make_shared<GroupMemberStrategy>(batcher_, std::move(lock_name));
+}
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,193 @@
+#include <userver/dist_lock/dist_lock_group.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/dist_lock/dist_lock_settings.hpp>
+#include <userver/dist_lock/dist_locked_worker.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kAttemptInterval{10};
+constexpr std::chrono::milliseconds kLockTtl{100};
+constexpr std::chrono::milliseconds kMaxBatchDelay{5};
+constexpr auto kAttemptTimeout = 5 * kAttemptInterval;
+
+dist_lock::DistLockSettings MakeSettings() {
+    return {kAttemptInterval, kAttemptInterval, kLockTtl, kAttemptInterval, kAttemptInterval};
+}
+
+/// [Sample distlock group strategy]
+class MockDistLockGroupStrategy final : public dist_lock::DistLockGroupStrategyBase {
+public:
+    std::vector<bool> AcquireMany(const std::vector<dist_lock::GroupLockRequest>& requests) override {
+        batches_++;
+        requests_ += requests.size();
+        if (!allowed_) throw std::runtime_error("not allowed");
+
+        std::vector<bool> result;
+        result.reserve(requests.size());
+        auto owners = owners_var_.Lock();
+        for (const auto& request : requests) {
+            auto& owner = (*owners)[request.lock_name];
+            if (owner.empty()) owner = request.locker_id;
+            result.push_back(owner == request.locker_id);
+        }
+        return result;
+    }
+
+    void Release(const std::string& lock_name, const std::string& locker_id) override {
+        auto owners = owners_var_.Lock();
+        auto& owner = (*owners)[lock_name];
+        if (owner == locker_id) owner.clear();
+    }
+
+    void Allow(bool allowed) { allowed_ = allowed; }
+
+    void SetLockedBy(const std::string& lock_name, const std::string& whom) {
+        auto owners = owners_var_.Lock();
+        (*owners)[lock_name] = whom;
+    }
+
+    std::size_t GetBatchesCount() const { return batches_; }
+    std::size_t GetRequestsCount() const { return requests_; }
+
+private:
+    concurrent::Variable<std::unordered_map<std::string, std::string>> owners_var_;
+    std::atomic<bool> allowed_{true};
+    std::atomic<std::size_t> batches_{0};
+    std::atomic<std::size_t> requests_{0};
+};
+/// [Sample distlock group strategy]
+
+bool WaitFor(const std::function<bool()>& predicate, std::chrono::milliseconds timeout) {
+    const auto deadline = utils::datetime::SteadyNow() + timeout;
+    while (!predicate()) {
+        if (utils::datetime::SteadyNow() > deadline) return false;
+        engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+
+}  // namespace
+
+UTEST_MT(DistLockGroup, BatchesManyLocks, 3) {
+    constexpr std::size_t kLocks = 50;
+    auto strategy = std::make_shared<MockDistLockGroupStrategy>();
+
+    /// [Sample distlock group]
+    dist_lock::DistLockGroup group{strategy, kMaxBatchDelay};
+
+    std::atomic<std::size_t> working{0};
+    std::vector<std::unique_ptr<dist_lock::DistLockedWorker>> workers;
+    for (std::size_t i = 0; i < kLocks; ++i) {
+        auto lock_name = "shard-" + std::to_string(i);
+        workers.push_back(std::make_unique<dist_lock::DistLockedWorker>(
+            lock_name,
+            [&working] {
+                ++working;
+                while (!engine::current_task::ShouldCancel()) {
+                    engine::InterruptibleSleepFor(kAttemptInterval);
+                }
+                --working;
+            },
+            group.MakeStrategy(lock_name),
+            MakeSettings()
+        ));
+        workers.back()->Start();
+    }
+    /// [Sample distlock group]
+
+    EXPECT_TRUE(WaitFor([&] { return working == kLocks; }, utest::kMaxTestWaitTime));
+    engine::SleepFor(kLockTtl);
+    EXPECT_EQ(working, kLocks) << "no lock must be lost";
+
+    EXPECT_LT(strategy->GetBatchesCount() * 3, strategy->GetRequestsCount());
+
+    for (auto& worker : workers) worker->Stop();
+    EXPECT_EQ(working, 0);
+}
+
+UTEST_MT(DistLockGroup, LockedByOther, 3) {
+    auto strategy = std::make_shared<MockDistLockGroupStrategy>();
+    dist_lock::DistLockGroup group{strategy, kMaxBatchDelay};
+    strategy->SetLockedBy("lock", "other");
+
+    std::atomic<bool> working{false};
+    dist_lock::DistLockedWorker worker(
+        "lock", [&working] { working = true; }, group.MakeStrategy("lock"), MakeSettings()
+    );
+    worker.Start();
+    EXPECT_FALSE(WaitFor([&] { return working.load(); }, kAttemptTimeout));
+
+    strategy->Release("lock", "other");
+    EXPECT_TRUE(WaitFor([&] { return working.load(); }, utest::kMaxTestWaitTime));
+    worker.Stop();
+}
+
+UTEST_MT(DistLockGroup, SameLockOnce, 3) {
+    auto strategy = std::make_shared<MockDistLockGroupStrategy>();
+    dist_lock::DistLockGroup group{strategy, kMaxBatchDelay};
+
+    std::atomic<std::size_t> working{0};
+    std::atomic<std::size_t> max_working{0};
+    const auto work = [&] {
+        const auto current = ++working;
+        if (current > max_working) max_working = current;
+        while (!engine::current_task::ShouldCancel()) engine::InterruptibleSleepFor(kAttemptInterval);
+        --working;
+    };
+
+    dist_lock::DistLockedWorker first("lock", work, group.MakeStrategy("lock"), MakeSettings());
+    dist_lock::DistLockedWorker second("lock", work, group.MakeStrategy("lock"), MakeSettings());
+    first.Start();
+    second.Start();
+
+    EXPECT_TRUE(WaitFor([&] { return working == 1; }, utest::kMaxTestWaitTime));
+    engine::SleepFor(kAttemptTimeout);
+    EXPECT_EQ(max_working, 1);
+    EXPECT_NE(first.OwnsLock(), second.OwnsLock());
+
+    first.Stop();
+    second.Stop();
+}
+
+UTEST_MT(DistLockGroup, BatchFailure, 3) {
+    auto strategy = std::make_shared<MockDistLockGroupStrategy>();
+    dist_lock::DistLockGroup group{strategy, kMaxBatchDelay};
+
+    std::atomic<bool> working{false};
+    dist_lock::DistLockedWorker worker(
+        "lock",
+        [&working] {
+            working = true;
+            while (!engine::current_task::ShouldCancel()) engine::InterruptibleSleepFor(kAttemptInterval);
+            working = false;
+        },
+        group.MakeStrategy("lock"),
+        MakeSettings()
+    );
+    worker.Start();
+    EXPECT_TRUE(WaitFor([&] { return working.load(); }, utest::kMaxTestWaitTime));
+
+    strategy->Allow(false);
+    EXPECT_TRUE(WaitFor([&] { return !working.load(); }, utest::kMaxTestWaitTime));
+
+    strategy->Allow(true);
+    EXPECT_TRUE(WaitFor([&] { return working.load(); }, utest::kMaxTestWaitTime));
+    worker.Stop();
+}
+
+USERVER_NAMESPACE_END
@@ -84,6 +84,15 @@ TEST(DumpCommonContainers, UnorderedMap) {
     TestWriteReadCycle(std::unordered_map<bool, bool>{});
 }
 
+TEST(DumpCommonContainers, PersistentHashMap) {
+    TestWriteReadCycle(cache::PersistentHashMap<int, std::string>{});
+
+    cache::PersistentHashMap<std::string, int> map;
+    map.insert_or_assign("a", 1);
+    map.insert_or_assign("b", 2);
+    TestWriteReadCycle(map);
+}
+
 TEST(DumpCommonContainers, Set) {
     TestWriteReadCycle(std::set<int>{1, 2, 5});
     TestWriteReadCycle(std::set<std::string>{"a", "b", "bb"});
@@ -18,6 +18,9 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kMmapReads = "mmap-reads";
+constexpr std::string_view kCompressed = "compressed";
+constexpr std::string_view kMaxDeltaCount = "max-delta-count";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
@@ -61,6 +64,9 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config, std::str
       max_dump_age(config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      mmap_reads(config[kMmapReads].As<bool>(false)),
+      dump_is_compressed(config[kCompressed].As<bool>(false)),
+      max_delta_count(config[kMaxDeltaCount].As<uint64_t>(0)),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
     if (max_dump_age && *max_dump_age <= std::chrono::milliseconds::zero()) {
@@ -69,6 +75,12 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config, std::str
     if (max_dump_count == 0) {
         throw std::logic_error(fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
     }
+    if (mmap_reads && dump_is_encrypted) {
+        throw std::logic_error(fmt::format("{}: {} is not supported for {} dumps", this->name, kMmapReads, kEncrypted));
+    }
+    if (mmap_reads && dump_is_compressed) {
+        throw std::logic_error(fmt::format("{}: {} is not supported for {} dumps", this->name, kMmapReads, kCompressed));
+    }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
@@ -1,6 +1,8 @@
 #include <dump/dump_locator.hpp>
 
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -20,13 +22,32 @@ namespace dump {
 namespace {
 
 const std::string kTimeZone = "UTC";
+const std::string kDateRegex = R"(\d{4}-\d{2}-\d{2}T\d{2}:?\d{2}:?\d{2}\.\d{6}Z?)";
+const std::string kDeltaInfix = ".delta-";
+
+std::string Filename(const std::string& full_path) { return boost::filesystem::path{full_path}.filename().string(); }
+
+std::chrono::system_clock::time_point ParseFilenameDate(const std::string& date_string) {
+    const auto date_format =
+        date_string.find(':') == std::string::npos ? kFilenameDateFormat : kLegacyFilenameDateFormat;
+    return utils::datetime::Stringtime(date_string, kTimeZone, date_format);
+}
+
+void WarnIfTimeGoesBack(const std::string& name, TimePoint old_update_time, TimePoint new_update_time) {
+    if (new_update_time < old_update_time) {
+        LOG_WARNING() << name << ": new_update_time < old_update_time, new="
+                      << utils::datetime::Timestring(new_update_time, kTimeZone, kFilenameDateFormat)
+                      << ", old=" << utils::datetime::Timestring(old_update_time, kTimeZone, kFilenameDateFormat);
+    }
+}
 
 }  // namespace
 
 DumpLocator::DumpLocator(Config static_config)
     : config_(static_config),
       filename_regex_(GenerateFilenameRegex(FileFormatType::kNormal)),
-      tmp_filename_regex_(GenerateFilenameRegex(FileFormatType::kTmp)) {}
+      tmp_filename_regex_(GenerateFilenameRegex(FileFormatType::kTmp)),
+      delta_filename_regex_(GenerateDeltaFilenameRegex()) {}
 
 DumpFileStats DumpLocator::RegisterNewDump(TimePoint update_time) {
     std::string dump_path = GenerateDumpPath(update_time);
@@ -48,6 +69,18 @@ DumpFileStats DumpLocator::RegisterNewDump(TimePoint update_time) {
     return {update_time, std::move(dump_path), config_.dump_format_version};
 }
 
+DumpFileStats DumpLocator::RegisterNewDelta(const DumpFileStats& base, TimePoint update_time) {
+    std::string delta_path = GenerateDeltaPath(base.full_path, update_time);
+
+    if (boost::filesystem::exists(delta_path)) {
+        throw std::runtime_error(fmt::format(
+            "{}: could not write a delta to \"{}\", because the file already exists", config_.name, delta_path
+        ));
+    }
+
+    return {update_time, std::move(delta_path), base.format_version};
+}
+
 std::optional<DumpFileStats> DumpLocator::GetLatestDump() const {
     try {
         std::optional<DumpFileStats> stats = GetLatestDumpImpl();
@@ -65,16 +98,36 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDump() const {
     }
 }
 
-bool DumpLocator::BumpDumpTime(TimePoint old_update_time, TimePoint new_update_time) {
-    if (new_update_time < old_update_time) {
-        LOG_WARNING() << config_.name << ": new_update_time < old_update_time, new="
-                      << utils::datetime::Timestring(new_update_time, kTimeZone, kFilenameDateFormat)
-                      << ", old=" << utils::datetime::Timestring(old_update_time, kTimeZone, kFilenameDateFormat);
+std::vector<DumpFileStats> DumpLocator::GetDeltas(const DumpFileStats& base) const {
+    const auto base_filename = Filename(base.full_path);
+    std::vector<DumpFileStats> deltas;
+
+    for (const auto& file : boost::filesystem::directory_iterator{config_.dump_directory}) {
+        if (!boost::filesystem::is_regular_file(file.status())) continue;
+
+        auto delta = ParseDeltaName(file.path().string());
+        if (delta && delta->base_filename == base_filename) deltas.push_back(std::move(delta->delta));
     }
 
-    const std::string old_name = GenerateDumpPath({old_update_time});
-    const std::string new_name = GenerateDumpPath({new_update_time});
+    std::sort(deltas.begin(), deltas.end(), [](const DumpFileStats& a, const DumpFileStats& b) {
+        return a.update_time < b.update_time;
+    });
+    return deltas;
+}
+
+bool DumpLocator::BumpDumpTime(TimePoint old_update_time, TimePoint new_update_time) {
+    WarnIfTimeGoesBack(config_.name, old_update_time, new_update_time);
+    return RenameDump(GenerateDumpPath({old_update_time}), GenerateDumpPath({new_update_time}));
+}
+
+bool DumpLocator::BumpDeltaTime(const DumpFileStats& base, TimePoint old_update_time, TimePoint new_update_time) {
+    WarnIfTimeGoesBack(config_.name, old_update_time, new_update_time);
+    return RenameDump(
+        GenerateDeltaPath(base.full_path, old_update_time), GenerateDeltaPath(base.full_path, new_update_time)
+    );
+}
 
+bool DumpLocator::RenameDump(const std::string& old_name, const std::string& new_name) {
     try {
         if (!boost::filesystem::is_regular_file(old_name)) {
             LOG_WARNING() << config_.name << ": the previous dump \"" << old_name
@@ -94,6 +147,7 @@ bool DumpLocator::BumpDumpTime(TimePoint old_update_time, TimePoint new_update_t
 void DumpLocator::Cleanup() {
     const auto min_update_time = MinAcceptableUpdateTime();
     std::vector<DumpFileStats> dumps;
+    std::vector<DeltaFileStats> deltas;
 
     try {
         if (!boost::filesystem::exists(config_.dump_directory)) {
@@ -114,6 +168,11 @@ void DumpLocator::Cleanup() {
                 continue;
             }
 
+            if (auto delta = ParseDeltaName(file.path().string())) {
+                deltas.push_back(std::move(*delta));
+                continue;
+            }
+
             auto dump = ParseDumpName(file.path().string());
             if (!dump) {
                 LOG_WARNING() << config_.name << ": unrelated file in the dump directory, path=\""
@@ -121,17 +180,35 @@ void DumpLocator::Cleanup() {
                 continue;
             }
 
-            if (dump->format_version < config_.dump_format_version || dump->update_time < min_update_time) {
-                LOG_DEBUG() << config_.name << ": removing an expired dump, path=\"" << file.path().string() << "\"";
-                boost::filesystem::remove(file);
-                continue;
-            }
+            dumps.push_back(std::move(*dump));
+        }
 
-            if (dump->format_version == config_.dump_format_version) {
-                dumps.push_back(std::move(*dump));
-            }
+        // A full dump is as fresh as its latest delta
+        std::unordered_map<std::string, TimePoint> effective_update_times;
+        for (const auto& delta : deltas) {
+            auto& update_time = effective_update_times[delta.base_filename];
+            update_time = std::max(update_time, delta.delta.update_time);
+        }
+        for (auto& dump : dumps) {
+            const auto it = effective_update_times.find(Filename(dump.full_path));
+            if (it != effective_update_times.end()) dump.update_time = std::max(dump.update_time, it->second);
         }
 
+        std::unordered_set<std::string> kept_filenames;
+        const auto is_removed = [&](const DumpFileStats& dump) {
+            if (dump.format_version < config_.dump_format_version || dump.update_time < min_update_time) {
+                LOG_DEBUG() << config_.name << ": removing an expired dump, path=\"" << dump.full_path << "\"";
+                boost::filesystem::remove(dump.full_path);
+                return true;
+            }
+            if (dump.format_version != config_.dump_format_version) {
+                kept_filenames.insert(Filename(dump.full_path));
+                return true;
+            }
+            return false;
+        };
+        dumps.erase(std::remove_if(dumps.begin(), dumps.end(), is_removed), dumps.end());
+
         std::sort(dumps.begin(), dumps.end(), [](const DumpFileStats& a, const DumpFileStats& b) {
             return a.update_time > b.update_time;
         });
@@ -140,6 +217,14 @@ void DumpLocator::Cleanup() {
             LOG_DEBUG() << config_.name << ": removing an excessive dump \"" << dumps[i].full_path << "\"";
             boost::filesystem::remove(dumps[i].full_path);
         }
+        if (dumps.size() > config_.max_dump_count) dumps.resize(config_.max_dump_count);
+
+        for (const auto& dump : dumps) kept_filenames.insert(Filename(dump.full_path));
+        for (const auto& delta : deltas) {
+            if (kept_filenames.count(delta.base_filename)) continue;
+            LOG_DEBUG() << config_.name << ": removing a delta of a removed dump \"" << delta.delta.full_path << "\"";
+            boost::filesystem::remove(delta.delta.full_path);
+        }
     } catch (const std::exception& ex) {
         LOG_ERROR() << config_.name << ": error while cleaning up old dumps. Cause: " << ex;
     }
@@ -155,10 +240,7 @@ std::optional<DumpFileStats> DumpLocator::ParseDumpName(std::string full_path) c
         );
 
         try {
-            const std::string date_string{regex[1]};
-            const auto date_format =
-                date_string.find(':') == std::string::npos ? kFilenameDateFormat : kLegacyFilenameDateFormat;
-            const auto date = utils::datetime::Stringtime(date_string, kTimeZone, date_format);
+            const auto date = ParseFilenameDate(std::string{regex[1]});
             const auto version = utils::FromString<uint64_t>(regex[2]);
             return DumpFileStats{{Round(date)}, std::move(full_path), version};
         } catch (const std::exception& ex) {
@@ -169,9 +251,32 @@ std::optional<DumpFileStats> DumpLocator::ParseDumpName(std::string full_path) c
     return std::nullopt;
 }
 
+std::optional<DumpLocator::DeltaFileStats> DumpLocator::ParseDeltaName(std::string full_path) const {
+    const auto filename = boost::filesystem::path{full_path}.filename().string();
+
+    utils::match_results regex;
+    if (utils::regex_match(filename, regex, delta_filename_regex_)) {
+        UASSERT_MSG(
+            regex.size() == 5, fmt::format("Incorrect sub-match count: {} for filename {}", regex.size(), filename)
+        );
+
+        try {
+            const auto date = ParseFilenameDate(std::string{regex[4]});
+            const auto version = utils::FromString<uint64_t>(regex[3]);
+            return DeltaFileStats{DumpFileStats{{Round(date)}, std::move(full_path), version}, std::string{regex[1]}};
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "A filename looks like a dump delta, but it is not, path=\"" << filename
+                          << "\". Reason: " << ex;
+            return std::nullopt;
+        }
+    }
+    return std::nullopt;
+}
+
 std::optional<DumpFileStats> DumpLocator::GetLatestDumpImpl() const {
     const auto min_update_time = MinAcceptableUpdateTime();
-    std::optional<DumpFileStats> best_dump;
+    std::vector<DumpFileStats> dumps;
+    std::unordered_map<std::string, TimePoint> latest_delta_times;
 
     try {
         if (!boost::filesystem::exists(config_.dump_directory)) {
@@ -184,6 +289,12 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDumpImpl() const {
                 continue;
             }
 
+            if (auto delta = ParseDeltaName(file.path().string())) {
+                auto& update_time = latest_delta_times[delta->base_filename];
+                update_time = std::max(update_time, delta->delta.update_time);
+                continue;
+            }
+
             auto curr_dump = ParseDumpName(file.path().string());
             if (!curr_dump) {
                 if (utils::regex_match(file.path().filename().string(), tmp_filename_regex_)) {
@@ -202,24 +313,36 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDumpImpl() const {
                 continue;
             }
 
-            if (curr_dump->update_time < min_update_time && config_.max_dump_age) {
-                LOG_DEBUG() << "Ignoring dump \"" << curr_dump->full_path
-                            << "\", because its age is greater than the maximum "
-                               "allowed dump age ("
-                            << config_.max_dump_age->count() << "ms)";
-                continue;
-            }
-
-            if (!best_dump || curr_dump->update_time > best_dump->update_time) {
-                best_dump = std::move(curr_dump);
-            }
+            dumps.push_back(std::move(*curr_dump));
         }
     } catch (const std::exception& ex) {
         LOG_ERROR() << config_.name << ": error while trying to fetch dumps. Cause: " << ex;
-        // proceed to return best_dump
+        // proceed to choose from the dumps found so far
+    }
+
+    std::optional<DumpFileStats> best_dump;
+    TimePoint best_update_time{};
+    for (auto& dump : dumps) {
+        // A full dump is as fresh as its latest delta
+        auto update_time = dump.update_time;
+        const auto it = latest_delta_times.find(Filename(dump.full_path));
+        if (it != latest_delta_times.end()) update_time = std::max(update_time, it->second);
+
+        if (update_time < min_update_time && config_.max_dump_age) {
+            LOG_DEBUG() << "Ignoring dump \"" << dump.full_path
+                        << "\", because its age is greater than the maximum "
+                           "allowed dump age ("
+                        << config_.max_dump_age->count() << "ms)";
+            continue;
+        }
+
+        if (!best_dump || update_time > best_update_time) {
+            best_dump = std::move(dump);
+            best_update_time = update_time;
+        }
     }
 
-    return best_dump ? std::optional{std::move(best_dump)} : std::nullopt;
+    return best_dump;
 }
 
 std::string DumpLocator::GenerateDumpPath(TimePoint update_time) const {
@@ -231,13 +354,21 @@ std::string DumpLocator::GenerateDumpPath(TimePoint update_time) const {
     );
 }
 
+std::string DumpLocator::GenerateDeltaPath(const std::string& base_path, TimePoint update_time) {
+    return base_path + kDeltaInfix + utils::datetime::Timestring(update_time, kTimeZone, kFilenameDateFormat);
+}
+
 TimePoint DumpLocator::MinAcceptableUpdateTime() const {
     return config_.max_dump_age ? Round(utils::datetime::Now()) - *config_.max_dump_age : TimePoint::min();
 }
 
 std::string DumpLocator::GenerateFilenameRegex(FileFormatType type) {
-    return std::string{R"(^(\d{4}-\d{2}-\d{2}T\d{2}:?\d{2}:?\d{2}\.\d{6}Z?)-v(\d+))"} +
-           (type == FileFormatType::kTmp ? "\\.tmp$" : "$");
+    return "^(" + kDateRegex + ")-v(\\d+)" +
+           (type == FileFormatType::kTmp ? "(\\.delta-" + kDateRegex + ")?\\.tmp$" : std::string{"$"});
+}
+
+std::string DumpLocator::GenerateDeltaFilenameRegex() {
+    return "^((" + kDateRegex + ")-v(\\d+))\\.delta-(" + kDateRegex + ")$";
 }
 
 TimePoint DumpLocator::Round(std::chrono::system_clock::time_point time) {
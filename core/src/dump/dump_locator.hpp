@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/dump/config.hpp>
 #include <userver/dump/helpers.hpp>
@@ -24,6 +25,10 @@ struct DumpFileStats final {
 
 /// @brief Manages dump files on disk. Encapsulates file paths and naming scheme
 /// and performs necessary bookkeeping.
+///
+/// A full dump may be followed by delta dumps, named after the full dump:
+/// `{full-dump-name}.delta-{update-time}`. The update time of a full dump with
+/// deltas is the one of its latest delta.
 /// @note The class is thread-safe, except for `Cleanup`
 class DumpLocator final {
 public:
@@ -35,18 +40,42 @@ public:
     /// @throws On a filesystem error
     DumpFileStats RegisterNewDump(TimePoint update_time);
 
+    /// @brief Prepare the place for a new delta of the `base` full dump
+    /// @note The operation is blocking, and should run in FS TaskProcessor
+    /// @note The actual creation of the file is a caller's responsibility
+    /// @throws On a filesystem error
+    DumpFileStats RegisterNewDelta(const DumpFileStats& base, TimePoint update_time);
+
     /// @brief Finds the latest suitable dump
     /// @note The operation is blocking, and should run in FS TaskProcessor
     /// @returns The full path of the dump if available and fresh enough,
     /// or `nullopt` otherwise
     std::optional<DumpFileStats> GetLatestDump() const;
 
+    /// @brief Finds the deltas of the `base` full dump
+    /// @note The operation is blocking, and should run in FS TaskProcessor
+    /// @returns The deltas sorted by update time, oldest first
+    /// @throws On a filesystem error
+    std::vector<DumpFileStats> GetDeltas(const DumpFileStats& base) const;
+
     /// @brief Modifies the update time for a dump
     /// @note The operation is blocking, and should run in FS TaskProcessor
     /// @return `true` on success, `false` if the dump is not available
     bool BumpDumpTime(TimePoint old_update_time, TimePoint new_update_time);
 
-    /// @brief Removes old dumps and tmp files
+    /// @brief Modifies the update time for the latest delta of the `base`
+    /// full dump
+    /// @note The operation is blocking, and should run in FS TaskProcessor
+    /// @return `true` on success, `false` if the delta is not available
+    bool BumpDeltaTime(const DumpFileStats& base, TimePoint old_update_time, TimePoint new_update_time);
+
+    /// @returns The path of a full dump with the `update_time`
+    std::string GenerateDumpPath(TimePoint update_time) const;
+
+    /// @returns The path of a delta of the `base_path` full dump
+    static std::string GenerateDeltaPath(const std::string& base_path, TimePoint update_time);
+
+    /// @brief Removes old dumps with their deltas, orphaned deltas and tmp files
     /// @note The operation is blocking, and should run in FS TaskProcessor
     /// @warning Must not be called concurrently with `RegisterNewDump`
     void Cleanup();
@@ -56,19 +85,29 @@ private:
 
     std::optional<DumpFileStats> ParseDumpName(std::string full_path) const;
 
-    std::optional<DumpFileStats> GetLatestDumpImpl() const;
+    struct DeltaFileStats final {
+        DumpFileStats delta;
+        std::string base_filename;
+    };
 
-    std::string GenerateDumpPath(TimePoint update_time) const;
+    std::optional<DeltaFileStats> ParseDeltaName(std::string full_path) const;
+
+    bool RenameDump(const std::string& old_name, const std::string& new_name);
+
+    std::optional<DumpFileStats> GetLatestDumpImpl() const;
 
     TimePoint MinAcceptableUpdateTime() const;
 
     static std::string GenerateFilenameRegex(FileFormatType type);
 
+    static std::string GenerateDeltaFilenameRegex();
+
     static TimePoint Round(std::chrono::system_clock::time_point);
 
     const Config config_;
     const utils::regex filename_regex_;
     const utils::regex tmp_filename_regex_;
+    const utils::regex delta_filename_regex_;
 };
 
 }  // namespace dump
@@ -269,4 +269,53 @@ max-age: 30m
     }
 }
 
+UTEST(DumpLocator, Deltas) {
+    using namespace std::chrono_literals;
+
+    const std::string kConfig = R"(
+enable: true
+world-readable: false
+format-version: 5
+max-count: 1
+max-age: null
+)";
+    const auto dir = fs::blocking::TempDirectory::Create();
+
+    const std::string base1 = "2015-03-22T090000.000000Z-v5";
+    const std::string base2 = "2015-03-22T090003.000000Z-v5";
+    const std::string delta1 = base1 + ".delta-2015-03-22T090005.000000Z";
+    const std::string delta2 = base1 + ".delta-2015-03-22T090004.000000Z";
+    const std::string orphaned_delta = "2015-03-22T080000.000000Z-v5.delta-2015-03-22T080001.000000Z";
+    const std::string delta_tmp = base1 + ".delta-2015-03-22T090006.000000Z.tmp";
+    dump::CreateDumps({base1, base2, delta1, delta2, orphaned_delta, delta_tmp}, dir, kDumperName);
+
+    const dump::Config config{dump::ConfigFromYaml(kConfig, dir, kDumperName)};
+    dump::DumpLocator locator{config};
+
+    // base1 is as fresh as its latest delta
+    const auto dump_stats = locator.GetLatestDump();
+    ASSERT_TRUE(dump_stats);
+    EXPECT_EQ(Filename(dump_stats->full_path), base1);
+    EXPECT_EQ(dump_stats->update_time, BaseTime());
+
+    const auto deltas = locator.GetDeltas(*dump_stats);
+    ASSERT_EQ(deltas.size(), 2u);
+    EXPECT_EQ(Filename(deltas[0].full_path), delta2);
+    EXPECT_EQ(deltas[0].update_time, BaseTime() + 4s);
+    EXPECT_EQ(Filename(deltas[1].full_path), delta1);
+    EXPECT_EQ(deltas[1].update_time, BaseTime() + 5s);
+
+    const auto new_delta = locator.RegisterNewDelta(*dump_stats, BaseTime() + 7s);
+    EXPECT_EQ(Filename(new_delta.full_path), base1 + ".delta-2015-03-22T090007.000000Z");
+
+    EXPECT_TRUE(locator.BumpDeltaTime(*dump_stats, BaseTime() + 5s, BaseTime() + 6s));
+
+    // Expected to remove the older dump, the orphaned delta and the tmp file
+    locator.Cleanup();
+    EXPECT_EQ(
+        dump::FilenamesInDirectory(dir, kDumperName),
+        (std::set<std::string>{base1, delta2, base1 + ".delta-2015-03-22T090006.000000Z"})
+    );
+}
+
 USERVER_NAMESPACE_END
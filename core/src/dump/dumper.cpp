@@ -51,6 +51,15 @@ void ThrowDumpUnimplemented(const std::string& name) {
 
 DumpableEntity::~DumpableEntity() = default;
 
+bool DumpableEntity::GetAndWriteDelta(dump::Writer& /*writer*/) const { return false; }
+
+void DumpableEntity::ReadAndSetWithDeltas(
+    dump::Reader& /*reader*/,
+    const std::vector<std::unique_ptr<dump::Reader>>& /*deltas*/
+) {
+    throw Error("Delta dumps are not supported");
+}
+
 namespace {
 
 struct UpdateTime final {
@@ -58,6 +67,13 @@ struct UpdateTime final {
     TimePoint last_modifying_update;
 };
 
+// A full dump and the deltas written after it
+struct DeltaChain final {
+    DumpFileStats base;
+    std::size_t delta_count{0};
+    std::optional<DumpFileStats> last_delta;
+};
+
 struct DumpData {
     DumpData(const Config& static_config, std::unique_ptr<OperationsFactory> rw_factory, DumpableEntity& dumpable)
         : rw_factory(std::move(rw_factory)), dumpable(dumpable), locator(static_config) {
@@ -68,6 +84,8 @@ struct DumpData {
     DumpableEntity& dumpable;
     DumpLocator locator;
     std::optional<UpdateTime> dumped_update_time;
+    // Only set if deltas are enabled and the next delta may follow
+    std::optional<DeltaChain> delta_chain;
 };
 
 struct UpdateData {
@@ -136,6 +154,15 @@ private:
     /// @throws std::exception on failure
     void DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope, DumpData& dump_data);
 
+    /// @returns `false` if a full dump should be written instead
+    /// @throws std::exception on failure
+    bool TryWriteDelta(TimePoint update_time, tracing::ScopeTime& scope, DumpData& dump_data);
+
+    /// @returns `false` if the dump is not available
+    bool BumpDumpTime(DumpData& dump_data, TimePoint old_update_time, TimePoint new_update_time);
+
+    void RecordWrite(std::chrono::steady_clock::time_point write_start, const std::string& path);
+
     enum class DumpOperation { kNewDump, kBumpTime };
 
     /// @returns `update_time` of the loaded dump on success, `null` otherwise
@@ -337,13 +364,15 @@ void Dumper::Impl::WriteDump(DumpData& dump_data) {
 
     switch (operation_type) {
         case DumpOperation::kNewDump: {
-            dump_data.locator.Cleanup();
-            DoWriteDump(update_time.last_update, scope_time, dump_data);
+            if (!TryWriteDelta(update_time.last_update, scope_time, dump_data)) {
+                dump_data.locator.Cleanup();
+                DoWriteDump(update_time.last_update, scope_time, dump_data);
+            }
             break;
         }
         case DumpOperation::kBumpTime: {
             UASSERT(dumped_update_time);
-            if (!dump_data.locator.BumpDumpTime(dumped_update_time->last_update, update_time.last_update)) {
+            if (!BumpDumpTime(dump_data, dumped_update_time->last_update, update_time.last_update)) {
                 DoWriteDump(update_time.last_update, scope_time, dump_data);
             }
             break;
@@ -403,20 +432,74 @@ void Dumper::Impl::CancelWriteTaskAndWait() noexcept {
 
 void Dumper::Impl::DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope, DumpData& dump_data) {
     const auto dump_start = std::chrono::steady_clock::now();
+    dump_data.delta_chain.reset();
 
-    const auto dump_stats = dump_data.locator.RegisterNewDump(update_time);
+    auto dump_stats = dump_data.locator.RegisterNewDump(update_time);
     const auto& dump_path = dump_stats.full_path;
     auto writer = dump_data.rw_factory->CreateWriter(dump_path, scope);
     dump_data.dumpable.GetAndWrite(*writer);
     writer->Finish();
-    const auto dump_size = boost::filesystem::file_size(dump_path);
 
     LOG_INFO() << Name() << ": a new dump has been written at \"" << dump_path << '"';
+    RecordWrite(dump_start, dump_path);
+
+    if (static_config_.max_delta_count > 0) {
+        dump_data.delta_chain = DeltaChain{std::move(dump_stats), 0, std::nullopt};
+    }
+}
+
+bool Dumper::Impl::TryWriteDelta(TimePoint update_time, tracing::ScopeTime& scope, DumpData& dump_data) {
+    // On any failure the chain is broken, and the next dump is a full one
+    auto chain = std::exchange(dump_data.delta_chain, std::nullopt);
+    if (!chain || chain->delta_count >= static_config_.max_delta_count) return false;
+
+    const auto delta_start = std::chrono::steady_clock::now();
 
-    statistics_.last_written_size = dump_size;
+    auto delta_stats = dump_data.locator.RegisterNewDelta(chain->base, update_time);
+    const auto& delta_path = delta_stats.full_path;
+    auto writer = dump_data.rw_factory->CreateWriter(delta_path, scope);
+    if (!dump_data.dumpable.GetAndWriteDelta(*writer)) {
+        // The unfinished tmp file is removed by DumpLocator::Cleanup
+        LOG_DEBUG() << Name() << ": the changes are unknown, writing a full dump";
+        return false;
+    }
+    writer->Finish();
+
+    LOG_INFO() << Name() << ": a new delta has been written at \"" << delta_path << '"';
+    RecordWrite(delta_start, delta_path);
+
+    ++chain->delta_count;
+    chain->last_delta = std::move(delta_stats);
+    dump_data.delta_chain = std::move(chain);
+    return true;
+}
+
+bool Dumper::Impl::BumpDumpTime(DumpData& dump_data, TimePoint old_update_time, TimePoint new_update_time) {
+    auto& chain = dump_data.delta_chain;
+    if (!chain) return dump_data.locator.BumpDumpTime(old_update_time, new_update_time);
+
+    const bool bumped =
+        chain->last_delta
+            ? dump_data.locator.BumpDeltaTime(chain->base, chain->last_delta->update_time, new_update_time)
+            : dump_data.locator.BumpDumpTime(chain->base.update_time, new_update_time);
+    if (!bumped) {
+        chain.reset();
+        return false;
+    }
+
+    auto& bumped_stats = chain->last_delta ? *chain->last_delta : chain->base;
+    bumped_stats.update_time = new_update_time;
+    bumped_stats.full_path = chain->last_delta
+                                 ? DumpLocator::GenerateDeltaPath(chain->base.full_path, new_update_time)
+                                 : dump_data.locator.GenerateDumpPath(new_update_time);
+    return true;
+}
+
+void Dumper::Impl::RecordWrite(std::chrono::steady_clock::time_point write_start, const std::string& path) {
+    statistics_.last_written_size = boost::filesystem::file_size(path);
     statistics_.last_nontrivial_write_duration =
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - dump_start);
-    statistics_.last_nontrivial_write_start_time = dump_start;
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - write_start);
+    statistics_.last_nontrivial_write_start_time = write_start;
 }
 
 std::optional<TimePoint> Dumper::Impl::LoadFromDump(DumpData& dump_data, const DynamicConfig& config) {
@@ -433,19 +516,38 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(DumpData& dump_data, const D
     const std::optional<TimePoint> update_time =
         utils::CriticalAsync(fs_task_processor_, read_span_name_, [&] {
             auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime();
+            dump_data.delta_chain.reset();
 
             try {
                 auto dump_stats = dump_data.locator.GetLatestDump();
                 if (!dump_stats) return std::optional<TimePoint>{};
 
+                auto delta_stats = dump_data.locator.GetDeltas(*dump_stats);
                 auto reader = dump_data.rw_factory->CreateReader(dump_stats->full_path);
-                dump_data.dumpable.ReadAndSet(*reader);
+                if (delta_stats.empty()) {
+                    dump_data.dumpable.ReadAndSet(*reader);
+                } else {
+                    std::vector<std::unique_ptr<Reader>> delta_readers;
+                    delta_readers.reserve(delta_stats.size());
+                    for (const auto& delta : delta_stats) {
+                        delta_readers.push_back(dump_data.rw_factory->CreateReader(delta.full_path));
+                    }
+                    dump_data.dumpable.ReadAndSetWithDeltas(*reader, delta_readers);
+                    for (auto& delta_reader : delta_readers) delta_reader->Finish();
+                }
                 reader->Finish();
 
-                LOG_INFO() << Name() << ": a dump has been loaded successfully";
-                return std::optional{dump_stats->update_time};
+                LOG_INFO() << Name() << ": a dump has been loaded successfully, deltas: " << delta_stats.size();
+                const auto update_time = delta_stats.empty() ? dump_stats->update_time : delta_stats.back().update_time;
+                if (static_config_.max_delta_count > 0) {
+                    std::optional<DumpFileStats> last_delta;
+                    if (!delta_stats.empty()) last_delta = delta_stats.back();
+                    dump_data.delta_chain = DeltaChain{std::move(*dump_stats), delta_stats.size(), std::move(last_delta)};
+                }
+                return std::optional{update_time};
             } catch (const std::exception& ex) {
                 LOG_ERROR() << Name() << ": error while reading a dump. Reason: " << ex;
+                dump_data.delta_chain.reset();
                 return std::optional<TimePoint>{};
             }
         }).Get();
@@ -564,6 +666,19 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            mmap-reads:
+                type: boolean
+                description: Whether to read dumps via mmap, allows dump::MappedArray to use the data in place
+                defaultDescription: false
+            compressed:
+                type: boolean
+                description: Whether to compress the dump with zstd, in chunks, in parallel
+                defaultDescription: false
+            max-delta-count:
+                type: integer
+                description: Max count of delta dumps written after a full dump, 0 disables deltas
+                defaultDescription: 0
+                minimum: 0
 )");
 }
 
@@ -343,6 +343,105 @@ UTEST_F(DumperFixtureNonPeriodic, ForcedReadsEnabled) {
 
 namespace {
 
+// Writes the whole value in each delta
+struct DeltaEntity final : public dump::DumpableEntity {
+    void GetAndWrite(dump::Writer& writer) const override {
+        writer.Write(value);
+        ++write_count;
+    }
+
+    void ReadAndSet(dump::Reader& reader) override { value = reader.Read<int>(); }
+
+    bool GetAndWriteDelta(dump::Writer& writer) const override {
+        writer.Write(value);
+        ++delta_write_count;
+        return true;
+    }
+
+    void ReadAndSetWithDeltas(dump::Reader& reader, const std::vector<std::unique_ptr<dump::Reader>>& deltas)
+        override {
+        value = reader.Read<int>();
+        for (const auto& delta : deltas) value = delta->Read<int>();
+        delta_read_count += deltas.size();
+    }
+
+    int value{0};
+    mutable int write_count{0};
+    mutable int delta_write_count{0};
+    std::size_t delta_read_count{0};
+};
+
+const std::string kDeltaConfig = R"(
+enable: true
+world-readable: true
+format-version: 0
+max-age:  # unlimited
+max-count: 1
+max-delta-count: 2
+)";
+
+}  // namespace
+
+UTEST(Dumper, Deltas) {
+    const auto root = fs::blocking::TempDirectory::Create();
+    const auto config = dump::ConfigFromYaml(kDeltaConfig, root, "delta");
+    testsuite::DumpControl control{testsuite::DumpControl::PeriodicsMode::kDisabled};
+    utils::statistics::Storage statistics_storage;
+    dynamic_config::StorageMock config_storage{{dump::kConfigSet, {}}};
+
+    const auto make_dumper = [&](DeltaEntity& dumpable) {
+        return std::make_unique<dump::Dumper>(
+            config,
+            dump::CreateDefaultOperationsFactory(config),
+            engine::current_task::GetTaskProcessor(),
+            config_storage.GetSource(),
+            statistics_storage,
+            control,
+            dumpable
+        );
+    };
+
+    utils::datetime::MockNowSet({});
+    DeltaEntity dumpable;
+    auto dumper = make_dumper(dumpable);
+    dumper->ReadDump();
+
+    const auto write = [&](int value, dump::UpdateType update_type) {
+        utils::datetime::MockSleep(1s);
+        dumpable.value = value;
+        dumper->OnUpdateCompleted(Now(), update_type);
+        dumper->WriteDumpSyncDebug();
+    };
+
+    write(1, dump::UpdateType::kModified);
+    EXPECT_EQ(dumpable.write_count, 1);
+    EXPECT_EQ(dumpable.delta_write_count, 0);
+
+    write(2, dump::UpdateType::kModified);
+    write(3, dump::UpdateType::kModified);
+    EXPECT_EQ(dumpable.write_count, 1);
+    EXPECT_EQ(dumpable.delta_write_count, 2);
+
+    // max-delta-count is reached
+    write(4, dump::UpdateType::kModified);
+    EXPECT_EQ(dumpable.write_count, 2);
+    EXPECT_EQ(dumpable.delta_write_count, 2);
+
+    write(4, dump::UpdateType::kAlreadyUpToDate);
+    write(5, dump::UpdateType::kModified);
+    write(5, dump::UpdateType::kAlreadyUpToDate);
+    EXPECT_EQ(dumpable.write_count, 2);
+    EXPECT_EQ(dumpable.delta_write_count, 3);
+
+    DeltaEntity restored;
+    auto restored_dumper = make_dumper(restored);
+    EXPECT_EQ(restored_dumper->ReadDump(), Now());
+    EXPECT_EQ(restored.value, 5);
+    EXPECT_EQ(restored.delta_read_count, 1);
+}
+
+namespace {
+
 /// [Sample Dumper usage]
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class SampleComponentWithDumps final : public components::ComponentBase, private dump::DumpableEntity {
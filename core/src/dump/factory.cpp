@@ -1,6 +1,7 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
 #include <userver/storages/secdist/component.hpp>
@@ -19,24 +20,32 @@ boost::filesystem::perms GetPerms(const Config& config) {
         return perms::owner_read;
 }
 
+std::unique_ptr<dump::OperationsFactory>
+WithCompression(const Config& config, std::unique_ptr<dump::OperationsFactory> factory) {
+    if (!config.dump_is_compressed) return factory;
+    return std::make_unique<dump::CompressedOperationsFactory>(std::move(factory));
+}
+
 }  // namespace
 
 std::unique_ptr<dump::OperationsFactory>
 CreateOperationsFactory(const Config& config, const components::ComponentContext& context) {
     auto dump_perms = GetPerms(config);
 
+    std::unique_ptr<dump::OperationsFactory> factory;
     if (config.dump_is_encrypted) {
         const auto& secdist = context.FindComponent<components::Secdist>().Get();
         auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
-        return std::make_unique<dump::EncryptedOperationsFactory>(std::move(secret_key), dump_perms);
+        factory = std::make_unique<dump::EncryptedOperationsFactory>(std::move(secret_key), dump_perms);
     } else {
-        return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+        factory = std::make_unique<dump::FileOperationsFactory>(dump_perms, config.mmap_reads);
     }
+    return WithCompression(config, std::move(factory));
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(const Config& config) {
     auto dump_perms = GetPerms(config);
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    return WithCompression(config, std::make_unique<dump::FileOperationsFactory>(dump_perms, config.mmap_reads));
 }
 
 }  // namespace dump
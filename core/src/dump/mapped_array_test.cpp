@@ -0,0 +1,79 @@
+#include <userver/dump/mapped_array.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Entry {
+    std::uint64_t id;
+    double score;
+    std::int32_t flags;
+};
+
+dump::MappedArray<Entry> MakeEntries() { return dump::MappedArray<Entry>{{{1, 0.5, 2}, {2, 1.5, 3}, {3, 2.5, 4}}}; }
+
+void ExpectEntries(const dump::MappedArray<Entry>& entries) {
+    ASSERT_EQ(entries.size(), 3);
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(entries[i].id, i + 1);
+        EXPECT_EQ(entries[i].score, 0.5 + i);
+        EXPECT_EQ(entries[i].flags, static_cast<std::int32_t>(i + 2));
+    }
+}
+
+std::string WriteDump(const fs::blocking::TempDirectory& dir) {
+    const auto path = dir.GetPath() + "/dump";
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::FileWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+    writer.Write(MakeEntries());
+    writer.Write(dump::MappedArray<Entry>{});
+    writer.Finish();
+    return path;
+}
+
+}  // namespace
+
+UTEST(DumpMappedArray, MmapReader) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = WriteDump(dir);
+
+    auto reader = std::make_unique<dump::MmapFileReader>(path);
+    auto entries = reader->Read<dump::MappedArray<Entry>>();
+    EXPECT_TRUE(reader->Read<dump::MappedArray<Entry>>().empty());
+    reader->Finish();
+    reader.reset();
+
+    // Points into the mapping, which outlives the reader
+    EXPECT_TRUE(entries.IsMapped());
+    ExpectEntries(entries);
+}
+
+UTEST(DumpMappedArray, FileReader) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = WriteDump(dir);
+
+    dump::FileReader reader(path);
+    const auto entries = reader.Read<dump::MappedArray<Entry>>();
+    EXPECT_TRUE(reader.Read<dump::MappedArray<Entry>>().empty());
+    reader.Finish();
+
+    EXPECT_FALSE(entries.IsMapped());
+    ExpectEntries(entries);
+}
+
+TEST(DumpMappedArray, Copies) {
+    const auto entries = dump::FromBinary<dump::MappedArray<Entry>>(dump::ToBinary(MakeEntries()));
+    EXPECT_FALSE(entries.IsMapped());
+    ExpectEntries(entries);
+}
+
+USERVER_NAMESPACE_END
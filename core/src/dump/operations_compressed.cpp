@@ -0,0 +1,201 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <fmt/format.h>
+
+#include <userver/compression/error.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+// Format:
+// 1. kMagic
+// 2. Chunks: raw size, compressed size, zstd frame
+// 3. Zero raw size
+constexpr std::string_view kMagic{"\0udzstd1", 8};
+
+// Upper bound to the memory occupied by a corrupted dump
+constexpr std::size_t kMaxChunkSize = 256 * 1024 * 1024;
+
+constexpr std::size_t kMaxChunksInFlight = 4;
+
+constexpr std::size_t kPassthroughReadSize = 64 * 1024;
+
+}  // namespace
+
+CompressedWriter::CompressedWriter(std::unique_ptr<Writer> sink, std::size_t chunk_size)
+    : sink_(std::move(sink)), chunk_size_(std::clamp<std::size_t>(chunk_size, 1, kMaxChunkSize)) {
+    UASSERT(sink_);
+    WriteStringViewUnsafe(*sink_, kMagic);
+    chunk_.reserve(chunk_size_);
+}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+    while (!data.empty()) {
+        const auto part_size = std::min(data.size(), chunk_size_ - chunk_.size());
+        chunk_.append(data.substr(0, part_size));
+        data.remove_prefix(part_size);
+
+        if (chunk_.size() == chunk_size_) {
+            StartCompression();
+            WriteCompressed(kMaxChunksInFlight);
+        }
+    }
+}
+
+void CompressedWriter::Finish() {
+    if (!chunk_.empty()) StartCompression();
+    WriteCompressed(0);
+
+    impl::WriteTrivial(*sink_, std::uint64_t{0});
+    sink_->Finish();
+}
+
+void CompressedWriter::StartCompression() {
+    const auto raw_size = chunk_.size();
+    auto task = utils::Async("dump-compress", [chunk = std::move(chunk_)] {
+        try {
+            return compression::zstd::Compress(chunk);
+        } catch (const compression::CompressionError& ex) {
+            throw Error(fmt::format("Failed to compress the dump: {}", ex.what()));
+        }
+    });
+    chunks_in_flight_.push_back({raw_size, std::move(task)});
+
+    chunk_ = std::string{};
+    chunk_.reserve(chunk_size_);
+}
+
+void CompressedWriter::WriteCompressed(std::size_t max_chunks_in_flight) {
+    while (chunks_in_flight_.size() > max_chunks_in_flight) {
+        auto& front = chunks_in_flight_.front();
+        const auto compressed = front.compressed.Get();
+
+        impl::WriteTrivial(*sink_, static_cast<std::uint64_t>(front.raw_size));
+        impl::WriteTrivial(*sink_, static_cast<std::uint64_t>(compressed.size()));
+        WriteStringViewUnsafe(*sink_, compressed);
+        chunks_in_flight_.pop_front();
+    }
+}
+
+CompressedReader::CompressedReader(std::unique_ptr<Reader> source) : source_(std::move(source)) {
+    UASSERT(source_);
+    const auto prefix = ReadUnsafeAtMost(*source_, kMagic.size());
+    is_compressed_ = (prefix == kMagic);
+    if (!is_compressed_) chunk_.assign(prefix);
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+    while (chunk_pos_ == chunk_.size()) {
+        if (!NextChunk()) return {};
+    }
+
+    if (chunk_.size() - chunk_pos_ >= max_size) {
+        const auto result = std::string_view{chunk_}.substr(chunk_pos_, max_size);
+        chunk_pos_ += max_size;
+        return result;
+    }
+
+    stitched_.assign(chunk_, chunk_pos_);
+    chunk_pos_ = chunk_.size();
+    while (stitched_.size() < max_size && NextChunk()) {
+        const auto part_size = std::min(max_size - stitched_.size(), chunk_.size());
+        stitched_.append(chunk_, 0, part_size);
+        chunk_pos_ = part_size;
+    }
+    return stitched_;
+}
+
+void CompressedReader::Finish() {
+    if (is_compressed_) ReadAhead();
+
+    if (chunk_pos_ != chunk_.size() || !chunks_in_flight_.empty() || (is_compressed_ && !source_exhausted_)) {
+        throw Error("Unexpected extra data at the end of the compressed dump");
+    }
+    source_->Finish();
+}
+
+void CompressedReader::ReadAhead() {
+    while (!source_exhausted_ && chunks_in_flight_.size() < kMaxChunksInFlight) {
+        const auto raw_size = impl::ReadTrivial<std::uint64_t>(*source_);
+        if (raw_size == 0) {
+            source_exhausted_ = true;
+            break;
+        }
+
+        const auto compressed_size = impl::ReadTrivial<std::uint64_t>(*source_);
+        if (raw_size > kMaxChunkSize || compressed_size > kMaxChunkSize) {
+            throw Error(fmt::format(
+                "Malformed compressed dump chunk: raw-size={}, compressed-size={}", raw_size, compressed_size
+            ));
+        }
+
+        std::string compressed{ReadStringViewUnsafe(*source_, compressed_size)};
+        chunks_in_flight_.push_back(utils::Async("dump-decompress", [compressed = std::move(compressed), raw_size] {
+            std::string chunk;
+            try {
+                chunk = compression::zstd::Decompress(compressed, raw_size);
+            } catch (const compression::DecompressionError& ex) {
+                throw Error(fmt::format("Failed to decompress the dump: {}", ex.what()));
+            }
+            if (chunk.size() != raw_size) {
+                throw Error(fmt::format(
+                    "Malformed compressed dump chunk: expected-size={}, actual-size={}", raw_size, chunk.size()
+                ));
+            }
+            return chunk;
+        }));
+    }
+}
+
+bool CompressedReader::NextChunk() {
+    chunk_pos_ = 0;
+
+    if (!is_compressed_) {
+        chunk_.assign(ReadUnsafeAtMost(*source_, kPassthroughReadSize));
+        return !chunk_.empty();
+    }
+
+    ReadAhead();
+    if (chunks_in_flight_.empty()) {
+        chunk_.clear();
+        return false;
+    }
+
+    chunk_ = chunks_in_flight_.front().Get();
+    chunks_in_flight_.pop_front();
+    // Keeps decompressing the next chunks while this one is deserialized
+    ReadAhead();
+    return true;
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(std::unique_ptr<OperationsFactory> base)
+    : base_(std::move(base)) {
+    UASSERT(base_);
+}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(std::string full_path) {
+    return std::make_unique<CompressedReader>(base_->CreateReader(std::move(full_path)));
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(std::string full_path, tracing::ScopeTime& scope) {
+    return std::make_unique<CompressedWriter>(base_->CreateWriter(std::move(full_path), scope));
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
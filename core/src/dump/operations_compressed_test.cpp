@@ -0,0 +1,128 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_compressed.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kPerms = boost::filesystem::perms::owner_read;
+
+std::unique_ptr<dump::Writer>
+MakeWriter(const std::string& path, std::size_t chunk_size, tracing::ScopeTime& scope_time) {
+    return std::make_unique<dump::CompressedWriter>(
+        std::make_unique<dump::FileWriter>(path, kPerms, scope_time), chunk_size
+    );
+}
+
+dump::CompressedReader MakeReader(const std::string& path) {
+    return dump::CompressedReader{std::make_unique<dump::FileReader>(path)};
+}
+
+}  // namespace
+
+UTEST(DumpCompressed, Smoke) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    auto writer = MakeWriter(path, dump::CompressedWriter::kDefaultChunkSize, scope_time);
+    writer->Write(42);
+    writer->Write(std::string(1000, 'a'));
+    UEXPECT_NO_THROW(writer->Finish());
+
+    EXPECT_LT(boost::filesystem::file_size(path), 100);
+
+    auto reader = MakeReader(path);
+    EXPECT_EQ(reader.Read<int>(), 42);
+    EXPECT_EQ(reader.Read<std::string>(), std::string(1000, 'a'));
+    UEXPECT_THROW(reader.Read<int>(), dump::Error);
+    UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST_MT(DumpCompressed, ManyChunks, 4) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    // Values span the chunk boundaries
+    constexpr std::size_t kChunkSize = 1000;
+    std::vector<std::string> values;
+    for (std::size_t i = 0; i < 200; ++i) {
+        values.push_back(std::string(i * 17 % 3000, static_cast<char>('a' + i % 26)));
+    }
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    auto writer = MakeWriter(path, kChunkSize, scope_time);
+    for (const auto& value : values) writer->Write(value);
+    UEXPECT_NO_THROW(writer->Finish());
+
+    auto reader = MakeReader(path);
+    for (const auto& value : values) EXPECT_EQ(reader.Read<std::string>(), value);
+    UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpCompressed, UnreadData) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    auto writer = MakeWriter(path, 4, scope_time);
+    writer->Write(std::uint64_t{1});
+    writer->Write(std::uint64_t{2});
+    UEXPECT_NO_THROW(writer->Finish());
+
+    auto reader = MakeReader(path);
+    EXPECT_EQ(reader.Read<std::uint64_t>(), 1);
+    UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpCompressed, ReadsUncompressed) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::FileWriter writer(path, kPerms, scope_time);
+    writer.Write(std::string{"old dump"});
+    writer.Write(42);
+    UEXPECT_NO_THROW(writer.Finish());
+
+    auto reader = MakeReader(path);
+    EXPECT_EQ(reader.Read<std::string>(), "old dump");
+    EXPECT_EQ(reader.Read<int>(), 42);
+    UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpCompressed, Corrupted) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    auto writer = MakeWriter(path, dump::CompressedWriter::kDefaultChunkSize, scope_time);
+    writer->Write(std::string(1000, 'a'));
+    UEXPECT_NO_THROW(writer->Finish());
+
+    // Cuts off the end of the zstd frame and the terminator
+    const auto size = boost::filesystem::file_size(path);
+    boost::filesystem::permissions(path, boost::filesystem::perms::owner_read | boost::filesystem::perms::owner_write);
+    boost::filesystem::resize_file(path, size - 12);
+
+    UEXPECT_THROW(
+        {
+            auto reader = MakeReader(path);
+            [[maybe_unused]] auto value = reader.Read<std::string>();
+            reader.Finish();
+        },
+        dump::Error
+    );
+}
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,20 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+
 #include <algorithm>
+#include <cerrno>
 #include <stdexcept>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/utils/strerror.hpp>
+
+#include <fs/async_file_io.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,6 +22,9 @@ namespace dump {
 
 namespace {
 constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
+
+// Dumps are written in small pieces, the io_uring writes are batched
+constexpr std::size_t kAsyncWriteBufferSize{1 << 18};
 }
 
 FileWriter::FileWriter(std::string path, boost::filesystem::perms perms, tracing::ScopeTime& scope)
@@ -25,28 +36,55 @@ FileWriter::FileWriter(std::string path, boost::filesystem::perms perms, tracing
     const auto tmp_perms = perms_ | boost::filesystem::perms::owner_write;
 
     try {
-        file_ = fs::blocking::CFile{path_, mode, tmp_perms};
+        if (fs::impl::IsAsyncFileIoAvailable()) {
+            async_file_ = std::make_unique<fs::impl::AsyncFileWriter>(path_, O_CREAT | O_EXCL, tmp_perms);
+            async_buffer_.reserve(kAsyncWriteBufferSize);
+        } else {
+            file_ = fs::blocking::CFile{path_, mode, tmp_perms};
+        }
     } catch (const std::exception& ex) {
         throw Error(fmt::format("Failed to open the dump file for write \"{}\": {}", path_, ex.what()));
     }
 }
 
+FileWriter::~FileWriter() = default;
+
 void FileWriter::WriteRaw(std::string_view data) {
     try {
-        file_.Write(data);
+        if (async_file_) {
+            if (async_buffer_.size() + data.size() > kAsyncWriteBufferSize) FlushAsyncBuffer();
+            if (data.size() >= kAsyncWriteBufferSize) {
+                async_file_->Write(data);
+            } else {
+                async_buffer_.append(data);
+            }
+        } else {
+            file_.Write(data);
+        }
     } catch (const std::exception& ex) {
         throw Error(fmt::format("Failed to write to the dump file \"{}\": {}", path_, ex.what()));
     }
     cpu_relax_.Relax(data.size());
 }
 
+void FileWriter::FlushAsyncBuffer() {
+    async_file_->Write(async_buffer_);
+    async_buffer_.clear();
+}
+
 void FileWriter::Finish() {
     try {
         // Flush must be performed at some point before Rename, otherwise after a
         // system's hard reset the file might end up in a state where it is renamed,
         // but truncated.
-        file_.Flush();
-        std::move(file_).Close();
+        if (async_file_) {
+            FlushAsyncBuffer();
+            async_file_->FSync();
+            std::move(*async_file_).Close();
+        } else {
+            file_.Flush();
+            std::move(file_).Close();
+        }
         fs::blocking::Chmod(path_, perms_);  // drop perms::owner_write
         fs::blocking::Rename(path_, final_path_);
     } catch (const std::exception& ex) {
@@ -109,9 +147,52 @@ void FileReader::Finish() {
     }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms) : perms_(perms) {}
+MmapFileReader::MmapFileReader(std::string path) : path_(std::move(path)) {
+    try {
+        const auto file = fs::blocking::FileDescriptor::Open(path_, fs::blocking::OpenFlag::kRead);
+        mapping_size_ = file.GetSize();
+        if (mapping_size_ == 0) return;
+
+        void* const data = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, file.GetNative(), 0);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error(fmt::format("mmap failed: {}", utils::strerror(errno)));
+        }
+        // The mapping outlives the file descriptor and, possibly, the reader
+        mapping_ = std::shared_ptr<const void>(data, [size = mapping_size_](const void* data) {
+            ::munmap(const_cast<void*>(data), size);
+        });
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to map the dump file for reading \"{}\". Reason: {}", path_, ex.what()));
+    }
+}
+
+std::string_view MmapFileReader::ReadRaw(std::size_t max_size) {
+    const auto size = std::min(max_size, mapping_size_ - position_);
+    const auto* data = static_cast<const char*>(mapping_.get()) + position_;
+    position_ += size;
+    return {data, size};
+}
+
+void MmapFileReader::Finish() {
+    if (position_ != mapping_size_) {
+        throw Error(fmt::format(
+            "Unexpected extra data at the end of the dump file \"{}\": "
+            "file-size={}, position={}, unread-size={}",
+            path_,
+            mapping_size_,
+            position_,
+            mapping_size_ - position_
+        ));
+    }
+}
+
+std::shared_ptr<const void> MmapFileReader::GetStableMemoryOwner() const { return mapping_; }
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms, bool mmap_reads)
+    : perms_(perms), mmap_reads_(mmap_reads) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(std::string full_path) {
+    if (mmap_reads_) return std::make_unique<MmapFileReader>(std::move(full_path));
     return std::make_unique<FileReader>(std::move(full_path));
 }
 
@@ -1,5 +1,8 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <string_view>
+#include <vector>
+
 #include <boost/regex.hpp>
 
 #include <userver/dump/unsafe.hpp>
@@ -109,4 +112,49 @@ TEST(DumpOperationsFile, Underread) {
     FAIL();
 }
 
+UTEST(DumpOperationsFile, MmapWriteReadRaw) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+
+    constexpr std::size_t kMaxLength = 10;
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::FileWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+    for (std::size_t i = 0; i <= kMaxLength; ++i) {
+        WriteStringViewUnsafe(writer, std::string(i, 'a'));
+    }
+    writer.Finish();
+
+    dump::MmapFileReader reader(path);
+    std::vector<std::string_view> results;
+    for (std::size_t i = 0; i <= kMaxLength; ++i) {
+        results.push_back(ReadStringViewUnsafe(reader, i));
+    }
+    reader.Finish();
+
+    // The memory stays valid after the subsequent reads
+    for (std::size_t i = 0; i <= kMaxLength; ++i) {
+        EXPECT_EQ(results[i], std::string(i, 'a'));
+    }
+    EXPECT_TRUE(reader.GetStableMemoryOwner());
+}
+
+TEST(DumpOperationsFile, MmapEmptyDump) {
+    const auto file = fs::blocking::TempFile::Create();
+
+    dump::MmapFileReader reader(file.GetPath());
+    EXPECT_EQ(ReadStringViewUnsafe(reader, 0), "");
+    reader.Finish();
+}
+
+TEST(DumpOperationsFile, MmapUnderread) {
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+    dump::MmapFileReader reader(file.GetPath());
+    EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+    UEXPECT_THROW_MSG(reader.Finish(), dump::Error, "file-size=10, position=9, unread-size=1");
+    UEXPECT_THROW(ReadStringViewUnsafe(reader, 2), dump::Error);
+}
+
 USERVER_NAMESPACE_END
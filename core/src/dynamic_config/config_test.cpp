@@ -2,10 +2,12 @@
 
 #include <vector>
 
+#include <userver/dynamic_config/impl/snapshot.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/serialize.hpp>
 
 using namespace std::chrono_literals;
@@ -111,6 +113,21 @@ UTEST_F(DynamicConfigTest, VariableSnapshotPtr) {
 
 UTEST_F(DynamicConfigTest, Copy) { EXPECT_EQ(source_.GetCopy(kIntConfig), 5); }
 
+UTEST(DynamicConfig, CopyAfterUpdate) {
+    dynamic_config::StorageMock storage{{kIntConfig, 1}};
+    const auto source = storage.GetSource();
+    EXPECT_EQ(source.GetCopy(kIntConfig), 1);
+    EXPECT_EQ(source.GetCopy(kIntConfig), 1);
+
+    storage.Extend({{kIntConfig, 2}});
+    EXPECT_EQ(source.GetCopy(kIntConfig), 2);
+
+    // Another storage on the same thread must not see the cached config
+    const dynamic_config::StorageMock other_storage{{kIntConfig, 3}};
+    EXPECT_EQ(other_storage.GetSource().GetCopy(kIntConfig), 3);
+    EXPECT_EQ(source.GetCopy(kIntConfig), 2);
+}
+
 struct OldConfig final {
     static const dynamic_config::Key<OldConfig> kDeprecatedKey;
 
@@ -473,6 +490,41 @@ UTEST(DynamicConfig, JsonConfig) {
     EXPECT_EQ(snapshot[kJsonConfig], kJson);
 }
 
+int parsed_counted_configs = 0;
+
+int ParseCountedConfig(const formats::json::Value& value) {
+    ++parsed_counted_configs;
+    return value.As<int>();
+}
+
+const dynamic_config::Key<int> kCountedConfig{
+    "COUNTED_CONFIG",
+    &ParseCountedConfig,
+    dynamic_config::DefaultAsJsonString{"0"},
+};
+
+UTEST(DynamicConfig, IncrementalParsing) {
+    const auto id = dynamic_config::impl::ConfigIdGetter::Get(kCountedConfig);
+    auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+    parsed_counted_configs = 0;
+
+    const dynamic_config::impl::SnapshotData first{docs_map, dynamic_config::impl::SnapshotData{}};
+    EXPECT_EQ(first.Get<int>(id), 0);
+    EXPECT_EQ(parsed_counted_configs, 1);
+
+    // An unrelated update reuses the parsed config
+    docs_map.Set("SOME_OTHER_CONFIG", formats::json::FromString("42"));
+    const dynamic_config::impl::SnapshotData second{docs_map, first};
+    EXPECT_EQ(parsed_counted_configs, 1);
+    EXPECT_TRUE(second.IsSameConfig(first, id));
+
+    docs_map.Set("COUNTED_CONFIG", formats::json::FromString("1"));
+    const dynamic_config::impl::SnapshotData third{docs_map, second};
+    EXPECT_EQ(third.Get<int>(id), 1);
+    EXPECT_EQ(parsed_counted_configs, 2);
+    EXPECT_FALSE(third.IsSameConfig(second, id));
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -107,22 +107,30 @@ DocsMap MakeDefaultDocsMap() {
     return result;
 }
 
+struct SnapshotData::UserConfig final {
+    std::any value;
+    // The JSON the value was parsed from, missing for the configs that depend
+    // on multiple or no JSON values
+    formats::json::Value source;
+};
+
 SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
     utils::impl::AssertStaticRegistrationFinished();
     user_configs_.resize(Registry().size());
 
     for (const auto& config_variable : config_variables) {
-        user_configs_[config_variable.GetId()] = config_variable.GetValue();
+        user_configs_[config_variable.GetId()] =
+            std::make_shared<UserConfig>(UserConfig{config_variable.GetValue(), {}});
     }
 }
 
 SnapshotData::SnapshotData(const DocsMap& defaults, const std::vector<KeyValue>& overrides) : SnapshotData(overrides) {
     utils::StreamingCpuRelax relax(1, nullptr);
     for (const auto [id, metadata] : utils::enumerate(Registry())) {
-        if (!user_configs_[id].has_value()) {
+        if (!user_configs_[id]) {
             relax.Relax(1);
             try {
-                user_configs_[id] = metadata.factory(defaults);
+                user_configs_[id] = std::make_shared<UserConfig>(UserConfig{metadata.factory(defaults), {}});
             } catch (const std::exception& ex) {
                 throw ConfigParseError(fmt::format(
                     "{} while parsing dynamic config values. {}", compiler::GetTypeName(typeid(ex)), ex.what()
@@ -137,20 +145,52 @@ SnapshotData::SnapshotData(const SnapshotData& defaults, const std::vector<KeyVa
     if (defaults.IsEmpty()) return;
 
     for (const auto [id, factory] : utils::enumerate(Registry())) {
-        if (user_configs_[id].has_value()) continue;
+        if (user_configs_[id]) continue;
         user_configs_[id] = defaults.user_configs_[id];
     }
 }
 
+SnapshotData::SnapshotData(const DocsMap& docs_map, const SnapshotData& previous) {
+    utils::impl::AssertStaticRegistrationFinished();
+    user_configs_.resize(Registry().size());
+
+    utils::StreamingCpuRelax relax(1, nullptr);
+    for (const auto [id, metadata] : utils::enumerate(Registry())) {
+        try {
+            formats::json::Value source;
+            if (!metadata.name.empty()) {
+                source = docs_map.Get(metadata.name);
+                const auto* previous_config = previous.IsEmpty() ? nullptr : previous.user_configs_[id].get();
+                if (previous_config && !previous_config->source.IsMissing() && previous_config->source == source) {
+                    user_configs_[id] = previous.user_configs_[id];
+                    continue;
+                }
+            }
+
+            relax.Relax(1);
+            user_configs_[id] = std::make_shared<UserConfig>(UserConfig{metadata.factory(docs_map), std::move(source)});
+        } catch (const std::exception& ex) {
+            throw ConfigParseError(fmt::format(
+                "{} while parsing dynamic config values. {}", compiler::GetTypeName(typeid(ex)), ex.what()
+            ));
+        }
+    }
+}
+
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
+bool SnapshotData::IsSameConfig(const SnapshotData& other, ConfigId id) const noexcept {
+    UASSERT(id < user_configs_.size() && id < other.user_configs_.size());
+    return user_configs_[id] == other.user_configs_[id];
+}
+
 const std::any& SnapshotData::DoGet(ConfigId id) const {
     UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
     const auto& config = user_configs_[id];
-    if (!config.has_value()) {
+    if (!config || !config->value.has_value()) {
         throw std::logic_error("This type is not registered as config");
     }
-    return config;
+    return config->value;
 }
 
 }  // namespace dynamic_config::impl
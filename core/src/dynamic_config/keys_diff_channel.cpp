@@ -0,0 +1,88 @@
+#include <dynamic_config/keys_diff_channel.hpp>
+
+#include <algorithm>
+
+#include <userver/concurrent/async_event_channel.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config::impl {
+
+bool KeysDiffChannel::HasAnyReparsed(const Diff& diff, const std::vector<ConfigId>& config_ids) {
+    if (!diff.previous || config_ids.empty()) return true;
+
+    const auto& previous = diff.previous->GetData();
+    const auto& current = diff.current.GetData();
+    return std::any_of(config_ids.begin(), config_ids.end(), [&](ConfigId id) {
+        return !current.IsSameConfig(previous, id);
+    });
+}
+
+KeysDiffChannel::KeysDiffChannel(std::string_view name, OnRemoveCallback on_listener_removal)
+    : name_(name), on_listener_removal_(std::move(on_listener_removal)) {}
+
+concurrent::AsyncEventSubscriberScope KeysDiffChannel::AddListener(
+    concurrent::FunctionId id,
+    std::string_view name,
+    std::vector<ConfigId> config_ids,
+    Function&& func
+) {
+    auto listeners = listeners_.Lock();
+    auto task_name = concurrent::impl::MakeAsyncChannelName(name_, name);
+    const auto [iterator, success] = listeners->emplace(
+        id, Listener{std::string{name}, std::move(config_ids), std::move(func), std::move(task_name)}
+    );
+    if (!success) concurrent::impl::ReportAlreadySubscribed(Name(), name);
+    return concurrent::AsyncEventSubscriberScope(*this, id);
+}
+
+void KeysDiffChannel::SendEvent(const Diff& diff) const {
+    const auto listeners = listeners_.Lock();
+
+    std::vector<std::pair<const Listener*, engine::TaskWithResult<void>>> tasks;
+    for (const auto& [_, listener] : *listeners) {
+        if (!HasAnyReparsed(diff, listener.config_ids)) continue;
+        tasks.emplace_back(&listener, utils::Async(listener.task_name, [&diff, &callback = listener.callback] {
+                               callback(diff);
+                           }));
+    }
+
+    for (auto& [listener, task] : tasks) concurrent::impl::WaitForTask(listener->name, task);
+}
+
+void KeysDiffChannel::RemoveListener(concurrent::FunctionId id, concurrent::UnsubscribingKind kind) noexcept {
+    const engine::TaskCancellationBlocker blocker;
+    auto listeners = listeners_.Lock();
+    const auto iter = listeners->find(id);
+
+    if (iter == listeners->end()) {
+        concurrent::impl::ReportNotSubscribed(Name());
+        return;
+    }
+
+    if (kind == concurrent::UnsubscribingKind::kAutomatic) {
+        if (!on_listener_removal_) {
+            concurrent::impl::ReportUnsubscribingAutomatically(name_, iter->second.name);
+        }
+
+        if constexpr (concurrent::impl::kCheckSubscriptionUB) {
+            // Fake listener call to check
+            auto on_listener_removal = on_listener_removal_;
+            concurrent::impl::CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnsubscribing(
+                on_listener_removal, iter->second.callback, name_, iter->second.name
+            );
+        }
+    }
+    listeners->erase(iter);
+}
+
+concurrent::AsyncEventSubscriberScope
+KeysDiffChannel::DoAddListener(concurrent::FunctionId id, std::string_view name, Function&& func) {
+    return AddListener(id, name, {}, std::move(func));
+}
+
+}  // namespace dynamic_config::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/concurrent/async_event_source.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/dynamic_config/impl/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config::impl {
+
+// Like concurrent::AsyncEventChannel, but the listeners are notified only if
+// any of their configs has been reparsed, the others are not even woken up.
+class KeysDiffChannel final : public concurrent::AsyncEventSource<const Diff&> {
+public:
+    using OnRemoveCallback = std::function<void(Function&)>;
+
+    KeysDiffChannel(std::string_view name, OnRemoveCallback on_listener_removal);
+
+    concurrent::AsyncEventSubscriberScope
+    AddListener(concurrent::FunctionId id, std::string_view name, std::vector<ConfigId> config_ids, Function&& func);
+
+    void SendEvent(const Diff& diff) const;
+
+    const std::string& Name() const noexcept { return name_; }
+
+private:
+    struct Listener final {
+        std::string name;
+        std::vector<ConfigId> config_ids;
+        Function callback;
+        std::string task_name;
+    };
+
+    static bool HasAnyReparsed(const Diff& diff, const std::vector<ConfigId>& config_ids);
+
+    void RemoveListener(concurrent::FunctionId id, concurrent::UnsubscribingKind kind) noexcept override;
+
+    // Listens to all the configs
+    concurrent::AsyncEventSubscriberScope
+    DoAddListener(concurrent::FunctionId id, std::string_view name, Function&& func) override;
+
+    const std::string name_;
+    const OnRemoveCallback on_listener_removal_;
+    concurrent::Variable<std::unordered_map<concurrent::FunctionId, Listener, concurrent::FunctionId::Hash>>
+        listeners_;
+};
+
+}  // namespace dynamic_config::impl
+
+USERVER_NAMESPACE_END
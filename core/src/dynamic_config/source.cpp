@@ -12,6 +12,10 @@ Source::Source(impl::StorageData& storage) : storage_(&storage) {}
 
 Snapshot Source::GetSnapshot() const { return Snapshot{*storage_}; }
 
+void Source::ReadCached(utils::function_ref<void(const impl::SnapshotData&)> func) const {
+    storage_->ReadCached(func);
+}
+
 Source::SnapshotEventSource& Source::GetEventChannel() { return storage_->GetChannel(); }
 
 concurrent::AsyncEventSubscriberScope
@@ -24,6 +28,15 @@ Source::DoUpdateAndListen(concurrent::FunctionId id, std::string_view name, Diff
     return storage_->DoUpdateAndListen(id, name, std::move(func));
 }
 
+concurrent::AsyncEventSubscriberScope Source::DoUpdateAndListen(
+    concurrent::FunctionId id,
+    std::string_view name,
+    std::vector<impl::ConfigId> config_ids,
+    DiffEventSource::Function&& func
+) {
+    return storage_->DoUpdateAndListen(id, name, std::move(config_ids), std::move(func));
+}
+
 }  // namespace dynamic_config
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <userver/dynamic_config/source.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const dynamic_config::Key kBenchmarkConfig{dynamic_config::ConstantConfig{}, 0};
+
+}  // namespace
+
+void dynamic_config_snapshot_read(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        const dynamic_config::StorageMock storage{{kBenchmarkConfig, 42}};
+        const auto source = storage.GetSource();
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                const auto snapshot = source.GetSnapshot();
+                benchmark::DoNotOptimize(snapshot[kBenchmarkConfig]);
+            }
+        });
+    });
+}
+BENCHMARK(dynamic_config_snapshot_read)->RangeMultiplier(2)->Range(1, 16);
+
+void dynamic_config_cached_read(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        const dynamic_config::StorageMock storage{{kBenchmarkConfig, 42}};
+        const auto source = storage.GetSource();
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                benchmark::DoNotOptimize(source.GetCopy(kBenchmarkConfig));
+            }
+        });
+    });
+}
+BENCHMARK(dynamic_config_cached_read)->RangeMultiplier(2)->Range(1, 16);
+
+USERVER_NAMESPACE_END
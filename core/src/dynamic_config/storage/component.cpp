@@ -177,7 +177,9 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater, std::str
 
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(const dynamic_config::DocsMap& value) {
     try {
-        dynamic_config::impl::SnapshotData config(value, {});
+        // Only the configs with changed JSON values are parsed
+        const auto previous_config = cache_.Read();
+        dynamic_config::impl::SnapshotData config(value, *previous_config);
         stats_.was_last_parse_successful = true;
         alert_storage_.StopAlertNow("config_parse_error");
         return config;
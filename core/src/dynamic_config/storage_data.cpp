@@ -3,16 +3,38 @@
 #include <mutex>
 #include <optional>
 
+#include <userver/compiler/thread_local.hpp>
 #include <userver/dynamic_config/impl/snapshot.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/dynamic_config/storage_mock.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dynamic_config::impl {
 
+namespace {
+
+std::atomic<std::uint64_t> version_counter{0};
+
+std::uint64_t MakeVersion() noexcept { return version_counter.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+struct CachedSnapshotData final {
+    // Versions are never reused, so a destroyed storage can't be confused with
+    // a new one allocated at the same address
+    std::uint64_t version{0};
+    SnapshotData data;
+};
+
+// The copy shares the parsed configs, which are kept alive until the thread
+// reads an updated config or exits
+compiler::ThreadLocal local_cached_data = [] { return CachedSnapshotData{}; };
+
+}  // namespace
+
 StorageData::StorageData(SnapshotData config)
     : config_(std::move(config)),
+      version_(MakeVersion()),
       snapshot_channel_(
           "dynamic-config-snapshot",
           [&](auto& func) {
@@ -20,17 +42,26 @@ StorageData::StorageData(SnapshotData config)
               if (!snapshot.GetData().IsEmpty()) func(snapshot);
           }
       ),
-      diff_channel_("dynamic-config-diff", [&](auto& func) {
-          auto snapshot = GetSnapshot();
-          if (snapshot.GetData().IsEmpty()) return;
-          const Diff diff{std::nullopt, std::move(snapshot)};
-          func(diff);
-      }) {}
+      diff_channel_("dynamic-config-diff", [&](auto& func) { NotifyOnRemoval(func); }),
+      keys_diff_channel_("dynamic-config-keys-diff", [&](auto& func) { NotifyOnRemoval(func); }) {}
 
 StorageData::StorageData() : StorageData(SnapshotData{}) {}
 
 rcu::ReadablePtr<SnapshotData> StorageData::Read() const { return config_.Read(); }
 
+void StorageData::ReadCached(utils::function_ref<void(const SnapshotData&)> func) const {
+    auto cached = local_cached_data.Use();
+    const auto version = version_.load(std::memory_order_acquire);
+    if (cached->version != version) {
+        // A newer config may be copied here, it is then copied once again on
+        // the next read, which is fine
+        const auto data = config_.Read();
+        cached->data = data->IsEmpty() ? SnapshotData{} : SnapshotData{*data, {}};
+        cached->version = version;
+    }
+    func(cached->data);
+}
+
 void StorageData::Update(SnapshotData config, AfterAssignHook after_assign_hook) {
     std::lock_guard lock(update_mutex_);
 
@@ -41,10 +72,12 @@ void StorageData::Update(SnapshotData config, AfterAssignHook after_assign_hook)
     }
 
     config_.Assign(std::move(config));
+    version_.store(MakeVersion(), std::memory_order_release);
     after_assign_hook();
 
     const Diff diff{std::move(previous_config), GetSnapshot()};
     diff_channel_.SendEvent(diff);
+    keys_diff_channel_.SendEvent(diff);
     snapshot_channel_.SendEvent(GetSnapshot());
 }
 
@@ -80,6 +113,27 @@ StorageData::DoUpdateAndListen(concurrent::FunctionId id, std::string_view name,
     return diff_channel_.DoUpdateAndListen(id, name, std::move(func), std::move(updater));
 }
 
+concurrent::AsyncEventSubscriberScope StorageData::DoUpdateAndListen(
+    concurrent::FunctionId id,
+    std::string_view name,
+    std::vector<ConfigId> config_ids,
+    DiffChannel::Function&& func
+) {
+    // Locked for the same reasons as above
+    std::lock_guard lock(update_mutex_);
+
+    const Diff diff{std::nullopt, GetSnapshot()};
+    func(diff);
+    return keys_diff_channel_.AddListener(id, name, std::move(config_ids), std::move(func));
+}
+
+void StorageData::NotifyOnRemoval(DiffChannel::Function& func) {
+    auto snapshot = GetSnapshot();
+    if (snapshot.GetData().IsEmpty()) return;
+    const Diff diff{std::nullopt, std::move(snapshot)};
+    func(diff);
+}
+
 }  // namespace dynamic_config::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
 #include <userver/concurrent/async_event_channel.hpp>
 #include <userver/dynamic_config/impl/snapshot.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
@@ -7,6 +10,8 @@
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/function_ref.hpp>
 
+#include <dynamic_config/keys_diff_channel.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace dynamic_config::impl {
@@ -22,6 +27,10 @@ public:
 
     rcu::ReadablePtr<SnapshotData> Read() const;
 
+    // Calls `func` with a thread-local copy of the current config, which is
+    // refreshed only when the config is updated. `func` must not suspend.
+    void ReadCached(utils::function_ref<void(const SnapshotData&)> func) const;
+
     void Update(SnapshotData config, AfterAssignHook after_assign_hook);
 
     SnapshotChannel& GetChannel();
@@ -32,12 +41,24 @@ public:
     concurrent::AsyncEventSubscriberScope
     DoUpdateAndListen(concurrent::FunctionId id, std::string_view name, DiffChannel::Function&& func);
 
+    concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
+        concurrent::FunctionId id,
+        std::string_view name,
+        std::vector<ConfigId> config_ids,
+        DiffChannel::Function&& func
+    );
+
 private:
     Snapshot GetSnapshot() { return Snapshot{*this}; }
 
+    void NotifyOnRemoval(DiffChannel::Function& func);
+
     rcu::Variable<SnapshotData> config_;
+    // Unique among all the storages, changes on every Update
+    std::atomic<std::uint64_t> version_;
     SnapshotChannel snapshot_channel_;
     DiffChannel diff_channel_;
+    KeysDiffChannel keys_diff_channel_;
 
     engine::Mutex update_mutex_;
 };
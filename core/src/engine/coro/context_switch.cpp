@@ -0,0 +1,116 @@
+#include <engine/coro/context_switch.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+#if defined(__CET__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#define USERVER_CORO_SHADOW_STACK ((__CET__ & 0x2) && SHADOW_STACK_SYSCALL)
+#else
+#define USERVER_CORO_SHADOW_STACK 0
+#endif
+
+#ifndef USERVER_CORO_HAS_FAST_SWITCH
+extern "C" {
+
+void* userver_coro_switch(void**, void*, void*) noexcept {
+    USERVER_NAMESPACE::utils::impl::AbortWithStacktrace("Coroutine context switch is not supported on this platform");
+}
+
+void* userver_coro_make(void*, void (*)(void*), void*) noexcept {
+    USERVER_NAMESPACE::utils::impl::AbortWithStacktrace("Coroutine context switch is not supported on this platform");
+}
+}
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+#if USERVER_CORO_SHADOW_STACK
+#ifndef SYS_map_shadow_stack
+#define SYS_map_shadow_stack 453
+#endif
+#ifndef SHADOW_STACK_SET_TOKEN
+#define SHADOW_STACK_SET_TOKEN 0x1
+#endif
+
+// A return address per 32 bytes of stack is more than enough
+std::size_t GetShadowStackSize(std::size_t stack_size) noexcept {
+    const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const auto size = stack_size / 32;
+    return (size + page_size - 1) / page_size * page_size;
+}
+#endif
+
+}  // namespace
+
+bool MachineContext::IsSupported() noexcept {
+#ifdef USERVER_CORO_HAS_FAST_SWITCH
+    return true;
+#else
+    return false;
+#endif
+}
+
+MachineContext::MachineContext(
+    [[maybe_unused]] void* stack,
+    [[maybe_unused]] std::size_t stack_size,
+    [[maybe_unused]] EntryFunction entry
+) {
+#ifdef USERVER_CORO_HAS_FAST_SWITCH
+    UASSERT(stack);
+    UASSERT(entry);
+    void* shadow_stack_top = nullptr;
+#if USERVER_CORO_SHADOW_STACK
+    shadow_stack_size_ = GetShadowStackSize(stack_size);
+    const auto shadow_stack = ::syscall(SYS_map_shadow_stack, 0, shadow_stack_size_, SHADOW_STACK_SET_TOKEN);
+    if (shadow_stack == -1) {
+        throw std::runtime_error("Failed to allocate a shadow stack for a coroutine");
+    }
+    shadow_stack_ = reinterpret_cast<void*>(shadow_stack);
+    shadow_stack_top = static_cast<char*>(shadow_stack_) + shadow_stack_size_;
+#endif
+    sp_ = userver_coro_make(static_cast<char*>(stack) + stack_size, entry, shadow_stack_top);
+#else
+    throw std::runtime_error("Coroutine context switch is not supported on this platform");
+#endif
+}
+
+MachineContext::MachineContext(MachineContext&& other) noexcept
+    : sp_(std::exchange(other.sp_, nullptr)),
+      shadow_stack_(std::exchange(other.shadow_stack_, nullptr)),
+      shadow_stack_size_(std::exchange(other.shadow_stack_size_, 0)) {}
+
+MachineContext& MachineContext::operator=(MachineContext&& other) noexcept {
+    if (this != &other) {
+        ReleaseShadowStack();
+        sp_ = std::exchange(other.sp_, nullptr);
+        shadow_stack_ = std::exchange(other.shadow_stack_, nullptr);
+        shadow_stack_size_ = std::exchange(other.shadow_stack_size_, 0);
+    }
+    return *this;
+}
+
+MachineContext::~MachineContext() { ReleaseShadowStack(); }
+
+void MachineContext::ReleaseShadowStack() noexcept {
+#if USERVER_CORO_SHADOW_STACK
+    if (shadow_stack_) {
+        ::munmap(shadow_stack_, shadow_stack_size_);
+    }
+#endif
+    shadow_stack_ = nullptr;
+    shadow_stack_size_ = 0;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+extern "C" {
+// Defined in third_party/uboost_coro/src/context/asm/switch_*.S or as aborting
+// stubs in context_switch.cpp
+void* userver_coro_switch(void** from_sp, void* to_sp, void* arg) noexcept;
+void* userver_coro_make(void* stack_top, void (*entry)(void*), void* ssp) noexcept;
+}
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+/// @brief Minimal stackful context on top of userver_coro_switch from
+/// third_party/uboost_coro/src/context/asm/switch_*.S
+///
+/// Only callee-saved registers are preserved on switch, FPU control words are
+/// preserved only with UBOOST_CORO_SWITCH_SAVE_FPU. With CET shadow stacks
+/// enabled (`-fcf-protection=return -DSHADOW_STACK_SYSCALL=1`, the same as for
+/// fcontext) each context gets its own shadow stack.
+///
+/// SwitchTo is inline, so that the return stack buffer of the CPU is not
+/// polluted by an extra call frame on each switch.
+///
+/// Not used by the engine yet, see context_switch_benchmark.cpp.
+class MachineContext final {
+public:
+    /// Must never return, switch to another context instead
+    using EntryFunction = void (*)(void* arg);
+
+    /// Whether userver_coro_switch is available on the current platform and
+    /// build configuration.
+    static bool IsSupported() noexcept;
+
+    /// Empty context, the current one is saved into it on SwitchTo
+    MachineContext() noexcept = default;
+
+    /// @brief Prepares a context on [stack, stack + stack_size), `entry` is
+    /// called with the argument of the first SwitchTo to it.
+    /// @throws std::runtime_error if !IsSupported() or the shadow stack could not
+    /// be allocated
+    MachineContext(void* stack, std::size_t stack_size, EntryFunction entry);
+
+    MachineContext(MachineContext&&) noexcept;
+    MachineContext& operator=(MachineContext&&) noexcept;
+    ~MachineContext();
+
+    /// @brief Saves the current context into `*this` and resumes `to`, passing
+    /// `arg` to it.
+    /// @returns `arg` of the SwitchTo that resumes `*this`
+    void* SwitchTo(MachineContext& to, void* arg) noexcept {
+        UASSERT(to.sp_);
+        return userver_coro_switch(&sp_, std::exchange(to.sp_, nullptr), arg);
+    }
+
+private:
+    void ReleaseShadowStack() noexcept;
+
+    void* sp_{nullptr};
+    void* shadow_stack_{nullptr};
+    std::size_t shadow_stack_size_{0};
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
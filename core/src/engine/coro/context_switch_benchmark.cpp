@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include <coroutines/coroutine.hpp>
+
+#include <engine/coro/context_switch.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackSize = 256 * 1024;
+
+struct PingPong final {
+    engine::coro::MachineContext main;
+    engine::coro::MachineContext coro;
+};
+
+[[noreturn]] void PingPongEntry(void* arg) {
+    auto& contexts = *static_cast<PingPong*>(arg);
+    for (;;) {
+        contexts.coro.SwitchTo(contexts.main, nullptr);
+    }
+}
+
+}  // namespace
+
+void coro_switch_machine_context(benchmark::State& state) {
+    if (!engine::coro::MachineContext::IsSupported()) {
+        state.SkipWithError("MachineContext is not supported on this platform");
+        return;
+    }
+
+    const auto stack = std::make_unique<char[]>(kStackSize);
+    PingPong contexts;
+    contexts.coro = engine::coro::MachineContext(stack.get(), kStackSize, &PingPongEntry);
+
+    for ([[maybe_unused]] auto _ : state) {
+        contexts.main.SwitchTo(contexts.coro, &contexts);
+    }
+}
+BENCHMARK(coro_switch_machine_context);
+
+void coro_switch_coroutines2(benchmark::State& state) {
+    using Coroutine = boost::coroutines2::coroutine<void*>;
+
+    Coroutine::push_type coro(boost::coroutines2::protected_fixedsize_stack(kStackSize), [](Coroutine::pull_type& sink) {
+        for ([[maybe_unused]] auto* arg : sink) {
+        }
+    });
+
+    for ([[maybe_unused]] auto _ : state) {
+        coro(nullptr);
+    }
+}
+BENCHMARK(coro_switch_coroutines2);
+
+USERVER_NAMESPACE_END
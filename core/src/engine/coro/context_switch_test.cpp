@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <engine/coro/context_switch.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackSize = 64 * 1024;
+
+struct Counter final {
+    engine::coro::MachineContext main;
+    engine::coro::MachineContext coro;
+    int value{0};
+};
+
+[[noreturn]] void CounterEntry(void* arg) {
+    auto& counter = *static_cast<Counter*>(arg);
+    for (;;) {
+        // Floating point math across switches checks the callee-saved registers
+        const double before = counter.value * 0.5;
+        auto* step = static_cast<int*>(counter.coro.SwitchTo(counter.main, &counter.value));
+        EXPECT_EQ(before, counter.value * 0.5);
+        counter.value += *step;
+    }
+}
+
+}  // namespace
+
+TEST(MachineContext, PingPong) {
+    if (!engine::coro::MachineContext::IsSupported()) {
+        GTEST_SKIP() << "MachineContext is not supported on this platform";
+    }
+
+    const auto stack = std::make_unique<char[]>(kStackSize);
+    Counter counter;
+    counter.coro = engine::coro::MachineContext(stack.get(), kStackSize, &CounterEntry);
+
+    // The first switch passes the argument of the entry function
+    auto* value = static_cast<int*>(counter.main.SwitchTo(counter.coro, &counter));
+    ASSERT_EQ(value, &counter.value);
+
+    int step = 3;
+    for (int i = 1; i <= 100; ++i) {
+        value = static_cast<int*>(counter.main.SwitchTo(counter.coro, &step));
+        EXPECT_EQ(*value, i * step);
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,16 @@
 #include <engine/coro/pool.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>  // for std::max/std::min
 #include <iterator>
+#include <limits>
 #include <optional>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
+#include <userver/utils/thread_name.hpp>
 
 #include <utils/sys_info.hpp>
 
@@ -17,12 +22,13 @@ Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
       local_coroutine_move_size_((config_.local_cache_size + 1) / 2),
-      stack_allocator_(config_.stack_size),
+      stack_allocator_(config_.stack_size, config_.huge_pages),
       stack_usage_monitor_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
       used_coroutines_(config_.max_size),
       idle_coroutines_num_(config_.initial_size),
-      total_coroutines_num_(0) {
+      total_coroutines_num_(0),
+      used_coroutines_low_watermark_(std::numeric_limits<std::size_t>::max()) {
     UASSERT(local_coroutine_move_size_ <= config_.local_cache_size);
     moodycamel::ProducerToken token(initial_coroutines_);
 
@@ -32,9 +38,22 @@ Pool::Pool(PoolConfig config, Executor executor)
         bool ok = initial_coroutines_.enqueue(token, CreateCoroutine(/*quiet =*/true));
         UINVARIANT(ok, "Failed to allocate the initial coro pool");
     }
+
+    if (config_.stack_reclaim_interval.count() > 0) {
+        reclaim_thread_ = std::thread{[this] { StackReclaimLoop(); }};
+    }
 }
 
-Pool::~Pool() = default;
+Pool::~Pool() {
+    if (reclaim_thread_.joinable()) {
+        {
+            const std::lock_guard lock{reclaim_mutex_};
+            is_reclaim_stopped_ = true;
+        }
+        reclaim_cv_.notify_all();
+        reclaim_thread_.join();
+    }
+}
 
 typename Pool::CoroutinePtr Pool::GetCoroutine() {
     struct CoroutineMover {
@@ -88,6 +107,8 @@ PoolStats Pool::GetStats() const {
     stats.total_coroutines = std::max(total_coroutines_num_.load(), stats.active_coroutines);
     stats.max_stack_usage_pct = stack_usage_monitor_.GetMaxStackUsagePct();
     stats.is_stack_usage_monitor_active = stack_usage_monitor_.IsActive();
+    stats.reclaimed_stack_bytes = reclaimed_stack_bytes_.load(std::memory_order_relaxed);
+    stats.destroyed_idle_coroutines = destroyed_idle_coroutines_.load(std::memory_order_relaxed);
     return stats;
 }
 
@@ -157,6 +178,7 @@ bool Pool::TryPopulateLocalCache() {
     if (dequeued_num == 0) return false;
 
     idle_coroutines_num_.fetch_sub(dequeued_num);
+    utils::AtomicMin(used_coroutines_low_watermark_, used_coroutines_.size_approx());
     return true;
 }
 
@@ -184,6 +206,91 @@ void Pool::DepopulateLocalCache() {
     local_coro_buffer_.erase(local_coro_buffer_.end() - local_coroutine_move_size_, local_coro_buffer_.end());
 }
 
+void Pool::StackReclaimLoop() {
+    utils::SetCurrentThreadName("coro-reclaim");
+
+    std::unique_lock lock{reclaim_mutex_};
+    while (!reclaim_cv_.wait_for(lock, config_.stack_reclaim_interval, [this] { return is_reclaim_stopped_; })) {
+        lock.unlock();
+        try {
+            ReclaimIdleCoroutines();
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "Failed to reclaim idle coroutines: " << ex;
+        }
+        lock.lock();
+    }
+}
+
+void Pool::ReclaimIdleCoroutines() {
+    const auto used_now = used_coroutines_.size_approx();
+    const auto idle_whole_period = std::min(used_coroutines_low_watermark_.exchange(used_now), used_now);
+    if (idle_whole_period == 0) return;
+
+    std::vector<Coroutine> coroutines;
+    coroutines.reserve(idle_whole_period);
+    const auto dequeued_num = used_coroutines_.try_dequeue_bulk(
+        GetUsedPoolToken<moodycamel::ConsumerToken>(), std::back_inserter(coroutines), idle_whole_period
+    );
+    if (dequeued_num == 0) return;
+    idle_coroutines_num_.fetch_sub(dequeued_num);
+
+    // Shrinking: a half of the coroutines above initial_size that were not
+    // needed during the whole period are destroyed, so that the pool shrinks
+    // gradually after a spike
+    const auto total = total_coroutines_num_.load();
+    const auto excess = total > config_.initial_size ? total - config_.initial_size : 0;
+    const auto destroy_num = std::min(dequeued_num, (excess + 1) / 2);
+    coroutines.erase(coroutines.begin(), coroutines.begin() + destroy_num);
+    total_coroutines_num_ -= destroy_num;
+    destroyed_idle_coroutines_.fetch_add(destroy_num, std::memory_order_relaxed);
+
+    std::uint64_t reclaimed_bytes = 0;
+    std::vector<MincoreVecItem> residency(config_.stack_size / utils::sys_info::GetPageSize());
+    for (const auto& coroutine : coroutines) {
+        reclaimed_bytes += ReclaimStack(coroutine, residency);
+    }
+    reclaimed_stack_bytes_.fetch_add(reclaimed_bytes, std::memory_order_relaxed);
+
+    const auto return_num = coroutines.size();
+    const bool ok = used_coroutines_.enqueue_bulk(
+        GetUsedPoolToken<moodycamel::ProducerToken>(), std::make_move_iterator(coroutines.begin()), return_num
+    );
+    if (ok) {
+        idle_coroutines_num_.fetch_add(return_num);
+    } else {
+        total_coroutines_num_ -= return_num;
+    }
+
+    if (destroy_num != 0 || reclaimed_bytes != 0) {
+        LOG_DEBUG() << "Destroyed " << destroy_num << " idle coroutines, released " << reclaimed_bytes
+                    << " bytes of stacks of " << return_num << " idle coroutines";
+    }
+}
+
+std::size_t Pool::ReclaimStack(const Coroutine& coroutine, std::vector<MincoreVecItem>& residency) noexcept {
+    // MADV_DONTNEED on a part of a huge page splits it
+    if (stack_allocator_.UsesHugePages()) return 0;
+
+    const auto range = GetUnusedStackRange(coroutine, config_.stack_size);
+    if (range.begin == range.end) return 0;
+
+    auto* const begin = reinterpret_cast<void*>(range.begin);
+    const auto size = range.end - range.begin;
+    const auto page_size = utils::sys_info::GetPageSize();
+
+    // Only count and release the pages that are actually resident
+    const auto pages = size / page_size;
+    UASSERT(pages <= residency.size());
+    if (::mincore(begin, size, residency.data()) == -1) return 0;
+    const auto resident_pages = std::count_if(residency.begin(), residency.begin() + pages, [](MincoreVecItem page) {
+        return (page & 1) != 0;
+    });
+    if (resident_pages == 0) return 0;
+
+    if (::madvise(begin, size, MADV_DONTNEED) == -1) return 0;
+    return static_cast<std::size_t>(resident_pages) * page_size;
+}
+
 std::size_t Pool::GetStackSize() const { return config_.stack_size; }
 
 PoolConfig Pool::FixupConfig(PoolConfig&& config) {
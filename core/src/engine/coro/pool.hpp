@@ -1,12 +1,17 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
 #include <engine/coro/pool_config.hpp>
 #include <engine/coro/pool_stats.hpp>
+#include <engine/coro/stack_allocator.hpp>
 #include <engine/coro/stack_usage_monitor.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -44,6 +49,16 @@ private:
     bool TryPopulateLocalCache();
     void DepopulateLocalCache();
 
+#ifdef __APPLE__
+    using MincoreVecItem = char;
+#else
+    using MincoreVecItem = unsigned char;
+#endif
+
+    void StackReclaimLoop();
+    void ReclaimIdleCoroutines();
+    std::size_t ReclaimStack(const Coroutine& coroutine, std::vector<MincoreVecItem>& residency) noexcept;
+
     template <typename Token>
     Token& GetUsedPoolToken();
 
@@ -60,10 +75,10 @@ private:
     // outside of any coroutine.
     static inline thread_local std::vector<Coroutine> local_coro_buffer_;
 
-    boost::coroutines2::protected_fixedsize_stack stack_allocator_;
-    // Some pointers arithmetic in StackUsageMonitor depends on this.
-    // If you change the allocator, adjust the math there accordingly.
-    static_assert(std::is_same_v<decltype(stack_allocator_), boost::coroutines2::protected_fixedsize_stack>);
+    // Some pointers arithmetic in StackUsageMonitor depends on the stack
+    // layout of StackAllocator. If you change the allocator, adjust the math
+    // there accordingly.
+    StackAllocator stack_allocator_;
     StackUsageMonitor stack_usage_monitor_;
 
     // We aim to reuse coroutines as much as possible,
@@ -77,6 +92,17 @@ private:
 
     std::atomic<std::size_t> idle_coroutines_num_;
     std::atomic<std::size_t> total_coroutines_num_;
+
+    // Min size of used_coroutines_ since the last reclamation, these
+    // coroutines were not needed during the whole period
+    std::atomic<std::size_t> used_coroutines_low_watermark_;
+    std::atomic<std::uint64_t> reclaimed_stack_bytes_{0};
+    std::atomic<std::uint64_t> destroyed_idle_coroutines_{0};
+
+    std::mutex reclaim_mutex_;
+    std::condition_variable reclaim_cv_;
+    bool is_reclaim_stopped_{false};
+    std::thread reclaim_thread_;
 };
 
 class Pool::CoroutinePtr final {
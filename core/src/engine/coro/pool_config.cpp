@@ -10,6 +10,9 @@ PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolCo
     config.max_size = value["max_size"].As<size_t>(config.max_size);
     config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
     config.local_cache_size = value["local_cache_size"].As<size_t>(config.local_cache_size);
+    config.stack_reclaim_interval =
+        value["stack_reclaim_interval"].As<std::chrono::milliseconds>(config.stack_reclaim_interval);
+    config.huge_pages = value["huge_pages"].As<bool>(config.huge_pages);
     return config;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -14,6 +15,8 @@ struct PoolConfig {
     std::size_t max_size = 4000;
     std::size_t stack_size = 256 * 1024ULL;
     std::size_t local_cache_size = 8;
+    std::chrono::milliseconds stack_reclaim_interval{0};
+    bool huge_pages = false;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>);
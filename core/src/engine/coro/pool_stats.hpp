@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,6 +13,10 @@ struct PoolStats {
     size_t total_coroutines = 0;
     std::uint16_t max_stack_usage_pct = 0;
     bool is_stack_usage_monitor_active = false;
+    // Resident stack memory of idle coroutines released to the OS, cumulative
+    std::uint64_t reclaimed_stack_bytes = 0;
+    // Idle coroutines destroyed to shrink the pool, cumulative
+    std::uint64_t destroyed_idle_coroutines = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
@@ -21,6 +26,8 @@ inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
         lhs.max_stack_usage_pct = rhs.max_stack_usage_pct;
     }
     lhs.is_stack_usage_monitor_active |= rhs.is_stack_usage_monitor_active;
+    lhs.reclaimed_stack_bytes += rhs.reclaimed_stack_bytes;
+    lhs.destroyed_idle_coroutines += rhs.destroyed_idle_coroutines;
     return lhs;
 }
 
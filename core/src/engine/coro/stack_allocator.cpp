@@ -0,0 +1,132 @@
+#include <engine/coro/stack_allocator.hpp>
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+// PMD size of x86_64 and of aarch64 with 4K pages
+constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+
+constexpr std::size_t RoundUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+class HugePageStackArena final {
+public:
+    explicit HugePageStackArena(std::size_t stack_size)
+        : stack_size_(stack_size), chunk_size_(RoundUp(stack_size, kHugePageSize)) {
+        UASSERT(stack_size_ % utils::sys_info::GetPageSize() == 0);
+    }
+
+    HugePageStackArena(const HugePageStackArena&) = delete;
+    HugePageStackArena& operator=(const HugePageStackArena&) = delete;
+
+    ~HugePageStackArena() {
+        for (const auto& [address, size] : mappings_) ::munmap(address, size);
+    }
+
+    std::size_t GetStackSize() const noexcept { return stack_size_; }
+
+    // Returns the lowest address of the stack
+    char* Allocate() {
+        const std::lock_guard lock{mutex_};
+        if (free_stacks_.empty()) AllocateChunk();
+
+        auto* stack = free_stacks_.back();
+        free_stacks_.pop_back();
+        return stack;
+    }
+
+    void Deallocate(char* stack) noexcept {
+        const std::lock_guard lock{mutex_};
+        // Was reserved in AllocateChunk
+        free_stacks_.push_back(stack);
+    }
+
+private:
+    void AllocateChunk() {
+        const auto page_size = utils::sys_info::GetPageSize();
+        // Room for the alignment and for the guard page below the chunk
+        const auto mapping_size = chunk_size_ + kHugePageSize + page_size;
+        void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) throw std::bad_alloc();
+        mappings_.emplace_back(mapping, mapping_size);
+
+        const auto mapping_address = reinterpret_cast<std::uintptr_t>(mapping);
+        auto* const chunk = reinterpret_cast<char*>(RoundUp(mapping_address + page_size, kHugePageSize));
+        if (::mprotect(chunk - page_size, page_size, PROT_NONE) == -1) {
+            throw std::system_error(errno, std::generic_category(), "mprotect");
+        }
+#ifdef MADV_HUGEPAGE
+        if (::madvise(chunk, chunk_size_, MADV_HUGEPAGE) == -1) {
+            LOG_LIMITED_WARNING() << "madvise(MADV_HUGEPAGE) failed for coroutine stacks, are transparent huge pages "
+                                     "disabled? errno="
+                                  << errno;
+        }
+#endif
+
+        const auto stacks_count = chunk_size_ / stack_size_;
+        all_stacks_count_ += stacks_count;
+        // The coroutines return the stacks on destruction, so the capacity
+        // must be enough for all of them to keep Deallocate noexcept
+        free_stacks_.reserve(all_stacks_count_);
+        // Pushed highest first, so that the stacks are taken starting from the
+        // bottom of the chunk, next to the guard page
+        for (std::size_t i = stacks_count; i > 0; --i) {
+            free_stacks_.push_back(chunk + (i - 1) * stack_size_);
+        }
+    }
+
+    const std::size_t stack_size_;
+    const std::size_t chunk_size_;
+
+    std::mutex mutex_;
+    std::vector<char*> free_stacks_;
+    std::size_t all_stacks_count_{0};
+    std::vector<std::pair<void*, std::size_t>> mappings_;
+};
+
+StackAllocator::StackAllocator(std::size_t stack_size, bool use_huge_pages)
+    : regular_(stack_size), arena_(use_huge_pages ? std::make_shared<HugePageStackArena>(stack_size) : nullptr) {}
+
+boost::context::stack_context StackAllocator::allocate() {
+    if (!arena_) return regular_.allocate();
+
+    boost::context::stack_context sctx;
+    // As in protected_fixedsize_stack, `size` is counted down from `sp`
+    sctx.size = arena_->GetStackSize();
+    sctx.sp = arena_->Allocate() + sctx.size;
+    return sctx;
+}
+
+void StackAllocator::deallocate(boost::context::stack_context& sctx) noexcept {
+    if (!arena_) {
+        regular_.deallocate(sctx);
+        return;
+    }
+
+    arena_->Deallocate(static_cast<char*>(sctx.sp) - sctx.size);
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
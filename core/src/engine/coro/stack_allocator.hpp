@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <coroutines/coroutine.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+class HugePageStackArena;
+
+/// Stack allocator of the coroutines of coro::Pool.
+///
+/// By default works as boost::coroutines2::protected_fixedsize_stack: each
+/// stack is a separate mapping with a guard page below it.
+///
+/// With `use_huge_pages` the stacks are carved out of 2 MiB aligned chunks
+/// marked with MADV_HUGEPAGE, so that a single TLB entry covers several
+/// stacks. Splitting a huge page with a guard page would defeat the purpose,
+/// so there is a single guard page below each chunk: an overflow of any but
+/// the lowest stack of a chunk corrupts the neighbouring stack instead of
+/// crashing. The memory of the destroyed coroutines is reused, not returned
+/// to the OS.
+///
+/// In both modes a stack occupies exactly `stack_size` bytes below
+/// `stack_context::sp`, StackUsageMonitor and GetUnusedStackRange rely on that.
+class StackAllocator final {
+public:
+    StackAllocator(std::size_t stack_size, bool use_huge_pages);
+
+    boost::context::stack_context allocate();
+
+    void deallocate(boost::context::stack_context& sctx) noexcept;
+
+    bool UsesHugePages() const noexcept { return arena_ != nullptr; }
+
+private:
+    boost::coroutines2::protected_fixedsize_stack regular_;
+    // Shared with the copies stored in the coroutines
+    std::shared_ptr<HugePageStackArena> arena_;
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <engine/coro/stack_allocator.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackSize = 256 * 1024;
+
+void CheckStacks(engine::coro::StackAllocator& allocator) {
+    std::vector<boost::context::stack_context> stacks;
+    std::set<char*> tops;
+    // More than fits into a single huge page chunk
+    for (int i = 0; i < 20; ++i) {
+        stacks.push_back(allocator.allocate());
+        auto& sctx = stacks.back();
+        ASSERT_GE(sctx.size, kStackSize);
+        auto* const top = static_cast<char*>(sctx.sp);
+        EXPECT_TRUE(tops.insert(top).second);
+        // The whole stack is writable
+        std::memset(top - kStackSize, 0xAB, kStackSize);
+    }
+
+    // The stacks do not overlap
+    std::set<char*> ordered_tops = tops;
+    char* previous_top = nullptr;
+    for (auto* top : ordered_tops) {
+        if (previous_top) EXPECT_GE(top - previous_top, static_cast<std::ptrdiff_t>(kStackSize));
+        previous_top = top;
+    }
+
+    for (auto& sctx : stacks) allocator.deallocate(sctx);
+}
+
+}  // namespace
+
+TEST(CoroStackAllocator, Regular) {
+    engine::coro::StackAllocator allocator{kStackSize, false};
+    EXPECT_FALSE(allocator.UsesHugePages());
+    CheckStacks(allocator);
+}
+
+TEST(CoroStackAllocator, HugePages) {
+    engine::coro::StackAllocator allocator{kStackSize, true};
+    EXPECT_TRUE(allocator.UsesHugePages());
+    CheckStacks(allocator);
+
+    // The stacks are reused
+    auto sctx = allocator.allocate();
+    auto copy = allocator;
+    copy.deallocate(sctx);
+    auto reused = allocator.allocate();
+    EXPECT_EQ(reused.sp, sctx.sp);
+    allocator.deallocate(reused);
+}
+
+TEST(CoroStackAllocator, HugePagesBigStack) {
+    constexpr std::size_t kBigStackSize = 3 * 1024 * 1024;
+    engine::coro::StackAllocator allocator{kBigStackSize, true};
+    auto first = allocator.allocate();
+    auto second = allocator.allocate();
+    EXPECT_EQ(first.size, kBigStackSize);
+    EXPECT_NE(first.sp, second.sp);
+    std::memset(static_cast<char*>(first.sp) - kBigStackSize, 0, kBigStackSize);
+    allocator.deallocate(first);
+    allocator.deallocate(second);
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,9 @@
 
 #include <coroutines/coroutine.hpp>
 
+#include <cstdint>
+#include <cstring>
+
 #include <engine/task/task_context.hpp>
 #include <utils/sys_info.hpp>
 
@@ -57,6 +60,22 @@ public:
     static const void* GetCbPtr(const push_coroutine<T>& coro) {
         return coro.cb_;
     }
+
+    // Returns the context saved on the stack of the suspended coroutine, i.e.
+    // its stack pointer, or nullptr if the context implementation is unknown
+    template <typename T>
+    static const void* GetSuspendedContextPtr(const push_coroutine<T>& coro) noexcept {
+        if (!coro.cb_) return nullptr;
+        const auto& fiber = coro.cb_->c;
+        // fcontext-based fiber is a single pointer to the saved context
+        if constexpr (sizeof(fiber) == sizeof(void*)) {
+            const void* context = nullptr;
+            std::memcpy(&context, &fiber, sizeof(context));
+            return context;
+        } else {
+            return nullptr;
+        }
+    }
 };
 }  // namespace boost::coroutines2::detail
 
@@ -68,6 +87,31 @@ const void* GetCoroCbPtr(const boost::coroutines2::coroutine<impl::TaskContext*>
     return boost::coroutines2::detail::pull_coroutine<boost::coroutines2::detail::FriendHijackTag>::GetCbPtr(coro);
 }
 
+UnusedStackRange GetUnusedStackRange(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro,
+    std::size_t stack_size
+) noexcept {
+    using Hijack = boost::coroutines2::detail::pull_coroutine<boost::coroutines2::detail::FriendHijackTag>;
+    const auto* const context = Hijack::GetSuspendedContextPtr(coro);
+    if (!context) return {};
+
+    const auto page_size = utils::sys_info::GetPageSize();
+    // The control block resides at the top of the stack, see GetStackBegin
+    const auto cb_address = reinterpret_cast<std::uintptr_t>(GetCoroCbPtr(coro));
+    const auto stack_begin = (cb_address + page_size - 1) & ~(page_size - 1);
+    // protected_fixedsize_stack puts the guard page below `stack_size` bytes
+    const auto stack_end = stack_begin - stack_size;
+
+    // Frames and the saved context of the coroutine are above the context
+    // pointer, a page below it is kept as well for the red zone
+    const auto context_address = reinterpret_cast<std::uintptr_t>(context);
+    if (context_address <= stack_end || context_address > stack_begin) return {};
+    const auto unused_end = (context_address & ~(page_size - 1)) - page_size;
+    if (unused_end <= stack_end) return {};
+
+    return {stack_end, unused_end};
+}
+
 #ifdef HAS_STACK_USAGE_MONITOR
 
 #if !defined(UFFD_USER_MODE_ONLY)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include <coroutines/coroutine.hpp>
@@ -42,6 +43,20 @@ private:
 
 std::size_t GetCurrentTaskStackUsageBytes() noexcept;
 
+/// Page-aligned address range [begin, end) of a coroutine stack
+struct UnusedStackRange final {
+    std::uintptr_t begin{0};
+    std::uintptr_t end{0};
+};
+
+/// @brief Returns the part of the stack of a suspended coroutine that is below
+/// all of its frames, so that its memory may be released. Returns an empty
+/// range if that can not be determined.
+UnusedStackRange GetUnusedStackRange(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro,
+    std::size_t stack_size
+) noexcept;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -1,7 +1,10 @@
 #include <benchmark/benchmark.h>
 
 #include <chrono>
+#include <memory>
+#include <vector>
 
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 
 #include <utils/gbench_auxilary.hpp>
@@ -43,6 +46,30 @@ void deadline_20ms_interval_reached(benchmark::State& state) {
 
 void deadline_100s_interval_reached(benchmark::State& state) { deadline_is_reached(state, std::chrono::seconds{100}); }
 
+// Arms and cancels a timer with `state.range(0)` other timers pending, as
+// most of the engine deadlines are cancelled before firing
+void deadline_timer_wheel_arm_cancel(benchmark::State& state) {
+    using engine::ev::TimerWheel;
+    constexpr TimerWheel::Entry::Callback kNoop = [](TimerWheel::Entry&) noexcept {};
+
+    const auto now = TimerWheel::Clock::now();
+    TimerWheel wheel{now};
+
+    std::vector<std::unique_ptr<TimerWheel::Entry>> pending;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        auto& entry = *pending.emplace_back(std::make_unique<TimerWheel::Entry>(kNoop));
+        wheel.Schedule(entry, now + std::chrono::milliseconds{i % 100'000}, now);
+    }
+
+    TimerWheel::Entry entry{kNoop};
+    for ([[maybe_unused]] auto _ : state) {
+        wheel.Schedule(entry, now + std::chrono::seconds{20}, now);
+        wheel.Cancel(entry);
+    }
+
+    for (auto& pending_entry : pending) wheel.Cancel(*pending_entry);
+}
+
 }  // namespace
 
 BENCHMARK(deadline_1us_interval_construction);
@@ -52,4 +79,6 @@ BENCHMARK(deadline_1us_interval_reached);
 BENCHMARK(deadline_20ms_interval_reached);
 BENCHMARK(deadline_100s_interval_reached);
 
+BENCHMARK(deadline_timer_wheel_arm_cancel)->RangeMultiplier(32)->Range(1, 1 << 20);
+
 USERVER_NAMESPACE_END
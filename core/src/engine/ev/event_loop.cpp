@@ -40,9 +40,46 @@ void ReleaseEvDefaultLoop() {
     GetEvDefaultLoopFlag().clear();
 }
 
+#if EV_VERSION_MAJOR > 4 || (EV_VERSION_MAJOR == 4 && EV_VERSION_MINOR >= 31)
+constexpr unsigned kEvBackendIoUring = EVBACKEND_IOURING;
+#else
+// Older libev headers do not declare it, ev_supported_backends() reports
+// the actual availability
+constexpr unsigned kEvBackendIoUring = 0x00000080U;
+#endif
+
+unsigned GetEvLoopFlags(EvBackend backend) noexcept {
+    switch (backend) {
+        case EvBackend::kAuto:
+            return EVFLAG_AUTO;
+        case EvBackend::kEpoll:
+            return EVBACKEND_EPOLL;
+        case EvBackend::kIoUring:
+            if (!(ev_supported_backends() & kEvBackendIoUring)) {
+                LOG_WARNING() << "io_uring ev backend was requested, but libev was built without "
+                                 "io_uring support. Falling back to epoll";
+                return EVBACKEND_EPOLL;
+            }
+            // libev tries the backends in order and falls back to epoll if
+            // io_uring_setup() fails (old kernel, seccomp, RLIMIT_MEMLOCK).
+            return kEvBackendIoUring | EVBACKEND_EPOLL;
+    }
+
+    UASSERT_MSG(false, "Unexpected EvBackend");
+    return EVFLAG_AUTO;
+}
+
+std::string_view GetEvBackendName(unsigned backend) noexcept {
+    if (backend & kEvBackendIoUring) return "io_uring";
+    if (backend & EVBACKEND_EPOLL) return "epoll";
+    if (backend & EVBACKEND_POLL) return "poll";
+    if (backend & EVBACKEND_SELECT) return "select";
+    return "unknown";
+}
+
 }  // namespace
 
-EventLoop::EventLoop(EvLoopType ev_loop_mode) : ev_loop_mode_(ev_loop_mode) {
+EventLoop::EventLoop(EvLoopType ev_loop_mode, EvBackend backend) : ev_loop_mode_(ev_loop_mode), backend_(backend) {
     if (ev_loop_mode_ == EvLoopType::kDefaultLoop) AcquireEvDefaultLoop();
     Start();
 }
@@ -61,6 +98,11 @@ void EventLoop::RunOnce() noexcept {
     ev_run(loop_, EVRUN_ONCE);
 }
 
+void EventLoop::PollOnce() noexcept {
+    UASSERT(DebugIsSameOsThread());
+    ev_run(loop_, EVRUN_NOWAIT);
+}
+
 void EventLoop::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
     UASSERT(DebugIsSameOsThread());
     payload.PerformAndRelease();
@@ -78,9 +120,13 @@ bool EventLoop::DebugIsSameOsThread() noexcept {
 }
 
 void EventLoop::Start() {
-    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(EVFLAG_AUTO) : ev_loop_new(EVFLAG_AUTO));
+    const auto flags = GetEvLoopFlags(backend_);
+    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(flags) : ev_loop_new(flags));
 
     UASSERT(loop_);
+    if (backend_ != EvBackend::kAuto) {
+        LOG_DEBUG() << "Using '" << GetEvBackendName(ev_backend(loop_)) << "' ev backend";
+    }
 #ifdef EV_HAS_IO_PESSIMISTIC_REMOVE
     ev_set_io_pessimistic_remove(loop_);
 #endif
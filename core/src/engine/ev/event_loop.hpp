@@ -5,6 +5,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/thread_pool_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,7 +18,7 @@ public:
         kDefaultLoop,
     };
 
-    explicit EventLoop(EvLoopType ev_loop_mode);
+    explicit EventLoop(EvLoopType ev_loop_mode, EvBackend backend = EvBackend::kAuto);
 
     ~EventLoop();
 
@@ -25,6 +26,9 @@ public:
 
     void RunOnce() noexcept;
 
+    // Same as RunOnce() but does not wait for the events
+    void PollOnce() noexcept;
+
     // Callbacks passed to RunInEvLoopAsync() are serialized.
     // All callbacks are guaranteed to execute.
     void RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
@@ -43,6 +47,7 @@ private:
     ev_child watch_child_{};
 
     const EvLoopType ev_loop_mode_;
+    const EvBackend backend_;
 
 #ifndef NDEBUG
     std::thread::id os_thread_id_{};
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 
@@ -10,6 +11,7 @@
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
 #include <userver/utils/thread_name.hpp>
 
+#include <engine/ev/wakeup_batch.hpp>
 #include <utils/check_syscall.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -25,15 +27,23 @@ const auto kDeferredInterval = kMinDurationToDefer - utils::datetime::SteadyCoar
 // Check the time at least twice per collect interval
 const auto kCpuStatsThrottle = static_cast<std::size_t>(kCpuStatsCollectInterval / kDeferredInterval / 2);
 
+// ev_timer_again() does not start a timer with zero repeat, so a wakeup that
+// is due already is postponed a bit
+constexpr std::chrono::duration<double> kMinTimerWheelWakeupDelay = std::chrono::microseconds{1};
+
 }  // namespace
 
-Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop) {}
+Thread::Thread(const std::string& thread_name, EvBackend backend, bool busy_poll)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, backend, busy_poll) {}
 
-Thread::Thread(const std::string& thread_name, UseDefaultEvLoop)
-    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop) {}
+Thread::Thread(const std::string& thread_name, UseDefaultEvLoop, EvBackend backend, bool busy_poll)
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, backend, busy_poll) {}
 
-Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type)
-    : event_loop_(ev_loop_type), name_{thread_name}, cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
+Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, EvBackend backend, bool busy_poll)
+    : event_loop_(ev_loop_type, backend),
+      name_{thread_name},
+      cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle},
+      busy_poll_(busy_poll) {
     UASSERT_MSG(kDeferredInterval > std::chrono::milliseconds{4}, "Timer events would happen too often");
     Start();
 }
@@ -43,8 +53,8 @@ Thread::~Thread() { StopEventLoop(); }
 void Thread::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
     RegisterInEvLoop(payload);
 
-    if (!IsInEvThread()) {
-        ev_async_send(GetEvLoop(), &watch_update_);
+    if (!IsInEvThread() && !impl::TryBatchWakeup(*this)) {
+        WakeUp();
     }
 }
 
@@ -65,7 +75,9 @@ void Thread::RunInEvLoopDeferred(AsyncPayloadBase& payload, Deadline deadline) n
         return;
     }
 
-    ev_async_send(GetEvLoop(), &watch_update_);
+    if (!impl::TryBatchWakeup(*this)) {
+        WakeUp();
+    }
 }
 
 void Thread::RegisterInEvLoop(AsyncPayloadBase& payload) {
@@ -79,6 +91,30 @@ void Thread::RegisterInEvLoop(AsyncPayloadBase& payload) {
 
 bool Thread::IsInEvThread() const { return (std::this_thread::get_id() == thread_.get_id()); }
 
+void Thread::WakeUp() noexcept { ev_async_send(GetEvLoop(), &watch_update_); }
+
+void Thread::ScheduleTimer(TimerWheel::Entry& entry, Deadline deadline) noexcept {
+    UASSERT(IsInEvThread());
+    UASSERT(deadline.IsReachable());
+
+    // TimeLeft() is taken first, so that the expiry is never before the deadline
+    const auto time_left = deadline.TimeLeft();
+    const auto now = TimerWheel::Clock::now();
+    timer_wheel_.Schedule(entry, now + time_left, now);
+
+    const auto wakeup = timer_wheel_.GetNextWakeup();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    if (!timer_wheel_wakeup_ || *wakeup < *timer_wheel_wakeup_ || !ev_is_active(&timer_wheel_watcher_)) {
+        UpdateTimerWheelWatcher();
+    }
+}
+
+void Thread::CancelTimer(TimerWheel::Entry& entry) noexcept {
+    UASSERT(IsInEvThread());
+    // The watcher is not rearmed, a spurious wakeup is cheaper
+    timer_wheel_.Cancel(entry);
+}
+
 std::uint8_t Thread::GetCurrentLoadPercent() const { return cpu_stats_storage_.GetCurrentLoadPercent(); }
 
 const std::string& Thread::GetName() const { return name_; }
@@ -109,6 +145,9 @@ void Thread::Start() {
     ev_timer_init(&defer_timer_, UpdateTimersWatcher, 0.0, defer_duration.count());
     ev_timer_start(loop, &defer_timer_);
 
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_timer_init(&timer_wheel_watcher_, TimerWheelWatcher, 0.0, 0.0);
+
     is_running_ = true;
     thread_ = std::thread([this] {
         utils::SetCurrentThreadName(name_);
@@ -128,7 +167,11 @@ void Thread::StopEventLoop() {
 void Thread::RunEvLoop() {
     while (is_running_) {
         AcquireImpl();
-        event_loop_.RunOnce();
+        if (busy_poll_) {
+            event_loop_.PollOnce();
+        } else {
+            event_loop_.RunOnce();
+        }
         UpdateLoopWatcherImpl();
         cpu_stats_storage_.Collect();
         ReleaseImpl();
@@ -137,6 +180,7 @@ void Thread::RunEvLoop() {
     ev_async_stop(GetEvLoop(), &watch_update_);
     ev_async_stop(GetEvLoop(), &watch_break_);
     ev_timer_stop(GetEvLoop(), &defer_timer_);
+    ev_timer_stop(GetEvLoop(), &timer_wheel_watcher_);
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -151,6 +195,28 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*, int) noexcept
     ev_thread->UpdateLoopWatcherImpl();
 }
 
+void Thread::TimerWheelWatcher(struct ev_loop* loop, ev_timer*, int) noexcept {
+    auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+    UASSERT(ev_thread != nullptr);
+    ev_thread->timer_wheel_.Advance(TimerWheel::Clock::now());
+    ev_thread->UpdateTimerWheelWatcher();
+}
+
+void Thread::UpdateTimerWheelWatcher() noexcept {
+    timer_wheel_wakeup_ = timer_wheel_.GetNextWakeup();
+    if (!timer_wheel_wakeup_) {
+        ev_timer_stop(GetEvLoop(), &timer_wheel_watcher_);
+        return;
+    }
+
+    using LibEvDuration = std::chrono::duration<double>;
+    const auto time_left = std::chrono::duration_cast<LibEvDuration>(*timer_wheel_wakeup_ - TimerWheel::Clock::now());
+    timer_wheel_watcher_.repeat = std::max(time_left, kMinTimerWheelWakeupDelay).count();
+
+    ev_now_update(GetEvLoop());
+    ev_timer_again(GetEvLoop(), &timer_wheel_watcher_);
+}
+
 void Thread::UpdateLoopWatcherImpl() {
     while (AsyncPayloadBase* payload = func_queue_.TryPopBlocking()) {
         LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), " << compiler::GetTypeName(typeid(*payload));
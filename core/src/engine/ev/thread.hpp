@@ -3,6 +3,7 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 
@@ -12,6 +13,7 @@
 
 #include <engine/ev/async_payload_base.hpp>
 #include <engine/ev/event_loop.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -27,8 +29,15 @@ public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
-    explicit Thread(const std::string& thread_name);
-    Thread(const std::string& thread_name, UseDefaultEvLoop);
+    // With `busy_poll` the thread spins in non-blocking ev iterations instead
+    // of sleeping in the backend, trading a whole CPU for the wakeup latency.
+    explicit Thread(const std::string& thread_name, EvBackend backend = EvBackend::kAuto, bool busy_poll = false);
+    Thread(
+        const std::string& thread_name,
+        UseDefaultEvLoop,
+        EvBackend backend = EvBackend::kAuto,
+        bool busy_poll = false
+    );
 
     ~Thread();
 
@@ -45,11 +54,23 @@ public:
 
     bool IsInEvThread() const;
 
+    // Wakes up the ev thread to run the queued callbacks. Prefer
+    // RunInEvLoopAsync(), that batches the wakeups.
+    void WakeUp() noexcept;
+
+    // Schedules the entry in the timer wheel of the thread, the callback of the
+    // entry is invoked in the ev thread after the `deadline`. Should be called
+    // from the ev thread.
+    void ScheduleTimer(TimerWheel::Entry& entry, Deadline deadline) noexcept;
+
+    // Should be called from the ev thread.
+    void CancelTimer(TimerWheel::Entry& entry) noexcept;
+
     std::uint8_t GetCurrentLoadPercent() const;
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, EvBackend backend, bool busy_poll);
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -60,6 +81,8 @@ private:
 
     static void UpdateLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     static void UpdateTimersWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+    static void TimerWheelWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+    void UpdateTimerWheelWatcher() noexcept;
     void UpdateLoopWatcherImpl();
     static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     void BreakLoopWatcherImpl();
@@ -78,12 +101,18 @@ private:
     std::unique_lock<std::mutex> lock_{loop_mutex_, std::defer_lock};
 
     ev_timer defer_timer_{};
+
+    // A single ev_timer drives all the engine timers of the thread
+    TimerWheel timer_wheel_;
+    ev_timer timer_wheel_watcher_{};
+    std::optional<TimerWheel::Clock::time_point> timer_wheel_wakeup_{};
     ev_async watch_update_{};
     ev_async watch_break_{};
 
     const std::string name_;
     utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
     bool is_running_{false};
+    const bool busy_poll_;
 };
 
 }  // namespace engine::ev
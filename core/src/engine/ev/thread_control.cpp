@@ -68,6 +68,14 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
     ev_io_stop(GetEvLoop(), &w);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoSchedule(TimerWheel::Entry& entry, Deadline deadline) noexcept {
+    thread_.ScheduleTimer(entry, deadline);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoCancel(TimerWheel::Entry& entry) noexcept { thread_.CancelTimer(entry); }
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept : ThreadControlBase{thread} {}
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
@@ -79,6 +87,12 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Schedule(TimerWheel::Entry& entry, Deadline deadline) noexcept { DoSchedule(entry, deadline); }
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Cancel(TimerWheel::Entry& entry) noexcept { DoCancel(entry); }
+
 ThreadControl::ThreadControl(Thread& thread) noexcept : ThreadControlBase{thread} {}
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
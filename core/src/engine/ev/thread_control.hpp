@@ -9,6 +9,8 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
+#include <engine/ev/wakeup_batch.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -153,6 +155,9 @@ protected:
     void DoStart(ev_io& w) noexcept;
     void DoStop(ev_io& w) noexcept;
 
+    void DoSchedule(TimerWheel::Entry& entry, Deadline deadline) noexcept;
+    void DoCancel(TimerWheel::Entry& entry) noexcept;
+
 private:
     Thread& thread_;
 };
@@ -203,6 +208,8 @@ void ThreadControlBase::RunInEvLoopBlocking(Func&& func) {
     Payload payload{func};
 
     RunPayloadInEvLoopAsync(payload);
+    // The current thread is blocked until the ev thread runs the payload
+    FlushBatchedWakeups();
 
     payload.Wait();
 }
@@ -214,6 +221,10 @@ public:
     void Start(ev_timer& w) noexcept;
     void Stop(ev_timer& w) noexcept;
     void Again(ev_timer& w) noexcept;
+
+    /// Schedules the entry in the timer wheel of the ev thread
+    void Schedule(TimerWheel::Entry& entry, Deadline deadline) noexcept;
+    void Cancel(TimerWheel::Entry& entry) noexcept;
 };
 
 class ThreadControl final : public ThreadControlBase {
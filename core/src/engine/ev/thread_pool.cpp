@@ -19,8 +19,9 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, UseDefaultEvLoop)
 ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop) : use_ev_default_loop_(use_ev_default_loop) {
     threads_ = utils::GenerateFixedArray(config.threads, [&](std::size_t index) {
         const auto thread_name = fmt::format("{}_{}", config.thread_name, index);
-        return (use_ev_default_loop && index == 0) ? Thread(thread_name, Thread::kUseDefaultEvLoop)
-                                                   : Thread(thread_name);
+        return (use_ev_default_loop && index == 0)
+                   ? Thread(thread_name, Thread::kUseDefaultEvLoop, config.backend, config.busy_poll)
+                   : Thread(thread_name, config.backend, config.busy_poll);
     });
 
     default_controls_.controls = utils::GenerateFixedArray(threads_.size(), [this](std::size_t index) {
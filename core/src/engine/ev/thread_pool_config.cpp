@@ -1,13 +1,64 @@
 #include "thread_pool_config.hpp"
 
+#include <algorithm>
+#include <cmath>
+
+#include <fmt/format.h>
+
+#include <hostinfo/cgroup.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+namespace {
+
+constexpr utils::TrivialBiMap kEvBackendMap([](auto selector) {
+    return selector()
+        .Case(EvBackend::kAuto, "auto")
+        .Case(EvBackend::kEpoll, "epoll")
+        .Case(EvBackend::kIoUring, "io_uring");
+});
+
+constexpr std::string_view kAutoThreads = "auto";
+
+// A single ev thread is enough for the IO of several worker threads
+constexpr double kCpusPerAutoThread = 4;
+
+std::size_t ParseThreads(const yaml_config::YamlConfig& value, std::size_t default_threads) {
+    if (value.IsMissing()) return default_threads;
+    if (value.As<std::string>() != kAutoThreads) return value.As<std::size_t>();
+
+    const auto cpus = hostinfo::impl::GetAvailableCpus();
+    const auto threads = static_cast<std::size_t>(std::max(std::lround(cpus / kCpusPerAutoThread), 1L));
+    LOG_INFO() << "Using " << threads << " threads for '" << value.GetPath() << "', available CPUs: " << cpus;
+    return threads;
+}
+
+}  // namespace
+
+EvBackend ParseEvBackend(std::string_view value) {
+    const auto result = kEvBackendMap.TryFindBySecond(value);
+    if (!result) {
+        throw std::runtime_error(
+            fmt::format("Unknown ev backend '{}', expected one of: {}", value, kEvBackendMap.DescribeSecond())
+        );
+    }
+    return *result;
+}
+
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>) {
+    return utils::ParseFromValueString(value, kEvBackendMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>) {
     ThreadPoolConfig config;
-    config.threads = value["threads"].As<std::size_t>(config.threads);
+    config.threads = ParseThreads(value["threads"], config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.backend = value["backend"].As<EvBackend>(config.backend);
+    config.busy_poll = value["busy_poll"].As<bool>(config.busy_poll);
     return config;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -9,10 +10,23 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+/// libev backend to use for the event loops of a thread pool
+enum class EvBackend {
+    kAuto,     ///< let libev choose the recommended backend
+    kEpoll,    ///< epoll(7)
+    kIoUring,  ///< io_uring(7), falls back to epoll if the kernel lacks support
+};
+
+EvBackend ParseEvBackend(std::string_view value);
+
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>);
+
 struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
     bool ev_default_loop_disabled = false;
+    EvBackend backend = EvBackend::kAuto;
+    bool busy_poll = false;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
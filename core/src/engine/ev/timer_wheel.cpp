@@ -0,0 +1,212 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+#include <limits>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+std::uint64_t RotateRight(std::uint64_t value, std::size_t shift) noexcept {
+    shift &= 63;
+    return shift == 0 ? value : (value >> shift) | (value << (64 - shift));
+}
+
+std::size_t CountTrailingZeros(std::uint64_t value) noexcept {
+    UASSERT(value != 0);
+    return __builtin_ctzll(value);
+}
+
+}  // namespace
+
+TimerWheel::TimerWheel(Clock::time_point now) noexcept : origin_(now) {}
+
+TimerWheel::~TimerWheel() {
+    // Leave the remaining entries in a valid unscheduled state
+    for (auto& level : levels_) {
+        for (auto& head : level) {
+            while (head) {
+                auto* entry = head;
+                head = entry->next_;
+                entry->pprev_ = nullptr;
+                entry->next_ = nullptr;
+            }
+        }
+    }
+}
+
+void TimerWheel::Schedule(Entry& entry, Clock::time_point expiry, Clock::time_point now) noexcept {
+    if (IsEmpty()) {
+        // The ticks passed while the wheel was idle have nothing to process.
+        // Linking relative to an outdated tick would put the entry into a
+        // coarse bucket that is due already.
+        current_tick_ = std::max(current_tick_, ToTick(now));
+    }
+
+    if (entry.IsScheduled()) {
+        if (expiry >= entry.expiry_) {
+            // Lazy rescheduling, the entry is moved when its bucket is processed
+            entry.expiry_ = expiry;
+            return;
+        }
+        Unlink(entry);
+    }
+
+    entry.expiry_ = expiry;
+    Link(entry);
+}
+
+void TimerWheel::Cancel(Entry& entry) noexcept {
+    if (entry.IsScheduled()) Unlink(entry);
+}
+
+std::size_t TimerWheel::Advance(Clock::time_point now) noexcept {
+    if (now < origin_) return 0;
+    const auto now_tick = static_cast<std::uint64_t>((now - origin_) / kTick);
+
+    std::size_t fired = 0;
+    while (current_tick_ <= now_tick) {
+        if (size_ == 0) {
+            current_tick_ = now_tick + 1;
+            break;
+        }
+
+        // Skip the ticks that have nothing to expire or cascade
+        const auto next_tick = GetNextTick();
+        if (next_tick > now_tick) {
+            current_tick_ = now_tick + 1;
+            break;
+        }
+        current_tick_ = std::max(current_tick_, next_tick);
+
+        const auto tick = current_tick_;
+        for (std::size_t level = 1; level < kLevels; ++level) {
+            if (tick & ((std::uint64_t{1} << (kSlotBits * level)) - 1)) break;
+            Cascade(level, (tick >> (kSlotBits * level)) & (kSlots - 1));
+        }
+
+        // Entries (re)scheduled from the callbacks go to the next ticks
+        ++current_tick_;
+        fired += Expire(tick & (kSlots - 1), now);
+    }
+
+    return fired;
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::GetNextWakeup() const noexcept {
+    if (size_ == 0) return std::nullopt;
+    return FromTick(GetNextTick());
+}
+
+std::uint64_t TimerWheel::GetNextTick() const noexcept {
+    UASSERT(size_ != 0);
+
+    auto next_tick = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t level = 0; level < kLevels; ++level) {
+        if (!occupied_[level]) continue;
+
+        const auto shift = kSlotBits * level;
+        const auto unit = std::uint64_t{1} << shift;
+        const auto base = (current_tick_ + unit - 1) >> shift;
+        const auto offset = CountTrailingZeros(RotateRight(occupied_[level], base & (kSlots - 1)));
+        next_tick = std::min(next_tick, (base + offset) << shift);
+    }
+
+    return next_tick;
+}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time) const noexcept {
+    if (time <= origin_) return 0;
+    const auto elapsed = time - origin_;
+    // Round up, so that the entries never fire before their expiry
+    return static_cast<std::uint64_t>(elapsed / kTick) + (elapsed % kTick != Clock::duration::zero() ? 1 : 0);
+}
+
+TimerWheel::Clock::time_point TimerWheel::FromTick(std::uint64_t tick) const noexcept {
+    const auto max_ticks = static_cast<std::uint64_t>((Clock::time_point::max() - origin_) / kTick);
+    if (tick >= max_ticks) return Clock::time_point::max();
+    return origin_ + tick * kTick;
+}
+
+void TimerWheel::Link(Entry& entry) noexcept {
+    UASSERT(!entry.IsScheduled());
+
+    // Far entries are parked at the end of the wheel and rescheduled from there
+    constexpr auto kMaxDelta = (std::uint64_t{1} << (kSlotBits * kLevels)) - 1;
+    const auto delta = std::min(std::max(ToTick(entry.expiry_), current_tick_) - current_tick_, kMaxDelta);
+    const auto tick = current_tick_ + delta;
+
+    std::size_t level = 0;
+    while ((delta >> (kSlotBits * (level + 1))) != 0) ++level;
+    UASSERT(level < kLevels);
+    const auto slot = (tick >> (kSlotBits * level)) & (kSlots - 1);
+
+    auto& head = levels_[level][slot];
+    entry.next_ = head;
+    if (head) head->pprev_ = &entry.next_;
+    head = &entry;
+    entry.pprev_ = &head;
+    entry.level_ = static_cast<std::uint8_t>(level);
+    entry.slot_ = static_cast<std::uint8_t>(slot);
+
+    occupied_[level] |= std::uint64_t{1} << slot;
+    ++size_;
+}
+
+void TimerWheel::Unlink(Entry& entry) noexcept {
+    UASSERT(entry.IsScheduled());
+
+    *entry.pprev_ = entry.next_;
+    if (entry.next_) entry.next_->pprev_ = entry.pprev_;
+    entry.pprev_ = nullptr;
+    entry.next_ = nullptr;
+
+    if (!levels_[entry.level_][entry.slot_]) {
+        occupied_[entry.level_] &= ~(std::uint64_t{1} << entry.slot_);
+    }
+    --size_;
+}
+
+void TimerWheel::Cascade(std::size_t level, std::size_t slot) noexcept {
+    // Detach the list first, entries may be linked back into the same slot
+    auto* entry = levels_[level][slot];
+    levels_[level][slot] = nullptr;
+    occupied_[level] &= ~(std::uint64_t{1} << slot);
+
+    while (entry) {
+        auto* next = entry->next_;
+        entry->pprev_ = nullptr;
+        entry->next_ = nullptr;
+        --size_;
+        Link(*entry);
+        entry = next;
+    }
+}
+
+std::size_t TimerWheel::Expire(std::size_t slot, Clock::time_point now) noexcept {
+    // Detach the list first, entries may be linked back into the same slot.
+    // Callbacks may reschedule and cancel arbitrary entries, including the
+    // detached ones, so the entries are taken from the list one by one.
+    Entry* pending = levels_[0][slot];
+    levels_[0][slot] = nullptr;
+    occupied_[0] &= ~(std::uint64_t{1} << slot);
+    if (pending) pending->pprev_ = &pending;
+
+    std::size_t fired = 0;
+    while (auto* entry = pending) {
+        Unlink(*entry);
+        if (entry->expiry_ <= now) {
+            ++fired;
+            entry->callback_(*entry);
+        } else {
+            Link(*entry);
+        }
+    }
+    return fired;
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// Hierarchical timer wheel with coarse-grained (kTick) buckets.
+//
+// Scheduling, rescheduling and cancellation are O(1) and do not allocate,
+// which suits the engine timers: there may be millions of them and most are
+// cancelled before firing. Timers never fire before their expiry, but may fire
+// up to kTick later.
+//
+// Rescheduling to a later expiry is lazy: the entry stays in its bucket and is
+// moved only when the bucket is processed.
+//
+// Not thread-safe, intended to be owned by a single ev::Thread.
+class TimerWheel final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::milliseconds kTick{1};
+
+    class Entry final {
+    public:
+        using Callback = void (*)(Entry&) noexcept;
+
+        explicit Entry(Callback callback, void* data = nullptr) noexcept : callback_(callback), data_(data) {}
+
+        Entry(const Entry&) = delete;
+        Entry& operator=(const Entry&) = delete;
+
+        ~Entry() { UASSERT_MSG(!IsScheduled(), "Destroying a scheduled timer wheel entry"); }
+
+        bool IsScheduled() const noexcept { return pprev_ != nullptr; }
+
+        void* GetData() const noexcept { return data_; }
+
+    private:
+        friend class TimerWheel;
+
+        Entry** pprev_{nullptr};
+        Entry* next_{nullptr};
+        Clock::time_point expiry_{};
+        Callback callback_;
+        void* data_;
+        std::uint8_t level_{0};
+        std::uint8_t slot_{0};
+    };
+
+    explicit TimerWheel(Clock::time_point now = Clock::now()) noexcept;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    ~TimerWheel();
+
+    // Schedules the entry or changes the expiry of an already scheduled one.
+    // `now` brings an empty wheel up to date, as nobody advances it while idle.
+    void Schedule(Entry& entry, Clock::time_point expiry, Clock::time_point now) noexcept;
+
+    // Does nothing for an entry that is not scheduled.
+    void Cancel(Entry& entry) noexcept;
+
+    // Invokes the callbacks of all the entries that expired by `now`. The entry
+    // is not scheduled any more when its callback is invoked, the callback may
+    // schedule it again. Returns the number of invoked callbacks.
+    std::size_t Advance(Clock::time_point now) noexcept;
+
+    // Returns the earliest time at which Advance() may have something to do,
+    // std::nullopt if there are no scheduled entries. May be in the past if
+    // Advance() was not called for a while.
+    std::optional<Clock::time_point> GetNextWakeup() const noexcept;
+
+    std::size_t Size() const noexcept { return size_; }
+
+    bool IsEmpty() const noexcept { return size_ == 0; }
+
+private:
+    static constexpr std::size_t kSlotBits = 6;
+    static constexpr std::size_t kSlots = 1 << kSlotBits;
+    static constexpr std::size_t kLevels = 4;
+
+    using Level = std::array<Entry*, kSlots>;
+
+    std::uint64_t GetNextTick() const noexcept;
+    std::uint64_t ToTick(Clock::time_point time) const noexcept;
+    Clock::time_point FromTick(std::uint64_t tick) const noexcept;
+
+    void Link(Entry& entry) noexcept;
+    void Unlink(Entry& entry) noexcept;
+
+    void Cascade(std::size_t level, std::size_t slot) noexcept;
+    std::size_t Expire(std::size_t slot, Clock::time_point now) noexcept;
+
+    const Clock::time_point origin_;
+
+    // The next tick to process
+    std::uint64_t current_tick_{0};
+    std::size_t size_{0};
+
+    std::array<Level, kLevels> levels_{};
+    std::array<std::uint64_t, kLevels> occupied_{};
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
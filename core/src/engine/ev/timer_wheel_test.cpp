@@ -0,0 +1,276 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using Clock = TimerWheel::Clock;
+
+using namespace std::chrono_literals;
+
+struct TestTimer {
+    TestTimer() : entry(&OnTimer, this) {}
+
+    static void OnTimer(TimerWheel::Entry& entry) noexcept {
+        auto& self = *static_cast<TestTimer*>(entry.GetData());
+        ++self.fired;
+        self.fired_at = *self.now;
+    }
+
+    TimerWheel::Entry entry;
+    const Clock::time_point* now{nullptr};
+    Clock::time_point fired_at{};
+    int fired{0};
+};
+
+}  // namespace
+
+TEST(TimerWheel, NeverFiresEarly) {
+    auto now = Clock::now();
+    TimerWheel wheel{now};
+
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<std::int64_t> distribution{0, 20'000'000};  // up to 20s
+
+    std::vector<std::unique_ptr<TestTimer>> timers;
+    std::vector<Clock::time_point> expiries;
+    for (int i = 0; i < 1000; ++i) {
+        auto& timer = *timers.emplace_back(std::make_unique<TestTimer>());
+        timer.now = &now;
+        expiries.push_back(now + std::chrono::microseconds{distribution(rng)});
+        wheel.Schedule(timer.entry, expiries.back(), now);
+    }
+    EXPECT_EQ(wheel.Size(), timers.size());
+
+    const auto end = now + 21s;
+    while (now < end) {
+        now += 300us;
+        wheel.Advance(now);
+    }
+
+    EXPECT_TRUE(wheel.IsEmpty());
+    for (std::size_t i = 0; i < timers.size(); ++i) {
+        ASSERT_EQ(timers[i]->fired, 1);
+        EXPECT_GE(timers[i]->fired_at, expiries[i]);
+        EXPECT_LE(timers[i]->fired_at, expiries[i] + TimerWheel::kTick + 300us);
+    }
+}
+
+TEST(TimerWheel, CancelAndReschedule) {
+    auto now = Clock::now();
+    TimerWheel wheel{now};
+
+    TestTimer cancelled;
+    TestTimer later;
+    TestTimer earlier;
+    for (auto* timer : {&cancelled, &later, &earlier}) timer->now = &now;
+
+    wheel.Schedule(cancelled.entry, now + 10ms, now);
+    wheel.Schedule(later.entry, now + 10ms, now);
+    wheel.Schedule(earlier.entry, now + 10s, now);
+    EXPECT_EQ(wheel.Size(), 3);
+
+    wheel.Cancel(cancelled.entry);
+    wheel.Cancel(cancelled.entry);
+    EXPECT_FALSE(cancelled.entry.IsScheduled());
+    wheel.Schedule(later.entry, now + 5s, now);
+    wheel.Schedule(earlier.entry, now + 20ms, now);
+    EXPECT_EQ(wheel.Size(), 2);
+
+    const auto start = now;
+    while (now < start + 6s) {
+        now += 1ms;
+        wheel.Advance(now);
+    }
+
+    EXPECT_EQ(cancelled.fired, 0);
+    EXPECT_EQ(earlier.fired, 1);
+    EXPECT_GE(earlier.fired_at, start + 20ms);
+    EXPECT_LE(earlier.fired_at, start + 22ms);
+    EXPECT_EQ(later.fired, 1);
+    EXPECT_GE(later.fired_at, start + 5s);
+    EXPECT_LE(later.fired_at, start + 5s + 2ms);
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, FarExpiry) {
+    auto now = Clock::now();
+    TimerWheel wheel{now};
+
+    TestTimer timer;
+    timer.now = &now;
+    const auto expiry = now + 10h;
+    wheel.Schedule(timer.entry, expiry, now);
+
+    while (now < expiry + 1min) {
+        now += 1min;
+        wheel.Advance(now);
+        ASSERT_TRUE(timer.fired == 0 || now >= expiry);
+    }
+    EXPECT_EQ(timer.fired, 1);
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, NextWakeup) {
+    auto now = Clock::now();
+    TimerWheel wheel{now};
+    EXPECT_FALSE(wheel.GetNextWakeup());
+
+    TestTimer near;
+    TestTimer far;
+    near.now = far.now = &now;
+    wheel.Schedule(far.entry, now + 1h, now);
+    const auto far_wakeup = wheel.GetNextWakeup();
+    ASSERT_TRUE(far_wakeup);
+    EXPECT_LE(*far_wakeup, now + 1h);
+
+    const auto near_expiry = now + 100ms;
+    wheel.Schedule(near.entry, near_expiry, now);
+    const auto near_wakeup = wheel.GetNextWakeup();
+    ASSERT_TRUE(near_wakeup);
+    EXPECT_LE(*near_wakeup, now + 100ms + TimerWheel::kTick);
+    EXPECT_GE(*near_wakeup, now + 64ms);
+
+    // Following the wakeups reaches the expiry in a few steps
+    int steps = 0;
+    while (!near.fired) {
+        now = *wheel.GetNextWakeup();
+        wheel.Advance(now);
+        ASSERT_LT(++steps, 10);
+    }
+    EXPECT_GE(near.fired_at, near_expiry);
+
+    wheel.Cancel(far.entry);
+    EXPECT_FALSE(wheel.GetNextWakeup());
+}
+
+TEST(TimerWheel, RescheduleFromCallback) {
+    auto now = Clock::now();
+    TimerWheel wheel{now};
+
+    struct Periodic {
+        TimerWheel* wheel;
+        const Clock::time_point* now;
+        int fired{0};
+    } periodic{&wheel, &now};
+
+    TimerWheel::Entry entry{
+        [](TimerWheel::Entry& entry) noexcept {
+            auto& self = *static_cast<Periodic*>(entry.GetData());
+            if (++self.fired < 5) self.wheel->Schedule(entry, *self.now + 10ms, *self.now);
+        },
+        &periodic};
+
+    wheel.Schedule(entry, now + 10ms, now);
+    for (int i = 0; i < 100; ++i) {
+        now += 1ms;
+        wheel.Advance(now);
+    }
+    EXPECT_EQ(periodic.fired, 5);
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, ScheduleAfterIdle) {
+    auto now = Clock::now();
+    TimerWheel wheel{now};
+
+    TestTimer first;
+    TestTimer second;
+    first.now = second.now = &now;
+    wheel.Schedule(first.entry, now + 10ms, now);
+    while (!first.fired) {
+        now += 1ms;
+        wheel.Advance(now);
+    }
+    EXPECT_TRUE(wheel.IsEmpty());
+
+    // Nobody advances an empty wheel
+    now += 10s;
+    const auto expiry = now + 100ms;
+    wheel.Schedule(second.entry, expiry, now);
+    const auto wakeup = wheel.GetNextWakeup();
+    ASSERT_TRUE(wakeup);
+    EXPECT_GE(*wakeup, now);
+    EXPECT_LE(*wakeup, expiry + TimerWheel::kTick);
+
+    int steps = 0;
+    while (!second.fired) {
+        now = *wheel.GetNextWakeup();
+        wheel.Advance(now);
+        ASSERT_LT(++steps, 10);
+    }
+    EXPECT_GE(second.fired_at, expiry);
+    EXPECT_LE(second.fired_at, expiry + TimerWheel::kTick);
+}
+
+TEST(TimerWheel, PastDueWakeup) {
+    auto now = Clock::now();
+    TimerWheel wheel{now};
+
+    TestTimer far;
+    TestTimer near;
+    far.now = near.now = &now;
+    wheel.Schedule(far.entry, now + 1h, now);
+
+    // The wheel is not advanced while it waits for the far entry, so the
+    // bucket of a new entry may be due already
+    now += 10s;
+    const auto expiry = now + 100ms;
+    wheel.Schedule(near.entry, expiry, now);
+    ASSERT_TRUE(wheel.GetNextWakeup());
+
+    int steps = 0;
+    while (!near.fired) {
+        now = std::max(now, *wheel.GetNextWakeup());
+        wheel.Advance(now);
+        // A due wakeup is processed at once and is not repeated
+        EXPECT_GT(*wheel.GetNextWakeup(), now);
+        ASSERT_LT(++steps, 10);
+    }
+    EXPECT_GE(near.fired_at, expiry);
+    EXPECT_LE(near.fired_at, expiry + TimerWheel::kTick);
+    EXPECT_EQ(far.fired, 0);
+
+    wheel.Cancel(far.entry);
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+UTEST(TimerWheel, DeadlineAfterIdle) {
+    engine::SleepFor(1ms);
+
+    // The timer wheel of the ev thread stays idle meanwhile
+    std::this_thread::sleep_for(300ms);
+
+    const auto start = Clock::now();
+    engine::SleepFor(10ms);
+    EXPECT_GE(Clock::now() - start, 10ms);
+}
+
+UTEST(TimerWheel, DeadlineAfterIdleWithPendingTimer) {
+    auto far = engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(1h); });
+    engine::SleepFor(1ms);
+
+    // The watcher of the timer wheel waits for the far timer meanwhile
+    std::this_thread::sleep_for(300ms);
+
+    const auto start = Clock::now();
+    engine::SleepFor(10ms);
+    EXPECT_GE(Clock::now() - start, 10ms);
+
+    far.SyncCancel();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,69 @@
+#include <engine/ev/wakeup_batch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <engine/ev/thread.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+// Services rarely use more than a few ev threads per task slice
+constexpr std::size_t kMaxBatchedThreads = 8;
+
+struct WakeupBatch final {
+    bool is_active{false};
+    std::size_t size{0};
+    std::array<Thread*, kMaxBatchedThreads> threads{};
+};
+
+compiler::ThreadLocal local_batch = [] { return WakeupBatch{}; };
+
+}  // namespace
+
+WakeupBatchScope::WakeupBatchScope() noexcept {
+    auto batch = local_batch.Use();
+    UASSERT_MSG(!batch->is_active, "WakeupBatchScope is not reentrant");
+    batch->is_active = true;
+}
+
+WakeupBatchScope::~WakeupBatchScope() {
+    FlushBatchedWakeups();
+    auto batch = local_batch.Use();
+    batch->is_active = false;
+}
+
+void FlushBatchedWakeups() noexcept {
+    auto batch = local_batch.Use();
+    for (std::size_t i = 0; i < batch->size; ++i) {
+        batch->threads[i]->WakeUp();
+    }
+    batch->size = 0;
+}
+
+namespace impl {
+
+bool TryBatchWakeup(Thread& thread) noexcept {
+    auto batch = local_batch.Use();
+    if (!batch->is_active) return false;
+
+    const auto end = batch->threads.begin() + batch->size;
+    if (std::find(batch->threads.begin(), end, &thread) != end) return true;
+
+    if (batch->size == batch->threads.size()) return false;
+    batch->threads[batch->size++] = &thread;
+    return true;
+}
+
+}  // namespace impl
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#pragma once
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+class Thread;
+
+/// While the scope is alive, the wakeups of ev threads requested from the
+/// current thread by Thread::RunInEvLoopAsync() and
+/// Thread::RunInEvLoopDeferred() are collected and sent at the scope exit,
+/// at most one per ev thread. Task processors open the scope for each task
+/// slice, so that e.g. starting several watchers costs a single ev_async_send.
+///
+/// The commands themselves are queued right away, only the wakeups are
+/// delayed. Anything that blocks the current thread waiting for an ev thread
+/// should call FlushBatchedWakeups() first.
+class WakeupBatchScope final {
+public:
+    WakeupBatchScope() noexcept;
+    ~WakeupBatchScope();
+
+    WakeupBatchScope(WakeupBatchScope&&) = delete;
+    WakeupBatchScope& operator=(WakeupBatchScope&&) = delete;
+};
+
+/// Sends the wakeups collected by the current WakeupBatchScope, if any
+void FlushBatchedWakeups() noexcept;
+
+namespace impl {
+
+/// Returns false if there is no WakeupBatchScope on the current thread or if
+/// it can not hold more ev threads, the caller should wake up `thread` itself
+bool TryBatchWakeup(Thread& thread) noexcept;
+
+}  // namespace impl
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
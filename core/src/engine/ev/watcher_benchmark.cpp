@@ -3,6 +3,7 @@
 #include <unistd.h>
 
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/utils/fixed_array.hpp>
 #include <utils/check_syscall.hpp>
@@ -70,4 +71,33 @@ void watcher_async_start_multiple(benchmark::State& state) {
 }
 BENCHMARK(watcher_async_start_multiple);
 
+// All the commands of a task slice wake up the ev thread once
+void watcher_async_start_stop_batched(benchmark::State& state) {
+    engine::RunStandalone([&]() {
+        const auto pipes_count = static_cast<std::size_t>(state.range(0));
+        utils::FixedArray<Pipe> pipes(pipes_count);
+        utils::FixedArray<ev::Watcher<ev_io>> watchers(pipes_count, engine::current_task::GetEventThread(), &pipes[0]);
+        for (std::size_t i = 0; i < pipes_count; ++i) {
+            watchers[i].Init(NoInvokeCallback, pipes[i].GetIn(), EV_READ);
+        }
+
+        for ([[maybe_unused]] auto _ : state) {
+            for (auto& watcher : watchers) {
+                watcher.StartAsync();
+            }
+            engine::Yield();
+            for (auto& watcher : watchers) {
+                watcher.StopAsync();
+            }
+            engine::Yield();
+        }
+
+        for (auto& watcher : watchers) {
+            watcher.Stop();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK(watcher_async_start_stop_batched)->RangeMultiplier(4)->Range(1, 64);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#include <userver/engine/impl/adaptive_spinner.hpp>
+
+#include <algorithm>
+
+#include <compiler/relax_cpu.hpp>
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// Roughly a few microseconds of pause instructions on modern CPUs
+constexpr std::int32_t kMaxSpins = 100;
+constexpr std::int32_t kMinSpins = 10;
+
+}  // namespace
+
+bool AdaptiveSpinner::Spin(utils::function_ref<bool()> try_lock) noexcept {
+    auto* const current = current_task::GetCurrentTaskContextUnchecked();
+    if (!current || current->GetTaskProcessor().GetWorkerCount() < 2) return false;
+
+    const auto estimate = static_cast<std::int32_t>(spins_estimate_.load(std::memory_order_relaxed));
+    const auto max_spins = std::min(kMaxSpins, estimate * 2 + kMinSpins);
+
+    compiler::RelaxCpu relax;
+    std::int32_t spins = 0;
+    bool is_locked = false;
+    while (spins < max_spins) {
+        ++spins;
+        relax();
+        if (try_lock()) {
+            is_locked = true;
+            break;
+        }
+    }
+
+    // A failed spin pushes the estimate towards max_spins, so the next waiters
+    // spin longer, up to kMaxSpins
+    spins_estimate_.store(static_cast<std::uint32_t>(estimate + (spins - estimate) / 8), std::memory_order_relaxed);
+    return is_locked;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <userver/engine/impl/adaptive_spinner.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(AdaptiveSpinner, NoSpinsOnSingleThread) {
+    engine::impl::AdaptiveSpinner spinner;
+    std::size_t attempts = 0;
+    EXPECT_FALSE(spinner.Spin([&attempts] {
+        ++attempts;
+        return true;
+    }));
+    EXPECT_EQ(attempts, 0);
+}
+
+UTEST_MT(AdaptiveSpinner, AcquiresOnSuccess, 2) {
+    engine::impl::AdaptiveSpinner spinner;
+    std::size_t attempts = 0;
+    EXPECT_TRUE(spinner.Spin([&attempts] { return ++attempts == 3; }));
+    EXPECT_EQ(attempts, 3);
+}
+
+UTEST_MT(AdaptiveSpinner, SpinLimitIsBounded, 2) {
+    engine::impl::AdaptiveSpinner spinner;
+    for (int i = 0; i < 100; ++i) {
+        std::size_t attempts = 0;
+        EXPECT_FALSE(spinner.Spin([&attempts] {
+            ++attempts;
+            return false;
+        }));
+        EXPECT_GT(attempts, 0);
+        EXPECT_LE(attempts, 100);
+    }
+}
+
+UTEST_MT(AdaptiveSpinner, MutexShortSections, 4) {
+    engine::Mutex mutex;
+    std::uint64_t counter = 0;
+    constexpr std::uint64_t kIterations = 10000;
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < GetThreadCount(); ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+            for (std::uint64_t j = 0; j < kIterations; ++j) {
+                const std::lock_guard lock{mutex};
+                ++counter;
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(counter, kIterations * GetThreadCount());
+}
+
+USERVER_NAMESPACE_END
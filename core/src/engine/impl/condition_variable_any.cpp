@@ -5,7 +5,7 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/utils/assert.hpp>
 
-#include <engine/impl/wait_list.hpp>
+#include <engine/impl/flat_combining_wait_list.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor.hpp>
 
@@ -18,16 +18,17 @@ void OnConditionVariableSpuriousWakeup() { current_task::GetTaskProcessor().GetT
 template <typename MutexType>
 class CvWaitStrategy final : public WaitStrategy {
 public:
-    CvWaitStrategy(WaitList& waiters, TaskContext& current, std::unique_lock<MutexType>& mutex_lock) noexcept
-        : waiters_(waiters), waiter_token_(waiters_), current_(current), mutex_lock_(mutex_lock) {}
+    CvWaitStrategy(
+        FlatCombiningWaitList& waiters,
+        TaskContext& current,
+        std::unique_lock<MutexType>& mutex_lock
+    ) noexcept
+        : waiters_(waiters), waiter_token_(waiters_), current_(current), waiter_(current), mutex_lock_(mutex_lock) {}
 
     EarlyWakeup SetupWakeups() override {
         UASSERT(mutex_lock_);
         UASSERT(current_.IsCurrent());
-        {
-            WaitList::Lock waiters_lock{waiters_};
-            waiters_.Append(waiters_lock, &current_);
-        }
+        waiters_.Append(waiter_);
 
         mutex_lock_.unlock();
         // A race is not possible here, because check + Append is performed under
@@ -38,15 +39,14 @@ public:
 
     void DisableWakeups() noexcept override {
         UASSERT(current_.IsCurrent());
-
-        WaitList::Lock waiters_lock{waiters_};
-        waiters_.Remove(waiters_lock, current_);
+        waiters_.Remove(waiter_);
     }
 
 private:
-    WaitList& waiters_;
-    const WaitList::WaitersScopeCounter waiter_token_;
+    FlatCombiningWaitList& waiters_;
+    const FlatCombiningWaitList::WaitersScopeCounter waiter_token_;
     TaskContext& current_;
+    FlatCombiningWaitList::Waiter waiter_;
     std::unique_lock<MutexType>& mutex_lock_;
 };
 
@@ -94,16 +94,14 @@ CvStatus ConditionVariableAny<MutexType>::WaitUntil(std::unique_lock<MutexType>&
 template <typename MutexType>
 void ConditionVariableAny<MutexType>::NotifyOne() {
     if (waiters_->GetCountOfSleepies()) {
-        WaitList::Lock lock(*waiters_);
-        waiters_->WakeupOne(lock);
+        waiters_->WakeupOne();
     }
 }
 
 template <typename MutexType>
 void ConditionVariableAny<MutexType>::NotifyAll() {
     if (waiters_->GetCountOfSleepies()) {
-        WaitList::Lock lock(*waiters_);
-        waiters_->WakeupAll(lock);
+        waiters_->WakeupAll();
     }
 }
 
@@ -1,9 +1,15 @@
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <memory>
 #include <optional>
+#include <thread>
 
 #include <engine/task/task_base_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 
@@ -14,10 +20,34 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Each shard has its own free list, so that the workers spawning detached tasks
+// at a high rate do not fight over a single CAS head
+constexpr std::size_t kMaxShardCount = 32;
+
+std::size_t GetShardCount() noexcept {
+    const std::size_t hardware_concurrency = std::thread::hardware_concurrency();
+    return std::clamp<std::size_t>(hardware_concurrency, 1, kMaxShardCount);
+}
+
+std::atomic<std::size_t> next_thread_shard_hint{0};
+
+// Threads are spread over the shards in a round-robin manner
+compiler::ThreadLocal local_shard_hint = [] { return next_thread_shard_hint.fetch_add(1, std::memory_order_relaxed); };
+
+std::size_t GetLocalShardHint() noexcept {
+    auto hint = local_shard_hint.Use();
+    return *hint;
+}
+
+}  // namespace
+
 struct DetachedTasksSyncBlock::Token final {
-    explicit Token(DetachedTasksSyncBlock& owner) : owner(owner) {}
+    explicit Token(Shard& shard) : shard(shard) {}
 
-    DetachedTasksSyncBlock& owner;
+    // The shard to return the token to
+    Shard& shard;
 
     concurrent::impl::IntrusiveWalkablePoolHook<Token> pool_hook{};
 
@@ -28,10 +58,27 @@ struct DetachedTasksSyncBlock::Token final {
     utils::impl::WaitTokenStorage::Token wait_token{};
 };
 
+struct DetachedTasksSyncBlock::Shard final {
+    concurrent::impl::IntrusiveWalkablePool<Token, concurrent::impl::MemberHook<&Token::pool_hook>> cancel_tokens{};
+};
+
 struct DetachedTasksSyncBlock::Impl final {
+    // A single counter for all the shards, otherwise a task of one shard could
+    // spawn a task into another shard that has already been waited for
     std::optional<utils::impl::WaitTokenStorage> wait_tokens{};
-    concurrent::impl::IntrusiveWalkablePool<Token, concurrent::impl::MemberHook<&Token::pool_hook>> cancel_tokens{};
+    std::size_t shard_count{GetShardCount()};
+    std::unique_ptr<concurrent::impl::InterferenceShield<Shard>[]> shards{
+        std::make_unique<concurrent::impl::InterferenceShield<Shard>[]>(shard_count)};
     std::atomic<TaskCancellationReason> cancel_new_tasks{TaskCancellationReason::kNone};
+
+    Shard& GetLocalShard() noexcept { return *shards[GetLocalShardHint() % shard_count]; }
+
+    template <typename Func>
+    void WalkAllShards(const Func& func) {
+        for (std::size_t i = 0; i < shard_count; ++i) {
+            shards[i]->cancel_tokens.Walk(func);
+        }
+    }
 };
 
 DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode) {
@@ -43,7 +90,8 @@ DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode) {
 DetachedTasksSyncBlock::~DetachedTasksSyncBlock() = default;
 
 void DetachedTasksSyncBlock::Add(TaskContext& context) {
-    auto& token = impl_->cancel_tokens.Acquire([this] { return Token(*this); });
+    auto& shard = impl_->GetLocalShard();
+    auto& token = shard.cancel_tokens.Acquire([&shard] { return Token(shard); });
     UASSERT(token.task == nullptr);
 
     boost::intrusive_ptr<TaskContext> context_copy(&context);
@@ -75,13 +123,13 @@ void DetachedTasksSyncBlock::Dispose(Token& token) noexcept {
         );
     }
     [[maybe_unused]] const auto wait_token = std::move(token.wait_token);
-    token.owner.impl_->cancel_tokens.Release(token);
+    token.shard.cancel_tokens.Release(token);
 }
 
 void DetachedTasksSyncBlock::RequestCancellation(TaskCancellationReason reason) noexcept {
     impl_->cancel_new_tasks.store(reason);
 
-    impl_->cancel_tokens.Walk([&](Token& token) {
+    impl_->WalkAllShards([&](Token& token) {
         auto* const context_ptr = token.task.exchange(nullptr);
 
         if (context_ptr != nullptr) {
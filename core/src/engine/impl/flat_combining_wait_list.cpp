@@ -0,0 +1,173 @@
+#include "flat_combining_wait_list.hpp"
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <compiler/relax_cpu.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+constexpr std::uint64_t kWakeupAllRequest = std::uint64_t{1} << 32;
+
+}  // namespace
+
+FlatCombiningWaitList::Waiter::~Waiter() {
+    UASSERT_MSG(state_.load(std::memory_order_relaxed) != State::kWaiting, "Waiter is destroyed while waiting");
+}
+
+// not implicitly noexcept on focal
+// NOLINTNEXTLINE(hicpp-use-equals-default,modernize-use-equals-default)
+FlatCombiningWaitList::FlatCombiningWaitList() noexcept {}
+
+FlatCombiningWaitList::~FlatCombiningWaitList() {
+    UASSERT_MSG(list_.empty(), "Someone is waiting on the FlatCombiningWaitList");
+    UASSERT_MSG(stack_.load() == nullptr, "Someone is waiting on the FlatCombiningWaitList");
+}
+
+void FlatCombiningWaitList::Append(Waiter& waiter) noexcept {
+    UASSERT(waiter.state_.load(std::memory_order_relaxed) != Waiter::State::kWaiting);
+    UASSERT(!waiter.in_stack_ && !waiter.list_hook_.is_linked());
+
+    waiter.epoch_ = waiter.context_.GetEpoch();
+    waiter.in_stack_ = true;
+    waiter.state_.store(Waiter::State::kWaiting, std::memory_order_relaxed);
+
+    auto* head = stack_.load(std::memory_order_relaxed);
+    do {
+        waiter.stack_next_ = head;
+    } while (!stack_.compare_exchange_weak(head, &waiter, std::memory_order_release, std::memory_order_relaxed));
+
+    // Pairs with the fence in ProcessRequests. Either the consumer sees the
+    // waiter, or the waiter sees the condition changed by the notifier.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+bool FlatCombiningWaitList::Remove(Waiter& waiter) noexcept {
+    auto expected = Waiter::State::kWaiting;
+    if (!waiter.state_.compare_exchange_strong(expected, Waiter::State::kRemoved, std::memory_order_acq_rel)) {
+        // kWoken: the consumer does not access the waiter after waking it up.
+        // kIdle, kRemoved: the waiter is not in the list.
+        return expected == Waiter::State::kWoken;
+    }
+
+    // The waiter may still be referenced from list_ or stack_
+    StartConsuming();
+    if (waiter.in_stack_) {
+        // Drops the waiter, as it is not kWaiting anymore
+        MoveStackToList();
+    } else if (waiter.list_hook_.is_linked()) {
+        list_.erase(List::s_iterator_to(waiter));
+    }
+    UASSERT(!waiter.in_stack_ && !waiter.list_hook_.is_linked());
+
+    StopConsumingAndProcessRequests();
+    return false;
+}
+
+void FlatCombiningWaitList::WakeupOne() {
+    wakeup_requests_.fetch_add(1);
+    if (TryStartConsuming()) {
+        StopConsumingAndProcessRequests();
+    }
+}
+
+void FlatCombiningWaitList::WakeupAll() {
+    wakeup_requests_.fetch_add(kWakeupAllRequest);
+    if (TryStartConsuming()) {
+        StopConsumingAndProcessRequests();
+    }
+}
+
+bool FlatCombiningWaitList::TryStartConsuming() noexcept {
+    return !is_consuming_.load(std::memory_order_relaxed) && !is_consuming_.exchange(true);
+}
+
+void FlatCombiningWaitList::StartConsuming() noexcept {
+    compiler::RelaxCpu relax;
+    while (!TryStartConsuming()) {
+        relax();
+    }
+}
+
+void FlatCombiningWaitList::StopConsumingAndProcessRequests() {
+    do {
+        try {
+            while (const auto requests = wakeup_requests_.exchange(0)) {
+                ProcessRequests(requests);
+            }
+        } catch (...) {
+            is_consuming_.store(false);
+            throw;
+        }
+
+        is_consuming_.store(false);
+        // Someone could have posted a request and failed to become the consumer
+        // after we have processed the requests.
+    } while (wakeup_requests_.load() != 0 && TryStartConsuming());
+}
+
+void FlatCombiningWaitList::ProcessRequests(std::uint64_t requests) {
+    // Pairs with the fence in Append
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const bool wakeup_all = requests >= kWakeupAllRequest;
+    while (wakeup_all || requests != 0) {
+        auto* const waiter = TryPopOldest();
+        if (!waiter) return;
+
+        // The task that removed the waiter is waiting for us to stop consuming
+        if (waiter->state_.load(std::memory_order_acquire) != Waiter::State::kWaiting) continue;
+
+        // The waiter may be destroyed as soon as it is marked as woken up
+        const boost::intrusive_ptr<TaskContext> context{&waiter->context_};
+        const auto epoch = waiter->epoch_;
+
+        auto expected = Waiter::State::kWaiting;
+        if (!waiter->state_.compare_exchange_strong(expected, Waiter::State::kWoken, std::memory_order_acq_rel)) {
+            UASSERT(expected == Waiter::State::kRemoved);
+            continue;
+        }
+
+        context->Wakeup(TaskContext::WakeupSource::kWaitList, epoch);
+        if (!wakeup_all) --requests;
+    }
+}
+
+FlatCombiningWaitList::Waiter* FlatCombiningWaitList::TryPopOldest() noexcept {
+    if (list_.empty()) {
+        MoveStackToList();
+        if (list_.empty()) return nullptr;
+    }
+
+    auto& waiter = list_.front();
+    list_.pop_front();
+    return &waiter;
+}
+
+void FlatCombiningWaitList::MoveStackToList() noexcept {
+    auto* waiter = stack_.exchange(nullptr, std::memory_order_acquire);
+    if (!waiter) return;
+
+    // The stack is in the reverse order of Append
+    List newer;
+    while (waiter) {
+        auto* const next = waiter->stack_next_;
+        waiter->in_stack_ = false;
+
+        // Removed waiters are waiting for us to stop consuming, drop them
+        if (waiter->state_.load(std::memory_order_acquire) == Waiter::State::kWaiting) {
+            newer.push_front(*waiter);
+        }
+        waiter = next;
+    }
+    list_.splice(list_.end(), newer);
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <boost/intrusive/list.hpp>
+
+#include <engine/task/sleep_state.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+class TaskContext;
+
+/// @brief Wait list for multiple entries without a lock on the hot paths.
+///
+/// Append is a lock-free push into an intrusive stack. Wakeups are
+/// flat-combined: WakeupOne and WakeupAll only post a request, and whoever
+/// manages to become the consumer wakes up the waiters on behalf of everyone.
+/// Remove of a waiter that has been woken up is a single CAS. Only the Remove
+/// of a waiter that has not been woken up (timeout, cancellation, the
+/// condition became true before sleeping) waits for the consumer role.
+///
+/// Unlike WaitList, there is no lock to make a check + Append atomic. Instead,
+/// the waiter must Append first and then re-check the condition, and the
+/// notifier must change the condition before calling WakeupOne or WakeupAll.
+/// If the condition is satisfied on the re-check, the waiter must Remove itself
+/// and must tolerate a concurrent wakeup, e.g. by returning EarlyWakeup{true}.
+class FlatCombiningWaitList final {
+public:
+    /// A waiter, usually stored in the WaitStrategy. May be reused for
+    /// subsequent Append calls after Remove.
+    class Waiter final {
+    public:
+        explicit Waiter(TaskContext& context) noexcept : context_(context) {}
+
+        Waiter(const Waiter&) = delete;
+        Waiter& operator=(const Waiter&) = delete;
+        ~Waiter();
+
+    private:
+        friend class FlatCombiningWaitList;
+
+        enum class State : std::uint8_t {
+            kIdle,
+            kWaiting,
+            kWoken,
+            kRemoved,
+        };
+
+        using ListHook = boost::intrusive::list_member_hook<boost::intrusive::link_mode<boost::intrusive::safe_link>>;
+
+        TaskContext& context_;
+        SleepState::Epoch epoch_{0};
+        std::atomic<State> state_{State::kIdle};
+
+        // Written by Append, then only accessed by the consumer
+        Waiter* stack_next_{nullptr};
+        bool in_stack_{false};
+        ListHook list_hook_;
+    };
+
+    /// @see WaitList::WaitersScopeCounter
+    class WaitersScopeCounter final {
+    public:
+        explicit WaitersScopeCounter(FlatCombiningWaitList& list) noexcept : impl_(list) { ++impl_.sleepies_; }
+        ~WaitersScopeCounter() { --impl_.sleepies_; }
+
+        WaitersScopeCounter(const WaitersScopeCounter&) = delete;
+        WaitersScopeCounter& operator=(const WaitersScopeCounter&) = delete;
+
+    private:
+        FlatCombiningWaitList& impl_;
+    };
+
+    FlatCombiningWaitList() noexcept;
+
+    FlatCombiningWaitList(const FlatCombiningWaitList&) = delete;
+    FlatCombiningWaitList(FlatCombiningWaitList&&) = delete;
+    FlatCombiningWaitList& operator=(const FlatCombiningWaitList&) = delete;
+    FlatCombiningWaitList& operator=(FlatCombiningWaitList&&) = delete;
+    ~FlatCombiningWaitList();
+
+    /// @brief Append the waiter of the current task. Lock-free.
+    /// @note The condition must be re-checked after Append, see the class
+    /// description.
+    void Append(Waiter& waiter) noexcept;
+
+    /// @brief Remove the waiter without wakeup. The waiter is not accessed by
+    /// the list after Remove returns.
+    /// @returns whether the waiter has been woken up by the list. If the task
+    /// does not make use of the wakeup (e.g. its deadline has expired), it
+    /// should pass the wakeup to another waiter.
+    bool Remove(Waiter& waiter) noexcept;
+
+    /// @brief Wake up the oldest waiter, if any. Never blocks.
+    void WakeupOne();
+
+    /// @brief Wake up all the waiters. Never blocks.
+    void WakeupAll();
+
+    /// @brief Get the maximum amount of coroutines that may be sleeping
+    /// @returns 0 if there are definitely no waiters currently, non-0 otherwise
+    std::size_t GetCountOfSleepies() const noexcept { return sleepies_.load(); }
+
+private:
+    using List = boost::intrusive::list<
+        Waiter,
+        boost::intrusive::member_hook<Waiter, Waiter::ListHook, &Waiter::list_hook_>,
+        boost::intrusive::constant_time_size<false>>;
+
+    bool TryStartConsuming() noexcept;
+    void StartConsuming() noexcept;
+    void StopConsumingAndProcessRequests();
+    void ProcessRequests(std::uint64_t requests);
+    Waiter* TryPopOldest() noexcept;
+    void MoveStackToList() noexcept;
+
+    std::atomic<std::size_t> sleepies_{0};
+    // WakeupOne adds 1, WakeupAll adds kWakeupAllRequest
+    std::atomic<std::uint64_t> wakeup_requests_{0};
+    std::atomic<bool> is_consuming_{false};
+
+    // Waiters that were taken from stack_ but not yet woken up, in the order
+    // of Append. Only accessed by the consumer.
+    List list_;
+
+    // Waiters newer than the ones in list_, the newest one on top
+    std::atomic<Waiter*> stack_{nullptr};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,283 @@
+#include <engine/impl/flat_combining_wait_list.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include <engine/task/task_context.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/rand.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// A counting semaphore on top of FlatCombiningWaitList, that follows the
+// protocol from the FlatCombiningWaitList description: Append, then re-check;
+// change the state, then wake up; pass on a wakeup that was not used.
+class Permits final {
+public:
+    explicit Permits(std::size_t count) : available_(count) {}
+
+    bool Take(engine::Deadline deadline) {
+        if (TryTake()) return true;
+
+        auto& current = engine::current_task::GetCurrentTaskContext();
+        WaitStrategy wait_strategy{*this, current};
+        while (true) {
+            const auto wakeup_source = current.Sleep(wait_strategy, deadline);
+            if (wait_strategy.IsTaken()) return true;
+            if (!engine::impl::HasWaitSucceeded(wakeup_source)) {
+                if (wait_strategy.IsWokenUp()) waiters_.WakeupOne();
+                return false;
+            }
+        }
+    }
+
+    void Give(std::size_t count = 1) {
+        available_.fetch_add(count);
+        if (waiters_.GetCountOfSleepies()) {
+            if (count > 1) {
+                waiters_.WakeupAll();
+            } else {
+                waiters_.WakeupOne();
+            }
+        }
+    }
+
+    // Wakeups without a state change, the waiters must go back to sleep
+    void SpuriousWakeupOne() { waiters_.WakeupOne(); }
+    void SpuriousWakeupAll() { waiters_.WakeupAll(); }
+
+    std::size_t GetAvailable() const noexcept { return available_.load(); }
+
+private:
+    class WaitStrategy final : public engine::impl::WaitStrategy {
+    public:
+        WaitStrategy(Permits& permits, engine::impl::TaskContext& current) noexcept
+            : permits_(permits), waiter_token_(permits_.waiters_), waiter_(current) {}
+
+        engine::impl::EarlyWakeup SetupWakeups() override {
+            woken_up_ = false;
+            if (permits_.TryTake()) {
+                taken_ = true;
+                return engine::impl::EarlyWakeup{true};
+            }
+            permits_.waiters_.Append(waiter_);
+            if (permits_.TryTake()) {
+                taken_ = true;
+                // The wakeup, if any, is consumed by the taken permit
+                permits_.waiters_.Remove(waiter_);
+                return engine::impl::EarlyWakeup{true};
+            }
+            return engine::impl::EarlyWakeup{false};
+        }
+
+        void DisableWakeups() noexcept override { woken_up_ = permits_.waiters_.Remove(waiter_); }
+
+        bool IsTaken() const noexcept { return taken_; }
+
+        bool IsWokenUp() const noexcept { return woken_up_; }
+
+    private:
+        Permits& permits_;
+        const engine::impl::FlatCombiningWaitList::WaitersScopeCounter waiter_token_;
+        engine::impl::FlatCombiningWaitList::Waiter waiter_;
+        bool taken_{false};
+        bool woken_up_{false};
+    };
+
+    bool TryTake() noexcept {
+        auto expected = available_.load();
+        while (expected != 0) {
+            if (available_.compare_exchange_weak(expected, expected - 1)) return true;
+        }
+        return false;
+    }
+
+    std::atomic<std::size_t> available_;
+    engine::impl::FlatCombiningWaitList waiters_;
+};
+
+engine::Deadline RandomShortDeadline() {
+    constexpr std::int64_t kMaxTimeoutUs = 100;
+    return engine::Deadline::FromDuration(std::chrono::microseconds{utils::RandRange(kMaxTimeoutUs)});
+}
+
+// Exposes engine::Semaphore of capacity 1 as a mutex
+class SemaphoreMutex final {
+public:
+    void lock() { semaphore_.lock_shared(); }
+    void unlock() { semaphore_.unlock_shared(); }
+    bool try_lock_until(engine::Deadline deadline) { return semaphore_.try_lock_shared_until(deadline); }
+
+private:
+    engine::Semaphore semaphore_{1};
+};
+
+// Each round there is a single unlock by the test. The waiters with timeouts
+// that were woken up but have timed out must pass the wakeup on, otherwise
+// the waiter without a timeout never wakes up.
+template <typename MutexType>
+void StressTimeoutsHandOff() {
+    constexpr std::size_t kRounds = 200;
+    constexpr std::size_t kTimedWaiters = 8;
+
+    for (std::size_t round = 0; round < kRounds; ++round) {
+        MutexType mutex;
+        std::unique_lock lock(mutex);
+
+        auto timed_waiters = utils::GenerateFixedArray(kTimedWaiters, [&](std::size_t) {
+            return engine::AsyncNoSpan([&] {
+                if (mutex.try_lock_until(RandomShortDeadline())) mutex.unlock();
+            });
+        });
+        auto waiter = engine::AsyncNoSpan([&] { const std::lock_guard waiter_lock(mutex); });
+
+        engine::SleepFor(std::chrono::microseconds{utils::RandRange(100)});
+        lock.unlock();
+
+        waiter.WaitFor(utest::kMaxTestWaitTime);
+        ASSERT_TRUE(waiter.IsFinished()) << "lost wakeup on round " << round;
+        for (auto& task : timed_waiters) task.Get();
+    }
+}
+
+}  // namespace
+
+UTEST(FlatCombiningWaitList, TakeAndGive) {
+    Permits permits{0};
+
+    EXPECT_FALSE(permits.Take(engine::Deadline::FromDuration(1ms)));
+
+    auto task = engine::AsyncNoSpan([&] { return permits.Take(engine::Deadline{}); });
+    engine::Yield();
+    EXPECT_FALSE(task.IsFinished());
+
+    permits.SpuriousWakeupAll();
+    engine::Yield();
+    EXPECT_FALSE(task.IsFinished());
+
+    permits.Give();
+    EXPECT_TRUE(task.Get());
+    EXPECT_EQ(permits.GetAvailable(), 0);
+}
+
+// A lost wakeup in the window between Append and the re-check, or between the
+// state change and the wakeup, makes one of the tasks sleep forever.
+UTEST_MT(FlatCombiningWaitList, PingPong, 2) {
+    constexpr std::size_t kRoundTrips = 10000;
+
+    Permits ping{0};
+    Permits pong{0};
+
+    auto task = engine::AsyncNoSpan([&] {
+        for (std::size_t i = 0; i < kRoundTrips; ++i) {
+            ASSERT_TRUE(ping.Take(engine::Deadline::FromDuration(utest::kMaxTestWaitTime)));
+            pong.Give();
+        }
+    });
+
+    for (std::size_t i = 0; i < kRoundTrips; ++i) {
+        ping.Give();
+        ASSERT_TRUE(pong.Take(engine::Deadline::FromDuration(utest::kMaxTestWaitTime))) << "round trip " << i;
+    }
+    UEXPECT_NO_THROW(task.Get());
+}
+
+UTEST_MT(FlatCombiningWaitList, WakeupAllRounds, 4) {
+    constexpr std::size_t kRounds = 1000;
+    constexpr std::size_t kWaiters = 8;
+
+    Permits start{0};
+    Permits finish{0};
+
+    auto tasks = utils::GenerateFixedArray(kWaiters, [&](std::size_t) {
+        return engine::AsyncNoSpan([&] {
+            for (std::size_t round = 0; round < kRounds; ++round) {
+                ASSERT_TRUE(start.Take(engine::Deadline::FromDuration(utest::kMaxTestWaitTime)));
+                finish.Give();
+            }
+        });
+    });
+
+    for (std::size_t round = 0; round < kRounds; ++round) {
+        start.Give(kWaiters);
+        for (std::size_t i = 0; i < kWaiters; ++i) {
+            ASSERT_TRUE(finish.Take(engine::Deadline::FromDuration(utest::kMaxTestWaitTime))) << "round " << round;
+        }
+    }
+    for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+}
+
+// Waiters time out and Remove themselves concurrently with WakeupOne and
+// WakeupAll. The permits must neither be lost nor duplicated, and the waiters
+// without a timeout must get all the permits in the end.
+UTEST_MT(FlatCombiningWaitList, RemoveRacesWakeups, 4) {
+    constexpr std::size_t kPermits = 2;
+    constexpr std::size_t kTimedWaiters = 16;
+    constexpr auto kStressDuration = 100ms;
+
+    Permits permits{kPermits};
+    std::atomic<bool> keep_running{true};
+    std::atomic<std::size_t> taken{0};
+    std::atomic<std::size_t> timed_out{0};
+
+    auto timed_waiters = utils::GenerateFixedArray(kTimedWaiters, [&](std::size_t) {
+        return engine::AsyncNoSpan([&] {
+            while (keep_running) {
+                if (permits.Take(RandomShortDeadline())) {
+                    ++taken;
+                    permits.Give();
+                } else {
+                    ++timed_out;
+                }
+            }
+        });
+    });
+
+    auto spurious_notifier = engine::AsyncNoSpan([&] {
+        while (keep_running) {
+            if (utils::RandRange(2) == 0) {
+                permits.SpuriousWakeupOne();
+            } else {
+                permits.SpuriousWakeupAll();
+            }
+            engine::Yield();
+        }
+    });
+
+    engine::SleepFor(kStressDuration / 2);
+    auto waiters = utils::GenerateFixedArray(kPermits, [&](std::size_t) {
+        return engine::AsyncNoSpan([&] { return permits.Take(engine::Deadline{}); });
+    });
+    engine::SleepFor(kStressDuration / 2);
+
+    keep_running = false;
+    for (auto& task : timed_waiters) UEXPECT_NO_THROW(task.Get());
+    UEXPECT_NO_THROW(spurious_notifier.Get());
+
+    for (auto& task : waiters) {
+        task.WaitFor(utest::kMaxTestWaitTime);
+        ASSERT_TRUE(task.IsFinished()) << "lost wakeup";
+        EXPECT_TRUE(task.Get());
+    }
+    EXPECT_EQ(permits.GetAvailable(), 0);
+    EXPECT_GT(taken.load(), 0);
+    EXPECT_GT(timed_out.load(), 0);
+
+    permits.Give(kPermits);
+}
+
+UTEST_MT(FlatCombiningWaitList, MutexTimeoutsHandOff, 4) { StressTimeoutsHandOff<engine::Mutex>(); }
+
+UTEST_MT(FlatCombiningWaitList, SemaphoreTimeoutsHandOff, 4) { StressTimeoutsHandOff<SemaphoreMutex>(); }
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <type_traits>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/adaptive_spinner.hpp>
 
 #include <userver/utils/assert.hpp>
 
+#include <engine/impl/flat_combining_wait_list.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
@@ -15,6 +18,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+// The mutexes that may be awaited by many tasks spin before suspending
+template <class Waiters>
+using MutexSpinner = std::conditional_t<std::is_same_v<Waiters, WaitListLight>, NoSpinner, AdaptiveSpinner>;
+
 template <class Waiters>
 class MutexImpl {
 public:
@@ -40,9 +47,11 @@ private:
     bool TryLockWithTaskContext(TaskContext& current);
 
     bool LockFastPath(TaskContext&) noexcept;
+    bool LockSpinPath(TaskContext&, Deadline) noexcept;
     bool LockSlowPath(TaskContext&, Deadline);
 
     std::atomic<TaskContext*> owner_;
+    MutexSpinner<Waiters> spinner_;
     Waiters lock_waiters_;
 };
 
@@ -74,6 +83,41 @@ private:
     const WaitList::WaitersScopeCounter waiter_token_;
 };
 
+template <>
+class MutexImpl<FlatCombiningWaitList>::MutexWaitStrategy final : public WaitStrategy {
+public:
+    MutexWaitStrategy(MutexImpl<FlatCombiningWaitList>& mutex, TaskContext& current)
+        : mutex_(mutex), current_(current), waiter_token_(mutex_.lock_waiters_), waiter_(current) {}
+
+    EarlyWakeup SetupWakeups() override {
+        woken_up_ = false;
+        if (mutex_.TryLockWithTaskContext(current_)) {
+            return EarlyWakeup{true};
+        }
+        // There is no lock to make check + Append atomic, so the check is
+        // repeated after Append. unlock() releases the mutex before WakeupOne.
+        mutex_.lock_waiters_.Append(waiter_);
+        if (mutex_.TryLockWithTaskContext(current_)) {
+            // The wakeup, if any, is consumed by locking the mutex
+            mutex_.lock_waiters_.Remove(waiter_);
+            return EarlyWakeup{true};
+        }
+        return EarlyWakeup{false};
+    }
+
+    void DisableWakeups() noexcept override { woken_up_ = mutex_.lock_waiters_.Remove(waiter_); }
+
+    // Whether the last wakeup came from unlock()
+    bool IsWokenUp() const noexcept { return woken_up_; }
+
+private:
+    MutexImpl<FlatCombiningWaitList>& mutex_;
+    TaskContext& current_;
+    const FlatCombiningWaitList::WaitersScopeCounter waiter_token_;
+    FlatCombiningWaitList::Waiter waiter_;
+    bool woken_up_{false};
+};
+
 template <>
 class MutexImpl<WaitListLight>::MutexWaitStrategy final : public WaitStrategy {
 public:
@@ -128,6 +172,14 @@ bool MutexImpl<Waiters>::LockFastPath(TaskContext& current) noexcept {
     return owner_.compare_exchange_strong(expected, &current, std::memory_order_acquire);
 }
 
+template <class Waiters>
+bool MutexImpl<Waiters>::LockSpinPath(TaskContext& current, Deadline deadline) noexcept {
+    if (deadline == Deadline::Passed()) return false;
+    return spinner_.Spin([this, &current] {
+        return owner_.load(std::memory_order_relaxed) == nullptr && LockFastPath(current);
+    });
+}
+
 template <class Waiters>
 bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
     const engine::TaskCancellationBlocker block_cancels;
@@ -138,6 +190,10 @@ bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
             return true;
         }
         if (!HasWaitSucceeded(wakeup_source)) {
+            if constexpr (std::is_same_v<Waiters, FlatCombiningWaitList>) {
+                // Do not lose the wakeup from unlock() that we are not going to use
+                if (wait_manager.IsWokenUp()) lock_waiters_.WakeupOne();
+            }
             return false;
         }
     }
@@ -162,6 +218,10 @@ void MutexImpl<Waiters>::unlock() {
             WaitList::Lock lock(lock_waiters_);
             lock_waiters_.WakeupOne(lock);
         }
+    } else if constexpr (std::is_same_v<Waiters, FlatCombiningWaitList>) {
+        if (lock_waiters_.GetCountOfSleepies()) {
+            lock_waiters_.WakeupOne();
+        }
     } else {
         static_assert(std::is_same_v<Waiters, WaitListLight>);
         lock_waiters_.WakeupOne();
@@ -200,7 +260,7 @@ bool MutexImpl<Waiters>::try_lock_until(Deadline deadline) {
 #endif
 
     auto& current = current_task::GetCurrentTaskContext();
-    const auto result = LockFastPath(current) || LockSlowPath(current, deadline);
+    const auto result = LockFastPath(current) || LockSpinPath(current, deadline) || LockSlowPath(current, deadline);
 
 #if USERVER_IMPL_HAS_TSAN
     __tsan_mutex_post_lock(this, __tsan_mutex_try_lock | (result ? 0 : __tsan_mutex_try_lock_failed), 0);
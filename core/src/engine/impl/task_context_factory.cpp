@@ -1,28 +1,98 @@
 #include <userver/engine/impl/task_context_factory.hpp>
 
+#include <boost/container/static_vector.hpp>
+
 #include <engine/task/task_context.hpp>
+#include <userver/compiler/impl/asan.hpp>
+#include <userver/compiler/impl/tsan.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/utils/assert.hpp>
 
+#if defined(__has_feature)
+#if __has_feature(memory_sanitizer)
+#define HAS_MSAN 1
+#endif
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Tasks with small payloads are often spawned and destroyed at a high rate,
+// so their storages are reused to keep the allocator out of the way.
+constexpr std::size_t kMaxPooledPayloadSize = 256;
+constexpr std::size_t kPooledStorageSize = sizeof(TaskContext) + kMaxPooledPayloadSize;
+constexpr std::size_t kMaxPooledStoragesPerThread = 64;
+
+// A reused storage hides use-after-free of a TaskContext or of its payload
+// from the sanitizers, so the storages are not pooled in sanitized builds.
+#if USERVER_IMPL_HAS_ASAN || USERVER_IMPL_HAS_TSAN || defined(HAS_MSAN)
+constexpr bool kPoolStorages = false;
+#else
+constexpr bool kPoolStorages = true;
+#endif
+
+struct alignas(kTaskContextAlignment) PooledStorage final {
+    std::byte data[kPooledStorageSize];
+};
+
+compiler::ThreadLocal local_pooled_storages = [] {
+    return boost::container::static_vector<std::unique_ptr<PooledStorage>, kMaxPooledStoragesPerThread>{};
+};
+
+}  // namespace
+
 std::size_t GetTaskContextSize() noexcept { return sizeof(TaskContext); }
 
 static_assert(kTaskContextAlignment >= alignof(TaskContext));
 static_assert(sizeof(TaskContext) % kTaskContextAlignment == 0);
 
-TaskContext& PlacementNewTaskContext(std::byte* storage, TaskConfig config, utils::impl::WrappedCallBase& payload) {
-    return *new (storage)
-        TaskContext{config.task_processor, config.importance, config.wait_mode, config.deadline, payload};
+TaskContext& PlacementNewTaskContext(
+    std::byte* storage,
+    std::size_t total_size,
+    TaskConfig config,
+    utils::impl::WrappedCallBase& payload
+) {
+    return *new (storage) TaskContext{
+        config.task_processor,
+        config.importance,
+        config.priority,
+        config.wait_mode,
+        config.deadline,
+        payload,
+        total_size,
+    };
 }
 
 std::byte* AllocateFusedTaskContext(std::size_t total_size) {
+    if (total_size <= kPooledStorageSize) {
+        if constexpr (kPoolStorages) {
+            auto storages = local_pooled_storages.Use();
+            if (!storages->empty()) {
+                auto* const storage = storages->back().release();
+                storages->pop_back();
+                return storage->data;
+            }
+        }
+        return (new PooledStorage)->data;
+    }
     return static_cast<std::byte*>(::operator new[](total_size, std::align_val_t{kTaskContextAlignment}));
 }
 
-void DeleteFusedTaskContext(std::byte* storage) noexcept {
+void DeleteFusedTaskContext(std::byte* storage, std::size_t total_size) noexcept {
     UASSERT(storage);
+    if (total_size <= kPooledStorageSize) {
+        std::unique_ptr<PooledStorage> owned_storage{reinterpret_cast<PooledStorage*>(storage)};
+        if constexpr (kPoolStorages) {
+            auto storages = local_pooled_storages.Use();
+            if (storages->size() != storages->capacity()) {
+                storages->push_back(std::move(owned_storage));
+            }
+        }
+        return;
+    }
     ::operator delete[](storage, std::align_val_t{kTaskContextAlignment});
 }
 
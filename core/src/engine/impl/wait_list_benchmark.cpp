@@ -1,17 +1,20 @@
 #include <benchmark/benchmark.h>
 
 #include <atomic>
+#include <memory>
 #include <thread>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_context_holder.hpp>
 #include <userver/engine/run_standalone.hpp>
 
+#include <engine/impl/flat_combining_wait_list.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+using engine::impl::FlatCombiningWaitList;
 using engine::impl::TaskContext;
 using engine::impl::WaitList;
 
@@ -139,7 +142,86 @@ void wait_list_add_remove_contention(benchmark::State& state) {
         run = false;
     });
 }
-BENCHMARK(wait_list_add_remove_contention)->RangeMultiplier(2)->Range(1, 2)->UseRealTime();
+BENCHMARK(wait_list_add_remove_contention)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+void flat_combining_wait_list_add_remove_contention(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        std::atomic<bool> run{true};
+        FlatCombiningWaitList wl;
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(state.range(0) - 1);
+        for (int i = 0; i < state.range(0) - 1; i++)
+            tasks.push_back(engine::AsyncNoSpan([&]() {
+                boost::intrusive_ptr<TaskContext> ctx = MakeContext();
+                FlatCombiningWaitList::Waiter waiter{*ctx};
+                while (run) {
+                    wl.Append(waiter);
+                    wl.Remove(waiter);
+                }
+            }));
+
+        boost::intrusive_ptr<TaskContext> ctx = MakeContext();
+        FlatCombiningWaitList::Waiter waiter{*ctx};
+        for ([[maybe_unused]] auto _ : state) {
+            wl.Append(waiter);
+            wl.Remove(waiter);
+        }
+
+        run = false;
+    });
+}
+BENCHMARK(flat_combining_wait_list_add_remove_contention)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+void flat_combining_wait_list_add_remove_contention_unbalanced(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        std::atomic<bool> run{true};
+        FlatCombiningWaitList wl;
+
+        const auto make_waiters = [](const auto& contexts) {
+            std::vector<std::unique_ptr<FlatCombiningWaitList::Waiter>> waiters;
+            waiters.reserve(contexts.size());
+            for (const auto& ctx : contexts) {
+                waiters.push_back(std::make_unique<FlatCombiningWaitList::Waiter>(*ctx));
+            }
+            return waiters;
+        };
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(state.range(0) - 1);
+        for (int i = 0; i < state.range(0) - 1; i++)
+            tasks.push_back(engine::AsyncNoSpan([&]() {
+                const auto contexts = MakeContexts();
+                const auto waiters = make_waiters(contexts);
+                while (run) {
+                    for (const auto& waiter : waiters) {
+                        wl.Append(*waiter);
+                    }
+                    for (const auto& waiter : waiters) {
+                        wl.Remove(*waiter);
+                    }
+                }
+            }));
+
+        const auto contexts = MakeContexts();
+        const auto waiters = make_waiters(contexts);
+        for ([[maybe_unused]] auto _ : state) {
+            for (const auto& waiter : waiters) {
+                wl.Append(*waiter);
+            }
+            for (const auto& waiter : waiters) {
+                wl.Remove(*waiter);
+            }
+        }
+
+        run = false;
+    });
+}
+BENCHMARK(flat_combining_wait_list_add_remove_contention_unbalanced)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
 
 void wait_list_add_remove_contention_unbalanced(benchmark::State& state) {
     engine::RunStandalone(state.range(0), [&] {
@@ -1,9 +1,14 @@
 #include <userver/engine/io/buffered.hpp>
 
+#include <cstdint>
+#include <cstring>
+
 #include <boost/algorithm/string/trim.hpp>
+#include <fmt/format.h>
 
 #include <engine/io/impl/buffer.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,13 +40,7 @@ std::string BufferedReader::ReadSome(size_t max_bytes, Deadline deadline) {
 }
 
 std::string BufferedReader::ReadAll(size_t num_bytes, Deadline deadline) {
-    if (buffer_->AvailableReadBytes() < num_bytes) {
-        buffer_->Reserve(num_bytes - buffer_->AvailableReadBytes());
-        while (buffer_->AvailableReadBytes() < num_bytes) {
-            if (!FillBuffer(deadline)) break;
-        }
-    }
-    std::string result(buffer_->ReadPtr(), std::min(num_bytes, buffer_->AvailableReadBytes()));
+    std::string result{PeekAll(num_bytes, deadline)};
     buffer_->ReportRead(result.size());
     return result;
 }
@@ -55,7 +54,9 @@ std::string BufferedReader::ReadLine(Deadline deadline) {
 }
 
 std::string BufferedReader::ReadUntil(char terminator, Deadline deadline) {
-    return ReadUntil([terminator](int c) { return c == terminator; }, deadline);
+    std::string result{PeekUntil(terminator, deadline)};
+    buffer_->ReportRead(result.size());
+    return result;
 }
 
 std::string BufferedReader::ReadUntil(utils::function_ref<bool(int) const> pred, Deadline deadline) {
@@ -114,6 +115,75 @@ void BufferedReader::Discard(size_t num_bytes, Deadline deadline) {
     }
 }
 
+std::string_view BufferedReader::PeekSome(Deadline deadline) {
+    if (!buffer_->AvailableReadBytes()) {
+        buffer_->Reserve(1);
+        FillBuffer(deadline);
+    }
+    return {buffer_->ReadPtr(), buffer_->AvailableReadBytes()};
+}
+
+std::string_view BufferedReader::PeekAll(size_t num_bytes, Deadline deadline) {
+    EnsureAvailable(num_bytes, deadline);
+    return {buffer_->ReadPtr(), std::min(num_bytes, buffer_->AvailableReadBytes())};
+}
+
+std::string_view BufferedReader::PeekUntil(char terminator, Deadline deadline) {
+    size_t search_pos = 0;
+    while (true) {
+        const auto* read_ptr = buffer_->ReadPtr();
+        const auto available = buffer_->AvailableReadBytes();
+        // memchr is vectorized by libc
+        const auto* found =
+            static_cast<const char*>(std::memchr(read_ptr + search_pos, terminator, available - search_pos));
+        if (found) return {read_ptr, static_cast<size_t>(found - read_ptr) + 1};
+
+        search_pos = available;
+        buffer_->Reserve(1);
+        if (!FillBuffer(deadline)) throw TerminatorNotFoundException();
+    }
+}
+
+std::string_view
+BufferedReader::PeekLengthPrefixedFrame(size_t prefix_size, size_t max_payload_size, Deadline deadline) {
+    UINVARIANT(prefix_size > 0 && prefix_size <= sizeof(std::uint64_t), "Invalid frame length prefix size");
+
+    if (!EnsureAvailable(prefix_size, deadline)) {
+        if (!buffer_->AvailableReadBytes()) return {};
+        throw FrameException("EOF encountered in the middle of a frame length");
+    }
+
+    std::uint64_t payload_size = 0;
+    const auto* prefix = reinterpret_cast<const unsigned char*>(buffer_->ReadPtr());
+    for (size_t i = 0; i < prefix_size; ++i) payload_size = (payload_size << 8) | prefix[i];
+    if (payload_size > max_payload_size) {
+        throw FrameException(
+            fmt::format("Frame payload length {} is above the limit of {}", payload_size, max_payload_size)
+        );
+    }
+
+    const auto frame_size = prefix_size + static_cast<size_t>(payload_size);
+    if (!EnsureAvailable(frame_size, deadline)) {
+        throw FrameException("EOF encountered in the middle of a frame");
+    }
+    return {buffer_->ReadPtr(), frame_size};
+}
+
+void BufferedReader::Consume(size_t num_bytes) {
+    UINVARIANT(num_bytes <= buffer_->AvailableReadBytes(), "Attempt to consume more bytes than buffered");
+    buffer_->ReportRead(num_bytes);
+}
+
+bool BufferedReader::EnsureAvailable(size_t num_bytes, Deadline deadline) {
+    if (buffer_->AvailableReadBytes() >= num_bytes) return true;
+
+    buffer_->Reserve(num_bytes - buffer_->AvailableReadBytes());
+    while (buffer_->AvailableReadBytes() < num_bytes) {
+        if (!FillBuffer(deadline)) return false;
+    }
+    return true;
+}
+
 size_t BufferedReader::FillBuffer(Deadline deadline) {
     try {
         auto read_bytes = source_->ReadSome(buffer_->WritePtr(), buffer_->AvailableWriteBytes(), deadline);
@@ -101,4 +101,56 @@ TEST(BufferedReader, GetPeek) {
     EXPECT_EQ(EOF, reader.Peek());
 }
 
+TEST(BufferedReader, PeekConsume) {
+    auto mock_ptr = std::make_shared<ReadableMock>();
+    BufferedReader reader(mock_ptr);
+
+    EXPECT_TRUE(reader.PeekSome().empty());
+    mock_ptr->Feed("test");
+    EXPECT_EQ("tes", reader.PeekAll(3));
+    EXPECT_EQ("tes", reader.PeekAll(3)) << "Peek must not consume";
+    reader.Consume(2);
+    EXPECT_EQ("st", reader.PeekAll(10));
+    reader.Consume(2);
+    EXPECT_TRUE(reader.PeekSome().empty());
+}
+
+TEST(BufferedReader, PeekUntil) {
+    auto mock_ptr = std::make_shared<ReadableMock>();
+    BufferedReader reader(mock_ptr);
+
+    mock_ptr->Feed(std::string(100000, 'a') + ";b");
+    const auto line = reader.PeekUntil(';');
+    EXPECT_EQ(line.size(), 100001);
+    EXPECT_EQ(line.back(), ';');
+    reader.Consume(line.size());
+
+    UEXPECT_THROW(reader.PeekUntil(';'), engine::io::TerminatorNotFoundException);
+    EXPECT_EQ("b", reader.PeekSome());
+}
+
+TEST(BufferedReader, PeekLengthPrefixedFrame) {
+    using namespace std::string_literals;
+    auto mock_ptr = std::make_shared<ReadableMock>();
+    BufferedReader reader(mock_ptr);
+
+    mock_ptr->Feed("\0\3abc\0\0"s);
+    auto frame = reader.PeekLengthPrefixedFrame(2, 10);
+    EXPECT_EQ(frame, "\0\3abc"s);
+    reader.Consume(frame.size());
+
+    frame = reader.PeekLengthPrefixedFrame(2, 10);
+    EXPECT_EQ(frame, "\0\0"s);
+    reader.Consume(frame.size());
+
+    EXPECT_TRUE(reader.PeekLengthPrefixedFrame(2, 10).empty());
+
+    mock_ptr->Feed("\0\xff"s);
+    UEXPECT_THROW(reader.PeekLengthPrefixedFrame(2, 10), engine::io::FrameException);
+
+    mock_ptr->Feed("\0\5abc"s);
+    reader.Consume(2);
+    UEXPECT_THROW(reader.PeekLengthPrefixedFrame(2, 10), engine::io::FrameException);
+}
+
 USERVER_NAMESPACE_END
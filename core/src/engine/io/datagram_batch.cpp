@@ -0,0 +1,170 @@
+#include <userver/engine/io/datagram_batch.hpp>
+
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+namespace {
+
+// Enough for the UDP_GRO segment size
+constexpr std::size_t kControlSize = 64;
+
+}  // namespace
+
+struct DatagramBatch::Impl final {
+    struct Datagram final {
+        std::size_t offset{0};
+        std::size_t size{0};
+        std::size_t message_index{0};
+        bool truncated{false};
+    };
+
+    Impl(std::size_t max_messages, std::size_t message_size)
+        : message_size(message_size),
+          buffer(max_messages * message_size),
+          addresses(max_messages),
+          iovecs(max_messages),
+          controls(max_messages * kControlSize) {
+        UINVARIANT(max_messages > 0 && message_size > 0, "DatagramBatch must not be empty");
+        datagrams.reserve(max_messages);
+#ifdef __linux__
+        headers.resize(max_messages);
+#endif
+    }
+
+    std::size_t MaxMessages() const noexcept { return addresses.size(); }
+
+    // Prepares the headers for the next receive
+    ::msghdr& ResetHeader(std::size_t index) noexcept;
+
+    // Accounts the received message, splitting it if the kernel has coalesced
+    // the datagrams with UDP_GRO
+    void AddMessage(std::size_t index, const ::msghdr& header, std::size_t size);
+
+    const std::size_t message_size;
+    std::vector<char> buffer;
+    std::vector<Sockaddr> addresses;
+    std::vector<::iovec> iovecs;
+    std::vector<char> controls;
+#ifdef __linux__
+    std::vector<::mmsghdr> headers;
+#else
+    ::msghdr header{};
+#endif
+    std::vector<Datagram> datagrams;
+};
+
+::msghdr& DatagramBatch::Impl::ResetHeader(std::size_t index) noexcept {
+    auto& iov = iovecs[index];
+    iov.iov_base = buffer.data() + index * message_size;
+    iov.iov_len = message_size;
+
+#ifdef __linux__
+    auto& header = headers[index].msg_hdr;
+#endif
+    header = ::msghdr{};
+    header.msg_name = addresses[index].Data();
+    header.msg_namelen = addresses[index].Capacity();
+    header.msg_iov = &iov;
+    header.msg_iovlen = 1;
+    header.msg_control = controls.data() + index * kControlSize;
+    header.msg_controllen = kControlSize;
+    return header;
+}
+
+void DatagramBatch::Impl::AddMessage(std::size_t index, const ::msghdr& header, std::size_t size) {
+    if (header.msg_namelen > addresses[index].Capacity()) {
+        throw IoException() << "Peer address does not fit into AddrStorage, addrlen=" << header.msg_namelen;
+    }
+
+    std::size_t segment_size = size;
+#ifdef UDP_GRO
+    for (auto* cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(const_cast<::msghdr*>(&header), cmsg)) {  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+            int gro_size = 0;
+            std::memcpy(&gro_size, CMSG_DATA(cmsg), sizeof(gro_size));
+            if (gro_size > 0) segment_size = gro_size;
+        }
+    }
+#endif
+
+    const bool truncated = (header.msg_flags & MSG_TRUNC) != 0;
+    const auto message_offset = index * message_size;
+    std::size_t offset = 0;
+    do {
+        const auto datagram_size = std::min(segment_size, size - offset);
+        datagrams.push_back({message_offset + offset, datagram_size, index, truncated});
+        offset += datagram_size;
+    } while (offset < size);
+}
+
+DatagramBatch::DatagramBatch(std::size_t max_messages, std::size_t message_size)
+    : impl_(std::make_unique<Impl>(max_messages, message_size)) {}
+
+DatagramBatch::DatagramBatch(DatagramBatch&&) noexcept = default;
+
+DatagramBatch& DatagramBatch::operator=(DatagramBatch&&) noexcept = default;
+
+DatagramBatch::~DatagramBatch() = default;
+
+std::size_t DatagramBatch::Size() const noexcept { return impl_->datagrams.size(); }
+
+std::string_view DatagramBatch::GetData(std::size_t index) const {
+    UASSERT(index < Size());
+    const auto& datagram = impl_->datagrams[index];
+    return {impl_->buffer.data() + datagram.offset, datagram.size};
+}
+
+const Sockaddr& DatagramBatch::GetSourceAddress(std::size_t index) const {
+    UASSERT(index < Size());
+    return impl_->addresses[impl_->datagrams[index].message_index];
+}
+
+bool DatagramBatch::IsTruncated(std::size_t index) const {
+    UASSERT(index < Size());
+    return impl_->datagrams[index].truncated;
+}
+
+std::size_t DatagramBatch::MaxMessages() const noexcept { return impl_->MaxMessages(); }
+
+ssize_t DatagramBatch::Receive(int fd) {
+    impl_->datagrams.clear();
+
+#ifdef __linux__
+    for (std::size_t i = 0; i < impl_->MaxMessages(); ++i) impl_->ResetHeader(i);
+
+    const auto received = ::recvmmsg(fd, impl_->headers.data(), impl_->MaxMessages(), MSG_DONTWAIT, nullptr);
+    for (ssize_t i = 0; i < received; ++i) {
+        const auto& message = impl_->headers[i];
+        impl_->AddMessage(i, message.msg_hdr, message.msg_len);
+    }
+    return received;
+#else
+    // MAC_COMPAT: no recvmmsg
+    std::size_t received = 0;
+    for (; received < impl_->MaxMessages(); ++received) {
+        auto& header = impl_->ResetHeader(received);
+        const auto size = ::recvmsg(fd, &header, MSG_DONTWAIT);
+        if (size == -1) break;
+        impl_->AddMessage(received, header, size);
+    }
+    return received == 0 ? -1 : static_cast<ssize_t>(received);
+#endif
+}
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
@@ -99,6 +99,17 @@ public:
         const Context&... context
     );
 
+    // (IoFunc*)(int, size_t), e.g. sendfile with a bound input descriptor
+    template <typename IoFunc, typename... Context>
+    size_t PerformIoWithoutBuffer(
+        SingleUserGuard& guard,
+        IoFunc&& io_func,
+        size_t len,
+        TransferMode mode,
+        Deadline deadline,
+        const Context&... context
+    );
+
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return poller_.TryGetContextAccessor(); }
 
 private:
@@ -273,6 +284,32 @@ size_t Direction::PerformIo(
     return pos - begin;
 }
 
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformIoWithoutBuffer(
+    SingleUserGuard&,
+    IoFunc&& io_func,
+    size_t len,
+    TransferMode mode,
+    Deadline deadline,
+    const Context&... context
+) {
+    size_t processed_bytes = 0;
+
+    while (processed_bytes < len) {
+        auto chunk_size = io_func(Fd(), len - processed_bytes);
+
+        if (chunk_size > 0) {
+            processed_bytes += chunk_size;
+            if (mode == TransferMode::kOnce) {
+                break;
+            }
+        } else if (!chunk_size || TryHandleError(errno, processed_bytes, mode, deadline, context...) == ErrorMode::kFatal) {
+            break;
+        }
+    }
+    return processed_bytes;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <string>
+
 #include <unistd.h>
 
 #include <userver/engine/run_standalone.hpp>
@@ -94,4 +96,28 @@ void fd_control_construct_wait_destroy(benchmark::State& state) {
 }
 BENCHMARK(fd_control_construct_wait_destroy);
 
+void fd_control_wait_ready(benchmark::State& state, const std::string& ev_backend) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_backend = ev_backend;
+    engine::RunStandalone(1, config, [&] {
+        Pipe pipe;
+        auto read_control = FdControl::Adopt(pipe.ExtractIn());
+        auto write_control = FdControl::Adopt(pipe.ExtractOut());
+        auto& read_dir = read_control->Read();
+        auto& write_dir = write_control->Write();
+        char c = 'x';
+
+        for ([[maybe_unused]] auto _ : state) {
+            {
+                io::impl::Direction::SingleUserGuard guard(write_dir);
+                write_dir.PerformIo(guard, &::write, &c, 1, io::impl::TransferMode::kWhole, Deadline{}, "write");
+            }
+            io::impl::Direction::SingleUserGuard guard(read_dir);
+            read_dir.PerformIo(guard, &::read, &c, 1, io::impl::TransferMode::kWhole, Deadline{}, "read");
+        }
+    });
+}
+BENCHMARK_CAPTURE(fd_control_wait_ready, epoll, "epoll");
+BENCHMARK_CAPTURE(fd_control_wait_ready, io_uring, "io_uring");
+
 USERVER_NAMESPACE_END
@@ -1,11 +1,22 @@
 #include <userver/engine/io/socket.hpp>
 
 #include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -63,6 +74,19 @@ Sockaddr& MemoizeAddr(
 
 [[nodiscard]] ssize_t RecvWrapper(int fd, void* buf, size_t len) { return ::recv(fd, buf, len, 0); }
 
+// The kernel leaves the quick ack mode on its own, so it is rearmed after each
+// receive
+[[nodiscard]] ssize_t RecvQuickAckWrapper(int fd, void* buf, size_t len) {
+    const auto ret = RecvWrapper(fd, buf, len);
+#ifdef TCP_QUICKACK
+    if (ret > 0) {
+        const int enable = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_QUICKACK, &enable, sizeof(enable));
+    }
+#endif
+    return ret;
+}
+
 [[nodiscard]] ssize_t SendWrapper(int fd, const void* buf, size_t len) {
     return ::send(
         fd,
@@ -117,6 +141,56 @@ private:
     const Sockaddr& dest_addr_;
 };
 
+void CheckAddressDomain(AddrDomain socket_domain, const Sockaddr& addr) {
+    if (addr.Domain() != socket_domain) {
+        throw AddrException(fmt::format(
+            "Socket address domain ({}) does not match address domain ({})",
+            static_cast<int>(socket_domain),
+            static_cast<int>(addr.Domain())
+        ));
+    }
+}
+
+constexpr int kSendFlags =
+// MAC_COMPAT: does not support MSG_NOSIGNAL
+#ifdef MSG_NOSIGNAL
+    MSG_NOSIGNAL |
+#endif
+    0;
+
+// Sends at least one of the datagrams, returns the number of sent datagrams
+[[nodiscard]] ssize_t SendDatagramsTo(int fd, const Sockaddr& dest_addr, const IoData* datagrams, std::size_t count) {
+    UASSERT(count > 0);
+#ifdef __linux__
+    constexpr std::size_t kMaxBatchSize = 64;
+    std::array<::iovec, kMaxBatchSize> iovecs{};
+    std::array<::mmsghdr, kMaxBatchSize> headers{};
+
+    count = std::min(count, kMaxBatchSize);
+    for (std::size_t i = 0; i < count; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        iovecs[i].iov_base = const_cast<void*>(datagrams[i].data);
+        iovecs[i].iov_len = datagrams[i].len;
+
+        auto& header = headers[i].msg_hdr;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        header.msg_name = const_cast<sockaddr*>(dest_addr.Data());
+        header.msg_namelen = dest_addr.Size();
+        header.msg_iov = &iovecs[i];
+        header.msg_iovlen = 1;
+    }
+    return ::sendmmsg(fd, headers.data(), count, kSendFlags);
+#else
+    // MAC_COMPAT: no sendmmsg
+    std::size_t sent = 0;
+    for (; sent < count; ++sent) {
+        const auto& datagram = datagrams[sent];
+        if (::sendto(fd, datagram.data, datagram.len, kSendFlags, dest_addr.Data(), dest_addr.Size()) == -1) break;
+    }
+    return sent == 0 ? -1 : static_cast<ssize_t>(sent);
+#endif
+}
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
     UASSERT(data);
     UASSERT(count > 0);
@@ -241,7 +315,14 @@ size_t Socket::RecvSome(void* buf, size_t len, Deadline deadline) {
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
     return dir.PerformIo(
-        guard, &RecvWrapper, buf, len, impl::TransferMode::kOnce, deadline, "RecvSome from ", peername_
+        guard,
+        quick_ack_ ? &RecvQuickAckWrapper : &RecvWrapper,
+        buf,
+        len,
+        impl::TransferMode::kOnce,
+        deadline,
+        "RecvSome from ",
+        peername_
     );
 }
 
@@ -253,7 +334,14 @@ size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
     return dir.PerformIo(
-        guard, &RecvWrapper, buf, len, impl::TransferMode::kWhole, deadline, "RecvAll from ", peername_
+        guard,
+        quick_ack_ ? &RecvQuickAckWrapper : &RecvWrapper,
+        buf,
+        len,
+        impl::TransferMode::kWhole,
+        deadline,
+        "RecvAll from ",
+        peername_
     );
 }
 
@@ -264,7 +352,7 @@ std::optional<size_t> Socket::RecvNoblock(void* buf, size_t len) {
     auto& dir = fd_control_->Read();
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
-    const auto bytesRead = RecvWrapper(fd_control_->Fd(), buf, len);
+    const auto bytesRead = (quick_ack_ ? &RecvQuickAckWrapper : &RecvWrapper)(fd_control_->Fd(), buf, len);
     if (bytesRead >= 0)
         return {bytesRead};
     else if (
@@ -338,6 +426,35 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
     );
 }
 
+size_t Socket::SendFileAll(int file_fd, std::size_t offset, std::size_t len, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendFileAll to closed socket");
+    }
+    if (len == 0) return 0;
+
+    auto file_offset = static_cast<off_t>(offset);
+    const auto send_file = [file_fd, &file_offset](int fd, std::size_t count) -> ssize_t {
+#ifdef __linux__
+        return ::sendfile(fd, file_fd, &file_offset, count);
+#else
+        // MAC_COMPAT: sendfile has a different signature, bounce via a buffer
+        std::array<char, 16 * 1024> buffer;
+        const auto read = ::pread(file_fd, buffer.data(), std::min(count, buffer.size()), file_offset);
+        if (read <= 0) return read;
+        const auto sent = SendWrapper(fd, buffer.data(), read);
+        if (sent > 0) file_offset += sent;
+        return sent;
+#endif
+    };
+
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoWithoutBuffer(
+        guard, send_file, len, impl::TransferMode::kWhole, deadline, "SendFileAll to ", peername_
+    );
+}
+
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len, Deadline deadline) {
     if (!IsValid()) {
         throw IoException("Attempt to RecvSomeFrom via closed socket");
@@ -359,13 +476,7 @@ size_t Socket::SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len,
     if (!IsValid()) {
         throw IoException("Attempt to SendAll to closed socket");
     }
-    if (dest_addr.Domain() != domain_) {
-        throw AddrException(fmt::format(
-            "Socket address domain ({}) does not match address domain ({})",
-            static_cast<int>(domain_),
-            static_cast<int>(dest_addr.Domain())
-        ));
-    }
+    CheckAddressDomain(domain_, dest_addr);
 
     auto& dir = fd_control_->Write();
     dir.ResetReady();
@@ -382,6 +493,127 @@ size_t Socket::SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len,
     );
 }
 
+std::size_t Socket::RecvSomeBatchFrom(DatagramBatch& batch, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to RecvSomeBatchFrom via closed socket");
+    }
+
+    auto& dir = fd_control_->Read();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoWithoutBuffer(
+        guard,
+        [&batch](int fd, std::size_t) { return batch.Receive(fd); },
+        batch.MaxMessages(),
+        impl::TransferMode::kOnce,
+        deadline,
+        "RecvSomeBatchFrom"
+    );
+}
+
+std::size_t
+Socket::SendAllBatchTo(const Sockaddr& dest_addr, const IoData* datagrams, std::size_t count, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendAllBatchTo to closed socket");
+    }
+    CheckAddressDomain(domain_, dest_addr);
+    if (count == 0) return 0;
+
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoWithoutBuffer(
+        guard,
+        [&](int fd, std::size_t left) { return SendDatagramsTo(fd, dest_addr, datagrams + (count - left), left); },
+        count,
+        impl::TransferMode::kWhole,
+        deadline,
+        "SendAllBatchTo to ",
+        dest_addr
+    );
+}
+
+size_t Socket::SendAllSegmentedTo(
+    const Sockaddr& dest_addr,
+    const void* buf,
+    size_t len,
+    size_t segment_size,
+    Deadline deadline
+) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendAllSegmentedTo to closed socket");
+    }
+    CheckAddressDomain(domain_, dest_addr);
+    UINVARIANT(segment_size > 0, "Segment size must be positive");
+    if (len == 0) return 0;
+
+    const auto* data = static_cast<const char*>(buf);
+
+    // A datagram per segment
+    const auto send_separately = [&](int fd, std::size_t left) -> ssize_t {
+        constexpr std::size_t kMaxBatchSize = 64;
+        std::array<IoData, kMaxBatchSize> segments{};
+        std::size_t count = 0;
+        for (auto offset = len - left; offset < len && count < kMaxBatchSize; offset += segment_size) {
+            segments[count++] = {data + offset, std::min(segment_size, len - offset)};
+        }
+
+        const auto sent_segments = SendDatagramsTo(fd, dest_addr, segments.data(), count);
+        if (sent_segments <= 0) return sent_segments;
+        // Only the last segment may be shorter
+        return std::min(static_cast<std::size_t>(sent_segments) * segment_size, left);
+    };
+
+#ifdef UDP_SEGMENT
+    // Limits of the kernel for a single GSO send
+    constexpr std::size_t kMaxSegments = 64;
+    constexpr std::size_t kMaxPayload = 65507;
+    const auto max_chunk = std::min(kMaxSegments, std::max<std::size_t>(kMaxPayload / segment_size, 1)) * segment_size;
+    bool use_gso = segment_size <= std::numeric_limits<std::uint16_t>::max();
+
+    const auto send_segmented = [&](int fd, std::size_t left) -> ssize_t {
+        const auto chunk = std::min(left, max_chunk);
+        if (!use_gso || chunk <= segment_size) return send_separately(fd, left);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        ::iovec iov{const_cast<char*>(data + (len - left)), chunk};
+        alignas(::cmsghdr) std::array<char, CMSG_SPACE(sizeof(std::uint16_t))> control{};
+        ::msghdr header{};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        header.msg_name = const_cast<sockaddr*>(dest_addr.Data());
+        header.msg_namelen = dest_addr.Size();
+        header.msg_iov = &iov;
+        header.msg_iovlen = 1;
+        header.msg_control = control.data();
+        header.msg_controllen = control.size();
+
+        auto* cmsg = CMSG_FIRSTHDR(&header);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+        const auto gso_size = static_cast<std::uint16_t>(segment_size);
+        std::memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+        const auto sent = ::sendmsg(fd, &header, kSendFlags);
+        if (sent == -1 && (errno == EIO || errno == EINVAL || errno == ENOPROTOOPT)) {
+            // The kernel or the network device does not support UDP GSO
+            use_gso = false;
+            return send_separately(fd, left);
+        }
+        return sent;
+    };
+#else
+    const auto& send_segmented = send_separately;
+#endif
+
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoWithoutBuffer(
+        guard, send_segmented, len, impl::TransferMode::kWhole, deadline, "SendAllSegmentedTo to ", dest_addr
+    );
+}
+
 Socket Socket::Accept(Deadline deadline) {
     if (!IsValid()) {
         throw IoException("Attempt to Accept from closed socket");
@@ -480,6 +712,29 @@ int Socket::GetOption(int layer, int optname) const {
     return value;
 }
 
+void Socket::EnableLowLatency(std::chrono::microseconds busy_poll) {
+    UASSERT(IsValid());
+    UINVARIANT(busy_poll.count() >= 0, "Negative busy poll duration");
+#ifdef SO_BUSY_POLL
+    if (busy_poll.count() > 0) {
+        SetOption(SOL_SOCKET, SO_BUSY_POLL, static_cast<int>(busy_poll.count()));
+#ifdef SO_PREFER_BUSY_POLL
+        // Only a hint that requires CAP_NET_ADMIN, failures are ignored
+        const int enable = 1;
+        ::setsockopt(Fd(), SOL_SOCKET, SO_PREFER_BUSY_POLL, &enable, sizeof(enable));
+#endif
+    }
+#endif
+#ifdef TCP_QUICKACK
+    const auto domain = Getsockname().Domain();
+    if (GetOption(SOL_SOCKET, SO_TYPE) == SOCK_STREAM &&
+        (domain == AddrDomain::kInet || domain == AddrDomain::kInet6)) {
+        SetOption(IPPROTO_TCP, TCP_QUICKACK, 1);
+        quick_ack_ = true;
+    }
+#endif
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void Socket::SetOption(int layer, int optname, int optval) {
     UASSERT(IsValid());
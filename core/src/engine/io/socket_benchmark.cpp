@@ -6,6 +6,7 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
+#include <userver/engine/io/datagram_batch.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/mutex.hpp>
@@ -23,10 +24,14 @@ namespace {
 
 constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
 
-}  // namespace
+engine::TaskProcessorPoolsConfig MakePoolsConfig(std::string ev_backend) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_backend = std::move(ev_backend);
+    return config;
+}
 
-void socket_send_all(benchmark::State& state) {
-    engine::RunStandalone([&]() {
+void SocketSendAll(benchmark::State& state, const engine::TaskProcessorPoolsConfig& config) {
+    engine::RunStandalone(1, config, [&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
         internal::net::TcpListener listener;
         auto [server, client] = listener.MakeSocketPair(test_deadline);
@@ -49,8 +54,15 @@ void socket_send_all(benchmark::State& state) {
         task_reader.Get();
     });
 }
+
+}  // namespace
+
+void socket_send_all(benchmark::State& state) { SocketSendAll(state, MakePoolsConfig("epoll")); }
 BENCHMARK(socket_send_all);
 
+void socket_send_all_io_uring(benchmark::State& state) { SocketSendAll(state, MakePoolsConfig("io_uring")); }
+BENCHMARK(socket_send_all_io_uring);
+
 void socket_send_all_v(benchmark::State& state) {
     engine::RunStandalone([&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
@@ -75,6 +87,53 @@ void socket_send_all_v(benchmark::State& state) {
 }
 BENCHMARK(socket_send_all_v);
 
+namespace {
+
+// Round trip of a small request and response, as in RPC
+void SocketPingPong(benchmark::State& state, bool low_latency, bool ev_busy_poll) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_busy_poll = ev_busy_poll;
+    engine::RunStandalone(2, config, [&]() {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+        if (low_latency) {
+            constexpr std::chrono::microseconds kBusyPoll{50};
+            server.EnableLowLatency(kBusyPoll);
+            client.EnableLowLatency(kBusyPoll);
+        }
+        auto task_echo = engine::AsyncNoSpan(
+            [test_deadline](auto&& server) {
+                std::array<char, 16> buf = {};
+                while (server.RecvAll(buf.data(), 4, test_deadline) == 4) {
+                    [[maybe_unused]] const auto sent = server.SendAll(buf.data(), 4, test_deadline);
+                }
+            },
+            std::move(server)
+        );
+
+        std::array<char, 16> buf = {};
+        for ([[maybe_unused]] auto _ : state) {
+            [[maybe_unused]] const auto sent = client.SendAll("ping", 4, test_deadline);
+            benchmark::DoNotOptimize(client.RecvAll(buf.data(), 4, test_deadline));
+        }
+
+        client.Close();
+        task_echo.Get();
+    });
+}
+
+}  // namespace
+
+void socket_ping_pong(benchmark::State& state) { SocketPingPong(state, false, false); }
+BENCHMARK(socket_ping_pong)->UseRealTime();
+
+void socket_ping_pong_low_latency(benchmark::State& state) { SocketPingPong(state, true, false); }
+BENCHMARK(socket_ping_pong_low_latency)->UseRealTime();
+
+void socket_ping_pong_low_latency_busy_poll(benchmark::State& state) { SocketPingPong(state, true, true); }
+BENCHMARK(socket_ping_pong_low_latency_busy_poll)->UseRealTime();
+
 [[maybe_unused]] void socket_send_all_v_range(benchmark::State& state) {
     engine::RunStandalone(2, [&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
@@ -134,4 +193,68 @@ BENCHMARK(socket_send_all_v);
 // TODO(TAXICOMMON-5510) flaky, sometimes throws engine::io::IoTimeout
 // BENCHMARK(socket_send_all_range)->RangeMultiplier(10)->Range(10, 10000);
 
+namespace {
+
+constexpr std::size_t kDatagramsBatchSize = 32;
+
+template <typename SendFunc>
+void SocketDatagrams(benchmark::State& state, bool batched_recv, SendFunc send) {
+    engine::RunStandalone(2, [&]() {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::UdpListener listener;
+        engine::io::Socket client{listener.addr.Domain(), internal::net::UdpListener::kType};
+        std::atomic<bool> reading{true};
+        auto task_reader = engine::AsyncNoSpan([&] {
+            engine::io::DatagramBatch batch{kDatagramsBatchSize, 64};
+            std::array<char, 64> buf = {};
+            while (reading) {
+                if (batched_recv) {
+                    benchmark::DoNotOptimize(listener.socket.RecvSomeBatchFrom(batch, test_deadline));
+                } else {
+                    benchmark::DoNotOptimize(listener.socket.RecvSomeFrom(buf.data(), buf.size(), test_deadline));
+                }
+            }
+        });
+
+        const std::string datagram(16, 'a');
+        for ([[maybe_unused]] auto _ : state) {
+            send(client, listener.addr, datagram, test_deadline);
+        }
+        state.SetItemsProcessed(state.iterations() * kDatagramsBatchSize);
+
+        reading.store(false);
+        // Wake up the reader
+        [[maybe_unused]] const auto sent = client.SendAllTo(listener.addr, "x", 1, test_deadline);
+        task_reader.Get();
+    });
+}
+
+}  // namespace
+
+void socket_datagrams_send_all_to(benchmark::State& state) {
+    SocketDatagrams(state, false, [](auto& client, const auto& addr, const std::string& datagram, Deadline deadline) {
+        for (std::size_t i = 0; i < kDatagramsBatchSize; ++i) {
+            benchmark::DoNotOptimize(client.SendAllTo(addr, datagram.data(), datagram.size(), deadline));
+        }
+    });
+}
+BENCHMARK(socket_datagrams_send_all_to);
+
+void socket_datagrams_batch(benchmark::State& state) {
+    SocketDatagrams(state, true, [](auto& client, const auto& addr, const std::string& datagram, Deadline deadline) {
+        std::array<engine::io::IoData, kDatagramsBatchSize> datagrams;
+        datagrams.fill({datagram.data(), datagram.size()});
+        benchmark::DoNotOptimize(client.SendAllBatchTo(addr, datagrams.data(), datagrams.size(), deadline));
+    });
+}
+BENCHMARK(socket_datagrams_batch);
+
+void socket_datagrams_segmented(benchmark::State& state) {
+    SocketDatagrams(state, true, [](auto& client, const auto& addr, const std::string& datagram, Deadline deadline) {
+        const std::string data(datagram.size() * kDatagramsBatchSize, 'a');
+        benchmark::DoNotOptimize(client.SendAllSegmentedTo(addr, data.data(), data.size(), datagram.size(), deadline));
+    });
+}
+BENCHMARK(socket_datagrams_segmented);
+
 USERVER_NAMESPACE_END
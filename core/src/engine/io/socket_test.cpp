@@ -2,13 +2,17 @@
 
 #include <arpa/inet.h>
 #include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
 #include <array>
 #include <cerrno>
 #include <cstdlib>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -18,6 +22,9 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -193,6 +200,56 @@ UTEST(Socket, SendAllVector) {
     EXPECT_EQ(bytes_sent, bytes_read);
 }
 
+UTEST(Socket, LowLatency) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+    // Non-zero busy polling may require CAP_NET_ADMIN
+    server.EnableLowLatency(std::chrono::microseconds{0});
+    client.EnableLowLatency(std::chrono::microseconds{0});
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(client.SendAll("ping", 4, deadline), 4);
+        std::array<char, 4> buf = {};
+        ASSERT_EQ(server.RecvAll(buf.data(), buf.size(), deadline), 4);
+        EXPECT_EQ(std::string(buf.data(), buf.size()), "ping");
+
+        EXPECT_EQ(server.SendAll("pong", 4, deadline), 4);
+        ASSERT_EQ(client.RecvSome(buf.data(), buf.size(), deadline), 4);
+        EXPECT_EQ(std::string(buf.data(), buf.size()), "pong");
+    }
+}
+
+UTEST(Socket, SendFileAll) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    // Large enough to not fit into the socket buffers at once
+    std::string contents(4 * 1024 * 1024, '\0');
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+        contents[i] = static_cast<char>('a' + i % 26);
+    }
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), contents);
+    const auto fd = fs::blocking::FileDescriptor::Open(file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+    TcpListener listener;
+    auto sockets = listener.MakeSocketPair(deadline);
+
+    constexpr std::size_t kOffset = 7;
+    const auto expected_size = contents.size() - kOffset;
+    auto read_task = engine::AsyncNoSpan([&sockets, &deadline, expected_size] {
+        std::string received(expected_size, '\0');
+        const auto bytes_read = sockets.first.ReadAll(received.data(), received.size(), deadline);
+        received.resize(bytes_read);
+        return received;
+    });
+
+    const auto bytes_sent = sockets.second.SendFileAll(fd.GetNative(), kOffset, expected_size, deadline);
+    EXPECT_EQ(bytes_sent, expected_size);
+    EXPECT_EQ(read_task.Get(), contents.substr(kOffset));
+}
+
 UTEST(Socket, WaitAnyRead) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
     TcpListener listener;
@@ -463,6 +520,55 @@ UTEST_MT(Socket, ConcurrentReadWriteUdp, 2) {
     /// [send self concurrent]
 }
 
+UTEST(Socket, DgramBatch) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(), UdpListener::kType};
+    const std::array<io::IoData, 3> datagrams{{{"first", 5}, {"", 0}, {"third", 5}}};
+    EXPECT_EQ(3, client.SendAllBatchTo(listener.addr, datagrams.data(), datagrams.size(), test_deadline));
+
+    io::DatagramBatch batch{/*max_messages=*/2, /*message_size=*/4};
+    std::vector<std::string> received;
+    while (received.size() < datagrams.size()) {
+        const auto count = listener.socket.RecvSomeBatchFrom(batch, test_deadline);
+        ASSERT_EQ(count, batch.Size());
+        ASSERT_LE(count, 2);
+        for (std::size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(client.Getsockname().Port(), batch.GetSourceAddress(i).Port());
+            EXPECT_EQ(batch.GetData(i).size() == 4, batch.IsTruncated(i));
+            received.emplace_back(batch.GetData(i));
+        }
+    }
+    EXPECT_EQ(received, (std::vector<std::string>{"firs", "", "thir"}));
+}
+
+UTEST(Socket, DgramSegmented) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    UdpListener listener;
+#ifdef UDP_GRO
+    // Let the kernel coalesce the datagrams, they must be split back
+    listener.socket.SetOption(SOL_UDP, UDP_GRO, 1);
+#endif
+    engine::io::Socket client{listener.addr.Domain(), UdpListener::kType};
+
+    std::string data(1050, '\0');
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>('a' + i / 100);
+    EXPECT_EQ(data.size(), client.SendAllSegmentedTo(listener.addr, data.data(), data.size(), 100, test_deadline));
+
+    io::DatagramBatch batch{/*max_messages=*/4, /*message_size=*/64 * 1024};
+    std::vector<std::string> received;
+    while (received.size() < 11) {
+        const auto count = listener.socket.RecvSomeBatchFrom(batch, test_deadline);
+        for (std::size_t i = 0; i < count; ++i) received.emplace_back(batch.GetData(i));
+    }
+
+    ASSERT_EQ(received.size(), 11);
+    for (std::size_t i = 0; i < 10; ++i) EXPECT_EQ(received[i], std::string(100, static_cast<char>('a' + i)));
+    EXPECT_EQ(received.back(), std::string(50, 'k'));
+}
+
 UTEST(Socket, WriteALot) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -0,0 +1,381 @@
+#ifdef __linux__
+
+#include <engine/io/sys_linux/io_uring.hpp>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <userver/engine/single_use_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
+#include <userver/utils/thread_name.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::sys_linux {
+
+namespace {
+
+constexpr unsigned kEntries = 256;
+
+// Larger reads and writes are split, the kernel does not transfer more than
+// ~2GiB at once anyway
+constexpr std::size_t kMaxIoSize = 1 << 30;
+
+// Operations have their address as user_data, so 0 is never used by them
+constexpr std::uint64_t kStopUserData = 0;
+
+constexpr std::uint8_t kRequiredOps[] = {
+    IORING_OP_NOP,
+    IORING_OP_READ,
+    IORING_OP_WRITE,
+    IORING_OP_FSYNC,
+    IORING_OP_OPENAT,
+    IORING_OP_CLOSE,
+    IORING_OP_STATX,
+};
+
+struct Batch final {
+    explicit Batch(std::size_t size) noexcept : remaining(size) {}
+
+    std::atomic<std::size_t> remaining;
+    engine::SingleUseEvent done;
+};
+
+int Setup(unsigned entries, io_uring_params& params) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int Enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int Register(int ring_fd, unsigned opcode, void* arg, unsigned nr_args) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+void* MapRing(int ring_fd, std::size_t size, off_t offset) noexcept {
+    void* const result = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+    return result == MAP_FAILED ? nullptr : result;
+}
+
+template <typename T>
+T* RingPointer(void* ring, std::uint32_t offset) noexcept {
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+bool IsRetryableEnterError(int error) noexcept { return error == EINTR || error == EAGAIN || error == EBUSY; }
+
+void YieldOrSpin() {
+    if (engine::current_task::IsTaskProcessorThread()) {
+        engine::Yield();
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+[[noreturn]] void ThrowError(int result, std::string_view what) {
+    throw std::system_error(std::error_code(-result, std::system_category()), fmt::format("Error while {}", what));
+}
+
+}  // namespace
+
+IoUring::Operation IoUring::MakeRead(int fd, char* buffer, std::size_t size, std::uint64_t offset) noexcept {
+    Operation op;
+    op.opcode = IORING_OP_READ;
+    op.fd = fd;
+    op.addr = reinterpret_cast<std::uint64_t>(buffer);
+    op.len = static_cast<std::uint32_t>(std::min(size, kMaxIoSize));
+    op.offset = offset;
+    return op;
+}
+
+IoUring::Operation IoUring::MakeWrite(int fd, const char* data, std::size_t size, std::uint64_t offset) noexcept {
+    Operation op;
+    op.opcode = IORING_OP_WRITE;
+    op.fd = fd;
+    op.addr = reinterpret_cast<std::uint64_t>(data);
+    op.len = static_cast<std::uint32_t>(std::min(size, kMaxIoSize));
+    op.offset = offset;
+    return op;
+}
+
+IoUring::Operation IoUring::MakeFsync(int fd) noexcept {
+    Operation op;
+    op.opcode = IORING_OP_FSYNC;
+    op.fd = fd;
+    return op;
+}
+
+IoUring::Operation IoUring::MakeOpenAt(const char* path, int flags, mode_t mode) noexcept {
+    Operation op;
+    op.opcode = IORING_OP_OPENAT;
+    op.fd = AT_FDCWD;
+    op.addr = reinterpret_cast<std::uint64_t>(path);
+    op.len = mode;
+    op.op_flags = static_cast<std::uint32_t>(flags);
+    return op;
+}
+
+IoUring::Operation IoUring::MakeClose(int fd) noexcept {
+    Operation op;
+    op.opcode = IORING_OP_CLOSE;
+    op.fd = fd;
+    return op;
+}
+
+IoUring::Operation IoUring::MakeStatx(int fd, const char* path, struct statx& result) noexcept {
+    Operation op;
+    op.opcode = IORING_OP_STATX;
+    op.fd = fd;
+    op.addr = reinterpret_cast<std::uint64_t>(path);
+    op.len = STATX_BASIC_STATS;
+    op.offset = reinterpret_cast<std::uint64_t>(&result);
+    op.op_flags = *path == '\0' ? AT_EMPTY_PATH : 0;
+    return op;
+}
+
+IoUring* IoUring::TryGet() noexcept {
+    if (!engine::current_task::IsTaskProcessorThread()) return nullptr;
+
+    static const std::unique_ptr<IoUring> instance = []() -> std::unique_ptr<IoUring> {
+        try {
+            std::unique_ptr<IoUring> ring{new IoUring()};
+            if (!ring->Init()) return nullptr;
+            return ring;
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to initialize io_uring, falling back to blocking file I/O: " << e;
+            return nullptr;
+        }
+    }();
+    return instance.get();
+}
+
+IoUring::~IoUring() {
+    if (reaper_.joinable()) {
+        Operation stop;
+        stop.opcode = IORING_OP_NOP;
+        SubmitImpl({&stop, 1});
+        reaper_.join();
+    }
+
+    if (sqes_) ::munmap(sqes_, sqes_size_);
+    if (cq_ring_ && cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_size_);
+    if (sq_ring_) ::munmap(sq_ring_, sq_ring_size_);
+    if (ring_fd_ != -1) ::close(ring_fd_);
+}
+
+bool IoUring::Init() {
+    io_uring_params params{};
+    ring_fd_ = Setup(kEntries, params);
+    if (ring_fd_ < 0) {
+        ring_fd_ = -1;
+        LOG_INFO() << "io_uring is not available, falling back to blocking file I/O: " << utils::strerror(errno);
+        return false;
+    }
+    // Completions are not lost if there are more operations in flight than
+    // the completion ring could hold
+    if (!(params.features & IORING_FEAT_NODROP)) {
+        LOG_INFO() << "io_uring is too old, falling back to blocking file I/O";
+        return false;
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ = MapRing(ring_fd_, sq_ring_size_, IORING_OFF_SQ_RING);
+    if (!sq_ring_) return false;
+    cq_ring_ = single_mmap ? sq_ring_ : MapRing(ring_fd_, cq_ring_size_, IORING_OFF_CQ_RING);
+    if (!cq_ring_) return false;
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(MapRing(ring_fd_, sqes_size_, IORING_OFF_SQES));
+    if (!sqes_) return false;
+
+    sq_head_ = RingPointer<unsigned>(sq_ring_, params.sq_off.head);
+    sq_tail_ = RingPointer<unsigned>(sq_ring_, params.sq_off.tail);
+    sq_mask_ = *RingPointer<unsigned>(sq_ring_, params.sq_off.ring_mask);
+    sq_entries_ = params.sq_entries;
+    sq_array_ = RingPointer<unsigned>(sq_ring_, params.sq_off.array);
+
+    cq_head_ = RingPointer<unsigned>(cq_ring_, params.cq_off.head);
+    cq_tail_ = RingPointer<unsigned>(cq_ring_, params.cq_off.tail);
+    cq_mask_ = *RingPointer<unsigned>(cq_ring_, params.cq_off.ring_mask);
+    cqes_ = RingPointer<io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+
+    if (!IsSupported()) {
+        LOG_INFO() << "io_uring does not support the required operations, falling back to blocking file I/O";
+        return false;
+    }
+
+    reaper_ = std::thread([this] {
+        utils::SetCurrentThreadName("io-uring");
+        ReapCompletions();
+    });
+    return true;
+}
+
+bool IoUring::IsSupported() const {
+    constexpr unsigned kProbeOps = 256;
+    constexpr std::size_t kProbeSize = sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op);
+    // The kernel requires the probe to be zeroed
+    const auto storage = std::make_unique<std::uint64_t[]>((kProbeSize + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+    auto* probe = reinterpret_cast<io_uring_probe*>(storage.get());
+
+    if (Register(ring_fd_, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) return false;
+
+    return std::all_of(std::begin(kRequiredOps), std::end(kRequiredOps), [probe](std::uint8_t op) {
+        return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+    });
+}
+
+void IoUring::Submit(utils::span<Operation> operations) {
+    if (operations.empty()) return;
+
+    Batch batch{operations.size()};
+    for (auto& op : operations) op.batch = &batch;
+
+    SubmitImpl(operations);
+    batch.done.WaitNonCancellable();
+}
+
+void IoUring::SubmitImpl(utils::span<Operation> operations) {
+    std::size_t next = 0;
+    unsigned last_tail = 0;
+
+    while (true) {
+        {
+            const std::lock_guard lock{submit_mutex_};
+
+            const auto head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            auto tail = *sq_tail_;
+            while (next < operations.size() && tail - head < sq_entries_) {
+                auto& op = operations[next++];
+                const auto index = tail++ & sq_mask_;
+
+                auto& sqe = sqes_[index];
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = op.opcode;
+                sqe.fd = op.fd;
+                sqe.addr = op.addr;
+                sqe.len = op.len;
+                sqe.off = op.offset;
+                // open_flags, statx_flags, fsync_flags and rw_flags share the storage
+                sqe.open_flags = op.op_flags;
+                sqe.user_data = op.batch ? reinterpret_cast<std::uint64_t>(&op) : kStopUserData;
+
+                sq_array_[index] = index;
+            }
+            __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+            last_tail = tail;
+
+            // Also submits the operations left by other callers on EAGAIN
+            if (Enter(ring_fd_, tail - head, 0, 0) < 0 && !IsRetryableEnterError(errno)) {
+                utils::impl::AbortWithStacktrace(fmt::format("io_uring_enter failed: {}", utils::strerror(errno)));
+            }
+        }
+
+        const auto consumed = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (next == operations.size() && static_cast<int>(consumed - last_tail) >= 0) return;
+
+        // The rings are full, wait for the kernel to make progress
+        YieldOrSpin();
+    }
+}
+
+void IoUring::ReapCompletions() {
+    while (true) {
+        if (Enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 && !IsRetryableEnterError(errno)) {
+            utils::impl::AbortWithStacktrace(fmt::format("io_uring_enter failed: {}", utils::strerror(errno)));
+        }
+
+        bool stop = false;
+        auto head = *cq_head_;
+        const auto tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const auto& cqe = cqes_[head & cq_mask_];
+            if (cqe.user_data == kStopUserData) {
+                stop = true;
+                continue;
+            }
+
+            auto& op = *reinterpret_cast<Operation*>(cqe.user_data);
+            op.result = cqe.res;
+            // The waiter may destroy the operations right after the Send()
+            auto& batch = *static_cast<Batch*>(op.batch);
+            if (batch.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                batch.done.Send();
+            }
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+        if (stop) return;
+    }
+}
+
+std::size_t IoUring::Read(int fd, char* buffer, std::size_t size, std::uint64_t offset) {
+    auto op = MakeRead(fd, buffer, size, offset);
+    Submit({&op, 1});
+    if (op.result < 0) ThrowError(op.result, "reading from file");
+    return static_cast<std::size_t>(op.result);
+}
+
+void IoUring::Write(int fd, std::string_view data, std::uint64_t offset) {
+    while (!data.empty()) {
+        auto op = MakeWrite(fd, data.data(), data.size(), offset);
+        Submit({&op, 1});
+        if (op.result < 0) ThrowError(op.result, "writing to file");
+        if (op.result == 0) ThrowError(-EIO, "writing to file");
+
+        data.remove_prefix(op.result);
+        offset += op.result;
+    }
+}
+
+void IoUring::Fsync(int fd) {
+    auto op = MakeFsync(fd);
+    Submit({&op, 1});
+    if (op.result < 0) ThrowError(op.result, "calling fsync");
+}
+
+int IoUring::OpenAt(const char* path, int flags, mode_t mode) {
+    auto op = MakeOpenAt(path, flags, mode);
+    Submit({&op, 1});
+    if (op.result < 0) ThrowError(op.result, fmt::format("opening file '{}'", path));
+    return op.result;
+}
+
+void IoUring::Close(int fd) {
+    auto op = MakeClose(fd);
+    Submit({&op, 1});
+    if (op.result < 0) ThrowError(op.result, "closing file");
+}
+
+int IoUring::Statx(int fd, const char* path, struct statx& result) {
+    auto op = MakeStatx(fd, path, result);
+    Submit({&op, 1});
+    return op.result < 0 ? -op.result : 0;
+}
+
+}  // namespace engine::io::sys_linux
+
+USERVER_NAMESPACE_END
+
+#endif  // __linux__
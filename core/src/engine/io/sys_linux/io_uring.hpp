@@ -0,0 +1,134 @@
+#pragma once
+
+#ifdef __linux__
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+#include <userver/utils/span.hpp>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::sys_linux {
+
+/// @brief Asynchronous file I/O on top of the Linux io_uring.
+///
+/// The operations suspend the calling coroutine instead of blocking the
+/// thread, so file I/O does not need a hop to a blocking task processor.
+/// Operations passed to a single Submit() call are submitted to the kernel
+/// with a single syscall. Completions are reaped by a background thread that
+/// wakes up the waiting coroutines.
+///
+/// The instance is process-wide and is created on first use.
+class IoUring final {
+public:
+    /// A single operation, see the Make* factories below
+    struct Operation final {
+        std::uint8_t opcode{0};
+        int fd{-1};
+        std::uint64_t addr{0};
+        std::uint32_t len{0};
+        std::uint64_t offset{0};
+        std::uint32_t op_flags{0};
+
+        /// The return value of the operation or -errno, set by Submit()
+        int result{0};
+
+    private:
+        friend class IoUring;
+        void* batch{nullptr};
+    };
+
+    static Operation MakeRead(int fd, char* buffer, std::size_t size, std::uint64_t offset) noexcept;
+    static Operation MakeWrite(int fd, const char* data, std::size_t size, std::uint64_t offset) noexcept;
+    static Operation MakeFsync(int fd) noexcept;
+    static Operation MakeOpenAt(const char* path, int flags, mode_t mode) noexcept;
+    static Operation MakeClose(int fd) noexcept;
+    /// `path` is relative to `fd`, pass an empty path to query the `fd`
+    static Operation MakeStatx(int fd, const char* path, struct statx& result) noexcept;
+
+    /// @returns the instance, or nullptr if io_uring or some of the operations
+    /// are not supported by the kernel or are forbidden, or if called outside
+    /// of a coroutine.
+    static IoUring* TryGet() noexcept;
+
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    /// Submits the operations and waits for all of them to complete.
+    /// @note The wait is not cancellable, as the kernel uses the buffers of
+    /// the operations until the completion.
+    void Submit(utils::span<Operation> operations);
+
+    /// Reads up to `size` bytes at `offset`, the same as pread(2)
+    /// @throws std::system_error
+    std::size_t Read(int fd, char* buffer, std::size_t size, std::uint64_t offset);
+
+    /// Writes all the `data` at `offset`
+    /// @throws std::system_error
+    void Write(int fd, std::string_view data, std::uint64_t offset);
+
+    /// @throws std::system_error
+    void Fsync(int fd);
+
+    /// @returns the file descriptor
+    /// @throws std::system_error
+    int OpenAt(const char* path, int flags, mode_t mode);
+
+    /// @throws std::system_error
+    void Close(int fd);
+
+    /// @returns 0 or the errno
+    int Statx(int fd, const char* path, struct statx& result);
+
+private:
+    IoUring() = default;
+
+    bool Init();
+    bool IsSupported() const;
+
+    // Puts the operations into the submission ring, does not wait for them
+    void SubmitImpl(utils::span<Operation> operations);
+    void ReapCompletions();
+
+    int ring_fd_{-1};
+
+    void* sq_ring_{nullptr};
+    std::size_t sq_ring_size_{0};
+    void* cq_ring_{nullptr};
+    std::size_t cq_ring_size_{0};
+    io_uring_sqe* sqes_{nullptr};
+    std::size_t sqes_size_{0};
+
+    unsigned* sq_head_{nullptr};
+    unsigned* sq_tail_{nullptr};
+    unsigned sq_mask_{0};
+    unsigned sq_entries_{0};
+    unsigned* sq_array_{nullptr};
+
+    unsigned* cq_head_{nullptr};
+    unsigned* cq_tail_{nullptr};
+    unsigned cq_mask_{0};
+    io_uring_cqe* cqes_{nullptr};
+
+    std::mutex submit_mutex_;
+    std::thread reaper_;
+};
+
+}  // namespace engine::io::sys_linux
+
+USERVER_NAMESPACE_END
+
+#endif  // __linux__
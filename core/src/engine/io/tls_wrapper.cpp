@@ -1,21 +1,42 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
 #include <boost/stacktrace/stacktrace.hpp>
+#include <algorithm>
+#include <array>
 #include <exception>
 #include <memory>
+#include <string_view>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
 
 #include <userver/crypto/openssl.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/strerror.hpp>
 
 #include <crypto/helpers.hpp>
 #include <engine/io/fd_control.hpp>
 
+// OpenSSL 3 passes the kTLS keys to the BIO, so our socket BIO may set them up
+#if defined(__linux__) && OPENSSL_VERSION_NUMBER >= 0x030000000L && !defined(OPENSSL_NO_KTLS)
+#define USERVER_IMPL_KTLS_SUPPORTED
+#include <linux/tls.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
@@ -60,15 +81,107 @@ struct SocketBioData {
     Socket socket;
     Deadline current_deadline;
     std::exception_ptr last_exception;
+    // Non-zero if the next write is a kTLS record of that type,
+    // e.g. an alert or a post-handshake message
+    int ktls_record_type{0};
+    bool ktls_tx{false};
 };
 
+#ifdef USERVER_IMPL_KTLS_SUPPORTED
+// Internal OpenSSL BIO controls, see include/internal/bio.h of OpenSSL
+constexpr int kBioCtrlSetKtls = 72;
+constexpr int kBioCtrlSetKtlsTxSendCtrlMsg = 74;
+constexpr int kBioCtrlClearKtlsTxCtrlMsg = 75;
+
+#ifndef SOL_TLS
+constexpr int SOL_TLS = 282;
+#endif
+#ifndef TCP_ULP
+constexpr int TCP_ULP = 31;
+#endif
+
+std::size_t GetKtlsCryptoInfoSize(const tls_crypto_info& info) noexcept {
+    switch (info.cipher_type) {
+        case TLS_CIPHER_AES_GCM_128:
+            return sizeof(tls12_crypto_info_aes_gcm_128);
+        case TLS_CIPHER_AES_GCM_256:
+            return sizeof(tls12_crypto_info_aes_gcm_256);
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+        case TLS_CIPHER_CHACHA20_POLY1305:
+            return sizeof(tls12_crypto_info_chacha20_poly1305);
+#endif
+        default:
+            return 0;
+    }
+}
+
+// OpenSSL falls back to the userspace encryption if this fails
+long EnableKtlsTx(SocketBioData& bio_data, const void* crypto_info) noexcept {
+    const auto size = GetKtlsCryptoInfoSize(*static_cast<const tls_crypto_info*>(crypto_info));
+    if (size == 0) return 0;
+
+    const int fd = bio_data.socket.Fd();
+    if (::setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+        LOG_LIMITED_INFO() << "Kernel TLS is not available: " << utils::strerror(errno);
+        return 0;
+    }
+    if (::setsockopt(fd, SOL_TLS, TLS_TX, crypto_info, size) != 0) {
+        LOG_LIMITED_INFO() << "Kernel TLS does not support the cipher: " << utils::strerror(errno);
+        return 0;
+    }
+
+    bio_data.ktls_tx = true;
+    return 1;
+}
+
+// Records other than the application data are marked with their type
+std::size_t SendKtlsRecord(SocketBioData& bio_data, const char* data, std::size_t len) {
+    std::array<char, CMSG_SPACE(sizeof(unsigned char))> control{};
+    iovec iov{const_cast<char*>(data), len};  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.data();
+    msg.msg_controllen = control.size();
+
+    auto* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+    *CMSG_DATA(cmsg) = static_cast<unsigned char>(bio_data.ktls_record_type);
+    msg.msg_controllen = cmsg->cmsg_len;
+
+    while (true) {
+        const auto sent = ::sendmsg(bio_data.socket.Fd(), &msg, MSG_NOSIGNAL);
+        if (sent >= 0) return sent;
+
+        if (errno == EINTR) continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            throw IoSystemError(errno, "sendmsg of a kernel TLS record");
+        }
+        if (!bio_data.socket.WaitWriteable(bio_data.current_deadline)) {
+            if (current_task::ShouldCancel()) throw IoCancelled();
+            throw IoTimeout();
+        }
+    }
+}
+#endif
+
 int SocketBioWriteEx(BIO* bio, const char* data, size_t len, size_t* bytes_written) noexcept {
     auto* bio_data = static_cast<SocketBioData*>(BIO_get_data(bio));
     UASSERT(bio_data);
     UASSERT(bytes_written);
 
     try {
-        *bytes_written = bio_data->socket.SendAll(data, len, bio_data->current_deadline);
+#ifdef USERVER_IMPL_KTLS_SUPPORTED
+        if (bio_data->ktls_record_type != 0) {
+            *bytes_written = SendKtlsRecord(*bio_data, data, len);
+        } else
+#endif
+        {
+            *bytes_written = bio_data->socket.SendAll(data, len, bio_data->current_deadline);
+        }
         BIO_clear_retry_flags(bio);
         if (bio_data->last_exception) bio_data->last_exception = {};
         if (*bytes_written) return 1;  // success
@@ -101,11 +214,32 @@ int SocketBioReadEx(BIO* bio, char* data, size_t len, size_t* bytes_read) noexce
     return 0;
 }
 
-long SocketBioControl(BIO*, int cmd, long, void*) noexcept {
+long SocketBioControl([[maybe_unused]] BIO* bio, int cmd, [[maybe_unused]] long larg, [[maybe_unused]] void* parg)
+    noexcept {
     if (cmd == BIO_CTRL_FLUSH) {
         // ignore for Socket
         return 1;
     }
+
+#ifdef USERVER_IMPL_KTLS_SUPPORTED
+    auto* bio_data = static_cast<SocketBioData*>(BIO_get_data(bio));
+    UASSERT(bio_data);
+    switch (cmd) {
+        case kBioCtrlSetKtls:
+            // larg is zero for the receive direction that is left to OpenSSL
+            return larg ? EnableKtlsTx(*bio_data, parg) : 0;
+        case BIO_CTRL_GET_KTLS_SEND:
+            return bio_data->ktls_tx ? 1 : 0;
+        case kBioCtrlSetKtlsTxSendCtrlMsg:
+            bio_data->ktls_record_type = static_cast<int>(larg);
+            return 1;
+        case kBioCtrlClearKtlsTxCtrlMsg:
+            bio_data->ktls_record_type = 0;
+            return 1;
+        default:
+            break;
+    }
+#endif
     return 0;
 }
 
@@ -249,6 +383,119 @@ void AddCertAuthorities(SslCtx& ctx, const std::vector<crypto::Certificate>& cer
     }
 }
 
+constexpr std::size_t kTicketKeyNameSize = 16;
+constexpr std::size_t kTicketKeySecretSize = 32;
+constexpr std::size_t kTicketKeySize = kTicketKeyNameSize + 2 * kTicketKeySecretSize;
+
+// Same layout as in nginx: name, HMAC secret, AES key
+struct TicketKeyView final {
+    explicit TicketKeyView(std::string_view key)
+        : name(key.substr(0, kTicketKeyNameSize)),
+          hmac_secret(key.substr(kTicketKeyNameSize, kTicketKeySecretSize)),
+          aes_key(key.substr(kTicketKeyNameSize + kTicketKeySecretSize)) {}
+
+    const auto* AesKey() const noexcept { return reinterpret_cast<const unsigned char*>(aes_key.data()); }
+
+    std::string_view name;
+    std::string_view hmac_secret;
+    std::string_view aes_key;
+};
+
+int GetTicketKeysIndex() {
+    static const int kIndex = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return kIndex;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+using TicketMacCtx = EVP_MAC_CTX;
+
+bool InitTicketMac(TicketMacCtx* mac_ctx, const TicketKeyView& key) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    auto* secret = const_cast<char*>(key.hmac_secret.data());
+    std::array<char, 7> digest{"SHA256"};
+    const std::array<OSSL_PARAM, 3> params{
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, secret, key.hmac_secret.size()),
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest.data(), 0),
+        OSSL_PARAM_construct_end(),
+    };
+    return 1 == EVP_MAC_CTX_set_params(mac_ctx, params.data());
+}
+#else
+using TicketMacCtx = HMAC_CTX;
+
+bool InitTicketMac(TicketMacCtx* mac_ctx, const TicketKeyView& key) noexcept {
+    return 1 == HMAC_Init_ex(mac_ctx, key.hmac_secret.data(), key.hmac_secret.size(), EVP_sha256(), nullptr);
+}
+#endif
+
+// Returns 1 if the ticket is processed, 2 if it should be renewed with the
+// current key and 0 if there is no key for the ticket
+int SessionTicketCallback(
+    SSL* ssl,
+    unsigned char* key_name,
+    unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx,
+    TicketMacCtx* mac_ctx,
+    int encrypt
+) noexcept {
+    const auto* keys = static_cast<const std::vector<std::string>*>(SSL_get_ex_data(ssl, GetTicketKeysIndex()));
+    if (!keys || keys->empty()) return 0;
+
+    if (encrypt) {
+        const TicketKeyView key{keys->front()};
+        std::copy(key.name.begin(), key.name.end(), key_name);
+        const auto iv_size = EVP_CIPHER_iv_length(EVP_aes_256_cbc());
+        if (1 != RAND_bytes(iv, iv_size)) return -1;
+        if (1 != EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.AesKey(), iv)) return -1;
+        return InitTicketMac(mac_ctx, key) ? 1 : -1;
+    }
+
+    const std::string_view name{reinterpret_cast<const char*>(key_name), kTicketKeyNameSize};
+    for (std::size_t i = 0; i < keys->size(); ++i) {
+        const TicketKeyView key{(*keys)[i]};
+        if (key.name != name) continue;
+
+        if (!InitTicketMac(mac_ctx, key)) return -1;
+        if (1 != EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.AesKey(), iv)) return -1;
+        return i == 0 ? 1 : 2;
+    }
+    return 0;
+}
+
+void SetUpSessionTickets(SslCtx& ctx, const std::vector<std::string>& keys) {
+    if (keys.empty()) {
+        // Tickets of the per-connection SSL_CTX could not be decrypted
+        // by other connections anyway
+        SSL_CTX_set_options(ctx.get(), SSL_OP_NO_TICKET);
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+        SSL_CTX_set_num_tickets(ctx.get(), 0);
+#endif
+        return;
+    }
+
+    for (const auto& key : keys) {
+        if (key.size() != kTicketKeySize) {
+            throw TlsException(
+                fmt::format("Invalid TLS session ticket key size {}, expected {}", key.size(), kTicketKeySize)
+            );
+        }
+    }
+
+    // Resumption requires a session id context if the client certs are verified
+    static constexpr std::string_view kSessionIdContext = "userver";
+    if (1 != SSL_CTX_set_session_id_context(
+                 ctx.get(), reinterpret_cast<const unsigned char*>(kSessionIdContext.data()), kSessionIdContext.size()
+             )) {
+        throw TlsException(crypto::FormatSslError("Failed to set up server TLS wrapper: SSL_CTX_set_session_id_context"));
+    }
+    SSL_CTX_set_session_cache_mode(ctx.get(), SSL_SESS_CACHE_OFF);
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+    SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx.get(), &SessionTicketCallback);
+#else
+    SSL_CTX_set_tlsext_ticket_key_cb(ctx.get(), &SessionTicketCallback);
+#endif
+}
+
 }  // namespace
 
 class TlsWrapper::ReadContextAccessor final : public engine::impl::ContextAccessor {
@@ -502,6 +749,17 @@ TlsWrapper TlsWrapper::StartTlsServer(
     const crypto::PrivateKey& key,
     Deadline deadline,
     const std::vector<crypto::Certificate>& extra_cert_authorities
+) {
+    return StartTlsServer(std::move(socket), cert, key, deadline, extra_cert_authorities, TlsServerSettings{});
+}
+
+TlsWrapper TlsWrapper::StartTlsServer(
+    Socket&& socket,
+    const crypto::Certificate& cert,
+    const crypto::PrivateKey& key,
+    Deadline deadline,
+    const std::vector<crypto::Certificate>& extra_cert_authorities,
+    const TlsServerSettings& settings
 ) {
     auto ssl_ctx = MakeSslCtx();
 
@@ -521,18 +779,33 @@ TlsWrapper TlsWrapper::StartTlsServer(
         throw TlsException(crypto::FormatSslError("Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
     }
 
+    SetUpSessionTickets(ssl_ctx, settings.session_ticket_keys);
+#ifdef USERVER_IMPL_KTLS_SUPPORTED
+    if (settings.kernel_tls_tx) {
+        SSL_CTX_set_options(ssl_ctx.get(), SSL_OP_ENABLE_KTLS);
+    }
+#endif
+
     TlsWrapper wrapper{std::move(socket)};
     wrapper.impl_->SetUp(std::move(ssl_ctx));
     wrapper.impl_->bio_data.current_deadline = deadline;
 
-    auto ret = SSL_accept(wrapper.impl_->ssl.get());
+    // Tickets are sent and received only during the handshake
+    auto* ssl = wrapper.impl_->ssl.get();
+    if (!settings.session_ticket_keys.empty()) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        SSL_set_ex_data(ssl, GetTicketKeysIndex(), const_cast<std::vector<std::string>*>(&settings.session_ticket_keys));
+    }
+    const utils::FastScopeGuard keys_guard{[ssl]() noexcept { SSL_set_ex_data(ssl, GetTicketKeysIndex(), nullptr); }};
+
+    auto ret = SSL_accept(ssl);
     if (1 != ret) {
         if (wrapper.impl_->bio_data.last_exception) {
             std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
         }
 
         throw TlsException(crypto::FormatSslError(
-            fmt::format("Failed to set up server TLS wrapper ({})", SSL_get_error(wrapper.impl_->ssl.get(), ret))
+            fmt::format("Failed to set up server TLS wrapper ({})", SSL_get_error(ssl, ret))
         ));
     }
 
@@ -601,6 +874,17 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
     );
 }
 
+bool TlsWrapper::IsKernelTlsTxEnabled() const noexcept { return impl_->ssl && impl_->bio_data.ktls_tx; }
+
+size_t TlsWrapper::SendFileAll(int file_fd, std::size_t offset, std::size_t len, Deadline deadline) {
+    impl_->CheckAlive();
+    if (!IsKernelTlsTxEnabled()) {
+        throw TlsException("SendFileAll requires kernel TLS");
+    }
+    // The kernel encrypts everything written to the socket
+    return impl_->bio_data.socket.SendFileAll(file_fd, offset, len, deadline);
+}
+
 [[nodiscard]] size_t TlsWrapper::WriteAll(std::initializer_list<IoData> list, Deadline deadline) {
     static constexpr std::size_t kBufSize = 4'096;
     std::byte buf[kBufSize];
@@ -645,6 +929,10 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
 }
 
 Socket TlsWrapper::StopTls(Deadline deadline) {
+    if (impl_->bio_data.ktls_tx) {
+        // The kernel would keep encrypting the data written to the socket
+        throw TlsException("StopTls is not supported with kernel TLS");
+    }
     if (impl_->ssl) {
         impl_->is_in_shutdown = true;
         impl_->bio_data.current_deadline = deadline;
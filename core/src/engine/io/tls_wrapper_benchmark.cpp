@@ -175,4 +175,55 @@ BENCHMARK(tls_write_all_buffered)->RangeMultiplier(2)->Range(1 << 6, 1 << 12)->U
 
 BENCHMARK(tls_write_all_default)->RangeMultiplier(2)->Range(1 << 6, 1 << 12)->Unit(benchmark::kNanosecond);
 
+void tls_server_write(benchmark::State& state, bool kernel_tls_tx) {
+    engine::RunStandalone(2, [&]() {
+        const auto deadline = Deadline::FromDuration(kDeadlineMaxTime);
+
+        TcpListener tcp_listener;
+        auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+        std::atomic<bool> reading{true};
+        auto client_task = engine::AsyncNoSpan(
+            [&reading, deadline](auto&& client) {
+                auto tls_client = io::TlsWrapper::StartTlsClient(std::forward<decltype(client)>(client), {}, deadline);
+
+                std::array<std::byte, 16'384> buf{};
+                while (tls_client.RecvSome(buf.data(), buf.size(), deadline) > 0 && reading) {
+                    /* receiving msgs */
+                }
+            },
+            std::move(client)
+        );
+
+        io::TlsServerSettings settings;
+        settings.kernel_tls_tx = kernel_tls_tx;
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::move(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key),
+            deadline,
+            {},
+            settings
+        );
+        if (kernel_tls_tx && !tls_server.IsKernelTlsTxEnabled()) {
+            state.SkipWithError("Kernel TLS is not supported");
+        }
+
+        const std::string payload(state.range(0), 'x');
+        for ([[maybe_unused]] auto _ : state) {
+            auto send_bytes = tls_server.SendAll(payload.data(), payload.size(), deadline);
+            benchmark::DoNotOptimize(send_bytes);
+        }
+        state.SetBytesProcessed(state.iterations() * payload.size());
+
+        reading.store(false);
+        // Wakes up the client to see the flag
+        static_cast<void>(tls_server.SendAll("x", 1, deadline));
+        client_task.Get();
+    });
+}
+
+BENCHMARK_CAPTURE(tls_server_write, userspace, false)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK_CAPTURE(tls_server_write, kernel_tls, true)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+
 USERVER_NAMESPACE_END
@@ -467,6 +467,66 @@ UTEST(TlsWrapper, Cancel) {
     server_task.SyncCancel();
 }
 
+UTEST_MT(TlsWrapper, ServerSettings, 2) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+    auto server_task = engine::AsyncNoSpan(
+        [test_deadline](auto&& server) {
+            io::TlsServerSettings settings;
+            settings.session_ticket_keys = {std::string(80, 'a'), std::string(80, 'b')};
+            settings.kernel_tls_tx = true;
+
+            auto tls_server = io::TlsWrapper::StartTlsServer(
+                std::forward<decltype(server)>(server),
+                crypto::Certificate::LoadFromString(cert),
+                crypto::PrivateKey::LoadFromString(key),
+                test_deadline,
+                {},
+                settings
+            );
+            // Whether or not the kernel supports TLS, the data is the same
+            const std::string data(100'000, 'x');
+            EXPECT_EQ(data.size(), tls_server.SendAll(data.data(), data.size(), test_deadline));
+            char c = 0;
+            EXPECT_EQ(1, tls_server.RecvSome(&c, 1, test_deadline));
+            EXPECT_EQ('2', c);
+        },
+        std::move(server)
+    );
+
+    auto tls_client = io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+    std::string data(100'000, '\0');
+    EXPECT_EQ(data.size(), tls_client.RecvAll(data.data(), data.size(), test_deadline));
+    EXPECT_EQ(data, std::string(100'000, 'x'));
+    EXPECT_EQ(1, tls_client.SendAll("2", 1, test_deadline));
+
+    server_task.Get();
+}
+
+UTEST_MT(TlsWrapper, InvalidSessionTicketKey, 2) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+    io::TlsServerSettings settings;
+    settings.session_ticket_keys = {"short"};
+    UEXPECT_THROW(
+        static_cast<void>(io::TlsWrapper::StartTlsServer(
+            std::move(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key),
+            test_deadline,
+            {},
+            settings
+        )),
+        io::TlsException
+    );
+}
+
 UTEST_MT(TlsWrapper, CertKeyMismatch, 2) {
     const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -6,7 +6,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
-class Mutex::Impl final : public impl::MutexImpl<impl::WaitList> {};
+class Mutex::Impl final : public impl::MutexImpl<impl::FlatCombiningWaitList> {};
 
 Mutex::Mutex() = default;
 
@@ -121,6 +121,34 @@ void generic_contention_with_payload(benchmark::State& state) {
         benchmark::Counter(total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
 }
 
+template <typename Mutex>
+void generic_contention_short_section(benchmark::State& state) {
+    std::atomic<std::uint64_t> lock_unlock_count{0};
+    concurrent::impl::InterferenceShield<Mutex> m;
+    // Only a single cache line is touched under the lock, so the lock is
+    // usually released before a context switch could complete
+    std::uint64_t protected_counter = 0;
+
+    RunParallelBenchmark(state, [&](auto& range) {
+        std::uint64_t local_lock_unlock_count = 0;
+
+        for ([[maybe_unused]] auto _ : range) {
+            m->lock();
+            ++protected_counter;
+            benchmark::DoNotOptimize(protected_counter);
+            m->unlock();
+            ++local_lock_unlock_count;
+        }
+
+        lock_unlock_count += local_lock_unlock_count;
+    });
+
+    const auto total_lock_unlock_count = static_cast<double>(lock_unlock_count.load());
+    state.counters["locks"] = benchmark::Counter(total_lock_unlock_count, benchmark::Counter::kIsRate);
+    state.counters["locks-per-thread"] =
+        benchmark::Counter(total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
+}
+
 //////// Benchmarks
 
 // Note: We intentionally do not run std::* benchmarks from RunStandalone to
@@ -169,6 +197,20 @@ void single_waiting_task_mutex_contention_with_payload(benchmark::State& state)
     });
 }
 
+void mutex_coro_contention_short_section(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] { generic_contention_short_section<engine::Mutex>(state); });
+}
+
+void mutex_std_contention_short_section(benchmark::State& state) {
+    generic_contention_short_section<std::mutex>(state);
+}
+
+void single_waiting_task_mutex_contention_short_section(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        generic_contention_short_section<engine::SingleWaitingTaskMutex>(state);
+    });
+}
+
 }  // namespace
 
 BENCHMARK(mutex_coro_lock);
@@ -187,4 +229,8 @@ BENCHMARK(mutex_coro_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention_with_payload)->Range(1, 2);
 
+BENCHMARK(mutex_coro_contention_short_section)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(mutex_std_contention_short_section)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(single_waiting_task_mutex_contention_short_section)->Range(1, 2);
+
 USERVER_NAMESPACE_END
@@ -5,7 +5,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 
-#include <engine/impl/wait_list.hpp>
+#include <engine/impl/flat_combining_wait_list.hpp>
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,10 +19,10 @@ public:
         CancellableSemaphore& sem,
         CancellableSemaphore::Counter count
     ) noexcept
-        : sem_(sem), current_(current), waiter_token_(*sem_.lock_waiters_), count_(count) {}
+        : sem_(sem), waiter_token_(*sem_.lock_waiters_), waiter_(current), count_(count) {}
 
     impl::EarlyWakeup SetupWakeups() override {
-        impl::WaitList::Lock lock(*sem_.lock_waiters_);
+        woken_up_ = false;
         status_ = sem_.DoTryLock(count_);
         if (status_ != TryLockStatus::kTransientFailure) {
             return impl::EarlyWakeup{status_ == TryLockStatus::kSuccess};
@@ -30,25 +30,30 @@ public:
         if (sem_.UsedApprox() <= sem_.GetCapacity() - count_) {
             return impl::EarlyWakeup{true};
         }
-        // A race is not possible here, because check + Append is performed under
-        // WaitList::Lock, and notification also takes WaitList::Lock.
-        sem_.lock_waiters_->Append(lock, &current_);
+        // There is no lock to make check + Append atomic, so the check is
+        // repeated after Append. Notifiers release the locks before waking up.
+        sem_.lock_waiters_->Append(waiter_);
+        if (sem_.UsedApprox() <= sem_.GetCapacity() - count_) {
+            woken_up_ = sem_.lock_waiters_->Remove(waiter_);
+            return impl::EarlyWakeup{true};
+        }
         return impl::EarlyWakeup{false};
     }
 
-    void DisableWakeups() noexcept override {
-        impl::WaitList::Lock lock(*sem_.lock_waiters_);
-        sem_.lock_waiters_->Remove(lock, current_);
-    }
+    void DisableWakeups() noexcept override { woken_up_ = sem_.lock_waiters_->Remove(waiter_); }
 
     TryLockStatus GetTryLockStatus() const noexcept { return status_; }
 
+    // Whether the last wakeup came from unlock_shared_count() or SetCapacity()
+    bool IsWokenUp() const noexcept { return woken_up_; }
+
 private:
     CancellableSemaphore& sem_;
-    impl::TaskContext& current_;
-    const impl::WaitList::WaitersScopeCounter waiter_token_;
+    const impl::FlatCombiningWaitList::WaitersScopeCounter waiter_token_;
+    impl::FlatCombiningWaitList::Waiter waiter_;
     const CancellableSemaphore::Counter count_;
     TryLockStatus status_{TryLockStatus::kTransientFailure};
+    bool woken_up_{false};
 };
 
 CancellableSemaphore::CancellableSemaphore(Counter capacity) : acquired_locks_(0), capacity_(capacity) {}
@@ -69,8 +74,7 @@ void CancellableSemaphore::SetCapacity(Counter capacity) {
     capacity_.store(capacity);
 
     if (lock_waiters_->GetCountOfSleepies()) {
-        impl::WaitList::Lock lock{*lock_waiters_};
-        lock_waiters_->WakeupAll(lock);
+        lock_waiters_->WakeupAll();
     }
 }
 
@@ -122,11 +126,10 @@ void CancellableSemaphore::unlock_shared_count(const Counter count) {
     );
 
     if (lock_waiters_->GetCountOfSleepies()) {
-        impl::WaitList::Lock lock{*lock_waiters_};
         if (count > 1) {
-            lock_waiters_->WakeupAll(lock);
+            lock_waiters_->WakeupAll();
         } else {
-            lock_waiters_->WakeupOne(lock);
+            lock_waiters_->WakeupOne();
         }
     }
 }
@@ -158,6 +161,8 @@ bool CancellableSemaphore::LockSlowPath(Deadline deadline, const Counter count)
             return wait_strategy.GetTryLockStatus() == TryLockStatus::kSuccess;
         }
         if (!impl::HasWaitSucceeded(wakeup_source)) {
+            // Do not lose the wakeup that we are not going to use
+            if (wait_strategy.IsWokenUp()) lock_waiters_->WakeupOne();
             return false;
         }
     }
@@ -6,6 +6,7 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/semaphore.hpp>
+#include <userver/engine/sharded_semaphore.hpp>
 #include <userver/engine/sleep.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
@@ -92,6 +93,49 @@ void semaphore_lock_unlock_payload_contention(benchmark::State& state) {
 }
 BENCHMARK(semaphore_lock_unlock_payload_contention)->RangeMultiplier(2)->Range(1, 32);
 
+// In-flight limit that is rarely reached
+void semaphore_lock_unlock_large_capacity_contention(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        engine::Semaphore sem{100'000};
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                sem.lock_shared();
+                sem.unlock_shared();
+            }
+        });
+    });
+}
+BENCHMARK(semaphore_lock_unlock_large_capacity_contention)->RangeMultiplier(2)->Range(1, 64);
+
+void sharded_semaphore_lock_unlock_large_capacity_contention(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        engine::ShardedSemaphore sem{100'000};
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                sem.lock_shared();
+                sem.unlock_shared();
+            }
+        });
+    });
+}
+BENCHMARK(sharded_semaphore_lock_unlock_large_capacity_contention)->RangeMultiplier(2)->Range(1, 64);
+
+void sharded_semaphore_lock_unlock_contention(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        engine::ShardedSemaphore sem{1};
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                sem.lock_shared();
+                sem.unlock_shared();
+            }
+        });
+    });
+}
+BENCHMARK(sharded_semaphore_lock_unlock_contention)->RangeMultiplier(2)->Range(1, 32);
+
 void semaphore_lock_unlock_coro_contention(benchmark::State& state) {
     engine::RunStandalone(4, [&] {
         engine::Semaphore sem{1};
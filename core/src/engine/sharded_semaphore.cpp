@@ -0,0 +1,172 @@
+#include <userver/engine/sharded_semaphore.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <userver/utils/fast_scope_guard.hpp>
+
+#include <concurrent/impl/rseq.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kNoSlice = std::numeric_limits<std::size_t>::max();
+
+// At most 1/kMaxCachedShare of capacity is cached in the slices
+constexpr std::size_t kMaxCachedShare = 8;
+constexpr std::size_t kMaxBatchSize = 64;
+
+std::size_t GetSlicesCount() noexcept {
+#ifdef USERVER_IMPL_HAS_RSEQ
+    return concurrent::impl::GetRseqArraySize();
+#else
+    return 0;
+#endif
+}
+
+std::size_t GetCurrentSliceIndex() noexcept {
+#ifdef USERVER_IMPL_HAS_RSEQ
+    // Only the CPU number is taken from rseq, see utils::StripedTokenBucket
+    const auto cpu_id = rseq_cpu_start();
+    if (concurrent::impl::IsCpuIdValid(cpu_id)) return cpu_id;
+#endif
+    return kNoSlice;
+}
+
+// 0 and 1 mean that the locks are not cached
+std::size_t GetBatchSize(ShardedSemaphore::Counter capacity, std::size_t slices_count) noexcept {
+    if (slices_count == 0) return 0;
+    return std::min(capacity / kMaxCachedShare / slices_count, kMaxBatchSize);
+}
+
+bool TryTakeFrom(std::atomic<ShardedSemaphore::Counter>& slice) noexcept {
+    auto locks = slice.load();
+    while (locks > 0) {
+        if (slice.compare_exchange_weak(locks, locks - 1)) return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+ShardedSemaphore::ShardedSemaphore(Counter capacity)
+    : shared_(capacity), batch_size_(GetBatchSize(capacity, GetSlicesCount())), slices_(GetSlicesCount(), 0) {}
+
+ShardedSemaphore::~ShardedSemaphore() {
+    // The cached locks are acquired from the point of view of shared_
+    FlushSlices();
+}
+
+void ShardedSemaphore::SetCapacity(Counter capacity) {
+    batch_size_.store(GetBatchSize(capacity, slices_.size()), std::memory_order_relaxed);
+    shared_.SetCapacity(capacity);
+    FlushSlices();
+}
+
+ShardedSemaphore::Counter ShardedSemaphore::GetCapacity() const noexcept { return shared_.GetCapacity(); }
+
+std::size_t ShardedSemaphore::RemainingApprox() const {
+    const auto capacity = GetCapacity();
+    const auto used = UsedApprox();
+    return capacity >= used ? capacity - used : 0;
+}
+
+std::size_t ShardedSemaphore::UsedApprox() const {
+    std::size_t cached = 0;
+    for (const auto& slice : slices_) {
+        cached += slice->load(std::memory_order_relaxed);
+    }
+    const auto used = shared_.UsedApprox();
+    return used >= cached ? used - cached : 0;
+}
+
+void ShardedSemaphore::lock_shared() {
+    LockOrWait([this] {
+        shared_.lock_shared();
+        return true;
+    });
+}
+
+void ShardedSemaphore::unlock_shared() {
+    const auto slice_index = GetCurrentSliceIndex();
+    const auto batch_size = batch_size_.load(std::memory_order_relaxed);
+    if (slice_index != kNoSlice && batch_size > 1) {
+        auto& slice = slices_[slice_index];
+        if (slice->load(std::memory_order_relaxed) < batch_size) {
+            CacheLocks(slice, 1);
+            return;
+        }
+    }
+    shared_.unlock_shared();
+}
+
+bool ShardedSemaphore::try_lock_shared() {
+    const auto slice_index = GetCurrentSliceIndex();
+    if (slice_index != kNoSlice && TryTakeFrom(*slices_[slice_index])) return true;
+    return TryLockSlow(slice_index);
+}
+
+bool ShardedSemaphore::try_lock_shared_until(Deadline deadline) {
+    return LockOrWait([this, deadline] { return shared_.try_lock_shared_until(deadline); });
+}
+
+bool ShardedSemaphore::TryLockSlow(std::size_t slice_index) {
+    if (slice_index != kNoSlice) {
+        const auto batch_size = batch_size_.load(std::memory_order_relaxed);
+        if (batch_size > 1 && waiters_.load(std::memory_order_relaxed) == 0 &&
+            shared_.try_lock_shared_count(batch_size)) {
+            // One of the locks is used right away
+            CacheLocks(slices_[slice_index], batch_size - 1);
+            return true;
+        }
+    }
+    if (shared_.try_lock_shared()) return true;
+
+    // The shared semaphore is depleted, rebalance the locks cached by other CPUs
+    return TryTakeFromSlices(slice_index == kNoSlice ? 0 : slice_index + 1);
+}
+
+template <typename SharedLock>
+bool ShardedSemaphore::LockOrWait(SharedLock&& shared_lock) {
+    if (try_lock_shared()) return true;
+
+    waiters_.fetch_add(1);
+    const utils::FastScopeGuard waiters_guard{[this]() noexcept { waiters_.fetch_sub(1); }};
+
+    // The locks could have been cached by unlock_shared() before it noticed us
+    if (TryTakeFromSlices(0)) return true;
+    return shared_lock();
+}
+
+bool ShardedSemaphore::TryTakeFromSlices(std::size_t first_slice_index) noexcept {
+    for (std::size_t i = 0; i < slices_.size(); ++i) {
+        if (TryTakeFrom(*slices_[(first_slice_index + i) % slices_.size()])) return true;
+    }
+    return false;
+}
+
+void ShardedSemaphore::CacheLocks(Slice& slice, Counter count) {
+    // Pairs with the increment of waiters_ in LockOrWait: either the waiter
+    // takes the locks from the slice, or we see the waiter.
+    slice->fetch_add(count);
+    if (waiters_.load() != 0) {
+        // The waiters sleep on shared_ and do not see the cached locks
+        FlushSlice(slice);
+    }
+}
+
+void ShardedSemaphore::FlushSlice(Slice& slice) {
+    const auto locks = slice->exchange(0);
+    if (locks != 0) shared_.unlock_shared_count(locks);
+}
+
+void ShardedSemaphore::FlushSlices() {
+    for (auto& slice : slices_) FlushSlice(slice);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
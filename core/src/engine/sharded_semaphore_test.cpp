@@ -0,0 +1,142 @@
+#include <userver/engine/sharded_semaphore.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Large enough for the locks to be cached in the per-CPU slices
+constexpr std::size_t kLargeCapacity = 100'000;
+
+}  // namespace
+
+UTEST(ShardedSemaphore, OnePass) {
+    engine::ShardedSemaphore s{1};
+    auto task = engine::AsyncNoSpan([&s] { const std::shared_lock guard{s}; });
+
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ShardedSemaphore, TryLockWholeCapacity) {
+    for (const std::size_t capacity : {std::size_t{1}, std::size_t{7}, kLargeCapacity}) {
+        engine::ShardedSemaphore s{capacity};
+
+        for (std::size_t i = 0; i < capacity; ++i) {
+            ASSERT_TRUE(s.try_lock_shared()) << "capacity=" << capacity << " i=" << i;
+        }
+        EXPECT_FALSE(s.try_lock_shared());
+        EXPECT_EQ(s.UsedApprox(), capacity);
+        EXPECT_EQ(s.RemainingApprox(), 0);
+
+        for (std::size_t i = 0; i < capacity; ++i) {
+            s.unlock_shared();
+        }
+        EXPECT_EQ(s.UsedApprox(), 0);
+        EXPECT_EQ(s.RemainingApprox(), capacity);
+    }
+}
+
+UTEST(ShardedSemaphore, WaiterIsWokenUp) {
+    engine::ShardedSemaphore s{kLargeCapacity};
+    for (std::size_t i = 0; i < kLargeCapacity; ++i) {
+        ASSERT_TRUE(s.try_lock_shared());
+    }
+
+    auto task = engine::AsyncNoSpan([&s] { const std::shared_lock guard{s}; });
+    task.WaitFor(10ms);
+    EXPECT_FALSE(task.IsFinished());
+
+    // The released lock may be cached in a slice, it must reach the waiter
+    s.unlock_shared();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+
+    for (std::size_t i = 1; i < kLargeCapacity; ++i) {
+        s.unlock_shared();
+    }
+}
+
+UTEST(ShardedSemaphore, TryLockUntil) {
+    engine::ShardedSemaphore s{1};
+    const std::shared_lock guard{s};
+
+    EXPECT_FALSE(s.try_lock_shared_for(10ms));
+}
+
+UTEST(ShardedSemaphore, ZeroCapacity) {
+    engine::ShardedSemaphore s{0};
+    EXPECT_FALSE(s.try_lock_shared());
+    EXPECT_THROW(s.lock_shared(), engine::UnreachableSemaphoreLockError);
+}
+
+UTEST(ShardedSemaphore, SetCapacity) {
+    engine::ShardedSemaphore s{kLargeCapacity};
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(s.try_lock_shared());
+    }
+
+    s.SetCapacity(100);
+    EXPECT_EQ(s.GetCapacity(), 100);
+    EXPECT_FALSE(s.try_lock_shared());
+
+    s.unlock_shared();
+    EXPECT_TRUE(s.try_lock_shared());
+
+    for (int i = 0; i < 100; ++i) {
+        s.unlock_shared();
+    }
+}
+
+UTEST_MT(ShardedSemaphore, CapacityIsNeverExceeded, 4) {
+    constexpr std::size_t kCapacity = 3;
+    constexpr std::size_t kTasks = 16;
+
+    engine::ShardedSemaphore s{kCapacity};
+    std::atomic<std::size_t> inside{0};
+    std::atomic<bool> exceeded{false};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasks);
+    for (std::size_t i = 0; i < kTasks; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+            for (int j = 0; j < 500; ++j) {
+                const std::shared_lock guard{s};
+                if (inside.fetch_add(1) >= kCapacity) exceeded = true;
+                engine::Yield();
+                inside.fetch_sub(1);
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_FALSE(exceeded);
+    EXPECT_EQ(s.UsedApprox(), 0);
+}
+
+UTEST_MT(ShardedSemaphore, LargeCapacityContention, 4) {
+    engine::ShardedSemaphore s{kLargeCapacity};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < 8; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+            for (int j = 0; j < 10'000; ++j) {
+                const std::shared_lock guard{s};
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(s.UsedApprox(), 0);
+    EXPECT_EQ(s.RemainingApprox(), kLargeCapacity);
+}
+
+USERVER_NAMESPACE_END
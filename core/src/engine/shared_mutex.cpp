@@ -43,7 +43,8 @@ bool SharedMutex::try_lock_until(Deadline deadline) {
     waiting_writers_count_.fetch_add(1, std::memory_order_relaxed);
 
     utils::ScopeGuard stop_wait([this] { DecWaitingWriters(); });
-    if (semaphore_.try_lock_shared_until_count(deadline, kWriterLock)) {
+    if ((!(deadline == Deadline::Passed()) && SpinLock()) ||
+        semaphore_.try_lock_shared_until_count(deadline, kWriterLock)) {
         stop_wait.Release();
         return true;
     }
@@ -62,6 +63,7 @@ void SharedMutex::lock_shared() {
      * we just don't care.
      */
 
+    if (SpinLockShared()) return;
     semaphore_.lock_shared();
 }
 
@@ -76,7 +78,17 @@ bool SharedMutex::try_lock_shared_until(Deadline deadline) {
     if (!WaitForNoWaitingWriters(deadline)) return false;
 
     /* Same deliberate race, see comment in lock_shared() */
-    return semaphore_.try_lock_shared_until(deadline);
+    return (!(deadline == Deadline::Passed()) && SpinLockShared()) || semaphore_.try_lock_shared_until(deadline);
+}
+
+bool SharedMutex::SpinLock() {
+    if (semaphore_.try_lock_shared_count(kWriterLock)) return true;
+    return spinner_.Spin([this] { return semaphore_.try_lock_shared_count(kWriterLock); });
+}
+
+bool SharedMutex::SpinLockShared() {
+    if (semaphore_.try_lock_shared()) return true;
+    return spinner_.Spin([this] { return semaphore_.try_lock_shared(); });
 }
 
 bool SharedMutex::HasWaitingWriter() const noexcept { return waiting_writers_count_.load() > 0; }
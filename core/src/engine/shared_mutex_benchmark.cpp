@@ -28,4 +28,42 @@ void shared_mutex_benchmark(benchmark::State& state) {
 }
 BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
 
+void shared_mutex_writers_short_section(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        std::uint64_t variable = 0;
+        engine::SharedMutex mutex;
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                const std::unique_lock lock(mutex);
+                ++variable;
+                benchmark::DoNotOptimize(variable);
+            }
+        });
+    });
+}
+BENCHMARK(shared_mutex_writers_short_section)->DenseRange(1, 6);
+
+void shared_mutex_mixed_short_section(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        std::uint64_t variable = 0;
+        engine::SharedMutex mutex;
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            std::uint64_t iteration = 0;
+            for ([[maybe_unused]] auto _ : range) {
+                // One write per 8 reads
+                if (++iteration % 8 == 0) {
+                    const std::unique_lock lock(mutex);
+                    ++variable;
+                } else {
+                    const std::shared_lock lock(mutex);
+                    benchmark::DoNotOptimize(variable);
+                }
+            }
+        });
+    });
+}
+BENCHMARK(shared_mutex_mixed_short_section)->DenseRange(1, 6);
+
 USERVER_NAMESPACE_END
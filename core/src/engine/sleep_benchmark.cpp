@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <engine/ev/thread_control.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -59,4 +61,27 @@ void unreached_task_deadline_benchmark(benchmark::State& state, bool has_task_de
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false);
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, unreached_task_deadline, true);
 
+// Same as unreached_task_deadline_benchmark, but with `state.range(0)` other
+// deadline timers armed on the ev threads
+void unreached_deadline_with_pending_timers_benchmark(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        std::vector<engine::TaskWithResult<void>> sleepers;
+        sleepers.reserve(state.range(0));
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            sleepers.push_back(engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(1h); }));
+        }
+        engine::Yield();
+
+        for ([[maybe_unused]] auto _ : state) {
+            const auto sleep_deadline = engine::Deadline::FromDuration(20s);
+            auto task = engine::AsyncNoSpan([&] { engine::InterruptibleSleepUntil(sleep_deadline); });
+            engine::Yield();
+            task.SyncCancel();
+        }
+
+        for (auto& sleeper : sleepers) sleeper.SyncCancel();
+    });
+}
+BENCHMARK(unreached_deadline_with_pending_timers_benchmark)->RangeMultiplier(16)->Range(1, 1 << 16);
+
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <sys/types.h>
 
 #include <csignal>
+#include <stdexcept>
 
 #include <userver/engine/task/cancel.hpp>
 #include <utils/check_syscall.hpp>
@@ -11,8 +12,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
-ChildProcessImpl::ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future)
-    : pid_(pid), status_future_(std::move(status_future)) {}
+ChildProcessImpl::ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future, ChildProcessPipes&& pipes)
+    : pid_(pid), status_future_(std::move(status_future)), pipes_(std::move(pipes)) {}
 
 void ChildProcessImpl::WaitNonCancellable() {
     TaskCancellationBlocker cancel_blocker;
@@ -32,6 +33,27 @@ ChildProcessStatus ChildProcessImpl::Get() {
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ChildProcessImpl::SendSignal(int signum) { utils::CheckSyscall(kill(pid_, signum), "kill, pid={}", pid_); }
 
+io::PipeWriter& ChildProcessImpl::GetStdin() {
+    if (!pipes_.stdin_writer) {
+        throw std::logic_error("stdin of the child process is not a pipe, see ExecOptions::stdin_pipe");
+    }
+    return *pipes_.stdin_writer;
+}
+
+io::PipeReader& ChildProcessImpl::GetStdout() {
+    if (!pipes_.stdout_reader) {
+        throw std::logic_error("stdout of the child process is not a pipe, see ExecOptions::stdout_pipe");
+    }
+    return *pipes_.stdout_reader;
+}
+
+io::PipeReader& ChildProcessImpl::GetStderr() {
+    if (!pipes_.stderr_reader) {
+        throw std::logic_error("stderr of the child process is not a pipe, see ExecOptions::stderr_pipe");
+    }
+    return *pipes_.stderr_reader;
+}
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
@@ -1,18 +1,27 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process_status.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
+/// The parent ends of the pipes connected to the stdio of a child process
+struct ChildProcessPipes final {
+    std::optional<io::PipeWriter> stdin_writer;
+    std::optional<io::PipeReader> stdout_reader;
+    std::optional<io::PipeReader> stderr_reader;
+};
+
 class ChildProcessImpl {
 public:
-    ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future);
+    ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future, ChildProcessPipes&& pipes = {});
 
     int GetPid() const { return pid_; }
 
@@ -24,9 +33,16 @@ public:
 
     void SendSignal(int signum);
 
+    io::PipeWriter& GetStdin();
+
+    io::PipeReader& GetStdout();
+
+    io::PipeReader& GetStderr();
+
 private:
     int pid_;
     Future<ChildProcessStatus> status_future_;
+    ChildProcessPipes pipes_;
 };
 
 }  // namespace engine::subprocess
@@ -1,13 +1,17 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
 
+#include <array>
+#include <cerrno>
 #include <csignal>
-#include <cstdio>
-#include <cstring>
-#include <iostream>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -18,70 +22,214 @@
 #include <engine/ev/thread_pool.hpp>
 #include <engine/subprocess/child_process_impl.hpp>
 #include <engine/task/task_processor.hpp>
+#include <userver/compiler/impl/asan.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/text_light.hpp>
 #include <utils/check_syscall.hpp>
 
-extern char** environ;
-
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 namespace {
 
-void DoExec(
+#ifdef __linux__
+// The child only calls a few syscalls before execve()
+constexpr std::size_t kChildStackSize = 64 * 1024;
+#endif
+
+// Same as the default of execvp()
+constexpr std::string_view kDefaultPath = "/bin:/usr/bin";
+
+// Everything the child needs is prepared by the parent: the child shares the
+// memory with the parent and must not allocate or take any locks
+struct ChildSetup final {
+    std::vector<std::string> executables;
+    std::vector<char*> argv;
+    std::vector<std::string> envp_buf;
+    std::vector<char*> envp;
+    const char* stdout_file{nullptr};
+    const char* stderr_file{nullptr};
+    // fds to be dup2()'ed to stdin, stdout and stderr
+    std::array<int, 3> stdio_fds{-1, -1, -1};
+    sigset_t sigmask{};
+};
+
+std::vector<std::string>
+FindExecutableCandidates(const std::string& executable_path, const EnvironmentVariables& env, bool use_path) {
+    if (!use_path || executable_path.find('/') != std::string::npos) return {executable_path};
+
+    // Same as execvp(), but the PATH is taken from the environment of the child
+    const auto* path = env.GetValueOptional("PATH");
+    std::vector<std::string> candidates;
+    const auto dirs = utils::text::Split(path ? std::string_view{*path} : kDefaultPath, ":", utils::text::SplitFlags::kNone);
+    for (const std::string_view dir : dirs) {
+        candidates.push_back(utils::StrCat(dir.empty() ? std::string_view{"."} : dir, "/", executable_path));
+    }
+    return candidates;
+}
+
+ChildSetup MakeChildSetup(
     const std::string& executable_path,
     const std::vector<std::string>& args,
     const EnvironmentVariables& env,
-    const std::optional<std::string>& stdout_file,
-    const std::optional<std::string>& stderr_file,
-    bool use_path
+    const ExecOptions& options
 ) {
-    if (stdout_file) {
-        if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-            utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
-        }
-    }
-    if (stderr_file) {
-        if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-            utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
-        }
-    }
-    std::vector<char*> argv_ptrs;
-    std::vector<std::string> envp_buf;
-    std::vector<char*> envp_ptrs;
-    argv_ptrs.reserve(args.size() + 2);
-    envp_buf.reserve(env.size());
-    envp_ptrs.reserve(env.size() + 1);
+    ChildSetup setup;
+    setup.executables = FindExecutableCandidates(executable_path, env, options.use_path);
 
+    setup.argv.reserve(args.size() + 2);
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    argv_ptrs.push_back(const_cast<char*>(executable_path.c_str()));
+    setup.argv.push_back(const_cast<char*>(executable_path.c_str()));
     for (const auto& arg : args) {
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-        argv_ptrs.push_back(const_cast<char*>(arg.c_str()));
+        setup.argv.push_back(const_cast<char*>(arg.c_str()));
     }
-    argv_ptrs.push_back(nullptr);
+    setup.argv.push_back(nullptr);
 
+    setup.envp_buf.reserve(env.size());
+    setup.envp.reserve(env.size() + 1);
     for (const auto& [key, value] : env) {
-        envp_buf.emplace_back(utils::StrCat(key, "=", value));
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-        envp_ptrs.push_back(const_cast<char*>(envp_buf.back().c_str()));
+        setup.envp_buf.emplace_back(utils::StrCat(key, "=", value));
+        setup.envp.push_back(setup.envp_buf.back().data());
     }
-    envp_ptrs.push_back(nullptr);
+    setup.envp.push_back(nullptr);
 
-    environ = envp_ptrs.data();  // The variable is assigned to the environment to
-                                 // use the execv, execvp functions
+    if (options.stdout_file) setup.stdout_file = options.stdout_file->c_str();
+    if (options.stderr_file) setup.stderr_file = options.stderr_file->c_str();
+    return setup;
+}
 
-    if (!use_path) {
-        utils::CheckSyscall(execv(executable_path.c_str(), argv_ptrs.data()), "execv");
-    } else {
-        utils::CheckSyscall(execvp(executable_path.c_str(), argv_ptrs.data()), "execvp");
+// The child end of a pipe must be blocking, the programs do not expect a
+// non-blocking stdio. The parent end is a separate file description and stays
+// non-blocking.
+void MakeBlocking(int fd) {
+    const auto flags = utils::CheckSyscall(::fcntl(fd, F_GETFL), "getting flags of a pipe");
+    utils::CheckSyscall(::fcntl(fd, F_SETFL, flags & ~O_NONBLOCK), "making a pipe blocking");
+}
+
+/// @{
+/// Functions that are called in the child, they must be async-signal-safe
+void WriteToStderr(std::string_view message) noexcept {
+    [[maybe_unused]] const auto ret = ::write(STDERR_FILENO, message.data(), message.size());
+}
+
+void WriteErrnoToStderr(int error) noexcept {
+    std::array<char, 16> buffer{};
+    auto pos = buffer.size();
+    do {
+        buffer[--pos] = static_cast<char>('0' + error % 10);
+        error /= 10;
+    } while (error > 0 && pos > 0);
+    WriteToStderr({buffer.data() + pos, buffer.size() - pos});
+}
+
+[[noreturn]] void AbortChild(const char* what) noexcept {
+    const auto error = errno;
+    WriteToStderr("Cannot execute child: ");
+    WriteToStderr(what);
+    WriteToStderr(" failed, errno=");
+    WriteErrnoToStderr(error);
+    WriteToStderr("\n");
+
+    // Same exit status as abort() used to give in a forked child. The signal
+    // handlers are already reset, so no handler of the parent runs here.
+    sigset_t abort_set;
+    ::sigemptyset(&abort_set);
+    ::sigaddset(&abort_set, SIGABRT);
+    ::sigprocmask(SIG_UNBLOCK, &abort_set, nullptr);
+    ::kill(::getpid(), SIGABRT);
+    ::_exit(127);
+}
+
+void ResetSignalHandlers() noexcept {
+    struct sigaction action {};
+    for (int signum = 1; signum < NSIG; ++signum) {
+        if (::sigaction(signum, nullptr, &action) != 0) continue;
+        if (action.sa_handler == SIG_DFL || action.sa_handler == SIG_IGN) continue;
+
+        action = {};
+        action.sa_handler = SIG_DFL;
+        ::sigaction(signum, &action, nullptr);
     }
 }
 
+void RedirectToFile(const char* file, int target_fd) noexcept {
+    if (!file) return;
+
+    // Same as freopen(file, "a")
+    const int fd = ::open(file, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666);
+    if (fd == -1) AbortChild("open");
+    if (::dup2(fd, target_fd) == -1) AbortChild("dup2");
+}
+
+[[noreturn]] void RunChild(const ChildSetup& setup) noexcept {
+    ResetSignalHandlers();
+
+    RedirectToFile(setup.stdout_file, STDOUT_FILENO);
+    RedirectToFile(setup.stderr_file, STDERR_FILENO);
+    for (int target_fd = 0; target_fd < static_cast<int>(setup.stdio_fds.size()); ++target_fd) {
+        const auto fd = setup.stdio_fds[target_fd];
+        if (fd != -1 && ::dup2(fd, target_fd) == -1) AbortChild("dup2");
+    }
+
+    ::sigprocmask(SIG_SETMASK, &setup.sigmask, nullptr);
+
+    int error = ENOENT;
+    for (const auto& executable : setup.executables) {
+        ::execve(executable.c_str(), setup.argv.data(), setup.envp.data());
+        if (errno == EACCES) {
+            error = errno;
+        } else if (errno != ENOENT && errno != ENOTDIR) {
+            error = errno;
+            break;
+        }
+    }
+    errno = error;
+    AbortChild("execve");
+}
+
+#ifdef __linux__
+int ChildMain(void* setup) { RunChild(*static_cast<const ChildSetup*>(setup)); }
+#endif
+/// @}
+
+// Returns the pid, or -1 and sets errno
+pid_t SpawnChild(ChildSetup& setup) {
+    // No signal handler of the parent must run in the child before the child
+    // resets the handlers
+    sigset_t all_signals;
+    ::sigfillset(&all_signals);
+    [[maybe_unused]] const auto block_result = ::pthread_sigmask(SIG_SETMASK, &all_signals, &setup.sigmask);
+    UASSERT(block_result == 0);
+
+    pid_t pid = -1;
+#ifdef __linux__
+    // The child shares the memory with the parent instead of copying the page
+    // tables as fork() does. The parent thread is suspended until execve(), so
+    // the child could use a part of the stack of the parent.
+    alignas(16) std::array<char, kChildStackSize> child_stack;
+    pid = ::clone(&ChildMain, child_stack.data() + child_stack.size(), CLONE_VM | CLONE_VFORK | SIGCHLD, &setup);
+    const auto error = errno;
+    // The frames of the child never return, their redzones are left behind
+    compiler::impl::AsanUnpoisonMemoryRegion(child_stack.data(), child_stack.size());
+#else
+    pid = ::fork();
+    if (pid == 0) RunChild(setup);
+    const auto error = errno;
+#endif
+
+    ::pthread_sigmask(SIG_SETMASK, &setup.sigmask, nullptr);
+    errno = error;
+    return pid;
+}
+
 EnvironmentVariables ApplyEnvironmentUpdate(
     std::optional<EnvironmentVariables>&& env,
     std::optional<EnvironmentVariablesUpdate>&& env_update
@@ -116,9 +264,44 @@ ProcessStarter::Exec(const std::string& executable_path, const std::vector<std::
             "https://github.com/userver-framework/userver/issues/588"
         );
     }
+    if (options.stdout_pipe && options.stdout_file) {
+        throw std::runtime_error("stdout of the child process could not be redirected both to a pipe and to a file");
+    }
+    if (options.stderr_pipe && options.stderr_file) {
+        throw std::runtime_error("stderr of the child process could not be redirected both to a pipe and to a file");
+    }
 
     tracing::Span span("ProcessStarter::Exec");
     span.AddTag("executable_path", executable_path);
+
+    auto setup = MakeChildSetup(executable_path, args, env, options);
+
+    // The child ends of the pipes are closed in the parent after the spawn
+    const utils::FastScopeGuard child_fds_guard([&setup]() noexcept {
+        for (const auto fd : setup.stdio_fds) {
+            if (fd != -1) ::close(fd);
+        }
+    });
+    ChildProcessPipes pipes;
+    if (options.stdin_pipe) {
+        io::Pipe pipe;
+        setup.stdio_fds[STDIN_FILENO] = pipe.reader.Release();
+        MakeBlocking(setup.stdio_fds[STDIN_FILENO]);
+        pipes.stdin_writer.emplace(std::move(pipe.writer));
+    }
+    if (options.stdout_pipe) {
+        io::Pipe pipe;
+        setup.stdio_fds[STDOUT_FILENO] = pipe.writer.Release();
+        MakeBlocking(setup.stdio_fds[STDOUT_FILENO]);
+        pipes.stdout_reader.emplace(std::move(pipe.reader));
+    }
+    if (options.stderr_pipe) {
+        io::Pipe pipe;
+        setup.stdio_fds[STDERR_FILENO] = pipe.writer.Release();
+        MakeBlocking(setup.stdio_fds[STDERR_FILENO]);
+        pipes.stderr_reader.emplace(std::move(pipe.reader));
+    }
+
     Promise<ChildProcess> promise;
     auto future = promise.get_future();
 
@@ -127,41 +310,35 @@ ProcessStarter::Exec(const std::string& executable_path, const std::vector<std::
                               return key_value.first + '=' + key_value.second;
                           });
         LOG_DEBUG() << fmt::format(
-            "do fork() + {}(), executable_path={}, args=[\'{}\'], env=[]",
-            options.use_path ? "execv" : "execvp",
+            "do clone() + execve(), executable_path={}, use_path={}, args=[\'{}\'], env=[{}]",
+            executable_path,
+            options.use_path,
             fmt::join(args, "' '"),
             fmt::join(keys, ", ")
         );
 
-        const auto pid = utils::CheckSyscall(fork(), "fork");
-        if (pid) {
-            // in parent thread
-            span.AddTag("child-process-pid", pid);
-            LOG_DEBUG() << "Started child process with pid=" << pid;
-            Promise<ChildProcessStatus> exec_result_promise;
-            auto res = ChildProcessMapSet(pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-            if (res.second) {
-                promise.set_value(ChildProcess{ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-            } else {
-                const auto msg = fmt::format("process with pid={} already exists in child_process_map", pid);
-                LOG_ERROR() << msg << ", send SIGKILL";
-                ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-                promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-            }
+        const auto pid = SpawnChild(setup);
+        if (pid == -1) {
+            const std::error_code error{errno, std::system_category()};
+            promise.set_exception(
+                std::make_exception_ptr(std::system_error(error, "Failed to spawn a child process"))
+            );
+            return;
+        }
+
+        span.AddTag("child-process-pid", pid);
+        LOG_DEBUG() << "Started child process with pid=" << pid;
+        Promise<ChildProcessStatus> exec_result_promise;
+        auto res = ChildProcessMapSet(pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+        if (res.second) {
+            promise.set_value(
+                ChildProcess{ChildProcessImpl{pid, res.first->status_promise.get_future(), std::move(pipes)}}
+            );
         } else {
-            // in child thread
-            try {
-                try {
-                    DoExec(executable_path, args, env, options.stdout_file, options.stderr_file, options.use_path);
-                } catch (const std::exception& ex) {
-                    std::cerr << "Cannot execute child: " << ex.what();
-                }
-            } catch (...) {
-                // must not do anything in a child
-                std::abort();
-            }
-            // on success execve or execvp does not return
-            std::abort();
+            const auto msg = fmt::format("process with pid={} already exists in child_process_map", pid);
+            LOG_ERROR() << msg << ", send SIGKILL";
+            ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+            promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
         }
     });
 
@@ -23,6 +23,8 @@
 
 #include <engine/ev/thread_control.hpp>
 #include <engine/ev/thread_pool.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process.hpp>
 #include <userver/engine/subprocess/process_starter.hpp>
 #include <userver/engine/task/task.hpp>
@@ -148,6 +150,61 @@ UTEST(Subprocess, ExecvpVulnerability) {
     );
 }
 
+UTEST(Subprocess, StdioPipes) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+
+    engine::subprocess::ExecOptions options{};
+    options.stdin_pipe = true;
+    options.stdout_pipe = true;
+    auto process = starter.Exec("/bin/cat", {}, std::move(options));
+
+    // Much more than the pipe buffer, the data is streamed through the child
+    const std::string data(1024 * 1024, 'x');
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    auto writer = engine::AsyncNoSpan([&] {
+        auto& in = process.GetStdin();
+        EXPECT_EQ(in.WriteAll(data.data(), data.size(), deadline), data.size());
+        in.Close();
+    });
+
+    std::string result;
+    std::array<char, 4096> buffer{};
+    while (const auto size = process.GetStdout().ReadSome(buffer.data(), buffer.size(), deadline)) {
+        result.append(buffer.data(), size);
+    }
+    writer.Get();
+
+    EXPECT_EQ(result, data);
+    const auto status = process.Get();
+    ASSERT_TRUE(status.IsExited());
+    EXPECT_EQ(0, status.GetExitCode());
+    UEXPECT_THROW(process.GetStderr(), std::logic_error);
+}
+
+UTEST(Subprocess, StderrPipe) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+
+    engine::subprocess::ExecOptions options{};
+    options.stderr_pipe = true;
+    auto process = starter.Exec("/bin/sh", {"-c", "echo error >&2"}, std::move(options));
+
+    std::array<char, 16> buffer{};
+    const auto size = process.GetStderr().ReadAll(
+        buffer.data(), buffer.size(), engine::Deadline::FromDuration(utest::kMaxTestWaitTime)
+    );
+    EXPECT_EQ(std::string_view(buffer.data(), size), "error\n");
+    EXPECT_EQ(0, process.Get().GetExitCode());
+}
+
+UTEST(Subprocess, PipeAndFileConflict) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+
+    engine::subprocess::ExecOptions options{};
+    options.stdout_pipe = true;
+    options.stdout_file = "/dev/null";
+    UEXPECT_THROW((void)starter.Exec("/bin/true", {}, std::move(options)), std::runtime_error);
+}
+
 UTEST(Subprocess, CheckLogClosesFds) {
     auto file = fs::blocking::TempFile::Create("/tmp", kLogFilePart);
     auto logger = logging::MakeFileLogger("to_file", file.GetPath(), logging::Format::kTskv);
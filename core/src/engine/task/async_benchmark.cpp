@@ -2,6 +2,7 @@
 
 #include <array>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
@@ -9,14 +10,29 @@
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
 
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
 
 using WrappedSpanCall = utils::impl::WrappedCallImplType<decltype(utils::impl::SpanLazyPrvalue("")), void (*)()>;
 
+void RunWithLifoSlot(std::size_t worker_threads, bool lifo_slot, utils::function_ref<void()> payload) {
+    engine::TaskProcessorConfig config;
+    config.worker_threads = worker_threads;
+    config.thread_name = "coro-runner";
+    config.global_queue_lifo_slot = lifo_slot;
+
+    engine::impl::TaskProcessorHolder task_processor{std::make_unique<engine::TaskProcessor>(
+        std::move(config), engine::impl::MakeTaskProcessorPools({})
+    )};
+    engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
 }
 
+}  // namespace
+
 // Note: We intentionally do not run this benchmark from RunStandalone to avoid
 // any side-effects (RunStandalone spawns additional std::threads and uses some
 // synchronization primitives).
@@ -42,6 +58,22 @@ void async_comparisons_coro(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro)->RangeMultiplier(2)->Range(1, 32);
 
+void async_fan_out(benchmark::State& state) {
+    engine::RunStandalone(4, [&] {
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(state.range(0));
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::int64_t i = 0; i < state.range(0); ++i) {
+                tasks.push_back(engine::AsyncNoSpan([] {}));
+            }
+            for (auto& task : tasks) task.Wait();
+            tasks.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK(async_fan_out)->Arg(16)->Arg(1024);
+
 void wrap_call_single(benchmark::State& state) {
     engine::RunStandalone([&] {
         for ([[maybe_unused]] auto _ : state) {
@@ -95,4 +127,32 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+// Arguments: worker threads, whether the LIFO slot is enabled
+void async_get_lifo_slot(benchmark::State& state) {
+    RunWithLifoSlot(state.range(0), state.range(1) != 0, [&] {
+        std::uint64_t sum = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            sum += engine::AsyncNoSpan([] { return 1; }).Get();
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+}
+BENCHMARK(async_get_lifo_slot)->ArgsProduct({{1, 2, 4, 8}, {0, 1}});
+
+// Arguments: worker threads, whether the LIFO slot is enabled
+void async_get_chain_lifo_slot(benchmark::State& state) {
+    constexpr int kDepth = 8;
+    RunWithLifoSlot(state.range(0), state.range(1) != 0, [&] {
+        const auto spawn_chain = [](int depth, const auto& self) -> int {
+            if (depth == 0) return 0;
+            return engine::AsyncNoSpan([depth, &self] { return self(depth - 1, self); }).Get() + 1;
+        };
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(spawn_chain(kDepth, spawn_chain));
+        }
+        state.SetItemsProcessed(state.iterations() * kDepth);
+    });
+}
+BENCHMARK(async_get_chain_lifo_slot)->ArgsProduct({{1, 4}, {0, 1}});
+
 USERVER_NAMESPACE_END
@@ -1,7 +1,5 @@
 #include <engine/task/context_timer.hpp>
 
-#include <chrono>
-
 #include <engine/ev/async_payload_base.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -58,27 +56,20 @@ public:
 private:
     void StopTimerInEvThread() noexcept;
 
-    static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+    static void OnTimer(ev::TimerWheel::Entry& entry) noexcept;
     static void InvokeTimerFunction(const Params& params, TaskContext& context);
     void DoOnTimer();
 
     boost::intrusive_ptr<TaskContext> context_;
     ev::TimerThreadControl* thread_control_ = nullptr;
     Params params_;
-    ev_timer timer_{};
+    ev::TimerWheel::Entry timer_{&OnTimer, this};
     ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
-ContextTimer::Impl::Impl() {
-    timer_.data = this;
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
-    ev_init(&timer_, OnTimer);
-}
+ContextTimer::Impl::Impl() = default;
 
-ContextTimer::Impl::~Impl() {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
-    UASSERT(!ev_is_active(&timer_));
-}
+ContextTimer::Impl::~Impl() { UASSERT(!timer_.IsScheduled()); }
 
 bool ContextTimer::Impl::WasStarted() const noexcept { return context_ && thread_control_; }
 
@@ -129,19 +120,14 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
 
     params_ = std::move(*params);
 
-    using LibEvDuration = std::chrono::duration<double>;
-    const auto time_left = std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft()).count();
-
-    LOG_TRACE() << "time_left=" << time_left;
-    if (time_left <= 0.0) {
+    if (params_.deadline.IsReached()) {
         // Optimization for small deadlines or high load
         DoOnTimer();
         return;
     }
 
-    timer_.repeat = time_left;
     UASSERT(thread_control_);
-    thread_control_->Again(timer_);
+    thread_control_->Schedule(timer_, params_.deadline);
 }
 
 void ContextTimer::Impl::InvokeTimerFunction(const Params& params, TaskContext& context) {
@@ -158,7 +144,7 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params, TaskContext&
 
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
     UASSERT(!engine::current_task::IsTaskProcessorThread());
-    thread_control_->Stop(timer_);
+    thread_control_->Cancel(timer_);
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -173,12 +159,12 @@ void ContextTimer::Impl::DoFinalizeInEvThread() {
     // ContextTimer may be destroyed at this point
 }
 
-void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
+void ContextTimer::Impl::OnTimer(ev::TimerWheel::Entry& entry) noexcept {
     UASSERT(!engine::current_task::IsTaskProcessorThread());
 
-    auto* ev_timer = static_cast<Impl*>(w->data);
-    UASSERT(ev_timer != nullptr);
-    ev_timer->DoOnTimer();
+    auto* timer = static_cast<Impl*>(entry.GetData());
+    UASSERT(timer != nullptr);
+    timer->DoOnTimer();
 }
 
 void ContextTimer::Impl::DoOnTimer() {
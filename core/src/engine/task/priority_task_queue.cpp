@@ -0,0 +1,120 @@
+#include <engine/task/priority_task_queue.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+constexpr std::size_t GetRoundLength() noexcept {
+    std::size_t result = 0;
+    for (const auto weight : PriorityTaskQueue::kPriorityWeights) {
+        result += weight;
+    }
+    return result;
+}
+
+constexpr std::size_t kRoundLength = GetRoundLength();
+
+// Priority that is preferred on the `pop_index`-th pop of a round
+constexpr std::size_t GetPreferredPriority(std::size_t pop_index) noexcept {
+    for (std::size_t priority = 0; priority < kTaskPriorityCount; ++priority) {
+        const auto weight = PriorityTaskQueue::kPriorityWeights[priority];
+        if (pop_index < weight) return priority;
+        pop_index -= weight;
+    }
+    return kTaskPriorityCount - 1;
+}
+
+constexpr std::size_t ToIndex(TaskPriority priority) noexcept { return static_cast<std::size_t>(priority); }
+
+}  // namespace
+
+struct PriorityTaskQueue::ConsumerTokens final {
+    explicit ConsumerTokens(std::array<Queue, kTaskPriorityCount>& queues)
+        : tokens{
+              moodycamel::ConsumerToken{queues[0]},
+              moodycamel::ConsumerToken{queues[1]},
+              moodycamel::ConsumerToken{queues[2]},
+          } {}
+
+    static_assert(kTaskPriorityCount == 3, "Update the tokens initialization");
+
+    std::array<moodycamel::ConsumerToken, kTaskPriorityCount> tokens;
+    std::size_t pop_index{0};
+};
+
+PriorityTaskQueue::PriorityTaskQueue(const TaskProcessorConfig& config)
+    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+
+void PriorityTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
+    UASSERT(context);
+    DoPush(context->GetPriority(), context.get());
+    context.detach();
+}
+
+boost::intrusive_ptr<impl::TaskContext> PriorityTaskQueue::PopBlocking() {
+    // Current thread handles only a single TaskProcessor, so it's safe to store
+    // tokens for the task processor in a thread-local variable.
+    thread_local ConsumerTokens tokens(queues_);
+
+    boost::intrusive_ptr<impl::TaskContext> context{
+        DoPopBlocking(tokens),
+        /* add_ref= */ false};
+
+    if (!context) {
+        // return "stop" token back
+        DoPush(TaskPriority::kHigh, nullptr);
+    }
+
+    return context;
+}
+
+void PriorityTaskQueue::StopProcessing() { DoPush(TaskPriority::kHigh, nullptr); }
+
+std::size_t PriorityTaskQueue::GetSizeApproximate() const noexcept {
+    std::size_t size = 0;
+    for (const auto& queue : queues_) {
+        size += queue.size_approx();
+    }
+    return size;
+}
+
+void PriorityTaskQueue::PrepareWorker(std::size_t) {}
+
+void PriorityTaskQueue::DoPush(TaskPriority priority, impl::TaskContext* context) {
+    queues_[ToIndex(priority)].enqueue(context);
+    queue_semaphore_.signal();
+}
+
+impl::TaskContext* PriorityTaskQueue::DoPopBlocking(ConsumerTokens& tokens) {
+    impl::TaskContext* context{};
+
+    const auto preferred = GetPreferredPriority(tokens.pop_index);
+    tokens.pop_index = (tokens.pop_index + 1) % kRoundLength;
+
+    // The semaphore counts the items of all the queues, so after the wait
+    // there is an item for us in one of them.
+    queue_semaphore_.wait();
+    if (queues_[preferred].try_dequeue(tokens.tokens[preferred], context)) {
+        return context;
+    }
+    while (true) {
+        for (std::size_t priority = 0; priority < kTaskPriorityCount; ++priority) {
+            if (queues_[priority].try_dequeue(tokens.tokens[priority], context)) {
+                return context;
+            }
+        }
+        // Can happen when another consumer steals our item in exchange for another
+        // item in a Moodycamel sub-queue that we have already passed.
+    }
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/task_priority.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+// Global task queue with a separate FIFO for each engine::TaskPriority.
+//
+// Workers take the tasks with weighted-fair rotation: in each round of
+// sum(kPriorityWeights) pops a worker prefers the tasks of kHigh priority
+// kPriorityWeights[kHigh] times and so on. If the preferred queue is empty,
+// the task of the highest available priority is taken, so that lower
+// priorities do not starve and the workers never idle with a non-empty queue.
+class PriorityTaskQueue final {
+public:
+    static constexpr std::array<std::size_t, kTaskPriorityCount> kPriorityWeights{8, 4, 1};
+
+    explicit PriorityTaskQueue(const TaskProcessorConfig& config);
+
+    void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+    // Returns nullptr as a stop signal
+    boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+    void StopProcessing();
+
+    std::size_t GetSizeApproximate() const noexcept;
+
+    void PrepareWorker(std::size_t index);
+
+private:
+    using Queue = moodycamel::ConcurrentQueue<impl::TaskContext*>;
+
+    struct ConsumerTokens;
+
+    void DoPush(TaskPriority priority, impl::TaskContext* context);
+
+    impl::TaskContext* DoPopBlocking(ConsumerTokens& tokens);
+
+    std::array<Queue, kTaskPriorityCount> queues_;
+    moodycamel::LightweightSemaphore queue_semaphore_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
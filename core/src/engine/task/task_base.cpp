@@ -149,7 +149,11 @@ bool IsTaskProcessorThread() noexcept { return GetCurrentTaskContextUnchecked()
 
 TaskProcessor& GetTaskProcessor() { return GetCurrentTaskContext().GetTaskProcessor(); }
 
-std::size_t GetStackSize() { return GetTaskProcessor().GetTaskProcessorPools()->GetCoroPool().GetStackSize(); }
+std::size_t GetStackSize() { return GetTaskProcessor().GetCoroPool().GetStackSize(); }
+
+TaskPriority GetPriority() { return GetCurrentTaskContext().GetPriority(); }
+
+void SetPriority(TaskPriority priority) { GetCurrentTaskContext().SetPriority(priority); }
 
 ev::ThreadControl& GetEventThread() { return GetTaskProcessor().EventThreadPool().NextThread(); }
 
@@ -17,6 +17,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
+#include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/underlying_value.hpp>
 
@@ -26,6 +27,8 @@
 #include <engine/task/coro_unwinder.hpp>
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/task_processor.hpp>
+#include <engine/task/task_profiler.hpp>
+#include <utils/jemalloc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -96,6 +99,11 @@ constexpr SleepState MakeNextEpochSleepState(SleepState::Epoch current) {
     return {SleepFlags::kNone, Epoch{utils::UnderlyingValue(current) + 1}};
 }
 
+TaskPriority InheritedPriority() noexcept {
+    auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+    return parent ? parent->GetPriority() : TaskPriority::kNormal;
+}
+
 auto* const kFinishedDetachedToken = reinterpret_cast<DetachedTasksSyncBlock::Token*>(1);
 
 }  // namespace
@@ -103,14 +111,18 @@ auto* const kFinishedDetachedToken = reinterpret_cast<DetachedTasksSyncBlock::To
 TaskContext::TaskContext(
     TaskProcessor& task_processor,
     Task::Importance importance,
+    std::optional<TaskPriority> priority,
     Task::WaitMode wait_type,
     Deadline deadline,
-    utils::impl::WrappedCallBase& payload
+    utils::impl::WrappedCallBase& payload,
+    std::size_t fused_storage_size
 )
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      priority_(priority.value_or(InheritedPriority())),
       payload_(&payload),
+      fused_storage_size_(fused_storage_size),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
@@ -427,6 +439,19 @@ void TaskContext::Wakeup(WakeupSource source, SleepState::Epoch epoch) {
     }
 }
 
+bool TaskContext::PrepareBulkBootstrap() {
+    if (IsFinished()) return false;
+
+    const auto prev_sleep_state =
+        sleep_state_.FetchOrFlags<std::memory_order_seq_cst>(static_cast<SleepFlags>(WakeupSource::kBootstrap));
+    if (!ShouldSchedule(prev_sleep_state.flags, WakeupSource::kBootstrap)) return false;
+
+    UASSERT(state_ != Task::State::kQueued);
+    SetState(Task::State::kQueued);
+    TraceStateTransition(Task::State::kQueued);
+    return true;
+}
+
 void TaskContext::Wakeup(WakeupSource source, NoEpoch) {
     UASSERT(source != WakeupSource::kDeadlineTimer);
     UASSERT(source != WakeupSource::kBootstrap);
@@ -584,9 +609,47 @@ void TaskContext::ProfilerStartExecution() {
     } else {
         execute_started_ = {};
     }
+
+    if (task_processor_.ShouldProfilerAccountCpu()) {
+        execute_started_cpu_time_ = GetThreadCpuTime();
+    } else {
+        execute_started_cpu_time_ = {};
+    }
+
+    execute_allocations_accounted_ = false;
+    if (task_processor_.ShouldProfilerAccountAllocations()) {
+        const auto counters = utils::jemalloc::GetThreadAllocationCounters();
+        if (counters.allocated) {
+            execute_started_allocated_ = *counters.allocated;
+            execute_started_deallocated_ = *counters.deallocated;
+            execute_allocations_accounted_ = true;
+        }
+    }
+
+    HeapProfileSliceStarted();
 }
 
 void TaskContext::ProfilerStopExecution() {
+    if (execute_started_cpu_time_.count() != 0 && task_processor_.ShouldProfilerAccountCpu()) {
+        const auto cpu_time = GetThreadCpuTime() - execute_started_cpu_time_;
+        const auto* span = tracing::Span::CurrentSpanUnchecked();
+        task_processor_.GetCpuAccounting().Account(
+            span ? span->GetName() : TaskCpuAccounting::kNoSpanName, cpu_time
+        );
+    }
+
+    if (execute_allocations_accounted_) {
+        const auto counters = utils::jemalloc::GetThreadAllocationCounters();
+        const auto* span = tracing::Span::CurrentSpanUnchecked();
+        task_processor_.GetAllocationAccounting().Account(
+            span ? span->GetName() : TaskCpuAccounting::kNoSpanName,
+            *counters.allocated - execute_started_allocated_,
+            *counters.deallocated - execute_started_deallocated_
+        );
+    }
+
+    HeapProfileSliceStopped();
+
     auto threshold_us = task_processor_.GetProfilerThreshold();
     if (threshold_us.count() <= 0) return;
 
@@ -604,6 +667,9 @@ void TaskContext::ProfilerStopExecution() {
         if (task_processor_.ShouldProfilerForceStacktrace()) {
             logging::impl::ExtendLogExtraWithStacktrace(extra_stacktrace);
         }
+        if (task_processor_.ShouldProfilerCollectStacktraces()) {
+            CollectSlowSliceStacktrace();
+        }
         LOG_ERROR() << "Profiler threshold reached, task was executing "
                        "for too long without context switch ("
                     << duration_us.count() << "us >= " << threshold_us.count() << "us)" << extra_stacktrace;
@@ -654,9 +720,10 @@ void intrusive_ptr_release(TaskContext* p) noexcept {
     if (p->intrusive_refcount_.fetch_sub(1, std::memory_order_seq_cst) == 1) {
         p->ResetPayload();
 
+        const auto fused_storage_size = p->fused_storage_size_;
         std::destroy_at(p);
 
-        DeleteFusedTaskContext(reinterpret_cast<std::byte*>(p));
+        DeleteFusedTaskContext(reinterpret_cast<std::byte*>(p), fused_storage_size);
     }
 }
 
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <ev.h>
@@ -24,6 +25,7 @@
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
 #include <userver/utils/impl/wrapped_call_base.hpp>
@@ -80,7 +82,15 @@ public:
         kBootstrap = static_cast<uint32_t>(SleepFlags::kWakeupByBootstrap),
     };
 
-    TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline, utils::impl::WrappedCallBase& payload);
+    TaskContext(
+        TaskProcessor&,
+        Task::Importance,
+        std::optional<TaskPriority>,
+        Task::WaitMode,
+        Deadline,
+        utils::impl::WrappedCallBase& payload,
+        std::size_t fused_storage_size
+    );
 
     ~TaskContext() noexcept;
 
@@ -121,6 +131,10 @@ public:
     // normally non-blocking, causes wakeup
     void RequestCancel(TaskCancellationReason);
 
+    // Does the same as the bootstrap Wakeup(), but leaves the scheduling to the
+    // caller. Returns whether the context should be scheduled.
+    bool PrepareBulkBootstrap();
+
     TaskCancellationReason CancellationReason() const noexcept { return cancellation_reason_; }
 
     bool IsCancelRequested() const noexcept { return cancellation_reason_ != TaskCancellationReason::kNone; }
@@ -134,6 +148,9 @@ public:
     void SetBackground(bool);
     bool IsBackground() const noexcept { return is_background_; };
 
+    TaskPriority GetPriority() const noexcept { return priority_.load(std::memory_order_relaxed); }
+    void SetPriority(TaskPriority priority) noexcept { priority_.store(priority, std::memory_order_relaxed); }
+
     // causes this to yield and wait for wakeup
     // must only be called from this context
     // "spurious wakeups" may be caused by wakeup queueing
@@ -210,9 +227,14 @@ private:
     bool is_cancellable_{true};
     bool is_background_{false};
     bool within_sleep_{false};
+    bool execute_allocations_accounted_{false};
+    // Read by the TaskProcessor on Schedule() from other threads
+    std::atomic<TaskPriority> priority_;
     EhGlobals eh_globals_;
 
     utils::impl::WrappedCallBase* payload_;
+    // Size of the allocation that holds both the TaskContext and the payload
+    const std::size_t fused_storage_size_;
 
     std::atomic<Task::State> state_{Task::State::kNew};
     std::atomic<DetachedTasksSyncBlock::Token*> detached_token_{nullptr};
@@ -225,6 +247,10 @@ private:
     // {} if not defined
     std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
     std::chrono::steady_clock::time_point execute_started_;
+    std::chrono::nanoseconds execute_started_cpu_time_{};
+    // Meaningful only if execute_allocations_accounted_ is set
+    std::uint64_t execute_started_allocated_{0};
+    std::uint64_t execute_started_deallocated_{0};
     std::chrono::steady_clock::time_point last_state_change_timepoint_;
 
     std::size_t trace_csw_left_;
@@ -2,6 +2,9 @@
 
 #include <sys/types.h>
 #include <csignal>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -11,10 +14,12 @@
 #include <userver/utils/impl/static_registration.hpp>
 #include <userver/utils/numeric_cast.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
+#include <engine/ev/wakeup_batch.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
@@ -24,6 +29,20 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 namespace {
 
+coro::Pool& SelectCoroPool(const TaskProcessorConfig& config, impl::TaskProcessorPools& pools) {
+    if (!config.use_big_stack_coro_pool) return pools.GetCoroPool();
+
+    auto* const big_stack_pool = pools.GetBigStackCoroPool();
+    if (!big_stack_pool) {
+        throw std::runtime_error(fmt::format(
+            "Task processor '{}' has 'big-stack: true', but "
+            "components_manager.big_stack_coro_pool is not configured",
+            config.name
+        ));
+    }
+    return *big_stack_pool;
+}
+
 template <class Value>
 struct OverloadActionAndValue final {
     TaskProcessorSettings::OverloadAction action;
@@ -42,6 +61,25 @@ constexpr OverloadActionAndValue<OverloadBitAndValue> GetOverloadActionAndValue(
     }
 }
 
+// Tasks of kLow priority are overloaded at the half of the wait time limit,
+// kNormal at the limit, kHigh at the doubled limit.
+std::uint8_t GetPrioritiesOverloadedByWaitTime(
+    std::chrono::steady_clock::duration wait_time,
+    std::chrono::microseconds max_wait_time
+) noexcept {
+    static_assert(kTaskPriorityCount == 3, "Update the thresholds");
+    if (max_wait_time.count() == 0) return 0;
+    std::uint8_t result = 0;
+    if (wait_time >= max_wait_time / 2) ++result;
+    if (wait_time >= max_wait_time) ++result;
+    if (wait_time >= max_wait_time * 2) ++result;
+    return result;
+}
+
+bool IsOverloaded(std::uint8_t overloaded_priorities, TaskPriority priority) noexcept {
+    return overloaded_priorities >= kTaskPriorityCount - static_cast<std::size_t>(priority);
+}
+
 void SetTaskQueueWaitTimepoint(impl::TaskContext* context) {
     static constexpr std::size_t kTaskTimestampInterval = 4;
     thread_local std::size_t task_count = 0;
@@ -83,12 +121,14 @@ void TaskProcessorThreadStartedHook() {
 }
 
 auto MakeTaskQueue(TaskProcessorConfig config) {
-    using ResultType = std::variant<TaskQueue, WorkStealingTaskQueue>;
+    using ResultType = std::variant<TaskQueue, WorkStealingTaskQueue, PriorityTaskQueue>;
     switch (config.task_processor_queue) {
         case TaskQueueType::kGlobalTaskQueue:
             return ResultType{std::in_place_index<0>, std::move(config)};
         case TaskQueueType::kWorkStealingTaskQueue:
             return ResultType{std::in_place_index<1>, std::move(config)};
+        case TaskQueueType::kPriorityTaskQueue:
+            return ResultType{std::in_place_index<2>, std::move(config)};
     }
     UINVARIANT(false, "Unexpected value of TaskQueueType enum");
 }
@@ -99,15 +139,28 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config, std::shared_ptr<impl::T
     : task_queue_(MakeTaskQueue(config)),
       task_counter_(config.worker_threads),
       config_(std::move(config)),
-      pools_(std::move(pools)) {
+      pools_(std::move(pools)),
+      coro_pool_(SelectCoroPool(config_, *pools_)) {
     utils::impl::FinishStaticRegistration();
     try {
         LOG_INFO() << "creating task_processor " << Name() << " "
                    << "worker_threads=" << config_.worker_threads << " thread_name=" << config_.thread_name;
         concurrent::impl::Latch workers_left{static_cast<std::ptrdiff_t>(config_.worker_threads)};
+        std::mutex pinning_error_mutex;
+        std::exception_ptr pinning_error;
         workers_.reserve(config_.worker_threads);
         for (std::size_t i = 0; i < config_.worker_threads; ++i) {
-            workers_.emplace_back([this, i, &workers_left] {
+            workers_.emplace_back([this, i, &workers_left, &pinning_error_mutex, &pinning_error] {
+                try {
+                    PinWorkerThread(i);
+                } catch (const std::exception& ex) {
+                    const std::lock_guard lock{pinning_error_mutex};
+                    if (!pinning_error) {
+                        pinning_error = std::make_exception_ptr(std::runtime_error(fmt::format(
+                            "Failed to pin worker thread {} of task processor {}: {}", i, Name(), ex.what()
+                        )));
+                    }
+                }
                 PrepareWorkerThread(i);
                 workers_left.count_down();
                 ProcessTasks();
@@ -117,6 +170,7 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config, std::shared_ptr<impl::T
 
         cpu_stats_storage_ = std::make_unique<utils::statistics::ThreadPoolCpuStatsStorage>(workers_);
         workers_left.wait();
+        if (pinning_error) std::rethrow_exception(pinning_error);
     } catch (...) {
         Cleanup();
         throw;
@@ -146,6 +200,27 @@ void TaskProcessor::InitiateShutdown() {
 }
 
 void TaskProcessor::Schedule(impl::TaskContext* context) {
+    PrepareSchedule(context);
+    std::visit([&context](auto&& arg) { return arg.Push(context); }, task_queue_);
+}
+
+void TaskProcessor::ScheduleBulk(utils::span<impl::TaskContext* const> contexts) {
+    for (auto* const context : contexts) PrepareSchedule(context);
+
+    std::visit(
+        [contexts](auto& queue) {
+            using Queue = std::decay_t<decltype(queue)>;
+            if constexpr (std::is_same_v<Queue, TaskQueue>) {
+                queue.PushBulk(contexts);
+            } else {
+                for (auto* const context : contexts) queue.Push(context);
+            }
+        },
+        task_queue_
+    );
+}
+
+void TaskProcessor::PrepareSchedule(impl::TaskContext* context) {
     UASSERT(context);
     const auto [action, max_queue_length] = GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_length_);
     if (max_queue_length && !context->IsCritical()) {
@@ -164,20 +239,24 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
     if (is_shutting_down_) context->RequestCancel(TaskCancellationReason::kShutdown);
 
     SetTaskQueueWaitTimepoint(context);
-
-    std::visit([&context](auto&& arg) { return arg.Push(context); }, task_queue_);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) { detached_contexts_->Add(context); }
 
 ev::ThreadPool& TaskProcessor::EventThreadPool() { return pools_->EventThreadPool(); }
 
-impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() { return {pools_->GetCoroPool().GetCoroutine(), *this}; }
+impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() { return {coro_pool_.GetCoroutine(), *this}; }
 
 std::size_t TaskProcessor::GetTaskQueueSize() const {
     return std::visit([](auto&& arg) { return arg.GetSizeApproximate(); }, task_queue_);
 }
 
+void TaskProcessor::WriteTaskQueueStatistics(utils::statistics::Writer& writer) const {
+    if (const auto* work_stealing_queue = std::get_if<WorkStealingTaskQueue>(&task_queue_)) {
+        writer["work-stealing"] = *work_stealing_queue;
+    }
+}
+
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
     sensor_task_queue_wait_time_ = settings.sensor_wait_queue_time_limit;
 
@@ -230,6 +309,9 @@ void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
         }
     }
     profiler_force_stacktrace_.store(settings.profiler_force_stacktrace);
+    profiler_cpu_accounting_.store(settings.profiler_cpu_accounting, std::memory_order_relaxed);
+    profiler_allocation_accounting_.store(settings.profiler_allocation_accounting, std::memory_order_relaxed);
+    profiler_collect_stacktraces_.store(settings.profiler_collect_stacktraces, std::memory_order_relaxed);
 }
 
 std::chrono::microseconds TaskProcessor::GetProfilerThreshold() const { return task_profiler_threshold_.load(); }
@@ -272,6 +354,14 @@ void RegisterThreadStartedHook(std::function<void()> func) {
     ThreadStartedHooks().push_back(std::move(func));
 }
 
+void TaskProcessor::PinWorkerThread(std::size_t index) const {
+    if (config_.cpu_affinity.empty()) return;
+
+    // Each worker stays on a single NUMA node, so that the work stealing
+    // queue knows the node of every worker without asking the OS
+    utils::SetCurrentThreadCpuAffinity(GetWorkerCpus(config_, index));
+}
+
 void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
     switch (config_.os_scheduling) {
         case OsScheduling::kNormal:
@@ -286,18 +376,18 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
 
     std::visit([index](auto& obj) { obj.PrepareWorker(index); }, task_queue_);
 
-    pools_->GetCoroPool().PrepareLocalCache();
+    coro_pool_.PrepareLocalCache();
 
     utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
     impl::SetLocalTaskCounterData(task_counter_, index);
 
-    pools_->GetCoroPool().RegisterThread();
+    coro_pool_.RegisterThread();
 
     TaskProcessorThreadStartedHook();
 }
 
-void TaskProcessor::FinalizeWorkerThread() noexcept { pools_->GetCoroPool().ClearLocalCache(); }
+void TaskProcessor::FinalizeWorkerThread() noexcept { coro_pool_.ClearLocalCache(); }
 
 void TaskProcessor::ProcessTasks() noexcept {
     while (true) {
@@ -309,13 +399,14 @@ void TaskProcessor::ProcessTasks() noexcept {
         bool has_failed = false;
         try {
             impl::TaskCounter::RunningToken token{GetTaskCounter()};
+            const ev::WakeupBatchScope wakeup_batch;
             context->DoStep();
         } catch (const std::exception& ex) {
             LOG_ERROR() << "uncaught exception from DoStep: " << ex;
             has_failed = true;
         }
 
-        pools_->GetCoroPool().AccountStackUsage();
+        coro_pool_.AccountStackUsage();
 
         if (has_failed || context->IsFinished()) {
             context->FinishDetached();
@@ -328,7 +419,7 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
     const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
 
     if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
-        SetTaskQueueWaitTimeOverloaded(false);
+        SetTaskQueueWaitTimeOverloaded(0);
         return;
     }
 
@@ -338,7 +429,7 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
         const auto wait_time_us = std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
         LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
 
-        SetTaskQueueWaitTimeOverloaded(max_wait_time.count() && wait_time >= max_wait_time);
+        SetTaskQueueWaitTimeOverloaded(GetPrioritiesOverloadedByWaitTime(wait_time, max_wait_time));
 
         if (sensor_wait_time.count() && wait_time >= sensor_wait_time) {
             GetTaskCounter().AccountTaskOverloadSensor();
@@ -351,12 +442,12 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
     }
 
     // Don't cancel critical tasks, but use their timestamp to cancel other tasks
-    if (overloaded_cache_->overloaded_by_wait_time.load()) {
+    if (IsOverloaded(overloaded_cache_->overloaded_by_wait_time.load(), context.GetPriority())) {
         HandleOverload(context, action);
     }
 }
 
-void TaskProcessor::SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept {
+void TaskProcessor::SetTaskQueueWaitTimeOverloaded(std::uint8_t new_value) noexcept {
     auto& atomic = overloaded_cache_->overloaded_by_wait_time;
     // The check helps to reduce contention.
     if (atomic.load(std::memory_order_relaxed) != new_value) {
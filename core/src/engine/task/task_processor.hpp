@@ -10,13 +10,16 @@
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/priority_task_queue.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <engine/task/task_profiler.hpp>
 #include <engine/task/task_queue.hpp>
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/span.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +36,10 @@ namespace ev {
 class ThreadPool;
 }  // namespace ev
 
+namespace coro {
+class Pool;
+}  // namespace coro
+
 class TaskProcessor final {
 public:
     TaskProcessor(TaskProcessorConfig, std::shared_ptr<impl::TaskProcessorPools>);
@@ -42,6 +49,10 @@ public:
 
     void Schedule(impl::TaskContext*);
 
+    /// Schedules the contexts with a single task queue operation if the queue
+    /// supports it
+    void ScheduleBulk(utils::span<impl::TaskContext* const> contexts);
+
     void Adopt(impl::TaskContext& context);
 
     impl::CountedCoroutinePtr GetCoroutine();
@@ -50,6 +61,9 @@ public:
 
     std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() { return pools_; }
 
+    /// Coroutine pool of the TaskProcessorPools used by this task processor
+    coro::Pool& GetCoroPool() noexcept { return coro_pool_; }
+
     const std::string& Name() const { return config_.name; }
 
     impl::TaskCounter& GetTaskCounter() noexcept { return task_counter_; }
@@ -58,6 +72,9 @@ public:
 
     std::size_t GetTaskQueueSize() const;
 
+    /// Writes the queue-specific metrics, if the task queue has any
+    void WriteTaskQueueStatistics(utils::statistics::Writer& writer) const;
+
     std::size_t GetWorkerCount() const { return workers_.size(); }
 
     void SetSettings(const TaskProcessorSettings& settings);
@@ -66,6 +83,24 @@ public:
 
     bool ShouldProfilerForceStacktrace() const;
 
+    bool ShouldProfilerAccountCpu() const noexcept { return profiler_cpu_accounting_.load(std::memory_order_relaxed); }
+
+    bool ShouldProfilerAccountAllocations() const noexcept {
+        return profiler_allocation_accounting_.load(std::memory_order_relaxed);
+    }
+
+    bool ShouldProfilerCollectStacktraces() const noexcept {
+        return profiler_collect_stacktraces_.load(std::memory_order_relaxed);
+    }
+
+    impl::TaskCpuAccounting& GetCpuAccounting() noexcept { return cpu_accounting_; }
+
+    const impl::TaskCpuAccounting& GetCpuAccounting() const noexcept { return cpu_accounting_; }
+
+    impl::TaskAllocationAccounting& GetAllocationAccounting() noexcept { return allocation_accounting_; }
+
+    const impl::TaskAllocationAccounting& GetAllocationAccounting() const noexcept { return allocation_accounting_; }
+
     std::size_t GetTaskTraceMaxCswForNewTask() const;
 
     const std::string& GetTaskTraceLoggerName() const;
@@ -81,12 +116,18 @@ private:
     using OverloadByLength = std::size_t;
 
     struct OverloadedCache final {
-        std::atomic<bool> overloaded_by_wait_time{false};
+        // Count of the lowest priorities overloaded by wait time, see
+        // GetPrioritiesOverloadedByWaitTime()
+        std::atomic<std::uint8_t> overloaded_by_wait_time{0};
         std::atomic<OverloadByLength> overload_by_length{0};
     };
 
     void Cleanup() noexcept;
 
+    void PrepareSchedule(impl::TaskContext* context);
+
+    void PinWorkerThread(std::size_t index) const;
+
     void PrepareWorkerThread(std::size_t index) noexcept;
 
     void FinalizeWorkerThread() noexcept;
@@ -95,7 +136,7 @@ private:
 
     void CheckWaitTime(impl::TaskContext& context);
 
-    void SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept;
+    void SetTaskQueueWaitTimeOverloaded(std::uint8_t new_value) noexcept;
 
     void HandleOverload(impl::TaskContext& context, TaskProcessorSettings::OverloadAction);
 
@@ -107,11 +148,12 @@ private:
     concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock> detached_contexts_{
         impl::DetachedTasksSyncBlock::StopMode::kCancel};
     concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
-    std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
+    std::variant<TaskQueue, WorkStealingTaskQueue, PriorityTaskQueue> task_queue_;
     impl::TaskCounter task_counter_;
 
     const TaskProcessorConfig config_;
     const std::shared_ptr<impl::TaskProcessorPools> pools_;
+    coro::Pool& coro_pool_;
     std::vector<std::thread> workers_;
     logging::LoggerPtr task_trace_logger_{nullptr};
 
@@ -122,10 +164,15 @@ private:
     std::atomic<std::int64_t> action_bit_and_max_task_queue_wait_length_{0};
 
     std::atomic<bool> profiler_force_stacktrace_{false};
+    std::atomic<bool> profiler_cpu_accounting_{false};
+    std::atomic<bool> profiler_allocation_accounting_{false};
+    std::atomic<bool> profiler_collect_stacktraces_{false};
     std::atomic<bool> is_shutting_down_{false};
     std::atomic<bool> task_trace_logger_set_{false};
 
     std::unique_ptr<utils::statistics::ThreadPoolCpuStatsStorage> cpu_stats_storage_{nullptr};
+    impl::TaskCpuAccounting cpu_accounting_;
+    impl::TaskAllocationAccounting allocation_accounting_;
 };
 
 /// Register a function that runs on all threads on task processor creation.
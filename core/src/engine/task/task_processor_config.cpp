@@ -1,8 +1,14 @@
 #include <engine/task/task_processor_config.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <optional>
 
+#include <hostinfo/cgroup.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/utils/from_string.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/text_light.hpp>
@@ -15,6 +21,17 @@ namespace engine {
 
 namespace {
 
+constexpr std::string_view kAutoThreads = "auto";
+
+std::size_t ParseWorkerThreads(const yaml_config::YamlConfig& value) {
+    if (value.As<std::string>() != kAutoThreads) return value.As<std::size_t>();
+
+    const auto cpus = hostinfo::impl::GetAvailableCpus();
+    const auto threads = static_cast<std::size_t>(std::max(std::lround(cpus), 1L));
+    LOG_INFO() << "Using " << threads << " worker_threads for '" << value.GetPath() << "', available CPUs: " << cpus;
+    return threads;
+}
+
 std::string GenerateWorkerThreadName(std::string_view tp_name) {
     static constexpr std::string_view kExpectedSuffix = "-task-processor";
     if (utils::text::EndsWith(tp_name, kExpectedSuffix)) {
@@ -32,8 +49,68 @@ std::string GenerateWorkerThreadName(std::string_view tp_name) {
     ));
 }
 
+constexpr std::string_view kNumaNodesDir = "/sys/devices/system/node";
+
+std::vector<std::size_t> GetNumaNodeCpus(std::size_t numa_node) {
+    const auto path = fmt::format("{}/node{}/cpulist", kNumaNodesDir, numa_node);
+    if (!fs::blocking::FileExists(path)) {
+        throw std::runtime_error(fmt::format("NUMA node {} does not exist: no '{}'", numa_node, path));
+    }
+    auto cpus = ParseCpuList(utils::text::Trim(fs::blocking::ReadFileContents(path)));
+    if (cpus.empty()) {
+        throw std::runtime_error(fmt::format("NUMA node {} has no CPUs", numa_node));
+    }
+    return cpus;
+}
+
+std::vector<std::size_t> GetCpusNumaNodes(const std::vector<std::size_t>& cpus) {
+    std::vector<std::size_t> result(cpus.size(), 0);
+
+    const auto online_path = fmt::format("{}/online", kNumaNodesDir);
+    if (!fs::blocking::FileExists(online_path)) {
+        // No NUMA information, all the CPUs are considered to be on node 0
+        return result;
+    }
+
+    for (const auto numa_node : ParseCpuList(utils::text::Trim(fs::blocking::ReadFileContents(online_path)))) {
+        // Memory-only nodes have an empty cpulist
+        const auto node_cpus = ParseCpuList(utils::text::Trim(
+            fs::blocking::ReadFileContents(fmt::format("{}/node{}/cpulist", kNumaNodesDir, numa_node))
+        ));
+        for (std::size_t i = 0; i < cpus.size(); ++i) {
+            if (std::find(node_cpus.begin(), node_cpus.end(), cpus[i]) != node_cpus.end()) {
+                result[i] = numa_node;
+            }
+        }
+    }
+    return result;
+}
+
 }  // namespace
 
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+    std::vector<std::size_t> result;
+    for (const auto range : utils::text::SplitIntoStringViewVector(cpu_list, ",")) {
+        if (range.empty()) continue;
+
+        const auto dash_pos = range.find('-');
+        if (dash_pos == std::string_view::npos) {
+            result.push_back(utils::FromString<std::size_t>(range));
+            continue;
+        }
+
+        const auto first = utils::FromString<std::size_t>(range.substr(0, dash_pos));
+        const auto last = utils::FromString<std::size_t>(range.substr(dash_pos + 1));
+        if (first > last) {
+            throw std::runtime_error(fmt::format("Invalid CPU range '{}' in cpulist '{}'", range, cpu_list));
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) {
+            result.push_back(cpu);
+        }
+    }
+    return result;
+}
+
 OsScheduling Parse(const yaml_config::YamlConfig& value, formats::parse::To<OsScheduling>) {
     static constexpr utils::TrivialBiMap kMap([](auto selector) {
         return selector()
@@ -49,7 +126,8 @@ TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tas
     static constexpr utils::TrivialBiMap kMap([](auto selector) {
         return selector()
             .Case(TaskQueueType::kGlobalTaskQueue, "global-task-queue")
-            .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing-task-queue");
+            .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing-task-queue")
+            .Case(TaskQueueType::kPriorityTaskQueue, "priority-task-queue");
     });
 
     return utils::ParseFromValueString(value, kMap);
@@ -58,11 +136,32 @@ TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tas
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskProcessorConfig>) {
     TaskProcessorConfig config;
     config.should_guess_cpu_limit = value["guess-cpu-limit"].As<bool>(config.should_guess_cpu_limit);
-    config.worker_threads = value["worker_threads"].As<std::size_t>();
+    config.worker_threads = ParseWorkerThreads(value["worker_threads"]);
     config.thread_name = value["thread_name"].As<std::string>({});
     config.os_scheduling = value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
+    config.global_queue_lifo_slot = value["lifo-slot"].As<bool>(config.global_queue_lifo_slot);
+
+    const auto work_stealing = value["work-stealing"];
+    config.work_stealing_spin_before_sleep = std::chrono::microseconds{
+        work_stealing["spin-before-sleep-us"].As<std::int64_t>(config.work_stealing_spin_before_sleep.count())};
+    config.work_stealing_spinning_workers =
+        work_stealing["spinning-workers"].As<std::size_t>(config.work_stealing_spinning_workers);
+    config.use_big_stack_coro_pool = value["big-stack"].As<bool>(config.use_big_stack_coro_pool);
+
+    const auto cpu_set = value["cpu-set"].As<std::optional<std::string>>();
+    const auto numa_node = value["numa-node"].As<std::optional<std::size_t>>();
+    if (cpu_set && numa_node) {
+        throw std::runtime_error("'cpu-set' and 'numa-node' options are mutually exclusive");
+    }
+    if (cpu_set) {
+        config.cpu_affinity = ParseCpuList(*cpu_set);
+        config.cpu_affinity_numa_nodes = GetCpusNumaNodes(config.cpu_affinity);
+    } else if (numa_node) {
+        config.cpu_affinity = GetNumaNodeCpus(*numa_node);
+        config.cpu_affinity_numa_nodes.assign(config.cpu_affinity.size(), *numa_node);
+    }
 
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
@@ -81,6 +180,26 @@ void TaskProcessorConfig::SetName(const std::string& new_name) {
     }
 }
 
+std::size_t GetWorkerNumaNode(const TaskProcessorConfig& config, std::size_t worker_index) {
+    const auto& numa_nodes = config.cpu_affinity_numa_nodes;
+    if (numa_nodes.empty()) return 0;
+
+    UASSERT(numa_nodes.size() == config.cpu_affinity.size());
+    return numa_nodes[worker_index % numa_nodes.size()];
+}
+
+std::vector<std::size_t> GetWorkerCpus(const TaskProcessorConfig& config, std::size_t worker_index) {
+    const auto& numa_nodes = config.cpu_affinity_numa_nodes;
+    if (numa_nodes.empty()) return config.cpu_affinity;
+
+    const auto numa_node = GetWorkerNumaNode(config, worker_index);
+    std::vector<std::size_t> cpus;
+    for (std::size_t i = 0; i < config.cpu_affinity.size(); ++i) {
+        if (numa_nodes[i] == numa_node) cpus.push_back(config.cpu_affinity[i]);
+    }
+    return cpus;
+}
+
 using OverloadAction = TaskProcessorSettings::OverloadAction;
 
 /// [sample enum parser]
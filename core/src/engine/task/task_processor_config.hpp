@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -18,12 +20,15 @@ enum class OsScheduling {
     kIdle,
 };
 
-enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue };
+enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue, kPriorityTaskQueue };
 
 OsScheduling Parse(const yaml_config::YamlConfig& value, formats::parse::To<OsScheduling>);
 
 TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskQueueType>);
 
+/// Parses a Linux cpulist, e.g. "0-3,8,10-11"
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
 struct TaskProcessorConfig {
     std::string name;
 
@@ -34,6 +39,29 @@ struct TaskProcessorConfig {
     int spinning_iterations{1000};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
 
+    /// kGlobalTaskQueue: run the task scheduled last by a worker on the same
+    /// worker next, bypassing the global queue
+    bool global_queue_lifo_slot{false};
+
+    /// kWorkStealingTaskQueue: how long an idle worker keeps looking for tasks
+    /// before going to sleep
+    std::chrono::microseconds work_stealing_spin_before_sleep{0};
+
+    /// kWorkStealingTaskQueue: how many idle workers keep looking for tasks
+    /// without going to sleep at all
+    std::size_t work_stealing_spinning_workers{0};
+
+    /// Take the coroutines from TaskProcessorPools::GetBigStackCoroPool()
+    bool use_big_stack_coro_pool{false};
+
+    /// CPUs the worker threads are pinned to, empty means no pinning. Filled
+    /// from `cpu-set` or from the CPUs of `numa-node`.
+    std::vector<std::size_t> cpu_affinity;
+
+    /// NUMA node of each CPU from cpu_affinity, in the same order. Empty means
+    /// that all of them are on node 0.
+    std::vector<std::size_t> cpu_affinity_numa_nodes;
+
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
     std::string task_trace_logger_name;
@@ -43,6 +71,14 @@ struct TaskProcessorConfig {
 
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<TaskProcessorConfig>);
 
+/// NUMA node of the worker thread. Workers are spread over the CPUs of
+/// TaskProcessorConfig::cpu_affinity round-robin and get the nodes of those.
+std::size_t GetWorkerNumaNode(const TaskProcessorConfig& config, std::size_t worker_index);
+
+/// CPUs of TaskProcessorConfig::cpu_affinity that are on the NUMA node of the
+/// worker thread, the worker is pinned to them.
+std::vector<std::size_t> GetWorkerCpus(const TaskProcessorConfig& config, std::size_t worker_index);
+
 struct TaskProcessorSettings {
     std::size_t wait_queue_length_limit{0};
     std::chrono::microseconds wait_queue_time_limit{0};
@@ -53,6 +89,9 @@ struct TaskProcessorSettings {
 
     std::chrono::microseconds profiler_execution_slice_threshold{0};
     bool profiler_force_stacktrace{false};
+    bool profiler_cpu_accounting{false};
+    bool profiler_allocation_accounting{false};
+    bool profiler_collect_stacktraces{false};
 };
 
 TaskProcessorSettings::OverloadAction
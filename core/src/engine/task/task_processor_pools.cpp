@@ -10,8 +10,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
-TaskProcessorPools::TaskProcessorPools(coro::PoolConfig coro_pool_config, ev::ThreadPoolConfig ev_pool_config)
+TaskProcessorPools::TaskProcessorPools(
+    coro::PoolConfig coro_pool_config,
+    ev::ThreadPoolConfig ev_pool_config,
+    std::optional<coro::PoolConfig> big_stack_coro_pool_config
+)
     : coro_pool_(std::move(coro_pool_config), &TaskContext::CoroFunc),
+      big_stack_coro_pool_(
+          big_stack_coro_pool_config
+              ? std::make_unique<CoroPool>(std::move(*big_stack_coro_pool_config), &TaskContext::CoroFunc)
+              : nullptr
+      ),
       event_thread_pool_(std::move(ev_pool_config), ev::ThreadPool::kUseDefaultEvLoop) {
     const bool old_value = std::exchange(logging::impl::has_background_threads_which_can_log, true);
     UASSERT_MSG(
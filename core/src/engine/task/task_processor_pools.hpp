@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include <engine/coro/pool.hpp>
 #include <engine/ev/thread_pool.hpp>
 
@@ -13,15 +16,27 @@ class TaskProcessorPools final {
 public:
     using CoroPool = coro::Pool;
 
-    TaskProcessorPools(coro::PoolConfig coro_pool_config, ev::ThreadPoolConfig ev_pool_config);
+    TaskProcessorPools(
+        coro::PoolConfig coro_pool_config,
+        ev::ThreadPoolConfig ev_pool_config,
+        std::optional<coro::PoolConfig> big_stack_coro_pool_config = {}
+    );
 
     ~TaskProcessorPools();
 
     CoroPool& GetCoroPool() { return coro_pool_; }
+
+    /// @brief Pool of coroutines with larger stacks for the task processors
+    /// with `big-stack: true`, nullptr if not configured.
+    /// @note Coroutine pools have thread-local caches, so a worker thread must
+    /// only use a single pool.
+    CoroPool* GetBigStackCoroPool() { return big_stack_coro_pool_.get(); }
+
     ev::ThreadPool& EventThreadPool() { return event_thread_pool_; }
 
 private:
     CoroPool coro_pool_;
+    std::unique_ptr<CoroPool> big_stack_coro_pool_;
     ev::ThreadPool event_thread_pool_;
 };
 
@@ -1,5 +1,10 @@
 #include <engine/task/task_processor.hpp>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <engine/impl/standalone.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -10,6 +15,44 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+// A single worker makes the order of the task execution match the order
+// of the pops from the queue.
+void RunWithPriorityTaskQueue(utils::function_ref<void()> payload) {
+    engine::TaskProcessorConfig config;
+    config.worker_threads = 1;
+    config.thread_name = "priority-tp";
+    config.task_processor_queue = engine::TaskQueueType::kPriorityTaskQueue;
+
+    engine::impl::TaskProcessorHolder task_processor{
+        std::make_unique<engine::TaskProcessor>(std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+    engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+constexpr engine::TaskPriority kPriorities[] = {
+    engine::TaskPriority::kHigh,
+    engine::TaskPriority::kNormal,
+    engine::TaskPriority::kLow,
+};
+
+// Schedules `count` tasks of each priority, interleaved. The last task is
+// of kLow priority, so it is popped last: the kLow queue gets a single pop
+// per round while the other queues are not empty.
+template <typename Function>
+std::vector<engine::TaskWithResult<void>> ScheduleOfEachPriority(std::size_t count, const Function& f) {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(count * std::size(kPriorities));
+    for (std::size_t i = 0; i < count; ++i) {
+        for (const auto priority : kPriorities) {
+            tasks.push_back(engine::AsyncNoSpan(priority, f));
+        }
+    }
+    return tasks;
+}
+
+}  // namespace
+
 UTEST(TaskProcessor, Overload) {
     engine::TaskProcessorSettings settings;
     settings.overload_action = engine::TaskProcessorSettings::OverloadAction::kCancel;
@@ -74,4 +117,143 @@ UTEST_MT(TaskProcessor, MetricsAliveAndRunning, 2) {
     EXPECT_EQ(task_counter.GetRunningTasks(), 1);
 }
 
+UTEST(TaskProcessor, PriorityInherited) {
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kNormal);
+
+    engine::current_task::SetPriority(engine::TaskPriority::kLow);
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kLow);
+
+    auto child = engine::AsyncNoSpan([] {
+        auto grandchild = engine::AsyncNoSpan([] { return engine::current_task::GetPriority(); });
+        return grandchild.Get();
+    });
+    EXPECT_EQ(child.Get(), engine::TaskPriority::kLow);
+
+    auto high = engine::AsyncNoSpan(engine::TaskPriority::kHigh, [] { return engine::current_task::GetPriority(); });
+    EXPECT_EQ(high.Get(), engine::TaskPriority::kHigh);
+
+    engine::current_task::SetPriority(engine::TaskPriority::kNormal);
+}
+
+TEST(TaskProcessor, PriorityQueueWeightedDequeue) {
+    constexpr std::size_t kTasksOfEachPriority = 40;
+    // While all the queues are non-empty, each round of 8 + 4 + 1 pops takes
+    // 8 kHigh, 4 kNormal and 1 kLow tasks, whatever the round offset is.
+    constexpr std::size_t kRounds = 4;
+    constexpr std::size_t kRoundLength = 8 + 4 + 1;
+    static_assert(kRounds * 8 < kTasksOfEachPriority);
+
+    RunWithPriorityTaskQueue([&] {
+        std::vector<engine::TaskPriority> executed;
+        executed.reserve(kTasksOfEachPriority * std::size(kPriorities));
+
+        auto tasks = ScheduleOfEachPriority(kTasksOfEachPriority, [&executed] {
+            executed.push_back(engine::current_task::GetPriority());
+        });
+        // Waiting for any other task would put us into the queue in the middle
+        tasks.back().Wait();
+        for (auto& task : tasks) task.Get();
+
+        ASSERT_EQ(executed.size(), tasks.size());
+        EXPECT_EQ(executed.back(), engine::TaskPriority::kLow);
+
+        const auto count_in_window = [&executed](engine::TaskPriority priority) {
+            const auto window_end = executed.begin() + kRounds * kRoundLength;
+            return static_cast<std::size_t>(std::count(executed.begin(), window_end, priority));
+        };
+        EXPECT_EQ(count_in_window(engine::TaskPriority::kHigh), kRounds * 8);
+        EXPECT_EQ(count_in_window(engine::TaskPriority::kNormal), kRounds * 4);
+        EXPECT_EQ(count_in_window(engine::TaskPriority::kLow), kRounds * 1);
+    });
+}
+
+TEST(TaskProcessor, PriorityWaitTimeOverload) {
+    constexpr std::size_t kTasksOfEachPriority = 20;
+    // Only every 5th task gets the queue wait timestamp, so the first few tasks
+    // of the batch may be taken before the overload is detected.
+    constexpr std::size_t kMinCancelledTasks = kTasksOfEachPriority / 2;
+    constexpr std::chrono::milliseconds kWaitTimeLimit{200};
+
+    struct Case final {
+        std::chrono::milliseconds queue_wait_time;
+        bool is_cancelled[std::size(kPriorities)];
+    };
+    // kLow is cancelled at 0.5x of the limit, kNormal at 1x, kHigh at 2x
+    constexpr Case kCases[] = {
+        {kWaitTimeLimit * 3 / 4, {false, false, true}},
+        {kWaitTimeLimit * 3 / 2, {false, true, true}},
+        {kWaitTimeLimit * 5 / 2, {true, true, true}},
+    };
+
+    RunWithPriorityTaskQueue([&] {
+        auto& task_processor = engine::current_task::GetTaskProcessor();
+
+        // The test itself must survive the overload
+        engine::CriticalAsyncNoSpan([&] {
+            for (const auto& test_case : kCases) {
+                engine::TaskProcessorSettings settings;
+                settings.overload_action = engine::TaskProcessorSettings::OverloadAction::kCancel;
+                settings.wait_queue_time_limit = kWaitTimeLimit;
+                task_processor.SetSettings(settings);
+
+                auto tasks = ScheduleOfEachPriority(kTasksOfEachPriority, [] {});
+                // Block the only worker to keep the tasks in the queue
+                std::this_thread::sleep_for(test_case.queue_wait_time);
+                tasks.back().Wait();
+
+                std::size_t cancelled[std::size(kPriorities)]{};
+                for (std::size_t i = 0; i < tasks.size(); ++i) {
+                    tasks[i].Wait();
+                    if (tasks[i].GetState() == engine::Task::State::kCancelled) {
+                        ++cancelled[i % std::size(kPriorities)];
+                    }
+                }
+
+                for (std::size_t priority = 0; priority < std::size(kPriorities); ++priority) {
+                    if (test_case.is_cancelled[priority]) {
+                        EXPECT_GE(cancelled[priority], kMinCancelledTasks)
+                            << "priority=" << priority << " wait=" << test_case.queue_wait_time.count() << "ms";
+                    } else {
+                        EXPECT_EQ(cancelled[priority], 0)
+                            << "priority=" << priority << " wait=" << test_case.queue_wait_time.count() << "ms";
+                    }
+                }
+
+                // Drop the overloaded state before the next case
+                task_processor.SetSettings({});
+                engine::Yield();
+            }
+        }).Get();
+    });
+}
+
+TEST(TaskProcessorConfig, ParseCpuList) {
+    using Cpus = std::vector<std::size_t>;
+    EXPECT_EQ(engine::ParseCpuList(""), Cpus{});
+    EXPECT_EQ(engine::ParseCpuList("3"), Cpus{3});
+    EXPECT_EQ(engine::ParseCpuList("0-3"), (Cpus{0, 1, 2, 3}));
+    EXPECT_EQ(engine::ParseCpuList("0-1,8,10-11"), (Cpus{0, 1, 8, 10, 11}));
+    EXPECT_ANY_THROW(engine::ParseCpuList("3-1"));
+    EXPECT_ANY_THROW(engine::ParseCpuList("a-b"));
+}
+
+TEST(TaskProcessorConfig, WorkerPinning) {
+    using Cpus = std::vector<std::size_t>;
+    engine::TaskProcessorConfig config;
+    config.cpu_affinity = {0, 1, 8, 9, 2};
+    config.cpu_affinity_numa_nodes = {0, 0, 1, 1, 0};
+
+    EXPECT_EQ(engine::GetWorkerNumaNode(config, 0), 0);
+    EXPECT_EQ(engine::GetWorkerNumaNode(config, 2), 1);
+    EXPECT_EQ(engine::GetWorkerNumaNode(config, 7), 1);
+    EXPECT_EQ(engine::GetWorkerCpus(config, 0), (Cpus{0, 1, 2}));
+    EXPECT_EQ(engine::GetWorkerCpus(config, 3), (Cpus{8, 9}));
+    EXPECT_EQ(engine::GetWorkerCpus(config, 4), (Cpus{0, 1, 2}));
+
+    // Without NUMA information all the CPUs are on node 0
+    config.cpu_affinity_numa_nodes.clear();
+    EXPECT_EQ(engine::GetWorkerNumaNode(config, 2), 0);
+    EXPECT_EQ(engine::GetWorkerCpus(config, 2), config.cpu_affinity);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,240 @@
+#include <engine/task/task_profiler.hpp>
+
+#include <time.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <boost/stacktrace.hpp>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+constexpr std::size_t kMaxSpanNames = 1000;
+constexpr std::size_t kMaxStacktraces = 1000;
+constexpr std::size_t kMaxStacktraceDepth = 64;
+
+struct StacktraceHash final {
+    std::size_t operator()(const boost::stacktrace::stacktrace& stacktrace) const noexcept {
+        return boost::stacktrace::hash_value(stacktrace);
+    }
+};
+
+class SlowSliceStacktraces final {
+public:
+    void Add(boost::stacktrace::stacktrace&& stacktrace) {
+        const std::lock_guard lock{mutex_};
+        const auto it = counts_.find(stacktrace);
+        if (it != counts_.end()) {
+            ++it->second;
+        } else if (counts_.size() < kMaxStacktraces) {
+            counts_.emplace(std::move(stacktrace), 1);
+        }
+    }
+
+    std::string GetFolded() const {
+        std::vector<std::pair<boost::stacktrace::stacktrace, std::uint64_t>> counts;
+        {
+            const std::lock_guard lock{mutex_};
+            counts.assign(counts_.begin(), counts_.end());
+        }
+
+        // Symbolization is slow, so it is done outside of the lock
+        std::string result;
+        for (const auto& [stacktrace, count] : counts) {
+            const auto& frames = stacktrace.as_vector();
+            for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+                if (it != frames.rbegin()) result += ';';
+                auto name = it->name();
+                if (name.empty()) name = fmt::format("{}", it->address());
+                // ';' and ' ' are the separators of the format
+                std::replace(name.begin(), name.end(), ';', ':');
+                std::replace(name.begin(), name.end(), ' ', '_');
+                result += name;
+            }
+            result += fmt::format(" {}\n", count);
+        }
+        return result;
+    }
+
+    void Reset() noexcept {
+        const std::lock_guard lock{mutex_};
+        counts_.clear();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_map<boost::stacktrace::stacktrace, std::uint64_t, StacktraceHash> counts_;
+};
+
+SlowSliceStacktraces& GetSlowSliceStacktraces() {
+    static SlowSliceStacktraces stacktraces;
+    return stacktraces;
+}
+
+struct HeapProfileSpanFilter final {
+    std::atomic<bool> is_set{false};
+    rcu::Variable<std::string, rcu::BlockingRcuTraits> span_name;
+};
+
+HeapProfileSpanFilter& GetHeapProfileSpanFilter() {
+    static HeapProfileSpanFilter filter;
+    return filter;
+}
+
+// Whether the heap profile sampling of the thread was changed by the filter
+compiler::ThreadLocal local_heap_profile_filtered = [] { return false; };
+
+}  // namespace
+
+std::chrono::nanoseconds GetThreadCpuTime() noexcept {
+    struct timespec ts {};
+    [[maybe_unused]] const auto res = ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    UASSERT(res == 0);
+    return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+void TaskCpuAccounting::Account(std::string_view span_name, std::chrono::nanoseconds cpu_time) {
+    {
+        const auto counters = counters_.Read();
+        if (const auto* counter = utils::impl::FindTransparentOrNullptr(*counters, span_name)) {
+            (*counter)->fetch_add(cpu_time.count(), std::memory_order_relaxed);
+            return;
+        }
+        if (counters->size() >= kMaxSpanNames) {
+            other_spans_.fetch_add(cpu_time.count(), std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    auto counters = counters_.StartWrite();
+    auto& counter = (*counters)[std::string{span_name}];
+    if (!counter) counter = std::make_shared<Counter>(0);
+    counter->fetch_add(cpu_time.count(), std::memory_order_relaxed);
+    counters.Commit();
+}
+
+void TaskCpuAccounting::Visit(
+    utils::function_ref<void(std::string_view span_name, std::chrono::nanoseconds cpu_time)> visitor
+) const {
+    const auto counters = counters_.Read();
+    for (const auto& [name, counter] : *counters) {
+        visitor(name, std::chrono::nanoseconds{counter->load(std::memory_order_relaxed)});
+    }
+    const auto other_spans = other_spans_.load(std::memory_order_relaxed);
+    if (other_spans != 0) visitor(kOtherSpansName, std::chrono::nanoseconds{other_spans});
+}
+
+void TaskAllocationAccounting::Account(
+    std::string_view span_name,
+    std::uint64_t allocated_bytes,
+    std::uint64_t deallocated_bytes
+) {
+    const auto account = [&](Counters& counters) {
+        counters.allocated.fetch_add(allocated_bytes, std::memory_order_relaxed);
+        counters.deallocated.fetch_add(deallocated_bytes, std::memory_order_relaxed);
+    };
+
+    {
+        const auto counters = counters_.Read();
+        if (const auto* counter = utils::impl::FindTransparentOrNullptr(*counters, span_name)) {
+            account(**counter);
+            return;
+        }
+        if (counters->size() >= kMaxSpanNames) {
+            account(other_spans_);
+            return;
+        }
+    }
+
+    auto counters = counters_.StartWrite();
+    auto& counter = (*counters)[std::string{span_name}];
+    if (!counter) counter = std::make_shared<Counters>();
+    account(*counter);
+    counters.Commit();
+}
+
+void TaskAllocationAccounting::Visit(
+    utils::function_ref<
+        void(std::string_view span_name, std::uint64_t allocated_bytes, std::uint64_t deallocated_bytes)> visitor
+) const {
+    const auto counters = counters_.Read();
+    for (const auto& [name, counter] : *counters) {
+        visitor(
+            name,
+            counter->allocated.load(std::memory_order_relaxed),
+            counter->deallocated.load(std::memory_order_relaxed)
+        );
+    }
+    const auto other_allocated = other_spans_.allocated.load(std::memory_order_relaxed);
+    const auto other_deallocated = other_spans_.deallocated.load(std::memory_order_relaxed);
+    if (other_allocated != 0 || other_deallocated != 0) {
+        visitor(TaskCpuAccounting::kOtherSpansName, other_allocated, other_deallocated);
+    }
+}
+
+void SetHeapProfileSpanFilter(std::optional<std::string> span_name) {
+    auto& filter = GetHeapProfileSpanFilter();
+    if (!span_name) {
+        filter.is_set.store(false, std::memory_order_relaxed);
+        utils::jemalloc::SetProfThreadActiveInit(true);
+        return;
+    }
+    filter.span_name.Assign(std::move(*span_name));
+    filter.is_set.store(true, std::memory_order_relaxed);
+    // Threads that do not run tasks are not sampled either
+    utils::jemalloc::SetProfThreadActiveInit(false);
+}
+
+void HeapProfileSliceStarted() {
+    auto& filter = GetHeapProfileSpanFilter();
+    auto filtered = local_heap_profile_filtered.Use();
+    if (!filter.is_set.load(std::memory_order_relaxed)) {
+        if (*filtered) {
+            utils::jemalloc::SetThreadProfActive(true);
+            *filtered = false;
+        }
+        return;
+    }
+
+    *filtered = true;
+    const auto* span = tracing::Span::CurrentSpanUnchecked();
+    const auto filter_span_name = filter.span_name.Read();
+    utils::jemalloc::SetThreadProfActive(span && span->GetName() == *filter_span_name);
+}
+
+void HeapProfileSliceStopped() noexcept {
+    if (!GetHeapProfileSpanFilter().is_set.load(std::memory_order_relaxed)) return;
+
+    auto filtered = local_heap_profile_filtered.Use();
+    *filtered = true;
+    utils::jemalloc::SetThreadProfActive(false);
+}
+
+void CollectSlowSliceStacktrace() noexcept {
+    try {
+        GetSlowSliceStacktraces().Add(boost::stacktrace::stacktrace{1, kMaxStacktraceDepth});
+    } catch (const std::exception& ex) {
+        UASSERT_MSG(false, ex.what());
+    }
+}
+
+std::string GetSlowSliceStacktracesFolded() { return GetSlowSliceStacktraces().GetFolded(); }
+
+void ResetSlowSliceStacktraces() noexcept { GetSlowSliceStacktraces().Reset(); }
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Returns the CPU time consumed by the current thread
+std::chrono::nanoseconds GetThreadCpuTime() noexcept;
+
+/// @brief Cumulative CPU time of the task execution slices of a task
+/// processor, by the name of the span that was current at the end of a slice.
+///
+/// The number of distinct span names is limited, the time of the slices with
+/// the names above the limit is accounted to kOtherSpansName.
+class TaskCpuAccounting final {
+public:
+    static constexpr std::string_view kOtherSpansName = "other";
+    static constexpr std::string_view kNoSpanName = "no-span";
+
+    void Account(std::string_view span_name, std::chrono::nanoseconds cpu_time);
+
+    void Visit(utils::function_ref<void(std::string_view span_name, std::chrono::nanoseconds cpu_time)> visitor) const;
+
+private:
+    using Counter = std::atomic<std::int64_t>;
+    using CounterMap = utils::impl::TransparentMap<std::string, std::shared_ptr<Counter>>;
+
+    rcu::Variable<CounterMap, rcu::BlockingRcuTraits> counters_;
+    Counter other_spans_{0};
+};
+
+/// @brief Cumulative bytes allocated and deallocated by the task execution
+/// slices of a task processor, by the name of the span that was current at the
+/// end of a slice.
+///
+/// The same limit on the distinct span names as in TaskCpuAccounting applies.
+class TaskAllocationAccounting final {
+public:
+    void Account(std::string_view span_name, std::uint64_t allocated_bytes, std::uint64_t deallocated_bytes);
+
+    void Visit(
+        utils::function_ref<
+            void(std::string_view span_name, std::uint64_t allocated_bytes, std::uint64_t deallocated_bytes)> visitor
+    ) const;
+
+private:
+    struct Counters final {
+        std::atomic<std::uint64_t> allocated{0};
+        std::atomic<std::uint64_t> deallocated{0};
+    };
+    using CounterMap = utils::impl::TransparentMap<std::string, std::shared_ptr<Counters>>;
+
+    rcu::Variable<CounterMap, rcu::BlockingRcuTraits> counters_;
+    Counters other_spans_;
+};
+
+/// @brief Limits the jemalloc heap profile sampling to the task execution
+/// slices that start within a span with the specified name.
+///
+/// std::nullopt samples all the allocations, as jemalloc does by default.
+void SetHeapProfileSpanFilter(std::optional<std::string> span_name);
+
+/// Enables the heap profile sampling in the current thread if the current
+/// span matches the span filter
+void HeapProfileSliceStarted();
+
+/// Disables the heap profile sampling in the current thread if the span
+/// filter is set, so that the non-task code is not sampled
+void HeapProfileSliceStopped() noexcept;
+
+/// @brief Remembers the stacktrace of the current too long execution slice.
+///
+/// The stacktraces of all the task processors are collected together and
+/// may be retrieved by server::handlers::TaskProfiler.
+void CollectSlowSliceStacktrace() noexcept;
+
+/// Returns the collected stacktraces in the folded format of flame graph
+/// tools: `outer;...;inner count` per line
+std::string GetSlowSliceStacktracesFolded();
+
+void ResetSlowSliceStacktraces() noexcept;
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
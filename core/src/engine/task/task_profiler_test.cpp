@@ -0,0 +1,91 @@
+#include <engine/task/task_profiler.hpp>
+
+#include <map>
+#include <string>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::map<std::string, std::chrono::nanoseconds> Collect(const engine::impl::TaskCpuAccounting& accounting) {
+    std::map<std::string, std::chrono::nanoseconds> result;
+    accounting.Visit([&result](std::string_view span_name, std::chrono::nanoseconds cpu_time) {
+        result.emplace(span_name, cpu_time);
+    });
+    return result;
+}
+
+}  // namespace
+
+TEST(TaskCpuAccounting, Basic) {
+    using std::chrono::nanoseconds;
+    engine::impl::TaskCpuAccounting accounting;
+    EXPECT_TRUE(Collect(accounting).empty());
+
+    accounting.Account("http/handler-first", nanoseconds{10});
+    accounting.Account("http/handler-second", nanoseconds{5});
+    accounting.Account("http/handler-first", nanoseconds{20});
+
+    const std::map<std::string, nanoseconds> expected{
+        {"http/handler-first", nanoseconds{30}},
+        {"http/handler-second", nanoseconds{5}},
+    };
+    EXPECT_EQ(Collect(accounting), expected);
+}
+
+TEST(TaskCpuAccounting, TooManySpanNames) {
+    using std::chrono::nanoseconds;
+    engine::impl::TaskCpuAccounting accounting;
+    for (int i = 0; i < 2000; ++i) {
+        accounting.Account("span-" + std::to_string(i), nanoseconds{1});
+    }
+
+    const auto collected = Collect(accounting);
+    ASSERT_EQ(collected.count(std::string{engine::impl::TaskCpuAccounting::kOtherSpansName}), 1);
+    EXPECT_EQ(collected.size(), 1001);
+    EXPECT_EQ(collected.at(std::string{engine::impl::TaskCpuAccounting::kOtherSpansName}), nanoseconds{1000});
+}
+
+TEST(TaskCpuAccounting, ThreadCpuTime) {
+    const auto start = engine::impl::GetThreadCpuTime();
+    volatile std::uint64_t sum = 0;
+    for (std::uint64_t i = 0; i < 10'000'000; ++i) sum = sum + i;
+    EXPECT_GT(engine::impl::GetThreadCpuTime(), start);
+}
+
+TEST(TaskAllocationAccounting, Basic) {
+    engine::impl::TaskAllocationAccounting accounting;
+
+    accounting.Account("http/handler-first", 100, 10);
+    accounting.Account("http/handler-second", 5, 0);
+    accounting.Account("http/handler-first", 20, 30);
+
+    std::map<std::string, std::pair<std::uint64_t, std::uint64_t>> collected;
+    accounting.Visit([&collected](std::string_view span_name, std::uint64_t allocated, std::uint64_t deallocated) {
+        collected.emplace(span_name, std::make_pair(allocated, deallocated));
+    });
+
+    const std::map<std::string, std::pair<std::uint64_t, std::uint64_t>> expected{
+        {"http/handler-first", {120, 40}},
+        {"http/handler-second", {5, 0}},
+    };
+    EXPECT_EQ(collected, expected);
+}
+
+UTEST(TaskProfiler, CollectStacktraces) {
+    engine::impl::ResetSlowSliceStacktraces();
+    EXPECT_EQ(engine::impl::GetSlowSliceStacktracesFolded(), "");
+
+    for (int i = 0; i < 3; ++i) engine::impl::CollectSlowSliceStacktrace();
+
+    const auto folded = engine::impl::GetSlowSliceStacktracesFolded();
+    EXPECT_NE(folded, "");
+    EXPECT_EQ(folded.back(), '\n');
+
+    engine::impl::ResetSlowSliceStacktraces();
+    EXPECT_EQ(engine::impl::GetSlowSliceStacktracesFolded(), "");
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include <engine/task/task_queue.hpp>
 
+#include <utility>
+
+#include <userver/compiler/thread_local.hpp>
+
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -8,22 +12,70 @@ namespace engine {
 
 namespace {
 constexpr std::size_t kSemaphoreInitialCount = 0;
-}
+
+// How many times in a row a worker may take a task from its LIFO slot before
+// giving the tasks of the global queue a chance to run
+constexpr std::size_t kMaxLifoSlotPolls = 3;
+
+// The task that was scheduled last by the current worker. It is run next by
+// the same worker, skipping the global queue and the semaphore notification.
+// Most of the time it is a task that was just spawned or woken up by a
+// task that is going to wait for it.
+struct WorkerSlot final {
+    const TaskQueue* owner{nullptr};
+    impl::TaskContext* task{nullptr};
+    std::size_t consecutive_polls{0};
+};
+
+compiler::ThreadLocal local_slot = [] { return WorkerSlot{}; };
+}  // namespace
 
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations),
+      lifo_slot_enabled_(config.global_queue_lifo_slot) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
     UASSERT(context);
+    {
+        auto slot = local_slot.Use();
+        if (slot->owner == this) {
+            auto* const evicted = std::exchange(slot->task, context.detach());
+            if (evicted) DoPush(evicted);
+            return;
+        }
+    }
     DoPush(context.get());
     context.detach();
 }
 
+void TaskQueue::PushBulk(utils::span<impl::TaskContext* const> contexts) {
+    for (auto* const context : contexts) {
+        UASSERT(context);
+        intrusive_ptr_add_ref(context);
+    }
+    queue_.enqueue_bulk(contexts.data(), contexts.size());
+    queue_semaphore_.signal(static_cast<moodycamel::LightweightSemaphore::ssize_t>(contexts.size()));
+}
+
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
     // Current thread handles only a single TaskProcessor, so it's safe to store
     // a token for the task processor in a thread-local variable.
     thread_local moodycamel::ConsumerToken token(queue_);
 
+    {
+        auto slot = local_slot.Use();
+        if (slot->owner == this) {
+            if (slot->task) {
+                if (slot->consecutive_polls < kMaxLifoSlotPolls) {
+                    ++slot->consecutive_polls;
+                    return {std::exchange(slot->task, nullptr), /* add_ref= */ false};
+                }
+                DoPush(std::exchange(slot->task, nullptr));
+            }
+            slot->consecutive_polls = 0;
+        }
+    }
+
     boost::intrusive_ptr<impl::TaskContext> context{
         DoPopBlocking(token),
         /* add_ref= */ false};
@@ -40,7 +92,12 @@ void TaskQueue::StopProcessing() { DoPush(nullptr); }
 
 std::size_t TaskQueue::GetSizeApproximate() const noexcept { return queue_.size_approx(); }
 
-void TaskQueue::PrepareWorker(std::size_t) {}
+void TaskQueue::PrepareWorker(std::size_t) {
+    if (lifo_slot_enabled_) {
+        auto slot = local_slot.Use();
+        slot->owner = this;
+    }
+}
 
 void TaskQueue::DoPush(impl::TaskContext* context) {
     // This piece of code is copy-pasted from
@@ -5,6 +5,7 @@
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_processor_config.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,6 +21,10 @@ public:
 
     void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
 
+    /// Pushes the contexts with a single queue operation, takes a reference to
+    /// each of them
+    void PushBulk(utils::span<impl::TaskContext* const> contexts);
+
     // Returns nullptr as a stop signal
     boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
@@ -36,6 +41,7 @@ private:
 
     moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
     moodycamel::LightweightSemaphore queue_semaphore_;
+    const bool lifo_slot_enabled_;
 };
 
 }  // namespace engine
@@ -13,6 +13,9 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/span.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <compiler/relax_cpu.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <engine/task/work_stealing_queue/task_queue.hpp>
@@ -43,6 +46,23 @@ constexpr std::size_t kFrequencyGlobalQueuePop = 61;
 constexpr std::size_t kFrequencyStealingBackgroundQueuePop = 10;
 }  // namespace
 
+ConsumerStatistics& ConsumerStatistics::operator+=(const ConsumerStatistics& other) noexcept {
+    stolen_tasks += other.stolen_tasks;
+    spins += other.spins;
+    spin_hits += other.spin_hits;
+    parks += other.parks;
+    wakeups += other.wakeups;
+    return *this;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ConsumerStatistics& stats) {
+    writer["stolen-tasks"] = stats.stolen_tasks;
+    writer["spins"] = stats.spins;
+    writer["spin-hits"] = stats.spin_hits;
+    writer["parks"] = stats.parks;
+    writer["wakeups"] = stats.wakeups;
+}
+
 Consumer::Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_manager)
     : owner_(owner),
       consumers_manager_(consumers_manager),
@@ -79,8 +99,16 @@ std::size_t Consumer::GetLocalQueueSize() const noexcept {
 
 WorkStealingTaskQueue* Consumer::GetOwner() const noexcept { return &owner_; }
 
+ConsumerStatistics Consumer::GetStatistics() const noexcept {
+    return {stolen_tasks_.Load(), spins_.Load(), spin_hits_.Load(), parks_.Load(), wakeups_.Load()};
+}
+
 void Consumer::SetIndex(std::size_t index) noexcept { inner_index_ = index; }
 
+void Consumer::SetNumaNode(std::size_t numa_node) noexcept { numa_node_ = numa_node; }
+
+std::size_t Consumer::GetNumaNode() const noexcept { return numa_node_; }
+
 bool Consumer::IsStopped() const noexcept { return consumers_manager_.IsStopped(); }
 
 void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
@@ -100,23 +128,36 @@ void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
     }
 }
 
+std::size_t Consumer::StealFromAnotherConsumers(std::size_t to_steal_count, NodeLocality locality) {
+    std::size_t stealed_size = 0;
+    const std::size_t start_index = rnd_() % owner_.consumers_count_;
+    const std::size_t numa_node = GetNumaNode();
+    for (std::size_t shift = 0; shift < owner_.consumers_count_ && to_steal_count > 0 && stealed_size == 0; ++shift) {
+        std::size_t index = (start_index + shift) % owner_.consumers_count_;
+        Consumer* victim = &owner_.consumers_[index];
+        if (victim == this) {
+            continue;
+        }
+        // Stealing cache-hot task contexts across NUMA nodes leads to remote
+        // memory traffic, so consumers from other nodes are robbed last.
+        if ((victim->GetNumaNode() == numa_node) != (locality == NodeLocality::kSameNode)) {
+            continue;
+        }
+        const std::size_t tasks_count =
+            victim->Steal(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
+        stealed_size += tasks_count;
+        to_steal_count -= tasks_count;
+    }
+    if (stealed_size) stolen_tasks_.AddAsSingleProducer(utils::statistics::Rate{stealed_size});
+    return stealed_size;
+}
+
 impl::TaskContext*
 Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal_count) {
     std::size_t stealed_size = 0;
     for (std::size_t i = 0; i < attempts && to_steal_count > 0 && stealed_size == 0; ++i) {
-        std::size_t start_index = rnd_() % owner_.consumers_count_;
-        for (std::size_t shift = 0; shift < owner_.consumers_count_ && to_steal_count > 0 && stealed_size == 0;
-             ++shift) {
-            std::size_t index = (start_index + shift) % owner_.consumers_count_;
-            Consumer* victim = &owner_.consumers_[index];
-            if (victim == this) {
-                continue;
-            }
-            const std::size_t tasks_count =
-                victim->Steal(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
-            stealed_size += tasks_count;
-            to_steal_count -= tasks_count;
-        }
+        stealed_size = StealFromAnotherConsumers(to_steal_count, NodeLocality::kSameNode);
+        to_steal_count -= stealed_size;
 
         if (stealed_size == 0) {
             impl::TaskContext* ctx = owner_.global_queue_.TryPop(global_queue_token_);
@@ -126,6 +167,11 @@ Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std:
             }
         }
 
+        if (stealed_size == 0 && owner_.is_multi_node_) {
+            stealed_size = StealFromAnotherConsumers(to_steal_count, NodeLocality::kOtherNode);
+            to_steal_count -= stealed_size;
+        }
+
         if (stealed_size == 0 && i % kFrequencyStealingBackgroundQueuePop == 0) {
             impl::TaskContext* ctx = owner_.background_queue_.TryPop(background_queue_token_);
             if (ctx) {
@@ -240,6 +286,40 @@ impl::TaskContext* Consumer::TryPopBeforeSleep() {
     return nullptr;
 }
 
+impl::TaskContext* Consumer::SpinBeforeSleep() {
+    const bool keep_spinning = consumers_manager_.TryStartKeptSpinning();
+    if (!keep_spinning && owner_.spin_before_sleep_.count() == 0) {
+        return nullptr;
+    }
+
+    // Spinning consumers are accounted as stealers, so that new tasks do not
+    // wake up the sleeping consumers while someone is looking for tasks
+    if (!consumers_manager_.AllowStealing()) {
+        if (keep_spinning) consumers_manager_.StopKeptSpinning();
+        return nullptr;
+    }
+    spins_.AddAsSingleProducer(utils::statistics::Rate{1});
+
+    const auto deadline = std::chrono::steady_clock::now() + owner_.spin_before_sleep_;
+    compiler::RelaxCpu relax;
+    impl::TaskContext* context = nullptr;
+    while (!IsStopped()) {
+        context = TryPopBeforeSleep();
+        if (context) break;
+        if (!keep_spinning && std::chrono::steady_clock::now() >= deadline) break;
+        relax();
+    }
+
+    const bool last = consumers_manager_.StopStealing();
+    if (keep_spinning) consumers_manager_.StopKeptSpinning();
+    if (context) {
+        spin_hits_.AddAsSingleProducer(utils::statistics::Rate{1});
+        // there are potentially other tasks that require a consumer
+        if (last) consumers_manager_.WakeUpOne();
+    }
+    return context;
+}
+
 impl::TaskContext* Consumer::TryPopLocal() {
     impl::TaskContext* context = local_queue_.TryPop();
     if (context) {
@@ -275,6 +355,10 @@ impl::TaskContext* Consumer::DoPop() {
         if (context) {
             return context;
         }
+        context = SpinBeforeSleep();
+        if (context) {
+            return context;
+        }
         const std::int32_t sleep_state = sleep_counter_.load();
         consumers_manager_.NotifySleep(this);
 
@@ -289,6 +373,7 @@ impl::TaskContext* Consumer::DoPop() {
             return nullptr;
         }
 
+        parks_.AddAsSingleProducer(utils::statistics::Rate{1});
         Sleep(sleep_state);
         consumers_manager_.NotifyWakeUp(this);
     }
@@ -309,6 +394,7 @@ void Consumer::Sleep(const std::int32_t old_sleep_counter) {
 }
 
 void Consumer::WakeUp() {
+    ++wakeups_;
 #ifdef __linux__
     sleep_counter_.fetch_add(1);
     FutexWake(&sleep_counter_, 1);
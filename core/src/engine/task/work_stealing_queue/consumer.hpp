@@ -1,12 +1,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <random>
 
 #include <engine/task/work_stealing_queue/global_queue.hpp>
 #include <engine/task/work_stealing_queue/local_queue.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,6 +21,21 @@ class TaskContext;
 class WorkStealingTaskQueue;
 class ConsumersManager;
 
+struct ConsumerStatistics final {
+    // Tasks taken from the local queues of other consumers
+    utils::statistics::Rate stolen_tasks;
+    // Idle periods spent looking for tasks instead of sleeping
+    utils::statistics::Rate spins;
+    // Idle periods that ended with a task without sleeping
+    utils::statistics::Rate spin_hits;
+    utils::statistics::Rate parks;
+    utils::statistics::Rate wakeups;
+
+    ConsumerStatistics& operator+=(const ConsumerStatistics& other) noexcept;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const ConsumerStatistics& stats);
+
 class Consumer final {
 public:
     Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_manager);
@@ -31,16 +48,28 @@ public:
 
     WorkStealingTaskQueue* GetOwner() const noexcept;
 
+    ConsumerStatistics GetStatistics() const noexcept;
+
 private:
     friend ConsumersManager;
     friend WorkStealingTaskQueue;
 
+    enum class NodeLocality { kSameNode, kOtherNode };
+
+    static constexpr std::size_t kUnknownNumaNode = static_cast<std::size_t>(-1);
+
     void SetIndex(std::size_t index) noexcept;
 
+    void SetNumaNode(std::size_t numa_node) noexcept;
+
+    std::size_t GetNumaNode() const noexcept;
+
     bool IsStopped() const noexcept;
 
     void EmptySurplusQueue(impl::TaskContext* extra);
 
+    std::size_t StealFromAnotherConsumers(std::size_t to_steal_count, NodeLocality locality);
+
     impl::TaskContext* StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal);
 
     std::size_t Steal(utils::span<impl::TaskContext*> buffer);
@@ -53,6 +82,8 @@ private:
 
     impl::TaskContext* TryPopBeforeSleep();
 
+    impl::TaskContext* SpinBeforeSleep();
+
     impl::TaskContext* TryPopLocal();
 
     impl::TaskContext* DoPop();
@@ -73,6 +104,7 @@ private:
     ConsumersManager& consumers_manager_;
     const std::size_t steal_attempts_count_;
     std::size_t inner_index_{0};
+    std::size_t numa_node_{kUnknownNumaNode};
     // kConsumerStealBufferSize + 1 for extra task in push
     std::array<impl::TaskContext*, kConsumerStealBufferSize + 1> steal_buffer_{};
     std::minstd_rand rnd_;
@@ -80,6 +112,12 @@ private:
     std::atomic<std::int32_t> sleep_counter_{0};
     GlobalQueue::Token global_queue_token_;
     GlobalQueue::Token background_queue_token_;
+    // Written by the owner thread, except for wakeups_
+    utils::statistics::RateCounter stolen_tasks_;
+    utils::statistics::RateCounter spins_;
+    utils::statistics::RateCounter spin_hits_;
+    utils::statistics::RateCounter parks_;
+    utils::statistics::RateCounter wakeups_;
 #ifndef __linux__
     std::condition_variable cv_;
     std::mutex mutex_;
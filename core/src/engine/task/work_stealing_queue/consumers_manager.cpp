@@ -10,8 +10,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
-ConsumersManager::ConsumersManager(std::size_t consumers_count)
-    : consumers_count_(consumers_count), is_sleeping_(consumers_count, false) {}
+ConsumersManager::ConsumersManager(std::size_t consumers_count, std::size_t max_kept_spinning)
+    : consumers_count_(consumers_count), max_kept_spinning_(max_kept_spinning), is_sleeping_(consumers_count, false) {}
 
 void ConsumersManager::NotifyNewTask() {
     ConsumersState::State curr_state = state_.Get();
@@ -61,6 +61,21 @@ bool ConsumersManager::StopStealing() noexcept {
     return old_state.stealing_count == 1;
 }
 
+bool ConsumersManager::TryStartKeptSpinning() noexcept {
+    auto spinning = kept_spinning_.load();
+    while (spinning < max_kept_spinning_) {
+        if (kept_spinning_.compare_exchange_weak(spinning, spinning + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ConsumersManager::StopKeptSpinning() noexcept {
+    [[maybe_unused]] const auto old = kept_spinning_.fetch_sub(1);
+    UASSERT(old > 0);
+}
+
 void ConsumersManager::WakeUpOne() {
     Consumer* consumer = nullptr;
     {
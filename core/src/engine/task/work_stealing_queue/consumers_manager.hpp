@@ -16,7 +16,7 @@ class Consumer;
 
 class ConsumersManager final {
 public:
-    explicit ConsumersManager(std::size_t consumers_count);
+    ConsumersManager(std::size_t consumers_count, std::size_t max_kept_spinning);
 
     void NotifyNewTask();
 
@@ -28,6 +28,11 @@ public:
 
     bool StopStealing() noexcept;
 
+    // Whether the consumer may look for tasks without going to sleep at all
+    bool TryStartKeptSpinning() noexcept;
+
+    void StopKeptSpinning() noexcept;
+
     void WakeUpOne();
 
     void Stop() noexcept;
@@ -40,6 +45,8 @@ private:
     void WakeUpAll();
 
     const std::size_t consumers_count_;
+    const std::size_t max_kept_spinning_;
+    std::atomic<std::size_t> kept_spinning_{0};
     std::mutex mutex_;
     ConsumersState state_{};
     std::atomic<bool> stopped_{false};
@@ -1,7 +1,10 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 
+#include <string>
+
 #include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <engine/task/task_context.hpp>
 
@@ -17,13 +20,25 @@ thread_local Consumer* localConsumer = nullptr;
 
 WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
     : consumers_count_(config.worker_threads),
+      spin_before_sleep_(config.work_stealing_spin_before_sleep),
       global_queue_(consumers_count_),
       background_queue_(consumers_count_),
       consumers_(config.worker_threads, *this, consumers_manager_),
-      consumers_manager_(consumers_count_) {
+      consumers_manager_(consumers_count_, config.work_stealing_spinning_workers) {
     for (size_t i = 0; i < consumers_count_; ++i) {
         consumers_[i].SetIndex(i);
     }
+
+    // Unpinned workers migrate between the nodes, so their nodes are not
+    // tracked for stealing
+    if (config.cpu_affinity.empty()) return;
+
+    for (size_t i = 0; i < consumers_count_; ++i) {
+        consumers_[i].SetNumaNode(GetWorkerNumaNode(config, i));
+        if (consumers_[i].GetNumaNode() != consumers_[0].GetNumaNode()) {
+            is_multi_node_ = true;
+        }
+    }
 }
 
 void WorkStealingTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
@@ -83,6 +98,16 @@ impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking() {
 
 Consumer* WorkStealingTaskQueue::GetConsumer() { return localConsumer; }
 
+void DumpMetric(utils::statistics::Writer& writer, const WorkStealingTaskQueue& queue) {
+    ConsumerStatistics total;
+    for (std::size_t i = 0; i < queue.consumers_count_; ++i) {
+        const auto stats = queue.consumers_[i].GetStatistics();
+        writer["consumer"].ValueWithLabels(stats, {"consumer_index", std::to_string(i)});
+        total += stats;
+    }
+    writer["total"] = total;
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -8,6 +9,7 @@
 #include <engine/task/work_stealing_queue/consumer.hpp>
 #include <engine/task/work_stealing_queue/consumers_manager.hpp>
 #include <engine/task/work_stealing_queue/global_queue.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -33,6 +35,8 @@ public:
 
     void PrepareWorker(std::size_t index);
 
+    friend void DumpMetric(utils::statistics::Writer& writer, const WorkStealingTaskQueue& queue);
+
 private:
     void DoPush(impl::TaskContext* context);
 
@@ -41,13 +45,19 @@ private:
     Consumer* GetConsumer();
 
     const std::size_t consumers_count_;
+    // How long an idle consumer looks for tasks before going to sleep
+    const std::chrono::microseconds spin_before_sleep_;
 
     GlobalQueue global_queue_;
     GlobalQueue background_queue_;
     utils::FixedArray<Consumer> consumers_;
     ConsumersManager consumers_manager_;
+    // Set if the worker threads are pinned to different NUMA nodes
+    bool is_multi_node_{false};
 };
 
+void DumpMetric(utils::statistics::Writer& writer, const WorkStealingTaskQueue& queue);
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,138 @@
+#include <userver/engine/task_group.hpp>
+
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+
+class TaskGroupState final {
+public:
+    // Written by the children
+    std::atomic<std::size_t> unfinished{0};
+    std::atomic<bool> has_exception{false};
+    // Written by the first failed child only, read by the parent after all
+    // the children are finished
+    std::exception_ptr exception;
+    SingleConsumerEvent event;
+
+    // Parent-only data
+    std::vector<boost::intrusive_ptr<TaskContext>> pending;
+    std::vector<boost::intrusive_ptr<TaskContext>> started;
+    std::vector<TaskContext*> to_schedule;
+};
+
+TaskGroupChildToken::TaskGroupChildToken(std::shared_ptr<TaskGroupState> state) noexcept : state_(std::move(state)) {}
+
+TaskGroupChildToken::~TaskGroupChildToken() {
+    if (state_ && state_->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        state_->event.Send();
+    }
+}
+
+void TaskGroupChildToken::SetException(std::exception_ptr&& exception) noexcept {
+    UASSERT(state_);
+    if (state_->has_exception.exchange(true, std::memory_order_relaxed)) return;
+
+    state_->exception = std::move(exception);
+    // Wake up the parent to cancel the siblings
+    state_->event.Send();
+}
+
+}  // namespace impl
+
+TaskGroup::TaskGroup() : TaskGroup(current_task::GetTaskProcessor()) {}
+
+TaskGroup::TaskGroup(TaskProcessor& task_processor)
+    : task_processor_(task_processor), state_(std::make_shared<impl::TaskGroupState>()) {}
+
+TaskGroup::~TaskGroup() {
+    Start();
+    RequestCancel();
+    WaitFinished(/*rethrow=*/false);
+}
+
+void TaskGroup::Start() {
+    auto& state = *state_;
+    if (state.pending.empty()) return;
+
+    state.to_schedule.clear();
+    for (const auto& context : state.pending) {
+        if (context->PrepareBulkBootstrap()) state.to_schedule.push_back(context.get());
+    }
+    task_processor_.ScheduleBulk(state.to_schedule);
+
+    state.started.insert(
+        state.started.end(),
+        std::make_move_iterator(state.pending.begin()),
+        std::make_move_iterator(state.pending.end())
+    );
+    state.pending.clear();
+}
+
+void TaskGroup::Wait() { WaitFinished(/*rethrow=*/true); }
+
+void TaskGroup::RequestCancel() {
+    for (const auto& context : state_->started) {
+        if (!context->IsFinished()) context->RequestCancel(TaskCancellationReason::kUserRequest);
+    }
+}
+
+std::size_t TaskGroup::GetUnfinishedCount() const noexcept {
+    return state_->unfinished.load(std::memory_order_acquire);
+}
+
+impl::TaskGroupChildToken TaskGroup::MakeChildToken() {
+    state_->unfinished.fetch_add(1, std::memory_order_relaxed);
+    return impl::TaskGroupChildToken{state_};
+}
+
+void TaskGroup::AddChild(impl::TaskContextHolder&& context) {
+    state_->pending.push_back(std::move(context).Extract());
+}
+
+void TaskGroup::WaitFinished(bool rethrow) {
+    Start();
+
+    auto& state = *state_;
+    bool is_cancel_requested = false;
+    std::optional<TaskCancellationReason> parent_cancellation;
+    std::optional<TaskCancellationBlocker> cancellation_blocker;
+
+    while (state.unfinished.load(std::memory_order_acquire) != 0) {
+        if (!is_cancel_requested && state.has_exception.load(std::memory_order_relaxed)) {
+            RequestCancel();
+            is_cancel_requested = true;
+        }
+
+        if (!state.event.WaitForEvent()) {
+            // The children reference the group, they must finish before we leave
+            parent_cancellation = current_task::CancellationReason();
+            cancellation_blocker.emplace();
+            if (!is_cancel_requested) {
+                RequestCancel();
+                is_cancel_requested = true;
+            }
+        }
+    }
+
+    if (!rethrow) return;
+    if (state.exception) std::rethrow_exception(state.exception);
+    if (parent_cancellation) throw WaitInterruptedException(*parent_cancellation);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#include <userver/engine/task_group.hpp>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+void task_group_fan_out(benchmark::State& state) {
+    engine::RunStandalone(state.range(1), [&] {
+        const auto children = state.range(0);
+        for ([[maybe_unused]] auto _ : state) {
+            engine::TaskGroup group;
+            for (std::int64_t i = 0; i < children; ++i) {
+                group.Spawn([] {});
+            }
+            group.Wait();
+        }
+        state.SetItemsProcessed(state.iterations() * children);
+    });
+}
+BENCHMARK(task_group_fan_out)->RangeMultiplier(4)->Ranges({{16, 1024}, {1, 4}});
+
+void task_vector_fan_out(benchmark::State& state) {
+    engine::RunStandalone(state.range(1), [&] {
+        const auto children = state.range(0);
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(children);
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::int64_t i = 0; i < children; ++i) {
+                tasks.push_back(engine::AsyncNoSpan([] {}));
+            }
+            engine::GetAll(tasks);
+            tasks.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * children);
+    });
+}
+BENCHMARK(task_vector_fan_out)->RangeMultiplier(4)->Ranges({{16, 1024}, {1, 4}});
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,134 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task_group.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST_MT(TaskGroup, Sample, 4) {
+    /// [Sample engine::TaskGroup usage]
+    constexpr std::size_t kChildren = 100;
+    std::vector<int> results(kChildren);
+
+    engine::TaskGroup group;
+    for (std::size_t i = 0; i < kChildren; ++i) {
+        // Each child writes to its own slot, so no synchronization is needed
+        group.Spawn([&results, i] { results[i] = static_cast<int>(i) * 2; });
+    }
+    group.Wait();
+    /// [Sample engine::TaskGroup usage]
+
+    for (std::size_t i = 0; i < kChildren; ++i) {
+        EXPECT_EQ(results[i], static_cast<int>(i) * 2);
+    }
+    EXPECT_EQ(group.GetUnfinishedCount(), 0);
+}
+
+UTEST(TaskGroup, NotStartedBeforeWait) {
+    std::atomic<bool> started{false};
+
+    engine::TaskGroup group;
+    group.Spawn([&started] { started = true; });
+    engine::Yield();
+    EXPECT_FALSE(started);
+    EXPECT_EQ(group.GetUnfinishedCount(), 1);
+
+    group.Wait();
+    EXPECT_TRUE(started);
+}
+
+UTEST(TaskGroup, SpawnArguments) {
+    std::atomic<int> sum{0};
+
+    engine::TaskGroup group;
+    for (int i = 1; i <= 10; ++i) {
+        group.Spawn([&sum](int value) { sum += value; }, i);
+    }
+    group.Wait();
+    EXPECT_EQ(sum, 55);
+}
+
+UTEST(TaskGroup, Empty) {
+    engine::TaskGroup group;
+    UEXPECT_NO_THROW(group.Wait());
+    EXPECT_EQ(group.GetUnfinishedCount(), 0);
+}
+
+UTEST(TaskGroup, StartThenWait) {
+    std::atomic<std::size_t> finished{0};
+
+    engine::TaskGroup group;
+    for (int i = 0; i < 10; ++i) {
+        group.Spawn([&finished] { ++finished; });
+    }
+    group.Start();
+    for (int i = 0; i < 10; ++i) {
+        group.Spawn([&finished] { ++finished; });
+    }
+    group.Wait();
+    EXPECT_EQ(finished, 20);
+}
+
+UTEST_MT(TaskGroup, FirstExceptionCancelsSiblings, 4) {
+    std::atomic<std::size_t> cancelled{0};
+
+    engine::TaskGroup group;
+    for (int i = 0; i < 10; ++i) {
+        group.Spawn([&cancelled] {
+            engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+            if (engine::current_task::IsCancelRequested()) ++cancelled;
+        });
+    }
+    group.Spawn([] { throw std::runtime_error("child failed"); });
+
+    UEXPECT_THROW_MSG(group.Wait(), std::runtime_error, "child failed");
+    EXPECT_EQ(cancelled, 10);
+    EXPECT_EQ(group.GetUnfinishedCount(), 0);
+}
+
+UTEST(TaskGroup, DestructorCancels) {
+    std::atomic<std::size_t> cancelled{0};
+
+    {
+        engine::TaskGroup group;
+        for (int i = 0; i < 10; ++i) {
+            group.Spawn([&cancelled] {
+                engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+                if (engine::current_task::IsCancelRequested()) ++cancelled;
+            });
+        }
+        group.Start();
+    }
+
+    EXPECT_EQ(cancelled, 10);
+}
+
+UTEST(TaskGroup, ParentCancellation) {
+    std::atomic<std::size_t> cancelled{0};
+    engine::SingleConsumerEvent children_started;
+
+    auto parent = utils::Async("parent", [&] {
+        engine::TaskGroup group;
+        group.Spawn([&] {
+            children_started.Send();
+            engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+            if (engine::current_task::IsCancelRequested()) ++cancelled;
+        });
+        group.Wait();
+    });
+
+    ASSERT_TRUE(children_started.WaitForEventFor(utest::kMaxTestWaitTime));
+    parent.RequestCancel();
+    UEXPECT_THROW(parent.Get(), engine::WaitInterruptedException);
+    EXPECT_EQ(cancelled, 1);
+}
+
+USERVER_NAMESPACE_END
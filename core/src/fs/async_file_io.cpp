@@ -0,0 +1,178 @@
+#include <fs/async_file_io.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <boost/filesystem/path.hpp>
+
+#include <engine/io/sys_linux/io_uring.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::impl {
+
+#ifdef __linux__
+
+namespace {
+
+using engine::io::sys_linux::IoUring;
+
+constexpr int kNoFd = -1;
+constexpr std::size_t kReadChunkSize = 64 * 1024;
+
+IoUring& GetRing() {
+    auto* ring = IoUring::TryGet();
+    UINVARIANT(ring, "io_uring is not available, check IsAsyncFileIoAvailable() first");
+    return *ring;
+}
+
+std::size_t GetSize(IoUring& ring, int fd, const std::string& path) {
+    struct statx result {};
+    const auto error = ring.Statx(fd, "", result);
+    if (error != 0) {
+        throw std::system_error(
+            std::error_code(error, std::system_category()), "Error while getting the size of '" + path + '\''
+        );
+    }
+    return result.stx_size;
+}
+
+// The size is a hint, the files could change and some of the special files
+// report zero size
+std::string ReadAll(IoUring& ring, int fd, std::size_t size_hint) {
+    std::string result;
+    result.resize(size_hint + 1);
+
+    std::size_t offset = 0;
+    while (true) {
+        if (offset == result.size()) result.resize(result.size() + std::max(result.size(), kReadChunkSize));
+
+        const auto read = ring.Read(fd, result.data() + offset, result.size() - offset, offset);
+        if (read == 0) break;
+        offset += read;
+    }
+
+    result.resize(offset);
+    return result;
+}
+
+}  // namespace
+
+bool IsAsyncFileIoAvailable() noexcept { return IoUring::TryGet() != nullptr; }
+
+std::string ReadFileContents(const std::string& path) {
+    auto& ring = GetRing();
+    auto file = blocking::FileDescriptor::AdoptFd(ring.OpenAt(path.c_str(), O_RDONLY | O_CLOEXEC, 0));
+
+    auto result = ReadAll(ring, file.GetNative(), GetSize(ring, file.GetNative(), path));
+    ring.Close(std::move(file).Release());
+    return result;
+}
+
+FileInfoWithData ReadFileInfoWithData(const std::string& path, std::size_t keep_open_min_size) {
+    auto& ring = GetRing();
+
+    FileInfoWithData info{};
+    info.extension = boost::filesystem::path(path).extension().string();
+
+    auto file = blocking::FileDescriptor::AdoptFd(ring.OpenAt(path.c_str(), O_RDONLY | O_CLOEXEC, 0));
+    info.size = GetSize(ring, file.GetNative(), path);
+    if (info.size >= keep_open_min_size) {
+        info.file = std::make_shared<const blocking::FileDescriptor>(std::move(file));
+        return info;
+    }
+
+    info.data = ReadAll(ring, file.GetNative(), info.size);
+    info.size = info.data.size();
+    ring.Close(std::move(file).Release());
+    return info;
+}
+
+bool FileExists(const std::string& path) {
+    struct statx result {};
+    const auto error = GetRing().Statx(AT_FDCWD, path.c_str(), result);
+    if (error == ENOENT || error == ENOTDIR) return false;
+    if (error != 0) {
+        throw std::system_error(std::error_code(error, std::system_category()), "Error while checking '" + path + '\'');
+    }
+    return true;
+}
+
+void RewriteFileContents(const std::string& path, std::string_view contents) {
+    AsyncFileWriter writer{
+        path, O_CREAT | O_TRUNC, boost::filesystem::perms::owner_read | boost::filesystem::perms::owner_write};
+    writer.Write(contents);
+    std::move(writer).Close();
+}
+
+AsyncFileWriter::AsyncFileWriter(const std::string& path, int flags, boost::filesystem::perms perms)
+    : fd_(GetRing().OpenAt(path.c_str(), flags | O_WRONLY | O_CLOEXEC, static_cast<mode_t>(perms))) {}
+
+AsyncFileWriter::AsyncFileWriter(AsyncFileWriter&& other) noexcept
+    : fd_(std::exchange(other.fd_, kNoFd)), offset_(other.offset_) {}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    if (fd_ != kNoFd) ::close(fd_);
+}
+
+void AsyncFileWriter::Write(std::string_view data) {
+    UASSERT(fd_ != kNoFd);
+    GetRing().Write(fd_, data, offset_);
+    offset_ += data.size();
+}
+
+void AsyncFileWriter::FSync() {
+    UASSERT(fd_ != kNoFd);
+    GetRing().Fsync(fd_);
+}
+
+void AsyncFileWriter::Close() && {
+    UASSERT(fd_ != kNoFd);
+    GetRing().Close(std::exchange(fd_, kNoFd));
+}
+
+#else
+
+namespace {
+
+[[noreturn]] void ThrowNotSupported() { throw std::runtime_error("io_uring is available only on Linux"); }
+
+}  // namespace
+
+bool IsAsyncFileIoAvailable() noexcept { return false; }
+
+std::string ReadFileContents(const std::string&) { ThrowNotSupported(); }
+
+FileInfoWithData ReadFileInfoWithData(const std::string&, std::size_t) { ThrowNotSupported(); }
+
+bool FileExists(const std::string&) { ThrowNotSupported(); }
+
+void RewriteFileContents(const std::string&, std::string_view) { ThrowNotSupported(); }
+
+AsyncFileWriter::AsyncFileWriter(const std::string&, int, boost::filesystem::perms) : fd_(-1) {
+    ThrowNotSupported();
+}
+
+AsyncFileWriter::AsyncFileWriter(AsyncFileWriter&& other) noexcept : fd_(other.fd_), offset_(other.offset_) {}
+
+AsyncFileWriter::~AsyncFileWriter() = default;
+
+void AsyncFileWriter::Write(std::string_view) { ThrowNotSupported(); }
+
+void AsyncFileWriter::FSync() { ThrowNotSupported(); }
+
+void AsyncFileWriter::Close() && { ThrowNotSupported(); }
+
+#endif  // __linux__
+
+}  // namespace fs::impl
+
+USERVER_NAMESPACE_END
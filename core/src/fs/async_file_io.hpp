@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/fs/read.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::impl {
+
+/// Returns `true` if the functions below could be used: io_uring is available
+/// and the caller is a coroutine. The functions suspend the coroutine instead
+/// of blocking the thread, so there is no need to hop to a blocking task
+/// processor.
+bool IsAsyncFileIoAvailable() noexcept;
+
+/// @{
+/// @brief Same as the fs::blocking:: ones, but use io_uring
+/// @warning Should be used only if IsAsyncFileIoAvailable()
+std::string ReadFileContents(const std::string& path);
+
+FileInfoWithData ReadFileInfoWithData(const std::string& path, std::size_t keep_open_min_size);
+
+bool FileExists(const std::string& path);
+
+void RewriteFileContents(const std::string& path, std::string_view contents);
+/// @}
+
+/// @brief A file that is written sequentially through io_uring
+/// @warning Should be used only if IsAsyncFileIoAvailable()
+class AsyncFileWriter final {
+public:
+    /// @param flags open(2) flags, O_WRONLY and O_CLOEXEC are always added
+    /// @throws std::system_error
+    AsyncFileWriter(const std::string& path, int flags, boost::filesystem::perms perms);
+
+    AsyncFileWriter(AsyncFileWriter&& other) noexcept;
+    AsyncFileWriter& operator=(AsyncFileWriter&&) = delete;
+    ~AsyncFileWriter();
+
+    /// @throws std::system_error
+    void Write(std::string_view data);
+
+    /// @throws std::system_error
+    void FSync();
+
+    /// @throws std::system_error
+    void Close() &&;
+
+private:
+    int fd_;
+    std::uint64_t offset_{0};
+};
+
+}  // namespace fs::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#include <userver/utest/utest.hpp>
+
+#include <fcntl.h>
+
+#include <fs/async_file_io.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kPerms = boost::filesystem::perms::owner_read | boost::filesystem::perms::owner_write;
+
+}  // namespace
+
+UTEST(AsyncFileIo, RewriteAndRead) {
+    if (!fs::impl::IsAsyncFileIoAvailable()) GTEST_SKIP() << "io_uring is not available";
+
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    EXPECT_FALSE(fs::impl::FileExists(path));
+    EXPECT_FALSE(fs::impl::FileExists(path + "/not-a-dir"));
+
+    fs::impl::RewriteFileContents(path, "old contents");
+    fs::impl::RewriteFileContents(path, "new");
+    EXPECT_TRUE(fs::impl::FileExists(path));
+    EXPECT_EQ(fs::impl::ReadFileContents(path), "new");
+    EXPECT_EQ(fs::blocking::ReadFileContents(path), "new");
+
+    EXPECT_THROW(fs::impl::ReadFileContents(path + "-missing"), std::system_error);
+}
+
+UTEST(AsyncFileIo, ReadLargeFile) {
+    if (!fs::impl::IsAsyncFileIoAvailable()) GTEST_SKIP() << "io_uring is not available";
+
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    std::string contents;
+    for (std::size_t i = 0; i < 300'000; ++i) contents.push_back(static_cast<char>('a' + i % 26));
+    fs::blocking::RewriteFileContents(path, contents);
+
+    EXPECT_EQ(fs::impl::ReadFileContents(path), contents);
+
+    const auto info = fs::impl::ReadFileInfoWithData(path, contents.size() + 1);
+    EXPECT_EQ(info.size, contents.size());
+    EXPECT_EQ(info.data, contents);
+    EXPECT_FALSE(info.file);
+
+    const auto info_open = fs::impl::ReadFileInfoWithData(path, contents.size());
+    EXPECT_EQ(info_open.size, contents.size());
+    EXPECT_TRUE(info_open.data.empty());
+    EXPECT_TRUE(info_open.file);
+}
+
+UTEST(AsyncFileIo, Writer) {
+    if (!fs::impl::IsAsyncFileIoAvailable()) GTEST_SKIP() << "io_uring is not available";
+
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    {
+        fs::impl::AsyncFileWriter writer{path, O_CREAT | O_EXCL, kPerms};
+        writer.Write("foo");
+        writer.Write("");
+        writer.Write("bar");
+        writer.FSync();
+        std::move(writer).Close();
+    }
+    EXPECT_EQ(fs::blocking::ReadFileContents(path), "foobar");
+
+    EXPECT_THROW((fs::impl::AsyncFileWriter{path, O_CREAT | O_EXCL, kPerms}), std::system_error);
+}
+
+USERVER_NAMESPACE_END
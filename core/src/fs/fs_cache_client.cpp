@@ -40,8 +40,16 @@ bool IsFilepathHidden(const std::string& path) {
 }  // namespace
 #endif  // __linux__
 
-FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period, engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+FsCacheClient::FsCacheClient(
+    std::string_view dir,
+    std::chrono::milliseconds update_period,
+    engine::TaskProcessor& tp,
+    std::size_t keep_open_min_size
+)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      keep_open_min_size_(keep_open_min_size) {
     UpdateCache();
 
     if (update_period_ == std::chrono::milliseconds(0)) {
@@ -56,7 +64,7 @@ FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds upd
 }
 
 void FsCacheClient::UpdateCache() {
-    auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+    auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, {fs::SettingsReadFile::kSkipHidden}, keep_open_min_size_);
     data_.Assign(std::move(map));
 }
 
@@ -101,10 +109,10 @@ void FsCacheClient::HandleDeleteDirectory(engine::io::sys_linux::Inotify& inotif
 void FsCacheClient::HandleCreate(const std::string& path) {
     if (IsFilepathHidden(path)) return;
 
-    FileInfoWithData info{};
-    info.extension = boost::filesystem::path(path).extension().string();
-    info.data = ReadFileContents(tp_, path);
-    data_.InsertOrAssign(GetLexicallyRelative(path, dir_), std::make_shared<const FileInfoWithData>(std::move(info)));
+    data_.InsertOrAssign(
+        GetLexicallyRelative(path, dir_),
+        std::make_shared<const FileInfoWithData>(ReadFileInfoWithData(tp_, path, keep_open_min_size_))
+    );
 }
 
 void FsCacheClient::HandleCreateDirectory(engine::io::sys_linux::Inotify& inotify, const std::string& path) {
@@ -3,9 +3,12 @@
 #include <boost/filesystem.hpp>
 
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
 
+#include <fs/async_file_io.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -18,6 +21,22 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
     return name != ".." && name != "." && name[0] == '.';
 }
 
+FileInfoWithData ReadFileInfoWithDataBlocking(const std::string& path, std::size_t keep_open_min_size) {
+    FileInfoWithData info{};
+    info.extension = boost::filesystem::path(path).extension().string();
+
+    auto file = blocking::FileDescriptor::Open(path, blocking::OpenFlag::kRead);
+    info.size = file.GetSize();
+    if (info.size >= keep_open_min_size) {
+        info.file = std::make_shared<const blocking::FileDescriptor>(std::move(file));
+        return info;
+    }
+
+    info.data = blocking::ReadFileContents(path);
+    info.size = info.data.size();
+    return info;
+}
+
 }  // namespace
 
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
@@ -28,13 +47,21 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
 }
 
 std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path) {
+    if (impl::IsAsyncFileIoAvailable()) return impl::ReadFileContents(path);
     return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path).Get();
 }
 
+FileInfoWithData
+ReadFileInfoWithData(engine::TaskProcessor& async_tp, const std::string& path, std::size_t keep_open_min_size) {
+    if (impl::IsAsyncFileIoAvailable()) return impl::ReadFileInfoWithData(path, keep_open_min_size);
+    return engine::AsyncNoSpan(async_tp, &ReadFileInfoWithDataBlocking, path, keep_open_min_size).Get();
+}
+
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp,
     const std::string& path,
-    utils::Flags<SettingsReadFile> flags
+    utils::Flags<SettingsReadFile> flags,
+    std::size_t keep_open_min_size
 ) {
     FileInfoWithDataMap data{};
     for (auto it = utils::Async(
@@ -45,16 +72,15 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
         // only files
         if (it->status().type() != boost::filesystem::regular_file) continue;
         if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path())) continue;
-        FileInfoWithData info{};
-        info.extension = it->path().extension().string();
-        info.data = ReadFileContents(async_tp, it->path().string());
-        data[GetLexicallyRelative(it->path().string(), path)] =
-            std::make_shared<const FileInfoWithData>(std::move(info));
+        data[GetLexicallyRelative(it->path().string(), path)] = std::make_shared<const FileInfoWithData>(
+            ReadFileInfoWithData(async_tp, it->path().string(), keep_open_min_size)
+        );
     }
     return data;
 }
 
 bool FileExists(engine::TaskProcessor& async_tp, const std::string& path) {
+    if (impl::IsAsyncFileIoAvailable()) return impl::FileExists(path);
     return engine::AsyncNoSpan(async_tp, &fs::blocking::FileExists, path).Get();
 }
 
@@ -7,6 +7,8 @@
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/write.hpp>
 
+#include <fs/async_file_io.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -20,6 +22,10 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path) {
 }
 
 void RewriteFileContents(engine::TaskProcessor& async_tp, const std::string& path, std::string_view contents) {
+    if (impl::IsAsyncFileIoAvailable()) {
+        impl::RewriteFileContents(path, contents);
+        return;
+    }
     engine::AsyncNoSpan(async_tp, &fs::blocking::RewriteFileContents, path, contents).Get();
 }
 
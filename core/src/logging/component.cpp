@@ -273,6 +273,7 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - binary
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
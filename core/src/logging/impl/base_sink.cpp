@@ -14,6 +14,18 @@ void BaseSink::Log(const LogMessage& message) {
     }
 }
 
+void BaseSink::Log(utils::span<const LogMessage> messages) {
+    if (!messages.empty()) {
+        WriteBatch(messages);
+    }
+}
+
+void BaseSink::WriteBatch(utils::span<const LogMessage> messages) {
+    for (const auto& message : messages) {
+        Log(message);
+    }
+}
+
 void BaseSink::Flush() {}
 
 void BaseSink::Reopen(ReopenMode) {}
@@ -4,6 +4,7 @@
 
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/logging/level.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,6 +23,9 @@ public:
 
     void Log(const LogMessage& message);
 
+    /// Writes the messages that pass the sink level, in order
+    void Log(utils::span<const LogMessage> messages);
+
     virtual void Flush();
 
     virtual void Reopen(ReopenMode);
@@ -35,6 +39,10 @@ protected:
 
     virtual void Write(std::string_view log) = 0;
 
+    /// The default implementation calls Write() for each of the messages that
+    /// pass ShouldLog(), sinks may override it to write all of them at once
+    virtual void WriteBatch(utils::span<const LogMessage> messages);
+
 private:
     std::atomic<Level> level_{Level::kTrace};
 };
@@ -1,11 +1,19 @@
 #include "buffered_file_sink.hpp"
 
+#include "fd_sink.hpp"
 #include "open_file_helper.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+// Smaller batches are cheaper to gather in the stdio buffer
+constexpr std::size_t kDirectWriteBatchSize = 64 * 1024;
+
+}  // namespace
+
 BufferedFileSink::BufferedFileSink(const std::string& filename)
     : filename_{filename}, file_(OpenFile<fs::blocking::CFile>(filename)) {
     if (file_.GetSize() > 0) {
@@ -24,6 +32,23 @@ BufferedFileSink::~BufferedFileSink() = default;
 
 void BufferedFileSink::Write(std::string_view log) { file_.Write(log); }
 
+void BufferedFileSink::WriteBatch(utils::span<const LogMessage> messages) {
+    std::size_t batch_size = 0;
+    for (const auto& message : messages) {
+        batch_size += message.payload.size();
+    }
+
+    if (batch_size < kDirectWriteBatchSize) {
+        BaseSink::WriteBatch(messages);
+        return;
+    }
+
+    // Writes the batch with a few writev calls bypassing the stdio buffer,
+    // which has to be written first to keep the order of the records
+    file_.FlushLight();
+    WriteBatchToFd(::fileno(file_.GetNative()), *this, messages);
+}
+
 void BufferedFileSink::Flush() {
     if (file_.IsOpen()) {
         file_.FlushLight();
@@ -25,6 +25,8 @@ protected:
 
     void Write(std::string_view log) final;
 
+    void WriteBatch(utils::span<const LogMessage> messages) final;
+
     fs::blocking::CFile& GetFile();
 
 private:
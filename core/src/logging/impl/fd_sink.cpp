@@ -1,13 +1,66 @@
 #include "fd_sink.hpp"
 
+#include <sys/uio.h>
+
+#include <array>
+#include <cerrno>
+#include <system_error>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr std::size_t kMaxBatchBuffers = 64;
+
+void WriteAll(int fd, iovec* begin, iovec* end) {
+    while (begin != end) {
+        const auto written = ::writev(fd, begin, static_cast<int>(end - begin));
+        if (written < 0) {
+            if (errno == EAGAIN || errno == EINTR) continue;
+
+            const auto code = std::make_error_code(std::errc{errno});
+            throw std::system_error(code, "calling ::writev");
+        }
+
+        auto remaining = static_cast<std::size_t>(written);
+        while (begin != end && remaining >= begin->iov_len) {
+            remaining -= begin->iov_len;
+            ++begin;
+        }
+        if (remaining != 0) {
+            begin->iov_base = static_cast<char*>(begin->iov_base) + remaining;
+            begin->iov_len -= remaining;
+        }
+    }
+}
+
+}  // namespace
+
+void WriteBatchToFd(int fd, const BaseSink& sink, utils::span<const LogMessage> messages) {
+    std::array<iovec, kMaxBatchBuffers> buffers{};
+    std::size_t count = 0;
+
+    for (const auto& message : messages) {
+        if (message.payload.empty() || !sink.ShouldLog(message.level)) continue;
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        buffers[count++] = {const_cast<char*>(message.payload.data()), message.payload.size()};
+        if (count == buffers.size()) {
+            WriteAll(fd, buffers.data(), buffers.data() + count);
+            count = 0;
+        }
+    }
+    WriteAll(fd, buffers.data(), buffers.data() + count);
+}
+
 FdSink::FdSink(fs::blocking::FileDescriptor fd) : fd_{std::move(fd)} {}
 
 void FdSink::Write(std::string_view log) { fd_.Write(log); }
 
+void FdSink::WriteBatch(utils::span<const LogMessage> messages) { WriteBatchToFd(fd_.GetNative(), *this, messages); }
+
 void FdSink::Flush() {
     if (fd_.IsOpen()) {
         fd_.FSync();
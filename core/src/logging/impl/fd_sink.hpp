@@ -21,6 +21,8 @@ public:
 protected:
     void Write(std::string_view log) final;
 
+    void WriteBatch(utils::span<const LogMessage> messages) final;
+
     fs::blocking::FileDescriptor& GetFd();
 
     void SetFd(fs::blocking::FileDescriptor&& fd);
@@ -29,6 +31,10 @@ private:
     fs::blocking::FileDescriptor fd_;
 };
 
+/// Writes the `messages` that pass `sink.ShouldLog()` into `fd` with as few
+/// `writev` calls as possible
+void WriteBatchToFd(int fd, const BaseSink& sink, utils::span<const LogMessage> messages);
+
 class UnownedFdSink final : public FdSink {
 public:
     explicit UnownedFdSink(int fd);
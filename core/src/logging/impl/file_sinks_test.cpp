@@ -181,6 +181,25 @@ UTEST_P(FileSinks, TestValidWriteMultiInFile) {
     EXPECT_EQ(test::ReadFromFile(Filename()), test::Messages("message", "message 2", "message 3"));
 }
 
+UTEST_P(FileSinks, TestWriteBatch) {
+    Sink().SetLevel(logging::Level::kInfo);
+    EXPECT_NO_THROW(Sink().Log({"before batch\n", logging::Level::kWarning}));
+
+    // Large enough to be written bypassing the buffer of BufferedFileSink
+    const std::string large(100 * 1024, 'x');
+    const std::string large_line = large + '\n';
+    const std::vector<logging::impl::LogMessage> batch{
+        {"message\n", logging::Level::kWarning},
+        {"skipped\n", logging::Level::kDebug},
+        {large_line, logging::Level::kInfo},
+        {"message 3\n", logging::Level::kCritical},
+    };
+    EXPECT_NO_THROW(Sink().Log(batch));
+    EXPECT_NO_THROW(Sink().Flush());
+
+    EXPECT_EQ(test::ReadFromFile(Filename()), test::Messages("before batch", "message", large, "message 3"));
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     /* no prefix */,
     FileSinks,
@@ -0,0 +1,115 @@
+#include <logging/impl/thread_log_buffer.hpp>
+
+#include <cstring>
+#include <limits>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+struct ThreadLogBuffer::Header final {
+    std::uint64_t sequence;
+    std::uint32_t size;
+    std::uint8_t level;
+};
+
+namespace {
+
+// A header with this size marks the unused tail of the storage
+constexpr std::uint32_t kPaddingMarker = std::numeric_limits<std::uint32_t>::max();
+
+// Headers are always aligned, so that the tail of the storage always fits
+// the padding marker
+constexpr std::size_t kRecordAlignment = 16;
+constexpr std::size_t kHeaderSpace = kRecordAlignment;
+
+constexpr std::size_t GetRecordSpace(std::size_t payload_size) noexcept {
+    return (kHeaderSpace + payload_size + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+}
+
+}  // namespace
+
+ThreadLogBuffer::ThreadLogBuffer(std::size_t capacity)
+    : capacity_(capacity), storage_(std::make_unique<char[]>(capacity)) {
+    static_assert(sizeof(Header) <= kHeaderSpace);
+    UINVARIANT(capacity >= kRecordAlignment * 4, "Too small capacity of the log buffer");
+    UINVARIANT((capacity & (capacity - 1)) == 0, "Capacity of the log buffer must be a power of 2");
+}
+
+ThreadLogBuffer::~ThreadLogBuffer() = default;
+
+char* ThreadLogBuffer::TryReserve(std::size_t size) noexcept {
+    if (size > GetMaxRecordSize()) return nullptr;
+
+    const auto space = GetRecordSpace(size);
+    auto position = write_position_;
+    const auto offset = position & (capacity_ - 1);
+    const auto tail_space = capacity_ - offset;
+    const auto padding = tail_space < space ? tail_space : 0;
+
+    if (position + padding + space - released_->load(std::memory_order_acquire) > capacity_) {
+        return nullptr;
+    }
+
+    if (padding != 0) {
+        const Header marker{0, kPaddingMarker, 0};
+        std::memcpy(storage_.get() + offset, &marker, sizeof(marker));
+        position += padding;
+    }
+
+    reserved_position_ = position;
+    reserved_size_ = size;
+    return storage_.get() + (position & (capacity_ - 1)) + kHeaderSpace;
+}
+
+void ThreadLogBuffer::Publish(std::uint64_t sequence, Level level) noexcept {
+    const Header header{sequence, static_cast<std::uint32_t>(reserved_size_), static_cast<std::uint8_t>(level)};
+    std::memcpy(storage_.get() + (reserved_position_ & (capacity_ - 1)), &header, sizeof(header));
+
+    write_position_ = reserved_position_ + GetRecordSpace(reserved_size_);
+    published_->store(write_position_, std::memory_order_release);
+}
+
+void ThreadLogBuffer::BeginRead() noexcept { read_limit_ = published_->load(std::memory_order_acquire); }
+
+std::optional<ThreadLogBuffer::Record> ThreadLogBuffer::Peek() noexcept {
+    while (read_position_ != read_limit_) {
+        const auto offset = read_position_ & (capacity_ - 1);
+        Header header{};
+        std::memcpy(&header, storage_.get() + offset, sizeof(header));
+
+        if (header.size == kPaddingMarker) {
+            read_position_ += capacity_ - offset;
+            continue;
+        }
+
+        return Record{
+            header.sequence,
+            static_cast<Level>(header.level),
+            std::string_view{storage_.get() + offset + kHeaderSpace, header.size},
+        };
+    }
+    return std::nullopt;
+}
+
+void ThreadLogBuffer::Pop() noexcept {
+    UASSERT(read_position_ != read_limit_);
+    Header header{};
+    std::memcpy(&header, storage_.get() + (read_position_ & (capacity_ - 1)), sizeof(header));
+    UASSERT(header.size != kPaddingMarker);
+    read_position_ += GetRecordSpace(header.size);
+}
+
+void ThreadLogBuffer::Release() noexcept { released_->store(read_position_, std::memory_order_release); }
+
+bool ThreadLogBuffer::HasPublished() const noexcept {
+    return published_->load(std::memory_order_acquire) != read_position_;
+}
+
+std::size_t ThreadLogBuffer::GetMaxRecordSize() const noexcept { return capacity_ / 4 - kHeaderSpace; }
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief Single-producer single-consumer ring buffer of log records.
+///
+/// The producer copies the record into the buffer with TryReserve() and
+/// makes it visible to the consumer with Publish(). The consumer reads the
+/// records published before BeginRead() with Peek() and Pop(), and returns
+/// their space to the producer with Release() once it has written them, so
+/// the record payloads may be passed to the sinks without copying.
+///
+/// Records are prefixed with a header and never wrap around the end of the
+/// storage, so each payload is contiguous.
+class ThreadLogBuffer final {
+public:
+    struct Record final {
+        std::uint64_t sequence{};
+        Level level{};
+        std::string_view payload;
+    };
+
+    /// @param capacity size of the storage in bytes, must be a power of 2
+    explicit ThreadLogBuffer(std::size_t capacity);
+
+    ThreadLogBuffer(ThreadLogBuffer&&) = delete;
+    ThreadLogBuffer& operator=(ThreadLogBuffer&&) = delete;
+    ~ThreadLogBuffer();
+
+    /// @brief Producer: returns the storage for a payload of `size` bytes, or
+    /// `nullptr` if the buffer has no space for it
+    char* TryReserve(std::size_t size) noexcept;
+
+    /// @brief Producer: makes the record written into the last TryReserve()
+    /// storage visible to the consumer
+    void Publish(std::uint64_t sequence, Level level) noexcept;
+
+    /// @brief Consumer: makes the records published so far readable
+    void BeginRead() noexcept;
+
+    /// @brief Consumer: returns the first unread record, if any
+    std::optional<Record> Peek() noexcept;
+
+    /// @brief Consumer: skips the record returned by Peek()
+    void Pop() noexcept;
+
+    /// @brief Consumer: returns the space of the popped records to the producer
+    /// @note The payloads of the popped records are invalidated
+    void Release() noexcept;
+
+    /// @brief Consumer: returns whether there are published unread records
+    bool HasPublished() const noexcept;
+
+    /// @brief Max payload size that TryReserve() may accept
+    std::size_t GetMaxRecordSize() const noexcept;
+
+private:
+    struct Header;
+
+    const std::size_t capacity_;
+    const std::unique_ptr<char[]> storage_;
+
+    // Positions are byte offsets that never wrap, the storage offset is
+    // `position & (capacity_ - 1)`
+
+    concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> published_{0};
+
+    // Producer-only data
+    std::uint64_t write_position_{0};
+    std::uint64_t reserved_position_{0};
+    std::size_t reserved_size_{0};
+
+    concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> released_{0};
+
+    // Consumer-only data
+    std::uint64_t read_position_{0};
+    std::uint64_t read_limit_{0};
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#include <logging/impl/thread_log_buffer.hpp>
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool TryPush(logging::impl::ThreadLogBuffer& buffer, std::uint64_t sequence, std::string_view payload) {
+    auto* const storage = buffer.TryReserve(payload.size());
+    if (!storage) return false;
+    std::memcpy(storage, payload.data(), payload.size());
+    buffer.Publish(sequence, logging::Level::kInfo);
+    return true;
+}
+
+}  // namespace
+
+TEST(ThreadLogBuffer, Basic) {
+    logging::impl::ThreadLogBuffer buffer{1024};
+    EXPECT_FALSE(buffer.HasPublished());
+
+    ASSERT_TRUE(TryPush(buffer, 1, "first"));
+    ASSERT_TRUE(TryPush(buffer, 5, ""));
+    EXPECT_TRUE(buffer.HasPublished());
+
+    buffer.BeginRead();
+    ASSERT_TRUE(TryPush(buffer, 7, "not yet visible"));
+
+    auto record = buffer.Peek();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(record->sequence, 1);
+    EXPECT_EQ(record->level, logging::Level::kInfo);
+    EXPECT_EQ(record->payload, "first");
+    buffer.Pop();
+
+    record = buffer.Peek();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(record->sequence, 5);
+    EXPECT_EQ(record->payload, "");
+    buffer.Pop();
+
+    EXPECT_FALSE(buffer.Peek());
+    buffer.Release();
+
+    buffer.BeginRead();
+    record = buffer.Peek();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(record->payload, "not yet visible");
+    buffer.Pop();
+    buffer.Release();
+    EXPECT_FALSE(buffer.HasPublished());
+}
+
+TEST(ThreadLogBuffer, Overflow) {
+    logging::impl::ThreadLogBuffer buffer{256};
+    EXPECT_EQ(buffer.TryReserve(buffer.GetMaxRecordSize() + 1), nullptr);
+
+    const std::string payload(40, 'x');
+    std::uint64_t pushed = 0;
+    while (TryPush(buffer, pushed, payload)) ++pushed;
+    EXPECT_EQ(pushed, 4);
+
+    // Popped records are not reusable until released
+    buffer.BeginRead();
+    ASSERT_TRUE(buffer.Peek());
+    buffer.Pop();
+    EXPECT_FALSE(TryPush(buffer, pushed, payload));
+
+    buffer.Release();
+    EXPECT_TRUE(TryPush(buffer, pushed, payload));
+}
+
+TEST(ThreadLogBuffer, WrapAround) {
+    logging::impl::ThreadLogBuffer buffer{256};
+
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        // The record sizes do not divide the capacity, so records do not fit
+        // the tail of the storage from time to time
+        const std::string payload(i % 40, static_cast<char>('a' + i % 26));
+        ASSERT_TRUE(TryPush(buffer, i, payload));
+
+        buffer.BeginRead();
+        const auto record = buffer.Peek();
+        ASSERT_TRUE(record);
+        EXPECT_EQ(record->sequence, i);
+        EXPECT_EQ(record->payload, payload);
+        buffer.Pop();
+        EXPECT_FALSE(buffer.Peek());
+        buffer.Release();
+    }
+}
+
+TEST(ThreadLogBuffer, Concurrent) {
+    constexpr std::uint64_t kRecords = 100'000;
+    logging::impl::ThreadLogBuffer buffer{4096};
+
+    std::thread producer([&buffer] {
+        for (std::uint64_t i = 0; i < kRecords; ++i) {
+            const auto payload = std::to_string(i);
+            while (!TryPush(buffer, i, payload)) std::this_thread::yield();
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected != kRecords) {
+        buffer.BeginRead();
+        while (const auto record = buffer.Peek()) {
+            ASSERT_EQ(record->sequence, expected);
+            ASSERT_EQ(record->payload, std::to_string(expected));
+            buffer.Pop();
+            ++expected;
+        }
+        buffer.Release();
+    }
+
+    producer.join();
+    EXPECT_FALSE(buffer.HasPublished());
+}
+
+USERVER_NAMESPACE_END
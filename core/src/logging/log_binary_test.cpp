@@ -0,0 +1,125 @@
+#include <chrono>
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/binary_log.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string Decode(std::string_view binary, logging::DecodedLogFormat format) {
+    std::string result;
+    const auto consumed = logging::DecodeBinaryLog(binary, format, result);
+    EXPECT_EQ(consumed, binary.size());
+    return result;
+}
+
+}  // namespace
+
+TEST_F(LoggingBinaryTest, Basic) {
+    constexpr std::string_view kText = "This is the binary text\tto log\n";
+    LOG_INFO() << kText << 42 << logging::LogExtra{{"custom.key", "value"}};
+    logging::LogFlush();
+
+    const auto binary = GetStreamString();
+    EXPECT_EQ(binary.find(kText), std::string::npos) << "The text should be written as is, with no escaping";
+
+    const auto tskv = Decode(binary, logging::DecodedLogFormat::kTskv);
+    ASSERT_EQ(ParseLoggedText(tskv, logging::Format::kTskv), "This is the binary text\\tto log\\n42");
+    EXPECT_TRUE(utils::text::StartsWith(tskv, "tskv\ttimestamp=")) << tskv;
+    EXPECT_NE(tskv.find("\tlevel=INFO\t"), std::string::npos) << tskv;
+    EXPECT_NE(tskv.find("\tmodule="), std::string::npos) << tskv;
+    EXPECT_NE(tskv.find("\tthread_id="), std::string::npos) << tskv;
+    EXPECT_NE(tskv.find("\tcustom_key=value"), std::string::npos) << tskv;
+
+    const auto ltsv = Decode(binary, logging::DecodedLogFormat::kLtsv);
+    EXPECT_EQ(ParseLoggedText(ltsv, logging::Format::kLtsv), "This is the binary text\\tto log\\n42");
+
+    const auto json = formats::json::FromString(Decode(binary, logging::DecodedLogFormat::kJson));
+    EXPECT_EQ(json["text"].As<std::string>(), "This is the binary text\tto log\n42");
+    EXPECT_EQ(json["level"].As<std::string>(), "INFO");
+    EXPECT_EQ(json["custom.key"].As<std::string>(), "value");
+}
+
+TEST_F(LoggingBinaryTest, LongValues) {
+    // Sizes of these values do not fit into the reserved byte
+    const std::string long_text(1000, 'x');
+    LOG_INFO() << long_text;
+    LOG_WARNING() << "short" << logging::LogExtra{{"long", std::string(20000, 'y')}};
+    logging::LogFlush();
+
+    const auto tskv = Decode(GetStreamString(), logging::DecodedLogFormat::kTskv);
+    const auto first_line_end = tskv.find('\n');
+    ASSERT_NE(first_line_end, std::string::npos);
+    const auto first_line = tskv.substr(0, first_line_end + 1);
+    const auto second_line = tskv.substr(first_line_end + 1);
+
+    EXPECT_EQ(ParseLoggedText(first_line, logging::Format::kTskv), long_text);
+    EXPECT_NE(second_line.find("\tlevel=WARNING\t"), std::string::npos);
+    EXPECT_EQ(ParseLoggedText(second_line, logging::Format::kTskv), "short");
+    EXPECT_NE(second_line.find("\tlong=" + std::string(20000, 'y') + "\n"), std::string::npos);
+}
+
+TEST_F(LoggingBinaryTest, PartialRecord) {
+    LOG_INFO() << "first";
+    LOG_INFO() << "second";
+    logging::LogFlush();
+
+    const auto binary = GetStreamString();
+    std::string tskv;
+    const auto consumed = logging::DecodeBinaryLog(
+        std::string_view{binary}.substr(0, binary.size() - 1), logging::DecodedLogFormat::kTskv, tskv
+    );
+    EXPECT_LT(consumed, binary.size());
+    EXPECT_EQ(ParseLoggedText(tskv, logging::Format::kTskv), "first");
+
+    tskv.clear();
+    EXPECT_EQ(
+        logging::DecodeBinaryLog(std::string_view{binary}.substr(consumed), logging::DecodedLogFormat::kTskv, tskv),
+        binary.size() - consumed
+    );
+    EXPECT_EQ(ParseLoggedText(tskv, logging::Format::kTskv), "second");
+}
+
+TEST_F(LoggingBinaryTest, RecordView) {
+    const auto before = std::chrono::system_clock::now();
+    LOG_WARNING() << "text\twith tab" << logging::LogExtra{{"custom.key", "value"}};
+    logging::LogFlush();
+    const auto after = std::chrono::system_clock::now();
+
+    const auto binary = GetStreamString();
+    const logging::BinaryLogRecordView record{binary};
+    EXPECT_EQ(record.GetLevel(), logging::Level::kWarning);
+    EXPECT_GE(record.GetTimestamp(), std::chrono::time_point_cast<std::chrono::microseconds>(before));
+    EXPECT_LE(record.GetTimestamp(), after);
+
+    std::map<std::string, std::string> tags;
+    record.VisitTags([&tags](std::string_view key, std::string_view value) {
+        EXPECT_TRUE(tags.emplace(key, value).second) << key;
+    });
+    EXPECT_EQ(tags["text"], "text\twith tab");
+    EXPECT_EQ(tags["custom.key"], "value");
+    EXPECT_EQ(tags.count("module"), 1);
+    EXPECT_EQ(tags.count("timestamp"), 0);
+    EXPECT_EQ(tags.count("level"), 0);
+
+    EXPECT_THROW(logging::BinaryLogRecordView{std::string_view{binary}.substr(1)}, logging::BinaryLogDecodeError);
+}
+
+TEST(BinaryLog, MalformedRecord) {
+    std::string out;
+    const std::string_view malformed{"\x03\x00\x00\x00\x07\x01\x02", 7};
+    EXPECT_THROW(
+        logging::DecodeBinaryLog(malformed, logging::DecodedLogFormat::kTskv, out), logging::BinaryLogDecodeError
+    );
+}
+
+USERVER_NAMESPACE_END
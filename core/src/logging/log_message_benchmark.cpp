@@ -15,7 +15,9 @@ namespace {
 
 class NoopLogger : public logging::impl::LoggerBase {
 public:
-    NoopLogger() noexcept : LoggerBase(logging::Format::kRaw) { SetLevel(logging::Level::kInfo); }
+    explicit NoopLogger(logging::Format format = logging::Format::kRaw) noexcept : LoggerBase(format) {
+        SetLevel(logging::Level::kInfo);
+    }
     void Log(logging::Level, std::string_view) override {}
     void Flush() override {}
 };
@@ -148,6 +150,18 @@ void LogPrependedTags(benchmark::State& state) {
 }
 BENCHMARK(LogPrependedTags);
 
+void LogFormat(benchmark::State& state, logging::Format format) {
+    const logging::DefaultLoggerGuard guard{std::make_shared<NoopLogger>(format)};
+    const auto text = Launder(std::string(state.range(0), '*'));
+    const auto value = Launder(std::string("some\tvalue\nwith=escaping"));
+
+    for ([[maybe_unused]] auto _ : state) {
+        LOG_INFO() << text << logging::LogExtra{{"key", value}, {"number", 42}};
+    }
+}
+BENCHMARK_CAPTURE(LogFormat, tskv, logging::Format::kTskv)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(LogFormat, binary, logging::Format::kBinary)->Range(8, 8 << 10);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
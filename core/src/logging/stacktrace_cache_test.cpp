@@ -1,5 +1,8 @@
 #include <userver/utest/utest.hpp>
 
+#include <chrono>
+#include <thread>
+
 #include <boost/stacktrace.hpp>
 
 #include <userver/logging/stacktrace_cache.hpp>
@@ -20,4 +23,20 @@ UTEST(StacktraceCache, StartOfCoroutine) {
     EXPECT_TRUE(utils::text::EndsWith(text, "[start of coroutine]\n")) << text;
 }
 
+TEST(StacktraceCache, Async) {
+    logging::stacktrace_cache::StacktraceGuard guard(true);
+    auto st = boost::stacktrace::stacktrace();
+    const auto expected = logging::stacktrace_cache::to_string(st);
+
+    const auto first = logging::stacktrace_cache::to_string_async(st);
+    EXPECT_NE(first, expected);
+    EXPECT_NE(first.find("0# 0x"), std::string::npos) << first;
+
+    const auto deadline = std::chrono::steady_clock::now() + utest::kMaxTestWaitTime;
+    while (logging::stacktrace_cache::to_string_async(st) != expected) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "stacktrace was not symbolized";
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
 USERVER_NAMESPACE_END
@@ -1,9 +1,17 @@
 #include "tp_logger.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <utility>
+
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <logging/impl/thread_log_buffer.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/logger.hpp>
@@ -15,18 +23,74 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace async {
+
+namespace {
+
+constexpr std::size_t kThreadBufferSize = 64 * 1024;
+
+}  // namespace
+
+struct ThreadBuffer final {
+    ThreadBuffer() : buffer(kThreadBufferSize) { wake_node.action = Wake{&is_wake_queued}; }
+
+    ThreadLogBuffer buffer;
+    std::atomic<bool> is_wake_queued{false};
+    ActionNode wake_node;
+};
+
+}  // namespace async
+
+namespace {
+
+constexpr std::size_t kMaxBatchSize = 256;
+
+// Each async logger takes a slot in the thread-local caches of the thread
+// buffers, the slots are reused by the later loggers.
+constexpr std::size_t kMaxLocalSlots = 64;
+
+struct LocalThreadBuffer final {
+    std::uint64_t logger_id{0};
+    async::ThreadBuffer* buffer{nullptr};
+};
+
+compiler::ThreadLocal local_thread_buffers = [] { return std::array<LocalThreadBuffer, kMaxLocalSlots>{}; };
+
+std::atomic<std::uint64_t> last_logger_id{0};
+std::atomic<std::uint64_t> used_local_slots{0};
+
+std::optional<std::size_t> TryAcquireLocalSlot() noexcept {
+    static_assert(kMaxLocalSlots == 64);
+    auto used = used_local_slots.load();
+    while (~used != 0) {
+        const auto slot = static_cast<std::size_t>(__builtin_ctzll(~used));
+        if (used_local_slots.compare_exchange_weak(used, used | (std::uint64_t{1} << slot))) {
+            return slot;
+        }
+    }
+    return std::nullopt;
+}
+
+void ReleaseLocalSlot(std::size_t slot) noexcept { used_local_slots.fetch_and(~(std::uint64_t{1} << slot)); }
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
     TpLogger& logger;
 
     void operator()(impl::async::Log&& log) const {
-        logger.AccountLogConsumed();
-        logger.BackendLog(std::move(log));
+        const LogMessage message{log.payload, log.level};
+        logger.BackendLog({&message, 1});
     }
 
     void operator()(impl::async::Stop&&) const noexcept {
         // The consumer thread will check state_ later.
     }
 
+    void operator()(impl::async::Wake&&) const noexcept {
+        // The consumer reads the thread buffers in any case.
+    }
+
     void operator()(impl::async::ReopenCoro&& reopen) const noexcept {
         try {
             logger.BackendReopen(reopen.reopen_mode);
@@ -45,8 +109,12 @@ struct TpLogger::ActionVisitor final {
     }
 };
 
-TpLogger::TpLogger(Format format, std::string logger_name) : LoggerBase(format), logger_name_(std::move(logger_name)) {
+TpLogger::TpLogger(Format format, std::string logger_name)
+    : LoggerBase(format), logger_name_(std::move(logger_name)), logger_id_(++last_logger_id) {
     SetLevel(logging::Level::kInfo);
+    pending_.reserve(kMaxBatchSize);
+    batch_.reserve(kMaxBatchSize);
+    batch_nodes_.reserve(kMaxBatchSize);
 }
 
 void TpLogger::StartConsumerTask(
@@ -58,6 +126,11 @@ void TpLogger::StartConsumerTask(
     max_queue_size_.store(max_queue_size);
     overflow_policy_.store(overflow_policy);
 
+    // Without a slot all the records go through the queue.
+    if (local_slot_ == kNoLocalSlot) {
+        local_slot_ = TryAcquireLocalSlot().value_or(kNoLocalSlot);
+    }
+
     auto expected = State::kSync;
     const bool success = state_.compare_exchange_strong(expected, State::kAsync);
     UINVARIANT(success, "Logger can only be switched to async mode once");
@@ -85,6 +158,13 @@ TpLogger::~TpLogger() {
         "We may be in non coroutine context, async logger must be in "
         "sync mode and consuming task must be stopped"
     );
+
+    for (std::size_t i = 0; i < thread_buffers_count_.load(); ++i) {
+        delete thread_buffers_[i];
+    }
+    if (local_slot_ != kNoLocalSlot) {
+        ReleaseLocalSlot(local_slot_);
+    }
 }
 
 void TpLogger::StopConsumerTask() {
@@ -136,14 +216,8 @@ void TpLogger::Log(Level level, std::string_view msg) {
         // The queue might have concurrently become full, in which case the size
         // will temporarily go over the max size. The actual number of log actions
         // in queue_ will not typically go over max_size + n_threads.
-        produced_->fetch_add(1);
-
-        try {
+        if (!TryPushToThreadBuffer(level, msg)) {
             Push(impl::async::Log{level, std::string{msg}});
-        } catch (const std::exception&) {
-            // failed to construct a Log action or a node in Push
-            produced_->fetch_sub(1);
-            throw;
         }
     } else {
         ++stats_.dropped;
@@ -182,17 +256,41 @@ void TpLogger::ProcessingLoop() {
     const engine::TaskCancellationBlocker cancel_blocker;
 
     while (true) {
-        ConsumeQueueOnce(queue_consumer_);
+        const bool is_complete = ConsumeAvailable(queue_consumer_, /*wait_for_gaps=*/true);
         if (state_ != State::kAsync) {
             UASSERT(state_ == State::kStoppingAsync);
             break;
         }
-        queue_.WaitWhileEmpty(queue_consumer_);
+
+        if (is_complete) {
+            WaitForActions();
+        } else {
+            // A producer has taken a sequence number, but has not published
+            // its record yet, it takes a few instructions.
+            engine::Yield();
+        }
     }
 
     CleanUpQueue(std::move(queue_consumer_));
 }
 
+void TpLogger::WaitForActions() noexcept {
+    is_consumer_sleeping_->store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!HasThreadBufferRecords()) {
+        queue_.WaitWhileEmpty(queue_consumer_);
+    }
+    is_consumer_sleeping_->store(false);
+}
+
+bool TpLogger::HasThreadBufferRecords() const noexcept {
+    const auto count = thread_buffers_count_.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (thread_buffers_[i]->buffer.HasPublished()) return true;
+    }
+    return false;
+}
+
 void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
     try {
         std::visit(ActionVisitor{*this}, std::move(action));
@@ -225,6 +323,9 @@ bool TpLogger::TryWaitFreeQueueCapacity() {
 void TpLogger::Push(impl::async::Action&& action) {
     auto node = std::make_unique<impl::async::ActionNode>();
     node->action = std::move(action);
+    // Nothing may throw after taking a sequence number, as the consumer waits
+    // for all the sequence numbers.
+    node->sequence = TakeSequence();
     DoPush(*node.release());
 }
 
@@ -235,8 +336,75 @@ void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
     }
 }
 
-void TpLogger::AccountLogConsumed() noexcept {
-    consumed_->store(consumed_->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+std::uint64_t TpLogger::TakeSequence() noexcept { return static_cast<std::uint64_t>(produced_->fetch_add(1)); }
+
+bool TpLogger::TryPushToThreadBuffer(Level level, std::string_view msg) {
+    if (state_.load() != State::kAsync) return false;
+
+    auto* const thread_buffer = GetThreadBuffer();
+    if (!thread_buffer) return false;
+
+    // Large records and the records that do not fit into the buffer of a
+    // lagging consumer go through the queue.
+    auto* const storage = thread_buffer->buffer.TryReserve(msg.size());
+    if (!storage) return false;
+
+    if (!msg.empty()) std::memcpy(storage, msg.data(), msg.size());
+    thread_buffer->buffer.Publish(TakeSequence(), level);
+    NotifyConsumer(*thread_buffer);
+    return true;
+}
+
+impl::async::ThreadBuffer* TpLogger::GetThreadBuffer() {
+    if (local_slot_ == kNoLocalSlot || !engine::current_task::IsTaskProcessorThread()) {
+        return nullptr;
+    }
+
+    // There must be no context switches until the end of the scope, otherwise
+    // the thread buffer might get another producer thread.
+    auto local_buffers = local_thread_buffers.Use();
+    auto& local_buffer = (*local_buffers)[local_slot_];
+    if (local_buffer.logger_id != logger_id_) {
+        local_buffer.buffer = RegisterThreadBuffer();
+        local_buffer.logger_id = logger_id_;
+    }
+    return local_buffer.buffer;
+}
+
+impl::async::ThreadBuffer* TpLogger::RegisterThreadBuffer() {
+    const std::lock_guard lock{thread_buffers_mutex_};
+    const auto count = thread_buffers_count_.load(std::memory_order_relaxed);
+    if (count == thread_buffers_.size()) {
+        // The records of the remaining threads go through the queue.
+        return nullptr;
+    }
+
+    thread_buffers_[count] = new impl::async::ThreadBuffer();
+    thread_buffers_count_.store(count + 1, std::memory_order_release);
+    return thread_buffers_[count];
+}
+
+void TpLogger::NotifyConsumer(impl::async::ThreadBuffer& buffer) noexcept {
+    // Pairs with the fences of the consumer. Either the consumer sees
+    // the published record, or we see it going to sleep or stopping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // If the logger is being stopped, the consumer might have already done
+    // its last read of the thread buffers, so the queue consumer has to read
+    // them once more.
+    if (state_.load(std::memory_order_relaxed) == State::kAsync) {
+        if (!is_consumer_sleeping_->load(std::memory_order_relaxed) || !is_consumer_sleeping_->exchange(false)) {
+            return;
+        }
+    }
+
+    if (!buffer.is_wake_queued.exchange(true)) {
+        DoPush(buffer.wake_node);
+    }
+}
+
+void TpLogger::AccountConsumed(QueueSize count) noexcept {
+    consumed_->store(consumed_->load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
     if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
         {
             // Atomic consumed_ mutation doesn't need to be protected by lock.
@@ -246,43 +414,139 @@ void TpLogger::AccountLogConsumed() noexcept {
             //    not fall asleep
             const std::lock_guard lock{capacity_waiters_mutex_};
         }
-        capacity_waiters_cv_.NotifyOne();
+        capacity_waiters_cv_.NotifyAll();
     }
 }
 
-void TpLogger::ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
+void TpLogger::AddPending(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
     auto& action_node = static_cast<impl::async::ActionNode&>(node);
-    if (&action_node == &stop_node_) return;
+    if (action_node.sequence == impl::async::kUnsequenced) {
+        if (auto* const wake = std::get_if<impl::async::Wake>(&action_node.action)) {
+            wake->is_queued->store(false);
+        }
+        return;
+    }
 
-    BackendPerform(std::move(action_node.action));
-    delete &action_node;
+    pending_.push_back(&action_node);
 }
 
-void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
-    while (auto* const node_base = consumer.TryPop()) {
-        ConsumeNode(*node_base);
+bool TpLogger::ConsumeAvailable(Queue::Consumer& consumer, bool wait_for_gaps) noexcept {
+    while (auto* const node = consumer.TryPop()) {
+        AddPending(*node);
     }
+    // The smallest sequence numbers are at the back.
+    std::sort(pending_.begin(), pending_.end(), [](const auto* lhs, const auto* rhs) {
+        return lhs->sequence > rhs->sequence;
+    });
+
+    // Pairs with the fence in NotifyConsumer.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto buffer_count = thread_buffers_count_.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < buffer_count; ++i) {
+        thread_buffers_[i]->buffer.BeginRead();
+    }
+
+    bool is_complete = true;
+    while (true) {
+        // Merges the thread buffers and the queue in the order of sequence
+        // numbers, there are few buffers, so a linear search is fine.
+        auto sequence = impl::async::kUnsequenced;
+        std::optional<ThreadLogBuffer::Record> record;
+        ThreadLogBuffer* record_buffer = nullptr;
+        for (std::size_t i = 0; i < buffer_count; ++i) {
+            auto& buffer = thread_buffers_[i]->buffer;
+            auto candidate = buffer.Peek();
+            if (candidate && candidate->sequence < sequence) {
+                sequence = candidate->sequence;
+                record = candidate;
+                record_buffer = &buffer;
+            }
+        }
+
+        impl::async::ActionNode* node = nullptr;
+        if (!pending_.empty() && pending_.back()->sequence < sequence) {
+            node = pending_.back();
+            sequence = node->sequence;
+        }
+
+        if (sequence == impl::async::kUnsequenced) break;
+
+        // Records are taken out of order only while switching to the sync mode,
+        // when having the queue consumer must not wait for producers.
+        if (wait_for_gaps && sequence > next_sequence_) {
+            is_complete = false;
+            break;
+        }
+        next_sequence_ = std::max(next_sequence_, sequence + 1);
+        ++batch_sequenced_;
+
+        if (!node) {
+            batch_.push_back(LogMessage{record->payload, record->level});
+            record_buffer->Pop();
+        } else {
+            pending_.pop_back();
+            if (auto* const log = std::get_if<impl::async::Log>(&node->action)) {
+                batch_.push_back(LogMessage{log->payload, log->level});
+                batch_nodes_.push_back(node);
+            } else {
+                WriteBatch();
+                BackendPerform(std::move(node->action));
+                delete node;
+            }
+        }
+
+        if (batch_.size() == kMaxBatchSize) WriteBatch();
+    }
+
+    WriteBatch();
+    return is_complete;
 }
 
-void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
-    std::move(consumer).ConsumeAndStop([this](auto& node) noexcept { ConsumeNode(node); });
+void TpLogger::WriteBatch() noexcept {
+    if (!batch_.empty()) {
+        try {
+            BackendLog(batch_);
+        } catch (const std::exception& e) {
+            UASSERT_MSG(false, fmt::format("Exception while doing an async logging: {}", e.what()));
+        }
+    }
+
+    // Payloads of the batch are no longer needed.
+    const auto buffer_count = thread_buffers_count_.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < buffer_count; ++i) {
+        thread_buffers_[i]->buffer.Release();
+    }
+    for (auto* const node : batch_nodes_) {
+        delete node;
+    }
+    batch_.clear();
+    batch_nodes_.clear();
+
+    if (batch_sequenced_ != 0) {
+        AccountConsumed(std::exchange(batch_sequenced_, 0));
+    }
 }
 
-void TpLogger::BackendLog(impl::async::Log&& action) const {
-    LogMessage message;
-    message.payload = action.payload;
-    message.level = action.level;
+void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
+    do {
+        ConsumeAvailable(consumer, /*wait_for_gaps=*/false);
+    } while (!consumer.TryStopConsuming());
+}
 
+void TpLogger::BackendLog(utils::span<const LogMessage> messages) const {
     for (const auto& sink : GetSinks()) {
         try {
-            sink->Log(message);
+            sink->Log(messages);
         } catch (const std::exception& e) {
             UASSERT_MSG(false, "While writing a log message caught an exception: " + std::string(e.what()));
         }
     }
 
-    if (ShouldFlush(message.level)) {
+    const bool should_flush = std::any_of(messages.begin(), messages.end(), [this](const auto& message) {
+        return ShouldFlush(message.level);
+    });
+    if (should_flush) {
         BackendFlush();
     }
 }
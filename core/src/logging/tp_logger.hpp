@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -53,15 +56,33 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+// Wakes up the consumer to read the thread buffers.
+struct Wake {
+    std::atomic<bool>* is_queued{nullptr};
+};
+
+using Action = std::variant<Stop, Wake, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+
+inline constexpr std::uint64_t kUnsequenced = std::numeric_limits<std::uint64_t>::max();
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
     Action action{Stop{}};
+    // Position of the action among the actions and the thread buffer records,
+    // kUnsequenced for the notifications.
+    std::uint64_t sequence{kUnsequenced};
 };
 
+struct ThreadBuffer;
+
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
+///
+/// In the async mode each TaskProcessor worker thread copies its records into
+/// its own ThreadLogBuffer, other threads, large records and the control
+/// actions go through the shared queue. Every record and action takes a
+/// sequence number, and the consumer writes them in the sequence order in
+/// batches.
 class TpLogger final : public LoggerBase {
 public:
     TpLogger(Format format, std::string logger_name);
@@ -102,17 +123,28 @@ private:
     using Queue = engine::impl::AsyncFlatCombiningQueue;
     using QueueSize = std::int64_t;
 
+    static constexpr std::size_t kMaxThreadBuffers = 256;
+    static constexpr std::size_t kNoLocalSlot = std::numeric_limits<std::size_t>::max();
+
     void ProcessingLoop();
     bool HasFreeQueueCapacity() noexcept;
     bool TryWaitFreeQueueCapacity();
     void Push(impl::async::Action&& action);
     void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
-    void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
-    void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
+    bool TryPushToThreadBuffer(Level level, std::string_view msg);
+    impl::async::ThreadBuffer* GetThreadBuffer();
+    impl::async::ThreadBuffer* RegisterThreadBuffer();
+    void NotifyConsumer(impl::async::ThreadBuffer& buffer) noexcept;
+    std::uint64_t TakeSequence() noexcept;
+    void WaitForActions() noexcept;
+    bool HasThreadBufferRecords() const noexcept;
+    bool ConsumeAvailable(Queue::Consumer& consumer, bool wait_for_gaps) noexcept;
+    void AddPending(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
+    void WriteBatch() noexcept;
     void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
-    void AccountLogConsumed() noexcept;
+    void AccountConsumed(QueueSize count) noexcept;
     void BackendPerform(impl::async::Action&& action) noexcept;
-    void BackendLog(impl::async::Log&& action) const;
+    void BackendLog(utils::span<const LogMessage> messages) const;
     void BackendFlush() const;
     void BackendReopen(ReopenMode reopen_mode) const;
 
@@ -134,6 +166,21 @@ private:
     Queue queue_;
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
+    concurrent::impl::InterferenceShield<std::atomic<bool>> is_consumer_sleeping_{false};
+
+    // Thread buffers are only appended, and are destroyed with the logger.
+    const std::uint64_t logger_id_;
+    std::size_t local_slot_{kNoLocalSlot};
+    std::mutex thread_buffers_mutex_;
+    std::array<impl::async::ThreadBuffer*, kMaxThreadBuffers> thread_buffers_{};
+    std::atomic<std::size_t> thread_buffers_count_{0};
+
+    // The data of the current queue consumer.
+    std::uint64_t next_sequence_{0};
+    std::vector<impl::async::ActionNode*> pending_;
+    std::vector<LogMessage> batch_;
+    std::vector<impl::async::ActionNode*> batch_nodes_;
+    QueueSize batch_sequenced_{0};
 };
 
 }  // namespace logging::impl
@@ -9,6 +9,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 #include <utils/gbench_auxilary.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -58,6 +59,23 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogString)(benchmark::State& state) {
 // Run benchmarks to output string of sizes of 8 bytes to 8 kilobytes
 BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
 
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringParallel)(benchmark::State& state) {
+    // One more thread for the consumer
+    engine::RunStandalone(state.range(0) + 1, [&] {
+        auto scope = StartAsyncLoggerScope();
+        const auto msg = Launder(std::string(state.range(1), '*'));
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                LOG_INFO() << msg;
+            }
+        });
+    });
+}
+// Run benchmarks with many producer threads
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringParallel)
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {64, 512}})
+    ->UseRealTime();
+
 namespace {
 
 __attribute__((noinline)) void LogDebug() { LOG_DEBUG() << 42; }
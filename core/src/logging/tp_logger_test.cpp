@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -742,4 +743,46 @@ UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleStdThreadFlushSyncCancelMT, 4) {
     EXPECT_EQ(GetRecordsCount(), message_count);
 }
 
+UTEST_F_MT(LoggingTestCoro, TpLoggerOrderMT, 4) {
+    const std::size_t message_count = kLoggingTestIterations * GetThreadCount();
+    auto logger = StartAsyncLogger(message_count * 10, QueueOverflowBehavior::kBlock);
+    // Records of this size do not fit into the thread buffers and go through
+    // the queue
+    const logging::LogExtra large_extra{{"padding", std::string(32 * 1024, '-')}};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t task_index = 0; task_index < GetThreadCount(); ++task_index) {
+        tasks.push_back(engine::AsyncNoSpan([&logger, &large_extra, task_index] {
+            for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+                if (i % 10 == 0) {
+                    LOG_INFO_TO(logger) << "ordered " << i << " at " << task_index << ';' << large_extra;
+                } else {
+                    LOG_INFO_TO(logger) << "ordered " << i << " at " << task_index << ';';
+                }
+
+                // Lets the task migrate between the threads
+                if (i % 7 == 0) {
+                    engine::Yield();
+                }
+            }
+        }));
+    }
+
+    for (auto& task : tasks) {
+        task.Get();
+    }
+    logger->StopConsumerTask();
+
+    // Records of each task are written in the order of logging
+    const auto logs = GetStreamString();
+    for (std::size_t task_index = 0; task_index < GetThreadCount(); ++task_index) {
+        std::size_t position = 0;
+        for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+            position = logs.find(fmt::format("text=ordered {} at {};", i, task_index), position);
+            ASSERT_NE(position, std::string::npos) << "record " << i << " of task " << task_index;
+        }
+    }
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
 USERVER_NAMESPACE_END
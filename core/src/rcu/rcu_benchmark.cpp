@@ -9,15 +9,17 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/rcu/sharded_rcu_map.hpp>
 #include <userver/utils/async.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-template <int VariableCount>
+template <int VariableCount, typename RcuTraits = rcu::DefaultRcuTraits>
 void rcu_read(benchmark::State& state) {
     engine::RunStandalone([&] {
-        rcu::Variable<std::uint64_t> vars[VariableCount];
+        rcu::Variable<std::uint64_t, RcuTraits> vars[VariableCount];
         {
             std::uint64_t i = 0;
             for (auto& var : vars) {
@@ -37,6 +39,8 @@ void rcu_read(benchmark::State& state) {
 BENCHMARK_TEMPLATE(rcu_read, 1);
 BENCHMARK_TEMPLATE(rcu_read, 2);
 BENCHMARK_TEMPLATE(rcu_read, 4);
+BENCHMARK_TEMPLATE(rcu_read, 1, rcu::EpochRcuTraits);
+BENCHMARK_TEMPLATE(rcu_read, 4, rcu::EpochRcuTraits);
 
 template <int VariableCount>
 void rcu_write(benchmark::State& state) {
@@ -54,6 +58,7 @@ BENCHMARK_TEMPLATE(rcu_write, 1);
 BENCHMARK_TEMPLATE(rcu_write, 2);
 BENCHMARK_TEMPLATE(rcu_write, 4);
 
+template <typename RcuTraits>
 void rcu_contention(benchmark::State& state) {
     const std::size_t readers_count = state.range(0);
     const std::size_t writers_count = state.range(1);
@@ -63,14 +68,14 @@ void rcu_contention(benchmark::State& state) {
 
     engine::RunStandalone(thread_count, [&] {
         std::atomic<bool> run{true};
-        rcu::Variable<std::uint64_t> var{0};
+        rcu::Variable<std::uint64_t, RcuTraits> var{0};
 
         std::vector<engine::TaskWithResult<void>> tasks;
         tasks.reserve(readers_count - 1 + writers_count);
 
         for (std::size_t j = 0; j < readers_count - 1; j++) {
             tasks.push_back(utils::Async("reader", [&] {
-                std::vector<rcu::ReadablePtr<std::uint64_t>> pointers;
+                std::vector<rcu::ReadablePtr<std::uint64_t, RcuTraits>> pointers;
                 pointers.reserve(kept_readable_pointers_count);
 
                 while (run) {
@@ -94,7 +99,7 @@ void rcu_contention(benchmark::State& state) {
         }
 
         {
-            std::queue<rcu::ReadablePtr<std::uint64_t>> pointers;
+            std::queue<rcu::ReadablePtr<std::uint64_t, RcuTraits>> pointers;
             for (std::size_t i = 0; i < kept_readable_pointers_count; i++) {
                 pointers.push(var.Read());
             }
@@ -112,7 +117,11 @@ void rcu_contention(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(rcu_contention)
+BENCHMARK_TEMPLATE(rcu_contention, rcu::DefaultRcuTraits)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 16}, {0, 1}, {1, 4}})
+    ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
+BENCHMARK_TEMPLATE(rcu_contention, rcu::EpochRcuTraits)
     ->RangeMultiplier(2)
     ->Ranges({{1, 16}, {0, 1}, {1, 4}})
     ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
@@ -133,4 +142,69 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+namespace {
+
+constexpr std::uint64_t kMapBenchmarkKeys = 10000;
+
+template <typename Map>
+void FillMap(Map& map) {
+    typename Map::RawMap items;
+    for (std::uint64_t i = 0; i < kMapBenchmarkKeys; ++i) items.emplace(i, std::make_shared<std::uint64_t>(i));
+    map.Assign(std::move(items));
+}
+
+// Every writer inserts and erases its own keys, so that each write changes
+// the keyset and copies the map (or its shard)
+template <typename Map>
+void RunMapWriters(benchmark::State& state, Map& map) {
+    std::atomic<std::uint64_t> next_writer{0};
+    RunParallelBenchmark(state, [&](auto& range) {
+        const auto key = kMapBenchmarkKeys + next_writer++;
+        for ([[maybe_unused]] auto _ : range) {
+            map.Emplace(key, key);
+            map.Erase(key);
+        }
+    });
+}
+
+}  // namespace
+
+void rcu_map_write_contention(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        rcu::RcuMap<std::uint64_t, std::uint64_t> map;
+        FillMap(map);
+        RunMapWriters(state, map);
+    });
+}
+BENCHMARK(rcu_map_write_contention)->RangeMultiplier(2)->Range(1, 8);
+
+void sharded_rcu_map_write_contention(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        rcu::ShardedRcuMap<std::uint64_t, std::uint64_t> map;
+        FillMap(map);
+        RunMapWriters(state, map);
+    });
+}
+BENCHMARK(sharded_rcu_map_write_contention)->RangeMultiplier(2)->Range(1, 8);
+
+void sharded_rcu_map_bulk_insert(benchmark::State& state) {
+    const auto batch_size = static_cast<std::uint64_t>(state.range(0));
+
+    engine::RunStandalone([&] {
+        rcu::ShardedRcuMap<std::uint64_t, std::uint64_t> map;
+        FillMap(map);
+
+        std::uint64_t i = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            rcu::ShardedRcuMap<std::uint64_t, std::uint64_t>::RawMap items;
+            for (std::uint64_t j = 0; j < batch_size; ++j, ++i) {
+                items.emplace(i % kMapBenchmarkKeys, std::make_shared<std::uint64_t>(i));
+            }
+            map.BulkInsert(std::move(items));
+        }
+        state.SetItemsProcessed(state.iterations() * batch_size);
+    });
+}
+BENCHMARK(sharded_rcu_map_bulk_insert)->RangeMultiplier(8)->Range(1, 512);
+
 USERVER_NAMESPACE_END
@@ -322,4 +322,30 @@ UTEST(RcuMap, StartWriteNoTearing) {
     UEXPECT_NO_THROW(checker.Get());
 }
 
+namespace {
+
+struct EpochRcuMapTraits : public rcu::DefaultRcuMapTraits<int> {
+    static constexpr auto kReclamationMode = rcu::ReclamationMode::kEpochs;
+};
+
+}  // namespace
+
+UTEST_MT(RcuMap, EpochReclamation, 3) {
+    rcu::RcuMap<int, int, EpochRcuMapTraits> map;
+    std::atomic<bool> stop{false};
+
+    auto reader = utils::Async("reader", [&] {
+        while (!stop) {
+            for (const auto& [key, value] : map) EXPECT_EQ(key, *value);
+        }
+    });
+
+    for (int i = 0; i < 1000; ++i) map.Emplace(i, i);
+    for (int i = 0; i < 1000; i += 2) map.Erase(i);
+    stop = true;
+    reader.Get();
+
+    EXPECT_EQ(map.SizeApprox(), 500);
+}
+
 USERVER_NAMESPACE_END
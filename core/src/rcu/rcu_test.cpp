@@ -4,6 +4,7 @@
 #include <future>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <engine/task/task_context.hpp>
 #include <userver/engine/sleep.hpp>
@@ -639,4 +640,95 @@ UTEST(Rcu, EmplaceExceptionInitial) {
     // Should not leak memory, detectable by Asan.
 }
 
+namespace {
+
+struct SyncEpochRcuTraits : public rcu::EpochRcuTraits {
+    using DeleterType = rcu::SyncDeleter;
+};
+
+}  // namespace
+
+UTEST(Rcu, EpochsLifetime) {
+    using Counted = Counted<struct EpochsLifetimeTag>;
+
+    rcu::Variable<Counted, SyncEpochRcuTraits> var;
+    EXPECT_EQ(1, Counted::counter);
+
+    // Without readers the old version is reclaimed on commit
+    {
+        auto writer = var.StartWrite();
+        writer->value = 2;
+        writer.Commit();
+    }
+    EXPECT_EQ(1, Counted::counter);
+
+    {
+        auto reader = var.Read();
+        {
+            auto writer = var.StartWrite();
+            writer->value = 3;
+            writer.Commit();
+        }
+        EXPECT_EQ(2, Counted::counter);
+
+        // Versions retired after the reader was created are not reclaimed
+        // as well
+        {
+            auto writer = var.StartWrite();
+            writer->value = 4;
+            writer.Commit();
+        }
+        EXPECT_EQ(3, Counted::counter);
+        EXPECT_EQ(2, reader->value);
+        EXPECT_EQ(4, var.ReadCopy().value);
+    }
+
+    var.Cleanup();
+    EXPECT_EQ(1, Counted::counter);
+    EXPECT_EQ(4, var.ReadCopy().value);
+}
+
+UTEST(Rcu, EpochsAsyncDeleter) {
+    using Counted = Counted<struct EpochsAsyncDeleterTag>;
+
+    {
+        rcu::Variable<Counted, rcu::EpochRcuTraits> var;
+        for (int i = 0; i < 10; ++i) {
+            auto reader = var.Read();
+            auto writer = var.StartWrite();
+            writer->value = reader->value + 1;
+            writer.Commit();
+        }
+        EXPECT_EQ(11, var.ReadCopy().value);
+    }
+    EXPECT_EQ(0, Counted::counter);
+}
+
+UTEST_MT(Rcu, EpochsConcurrentReadWrite, 4) {
+    constexpr std::size_t kReaders = 3;
+
+    rcu::Variable<X, SyncEpochRcuTraits> var(0, 0);
+    std::atomic<bool> stop{false};
+
+    std::vector<engine::TaskWithResult<void>> readers;
+    for (std::size_t i = 0; i < kReaders; ++i) {
+        readers.push_back(engine::AsyncNoSpan([&] {
+            while (!stop) {
+                auto reader = var.Read();
+                const auto value = *reader;
+                engine::Yield();
+                // The version must stay alive and unchanged while it is read
+                EXPECT_EQ(value, *reader);
+                EXPECT_EQ(reader->first, reader->second);
+            }
+        }));
+    }
+
+    for (int i = 1; i < 10000; ++i) var.Assign(X{i, i});
+    stop = true;
+    for (auto& reader : readers) reader.Get();
+
+    EXPECT_EQ(std::make_pair(9999, 9999), var.ReadCopy());
+}
+
 USERVER_NAMESPACE_END
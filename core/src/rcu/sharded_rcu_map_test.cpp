@@ -0,0 +1,137 @@
+#include <userver/rcu/sharded_rcu_map.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = rcu::ShardedRcuMap<int, int>;
+
+}  // namespace
+
+UTEST(ShardedRcuMap, Empty) {
+    const Map map;
+    EXPECT_EQ(map.SizeApprox(), 0);
+    EXPECT_EQ(map.GetShardCount(), Map::kDefaultShardCount);
+    EXPECT_FALSE(map.Get(1));
+    UEXPECT_THROW(map[1], rcu::MissingKeyException);
+    EXPECT_TRUE(map.GetSnapshot().empty());
+}
+
+UTEST(ShardedRcuMap, InsertErase) {
+    Map map{4};
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(map.Insert(i, std::make_shared<int>(i)).inserted);
+    }
+    EXPECT_FALSE(map.Insert(1, std::make_shared<int>(-1)).inserted);
+    EXPECT_FALSE(map.Emplace(2, -1).inserted);
+    EXPECT_TRUE(map.TryEmplace(100, 100).inserted);
+    map.InsertOrAssign(3, std::make_shared<int>(-3));
+    EXPECT_EQ(map.SizeApprox(), 101);
+
+    EXPECT_EQ(*map[1], 1);
+    EXPECT_EQ(*map[2], 2);
+    EXPECT_EQ(*map[3], -3);
+    EXPECT_EQ(*map.Get(100), 100);
+
+    EXPECT_TRUE(map.Erase(1));
+    EXPECT_FALSE(map.Erase(1));
+    EXPECT_EQ(*map.Pop(2), 2);
+    EXPECT_FALSE(map.Pop(2));
+    EXPECT_EQ(map.SizeApprox(), 99);
+
+    map.Clear();
+    EXPECT_EQ(map.SizeApprox(), 0);
+}
+
+UTEST(ShardedRcuMap, BulkInsertAssign) {
+    Map map{8};
+    map.Emplace(-1, -1);
+
+    Map::RawMap items;
+    for (int i = 0; i < 1000; ++i) items.emplace(i, std::make_shared<int>(i));
+    map.BulkInsert(std::move(items));
+    EXPECT_EQ(map.SizeApprox(), 1001);
+    EXPECT_EQ(*map[-1], -1);
+    EXPECT_EQ(*map[999], 999);
+
+    const auto snapshot = map.GetSnapshot();
+    EXPECT_EQ(snapshot.size(), 1001);
+    for (const auto& [key, value] : snapshot) EXPECT_EQ(key, *value);
+
+    Map::RawMap new_map;
+    new_map.emplace(5, std::make_shared<int>(50));
+    map.Assign(std::move(new_map));
+    EXPECT_EQ(map.SizeApprox(), 1);
+    EXPECT_EQ(*map[5], 50);
+    EXPECT_FALSE(map.Get(-1));
+}
+
+UTEST(ShardedRcuMap, StartWrite) {
+    Map map;
+    map.Emplace(1, 1);
+
+    auto txn = map.StartWrite(1);
+    (*txn)[1] = std::make_shared<int>(10);
+    EXPECT_EQ(*map[1], 1);
+    txn.Commit();
+    EXPECT_EQ(*map[1], 10);
+}
+
+UTEST(ShardedRcuMap, SampleShardedRcuMap) {
+    /// [Sample rcu::ShardedRcuMap usage]
+    rcu::ShardedRcuMap<std::string, int> map{/*shard_count=*/4};
+
+    // Single key changes copy a quarter of the map on average
+    map.Emplace("one", 1);
+    map.InsertOrAssign("two", std::make_shared<int>(2));
+
+    // Publishes all the changes copying each of the shards at most once
+    rcu::ShardedRcuMap<std::string, int>::RawMap items;
+    for (int i = 0; i < 100; ++i) items.emplace(std::to_string(i), std::make_shared<int>(i));
+    map.BulkInsert(std::move(items));
+
+    ASSERT_EQ(*map["one"], 1);
+    ASSERT_EQ(*map["42"], 42);
+    ASSERT_EQ(map.SizeApprox(), 102);
+    /// [Sample rcu::ShardedRcuMap usage]
+}
+
+UTEST_MT(ShardedRcuMap, ConcurrentWriters, 4) {
+    constexpr int kWriters = 4;
+    constexpr int kKeysPerWriter = 500;
+
+    Map map{8};
+    std::atomic<bool> run{true};
+
+    auto reader = utils::Async("reader", [&] {
+        while (run) {
+            map.VisitAll([](int key, const Map::ConstValuePtr& value) { EXPECT_EQ(key, *value); });
+        }
+    });
+
+    std::vector<engine::TaskWithResult<void>> writers;
+    for (int writer = 0; writer < kWriters; ++writer) {
+        writers.push_back(utils::Async("writer", [&map, writer] {
+            for (int i = 0; i < kKeysPerWriter; ++i) {
+                const int key = writer * kKeysPerWriter + i;
+                map.Emplace(key, key);
+            }
+        }));
+    }
+    for (auto& writer : writers) writer.Get();
+    run = false;
+    reader.Get();
+
+    EXPECT_EQ(map.SizeApprox(), kWriters * kKeysPerWriter);
+    for (int key = 0; key < kWriters * kKeysPerWriter; ++key) EXPECT_EQ(*map[key], key);
+}
+
+USERVER_NAMESPACE_END
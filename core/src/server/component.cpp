@@ -132,6 +132,13 @@ properties:
                     private-key-passphrase-name:
                         type: string
                         description: passphrase name located in secdist
+                    session-ticket-keys-name:
+                        type: string
+                        description: name of the TLS session ticket keys list located in secdist 'tls_session_ticket_keys' entry, the first key encrypts new tickets
+                    kernel-tls-tx:
+                        type: boolean
+                        description: encrypt the sent data in kernel (kTLS) if supported, allows sendfile(2) for TLS
+                        defaultDescription: false
             handler-defaults:
                 type: object
                 description: handler defaults options
@@ -184,6 +191,10 @@ properties:
                         type: integer
                         description: "size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU"
                         defaultDescription: 32 * 1024
+                    in_buffer_pool_max_idle:
+                        type: integer
+                        description: "receive buffers are shared by the connections of a listener and are held only while there is data to read; this is the max count of unused buffers kept for reuse, 0 gives each connection its own buffer for its whole lifetime"
+                        defaultDescription: 256
                     requests_queue_size_threshold:
                         type: integer
                         description: drop requests from handlers that allow throttling if there's more pending requests than allowed by this value
@@ -192,6 +203,15 @@ properties:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+                    pipeline_depth:
+                        type: integer
+                        description: "max count of the pipelined HTTP/1.1 requests of a connection that are processed concurrently, the responses are still sent in order"
+                        defaultDescription: 1
+                        minimum: 1
+                    pipeline_max_buffered_size:
+                        type: integer
+                        description: "the pipelined requests are not started ahead of their turn while the ready responses waiting for the preceding ones take more bytes than this value"
+                        defaultDescription: 1024 * 1024
                     stream_close_check_delay:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
@@ -222,6 +242,18 @@ properties:
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            steer_connections_by_cpu:
+                type: boolean
+                description: "each shard listens on its own SO_REUSEPORT socket; set to true to make the kernel pass a new connection to the shard number `cpu % shards`, where `cpu` handles the incoming packet, instead of hashing; Linux only"
+                defaultDescription: false
+            low_latency:
+                type: boolean
+                description: "set to true to trade CPU for latency on accepted connections: the kernel acknowledges each received TCP segment immediately (TCP_QUICKACK) and busy polls the device queue for `busy_poll_us` waiting for the data (SO_BUSY_POLL, SO_PREFER_BUSY_POLL); Linux only"
+                defaultDescription: false
+            busy_poll_us:
+                type: integer
+                description: "busy polling time in microseconds for the `low_latency` mode, values above the net.core.busy_read sysctl require CAP_NET_ADMIN; 0 disables busy polling"
+                defaultDescription: 50
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
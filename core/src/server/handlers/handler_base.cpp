@@ -111,6 +111,21 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: deliver the request body to the handler via server::http::HttpRequest::GetBodyStream() while it is being received, the handler is started right after the request headers; the max_request_size limit does not apply to the body
+        defaultDescription: false
+    run-inline:
+        type: boolean
+        description: |
+            run the handler right in the coroutine of the connection instead of
+            a separate task on the handler task_processor, saving the task
+            creation and context switches per request. Only for cheap
+            non-blocking handlers: the pipelined requests and HTTP/2 streams of
+            the connection wait for the handler, the handler is not cancelled
+            when the client closes the connection and is not interrupted when
+            the deadline expires (the deadline is still propagated)
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
@@ -142,6 +157,23 @@ properties:
         defaultDescription: taken from server.listener.handler-defaults.deadline_expired_status_code
         minimum: 400
         maximum: 599
+    deadline_early_rejection_enabled:
+        type: boolean
+        description: |
+            respond with deadline_expired_status_code right away, without
+            running the handler, if the time left till the propagated deadline
+            is less than the median handling time of the recent requests to
+            this handler. No requests are rejected until the handler has
+            enough recent requests to estimate the median.
+        defaultDescription: false
+    deadline_propagation_reserve:
+        type: string
+        description: |
+            time to subtract from the deadline propagated to the downstream
+            services and databases, so that there is time left to build and
+            send the response when they time out. The handler itself is still
+            interrupted by the original deadline.
+        defaultDescription: 0ms
 )");
 }
 
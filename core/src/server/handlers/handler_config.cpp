@@ -77,6 +77,12 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
     config.set_response_server_hostname = value["set-response-server-hostname"].As<std::optional<bool>>();
 
     config.response_body_stream = value["response-body-stream"].As<bool>(false);
+    config.request_body_stream = value["request-body-stream"].As<bool>(false);
+    config.run_inline = value["run-inline"].As<bool>(false);
+
+    if (config.run_inline && (config.response_body_stream || config.request_body_stream)) {
+        throw std::runtime_error("run-inline can not be combined with response-body-stream or request-body-stream");
+    }
 
     if (config.max_requests_per_second && config.max_requests_per_second.value() <= 0) {
         throw std::runtime_error(
@@ -93,6 +99,10 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
     config.deadline_expired_status_code =
         value["deadline_expired_status_code"].As<http::HttpStatus>(handler_defaults.deadline_expired_status_code);
 
+    config.deadline_early_rejection_enabled = value["deadline_early_rejection_enabled"].As<bool>(false);
+    config.deadline_propagation_reserve =
+        value["deadline_propagation_reserve"].As<std::chrono::milliseconds>(std::chrono::milliseconds{0});
+
     return config;
 }
 
@@ -203,6 +203,9 @@ void HttpHandlerBase::HandleRequestStream(http::HttpRequest& http_request, reque
     const utils::ScopeGuard scope([&response] { response.SetHeadersEnd(); });
 
     server::http::ResponseBodyStream response_body_stream{response.GetBodyProducer(), response};
+    if (auto encoder = context.GetInternalContext().ExtractResponseBodyEncoder()) {
+        response_body_stream.SetEncoder(std::move(encoder));
+    }
 
     // Just in case HandleStreamRequest() throws an exception.
     // Though it can be changed in HandleStreamRequest().
@@ -240,6 +243,12 @@ void HttpHandlerBase::HandleRequestStream(http::HttpRequest& http_request, reque
             );
         }
     }
+
+    try {
+        response_body_stream.Finish(engine::Deadline());
+    } catch (const std::exception& e) {
+        LOG_ERROR() << "failed to finish the encoded response body in '" << HandlerName() << "' handler: " << e;
+    }
 }
 
 void HttpHandlerBase::HandleHttpRequest(http::HttpRequest& http_request, request::RequestContext& context) const {
@@ -1,7 +1,9 @@
 #include <server/handlers/http_handler_base_statistics.hpp>
 
 #include <algorithm>
+#include <thread>
 
+#include <userver/compiler/thread_local.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -10,6 +12,13 @@ namespace server::handlers {
 
 namespace {
 
+constexpr std::chrono::seconds kMedianTimingUpdateInterval{1};
+
+std::atomic<std::size_t> next_thread_shard_index{0};
+
+compiler::ThreadLocal local_shard_index = [] { return next_thread_shard_index.fetch_add(1); };
+constexpr std::size_t kMinTimingsForMedian = 100;
+
 struct HttpHandlerStatisticsHelper {
     const HttpHandlerStatisticsSnapshot& snapshot;
 };
@@ -28,25 +37,100 @@ void DumpMetric(utils::statistics::Writer& writer, HttpHandlerStatisticsHelper h
 
 }  // namespace
 
+class HttpHandlerMethodStatistics::ShardLock final {
+public:
+    explicit ShardLock(Shard& shard) noexcept : shard_(shard) {
+        // Only contended by the threads that share the shard and by Flush
+        while (shard_.locked.exchange(true, std::memory_order_acquire)) {
+            while (shard_.locked.load(std::memory_order_relaxed)) std::this_thread::yield();
+        }
+    }
+
+    ShardLock(ShardLock&&) = delete;
+    ShardLock& operator=(ShardLock&&) = delete;
+
+    ~ShardLock() { shard_.locked.store(false, std::memory_order_release); }
+
+private:
+    Shard& shard_;
+};
+
 void HttpHandlerMethodStatistics::Account(const HttpHandlerStatisticsEntry& stats) noexcept {
-    reply_codes_.Account(static_cast<utils::statistics::HttpCodes::Code>(stats.code));
-    timings_.GetCurrentCounter().Account(stats.timing.count());
+    std::size_t shard_index = 0;
+    {
+        auto local_index = local_shard_index.Use();
+        shard_index = *local_index % kShardsCount;
+    }
+
+    auto& shard = shards_[shard_index];
+    {
+        const ShardLock lock{shard};
+        if (shard.size == kShardCapacity) FlushShard(shard);
+        shard.entries[shard.size++] = PendingEntry{
+            static_cast<utils::statistics::HttpCodes::Code>(stats.code),
+            static_cast<std::uint32_t>(stats.timing.count()),
+        };
+    }
+
     if (stats.deadline.IsReachable()) ++deadline_received_;
     if (stats.cancelled_by_deadline) ++cancelled_by_deadline_;
 }
 
+void HttpHandlerMethodStatistics::Flush() const noexcept {
+    for (auto& shard : shards_) {
+        const ShardLock lock{shard};
+        FlushShard(shard);
+    }
+}
+
+HttpHandlerMethodStatistics::Percentile HttpHandlerMethodStatistics::GetTimings() const {
+    Flush();
+    return timings_.GetStatsForPeriod();
+}
+
+void HttpHandlerMethodStatistics::FlushShard(Shard& shard) const noexcept {
+    auto& timings = timings_.GetCurrentCounter();
+    for (std::size_t i = 0; i < shard.size; ++i) {
+        reply_codes_.Account(shard.entries[i].code);
+        timings.Account(shard.entries[i].timing_ms);
+    }
+    shard.size = 0;
+}
+
 std::size_t HttpHandlerMethodStatistics::GetInFlight() const noexcept {
     const auto finished = finished_.Load();
     const auto started = started_.Load();
     return static_cast<std::size_t>(std::max(started, finished).value - finished.value);
 }
 
+std::optional<std::chrono::milliseconds> HttpHandlerMethodStatistics::GetMedianTimingApprox() const {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto updated_at = median_updated_at_.load();
+    const auto update_interval =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(kMedianTimingUpdateInterval).count();
+
+    // Only one of the concurrent requests recalculates the median, others use
+    // the previous value
+    if ((updated_at == 0 || now - updated_at >= update_interval) &&
+        median_updated_at_.compare_exchange_strong(updated_at, now)) {
+        Flush();
+        const auto timings = timings_.GetStatsForPeriod(RecentPeriod::Duration::min(), true);
+        median_timing_ms_ = timings.Count() < kMinTimingsForMedian
+                                ? std::int64_t{-1}
+                                : static_cast<std::int64_t>(timings.GetPercentile(50));
+    }
+
+    const auto median_ms = median_timing_ms_.load();
+    if (median_ms < 0) return std::nullopt;
+    return std::chrono::milliseconds{median_ms};
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const HttpHandlerMethodStatistics& stats) {
     writer = HttpHandlerStatisticsSnapshot{stats};
 }
 
 HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(const HttpHandlerMethodStatistics& stats)
-    : timings(stats.timings_.GetStatsForPeriod()),
+    : timings(stats.GetTimings()),
       reply_codes(stats.reply_codes_),
       in_flight(stats.GetInFlight()),
       finished(stats.finished_.Load()),
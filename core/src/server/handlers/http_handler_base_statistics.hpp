@@ -1,11 +1,15 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <type_traits>
 
 #include <server/http/handler_methods.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -13,6 +17,7 @@
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,8 +40,16 @@ public:
 
     void Account(const HttpHandlerStatisticsEntry& stats) noexcept;
 
+    // Adds the reply codes and timings, accounted by all the threads, to the
+    // totals
+    void Flush() const noexcept;
+
     std::size_t GetInFlight() const noexcept;
 
+    // Median of the recent timings, recalculated at most once per second.
+    // std::nullopt if there were too few requests to estimate it.
+    std::optional<std::chrono::milliseconds> GetMedianTimingApprox() const;
+
     void IncrementInFlight() noexcept { ++started_; }
 
     void DecrementInFlight() noexcept { ++finished_; }
@@ -51,14 +64,46 @@ private:
     using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
     using RecentPeriod = utils::statistics::RecentPeriod<Percentile, Percentile, utils::datetime::SteadyClock>;
 
-    RecentPeriod timings_;
-    utils::statistics::HttpCodes reply_codes_;
-    utils::statistics::RateCounter started_;
-    utils::statistics::RateCounter finished_;
+    static constexpr std::size_t kShardsCount = 16;
+    static constexpr std::size_t kShardCapacity = 32;
+
+    struct PendingEntry final {
+        utils::statistics::HttpCodes::Code code;
+        std::uint32_t timing_ms;
+    };
+
+    // The reply codes and timings of a group of threads, that are not yet
+    // added to the totals. Each worker thread writes to its own shard, so the
+    // shared counters are updated once per kShardCapacity requests instead of
+    // every request contending for the same cache lines.
+    struct alignas(concurrent::impl::kDestructiveInterferenceSize) Shard final {
+        std::atomic<bool> locked{false};
+        std::size_t size{0};
+        std::array<PendingEntry, kShardCapacity> entries{};
+    };
+
+    class ShardLock;
+
+    void FlushShard(Shard& shard) const noexcept;
+
+    // Flushes the shards first, so that reply_codes_ are also up to date
+    Percentile GetTimings() const;
+
+    mutable std::array<Shard, kShardsCount> shards_{};
+
+    mutable RecentPeriod timings_;
+    mutable utils::statistics::HttpCodes reply_codes_;
+    // Incremented by every request from all the worker threads
+    utils::statistics::StripedRateCounter started_;
+    utils::statistics::StripedRateCounter finished_;
     utils::statistics::RateCounter too_many_requests_in_flight_;
     utils::statistics::RateCounter rate_limit_reached_;
-    utils::statistics::RateCounter deadline_received_;
+    utils::statistics::StripedRateCounter deadline_received_;
     utils::statistics::RateCounter cancelled_by_deadline_;
+
+    // Negative if unknown
+    mutable std::atomic<std::int64_t> median_timing_ms_{-1};
+    mutable std::atomic<std::chrono::steady_clock::rep> median_updated_at_{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const HttpHandlerMethodStatistics& stats);
@@ -0,0 +1,50 @@
+#include <server/handlers/http_handler_base_statistics.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// The statistics as they were before sharding: every request updates the
+// shared atomics
+class UnshardedStatistics final {
+public:
+    void Account(const server::handlers::HttpHandlerStatisticsEntry& stats) noexcept {
+        reply_codes_.Account(static_cast<utils::statistics::HttpCodes::Code>(stats.code));
+        timings_.GetCurrentCounter().Account(stats.timing.count());
+    }
+
+private:
+    using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
+
+    utils::statistics::RecentPeriod<Percentile, Percentile, utils::datetime::SteadyClock> timings_;
+    utils::statistics::HttpCodes reply_codes_;
+};
+
+template <typename Statistics>
+void HttpHandlerStatisticsAccount(benchmark::State& state) {
+    Statistics stats;
+
+    server::handlers::HttpHandlerStatisticsEntry entry;
+    entry.code = server::http::HttpStatus::kOk;
+    entry.timing = std::chrono::milliseconds{3};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+        for ([[maybe_unused]] auto _ : range) {
+            stats.Account(entry);
+        }
+    });
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(HttpHandlerStatisticsAccount, UnshardedStatistics)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(HttpHandlerStatisticsAccount, server::handlers::HttpHandlerMethodStatistics)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->UseRealTime();
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <server/handlers/http_handler_base_statistics.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void AccountTimings(server::handlers::HttpHandlerMethodStatistics& stats, std::chrono::milliseconds timing, int count) {
+    server::handlers::HttpHandlerStatisticsEntry entry;
+    entry.code = server::http::HttpStatus::kOk;
+    entry.timing = timing;
+    for (int i = 0; i < count; ++i) stats.Account(entry);
+}
+
+}  // namespace
+
+TEST(HttpHandlerStatistics, MedianTimingUnknown) {
+    server::handlers::HttpHandlerMethodStatistics stats;
+    EXPECT_EQ(stats.GetMedianTimingApprox(), std::nullopt);
+}
+
+TEST(HttpHandlerStatistics, MedianTimingTooFewRequests) {
+    server::handlers::HttpHandlerMethodStatistics stats;
+    AccountTimings(stats, std::chrono::milliseconds{10}, 10);
+    EXPECT_EQ(stats.GetMedianTimingApprox(), std::nullopt);
+}
+
+TEST(HttpHandlerStatistics, MedianTiming) {
+    server::handlers::HttpHandlerMethodStatistics stats;
+    AccountTimings(stats, std::chrono::milliseconds{10}, 100);
+    AccountTimings(stats, std::chrono::milliseconds{30}, 120);
+    AccountTimings(stats, std::chrono::milliseconds{500}, 10);
+    EXPECT_EQ(stats.GetMedianTimingApprox(), std::chrono::milliseconds{30});
+
+    // The value is cached
+    AccountTimings(stats, std::chrono::milliseconds{500}, 1000);
+    EXPECT_EQ(stats.GetMedianTimingApprox(), std::chrono::milliseconds{30});
+}
+
+TEST(HttpHandlerStatistics, AccountFromManyThreads) {
+    constexpr int kThreads = 8;
+    constexpr int kRequestsPerThread = 1001;
+
+    server::handlers::HttpHandlerMethodStatistics stats;
+    std::vector<std::thread> threads;
+    threads.reserve(kThreads);
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&stats] { AccountTimings(stats, std::chrono::milliseconds{5}, kRequestsPerThread); });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // Entries that are still in the per-thread shards are flushed by the snapshot
+    const server::handlers::HttpHandlerStatisticsSnapshot snapshot{stats};
+    EXPECT_EQ(snapshot.timings.Count(), kThreads * kRequestsPerThread);
+    EXPECT_EQ(snapshot.timings.GetPercentile(50), 5);
+}
+
+USERVER_NAMESPACE_END
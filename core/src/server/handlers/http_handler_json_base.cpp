@@ -1,7 +1,11 @@
 #include <userver/server/handlers/http_handler_json_base.hpp>
 
+#include <userver/components/component_config.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/msgpack/serialize.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
 #include <userver/tracing/span.hpp>
 
@@ -10,7 +14,7 @@
 #include <userver/server/handlers/legacy_json_error_builder.hpp>
 #include <userver/server/http/http_error.hpp>
 #include <userver/server/http/http_status.hpp>
-#include <userver/yaml_config/schema.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,11 +23,25 @@ namespace server::handlers {
 namespace {
 
 const std::string kRequestDataName = "__request_json";
+const std::string kLazyRequestDataName = "__request_lazy_json";
 const std::string kResponseDataName = "__response_json";
 const std::string kSerializeJson = "serialize_json";
 
 const formats::json::Value kEmptyJson{};
 
+// Requests with MessagePack bodies get MessagePack responses
+bool IsMsgpackRequest(const http::HttpRequest& request) {
+    const auto& content_type = request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
+    if (content_type.empty()) return false;
+
+    try {
+        return USERVER_NAMESPACE::http::ContentType{content_type}.MediaType() ==
+               USERVER_NAMESPACE::http::content_type::kApplicationMsgpack.MediaType();
+    } catch (const USERVER_NAMESPACE::http::MalformedContentType&) {
+        return false;
+    }
+}
+
 }  // namespace
 
 HttpHandlerJsonBase::HttpHandlerJsonBase(
@@ -31,27 +49,56 @@ HttpHandlerJsonBase::HttpHandlerJsonBase(
     const components::ComponentContext& component_context,
     bool is_monitor
 )
-    : HttpHandlerBase(config, component_context, is_monitor) {}
+    : HttpHandlerBase(config, component_context, is_monitor),
+      lazy_request_json_(config["lazy-request-json"].As<bool>(false)) {}
 
 std::string HttpHandlerJsonBase::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext& context)
     const {
     const auto& request_json = context.GetData<const formats::json::Value&>(kRequestDataName);
 
+    const bool is_msgpack = IsMsgpackRequest(request);
     auto& response = request.GetHttpResponse();
-    response.SetContentType(USERVER_NAMESPACE::http::content_type::kApplicationJson);
+    response.SetContentType(
+        is_msgpack ? USERVER_NAMESPACE::http::content_type::kApplicationMsgpack
+                   : USERVER_NAMESPACE::http::content_type::kApplicationJson
+    );
+
+    if (!is_msgpack) {
+        formats::json::StringBuilder sw;
+        WriteResponseJsonThrow(request, request_json, context, sw);
+        return sw.GetString();
+    }
 
     const auto& response_json = context.SetData<formats::json::Value>(
         kResponseDataName, HandleRequestJsonThrow(request, request_json, context)
     );
 
     const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(kSerializeJson);
-    return formats::json::ToString(response_json);
+    return formats::msgpack::ToString(response_json);
+}
+
+void HttpHandlerJsonBase::WriteResponseJsonThrow(
+    const http::HttpRequest& request,
+    const formats::json::Value& request_json,
+    request::RequestContext& context,
+    formats::json::StringBuilder& sw
+) const {
+    const auto& response_json = context.SetData<formats::json::Value>(
+        kResponseDataName, HandleRequestJsonThrow(request, request_json, context)
+    );
+
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(kSerializeJson);
+    sw.WriteValue(response_json);
 }
 
 const formats::json::Value* HttpHandlerJsonBase::GetRequestJson(const request::RequestContext& context) {
     return context.GetDataOptional<const formats::json::Value>(kRequestDataName);
 }
 
+const formats::json::LazyValue* HttpHandlerJsonBase::GetRequestLazyJson(const request::RequestContext& context) {
+    return context.GetDataOptional<const formats::json::LazyValue>(kLazyRequestDataName);
+}
+
 const formats::json::Value* HttpHandlerJsonBase::GetResponseJson(const request::RequestContext& context) {
     return context.GetDataOptional<const formats::json::Value>(kResponseDataName);
 }
@@ -71,6 +118,19 @@ void HttpHandlerJsonBase::ParseRequestData(const http::HttpRequest& request, req
     }
 
     try {
+        if (IsMsgpackRequest(request)) {
+            auto request_json = formats::msgpack::FromString(request.RequestBody());
+            context.SetData<formats::json::Value>(kRequestDataName, std::move(request_json));
+            return;
+        }
+        if (lazy_request_json_) {
+            // The request body outlives the request context data
+            context.SetData<formats::json::LazyValue>(
+                kLazyRequestDataName, formats::json::LazyValue{request.RequestBody()}
+            );
+            context.SetData<formats::json::Value>(kRequestDataName, kEmptyJson);
+            return;
+        }
         context.SetData<formats::json::Value>(kRequestDataName, formats::json::FromString(request.RequestBody()));
     } catch (const formats::json::Exception& e) {
         throw RequestParseError(
@@ -80,9 +140,19 @@ void HttpHandlerJsonBase::ParseRequestData(const http::HttpRequest& request, req
 }
 
 yaml_config::Schema HttpHandlerJsonBase::GetStaticConfigSchema() {
-    auto schema = HttpHandlerBase::GetStaticConfigSchema();
-    schema.UpdateDescription("HTTP handler JSON base config");
-    return schema;
+    return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: HTTP handler JSON base config
+additionalProperties: false
+properties:
+    lazy-request-json:
+        type: boolean
+        description: |
+            only validate the request body and provide it as
+            formats::json::LazyValue via GetRequestLazyJson() instead of
+            building formats::json::Value
+        defaultDescription: false
+)");
 }
 
 }  // namespace server::handlers
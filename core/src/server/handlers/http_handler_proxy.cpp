@@ -0,0 +1,284 @@
+#include <userver/server/handlers/http_handler_proxy.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/component.hpp>
+#include <userver/clients/http/error.hpp>
+#include <userver/clients/http/streamed_response.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response_body_stream.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+constexpr headers::PredefinedHeader kKeepAlive{"Keep-Alive"};
+
+// RFC 9110, 7.6.1. These headers describe a single connection and are not
+// forwarded by proxies
+constexpr headers::PredefinedHeader kHopByHopHeaders[] = {
+    headers::kConnection,
+    kKeepAlive,
+    headers::kProxyAuthenticate,
+    headers::kProxyAuthorization,
+    headers::kTE,
+    headers::kTrailer,
+    headers::kTransferEncoding,
+    headers::kUpgrade,
+};
+
+void RemoveHopByHopHeaders(clients::http::Headers& header_map) {
+    // Connection may list additional hop-by-hop headers
+    const auto connection_it = header_map.find(headers::kConnection);
+    if (connection_it != header_map.end()) {
+        for (const auto& name : utils::text::Split(connection_it->second, ", \t")) {
+            header_map.erase(name);
+        }
+    }
+
+    for (const auto& name : kHopByHopHeaders) {
+        header_map.erase(name);
+    }
+}
+
+std::vector<std::pair<std::string, std::string>> ParseHeadersToSet(const yaml_config::YamlConfig& value) {
+    const auto headers_map = value.As<std::unordered_map<std::string, std::string>>({});
+    return {headers_map.begin(), headers_map.end()};
+}
+
+bool IsRemoved(const std::vector<std::string>& to_remove, std::string_view name) {
+    return std::any_of(to_remove.begin(), to_remove.end(), [name](const std::string& removed) {
+        return utils::StrIcaseEqual{}(removed, name);
+    });
+}
+
+clients::http::HttpMethod ToClientMethod(http::HttpMethod method) {
+    switch (method) {
+        case http::HttpMethod::kDelete:
+            return clients::http::HttpMethod::kDelete;
+        case http::HttpMethod::kGet:
+            return clients::http::HttpMethod::kGet;
+        case http::HttpMethod::kHead:
+            return clients::http::HttpMethod::kHead;
+        case http::HttpMethod::kPost:
+            return clients::http::HttpMethod::kPost;
+        case http::HttpMethod::kPut:
+            return clients::http::HttpMethod::kPut;
+        case http::HttpMethod::kPatch:
+            return clients::http::HttpMethod::kPatch;
+        case http::HttpMethod::kOptions:
+            return clients::http::HttpMethod::kOptions;
+        case http::HttpMethod::kConnect:
+        case http::HttpMethod::kUnknown:
+            break;
+    }
+    throw ClientError(ExternalBody{fmt::format("Method {} could not be proxied", method)});
+}
+
+bool MayHaveRequestBody(http::HttpMethod method) {
+    return method != http::HttpMethod::kGet && method != http::HttpMethod::kHead;
+}
+
+template <typename Func>
+auto WithUpstreamErrors(Func&& func) {
+    try {
+        return func();
+    } catch (const clients::http::TimeoutException& e) {
+        throw ExceptionWithCode<HandlerErrorCode::kGatewayTimeout>(
+            InternalMessage{fmt::format("Upstream request timed out: {}", e.what())}
+        );
+    } catch (const clients::http::BaseException& e) {
+        throw ExceptionWithCode<HandlerErrorCode::kBadGateway>(
+            InternalMessage{fmt::format("Upstream request failed: {}", e.what())}
+        );
+    }
+}
+
+}  // namespace
+
+HttpHandlerProxy::HttpHandlerProxy(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpHandlerBase(config, context),
+      http_client_(
+          context.FindComponent<components::HttpClient>(config["http-client"].As<std::string>("http-client"))
+              .GetHttpClient()
+      ),
+      upstream_(config["upstream"].As<std::string>()),
+      strip_path_prefix_(config["strip-path-prefix"].As<std::string>("")),
+      timeout_(config["timeout"].As<std::chrono::milliseconds>(std::chrono::seconds{10})),
+      response_queue_size_(config["response-queue-size"].As<std::size_t>(64 * 1024)),
+      request_rules_{
+          config["request-headers-to-remove"].As<std::vector<std::string>>({}),
+          ParseHeadersToSet(config["request-headers-to-set"]),
+      },
+      response_rules_{
+          config["response-headers-to-remove"].As<std::vector<std::string>>({}),
+          ParseHeadersToSet(config["response-headers-to-set"]),
+      } {}
+
+std::string HttpHandlerProxy::HandleRequest(http::HttpRequest& request, request::RequestContext&) const {
+    const auto upstream_response = WithUpstreamErrors([&] { return MakeUpstreamRequest(request).perform(); });
+
+    auto& response = request.GetHttpResponse();
+    response.SetStatus(static_cast<http::HttpStatus>(upstream_response->status_code()));
+    RelayResponseHeaders(upstream_response->headers(), upstream_response->cookies(), response);
+
+    return std::move(*upstream_response).body();
+}
+
+void HttpHandlerProxy::HandleStreamRequest(
+    http::HttpRequest& request,
+    request::RequestContext&,
+    http::ResponseBodyStream& response_body_stream
+) const {
+    const auto deadline =
+        std::min(engine::Deadline::FromDuration(timeout_), server::request::GetTaskInheritedDeadline());
+
+    auto queue = concurrent::StringStreamQueue::Create(response_queue_size_);
+    auto upstream_response = MakeUpstreamRequest(request).async_perform_stream_body(queue);
+
+    const auto status = WithUpstreamErrors([&] { return upstream_response.StatusCode(); });
+    response_body_stream.SetStatusCode(static_cast<int>(status));
+    RelayResponseHeaders(upstream_response.GetHeaders(), upstream_response.GetCookies(), request.GetHttpResponse());
+    response_body_stream.SetEndOfHeaders();
+
+    std::string chunk;
+    while (upstream_response.ReadChunk(chunk, deadline)) {
+        response_body_stream.PushBodyChunk(std::move(chunk), deadline);
+    }
+
+    if (deadline.IsReached()) {
+        // The status code is already sent, the client sees a truncated body
+        LOG_WARNING() << "Timeout while relaying the upstream response body of " << request.GetUrl();
+    }
+}
+
+clients::http::Request HttpHandlerProxy::MakeUpstreamRequest(http::HttpRequest& request) const {
+    const auto method = request.GetMethod();
+
+    std::string_view path = request.GetUrl();
+    if (utils::text::StartsWith(path, strip_path_prefix_)) path.remove_prefix(strip_path_prefix_.size());
+
+    auto request_headers = request.GetHeaders();
+    RemoveHopByHopHeaders(request_headers);
+    // Set by the HTTP client for the upstream connection
+    request_headers.erase(headers::kHost);
+    request_headers.erase(headers::kContentLength);
+    request_headers.erase(headers::kExpect);
+    for (const auto& name : request_rules_.to_remove) request_headers.erase(name);
+    for (const auto& [name, value] : request_rules_.to_set) request_headers.insert_or_assign(name, value);
+
+    auto upstream_request = http_client_.CreateRequest();
+    upstream_request.method(ToClientMethod(method))
+        .url(upstream_ + std::string{path})
+        .headers(request_headers)
+        .timeout(timeout_)
+        .DisableReplyDecoding();
+
+    if (MayHaveRequestBody(method) && !request.RequestBody().empty()) {
+        // The server has the whole body already, it is moved without copying
+        upstream_request.data(request.ExtractRequestBody());
+    }
+
+    return upstream_request;
+}
+
+void HttpHandlerProxy::RelayResponseHeaders(
+    const clients::http::Headers& upstream_headers,
+    const clients::http::Response::CookiesMap& upstream_cookies,
+    http::HttpResponse& response
+) const {
+    auto response_headers = upstream_headers;
+    RemoveHopByHopHeaders(response_headers);
+    // The server computes the length of the relayed body by itself
+    response_headers.erase(headers::kContentLength);
+    for (const auto& name : response_rules_.to_remove) response_headers.erase(name);
+    for (const auto& [name, value] : response_rules_.to_set) response_headers.insert_or_assign(name, value);
+
+    for (const auto& [name, value] : response_headers) {
+        response.SetHeader(std::string_view{name}, value);
+    }
+
+    if (!IsRemoved(response_rules_.to_remove, headers::kSetCookie)) {
+        for (const auto& [name, cookie] : upstream_cookies) {
+            response.SetCookie(cookie);
+        }
+    }
+}
+
+yaml_config::Schema HttpHandlerProxy::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: |
+    Handler that forwards requests to an upstream and relays the responses
+    back as is
+additionalProperties: false
+properties:
+    upstream:
+        type: string
+        description: base URL of the upstream, e.g. http://backend:8080
+    strip-path-prefix:
+        type: string
+        description: prefix removed from the request path before forwarding
+        defaultDescription: ''
+    http-client:
+        type: string
+        description: name of the HttpClient component to use
+        defaultDescription: http-client
+    timeout:
+        type: string
+        description: timeout of the upstream request
+        defaultDescription: 10s
+    response-queue-size:
+        type: integer
+        description: max bytes of the streamed response body kept in memory
+        defaultDescription: 65536
+        minimum: 1
+    request-headers-to-remove:
+        type: array
+        description: headers that are not forwarded to the upstream
+        items:
+            type: string
+            description: header name
+    request-headers-to-set:
+        type: object
+        description: headers that are added or replaced in upstream requests
+        properties: {}
+        additionalProperties:
+            type: string
+            description: header value
+    response-headers-to-remove:
+        type: array
+        description: headers that are not relayed to the client
+        items:
+            type: string
+            description: header name
+    response-headers-to-set:
+        type: object
+        description: headers that are added or replaced in responses
+        properties: {}
+        additionalProperties:
+            type: string
+            description: header value
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
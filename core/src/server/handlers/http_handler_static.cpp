@@ -4,8 +4,11 @@
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <server/middlewares/compression.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
@@ -32,6 +35,17 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>> kContentTypeMa
 )"},
 };
 
+struct PrecompressedVariant final {
+    middlewares::ContentEncoding encoding;
+    std::string_view suffix;
+};
+
+// In the order of preference
+constexpr PrecompressedVariant kPrecompressedVariants[] = {
+    {middlewares::ContentEncoding::kZstd, ".zst"},
+    {middlewares::ContentEncoding::kGzip, ".gz"},
+};
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -43,18 +57,60 @@ HttpHandlerStatic::HttpHandlerStatic(
       storage_(
           context.FindComponent<components::FsCache>(config["fs-cache-component"].As<std::string>("fs-cache-component"))
               .GetClient()
-      ) {}
+      ),
+      serve_precompressed_(config["serve-precompressed"].As<bool>(false)) {}
 
 std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
     LOG_DEBUG() << "Handler: " << request.GetRequestPath();
-    const auto file = storage_.TryGetFile(request.GetRequestPath());
-    if (file) {
-        const auto config = config_.GetSnapshot();
-        request.GetHttpResponse().SetContentType(config[kContentTypeMap][file->extension]);
-        return file->data;
+    const auto& path = request.GetRequestPath();
+    const auto file = storage_.TryGetFile(path);
+    if (!file) {
+        request.GetHttpResponse().SetStatusNotFound();
+        return "File not found";
+    }
+
+    auto& response = request.GetHttpResponse();
+    const auto config = config_.GetSnapshot();
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+
+    auto body = file;
+    if (serve_precompressed_) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{"Accept-Encoding"});
+        if (auto variant = TryGetPrecompressedVariant(request, path)) {
+            body = std::move(variant);
+        }
+    }
+
+    if (body->file) {
+        response.SetFileBody(body->file, 0, body->size);
+        return {};
+    }
+    return body->data;
+}
+
+fs::FileInfoWithDataConstPtr
+HttpHandlerStatic::TryGetPrecompressedVariant(const http::HttpRequest& request, const std::string& path) const {
+    const auto& accept_encoding = request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding);
+    if (accept_encoding.empty()) return nullptr;
+
+    std::vector<middlewares::ContentEncoding> available;
+    std::vector<fs::FileInfoWithDataConstPtr> variants;
+    for (const auto& [encoding, suffix] : kPrecompressedVariants) {
+        if (auto variant = storage_.TryGetFile(path + std::string{suffix})) {
+            available.push_back(encoding);
+            variants.push_back(std::move(variant));
+        }
+    }
+    if (available.empty()) return nullptr;
+
+    const auto chosen = middlewares::ChooseContentEncoding(accept_encoding, available);
+    for (std::size_t i = 0; i < available.size(); ++i) {
+        if (available[i] == chosen) {
+            request.GetHttpResponse().SetContentEncoding(std::string{middlewares::ToString(chosen)});
+            return variants[i];
+        }
     }
-    request.GetHttpResponse().SetStatusNotFound();
-    return "File not found";
+    return nullptr;
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -69,6 +125,12 @@ properties:
         type: string
         description: Name of the FsCache component
         defaultDescription: fs-cache-component
+    serve-precompressed:
+        type: boolean
+        description: |
+            serve pre-compressed 'file.zst' and 'file.gz' variants of 'file'
+            if they exist in the cache and are accepted by the client
+        defaultDescription: false
 )");
 }
 
@@ -1,5 +1,6 @@
 #include <userver/server/handlers/jemalloc.hpp>
 
+#include <engine/task/task_profiler.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/from_string.hpp>
 #include <userver/utils/strerror.hpp>
@@ -30,6 +31,8 @@ constexpr utils::TrivialBiMap kStrToCommand = [](auto selector) {
         .Case("enable", Command::kEnable)
         .Case("disable", Command::kDisable)
         .Case("dump", Command::kDump)
+        .Case("prof_span_filter", Command::kProfSpanFilter)
+        .Case("prof_span_filter_reset", Command::kProfSpanFilterReset)
         .Case("bg_threads_set_max", Command::kBgThreadsSetMax)
         .Case("bg_threads_enable", Command::kBgThreadsEnable)
         .Case("bg_threads_disable", Command::kBgThreadsDisable);
@@ -60,7 +63,7 @@ std::string Jemalloc::HandleRequestThrow(const http::HttpRequest& request, reque
         case Command::kStat:
             return utils::jemalloc::Stats();
         case Command::kEnable:
-            if (!utils::jemalloc::IsProfilingEnbledViaEnv()) {
+            if (!utils::jemalloc::IsProfilingEnabledViaEnv()) {
                 request.SetResponseStatus(server::http::HttpStatus::kServiceUnavailable);
                 return "'jemalloc' profiling is not available because the service was not started with a 'MALLOC_CONF' "
                        "environment variable that contain 'prof:true'";
@@ -70,6 +73,18 @@ std::string Jemalloc::HandleRequestThrow(const http::HttpRequest& request, reque
             return HandleRc(request, utils::jemalloc::ProfDeactivate());
         case Command::kDump:
             return HandleRc(request, utils::jemalloc::ProfDump());
+        case Command::kProfSpanFilter: {
+            const auto& span_name = request.GetArg("span");
+            if (span_name.empty()) {
+                request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+                return "missing 'span' argument";
+            }
+            engine::impl::SetHeapProfileSpanFilter(span_name);
+            return "OK\n";
+        }
+        case Command::kProfSpanFilterReset:
+            engine::impl::SetHeapProfileSpanFilter(std::nullopt);
+            return "OK\n";
         case Command::kBgThreadsSetMax: {
             size_t num_threads = 0;
             if (!request.HasArg("count")) {
@@ -1,8 +1,12 @@
 #include <userver/server/handlers/server_monitor.hpp>
 
+#include <compression/gzip.hpp>
+#include <server/middlewares/compression.hpp>
+
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/utils/statistics/graphite.hpp>
 #include <userver/utils/statistics/json.hpp>
@@ -60,6 +64,27 @@ std::optional<StatsFormat> ParseFormat(std::string_view format) {
     )});
 }
 
+bool AcceptsGzip(const http::HttpRequest& request) {
+    const auto encoding = middlewares::ChooseContentEncoding(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding), {middlewares::ContentEncoding::kGzip}
+    );
+    return encoding == middlewares::ContentEncoding::kGzip;
+}
+
+// Compresses the output chunk by chunk, so that the uncompressed text of all
+// the metrics is never materialized
+template <typename Formatter>
+std::string ToGzip(http::HttpResponse& response, Formatter formatter) {
+    USERVER_NAMESPACE::compression::gzip::StreamCompressor compressor;
+    std::string result;
+    formatter([&compressor, &result](std::string_view chunk) { result += compressor.Compress(chunk); });
+    result += compressor.Finish();
+
+    response.SetContentEncoding(std::string{middlewares::ToString(middlewares::ContentEncoding::kGzip)});
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{"Accept-Encoding"});
+    return result;
+}
+
 }  // namespace
 
 ServerMonitor::ServerMonitor(
@@ -69,7 +94,8 @@ ServerMonitor::ServerMonitor(
     : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
       statistics_storage_(component_context.FindComponent<components::StatisticsStorage>().GetStorage()),
       common_labels_{config["common-labels"].As<CommonLabels>({})},
-      default_format_{ParseFormat(config["format"].As<std::string>({}))} {}
+      default_format_{ParseFormat(config["format"].As<std::string>({}))},
+      gzip_{config["gzip"].As<bool>(false)} {}
 
 std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
     const auto& prefix = request.GetArg("prefix");
@@ -101,30 +127,42 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
         (path.empty() ? Request::MakeWithPrefix(prefix, std::move(common_labels), std::move(labels))
                       : Request::MakeWithPath(path, std::move(common_labels), std::move(labels)));
 
-    request.GetHttpResponse().SetContentType("text/plain; charset=utf-8");
+    auto& response = request.GetHttpResponse();
+    response.SetContentType("text/plain; charset=utf-8");
+    const bool gzip = gzip_ && AcceptsGzip(request);
     switch (format) {
         case StatsFormat::kGraphite:
             return utils::statistics::ToGraphiteFormat(statistics_storage_, statistics_request);
 
         case StatsFormat::kPrometheus:
+            if (gzip) {
+                return ToGzip(response, [&](auto consumer) {
+                    utils::statistics::ToPrometheusFormat(statistics_storage_, statistics_request, consumer);
+                });
+            }
             return utils::statistics::ToPrometheusFormat(statistics_storage_, statistics_request);
 
         case StatsFormat::kPrometheusUntyped:
+            if (gzip) {
+                return ToGzip(response, [&](auto consumer) {
+                    utils::statistics::ToPrometheusFormatUntyped(statistics_storage_, statistics_request, consumer);
+                });
+            }
             return utils::statistics::ToPrometheusFormatUntyped(statistics_storage_, statistics_request);
 
         case StatsFormat::kJson:
-            request.GetHttpResponse().SetContentType("application/json");
+            response.SetContentType("application/json");
             return utils::statistics::ToJsonFormat(statistics_storage_, statistics_request);
 
         case StatsFormat::kPretty:
             return utils::statistics::ToPrettyFormat(statistics_storage_, statistics_request);
 
         case StatsFormat::kSolomon:
-            request.GetHttpResponse().SetContentType("application/json");
+            response.SetContentType("application/json");
             return utils::statistics::ToSolomonFormat(statistics_storage_, common_labels_, statistics_request);
 
         case StatsFormat::kInternal:
-            request.GetHttpResponse().SetContentType("application/json");
+            response.SetContentType("application/json");
             const auto json = statistics_storage_.GetAsJson();
             UASSERT(utils::statistics::AreAllMetricsNumbers(json));
             return formats::json::ToString(json);
@@ -163,6 +201,13 @@ properties:
           - pretty
           - solomon
           - internal
+    gzip:
+        type: boolean
+        description: |
+            Compress the Prometheus output on the fly with gzip, if the client
+            accepts it. Big outputs are compressed without materializing the
+            uncompressed text.
+        defaultDescription: false
   )");
 }
 
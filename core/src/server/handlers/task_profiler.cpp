@@ -0,0 +1,33 @@
+#include <userver/server/handlers/task_profiler.hpp>
+
+#include <engine/task/task_profiler.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+TaskProfiler::TaskProfiler(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : HttpHandlerBase(config, context, /*is_monitor = */ true) {}
+
+std::string TaskProfiler::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
+    switch (request.GetMethod()) {
+        case http::HttpMethod::kGet:
+            return engine::impl::GetSlowSliceStacktracesFolded();
+        case http::HttpMethod::kDelete:
+            engine::impl::ResetSlowSliceStacktraces();
+            return {};
+        default:
+            throw std::runtime_error("unsupported method: " + request.GetMethodStr());
+    }
+}
+
+yaml_config::Schema TaskProfiler::GetStaticConfigSchema() {
+    auto schema = HttpHandlerBase::GetStaticConfigSchema();
+    schema.UpdateDescription("handler-task-profiler config");
+    return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <nghttp2/nghttp2.h>
+
+#include <server/http/handler_info_index.hpp>
+#include <server/http/http2_session.hpp>
+#include <server/http/http2_writer.hpp>
+#include <server/net/connection_config.hpp>
+#include <server/net/stats.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
+
+nghttp2_nv MakeHeader(std::string_view name, std::string_view value) {
+    return {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        reinterpret_cast<uint8_t*>(const_cast<char*>(name.data())),
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        reinterpret_cast<uint8_t*>(const_cast<char*>(value.data())),
+        name.size(),
+        value.size(),
+        NGHTTP2_NV_FLAG_NONE,
+    };
+}
+
+// Bare nghttp2 client that issues requests and consumes the responses,
+// granting big flow control windows so that the server never waits for them
+class Http2Client final {
+public:
+    Http2Client() {
+        nghttp2_session_callbacks* callbacks{nullptr};
+        UINVARIANT(nghttp2_session_callbacks_new(&callbacks) == 0, "Failed to init callbacks");
+        const utils::FastScopeGuard delete_guard{[&callbacks]() noexcept { nghttp2_session_callbacks_del(callbacks); }
+        };
+        UINVARIANT(nghttp2_session_client_new(&session_, callbacks, nullptr) == 0, "Failed to init client");
+
+        const std::array<nghttp2_settings_entry, 1> settings{
+            nghttp2_settings_entry{NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, NGHTTP2_MAX_WINDOW_SIZE}};
+        UINVARIANT(
+            nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, settings.data(), settings.size()) == 0,
+            "Failed to submit settings"
+        );
+        UINVARIANT(
+            nghttp2_session_set_local_window_size(session_, NGHTTP2_FLAG_NONE, 0, NGHTTP2_MAX_WINDOW_SIZE) == 0,
+            "Failed to set window size"
+        );
+    }
+
+    ~Http2Client() { nghttp2_session_del(session_); }
+
+    void SubmitRequests(std::size_t count) {
+        const std::array<nghttp2_nv, 4> headers{
+            MakeHeader(":method", "GET"),
+            MakeHeader(":scheme", "http"),
+            MakeHeader(":path", "/"),
+            MakeHeader(":authority", "localhost"),
+        };
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto stream_id =
+                nghttp2_submit_request(session_, nullptr, headers.data(), headers.size(), nullptr, nullptr);
+            UINVARIANT(stream_id > 0, "Failed to submit request");
+        }
+    }
+
+    std::string ExtractOutput() {
+        std::string result;
+        const uint8_t* data{nullptr};
+        while (true) {
+            const auto size = nghttp2_session_mem_send(session_, &data);
+            UINVARIANT(size >= 0, "Failed to serialize client frames");
+            if (size == 0) break;
+            result.append(reinterpret_cast<const char*>(data), size);
+        }
+        return result;
+    }
+
+    void Consume(const char* data, std::size_t size) {
+        const auto consumed = nghttp2_session_mem_recv(session_, reinterpret_cast<const uint8_t*>(data), size);
+        UINVARIANT(consumed == static_cast<long>(size), "Failed to parse server frames");
+    }
+
+private:
+    nghttp2_session* session_{nullptr};
+};
+
+void http2_response_write(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        const auto test_deadline = engine::Deadline::FromDuration(kDeadlineMaxTime);
+        auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+        const server::http::HandlerInfoIndex handler_info_index;
+        const server::request::HttpRequestConfig request_config;
+        const server::net::Http2SessionConfig session_config;
+        server::net::ParserStats stats;
+        server::request::ResponseDataAccounter accounter;
+
+        std::vector<std::shared_ptr<server::http::HttpRequest>> requests;
+        server::http::Http2Session session{
+            handler_info_index,
+            request_config,
+            session_config,
+            [&requests](std::shared_ptr<server::http::HttpRequest>&& request) {
+                requests.push_back(std::move(request));
+            },
+            stats,
+            accounter,
+            engine::io::Sockaddr{},
+            &server};
+
+        Http2Client http2_client;
+        std::atomic<bool> reading{true};
+        auto reader = engine::AsyncNoSpan([&] {
+            std::array<char, 64 * 1024> buf{};
+            while (reading) {
+                const auto size = client.RecvSome(buf.data(), buf.size(), test_deadline);
+                if (size == 0) break;
+                http2_client.Consume(buf.data(), size);
+            }
+        });
+
+        const std::size_t streams = state.range(0);
+        const std::string body(state.range(1), 'a');
+        std::size_t responses = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            http2_client.SubmitRequests(streams);
+            if (!session.Parse(http2_client.ExtractOutput())) {
+                state.SkipWithError("Server failed to parse the requests");
+                break;
+            }
+
+            for (auto& request : requests) {
+                auto& response = request->GetHttpResponse();
+                response.SetData(body);
+                server::http::WriteHttp2ResponseToSocket(response, session);
+            }
+            responses += requests.size();
+            requests.clear();
+        }
+        state.SetItemsProcessed(responses);
+
+        reading = false;
+        // Makes the reader see EOF
+        server.Close();
+        reader.Get();
+    });
+}
+
+}  // namespace
+
+BENCHMARK(http2_response_write)->ArgsProduct({{1, 10, 100}, {16, 1024, 64 * 1024}});
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <server/http/http2_session.hpp>
 
+#include <limits>
+
 #include <server/http/http_request_parser.hpp>
 #include <server/net/connection_config.hpp>
 
@@ -54,6 +56,7 @@ Http2Session::Http2Session(
       stats_(stats),
       remote_address_(remote_address),
       socket_(socket),
+      write_queue_(socket),
       streaming_queue_(impl::Http2StreamEventQueue::Create()),
       streaming_consumer_(streaming_queue_->GetConsumer()) {
     UASSERT(streaming_queue_);
@@ -72,8 +75,17 @@ Http2Session::Http2Session(
     nghttp2_session_callbacks_set_on_begin_headers_callback(callbacks, OnBeginHeaders);
     nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, OnDataChunkRecv);
 
+    nghttp2_option* option{nullptr};
+    UINVARIANT(nghttp2_option_new(&option) == 0, "Failed to init options for HTTP/2.0");
+    utils::FastScopeGuard delete_option_guard{[&option]() noexcept { nghttp2_option_del(option); }};
+    // The window of a stream with a streamed request body is extended only
+    // after the handler reads the body, see ConsumeRequestBody()
+    nghttp2_option_set_no_auto_window_update(option, 1);
+
     nghttp2_session* session{nullptr};
-    UINVARIANT(nghttp2_session_server_new(&session, callbacks, this) == 0, "Failed to init session for HTTP/2.0");
+    UINVARIANT(
+        nghttp2_session_server_new2(&session, callbacks, this, option) == 0, "Failed to init session for HTTP/2.0"
+    );
     UASSERT(session);
     session_ = SessionPtr(session, nghttp2_session_del);
 
@@ -86,6 +98,7 @@ Http2Session::Http2Session(
     ThrowIfErr(rv, "Error when submit settings");
     rv = nghttp2_session_send(session_.get());
     ThrowIfErr(rv, "Error when session send");
+    write_queue_.Flush();
 }
 
 int Http2Session::OnFrameRecv(nghttp2_session* session, const nghttp2_frame* frame, void* user_data) {
@@ -96,8 +109,16 @@ int Http2Session::OnFrameRecv(nghttp2_session* session, const nghttp2_frame* fra
     switch (frame->hd.type) {
         case NGHTTP2_DATA:
         case NGHTTP2_HEADERS: {
+            if (frame->hd.type == NGHTTP2_HEADERS && frame->headers.cat == NGHTTP2_HCAT_REQUEST) {
+                auto& stream = parser.GetStreamChecked(Stream::Id{frame->hd.stream_id});
+                if (stream.RequestConstructor().IsBodyStreamed() && !parser.StartRequestBodyStream(stream)) break;
+            }
             if (frame->hd.flags & NGHTTP2_FLAG_END_STREAM) {
                 auto& stream = parser.GetStreamChecked(Stream::Id{frame->hd.stream_id});
+                if (auto* body_producer = stream.GetBodyProducer()) {
+                    body_producer->SetReceived();
+                    break;
+                }
                 try {
                     stream.RequestConstructor().AppendHeaderField("", 0);
                 } catch (const std::exception& e) {
@@ -189,7 +210,7 @@ int Http2Session::OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame, v
 }
 
 int Http2Session::OnDataChunkRecv(
-    nghttp2_session*,
+    nghttp2_session* session,
     uint8_t,
     int32_t id,
     const uint8_t* data,
@@ -198,11 +219,25 @@ int Http2Session::OnDataChunkRecv(
 ) {
     auto& parser = GetParser(user_data);
     auto& stream = parser.GetStreamChecked(Stream::Id{id});
+    if (auto* body_producer = stream.GetBodyProducer()) {
+        // Other streams should not wait for the handler, so only the stream
+        // window is held until the handler reads the body
+        ThrowIfErr(nghttp2_session_consume_connection(session, len), "Error while consume_connection");
+        if (body_producer->IsAborted()) {
+            ThrowIfErr(nghttp2_session_consume_stream(session, id, len), "Error while consume_stream");
+        } else {
+            body_producer->Append(ToStringView(data, len));
+            stream.AddUnconsumedBody(len);
+        }
+        return 0;
+    }
+
     try {
         stream.RequestConstructor().AppendBody(reinterpret_cast<const char*>(data), len);
     } catch (const std::exception& e) {
         LOG_LIMITED_WARNING() << "can't append body: " << e;
     }
+    ThrowIfErr(nghttp2_session_consume(session, id, len), "Error while consume");
     return 0;
 }
 
@@ -211,7 +246,8 @@ long Http2Session::OnSend(nghttp2_session* session, const uint8_t* data, size_t
     UASSERT(data);
     auto& parser = GetParser(user_data);
     if (parser.socket_ != nullptr) {
-        return parser.socket_->WriteAll(data, len, {});
+        parser.write_queue_.PushCopy(ToStringView(data, len));
+        return static_cast<long>(len);
     }
     return NGHTTP2_ERR_WOULDBLOCK;
 }
@@ -235,10 +271,7 @@ int Http2Session::OnDataFrameSend(
     auto& stream = *static_cast<Stream*>(source->ptr);
 
     const auto frame_header{ToStringView(framehd, kFrameHeaderSize)};
-    // TODO: doesn't work with TLS?!
-    UASSERT(dynamic_cast<engine::io::Socket*>(parser.socket_));
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    stream.Send(*static_cast<engine::io::Socket*>(parser.socket_), frame_header, max_len);
+    stream.Send(parser.write_queue_, frame_header, max_len);
     return 0;
 }
 
@@ -268,6 +301,9 @@ void Http2Session::RegisterStream(Stream::Id id) {
 
 void Http2Session::RemoveStream(Stream& stream) {
     UASSERT(streams_pool_.is_from(&stream));
+    // The queue may reference a partially sent chunk of the stream
+    if (stream.HasChunks()) write_queue_.Flush();
+
     const auto id = stream.GetId();
     streams_pool_.destroy(&stream);
 
@@ -321,24 +357,61 @@ void Http2Session::UpgradeToHttp2(std::string_view client_magic) {
     RegisterStream(kStreamIdAfterUpgradeResponse);
 }
 
-void Http2Session::FinalizeRequest(Stream& stream) {
+bool Http2Session::FinalizeRequest(Stream& stream) {
     if (!stream.CheckUrlComplete()) {
         IncStat(stats_.http2_stats.streams_parse_error);
         SubmitRstStream(stream.GetId());
         RemoveStream(stream);
-        return;
+        return false;
     }
     stream.RequestConstructor().SetResponseStreamId(static_cast<std::int32_t>(stream.GetId()));
     stream.RequestConstructor().SetStreamProducer(impl::Http2StreamEventProducer{*streaming_queue_, streaming_event_});
     if (auto request = stream.RequestConstructor().Finalize()) {
         on_new_request_cb_(std::move(request));
+        return true;
     } else {
         IncStat(stats_.http2_stats.streams_parse_error);
         SubmitRstStream(stream.GetId());
         RemoveStream(stream);
+        return false;
     }
 }
 
+bool Http2Session::StartRequestBodyStream(Stream& stream) {
+    try {
+        stream.RequestConstructor().AppendHeaderField("", 0);
+    } catch (const std::exception& e) {
+        IncStat(stats_.http2_stats.streams_parse_error);
+        LOG_LIMITED_WARNING() << "can't append header field: " << e;
+    }
+    // The request is finalized with an error status after the whole body
+    if (!stream.RequestConstructor().IsBodyStreamed()) return true;
+
+    auto producer = std::make_shared<impl::RequestBodyStreamProducer>(
+        impl::Http2StreamEventProducer{*streaming_queue_, streaming_event_}, static_cast<std::int32_t>(stream.GetId())
+    );
+    stream.RequestConstructor().SetBodyStreamProducer(producer);
+    stream.SetBodyProducer(std::move(producer));
+    return FinalizeRequest(stream);
+}
+
+void Http2Session::ConsumeRequestBody(Stream& stream, std::size_t size) {
+    size = stream.TakeUnconsumedBody(size);
+    if (size == 0) return;
+    const auto res = nghttp2_session_consume_stream(session_.get(), static_cast<std::int32_t>(stream.GetId()), size);
+    ThrowIfErr(res, "Error while consume_stream");
+}
+
+void Http2Session::DiscardRequestBody(std::int32_t stream_id) {
+    auto* stream = static_cast<Stream*>(nghttp2_session_get_stream_user_data(session_.get(), stream_id));
+    // The stream is already closed
+    if (!stream || !stream->GetBodyProducer()) return;
+
+    stream->GetBodyProducer()->Abort();
+    ConsumeRequestBody(*stream, std::numeric_limits<std::size_t>::max());
+    WriteWhileWant();
+}
+
 bool Http2Session::ConnectionIsOk() {
     return nghttp2_session_want_read(session_.get()) != 0 || nghttp2_session_want_write(session_.get()) != 0;
 }
@@ -349,6 +422,7 @@ void Http2Session::WriteWhileWant() {
         const auto res = nghttp2_session_send(session);
         ThrowIfErr(res, "Error while nghttp2_session_send");
     }
+    write_queue_.Flush();
 }
 
 engine::SingleConsumerEvent& Http2Session::GetStreamingEvent() { return streaming_event_; }
@@ -357,6 +431,14 @@ void Http2Session::HandleStreamingEvents() {
     impl::Http2StreamEvent event;
     while (streaming_consumer_.PopNoblock(event)) {
         UASSERT(event.stream_id != -1);
+        if (event.consumed_body_size != 0) {
+            // The handler may read the body after the stream was closed
+            auto* stream = static_cast<Stream*>(nghttp2_session_get_stream_user_data(session_.get(), event.stream_id));
+            if (stream) ConsumeRequestBody(*stream, event.consumed_body_size);
+            event = {};
+            continue;
+        }
+
         auto& stream = GetStreamChecked(Stream::Id{event.stream_id});
         if (stream.IsDeferred()) {
             const auto res = nghttp2_session_resume_data(session_.get(), static_cast<std::int32_t>(stream.GetId()));
@@ -4,6 +4,7 @@
 #include <boost/pool/object_pool.hpp>
 
 #include <server/http/http2_stream.hpp>
+#include <server/http/http2_write_queue.hpp>
 #include <server/http/http2_writer.hpp>
 #include <server/http/http_request_constructor.hpp>
 #include <server/net/stats.hpp>
@@ -63,6 +64,10 @@ public:
     void WriteWhileWant();
     void HandleStreamingEvents();
 
+    // The handler does not read the request body of the stream anymore, the
+    // rest of it is discarded
+    void DiscardRequestBody(std::int32_t stream_id);
+
 private:
     static int OnFrameRecv(nghttp2_session* session, const nghttp2_frame* frame, void* user_data);
 
@@ -107,7 +112,10 @@ private:
 
     void SubmitRstStream(Stream::Id stream_id);
 
-    void FinalizeRequest(Stream& stream);
+    // Returns false if the stream was removed
+    bool FinalizeRequest(Stream& stream);
+    bool StartRequestBodyStream(Stream& stream);
+    void ConsumeRequestBody(Stream& stream, std::size_t size);
     bool ConnectionIsOk();
 
 private:
@@ -128,6 +136,8 @@ private:
     net::ParserStats& stats_;
     engine::io::Sockaddr remote_address_;
     engine::io::RwBase* socket_;
+    // Frames of all the streams, flushed at the end of WriteWhileWant()
+    Http2WriteQueue write_queue_;
 
     std::shared_ptr<impl::Http2StreamEventQueue> streaming_queue_{nullptr};
     engine::SingleConsumerEvent streaming_event_;
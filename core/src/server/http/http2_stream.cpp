@@ -1,7 +1,8 @@
 #include <server/http/http2_stream.hpp>
 
-#include <userver/engine/io/socket.hpp>
+#include <server/http/http2_write_queue.hpp>
 
+#include <algorithm>
 #include <numeric>  // std::accumulate
 
 USERVER_NAMESPACE_BEGIN
@@ -53,6 +54,21 @@ bool Stream::IsStreaming() const { return is_streaming_; }
 
 void Stream::SetStreaming(bool streaming) { is_streaming_ = streaming; }
 
+Stream::~Stream() {
+    // The handler should not wait for the rest of the body of a closed stream
+    if (body_producer_) body_producer_->Abort();
+}
+
+void Stream::SetBodyProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer) {
+    body_producer_ = std::move(producer);
+}
+
+std::size_t Stream::TakeUnconsumedBody(std::size_t max_size) noexcept {
+    const auto size = std::min(max_size, unconsumed_body_size_);
+    unconsumed_body_size_ -= size;
+    return size;
+}
+
 bool Stream::CheckUrlComplete() {
     if (url_complete_) return true;
     try {
@@ -100,9 +116,9 @@ ssize_t Stream::GetMaxSize(std::size_t max_len, std::uint32_t* flags) {
     return res;
 }
 
-void Stream::Send(engine::io::Socket& socket, std::string_view data_frame_header, std::size_t max_len) {
-    boost::container::small_vector<engine::io::IoData, 16> parts{};
-    parts.push_back({data_frame_header.data(), data_frame_header.size()});
+void Stream::Send(Http2WriteQueue& queue, std::string_view data_frame_header, std::size_t max_len) {
+    queue.PushCopy(data_frame_header);
+    std::size_t sent_chunks_count = 0;
     auto budget = max_len;
     for (const auto& chunk : chunks_) {
         if (budget == 0) {
@@ -111,19 +127,21 @@ void Stream::Send(engine::io::Socket& socket, std::string_view data_frame_header
         UASSERT(chunk.size() > pos_in_first_chunk_);
         const auto part =
             std::string_view{chunk}.substr(pos_in_first_chunk_, std::min(chunk.size() - pos_in_first_chunk_, budget));
-        parts.push_back({part.data(), part.size()});
+        queue.PushData(part);
         pos_in_first_chunk_ += part.size();
         if (pos_in_first_chunk_ >= chunk.size()) {
             pos_in_first_chunk_ = 0;
+            ++sent_chunks_count;
         }
         UASSERT(budget >= part.size());
         budget -= part.size();
     }
-    UASSERT(!parts.empty());
-    [[maybe_unused]] const auto res = socket.SendAll(parts.data(), parts.size(), {});
-    const auto send_parts_count =
-        pos_in_first_chunk_ == 0 ? parts.size() - 1 : parts.size() - 2;  // data_frame_header doesn't matter
-    chunks_.erase(chunks_.begin(), chunks_.begin() + send_parts_count);
+
+    // The queue may still reference the sent chunks
+    for (std::size_t i = 0; i < sent_chunks_count; ++i) {
+        queue.KeepAlive(std::move(chunks_[i]));
+    }
+    chunks_.erase(chunks_.begin(), chunks_.begin() + sent_chunks_count);
 }
 
 }  // namespace server::http
@@ -4,17 +4,16 @@
 #include <boost/container/small_vector.hpp>
 
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/request_body_stream_producer.hpp>
 
 #include <userver/utils/strong_typedef.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-namespace engine::io {
-class Socket;
-}
-
 namespace server::http {
 
+class Http2WriteQueue;
+
 class Stream final {
 public:
     using Id = utils::StrongTypedef<struct IdTag, std::int32_t>;
@@ -32,6 +31,8 @@ public:
     Stream& operator=(const Stream&) = delete;
     Stream& operator=(Stream&&) = delete;
 
+    ~Stream();
+
     Id GetId() const;
     HttpRequestConstructor& RequestConstructor();
     bool IsDeferred() const;
@@ -43,9 +44,18 @@ public:
     bool CheckUrlComplete();
     void PushChunk(std::string&& chunk);
     ssize_t GetMaxSize(std::size_t max_len, std::uint32_t* flags);
-    void Send(engine::io::Socket& socket, std::string_view data_frame_header, std::size_t max_len);
+    void Send(Http2WriteQueue& queue, std::string_view data_frame_header, std::size_t max_len);
+    bool HasChunks() const noexcept { return !chunks_.empty(); }
     nghttp2_data_provider* GetNativeProvider() { return &nghttp2_provider_; }
 
+    // Request body streaming
+    void SetBodyProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer);
+    impl::RequestBodyStreamProducer* GetBodyProducer() const noexcept { return body_producer_.get(); }
+    void AddUnconsumedBody(std::size_t size) noexcept { unconsumed_body_size_ += size; }
+    // Returns up to max_size received body bytes that were not reported to
+    // nghttp2 as consumed yet
+    std::size_t TakeUnconsumedBody(std::size_t max_size) noexcept;
+
 private:
     bool url_complete_{false};
     HttpRequestConstructor constructor_;
@@ -58,6 +68,9 @@ private:
     bool is_streaming_{false};
     bool is_end_{false};
     bool is_deferred_{false};
+    // for the request body streaming
+    std::shared_ptr<impl::RequestBodyStreamProducer> body_producer_;
+    std::size_t unconsumed_body_size_{0};
 };
 
 }  // namespace server::http
@@ -0,0 +1,75 @@
+#include <server/http/http2_write_queue.hpp>
+
+#include <userver/engine/io/socket.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+Http2WriteQueue::Http2WriteQueue(engine::io::RwBase* socket)
+    : socket_(socket), raw_socket_(dynamic_cast<engine::io::Socket*>(socket)) {}
+
+void Http2WriteQueue::PushCopy(std::string_view data) {
+    if (data.empty()) return;
+
+    if (!parts_.empty()) {
+        auto& last = parts_.back();
+        if (!last.data && last.offset + last.size == copied_.size()) {
+            copied_.append(data);
+            last.size += data.size();
+            return;
+        }
+    }
+
+    if (parts_.size() == kMaxParts) Flush();
+    parts_.push_back(Part{nullptr, copied_.size(), data.size()});
+    copied_.append(data);
+}
+
+void Http2WriteQueue::PushData(std::string_view data) {
+    if (data.size() < kMinReferencedSize) {
+        PushCopy(data);
+        return;
+    }
+
+    if (parts_.size() == kMaxParts) Flush();
+    parts_.push_back(Part{data.data(), 0, data.size()});
+}
+
+void Http2WriteQueue::KeepAlive(std::string&& chunk) {
+    // Strings of that size are not in SSO, moving them keeps the data in place
+    static_assert(kMinReferencedSize > sizeof(std::string));
+    if (chunk.size() < kMinReferencedSize || parts_.empty()) return;
+    kept_chunks_.push_back(std::move(chunk));
+}
+
+void Http2WriteQueue::Flush() {
+    if (parts_.empty()) return;
+    UASSERT(socket_);
+
+    const utils::FastScopeGuard clear_guard{[this]() noexcept {
+        parts_.clear();
+        copied_.clear();
+        kept_chunks_.clear();
+    }};
+
+    boost::container::small_vector<engine::io::IoData, kMaxParts> buffers;
+    for (const auto& part : parts_) {
+        const char* data = part.data ? part.data : copied_.data() + part.offset;
+        buffers.push_back({data, part.size});
+    }
+
+    if (raw_socket_) {
+        [[maybe_unused]] const auto sent = raw_socket_->SendAll(buffers.data(), buffers.size(), {});
+    } else {
+        for (const auto& buffer : buffers) {
+            [[maybe_unused]] const auto sent = socket_->WriteAll(buffer.data, buffer.len, {});
+        }
+    }
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <boost/container/small_vector.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+class RwBase;
+class Socket;
+}  // namespace engine::io
+
+namespace server::http {
+
+// Accumulates the outgoing frames of all the streams of an HTTP/2 session
+// to write them to the socket with a single writev on Flush().
+//
+// Small pieces are copied, large pieces of DATA frames are referenced and
+// must stay alive and immovable until Flush(), see KeepAlive().
+class Http2WriteQueue final {
+public:
+    // Pieces of at least this size are not copied by PushData()
+    static constexpr std::size_t kMinReferencedSize = 512;
+
+    explicit Http2WriteQueue(engine::io::RwBase* socket);
+
+    Http2WriteQueue(const Http2WriteQueue&) = delete;
+    Http2WriteQueue& operator=(const Http2WriteQueue&) = delete;
+
+    void PushCopy(std::string_view data);
+
+    // Copies small `data`, references large ones
+    void PushData(std::string_view data);
+
+    // Holds the `chunk` referenced by PushData() down to the next Flush(),
+    // does nothing for the chunks that were copied
+    void KeepAlive(std::string&& chunk);
+
+    bool IsEmpty() const noexcept { return parts_.empty(); }
+
+    void Flush();
+
+private:
+    // Limit to the writev buffers count. Way below IOV_MAX to keep the
+    // iovec array on stack.
+    static constexpr std::size_t kMaxParts = 64;
+
+    struct Part final {
+        // nullptr if the piece is in copied_
+        const char* data;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    engine::io::RwBase* socket_;
+    // Same as socket_ if it supports writev
+    engine::io::Socket* raw_socket_;
+    std::string copied_;
+    boost::container::small_vector<Part, kMaxParts> parts_;
+    boost::container::small_vector<std::string, 16> kept_chunks_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
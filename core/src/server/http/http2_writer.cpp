@@ -102,6 +102,10 @@ public:
 
     void WriteHttpResponse() {
         auto data = response_.ExtractData();
+        if (data.empty() && response_.file_body_) {
+            data = response_.ReadFileBody();
+            response_.file_body_.reset();
+        }
 
         auto headers = GetHeaders();
         const bool is_body_forbidden = IsBodyForbiddenForStatus(response_.status_);
@@ -2,6 +2,7 @@
 
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/http/http_request_impl.hpp>
+#include <server/http/request_body_stream_producer.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/http/common_headers.hpp>
@@ -159,10 +160,10 @@ std::vector<std::string> HttpRequest::FormDataArgNames() const {
 }
 
 const std::string& HttpRequest::GetPathArg(std::string_view arg_name) const {
-    const auto* ptr = utils::impl::FindTransparentOrNullptr(pimpl_->path_args_by_name_index_, arg_name);
-    if (!ptr) return kEmptyString;
-    UASSERT(*ptr < pimpl_->path_args_.size());
-    return pimpl_->path_args_[*ptr];
+    const auto it = pimpl_->path_args_by_name_index_.find(arg_name);
+    if (it == pimpl_->path_args_by_name_index_.end()) return kEmptyString;
+    UASSERT(it->second < pimpl_->path_args_.size());
+    return pimpl_->path_args_[it->second];
 }
 
 const std::string& HttpRequest::GetPathArg(size_t index) const {
@@ -170,7 +171,7 @@ const std::string& HttpRequest::GetPathArg(size_t index) const {
 }
 
 bool HttpRequest::HasPathArg(std::string_view arg_name) const {
-    return !!utils::impl::FindTransparentOrNullptr(pimpl_->path_args_by_name_index_, arg_name);
+    return pimpl_->path_args_by_name_index_.find(arg_name) != pimpl_->path_args_by_name_index_.end();
 }
 
 bool HttpRequest::HasPathArg(size_t index) const { return index < PathArgCount(); }
@@ -252,6 +253,18 @@ bool HttpRequest::IsFinal() const { return pimpl_->is_final_; }
 
 void HttpRequest::SetResponseStatus(HttpStatus status) const { pimpl_->response_.SetStatus(status); }
 
+bool HttpRequest::IsBodyStreamed() const { return pimpl_->body_stream_producer_ != nullptr; }
+
+RequestBodyStream& HttpRequest::GetBodyStream() const {
+    if (!pimpl_->body_stream_) {
+        throw std::logic_error(
+            IsBodyStreamed() ? "The request body stream is available only while the request is handled"
+                             : "The request body is not streamed, set the 'request-body-stream' option of the handler"
+        );
+    }
+    return *pimpl_->body_stream_;
+}
+
 bool HttpRequest::IsBodyCompressed() const {
     const auto& encoding = GetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding);
     return !encoding.empty() && encoding != "identity";
@@ -274,6 +287,7 @@ void HttpRequest::SetPathArgs(std::vector<std::pair<std::string, std::string>> a
     pimpl_->path_args_.reserve(args.size());
 
     pimpl_->path_args_by_name_index_.clear();
+    pimpl_->path_args_by_name_index_.reserve(args.size());
     for (auto& [name, value] : args) {
         pimpl_->path_args_.push_back(std::move(value));
         if (!name.empty()) {
@@ -316,6 +330,17 @@ void HttpRequest::SetStreamProducer(impl::Http2StreamEventProducer&& producer) {
     pimpl_->response_.SetStreamProdicer(std::move(producer));
 }
 
+void HttpRequest::SetBodyStreamProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer) {
+    pimpl_->body_stream_ = std::make_unique<RequestBodyStream>(producer->MakeStream());
+    pimpl_->body_stream_producer_ = std::move(producer);
+}
+
+void HttpRequest::ResetBodyStream() noexcept { pimpl_->body_stream_.reset(); }
+
+impl::RequestBodyStreamProducer* HttpRequest::GetBodyStreamProducer() const {
+    return pimpl_->body_stream_producer_.get();
+}
+
 void HttpRequest::SetTaskCreateTime() { pimpl_->task_create_time_ = std::chrono::steady_clock::now(); }
 
 void HttpRequest::SetTaskStartTime() { pimpl_->task_start_time_ = std::chrono::steady_clock::now(); }
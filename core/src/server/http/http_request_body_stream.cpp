@@ -0,0 +1,39 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <server/http/request_body_stream_producer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(Queue::Consumer&& consumer, std::shared_ptr<impl::RequestBodyStreamState> state)
+    : consumer_(std::move(consumer)), state_(std::move(state)) {}
+
+RequestBodyStream::RequestBodyStream(RequestBodyStream&&) noexcept = default;
+
+RequestBodyStream& RequestBodyStream::operator=(RequestBodyStream&&) noexcept = default;
+
+RequestBodyStream::~RequestBodyStream() = default;
+
+bool RequestBodyStream::ReadChunk(std::string& output, engine::Deadline deadline) {
+    if (!consumer_.Pop(output, deadline)) {
+        // The end of the body is signalled by the producer going away
+        if (!consumer_.Queue()->NoMoreProducers() || !state_->is_received) return false;
+        if (!consumer_.PopNoblock(output)) {
+            is_complete_ = true;
+            return false;
+        }
+    }
+
+    // After the whole body was received there is no need to extend the window
+    if (state_->window_producer && !state_->is_received) {
+        state_->window_producer->PushEvent({state_->stream_id, {}, false, output.size()});
+    }
+    return true;
+}
+
+bool RequestBodyStream::IsComplete() const { return is_complete_; }
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
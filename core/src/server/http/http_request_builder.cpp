@@ -54,6 +54,11 @@ HttpRequestBuilder& HttpRequestBuilder::AddHeader(std::string&& header, std::str
     return *this;
 }
 
+HttpRequestBuilder& HttpRequestBuilder::ReserveHeaders(std::size_t count) {
+    request_->pimpl_->headers_.reserve(count);
+    return *this;
+}
+
 HttpRequestBuilder& HttpRequestBuilder::AddRequestArg(std::string&& key, std::string&& value) {
     request_->pimpl_->request_args_[std::move(key)].push_back(std::move(value));
     return *this;
@@ -106,6 +111,12 @@ HttpRequestBuilder& HttpRequestBuilder::SetStreamProducer(impl::Http2StreamEvent
     return *this;
 }
 
+HttpRequestBuilder& HttpRequestBuilder::SetBodyStreamProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer
+) {
+    request_->SetBodyStreamProducer(std::move(producer));
+    return *this;
+}
+
 HttpRequestBuilder& HttpRequestBuilder::SetResponseStreamId(std::int32_t stream_id) {
     request_->SetResponseStreamId(stream_id);
     return *this;
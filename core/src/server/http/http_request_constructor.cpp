@@ -10,6 +10,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
 #include <userver/utils/exception.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 #include "multipart_form_data_parser.hpp"
 
@@ -112,6 +113,7 @@ void HttpRequestConstructor::ParseUrl() {
         config_.max_headers_size = handler_config.request_config.max_headers_size;
         config_.parse_args_from_body = handler_config.request_config.parse_args_from_body;
         if (handler_config.decompress_request) config_.decompress_request = true;
+        body_stream_enabled_ = handler_config.request_body_stream;
 
         builder_.SetTaskProcessor(handler_info->task_processor);
         builder_.SetHttpHandler(handler_info->handler);
@@ -143,7 +145,7 @@ void HttpRequestConstructor::AppendHeaderField(const char* data, size_t size) {
     AccountHeadersSize(size);
     AccountRequestSize(size);
 
-    header_field_.append(data, size);
+    AppendHeaderPart(header_views_.field, header_field_, data, size);
 }
 
 void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
@@ -153,7 +155,7 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
     AccountHeadersSize(size);
     AccountRequestSize(size);
 
-    header_value_.append(data, size);
+    AppendHeaderPart(header_views_.value, header_value_, data, size);
 }
 
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
@@ -163,13 +165,35 @@ void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
 
 void HttpRequestConstructor::SetIsFinal(bool is_final) { builder_.SetIsFinal(is_final); }
 
+void HttpRequestConstructor::EnableHeaderViews() { header_views_enabled_ = true; }
+
+void HttpRequestConstructor::DetachHeaderViews() {
+    FlushPendingHeaders();
+    if (!header_copied_) CopyHeaderViews();
+}
+
 void HttpRequestConstructor::SetResponseStreamId(std::int32_t stream_id) { builder_.SetResponseStreamId(stream_id); }
 
 void HttpRequestConstructor::SetStreamProducer(impl::Http2StreamEventProducer&& producer) {
     builder_.SetStreamProducer(std::move(producer));
 }
 
+bool HttpRequestConstructor::IsBodyStreamed() const { return body_stream_enabled_ && status_ == Status::kOk; }
+
+void HttpRequestConstructor::SetBodyStreamProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer) {
+    UASSERT(IsBodyStreamed());
+    builder_.SetBodyStreamProducer(std::move(producer));
+    body_streamed_ = true;
+}
+
 std::shared_ptr<http::HttpRequest> HttpRequestConstructor::Finalize() {
+    try {
+        FlushPendingHeaders();
+    } catch (const std::exception& ex) {
+        // status is already set
+        LOG_WARNING() << "can't add headers: " << ex;
+    }
+
     FinalizeImpl();
 
     CheckStatus();
@@ -193,7 +217,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
     try {
         ParseArgs(*parsed_url_pimpl_);
-        if (config_.parse_args_from_body) {
+        if (config_.parse_args_from_body && !body_streamed_) {
             if (!config_.decompress_request || !request.IsBodyCompressed())
                 ParseArgs(request.RequestBody().data(), request.RequestBody().size());
         }
@@ -205,7 +229,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
     // TODO: split logic
     const auto& content_type = request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-    if (IsMultipartFormDataContentType(content_type)) {
+    if (!body_streamed_ && IsMultipartFormDataContentType(content_type)) {
         utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash> form_data_args;
         if (!ParseMultipartFormData(content_type, request.RequestBody(), form_data_args)) {
             SetStatus(Status::kParseMultipartFormDataError);
@@ -230,19 +254,70 @@ void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
     );
 }
 
+void HttpRequestConstructor::AppendHeaderPart(std::string_view& view, std::string& str, const char* data, size_t size) {
+    if (header_views_enabled_ && !header_copied_) {
+        // llhttp reports the whole field or value at once, unless it is split
+        // between the input buffers or interleaved with obsolete line folding
+        if (view.empty()) {
+            view = std::string_view{data, size};
+            return;
+        }
+        if (view.data() + view.size() == data) {
+            view = std::string_view{view.data(), view.size() + size};
+            return;
+        }
+        CopyHeaderViews();
+    }
+
+    str.append(data, size);
+}
+
+void HttpRequestConstructor::CopyHeaderViews() {
+    UASSERT(!header_copied_);
+    header_field_.assign(header_views_.field);
+    header_value_.assign(header_views_.value);
+    header_views_ = {};
+    header_copied_ = true;
+}
+
 void HttpRequestConstructor::AddHeader() {
     UASSERT(header_field_flag_);
 
+    if (header_views_enabled_ && !header_copied_) {
+        pending_headers_.push_back(header_views_);
+        header_views_ = {};
+        if (pending_headers_.size() == kPendingHeadersCount) FlushPendingHeaders();
+        return;
+    }
+
+    // keep the headers order for the duplicates
+    FlushPendingHeaders();
+    InsertHeader(std::move(header_field_), std::move(header_value_));
+    header_field_.clear();
+    header_value_.clear();
+    header_copied_ = false;
+}
+
+void HttpRequestConstructor::InsertHeader(std::string&& field, std::string&& value) {
     try {
-        builder_.AddHeader(std::move(header_field_), std::move(header_value_));
+        builder_.AddHeader(std::move(field), std::move(value));
     } catch (const USERVER_NAMESPACE::http::headers::HeaderMap::TooManyHeadersException&) {
         SetStatus(Status::kHeadersTooLarge);
         utils::LogErrorAndThrow(fmt::format(
             "HeaderMap reached its maximum capacity, already contains {} headers", builder_.GetRef().GetHeaders().size()
         ));
     }
-    header_field_.clear();
-    header_value_.clear();
+}
+
+void HttpRequestConstructor::FlushPendingHeaders() {
+    if (pending_headers_.empty()) return;
+
+    if (builder_.GetRef().GetHeaders().empty()) builder_.ReserveHeaders(pending_headers_.size());
+
+    const utils::ScopeGuard clear_guard{[this] { pending_headers_.clear(); }};
+    for (const auto& header : pending_headers_) {
+        InsertHeader(std::string{header.field}, std::string{header.value});
+    }
 }
 
 void HttpRequestConstructor::SetStatus(HttpRequestConstructor::Status status) { status_ = status; }
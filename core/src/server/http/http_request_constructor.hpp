@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
+
+#include <boost/container/small_vector.hpp>
 
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/server/http/http_method.hpp>
@@ -56,10 +59,24 @@ public:
 
     void SetIsFinal(bool is_final);
 
+    // HTTP/1.1 only:
+    // Allows keeping views to the data passed to AppendHeaderField() and
+    // AppendHeaderValue() instead of copying it. The data must stay valid until
+    // the DetachHeaderViews() call.
+    void EnableHeaderViews();
+    // Adds the complete headers to the request and copies the data of the
+    // incomplete one, must be called before the input buffer is invalidated.
+    void DetachHeaderViews();
+
     // HTTP/2.0 only:
     void SetStreamProducer(impl::Http2StreamEventProducer&& producer);
     void SetResponseStreamId(std::int32_t stream_id);
 
+    // Handler reads the body as a stream, so the request is finalized right
+    // after the headers and the body goes to the producer
+    bool IsBodyStreamed() const;
+    void SetBodyStreamProducer(std::shared_ptr<impl::RequestBodyStreamProducer> producer);
+
     std::shared_ptr<http::HttpRequest> Finalize();
 
 private:
@@ -69,7 +86,11 @@ private:
 
     void ParseArgs(const HttpParserUrl& url);
     void ParseArgs(const char* data, size_t size);
+    void AppendHeaderPart(std::string_view& view, std::string& str, const char* data, size_t size);
+    void CopyHeaderViews();
     void AddHeader();
+    void InsertHeader(std::string&& field, std::string&& value);
+    void FlushPendingHeaders();
 
     void SetStatus(Status status);
     void AccountRequestSize(size_t size);
@@ -82,15 +103,30 @@ private:
     const HandlerInfoIndex& handler_info_index_;
 
     utils::FastPimpl<HttpParserUrl, 60, 8> parsed_url_pimpl_;
+    struct HeaderViews {
+        std::string_view field;
+        std::string_view value;
+    };
+
+    // Typical requests fit, so the headers are inserted with a single reserve
+    static constexpr std::size_t kPendingHeadersCount = 32;
+
+    // The header being parsed, either in views or in header_field_/header_value_
+    HeaderViews header_views_;
     std::string header_field_;
     std::string header_value_;
     bool header_field_flag_ = false;
     bool header_value_flag_ = false;
+    bool header_views_enabled_ = false;
+    bool header_copied_ = false;
+    boost::container::small_vector<HeaderViews, kPendingHeadersCount> pending_headers_;
 
     size_t request_size_ = 0;
     size_t url_size_ = 0;
     size_t headers_size_ = 0;
     bool url_parsed_ = false;
+    bool body_stream_enabled_ = false;
+    bool body_streamed_ = false;
     Status status_ = Status::kOk;
 
     std::string url_;
@@ -1,6 +1,10 @@
 #include <benchmark/benchmark.h>
 
+#include <fmt/format.h>
+
 #include <server/http/http_request_constructor.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_request_builder.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,7 +19,31 @@ void http_request_constructor_url_decode(benchmark::State& state) {
 
     for ([[maybe_unused]] auto _ : state) benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+// Builds a request with `state.range(0)` args, a few path args and a cookie
+// header, the args and path args are stored in the request arena
+void http_request_builder_build(benchmark::State& state) {
+    std::vector<std::pair<std::string, std::string>> args;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        args.emplace_back(fmt::format("arg_{}", i), fmt::format("value_{}", i));
+    }
+
+    server::request::ResponseDataAccounter accounter;
+    for ([[maybe_unused]] auto _ : state) {
+        server::http::HttpRequestBuilder builder{accounter};
+        for (const auto& [key, value] : args) {
+            builder.AddRequestArg(std::string{key}, std::string{value});
+        }
+        builder.SetPathArgs({{"user", "12345"}, {"order", "67890"}, {"", "unnamed"}});
+        builder.AddHeader(std::string{USERVER_NAMESPACE::http::headers::kCookie}, "session=abcdef; theme=dark");
+
+        auto request = builder.Build();
+        benchmark::DoNotOptimize(request->GetPathArg("order"));
+        benchmark::DoNotOptimize(request->GetArg("arg_0"));
+    }
+}
 }  // namespace
 BENCHMARK(http_request_constructor_url_decode)->RangeMultiplier(2)->Range(1, 1024);
+BENCHMARK(http_request_builder_build)->RangeMultiplier(4)->Range(1, 64);
 
 USERVER_NAMESPACE_END
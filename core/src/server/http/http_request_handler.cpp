@@ -10,12 +10,14 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/task_inherited_request.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -56,7 +58,14 @@ engine::TaskWithResult<void> HttpRequestHandler::StartFailsafeTask(std::shared_p
 
     http_request->SetHttpHandlerStatistics(dummy_statistics);
 
-    return engine::AsyncNoSpan([request = std::move(http_request), handler]() {
+    // The connection stops waiting for the body to be read once the payload is
+    // destroyed, i.e. after the run or on cancellation before the start
+    auto body_stream_guard =
+        utils::FastScopeGuard([request = http_request.get()]() noexcept { request->ResetBodyStream(); });
+
+    return engine::AsyncNoSpan([request = std::move(http_request),
+                                handler,
+                                body_stream_guard = std::move(body_stream_guard)]() {
         request->SetTaskStartTime();
         if (handler) handler->ReportMalformedRequest(*request);
         request->SetResponseNotifyTime();
@@ -69,6 +78,31 @@ namespace {
 utils::statistics::MetricTag<std::atomic<size_t>> kCcStatusCodeIsCustom{
     "congestion-control.rps.is-custom-status-activated"};
 
+// Gives the inline request its own task-local variables, as if it was a child
+// task of the connection, so that nothing leaks into the following requests
+class InlineRequestStorageScope final {
+public:
+    InlineRequestStorageScope() : storage_(engine::impl::task_local::GetCurrentStorage()) {
+        connection_storage_.InitializeFrom(std::move(storage_));
+        storage_.InheritFrom(connection_storage_);
+    }
+
+    InlineRequestStorageScope(InlineRequestStorageScope&&) = delete;
+    InlineRequestStorageScope& operator=(InlineRequestStorageScope&&) = delete;
+
+    ~InlineRequestStorageScope() {
+        {
+            engine::impl::task_local::Storage request_storage;
+            request_storage.InitializeFrom(std::move(storage_));
+        }
+        storage_.InitializeFrom(std::move(connection_storage_));
+    }
+
+private:
+    engine::impl::task_local::Storage& storage_;
+    engine::impl::task_local::Storage connection_storage_;
+};
+
 }  // namespace
 
 engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_ptr<http::HttpRequest> http_request
@@ -147,7 +181,10 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
         http_response.SetStreamBody();
     }
 
-    auto payload = [request = std::move(http_request), handler] {
+    auto body_stream_guard =
+        utils::FastScopeGuard([request = http_request.get()]() noexcept { request->ResetBodyStream(); });
+
+    auto payload = [request = std::move(http_request), handler, body_stream_guard = std::move(body_stream_guard)] {
         server::request::kTaskInheritedRequest.Set(std::static_pointer_cast<HttpRequest>(request));
 
         request->SetTaskStartTime();
@@ -160,6 +197,12 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
         request->GetHttpResponse().SetReady(now);
     };
 
+    if (handler->GetConfig().run_inline) {
+        const InlineRequestStorageScope storage_scope;
+        payload();
+        return {};
+    }
+
     if (!is_monitor_ && throttling_enabled) {
         return engine::AsyncNoSpan(*task_processor, std::move(payload));
     } else {
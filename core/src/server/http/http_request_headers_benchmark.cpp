@@ -35,6 +35,17 @@ void http_request_headers_insert(benchmark::State& state) {
     }
 }
 
+void http_request_headers_insert_reserved(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        server::http::HttpRequest::HeadersMap map;
+        map.reserve(state.range(0));
+
+        for (int i = 0; i < state.range(0); i++) map[kHeadersArray[i]] = "1";
+
+        benchmark::DoNotOptimize(map);
+    }
+}
+
 void http_request_headers_get(benchmark::State& state) {
     server::http::HttpRequest::HeadersMap map;
     for (const auto& header : kHeadersArray) map[header] = "1";
@@ -48,6 +59,7 @@ void http_request_headers_get(benchmark::State& state) {
 
 }  // namespace
 BENCHMARK(http_request_headers_insert)->RangeMultiplier(2)->Range(1, kHeadersCount);
+BENCHMARK(http_request_headers_insert_reserved)->RangeMultiplier(2)->Range(1, kHeadersCount);
 
 BENCHMARK(http_request_headers_get);
 
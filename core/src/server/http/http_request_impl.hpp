@@ -1,6 +1,8 @@
 #pragma once
 
 #include <userver/server/http/http_request.hpp>
+#include <userver/utils/arena_containers.hpp>
+#include <userver/utils/monotonic_arena.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,6 +14,24 @@ constexpr size_t kBucketCount = 16;
 
 constexpr size_t kZeroAllocationBucketCount = 0;
 
+// Enough for the args and path args of a typical request, larger requests
+// continue in the heap blocks of the arena
+constexpr size_t kArenaInlineSize = 512;
+
+constexpr size_t kInlinePathArgs = 4;
+
+using RequestArgs = utils::impl::TransparentMap<
+    std::string,
+    std::vector<std::string>,
+    utils::StrCaseHash,
+    std::equal_to<>,
+    utils::ArenaAllocator<std::pair<const std::string, std::vector<std::string>>>>;
+
+using PathArgs = utils::ArenaSmallVector<std::string, kInlinePathArgs>;
+
+// Path arg names come from the handler config, so there are only a few of them
+using PathArgsByNameIndex = utils::ArenaSmallFlatMap<std::string, size_t, kInlinePathArgs>;
+
 }  // namespace impl
 
 struct HttpRequest::Impl {
@@ -20,8 +40,15 @@ struct HttpRequest::Impl {
     // overhead.
     Impl(HttpRequest& http_request, request::ResponseDataAccounter& data_accounter)
         : start_time_(std::chrono::steady_clock::now()),
+          request_args_(
+              impl::kZeroAllocationBucketCount,
+              utils::StrCaseHash{},
+              std::equal_to<>{},
+              impl::RequestArgs::allocator_type{arena_}
+          ),
           form_data_args_(impl::kZeroAllocationBucketCount, request_args_.hash_function()),
-          path_args_by_name_index_(impl::kZeroAllocationBucketCount, request_args_.hash_function()),
+          path_args_(impl::PathArgs::allocator_type{utils::ArenaAllocator<std::string>{arena_}}),
+          path_args_by_name_index_(impl::PathArgsByNameIndex::allocator_type{utils::ArenaAllocator<void>{arena_}}),
           headers_(impl::kBucketCount),
           cookies_(impl::kZeroAllocationBucketCount, request_args_.hash_function()),
           response_(http_request, data_accounter, start_time_, cookies_.hash_function()) {}
@@ -39,10 +66,12 @@ struct HttpRequest::Impl {
     std::string url_;
     std::string request_path_;
     std::string request_body_;
-    utils::impl::TransparentMap<std::string, std::vector<std::string>, utils::StrCaseHash> request_args_;
+    // Request-scoped storage for the args, should be declared before them
+    utils::InlineMonotonicArena<impl::kArenaInlineSize> arena_;
+    impl::RequestArgs request_args_;
     utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash> form_data_args_;
-    std::vector<std::string> path_args_;
-    utils::impl::TransparentMap<std::string, size_t, utils::StrCaseHash> path_args_by_name_index_;
+    impl::PathArgs path_args_;
+    impl::PathArgsByNameIndex path_args_by_name_index_;
     HeadersMap headers_;
     CookiesMap cookies_;
     bool is_final_{false};
@@ -57,6 +86,8 @@ struct HttpRequest::Impl {
     engine::TaskProcessor* task_processor_{nullptr};
     const handlers::HttpHandlerBase* handler_{nullptr};
     handlers::HttpRequestStatistics* request_statistics_{nullptr};
+    std::unique_ptr<RequestBodyStream> body_stream_;
+    std::shared_ptr<impl::RequestBodyStreamProducer> body_stream_producer_;
 };
 
 }  // namespace server::http
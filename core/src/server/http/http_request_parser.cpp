@@ -1,5 +1,6 @@
 #include "http_request_parser.hpp"
 
+#include <server/http/request_body_stream_producer.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -101,6 +102,18 @@ HttpRequestParser::HttpRequestParser(
 
 bool HttpRequestParser::Parse(std::string_view req) {
     const auto err = llhttp_execute(&parser_, req.data(), req.size());
+    if (err != HPE_OK && body_producer_) {
+        // The request is already being handled, there is no way to respond
+        // with another one
+        LOG_WARNING() << "streamed request body is malformed, error_description=" << llhttp_errno_name(err);
+        body_producer_->Abort();
+        body_producer_.reset();
+        return false;
+    }
+    if (err == HPE_OK && !DetachHeaderViews()) {
+        FinalizeRequest();
+        return false;
+    }
     if (parser_.upgrade && err == HPE_PAUSED_UPGRADE) {
         FinalizeRequest();
         // returns true iff it is an HTTP/2 upgrade request
@@ -208,15 +221,28 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
     if (!CheckUrlComplete(p)) return -1;
     try {
         request_constructor_->AppendHeaderField("", 0);
+        request_constructor_->DetachHeaderViews();
     } catch (const std::exception& ex) {
         LOG_WARNING() << "can't append header value: " << ex;
         return -1;
     }
     LOG_TRACE() << "headers complete";
+
+    if (!p->upgrade && request_constructor_->IsBodyStreamed()) {
+        // The handler is started right away and reads the body as it arrives
+        request_constructor_->SetIsFinal(!llhttp_should_keep_alive(p));
+        body_producer_ = std::make_shared<impl::RequestBodyStreamProducer>();
+        request_constructor_->SetBodyStreamProducer(body_producer_);
+        if (!FinalizeRequest()) return -1;
+    }
     return 0;
 }
 
 int HttpRequestParser::OnBodyImpl(llhttp_t* p, const char* data, size_t size) {
+    if (body_producer_) {
+        body_producer_->Append({data, size});
+        return 0;
+    }
     UASSERT(request_constructor_);
     if (!CheckUrlComplete(p)) return -1;
     LOG_TRACE() << "body: '" << std::string_view(data, size) << "'";
@@ -230,6 +256,12 @@ int HttpRequestParser::OnBodyImpl(llhttp_t* p, const char* data, size_t size) {
 }
 
 int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
+    if (body_producer_) {
+        LOG_TRACE() << "streamed body complete";
+        body_producer_->SetReceived();
+        body_producer_.reset();
+        return 0;
+    }
     UASSERT(request_constructor_);
     if (p->upgrade) {
         return 0;
@@ -244,9 +276,21 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
 void HttpRequestParser::CreateRequestConstructor() {
     stats_.parsing_request_count.Add(1);
     request_constructor_.emplace(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_);
+    request_constructor_->EnableHeaderViews();
     url_complete_ = false;
 }
 
+bool HttpRequestParser::DetachHeaderViews() {
+    if (!request_constructor_) return true;
+    try {
+        request_constructor_->DetachHeaderViews();
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "can't append headers: " << ex;
+        return false;
+    }
+    return true;
+}
+
 bool HttpRequestParser::CheckUrlComplete(llhttp_t* p) {
     if (url_complete_) return true;
     url_complete_ = true;
@@ -56,6 +56,9 @@ private:
 
     void CreateRequestConstructor();
 
+    // The headers reference the input buffer until this call
+    bool DetachHeaderViews();
+
     bool CheckUrlComplete(llhttp_t* p);
 
     bool FinalizeRequest();
@@ -70,6 +73,8 @@ private:
 
     llhttp_t parser_{};
     std::optional<HttpRequestConstructor> request_constructor_;
+    // The body of the request that is already being handled
+    std::shared_ptr<impl::RequestBodyStreamProducer> body_producer_;
 
     static const llhttp_settings_t parser_settings;
     net::ParserStats& stats_;
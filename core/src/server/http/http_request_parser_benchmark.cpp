@@ -17,6 +17,32 @@ constexpr std::string_view kHttpRequestDataMiddle =
     "Content-type: application/json\r\nContent-Length: 18\r\n\r\n"
     "{\"hello\": \"world\"}";
 
+// Headers of a typical browser request
+constexpr std::string_view kHttpRequestDataBrowser =
+    "GET /api/v1/profile?lang=en HTTP/1.1\r\n"
+    "Host: example.com\r\n"
+    "Connection: keep-alive\r\n"
+    "sec-ch-ua: \"Chromium\";v=\"124\", \"Google Chrome\";v=\"124\", \"Not-A.Brand\";v=\"99\"\r\n"
+    "sec-ch-ua-mobile: ?0\r\n"
+    "sec-ch-ua-platform: \"Linux\"\r\n"
+    "Upgrade-Insecure-Requests: 1\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+    "Chrome/124.0.0.0 Safari/537.36\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,*/*;q=0.8\r\n"
+    "Sec-Fetch-Site: same-origin\r\n"
+    "Sec-Fetch-Mode: navigate\r\n"
+    "Sec-Fetch-User: ?1\r\n"
+    "Sec-Fetch-Dest: document\r\n"
+    "Referer: https://example.com/\r\n"
+    "Accept-Encoding: gzip, deflate, br, zstd\r\n"
+    "Accept-Language: en-US,en;q=0.9\r\n"
+    "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark; _ga=GA1.1.123456789.1700000000\r\n"
+    "X-Request-Id: 6f1c2a9e-3d4b-4c5a-9e8f-0a1b2c3d4e5f\r\n"
+    "X-YaTraceId: 0123456789abcdef0123456789abcdef\r\n"
+    "X-YaSpanId: 0123456789abcdef\r\n"
+    "X-Forwarded-For: 192.0.2.1\r\n"
+    "\r\n";
+
 constexpr size_t kEntryCount = 1024;
 
 inline server::http::HttpRequestParser CreateBenchmarkParser(server::http::HttpRequestParser::OnNewRequestCb&& cb) {
@@ -59,6 +85,28 @@ void http_request_parser_parse_benchmark_middle(benchmark::State& state) {
     }
 }
 
+void http_request_parser_parse_benchmark_browser(benchmark::State& state) {
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::http::HttpRequest>&&) {});
+
+    for ([[maybe_unused]] auto _ : state) {
+        parser.Parse(kHttpRequestDataBrowser);
+    }
+    state.SetBytesProcessed(state.iterations() * kHttpRequestDataBrowser.size());
+}
+
+// Headers are split between the reads, so they are copied out of the buffer
+void http_request_parser_parse_benchmark_browser_chunked(benchmark::State& state) {
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::http::HttpRequest>&&) {});
+    const auto chunk_size = static_cast<std::size_t>(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        for (std::size_t pos = 0; pos < kHttpRequestDataBrowser.size(); pos += chunk_size) {
+            parser.Parse(kHttpRequestDataBrowser.substr(pos, chunk_size));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * kHttpRequestDataBrowser.size());
+}
+
 void http_request_parser_parse_benchmark_large_url(benchmark::State& state) {
     auto parser = CreateBenchmarkParser([](std::shared_ptr<server::http::HttpRequest>&&) {});
 
@@ -112,6 +160,8 @@ void http_request_parser_parse_benchmark_many_headers(benchmark::State& state) {
 
 BENCHMARK(http_request_parser_parse_benchmark_small);
 BENCHMARK(http_request_parser_parse_benchmark_middle);
+BENCHMARK(http_request_parser_parse_benchmark_browser);
+BENCHMARK(http_request_parser_parse_benchmark_browser_chunked)->RangeMultiplier(4)->Range(16, 256);
 BENCHMARK(http_request_parser_parse_benchmark_large_url);
 BENCHMARK(http_request_parser_parse_benchmark_large_body);
 BENCHMARK(http_request_parser_parse_benchmark_many_headers);
@@ -30,6 +30,10 @@ constexpr std::string_view kHttpRequestHeaderValues =
     "GET / HTTP/1.1\r\n"
     "Host: *\"@!%\r\nUser-Agent: [-]{~},/\r\n\r\n";
 
+constexpr std::string_view kHttpRequestHeadersDuplicate =
+    "GET / HTTP/1.1\r\n"
+    "Host: localhost:11235\r\nX-Header: first\r\nUser-Agent: curl/7.58.0\r\nX-Header: second\r\n\r\n";
+
 constexpr std::string_view kHttpRequestBodySimple =
     "GET / HTTP/1.1\r\n"
     "Host: localhost:11235\r\nContent-Length: 4\r\n\r\n"
@@ -118,6 +122,56 @@ UTEST(HttpRequestParserParser, HeadersSimple) {
     EXPECT_EQ(parsed, true);
 }
 
+UTEST(HttpRequestParserParser, HeadersSplitIntoChunks) {
+    for (std::size_t chunk_size = 1; chunk_size < kHttpRequestHeadersDuplicate.size(); ++chunk_size) {
+        bool parsed = false;
+        auto parser = server::CreateTestParser([&parsed](std::shared_ptr<server::http::HttpRequest>&& request) {
+            parsed = true;
+            auto& http_request_impl =
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+                static_cast<server::http::HttpRequest&>(*request);
+
+            EXPECT_EQ(http_request_impl.HeaderCount(), 3);
+            EXPECT_EQ(http_request_impl.GetHeader("host"), "localhost:11235");
+            EXPECT_EQ(http_request_impl.GetHeader("user-agent"), "curl/7.58.0");
+            EXPECT_EQ(http_request_impl.GetHeader("x-header"), "first,second");
+        });
+
+        for (std::size_t pos = 0; pos < kHttpRequestHeadersDuplicate.size(); pos += chunk_size) {
+            // a fresh buffer for each chunk, as the connection reuses its buffer
+            const std::string chunk{kHttpRequestHeadersDuplicate.substr(pos, chunk_size)};
+            ASSERT_TRUE(parser->Parse(chunk));
+        }
+        EXPECT_EQ(parsed, true) << "chunk_size=" << chunk_size;
+    }
+}
+
+UTEST(HttpRequestParserParser, HeadersMany) {
+    constexpr std::size_t kHeadersCount = 100;
+
+    std::string request_data = "GET / HTTP/1.1\r\n";
+    for (std::size_t i = 0; i < kHeadersCount; ++i) {
+        request_data += fmt::format("header{}: value{}\r\n", i, i);
+    }
+    request_data += "\r\n";
+
+    bool parsed = false;
+    auto parser = server::CreateTestParser([&](std::shared_ptr<server::http::HttpRequest>&& request) {
+        parsed = true;
+        auto& http_request_impl =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            static_cast<server::http::HttpRequest&>(*request);
+
+        EXPECT_EQ(http_request_impl.HeaderCount(), kHeadersCount);
+        for (std::size_t i = 0; i < kHeadersCount; ++i) {
+            EXPECT_EQ(http_request_impl.GetHeader(fmt::format("header{}", i)), fmt::format("value{}", i));
+        }
+    });
+
+    parser->Parse(request_data);
+    EXPECT_EQ(parsed, true);
+}
+
 UTEST(HttpRequestParserParser, HeadersNoSpaces) {
     bool parsed = false;
     auto parser = server::CreateTestParser([&parsed](std::shared_ptr<server::http::HttpRequest>&& request) {
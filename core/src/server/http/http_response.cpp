@@ -1,12 +1,19 @@
 #include <userver/server/http/http_response.hpp>
 
+#include <unistd.h>
+
+#include <algorithm>
 #include <array>
+#include <cerrno>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
@@ -291,6 +298,8 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
     if (IsBodyStreamed() && GetData().empty()) {
         sent_bytes = SetBodyStreamed(socket, header);
+    } else if (file_body_ && GetData().empty()) {
+        sent_bytes = SetBodyFromFile(socket, header);
     } else {
         // e.g. a CustomHandlerException
         sent_bytes = SetBodyNotStreamed(socket, header);
@@ -327,6 +336,87 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
     return sent_bytes;
 }
 
+std::size_t
+HttpResponse::SetBodyFromFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    UASSERT(file_body_);
+    const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+    const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
+
+    // The file could have been truncated since it was cached, so Content-Length
+    // is taken from what the file holds right now
+    const auto file_size = file_body_->file->GetSize();
+    file_body_->size =
+        file_body_->offset < file_size ? std::min(file_body_->size, file_size - file_body_->offset) : std::size_t{0};
+
+    if (!is_body_forbidden) {
+        impl::OutputHeader(
+            header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::format(FMT_COMPILE("{}"), file_body_->size)
+        );
+    }
+    header.append(kCrlf);
+
+    std::size_t sent_bytes = 0;
+    std::size_t expected_bytes = header.size();
+    if (is_head_request || is_body_forbidden) {
+        sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+    } else if (auto* plain_socket = dynamic_cast<engine::io::Socket*>(&socket)) {
+        sent_bytes = plain_socket->SendAll(header.data(), header.size(), engine::Deadline{});
+        if (sent_bytes == header.size()) {
+            sent_bytes += plain_socket->SendFileAll(
+                file_body_->file->GetNative(), file_body_->offset, file_body_->size, engine::Deadline{}
+            );
+        }
+    } else if (auto* tls_socket = dynamic_cast<engine::io::TlsWrapper*>(&socket);
+               tls_socket && tls_socket->IsKernelTlsTxEnabled()) {
+        sent_bytes = tls_socket->SendAll(header.data(), header.size(), engine::Deadline{});
+        if (sent_bytes == header.size()) {
+            sent_bytes += tls_socket->SendFileAll(
+                file_body_->file->GetNative(), file_body_->offset, file_body_->size, engine::Deadline{}
+            );
+        }
+    } else {
+        // TLS has to encrypt the data in userspace
+        const auto data = ReadFileBody();
+        sent_bytes = socket.WriteAll({{header.data(), header.size()}, {data.data(), data.size()}}, engine::Deadline{});
+    }
+    if (!is_head_request && !is_body_forbidden) expected_bytes += file_body_->size;
+
+    file_body_.reset();
+    if (sent_bytes < expected_bytes) {
+        // The peer would wait for the rest of the body or misframe the next
+        // response, the connection has to be closed
+        throw engine::io::IoException(fmt::format(
+            "Sent {} of {} bytes of a response with the body from file, the file was truncated or the peer is gone",
+            sent_bytes,
+            expected_bytes
+        ));
+    }
+    return sent_bytes;
+}
+
+std::string HttpResponse::ReadFileBody() const {
+    UASSERT(file_body_);
+    std::string result(file_body_->size, '\0');
+    std::size_t read_bytes = 0;
+    while (read_bytes < result.size()) {
+        const auto chunk = ::pread(
+            file_body_->file->GetNative(),
+            result.data() + read_bytes,
+            result.size() - read_bytes,
+            static_cast<off_t>(file_body_->offset + read_bytes)
+        );
+        if (chunk < 0 && errno == EINTR) continue;
+        if (chunk <= 0) {
+            LOG_LIMITED_ERROR() << "Failed to read the response body from file, read " << read_bytes << " of "
+                                << result.size() << " bytes";
+            break;
+        }
+        read_bytes += chunk;
+    }
+    result.resize(read_bytes);
+    return result;
+}
+
 std::size_t
 HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
@@ -336,36 +426,60 @@ HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::htt
     // headers end marker
     header.append(kCrlf);
 
-    // send HTTP headers
-    size_t sent_bytes = socket.WriteAll(header.data(), header.size(), {});
-    header.clear();
-    header.shrink_to_fit();  // free memory before time-consuming operation
-
     if (is_body_forbidden) {
-        return sent_bytes;
+        return socket.WriteAll(header.data(), header.size(), {});
     }
 
-    // Transmit HTTP response body
+    std::size_t sent_bytes = 0;
     std::string body_part;
-    // First chunk must be sent without kCrlf
-    // because kCrlf was sent with headers
+
+    // The headers go in the same write with the first chunk if it is already
+    // produced, otherwise they are sent right away and are not delayed till
+    // the handler produces the chunk
+    bool has_body_part = body_stream_->PopNoblock(body_part);
+    if (!has_body_part) {
+        sent_bytes += socket.WriteAll(header.data(), header.size(), {});
+        header.clear();
+        header.shrink_to_fit();  // free memory before time-consuming operation
+        has_body_part = body_stream_->Pop(body_part);
+    }
+
+    // Transmit HTTP response body, each chunk is written together with its
+    // framing without copying.
+    // First chunk must be sent without kCrlf because kCrlf was sent with
+    // headers
     bool first_chunk_processed = false;
-    while (body_stream_->Pop(body_part)) {
+    for (; has_body_part; has_body_part = body_stream_->Pop(body_part)) {
         if (body_part.empty()) {
             LOG_DEBUG() << "Zero size body_part in http_response.cpp";
             continue;
         }
 
-        auto size = first_chunk_processed ? fmt::format("\r\n{:x}\r\n", body_part.size())
-                                          : fmt::format("{:x}\r\n", body_part.size());
-        sent_bytes +=
-            socket.WriteAll({{size.data(), size.size()}, {body_part.data(), body_part.size()}}, engine::Deadline{});
+        // CRLF, up to 16 hex digits of the size and another CRLF
+        std::array<char, 20> framing;
+        char* framing_end = framing.data();
+        if (first_chunk_processed) AppendToCharArray(framing_end, kCrlf);
+        framing_end = fmt::format_to(framing_end, FMT_COMPILE("{:x}\r\n"), body_part.size());
+
+        sent_bytes += socket.WriteAll(
+            {{header.data(), header.size()},
+             {framing.data(), static_cast<std::size_t>(framing_end - framing.data())},
+             {body_part.data(), body_part.size()}},
+            engine::Deadline{}
+        );
+        if (!first_chunk_processed) {
+            header.clear();
+            header.shrink_to_fit();
+        }
 
         first_chunk_processed = true;
     }
 
     const std::string_view terminating_chunk{first_chunk_processed ? "\r\n0\r\n\r\n" : "0\r\n\r\n"};
-    sent_bytes += socket.WriteAll(terminating_chunk.data(), terminating_chunk.size(), {});
+    // The headers are still here if all the chunks were empty
+    sent_bytes += socket.WriteAll(
+        {{header.data(), header.size()}, {terminating_chunk.data(), terminating_chunk.size()}}, engine::Deadline{}
+    );
 
     // TODO: exceptions?
     body_stream_producer_.emplace<std::monostate>();
@@ -398,6 +512,15 @@ void HttpResponse::SetStreamBody() {
 
 bool HttpResponse::IsBodyStreamed() const { return is_stream_body_; }
 
+void HttpResponse::SetFileBody(
+    std::shared_ptr<const fs::blocking::FileDescriptor> file,
+    std::size_t offset,
+    std::size_t size
+) {
+    UASSERT(file);
+    file_body_.emplace(FileBody{std::move(file), offset, size});
+}
+
 HttpResponse::Producer HttpResponse::GetBodyProducer() {
     Producer res{};
     std::visit(
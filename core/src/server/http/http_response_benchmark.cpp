@@ -1,9 +1,16 @@
 #include <benchmark/benchmark.h>
 
-#include <fmt/compile.h>
+#include <array>
+#include <chrono>
 #include <sstream>
 
+#include <fmt/compile.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/small_string.hpp>
@@ -135,11 +142,44 @@ void HttpResponseSetHeaderBenchmark(benchmark::State& state) {
     }
 }
 
+// Headers and the body go to the socket in a single write without copying the
+// body
+void http_response_send(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        const auto test_deadline = engine::Deadline::FromDuration(std::chrono::seconds{60});
+        auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+        auto reader = engine::AsyncNoSpan([&client = client, test_deadline] {
+            std::array<char, 256 * 1024> buf{};
+            while (client.RecvSome(buf.data(), buf.size(), test_deadline) != 0) {
+            }
+        });
+
+        server::request::ResponseDataAccounter accounter;
+        const auto request = server::http::HttpRequestBuilder{accounter}.Build();
+        const std::string body(state.range(0), 'a');
+        std::size_t sent_bytes = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            server::http::HttpResponse response{*request, accounter};
+            response.SetData(body);
+            response.SetStatus(server::http::HttpStatus::kOk);
+            response.SendResponse(server);
+            sent_bytes += response.BytesSent();
+        }
+        state.SetBytesProcessed(sent_bytes);
+
+        // Makes the reader see EOF
+        server.Close();
+        reader.Get();
+    });
+}
+
 }  // namespace
 
 BENCHMARK(http_headers_serialization_inplace);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
 BENCHMARK(HttpResponseSetHeaderBenchmark);
+BENCHMARK(http_response_send)->Arg(1024)->Arg(64 * 1024)->Arg(1024 * 1024);
 
 USERVER_NAMESPACE_END
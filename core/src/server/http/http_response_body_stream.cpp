@@ -1,8 +1,12 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
+#include <server/http/response_body_encoder.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
@@ -13,6 +17,8 @@ ResponseBodyStream::ResponseBodyStream(
 )
     : queue_producer_(std::move(queue_producer)), http_response_(http_response) {}
 
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) noexcept = default;
+
 ResponseBodyStream::~ResponseBodyStream() {
     if (http_response_.GetStreamId().has_value()) {
         UASSERT(queue_producer_.index() == 2);
@@ -22,6 +28,14 @@ ResponseBodyStream::~ResponseBodyStream() {
 
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     UASSERT_MSG(headers_ended_, "SetEndOfHeaders() was not called before PushBodyChunk()");
+    if (encoder_) {
+        chunk = encoder_->Encode(chunk);
+        if (chunk.empty()) return;
+    }
+    DoPushBodyChunk(std::move(chunk), deadline);
+}
+
+void ResponseBodyStream::DoPushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     std::visit(
         utils::Overloaded{
             [&chunk, &deadline](HttpResponse::Queue::Producer& queue_producer) mutable {
@@ -46,6 +60,14 @@ void ResponseBodyStream::SetHeader(std::string_view name, const std::string& val
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+    if (encoder_) {
+        if (http_response_.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+            // The handler streams an already encoded body
+            encoder_.reset();
+        } else {
+            http_response_.SetContentEncoding(std::string{encoder_->GetContentEncoding()});
+        }
+    }
     headers_ended_ = true;
     http_response_.SetHeadersEnd();
 }
@@ -56,6 +78,21 @@ void ResponseBodyStream::SetStatusCode(int status_code) {
 
 void ResponseBodyStream::SetStatusCode(HttpStatus status) { http_response_.SetStatus(status); }
 
+void ResponseBodyStream::SetEncoder(std::unique_ptr<impl::ResponseBodyEncoder>&& encoder) {
+    UASSERT_MSG(!headers_ended_, "Encoder should be set before the headers are sent");
+    encoder_ = std::move(encoder);
+}
+
+void ResponseBodyStream::Finish(engine::Deadline deadline) {
+    if (!encoder_ || !headers_ended_) return;
+
+    auto tail = encoder_->Finish();
+    encoder_.reset();
+    if (!tail.empty()) {
+        DoPushBodyChunk(std::move(tail), deadline);
+    }
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -1,3 +1,5 @@
+#include <unistd.h>
+
 #include <string_view>
 #include <vector>
 
@@ -5,6 +7,9 @@
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_request_builder.hpp>
@@ -41,6 +46,109 @@ UTEST(HttpResponse, Smoke) {
     EXPECT_EQ(reply.substr(reply.size() - 4 - kBody.size()), fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, FileBody) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "skipped test data from file");
+    auto fd = std::make_shared<const fs::blocking::FileDescriptor>(
+        fs::blocking::FileDescriptor::Open(file.GetPath(), fs::blocking::OpenFlag::kRead)
+    );
+
+    server::request::ResponseDataAccounter accounter;
+    auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    server::http::HttpResponse response{*request, accounter};
+
+    constexpr std::string_view kBody = "test data from file";
+    response.SetFileBody(std::move(fd), 8, kBody.size());
+    response.SetStatus(server::http::HttpStatus::kOk);
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::vector<char> buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+    std::string_view reply{buffer.data(), reply_size};
+    const auto expected_content_length = fmt::format("\r\n{}: {}\r\n", http::headers::kContentLength, kBody.size());
+    EXPECT_TRUE(reply.find(expected_content_length) != std::string_view::npos);
+
+    EXPECT_EQ(reply.substr(reply.size() - 4 - kBody.size()), fmt::format("\r\n\r\n{}", kBody));
+}
+
+UTEST(HttpResponse, FileBodyTruncatedAfterCaching) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "skipped test data from file");
+    auto fd = std::make_shared<const fs::blocking::FileDescriptor>(
+        fs::blocking::FileDescriptor::Open(file.GetPath(), fs::blocking::OpenFlag::kRead)
+    );
+
+    server::request::ResponseDataAccounter accounter;
+    auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    server::http::HttpResponse response{*request, accounter};
+
+    // The size was cached before the file got truncated
+    response.SetFileBody(std::move(fd), 8, std::string_view{"test data from file"}.size());
+    response.SetStatus(server::http::HttpStatus::kOk);
+    constexpr std::string_view kBody = "test";
+    ASSERT_EQ(::truncate(file.GetPath().c_str(), 8 + kBody.size()), 0);
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::vector<char> buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+    std::string_view reply{buffer.data(), reply_size};
+    const auto expected_content_length = fmt::format("\r\n{}: {}\r\n", http::headers::kContentLength, kBody.size());
+    EXPECT_TRUE(reply.find(expected_content_length) != std::string_view::npos);
+
+    EXPECT_EQ(reply.substr(reply.size() - 4 - kBody.size()), fmt::format("\r\n\r\n{}", kBody));
+}
+
+UTEST(HttpResponse, StreamedBody) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    server::request::ResponseDataAccounter accounter;
+    auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    server::http::HttpResponse response{*request, accounter};
+    response.SetStatus(server::http::HttpStatus::kOk);
+    response.SetStreamBody();
+
+    {
+        // The chunks are ready before the headers are sent
+        auto producer = std::get<server::http::HttpResponse::Queue::Producer>(response.GetBodyProducer());
+        ASSERT_TRUE(producer.Push("abc", test_deadline));
+        ASSERT_TRUE(producer.Push("", test_deadline));
+        ASSERT_TRUE(producer.Push(std::string(17, 'x'), test_deadline));
+    }
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::vector<char> buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+    std::string_view reply{buffer.data(), reply_size};
+    constexpr std::string_view expected_header = "HTTP/1.1 200 OK\r\n";
+    ASSERT_EQ(reply.substr(0, expected_header.size()), expected_header);
+    const auto expected_encoding = fmt::format("\r\n{}: chunked\r\n", http::headers::kTransferEncoding);
+    EXPECT_TRUE(reply.find(expected_encoding) != std::string_view::npos);
+    EXPECT_EQ(reply.find(http::headers::kContentLength), std::string_view::npos);
+
+    const auto expected_body =
+        fmt::format("\r\n\r\n3\r\nabc\r\n11\r\n{}\r\n0\r\n\r\n", std::string(17, 'x'));
+    EXPECT_EQ(reply.substr(reply.size() - expected_body.size()), expected_body);
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
     auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
     const auto request = server::http::HttpRequestBuilder{*accounter}.Build();
@@ -1,10 +1,13 @@
 #include "multipart_form_data_parser.hpp"
 
+#include <string.h>
+
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <algorithm>
 #include <array>
 
 USERVER_NAMESPACE_BEGIN
@@ -247,38 +250,29 @@ bool ParseMultipartFormDataHeaders(std::string_view& body, FormDataArgInfo& arg_
     return SkipCrLf(body, crlf);
 }
 
-size_t FindBoundaryEnd(std::string_view body, std::string_view boundary, std::string_view crlf) {
-    size_t pos = 0;
-    while (pos < body.size()) {
-        if (body[pos] == crlf.front()) {
-            if (pos + crlf.size() < body.size() && body.substr(pos, crlf.size()) == crlf) {
-                pos += crlf.size();
-                if (pos < body.size() && body[pos] == '-') {
-                    ++pos;
-                    if (pos < body.size() && body[pos] == '-') {
-                        ++pos;
-                        size_t idx = 0;
-                        while (idx < boundary.size() && pos + idx < body.size() && body[pos + idx] == boundary[idx])
-                            ++idx;
-                        pos += idx;
-                        if (idx == boundary.size()) return pos;
-                    }
-                }
-            } else
-                ++pos;
-        } else
-            ++pos;
-    }
-    return std::string_view::npos;
+// The delimiter of the parts is `crlf--boundary`
+std::string MakeDelimiter(std::string_view crlf, std::string_view boundary) {
+    std::string delimiter;
+    delimiter.reserve(crlf.size() + 2 + boundary.size());
+    delimiter.append(crlf).append("--").append(boundary);
+    return delimiter;
+}
+
+// Returns the position right after the delimiter. The parts may be megabytes
+// long, and memmem is vectorized in the common libc implementations unlike a
+// byte-wise scan
+size_t FindBoundaryEnd(std::string_view body, std::string_view delimiter) {
+    const void* found = ::memmem(body.data(), body.size(), delimiter.data(), delimiter.size());
+    if (!found) return std::string_view::npos;
+    return static_cast<const char*>(found) - body.data() + delimiter.size();
 }
 
 bool ParseMultipartFormDataValue(
     std::string_view& body,
-    std::string_view boundary,
+    std::string_view delimiter,
     FormDataArgInfo&& arg_info,
     std::optional<std::string>& charset,
-    FormDataArgs& form_data_args,
-    std::string_view crlf
+    FormDataArgs& form_data_args
 ) {
     static const std::string kCharset = "_charset_";
 
@@ -287,12 +281,13 @@ bool ParseMultipartFormDataValue(
         return false;
     }
 
-    size_t pos = FindBoundaryEnd(body, boundary, crlf);
+    size_t pos = FindBoundaryEnd(body, delimiter);
     if (pos == std::string_view::npos) {
         LOG_WARNING() << "Unexpected end of form-data part value";
         return false;
     }
-    arg_info.arg.value = body.substr(0, pos - boundary.size() - 2 - crlf.size());
+    // The value references the request body, it is never copied
+    arg_info.arg.value = body.substr(0, pos - delimiter.size());
     if (arg_info.name == kCharset) {
         charset = arg_info.arg.value;
     } else {
@@ -313,14 +308,18 @@ bool ParseMultipartFormDataBody(
 ) {
     LOG_TRACE() << "body=" << body << ", body.size()=" << body.size();
     std::string_view crlf = "\r\n";
-    if (boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
-        body.substr(2, boundary.size()) == boundary) {
+    const bool starts_with_boundary = boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
+                                      body.substr(2, boundary.size()) == boundary;
+    if (starts_with_boundary) {
         body.remove_prefix(2 + boundary.size());
-        if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
     } else {
-        while (!body.empty() && body.front() != kCr && body.front() != kLf) body.remove_prefix(1);
-        if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
-        size_t pos = FindBoundaryEnd(body, boundary, crlf);
+        body.remove_prefix(std::min(body.find_first_of("\r\n"), body.size()));
+    }
+    if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
+    const auto delimiter = MakeDelimiter(crlf, boundary);
+
+    if (!starts_with_boundary) {
+        size_t pos = FindBoundaryEnd(body, delimiter);
         if (pos == std::string_view::npos) {
             LOG_WARNING() << "Unexpected request body end";
             return false;
@@ -362,7 +361,7 @@ bool ParseMultipartFormDataBody(
 
         if (!ParseMultipartFormDataHeaders(body, arg_info, crlf)) return false;
         LOG_TRACE() << "ParseMultipartFormDataHeaders finished, body=" << body << ", body.size()=" << body.size();
-        if (!ParseMultipartFormDataValue(body, boundary, std::move(arg_info), charset, form_data_args, crlf)) {
+        if (!ParseMultipartFormDataValue(body, delimiter, std::move(arg_info), charset, form_data_args)) {
             return false;
         }
     }
@@ -286,6 +286,29 @@ TEST(MultipartFormDataParser, NoFinalCrLf2) {
     EXPECT_TRUE(form_data_args.empty());
 }
 
+TEST(MultipartFormDataParser, ValueWithBoundaryPrefixes) {
+    namespace sh = server::http;
+    const std::string kContentType = "multipart/form-data; boundary=zzz";
+    const std::string kValue = "\r\n--zz\r\n-zzz\r\n--\r\nzzz--zzz\r\n";
+    const std::string kBody =
+        "--zzz\r\n"
+        "Content-Disposition: form-data; name=arg\r\n"
+        "\r\n" +
+        kValue +
+        "\r\n"
+        "--zzz--\r\n";
+
+    sh::FormDataArgs form_data_args;
+    ASSERT_TRUE(ParseMultipartFormData(kContentType, kBody, form_data_args));
+    ASSERT_EQ(form_data_args["arg"].size(), 1);
+
+    const auto value = form_data_args["arg"].front().value;
+    EXPECT_EQ(value, kValue);
+    // The value references the body without copying
+    EXPECT_GE(value.data(), kBody.data());
+    EXPECT_LE(value.data() + value.size(), kBody.data() + kBody.size());
+}
+
 TEST(MultipartFormDataParser, ParseNonUsAsciiCharsInHeaders) {
     namespace sh = server::http;
     const std::string kContentType = "multipart/form-data; Boundary=zzz";
@@ -0,0 +1,73 @@
+#include <server/http/request_body_stream_producer.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+RequestBodyStreamProducer::RequestBodyStreamProducer()
+    : queue_(RequestBodyStream::Queue::Create(kMaxBufferedSize)),
+      producer_(queue_->GetProducer()),
+      state_(std::make_shared<RequestBodyStreamState>()) {}
+
+RequestBodyStreamProducer::RequestBodyStreamProducer(
+    Http2StreamEventProducer&& window_producer,
+    std::int32_t stream_id
+)
+    : RequestBodyStreamProducer() {
+    state_->window_producer.emplace(std::move(window_producer));
+    state_->stream_id = stream_id;
+}
+
+RequestBodyStream RequestBodyStreamProducer::MakeStream() {
+    UASSERT(!is_stream_made_);
+    is_stream_made_ = true;
+    return RequestBodyStream{queue_->GetConsumer(), state_};
+}
+
+void RequestBodyStreamProducer::Append(std::string_view data) {
+    if (IsAborted()) return;
+    pending_.append(data);
+}
+
+void RequestBodyStreamProducer::SetReceived() { is_received_ = true; }
+
+bool RequestBodyStreamProducer::IsReceived() const { return is_received_; }
+
+bool RequestBodyStreamProducer::Flush(engine::Deadline deadline) {
+    if (!producer_) return state_->is_received;
+
+    // The queue is limited by the total size of the elements, so an element
+    // larger than kMaxBufferedSize would never fit
+    std::size_t offset = 0;
+    while (offset < pending_.size()) {
+        const auto size = std::min(kMaxChunkSize, pending_.size() - offset);
+        std::string chunk = offset == 0 && size == pending_.size() ? std::move(pending_) : pending_.substr(offset, size);
+        if (!producer_->Push(std::move(chunk), deadline)) {
+            Abort();
+            return false;
+        }
+        offset += size;
+    }
+    pending_.clear();
+
+    if (is_received_) {
+        state_->is_received = true;
+        producer_.reset();
+    }
+    return true;
+}
+
+void RequestBodyStreamProducer::Abort() noexcept {
+    pending_.clear();
+    producer_.reset();
+}
+
+bool RequestBodyStreamProducer::IsAborted() const noexcept { return !producer_ && !state_->is_received; }
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
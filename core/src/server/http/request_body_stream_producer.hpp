@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/server/http/http_request_body_stream.hpp>
+#include <userver/server/request/response_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+struct RequestBodyStreamState final {
+    // Set by the connection before the end of the body is signalled
+    std::atomic<bool> is_received{false};
+
+    // HTTP/2 only, the consumed bytes are reported back to the session to
+    // extend the flow-control window of the stream
+    std::optional<Http2StreamEventProducer> window_producer;
+    std::int32_t stream_id{-1};
+};
+
+/// Connection side of the RequestBodyStream. All the methods are called from
+/// the connection task.
+class RequestBodyStreamProducer final {
+public:
+    /// Max bytes buffered for the handler, the connection stops reading the
+    /// body until the handler catches up
+    static constexpr std::size_t kMaxBufferedSize = 256 * 1024;
+    static constexpr std::size_t kMaxChunkSize = 64 * 1024;
+
+    RequestBodyStreamProducer();
+
+    /// HTTP/2 stream, see RequestBodyStreamState::window_producer
+    RequestBodyStreamProducer(Http2StreamEventProducer&& window_producer, std::int32_t stream_id);
+
+    RequestBodyStreamProducer(const RequestBodyStreamProducer&) = delete;
+    RequestBodyStreamProducer& operator=(const RequestBodyStreamProducer&) = delete;
+
+    /// Must be called exactly once
+    RequestBodyStream MakeStream();
+
+    /// Buffers the parsed body data, never blocks
+    void Append(std::string_view data);
+
+    /// The whole body was parsed
+    void SetReceived();
+
+    /// Body was parsed completely, though it may be not flushed yet
+    bool IsReceived() const;
+
+    /// Pushes the buffered data to the handler, waits while the handler lags
+    /// behind. Signals the end of the body if the whole body was flushed.
+    /// @returns false if the handler does not read the body anymore, if the
+    /// body was aborted or on deadline/cancellation; the body is aborted then
+    bool Flush(engine::Deadline deadline);
+
+    /// The body would never be complete, e.g. the client has gone
+    void Abort() noexcept;
+
+    /// Appended data is discarded after the Abort()
+    bool IsAborted() const noexcept;
+
+private:
+    std::shared_ptr<RequestBodyStream::Queue> queue_;
+    std::optional<RequestBodyStream::Queue::Producer> producer_;
+    std::shared_ptr<RequestBodyStreamState> state_;
+    std::string pending_;
+    bool is_received_{false};
+    bool is_stream_made_{false};
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
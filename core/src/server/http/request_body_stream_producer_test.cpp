@@ -0,0 +1,127 @@
+#include <server/http/request_body_stream_producer.hpp>
+
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Producer = server::http::impl::RequestBodyStreamProducer;
+
+std::string ReadAll(server::http::RequestBodyStream& stream) {
+    std::string body;
+    std::string chunk;
+    while (stream.ReadChunk(chunk)) {
+        EXPECT_LE(chunk.size(), Producer::kMaxChunkSize);
+        body += chunk;
+    }
+    return body;
+}
+
+}  // namespace
+
+UTEST(RequestBodyStream, Simple) {
+    Producer producer;
+    auto stream = producer.MakeStream();
+
+    producer.Append("first ");
+    producer.Append("second");
+    producer.SetReceived();
+    EXPECT_TRUE(producer.IsReceived());
+    ASSERT_TRUE(producer.Flush({}));
+
+    EXPECT_EQ(ReadAll(stream), "first second");
+    EXPECT_TRUE(stream.IsComplete());
+}
+
+UTEST(RequestBodyStream, Empty) {
+    Producer producer;
+    auto stream = producer.MakeStream();
+
+    producer.SetReceived();
+    ASSERT_TRUE(producer.Flush({}));
+
+    EXPECT_EQ(ReadAll(stream), "");
+    EXPECT_TRUE(stream.IsComplete());
+}
+
+UTEST(RequestBodyStream, Backpressure) {
+    constexpr std::size_t kBodySize = 4 * Producer::kMaxBufferedSize + 1;
+    Producer producer;
+    auto stream = producer.MakeStream();
+
+    auto reader = engine::AsyncNoSpan([&stream] { return ReadAll(stream); });
+
+    std::string expected;
+    for (std::size_t i = 0; expected.size() < kBodySize; ++i) {
+        const std::string part(Producer::kMaxChunkSize / 3, static_cast<char>('a' + i % 26));
+        producer.Append(part);
+        expected += part;
+        ASSERT_TRUE(producer.Flush({}));
+    }
+    producer.SetReceived();
+    ASSERT_TRUE(producer.Flush({}));
+
+    EXPECT_EQ(reader.Get(), expected);
+    EXPECT_TRUE(stream.IsComplete());
+}
+
+UTEST(RequestBodyStream, FlushBlocksUntilRead) {
+    Producer producer;
+    auto stream = producer.MakeStream();
+
+    producer.Append(std::string(2 * Producer::kMaxBufferedSize, 'x'));
+    EXPECT_FALSE(producer.Flush(engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+    // Flush failure aborts the body
+    EXPECT_TRUE(producer.IsAborted());
+
+    std::string chunk;
+    std::size_t read_size = 0;
+    while (stream.ReadChunk(chunk)) read_size += chunk.size();
+    EXPECT_GE(read_size, Producer::kMaxBufferedSize);
+    EXPECT_LT(read_size, 2 * Producer::kMaxBufferedSize);
+    EXPECT_FALSE(stream.IsComplete());
+}
+
+UTEST(RequestBodyStream, Abort) {
+    Producer producer;
+    auto stream = producer.MakeStream();
+
+    producer.Append("partial");
+    ASSERT_TRUE(producer.Flush({}));
+    producer.Abort();
+    producer.Append("ignored");
+
+    EXPECT_EQ(ReadAll(stream), "partial");
+    EXPECT_FALSE(stream.IsComplete());
+}
+
+UTEST(RequestBodyStream, ReaderGone) {
+    Producer producer;
+    {
+        [[maybe_unused]] auto stream = producer.MakeStream();
+    }
+
+    producer.Append("body");
+    EXPECT_FALSE(producer.Flush({}));
+}
+
+UTEST(RequestBodyStream, ReadDeadline) {
+    Producer producer;
+    auto stream = producer.MakeStream();
+
+    std::string chunk;
+    EXPECT_FALSE(stream.ReadChunk(chunk, engine::Deadline::FromDuration(std::chrono::milliseconds{1})));
+    EXPECT_FALSE(stream.IsComplete());
+
+    producer.Append("body");
+    producer.SetReceived();
+    ASSERT_TRUE(producer.Flush({}));
+    EXPECT_EQ(ReadAll(stream), "body");
+    EXPECT_TRUE(stream.IsComplete());
+}
+
+USERVER_NAMESPACE_END
@@ -15,6 +15,8 @@ class RequestHandlerBase {
 public:
     virtual ~RequestHandlerBase() noexcept;
 
+    /// Returns an invalid task if the request was processed synchronously in
+    /// the current task, e.g. for the handlers with `run-inline: true`
     virtual engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<http::HttpRequest> request) const = 0;
 
     virtual const HandlerInfoIndex& GetHandlerInfoIndex() const = 0;
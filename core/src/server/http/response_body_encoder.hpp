@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// Encodes the chunks of a streamed response body, e.g. compresses them
+class ResponseBodyEncoder {
+public:
+    virtual ~ResponseBodyEncoder() = default;
+
+    /// Value for the Content-Encoding header
+    virtual std::string_view GetContentEncoding() const noexcept = 0;
+
+    /// Encodes the next chunk; the result is decodable by the peer as is
+    virtual std::string Encode(std::string_view chunk) = 0;
+
+    /// Returns the tail of the encoded body
+    virtual std::string Finish() = 0;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,11 @@
 #include <server/middlewares/baggage.hpp>
 
 #include <server/request/internal_request_context.hpp>
+#include <server/request/task_inherited_request_impl.hpp>
 
 #include <userver/baggage/baggage.hpp>
 #include <userver/baggage/baggage_settings.hpp>
+#include <userver/baggage/lazy_baggage.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -15,11 +17,19 @@ namespace server::middlewares {
 
 void SetUpBaggage(const http::HttpRequest& http_request, const dynamic_config::Snapshot& config_snapshot) {
     if (config_snapshot[baggage::kBaggageEnabled]) {
-        auto baggage_header = http_request.GetHeader(USERVER_NAMESPACE::http::headers::kXBaggage);
+        const auto& baggage_header = http_request.GetHeader(USERVER_NAMESPACE::http::headers::kXBaggage);
         if (!baggage_header.empty()) {
             LOG_DEBUG() << "Got baggage header: " << baggage_header;
+
+            // The header is parsed only if the handler makes outgoing requests
+            const auto* inherited_request = request::kTaskInheritedRequest.GetOptional();
+            if (inherited_request && inherited_request->get() == &http_request) {
+                baggage::impl::kLazyInheritedBaggage.Emplace(*inherited_request, baggage_header, config_snapshot);
+                return;
+            }
+
             const auto& baggage_settings = config_snapshot[baggage::kBaggageSettings];
-            auto baggage = baggage::TryMakeBaggage(std::move(baggage_header), baggage_settings.allowed_keys);
+            auto baggage = baggage::TryMakeBaggage(baggage_header, baggage_settings.allowed_keys);
             if (baggage) {
                 baggage::kInheritedBaggage.Set(std::move(*baggage));
             }
@@ -0,0 +1,272 @@
+#include <server/middlewares/compression.hpp>
+
+#include <server/http/response_body_encoder.hpp>
+#include <server/request/internal_request_context.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/server/request/request_context.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr utils::TrivialBiMap kContentEncodingMap([](auto selector) {
+    return selector()
+        .Case(ContentEncoding::kIdentity, "identity")
+        .Case(ContentEncoding::kGzip, "gzip")
+        .Case(ContentEncoding::kZstd, "zstd");
+});
+
+template <typename Compressor, ContentEncoding Encoding>
+class CompressingBodyEncoder final : public http::impl::ResponseBodyEncoder {
+public:
+    explicit CompressingBodyEncoder(int level) : compressor_(level) {}
+
+    std::string_view GetContentEncoding() const noexcept override { return ToString(Encoding); }
+
+    std::string Encode(std::string_view chunk) override { return compressor_.Compress(chunk); }
+
+    std::string Finish() override { return compressor_.Finish(); }
+
+private:
+    Compressor compressor_;
+};
+
+using GzipBodyEncoder = CompressingBodyEncoder<USERVER_NAMESPACE::compression::gzip::StreamCompressor, ContentEncoding::kGzip>;
+using ZstdBodyEncoder = CompressingBodyEncoder<USERVER_NAMESPACE::compression::zstd::StreamCompressor, ContentEncoding::kZstd>;
+
+// Responses with these statuses have no body, see RFC 9110, 6.4.1.
+bool MayHaveBody(http::HttpStatus status) {
+    const auto code = static_cast<int>(status);
+    return code >= 200 && status != http::HttpStatus::kNoContent && status != http::HttpStatus::kNotModified;
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+    constexpr std::string_view kAcceptEncoding = "Accept-Encoding";
+    const auto& vary = response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+    if (vary.empty()) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{kAcceptEncoding});
+        return;
+    }
+
+    for (const auto value : utils::text::SplitIntoStringViewVector(vary, ",")) {
+        const auto trimmed = utils::text::Trim(std::string{value});
+        if (trimmed == "*" || utils::StrIcaseEqual{}(trimmed, kAcceptEncoding)) return;
+    }
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, fmt::format("{}, {}", vary, kAcceptEncoding));
+}
+
+struct AcceptedCoding final {
+    std::string name;
+    double quality{1.0};
+};
+
+std::vector<AcceptedCoding> ParseAcceptEncoding(std::string_view accept_encoding) {
+    std::vector<AcceptedCoding> result;
+    for (const auto item : utils::text::SplitIntoStringViewVector(accept_encoding, ",")) {
+        const auto params = utils::text::SplitIntoStringViewVector(item, ";");
+        AcceptedCoding coding{utils::text::Trim(std::string{params.front()})};
+        if (coding.name.empty()) continue;
+
+        for (std::size_t i = 1; i < params.size(); ++i) {
+            const auto param = utils::text::Trim(std::string{params[i]});
+            if (param.size() > 2 && (param[0] == 'q' || param[0] == 'Q') && param[1] == '=') {
+                try {
+                    coding.quality = utils::FromString<double>(param.substr(2));
+                } catch (const std::exception&) {
+                    coding.quality = 0.0;
+                }
+            }
+        }
+        result.push_back(std::move(coding));
+    }
+    return result;
+}
+
+}  // namespace
+
+std::string_view ToString(ContentEncoding encoding) {
+    const auto result = kContentEncodingMap.TryFindByFirst(encoding);
+    UASSERT(result);
+    return result.value_or("identity");
+}
+
+ContentEncoding Parse(const yaml_config::YamlConfig& value, formats::parse::To<ContentEncoding>) {
+    return utils::ParseFromValueString(value, kContentEncodingMap);
+}
+
+ContentEncoding ChooseContentEncoding(std::string_view accept_encoding, const std::vector<ContentEncoding>& supported) {
+    if (accept_encoding.empty()) return ContentEncoding::kIdentity;
+
+    const auto accepted = ParseAcceptEncoding(accept_encoding);
+
+    const auto get_quality = [&accepted](std::string_view name) {
+        std::optional<double> wildcard_quality;
+        for (const auto& coding : accepted) {
+            if (utils::StrIcaseEqual{}(coding.name, name)) return coding.quality;
+            if (coding.name == "*") wildcard_quality = coding.quality;
+        }
+        return wildcard_quality.value_or(0.0);
+    };
+
+    auto best = ContentEncoding::kIdentity;
+    double best_quality = 0.0;
+    for (const auto encoding : supported) {
+        const auto quality = get_quality(ToString(encoding));
+        if (quality > best_quality) {
+            best = encoding;
+            best_quality = quality;
+        }
+    }
+    return best;
+}
+
+Compression::Compression(const CompressionSettings& settings, bool enabled) : settings_(settings), enabled_(enabled) {}
+
+void Compression::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    if (!enabled_) {
+        Next(request, context);
+        return;
+    }
+
+    const auto encoding =
+        ChooseContentEncoding(request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding), settings_.encodings);
+    if (encoding == ContentEncoding::kIdentity) {
+        Next(request, context);
+        return;
+    }
+
+    auto& response = request.GetHttpResponse();
+    if (response.IsBodyStreamed()) {
+        // Chunks are compressed one by one as the handler pushes them
+        AddVaryAcceptEncoding(response);
+        context.GetInternalContext().SetResponseBodyEncoder(MakeEncoder(encoding));
+        Next(request, context);
+        return;
+    }
+
+    Next(request, context);
+    CompressResponse(response, encoding);
+}
+
+void Compression::CompressResponse(http::HttpResponse& response, ContentEncoding encoding) const {
+    if (!MayHaveBody(response.GetStatus())) return;
+
+    AddVaryAcceptEncoding(response);
+    if (response.GetData().size() < settings_.min_body_size ||
+        response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+        return;
+    }
+
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_compress_response_body");
+    try {
+        switch (encoding) {
+            case ContentEncoding::kGzip:
+                response.SetData(USERVER_NAMESPACE::compression::gzip::Compress(response.GetData(), settings_.gzip_level));
+                break;
+            case ContentEncoding::kZstd:
+                response.SetData(USERVER_NAMESPACE::compression::zstd::Compress(response.GetData(), settings_.zstd_level));
+                break;
+            case ContentEncoding::kIdentity:
+                return;
+        }
+        response.SetContentEncoding(std::string{ToString(encoding)});
+    } catch (const std::exception& ex) {
+        // Sending the body as is is better than failing the request
+        LOG_ERROR() << "Failed to compress the response body with " << ToString(encoding) << ": " << ex;
+    }
+}
+
+std::unique_ptr<http::impl::ResponseBodyEncoder> Compression::MakeEncoder(ContentEncoding encoding) const {
+    switch (encoding) {
+        case ContentEncoding::kGzip:
+            return std::make_unique<GzipBodyEncoder>(settings_.gzip_level);
+        case ContentEncoding::kZstd:
+            return std::make_unique<ZstdBodyEncoder>(settings_.zstd_level);
+        case ContentEncoding::kIdentity:
+            break;
+    }
+    return nullptr;
+}
+
+CompressionFactory::CompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase(config, context) {
+    settings_.encodings = config["encodings"].As<std::vector<ContentEncoding>>(settings_.encodings);
+    settings_.min_body_size = config["min-body-size"].As<std::size_t>(settings_.min_body_size);
+    settings_.gzip_level = config["gzip-level"].As<int>(settings_.gzip_level);
+    settings_.zstd_level = config["zstd-level"].As<int>(settings_.zstd_level);
+}
+
+std::unique_ptr<HttpMiddlewareBase>
+CompressionFactory::Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const {
+    return std::make_unique<Compression>(settings_, middleware_config["enabled"].As<bool>(true));
+}
+
+yaml_config::Schema CompressionFactory::GetMiddlewareConfigSchema() const {
+    return formats::yaml::FromString(R"(
+type: object
+description: per-handler response compression settings
+additionalProperties: false
+properties:
+    enabled:
+        type: boolean
+        description: set to false to never compress responses of the handler
+        defaultDescription: true
+)")
+        .As<yaml_config::Schema>();
+}
+
+yaml_config::Schema CompressionFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<HttpMiddlewareFactoryBase>(R"(
+type: object
+description: Http server response compression middleware
+additionalProperties: false
+properties:
+    encodings:
+        type: array
+        description: supported content codings in the order of preference
+        defaultDescription: '[zstd, gzip]'
+        items:
+            type: string
+            description: content coding
+            enum:
+              - gzip
+              - zstd
+    min-body-size:
+        type: integer
+        description: |
+            responses with smaller bodies are sent uncompressed. Streamed
+            responses are always compressed, as their size is not known
+            in advance
+        defaultDescription: 1024
+    gzip-level:
+        type: integer
+        description: zlib compression level, 1-9
+        defaultDescription: 6
+    zstd-level:
+        type: integer
+        description: zstd compression level
+        defaultDescription: 3
+)");
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::http::impl {
+class ResponseBodyEncoder;
+}
+
+namespace server::middlewares {
+
+enum class ContentEncoding {
+    kIdentity,
+    kGzip,
+    kZstd,
+};
+
+std::string_view ToString(ContentEncoding encoding);
+
+ContentEncoding Parse(const yaml_config::YamlConfig& value, formats::parse::To<ContentEncoding>);
+
+/// Chooses the best encoding from `supported` (in server preference order)
+/// according to the Accept-Encoding header value, see RFC 9110, 12.5.3.
+ContentEncoding ChooseContentEncoding(std::string_view accept_encoding, const std::vector<ContentEncoding>& supported);
+
+struct CompressionSettings final {
+    // In the order of server preference
+    std::vector<ContentEncoding> encodings{ContentEncoding::kZstd, ContentEncoding::kGzip};
+    std::size_t min_body_size{1024};
+    int gzip_level{USERVER_NAMESPACE::compression::gzip::kDefaultLevel};
+    int zstd_level{USERVER_NAMESPACE::compression::zstd::kDefaultLevel};
+};
+
+class Compression final : public HttpMiddlewareBase {
+public:
+    static constexpr std::string_view kName = builtin::kCompression;
+
+    Compression(const CompressionSettings& settings, bool enabled);
+
+private:
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    void CompressResponse(http::HttpResponse& response, ContentEncoding encoding) const;
+
+    std::unique_ptr<http::impl::ResponseBodyEncoder> MakeEncoder(ContentEncoding encoding) const;
+
+    const CompressionSettings& settings_;
+    const bool enabled_;
+};
+
+class CompressionFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = Compression::kName;
+
+    CompressionFactory(const components::ComponentConfig&, const components::ComponentContext&);
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    std::unique_ptr<HttpMiddlewareBase>
+    Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const override;
+
+    CompressionSettings settings_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::CompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::CompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
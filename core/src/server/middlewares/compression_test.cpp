@@ -0,0 +1,36 @@
+#include <server/middlewares/compression.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::middlewares::ChooseContentEncoding;
+using server::middlewares::ContentEncoding;
+
+const std::vector<ContentEncoding> kSupported{ContentEncoding::kZstd, ContentEncoding::kGzip};
+
+}  // namespace
+
+TEST(CompressionMiddleware, ChooseContentEncoding) {
+    EXPECT_EQ(ChooseContentEncoding("", kSupported), ContentEncoding::kIdentity);
+    EXPECT_EQ(ChooseContentEncoding("identity", kSupported), ContentEncoding::kIdentity);
+    EXPECT_EQ(ChooseContentEncoding("br", kSupported), ContentEncoding::kIdentity);
+
+    EXPECT_EQ(ChooseContentEncoding("gzip", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(ChooseContentEncoding("GZip", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(ChooseContentEncoding("gzip, deflate, br, zstd", kSupported), ContentEncoding::kZstd);
+    EXPECT_EQ(ChooseContentEncoding("gzip;q=1.0, zstd;q=0.5", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(ChooseContentEncoding("zstd;q=0, gzip", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(ChooseContentEncoding("gzip;q=0, zstd;q=0", kSupported), ContentEncoding::kIdentity);
+
+    EXPECT_EQ(ChooseContentEncoding("*", kSupported), ContentEncoding::kZstd);
+    EXPECT_EQ(ChooseContentEncoding("zstd;q=0, *", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(ChooseContentEncoding("*;q=0", kSupported), ContentEncoding::kIdentity);
+
+    EXPECT_EQ(ChooseContentEncoding("gzip, zstd", {ContentEncoding::kGzip}), ContentEncoding::kGzip);
+    EXPECT_EQ(ChooseContentEncoding("gzip;q=abc", kSupported), ContentEncoding::kIdentity);
+}
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
@@ -67,6 +68,7 @@ components::ComponentList DefaultMiddlewareComponents() {
         .Append<AuthFactory>()
         .Append<DeadlinePropagationFactory>()
         .Append<DecompressionFactory>()
+        .Append<CompressionFactory>()
         .Append<SetAcceptEncodingFactory>()
         .Append<ExceptionsHandlingFactory>()
         .Append<UnknownExceptionsHandlingFactory>()
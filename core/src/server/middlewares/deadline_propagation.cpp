@@ -1,5 +1,8 @@
 #include <server/middlewares/deadline_propagation.hpp>
 
+#include <fmt/format.h>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
 #include <server/request/internal_request_context.hpp>
 
@@ -70,6 +73,8 @@ struct DeadlinePropagation::RequestScope final {
         : config_snapshot{context.GetConfigSnapshot()}, shared_dp_context{context.GetDPContext()} {}
 
     bool need_log_response{false};
+    // The deadline of the request, the propagated one may be earlier
+    engine::Deadline deadline;
     const dynamic_config::Snapshot& config_snapshot;
     request::impl::DeadlinePropagationContext& shared_dp_context;
 };
@@ -78,6 +83,9 @@ DeadlinePropagation::DeadlinePropagation(const handlers::HttpHandlerBase& handle
     : handler_{handler},
       deadline_propagation_enabled_{handler_.GetConfig().deadline_propagation_enabled},
       deadline_expired_status_code_{handler_.GetConfig().deadline_expired_status_code},
+      cancel_by_deadline_allowed_{!handler_.GetConfig().run_inline},
+      early_rejection_enabled_{handler_.GetConfig().deadline_early_rejection_enabled},
+      propagation_reserve_{handler_.GetConfig().deadline_propagation_reserve},
       path_{GetHandlerPath(handler_)} {}
 
 void DeadlinePropagation::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
@@ -158,13 +166,37 @@ void DeadlinePropagation::SetupInheritedDeadline(
 
     const auto deadline = engine::Deadline::FromTimePoint(request.GetStartTime() + *timeout);
     inherited_data.deadline = deadline;
+    dp_scope.deadline = deadline;
 
     if (deadline.IsSurelyReachedApprox()) {
         HandleDeadlineExpired(request, dp_scope, "Immediate timeout (deadline propagation)");
         return;
     }
 
-    if (config_snapshot[handlers::kCancelHandleRequestByDeadline]) {
+    if (early_rejection_enabled_) {
+        const auto median_timing =
+            handler_.GetHandlerStatistics().GetByMethod(request.GetMethod()).GetMedianTimingApprox();
+        if (median_timing && deadline.TimeLeftApprox() < *median_timing) {
+            HandleDeadlineExpired(
+                request,
+                dp_scope,
+                fmt::format(
+                    "Early timeout, less time left than the median handling time of {}ms (deadline propagation)",
+                    median_timing->count()
+                )
+            );
+            return;
+        }
+    }
+
+    if (propagation_reserve_.count() > 0) {
+        inherited_data.deadline =
+            engine::Deadline::FromTimePoint(request.GetStartTime() + *timeout - propagation_reserve_);
+    }
+
+    // Inline handlers run in the connection task, cancelling it would close the
+    // connection
+    if (cancel_by_deadline_allowed_ && config_snapshot[handlers::kCancelHandleRequestByDeadline]) {
         engine::current_task::SetDeadline(deadline);
     }
 }
@@ -205,11 +237,15 @@ void DeadlinePropagation::CompleteDeadlinePropagation(
         return;
     }
 
-    if (!inherited_data->deadline.IsReachable()) return;
+    if (!dp_scope.deadline.IsReachable()) return;
 
+    // With a reserve the downstream calls time out before the request deadline,
+    // and the handler still has time to respond
+    const bool propagated_deadline_expired =
+        propagation_reserve_.count() == 0 && inherited_data->deadline_signal.IsExpired();
     const bool cancelled_by_deadline =
         engine::current_task::CancellationReason() == engine::TaskCancellationReason::kDeadline ||
-        inherited_data->deadline_signal.IsExpired() || inherited_data->deadline.IsReached();
+        propagated_deadline_expired || dp_scope.deadline.IsReached();
 
     auto* span_opt = tracing::Span::CurrentSpanUnchecked();
     if (span_opt) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <userver/dynamic_config/source.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/server/middlewares/builtin.hpp>
@@ -44,6 +46,9 @@ private:
     const handlers::HttpHandlerBase& handler_;
     const bool deadline_propagation_enabled_;
     const http::HttpStatus deadline_expired_status_code_;
+    const bool cancel_by_deadline_allowed_;
+    const bool early_rejection_enabled_;
+    const std::chrono::milliseconds propagation_reserve_;
     const std::string path_;
 };
 
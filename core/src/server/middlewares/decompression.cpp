@@ -17,7 +17,8 @@ namespace server::middlewares {
 
 namespace {
 bool GetDecompressRequestFromHandlerSettings(const handlers::HttpHandlerBase& handler) {
-    return handler.GetConfig().decompress_request;
+    // The streamed body is passed to the handler as is
+    return handler.GetConfig().decompress_request && !handler.GetConfig().request_body_stream;
 }
 }  // namespace
 
@@ -1,6 +1,7 @@
 #include <userver/server/middlewares/headers_propagator.hpp>
 
 #include <server/request/internal_request_context.hpp>
+#include <server/request/task_inherited_request_impl.hpp>
 
 #include <userver/components/component_config.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -16,6 +17,14 @@ HeadersPropagator::HeadersPropagator(const handlers::HttpHandlerBase&, std::vect
     : headers_(std::move(headers)) {}
 
 void HeadersPropagator::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    // The values are copied only if the handler makes outgoing requests
+    const auto* inherited_request = USERVER_NAMESPACE::server::request::kTaskInheritedRequest.GetOptional();
+    if (inherited_request && inherited_request->get() == &request) {
+        USERVER_NAMESPACE::server::request::SetLazyPropagatedHeaders(*inherited_request, headers_);
+        Next(request, context);
+        return;
+    }
+
     USERVER_NAMESPACE::server::request::HeadersToPropagate headers_to_propagate;
     for (const auto& header_name : headers_) {
         const auto* header_value = utils::FindOrNullptr(request.GetHeaders(), header_name);
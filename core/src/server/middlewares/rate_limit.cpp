@@ -12,7 +12,7 @@ USERVER_NAMESPACE_BEGIN
 namespace server::middlewares {
 
 RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
-    : rate_limit_{utils::TokenBucket::MakeUnbounded()},
+    : rate_limit_{utils::StripedTokenBucket::MakeUnbounded()},
       statistics_{handler.GetHandlerStatistics()},
       max_requests_per_second_{handler.GetConfig().max_requests_per_second},
       max_requests_in_flight_{handler.GetConfig().max_requests_in_flight},
@@ -21,14 +21,21 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
         const auto max_rps = *max_requests_per_second_;
         UASSERT_MSG(max_rps > 0, "max_requests_per_second option was not verified in config parsing");
         rate_limit_.SetMaxSize(max_rps);
-        rate_limit_.SetRefillPolicy({1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / max_rps});
+        rate_limit_.SetRefillPolicy({1, utils::StripedTokenBucket::Duration{std::chrono::seconds(1)} / max_rps});
+    }
+    if (max_requests_in_flight_.has_value()) {
+        in_flight_limit_.emplace(*max_requests_in_flight_);
     }
 }
 
 void RateLimit::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
-    if (CheckRateLimit(request)) {
-        Next(request, context);
-    }
+    if (!CheckRateLimit(request)) return;
+
+    // Held until the request is processed by the rest of the pipeline
+    const auto in_flight_lock = TryLockInFlight(request);
+    if (in_flight_limit_ && !in_flight_lock) return;
+
+    Next(request, context);
 }
 
 bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
@@ -49,24 +56,29 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
         return false;
     }
 
-    auto max_requests_in_flight = max_requests_in_flight_;
-    auto requests_in_flight = statistics.GetInFlight();
-    if (max_requests_in_flight && (requests_in_flight > *max_requests_in_flight)) {
+    return true;
+}
+
+std::shared_lock<engine::ShardedSemaphore> RateLimit::TryLockInFlight(const http::HttpRequest& request) const {
+    if (!in_flight_limit_) return {};
+
+    std::shared_lock lock{*in_flight_limit_, std::try_to_lock};
+    if (!lock) {
+        UASSERT(max_requests_in_flight_);
+
         auto& http_response = request.GetHttpResponse();
-        auto log_reason = fmt::format("reached max_requests_in_flight={}", *max_requests_in_flight);
+        auto log_reason = fmt::format("reached max_requests_in_flight={}", max_requests_in_flight_.value_or(0));
         SetThrottleReason(
             http_response,
             std::move(log_reason),
             std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kInFlight}
         );
 
-        statistics.IncrementTooManyRequestsInFlight();
+        statistics_.ForMethod(request.GetMethod()).IncrementTooManyRequestsInFlight();
 
         FailProcessingAndSetResponse(request);
-        return false;
     }
-
-    return true;
+    return lock;
 }
 
 void RateLimit::FailProcessingAndSetResponse(const http::HttpRequest& request) const {
@@ -2,9 +2,10 @@
 
 #include <optional>
 
+#include <userver/engine/sharded_semaphore.hpp>
 #include <userver/server/middlewares/builtin.hpp>
 #include <userver/server/middlewares/http_middleware_base.hpp>
-#include <userver/utils/token_bucket.hpp>
+#include <userver/utils/striped_token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -25,13 +26,16 @@ private:
 
     bool CheckRateLimit(const http::HttpRequest& request) const;
 
+    std::shared_lock<engine::ShardedSemaphore> TryLockInFlight(const http::HttpRequest& request) const;
+
     void FailProcessingAndSetResponse(const http::HttpRequest& request) const;
 
-    mutable utils::TokenBucket rate_limit_;
+    mutable utils::StripedTokenBucket rate_limit_;
     handlers::HttpHandlerStatistics& statistics_;
 
     std::optional<std::size_t> max_requests_per_second_;
     std::optional<std::size_t> max_requests_in_flight_;
+    mutable std::optional<engine::ShardedSemaphore> in_flight_limit_;
 
     const handlers::HttpHandlerBase& handler_;
 };
@@ -39,7 +39,8 @@ Connection::Connection(
     const engine::io::Sockaddr& remote_address,
     const http::RequestHandlerBase& request_handler,
     std::shared_ptr<Stats> stats,
-    request::ResponseDataAccounter& data_accounter
+    request::ResponseDataAccounter& data_accounter,
+    std::shared_ptr<ReadBufferPool> read_buffer_pool
 )
     : config_(config),
       handler_defaults_config_(handler_defaults_config),
@@ -48,7 +49,8 @@ Connection::Connection(
       stats_(std::move(stats)),
       data_accounter_(data_accounter),
       remote_address_(remote_address),
-      peer_name_(remote_address_.PrimaryAddressString()) {
+      peer_name_(remote_address_.PrimaryAddressString()),
+      read_buffer_pool_(std::move(read_buffer_pool)) {
     LOG_DEBUG() << "Incoming connection from " << Getpeername() << ", fd " << Fd();
 
     ++stats_->active_connections;
@@ -79,6 +81,7 @@ void Connection::Shutdown() noexcept {
                 << Fd();
 
     peer_socket_.reset();
+    pending_data_.Release();
 
     --stats_->active_connections;
     ++stats_->connections_closed;
@@ -91,43 +94,47 @@ void Connection::ListenForRequests() noexcept {
             parser_ = MakeParser(HttpVersion::k11);
         }
 
-        pending_data_.resize(config_.in_buffer_size);
+        if (!read_buffer_pool_) pending_data_ = ReadBuffer{config_.in_buffer_size};
         std::string http_version_buffer;
         http_version_buffer.reserve(kPrefaceBegin.size());
-        while (is_accepting_requests_) {
-            auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
+        while (is_accepting_requests_ || !pending_requests_.empty()) {
+            bool should_stop_accepting_requests = false;
 
-            if (pending_data_size_ == 0) {
-                if (!WaitOnSocket(deadline)) {
-                    return;
+            // Requests parsed while reading a streamed request body are
+            // processed without waiting for more data
+            if (pending_requests_.empty()) {
+                auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
+
+                if (pending_data_size_ == 0) {
+                    if (!WaitOnSocket(deadline)) {
+                        return;
+                    }
                 }
-            }
 
-            bool should_stop_accepting_requests = false;
-            bool res = false;
-            const std::string_view req{pending_data_.data(), pending_data_size_};
-            if (config_.http_version == HttpVersion::k2) {
-                if (parser_ || TryDetectHttpVersion(http_version_buffer, req)) {
+                bool res = false;
+                const std::string_view req{pending_data_.data(), pending_data_size_};
+                if (config_.http_version == HttpVersion::k2) {
+                    if (parser_ || TryDetectHttpVersion(http_version_buffer, req)) {
+                        res = parser_->Parse(req);
+                    } else {
+                        // We have to wait next bytes to detect the version
+                        res = true;
+                    }
+                } else {  // Pure HTTP/1.1
                     res = parser_->Parse(req);
-                } else {
-                    // We have to wait next bytes to detect the version
-                    res = true;
                 }
-            } else {  // Pure HTTP/1.1
-                res = parser_->Parse(req);
-            }
-            if (!res) {
-                LOG_DEBUG() << "Malformed request from " << Getpeername() << " on fd " << Fd();
+                if (!res) {
+                    LOG_DEBUG() << "Malformed request from " << Getpeername() << " on fd " << Fd();
 
-                // Stop accepting new requests, send previous answers.
-                should_stop_accepting_requests = true;
+                    // Stop accepting new requests, send previous answers.
+                    should_stop_accepting_requests = true;
+                }
+                pending_data_size_ = 0;
             }
-            pending_data_size_ = 0;
 
-            for (auto&& request : pending_requests_) {
-                ProcessRequest(std::move(request));
-            }
-            pending_requests_.resize(0);
+            processing_requests_.swap(pending_requests_);
+            ProcessRequests();
+            processing_requests_.resize(0);
             if (should_stop_accepting_requests) is_accepting_requests_ = false;
         }
 
@@ -148,8 +155,11 @@ void Connection::ListenForRequests() noexcept {
 }
 
 bool Connection::WaitOnSocket(engine::Deadline deadline) {
+    // Nothing is buffered, so the buffer is not needed while we wait
+    ReleaseIdleReadBuffer();
+
     bool is_readable = true;
-    if (pending_data_size_ != pending_data_.size()) {
+    if (pending_data_size_ != config_.in_buffer_size) {
         if (is_http2_parser_) {
             UASSERT(dynamic_cast<http::Http2Session*>(parser_.get()));
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
@@ -185,7 +195,12 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
             is_readable = peer_socket_->WaitReadable(deadline);
         }
     }
-    pending_data_size_ = is_readable ? peer_socket_->ReadSome(pending_data_.data(), pending_data_.size(), deadline) : 0;
+    if (is_readable) {
+        AcquireReadBuffer();
+        pending_data_size_ = peer_socket_->ReadSome(pending_data_.data(), pending_data_.size(), deadline);
+    } else {
+        pending_data_size_ = 0;
+    }
     if (!pending_data_size_) {
         LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
                     << " closed connection or the connection timed out";
@@ -203,24 +218,73 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
     return true;
 }
 
-void Connection::ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr) {
-    if (request_ptr->IsFinal()) {
-        is_accepting_requests_ = false;
+void Connection::ProcessRequests() {
+    const utils::FastScopeGuard clear_guard{[this]() noexcept { processing_tasks_.clear(); }};
+    processing_tasks_.resize(processing_requests_.size());
+
+    std::size_t started_count = 0;
+    for (std::size_t i = 0; i < processing_requests_.size(); ++i) {
+        if (started_count == i) {
+            processing_tasks_[i] = StartRequestTask(processing_requests_[i]);
+            ++started_count;
+        }
+        // The following requests run while the current one is processed, their
+        // responses wait in memory till the preceding ones are sent
+        while (started_count < processing_requests_.size() && started_count - i < config_.pipeline_depth &&
+               CanStartAhead(i, started_count)) {
+            processing_tasks_[started_count] = StartRequestTask(processing_requests_[started_count]);
+            ++started_count;
+        }
+
+        ProcessRequest(std::move(processing_requests_[i]), std::move(processing_tasks_[i]));
     }
+}
 
+bool Connection::CanStartAhead(std::size_t current_index, std::size_t next_index) const {
+    // HTTP/2 streams and upgrades are processed one by one
+    if (config_.http_version != USERVER_NAMESPACE::http::HttpVersion::k11) return false;
+    if (!is_response_chain_valid_ || engine::current_task::ShouldCancel()) return false;
+
+    // The body is read from the socket in turn
+    const auto& request = *processing_requests_[next_index];
+    if (request.IsBodyStreamed() || request.IsUpgradeWebsocket()) return false;
+
+    std::size_t buffered_size = 0;
+    for (std::size_t i = current_index + 1; i < next_index; ++i) {
+        const auto& task = processing_tasks_[i];
+        // Invalid task means that the request was processed inline
+        if (!task.IsValid() || task.IsFinished()) {
+            buffered_size += processing_requests_[i]->GetHttpResponse().GetData().size();
+        }
+    }
+    return buffered_size < config_.pipeline_max_buffered_size;
+}
+
+engine::TaskWithResult<void> Connection::StartRequestTask(const std::shared_ptr<http::HttpRequest>& request) {
     stats_->active_request_count.Add(1);
+    return request_handler_.StartRequestTask(request);
+}
 
-    auto task = HandleQueueItem(request_ptr);
+void Connection::ProcessRequest(
+    std::shared_ptr<http::HttpRequest>&& request_ptr,
+    engine::TaskWithResult<void>&& request_task
+) {
+    if (request_ptr->IsFinal()) {
+        is_accepting_requests_ = false;
+    }
+
+    auto task = HandleQueueItem(request_ptr, std::move(request_task));
     SendResponse(*request_ptr);
 
     if (request_ptr->IsUpgradeWebsocket()) request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
 }
 
 bool Connection::ReadSome() {
-    if (pending_data_size_ == pending_data_.size()) return true;
+    if (pending_data_size_ == config_.in_buffer_size) return true;
 
     try {
         engine::TaskCancellationBlocker blocker;
+        AcquireReadBuffer();
 
         auto count = peer_socket_->ReadSome(
             pending_data_.data() + pending_data_size_,
@@ -239,18 +303,38 @@ bool Connection::ReadSome() {
     return true;
 }
 
-engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept {
-    auto request_task = request_handler_.StartRequestTask(request);
+void Connection::AcquireReadBuffer() {
+    if (pending_data_) return;
+
+    UASSERT(read_buffer_pool_);
+    UASSERT(pending_data_size_ == 0);
+    pending_data_ = read_buffer_pool_->Acquire();
+}
+
+void Connection::ReleaseIdleReadBuffer() noexcept {
+    if (read_buffer_pool_ && pending_data_size_ == 0) pending_data_.Release();
+}
 
+engine::TaskWithResult<void> Connection::HandleQueueItem(
+    const std::shared_ptr<http::HttpRequest>& request,
+    engine::TaskWithResult<void> request_task
+) noexcept {
     if (engine::current_task::IsCancelRequested()) {
         // We could've packed all remaining requests into a vector and cancel them
         // in parallel. But pipelining is almost never used so why bother.
-        request_task.SyncCancel();
+        if (request_task.IsValid()) request_task.SyncCancel();
         LOG_DEBUG() << "Request processing interrupted";
         is_response_chain_valid_ = false;
         return request_task;  // avoids throwing and catching exception down below
     }
 
+    if (!request_task.IsValid()) {
+        // The handler was run inline, the response is ready
+        return request_task;
+    }
+
+    if (request->IsBodyStreamed()) ReadRequestBody(*request);
+
     try {
         auto& response = request->GetHttpResponse();
         if (response.IsBodyStreamed()) {
@@ -306,6 +390,54 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
     return request_task;
 }
 
+void Connection::ReadRequestBody(http::HttpRequest& request) noexcept {
+    auto* body = request.GetBodyStreamProducer();
+    UASSERT(body);
+
+    const auto abort_body = [this, body, &request](std::string_view reason) {
+        LOG_DEBUG() << "Streamed request body from " << Getpeername() << " on fd " << Fd() << " is aborted: " << reason;
+        body->Abort();
+        // The rest of the body is still in the socket, so it is impossible to
+        // parse the next request
+        is_accepting_requests_ = false;
+    };
+
+    try {
+        while (true) {
+            // Waits for the handler to read the buffered data, this is where
+            // the backpressure comes from
+            if (!body->Flush(engine::Deadline{})) {
+                if (!is_http2_parser_) {
+                    abort_body("the handler stopped reading the body");
+                } else if (const auto stream_id = request.GetHttpResponse().GetStreamId()) {
+                    // Other streams go on, the rest of the body is discarded
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+                    static_cast<http::Http2Session*>(parser_.get())->DiscardRequestBody(*stream_id);
+                }
+                return;
+            }
+            if (body->IsReceived()) return;
+
+            if (!WaitOnSocket(engine::Deadline::FromDuration(config_.keepalive_timeout))) {
+                abort_body("the connection was closed");
+                return;
+            }
+            const bool res = parser_->Parse({pending_data_.data(), pending_data_size_});
+            pending_data_size_ = 0;
+            if (!res) {
+                if (!body->IsReceived()) {
+                    abort_body("malformed request");
+                    return;
+                }
+                // Malformed data follows the body, stop after the response
+                is_accepting_requests_ = false;
+            }
+        }
+    } catch (const std::exception& ex) {
+        abort_body(ex.what());
+    }
+}
+
 void Connection::SendResponse(http::HttpRequest& request) {
     auto& response = request.GetHttpResponse();
     UASSERT(!response.IsSent());
@@ -355,9 +487,11 @@ void Connection::SendResponse(http::HttpRequest& request) {
                                                                                            : logging::Level::kError;
             LOG(log_level) << "I/O error while sending data: " << ex;
             response.SetSendFailed(std::chrono::steady_clock::now());
+            StopAfterFailedSend();
         } catch (const std::exception& ex) {
             LOG_ERROR() << "Error while sending data: " << ex;
             response.SetSendFailed(std::chrono::steady_clock::now());
+            StopAfterFailedSend();
         }
     } else {
         response.SetSendFailed(std::chrono::steady_clock::now());
@@ -369,6 +503,13 @@ void Connection::SendResponse(http::HttpRequest& request) {
     request.WriteAccessLogs(request_handler_.LoggerAccess(), request_handler_.LoggerAccessTskv(), peer_name_);
 }
 
+void Connection::StopAfterFailedSend() noexcept {
+    // A part of the response could have been written, so the peer can not
+    // tell where the next one starts
+    is_response_chain_valid_ = false;
+    is_accepting_requests_ = false;
+}
+
 std::string Connection::Getpeername() const { return peer_name_; }
 
 std::unique_ptr<request::RequestParser> Connection::MakeParser(USERVER_NAMESPACE::http::HttpVersion ver) {
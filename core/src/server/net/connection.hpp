@@ -5,6 +5,7 @@
 
 #include <server/http/request_handler_base.hpp>
 #include <server/net/connection_config.hpp>
+#include <server/net/read_buffer_pool.hpp>
 #include <server/net/stats.hpp>
 
 // TODO: use fwd
@@ -32,7 +33,8 @@ public:
         const engine::io::Sockaddr& remote_address,
         const http::RequestHandlerBase& request_handler,
         std::shared_ptr<Stats> stats,
-        request::ResponseDataAccounter& data_accounter
+        request::ResponseDataAccounter& data_accounter,
+        std::shared_ptr<ReadBufferPool> read_buffer_pool = {}
     );
 
     void Process();
@@ -45,15 +47,25 @@ private:
     bool IsRequestTasksEmpty() const noexcept;
 
     void ListenForRequests() noexcept;
-    void ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr);
+    void ProcessRequests();
+    bool CanStartAhead(std::size_t current_index, std::size_t next_index) const;
+    engine::TaskWithResult<void> StartRequestTask(const std::shared_ptr<http::HttpRequest>& request);
+    void ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr, engine::TaskWithResult<void>&& request_task);
     bool WaitOnSocket(engine::Deadline deadline);
 
-    engine::TaskWithResult<void> HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept;
+    engine::TaskWithResult<void> HandleQueueItem(
+        const std::shared_ptr<http::HttpRequest>& request,
+        engine::TaskWithResult<void> request_task
+    ) noexcept;
+    void ReadRequestBody(http::HttpRequest& request) noexcept;
     void SendResponse(http::HttpRequest& request);
+    void StopAfterFailedSend() noexcept;
 
     std::string Getpeername() const;
 
     bool ReadSome();
+    void AcquireReadBuffer();
+    void ReleaseIdleReadBuffer() noexcept;
     std::unique_ptr<request::RequestParser> MakeParser(USERVER_NAMESPACE::http::HttpVersion ver);
     bool TryDetectHttpVersion(std::string& buffer, std::string_view req);
 
@@ -68,11 +80,18 @@ private:
 
     using HttpRequestPtr = std::shared_ptr<http::HttpRequest>;
     std::vector<HttpRequestPtr> pending_requests_;
+    // More requests may be parsed while a streamed request body is read
+    std::vector<HttpRequestPtr> processing_requests_;
+    // Tasks of processing_requests_, the pipelined requests may be started
+    // ahead of their turn
+    std::vector<engine::TaskWithResult<void>> processing_tasks_;
 
     engine::io::Sockaddr remote_address_;
     std::string peer_name_;
 
-    std::vector<char> pending_data_{};
+    // Without a pool the buffer is allocated once and kept till the end
+    const std::shared_ptr<ReadBufferPool> read_buffer_pool_;
+    ReadBuffer pending_data_{};
     size_t pending_data_size_{0};
 
     bool is_accepting_requests_{true};
@@ -1,5 +1,7 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,10 +20,18 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
     ConnectionConfig config;
 
     config.in_buffer_size = value["in_buffer_size"].As<size_t>(config.in_buffer_size);
+    config.in_buffer_pool_max_idle = value["in_buffer_pool_max_idle"].As<size_t>(config.in_buffer_pool_max_idle);
     config.requests_queue_size_threshold =
         value["requests_queue_size_threshold"].As<size_t>(config.requests_queue_size_threshold);
     config.keepalive_timeout = value["keepalive_timeout"].As<std::chrono::seconds>(config.keepalive_timeout);
 
+    config.pipeline_depth = value["pipeline_depth"].As<size_t>(config.pipeline_depth);
+    if (config.pipeline_depth == 0) {
+        throw std::runtime_error("connection.pipeline_depth must be greater than 0");
+    }
+    config.pipeline_max_buffered_size =
+        value["pipeline_max_buffered_size"].As<size_t>(config.pipeline_max_buffered_size);
+
     if (!value["stream_close_check_delay"].IsMissing()) {
         config.abort_check_delay = utils::StringToDuration(value["stream_close_check_delay"].As<std::string>());
     }
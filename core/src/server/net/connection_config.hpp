@@ -26,9 +26,12 @@ struct Http2SessionConfig final {
 
 struct ConnectionConfig {
     size_t in_buffer_size = 32 * 1024;
+    size_t in_buffer_pool_max_idle = 256;
     size_t requests_queue_size_threshold = 100;
     std::chrono::seconds keepalive_timeout{10 * 60};
     std::chrono::milliseconds abort_check_delay{kDefaultAbortCheckDelay};
+    size_t pipeline_depth = 1;
+    size_t pipeline_max_buffered_size = 1024 * 1024;
     USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
     Http2SessionConfig http2_session_config;
 };
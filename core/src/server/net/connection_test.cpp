@@ -1,5 +1,7 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -23,7 +25,7 @@ constexpr auto kAcceptTimeout = utest::kMaxTestWaitTime;
 
 class TestHttprequestHandler : public server::http::RequestHandlerBase {
 public:
-    enum class Behaviors { kNoop, kHang };
+    enum class Behaviors { kNoop, kHang, kInline, kSleep };
 
     explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop) : behavior_(behavior) {}
 
@@ -40,6 +42,17 @@ public:
                     ASSERT_TRUE(engine::current_task::IsCancelRequested());
                     ++asyncs_finished;
                 });
+            case Behaviors::kInline:
+                ++asyncs_finished;
+                return {};
+            case Behaviors::kSleep:
+                return engine::AsyncNoSpan([this]() {
+                    const auto running = ++asyncs_running;
+                    if (running > max_asyncs_running) max_asyncs_running = running;
+                    engine::SleepFor(std::chrono::milliseconds{50});
+                    --asyncs_running;
+                    ++asyncs_finished;
+                });
         }
 
         UINVARIANT(false, "Unexpected behavior");
@@ -52,6 +65,10 @@ public:
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     mutable std::atomic<std::size_t> asyncs_finished{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> asyncs_running{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> max_asyncs_running{0};
 
 private:
     const Behaviors behavior_;
@@ -299,6 +316,107 @@ UTEST_P(ServerNetConnection, KeepAlive) {
     EXPECT_EQ(handler.asyncs_finished, 2);
 }
 
+UTEST_P(ServerNetConnection, KeepAliveInline) {
+    const auto http_ver = GetParam();
+    net::ListenerConfig config = CreateConfig(http_ver);
+    auto request_socket = net::CreateSocket(config);
+
+    auto http_client_ptr = utest::CreateHttpClient();
+    http_client_ptr->SetMaxHostConnections(1);
+
+    auto request = CreateRequest(*http_client_ptr, request_socket, http_ver, ConnectionHeader::kKeepAlive);
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kInline};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+    EXPECT_EQ(request.Get()->status_code(), 404);
+
+    EXPECT_EQ(handler.asyncs_finished, 1);
+    request = CreateRequest(*http_client_ptr, request_socket, http_ver, ConnectionHeader::kKeepAlive);
+    EXPECT_EQ(request.Get()->status_code(), 404);
+    EXPECT_EQ(handler.asyncs_finished, 2);
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnectionPipeline, ConcurrentRequests) {
+    constexpr std::size_t kRequests = 3;
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.pipeline_depth = 4;
+    auto request_socket = net::CreateSocket(config);
+
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(request_socket.Getsockname().Port());
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    client.Connect(addr, Deadline::FromDuration(kAcceptTimeout));
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kSleep};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    std::string requests;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        requests += "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    }
+    const auto sent = client.SendAll(requests.data(), requests.size(), Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_EQ(sent, requests.size());
+
+    // Waits for the status lines of all the responses
+    std::string responses;
+    std::size_t responses_count = 0;
+    std::array<char, 4096> buffer{};
+    while (responses_count < kRequests) {
+        const auto size = client.RecvSome(buffer.data(), buffer.size(), Deadline::FromDuration(kAcceptTimeout));
+        ASSERT_NE(size, 0);
+        responses.append(buffer.data(), size);
+        responses_count = 0;
+        for (auto pos = responses.find("HTTP/1.1 "); pos != std::string::npos;
+             pos = responses.find("HTTP/1.1 ", pos + 1)) {
+            ++responses_count;
+        }
+    }
+    EXPECT_EQ(handler.asyncs_finished, kRequests);
+    EXPECT_EQ(handler.max_asyncs_running, kRequests);
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
 UTEST_P(ServerNetConnection, CancelMultipleInFlight) {
     constexpr std::size_t kInFlightRequests = 10;
     constexpr std::size_t kMaxAttempts = 10;
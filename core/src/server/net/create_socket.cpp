@@ -1,6 +1,15 @@
 #include "create_socket.hpp"
 
+#include <sys/socket.h>
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
 #include <string>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -9,6 +18,7 @@
 #include <userver/engine/io/socket.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -71,6 +81,31 @@ engine::io::Socket CreateSocket(const ListenerConfig& config) {
         return CreateUnixSocket(config.unix_socket_path, config.backlog);
 }
 
+void SteerConnectionsByCpu(engine::io::Socket& socket, std::size_t shards) {
+    UASSERT(shards > 0);
+
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+    // A = cpu; A %= shards; return A;
+    // An index past the group size makes the kernel fall back to hashing, so
+    // it is fine to attach the program before all the shards are bound.
+    std::array<sock_filter, 3> code{{
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(shards)},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    }};
+    sock_fprog program{static_cast<unsigned short>(code.size()), code.data()};
+
+    if (::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)) == -1) {
+        const std::error_code ec{errno, std::system_category()};
+        LOG_WARNING() << "Failed to attach the CPU steering program to fd " << socket.Fd() << ", connections are "
+                      << "distributed between the listener shards by hash: " << ec.message();
+    }
+#else
+    LOG_WARNING() << "SO_ATTACH_REUSEPORT_CBPF is not supported by the platform, connections are distributed "
+                  << "between the " << shards << " listener shards by hash (fd " << socket.Fd() << ')';
+#endif
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -9,6 +9,12 @@ namespace server::net {
 
 engine::io::Socket CreateSocket(const ListenerConfig& config);
 
+/// Makes the kernel pass new connections of the SO_REUSEPORT group of the
+/// `socket` to the socket number `cpu % shards` in the group, where `cpu` is
+/// the CPU that handles the incoming packet. Does nothing but logging if the
+/// platform lacks SO_ATTACH_REUSEPORT_CBPF.
+void SteerConnectionsByCpu(engine::io::Socket& socket, std::size_t shards);
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
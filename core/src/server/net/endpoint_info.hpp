@@ -18,6 +18,8 @@ struct EndpointInfo {
     const ListenerConfig& listener_config;
     http::HttpRequestHandler& request_handler;
     Connection::Type connection_type{Connection::Type::kRequest};
+    // count of the Listener-s sharing the SO_REUSEPORT group
+    std::size_t listener_shards{1};
 
     std::atomic<size_t> connection_count{0};
 };
@@ -20,8 +20,11 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
     config.unix_socket_path = value["unix-socket"].As<std::string>("");
     config.max_connections = value["max_connections"].As<size_t>(config.max_connections);
     config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+    config.steer_connections_by_cpu = value["steer_connections_by_cpu"].As<bool>(config.steer_connections_by_cpu);
     config.task_processor = value["task_processor"].As<std::string>();
     config.backlog = value["backlog"].As<int>(config.backlog);
+    config.low_latency = value["low_latency"].As<bool>(config.low_latency);
+    config.busy_poll = std::chrono::microseconds{value["busy_poll_us"].As<int>(config.busy_poll.count())};
 
     if (config.port != 0 && !config.unix_socket_path.empty())
         throw std::runtime_error(
@@ -34,6 +37,9 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
     if (config.backlog <= 0) {
         throw std::runtime_error("Invalid backlog value in " + value.GetPath());
     }
+    if (config.busy_poll.count() < 0) {
+        throw std::runtime_error("Invalid busy_poll_us value in " + value.GetPath());
+    }
 
     auto cert_path = value["tls"]["cert"].As<std::string>({});
     auto pkey_path = value["tls"]["private-key"].As<std::string>({});
@@ -57,6 +63,8 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
         auto contents = fs::blocking::ReadFileContents(ca_path);
         config.tls_certificate_authorities.push_back(crypto::Certificate::LoadFromString(contents));
     }
+    config.tls_session_ticket_keys_name = value["tls"]["session-ticket-keys-name"].As<std::string>({});
+    config.tls_settings.kernel_tls_tx = value["tls"]["kernel-tls-tx"].As<bool>(false);
 
     return config;
 }
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 
 #include <userver/crypto/certificate.hpp>
 #include <userver/crypto/private_key.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
 #include <userver/server/request/request_config.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -23,6 +25,9 @@ struct ListenerConfig {
     int backlog = 1024;  // truncated to net.core.somaxconn
     size_t max_connections = 32768;
     std::optional<size_t> shards;
+    bool steer_connections_by_cpu{false};
+    bool low_latency{false};
+    std::chrono::microseconds busy_poll{50};  // used only in low_latency mode
     std::string task_processor;
 
     bool tls{false};
@@ -31,6 +36,9 @@ struct ListenerConfig {
     std::string tls_private_key_passphrase_name;
     crypto::PrivateKey tls_private_key;
     std::vector<crypto::Certificate> tls_certificate_authorities;
+    std::string tls_session_ticket_keys_name;
+    // Session ticket keys are loaded from secdist by the server
+    engine::io::TlsServerSettings tls_settings;
 };
 
 ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ListenerConfig>);
@@ -24,6 +24,24 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+std::shared_ptr<ReadBufferPool> MakeReadBufferPool(const ConnectionConfig& config) {
+    if (config.in_buffer_pool_max_idle == 0) return {};
+    return std::make_shared<ReadBufferPool>(config.in_buffer_size, config.in_buffer_pool_max_idle);
+}
+
+engine::io::Socket CreateListenerSocket(const EndpointInfo& endpoint_info) {
+    const auto& config = endpoint_info.listener_config;
+    auto socket = CreateSocket(config);
+    if (config.steer_connections_by_cpu && config.unix_socket_path.empty()) {
+        SteerConnectionsByCpu(socket, endpoint_info.listener_shards);
+    }
+    return socket;
+}
+
+}  // namespace
+
 ListenerImpl::ListenerImpl(
     engine::TaskProcessor& task_processor,
     std::shared_ptr<EndpointInfo> endpoint_info,
@@ -32,6 +50,7 @@ ListenerImpl::ListenerImpl(
     : task_processor_(task_processor),
       endpoint_info_(std::move(endpoint_info)),
       stats_(std::make_shared<Stats>()),
+      read_buffer_pool_(MakeReadBufferPool(endpoint_info_->listener_config.connection_config)),
       data_accounter_(data_accounter),
       socket_listener_task_(engine::CriticalAsyncNoSpan(
           task_processor_,
@@ -50,7 +69,7 @@ ListenerImpl::ListenerImpl(
                   }
               }
           },
-          CreateSocket(endpoint_info_->listener_config)
+          CreateListenerSocket(*endpoint_info_)
       )) {}
 
 ListenerImpl::~ListenerImpl() {
@@ -61,7 +80,11 @@ ListenerImpl::~ListenerImpl() {
     connections_.CancelAndWait();
 }
 
-StatsAggregation ListenerImpl::GetStats() const { return StatsAggregation{*stats_}; }
+StatsAggregation ListenerImpl::GetStats() const {
+    StatsAggregation stats{*stats_};
+    if (read_buffer_pool_) stats.read_buffers = read_buffer_pool_->GetStats();
+    return stats;
+}
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
     auto peer_socket = request_socket.Accept({});
@@ -94,6 +117,15 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
         peer_socket.Getsockname().Domain() == engine::io::AddrDomain::kInet)
         peer_socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
 
+    if (endpoint_info_->listener_config.low_latency) {
+        try {
+            peer_socket.EnableLowLatency(endpoint_info_->listener_config.busy_poll);
+        } catch (const engine::io::IoSystemError& ex) {
+            LOG_LIMITED_WARNING() << "Failed to enable the low latency mode for fd " << peer_socket.Fd() << ": "
+                                  << ex;
+        }
+    }
+
     const auto fd = peer_socket.Fd();
 
     LOG_TRACE() << "Creating connection for fd " << fd;
@@ -102,7 +134,12 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
     if (endpoint_info_->listener_config.tls) {
         const auto& config = endpoint_info_->listener_config;
         socket = std::make_unique<engine::io::TlsWrapper>(engine::io::TlsWrapper::StartTlsServer(
-            std::move(peer_socket), config.tls_cert, config.tls_private_key, {}, config.tls_certificate_authorities
+            std::move(peer_socket),
+            config.tls_cert,
+            config.tls_private_key,
+            {},
+            config.tls_certificate_authorities,
+            config.tls_settings
         ));
     } else {
         socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
@@ -115,7 +152,8 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
         std::move(remote_address),
         endpoint_info_->request_handler,
         stats_,
-        data_accounter_
+        data_accounter_,
+        read_buffer_pool_
     );
 
     LOG_TRACE() << "Start connection processing for fd " << fd;
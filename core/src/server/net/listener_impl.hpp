@@ -9,6 +9,7 @@
 
 #include "connection.hpp"
 #include "endpoint_info.hpp"
+#include "read_buffer_pool.hpp"
 #include "stats.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +35,7 @@ private:
     std::shared_ptr<EndpointInfo> endpoint_info_;
 
     std::shared_ptr<Stats> stats_;
+    std::shared_ptr<ReadBufferPool> read_buffer_pool_;
     request::ResponseDataAccounter& data_accounter_;
 
     concurrent::BackgroundTaskStorageCore connections_;
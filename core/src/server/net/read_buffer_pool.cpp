@@ -0,0 +1,81 @@
+#include <server/net/read_buffer_pool.hpp>
+
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+ReadBuffer::ReadBuffer(std::size_t size)
+    // Not using std::make_unique as it value-initializes the memory
+    : data_(new char[size]), size_(size) {}
+
+ReadBuffer::ReadBuffer(std::unique_ptr<char[]> data, std::size_t size, ReadBufferPool& pool) noexcept
+    : data_(std::move(data)), size_(size), pool_(&pool) {}
+
+ReadBuffer::ReadBuffer(ReadBuffer&& other) noexcept
+    : data_(std::move(other.data_)), size_(std::exchange(other.size_, 0)), pool_(std::exchange(other.pool_, nullptr)) {}
+
+ReadBuffer& ReadBuffer::operator=(ReadBuffer&& other) noexcept {
+    if (this != &other) {
+        Release();
+        data_ = std::move(other.data_);
+        size_ = std::exchange(other.size_, 0);
+        pool_ = std::exchange(other.pool_, nullptr);
+    }
+    return *this;
+}
+
+ReadBuffer::~ReadBuffer() { Release(); }
+
+void ReadBuffer::Release() noexcept {
+    if (pool_ && data_) {
+        pool_->Return(std::move(data_));
+    }
+    data_.reset();
+    size_ = 0;
+    pool_ = nullptr;
+}
+
+ReadBufferPool::ReadBufferPool(std::size_t buffer_size, std::size_t max_idle_buffers)
+    : buffer_size_(buffer_size), max_idle_buffers_(max_idle_buffers) {
+    UINVARIANT(buffer_size_ > 0, "Read buffers of zero size are useless");
+}
+
+ReadBufferPool::~ReadBufferPool() { UASSERT_MSG(in_use_count_ == 0, "Some read buffers outlive their pool"); }
+
+ReadBuffer ReadBufferPool::Acquire() {
+    std::unique_ptr<char[]> data;
+    if (idle_buffers_.try_dequeue(data)) {
+        --idle_count_;
+    } else {
+        data.reset(new char[buffer_size_]);
+    }
+
+    ++in_use_count_;
+    return ReadBuffer{std::move(data), buffer_size_, *this};
+}
+
+ReadBufferPoolStats ReadBufferPool::GetStats() const noexcept {
+    ReadBufferPoolStats stats;
+    stats.in_use = in_use_count_.load(std::memory_order_relaxed);
+    stats.idle = idle_count_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ReadBufferPool::Return(std::unique_ptr<char[]>&& data) noexcept {
+    --in_use_count_;
+
+    // The counter is bumped first so that concurrent returns do not overflow
+    // the limit. Extra buffers are freed right away.
+    if (idle_count_.fetch_add(1) >= max_idle_buffers_ || !idle_buffers_.enqueue(std::move(data))) {
+        --idle_count_;
+        data.reset();
+    }
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <moodycamel/concurrentqueue.h>
+
+#include <server/net/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+class ReadBufferPool;
+
+/// Receive buffer of a connection. Returns the memory to the pool on
+/// destruction or on Release(), buffers without a pool own their memory.
+class ReadBuffer final {
+public:
+    ReadBuffer() noexcept = default;
+    explicit ReadBuffer(std::size_t size);
+
+    ReadBuffer(ReadBuffer&&) noexcept;
+    ReadBuffer& operator=(ReadBuffer&&) noexcept;
+    ~ReadBuffer();
+
+    char* data() const noexcept { return data_.get(); }
+    std::size_t size() const noexcept { return size_; }
+
+    explicit operator bool() const noexcept { return !!data_; }
+
+    void Release() noexcept;
+
+private:
+    friend class ReadBufferPool;
+
+    ReadBuffer(std::unique_ptr<char[]> data, std::size_t size, ReadBufferPool& pool) noexcept;
+
+    std::unique_ptr<char[]> data_;
+    std::size_t size_{0};
+    ReadBufferPool* pool_{nullptr};
+};
+
+/// Receive buffers shared by the connections of a listener. A connection
+/// holds a buffer only while it has some data to read, so idle keep-alive
+/// connections hold no memory.
+class ReadBufferPool final {
+public:
+    ReadBufferPool(std::size_t buffer_size, std::size_t max_idle_buffers);
+    ~ReadBufferPool();
+
+    ReadBuffer Acquire();
+
+    ReadBufferPoolStats GetStats() const noexcept;
+
+private:
+    friend class ReadBuffer;
+
+    void Return(std::unique_ptr<char[]>&& data) noexcept;
+
+    const std::size_t buffer_size_;
+    const std::size_t max_idle_buffers_;
+
+    moodycamel::ConcurrentQueue<std::unique_ptr<char[]>> idle_buffers_;
+    std::atomic<std::size_t> idle_count_{0};
+    std::atomic<std::size_t> in_use_count_{0};
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <server/net/read_buffer_pool.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kBufferSize = 1024;
+
+}  // namespace
+
+TEST(ReadBufferPool, Reuse) {
+    server::net::ReadBufferPool pool{kBufferSize, 2};
+
+    auto buffer = pool.Acquire();
+    ASSERT_TRUE(buffer);
+    EXPECT_EQ(buffer.size(), kBufferSize);
+    EXPECT_EQ(pool.GetStats().in_use, 1);
+    EXPECT_EQ(pool.GetStats().idle, 0);
+
+    const auto* data = buffer.data();
+    buffer.Release();
+    EXPECT_FALSE(buffer);
+    EXPECT_EQ(pool.GetStats().in_use, 0);
+    EXPECT_EQ(pool.GetStats().idle, 1);
+
+    buffer = pool.Acquire();
+    EXPECT_EQ(buffer.data(), data);
+    EXPECT_EQ(pool.GetStats().in_use, 1);
+    EXPECT_EQ(pool.GetStats().idle, 0);
+}
+
+TEST(ReadBufferPool, MaxIdle) {
+    server::net::ReadBufferPool pool{kBufferSize, 2};
+
+    {
+        auto first = pool.Acquire();
+        auto second = pool.Acquire();
+        auto third = pool.Acquire();
+        EXPECT_EQ(pool.GetStats().in_use, 3);
+    }
+
+    EXPECT_EQ(pool.GetStats().in_use, 0);
+    EXPECT_EQ(pool.GetStats().idle, 2);
+}
+
+TEST(ReadBufferPool, Move) {
+    server::net::ReadBufferPool pool{kBufferSize, 2};
+
+    auto buffer = pool.Acquire();
+    server::net::ReadBuffer other{std::move(buffer)};
+    EXPECT_TRUE(other);
+    EXPECT_EQ(pool.GetStats().in_use, 1);
+
+    other = server::net::ReadBuffer{kBufferSize};
+    EXPECT_EQ(other.size(), kBufferSize);
+    EXPECT_EQ(pool.GetStats().in_use, 0);
+    EXPECT_EQ(pool.GetStats().idle, 1);
+
+    other.Release();
+    EXPECT_EQ(pool.GetStats().idle, 1);
+}
+
+USERVER_NAMESPACE_END
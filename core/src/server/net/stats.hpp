@@ -56,6 +56,17 @@ struct ParserStatsAggregation final {
     utils::statistics::Rate goaway{0};
 };
 
+struct ReadBufferPoolStats final {
+    ReadBufferPoolStats& operator+=(const ReadBufferPoolStats& other) {
+        in_use += other.in_use;
+        idle += other.idle;
+        return *this;
+    }
+
+    std::size_t in_use{0};
+    std::size_t idle{0};
+};
+
 struct Stats {
     // per listener
     std::atomic<size_t> active_connections{0};
@@ -88,6 +99,8 @@ struct StatsAggregation final {
         active_request_count += other.active_request_count;
         requests_processed_count += other.requests_processed_count;
 
+        read_buffers += other.read_buffers;
+
         return *this;
     }
 
@@ -99,6 +112,9 @@ struct StatsAggregation final {
     ParserStatsAggregation parser_stats;
     std::size_t active_request_count{0};
     std::size_t requests_processed_count{0};
+
+    // per listener, filled from ReadBufferPool
+    ReadBufferPoolStats read_buffers;
 };
 
 }  // namespace server::net
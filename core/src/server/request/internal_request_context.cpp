@@ -36,6 +36,14 @@ void InternalRequestContext::ResetConfigSnapshot() { config_snapshot_.reset(); }
 
 DeadlinePropagationContext& InternalRequestContext::GetDPContext() { return dp_context_; }
 
+void InternalRequestContext::SetResponseBodyEncoder(std::unique_ptr<http::impl::ResponseBodyEncoder>&& encoder) {
+    response_body_encoder_ = std::move(encoder);
+}
+
+std::unique_ptr<http::impl::ResponseBodyEncoder> InternalRequestContext::ExtractResponseBodyEncoder() {
+    return std::move(response_body_encoder_);
+}
+
 }  // namespace server::request::impl
 
 USERVER_NAMESPACE_END
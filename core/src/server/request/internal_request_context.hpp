@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include <userver/logging/level.hpp>
 
 #include <userver/dynamic_config/snapshot.hpp>
 
+#include <server/http/response_body_encoder.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request::impl {
@@ -35,9 +38,13 @@ public:
 
     DeadlinePropagationContext& GetDPContext();
 
+    void SetResponseBodyEncoder(std::unique_ptr<http::impl::ResponseBodyEncoder>&& encoder);
+    std::unique_ptr<http::impl::ResponseBodyEncoder> ExtractResponseBodyEncoder();
+
 private:
     std::optional<dynamic_config::Snapshot> config_snapshot_;
     DeadlinePropagationContext dp_context_{};
+    std::unique_ptr<http::impl::ResponseBodyEncoder> response_body_encoder_;
 };
 
 }  // namespace server::request::impl
@@ -1,16 +1,18 @@
 #include <userver/server/request/task_inherited_request.hpp>
 
 #include <algorithm>
+#include <atomic>
 
 #include <server/request/task_inherited_request_impl.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request {
 
 namespace {
-inline engine::TaskInheritedVariable<HeadersToPropagate> kPropagatedHeaders;
 
 const std::string kEmptyString{};
 const HeadersToPropagate kEmptyHeaders;
@@ -25,12 +27,61 @@ const std::string* FindValueOrNullptr(const HeadersToPropagate& headers, std::st
     return &it->value;
 }
 
+// Either the headers set by SetPropagatedHeaders(), or the headers of the
+// request that are copied on the first GetAll() call. The latter spares the
+// copying for the requests that make no outgoing calls.
+class PropagatedHeaders final {
+public:
+    explicit PropagatedHeaders(HeadersToPropagate headers) : headers_(std::move(headers)), all_(&headers_) {}
+
+    PropagatedHeaders(std::shared_ptr<http::HttpRequest> request, const std::vector<std::string>& names)
+        : request_(std::move(request)), names_(&names) {}
+
+    PropagatedHeaders(PropagatedHeaders&&) = delete;
+    PropagatedHeaders& operator=(PropagatedHeaders&&) = delete;
+
+    ~PropagatedHeaders() {
+        const auto* all = all_.load();
+        if (all != &headers_) delete all;
+    }
+
+    const std::string* Find(std::string_view header_name) const {
+        if (!request_) return FindValueOrNullptr(headers_, header_name);
+
+        if (std::find(names_->begin(), names_->end(), header_name) == names_->end()) return nullptr;
+        return utils::FindOrNullptr(request_->GetHeaders(), header_name);
+    }
+
+    // Safe to call concurrently from the tasks that inherited the headers
+    const HeadersToPropagate& GetAll() const {
+        if (const auto* all = all_.load()) return *all;
+
+        auto headers = std::make_unique<HeadersToPropagate>();
+        for (const auto& header_name : *names_) {
+            const auto* header_value = utils::FindOrNullptr(request_->GetHeaders(), header_name);
+            if (header_value) headers->emplace_back(header_name, *header_value);
+        }
+
+        const HeadersToPropagate* expected = nullptr;
+        if (all_.compare_exchange_strong(expected, headers.get())) return *headers.release();
+        return *expected;
+    }
+
+private:
+    const HeadersToPropagate headers_;
+    const std::shared_ptr<http::HttpRequest> request_;
+    const std::vector<std::string>* const names_{nullptr};
+    mutable std::atomic<const HeadersToPropagate*> all_{nullptr};
+};
+
+inline engine::TaskInheritedVariable<PropagatedHeaders> kPropagatedHeaders;
+
 const std::string& DoGetPropagatedHeader(std::string_view header_name) {
     const auto* headers = kPropagatedHeaders.GetOptional();
     if (headers == nullptr) {
         return kEmptyString;
     }
-    const auto* const value = FindValueOrNullptr(*headers, header_name);
+    const auto* const value = headers->Find(header_name);
     if (value == nullptr) {
         return kEmptyString;
     }
@@ -42,7 +93,7 @@ bool DoHasPropagatedHeader(std::string_view header_name) {
     if (headers == nullptr) {
         return false;
     }
-    return FindValueOrNullptr(*headers, header_name) != nullptr;
+    return headers->Find(header_name) != nullptr;
 }
 
 }  // namespace
@@ -64,10 +115,15 @@ boost::iterator_range<HeadersToPropagate::const_iterator> GetPropagatedHeaders()
     if (headers == nullptr) {
         return kEmptyHeaders;
     }
-    return *headers;
+    return headers->GetAll();
 }
 
-void SetPropagatedHeaders(HeadersToPropagate headers) { kPropagatedHeaders.Set(std::move(headers)); }
+void SetPropagatedHeaders(HeadersToPropagate headers) { kPropagatedHeaders.Emplace(std::move(headers)); }
+
+void SetLazyPropagatedHeaders(std::shared_ptr<http::HttpRequest> request, const std::vector<std::string>& names) {
+    UASSERT(request);
+    kPropagatedHeaders.Emplace(std::move(request), names);
+}
 
 const std::string& GetTaskInheritedQueryParameter(std::string_view name) {
     const auto* request = kTaskInheritedRequest.GetOptional();
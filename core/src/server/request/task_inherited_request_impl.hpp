@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <userver/engine/task/inherited_variable.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,6 +16,11 @@ namespace server::request {
 
 inline engine::TaskInheritedVariable<std::shared_ptr<http::HttpRequest>> kTaskInheritedRequest;
 
+// Makes the `names` headers of the `request` propagated. Unlike
+// SetPropagatedHeaders() the values are not copied until the first
+// GetPropagatedHeaders() call. `names` must outlive the task hierarchy.
+void SetLazyPropagatedHeaders(std::shared_ptr<http::HttpRequest> request, const std::vector<std::string>& names);
+
 }  // namespace server::request
 
 USERVER_NAMESPACE_END
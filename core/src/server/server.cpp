@@ -17,6 +17,7 @@
 #include <server/pph_config.hpp>
 #include <server/requests_view.hpp>
 #include <server/server_config.hpp>
+#include <server/tls_ticket_keys_config.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/middlewares/configuration.hpp>
@@ -65,6 +66,7 @@ void PortInfo::Init(
 
     const auto& event_thread_pool = task_processor.EventThreadPool();
     size_t listener_shards = listener_config.shards ? *listener_config.shards : event_thread_pool.GetSize();
+    endpoint_info_->listener_shards = listener_shards;
 
     listeners_.reserve(listener_shards);
     while (listener_shards--) {
@@ -158,6 +160,10 @@ ServerImpl::ServerImpl(
             auto pph = secdist.Get<PassphraseConfig>().GetPassphrase(config_.listener.tls_private_key_passphrase_name);
             config_.listener.tls_private_key = crypto::PrivateKey::LoadFromString(contents, pph.GetUnderlying());
         }
+        if (!config_.listener.tls_session_ticket_keys_name.empty()) {
+            config_.listener.tls_settings.session_ticket_keys =
+                secdist.Get<TlsTicketKeysConfig>().GetKeys(config_.listener.tls_session_ticket_keys_name);
+        }
     }
 
     main_port_info_.Init(config_, config_.listener, component_context, false);
@@ -339,6 +345,10 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
         conn_stats["active"] = server_stats.active_connections;
         conn_stats["opened"] = server_stats.connections_created;
         conn_stats["closed"] = server_stats.connections_closed;
+        if (auto buffers_stats = conn_stats["read-buffers"]) {
+            buffers_stats["in-use"] = server_stats.read_buffers.in_use;
+            buffers_stats["idle"] = server_stats.read_buffers.idle;
+        }
     }
 
     if (auto request_stats = writer["requests"]) {
@@ -0,0 +1,353 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <fmt/format.h>
+#include <llhttp.h>
+#include <nghttp2/nghttp2.h>
+
+#include <userver/components/component_base.hpp>
+#include <userver/components/minimal_server_component_list.hpp>
+#include <userver/components/run.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/component.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kRoundTripMaxTime = std::chrono::seconds{60};
+constexpr std::string_view kPath = "/bench";
+
+// Server under load shares the task processor with the load generator, as
+// the whole benchmark is supposed to be run on a dedicated machine.
+constexpr std::string_view kStaticConfigTemplate = R"(
+components_manager:
+  coro_pool:
+    initial_size: 500
+    max_size: 5000
+  default_task_processor: main-task-processor
+  event_thread_pool:
+    threads: 2
+  task_processors:
+    main-task-processor:
+      worker_threads: 4
+  components:
+    logging:
+      fs-task-processor: main-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+          level: error
+    dynamic-config:
+      defaults: {{}}
+    server:
+      listener:
+        port: {0}
+        task_processor: main-task-processor
+        connection:
+          http-version: '{1}'
+    handler-benchmark:
+      path: {2}
+      method: GET
+      task_processor: main-task-processor
+      run-inline: {3}
+)";
+
+struct BenchmarkParams final {
+    benchmark::State& state;
+    std::uint16_t port;
+    bool http2;
+    std::size_t connections;
+    std::size_t pipeline;
+    bool run_inline;
+};
+
+// The components are constructed by the components::RunOnce, so there is no
+// other way to pass the benchmark state to them
+BenchmarkParams* current_params{nullptr};
+
+std::uint16_t FindFreePort() {
+    std::uint16_t result{};
+    engine::RunStandalone([&result] {
+        const internal::net::TcpListener listener{};
+        result = listener.Port();
+    });
+    return result;
+}
+
+engine::io::Socket Connect(std::uint16_t port) {
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(port);
+    engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+    socket.Connect(addr, engine::Deadline::FromDuration(kRoundTripMaxTime));
+    socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+    return socket;
+}
+
+class BenchmarkHandler final : public server::handlers::HttpHandlerBase {
+public:
+    static constexpr std::string_view kName = "handler-benchmark";
+
+    using HttpHandlerBase::HttpHandlerBase;
+
+    std::string HandleRequestThrow(const server::http::HttpRequest&, server::request::RequestContext&)
+        const override {
+        return "OK";
+    }
+};
+
+class LoadConnection {
+public:
+    LoadConnection(const LoadConnection&) = delete;
+    LoadConnection& operator=(const LoadConnection&) = delete;
+    virtual ~LoadConnection() = default;
+
+    // Sends `pipeline` requests at once and waits for all the responses
+    void RoundTrip(std::size_t pipeline) {
+        const auto start = std::chrono::steady_clock::now();
+        DoRoundTrip(pipeline, engine::Deadline::FromDuration(kRoundTripMaxTime));
+        latencies_.push_back(std::chrono::steady_clock::now() - start);
+    }
+
+    const std::vector<std::chrono::steady_clock::duration>& GetLatencies() const { return latencies_; }
+
+protected:
+    LoadConnection() = default;
+
+    virtual void DoRoundTrip(std::size_t pipeline, engine::Deadline deadline) = 0;
+
+private:
+    std::vector<std::chrono::steady_clock::duration> latencies_;
+};
+
+class Http1Connection final : public LoadConnection {
+public:
+    Http1Connection(std::uint16_t port, std::size_t pipeline) : socket_(Connect(port)) {
+        for (std::size_t i = 0; i < pipeline; ++i) {
+            requests_ += fmt::format("GET {} HTTP/1.1\r\nHost: localhost\r\n\r\n", kPath);
+        }
+
+        llhttp_settings_init(&settings_);
+        settings_.on_message_complete = [](llhttp_t* parser) {
+            ++static_cast<Http1Connection*>(parser->data)->responses_;
+            return 0;
+        };
+        llhttp_init(&parser_, HTTP_RESPONSE, &settings_);
+        parser_.data = this;
+    }
+
+private:
+    void DoRoundTrip(std::size_t pipeline, engine::Deadline deadline) override {
+        UINVARIANT(socket_.SendAll(requests_.data(), requests_.size(), deadline) == requests_.size(), "Send failed");
+
+        responses_ = 0;
+        while (responses_ < pipeline) {
+            const auto size = socket_.RecvSome(buffer_.data(), buffer_.size(), deadline);
+            UINVARIANT(size != 0, "Server closed the connection");
+            UINVARIANT(llhttp_execute(&parser_, buffer_.data(), size) == HPE_OK, "Failed to parse the responses");
+        }
+    }
+
+    engine::io::Socket socket_;
+    std::string requests_;
+    llhttp_settings_t settings_{};
+    llhttp_t parser_{};
+    std::size_t responses_{0};
+    std::array<char, 64 * 1024> buffer_{};
+};
+
+nghttp2_nv MakeHeader(std::string_view name, std::string_view value) {
+    return {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        reinterpret_cast<uint8_t*>(const_cast<char*>(name.data())),
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        reinterpret_cast<uint8_t*>(const_cast<char*>(value.data())),
+        name.size(),
+        value.size(),
+        NGHTTP2_NV_FLAG_NONE,
+    };
+}
+
+// Prior knowledge HTTP/2 client, the pipelined requests are sent as
+// concurrent streams
+class Http2Connection final : public LoadConnection {
+public:
+    explicit Http2Connection(std::uint16_t port) : socket_(Connect(port)) {
+        nghttp2_session_callbacks* callbacks{nullptr};
+        UINVARIANT(nghttp2_session_callbacks_new(&callbacks) == 0, "Failed to init callbacks");
+        const utils::FastScopeGuard delete_guard{[&callbacks]() noexcept { nghttp2_session_callbacks_del(callbacks); }
+        };
+        nghttp2_session_callbacks_set_on_stream_close_callback(
+            callbacks,
+            [](nghttp2_session*, int32_t, uint32_t, void* user_data) {
+                ++static_cast<Http2Connection*>(user_data)->responses_;
+                return 0;
+            }
+        );
+        UINVARIANT(nghttp2_session_client_new(&session_, callbacks, this) == 0, "Failed to init client");
+
+        const std::array<nghttp2_settings_entry, 1> settings{
+            nghttp2_settings_entry{NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, NGHTTP2_MAX_WINDOW_SIZE}};
+        UINVARIANT(
+            nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, settings.data(), settings.size()) == 0,
+            "Failed to submit settings"
+        );
+    }
+
+    ~Http2Connection() override { nghttp2_session_del(session_); }
+
+private:
+    void DoRoundTrip(std::size_t pipeline, engine::Deadline deadline) override {
+        const std::array<nghttp2_nv, 4> headers{
+            MakeHeader(":method", "GET"),
+            MakeHeader(":scheme", "http"),
+            MakeHeader(":path", kPath),
+            MakeHeader(":authority", "localhost"),
+        };
+        for (std::size_t i = 0; i < pipeline; ++i) {
+            const auto stream_id =
+                nghttp2_submit_request(session_, nullptr, headers.data(), headers.size(), nullptr, nullptr);
+            UINVARIANT(stream_id > 0, "Failed to submit request");
+        }
+
+        responses_ = 0;
+        Flush(deadline);
+        while (responses_ < pipeline) {
+            const auto size = socket_.RecvSome(buffer_.data(), buffer_.size(), deadline);
+            UINVARIANT(size != 0, "Server closed the connection");
+            const auto consumed =
+                nghttp2_session_mem_recv(session_, reinterpret_cast<const uint8_t*>(buffer_.data()), size);
+            UINVARIANT(consumed == static_cast<long>(size), "Failed to parse server frames");
+            // Settings acks and window updates
+            Flush(deadline);
+        }
+    }
+
+    void Flush(engine::Deadline deadline) {
+        output_.clear();
+        const uint8_t* data{nullptr};
+        while (true) {
+            const auto size = nghttp2_session_mem_send(session_, &data);
+            UINVARIANT(size >= 0, "Failed to serialize client frames");
+            if (size == 0) break;
+            output_.append(reinterpret_cast<const char*>(data), size);
+        }
+        if (output_.empty()) return;
+        UINVARIANT(socket_.SendAll(output_.data(), output_.size(), deadline) == output_.size(), "Send failed");
+    }
+
+    engine::io::Socket socket_;
+    nghttp2_session* session_{nullptr};
+    std::size_t responses_{0};
+    std::string output_;
+    std::array<char, 64 * 1024> buffer_{};
+};
+
+double PercentileUs(std::vector<std::chrono::steady_clock::duration>& latencies, double percentile) {
+    if (latencies.empty()) return 0;
+    const auto nth = latencies.begin() + static_cast<std::ptrdiff_t>((latencies.size() - 1) * percentile);
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return std::chrono::duration<double, std::micro>(*nth).count();
+}
+
+// Drives the load from OnAllComponentsLoaded, which is called after the
+// server has started listening as the generator depends on the server
+class LoadGenerator final : public components::ComponentBase {
+public:
+    static constexpr std::string_view kName = "load-generator";
+
+    LoadGenerator(const components::ComponentConfig& config, const components::ComponentContext& context)
+        : components::ComponentBase(config, context) {
+        [[maybe_unused]] const auto& server = context.FindComponent<components::Server>();
+        [[maybe_unused]] const auto& handler = context.FindComponent<BenchmarkHandler>();
+    }
+
+    void OnAllComponentsLoaded() override {
+        UASSERT(current_params);
+        auto& params = *current_params;
+
+        std::vector<std::unique_ptr<LoadConnection>> connections;
+        for (std::size_t i = 0; i < params.connections; ++i) {
+            if (params.http2) {
+                connections.push_back(std::make_unique<Http2Connection>(params.port));
+            } else {
+                connections.push_back(std::make_unique<Http1Connection>(params.port, params.pipeline));
+            }
+        }
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(connections.size());
+        for ([[maybe_unused]] auto _ : params.state) {
+            for (auto& connection : connections) {
+                tasks.push_back(engine::AsyncNoSpan([&connection, &params] { connection->RoundTrip(params.pipeline); })
+                );
+            }
+            for (auto& task : tasks) task.Get();
+            tasks.clear();
+        }
+
+        std::vector<std::chrono::steady_clock::duration> latencies;
+        for (const auto& connection : connections) {
+            const auto& connection_latencies = connection->GetLatencies();
+            latencies.insert(latencies.end(), connection_latencies.begin(), connection_latencies.end());
+        }
+
+        const auto requests = static_cast<double>(params.state.iterations() * params.connections * params.pipeline);
+        params.state.counters["rps"] = benchmark::Counter(requests, benchmark::Counter::kIsRate);
+        params.state.counters["p50_us"] = PercentileUs(latencies, 0.5);
+        params.state.counters["p90_us"] = PercentileUs(latencies, 0.9);
+        params.state.counters["p99_us"] = PercentileUs(latencies, 0.99);
+        params.state.SetItemsProcessed(params.state.iterations() * params.connections * params.pipeline);
+    }
+};
+
+}  // namespace
+
+template <>
+inline constexpr auto components::kConfigFileMode<LoadGenerator> = ConfigFileMode::kNotRequired;
+
+namespace {
+
+void server_request_loop(benchmark::State& state) {
+    BenchmarkParams params{
+        state,
+        FindFreePort(),
+        state.range(0) != 0,
+        static_cast<std::size_t>(state.range(1)),
+        static_cast<std::size_t>(state.range(2)),
+        state.range(3) != 0,
+    };
+    current_params = &params;
+    const utils::FastScopeGuard reset_guard{[]() noexcept { current_params = nullptr; }};
+
+    const auto static_config =
+        fmt::format(kStaticConfigTemplate, params.port, params.http2 ? "2" : "1.1", kPath, params.run_inline);
+    components::RunOnce(
+        components::InMemoryConfig{static_config},
+        components::MinimalServerComponentList().Append<BenchmarkHandler>().Append<LoadGenerator>()
+    );
+}
+
+}  // namespace
+
+BENCHMARK(server_request_loop)
+    ->ArgNames({"http2", "connections", "pipeline", "run_inline"})
+    ->ArgsProduct({{0, 1}, {1, 16}, {1, 16}, {0, 1}})
+    ->UseRealTime();
+
+USERVER_NAMESPACE_END
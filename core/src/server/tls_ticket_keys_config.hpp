@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server {
+
+/// Keys of TLS session tickets from the secdist "tls_session_ticket_keys"
+/// entry, base64 encoded, the current key goes first
+class TlsTicketKeysConfig final {
+public:
+    explicit TlsTicketKeysConfig(const formats::json::Value& doc)
+        : keys_(doc["tls_session_ticket_keys"].As<std::unordered_map<std::string, std::vector<std::string>>>({})) {}
+
+    std::vector<std::string> GetKeys(const std::string& name) const {
+        auto it = keys_.find(name);
+        if (it == keys_.cend()) {
+            auto message = fmt::format("No keys with name '{}' in secdist 'tls_session_ticket_keys' entry", name);
+            LOG_ERROR() << message;
+            throw std::runtime_error(std::move(message));
+        }
+
+        std::vector<std::string> result;
+        result.reserve(it->second.size());
+        for (const auto& key : it->second) {
+            result.push_back(crypto::base64::Base64Decode(key));
+        }
+        return result;
+    }
+
+private:
+    std::unordered_map<std::string, std::vector<std::string>> keys_;
+};
+
+}  // namespace server
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,224 @@
+#include <server/websocket/deflate.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+constexpr std::string_view kDeflateTail{"\x00\x00\xff\xff", 4};
+
+constexpr int kMinWindowBits = 9;
+constexpr int kMaxWindowBits = 15;
+constexpr int kMemLevel = 8;
+constexpr std::size_t kBufferSize = 16 * 1024;
+
+std::string_view Trim(std::string_view str) noexcept {
+    while (!str.empty() && utils::text::IsAsciiSpace(str.front())) str.remove_prefix(1);
+    while (!str.empty() && utils::text::IsAsciiSpace(str.back())) str.remove_suffix(1);
+    return str;
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+    value = Trim(value);
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        value = value.substr(1, value.size() - 2);
+    }
+    if (value.empty() || value.size() > 2) return std::nullopt;
+
+    int bits = 0;
+    for (const char c : value) {
+        if (c < '0' || c > '9') return std::nullopt;
+        bits = bits * 10 + (c - '0');
+    }
+    // zlib does not support the 8 bit window for raw deflate
+    if (bits < kMinWindowBits || bits > kMaxWindowBits) return std::nullopt;
+    return bits;
+}
+
+std::optional<DeflateParams> ParseOffer(std::string_view offer, const DeflateConfig& config) {
+    const auto params = utils::text::SplitIntoStringViewVector(offer, ";");
+    if (params.empty() || !utils::StrIcaseEqual{}(Trim(params.front()), kExtensionName)) return std::nullopt;
+
+    DeflateParams result;
+    result.server_no_context_takeover = config.server_no_context_takeover;
+    result.client_no_context_takeover = config.client_no_context_takeover;
+    result.server_max_window_bits = config.server_max_window_bits;
+
+    bool has_server_no_context_takeover = false;
+    bool has_client_no_context_takeover = false;
+    bool has_server_max_window_bits = false;
+    bool has_client_max_window_bits = false;
+
+    for (std::size_t i = 1; i < params.size(); ++i) {
+        const auto param = Trim(params[i]);
+        const auto eq_pos = param.find('=');
+        const auto name = Trim(param.substr(0, eq_pos));
+        const auto value = eq_pos == std::string_view::npos ? std::optional<std::string_view>{}
+                                                            : std::optional{param.substr(eq_pos + 1)};
+
+        // Duplicate or malformed parameters make the whole offer invalid
+        if (name == "server_no_context_takeover") {
+            if (has_server_no_context_takeover || value) return std::nullopt;
+            has_server_no_context_takeover = true;
+            result.server_no_context_takeover = true;
+        } else if (name == "client_no_context_takeover") {
+            if (has_client_no_context_takeover || value) return std::nullopt;
+            has_client_no_context_takeover = true;
+            result.client_no_context_takeover = true;
+        } else if (name == "server_max_window_bits") {
+            if (has_server_max_window_bits || !value) return std::nullopt;
+            has_server_max_window_bits = true;
+            const auto bits = ParseWindowBits(*value);
+            if (!bits) return std::nullopt;
+            result.server_max_window_bits = std::min(result.server_max_window_bits, *bits);
+        } else if (name == "client_max_window_bits") {
+            // The client supports limiting its window, the server always
+            // decompresses with the max window and does not ask for it
+            if (has_client_max_window_bits || (value && !ParseWindowBits(*value))) return std::nullopt;
+            has_client_max_window_bits = true;
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    return result;
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions_header, const DeflateConfig& config) {
+    if (!config.enabled) return std::nullopt;
+
+    for (const auto offer : utils::text::SplitIntoStringViewVector(extensions_header, ",")) {
+        auto params = ParseOffer(offer, config);
+        if (params) return params;
+    }
+    return std::nullopt;
+}
+
+std::string MakeDeflateResponseHeader(const DeflateParams& params) {
+    std::string result{kExtensionName};
+    if (params.server_no_context_takeover) result += "; server_no_context_takeover";
+    if (params.client_no_context_takeover) result += "; client_no_context_takeover";
+    if (params.server_max_window_bits != kMaxWindowBits) {
+        result += "; server_max_window_bits=";
+        result += std::to_string(params.server_max_window_bits);
+    }
+    return result;
+}
+
+struct Deflater::Impl final {
+    z_stream stream{};
+};
+
+Deflater::Deflater(int level, int window_bits, bool no_context_takeover)
+    : impl_(std::make_unique<Impl>()), no_context_takeover_(no_context_takeover) {
+    UASSERT(window_bits >= kMinWindowBits && window_bits <= kMaxWindowBits);
+    // Negative window bits ask zlib for the raw deflate without headers
+    const auto ret = deflateInit2(&impl_->stream, level, Z_DEFLATED, -window_bits, kMemLevel, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        throw std::runtime_error(impl_->stream.msg ? impl_->stream.msg : "deflateInit2 failed");
+    }
+}
+
+Deflater::~Deflater() { deflateEnd(&impl_->stream); }
+
+void Deflater::Compress(std::string_view payload, std::string& out) {
+    auto& stream = impl_->stream;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(payload.data()));
+    stream.avail_in = static_cast<uInt>(payload.size());
+
+    out.clear();
+    out.resize(deflateBound(&stream, payload.size()) + kDeflateTail.size());
+    std::size_t produced = 0;
+    while (true) {
+        if (produced == out.size()) out.resize(out.size() * 2);
+        stream.next_out = reinterpret_cast<Bytef*>(out.data() + produced);
+        stream.avail_out = static_cast<uInt>(out.size() - produced);
+
+        const auto ret = deflate(&stream, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            throw std::runtime_error(stream.msg ? stream.msg : "deflate failed");
+        }
+        produced = out.size() - stream.avail_out;
+
+        // The sync flush is complete once zlib has some output space left
+        if (stream.avail_in == 0 && stream.avail_out != 0) break;
+    }
+    out.resize(produced);
+
+    UASSERT(utils::text::EndsWith(out, kDeflateTail));
+    out.resize(out.size() - kDeflateTail.size());
+
+    if (no_context_takeover_) deflateReset(&stream);
+}
+
+struct Inflater::Impl final {
+    z_stream stream{};
+};
+
+Inflater::Inflater() : impl_(std::make_unique<Impl>()) {
+    // The max window fits any client_max_window_bits
+    const auto ret = inflateInit2(&impl_->stream, -kMaxWindowBits);
+    if (ret != Z_OK) {
+        throw std::runtime_error(impl_->stream.msg ? impl_->stream.msg : "inflateInit2 failed");
+    }
+}
+
+Inflater::~Inflater() { inflateEnd(&impl_->stream); }
+
+CloseStatus Inflater::Decompress(std::string_view payload, std::string& out, std::size_t max_size) {
+    auto& stream = impl_->stream;
+    out.clear();
+
+    char buffer[kBufferSize];
+    for (const auto input : {payload, kDeflateTail}) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream.avail_in = static_cast<uInt>(input.size());
+
+        do {
+            stream.next_out = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = sizeof(buffer);
+
+            const auto ret = inflate(&stream, Z_SYNC_FLUSH);
+            if (ret != Z_OK && ret != Z_BUF_ERROR && ret != Z_STREAM_END) {
+                inflateReset(&stream);
+                return CloseStatus::kBadMessageData;
+            }
+
+            const auto produced = sizeof(buffer) - stream.avail_out;
+            if (out.size() + produced > max_size) {
+                inflateReset(&stream);
+                return CloseStatus::kTooBigData;
+            }
+            out.append(buffer, produced);
+
+            if (ret == Z_STREAM_END) {
+                // The message was ended with a final block, the next message
+                // starts a new stream and the appended tail is not needed
+                inflateReset(&stream);
+                return CloseStatus::kNone;
+            }
+        } while (stream.avail_in != 0 || stream.avail_out == 0);
+    }
+
+    return CloseStatus::kNone;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/server/websocket/server.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// Negotiated parameters of the permessage-deflate extension (RFC 7692)
+struct DeflateParams final {
+    bool server_no_context_takeover{false};
+    bool client_no_context_takeover{false};
+    int server_max_window_bits{15};
+};
+
+/// Picks the first acceptable permessage-deflate offer from the
+/// Sec-WebSocket-Extensions request header, std::nullopt if there is none.
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions_header, const DeflateConfig& config);
+
+/// Sec-WebSocket-Extensions response header value for the accepted offer
+std::string MakeDeflateResponseHeader(const DeflateParams& params);
+
+/// Creates a connection with the negotiated permessage-deflate extension,
+/// std::nullopt disables the compression
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    std::optional<DeflateParams> deflate_params
+);
+
+/// Raw deflate compressor of the message payloads
+class Deflater final {
+public:
+    Deflater(int level, int window_bits, bool no_context_takeover);
+    ~Deflater();
+
+    Deflater(const Deflater&) = delete;
+    Deflater& operator=(const Deflater&) = delete;
+
+    /// Compresses the whole message, the trailing 0x00 0x00 0xff 0xff of the
+    /// sync flush is stripped as required by RFC 7692
+    void Compress(std::string_view payload, std::string& out);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+    const bool no_context_takeover_;
+};
+
+/// Raw deflate decompressor of the message payloads
+class Inflater final {
+public:
+    Inflater();
+    ~Inflater();
+
+    Inflater(const Inflater&) = delete;
+    Inflater& operator=(const Inflater&) = delete;
+
+    /// Decompresses the whole message into `out`.
+    /// @returns kNone on success, kTooBigData if the decompressed message is
+    /// bigger than `max_size`, kBadMessageData for malformed data.
+    CloseStatus Decompress(std::string_view payload, std::string& out, std::size_t max_size);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
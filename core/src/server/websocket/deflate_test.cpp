@@ -0,0 +1,136 @@
+#include <server/websocket/deflate.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::websocket::CloseStatus;
+using server::websocket::DeflateConfig;
+namespace impl = server::websocket::impl;
+
+DeflateConfig EnabledConfig() {
+    DeflateConfig config;
+    config.enabled = true;
+    return config;
+}
+
+std::string MakeText(std::size_t size) {
+    std::string result;
+    while (result.size() < size) result += "the quick brown fox jumps over the lazy dog ";
+    result.resize(size);
+    return result;
+}
+
+}  // namespace
+
+TEST(WebsocketDeflate, NegotiateDisabled) {
+    EXPECT_FALSE(impl::NegotiateDeflate("permessage-deflate", DeflateConfig{}));
+}
+
+TEST(WebsocketDeflate, NegotiateDefaults) {
+    const auto params = impl::NegotiateDeflate("permessage-deflate; client_max_window_bits", EnabledConfig());
+    ASSERT_TRUE(params);
+    EXPECT_FALSE(params->server_no_context_takeover);
+    EXPECT_FALSE(params->client_no_context_takeover);
+    EXPECT_EQ(params->server_max_window_bits, 15);
+    EXPECT_EQ(impl::MakeDeflateResponseHeader(*params), "permessage-deflate");
+}
+
+TEST(WebsocketDeflate, NegotiateParams) {
+    auto config = EnabledConfig();
+    config.client_no_context_takeover = true;
+
+    const auto params = impl::NegotiateDeflate(
+        "x-webkit-deflate-frame, permessage-deflate; server_no_context_takeover; server_max_window_bits=\"10\"",
+        config
+    );
+    ASSERT_TRUE(params);
+    EXPECT_TRUE(params->server_no_context_takeover);
+    EXPECT_TRUE(params->client_no_context_takeover);
+    EXPECT_EQ(params->server_max_window_bits, 10);
+    EXPECT_EQ(
+        impl::MakeDeflateResponseHeader(*params),
+        "permessage-deflate; server_no_context_takeover; client_no_context_takeover; server_max_window_bits=10"
+    );
+}
+
+TEST(WebsocketDeflate, NegotiateInvalidOffers) {
+    const auto config = EnabledConfig();
+    EXPECT_FALSE(impl::NegotiateDeflate("", config));
+    EXPECT_FALSE(impl::NegotiateDeflate("permessage-deflate; unknown", config));
+    EXPECT_FALSE(impl::NegotiateDeflate("permessage-deflate; server_max_window_bits=8", config));
+    EXPECT_FALSE(impl::NegotiateDeflate("permessage-deflate; server_max_window_bits", config));
+    EXPECT_FALSE(impl::NegotiateDeflate(
+        "permessage-deflate; server_no_context_takeover; server_no_context_takeover", config
+    ));
+
+    // The next acceptable offer is picked
+    const auto params =
+        impl::NegotiateDeflate("permessage-deflate; unknown, permessage-deflate; server_max_window_bits=12", config);
+    ASSERT_TRUE(params);
+    EXPECT_EQ(params->server_max_window_bits, 12);
+}
+
+TEST(WebsocketDeflate, RoundTripWithContextTakeover) {
+    impl::Deflater deflater{6, 15, /*no_context_takeover*/ false};
+    impl::Inflater inflater;
+
+    const auto message = MakeText(10000);
+    std::string compressed;
+    std::string decompressed;
+    std::size_t first_size = 0;
+    for (int i = 0; i < 3; ++i) {
+        deflater.Compress(message, compressed);
+        if (i == 0) first_size = compressed.size();
+        EXPECT_LT(compressed.size(), message.size());
+
+        ASSERT_EQ(inflater.Decompress(compressed, decompressed, message.size()), CloseStatus::kNone);
+        EXPECT_EQ(decompressed, message);
+    }
+
+    // The following messages reference the previous ones
+    EXPECT_LT(compressed.size(), first_size);
+}
+
+TEST(WebsocketDeflate, RoundTripWithoutContextTakeover) {
+    impl::Deflater deflater{6, 9, /*no_context_takeover*/ true};
+    impl::Inflater inflater;
+
+    std::string compressed;
+    std::string decompressed;
+    for (const std::size_t size : {0, 1, 100, 100000}) {
+        const auto message = MakeText(size);
+        deflater.Compress(message, compressed);
+
+        // Each message is decodable by a fresh inflater
+        impl::Inflater fresh_inflater;
+        ASSERT_EQ(fresh_inflater.Decompress(compressed, decompressed, size), CloseStatus::kNone);
+        EXPECT_EQ(decompressed, message);
+
+        ASSERT_EQ(inflater.Decompress(compressed, decompressed, size), CloseStatus::kNone);
+        EXPECT_EQ(decompressed, message);
+    }
+}
+
+TEST(WebsocketDeflate, DecompressLimits) {
+    impl::Deflater deflater{6, 15, /*no_context_takeover*/ true};
+    impl::Inflater inflater;
+
+    const auto message = MakeText(100000);
+    std::string compressed;
+    std::string decompressed;
+    deflater.Compress(message, compressed);
+    EXPECT_EQ(inflater.Decompress(compressed, decompressed, message.size() - 1), CloseStatus::kTooBigData);
+
+    EXPECT_EQ(inflater.Decompress("\xff\xff\xff\xff", decompressed, message.size()), CloseStatus::kBadMessageData);
+
+    // The inflater is usable after errors
+    ASSERT_EQ(inflater.Decompress(compressed, decompressed, message.size()), CloseStatus::kNone);
+    EXPECT_EQ(decompressed, message);
+}
+
+USERVER_NAMESPACE_END
@@ -75,8 +75,13 @@ void PushRaw(const T& value, V& data) {
 
 namespace frames {
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final) {
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed
+) {
     boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
     frame.resize(sizeof(WSHeader));
@@ -86,7 +91,12 @@ DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is
     hdr->bytes = 0;
     hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
     hdr->bits.opcode = is_text ? kText : kBinary;
-    if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+    if (is_continuation == Continuation::kYes) {
+        hdr->bits.opcode = kContinuation;
+    } else if (is_compressed == Compressed::kYes) {
+        // Only the first frame of a message is marked
+        hdr->bits.reserved = kReservedCompressedBit;
+    }
 
     if (data.size() <= 125) {
         hdr->bits.payloadLen = data.size();
@@ -100,6 +110,28 @@ DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is
     return frame;
 }
 
+void AppendDataFrames(
+    std::string& out,
+    utils::span<const std::byte> data,
+    bool is_text,
+    unsigned fragment_size,
+    Compressed is_compressed
+) {
+    const auto append = [&out](utils::span<const char> header, utils::span<const std::byte> payload) {
+        out.append(header.data(), header.size());
+        out.append(reinterpret_cast<const char*>(payload.data()), payload.size());
+    };
+
+    auto continuation = Continuation::kNo;
+    while (data.size() > fragment_size && fragment_size > 0) {
+        const auto fragment = data.first(fragment_size);
+        append(DataFrameHeader(fragment, is_text, continuation, Final::kNo, is_compressed), fragment);
+        continuation = Continuation::kYes;
+        data = data.last(data.size() - fragment_size);
+    }
+    append(DataFrameHeader(data, is_text, continuation, Final::kYes, is_compressed), data);
+}
+
 std::string CloseFrame(CloseStatusInt status_code) {
     std::string frame;
     frame.resize(sizeof(WSHeader) + sizeof(status_code));
@@ -225,6 +257,8 @@ CloseStatus ReadWSFrameImpl(
             frame.is_text = true;
             [[fallthrough]];
         case kBinary:
+            frame.is_compressed = hdr.bits.reserved & kReservedCompressedBit;
+            [[fallthrough]];
         case kContinuation:
             frame.waiting_continuation = !fin;
             break;
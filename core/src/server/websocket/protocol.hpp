@@ -63,6 +63,9 @@ static_assert(sizeof(WSHeader) == 2);
 
 constexpr inline unsigned int kMaxFrameHeaderSize = sizeof(WSHeader) + sizeof(uint64_t);
 
+// RSV1 marks the compressed messages of the permessage-deflate extension
+constexpr inline unsigned char kReservedCompressedBit = 0b100;
+
 namespace frames {
 
 enum class Continuation {
@@ -75,8 +78,28 @@ enum class Final {
     kNo,
 };
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final);
+enum class Compressed {
+    kYes,
+    kNo,
+};
+
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed = Compressed::kNo
+);
+
+/// Appends the message split into frames of at most `fragment_size` bytes
+/// (0 - do not fragment) to `out`
+void AppendDataFrames(
+    std::string& out,
+    utils::span<const std::byte> data,
+    bool is_text,
+    unsigned fragment_size,
+    Compressed is_compressed = Compressed::kNo
+);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
 
@@ -92,6 +115,7 @@ struct FrameParserState {
     bool pong_received = false;
     bool waiting_continuation = false;
     bool is_text = false;
+    bool is_compressed = false;
     CloseStatusInt remote_close_status = 0;
     size_t offset_when_noblock = 0;
 
@@ -1,5 +1,12 @@
 #include <userver/server/websocket/server.hpp>
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
 #include <userver/components/component.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
@@ -7,6 +14,7 @@
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include "deflate.hpp"
 #include "protocol.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -14,26 +22,115 @@ USERVER_NAMESPACE_BEGIN
 namespace server::websocket {
 
 namespace {
-inline void
-SendExactly(engine::io::WritableBase& writable, utils::span<const char> data1, utils::span<const std::byte> data2) {
-    if (writable.WriteAll({{data1.data(), data1.size()}, {data2.data(), data2.size()}}, {}) !=
-        data1.size() + data2.size())
-        throw(engine::io::IoException() << "Socket closed during transfer");
-}
+
+// Conservative limit on the number of buffers in a single vectored write,
+// IOV_MAX is 1024 on Linux
+constexpr std::size_t kMaxIoDataPerWrite = 512;
 
 Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
 utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) { return utils::as_bytes(span); }
 
+// Frames of a single Send() waiting in the write queue of a connection. Lives
+// on the stack of the sending coroutine until the frames are written.
+struct OutgoingFrames final {
+    void AddHeader(utils::span<const char> header) {
+        UASSERT_MSG(headers.size() + header.size() <= headers.capacity(), "Headers storage should not reallocate");
+        const auto* data = headers.data() + headers.size();
+        headers.append(header.data(), header.size());
+        AddPayload({data, header.size()});
+    }
+
+    void AddPayload(engine::io::IoData data) {
+        if (data.len == 0) return;
+        pieces.push_back(data);
+        size += data.len;
+    }
+
+    boost::container::small_vector<engine::io::IoData, 4> pieces;
+    std::size_t size{0};
+
+    // Storage for the frame headers, IoData pieces point into it
+    std::string headers;
+    // Storage for the compressed payload
+    std::string payload;
+
+    bool is_written{false};
+    std::exception_ptr error;
+};
+
 }  // namespace
 
+DeflateConfig Parse(const yaml_config::YamlConfig& config, formats::parse::To<DeflateConfig>) {
+    DeflateConfig result;
+    result.enabled = config["enabled"].As<bool>(result.enabled);
+    result.server_no_context_takeover =
+        config["server-no-context-takeover"].As<bool>(result.server_no_context_takeover);
+    result.client_no_context_takeover =
+        config["client-no-context-takeover"].As<bool>(result.client_no_context_takeover);
+    result.server_max_window_bits = config["server-max-window-bits"].As<int>(result.server_max_window_bits);
+    result.compression_level = config["compression-level"].As<int>(result.compression_level);
+    result.min_message_size = config["min-message-size"].As<unsigned>(result.min_message_size);
+
+    if (result.server_max_window_bits < 9 || result.server_max_window_bits > 15) {
+        throw std::runtime_error(
+            "Invalid 'server-max-window-bits' value " + std::to_string(result.server_max_window_bits) +
+            ", expected 9..15"
+        );
+    }
+    if (result.compression_level < 0 || result.compression_level > 9) {
+        throw std::runtime_error(
+            "Invalid 'compression-level' value " + std::to_string(result.compression_level) + ", expected 0..9"
+        );
+    }
+    return result;
+}
+
 Config Parse(const yaml_config::YamlConfig& config, formats::parse::To<Config>) {
     return {
         config["max-remote-payload"].As<unsigned>(65536),
         config["fragment-size"].As<unsigned>(65536),
+        config["permessage-deflate"].As<DeflateConfig>(DeflateConfig{}),
     };
 }
 
+struct PreparedMessage::Frames final {
+    std::string plain;
+
+    // Compressed with a fresh deflate context, empty if not compressed
+    std::string deflated;
+    int deflate_window_bits{0};
+
+    std::size_t payload_size{0};
+};
+
+PreparedMessage::PreparedMessage(std::string_view data, bool is_text, const Config& config) {
+    auto frames = std::make_shared<Frames>();
+    frames->payload_size = data.size();
+    impl::frames::AppendDataFrames(frames->plain, MakeBinarySpan(data), is_text, config.fragment_size);
+
+    if (config.deflate.enabled && data.size() >= config.deflate.min_message_size) {
+        impl::Deflater deflater{
+            config.deflate.compression_level,
+            config.deflate.server_max_window_bits,
+            /*no_context_takeover*/ true};
+        std::string compressed;
+        deflater.Compress(data, compressed);
+        impl::frames::AppendDataFrames(
+            frames->deflated,
+            MakeBinarySpan(compressed),
+            is_text,
+            config.fragment_size,
+            impl::frames::Compressed::kYes
+        );
+        frames->deflate_window_bits = config.deflate.server_max_window_bits;
+    }
+
+    frames_ = std::move(frames);
+}
+
+std::size_t PreparedMessage::GetPayloadSize() const noexcept { return frames_->payload_size; }
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
 public:
 private:
@@ -50,6 +147,17 @@ private:
     // and user coroutine with data response.
     engine::Mutex write_mutex_;
 
+    // Frames waiting for the write. The coroutine that obtains write_mutex_
+    // writes all the queued frames at once. queue_mutex_ also orders the
+    // compression of messages with the order of their frames on the wire.
+    engine::Mutex queue_mutex_;
+    std::vector<OutgoingFrames*> write_queue_;
+
+    // Socket supports vectored writes, nullptr for TLS connections
+    engine::io::Socket* const socket_;
+    // Concatenated frames for connections without vectored writes
+    std::string write_buffer_;
+
     const engine::io::Sockaddr remote_addr_;
     Statistics stats_;
 
@@ -59,50 +167,151 @@ private:
 
     Config config;
 
+    const std::optional<impl::DeflateParams> deflate_params_;
+    std::unique_ptr<impl::Deflater> deflater_;
+    std::unique_ptr<impl::Inflater> inflater_;
+    std::string inflate_buffer_;
+
 public:
     WebSocketConnectionImpl(
         std::unique_ptr<engine::io::RwBase> io_,
         const engine::io::Sockaddr& remote_addr,
-        const Config& server_config
+        const Config& server_config,
+        std::optional<impl::DeflateParams> deflate_params
     )
-        : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+        : io(std::move(io_)),
+          socket_(dynamic_cast<engine::io::Socket*>(io.get())),
+          remote_addr_(remote_addr),
+          config(server_config),
+          deflate_params_(deflate_params) {
+        if (deflate_params_) {
+            deflater_ = std::make_unique<impl::Deflater>(
+                config.deflate.compression_level,
+                deflate_params_->server_max_window_bits,
+                deflate_params_->server_no_context_takeover
+            );
+            inflater_ = std::make_unique<impl::Inflater>();
+        }
+    }
 
     ~WebSocketConnectionImpl() override { LOG_TRACE() << "Websocket connection closed"; }
 
+    void AddDataFrames(OutgoingFrames& frames, MessageExtended& message) {
+        auto data_to_send = message.data;
+        auto compressed = impl::frames::Compressed::kNo;
+        if (deflater_ && data_to_send.size() >= config.deflate.min_message_size) {
+            deflater_->Compress(
+                {reinterpret_cast<const char*>(data_to_send.data()), data_to_send.size()}, frames.payload
+            );
+            data_to_send = MakeBinarySpan(frames.payload);
+            compressed = impl::frames::Compressed::kYes;
+        }
+
+        std::size_t frames_count = 1;
+        if (config.fragment_size > 0 && data_to_send.size() > config.fragment_size) {
+            frames_count = (data_to_send.size() + config.fragment_size - 1) / config.fragment_size;
+        }
+        frames.headers.reserve(frames_count * impl::kMaxFrameHeaderSize);
+
+        const bool is_text = message.opcode == impl::WSOpcodes::kText;
+        auto continuation = impl::frames::Continuation::kNo;
+        while (data_to_send.size() > config.fragment_size && config.fragment_size > 0) {
+            const auto fragment = data_to_send.first(config.fragment_size);
+            frames.AddHeader(
+                impl::frames::DataFrameHeader(fragment, is_text, continuation, impl::frames::Final::kNo, compressed)
+            );
+            frames.AddPayload({fragment.data(), fragment.size()});
+            continuation = impl::frames::Continuation::kYes;
+            data_to_send = data_to_send.last(data_to_send.size() - config.fragment_size);
+        }
+        frames.AddHeader(
+            impl::frames::DataFrameHeader(data_to_send, is_text, continuation, impl::frames::Final::kYes, compressed)
+        );
+        frames.AddPayload({data_to_send.data(), data_to_send.size()});
+    }
+
     void SendExtended(MessageExtended& message) {
         stats_.msg_sent++;
         stats_.bytes_sent += message.data.size();
 
+        LOG_TRACE() << "Write message " << message.data.size() << " bytes";
+        OutgoingFrames frames;
+        {
+            const std::unique_lock lock(queue_mutex_);
+            if (message.opcode == impl::WSOpcodes::kPing) {
+                frames.headers.reserve(impl::kMaxFrameHeaderSize);
+                frames.AddHeader(impl::frames::PingFrame());
+            } else if (message.opcode == impl::WSOpcodes::kPong) {
+                frames.headers.reserve(impl::kMaxFrameHeaderSize);
+                frames.AddHeader(impl::frames::MakeControlFrame(impl::WSOpcodes::kPong, message.data));
+                frames.AddPayload({message.data.data(), message.data.size()});
+            } else if (message.close_status.has_value()) {
+                frames.headers = impl::frames::CloseFrame(static_cast<int>(message.close_status.value()));
+                frames.AddPayload({frames.headers.data(), frames.headers.size()});
+            } else if (!message.data.empty()) {
+                AddDataFrames(frames, message);
+            }
+            if (frames.pieces.empty()) return;
+            write_queue_.push_back(&frames);
+        }
+        WriteQueued(frames);
+    }
+
+    void WriteQueued(OutgoingFrames& frames) {
         const std::unique_lock lock(write_mutex_);
+        if (!frames.is_written) {
+            // Frames of other coroutines that were queued while the previous
+            // write was in progress are written together with ours
+            std::vector<OutgoingFrames*> batch;
+            {
+                const std::unique_lock queue_lock(queue_mutex_);
+                batch.swap(write_queue_);
+            }
+            UASSERT(!batch.empty());
 
-        LOG_TRACE() << "Write message " << message.data.size() << " bytes";
-        if (message.opcode == impl::WSOpcodes::kPing) {
-            SendExactly(*io, impl::frames::PingFrame(), {});
-        } else if (message.opcode == impl::WSOpcodes::kPong) {
-            const auto control_frame = impl::frames::MakeControlFrame(impl::WSOpcodes::kPong, message.data);
-            SendExactly(*io, control_frame, message.data);
-        } else if (message.close_status.has_value()) {
-            const auto close_frame = impl::frames::CloseFrame(static_cast<int>(message.close_status.value()));
-            SendExactly(*io, close_frame, {});
-        } else if (!message.data.empty()) {
-            utils::span<const std::byte> data_to_send{message.data};
-            auto continuation = impl::frames::Continuation::kNo;
-            while (data_to_send.size() > config.fragment_size && config.fragment_size > 0) {
-                const auto data_frame_header = impl::frames::DataFrameHeader(
-                    data_to_send.first(config.fragment_size),
-                    message.opcode == impl::WSOpcodes::kText,
-                    continuation,
-                    impl::frames::Final::kNo
-                );
-                SendExactly(*io, data_frame_header, data_to_send.first(config.fragment_size));
-                continuation = impl::frames::Continuation::kYes;
-                data_to_send = data_to_send.last(data_to_send.size() - config.fragment_size);
+            std::exception_ptr error;
+            try {
+                WriteBatch(batch);
+            } catch (const std::exception&) {
+                error = std::current_exception();
+            }
+            for (auto* queued : batch) {
+                queued->error = error;
+                queued->is_written = true;
             }
-            const auto data_frame_header = impl::frames::DataFrameHeader(
-                data_to_send, message.opcode == impl::WSOpcodes::kText, continuation, impl::frames::Final::kYes
-            );
-            SendExactly(*io, data_frame_header, data_to_send);
         }
+
+        if (frames.error) std::rethrow_exception(frames.error);
+    }
+
+    void WriteBatch(const std::vector<OutgoingFrames*>& batch) {
+        std::size_t total_size = 0;
+        std::size_t written = 0;
+
+        if (socket_) {
+            boost::container::small_vector<engine::io::IoData, 16> pieces;
+            for (const auto* queued : batch) {
+                pieces.insert(pieces.end(), queued->pieces.begin(), queued->pieces.end());
+                total_size += queued->size;
+            }
+            for (std::size_t offset = 0; offset < pieces.size(); offset += kMaxIoDataPerWrite) {
+                const auto count = std::min(kMaxIoDataPerWrite, pieces.size() - offset);
+                written += socket_->SendAll(pieces.data() + offset, count, {});
+            }
+        } else {
+            // TLS encrypts each write into separate records, so a single
+            // contiguous write is cheaper than many small ones
+            write_buffer_.clear();
+            for (const auto* queued : batch) {
+                for (const auto& piece : queued->pieces) {
+                    write_buffer_.append(static_cast<const char*>(piece.data), piece.len);
+                }
+                total_size += queued->size;
+            }
+            written = io->WriteAll(write_buffer_.data(), write_buffer_.size(), {});
+        }
+
+        if (written != total_size) throw(engine::io::IoException() << "Socket closed during transfer");
     }
 
     void Send(const Message& message) override {
@@ -123,6 +332,39 @@ public:
         SendExtended(mext);
     }
 
+    void SendPrepared(const PreparedMessage& message) override {
+        const auto& prepared = *message.frames_;
+        stats_.msg_sent++;
+        stats_.bytes_sent += prepared.payload_size;
+
+        // Frames compressed with a fresh context are decodable by the peer only
+        // if the connection does not keep the server compression context
+        const bool use_deflated = deflate_params_ && deflate_params_->server_no_context_takeover &&
+                                  !prepared.deflated.empty() &&
+                                  prepared.deflate_window_bits <= deflate_params_->server_max_window_bits;
+        const auto& serialized = use_deflated ? prepared.deflated : prepared.plain;
+
+        LOG_TRACE() << "Write prepared message " << serialized.size() << " bytes";
+        OutgoingFrames frames;
+        frames.AddPayload({serialized.data(), serialized.size()});
+        {
+            const std::unique_lock lock(queue_mutex_);
+            write_queue_.push_back(&frames);
+        }
+        WriteQueued(frames);
+    }
+
+    CloseStatus Inflate(Message& msg) {
+        if (!inflater_) {
+            // RSV1 without the negotiated extension
+            return CloseStatus::kProtocolError;
+        }
+
+        const auto status = inflater_->Decompress(msg.data, inflate_buffer_, config.max_remote_payload);
+        if (status == CloseStatus::kNone) msg.data.swap(inflate_buffer_);
+        return status;
+    }
+
     bool RecvImpl(Message& msg, bool do_not_wait_for_message_header) {
         msg.data.resize(0);  // do not call .clear() to keep the allocated memory
         frame_.payload = &msg.data;
@@ -177,6 +419,17 @@ public:
             }
             if (frame_.waiting_continuation) continue;
 
+            if (frame_.is_compressed) {
+                frame_.is_compressed = false;
+                const auto inflate_status = Inflate(msg);
+                if (inflate_status != CloseStatus::kNone) {
+                    MessageExtended close_msg{{}, impl::WSOpcodes::kClose, inflate_status};
+                    SendExtended(close_msg);
+                    msg = CloseMessage(inflate_status);
+                    return true;
+                }
+            }
+
             msg.is_text = frame_.is_text;
             stats_.msg_recv++;
             stats_.bytes_recv += msg.data.size();
@@ -219,9 +472,24 @@ WebSocketConnection::~WebSocketConnection() = default;
 
 std::shared_ptr<WebSocketConnection>
 MakeWebSocket(std::unique_ptr<engine::io::RwBase>&& socket, engine::io::Sockaddr&& peer_name, const Config& config) {
-    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config);
+    return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config, std::nullopt);
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    std::optional<DeflateParams> deflate_params
+) {
+    return std::make_shared<WebSocketConnectionImpl>(
+        std::move(socket), std::move(peer_name), config, deflate_params
+    );
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <userver/server/websocket/server.hpp>
+#include "deflate.hpp"
 #include "protocol.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -68,10 +69,21 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
         USERVER_NAMESPACE::http::headers::kWebsocketAccept, websocket::impl::WebsocketSecAnswer(secWebsocketKey)
     );
 
+    auto deflate_params = websocket::impl::NegotiateDeflate(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions), config_.deflate
+    );
+    if (deflate_params) {
+        response.SetHeader(
+            USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+            websocket::impl::MakeDeflateResponseHeader(*deflate_params)
+        );
+    }
+
     request.SetUpgradeWebsocket([context = std::make_shared<server::request::RequestContext>(std::move(context)),
+                                 deflate_params,
                                  this](std::unique_ptr<engine::io::RwBase> socket, engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket), std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
             Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -84,6 +96,10 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
     return "";
 }
 
+PreparedMessage WebsocketHandlerBase::PrepareMessage(std::string_view data, bool is_text) const {
+    return PreparedMessage{data, is_text, config_};
+}
+
 void WebsocketHandlerBase::WriteMetrics(utils::statistics::Writer& writer) const {
     writer["msg"]["sent"] = stats_.msg_sent.load();
     writer["msg"]["recv"] = stats_.msg_recv.load();
@@ -106,6 +122,39 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: object
+        description: settings of the permessage-deflate compression extension
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: accept the compression offers of clients
+                defaultDescription: false
+            server-no-context-takeover:
+                type: boolean
+                description: reset the compression context after each message, required for compressed PreparedMessage
+                defaultDescription: false
+            client-no-context-takeover:
+                type: boolean
+                description: ask clients to reset their compression context after each message
+                defaultDescription: false
+            server-max-window-bits:
+                type: integer
+                description: max compression window size (log2), 9..15
+                defaultDescription: 15
+                minimum: 9
+                maximum: 15
+            compression-level:
+                type: integer
+                description: zlib compression level, 0..9
+                defaultDescription: 6
+                minimum: 0
+                maximum: 9
+            min-message-size:
+                type: integer
+                description: messages smaller than this are sent uncompressed
+                defaultDescription: 128
 )");
 }
 
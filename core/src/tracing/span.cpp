@@ -1,12 +1,16 @@
 #include <tracing/span_impl.hpp>
 
+#include <memory>
 #include <type_traits>
 
+#include <boost/container/static_vector.hpp>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -60,6 +64,16 @@ TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
+// Span::Impl is large, so its storage is taken from a small thread-local pool
+// instead of the allocator. A span may be destroyed on another thread, its
+// storage is then returned to the pool of that thread.
+using ImplStorage = std::aligned_storage_t<sizeof(Span::Impl), alignof(Span::Impl)>;
+constexpr std::size_t kMaxPooledImplStorages = 16;
+
+compiler::ThreadLocal local_impl_storages = [] {
+    return boost::container::static_vector<std::unique_ptr<ImplStorage>, kMaxPooledImplStorages>{};
+};
+
 std::string GenerateSpanId() {
     std::uniform_int_distribution<std::uint64_t> dist;
     const auto random_value = utils::WithDefaultRandom(dist);
@@ -97,8 +111,8 @@ Span::Impl::Impl(
       is_no_log_span_(tracing::Tracer::IsNoLogSpan(name_)),
       log_level_(is_no_log_span_ ? logging::Level::kNone : log_level),
       tracer_(std::move(tracer)),
-      start_system_time_(std::chrono::system_clock::now()),
-      start_steady_time_(std::chrono::steady_clock::now()),
+      start_system_time_(utils::datetime::TscClock::WallNow()),
+      start_steady_time_(utils::datetime::TscClock::now()),
       trace_id_(parent ? parent->GetTraceId() : utils::generators::GenerateUuid()),
       span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
@@ -107,10 +121,19 @@ Span::Impl::Impl(
     if (parent) {
         log_extra_inheritable_ = parent->log_extra_inheritable_;
         local_log_level_ = parent->local_log_level_;
+        tail_sampled_trace_ = parent->tail_sampled_trace_;
+    } else {
+        tail_sampled_trace_ = impl::StartTailSampledTrace();
+        is_tail_sampling_root_ = (tail_sampled_trace_ != nullptr);
     }
 }
 
 Span::Impl::~Impl() {
+    if (tail_sampled_trace_) {
+        LogTailSampled();
+        return;
+    }
+
     if (!ShouldLog()) {
         return;
     }
@@ -123,8 +146,35 @@ Span::Impl::~Impl() {
     }
 }
 
+void Span::Impl::LogTailSampled() {
+    auto& trace = *tail_sampled_trace_;
+    if (HasErrorFlag()) trace.MarkError();
+
+    if (ShouldLog() && !trace.IsDropped()) {
+        impl::SpanRecordCapture capture{logging::GetDefaultLogger().GetFormat()};
+        {
+            const impl::DetachLocalSpansScope ignore_local_span;
+            logging::LogHelper lh{capture, log_level_, source_location_};
+            lh.MarkAsTrace(logging::LogHelper::InternalTag{});
+            std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+        }
+        const auto format = capture.GetFormat();
+        trace.Add(log_level_, format, std::move(capture).ExtractRecord());
+    }
+
+    if (is_tail_sampling_root_) {
+        trace.Complete(utils::datetime::TscClock::now() - start_steady_time_);
+    }
+}
+
+bool Span::Impl::HasErrorFlag() const {
+    const logging::LogExtra::Value kError{true};
+    return log_extra_inheritable_.GetValue(tracing::kErrorFlag) == kError ||
+           (log_extra_local_ && log_extra_local_->GetValue(tracing::kErrorFlag) == kError);
+}
+
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
-    const auto steady_now = std::chrono::steady_clock::now();
+    const auto steady_now = utils::datetime::TscClock::now();
     const auto duration = steady_now - start_steady_time_;
     const auto total_time_ms = std::chrono::duration_cast<RealMilliseconds>(duration).count();
     const auto timestamp_buffer = StartTsToString(start_system_time_);
@@ -200,7 +250,9 @@ bool Span::Impl::ShouldLog() const {
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
     if (do_delete) {
-        std::default_delete<Impl>{}(impl);
+        // Logs the span, so must not be called within the thread-local scope
+        impl->~Impl();
+        impl::DeallocateSpanImplStorage(impl);
     }
 }
 
@@ -394,6 +446,8 @@ const std::string& Span::GetSpanId() const { return pimpl_->GetSpanId(); }
 
 const std::string& Span::GetParentId() const { return pimpl_->GetParentId(); }
 
+const std::string& Span::GetName() const { return pimpl_->GetName(); }
+
 ScopeTime::Duration Span::GetTotalDuration(const std::string& scope_name) const {
     return pimpl_->GetTimeStorage().DurationTotal(scope_name);
 }
@@ -414,6 +468,26 @@ const Span::Impl* GetParentSpanImpl() {
 
 namespace impl {
 
+void* AllocateSpanImplStorage() {
+    {
+        auto storages = local_impl_storages.Use();
+        if (!storages->empty()) {
+            void* const storage = storages->back().release();
+            storages->pop_back();
+            return storage;
+        }
+    }
+    return new ImplStorage;
+}
+
+void DeallocateSpanImplStorage(void* storage) noexcept {
+    std::unique_ptr<ImplStorage> owned_storage{static_cast<ImplStorage*>(storage)};
+    auto storages = local_impl_storages.Use();
+    if (storages->size() != storages->capacity()) {
+        storages->push_back(std::move(owned_storage));
+    }
+}
+
 struct DetachLocalSpansScope::Impl {
     SpanStack old_spans;
 };
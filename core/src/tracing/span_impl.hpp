@@ -16,8 +16,10 @@
 #include <userver/tracing/scope_time.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
+#include <userver/utils/datetime/tsc_clock.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <tracing/tail_sampling.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -61,6 +63,7 @@ public:
     const std::string& GetTraceId() const& noexcept { return trace_id_; }
     const std::string& GetSpanId() const& noexcept { return span_id_; }
     const std::string& GetParentId() const& noexcept { return parent_id_; }
+    const std::string& GetName() const noexcept { return name_; }
 
     std::string GetTraceId() && noexcept { return std::move(trace_id_); }
     std::string GetSpanId() && noexcept { return std::move(span_id_); }
@@ -83,6 +86,9 @@ private:
     static std::string GetParentIdForLogging(const Span::Impl* parent);
     bool ShouldLog() const;
 
+    void LogTailSampled();
+    bool HasErrorFlag() const;
+
     const std::string name_;
     const bool is_no_log_span_;
     logging::Level log_level_;
@@ -97,7 +103,7 @@ private:
     impl::TimeStorage time_storage_;
 
     const std::chrono::system_clock::time_point start_system_time_;
-    const std::chrono::steady_clock::time_point start_steady_time_;
+    const utils::datetime::TscClock::time_point start_steady_time_;
 
     std::string trace_id_;
     std::string span_id_;
@@ -105,6 +111,10 @@ private:
     const ReferenceType reference_type_;
     utils::impl::SourceLocation source_location_;
 
+    // Shared by all the spans of the trace within the process
+    std::shared_ptr<impl::TailSampledTrace> tail_sampled_trace_;
+    bool is_tail_sampling_root_{false};
+
     friend class Span;
     friend class SpanBuilder;
     friend class TagScope;
@@ -116,9 +126,23 @@ using SpanStack = boost::intrusive::list<Span::Impl, boost::intrusive::constant_
 
 const Span::Impl* GetParentSpanImpl();
 
+namespace impl {
+
+// Storages of Span::Impl are reused from a thread-local pool
+void* AllocateSpanImplStorage();
+void DeallocateSpanImplStorage(void* storage) noexcept;
+
+}  // namespace impl
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-    return new Span::Impl(std::forward<Args>(args)...);
+    void* const storage = impl::AllocateSpanImplStorage();
+    try {
+        return new (storage) Span::Impl(std::forward<Args>(args)...);
+    } catch (...) {
+        impl::DeallocateSpanImplStorage(storage);
+        throw;
+    }
 }
 
 }  // namespace tracing
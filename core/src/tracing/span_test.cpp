@@ -4,9 +4,11 @@
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -689,4 +691,59 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
     }
 }
 
+UTEST_F(Span, TailSamplingDropsFastTraces) {
+    tracing::TailSamplingConfig config;
+    config.enabled = true;
+    config.slow_threshold = std::chrono::hours{1};
+    config.sample_rate = 0;
+    tracing::Tracer::SetTailSampling(std::move(config));
+
+    {
+        tracing::Span root("tail_fast_root");
+        tracing::Span child("tail_fast_child");
+    }
+    {
+        tracing::Span root("tail_error_root");
+        {
+            tracing::Span child("tail_error_child");
+            child.AddTag(tracing::kErrorFlag, true);
+        }
+        logging::LogFlush();
+        EXPECT_THAT(GetStreamString(), Not(HasSubstr("tail_error_child"))) << "Spans are kept until the root completes";
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("tail_fast_root")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("tail_fast_child")));
+    EXPECT_THAT(GetStreamString(), HasSubstr("tail_error_root"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("tail_error_child"));
+
+    tracing::Tracer::SetTailSampling(tracing::TailSamplingConfig{});
+}
+
+UTEST_F(Span, TailSamplingKeepsSlowTraces) {
+    tracing::TailSamplingConfig config;
+    config.enabled = true;
+    config.slow_threshold = std::chrono::milliseconds{0};
+    config.sample_rate = 0;
+    tracing::Tracer::SetTailSampling(std::move(config));
+
+    std::optional<tracing::Span> late_child;
+    {
+        tracing::Span root("tail_slow_root");
+        tracing::Span child("tail_slow_child");
+        late_child.emplace(root.CreateChild("tail_late_child"));
+    }
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("tail_slow_root"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("tail_slow_child"));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("tail_late_child")));
+
+    late_child.reset();
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("tail_late_child")) << "The trace is kept, late spans are logged";
+
+    tracing::Tracer::SetTailSampling(tracing::TailSamplingConfig{});
+}
+
 USERVER_NAMESPACE_END
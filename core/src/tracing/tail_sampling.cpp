@@ -0,0 +1,111 @@
+#include <tracing/tail_sampling.hpp>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common.hpp>
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/logger.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+auto& GlobalTailSamplingConfig() {
+    static rcu::Variable<TailSamplingConfig> config{};
+    return config;
+}
+
+}  // namespace
+
+TailSamplingConfig Parse(const formats::json::Value& value, formats::parse::To<TailSamplingConfig>) {
+    TailSamplingConfig result;
+    result.enabled = value["enabled"].As<bool>(result.enabled);
+    result.slow_threshold =
+        std::chrono::milliseconds{value["slow-threshold-ms"].As<std::int64_t>(result.slow_threshold.count())};
+    result.sample_rate = value["sample-rate"].As<double>(result.sample_rate);
+    result.max_spans_per_trace = value["max-spans-per-trace"].As<std::size_t>(result.max_spans_per_trace);
+    return result;
+}
+
+namespace impl {
+
+TailSampledTrace::TailSampledTrace(const TailSamplingConfig& config)
+    : slow_threshold_(config.slow_threshold),
+      sample_rate_(config.sample_rate),
+      max_spans_(config.max_spans_per_trace) {}
+
+bool TailSampledTrace::IsDropped() const noexcept { return state_.load(std::memory_order_relaxed) == State::kDropped; }
+
+void TailSampledTrace::MarkError() noexcept { has_error_.store(true, std::memory_order_relaxed); }
+
+void TailSampledTrace::Add(logging::Level level, logging::Format format, std::string&& record) {
+    Record new_record{level, format, std::move(record)};
+    {
+        const std::lock_guard lock{mutex_};
+        switch (state_.load(std::memory_order_relaxed)) {
+            case State::kBuffering:
+                // Spans above the limit are dropped to bound the memory usage
+                if (records_.size() < max_spans_) records_.push_back(std::move(new_record));
+                return;
+            case State::kDropped:
+                return;
+            case State::kKept:
+                break;
+        }
+    }
+    LogRecord(new_record);
+}
+
+void TailSampledTrace::Complete(std::chrono::steady_clock::duration root_duration) {
+    const bool keep = has_error_.load(std::memory_order_relaxed) || root_duration >= slow_threshold_ ||
+                      (sample_rate_ > 0 && utils::RandRange(1.0) < sample_rate_);
+
+    std::vector<Record> records;
+    {
+        const std::lock_guard lock{mutex_};
+        state_.store(keep ? State::kKept : State::kDropped, std::memory_order_relaxed);
+        records.swap(records_);
+    }
+
+    if (!keep) return;
+    for (const auto& record : records) {
+        LogRecord(record);
+    }
+}
+
+void TailSampledTrace::LogRecord(const Record& record) {
+    auto& logger = logging::GetDefaultLogger();
+    // The default logger could have been replaced since the record was formatted
+    if (logger.GetFormat() != record.format) return;
+    logger.Trace(record.level, record.text);
+}
+
+std::shared_ptr<TailSampledTrace> StartTailSampledTrace() {
+    const auto config = GlobalTailSamplingConfig().Read();
+    if (!config->enabled) return nullptr;
+    return std::make_shared<TailSampledTrace>(*config);
+}
+
+void SetTailSamplingConfig(TailSamplingConfig&& config) { GlobalTailSamplingConfig().Assign(std::move(config)); }
+
+SpanRecordCapture::SpanRecordCapture(logging::Format format) noexcept : LoggerBase(format) {
+    SetLevel(logging::Level::kTrace);
+}
+
+void SpanRecordCapture::Log(logging::Level, std::string_view msg) { record_.assign(msg); }
+
+void SpanRecordCapture::Trace(logging::Level, std::string_view msg) { record_.assign(msg); }
+
+void SpanRecordCapture::PrependCommonTags(logging::impl::TagWriter writer) const {
+    logging::impl::default_::PrependCommonTags(writer);
+}
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace tracing {
+
+/// Settings of the tail-based sampling of spans, see
+/// @ref USERVER_TRACING_TAIL_SAMPLING
+struct TailSamplingConfig final {
+    bool enabled{false};
+    std::chrono::milliseconds slow_threshold{1000};
+    double sample_rate{0.05};
+    std::size_t max_spans_per_trace{1000};
+};
+
+TailSamplingConfig Parse(const formats::json::Value& value, formats::parse::To<TailSamplingConfig>);
+
+namespace impl {
+
+/// @brief Records of the completed spans of a trace, kept in memory until the
+/// local root span of the trace completes.
+///
+/// The root span decides whether the trace is worth logging: it is slow,
+/// some of its spans have the tracing::kErrorFlag tag, or it is selected by
+/// the sample rate. Spans completed after the decision are logged or dropped
+/// right away.
+class TailSampledTrace final {
+public:
+    explicit TailSampledTrace(const TailSamplingConfig& config);
+
+    bool IsDropped() const noexcept;
+
+    void MarkError() noexcept;
+
+    /// Buffers the span record, or logs it if the trace is already kept
+    void Add(logging::Level level, logging::Format format, std::string&& record);
+
+    /// Makes the decision and logs the buffered records if the trace is kept
+    void Complete(std::chrono::steady_clock::duration root_duration);
+
+private:
+    enum class State { kBuffering, kKept, kDropped };
+
+    struct Record final {
+        logging::Level level;
+        logging::Format format;
+        std::string text;
+    };
+
+    static void LogRecord(const Record& record);
+
+    const std::chrono::milliseconds slow_threshold_;
+    const double sample_rate_;
+    const std::size_t max_spans_;
+
+    std::atomic<bool> has_error_{false};
+    std::atomic<State> state_{State::kBuffering};
+
+    std::mutex mutex_;
+    std::vector<Record> records_;
+};
+
+/// Returns nullptr if the tail-based sampling is disabled
+std::shared_ptr<TailSampledTrace> StartTailSampledTrace();
+
+void SetTailSamplingConfig(TailSamplingConfig&& config);
+
+/// Logger that keeps a formatted span record instead of writing it
+class SpanRecordCapture final : public logging::impl::LoggerBase {
+public:
+    explicit SpanRecordCapture(logging::Format format) noexcept;
+
+    void Log(logging::Level level, std::string_view msg) override;
+
+    void Trace(logging::Level level, std::string_view msg) override;
+
+    void PrependCommonTags(logging::impl::TagWriter writer) const override;
+
+    std::string ExtractRecord() && noexcept { return std::move(record_); }
+
+private:
+    std::string record_;
+};
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
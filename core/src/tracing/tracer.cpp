@@ -8,6 +8,7 @@
 
 #include <tracing/no_log_spans.hpp>
 #include <tracing/span_impl.hpp>
+#include <tracing/tail_sampling.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -77,6 +78,8 @@ bool Tracer::IsNoLogSpan(const std::string& name) {
     return ValueMatchesOneOfPrefixes(name, spans->prefixes) || spans->names.find(name) != spans->names.end();
 }
 
+void Tracer::SetTailSampling(TailSamplingConfig&& config) { impl::SetTailSamplingConfig(std::move(config)); }
+
 void Tracer::SetTracer(std::shared_ptr<Tracer> tracer) { GlobalTracer().Assign(std::move(tracer)); }
 
 std::shared_ptr<Tracer> Tracer::GetTracer() { return GlobalTracer().ReadCopy(); }
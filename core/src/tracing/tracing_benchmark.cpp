@@ -1,7 +1,11 @@
 #include <benchmark/benchmark.h>
 
+#include <memory>
+#include <optional>
+
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/tracing/in_place_span.hpp>
 #include <userver/tracing/tracer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +35,33 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+void tracing_child_ctr(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        const tracing::Span root_span{"root"};
+
+        for ([[maybe_unused]] auto _ : state) {
+            tracing::Span span{"child"};
+            benchmark::DoNotOptimize(span);
+        }
+    });
+}
+BENCHMARK(tracing_child_ctr);
+
+void tracing_in_place_child_ctr(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        const tracing::Span root_span{"root"};
+        // InPlaceSpan is too large for the stack
+        auto storage = std::make_unique<std::optional<tracing::InPlaceSpan>>();
+
+        for ([[maybe_unused]] auto _ : state) {
+            storage->emplace("child");
+            benchmark::DoNotOptimize(storage->value().Get());
+            storage->reset();
+        }
+    });
+}
+BENCHMARK(tracing_in_place_child_ctr);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
     auto span = tracer->CreateSpanWithoutParent("name");
     span.AddTag("meta_code", 200);
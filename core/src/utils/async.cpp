@@ -2,6 +2,7 @@
 
 #include <tracing/span_impl.hpp>
 #include <userver/baggage/baggage_manager.hpp>
+#include <userver/baggage/lazy_baggage.hpp>
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/tracing/span.hpp>
 
@@ -26,6 +27,7 @@ SpanWrapCall::Impl::Impl(std::string&& name, InheritVariables inherit_variables)
         storage_.InheritFrom(engine::impl::task_local::GetCurrentStorage());
     } else {
         baggage::kInheritedBaggage.InheritTo(storage_, engine::impl::task_local::InternalTag{});
+        baggage::impl::kLazyInheritedBaggage.InheritTo(storage_, engine::impl::task_local::InternalTag{});
     }
 }
 
@@ -6,6 +6,7 @@
 #include <cerrno>
 #endif
 
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/subprocess/environment_variables.hpp>
 #include <userver/utils/thread_name.hpp>
 
@@ -41,6 +42,18 @@ void MallocStatPrintCb(void* data, const char* msg) {
     *s += msg;
 }
 
+ThreadAllocationCounters QueryThreadAllocationCounters() noexcept {
+    std::uint64_t* allocated = nullptr;
+    std::uint64_t* deallocated = nullptr;
+    size_t size = sizeof(allocated);
+    if (mallctl("thread.allocatedp", &allocated, &size, nullptr, 0) != 0) return {};
+    size = sizeof(deallocated);
+    if (mallctl("thread.deallocatedp", &deallocated, &size, nullptr, 0) != 0) return {};
+    return {allocated, deallocated};
+}
+
+compiler::ThreadLocal local_allocation_counters = [] { return QueryThreadAllocationCounters(); };
+
 }  // namespace
 
 bool IsProfilingEnabledViaEnv() {
@@ -72,6 +85,15 @@ std::error_code EnableBgThreads() {
 
 std::error_code StopBgThreads() { return MallCtl<bool>("background_thread", false); }
 
+ThreadAllocationCounters GetThreadAllocationCounters() noexcept {
+    auto counters = local_allocation_counters.Use();
+    return *counters;
+}
+
+std::error_code SetThreadProfActive(bool active) noexcept { return MallCtl<bool>("thread.prof.active", active); }
+
+std::error_code SetProfThreadActiveInit(bool active) { return MallCtl<bool>("prof.thread_active_init", active); }
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <system_error>
 
@@ -24,6 +25,24 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+/// Counters of the bytes allocated and deallocated by the current thread,
+/// nullptrs if jemalloc is not available
+struct ThreadAllocationCounters final {
+    const std::uint64_t* allocated{nullptr};
+    const std::uint64_t* deallocated{nullptr};
+};
+
+/// The pointers are valid for the lifetime of the current thread and are
+/// cached, so reading the counters costs no mallctl() calls
+ThreadAllocationCounters GetThreadAllocationCounters() noexcept;
+
+/// Enables or disables the sampling of allocations of the current thread
+/// for heap profiles
+std::error_code SetThreadProfActive(bool active) noexcept;
+
+/// Sets whether the sampling for heap profiles is enabled in new threads
+std::error_code SetProfThreadActiveInit(bool active);
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
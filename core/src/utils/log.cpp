@@ -1,8 +1,11 @@
 #include <userver/utils/log.hpp>
 
+#include <algorithm>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
 #include <userver/utils/text_light.hpp>
 
@@ -22,21 +25,26 @@ std::string ToLimitedHex(std::string_view data, size_t limit) {
     }
 }
 
-std::string ToLimitedUtf8(std::string_view data, size_t limit) {
-    if (data.size() <= limit) {
-        if (utils::text::IsUtf8(data)) {
-            return std::string{data};
+std::string ToLimitedUtf8(std::string_view data, size_t limit) { return ToLimitedUtf8(data, limit, data.size()); }
+
+std::string ToLimitedUtf8(std::string_view prefix, size_t limit, size_t total_size) {
+    UASSERT(prefix.size() <= total_size);
+    UASSERT(prefix.size() >= std::min(limit, total_size));
+
+    if (total_size <= limit) {
+        if (utils::text::IsUtf8(prefix)) {
+            return std::string{prefix};
         } else {
-            return fmt::format(FMT_COMPILE("<Non utf-8, total {} bytes>"), data.size());
+            return fmt::format(FMT_COMPILE("<Non utf-8, total {} bytes>"), total_size);
         }
     }
 
-    auto view = std::string_view{data.data(), limit};
+    auto view = prefix.substr(0, limit);
     utils::text::utf8::TrimViewTruncatedEnding(view);
     if (utils::text::IsUtf8(view)) {
-        return fmt::format(FMT_COMPILE("{}...(truncated, total {} bytes)"), view, data.size());
+        return fmt::format(FMT_COMPILE("{}...(truncated, total {} bytes)"), view, total_size);
     } else {
-        return fmt::format(FMT_COMPILE("<Non utf-8, total {} bytes>"), data.size());
+        return fmt::format(FMT_COMPILE("<Non utf-8, total {} bytes>"), total_size);
     }
 }
 
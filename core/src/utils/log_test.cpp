@@ -126,4 +126,14 @@ TEST(TestToLimitedUtf8, MultibyteTruncatedNegative) {
 
 TEST(TestToLimitedUtf8, Empty) { EXPECT_EQ(utils::log::ToLimitedUtf8("", 0), ""); }
 
+TEST(TestToLimitedUtf8, PrefixTruncated) {
+    auto data = utils::log::ToLimitedUtf8(kMultibyteUtf8Data.substr(0, 7), 6, 1000);
+    EXPECT_EQ(data, TruncatedMsg(kMultibyteUtf8Data.substr(0, 5), 1000));
+}
+
+TEST(TestToLimitedUtf8, PrefixComplete) {
+    EXPECT_EQ(utils::log::ToLimitedUtf8(kMultibyteUtf8Data, 30, kMultibyteUtf8Data.size()), kMultibyteUtf8Data);
+    EXPECT_EQ(utils::log::ToLimitedUtf8(kBrokenUtf8Data, 30, kBrokenUtf8Data.size()), NonUtf8Msg(kBrokenUtf8Data.size()));
+}
+
 USERVER_NAMESPACE_END
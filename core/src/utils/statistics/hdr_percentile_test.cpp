@@ -0,0 +1,93 @@
+#include <userver/utils/statistics/hdr_percentile.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HdrPercentile = utils::statistics::HdrPercentile<60'000>;
+
+}  // namespace
+
+static_assert(utils::statistics::kHasWriterSupport<HdrPercentile>);
+
+TEST(HdrPercentile, Zero) {
+    HdrPercentile p;
+
+    EXPECT_EQ(0U, p.GetPercentile(0));
+    EXPECT_EQ(0U, p.GetPercentile(50));
+    EXPECT_EQ(0U, p.GetPercentile(100));
+}
+
+TEST(HdrPercentile, PreciseSmallValues) {
+    HdrPercentile p;
+
+    for (int i = 0; i < 32; i++) p.Account(i);
+
+    EXPECT_EQ(0U, p.GetPercentile(0));
+    EXPECT_EQ(16U, p.GetPercentile(50));
+    EXPECT_EQ(31U, p.GetPercentile(100));
+    EXPECT_EQ(31U, p.GetPercentile(200));
+}
+
+TEST(HdrPercentile, RelativeError) {
+    for (std::size_t value = 1; value <= 60'000; value = value * 5 / 4 + 1) {
+        HdrPercentile p;
+        p.Account(value);
+        const auto result = p.GetPercentile(50);
+        EXPECT_LE(result > value ? result - value : value - result, value / 32) << value;
+    }
+}
+
+TEST(HdrPercentile, Percentiles) {
+    HdrPercentile p;
+
+    for (int i = 0; i < 1000; i++) p.Account(i);
+
+    EXPECT_NEAR(500, p.GetPercentile(50), 500 / 32);
+    EXPECT_NEAR(900, p.GetPercentile(90), 900 / 32);
+    EXPECT_NEAR(999, p.GetPercentile(100), 999 / 32);
+    EXPECT_EQ(1000U, p.Count());
+}
+
+TEST(HdrPercentile, Overflow) {
+    HdrPercentile p;
+
+    p.Account(1'000'000);
+    EXPECT_EQ(60'000U, p.GetPercentile(100));
+}
+
+TEST(HdrPercentile, AddAndReset) {
+    HdrPercentile p1;
+    HdrPercentile p2;
+
+    p1.Account(10);
+    p2.Account(1000);
+    p2.Account(1000);
+    p1.Add(p2);
+
+    EXPECT_EQ(3U, p1.Count());
+    EXPECT_EQ(10U, p1.GetPercentile(0));
+    EXPECT_NEAR(1000, p1.GetPercentile(50), 1000 / 32);
+
+    const HdrPercentile copy = p1;
+    EXPECT_EQ(3U, copy.Count());
+
+    p1.Reset();
+    EXPECT_EQ(0U, p1.Count());
+    EXPECT_EQ(0U, p1.GetPercentile(100));
+}
+
+TEST(HdrPercentile, RecentPeriod) {
+    utils::statistics::RecentPeriod<HdrPercentile, HdrPercentile> timings;
+
+    timings.GetCurrentCounter().Account(42);
+    const auto result = timings.GetStatsForPeriod(std::chrono::seconds{60}, true);
+    EXPECT_EQ(1U, result.Count());
+    EXPECT_EQ(42U, result.GetPercentile(100));
+}
+
+USERVER_NAMESPACE_END
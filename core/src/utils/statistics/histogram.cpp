@@ -7,6 +7,7 @@
 #endif
 
 #include <cmath>
+#include <functional>
 
 #include <userver/utils/statistics/impl/histogram_bucket.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -134,6 +135,17 @@ void Histogram::Account(double value, std::uint64_t count) noexcept {
         return;
     }
 
+    auto& bucket = buckets_[GetBucketIndex(value)];
+    bucket.counter.fetch_add(count, std::memory_order_relaxed);
+}
+
+std::size_t Histogram::GetBucketIndex(double value) const noexcept {
+    if (bucket_count_ > kMaxBPlusBounds) {
+        const auto upper_bounds = impl::histogram::Access::Bounds(GetView());
+        const auto iter = boost::upper_bound(upper_bounds, value, std::less_equal<>{});
+        return iter == upper_bounds.end() ? 0 : (iter.base() - buckets_.get());
+    }
+
     std::size_t block_index = 0;
     for (std::size_t i = 0; i < kBlockLayers; ++i) {
         block_index = 1 + block_index * kBlockWays + LeastGreaterEqualIndex(bounds_[block_index], value);
@@ -141,9 +153,7 @@ void Histogram::Account(double value, std::uint64_t count) noexcept {
     // block_index now points to a block in a hypothetical additional layer.
     const auto pre_bucket_index = block_index - kBlocksCount;
     // 0th bucket is the "infinity" bucket.
-    const auto bucket_index = pre_bucket_index + 1 > bucket_count_ ? 0 : pre_bucket_index + 1;
-    auto& bucket = buckets_[bucket_index];
-    bucket.counter.fetch_add(count, std::memory_order_relaxed);
+    return pre_bucket_index + 1 > bucket_count_ ? 0 : pre_bucket_index + 1;
 }
 
 void ResetMetric(Histogram& histogram) noexcept { impl::histogram::ResetMetric(histogram.buckets_.get()); }
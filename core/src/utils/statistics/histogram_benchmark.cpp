@@ -1,4 +1,5 @@
 #include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/striped_histogram.hpp>
 
 #include <benchmark/benchmark.h>
 #include <boost/range/irange.hpp>
@@ -6,6 +7,7 @@
 #include <userver/utils/algo.hpp>
 #include <userver/utils/rand.hpp>
 #include <utils/gbench_auxilary.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,4 +36,23 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+// All the threads hit the same few buckets, as the handler timings do
+template <typename AnyHistogram>
+void HistogramAccountContended(benchmark::State& state) {
+    const auto bounds = utils::AsContainer<std::vector<double>>(boost::irange(1, 21));
+    AnyHistogram histogram{bounds};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+        for ([[maybe_unused]] auto _ : range) {
+            // inner loop to reduce accounting overhead
+            for (std::size_t i = 0; i < 10; ++i) {
+                histogram.Account(static_cast<double>(i % 2));
+            }
+        }
+    });
+}
+
+BENCHMARK_TEMPLATE(HistogramAccountContended, utils::statistics::Histogram)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK_TEMPLATE(HistogramAccountContended, utils::statistics::StripedHistogram)->RangeMultiplier(2)->Range(1, 32);
+
 USERVER_NAMESPACE_END
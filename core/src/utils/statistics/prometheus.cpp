@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <iterator>
+#include <optional>
 #include <unordered_map>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/fmt.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -22,49 +24,79 @@ namespace {
 
 enum class Typed { kYes, kNo };
 
+// Should be big enough to amortize the consumer calls, and small enough to
+// stay in the cache
+constexpr std::size_t kChunkSize = 64 * 1024;
+
+using ChunkConsumer = utils::function_ref<void(std::string_view)>;
+
 template <Typed IsTyped>
 class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 public:
-    explicit FormatBuilder() = default;
+    FormatBuilder() = default;
+
+    explicit FormatBuilder(ChunkConsumer consumer) : consumer_(consumer) {}
 
     void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels, const MetricValue& value) override {
         if (value.IsHistogram()) {
             HandleHistogram(path, labels, value);
-            return;
+        } else {
+            DumpMetricNameAndType(path, value);
+            DumpLabels(labels);
+            fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
         }
 
-        DumpMetricNameAndType(path, value);
-        DumpLabels(labels);
-        fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
+        if (consumer_ && buf_.size() >= kChunkSize) Flush();
     }
 
-    std::string Release() { return fmt::to_string(buf_); }
+    std::string Release() {
+        UASSERT(!consumer_);
+        return fmt::to_string(buf_);
+    }
+
+    void Flush() {
+        UASSERT(consumer_);
+        if (buf_.size() == 0) return;
+        (*consumer_)(std::string_view{buf_.data(), buf_.size()});
+        // Keeps the capacity, so that the buffer is allocated once per scrape
+        buf_.clear();
+    }
 
 private:
+    template <typename Value>
     void AppendHistogramMetric(
         std::string_view metric_suffix,
         std::string_view path,
-        const std::string_view& upper_bound,
-        std::string_view value,
+        const std::optional<double>& upper_bound,
+        Value value,
         utils::statistics::LabelsSpan labels
     ) {
         fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_{}{{"), path, metric_suffix);
-        if (!upper_bound.empty()) {
-            fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("le=\"{}\""), upper_bound);
+        if (upper_bound) {
+            fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("le=\"{}\""), *upper_bound);
         }
         if (!labels.empty()) {
-            if (!upper_bound.empty()) {
-                fmt::format_to(std::back_inserter(buf_), ",");
+            if (upper_bound) {
+                buf_.push_back(',');
             }
             DumpLabelsRaw(labels);
         }
         fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("}} {}\n"), value);
     }
 
+    void AppendHistogramInfBucket(std::string_view path, std::uint64_t value, utils::statistics::LabelsSpan labels) {
+        fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_bucket{{le=\"+Inf\""), path);
+        if (!labels.empty()) {
+            buf_.push_back(',');
+            DumpLabelsRaw(labels);
+        }
+        fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("}} {}\n"), value);
+    }
+
     void HandleHistogram(std::string_view path, utils::statistics::LabelsSpan labels, const MetricValue& value) {
         static constexpr std::string_view kBucket = "bucket";
 
-        const auto prometheus_name = impl::ToPrometheusName(path);
+        const auto& prometheus_name = GetPrometheusName(path);
         DumpMetricType(prometheus_name, value);
 
         auto histogram = value.AsHistogram();
@@ -72,25 +104,26 @@ private:
         std::uint64_t cumulative_sum = 0;
         for (std::size_t i = 0; i < bucket_count; ++i) {
             cumulative_sum += histogram.GetValueAt(i);
-            AppendHistogramMetric(
-                kBucket,
-                prometheus_name,
-                fmt::to_string(histogram.GetUpperBoundAt(i)),
-                fmt::to_string(cumulative_sum),
-                labels
-            );
+            AppendHistogramMetric(kBucket, prometheus_name, histogram.GetUpperBoundAt(i), cumulative_sum, labels);
         }
         cumulative_sum += histogram.GetValueAtInf();
-        AppendHistogramMetric(kBucket, prometheus_name, "+Inf", fmt::to_string(cumulative_sum), labels);
+        AppendHistogramInfBucket(prometheus_name, cumulative_sum, labels);
         AppendHistogramMetric(
             "count",
             prometheus_name,
-            /* upper_bound */ "",
-            fmt::to_string(histogram.GetTotalCount()),
+            /* upper_bound */ std::nullopt,
+            histogram.GetTotalCount(),
             labels
         );
     }
 
+    const std::string& GetPrometheusName(std::string_view name) {
+        if (const auto* const converted = utils::impl::FindTransparentOrNullptr(histogram_metrics_, name)) {
+            return *converted;
+        }
+        return histogram_metrics_.emplace(name, impl::ToPrometheusName(name)).first->second;
+    }
+
     void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
         if (const auto* const converted = utils::impl::FindTransparentOrNullptr(metrics_, name)) {
             buf_.append(*converted);
@@ -123,13 +156,22 @@ private:
         fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("# TYPE {} {}\n"), prometheus_name, type);
     }
 
+    // Label names repeat across the metrics, so the escaped names are cached
+    const std::string& GetLabelName(std::string_view name) {
+        if (const auto* const converted = utils::impl::FindTransparentOrNullptr(labels_, name)) {
+            return *converted;
+        }
+        return labels_.emplace(name, impl::ToPrometheusLabel(name)).first->second;
+    }
+
     void DumpLabelsRaw(utils::statistics::LabelsSpan labels) {
         bool sep = false;
         for (const auto& label : labels) {
             if (sep) {
                 buf_.push_back(',');
             }
-            fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""), impl::ToPrometheusLabel(label.Name()));
+            buf_.append(GetLabelName(label.Name()));
+            buf_.append(std::string_view{"=\""});
             const auto& value = label.Value();
             std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_), '"', '\'');
             buf_.push_back('"');
@@ -143,8 +185,13 @@ private:
         buf_.push_back('}');
     }
 
+    std::optional<ChunkConsumer> consumer_;
     fmt::memory_buffer buf_;
+    // Metric name -> name with the type line already written
     utils::impl::TransparentMap<std::string, std::string> metrics_;
+    // Histograms write the type line each time
+    utils::impl::TransparentMap<std::string, std::string> histogram_metrics_;
+    utils::impl::TransparentMap<std::string, std::string> labels_;
 };
 
 }  // namespace
@@ -195,6 +242,26 @@ ToPrometheusFormatUntyped(const utils::statistics::Storage& statistics, const ut
     return builder.Release();
 }
 
+void ToPrometheusFormat(
+    const utils::statistics::Storage& statistics,
+    const utils::statistics::Request& request,
+    utils::function_ref<void(std::string_view)> consumer
+) {
+    impl::FormatBuilder<impl::Typed::kYes> builder{consumer};
+    statistics.VisitMetrics(builder, request);
+    builder.Flush();
+}
+
+void ToPrometheusFormatUntyped(
+    const utils::statistics::Storage& statistics,
+    const utils::statistics::Request& request,
+    utils::function_ref<void(std::string_view)> consumer
+) {
+    impl::FormatBuilder<impl::Typed::kNo> builder{consumer};
+    statistics.VisitMetrics(builder, request);
+    builder.Flush();
+}
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
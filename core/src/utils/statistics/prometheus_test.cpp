@@ -3,6 +3,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <userver/formats/json/serialize.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 #include <userver/utils/statistics/storage.hpp>
 #include <userver/utils/text.hpp>
@@ -392,6 +393,39 @@ child{application="processing"} 8
     }
 }
 
+UTEST(MetricsPrometheus, Chunked) {
+    utils::statistics::Histogram histogram{std::vector<double>{1.5, 5}};
+    histogram.Account(2, 3);
+
+    utils::statistics::Storage statistics_storage;
+    auto statistics_holder = statistics_storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        // Big enough to require several chunks
+        for (int i = 0; i < 10000; ++i) {
+            writer["gauge"].ValueWithLabels(i, {"index", std::to_string(i)});
+        }
+        writer["histogram"] = histogram;
+    });
+
+    const auto request = utils::statistics::Request::MakeWithPrefix({}, {{"application", "processing"}});
+    std::string result;
+    std::size_t chunks = 0;
+    ToPrometheusFormat(statistics_storage, request, [&](std::string_view chunk) {
+        EXPECT_FALSE(chunk.empty());
+        result += chunk;
+        ++chunks;
+    });
+
+    EXPECT_GT(chunks, 1);
+    EXPECT_EQ(result, ToPrometheusFormat(statistics_storage, request));
+    EXPECT_NE(
+        result.find("test_histogram_bucket{le=\"+Inf\",application=\"processing\"} 3\n"), std::string::npos
+    );
+
+    std::string untyped_result;
+    ToPrometheusFormatUntyped(statistics_storage, request, [&](std::string_view chunk) { untyped_result += chunk; });
+    EXPECT_EQ(untyped_result, ToPrometheusFormatUntyped(statistics_storage, request));
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -1,7 +1,10 @@
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/statistics/hdr_percentile.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 
+#include <array>
+
 #include <benchmark/benchmark.h>
 
 USERVER_NAMESPACE_BEGIN
@@ -46,4 +49,65 @@ void RecentPeriodOfPercentilesAccountBenchmark(benchmark::State& state) {
 BENCHMARK_TEMPLATE(RecentPeriodOfPercentilesAccountBenchmark, DefaultClock)->ThreadRange(1, 16);
 BENCHMARK_TEMPLATE(RecentPeriodOfPercentilesAccountBenchmark, CoarseClock)->ThreadRange(1, 16);
 
+namespace {
+
+// As in the HTTP handlers statistics
+using LinearPercentile = utils::statistics::Percentile<2048, unsigned int, 120>;
+using HdrPercentile = utils::statistics::HdrPercentile<60'000>;
+
+// The epochs are stored in a std::vector, so only the size of a single epoch
+// is reported
+template <typename Percentile>
+using Timings = utils::statistics::RecentPeriod<Percentile, Percentile>;
+
+constexpr std::size_t kValuesCount = 1024;
+
+template <typename Percentile>
+Timings<Percentile>& GetTimings() {
+    static Timings<Percentile> timings;
+    return timings;
+}
+
+std::array<std::size_t, kValuesCount> MakeValues() {
+    std::array<std::size_t, kValuesCount> values{};
+    std::size_t seed = 1;
+    for (auto& value : values) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        // Mostly small timings with a long tail
+        value = (seed >> 33) % 100 == 0 ? (seed >> 20) % 60'000 : (seed >> 20) % 200;
+    }
+    return values;
+}
+
+}  // namespace
+
+template <typename Percentile>
+void PercentileAccountBenchmark(benchmark::State& state) {
+    static const auto kValues = MakeValues();
+    auto& timings = GetTimings<Percentile>();
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        timings.GetCurrentCounter().Account(kValues[i++ % kValuesCount]);
+    }
+    state.counters["bytes-per-epoch"] = benchmark::Counter(sizeof(Percentile), benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_TEMPLATE(PercentileAccountBenchmark, LinearPercentile)->ThreadRange(1, 16);
+BENCHMARK_TEMPLATE(PercentileAccountBenchmark, HdrPercentile)->ThreadRange(1, 16);
+
+template <typename Percentile>
+void PercentileGetStatsBenchmark(benchmark::State& state) {
+    static const auto kValues = MakeValues();
+    Timings<Percentile> timings;
+    for (const auto value : kValues) timings.GetCurrentCounter().Account(value);
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto stats = timings.GetStatsForPeriod(std::chrono::seconds{60}, true);
+        benchmark::DoNotOptimize(stats.GetPercentile(99));
+    }
+    state.counters["bytes-per-epoch"] = sizeof(Percentile);
+}
+BENCHMARK_TEMPLATE(PercentileGetStatsBenchmark, LinearPercentile);
+BENCHMARK_TEMPLATE(PercentileGetStatsBenchmark, HdrPercentile);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <vector>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+StripedHistogram::StripedHistogram(utils::span<const double> upper_bounds)
+    : bounds_(upper_bounds), counters_(upper_bounds.size() + 1) {}
+
+StripedHistogram::StripedHistogram(StripedHistogram&&) noexcept = default;
+
+StripedHistogram& StripedHistogram::operator=(StripedHistogram&&) noexcept = default;
+
+StripedHistogram::~StripedHistogram() = default;
+
+void StripedHistogram::Account(double value, std::uint64_t count) noexcept {
+    counters_[bounds_.GetBucketIndex(value)].Add(static_cast<std::uintptr_t>(count));
+}
+
+HistogramAggregator StripedHistogram::Aggregate() const {
+    const auto view = bounds_.GetView();
+    std::vector<double> upper_bounds(view.GetBucketCount());
+    for (std::size_t i = 0; i < upper_bounds.size(); ++i) {
+        upper_bounds[i] = view.GetUpperBoundAt(i);
+    }
+
+    HistogramAggregator result{upper_bounds};
+    result.AccountInf(counters_[0].Read());
+    for (std::size_t i = 0; i < upper_bounds.size(); ++i) {
+        result.AccountAt(i, counters_[i + 1].Read());
+    }
+    return result;
+}
+
+void ResetMetric(StripedHistogram& histogram) noexcept {
+    for (auto& counter : histogram.counters_) {
+        counter.Subtract(counter.Read());
+    }
+}
+
+void DumpMetric(Writer& writer, const StripedHistogram& histogram) {
+    const auto aggregator = histogram.Aggregate();
+    writer = aggregator.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
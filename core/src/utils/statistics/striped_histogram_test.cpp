@@ -0,0 +1,105 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <vector>
+
+#include <boost/range/irange.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+auto Bounds() { return std::vector<double>{1.5, 5, 42, 60}; }
+
+template <typename AnyHistogram>
+void AccountSome(AnyHistogram& histogram) {
+    histogram.Account(10);
+    histogram.Account(1.2);
+    histogram.Account(1.8);
+    histogram.Account(100);
+    histogram.Account(30, 4);
+}
+
+}  // namespace
+
+UTEST(StatisticsStripedHistogram, Account) {
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    AccountSome(histogram);
+
+    const auto aggregator = histogram.Aggregate();
+    EXPECT_EQ(fmt::to_string(aggregator.GetView()), "[1.5]=1,[5]=1,[42]=5,[60]=0,[inf]=1");
+    EXPECT_EQ(aggregator.GetView().GetTotalCount(), 8);
+}
+
+UTEST(StatisticsStripedHistogram, SameAsHistogram) {
+    for (const std::size_t bucket_count : {0, 1, 20, 100}) {
+        const auto bounds = utils::AsContainer<std::vector<double>>(boost::irange(std::size_t{1}, bucket_count + 1));
+        utils::statistics::Histogram histogram{bounds};
+        utils::statistics::StripedHistogram striped_histogram{bounds};
+
+        for (const auto value : {0.5, 1.0, 1.5, 7.0, 19.0, 20.0, 20.5, 99.0, 1000.0}) {
+            histogram.Account(value);
+            striped_histogram.Account(value);
+        }
+
+        const auto aggregator = striped_histogram.Aggregate();
+        EXPECT_EQ(aggregator.GetView(), histogram.GetView()) << bucket_count;
+    }
+}
+
+UTEST(StatisticsStripedHistogram, Reset) {
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    AccountSome(histogram);
+    ResetMetric(histogram);
+
+    const utils::statistics::Histogram zero_histogram{Bounds()};
+    const auto zero_aggregator = histogram.Aggregate();
+    EXPECT_EQ(zero_aggregator.GetView(), zero_histogram.GetView());
+
+    histogram.Account(2);
+    const auto aggregator = histogram.Aggregate();
+    EXPECT_EQ(fmt::to_string(aggregator.GetView()), "[1.5]=0,[5]=1,[42]=0,[60]=0,[inf]=0");
+}
+
+UTEST(StatisticsStripedHistogram, Sample) {
+    utils::statistics::Storage storage;
+    utils::statistics::StripedHistogram histogram{Bounds()};
+
+    auto statistics_holder =
+        storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+    AccountSome(histogram);
+
+    const utils::statistics::Snapshot snapshot{storage};
+    EXPECT_EQ(fmt::to_string(snapshot.SingleMetric("test")), "[1.5]=1,[5]=1,[42]=5,[60]=0,[inf]=1");
+}
+
+UTEST_MT(StatisticsStripedHistogram, ConcurrentAccount, 4) {
+    constexpr std::size_t kTasks = 4;
+    constexpr std::uint64_t kIterations = 10000;
+
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kTasks; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&histogram] {
+            for (std::uint64_t j = 0; j < kIterations; ++j) {
+                histogram.Account(3);
+                histogram.Account(1000);
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    const auto aggregator = histogram.Aggregate();
+    EXPECT_EQ(aggregator.GetView().GetValueAt(1), kTasks * kIterations);
+    EXPECT_EQ(aggregator.GetView().GetValueAtInf(), kTasks * kIterations);
+}
+
+USERVER_NAMESPACE_END
@@ -17,6 +17,7 @@
 #include <boost/pfr/core.hpp>
 #include <boost/system/error_code.hpp>
 
+#include <hostinfo/cgroup.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -62,6 +63,7 @@ void ParseProcStat(std::string_view data, SystemStats& stats) {
 
     // proc(5), 1-based
     static constexpr size_t kCommFieldNum = 2;
+    static constexpr size_t kMinfltFieldNum = 10;
     static constexpr size_t kMajfltFieldNum = 12;
     static constexpr size_t kUtimeFieldNum = 14;
     static constexpr size_t kStimeFieldNum = 15;
@@ -89,6 +91,10 @@ void ParseProcStat(std::string_view data, SystemStats& stats) {
                 UASSERT(next_delim_pos < data.size() && data[next_delim_pos] == ' ');
                 break;
 
+            case kMinfltFieldNum:
+                stats.minor_pagefaults = get_current_value();
+                break;
+
             case kMajfltFieldNum:
                 stats.major_pagefaults = get_current_value();
                 break;
@@ -141,6 +147,21 @@ void ParseProcStatIo(std::string_view data, SystemStats& stats) {
     }
 }
 
+void ParseProcSmapsRollup(std::string_view data, SystemStats& stats) {
+    static constexpr std::string_view kAnonHugePagesHeader = "AnonHugePages:";
+
+    const auto pos = data.find(kAnonHugePagesHeader);
+    if (pos == std::string_view::npos) return;
+
+    // "AnonHugePages:      2048 kB"
+    auto value = data.substr(pos + kAnonHugePagesHeader.size());
+    value = value.substr(0, value.find('\n'));
+    const auto begin = value.find_first_not_of(' ');
+    if (begin == std::string_view::npos) return;
+    value = value.substr(begin, value.find(' ', begin) - begin);
+    stats.anon_huge_pages_kb = utils::FromString<int64_t>(std::string{value});
+}
+
 SystemStats GetSystemStatisticsByProcPath(std::string_view path) {
     SystemStats stats;
     try {
@@ -167,6 +188,12 @@ SystemStats GetSystemStatisticsByProcPath(std::string_view path) {
         LOG_LIMITED_DEBUG() << "Could not get I/O stats from " << path << ": " << ex;
     }
 
+    try {
+        ParseProcSmapsRollup(fs::blocking::ReadFileContents(fmt::format("{}/smaps_rollup", path)), stats);
+    } catch (const std::exception& ex) {
+        LOG_LIMITED_DEBUG() << "Could not get memory mapping stats from " << path << ": " << ex;
+    }
+
     return stats;
 }
 
@@ -234,6 +261,7 @@ utils::statistics::impl::SystemStats GetSelfSystemStatisticsFromKernel() {
         if (::getrusage(RUSAGE_SELF, &rusage) != -1) {
             timeradd(&rusage.ru_utime, &rusage.ru_stime, &rusage.ru_utime);
             stats.cpu_time_sec = rusage.ru_utime.tv_sec + rusage.ru_utime.tv_usec * 1e-6;
+            stats.minor_pagefaults = rusage.ru_minflt;
             stats.major_pagefaults = rusage.ru_majflt;
         }
     }
@@ -251,12 +279,25 @@ void DumpMetric(Writer& writer, const SystemStats& stats) {
     put_field("cpu_time_sec", stats.cpu_time_sec);
     put_field("rss_kb", stats.rss_kb);
     put_field("open_files", stats.open_files);
+    put_field("minor_pagefaults", stats.minor_pagefaults);
     put_field("major_pagefaults", stats.major_pagefaults);
+    put_field("anon_huge_pages_kb", stats.anon_huge_pages_kb);
     put_field("io_read_bytes", stats.io_read_bytes);
     put_field("io_write_bytes", stats.io_write_bytes);
 }
 
+void DumpMetric(Writer& writer, const CgroupStats& stats) {
+    const auto put_field = [&writer](std::string_view name, const auto& value) {
+        if (value) writer[name] = *value;
+    };
+    put_field("cpu_limit", stats.cpu_limit);
+    put_field("cpu_periods", stats.cpu_periods);
+    put_field("cpu_throttled_periods", stats.cpu_throttled_periods);
+    put_field("cpu_throttled_sec", stats.cpu_throttled_sec);
+}
+
 static_assert(kHasWriterSupport<SystemStats>);
+static_assert(kHasWriterSupport<CgroupStats>);
 
 SystemStats GetSelfSystemStatistics() {
 #if defined(__linux__)
@@ -278,6 +319,23 @@ SystemStats GetSystemStatisticsByExeName(std::string_view name) {
     return {};
 }
 
+CgroupStats GetCgroupStatistics() {
+    CgroupStats stats;
+#if defined(__linux__)
+    try {
+        // Not hostinfo::CpuLimit(), as the quota may change at runtime
+        stats.cpu_limit = hostinfo::impl::ReadCgroupCpuLimit();
+        const auto cpu_stat = hostinfo::impl::ReadCgroupCpuStat();
+        stats.cpu_periods = cpu_stat.periods;
+        stats.cpu_throttled_periods = cpu_stat.throttled_periods;
+        stats.cpu_throttled_sec = cpu_stat.throttled_sec;
+    } catch (const std::exception& ex) {
+        LOG_LIMITED_DEBUG() << "Could not get cgroup stats: " << ex;
+    }
+#endif
+    return stats;
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -14,15 +14,29 @@ struct SystemStats {
     std::optional<double> cpu_time_sec;
     std::optional<std::int64_t> rss_kb;
     std::optional<std::int64_t> open_files;
+    std::optional<std::int64_t> minor_pagefaults;
     std::optional<std::int64_t> major_pagefaults;
+    // Memory backed by transparent huge pages
+    std::optional<std::int64_t> anon_huge_pages_kb;
     std::optional<std::int64_t> io_read_bytes;
     std::optional<std::int64_t> io_write_bytes;
 };
 
+// CPU quota and CFS throttling of the cgroup of the process
+struct CgroupStats {
+    std::optional<double> cpu_limit;
+    std::optional<std::int64_t> cpu_periods;
+    std::optional<std::int64_t> cpu_throttled_periods;
+    std::optional<double> cpu_throttled_sec;
+};
+
 void DumpMetric(Writer& writer, const SystemStats& stats);
 
+void DumpMetric(Writer& writer, const CgroupStats& stats);
+
 SystemStats GetSelfSystemStatistics();
 SystemStats GetSystemStatisticsByExeName(std::string_view name);
+CgroupStats GetCgroupStatistics();
 
 }  // namespace utils::statistics::impl
 
@@ -24,6 +24,7 @@ SystemStatisticsCollector::~SystemStatisticsCollector() { statistics_holder_.Unr
 void SystemStatisticsCollector::ExtendStatistics(utils::statistics::Writer& writer) {
     engine::CriticalAsyncNoSpan(fs_task_processor_, [&] {
         DumpMetric(writer, utils::statistics::impl::GetSelfSystemStatistics());
+        writer["cgroup"] = utils::statistics::impl::GetCgroupStatistics();
         if (with_nginx_) {
             writer.ValueWithLabels(
                 utils::statistics::impl::GetSystemStatisticsByExeName("nginx"), {"application", "nginx"}
@@ -0,0 +1,122 @@
+#include <userver/utils/striped_token_bucket.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <concurrent/impl/rseq.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kNoSlice = std::numeric_limits<std::size_t>::max();
+
+// At most 1/kMaxCachedShare of max_size is cached in the slices
+constexpr std::size_t kMaxCachedShare = 8;
+constexpr std::size_t kMaxBatchSize = 64;
+
+std::size_t GetSlicesCount() noexcept {
+#ifdef USERVER_IMPL_HAS_RSEQ
+    return concurrent::impl::GetRseqArraySize();
+#else
+    return 0;
+#endif
+}
+
+std::size_t GetCurrentSliceIndex() noexcept {
+#ifdef USERVER_IMPL_HAS_RSEQ
+    // Only the CPU number is taken from rseq. The slices are updated with
+    // atomics, so that the other CPUs could take the cached tokens. The cache
+    // line of a slice is shared only when a thread migrates between CPUs.
+    const auto cpu_id = rseq_cpu_start();
+    if (concurrent::impl::IsCpuIdValid(cpu_id)) return cpu_id;
+#endif
+    return kNoSlice;
+}
+
+std::size_t GetBatchSize(std::size_t max_size, std::size_t slices_count) noexcept {
+    if (slices_count == 0) return 1;
+    return std::clamp(max_size / kMaxCachedShare / slices_count, std::size_t{1}, kMaxBatchSize);
+}
+
+bool TryObtainFrom(std::atomic<std::int64_t>& slice) noexcept {
+    auto tokens = slice.load(std::memory_order_relaxed);
+    while (tokens > 0) {
+        if (slice.compare_exchange_weak(tokens, tokens - 1, std::memory_order_relaxed)) return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+StripedTokenBucket::StripedTokenBucket() : slices_(GetSlicesCount(), 0) {}
+
+StripedTokenBucket::StripedTokenBucket(std::size_t max_size, RefillPolicy policy) : StripedTokenBucket() {
+    SetMaxSize(max_size);
+    SetRefillPolicy(policy);
+}
+
+StripedTokenBucket StripedTokenBucket::MakeUnbounded() {
+    return StripedTokenBucket{std::numeric_limits<std::size_t>::max(), {1, Duration::zero()}};
+}
+
+StripedTokenBucket::~StripedTokenBucket() = default;
+
+bool StripedTokenBucket::IsUnbounded() const { return shared_.IsUnbounded(); }
+
+std::size_t StripedTokenBucket::GetMaxSizeApprox() const { return shared_.GetMaxSizeApprox(); }
+
+double StripedTokenBucket::GetRatePs() const { return shared_.GetRatePs(); }
+
+std::size_t StripedTokenBucket::GetTokensApprox() {
+    std::size_t tokens = shared_.GetTokensApprox();
+    for (const auto& slice : slices_) {
+        tokens += std::max<std::int64_t>(slice->load(std::memory_order_relaxed), 0);
+    }
+    return tokens;
+}
+
+void StripedTokenBucket::SetMaxSize(std::size_t max_size) {
+    shared_.SetMaxSize(max_size);
+    batch_size_.store(GetBatchSize(max_size, slices_.size()), std::memory_order_relaxed);
+    ResetSlices();
+}
+
+void StripedTokenBucket::SetRefillPolicy(RefillPolicy policy) {
+    shared_.SetRefillPolicy(policy);
+    ResetSlices();
+}
+
+bool StripedTokenBucket::Obtain() {
+    const auto slice_index = GetCurrentSliceIndex();
+    if (slice_index == kNoSlice) return shared_.Obtain();
+
+    if (TryObtainFrom(*slices_[slice_index])) return true;
+    return ObtainSlow(slice_index);
+}
+
+bool StripedTokenBucket::ObtainSlow(std::size_t slice_index) {
+    const auto batch_size = batch_size_.load(std::memory_order_relaxed);
+    if (batch_size > 1 && shared_.ObtainAll(batch_size)) {
+        // One of the tokens is used right away
+        slices_[slice_index]->fetch_add(batch_size - 1, std::memory_order_relaxed);
+        return true;
+    }
+    if (shared_.Obtain()) return true;
+
+    // The shared bucket is depleted, rebalance the tokens cached by other CPUs
+    for (std::size_t i = 1; i < slices_.size(); ++i) {
+        if (TryObtainFrom(*slices_[(slice_index + i) % slices_.size()])) return true;
+    }
+    return false;
+}
+
+void StripedTokenBucket::ResetSlices() noexcept {
+    for (auto& slice : slices_) slice->store(0, std::memory_order_relaxed);
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
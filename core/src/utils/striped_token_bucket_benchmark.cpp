@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/striped_token_bucket.hpp>
+#include <userver/utils/token_bucket.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Practically never depleted, so that only the contention is measured
+constexpr std::size_t kMaxSize = 1'000'000'000;
+constexpr utils::TokenBucket::RefillPolicy kFastRefill{1'000, std::chrono::microseconds{1}};
+
+}  // namespace
+
+template <typename Bucket>
+void TokenBucketBenchmark(benchmark::State& state) {
+    Bucket bucket{kMaxSize, kFastRefill};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+        for ([[maybe_unused]] auto _ : range) {
+            // inner loop to reduce accounting overhead
+            for (std::size_t i = 0; i < 10; ++i) {
+                benchmark::DoNotOptimize(bucket.Obtain());
+            }
+        }
+    });
+}
+
+BENCHMARK_TEMPLATE(TokenBucketBenchmark, utils::TokenBucket)->RangeMultiplier(2)->Range(1, 64);
+BENCHMARK_TEMPLATE(TokenBucketBenchmark, utils::StripedTokenBucket)->RangeMultiplier(2)->Range(1, 64);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#include <userver/utils/striped_token_bucket.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr utils::StripedTokenBucket::RefillPolicy kNoRefill{0, utils::StripedTokenBucket::Duration::max()};
+
+}  // namespace
+
+TEST(StripedTokenBucket, Default) {
+    utils::StripedTokenBucket tb;
+    EXPECT_EQ(0, tb.GetMaxSizeApprox());
+    EXPECT_EQ(0, tb.GetTokensApprox());
+    EXPECT_FALSE(tb.Obtain());
+}
+
+TEST(StripedTokenBucket, Unbounded) {
+    auto tb = utils::StripedTokenBucket::MakeUnbounded();
+    EXPECT_TRUE(tb.IsUnbounded());
+    for (int i = 0; i < 10'000; ++i) ASSERT_TRUE(tb.Obtain());
+}
+
+TEST(StripedTokenBucket, Obtain) {
+    utils::StripedTokenBucket tb{3, kNoRefill};
+    EXPECT_EQ(3, tb.GetTokensApprox());
+
+    EXPECT_TRUE(tb.Obtain());
+    EXPECT_TRUE(tb.Obtain());
+    EXPECT_TRUE(tb.Obtain());
+    EXPECT_FALSE(tb.Obtain());
+    EXPECT_EQ(0, tb.GetTokensApprox());
+}
+
+TEST(StripedTokenBucket, CachedTokensAreCounted) {
+    utils::StripedTokenBucket tb{100'000, kNoRefill};
+
+    ASSERT_TRUE(tb.Obtain());
+    EXPECT_EQ(99'999, tb.GetTokensApprox());
+
+    tb.SetMaxSize(10);
+    EXPECT_EQ(10, tb.GetTokensApprox());
+}
+
+UTEST_MT(StripedTokenBucket, NoOverdraftUnderContention, 8) {
+    constexpr std::size_t kTokens = 100'000;
+    utils::StripedTokenBucket tb{kTokens, kNoRefill};
+
+    std::atomic<std::size_t> obtained{0};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < GetThreadCount(); ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+            std::size_t local_obtained = 0;
+            while (tb.Obtain()) ++local_obtained;
+            obtained += local_obtained;
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    // Tokens cached by the slices of other CPUs are rebalanced
+    EXPECT_EQ(obtained.load(), kTokens);
+    EXPECT_EQ(tb.GetTokensApprox(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/impl/logger_base.hpp>
@@ -164,6 +165,23 @@ void UnaryRPC(benchmark::State& state) {
 
 BENCHMARK(UnaryRPC)->DenseRange(1, 4)->Unit(benchmark::kMicrosecond);
 
+void UnaryRPCPolledQueues(benchmark::State& state) {
+    const logging::DefaultLoggerGuard logger_guard{std::make_shared<NoopLogger>()};
+
+    engine::RunStandalone(state.range(0), [&] {
+        server::ServerConfig server_config;
+        server_config.completion_queue_poll_task_processor = &engine::current_task::GetTaskProcessor();
+        GrpcClientTest client_factory{std::move(server_config)};
+        auto client = client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        for (auto _ : state) {
+            UnaryRPCPayload(client);
+        }
+    });
+}
+
+BENCHMARK(UnaryRPCPolledQueues)->DenseRange(1, 4)->Unit(benchmark::kMicrosecond);
+
 void UnaryRPCWithLogging(benchmark::State& state) {
     const logging::DefaultLoggerGuard logger_guard{std::make_shared<NoopLogger>()};
 
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <ugrpc/impl/logging.hpp>
+
+#include <tests/secret_fields.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+sample::ugrpc::SendRequest MakeLargeSendRequest() {
+    sample::ugrpc::SendRequest request;
+    request.mutable_creds()->set_login("some-login-value");
+    request.mutable_creds()->set_password("xxx-password-value");
+    request.set_dest("some-dest");
+    request.mutable_msg()->set_text(std::string(64 * 1024, 'a'));
+    return request;
+}
+
+ugrpc::impl::MessageLoggingOptions MakeOptions(std::size_t max_size) {
+    ugrpc::impl::MessageLoggingOptions options;
+    // kError passes the level check of any default logger
+    options.log_level = logging::Level::kError;
+    options.max_size = max_size;
+    return options;
+}
+
+}  // namespace
+
+void MessageLoggingBench(benchmark::State& state) {
+    const auto request = MakeLargeSendRequest();
+    const auto options = MakeOptions(state.range(0));
+
+    // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+    for (auto _ : state) {
+        auto log = ugrpc::impl::GetMessageForLogging(request, options);
+        benchmark::DoNotOptimize(log);
+    }
+}
+
+BENCHMARK(MessageLoggingBench)->Arg(512)->Arg(4 * 1024)->Arg(1024 * 1024);
+
+void MessageLoggingDebugStringBench(benchmark::State& state) {
+    const auto request = MakeLargeSendRequest();
+
+    // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+    for (auto _ : state) {
+        auto log = request.Utf8DebugString();
+        log.resize(std::min<std::size_t>(log.size(), state.range(0)));
+        benchmark::DoNotOptimize(log);
+    }
+}
+
+BENCHMARK(MessageLoggingDebugStringBench)->Arg(512)->Arg(4 * 1024)->Arg(1024 * 1024);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/ugrpc/protobuf_visit.hpp>
+
+#include <ugrpc/impl/protobuf_utils.hpp>
+
+#include <tests/secret_fields.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+sample::ugrpc::SendRequest MakeSendRequest() {
+    sample::ugrpc::SendRequest request;
+    request.mutable_creds()->set_login("some-login-value");
+    request.mutable_creds()->set_password("xxx-password-value");
+    request.mutable_creds()->set_secret_code("xxx-secret-code");
+    request.set_dest("some-dest");
+    request.mutable_msg()->set_text("msg-text-value");
+    return request;
+}
+
+bool IsSecret(const google::protobuf::FieldDescriptor& field) { return ugrpc::impl::GetFieldOptions(field).secret(); }
+
+}  // namespace
+
+void VisitFieldsRecursiveBench(benchmark::State& state) {
+    auto request = MakeSendRequest();
+
+    // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+    for (auto _ : state) {
+        std::size_t secrets = 0;
+        ugrpc::VisitFieldsRecursive(request, [&secrets](google::protobuf::Message&, const auto& field) {
+            if (IsSecret(field)) ++secrets;
+        });
+        benchmark::DoNotOptimize(secrets);
+    }
+}
+
+BENCHMARK(VisitFieldsRecursiveBench);
+
+void FieldsVisitorBench(benchmark::State& state) {
+    auto request = MakeSendRequest();
+    ugrpc::FieldsVisitor visitor{
+        &IsSecret, {request.GetDescriptor()}, ugrpc::FieldsVisitor::LockBehavior::kNone};
+
+    // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+    for (auto _ : state) {
+        std::size_t secrets = 0;
+        visitor.VisitRecursive(request, [&secrets](google::protobuf::Message&, const auto&) { ++secrets; });
+        benchmark::DoNotOptimize(secrets);
+    }
+}
+
+BENCHMARK(FieldsVisitorBench);
+
+void FieldsVisitorContainsSelectedBench(benchmark::State& state) {
+    const auto request = MakeSendRequest();
+    ugrpc::FieldsVisitor visitor{
+        &IsSecret, {request.GetDescriptor()}, ugrpc::FieldsVisitor::LockBehavior::kNone};
+
+    // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(visitor.ContainsSelected(request.GetDescriptor()));
+    }
+}
+
+BENCHMARK(FieldsVisitorContainsSelectedBench);
+
+USERVER_NAMESPACE_END
@@ -31,6 +31,12 @@ SerializeToByteBuffer(const ::google::protobuf::Message& message, std::size_t bl
 /// message, according to the derived type of @a message
 bool ParseFromByteBuffer(grpc::ByteBuffer&& buffer, ::google::protobuf::Message& message);
 
+/// @overload
+///
+/// Leaves @a buffer intact, e.g. to forward it as is after inspecting the
+/// message. The slices of @a buffer are shared with the parser, not copied.
+bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer, ::google::protobuf::Message& message);
+
 }  // namespace ugrpc
 
 USERVER_NAMESPACE_END
@@ -37,6 +37,17 @@ namespace ugrpc::client {
 /// We allow setting default service_config: pass desired JSON literal
 /// to `default-service-config` parameter
 ///
+/// ## Load balancing
+/// `load-balancing-policy` is a shortcut for the `loadBalancingConfig` of
+/// the default service config:
+/// - `default` - as configured by the service config, `pick_first` if none;
+/// - `pick-first` - all the RPCs go to the first available endpoint;
+/// - `round-robin` - the RPCs are spread evenly across the endpoints;
+/// - `weighted-round-robin` - endpoints get RPCs proportionally to their
+///   capacity, computed from the load reports of the servers. The servers
+///   should have ugrpc::server::middlewares::load_report::Component enabled.
+///   Requires gRPC >= 1.55.
+///
 /// ## Static options:
 /// The default component name for static config is `"grpc-client-factory"`.
 ///
@@ -46,7 +57,10 @@ namespace ugrpc::client {
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
+/// load-balancing-policy | load balancing policy, see above | default
 /// channel-count | Number of underlying grpc::Channel objects | 1
+/// max-channel-count | Upper bound of grpc::Channel objects of a client, extra channels are created when all the channels are loaded | channel-count
+/// channel-streams-threshold | Number of in-flight RPCs after which a channel is considered loaded | 100
 /// middlewares | middlewares names to use | -
 ///
 /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
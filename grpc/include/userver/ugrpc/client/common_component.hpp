@@ -29,6 +29,8 @@ namespace ugrpc::client {
 /// ---- | ----------- | -------------
 /// blocking-task-processor | the task processor for blocking channel creation | -
 /// native-log-level | min log level for the native gRPC library | 'error'
+/// completion-queue-count | count of completion queues to create, if the service has no grpc-server | 1
+/// completion-queue-poll-task-processor | the task processor to poll the completion queues on, instead of dedicated threads | -
 ///
 /// @see ugrpc::client::ClientFactoryComponent
 
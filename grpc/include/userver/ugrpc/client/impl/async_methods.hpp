@@ -156,6 +156,7 @@ private:
     grpc::CompletionQueue& queue_;
     RpcConfigValues config_values_;
     const Middlewares& mws_;
+    StubLease stub_lease_;
 
     CallKind call_kind_{};
 
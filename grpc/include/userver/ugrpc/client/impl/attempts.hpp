@@ -0,0 +1,133 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+struct AttemptsPolicy final {
+    std::size_t attempts{1};
+    std::optional<std::chrono::milliseconds> hedging_delay;
+};
+
+/// Merges the explicit Qos with the GRPC_CLIENT_QOS dynamic config field-wise
+AttemptsPolicy GetAttemptsPolicy(const ClientData& client_data, std::size_t method_id, const Qos& qos);
+
+/// UNAVAILABLE and network errors
+bool IsRetryableError(const RpcError& error) noexcept;
+
+template <typename Future>
+class UnaryAttempt final {
+public:
+    UnaryAttempt(Future&& future, std::size_t index)
+        : future_(std::make_unique<Future>(std::move(future))), index_(index) {}
+
+    Future& GetFuture() noexcept { return *future_; }
+
+    std::size_t GetIndex() const noexcept { return index_; }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return future_->TryGetContextAccessor(); }
+
+private:
+    // Futures are not movable once started, losers are cancelled on destruction
+    std::unique_ptr<Future> future_;
+    std::size_t index_;
+};
+
+/// @brief Performs a unary RPC with retries and hedging according to
+/// Qos::attempts and Qos::hedging_delay.
+/// @param start_attempt `(std::unique_ptr<grpc::ClientContext>) -> ResponseFuture`
+template <typename StartAttempt>
+auto PerformUnaryAttempts(
+    const ClientData& client_data,
+    std::size_t method_id,
+    std::unique_ptr<grpc::ClientContext> context,
+    const Qos& qos,
+    StartAttempt start_attempt
+) {
+    const auto policy = GetAttemptsPolicy(client_data, method_id, qos);
+    if (policy.attempts <= 1) {
+        return start_attempt(std::move(context)).Get();
+    }
+
+    using Future = decltype(start_attempt(std::move(context)));
+    auto& retry_budget = client_data.GetRetryBudget();
+    auto& statistics = client_data.GetStatistics(method_id);
+
+    std::vector<UnaryAttempt<Future>> in_flight;
+    in_flight.reserve(policy.attempts);
+    std::size_t started = 0;
+    bool can_hedge = policy.hedging_delay.has_value();
+
+    const auto start_next = [&] {
+        auto attempt_context = started == 0 ? std::move(context) : std::make_unique<grpc::ClientContext>();
+        in_flight.emplace_back(start_attempt(std::move(attempt_context)), started);
+        ++started;
+    };
+    const auto may_start_next = [&] {
+        return started < policy.attempts && retry_budget.CanRetry() && !engine::current_task::ShouldCancel();
+    };
+
+    start_next();
+    while (true) {
+        const auto deadline = can_hedge && started < policy.attempts
+                                  ? engine::Deadline::FromDuration(*policy.hedging_delay)
+                                  : engine::Deadline{};
+        const auto ready = engine::WaitAnyUntil(deadline, in_flight);
+        if (!ready) {
+            if (engine::current_task::ShouldCancel()) {
+                // Throws RpcCancelledError
+                return in_flight.front().GetFuture().Get();
+            }
+            if (may_start_next()) {
+                statistics.AccountHedged();
+                start_next();
+            } else {
+                // The retry budget is exhausted, wait for the attempts in flight
+                can_hedge = false;
+            }
+            continue;
+        }
+
+        auto& attempt = in_flight[*ready];
+        try {
+            auto response = attempt.GetFuture().Get();
+            retry_budget.AccountOk();
+            if (attempt.GetIndex() != 0) statistics.AccountHedgedWon();
+            return response;
+        } catch (const RpcError& ex) {
+            if (!IsRetryableError(ex)) throw;
+            retry_budget.AccountFail();
+            if (may_start_next()) {
+                statistics.AccountRetried();
+                in_flight.erase(in_flight.begin() + *ready);
+                start_next();
+            } else if (in_flight.size() == 1) {
+                throw;
+            } else {
+                in_flight.erase(in_flight.begin() + *ready);
+            }
+        }
+    }
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
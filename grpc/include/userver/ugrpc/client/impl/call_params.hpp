@@ -9,6 +9,7 @@
 #include <userver/dynamic_config/snapshot.hpp>
 
 #include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/impl/stub_pool.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/client/qos.hpp>
 #include <userver/ugrpc/impl/maybe_owned_string.hpp>
@@ -26,13 +27,15 @@ struct CallParams {
     std::unique_ptr<grpc::ClientContext> context;
     ugrpc::impl::MethodStatistics& statistics;
     const Middlewares& mws;
+    StubLease stub_lease;
 };
 
 CallParams CreateCallParams(
     const ClientData& client_data,
     std::size_t method_id,
     std::unique_ptr<grpc::ClientContext> client_context,
-    const Qos& qos
+    const Qos& qos,
+    StubLease&& stub_lease
 );
 
 CallParams CreateGenericCallParams(
@@ -40,7 +43,8 @@ CallParams CreateGenericCallParams(
     std::string_view call_name,
     std::unique_ptr<grpc::ClientContext> client_context,
     const Qos& qos,
-    std::optional<std::string_view> metrics_call_name
+    std::optional<std::string_view> metrics_call_name,
+    StubLease&& stub_lease
 );
 
 }  // namespace ugrpc::client::impl
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -12,10 +13,12 @@
 #include <userver/dynamic_config/source.hpp>
 #include <userver/testsuite/grpc_control.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/retry_budget.hpp>
 
 #include <userver/ugrpc/client/client_factory_settings.hpp>
 #include <userver/ugrpc/client/fwd.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
+#include <userver/ugrpc/client/impl/stub_pool.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
@@ -47,6 +50,7 @@ struct ClientDependencies final {
     const dynamic_config::Key<ClientQos>* qos{nullptr};
     const ClientFactorySettings& settings;
     DedicatedMethodsConfig dedicated_methods_config;
+    engine::TaskProcessor& channel_task_processor;
 };
 
 struct GenericClientTag final {
@@ -66,12 +70,12 @@ public:
         : dependencies_(std::move(dependencies)),
           metadata_(metadata),
           service_statistics_(&GetServiceStatistics()),
-          default_stubs_(MakeStubs<Service>(dependencies_.channel_token)),
+          default_stubs_(MakeStubs<Service>(dependencies_)),
           dedicated_stubs_(MakeDedicatedStubs<Service>(dependencies_, metadata)) {}
 
     template <typename Service>
     ClientData(ClientDependencies&& dependencies, GenericClientTag, std::in_place_type_t<Service>)
-        : dependencies_(std::move(dependencies)), default_stubs_(MakeStubs<Service>(dependencies_.channel_token)) {}
+        : dependencies_(std::move(dependencies)), default_stubs_(MakeStubs<Service>(dependencies_)) {}
 
     ClientData(ClientData&&) noexcept = default;
     ClientData& operator=(ClientData&&) = delete;
@@ -79,17 +83,19 @@ public:
     ClientData(const ClientData&) = delete;
     ClientData& operator=(const ClientData&) = delete;
 
+    /// The stub is leased until the RPC finishes, the lease should be passed
+    /// to CreateCallParams
     template <typename Service>
-    Stub<Service>& NextStubFromMethodId(std::size_t method_id) const {
-        if (!dedicated_stubs_[method_id].empty()) {
-            return *static_cast<Stub<Service>*>(NextStubPtr(dedicated_stubs_[method_id]).get());
+    LeasedStub<Stub<Service>> NextStubFromMethodId(std::size_t method_id) const {
+        if (dedicated_stubs_[method_id]) {
+            return dedicated_stubs_[method_id]->template Next<Stub<Service>>();
         }
         return NextGenericStub<Service>();
     }
 
     template <typename Service>
-    Stub<Service>& NextGenericStub() const {
-        return *static_cast<Stub<Service>*>(NextStubPtr(default_stubs_).get());
+    LeasedStub<Stub<Service>> NextGenericStub() const {
+        return default_stubs_->template Next<Stub<Service>>();
     }
 
     grpc::CompletionQueue& NextQueue() const;
@@ -112,8 +118,15 @@ public:
 
     const dynamic_config::Key<ClientQos>* GetClientQos() const;
 
+    /// Shared by all the methods of the client, limits Qos::attempts
+    utils::RetryBudget& GetRetryBudget() const { return *retry_budget_; }
+
     std::size_t GetDedicatedChannelCount(std::size_t method_id) const;
 
+    /// Count of the channels used for the methods without dedicated channels,
+    /// including the extra channels created under load
+    std::size_t GetChannelCount() const;
+
 private:
     static std::shared_ptr<grpc::Channel>
     CreateChannelImpl(const ClientDependencies& dependencies, const grpc::string& endpoint);
@@ -124,10 +137,11 @@ private:
         const ugrpc::impl::StaticServiceMetadata& meta
     );
 
-    using StubDeleterType = void (*)(void*);
-    using StubPtr = std::unique_ptr<void, StubDeleterType>;
+    using ChannelFactory = std::function<std::shared_ptr<grpc::Channel>()>;
 
-    using StubPool = utils::FixedArray<StubPtr>;
+    static ChannelFactory MakeChannelFactory(const ClientDependencies& dependencies);
+
+    static std::size_t GetMaxChannelCount(const ClientDependencies& dependencies);
 
     template <typename Service>
     static void StubDeleter(void* ptr) noexcept {
@@ -135,36 +149,49 @@ private:
     }
 
     template <typename Service>
-    static utils::FixedArray<StubPtr> MakeStubs(impl::ChannelCache::Token& channel_token) {
+    static StubPtr MakeStub(const std::shared_ptr<grpc::Channel>& channel) {
+        return StubPtr(Service::NewStub(channel).release(), &StubDeleter<Service>);
+    }
+
+    template <typename Service>
+    static std::shared_ptr<StubPool> MakeStubs(ClientDependencies& dependencies) {
+        auto& channel_token = dependencies.channel_token;
         const std::size_t channel_count = channel_token.GetChannelCount();
-        return utils::GenerateFixedArray(channel_count, [&](std::size_t index) {
-            return StubPtr(Service::NewStub(channel_token.GetChannel(index)).release(), &StubDeleter<Service>);
-        });
+        return std::make_shared<StubPool>(
+            utils::GenerateFixedArray(
+                channel_count, [&](std::size_t index) { return MakeStub<Service>(channel_token.GetChannel(index)); }
+            ),
+            GetMaxChannelCount(dependencies),
+            dependencies.settings.channel_streams_threshold,
+            [channel_factory = MakeChannelFactory(dependencies)] { return MakeStub<Service>(channel_factory()); },
+            dependencies.channel_task_processor
+        );
     }
 
     template <typename Service>
-    static utils::FixedArray<StubPool>
+    static utils::FixedArray<std::unique_ptr<StubPool>>
     MakeDedicatedStubs(ClientDependencies& dependencies, const ugrpc::impl::StaticServiceMetadata& meta) {
         const auto& method_full_names = meta.method_full_names;
         const auto endpoint_string = ugrpc::impl::ToGrpcString(dependencies.endpoint);
         return utils::GenerateFixedArray(method_full_names.size(), [&](std::size_t method_id) {
             const auto count_of_channels = GetDedicatedChannelCountImpl(dependencies, method_id, meta);
-            return utils::GenerateFixedArray(count_of_channels, [&](std::size_t) {
-                return StubPtr(Service::NewStub(CreateChannelImpl(dependencies, endpoint_string)).release(), &StubDeleter<Service>);
-            });
+            if (count_of_channels == 0) return std::unique_ptr<StubPool>{};
+            return std::make_unique<StubPool>(utils::GenerateFixedArray(count_of_channels, [&](std::size_t) {
+                return MakeStub<Service>(CreateChannelImpl(dependencies, endpoint_string));
+            }));
         });
     }
 
-    const StubPtr& NextStubPtr(const utils::FixedArray<StubPtr>& stubs) const;
-
     ugrpc::impl::ServiceStatistics& GetServiceStatistics();
 
     ClientDependencies dependencies_;
     std::optional<ugrpc::impl::StaticServiceMetadata> metadata_{std::nullopt};
     ugrpc::impl::ServiceStatistics* service_statistics_{nullptr};
-    utils::FixedArray<StubPtr> default_stubs_;
-    // method_id -> stub_pool
-    utils::FixedArray<StubPool> dedicated_stubs_;
+    // shared with the background task that adds channels under load
+    std::shared_ptr<StubPool> default_stubs_;
+    // method_id -> stub_pool, nullptr if the method has no dedicated channels
+    utils::FixedArray<std::unique_ptr<StubPool>> dedicated_stubs_;
+    std::unique_ptr<utils::RetryBudget> retry_budget_{std::make_unique<utils::RetryBudget>()};
 };
 
 template <typename Client>
@@ -9,4 +9,5 @@
 #include <utility>
 
 #include <userver/ugrpc/client/client_qos.hpp>
+#include <userver/ugrpc/client/impl/attempts.hpp>
 #include <userver/ugrpc/impl/protobuf_collector.hpp>
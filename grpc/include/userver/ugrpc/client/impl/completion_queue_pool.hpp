@@ -9,7 +9,7 @@ namespace ugrpc::client::impl {
 /// @brief Manages a gRPC completion queue, usable only in clients
 class CompletionQueuePool final : public ugrpc::impl::CompletionQueuePoolBase {
 public:
-    explicit CompletionQueuePool(std::size_t queue_count);
+    explicit CompletionQueuePool(std::size_t queue_count, engine::TaskProcessor* poll_task_processor = nullptr);
 };
 
 }  // namespace ugrpc::client::impl
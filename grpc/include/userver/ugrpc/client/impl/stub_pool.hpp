@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+using StubDeleterType = void (*)(void*);
+using StubPtr = std::unique_ptr<void, StubDeleterType>;
+
+/// Accounts an in-flight RPC of a stub until destroyed or released
+class StubLease final {
+public:
+    StubLease() noexcept = default;
+    explicit StubLease(std::atomic<std::size_t>& in_flight) noexcept;
+
+    StubLease(StubLease&&) noexcept;
+    StubLease& operator=(StubLease&&) noexcept;
+    ~StubLease();
+
+    void Release() noexcept;
+
+private:
+    std::atomic<std::size_t>* in_flight_{nullptr};
+};
+
+template <typename Stub>
+struct LeasedStub final {
+    Stub& stub;
+    StubLease lease;
+};
+
+/// @brief Type-erased stubs of a single service, one per grpc::Channel.
+///
+/// An RPC is started on the stub with the least in-flight RPCs, so that
+/// long-lived streams do not make unary calls queue behind them on the same
+/// channel. When the least loaded stub has at least `streams_threshold`
+/// in-flight RPCs, a stub over a new channel is created in background, up to
+/// `max_size` stubs.
+class StubPool final : public std::enable_shared_from_this<StubPool> {
+public:
+    using StubFactory = std::function<StubPtr()>;
+
+    /// Creates a pool of fixed size
+    explicit StubPool(utils::FixedArray<StubPtr>&& stubs);
+
+    /// Creates a pool that may grow up to `max_size` stubs, new stubs are
+    /// created by `stub_factory` on `blocking_task_processor`
+    StubPool(
+        utils::FixedArray<StubPtr>&& stubs,
+        std::size_t max_size,
+        std::size_t streams_threshold,
+        StubFactory&& stub_factory,
+        engine::TaskProcessor& blocking_task_processor
+    );
+
+    StubPool(StubPool&&) = delete;
+    StubPool& operator=(StubPool&&) = delete;
+    ~StubPool();
+
+    bool IsEmpty() const noexcept;
+
+    std::size_t GetSize() const noexcept;
+
+    template <typename Stub>
+    LeasedStub<Stub> Next() {
+        auto& slot = NextSlot();
+        return {*static_cast<Stub*>(slot.stub.get()), StubLease{slot.in_flight}};
+    }
+
+private:
+    struct Slot final {
+        StubPtr stub{nullptr, nullptr};
+        std::atomic<std::size_t> in_flight{0};
+    };
+
+    Slot& NextSlot();
+
+    void GrowAsync(std::size_t size);
+
+    utils::FixedArray<Slot> slots_;
+    std::atomic<std::size_t> size_;
+    const std::size_t streams_threshold_{0};
+    const StubFactory stub_factory_;
+    engine::TaskProcessor* const blocking_task_processor_{nullptr};
+    std::atomic<bool> is_growing_{false};
+};
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::Qos
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 #include <userver/formats/json_fwd.hpp>
@@ -29,6 +30,23 @@ struct Qos final {
   /// not using timeouts.
     // clang-format on
     std::optional<std::chrono::milliseconds> timeout;
+
+    /// @brief Max count of attempts of a unary RPC, including the first one,
+    /// `timeout` applies to each attempt. Only affects the `Sync*` methods of
+    /// the generated clients, should only be set for idempotent RPCs.
+    ///
+    /// An attempt that fails with `UNAVAILABLE` or a network error is retried
+    /// immediately. Attempts after the first one are only made while the retry
+    /// budget of the client allows it, and are made with a default
+    /// `grpc::ClientContext`, so the metadata that must be sent with each
+    /// attempt should be added by middlewares.
+    std::optional<std::size_t> attempts;
+
+    /// @brief If set, the next attempt is also made when the previous one has
+    /// not finished within the delay (hedging). The first successful response
+    /// is used, the attempts that are still in flight are cancelled.
+    /// Requires `attempts` > 1.
+    std::optional<std::chrono::milliseconds> hedging_delay;
 };
 
 bool operator==(const Qos& lhs, const Qos& rhs) noexcept;
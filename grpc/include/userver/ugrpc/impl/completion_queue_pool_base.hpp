@@ -4,6 +4,7 @@
 
 #include <grpcpp/completion_queue.h>
 
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/fixed_array.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -24,7 +25,12 @@ public:
     grpc::CompletionQueue& NextQueue();
 
 protected:
-    explicit CompletionQueuePoolBase(utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues);
+    // If 'poll_task_processor' is not null, the queues are polled by tasks on it
+    // instead of dedicated threads
+    explicit CompletionQueuePoolBase(
+        utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues,
+        engine::TaskProcessor* poll_task_processor = nullptr
+    );
 
     // protected to prevent destruction via pointer to base.
     ~CompletionQueuePoolBase();
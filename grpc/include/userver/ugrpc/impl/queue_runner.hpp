@@ -3,14 +3,21 @@
 #include <grpcpp/completion_queue.h>
 
 #include <userver/engine/single_use_event.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
+/// @brief Delivers the events of a completion queue to the waiting tasks.
+///
+/// By default the queue is drained by a dedicated thread. If
+/// `poll_task_processor` is passed, the queue is polled by a task on it, so
+/// that the events are delivered from the worker threads without a wakeup of
+/// an extra thread.
 class QueueRunner final {
 public:
-    explicit QueueRunner(grpc::CompletionQueue& queue);
+    explicit QueueRunner(grpc::CompletionQueue& queue, engine::TaskProcessor* poll_task_processor = nullptr);
     ~QueueRunner();
 
 private:
@@ -52,6 +52,16 @@ public:
 
     void AccountCancelled() noexcept;
 
+    // Client-side only, an attempt is started after a failed attempt
+    void AccountRetried() noexcept;
+
+    // Client-side only, an attempt is started while the previous ones are still
+    // in flight
+    void AccountHedged() noexcept;
+
+    // Client-side only, the response of a hedged attempt is used
+    void AccountHedgedWon() noexcept;
+
     friend void DumpMetric(utils::statistics::Writer& writer, const MethodStatistics& stats);
 
     std::uint64_t GetStarted() const noexcept;
@@ -78,6 +88,10 @@ private:
 
     RateCounter deadline_updated_{0};
     RateCounter deadline_cancelled_{0};
+
+    RateCounter retried_{0};
+    RateCounter hedged_{0};
+    RateCounter hedged_won_{0};
 };
 
 struct MethodStatisticsSnapshot final {
@@ -101,6 +115,10 @@ struct MethodStatisticsSnapshot final {
 
     Rate deadline_updated{0};
     Rate deadline_cancelled{0};
+
+    Rate retried{0};
+    Rate hedged{0};
+    Rate hedged_won{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const MethodStatisticsSnapshot& stats);
@@ -57,6 +57,10 @@ public:
     /// @brief Get RPCs kind of method
     CallKind GetCallKind() const { return call_kind_; }
 
+    /// @brief Get the per-call protobuf Arena, nullptr if the Arena is disabled
+    /// by `arena-initial-block-size` of the service.
+    google::protobuf::Arena* GetArena() { return params_.arena; }
+
     /// @brief Returns call context for storing per-call custom data
     ///
     /// The context can be used to pass data from server middleware to client
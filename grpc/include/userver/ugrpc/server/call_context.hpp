@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/server/call_context.hpp
 /// @brief @copybrief ugrpc::server::CallContext
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/tracing/span.hpp>
@@ -61,6 +62,17 @@ public:
     /// @endcode
     utils::AnyStorage<StorageContext>& GetStorageContext();
 
+    /// @brief Returns the per-call protobuf Arena, nullptr if the Arena is
+    /// disabled by `arena-initial-block-size` of the service.
+    ///
+    /// The Arena lives until the end of the RPC, it may be used to allocate the
+    /// messages of streaming reads and the intermediate messages of the handler:
+    ///
+    /// @code
+    /// auto* request = google::protobuf::Arena::Create<Request>(context.GetArena());
+    /// @endcode
+    google::protobuf::Arena* GetArena();
+
 protected:
     /// @cond
     const CallAnyBase& GetCall() const;
@@ -0,0 +1,44 @@
+#pragma once
+
+/// @file userver/ugrpc/server/generic_proxy.hpp
+/// @brief @copybrief ugrpc::server::ProxyUnaryCall
+
+#include <memory>
+#include <string_view>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/ugrpc/client/generic.hpp>
+#include <userver/ugrpc/server/generic_service_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Forwards a unary RPC received by a @ref GenericServiceBase to
+/// a @ref client::GenericClient without parsing the messages.
+///
+/// The request and the response are passed as the original `grpc::ByteBuffer`
+/// slices, which are reference-counted, so the message bodies are neither
+/// copied nor flattened.
+///
+/// Request metadata is not proxied automatically, fill @a client_context
+/// as needed. Trailing metadata of the upstream response is proxied to
+/// the server response.
+///
+/// @param call_name the upstream RPC name, typically `context.GetCallName()`
+/// @returns the upstream response or the upstream error status; in case of
+/// a network failure or an upstream timeout, `UNAVAILABLE`
+/// @throws server::RpcInterruptedError if the server RPC is broken
+GenericServiceBase::GenericResult ProxyUnaryCall(
+    GenericCallContext& context,
+    GenericServiceBase::GenericReaderWriter& stream,
+    const client::GenericClient& client,
+    std::string_view call_name,
+    std::unique_ptr<grpc::ClientContext> client_context = std::make_unique<grpc::ClientContext>(),
+    const client::GenericOptions& options = {}
+);
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <grpcpp/server_context.h>
 
 #include <userver/engine/single_use_event.hpp>
@@ -33,6 +35,19 @@ private:
     engine::SingleUseEvent event_;
 };
 
+/// Remembers when the RPC was received from the completion queue, to measure
+/// for how long the handling task has waited in the task processor queue
+class RpcReceivedEvent final : public ugrpc::impl::AsyncMethodInvocation {
+public:
+    /// @see EventBase::Notify
+    void Notify(bool ok) noexcept override;
+
+    std::chrono::steady_clock::time_point GetReceivedAt() const noexcept { return received_at_; }
+
+private:
+    std::chrono::steady_clock::time_point received_at_{};
+};
+
 ugrpc::impl::AsyncMethodInvocation::WaitStatus Wait(ugrpc::impl::AsyncMethodInvocation& async);
 
 }  // namespace ugrpc::server::impl
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <google/protobuf/arena.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// @brief Per-call protobuf Arena, its initial block is taken from a small
+/// thread-local pool, so that typical calls do not touch the allocator.
+class CallArena final {
+public:
+    explicit CallArena(std::size_t initial_block_size);
+
+    CallArena(CallArena&&) = delete;
+    CallArena& operator=(CallArena&&) = delete;
+
+    google::protobuf::Arena& Get() noexcept { return arena_; }
+
+private:
+    class InitialBlock final {
+    public:
+        explicit InitialBlock(std::size_t size);
+        ~InitialBlock();
+
+        InitialBlock(InitialBlock&&) = delete;
+        InitialBlock& operator=(InitialBlock&&) = delete;
+
+        char* GetData() noexcept { return data_.get(); }
+        std::size_t GetSize() const noexcept { return size_; }
+
+    private:
+        std::unique_ptr<char[]> data_;
+        std::size_t size_;
+    };
+
+    // 'initial_block_' must outlive 'arena_'
+    InitialBlock initial_block_;
+    google::protobuf::Arena arena_;
+};
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
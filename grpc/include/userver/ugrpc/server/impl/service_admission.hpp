@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/status.h>
+
+#include <userver/utils/fixed_array.hpp>
+
+#include <userver/ugrpc/impl/static_metadata.hpp>
+#include <userver/ugrpc/server/impl/service_worker.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// Keeps an RPC accounted in the in-flight counters of ServiceAdmission
+class AdmissionTicket final {
+public:
+    AdmissionTicket() noexcept = default;
+    ~AdmissionTicket();
+
+    AdmissionTicket(AdmissionTicket&&) = delete;
+    AdmissionTicket& operator=(AdmissionTicket&&) = delete;
+
+private:
+    friend class ServiceAdmission;
+
+    std::atomic<std::size_t>* service_in_flight_{nullptr};
+    std::atomic<std::size_t>* method_in_flight_{nullptr};
+};
+
+/// @brief Per-gRPC-service in-flight limits and queue wait time shedding.
+///
+/// The checks are done right after the RPC is received from the completion
+/// queue and before the middlewares run, so the rejected RPCs are cheap.
+class ServiceAdmission final {
+public:
+    ServiceAdmission(const ServiceSettings& settings, const ugrpc::impl::StaticServiceMetadata& metadata);
+
+    /// @returns the error status to finish the RPC with, if it is rejected
+    std::optional<grpc::Status> TryAdmit(
+        std::size_t method_id,
+        std::chrono::steady_clock::time_point received_at,
+        grpc::ServerContext& context,
+        std::string_view call_name,
+        AdmissionTicket& ticket
+    );
+
+private:
+    const std::optional<std::size_t> max_in_flight_;
+    const utils::FixedArray<std::optional<std::size_t>> method_max_in_flight_;
+    const std::chrono::milliseconds max_queue_wait_time_;
+    const bool is_enabled_;
+
+    std::atomic<std::size_t> in_flight_{0};
+    utils::FixedArray<std::atomic<std::size_t>> method_in_flight_;
+};
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
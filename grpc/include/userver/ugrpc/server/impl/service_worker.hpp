@@ -1,8 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <grpcpp/completion_queue.h>
@@ -31,6 +36,12 @@ struct ServiceSettings final {
     Middlewares middlewares;
     logging::LoggerPtr access_tskv_logger;
     const dynamic_config::Source config_source;
+    std::size_t arena_initial_block_size{0};
+    std::optional<std::size_t> max_requests_in_flight{};
+    std::unordered_map<std::string, std::size_t> method_max_requests_in_flight{};
+    std::chrono::milliseconds max_queue_wait_time{0};
+    std::unordered_map<std::string, engine::TaskProcessor*> method_task_processors{};
+    std::unordered_set<std::string> inline_methods{};
 };
 
 /// @brief Listens to requests for a gRPC service, forwarding them to a
@@ -28,11 +28,13 @@
 #include <userver/ugrpc/server/call_context.hpp>
 #include <userver/ugrpc/server/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/server/impl/async_service.hpp>
+#include <userver/ugrpc/server/impl/call_arena.hpp>
 #include <userver/ugrpc/server/impl/call_params.hpp>
 #include <userver/ugrpc/server/impl/call_traits.hpp>
 #include <userver/ugrpc/server/impl/call_utils.hpp>
 #include <userver/ugrpc/server/impl/error_code.hpp>
 #include <userver/ugrpc/server/impl/exceptions.hpp>
+#include <userver/ugrpc/server/impl/service_admission.hpp>
 #include <userver/ugrpc/server/impl/service_worker.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 #include <userver/ugrpc/server/rpc.hpp>
@@ -75,11 +77,19 @@ void ParseGenericCallName(
     std::string_view& method_name
 );
 
+void ValidateMethodSettings(const ServiceSettings& settings, const ugrpc::impl::StaticServiceMetadata& metadata);
+
+engine::TaskProcessor& GetMethodTaskProcessor(const ServiceSettings& settings, std::string_view method_name);
+
+bool IsInlineMethod(const ServiceSettings& settings, std::string_view method_name);
+
 /// Per-gRPC-service data
 template <typename GrpcppService>
 struct ServiceData final {
     ServiceData(const ServiceSettings& settings, const ugrpc::impl::StaticServiceMetadata& metadata)
-        : settings(settings), metadata(metadata) {}
+        : settings(settings), metadata(metadata) {
+        ValidateMethodSettings(this->settings, this->metadata);
+    }
 
     ~ServiceData() { wait_tokens.WaitForAllTokens(); }
 
@@ -89,6 +99,7 @@ struct ServiceData final {
     utils::impl::WaitTokenStorage wait_tokens;
     ugrpc::impl::ServiceStatistics& service_statistics{
         settings.statistics_storage.GetServiceStatistics(metadata, std::nullopt)};
+    ServiceAdmission admission{settings, metadata};
 };
 
 /// Per-gRPC-method data
@@ -104,6 +115,10 @@ struct MethodData final {
     // Remove name of the service and slash
     std::string_view method_name{call_name.substr(service_data.metadata.service_full_name.size() + 1)};
     ugrpc::impl::MethodStatistics& statistics{service_data.service_statistics.GetMethodStatistics(method_id)};
+    engine::TaskProcessor& task_processor{GetMethodTaskProcessor(service_data.settings, method_name)};
+    // Only unary RPCs are short enough to be handled inline
+    const bool is_inline{
+        CallTraits::kCallCategory == CallCategory::kUnary && IsInlineMethod(service_data.settings, method_name)};
 };
 
 template <typename GrpcppService, typename CallTraits>
@@ -112,15 +127,61 @@ public:
     explicit CallData(const MethodData<GrpcppService, CallTraits>& method_data)
         : wait_token_(method_data.service_data.wait_tokens.GetToken()), method_data_(method_data) {
         UASSERT(method_data.method_id < method_data.service_data.metadata.method_full_names.size());
+
+        const auto arena_initial_block_size = method_data_.service_data.settings.arena_initial_block_size;
+        if (arena_initial_block_size != 0) {
+            arena_.emplace(arena_initial_block_size);
+        }
+        if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
+            initial_request_ = &inline_initial_request_.emplace();
+        } else {
+            // The request is owned by the Arena, its destructor is not called
+            initial_request_ = arena_ ? google::protobuf::Arena::Create<InitialRequest>(&arena_->Get())
+                                      : &inline_initial_request_.emplace();
+        }
+    }
+
+    void operator()() && { Serve(); }
+
+    static void ListenAsync(const MethodData<GrpcppService, CallTraits>& data) {
+        if (data.is_inline) {
+            ListenInline(data);
+            return;
+        }
+        engine::CriticalAsyncNoSpan(
+            data.task_processor, utils::LazyPrvalue([&] { return CallData(data); })
+        ).Detach();
+    }
+
+private:
+    using InitialRequest = typename CallTraits::InitialRequest;
+    using RawCall = typename CallTraits::RawCall;
+    using Call = typename CallTraits::Call;
+
+    // Serves the RPCs one by one in a single task, saving a task start per RPC
+    static void ListenInline(const MethodData<GrpcppService, CallTraits>& data) {
+        engine::CriticalAsyncNoSpan(
+            data.task_processor,
+            [data, wait_token = data.service_data.wait_tokens.GetToken()] {
+                while (CallData(data).Serve()) {
+                }
+            }
+        ).Detach();
     }
 
-    void operator()() && {
+    // Returns false if the completion queue is shutting down
+    bool Serve() {
         // Based on the tensorflow code, we must first call AsyncNotifyWhenDone
         // and only then Prepare<>
         // see
         // https://git.ecdf.ed.ac.uk/s1886313/tensorflow/-/blob/438604fc885208ee05f9eef2d0f2c630e1360a83/tensorflow/core/distributed_runtime/rpc/grpc_call.h#L201
         // and grpc::ServerContext::AsyncNotifyWhenDone
-        ugrpc::server::impl::RpcFinishedEvent notify_when_done(engine::current_task::GetCancellationToken(), context_);
+        // The task of inline RPCs outlives them and must not be cancelled with
+        // a cancelled RPC
+        ugrpc::server::impl::RpcFinishedEvent notify_when_done(
+            method_data_.is_inline ? engine::TaskCancellationToken{} : engine::current_task::GetCancellationToken(),
+            context_
+        );
 
         context_.AsyncNotifyWhenDone(notify_when_done.GetTag());
 
@@ -128,7 +189,7 @@ public:
 
         // the request for an incoming RPC must be performed synchronously
         method_data_.service_data.async_service.template Prepare<CallTraits>(
-            method_data_.method_id, context_, initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
+            method_data_.method_id, context_, *initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
         );
 
         // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -141,7 +202,7 @@ public:
             // Do not wait for notify_when_done. When queue is shutting down, it will
             // not be called.
             // https://github.com/grpc/grpc/issues/10136
-            return;
+            return false;
         }
 
         utils::FastScopeGuard await_notify_when_done([&]() noexcept {
@@ -153,22 +214,12 @@ public:
         });
 
         // start a concurrent listener immediately, as advised by gRPC docs
-        ListenAsync(method_data_);
+        if (!method_data_.is_inline) ListenAsync(method_data_);
 
         HandleRpc();
+        return true;
     }
 
-    static void ListenAsync(const MethodData<GrpcppService, CallTraits>& data) {
-        engine::CriticalAsyncNoSpan(
-            data.service_data.settings.task_processor, utils::LazyPrvalue([&] { return CallData(data); })
-        ).Detach();
-    }
-
-private:
-    using InitialRequest = typename CallTraits::InitialRequest;
-    using RawCall = typename CallTraits::RawCall;
-    using Call = typename CallTraits::Call;
-
     void HandleRpc() {
         auto call_name = method_data_.call_name;
         auto service_name = method_data_.service_data.metadata.service_full_name;
@@ -199,7 +250,8 @@ private:
                 *access_tskv_logger,
                 span_->Get(),
                 storage_context,
-                middlewares},
+                middlewares,
+                arena_ ? &arena_->Get() : nullptr},
             raw_responder_
         );
 
@@ -212,7 +264,7 @@ private:
                 CallContext context{responder};
                 if constexpr (CallTraits::kCallCategory == CallCategory::kUnary) {
                     auto result =
-                        (method_data_.service.*(method_data_.service_method))(context, std::move(initial_request_));
+                        (method_data_.service.*(method_data_.service_method))(context, std::move(*initial_request_));
                     Finalize(responder, std::move(result));
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kInputStream) {
                     auto result = (method_data_.service.*(method_data_.service_method))(context, responder);
@@ -220,7 +272,7 @@ private:
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kOutputStream) {
                     auto result =
                         (method_data_.service.*(method_data_.service_method)
-                        )(context, std::move(initial_request_), responder);
+                        )(context, std::move(*initial_request_), responder);
                     Finalize(responder, std::move(result));
                 } else if constexpr (CallTraits::kCallCategory == CallCategory::kBidirectionalStream) {
                     auto result = (method_data_.service.*(method_data_.service_method))(context, responder);
@@ -232,9 +284,18 @@ private:
         };
 
         try {
+            AdmissionTicket admission_ticket;
+            auto rejection = method_data_.service_data.admission.TryAdmit(
+                method_data_.method_id, prepare_.GetReceivedAt(), context_, call_name, admission_ticket
+            );
+            if (rejection) {
+                responder.FinishWithError(*rejection);
+                return;
+            }
+
             ::google::protobuf::Message* initial_request = nullptr;
             if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-                initial_request = &initial_request_;
+                initial_request = initial_request_;
             }
 
             MiddlewareCallContext middleware_context(
@@ -265,9 +326,12 @@ private:
     MethodData<GrpcppService, CallTraits> method_data_;
 
     typename CallTraits::ContextType context_{};
-    InitialRequest initial_request_{};
+    // 'arena_' must outlive 'initial_request_'
+    std::optional<CallArena> arena_{};
+    std::optional<InitialRequest> inline_initial_request_{};
+    InitialRequest* initial_request_{nullptr};
     RawCall raw_responder_{&context_};
-    ugrpc::impl::AsyncMethodInvocation prepare_;
+    RpcReceivedEvent prepare_;
     std::optional<tracing::InPlaceSpan> span_{};
 };
 
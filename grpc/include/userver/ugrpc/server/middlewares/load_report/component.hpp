@@ -0,0 +1,69 @@
+#pragma once
+
+/// @file userver/ugrpc/server/middlewares/load_report/component.hpp
+/// @brief @copybrief ugrpc::server::middlewares::load_report::Component
+
+#include <userver/ugrpc/server/middlewares/base.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Server load report middleware
+namespace ugrpc::server::middlewares::load_report {
+
+class Middleware;
+
+// clang-format off
+
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Component for gRPC server load reports
+///
+/// Sends an ORCA load report in the trailing metadata of every RPC, so that
+/// the clients with `weighted-round-robin` load-balancing-policy (see
+/// ugrpc::client::ClientFactoryComponent) send more RPCs to the less loaded
+/// servers. The report contains:
+/// - `cpu_utilization` - CPU time used by the whole process during the last
+///   `update-period`, divided by the number of CPU cores;
+/// - `in_flight` utilization - the number of RPCs being handled by the
+///   services with this middleware.
+///
+/// The component does **not** have any options for service config.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// update-period | how often to measure the CPU utilization | 1s
+///
+/// ## Static configuration example:
+///
+/// @code
+///   grpc-server-load-report:
+///       update-period: 1s
+/// @endcode
+
+// clang-format on
+
+class Component final : public MiddlewareComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of
+    /// ugrpc::server::middlewares::load_report::Component
+    static constexpr std::string_view kName = "grpc-server-load-report";
+
+    Component(const components::ComponentConfig& config, const components::ComponentContext& context);
+
+    ~Component() override;
+
+    std::shared_ptr<MiddlewareBase> GetMiddleware() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::shared_ptr<Middleware> middleware_;
+    utils::PeriodicTask cpu_utilization_task_;
+};
+
+}  // namespace ugrpc::server::middlewares::load_report
+
+USERVER_NAMESPACE_END
@@ -140,6 +140,16 @@ public:
     /// @throws ugrpc::server::RpcError on an RPC error
     void Write(Response&& response) override;
 
+    /// @brief Write several outgoing messages at once
+    ///
+    /// All the messages except the last one are written with a buffer hint,
+    /// so gRPC may coalesce them into fewer network writes. The last message
+    /// flushes the batch.
+    ///
+    /// @param responses the next messages to write
+    /// @throws ugrpc::server::RpcError on an RPC error
+    void WriteBatch(utils::span<Response> responses) override;
+
     /// @brief Complete the RPC successfully
     ///
     /// `Finish` must not be called multiple times.
@@ -187,6 +197,8 @@ public:
 private:
     enum class State { kNew, kOpen, kFinished };
 
+    void DoWrite(Response& response, grpc::WriteOptions write_options);
+
     impl::RawWriter<Response>& stream_;
     State state_{State::kNew};
 };
@@ -222,6 +234,16 @@ public:
     /// @throws ugrpc::server::RpcError on an RPC error
     void Write(Response&& response) override;
 
+    /// @brief Write several outgoing messages at once
+    ///
+    /// All the messages except the last one are written with a buffer hint,
+    /// so gRPC may coalesce them into fewer network writes. The last message
+    /// flushes the batch.
+    ///
+    /// @param responses the next messages to write
+    /// @throws ugrpc::server::RpcError on an RPC error
+    void WriteBatch(utils::span<Response> responses) override;
+
     /// @brief Complete the RPC successfully
     ///
     /// `Finish` must not be called multiple times.
@@ -267,6 +289,8 @@ public:
     bool IsFinished() const override;
 
 private:
+    void DoWrite(Response& response, grpc::WriteOptions write_options);
+
     impl::RawReaderWriter<Request, Response>& stream_;
     bool are_reads_done_{false};
     bool is_finished_{false};
@@ -400,6 +424,22 @@ void OutputStream<Response>::Write(Response&& response) {
 
 template <typename Response>
 void OutputStream<Response>::Write(Response& response) {
+    // Don't buffer writes, otherwise in an event subscription scenario, events
+    // may never actually be delivered
+    DoWrite(response, grpc::WriteOptions{});
+}
+
+template <typename Response>
+void OutputStream<Response>::WriteBatch(utils::span<Response> responses) {
+    for (std::size_t i = 0; i < responses.size(); ++i) {
+        grpc::WriteOptions write_options{};
+        if (i + 1 != responses.size()) write_options.set_buffer_hint();
+        DoWrite(responses[i], write_options);
+    }
+}
+
+template <typename Response>
+void OutputStream<Response>::DoWrite(Response& response, grpc::WriteOptions write_options) {
     UINVARIANT(state_ != State::kFinished, "'Write' called on a finished stream");
     ApplyResponseHook(&response);
 
@@ -407,10 +447,6 @@ void OutputStream<Response>::Write(Response& response) {
     // streams
     impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
 
-    // Don't buffer writes, otherwise in an event subscription scenario, events
-    // may never actually be delivered
-    grpc::WriteOptions write_options{};
-
     impl::Write(stream_, response, write_options, GetCallName());
 }
 
@@ -505,14 +541,26 @@ void BidirectionalStream<Request, Response>::Write(Response&& response) {
 
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Write(Response& response) {
+    // Don't buffer writes, optimize for ping-pong-style interaction
+    DoWrite(response, grpc::WriteOptions{});
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::WriteBatch(utils::span<Response> responses) {
+    for (std::size_t i = 0; i < responses.size(); ++i) {
+        grpc::WriteOptions write_options{};
+        if (i + 1 != responses.size()) write_options.set_buffer_hint();
+        DoWrite(responses[i], write_options);
+    }
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::DoWrite(Response& response, grpc::WriteOptions write_options) {
     UINVARIANT(!is_finished_, "'Write' called on a finished stream");
     if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
         ApplyResponseHook(&response);
     }
 
-    // Don't buffer writes, optimize for ping-pong-style interaction
-    grpc::WriteOptions write_options{};
-
     try {
         impl::Write(stream_, response, write_options, GetCallName());
     } catch (const RpcInterruptedError&) {
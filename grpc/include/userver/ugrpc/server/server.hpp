@@ -60,6 +60,11 @@ struct ServerConfig final {
     /// of worker threads for best RPS.
     std::size_t completion_queue_num{2};
 
+    /// If set, the completion queues are polled by tasks on this TaskProcessor
+    /// instead of dedicated threads. The RPC events are then delivered without
+    /// cross-thread wakeups at the cost of CPU spent on polling.
+    engine::TaskProcessor* completion_queue_poll_task_processor{nullptr};
+
     /// Optional grpc-core channel args
     /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
     std::unordered_map<std::string, std::string> channel_args{};
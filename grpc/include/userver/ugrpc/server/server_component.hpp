@@ -30,6 +30,7 @@ struct ServiceDefaults;
 /// port | the port to use for all gRPC services, or 0 to pick any available | -
 /// unix-socket-path | unix socket absolute path to listen to, instead of listening on `port` | -
 /// completion-queue-count | count of completion queues to create | 2
+/// completion-queue-poll-task-processor | the task processor to poll the completion queues on, instead of dedicated threads | -
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// enable-channelz | initialize service with runtime info about gRPC connections | false
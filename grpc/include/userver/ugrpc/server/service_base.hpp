@@ -3,6 +3,13 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <userver/ugrpc/server/call_context.hpp>
@@ -20,6 +27,32 @@ struct ServiceConfig final {
 
     /// Server middlewares to use for the gRPC service.
     Middlewares middlewares;
+
+    /// Size of the initial block of the per-call protobuf Arena, the initial
+    /// requests are allocated on the Arena. 0 disables the Arena.
+    std::size_t arena_initial_block_size{0};
+
+    /// Max count of in-flight RPCs of the service, extra RPCs are rejected with
+    /// `RESOURCE_EXHAUSTED` before the middlewares and the handler.
+    std::optional<std::size_t> max_requests_in_flight{};
+
+    /// Max count of in-flight RPCs per method name, e.g. `SayHello`.
+    std::unordered_map<std::string, std::size_t> method_max_requests_in_flight{};
+
+    /// RPCs that have waited in the task processor queue for longer are
+    /// rejected with `RESOURCE_EXHAUSTED` before the middlewares and the
+    /// handler. 0 disables the check.
+    std::chrono::milliseconds max_queue_wait_time{0};
+
+    /// TaskProcessors to use for serving RPCs per method name, e.g.
+    /// `SayHello`. Other methods use `task_processor`.
+    std::unordered_map<std::string, engine::TaskProcessor*> method_task_processors{};
+
+    /// Names of the unary methods that are handled right in the task that has
+    /// received the RPC, without starting a new task per RPC. The RPCs of such
+    /// a method are handled one at a time per completion queue, so the handler
+    /// must be fast and must never block.
+    std::unordered_set<std::string> inline_methods{};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
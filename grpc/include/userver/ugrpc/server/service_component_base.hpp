@@ -29,6 +29,10 @@ class GenericServiceBase;
 /// ---- | ----------- | -------------
 /// task-processor | the task processor to use for responses | taken from grpc-server.service-defaults
 /// middlewares | middleware component names to use for each RPC call, can be empty array ([]) | taken from grpc-server.service-defaults
+/// arena-initial-block-size | size of the initial block of the per-call protobuf Arena that stores the initial requests, 0 disables the Arena | taken from grpc-server.service-defaults
+/// max-queue-wait-time | RPCs that have waited in the task processor queue for longer are rejected with RESOURCE_EXHAUSTED, 0 disables the check | taken from grpc-server.service-defaults
+/// max-requests-in-flight | max count of in-flight RPCs of the service, extra RPCs are rejected with RESOURCE_EXHAUSTED | no limit
+/// method-max-requests-in-flight | a map of a method name (e.g. `SayHello`) to the max count of its in-flight RPCs | no limits
 
 // clang-format on
 
@@ -3,6 +3,8 @@
 /// @file userver/ugrpc/server/stream.hpp
 /// @brief Server streaming interfaces
 
+#include <userver/utils/span.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server {
@@ -47,6 +49,18 @@ public:
     /// @param response the next message to write
     /// @throws ugrpc::server::RpcError on an RPC error
     virtual void Write(Response&& response) = 0;
+
+    /// @brief Write several outgoing messages at once
+    ///
+    /// The messages may be coalesced by gRPC into fewer network writes, the
+    /// batch is flushed after the last message is written. Prefer it over
+    /// separate `Write` calls when a lot of small messages are ready at once.
+    ///
+    /// @param responses the next messages to write
+    /// @throws ugrpc::server::RpcError on an RPC error
+    virtual void WriteBatch(utils::span<Response> responses) {
+        for (auto& response : responses) Write(response);
+    }
 };
 
 /// @brief Interface to both read and write messages.
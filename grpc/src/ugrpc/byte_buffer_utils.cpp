@@ -31,6 +31,12 @@ bool ParseFromByteBuffer(grpc::ByteBuffer&& buffer, ::google::protobuf::Message&
     return message.ParseFromZeroCopyStream(&reader);
 }
 
+bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer, ::google::protobuf::Message& message) {
+    // Copying a ByteBuffer only increments the reference counts of its slices
+    grpc::ByteBuffer shared_buffer{buffer};
+    return ParseFromByteBuffer(std::move(shared_buffer), message);
+}
+
 }  // namespace ugrpc
 
 USERVER_NAMESPACE_END
@@ -74,6 +74,7 @@ impl::ClientDependencies ClientFactory::MakeClientDependencies(ClientSettings&&
         settings.client_qos,
         settings_,
         std::move(settings.dedicated_methods_config),
+        channel_task_processor_,
     };
 }
 
@@ -97,11 +97,40 @@ properties:
             This value is used if the name resolution process can't get value
             from DNS
         defaultDescription: absent
+    load-balancing-policy:
+        type: string
+        description: |
+            load balancing policy of the channels, used if there is no
+            default-service-config. `weighted-round-robin` balances by the
+            server load reports, see
+            ugrpc::server::middlewares::load_report::Component, and requires
+            gRPC >= 1.55
+        defaultDescription: default
+        enum:
+          - default
+          - pick-first
+          - round-robin
+          - weighted-round-robin
     channel-count:
         type: integer
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    max-channel-count:
+        type: integer
+        description: |
+            Upper bound of the number of channels of each client. Extra
+            channels are created when all the channels of a client have at
+            least channel-streams-threshold in-flight RPCs.
+        defaultDescription: channel-count
+        minimum: 0
+    channel-streams-threshold:
+        type: integer
+        description: |
+            Number of in-flight RPCs of a channel, after which a new RPC
+            prefers a less loaded or a new channel.
+        defaultDescription: 100
+        minimum: 1
     middlewares:
         type: array
         items:
@@ -20,6 +20,7 @@ constexpr std::size_t kDefaultCompletionQueueCount = 1;
 ugrpc::impl::CompletionQueuePoolBase& FindOrEmplaceCompletionQueues(
     std::optional<impl::CompletionQueuePool>& holder,
     std::size_t queue_count,
+    const std::optional<std::string>& poll_task_processor,
     const components::ComponentContext& context
 ) {
     if (auto* const server = context.FindComponentOptional<server::ServerComponent>()) {
@@ -29,9 +30,15 @@ ugrpc::impl::CompletionQueuePoolBase& FindOrEmplaceCompletionQueues(
             "meaningless and should not be specified if the service has a "
             "grpc-server. Use grpc-server.completion-queue-count instead"
         );
+        UINVARIANT(
+            !poll_task_processor,
+            "grpc-client-common.completion-queue-poll-task-processor option is "
+            "meaningless and should not be specified if the service has a "
+            "grpc-server. Use grpc-server.completion-queue-poll-task-processor instead"
+        );
         return server->GetServer().GetCompletionQueues(utils::impl::InternalTag{});
     }
-    holder.emplace(queue_count);
+    holder.emplace(queue_count, poll_task_processor ? &context.GetTaskProcessor(*poll_task_processor) : nullptr);
     return *holder;
 }
 
@@ -43,6 +50,7 @@ CommonComponent::CommonComponent(const components::ComponentConfig& config, cons
       completion_queues_(FindOrEmplaceCompletionQueues(
           client_completion_queues_,
           config["completion-queue-count"].As<std::size_t>(kDefaultCompletionQueueCount),
+          config["completion-queue-poll-task-processor"].As<std::optional<std::string>>(),
           context
       )),
       client_statistics_storage_(
@@ -78,6 +86,12 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-poll-task-processor:
+        type: string
+        description: |
+            the task processor to poll the completion queues on, instead of
+            dedicated threads
+        defaultDescription: dedicated threads are used
 )");
 }
 
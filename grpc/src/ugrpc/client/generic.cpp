@@ -33,11 +33,17 @@ client::ResponseFuture<grpc::ByteBuffer> GenericClient::AsyncUnaryCall(
     std::unique_ptr<grpc::ClientContext> context,
     const GenericOptions& generic_options
 ) const {
-    auto& stub = impl_.NextGenericStub<GenericStubService>();
+    auto leased_stub = impl_.NextGenericStub<GenericStubService>();
+    auto& stub = leased_stub.stub;
     auto grpcpp_call_name = utils::StrCat<grpc::string>("/", call_name);
     client::UnaryCall<grpc::ByteBuffer> call{
         impl::CreateGenericCallParams(
-            impl_, call_name, std::move(context), generic_options.qos, generic_options.metrics_call_name
+            impl_,
+            call_name,
+            std::move(context),
+            generic_options.qos,
+            generic_options.metrics_call_name,
+            std::move(leased_stub.lease)
         ),
         [&stub, &grpcpp_call_name](
             grpc::ClientContext* context, const grpc::ByteBuffer& request, grpc::CompletionQueue* cq
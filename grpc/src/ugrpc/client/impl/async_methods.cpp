@@ -86,6 +86,7 @@ RpcData::RpcData(impl::CallParams&& params, CallKind call_kind)
       queue_(params.queue),
       config_values_(params.config),
       mws_(params.mws),
+      stub_lease_(std::move(params.stub_lease)),
       call_kind_(call_kind) {
     UASSERT(context_);
     UASSERT(!client_name_.empty());
@@ -160,6 +161,7 @@ void RpcData::SetFinished() noexcept {
     UASSERT(context_);
     UINVARIANT(!is_finished_, "Tried to finish already finished call");
     is_finished_ = true;
+    stub_lease_.Release();
 }
 
 bool RpcData::IsFinished() const noexcept {
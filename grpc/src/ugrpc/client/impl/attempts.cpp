@@ -0,0 +1,34 @@
+#include <userver/ugrpc/client/impl/attempts.hpp>
+
+#include <userver/ugrpc/client/client_qos.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+AttemptsPolicy GetAttemptsPolicy(const ClientData& client_data, std::size_t method_id, const Qos& qos) {
+    AttemptsPolicy policy;
+    std::optional<Qos> dynamic_qos;
+    if (!qos.attempts || !qos.hedging_delay) {
+        if (const auto* const config_key = client_data.GetClientQos()) {
+            const auto call_name = client_data.GetMetadata().method_full_names[method_id];
+            const auto config = client_data.GetConfigSnapshot();
+            dynamic_qos = config[*config_key].GetOptional(call_name);
+        }
+    }
+
+    // The explicit Qos parameter has the highest priority, see ApplyQosConfigs
+    const auto& fallback_qos = dynamic_qos ? *dynamic_qos : Qos{};
+    policy.attempts = qos.attempts.value_or(fallback_qos.attempts.value_or(1));
+    policy.hedging_delay = qos.hedging_delay ? qos.hedging_delay : fallback_qos.hedging_delay;
+    return policy;
+}
+
+bool IsRetryableError(const RpcError& error) noexcept {
+    return dynamic_cast<const UnavailableError*>(&error) != nullptr ||
+           dynamic_cast<const RpcInterruptedError*>(&error) != nullptr;
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
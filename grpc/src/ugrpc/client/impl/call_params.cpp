@@ -79,7 +79,8 @@ CallParams CreateCallParams(
     const ClientData& client_data,
     std::size_t method_id,
     std::unique_ptr<grpc::ClientContext> client_context,
-    const Qos& qos
+    const Qos& qos,
+    StubLease&& stub_lease
 ) {
     const auto& metadata = client_data.GetMetadata();
     const auto call_name = metadata.method_full_names[method_id];
@@ -98,6 +99,7 @@ CallParams CreateCallParams(
         std::move(client_context),
         client_data.GetStatistics(method_id),
         client_data.GetMiddlewares(),
+        std::move(stub_lease),
     };
 }
 
@@ -106,7 +108,8 @@ CallParams CreateGenericCallParams(
     std::string_view call_name,
     std::unique_ptr<grpc::ClientContext> client_context,
     const Qos& qos,
-    std::optional<std::string_view> metrics_call_name
+    std::optional<std::string_view> metrics_call_name,
+    StubLease&& stub_lease
 ) {
     CheckValidCallName(call_name);
     if (metrics_call_name) {
@@ -127,6 +130,7 @@ CallParams CreateGenericCallParams(
         std::move(client_context),
         client_data.GetGenericStatistics(metrics_call_name.value_or(call_name)),
         client_data.GetMiddlewares(),
+        std::move(stub_lease),
     };
 }
 
@@ -1,5 +1,7 @@
 #include <userver/ugrpc/client/impl/client_data.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <grpcpp/create_channel.h>
@@ -11,7 +13,6 @@
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 #include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -53,9 +54,6 @@ const ugrpc::impl::StaticServiceMetadata& ClientData::GetMetadata() const {
 
 const dynamic_config::Key<ClientQos>* ClientData::GetClientQos() const { return dependencies_.qos; }
 
-const ClientData::StubPtr& ClientData::NextStubPtr(const utils::FixedArray<StubPtr>& stubs) const {
-    return stubs[utils::RandRange(stubs.size())];
-}
 
 ugrpc::impl::ServiceStatistics& ClientData::GetServiceStatistics() {
     return dependencies_.statistics_storage.GetServiceStatistics(GetMetadata(), dependencies_.client_name);
@@ -63,7 +61,26 @@ ugrpc::impl::ServiceStatistics& ClientData::GetServiceStatistics() {
 
 std::size_t ClientData::GetDedicatedChannelCount(std::size_t method_id) const {
     UASSERT(method_id < dedicated_stubs_.size());
-    return dedicated_stubs_[method_id].size();
+    const auto& stubs = dedicated_stubs_[method_id];
+    return stubs ? stubs->GetSize() : 0;
+}
+
+std::size_t ClientData::GetChannelCount() const {
+    UASSERT(default_stubs_);
+    return default_stubs_->GetSize();
+}
+
+ClientData::ChannelFactory ClientData::MakeChannelFactory(const ClientDependencies& dependencies) {
+    return [endpoint = ugrpc::impl::ToGrpcString(dependencies.endpoint),
+            credentials = dependencies.testsuite_grpc.IsTlsEnabled() ? GetCredentails(dependencies)
+                                                                     : grpc::InsecureChannelCredentials(),
+            channel_args = dependencies.settings.channel_args] {
+        return grpc::CreateCustomChannel(endpoint, credentials, channel_args);
+    };
+}
+
+std::size_t ClientData::GetMaxChannelCount(const ClientDependencies& dependencies) {
+    return std::max(dependencies.settings.max_channel_count, dependencies.channel_token.GetChannelCount());
 }
 
 std::shared_ptr<grpc::Channel>
@@ -1,5 +1,11 @@
 #include <ugrpc/client/impl/client_factory_config.hpp>
 
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include <grpcpp/version_info.h>
+
 #include <userver/logging/level_serialization.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -23,8 +29,52 @@ std::shared_ptr<grpc::ChannelCredentials> MakeDefaultCredentials(impl::AuthType
     UINVARIANT(false, "Invalid AuthType");
 }
 
-grpc::ChannelArguments
-MakeChannelArgs(const yaml_config::YamlConfig& channel_args, const yaml_config::YamlConfig& default_service_config) {
+enum class LoadBalancingPolicy {
+    kDefault,
+    kPickFirst,
+    kRoundRobin,
+    kWeightedRoundRobin,
+};
+
+LoadBalancingPolicy Parse(const yaml_config::YamlConfig& value, formats::parse::To<LoadBalancingPolicy>) {
+    constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector()
+            .Case(LoadBalancingPolicy::kDefault, "default")
+            .Case(LoadBalancingPolicy::kPickFirst, "pick-first")
+            .Case(LoadBalancingPolicy::kRoundRobin, "round-robin")
+            .Case(LoadBalancingPolicy::kWeightedRoundRobin, "weighted-round-robin");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
+std::optional<std::string> MakeLoadBalancingServiceConfig(LoadBalancingPolicy policy) {
+    switch (policy) {
+        case LoadBalancingPolicy::kDefault:
+            return std::nullopt;
+        case LoadBalancingPolicy::kPickFirst:
+            return R"({"loadBalancingConfig": [{"pick_first": {}}]})";
+        case LoadBalancingPolicy::kRoundRobin:
+            return R"({"loadBalancingConfig": [{"round_robin": {}}]})";
+        case LoadBalancingPolicy::kWeightedRoundRobin:
+#if GRPC_CPP_VERSION_MAJOR == 1 && GRPC_CPP_VERSION_MINOR < 55
+            throw std::runtime_error(
+                "load-balancing-policy 'weighted-round-robin' requires gRPC >= 1.55, found " GRPC_CPP_VERSION_STRING
+            );
+#else
+            // Weights are computed from the ORCA load reports of the servers,
+            // see ugrpc::server::middlewares::load_report
+            return R"({"loadBalancingConfig": [{"weighted_round_robin": {}}]})";
+#endif
+    }
+    UINVARIANT(false, "Invalid LoadBalancingPolicy");
+}
+
+grpc::ChannelArguments MakeChannelArgs(
+    const yaml_config::YamlConfig& channel_args,
+    const yaml_config::YamlConfig& default_service_config,
+    const yaml_config::YamlConfig& load_balancing_policy
+) {
     grpc::ChannelArguments args;
     if (!channel_args.IsMissing()) {
         for (const auto& [key, value] : Items(channel_args)) {
@@ -36,8 +86,19 @@ MakeChannelArgs(const yaml_config::YamlConfig& channel_args, const yaml_config::
         }
     }
 
+    const auto load_balancing_service_config =
+        MakeLoadBalancingServiceConfig(load_balancing_policy.As<LoadBalancingPolicy>(LoadBalancingPolicy::kDefault));
+    if (load_balancing_service_config && !default_service_config.IsMissing()) {
+        throw std::runtime_error(
+            "load-balancing-policy can not be combined with default-service-config, "
+            "set 'loadBalancingConfig' in default-service-config instead"
+        );
+    }
+
     if (!default_service_config.IsMissing()) {
         args.SetServiceConfigJSON(default_service_config.As<std::string>());
+    } else if (load_balancing_service_config) {
+        args.SetServiceConfigJSON(*load_balancing_service_config);
     }
     return args;
 }
@@ -56,8 +117,12 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     ClientFactoryConfig config;
 
     config.auth_type = value["auth-type"].As<AuthType>(AuthType::kInsecure);
-    config.channel_args = MakeChannelArgs(value["channel-args"], value["default-service-config"]);
+    config.channel_args =
+        MakeChannelArgs(value["channel-args"], value["default-service-config"], value["load-balancing-policy"]);
     config.channel_count = value["channel-count"].As<std::size_t>(config.channel_count);
+    config.max_channel_count = value["max-channel-count"].As<std::size_t>(config.max_channel_count);
+    config.channel_streams_threshold =
+        value["channel-streams-threshold"].As<std::size_t>(config.channel_streams_threshold);
 
     return config;
 }
@@ -83,6 +148,8 @@ MakeFactorySettings(ClientFactoryConfig&& config, const storages::secdist::Secdi
         config.channel_args,
         logging::Level::kError,
         config.channel_count,
+        config.max_channel_count,
+        config.channel_streams_threshold,
     };
 }
 
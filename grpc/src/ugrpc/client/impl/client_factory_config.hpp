@@ -24,6 +24,17 @@ struct ClientFactoryConfig final {
     /// Number of underlying channels that will be created for every client
     /// in this factory.
     std::size_t channel_count{1};
+
+    /// Upper bound of the number of channels for every client. When every
+    /// channel of a client has at least `channel_streams_threshold` in-flight
+    /// RPCs, an extra channel is created for it. Values not greater than
+    /// `channel_count` disable the extra channels.
+    std::size_t max_channel_count{0};
+
+    /// Number of in-flight RPCs of a channel, after which the channel is
+    /// considered loaded. Should not be greater than HTTP/2
+    /// `MAX_CONCURRENT_STREAMS` of the server.
+    std::size_t channel_streams_threshold{100};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientFactoryConfig>);
@@ -6,10 +6,13 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
-CompletionQueuePool::CompletionQueuePool(std::size_t queue_count)
-    : CompletionQueuePoolBase(utils::GenerateFixedArray(queue_count, [](std::size_t) {
-          return std::make_unique<grpc::CompletionQueue>();
-      })) {}
+CompletionQueuePool::CompletionQueuePool(std::size_t queue_count, engine::TaskProcessor* poll_task_processor)
+    : CompletionQueuePoolBase(
+          utils::GenerateFixedArray(
+              queue_count, [](std::size_t) { return std::make_unique<grpc::CompletionQueue>(); }
+          ),
+          poll_task_processor
+      ) {}
 
 }  // namespace ugrpc::client::impl
 
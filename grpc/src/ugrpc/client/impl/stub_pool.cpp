@@ -0,0 +1,108 @@
+#include <userver/ugrpc/client/impl/stub_pool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/engine/async.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+StubLease::StubLease(std::atomic<std::size_t>& in_flight) noexcept : in_flight_(&in_flight) {
+    in_flight_->fetch_add(1, std::memory_order_relaxed);
+}
+
+StubLease::StubLease(StubLease&& other) noexcept : in_flight_(std::exchange(other.in_flight_, nullptr)) {}
+
+StubLease& StubLease::operator=(StubLease&& other) noexcept {
+    std::swap(in_flight_, other.in_flight_);
+    return *this;
+}
+
+StubLease::~StubLease() { Release(); }
+
+void StubLease::Release() noexcept {
+    if (in_flight_) {
+        std::exchange(in_flight_, nullptr)->fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+StubPool::StubPool(utils::FixedArray<StubPtr>&& stubs) : slots_(stubs.size()), size_(stubs.size()) {
+    for (std::size_t i = 0; i < stubs.size(); ++i) {
+        slots_[i].stub = std::move(stubs[i]);
+    }
+}
+
+StubPool::StubPool(
+    utils::FixedArray<StubPtr>&& stubs,
+    std::size_t max_size,
+    std::size_t streams_threshold,
+    StubFactory&& stub_factory,
+    engine::TaskProcessor& blocking_task_processor
+)
+    : slots_(std::max(max_size, stubs.size())),
+      size_(stubs.size()),
+      streams_threshold_(streams_threshold),
+      stub_factory_(std::move(stub_factory)),
+      blocking_task_processor_(&blocking_task_processor) {
+    UINVARIANT(streams_threshold > 0, "Streams threshold must be greater than zero");
+    UASSERT(stub_factory_);
+    for (std::size_t i = 0; i < stubs.size(); ++i) {
+        slots_[i].stub = std::move(stubs[i]);
+    }
+}
+
+StubPool::~StubPool() = default;
+
+bool StubPool::IsEmpty() const noexcept { return GetSize() == 0; }
+
+std::size_t StubPool::GetSize() const noexcept { return size_.load(std::memory_order_acquire); }
+
+StubPool::Slot& StubPool::NextSlot() {
+    const auto size = GetSize();
+    UASSERT(size > 0);
+
+    // Start from a random stub, so that the ties are spread over the stubs
+    const auto offset = size == 1 ? 0 : utils::RandRange(size);
+    auto* best = &slots_[offset];
+    auto best_in_flight = best->in_flight.load(std::memory_order_relaxed);
+    for (std::size_t i = 1; i < size && best_in_flight != 0; ++i) {
+        auto& slot = slots_[(offset + i) % size];
+        const auto in_flight = slot.in_flight.load(std::memory_order_relaxed);
+        if (in_flight < best_in_flight) {
+            best = &slot;
+            best_in_flight = in_flight;
+        }
+    }
+
+    if (stub_factory_ && best_in_flight >= streams_threshold_ && size < slots_.size()) {
+        GrowAsync(size);
+    }
+    return *best;
+}
+
+void StubPool::GrowAsync(std::size_t size) {
+    if (is_growing_.exchange(true)) return;
+
+    // Channels are created on the blocking task processor, the RPC is started
+    // on the least loaded of the existing stubs meanwhile
+    engine::CriticalAsyncNoSpan(*blocking_task_processor_, [self = shared_from_this(), size] {
+        try {
+            UASSERT(self->GetSize() == size);
+            self->slots_[size].stub = self->stub_factory_();
+            self->size_.store(size + 1, std::memory_order_release);
+            LOG_INFO() << "Created an extra gRPC channel, channels count: " << size + 1;
+        } catch (const std::exception& ex) {
+            LOG_LIMITED_WARNING() << "Failed to create an extra gRPC channel: " << ex;
+        }
+        self->is_growing_.store(false);
+    }).Detach();
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -20,12 +20,19 @@ Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
     if (ms) {
         result.timeout = std::chrono::milliseconds{*ms};
     }
+    result.attempts = value["attempts"].As<std::optional<std::size_t>>();
+    const auto hedging_delay_ms = value["hedging-delay-ms"].As<std::optional<std::chrono::milliseconds::rep>>();
+    if (hedging_delay_ms) {
+        result.hedging_delay = std::chrono::milliseconds{*hedging_delay_ms};
+    }
     return result;
 }
 
 formats::json::Value Serialize(const Qos& qos, formats::serialize::To<formats::json::Value>) {
     formats::json::ValueBuilder result{formats::common::Type::kObject};
     result["timeout-ms"] = qos.timeout;
+    result["attempts"] = qos.attempts;
+    result["hedging-delay-ms"] = qos.hedging_delay;
     return result.ExtractValue();
 }
 
@@ -11,9 +11,12 @@ namespace ugrpc::impl {
 
 static_assert(std::has_virtual_destructor_v<grpc::CompletionQueue>);
 
-CompletionQueuePoolBase::CompletionQueuePoolBase(utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues)
+CompletionQueuePoolBase::CompletionQueuePoolBase(
+    utils::FixedArray<std::unique_ptr<grpc::CompletionQueue>> queues,
+    engine::TaskProcessor* poll_task_processor
+)
     : queues_(std::move(queues)), queue_runners_(utils::GenerateFixedArray(queues_.size(), [&](std::size_t idx) {
-          return QueueRunner{*queues_[idx]};
+          return QueueRunner{*queues_[idx], poll_task_processor};
       })) {}
 
 CompletionQueuePoolBase::~CompletionQueuePoolBase() = default;
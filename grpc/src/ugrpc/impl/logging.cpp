@@ -1,7 +1,14 @@
 #include <ugrpc/impl/logging.hpp>
 
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <memory>
 
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/text_format.h>
+
+#include <userver/compiler/thread_local.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/log.hpp>
 
@@ -13,8 +20,74 @@ namespace ugrpc::impl {
 
 namespace {
 
+// Prints the same text as Message::Utf8DebugString
+struct DebugStringPrinter final {
+    DebugStringPrinter() {
+        printer.SetUseUtf8StringEscaping(true);
+        printer.SetExpandAny(true);
+    }
+
+    google::protobuf::TextFormat::Printer printer;
+};
+
+compiler::ThreadLocal kDebugStringPrinter = [] { return DebugStringPrinter{}; };
+
+// Keeps only the first `limit` bytes of the output and counts the rest, so that
+// huge messages are not stored in full just to be truncated
+class LimitedStringOutputStream final : public google::protobuf::io::ZeroCopyOutputStream {
+public:
+    LimitedStringOutputStream(std::string& target, std::size_t limit) : stream_(&target), limit_(limit) {}
+
+    bool Next(void** data, int* size) override {
+        const auto written = static_cast<std::size_t>(stream_.ByteCount());
+        if (written >= limit_) {
+            *data = discarded_.data();
+            *size = static_cast<int>(discarded_.size());
+            discarded_bytes_ += discarded_.size();
+            return true;
+        }
+        if (!stream_.Next(data, size)) return false;
+
+        const auto available = limit_ - written;
+        if (static_cast<std::size_t>(*size) > available) {
+            stream_.BackUp(*size - static_cast<int>(available));
+            *size = static_cast<int>(available);
+        }
+        return true;
+    }
+
+    void BackUp(int count) override {
+        if (discarded_bytes_ != 0) {
+            discarded_bytes_ -= static_cast<std::size_t>(count);
+        } else {
+            stream_.BackUp(count);
+        }
+    }
+
+    std::int64_t ByteCount() const override {
+        return stream_.ByteCount() + static_cast<std::int64_t>(discarded_bytes_);
+    }
+
+private:
+    google::protobuf::io::StringOutputStream stream_;
+    const std::size_t limit_;
+    std::size_t discarded_bytes_{0};
+    std::array<char, 1024> discarded_{};
+};
+
 std::string ToLimitedString(const google::protobuf::Message& message, std::size_t max_size) {
-    return utils::log::ToLimitedUtf8(message.Utf8DebugString(), max_size);
+    if (max_size >= static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+        return utils::log::ToLimitedUtf8(message.Utf8DebugString(), max_size);
+    }
+
+    std::string output;
+    const auto total_size = [&] {
+        LimitedStringOutputStream stream{output, max_size};
+        auto debug_string_printer = kDebugStringPrinter.Use();
+        debug_string_printer->printer.Print(message, &stream);
+        return static_cast<std::size_t>(stream.ByteCount());
+    }();
+    return utils::log::ToLimitedUtf8(output, max_size, total_size);
 }
 
 }  // namespace
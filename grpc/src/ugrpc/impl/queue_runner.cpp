@@ -1,7 +1,12 @@
 #include <userver/ugrpc/impl/queue_runner.hpp>
 
+#include <chrono>
 #include <thread>
 
+#include <grpc/support/time.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/thread_name.hpp>
 
@@ -13,6 +18,11 @@ namespace ugrpc::impl {
 
 namespace {
 
+// Empty polls are retried after a yield at first, so that a busy queue is
+// polled without timer roundtrips, and then with a sleep to not burn CPU
+constexpr std::size_t kSpinPollsCount = 64;
+constexpr std::chrono::microseconds kIdlePollInterval{100};
+
 void ProcessQueue(grpc::CompletionQueue& queue, engine::SingleUseEvent& completion) noexcept {
     utils::SetCurrentThreadName("grpc-queue");
 
@@ -28,10 +38,38 @@ void ProcessQueue(grpc::CompletionQueue& queue, engine::SingleUseEvent& completi
     completion.Send();
 }
 
+void PollQueue(grpc::CompletionQueue& queue, engine::SingleUseEvent& completion) noexcept {
+    void* tag = nullptr;
+    bool ok = false;
+    std::size_t empty_polls = 0;
+
+    while (true) {
+        const auto status = queue.AsyncNext(&tag, &ok, gpr_time_0(GPR_CLOCK_MONOTONIC));
+        if (status == grpc::CompletionQueue::SHUTDOWN) break;
+
+        if (status == grpc::CompletionQueue::GOT_EVENT) {
+            auto* call = static_cast<EventBase*>(tag);
+            UASSERT(call != nullptr);
+            call->Notify(ok);
+            empty_polls = 0;
+        } else if (++empty_polls < kSpinPollsCount) {
+            engine::Yield();
+        } else {
+            engine::SleepFor(kIdlePollInterval);
+        }
+    }
+
+    completion.Send();
+}
+
 }  // namespace
 
-QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
-    std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+QueueRunner::QueueRunner(grpc::CompletionQueue& queue, engine::TaskProcessor* poll_task_processor) : queue_(queue) {
+    if (poll_task_processor) {
+        engine::CriticalAsyncNoSpan(*poll_task_processor, [this] { PollQueue(queue_, completion_); }).Detach();
+    } else {
+        std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+    }
 }
 
 QueueRunner::~QueueRunner() {
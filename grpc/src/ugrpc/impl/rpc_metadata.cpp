@@ -20,6 +20,8 @@ const grpc::string kXYaTaxiRatelimitReason = "x-yataxi-ratelimit-reason";
 const grpc::string kHostname = hostinfo::blocking::GetRealHostName();
 
 const grpc::string kCongestionControlRatelimitReason = "congestion-control";
+const grpc::string kInFlightRatelimitReason = "max-requests-in-flight";
+const grpc::string kQueueWaitTimeRatelimitReason = "max-queue-wait-time";
 
 }  // namespace ugrpc::impl
 
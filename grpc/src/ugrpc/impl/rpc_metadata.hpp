@@ -22,6 +22,8 @@ extern const grpc::string kXYaTaxiRatelimitReason;
 extern const grpc::string kHostname;
 
 extern const grpc::string kCongestionControlRatelimitReason;
+extern const grpc::string kInFlightRatelimitReason;
+extern const grpc::string kQueueWaitTimeRatelimitReason;
 
 }  // namespace ugrpc::impl
 
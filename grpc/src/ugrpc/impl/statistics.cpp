@@ -38,6 +38,12 @@ void MethodStatistics::AccountDeadlinePropagated() noexcept { ++deadline_updated
 
 void MethodStatistics::AccountCancelled() noexcept { ++cancelled_; }
 
+void MethodStatistics::AccountRetried() noexcept { ++retried_; }
+
+void MethodStatistics::AccountHedged() noexcept { ++hedged_; }
+
+void MethodStatistics::AccountHedgedWon() noexcept { ++hedged_won_; }
+
 void DumpMetric(utils::statistics::Writer& writer, const MethodStatistics& stats) {
     writer = MethodStatisticsSnapshot{stats};
 }
@@ -107,6 +113,13 @@ void DumpMetric(utils::statistics::Writer& writer, const MethodStatisticsSnapsho
 
     writer["deadline-propagated"] = stats.deadline_updated;
     writer["cancelled-by-deadline-propagation"] = deadline_cancelled_value;
+
+    if (stats.domain == StatisticsDomain::kClient) {
+        // Each attempt is also accounted as a separate RPC in the metrics above
+        writer["retries"] = stats.retried;
+        writer["hedged-attempts"] = stats.hedged;
+        writer["hedged-wins"] = stats.hedged_won;
+    }
 }
 
 MethodStatisticsSnapshot::MethodStatisticsSnapshot(const StatisticsDomain domain) : domain(domain) {}
@@ -120,7 +133,10 @@ MethodStatisticsSnapshot::MethodStatisticsSnapshot(const MethodStatistics& stats
       internal_errors(stats.internal_errors_.Load()),
       cancelled(stats.cancelled_.Load()),
       deadline_updated(stats.deadline_updated_.Load()),
-      deadline_cancelled(stats.deadline_cancelled_.Load()) {
+      deadline_cancelled(stats.deadline_cancelled_.Load()),
+      retried(stats.retried_.Load()),
+      hedged(stats.hedged_.Load()),
+      hedged_won(stats.hedged_won_.Load()) {
     // For the 'active' metric, it is important to load the 'started' value after
     // loading the 'started_renamed' and 'total_requests' values.
     // More details in DumpMetric for MethodStatisticsSnapshot
@@ -139,6 +155,9 @@ void MethodStatisticsSnapshot::Add(const MethodStatisticsSnapshot& other) {
     cancelled += other.cancelled;
     deadline_updated += other.deadline_updated;
     deadline_cancelled += other.deadline_cancelled;
+    retried += other.retried;
+    hedged += other.hedged;
+    hedged_won += other.hedged_won;
 }
 
 void DumpMetricWithLabels(
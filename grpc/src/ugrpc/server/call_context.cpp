@@ -20,6 +20,8 @@ tracing::Span& CallContext::GetSpan() { return GetCall().GetSpan(); }
 
 utils::AnyStorage<StorageContext>& CallContext::GetStorageContext() { return GetCall().GetStorageContext(); }
 
+google::protobuf::Arena* CallContext::GetArena() { return GetCall().GetArena(); }
+
 const CallAnyBase& CallContext::GetCall() const { return call_; }
 
 CallAnyBase& CallContext::GetCall() { return call_; }
@@ -0,0 +1,58 @@
+#include <userver/ugrpc/server/generic_proxy.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+namespace {
+
+void ProxyTrailingMetadata(const grpc::ClientContext& client_context, grpc::ServerContext& server_context) {
+    for (const auto& [key, value] : client_context.GetServerTrailingMetadata()) {
+        server_context.AddTrailingMetadata(
+            grpc::string(key.data(), key.size()), grpc::string(value.data(), value.size())
+        );
+    }
+}
+
+}  // namespace
+
+GenericServiceBase::GenericResult ProxyUnaryCall(
+    GenericCallContext& context,
+    GenericServiceBase::GenericReaderWriter& stream,
+    const client::GenericClient& client,
+    std::string_view call_name,
+    std::unique_ptr<grpc::ClientContext> client_context,
+    const client::GenericOptions& options
+) {
+    grpc::ByteBuffer request;
+    if (!stream.Read(request)) {
+        return grpc::Status{grpc::StatusCode::INVALID_ARGUMENT, "Expected exactly 1 request, given: 0"};
+    }
+    // For unary RPCs, clients call WritesDone right after the request
+    grpc::ByteBuffer extra_request;
+    if (stream.Read(extra_request)) {
+        return grpc::Status{grpc::StatusCode::INVALID_ARGUMENT, "Expected exactly 1 request, given: at least 2"};
+    }
+
+    auto future = client.AsyncUnaryCall(call_name, request, std::move(client_context), options);
+    grpc::ByteBuffer response;
+    try {
+        response = future.Get();
+    } catch (const client::ErrorWithStatus& ex) {
+        ProxyTrailingMetadata(future.GetCall().GetContext(), context.GetServerContext());
+        return ex.GetStatus();
+    } catch (const client::RpcError& ex) {
+        LOG_WARNING() << "Failed to proxy '" << context.GetCallName() << "' to '" << call_name << "': " << ex;
+        return grpc::Status{grpc::StatusCode::UNAVAILABLE, "Failed to proxy the request"};
+    }
+
+    ProxyTrailingMetadata(future.GetCall().GetContext(), context.GetServerContext());
+    return response;
+}
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -18,12 +18,17 @@ void RpcFinishedEvent::Notify(bool ok) noexcept {
     // From the documentation to grpcpp: Server-side AsyncNotifyWhenDone:
     // ok should always be true
     UASSERT(ok);
-    if (server_ctx_.IsCancelled()) {
+    if (server_ctx_.IsCancelled() && cancellation_token_.IsValid()) {
         cancellation_token_.RequestCancel();
     }
     event_.Send();
 }
 
+void RpcReceivedEvent::Notify(bool ok) noexcept {
+    received_at_ = std::chrono::steady_clock::now();
+    ugrpc::impl::AsyncMethodInvocation::Notify(ok);
+}
+
 ugrpc::impl::AsyncMethodInvocation::WaitStatus Wait(ugrpc::impl::AsyncMethodInvocation& async) {
     using WaitStatus = ugrpc::impl::AsyncMethodInvocation::WaitStatus;
 
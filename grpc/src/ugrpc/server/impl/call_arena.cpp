@@ -0,0 +1,63 @@
+#include <userver/ugrpc/server/impl/call_arena.hpp>
+
+#include <boost/container/static_vector.hpp>
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+struct PooledBlock final {
+    std::unique_ptr<char[]> data;
+    std::size_t size{0};
+};
+
+// A call may finish on another thread, its block is then returned to the pool
+// of that thread.
+constexpr std::size_t kMaxPooledBlocks = 16;
+
+compiler::ThreadLocal local_blocks = [] {
+    return boost::container::static_vector<PooledBlock, kMaxPooledBlocks>{};
+};
+
+google::protobuf::ArenaOptions MakeArenaOptions(char* initial_block, std::size_t size) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = initial_block;
+    options.initial_block_size = size;
+    return options;
+}
+
+}  // namespace
+
+CallArena::InitialBlock::InitialBlock(std::size_t size) : size_(size) {
+    {
+        auto blocks = local_blocks.Use();
+        // Blocks of other services may be smaller, those are left in the pool
+        if (!blocks->empty() && blocks->back().size >= size) {
+            data_ = std::move(blocks->back().data);
+            size_ = blocks->back().size;
+            blocks->pop_back();
+            return;
+        }
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    data_.reset(new char[size]);
+}
+
+CallArena::InitialBlock::~InitialBlock() {
+    auto blocks = local_blocks.Use();
+    if (blocks->size() != blocks->capacity()) {
+        blocks->push_back(PooledBlock{std::move(data_), size_});
+    }
+}
+
+CallArena::CallArena(std::size_t initial_block_size)
+    : initial_block_(initial_block_size),
+      arena_(MakeArenaOptions(initial_block_.GetData(), initial_block_.GetSize())) {}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -6,10 +6,20 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::impl {
 
-CompletionQueuePool::CompletionQueuePool(std::size_t queue_count, grpc::ServerBuilder& server_builder)
-    : CompletionQueuePoolBase(utils::GenerateFixedArray(queue_count, [&server_builder](std::size_t) {
-          return static_cast<std::unique_ptr<grpc::CompletionQueue>>(server_builder.AddCompletionQueue());
-      })) {}
+CompletionQueuePool::CompletionQueuePool(
+    std::size_t queue_count,
+    grpc::ServerBuilder& server_builder,
+    engine::TaskProcessor* poll_task_processor
+)
+    : CompletionQueuePoolBase(
+          utils::GenerateFixedArray(
+              queue_count,
+              [&server_builder](std::size_t) {
+                  return static_cast<std::unique_ptr<grpc::CompletionQueue>>(server_builder.AddCompletionQueue());
+              }
+          ),
+          poll_task_processor
+      ) {}
 
 }  // namespace ugrpc::server::impl
 
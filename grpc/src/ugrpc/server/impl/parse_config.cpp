@@ -19,6 +19,8 @@ namespace {
 
 constexpr std::string_view kTaskProcessorKey = "task-processor";
 constexpr std::string_view kMiddlewaresKey = "middlewares";
+constexpr std::string_view kArenaInitialBlockSizeKey = "arena-initial-block-size";
+constexpr std::string_view kMaxQueueWaitTimeKey = "max-queue-wait-time";
 
 template <typename ParserFunc>
 auto ParseOptional(
@@ -57,6 +59,25 @@ ParseMiddlewares(const yaml_config::YamlConfig& field, const components::Compone
     return field.As<std::vector<std::string>>();
 }
 
+std::size_t
+ParseArenaInitialBlockSize(const yaml_config::YamlConfig& field, const components::ComponentContext& /*context*/) {
+    return field.As<std::size_t>(0);
+}
+
+std::chrono::milliseconds
+ParseMaxQueueWaitTime(const yaml_config::YamlConfig& field, const components::ComponentContext& /*context*/) {
+    return field.As<std::chrono::milliseconds>(std::chrono::milliseconds{0});
+}
+
+std::unordered_map<std::string, engine::TaskProcessor*>
+ParseMethodTaskProcessors(const yaml_config::YamlConfig& field, const components::ComponentContext& context) {
+    std::unordered_map<std::string, engine::TaskProcessor*> result;
+    for (const auto& [method_name, task_processor_name] : field.As<std::unordered_map<std::string, std::string>>({})) {
+        result.emplace(method_name, &context.GetTaskProcessor(task_processor_name));
+    }
+    return result;
+}
+
 Middlewares FindMiddlewares(const std::vector<std::string>& names, const components::ComponentContext& context) {
     return utils::AsContainer<Middlewares>(
         names | boost::adaptors::transformed([&](const std::string& name) {
@@ -73,6 +94,10 @@ ParseServiceDefaults(const yaml_config::YamlConfig& value, const components::Com
         /*task_processor=*/ParseOptional(value[kTaskProcessorKey], context, ParseTaskProcessor),
         /*middleware_names=*/
         ParseOptional(value[kMiddlewaresKey], context, ParseMiddlewares),
+        /*arena_initial_block_size=*/
+        ParseOptional(value[kArenaInitialBlockSizeKey], context, ParseArenaInitialBlockSize),
+        /*max_queue_wait_time=*/
+        ParseOptional(value[kMaxQueueWaitTimeKey], context, ParseMaxQueueWaitTime),
     };
 }
 
@@ -87,6 +112,20 @@ server::ServiceConfig ParseServiceConfig(
         FindMiddlewares(
             MergeField(value[kMiddlewaresKey], defaults.middleware_names, context, ParseMiddlewares), context
         ),
+        /*arena_initial_block_size=*/
+        MergeField(
+            value[kArenaInitialBlockSizeKey],
+            defaults.arena_initial_block_size,
+            context,
+            ParseArenaInitialBlockSize
+        ),
+        /*max_requests_in_flight=*/value["max-requests-in-flight"].As<std::optional<std::size_t>>(),
+        /*method_max_requests_in_flight=*/
+        value["method-max-requests-in-flight"].As<std::unordered_map<std::string, std::size_t>>({}),
+        /*max_queue_wait_time=*/
+        MergeField(value[kMaxQueueWaitTimeKey], defaults.max_queue_wait_time, context, ParseMaxQueueWaitTime),
+        /*method_task_processors=*/ParseMethodTaskProcessors(value["method-task-processors"], context),
+        /*inline_methods=*/value["inline-methods"].As<std::unordered_set<std::string>>({}),
     };
 }
 
@@ -95,6 +134,10 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value, const compo
     config.unix_socket_path = value["unix-socket-path"].As<std::optional<std::string>>();
     config.port = value["port"].As<std::optional<int>>();
     config.completion_queue_num = value["completion-queue-count"].As<std::size_t>(2);
+    const auto poll_task_processor = value["completion-queue-poll-task-processor"].As<std::optional<std::string>>();
+    if (poll_task_processor) {
+        config.completion_queue_poll_task_processor = &context.GetTaskProcessor(*poll_task_processor);
+    }
     config.channel_args = value["channel-args"].As<decltype(config.channel_args)>({});
     config.native_log_level = value["native-log-level"].As<logging::Level>(logging::Level::kError);
     config.enable_channelz = value["enable-channelz"].As<bool>(false);
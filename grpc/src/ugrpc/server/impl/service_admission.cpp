@@ -0,0 +1,116 @@
+#include <userver/ugrpc/server/impl/service_admission.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <ugrpc/impl/rpc_metadata.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+utils::FixedArray<std::optional<std::size_t>>
+MakeMethodLimits(const ServiceSettings& settings, const ugrpc::impl::StaticServiceMetadata& metadata) {
+    utils::FixedArray<std::optional<std::size_t>> result(metadata.method_full_names.size());
+    for (const auto& [method_name, limit] : settings.method_max_requests_in_flight) {
+        bool is_found = false;
+        for (std::size_t method_id = 0; method_id < metadata.method_full_names.size(); ++method_id) {
+            // Remove name of the service and slash
+            const auto full_name = metadata.method_full_names[method_id];
+            if (full_name.substr(metadata.service_full_name.size() + 1) == method_name) {
+                result[method_id] = limit;
+                is_found = true;
+                break;
+            }
+        }
+        UINVARIANT(
+            is_found,
+            fmt::format(
+                "Unknown method '{}' in method-max-requests-in-flight of service '{}'",
+                method_name,
+                metadata.service_full_name
+            )
+        );
+    }
+    return result;
+}
+
+bool TryAcquire(std::atomic<std::size_t>& in_flight, std::size_t limit) noexcept {
+    if (in_flight.fetch_add(1, std::memory_order_relaxed) >= limit) {
+        in_flight.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+grpc::Status Reject(grpc::ServerContext& context, const grpc::string& reason, const char* message) {
+    context.AddInitialMetadata(ugrpc::impl::kXYaTaxiRatelimitedBy, ugrpc::impl::kHostname);
+    context.AddInitialMetadata(ugrpc::impl::kXYaTaxiRatelimitReason, reason);
+    return grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED, message};
+}
+
+}  // namespace
+
+AdmissionTicket::~AdmissionTicket() {
+    if (service_in_flight_) service_in_flight_->fetch_sub(1, std::memory_order_relaxed);
+    if (method_in_flight_) method_in_flight_->fetch_sub(1, std::memory_order_relaxed);
+}
+
+ServiceAdmission::ServiceAdmission(const ServiceSettings& settings, const ugrpc::impl::StaticServiceMetadata& metadata)
+    : max_in_flight_(settings.max_requests_in_flight),
+      method_max_in_flight_(MakeMethodLimits(settings, metadata)),
+      max_queue_wait_time_(settings.max_queue_wait_time),
+      is_enabled_(
+          max_in_flight_.has_value() || !settings.method_max_requests_in_flight.empty() ||
+          max_queue_wait_time_.count() > 0
+      ),
+      method_in_flight_(metadata.method_full_names.size(), 0) {}
+
+std::optional<grpc::Status> ServiceAdmission::TryAdmit(
+    std::size_t method_id,
+    std::chrono::steady_clock::time_point received_at,
+    grpc::ServerContext& context,
+    std::string_view call_name,
+    AdmissionTicket& ticket
+) {
+    if (!is_enabled_) return std::nullopt;
+    UASSERT(method_id < method_in_flight_.size());
+
+    if (max_queue_wait_time_.count() > 0) {
+        const auto queue_wait_time = std::chrono::steady_clock::now() - received_at;
+        if (queue_wait_time > max_queue_wait_time_) {
+            LOG_LIMITED_WARNING() << "Rejecting '" << call_name << "', it has waited in the task processor queue for "
+                                  << std::chrono::duration_cast<std::chrono::milliseconds>(queue_wait_time).count()
+                                  << "ms";
+            return Reject(context, ugrpc::impl::kQueueWaitTimeRatelimitReason, "Queue wait time limit exceeded");
+        }
+    }
+
+    if (max_in_flight_) {
+        if (!TryAcquire(in_flight_, *max_in_flight_)) {
+            LOG_LIMITED_WARNING() << "Rejecting '" << call_name << "', too many requests in flight for the service";
+            return Reject(context, ugrpc::impl::kInFlightRatelimitReason, "Service in-flight limit exceeded");
+        }
+        ticket.service_in_flight_ = &in_flight_;
+    }
+
+    const auto& method_max_in_flight = method_max_in_flight_[method_id];
+    if (method_max_in_flight) {
+        auto& method_in_flight = method_in_flight_[method_id];
+        if (!TryAcquire(method_in_flight, *method_max_in_flight)) {
+            LOG_LIMITED_WARNING() << "Rejecting '" << call_name << "', too many requests in flight for the method";
+            return Reject(context, ugrpc::impl::kInFlightRatelimitReason, "Method in-flight limit exceeded");
+        }
+        ticket.method_in_flight_ = &method_in_flight;
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -15,6 +17,8 @@ struct ServiceDefaults final {
     // using boost::optional to easily generalize to references
     boost::optional<engine::TaskProcessor&> task_processor;
     boost::optional<std::vector<std::string>> middleware_names;
+    boost::optional<std::size_t> arena_initial_block_size;
+    boost::optional<std::chrono::milliseconds> max_queue_wait_time;
 };
 
 }  // namespace ugrpc::server::impl
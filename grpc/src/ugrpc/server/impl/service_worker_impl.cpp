@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include <fmt/format.h>
 #include <grpc/support/time.h>
 
 #include <userver/logging/log.hpp>
@@ -146,6 +147,40 @@ void ParseGenericCallName(
     method_name = generic_call_name.substr(slash_pos + 1);
 }
 
+void ValidateMethodSettings(const ServiceSettings& settings, const ugrpc::impl::StaticServiceMetadata& metadata) {
+    const auto validate = [&metadata](std::string_view method_name, std::string_view option) {
+        bool is_found = false;
+        for (const auto full_name : metadata.method_full_names) {
+            // Remove name of the service and slash
+            if (full_name.substr(metadata.service_full_name.size() + 1) == method_name) {
+                is_found = true;
+                break;
+            }
+        }
+        UINVARIANT(
+            is_found,
+            fmt::format("Unknown method '{}' in {} of service '{}'", method_name, option, metadata.service_full_name)
+        );
+    };
+
+    for (const auto& [method_name, task_processor] : settings.method_task_processors) {
+        UASSERT(task_processor);
+        validate(method_name, "method-task-processors");
+    }
+    for (const auto& method_name : settings.inline_methods) {
+        validate(method_name, "inline-methods");
+    }
+}
+
+engine::TaskProcessor& GetMethodTaskProcessor(const ServiceSettings& settings, std::string_view method_name) {
+    auto* const task_processor = utils::FindOrDefault(settings.method_task_processors, std::string{method_name});
+    return task_processor ? *task_processor : settings.task_processor;
+}
+
+bool IsInlineMethod(const ServiceSettings& settings, std::string_view method_name) {
+    return settings.inline_methods.count(std::string{method_name}) != 0;
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -1,7 +1,11 @@
 #include "middleware.hpp"
 
+#include <memory>
+#include <string>
+
 #include <userver/baggage/baggage.hpp>
 #include <userver/baggage/baggage_settings.hpp>
+#include <userver/baggage/lazy_baggage.hpp>
 #include <userver/utils/algo.hpp>
 
 #include <ugrpc/impl/grpc_string_logging.hpp>
@@ -18,8 +22,6 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
     const auto& dynamic_config = context.GetInitialDynamicConfig();
 
     if (dynamic_config[USERVER_NAMESPACE::baggage::kBaggageEnabled]) {
-        const auto& baggage_settings = dynamic_config[USERVER_NAMESPACE::baggage::kBaggageSettings];
-
         const auto& server_context = call.GetContext();
 
         const auto* baggage_header = utils::FindOrNullptr(server_context.client_metadata(), ugrpc::impl::kXBaggage);
@@ -27,12 +29,12 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
         if (baggage_header) {
             LOG_DEBUG() << "Got baggage header: " << *baggage_header;
 
-            auto baggage = USERVER_NAMESPACE::baggage::TryMakeBaggage(
-                ugrpc::impl::ToString(*baggage_header), baggage_settings.allowed_keys
+            // The header is parsed only if the handler makes outgoing requests
+            auto header = std::make_shared<const std::string>(ugrpc::impl::ToString(*baggage_header));
+            const std::string_view header_view = *header;
+            USERVER_NAMESPACE::baggage::impl::kLazyInheritedBaggage.Emplace(
+                std::move(header), header_view, dynamic_config
             );
-            if (baggage) {
-                USERVER_NAMESPACE::baggage::kInheritedBaggage.Set(std::move(*baggage));
-            }
         }
     }
 
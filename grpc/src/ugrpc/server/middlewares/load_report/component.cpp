@@ -0,0 +1,54 @@
+#include <userver/ugrpc/server/middlewares/load_report/component.hpp>
+
+#include <grpcpp/ext/call_metric_recorder.h>
+
+#include <ugrpc/server/middlewares/load_report/middleware.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/ugrpc/server/server_component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::load_report {
+
+namespace {
+
+constexpr std::chrono::seconds kDefaultUpdatePeriod{1};
+
+}  // namespace
+
+Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : MiddlewareComponentBase(config, context), middleware_(std::make_shared<Middleware>()) {
+    auto& server = context.FindComponent<ServerComponent>().GetServer();
+    server.WithServerBuilder([](grpc::ServerBuilder& builder) {
+        grpc::experimental::EnableCallMetricRecording(&builder);
+    });
+
+    cpu_utilization_task_.Start(
+        "grpc-server-load-report",
+        config["update-period"].As<std::chrono::milliseconds>(kDefaultUpdatePeriod),
+        [this] { middleware_->UpdateCpuUtilization(); }
+    );
+}
+
+Component::~Component() { cpu_utilization_task_.Stop(); }
+
+std::shared_ptr<MiddlewareBase> Component::GetMiddleware() { return middleware_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<MiddlewareComponentBase>(R"(
+type: object
+description: gRPC server ORCA load report middleware component
+additionalProperties: false
+properties:
+    update-period:
+        type: string
+        description: how often to measure the CPU utilization
+        defaultDescription: 1s
+)");
+}
+
+}  // namespace ugrpc::server::middlewares::load_report
+
+USERVER_NAMESPACE_END
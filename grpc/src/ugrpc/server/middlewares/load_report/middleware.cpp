@@ -0,0 +1,70 @@
+#include "middleware.hpp"
+
+#include <time.h>
+
+#include <algorithm>
+#include <thread>
+
+#include <grpcpp/ext/call_metric_recorder.h>
+
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::load_report {
+
+namespace {
+
+// Name of the utilization metric must outlive the RPC
+constexpr std::string_view kInFlightMetric = "in_flight";
+
+std::chrono::nanoseconds GetProcessCpuTime() noexcept {
+    struct timespec ts {};
+    if (::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0) return {};
+    return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+}  // namespace
+
+Middleware::Middleware()
+    : cpu_count_(std::max(std::thread::hardware_concurrency(), 1U)),
+      last_cpu_time_(GetProcessCpuTime()),
+      last_update_(std::chrono::steady_clock::now()) {}
+
+void Middleware::Handle(MiddlewareCallContext& context) const {
+    in_flight_.fetch_add(1, std::memory_order_relaxed);
+    const utils::FastScopeGuard in_flight_guard{[this]() noexcept {
+        in_flight_.fetch_sub(1, std::memory_order_relaxed);
+    }};
+
+    // The report is sent with the trailing metadata, so it has to be recorded
+    // before the handler finishes the RPC
+    auto* recorder = context.GetCall().GetContext().ExperimentalGetCallMetricRecorder();
+    if (recorder) {
+        recorder->RecordCpuUtilizationMetric(GetCpuUtilization());
+        recorder->RecordUtilizationMetric(
+            grpc::string_ref{kInFlightMetric.data(), kInFlightMetric.size()}, static_cast<double>(GetInFlight())
+        );
+    }
+
+    context.Next();
+}
+
+void Middleware::UpdateCpuUtilization() {
+    const auto cpu_time = GetProcessCpuTime();
+    const auto now = std::chrono::steady_clock::now();
+
+    const std::chrono::duration<double> cpu_spent = cpu_time - last_cpu_time_;
+    const std::chrono::duration<double> wall_spent = now - last_update_;
+    if (wall_spent.count() <= 0) return;
+
+    last_cpu_time_ = cpu_time;
+    last_update_ = now;
+    cpu_utilization_.store(
+        std::clamp(cpu_spent.count() / wall_spent.count() / cpu_count_, 0.0, 1.0), std::memory_order_relaxed
+    );
+}
+
+}  // namespace ugrpc::server::middlewares::load_report
+
+USERVER_NAMESPACE_END
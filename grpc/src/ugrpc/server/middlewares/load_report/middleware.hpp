@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include <userver/ugrpc/server/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::load_report {
+
+class Middleware final : public MiddlewareBase {
+public:
+    Middleware();
+
+    void Handle(MiddlewareCallContext& context) const override;
+
+    // Recalculates the CPU utilization since the previous call
+    void UpdateCpuUtilization();
+
+    double GetCpuUtilization() const noexcept { return cpu_utilization_.load(std::memory_order_relaxed); }
+
+    std::size_t GetInFlight() const noexcept { return in_flight_.load(std::memory_order_relaxed); }
+
+private:
+    const unsigned cpu_count_;
+    std::chrono::nanoseconds last_cpu_time_;
+    std::chrono::steady_clock::time_point last_update_;
+    std::atomic<double> cpu_utilization_{0};
+    mutable std::atomic<std::size_t> in_flight_{0};
+};
+
+}  // namespace ugrpc::server::middlewares::load_report
+
+USERVER_NAMESPACE_END
@@ -145,7 +145,9 @@ Server::Impl::Impl(
     }
     server_builder_.emplace();
     ApplyChannelArgs(*server_builder_, config);
-    completion_queues_.emplace(config.completion_queue_num, *server_builder_);
+    completion_queues_.emplace(
+        config.completion_queue_num, *server_builder_, config.completion_queue_poll_task_processor
+    );
 
     if (config.unix_socket_path) AddListeningUnixSocket(*config.unix_socket_path, config.tls);
 
@@ -196,6 +198,12 @@ impl::ServiceSettings Server::Impl::MakeServiceSettings(ServiceConfig&& config)
         std::move(config.middlewares),
         access_tskv_logger_,
         config_source_,
+        config.arena_initial_block_size,
+        config.max_requests_in_flight,
+        std::move(config.method_max_requests_in_flight),
+        config.max_queue_wait_time,
+        std::move(config.method_task_processors),
+        std::move(config.inline_methods),
     };
 }
 
@@ -56,6 +56,12 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-poll-task-processor:
+        type: string
+        description: |
+            the task processor to poll the completion queues on, instead of
+            dedicated threads
+        defaultDescription: dedicated threads are used
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
@@ -110,6 +116,16 @@ properties:
                 items:
                     type: string
                     description: middleware component name
+            arena-initial-block-size:
+                type: integer
+                description: size of the initial block of the per-call protobuf Arena, 0 disables the Arena
+                minimum: 0
+            max-queue-wait-time:
+                type: string
+                description: |
+                    RPCs that have waited in the task processor queue for
+                    longer are rejected with RESOURCE_EXHAUSTED, 0 disables
+                    the check
 )");
 }
 
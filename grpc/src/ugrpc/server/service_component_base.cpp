@@ -48,6 +48,50 @@ properties:
         items:
             type: string
             description: middleware component name
+    arena-initial-block-size:
+        type: integer
+        description: size of the initial block of the per-call protobuf Arena, 0 disables the Arena
+        defaultDescription: uses grpc-server.service-defaults.arena-initial-block-size
+        minimum: 0
+    max-queue-wait-time:
+        type: string
+        description: |
+            RPCs that have waited in the task processor queue for longer are
+            rejected with RESOURCE_EXHAUSTED, 0 disables the check
+        defaultDescription: uses grpc-server.service-defaults.max-queue-wait-time
+    max-requests-in-flight:
+        type: integer
+        description: max count of in-flight RPCs of the service, extra RPCs are rejected with RESOURCE_EXHAUSTED
+        defaultDescription: no limit
+        minimum: 1
+    method-max-requests-in-flight:
+        type: object
+        description: max count of in-flight RPCs per method name, extra RPCs are rejected with RESOURCE_EXHAUSTED
+        defaultDescription: no limits
+        properties: {}
+        additionalProperties:
+            type: integer
+            description: max count of in-flight RPCs of the method
+            minimum: 1
+    method-task-processors:
+        type: object
+        description: task processors to use for responses per method name
+        defaultDescription: all the methods use task-processor
+        properties: {}
+        additionalProperties:
+            type: string
+            description: the task processor to use for responses of the method
+    inline-methods:
+        type: array
+        description: |
+            names of the unary methods that are handled right in the task that
+            has received the RPC, without starting a new task per RPC; the RPCs
+            of such a method are handled one at a time per completion queue, so
+            the handlers must be fast and must never block
+        defaultDescription: a new task is started per RPC
+        items:
+            type: string
+            description: method name
 )");
 }
 
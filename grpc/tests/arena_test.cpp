@@ -0,0 +1,131 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/task/task.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kArenaInitialBlockSize = 1024;
+
+class ArenaService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& context, sample::ugrpc::GreetingRequest&& request) override {
+        auto* const arena = context.GetArena();
+        sample::ugrpc::GreetingResponse response;
+        if (!arena) {
+            response.set_name("No arena");
+            return response;
+        }
+        EXPECT_EQ(request.GetArena(), arena);
+
+        auto* const greeting = google::protobuf::Arena::Create<sample::ugrpc::GreetingRequest>(arena);
+        greeting->set_name("Hello " + request.name());
+        response.set_name(greeting->name());
+        return response;
+    }
+
+    ReadManyResult
+    ReadMany(CallContext& context, sample::ugrpc::StreamGreetingRequest&& request, ReadManyWriter& writer) override {
+        EXPECT_EQ(request.GetArena(), context.GetArena());
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name("Hello again " + request.name());
+        for (int i = 0; i < request.number(); ++i) {
+            response.set_number(i);
+            writer.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+
+    WriteManyResult WriteMany(CallContext& context, WriteManyReader& reader) override {
+        auto* const request = google::protobuf::Arena::Create<sample::ugrpc::StreamGreetingRequest>(context.GetArena());
+        int count = 0;
+        while (reader.Read(*request)) {
+            ++count;
+        }
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name("Hello");
+        response.set_number(count);
+        return response;
+    }
+};
+
+class GrpcArena : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    explicit GrpcArena(std::size_t arena_initial_block_size) {
+        GetServer().AddService(
+            service_,
+            ugrpc::server::ServiceConfig{
+                engine::current_task::GetTaskProcessor(),
+                ugrpc::tests::GetDefaultServerMiddlewares(),
+                arena_initial_block_size,
+            }
+        );
+        StartServer();
+    }
+
+    GrpcArena() : GrpcArena(kArenaInitialBlockSize) {}
+
+    ~GrpcArena() override { StopServer(); }
+
+private:
+    ArenaService service_;
+};
+
+class GrpcNoArena : public GrpcArena {
+protected:
+    GrpcNoArena() : GrpcArena(0) {}
+};
+
+}  // namespace
+
+UTEST_F(GrpcArena, Unary) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    for (int i = 0; i < 3; ++i) {
+        sample::ugrpc::GreetingRequest request;
+        request.set_name("userver");
+        EXPECT_EQ(client.SayHello(request).name(), "Hello userver");
+    }
+}
+
+UTEST_F(GrpcArena, InputStream) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    request.set_number(3);
+    auto stream = client.ReadMany(request);
+
+    sample::ugrpc::StreamGreetingResponse response;
+    int count = 0;
+    while (stream.Read(response)) {
+        EXPECT_EQ(response.name(), "Hello again userver");
+        EXPECT_EQ(response.number(), count);
+        ++count;
+    }
+    EXPECT_EQ(count, 3);
+}
+
+UTEST_F(GrpcArena, OutputStream) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto stream = client.WriteMany();
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    for (int i = 0; i < 3; ++i) {
+        request.set_number(i);
+        ASSERT_TRUE(stream.Write(request));
+    }
+    EXPECT_EQ(stream.Finish().number(), 3);
+}
+
+UTEST_F(GrpcNoArena, Unary) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    EXPECT_EQ(client.SayHello(request).name(), "No arena");
+}
+
+USERVER_NAMESPACE_END
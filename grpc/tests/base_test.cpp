@@ -406,4 +406,71 @@ UTEST_F(GrpcWriteAndFinish, BidirectionalStream) {
     EXPECT_FALSE(is.Read(in));
 }
 
+namespace {
+
+class WriteBatchService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    ReadManyResult
+    ReadMany(CallContext& /*context*/, sample::ugrpc::StreamGreetingRequest&& request, ReadManyWriter& writer)
+        override {
+        std::vector<sample::ugrpc::StreamGreetingResponse> responses(request.number());
+        for (int i = 0; i < request.number(); ++i) {
+            responses[i].set_number(i);
+            responses[i].set_name("Hello " + request.name());
+        }
+        writer.WriteBatch(responses);
+        return grpc::Status::OK;
+    }
+
+    ChatResult Chat(CallContext& /*context*/, ChatReaderWriter& stream) override {
+        sample::ugrpc::StreamGreetingRequest request;
+        std::vector<sample::ugrpc::StreamGreetingResponse> responses;
+        while (stream.Read(request)) {
+            responses.resize(request.number());
+            for (int i = 0; i < request.number(); ++i) responses[i].set_number(i);
+            stream.WriteBatch(responses);
+        }
+        return grpc::Status::OK;
+    }
+};
+
+}  // namespace
+
+using GrpcWriteBatch = ugrpc::tests::ServiceFixture<WriteBatchService>;
+
+UTEST_F(GrpcWriteBatch, InputStream) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::StreamGreetingRequest out;
+    out.set_name("userver");
+    out.set_number(kNumber);
+    auto is = client.ReadMany(out, PrepareClientContext());
+
+    sample::ugrpc::StreamGreetingResponse in;
+    for (int i = 0; i < kNumber; ++i) {
+        ASSERT_TRUE(is.Read(in));
+        EXPECT_EQ(in.number(), i);
+        EXPECT_EQ(in.name(), "Hello userver");
+    }
+    EXPECT_FALSE(is.Read(in));
+}
+
+UTEST_F(GrpcWriteBatch, BidirectionalStream) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto bs = client.Chat(PrepareClientContext());
+
+    sample::ugrpc::StreamGreetingRequest out;
+    sample::ugrpc::StreamGreetingResponse in;
+    for (int batch_size = 1; batch_size < 4; ++batch_size) {
+        out.set_number(batch_size);
+        ASSERT_TRUE(bs.Write(out));
+        // The last message of the batch is flushed without further writes
+        for (int i = 0; i < batch_size; ++i) {
+            ASSERT_TRUE(bs.Read(in));
+            EXPECT_EQ(in.number(), i);
+        }
+    }
+    ASSERT_TRUE(bs.WritesDone());
+    EXPECT_FALSE(bs.Read(in));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,112 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// The first call of each kind misbehaves, the next ones succeed
+class FlakyService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        const auto call_index = calls_++;
+        if (call_index == 0) {
+            if (request.name() == "unavailable") {
+                return grpc::Status{grpc::StatusCode::UNAVAILABLE, "Try again"};
+            }
+            if (request.name() == "invalid") {
+                return grpc::Status{grpc::StatusCode::INVALID_ARGUMENT, "Do not try again"};
+            }
+            if (request.name() == "slow") {
+                engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+            }
+        }
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+
+    std::size_t GetCalls() const { return calls_.load(); }
+
+private:
+    std::atomic<std::size_t> calls_{0};
+};
+
+using GrpcClientAttempts = ugrpc::tests::ServiceFixture<FlakyService>;
+
+sample::ugrpc::GreetingRequest MakeRequest(std::string name) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::move(name));
+    return request;
+}
+
+ugrpc::client::Qos MakeQos(std::size_t attempts, std::optional<std::chrono::milliseconds> hedging_delay = {}) {
+    ugrpc::client::Qos qos;
+    qos.attempts = attempts;
+    qos.hedging_delay = hedging_delay;
+    return qos;
+}
+
+}  // namespace
+
+UTEST_F(GrpcClientAttempts, RetryUnavailable) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    const auto response =
+        client.SyncSayHello(MakeRequest("unavailable"), std::make_unique<grpc::ClientContext>(), MakeQos(2));
+    EXPECT_EQ(response.name(), "Hello unavailable");
+    EXPECT_EQ(GetService().GetCalls(), 2);
+
+    const auto stats =
+        GetStatistics("grpc.client.by-destination", {{"grpc_destination", "sample.ugrpc.UnitTestService/SayHello"}});
+    EXPECT_EQ(stats.SingleMetric("retries"), utils::statistics::Rate{1});
+    EXPECT_EQ(stats.SingleMetric("hedged-attempts"), utils::statistics::Rate{0});
+}
+
+UTEST_F(GrpcClientAttempts, NoRetriesByDefault) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    UEXPECT_THROW(client.SyncSayHello(MakeRequest("unavailable")), ugrpc::client::UnavailableError);
+    EXPECT_EQ(GetService().GetCalls(), 1);
+}
+
+UTEST_F(GrpcClientAttempts, NoRetryOfNonRetryableError) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    UEXPECT_THROW(
+        client.SyncSayHello(MakeRequest("invalid"), std::make_unique<grpc::ClientContext>(), MakeQos(3)),
+        ugrpc::client::InvalidArgumentError
+    );
+    EXPECT_EQ(GetService().GetCalls(), 1);
+}
+
+UTEST_F(GrpcClientAttempts, Hedging) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    const auto response =
+        client.SyncSayHello(MakeRequest("slow"), std::make_unique<grpc::ClientContext>(), MakeQos(2, 50ms));
+    EXPECT_EQ(response.name(), "Hello slow");
+    EXPECT_EQ(GetService().GetCalls(), 2);
+
+    const auto stats =
+        GetStatistics("grpc.client.by-destination", {{"grpc_destination", "sample.ugrpc.UnitTestService/SayHello"}});
+    EXPECT_EQ(stats.SingleMetric("hedged-attempts"), utils::statistics::Rate{1});
+    EXPECT_EQ(stats.SingleMetric("hedged-wins"), utils::statistics::Rate{1});
+}
+
+UTEST_F(GrpcClientAttempts, NoHedgingForFastResponses) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    const auto response =
+        client.SyncSayHello(MakeRequest("userver"), std::make_unique<grpc::ClientContext>(), MakeQos(2, 10s));
+    EXPECT_EQ(response.name(), "Hello userver");
+    EXPECT_EQ(GetService().GetCalls(), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <userver/ugrpc/server/generic_proxy.hpp>
+
+#include <userver/ugrpc/byte_buffer_utils.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/algo.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kProxiedSayHelloCallName = "sample.ugrpc.ProxiedService/SayHello";
+constexpr std::string_view kSayHelloCallName = "sample.ugrpc.UnitTestService/SayHello";
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& context, sample::ugrpc::GreetingRequest&& request) override {
+        context.GetServerContext().AddTrailingMetadata("upstream", "unit-test-service");
+        if (request.name().empty()) {
+            return grpc::Status{grpc::StatusCode::INVALID_ARGUMENT, "Empty name"};
+        }
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+};
+
+// Forwards the calls of a non-existent service to UnitTestService
+class ProxyService final : public ugrpc::server::GenericServiceBase {
+public:
+    GenericResult Handle(GenericCallContext& context, GenericReaderWriter& stream) override {
+        EXPECT_EQ(context.GetCallName(), kProxiedSayHelloCallName);
+        UINVARIANT(client_, "The client is not set");
+        return ugrpc::server::ProxyUnaryCall(context, stream, *client_, kSayHelloCallName);
+    }
+
+    void SetClient(ugrpc::client::GenericClient&& client) { client_.emplace(std::move(client)); }
+
+private:
+    std::optional<ugrpc::client::GenericClient> client_;
+};
+
+class GenericProxyTest : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    GenericProxyTest() {
+        RegisterService(service_);
+        RegisterService(proxy_);
+        StartServer();
+        proxy_.SetClient(MakeClient<ugrpc::client::GenericClient>());
+    }
+
+    ~GenericProxyTest() override { StopServer(); }
+
+private:
+    UnitTestService service_;
+    ProxyService proxy_;
+};
+
+}  // namespace
+
+UTEST_F(GenericProxyTest, UnaryCall) {
+    const auto client = MakeClient<ugrpc::client::GenericClient>();
+
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("proxy");
+    auto future = client.AsyncUnaryCall(kProxiedSayHelloCallName, ugrpc::SerializeToByteBuffer(request));
+
+    sample::ugrpc::GreetingResponse response;
+    ASSERT_TRUE(ugrpc::ParseFromByteBuffer(future.Get(), response));
+    EXPECT_EQ(response.name(), "Hello proxy");
+
+    const auto& metadata = future.GetCall().GetContext().GetServerTrailingMetadata();
+    EXPECT_EQ(utils::FindOrDefault(metadata, "upstream"), "unit-test-service");
+}
+
+UTEST_F(GenericProxyTest, UpstreamError) {
+    const auto client = MakeClient<ugrpc::client::GenericClient>();
+
+    const sample::ugrpc::GreetingRequest request;
+    auto future = client.AsyncUnaryCall(kProxiedSayHelloCallName, ugrpc::SerializeToByteBuffer(request));
+    UEXPECT_THROW_MSG(future.Get(), ugrpc::client::InvalidArgumentError, "Empty name");
+}
+
+UTEST(ByteBufferUtils, ParseKeepsBuffer) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    const auto buffer = ugrpc::SerializeToByteBuffer(request);
+
+    for (int i = 0; i < 2; ++i) {
+        sample::ugrpc::GreetingRequest parsed;
+        ASSERT_TRUE(ugrpc::ParseFromByteBuffer(buffer, parsed));
+        EXPECT_EQ(parsed.name(), "userver");
+    }
+    EXPECT_EQ(buffer.Length(), request.ByteSizeLong());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,146 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/algo.hpp>
+
+#include <ugrpc/impl/rpc_metadata.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class BlockingService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        if (request.name() == "block") {
+            is_blocked_.Send();
+            EXPECT_TRUE(release_.WaitForEvent());
+        }
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+
+    void WaitBlocked() { ASSERT_TRUE(is_blocked_.WaitForEvent()); }
+
+    void Release() { release_.Send(); }
+
+private:
+    engine::SingleConsumerEvent is_blocked_;
+    engine::SingleConsumerEvent release_;
+};
+
+ugrpc::server::ServiceConfig MakeServiceConfig() {
+    return ugrpc::server::ServiceConfig{
+        engine::current_task::GetTaskProcessor(),
+        ugrpc::tests::GetDefaultServerMiddlewares(),
+    };
+}
+
+class GrpcInFlightLimit : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    explicit GrpcInFlightLimit(ugrpc::server::ServiceConfig&& config) {
+        GetServer().AddService(service_, std::move(config));
+        StartServer();
+    }
+
+    ~GrpcInFlightLimit() override { StopServer(); }
+
+    BlockingService& GetService() { return service_; }
+
+private:
+    BlockingService service_;
+};
+
+class GrpcServiceInFlightLimit : public GrpcInFlightLimit {
+protected:
+    GrpcServiceInFlightLimit() : GrpcInFlightLimit([] {
+        auto config = MakeServiceConfig();
+        config.max_requests_in_flight = 1;
+        return config;
+    }()) {}
+};
+
+class GrpcMethodInFlightLimit : public GrpcInFlightLimit {
+protected:
+    GrpcMethodInFlightLimit() : GrpcInFlightLimit([] {
+        auto config = MakeServiceConfig();
+        config.method_max_requests_in_flight = {{"SayHello", 1}};
+        return config;
+    }()) {}
+};
+
+class GrpcQueueWaitTimeLimit : public GrpcInFlightLimit {
+protected:
+    GrpcQueueWaitTimeLimit() : GrpcInFlightLimit([] {
+        auto config = MakeServiceConfig();
+        config.max_queue_wait_time = std::chrono::milliseconds{10};
+        return config;
+    }()) {}
+};
+
+sample::ugrpc::GreetingRequest MakeRequest(std::string name) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::move(name));
+    return request;
+}
+
+template <typename Future>
+void ExpectRejected(Future& future, const grpc::string& reason) {
+    UEXPECT_THROW(future.Get(), ugrpc::client::ResourceExhaustedError);
+    const auto& metadata = future.GetCall().GetContext().GetServerInitialMetadata();
+    EXPECT_EQ(reason, utils::FindOrDefault(metadata, ugrpc::impl::kXYaTaxiRatelimitReason));
+}
+
+}  // namespace
+
+UTEST_F(GrpcServiceInFlightLimit, Basic) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    auto blocked = client.AsyncSayHello(MakeRequest("block"));
+    GetService().WaitBlocked();
+
+    auto rejected = client.AsyncSayHello(MakeRequest("userver"));
+    ExpectRejected(rejected, ugrpc::impl::kInFlightRatelimitReason);
+
+    GetService().Release();
+    EXPECT_EQ(blocked.Get().name(), "Hello block");
+
+    // The slot is released after the RPC is finished
+    EXPECT_EQ(client.SayHello(MakeRequest("userver")).name(), "Hello userver");
+}
+
+UTEST_F(GrpcMethodInFlightLimit, Basic) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    auto blocked = client.AsyncSayHello(MakeRequest("block"));
+    GetService().WaitBlocked();
+
+    auto rejected = client.AsyncSayHello(MakeRequest("userver"));
+    ExpectRejected(rejected, ugrpc::impl::kInFlightRatelimitReason);
+
+    GetService().Release();
+    EXPECT_EQ(blocked.Get().name(), "Hello block");
+    EXPECT_EQ(client.SayHello(MakeRequest("userver")).name(), "Hello userver");
+}
+
+UTEST_F(GrpcQueueWaitTimeLimit, Basic) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    EXPECT_EQ(client.SayHello(MakeRequest("userver")).name(), "Hello userver");
+
+    auto rejected = client.AsyncSayHello(MakeRequest("userver"));
+    // Occupy the only thread of the task processor, so that the handling task
+    // waits in the queue
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    ExpectRejected(rejected, ugrpc::impl::kQueueWaitTimeRatelimitReason);
+}
+
+USERVER_NAMESPACE_END
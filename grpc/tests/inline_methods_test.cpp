@@ -0,0 +1,73 @@
+#include <userver/utest/utest.hpp>
+
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/task/task.hpp>
+
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class GreeterService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+};
+
+class GrpcInlineMethods : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    GrpcInlineMethods() {
+        ugrpc::server::ServiceConfig config{
+            engine::current_task::GetTaskProcessor(),
+            ugrpc::tests::GetDefaultServerMiddlewares(),
+        };
+        config.method_task_processors = {{"SayHello", &engine::current_task::GetTaskProcessor()}};
+        config.inline_methods = {"SayHello"};
+
+        GetServer().AddService(service_, std::move(config));
+        StartServer();
+    }
+
+    ~GrpcInlineMethods() override { StopServer(); }
+
+private:
+    GreeterService service_;
+};
+
+sample::ugrpc::GreetingRequest MakeRequest(std::string_view name) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(grpc::string(name));
+    return request;
+}
+
+}  // namespace
+
+UTEST_F_MT(GrpcInlineMethods, Sequential, 2) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(client.SayHello(MakeRequest("userver")).name(), "Hello userver");
+    }
+}
+
+UTEST_F_MT(GrpcInlineMethods, Concurrent, 4) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    std::vector<ugrpc::client::ResponseFuture<sample::ugrpc::GreetingResponse>> futures;
+    for (int i = 0; i < 20; ++i) {
+        futures.push_back(client.AsyncSayHello(MakeRequest("userver")));
+    }
+    for (auto& future : futures) {
+        EXPECT_EQ(future.Get().name(), "Hello userver");
+    }
+}
+
+USERVER_NAMESPACE_END
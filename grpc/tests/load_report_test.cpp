@@ -0,0 +1,70 @@
+#include <userver/utest/utest.hpp>
+
+#include <grpcpp/ext/call_metric_recorder.h>
+
+#include <ugrpc/server/middlewares/load_report/middleware.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+#include <userver/utils/algo.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kLoadReportMetadata = "endpoint-load-metrics-bin";
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+};
+
+class LoadReportTest : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    LoadReportTest() : middleware_(std::make_shared<ugrpc::server::middlewares::load_report::Middleware>()) {
+        SetServerMiddlewares({middleware_});
+        GetServer().WithServerBuilder([](grpc::ServerBuilder& builder) {
+            grpc::experimental::EnableCallMetricRecording(&builder);
+        });
+
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~LoadReportTest() override { StopServer(); }
+
+    ugrpc::server::middlewares::load_report::Middleware& GetMiddleware() { return *middleware_; }
+
+private:
+    std::shared_ptr<ugrpc::server::middlewares::load_report::Middleware> middleware_;
+    UnitTestService service_;
+};
+
+}  // namespace
+
+UTEST_F(LoadReportTest, ReportInTrailingMetadata) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::GreetingRequest out;
+    out.set_name("userver");
+    auto future = client.AsyncSayHello(out);
+    EXPECT_EQ(future.Get().name(), "Hello userver");
+
+    const auto& metadata = future.GetCall().GetContext().GetServerTrailingMetadata();
+    EXPECT_FALSE(utils::FindOrDefault(metadata, kLoadReportMetadata).empty());
+    EXPECT_EQ(GetMiddleware().GetInFlight(), 0);
+}
+
+UTEST_F(LoadReportTest, CpuUtilization) {
+    GetMiddleware().UpdateCpuUtilization();
+    const auto utilization = GetMiddleware().GetCpuUtilization();
+    EXPECT_GE(utilization, 0.0);
+    EXPECT_LE(utilization, 1.0);
+}
+
+USERVER_NAMESPACE_END
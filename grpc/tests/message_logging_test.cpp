@@ -0,0 +1,66 @@
+#include <ugrpc/impl/logging.hpp>
+
+#include <fmt/format.h>
+#include <gmock/gmock.h>
+
+#include <userver/utest/log_capture_fixture.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <tests/messages.pb.h>
+#include <tests/secret_fields.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+ugrpc::impl::MessageLoggingOptions MakeOptions(std::size_t max_size) {
+    ugrpc::impl::MessageLoggingOptions options;
+    options.log_level = logging::Level::kInfo;
+    options.max_size = max_size;
+    return options;
+}
+
+using MessageLogging = utest::LogCaptureFixture<>;
+
+}  // namespace
+
+UTEST_F(MessageLogging, SameAsDebugString) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver \xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82");
+    EXPECT_EQ(ugrpc::impl::GetMessageForLogging(request, MakeOptions(512)), request.Utf8DebugString());
+}
+
+UTEST_F(MessageLogging, Truncated) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::string(10000, 'a'));
+
+    const auto body = ugrpc::impl::GetMessageForLogging(request, MakeOptions(20));
+    const auto full = request.Utf8DebugString();
+    EXPECT_EQ(body, fmt::format("{}...(truncated, total {} bytes)", full.substr(0, 20), full.size()));
+}
+
+UTEST_F(MessageLogging, TruncatedAtUtf8Boundary) {
+    sample::ugrpc::GreetingRequest request;
+    // 'name: "' takes 7 bytes, the 2-byte characters then end at an odd offset
+    std::string name;
+    for (int i = 0; i < 100; ++i) name += "\xd0\xbf";
+    request.set_name(name);
+
+    const auto body = ugrpc::impl::GetMessageForLogging(request, MakeOptions(20));
+    const auto full = request.Utf8DebugString();
+    EXPECT_EQ(body, fmt::format("{}...(truncated, total {} bytes)", full.substr(0, 19), full.size()));
+}
+
+UTEST_F(MessageLogging, SecretsTrimmed) {
+    sample::ugrpc::SendRequest request;
+    request.mutable_creds()->set_login("login");
+    request.mutable_creds()->set_password("password");
+    request.set_dest("dest");
+
+    const auto body = ugrpc::impl::GetMessageForLogging(request, MakeOptions(512));
+    EXPECT_THAT(body, testing::HasSubstr("login"));
+    EXPECT_THAT(body, testing::HasSubstr("dest"));
+    EXPECT_THAT(body, testing::Not(testing::HasSubstr("password")));
+}
+
+USERVER_NAMESPACE_END
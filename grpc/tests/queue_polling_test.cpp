@@ -0,0 +1,79 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+
+    ReadManyResult
+    ReadMany(CallContext& /*context*/, sample::ugrpc::StreamGreetingRequest&& request, ReadManyWriter& writer) override {
+        sample::ugrpc::StreamGreetingResponse response;
+        for (int i = 0; i < request.number(); ++i) {
+            response.set_number(i);
+            writer.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+};
+
+ugrpc::server::ServerConfig MakePolledQueuesConfig() {
+    ugrpc::server::ServerConfig config;
+    config.completion_queue_poll_task_processor = &engine::current_task::GetTaskProcessor();
+    return config;
+}
+
+class GrpcPolledQueues : public ugrpc::tests::Service<UnitTestService> {
+protected:
+    GrpcPolledQueues() : Service(MakePolledQueuesConfig()) {}
+};
+
+}  // namespace
+
+UTEST_F_MT(GrpcPolledQueues, Unary, 2) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    constexpr std::size_t kTasksCount = 8;
+    auto tasks = utils::GenerateFixedArray(kTasksCount, [&](std::size_t) {
+        return engine::AsyncNoSpan([&client] {
+            for (int i = 0; i < 16; ++i) {
+                sample::ugrpc::GreetingRequest request;
+                request.set_name("userver");
+                EXPECT_EQ(client.SyncSayHello(request).name(), "Hello userver");
+            }
+        });
+    });
+    engine::GetAll(tasks);
+}
+
+UTEST_F(GrpcPolledQueues, InputStream) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_number(5);
+    auto stream = client.ReadMany(request);
+
+    sample::ugrpc::StreamGreetingResponse response;
+    int count = 0;
+    while (stream.Read(response)) {
+        EXPECT_EQ(response.number(), count);
+        ++count;
+    }
+    EXPECT_EQ(count, 5);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <userver/ugrpc/client/impl/stub_pool.hpp>
+
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ugrpc::client::impl::StubLease;
+using ugrpc::client::impl::StubPool;
+using ugrpc::client::impl::StubPtr;
+
+void DeleteInt(void* ptr) noexcept { delete static_cast<int*>(ptr); }
+
+StubPtr MakeIntStub(int value) { return StubPtr(new int{value}, &DeleteInt); }
+
+utils::FixedArray<StubPtr> MakeIntStubs(std::size_t count) {
+    return utils::GenerateFixedArray(count, [](std::size_t index) { return MakeIntStub(static_cast<int>(index)); });
+}
+
+}  // namespace
+
+UTEST(StubPool, LeastLoaded) {
+    StubPool pool{MakeIntStubs(3)};
+    EXPECT_EQ(pool.GetSize(), 3);
+
+    std::vector<std::vector<StubLease>> leases(3);
+    for (int i = 0; i < 6; ++i) {
+        auto leased = pool.Next<int>();
+        leases[leased.stub].push_back(std::move(leased.lease));
+    }
+    for (const auto& stub_leases : leases) {
+        EXPECT_EQ(stub_leases.size(), 2);
+    }
+
+    // Only the stub with a finished RPC is not loaded
+    leases[1].back().Release();
+    EXPECT_EQ(pool.Next<int>().stub, 1);
+}
+
+UTEST(StubPool, Grow) {
+    StubPool::StubFactory factory = [] { return MakeIntStub(42); };
+    auto pool = std::make_shared<StubPool>(
+        MakeIntStubs(1),
+        /*max_size=*/2,
+        /*streams_threshold=*/2,
+        std::move(factory),
+        engine::current_task::GetTaskProcessor()
+    );
+
+    auto first = pool->Next<int>();
+    auto second = pool->Next<int>();
+    EXPECT_EQ(first.stub, 0);
+    EXPECT_EQ(second.stub, 0);
+    EXPECT_EQ(pool->GetSize(), 1);
+
+    // The stub is loaded, an extra stub is created in background
+    auto third = pool->Next<int>();
+    EXPECT_EQ(third.stub, 0);
+    while (pool->GetSize() != 2) engine::Yield();
+
+    EXPECT_EQ(pool->Next<int>().stub, 42);
+
+    // The pool does not grow above the max size
+    auto fourth = pool->Next<int>();
+    auto fifth = pool->Next<int>();
+    auto sixth = pool->Next<int>();
+    engine::Yield();
+    EXPECT_EQ(pool->GetSize(), 2);
+}
+
+USERVER_NAMESPACE_END
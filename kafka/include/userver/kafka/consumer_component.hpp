@@ -45,6 +45,9 @@ class Consumer;
 /// poll_timeout                       | maximum amount of time consumer waits for messages for new messages before calling a callback | 1s
 /// max_callback_duration              | duration user callback must fit not to be kicked from the consumer group | 5m
 /// restart_after_failure_delay        | time consumer suspends execution if user-callback fails | 10s
+/// queued_max_messages_kbytes         | maximum size of prefetched but not yet polled messages, fetching pauses when exceeded | 65536
+/// statistics_interval                | how often librdkafka reports the statistics exported as `consumer_lag` metrics, disabled if zero | 0ms
+/// process_partitions_concurrently    | whether to call the callback for each partition of a polled batch concurrently, committing each succeeded partition | false
 /// auto_offset_reset                  | action to take when there is no initial offset in offset store | smallest
 /// env_pod_name                       | environment variable to substitute `{pod_name}` substring in `group_id` | none
 /// security_protocol                  | protocol used to communicate with brokers | --
@@ -47,6 +47,12 @@ class Consumer;
 /// @note Each ConsumerScope instance is not thread-safe. To speed up the topic
 /// messages processing, create more consumers with the same `group_id`.
 ///
+/// With `process_partitions_concurrently` static config option set, each polled
+/// batch is split by topic partitions and the callback is called for the
+/// partitions concurrently, messages of a partition keep their order. Offsets
+/// of each partition are committed as soon as the callback succeeds for it, so
+/// ConsumerScope::AsyncCommit must not be called in this mode.
+///
 /// @see https://docs.confluent.io/platform/current/clients/consumer.html for
 /// basic consumer concepts
 /// @see
@@ -68,6 +74,8 @@ class Consumer;
 class ConsumerScope final {
 public:
     /// @brief Callback that is invoked on each polled message batch.
+    /// @note Is called concurrently for distinct partitions if
+    /// `process_partitions_concurrently` is set.
     /// @warning If callback throws, it called over and over again with the batch
     /// with the same messages, until successful invocation.
     /// Though, user should consider idempotent message processing mechanism.
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <string_view>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -70,6 +72,25 @@ public:
     UnknownPartitionException();
 };
 
+/// @brief Exception thrown by Producer::SendBatch if some messages of the
+/// batch are not delivered.
+class SendBatchException final : public SendException {
+public:
+    SendBatchException(
+        std::string_view first_error,
+        std::vector<std::size_t> failed_messages,
+        std::size_t batch_size,
+        bool is_retryable
+    );
+
+    /// @brief Returns indices of the not delivered messages in the batch.
+    /// @note IsRetryable is true if all of them may be retried.
+    const std::vector<std::size_t>& GetFailedMessages() const noexcept;
+
+private:
+    std::vector<std::size_t> failed_messages_;
+};
+
 /// @brief Exception thrown when there is an error retrieving the offset range.
 class OffsetRangeException : public std::runtime_error {
 public:
@@ -46,6 +46,8 @@ struct ConsumerConfiguration final {
     std::string auto_offset_reset{"smallest"};
     std::optional<std::string> env_pod_name{};
     std::chrono::milliseconds max_callback_duration{300000};
+    std::uint32_t queued_max_messages_kbytes{65536};  // 64 MiB
+    std::chrono::milliseconds statistics_interval{0};  // disabled
 
     RdKafkaOptions rd_kafka_options;
 };
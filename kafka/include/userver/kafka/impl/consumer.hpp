@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -43,6 +44,13 @@ struct ConsumerExecutionParams final {
     /// @brief Time consumer suspends execution after user-callback exception.
     /// @note After consumer restart, all uncommitted messages come again.
     std::chrono::milliseconds restart_after_failure_delay{10000};
+
+    /// @brief Whether to split each polled batch by topic partitions and call
+    /// the callback for the partitions concurrently.
+    /// Messages of a partition are passed in a single batch in their order.
+    /// Offsets of each partition are committed as soon as its processing
+    /// succeeds.
+    bool process_partitions_concurrently{false};
 };
 
 class Consumer final {
@@ -118,6 +126,12 @@ private:
     /// @brief Subscribes for configured topics and starts polling loop.
     void RunConsuming(ConsumerScope::Callback callback);
 
+    /// @brief Processes partitions of the `polled_messages` concurrently and
+    /// commits the offsets of each successfully processed partition.
+    /// @throws the first callback exception after all the partitions are
+    /// processed
+    void ProcessPartitionsConcurrently(const ConsumerScope::Callback& callback, std::vector<Message>& polled_messages);
+
 private:
     std::atomic<bool> processing_{false};
     Stats stats_;
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
@@ -21,6 +27,8 @@ struct MessagesCounts final {
 struct TopicStats final {
     MessagesCounts messages_counts;
     utils::statistics::RecentPeriod<MinMaxAvg, MinMaxAvg, utils::datetime::SteadyClock> avg_ms_spent_time;
+    // -1 if unknown
+    std::atomic<std::int64_t> consumer_lag{-1};
 };
 
 struct Stats final {
@@ -28,6 +36,22 @@ struct Stats final {
     utils::statistics::RelaxedCounter<uint64_t> connections_error = 0;
 };
 
+/// @brief The part of the librdkafka statistics that is exported as metrics.
+/// @see https://github.com/confluentinc/librdkafka/blob/master/STATISTICS.md
+struct LibrdkafkaStats final {
+    /// Sum of the known `consumer_lag` of the topic partitions, by topic
+    std::unordered_map<std::string, std::int64_t> topics_consumer_lag;
+};
+
+/// @brief Extracts LibrdkafkaStats from the statistics JSON with a SAX
+/// parser, without building a DOM of the multi-megabyte document.
+/// @throws formats::json::parser::ParseError
+LibrdkafkaStats ParseLibrdkafkaStats(std::string_view json);
+
+/// @brief Updates the gauges of `stats` by the parsed statistics, the topics
+/// missing from the statistics get unknown values.
+void AccountLibrdkafkaStats(Stats& stats, const LibrdkafkaStats& librdkafka_stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
 
 }  // namespace kafka::impl
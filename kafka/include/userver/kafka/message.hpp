@@ -2,6 +2,8 @@
 
 #include <chrono>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/span.hpp>
@@ -29,8 +31,16 @@ public:
     Message& operator=(const Message&) = delete;
 
     const std::string& GetTopic() const;
+    /// @note Key, payload and header views point into the message polled by
+    /// `librdkafka` and are valid while the Message is alive, i.e. for the
+    /// whole batch processing. No data is copied.
     std::string_view GetKey() const;
     std::string_view GetPayload() const;
+
+    /// @brief Returns the value of the last header with the given `name` or
+    /// std::nullopt if the message has no such header.
+    std::optional<std::string_view> GetHeader(std::string_view name) const;
+
     std::optional<std::chrono::milliseconds> GetTimestamp() const;
     int GetPartition() const;
     std::int64_t GetOffset() const;
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
+#include <string_view>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/kafka/exceptions.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -22,6 +25,16 @@ struct Secret;
 
 }  // namespace impl
 
+/// @brief Message of a batch sent with Producer::SendBatch. Does not own the
+/// data, it must live until Producer::SendBatch returns.
+struct ProducerMessageView final {
+    std::string_view key;
+    std::string_view message;
+
+    /// If not set, partition is chosen by internal Kafka partitioner
+    std::optional<std::uint32_t> partition{};
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Apache Kafka Producer Client.
@@ -114,6 +127,25 @@ public:
         std::optional<std::uint32_t> partition = std::nullopt
     ) const;
 
+    /// @brief Sends all the `messages` to topic `topic_name` and
+    /// asynchronously waits until the whole batch is delivered or failed.
+    ///
+    /// Messages are enqueued at once and are awaited with a single waiter per
+    /// batch, that is much cheaper than Producer::Send or Producer::SendAsync
+    /// call per message for large batches. No payload data is copied.
+    ///
+    /// Thread-safe and can be called from any number of threads
+    /// concurrently.
+    ///
+    /// @warning Like with a batch of Producer::SendAsync, the order messages
+    /// are written to partition may differ from the order of `messages`.
+    ///
+    /// @throws SendBatchException if some of the messages are not delivered
+    /// and acked by Kafka Broker in configured timeout, other messages of the
+    /// batch are delivered.
+    /// @snippet kafka/tests/producer_kafkatest.cpp Producer send batch
+    void SendBatch(const std::string& topic_name, utils::span<const ProducerMessageView> messages) const;
+
     /// @brief Dumps per topic messages produce statistics. No expected to be
     /// called manually.
     /// @see kafka/impl/stats.hpp
@@ -127,6 +159,8 @@ private:
         std::optional<std::uint32_t> partition
     ) const;
 
+    void SendBatchImpl(const std::string& topic_name, utils::span<const ProducerMessageView> messages) const;
+
 private:
     const std::string name_;
     engine::TaskProcessor& producer_task_processor_;
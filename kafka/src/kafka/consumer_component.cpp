@@ -37,6 +37,8 @@ ConsumerComponent::ConsumerComponent(
               params.restart_after_failure_delay =
                   config["restart_after_failure_delay"].As<std::chrono::milliseconds>(params.restart_after_failure_delay
                   );
+              params.process_partitions_concurrently =
+                  config["process_partitions_concurrently"].As<bool>(params.process_partitions_concurrently);
 
               return params;
           }()
@@ -95,6 +97,29 @@ properties:
         type: string
         description: backoff consumer waits until restart after user-callback exception.
         defaultDescription: 10s
+    queued_max_messages_kbytes:
+        type: integer
+        description: |
+            maximum total size of messages prefetched from brokers but not yet polled.
+            When exceeded, fetching from brokers is paused until the messages are
+            polled, so lagging consumers do not consume unbounded memory
+        minimum: 1
+        maximum: 2097151
+        defaultDescription: 65536
+    statistics_interval:
+        type: string
+        description: |
+            how often librdkafka reports its statistics, that are exported as
+            the per topic `consumer_lag` metrics. The statistics are not
+            collected if not set
+        defaultDescription: 0ms
+    process_partitions_concurrently:
+        type: boolean
+        description: |
+            whether to split each polled batch by topic partitions and call the callback
+            for the partitions concurrently. Offsets of each partition are committed
+            as soon as the callback for it succeeds
+        defaultDescription: false
     auto_offset_reset:
         type: string
         description: |
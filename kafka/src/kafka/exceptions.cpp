@@ -1,5 +1,7 @@
 #include <userver/kafka/exceptions.hpp>
 
+#include <utility>
+
 #include <fmt/format.h>
 
 USERVER_NAMESPACE_BEGIN
@@ -21,6 +23,23 @@ UnknownTopicException::UnknownTopicException() : SendException(kWhat) {}
 
 UnknownPartitionException::UnknownPartitionException() : SendException(kWhat) {}
 
+SendBatchException::SendBatchException(
+    std::string_view first_error,
+    std::vector<std::size_t> failed_messages,
+    std::size_t batch_size,
+    bool is_retryable
+)
+    : SendException(
+          fmt::format(
+              "{} of {} messages are not delivered, first error: {}", failed_messages.size(), batch_size, first_error
+          )
+              .c_str(),
+          is_retryable
+      ),
+      failed_messages_(std::move(failed_messages)) {}
+
+const std::vector<std::size_t>& SendBatchException::GetFailedMessages() const noexcept { return failed_messages_; }
+
 OffsetRangeException::OffsetRangeException(std::string_view what, std::string_view topic, std::uint32_t partition)
     : std::runtime_error(fmt::format("{} topic: '{}', partition: {}", what, topic, partition)) {}
 
@@ -142,6 +142,10 @@ ConsumerConfiguration Parse(const yaml_config::YamlConfig& config, formats::pars
     consumer.auto_offset_reset = config["auto_offset_reset"].As<std::string>(consumer.auto_offset_reset);
     consumer.max_callback_duration =
         config["max_callback_duration"].As<std::chrono::milliseconds>(consumer.max_callback_duration);
+    consumer.queued_max_messages_kbytes =
+        config["queued_max_messages_kbytes"].As<std::uint32_t>(consumer.queued_max_messages_kbytes);
+    consumer.statistics_interval =
+        config["statistics_interval"].As<std::chrono::milliseconds>(consumer.statistics_interval);
     if (config.HasMember(kEnvPodNameField)) {
         consumer.env_pod_name = config[kEnvPodNameField].As<std::string>();
     }
@@ -262,11 +266,15 @@ void Configuration::SetConsumer(const ConsumerConfiguration& configuration) {
     SetOption("enable.auto.commit", "false");
     SetOption("auto.offset.reset", configuration.auto_offset_reset);
     SetOption("max.poll.interval.ms", configuration.max_callback_duration);
-    rd_kafka_conf_set_events(
-        conf_.GetHandle(),
-        RD_KAFKA_EVENT_LOG | RD_KAFKA_EVENT_ERROR | RD_KAFKA_EVENT_OFFSET_COMMIT | RD_KAFKA_EVENT_REBALANCE |
-            RD_KAFKA_EVENT_FETCH
-    );
+    SetOption("queued.max.messages.kbytes", configuration.queued_max_messages_kbytes);
+
+    int events = RD_KAFKA_EVENT_LOG | RD_KAFKA_EVENT_ERROR | RD_KAFKA_EVENT_OFFSET_COMMIT | RD_KAFKA_EVENT_REBALANCE |
+                 RD_KAFKA_EVENT_FETCH;
+    if (configuration.statistics_interval.count() > 0) {
+        SetOption("statistics.interval.ms", configuration.statistics_interval);
+        events |= RD_KAFKA_EVENT_STATS;
+    }
+    rd_kafka_conf_set_events(conf_.GetHandle(), events);
 }
 
 void Configuration::SetProducer(const ProducerConfiguration& configuration) {
@@ -1,10 +1,15 @@
 #include <userver/kafka/impl/consumer.hpp>
 
+#include <exception>
+#include <map>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/kafka/impl/configuration.hpp>
 #include <userver/kafka/impl/stats.hpp>
@@ -47,6 +52,46 @@ std::function<void()> CreateDurationNotifier(std::chrono::milliseconds max_callb
     };
 }
 
+/// @brief Reorders `messages` so that messages of each topic partition are
+/// adjacent, preserving their order inside the partition.
+/// @returns the batches of messages of distinct partitions
+std::vector<MessageBatchView> GroupByPartitions(std::vector<Message>& messages) {
+    std::vector<std::vector<std::size_t>> partitions_messages;
+    std::map<std::pair<std::string_view, int>, std::size_t> partition_indices;
+    for (std::size_t index{0}; index < messages.size(); ++index) {
+        const auto& message = messages[index];
+        const auto [it, inserted] = partition_indices.emplace(
+            std::make_pair(std::string_view{message.GetTopic()}, message.GetPartition()), partitions_messages.size()
+        );
+        if (inserted) {
+            partitions_messages.emplace_back();
+        }
+        partitions_messages[it->second].push_back(index);
+    }
+
+    if (partitions_messages.size() > 1) {
+        std::vector<Message> grouped_messages;
+        grouped_messages.reserve(messages.size());
+        for (const auto& message_indices : partitions_messages) {
+            for (const auto index : message_indices) {
+                grouped_messages.push_back(std::move(messages[index]));
+            }
+        }
+        messages = std::move(grouped_messages);
+    }
+
+    std::vector<MessageBatchView> batches;
+    batches.reserve(partitions_messages.size());
+    const MessageBatchView all_messages{messages};
+    std::size_t offset{0};
+    for (const auto& message_indices : partitions_messages) {
+        batches.push_back(all_messages.subspan(offset).first(message_indices.size()));
+        offset += message_indices.size();
+    }
+
+    return batches;
+}
+
 }  // namespace
 
 Consumer::Consumer(
@@ -66,7 +111,7 @@ Consumer::Consumer(
       consumer_blocking_task_processor_(consumer_blocking_task_processor),
       main_task_processor_(main_task_processor),
       conf_(Configuration{name, configuration, secrets}.Release()),
-      consumer_(std::make_unique<ConsumerImpl>(name_, conf_, topics_, stats_)) {
+      consumer_(std::make_unique<ConsumerImpl>(name_, conf_, topics_, stats_, main_task_processor_)) {
     /// To check configuration validity
     [[maybe_unused]] auto _ = ConsumerHolder{conf_};
 }
@@ -93,7 +138,7 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
     // note: Consumer must be recreated after each stop,
     // because stop invalidates some internal consumer state (in librdkafka).
     // Nevertheless, it is possible to use blocking consumer methods after stop.
-    consumer_ = std::make_unique<ConsumerImpl>(name_, conf_, topics_, stats_);
+    consumer_ = std::make_unique<ConsumerImpl>(name_, conf_, topics_, stats_, main_task_processor_);
     consumer_->StartConsuming();
 
     LOG_INFO() << fmt::format("Started messages polling");
@@ -116,6 +161,11 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
         TESTPOINT(fmt::format("tp_{}_polled", name_), {});
 
+        if (execution_params.process_partitions_concurrently) {
+            ProcessPartitionsConcurrently(callback, polled_messages);
+            continue;
+        }
+
         auto batch_processing_task =
             utils::Async(main_task_processor_, "messages_processing", callback, utils::span{polled_messages});
         const utils::ScopeGuard callback_duration_notifier{
@@ -133,6 +183,47 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
     }
 }
 
+void Consumer::ProcessPartitionsConcurrently(
+    const ConsumerScope::Callback& callback,
+    std::vector<Message>& polled_messages
+) {
+    const auto partition_batches = GroupByPartitions(polled_messages);
+
+    std::vector<engine::TaskWithResult<void>> processing_tasks;
+    processing_tasks.reserve(partition_batches.size());
+    for (const auto partition_batch : partition_batches) {
+        processing_tasks.push_back(
+            utils::Async(main_task_processor_, "partition_messages_processing", callback, partition_batch)
+        );
+    }
+    const utils::ScopeGuard callback_duration_notifier{CreateDurationNotifier(execution_params.max_callback_duration)};
+
+    /// Each partition is committed as soon as processed, so that a failure of
+    /// one partition does not make other partitions be reprocessed after
+    /// the consumer restart
+    std::exception_ptr processing_error;
+    while (const auto finished = engine::WaitAny(processing_tasks)) {
+        const auto partition_batch = partition_batches[*finished];
+        try {
+            processing_tasks[*finished].Get();
+        } catch (const std::exception& e) {
+            consumer_->AccountMessageBatchProcessingFailed(partition_batch);
+            if (!processing_error) {
+                processing_error = std::current_exception();
+            }
+            continue;
+        }
+
+        consumer_->AccountMessageBatchProcessingSucceeded(partition_batch);
+        consumer_->AsyncCommitPartition(partition_batch[partition_batch.size() - 1]);
+    }
+
+    if (processing_error) {
+        std::rethrow_exception(processing_error);
+    }
+    TESTPOINT(fmt::format("tp_{}", name_), {});
+}
+
 void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
     UINVARIANT(!processing_.exchange(true), "Message processing already started");
 
@@ -48,6 +48,8 @@ std::string ToString(rd_kafka_event_type_t event_type) {
             return "OFFSET_COMMIT";
         case RD_KAFKA_EVENT_FETCH:
             return "FETCH";
+        case RD_KAFKA_EVENT_STATS:
+            return "STATS";
         default:
             return "UNEXPECTED_EVENT";
     }
@@ -95,6 +97,27 @@ std::string_view Message::GetPayload() const {
     return std::string_view{static_cast<const char*>(data_->message->payload), data_->message->len};
 }
 
+std::optional<std::string_view> Message::GetHeader(std::string_view name) const {
+    rd_kafka_headers_t* headers{nullptr};
+    if (rd_kafka_message_headers(data_->message.GetHandle(), &headers) != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        return std::nullopt;
+    }
+
+    std::optional<std::string_view> header_value;
+    const char* header_name{nullptr};
+    const void* value{nullptr};
+    std::size_t value_size{0};
+    for (std::size_t index{0};
+         rd_kafka_header_get_all(headers, index, &header_name, &value, &value_size) == RD_KAFKA_RESP_ERR_NO_ERROR;
+         ++index) {
+        if (header_name == name) {
+            header_value.emplace(value ? static_cast<const char*>(value) : "", value_size);
+        }
+    }
+
+    return header_value;
+}
+
 std::optional<std::chrono::milliseconds> Message::GetTimestamp() const { return data_->timestamp; }
 
 int Message::GetPartition() const { return data_->message->partition; }
@@ -218,6 +241,22 @@ void ConsumerImpl::RebalanceCallback(rd_kafka_resp_err_t err, const rd_kafka_top
     }
 }
 
+void ConsumerImpl::StatsCallback(const char* json) {
+    if (is_parsing_stats_.exchange(true)) {
+        LOG_LIMITED_WARNING() << "Skipping librdkafka statistics, the previous ones are still being parsed";
+        return;
+    }
+
+    stats_tasks_.CriticalAsyncDetach("kafka_statistics_parsing", [this, json = std::string{json}] {
+        try {
+            AccountLibrdkafkaStats(stats_, ParseLibrdkafkaStats(json));
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to parse librdkafka statistics: " << e;
+        }
+        is_parsing_stats_ = false;
+    });
+}
+
 void ConsumerImpl::OffsetCommitCallback(
     rd_kafka_resp_err_t err,
     const rd_kafka_topic_partition_list_t* committed_offsets
@@ -250,9 +289,10 @@ ConsumerImpl::ConsumerImpl(
     const std::string& name,
     const ConfHolder& conf,
     const std::vector<std::string>& topics,
-    Stats& stats
+    Stats& stats,
+    engine::TaskProcessor& stats_task_processor
 )
-    : name_(name), stats_(stats), topics_(topics), consumer_(conf) {}
+    : name_(name), stats_(stats), topics_(topics), consumer_(conf), stats_tasks_(stats_task_processor) {}
 
 const Stats& ConsumerImpl::GetStats() const { return stats_; }
 
@@ -298,6 +338,18 @@ void ConsumerImpl::Commit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*
 
 void ConsumerImpl::AsyncCommit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*async=*/1); }
 
+void ConsumerImpl::AsyncCommitPartition(const Message& last_processed_message) {
+    const TopicPartitionsListHolder offsets{rd_kafka_topic_partition_list_new(/*size=*/1)};
+    auto* topic_partition = rd_kafka_topic_partition_list_add(
+        offsets.GetHandle(), last_processed_message.GetTopic().c_str(), last_processed_message.GetPartition()
+    );
+    /// Committed offset is the offset of the next message to consume
+    topic_partition->offset = last_processed_message.GetOffset() + 1;
+
+    /// `rd_kafka_commit` copies the `offsets` list
+    rd_kafka_commit(consumer_.GetHandle(), offsets.GetHandle(), /*async=*/1);
+}
+
 OffsetRange ConsumerImpl::GetOffsetRange(
     const std::string& topic,
     std::uint32_t partition,
@@ -397,6 +449,9 @@ void ConsumerImpl::DispatchEvent(const EventHolder& event_holder) {
             rd_kafka_event_log(event, &facility, &message, &log_level);
             LogCallback(facility, message, log_level);
         } break;
+        case RD_KAFKA_EVENT_STATS:
+            StatsCallback(rd_kafka_event_stats(event));
+            break;
     }
 }
 
@@ -513,7 +568,7 @@ void ConsumerImpl::AccountMessageProcessingSucceeded(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_success;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingSucceeded(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingSucceeded(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingSucceeded(message);
     }
@@ -522,7 +577,7 @@ void ConsumerImpl::AccountMessageProcessingFailed(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_error;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingFailed(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingFailed(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingFailed(message);
     }
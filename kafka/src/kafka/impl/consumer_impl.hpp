@@ -1,10 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <optional>
 #include <vector>
 
 #include <librdkafka/rdkafka.h>
 
+#include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/kafka/impl/holders.hpp>
@@ -28,7 +30,13 @@ class ConsumerImpl final {
     using MessageBatch = std::vector<Message>;
 
 public:
-    ConsumerImpl(const std::string& name, const ConfHolder& conf, const std::vector<std::string>& topics, Stats& stats);
+    ConsumerImpl(
+        const std::string& name,
+        const ConfHolder& conf,
+        const std::vector<std::string>& topics,
+        Stats& stats,
+        engine::TaskProcessor& stats_task_processor
+    );
 
     const Stats& GetStats() const;
 
@@ -38,6 +46,10 @@ public:
     /// @brief Schedules the commitment task.
     void AsyncCommit();
 
+    /// @brief Schedules the commitment of the `last_processed_message`
+    /// partition offset, so that consuming continues from the next message.
+    void AsyncCommitPartition(const Message& last_processed_message);
+
     /// @brief Retrieves the low and high offsets for the specified topic and partition.
     OffsetRange GetOffsetRange(
         const std::string& topic,
@@ -54,9 +66,9 @@ public:
     MessageBatch PollBatch(std::size_t max_batch_size, engine::Deadline deadline);
 
     void AccountMessageProcessingSucceeded(const Message& message);
-    void AccountMessageBatchProcessingSucceeded(const MessageBatch& batch);
+    void AccountMessageBatchProcessingSucceeded(MessageBatchView batch);
     void AccountMessageProcessingFailed(const Message& message);
-    void AccountMessageBatchProcessingFailed(const MessageBatch& batch);
+    void AccountMessageBatchProcessingFailed(MessageBatchView batch);
 
     void EventCallback();
 
@@ -105,6 +117,11 @@ private:
     /// @brief Revokes `partitions` from the current consumer.
     void RevokePartitions(const rd_kafka_topic_partition_list_s* partitions);
 
+    /// @brief Callback called with the librdkafka statistics JSON each
+    /// `statistics.interval.ms`. Parses the statistics in a separate task, so
+    /// that the polling is not delayed by the multi-megabyte documents.
+    void StatsCallback(const char* json);
+
     /// @brief Callback which is called after succeeded/failed commit.
     /// Currently, used for logging purposes.
     void OffsetCommitCallback(rd_kafka_resp_err_t err, const rd_kafka_topic_partition_list_s* committed_offsets);
@@ -122,6 +139,9 @@ private:
     engine::SingleConsumerEvent queue_became_non_empty_event_;
 
     ConsumerHolder consumer_;
+
+    std::atomic<bool> is_parsing_stats_{false};
+    concurrent::BackgroundTaskStorage stats_tasks_;
 };
 
 }  // namespace kafka::impl
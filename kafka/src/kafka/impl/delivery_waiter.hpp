@@ -1,5 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
 #include <librdkafka/rdkafka.h>
 
 #include <userver/engine/future.hpp>
@@ -26,9 +31,21 @@ private:
     std::optional<rd_kafka_msg_status_t> message_status_;
 };
 
+/// @brief Handler of the message delivery report. Pointer to it is passed to
+/// `librdkafka` as the message opaque.
+class DeliveryReportHandler {
+public:
+    /// @brief Called once on the message delivery report. The handler must not
+    /// be used after the call.
+    virtual void OnDeliveryReport(DeliveryResult delivery_result) = 0;
+
+protected:
+    ~DeliveryReportHandler() = default;
+};
+
 /// @brief State for waiting delivery callback invoked after producer send
 /// called
-class DeliveryWaiter final {
+class DeliveryWaiter final : public DeliveryReportHandler {
 public:
     DeliveryWaiter() = default;
 
@@ -36,10 +53,46 @@ public:
 
     void SetDeliveryResult(DeliveryResult delivery_result);
 
+    /// @brief Sets the delivery result and destroys the waiter.
+    void OnDeliveryReport(DeliveryResult delivery_result) override;
+
 private:
     engine::Promise<DeliveryResult> wait_handle_;
 };
 
+/// @brief State for waiting delivery of a batch of messages with a single
+/// future, which becomes ready after all the messages are reported.
+///
+/// Must be allocated with `new`, destroys itself after the last report.
+class BatchDeliveryWaiter final {
+public:
+    explicit BatchDeliveryWaiter(std::size_t messages_count);
+
+    engine::Future<std::vector<DeliveryResult>> GetFuture();
+
+    /// @brief Returns the handler to pass as an opaque of the `index`-th message
+    DeliveryReportHandler& GetMessageHandler(std::size_t index);
+
+private:
+    class MessageHandler final : public DeliveryReportHandler {
+    public:
+        MessageHandler(BatchDeliveryWaiter& waiter, std::size_t index) : waiter_(waiter), index_(index) {}
+
+        void OnDeliveryReport(DeliveryResult delivery_result) override;
+
+    private:
+        BatchDeliveryWaiter& waiter_;
+        const std::size_t index_;
+    };
+
+    void SetDeliveryResult(std::size_t index, DeliveryResult delivery_result);
+
+    std::vector<MessageHandler> handlers_;
+    std::vector<std::optional<DeliveryResult>> results_;
+    std::atomic<std::size_t> not_reported_count_;
+    engine::Promise<std::vector<DeliveryResult>> wait_handle_;
+};
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
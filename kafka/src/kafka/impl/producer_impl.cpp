@@ -64,7 +64,7 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
 
     const char* topic_name = rd_kafka_topic_name(message->rkt);
 
-    auto* complete_handle = static_cast<DeliveryWaiter*>(message->_private);
+    auto* complete_handle = static_cast<DeliveryReportHandler*>(message->_private);
 
     auto& topic_stats = stats_.topics_stats[topic_name];
     ++topic_stats->messages_counts.messages_total;
@@ -101,8 +101,7 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
         ) << fmt::format("Failed to delivery message to topic '{}': {}", topic_name, rd_kafka_err2str(message->err));
     }
 
-    complete_handle->SetDeliveryResult(std::move(delivery_result));
-    delete complete_handle;
+    complete_handle->OnDeliveryReport(std::move(delivery_result));
 }
 
 ProducerImpl::ProducerImpl(Configuration&& configuration)
@@ -136,6 +135,20 @@ DeliveryResult ProducerImpl::Send(
     return delivery_result_future.get();
 }
 
+std::vector<DeliveryResult>
+ProducerImpl::SendBatch(const std::string& topic_name, utils::span<const ProducerMessageView> messages) const {
+    if (messages.empty()) {
+        return {};
+    }
+
+    LOG_INFO() << fmt::format("Batch of {} messages to topic '{}' is requested to send", messages.size(), topic_name);
+    auto delivery_results_future = ScheduleBatchDelivery(topic_name, messages);
+
+    WaitUntilDeliveryReported(delivery_results_future);
+
+    return delivery_results_future.get();
+}
+
 engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     const std::string& topic_name,
     std::string_view key,
@@ -201,6 +214,71 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     return wait_handle;
 }
 
+engine::Future<std::vector<DeliveryResult>>
+ProducerImpl::ScheduleBatchDelivery(const std::string& topic_name, utils::span<const ProducerMessageView> messages)
+    const {
+    UASSERT(!messages.empty());
+
+    auto* waiter = new BatchDeliveryWaiter(messages.size());
+    auto wait_handle = waiter->GetFuture();
+
+    /// Each message is passed with its own handler pointing into the single
+    /// batch waiter, so the whole batch is awaited with a single future.
+    /// As in ScheduleMessageDelivery, 0 msgflags implies no payload copying,
+    /// the data lives till the batch is delivered.
+    /// `RD_KAFKA_MSG_F_PARTITION` makes `librdkafka` use the partition of each
+    /// message instead of the batch one.
+    ///
+    /// Waiter must not be touched after the last report is handled, so all the
+    /// message handlers are taken before the batch is enqueued.
+    std::vector<rd_kafka_message_t> batch(messages.size());
+    std::vector<DeliveryReportHandler*> handlers(messages.size());
+    for (std::size_t index{0}; index < messages.size(); ++index) {
+        const auto& message = messages[index];
+        auto& batch_message = batch[index];
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+        batch_message.payload = const_cast<char*>(message.message.data());
+        batch_message.len = message.message.size();
+        batch_message.key = const_cast<char*>(message.key.data());
+        batch_message.key_len = message.key.size();
+        // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+        batch_message.partition = message.partition.value_or(RD_KAFKA_PARTITION_UA);
+
+        handlers[index] = &waiter->GetMessageHandler(index);
+        batch_message._private = handlers[index];
+    }
+
+    const TopicHolder topic{rd_kafka_topic_new(producer_.GetHandle(), topic_name.c_str(), nullptr)};
+    if (!topic) {
+        const auto topic_error = rd_kafka_last_error();
+        LOG_WARNING(
+        ) << fmt::format("Failed to create topic '{}' handle: {}", topic_name, rd_kafka_err2str(topic_error));
+        for (auto* handler : handlers) {
+            handler->OnDeliveryReport(DeliveryResult{topic_error});
+        }
+        return wait_handle;
+    }
+
+    const int enqueued_count = rd_kafka_produce_batch(
+        topic.GetHandle(), RD_KAFKA_PARTITION_UA, RD_KAFKA_MSG_F_PARTITION, batch.data(), static_cast<int>(batch.size())
+    );
+    if (static_cast<std::size_t>(enqueued_count) != batch.size()) {
+        LOG_WARNING() << fmt::format(
+            "Failed to enqueue {} of {} messages to Kafka local queue",
+            batch.size() - static_cast<std::size_t>(enqueued_count),
+            batch.size()
+        );
+        for (std::size_t index{0}; index < batch.size(); ++index) {
+            if (batch[index].err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+                handlers[index]->OnDeliveryReport(DeliveryResult{batch[index].err});
+            }
+        }
+    }
+
+    return wait_handle;
+}
+
 EventHolder ProducerImpl::PollEvent() const {
     /// zero `timeout_ms` means no logical blocking wait for new events in
     /// producer queue. Actually, `rd_kafka_queue_poll` locks some pthread
@@ -255,7 +333,8 @@ std::size_t ProducerImpl::HandleEvents(std::string_view context) const {
     return handled;
 }
 
-void ProducerImpl::WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const {
+template <typename Result>
+void ProducerImpl::WaitUntilDeliveryReported(engine::Future<Result>& delivery_result) const {
     /// While this task is waiting for corresponding message delivery, it can
     /// handle other messages delivery reports and errors.
     /// Waiting strategy is as follows:
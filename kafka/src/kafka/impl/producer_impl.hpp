@@ -3,10 +3,13 @@
 #include <chrono>
 #include <cstdint>
 #include <optional>
+#include <vector>
 
 #include <librdkafka/rdkafka.h>
 
 #include <userver/kafka/impl/stats.hpp>
+#include <userver/kafka/producer.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/periodic_task.hpp>
 
 #include <kafka/impl/concurrent_event_waiter.hpp>
@@ -34,6 +37,12 @@ public:
         std::optional<std::uint32_t> partition
     ) const;
 
+    /// @brief Enqueues all the messages at once and waits for the delivery of
+    /// the whole batch.
+    /// @returns delivery results in order of `messages`.
+    [[nodiscard]] std::vector<DeliveryResult>
+    SendBatch(const std::string& topic_name, utils::span<const ProducerMessageView> messages) const;
+
     /// @brief Waits until scheduled messages are delivered for
     /// at most 2 x `delivery_timeout`.
     ///
@@ -54,6 +63,11 @@ private:
         std::optional<std::uint32_t> partition
     ) const;
 
+    /// @brief Schedules the delivery of the messages batch.
+    /// @returns the future for delivery results, which must be awaited.
+    [[nodiscard]] engine::Future<std::vector<DeliveryResult>>
+    ScheduleBatchDelivery(const std::string& topic_name, utils::span<const ProducerMessageView> messages) const;
+
     /// @brief Poll a delivery or error event from producer's queue.
     EventHolder PollEvent() const;
 
@@ -68,7 +82,8 @@ private:
 
     /// @brief Waits until message delivery status reported by `librdkafka`.
     /// Suspends for no more than `delivery_timeout` milliseconds.
-    void WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const;
+    template <typename Result>
+    void WaitUntilDeliveryReported(engine::Future<Result>& delivery_result) const;
 
     /// @brief Callback called on error in `librdkafka` work.
     void ErrorCallback(rd_kafka_resp_err_t error, const char* reason, bool is_fatal) const;
@@ -79,8 +94,8 @@ private:
     /// @brief Callback called on each succeeded/failed message delivery.
     /// @param message represents the delivered (or not) message. Its `_private`
     /// field contains and `opaque` argument, which was passed to
-    /// `rd_kafka_producev`, i.e. the Promise which must be setted to notify
-    /// waiter about the delivery.
+    /// `rd_kafka_producev` or `rd_kafka_produce_batch`, i.e. the
+    /// DeliveryReportHandler which must be notified about the delivery.
     void DeliveryReportCallback(const rd_kafka_message_s* message) const;
 
 private:
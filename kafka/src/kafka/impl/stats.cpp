@@ -2,6 +2,8 @@
 
 #include <string_view>
 
+#include <userver/formats/json/parser/base_parser.hpp>
+#include <userver/formats/json/parser/parser_state.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,8 +14,114 @@ namespace {
 
 constexpr std::string_view kSolomonLabel{"solomon_label"};
 
+// Walks the whole statistics document, remembering only the
+// `topics.<topic>.partitions.<partition>.consumer_lag` values
+class LibrdkafkaStatsParser final : public formats::json::parser::BaseParser {
+public:
+    explicit LibrdkafkaStatsParser(LibrdkafkaStats& result) : result_(result) {}
+
+    void Null() override { Value(); }
+    void Bool(bool) override { Value(); }
+    void Int64(std::int64_t value) override { Number(value); }
+    void Uint64(std::uint64_t value) override { Number(static_cast<std::int64_t>(value)); }
+    void Double(double) override { Value(); }
+    void String(std::string_view) override { Value(); }
+    void StartObject() override { Start(); }
+    void StartArray() override { Start(); }
+    void EndObject() override { End(); }
+    void EndArray() override { End(); }
+
+    void Key(std::string_view key) override {
+        if (depth_ != matched_depth_) return;
+
+        switch (depth_) {
+            case 1:
+                key_matches_ = (key == "topics");
+                break;
+            case 2:
+                key_matches_ = true;
+                topic_.assign(key);
+                break;
+            case 3:
+                key_matches_ = (key == "partitions");
+                break;
+            case 4:
+                // -1 is the internal partition for the not yet assigned messages
+                key_matches_ = (key != "-1");
+                break;
+            case 5:
+                key_matches_ = (key == "consumer_lag");
+                break;
+            default:
+                key_matches_ = false;
+        }
+    }
+
+    std::string GetPathItem() const override { return {}; }
+
+protected:
+    std::string Expected() const override { return "librdkafka statistics"; }
+
+private:
+    static constexpr std::size_t kConsumerLagDepth = 5;
+
+    void Start() {
+        ++depth_;
+        if (depth_ == 1 || (key_matches_ && depth_ == matched_depth_ + 1 && depth_ <= kConsumerLagDepth)) {
+            matched_depth_ = depth_;
+        }
+        key_matches_ = false;
+    }
+
+    void End() {
+        if (matched_depth_ == depth_) --matched_depth_;
+        --depth_;
+        Value();
+    }
+
+    void Number(std::int64_t value) {
+        // -1 is reported for the partitions with unknown lag
+        if (key_matches_ && matched_depth_ == kConsumerLagDepth && value >= 0) {
+            result_.topics_consumer_lag[topic_] += value;
+        }
+        Value();
+    }
+
+    void Value() {
+        key_matches_ = false;
+        if (depth_ == 0) parser_state_->PopMe(*this);
+    }
+
+    LibrdkafkaStats& result_;
+    std::size_t depth_{0};
+    // Depth of the innermost container on the path to the exported values
+    std::size_t matched_depth_{0};
+    bool key_matches_{false};
+    std::string topic_;
+};
+
 }  // namespace
 
+LibrdkafkaStats ParseLibrdkafkaStats(std::string_view json) {
+    LibrdkafkaStats result;
+    LibrdkafkaStatsParser parser{result};
+
+    formats::json::parser::ParserState state;
+    state.PushParser(parser);
+    state.ProcessInput(json);
+
+    return result;
+}
+
+void AccountLibrdkafkaStats(Stats& stats, const LibrdkafkaStats& librdkafka_stats) {
+    for (const auto& [topic, consumer_lag] : librdkafka_stats.topics_consumer_lag) {
+        stats.topics_stats[topic]->consumer_lag = consumer_lag;
+    }
+    for (const auto& [topic, topic_stats] : stats.topics_stats) {
+        if (!librdkafka_stats.topics_consumer_lag.count(topic)) topic_stats->consumer_lag = -1;
+    }
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
     for (const auto& [topic, topic_stats] : stats.topics_stats) {
         const utils::statistics::LabelView label{kSolomonLabel, topic};
@@ -24,6 +132,9 @@ void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
         writer[topic]["messages_total"].ValueWithLabels(topic_stats->messages_counts.messages_total.Load(), label);
         writer[topic]["messages_success"].ValueWithLabels(topic_stats->messages_counts.messages_success.Load(), label);
         writer[topic]["messages_error"].ValueWithLabels(topic_stats->messages_counts.messages_error.Load(), label);
+
+        const auto consumer_lag = topic_stats->consumer_lag.load();
+        if (consumer_lag >= 0) writer[topic]["consumer_lag"].ValueWithLabels(consumer_lag, label);
     }
     writer["connections_error"].ValueWithLabels(stats.connections_error.Load(), {kSolomonLabel, "component_name"});
 }
@@ -1,5 +1,7 @@
 #include <userver/kafka/producer.hpp>
 
+#include <vector>
+
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/kafka/impl/configuration.hpp>
 #include <userver/kafka/impl/stats.hpp>
@@ -64,6 +66,10 @@ void SendToTestPoint(
     UASSERT(false);
 }
 
+bool IsRetryableSendError(rd_kafka_resp_err_t error) {
+    return error == RD_KAFKA_RESP_ERR__MSG_TIMED_OUT || error == RD_KAFKA_RESP_ERR__QUEUE_FULL;
+}
+
 }  // namespace
 
 Producer::Producer(
@@ -108,6 +114,12 @@ engine::TaskWithResult<void> Producer::SendAsync(
     );
 }
 
+void Producer::SendBatch(const std::string& topic_name, utils::span<const ProducerMessageView> messages) const {
+    utils::Async(producer_task_processor_, "producer_send_batch", [this, &topic_name, messages] {
+        SendBatchImpl(topic_name, messages);
+    }).Get();
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const { impl::DumpMetric(writer, producer_->GetStats()); }
 
 void Producer::SendImpl(
@@ -126,6 +138,36 @@ void Producer::SendImpl(
     SendToTestPoint(name_, topic_name, key, message, partition);
 }
 
+void Producer::SendBatchImpl(const std::string& topic_name, utils::span<const ProducerMessageView> messages) const {
+    tracing::Span::CurrentSpan().AddTag("kafka_producer", name_);
+
+    const auto delivery_results = producer_->SendBatch(topic_name, messages);
+    UASSERT(delivery_results.size() == messages.size());
+
+    std::vector<std::size_t> failed_messages;
+    bool is_retryable{true};
+    for (std::size_t index{0}; index < delivery_results.size(); ++index) {
+        const auto& message = messages[index];
+        const auto& delivery_result = delivery_results[index];
+        if (delivery_result.IsSuccess()) {
+            SendToTestPoint(name_, topic_name, message.key, message.message, message.partition);
+            continue;
+        }
+
+        if (failed_messages.empty()) {
+            failed_messages.reserve(delivery_results.size() - index);
+        }
+        failed_messages.push_back(index);
+        is_retryable = is_retryable && IsRetryableSendError(delivery_result.GetMessageError());
+    }
+
+    if (!failed_messages.empty()) {
+        const auto first_error = delivery_results[failed_messages.front()].GetMessageError();
+        throw SendBatchException{
+            rd_kafka_err2str(first_error), std::move(failed_messages), delivery_results.size(), is_retryable};
+    }
+}
+
 }  // namespace kafka
 
 USERVER_NAMESPACE_END
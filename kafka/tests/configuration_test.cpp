@@ -107,6 +107,10 @@ UTEST_F(ConfigurationTest, Consumer) {
     EXPECT_EQ(configuration->GetOption("group.id"), "test-group");
     EXPECT_EQ(configuration->GetOption("auto.offset.reset"), default_consumer.auto_offset_reset);
     EXPECT_EQ(configuration->GetOption("enable.auto.commit"), "false");
+    EXPECT_EQ(
+        configuration->GetOption("queued.max.messages.kbytes"),
+        std::to_string(default_consumer.queued_max_messages_kbytes)
+    );
 }
 
 UTEST_F(ConfigurationTest, ConsumerNonDefault) {
@@ -115,6 +119,7 @@ UTEST_F(ConfigurationTest, ConsumerNonDefault) {
     consumer_configuration.common.metadata_max_age = 30ms;
     consumer_configuration.common.client_id = "test-client";
     consumer_configuration.auto_offset_reset = "largest";
+    consumer_configuration.queued_max_messages_kbytes = 1024;
     consumer_configuration.rd_kafka_options["socket.keepalive.enable"] = "true";
 
     std::optional<kafka::impl::Configuration> configuration;
@@ -126,6 +131,7 @@ UTEST_F(ConfigurationTest, ConsumerNonDefault) {
     EXPECT_EQ(configuration->GetOption("security.protocol"), "plaintext");
     EXPECT_EQ(configuration->GetOption("group.id"), "test-group");
     EXPECT_EQ(configuration->GetOption("auto.offset.reset"), "largest");
+    EXPECT_EQ(configuration->GetOption("queued.max.messages.kbytes"), "1024");
     EXPECT_EQ(configuration->GetOption("socket.keepalive.enable"), "true");
 }
 
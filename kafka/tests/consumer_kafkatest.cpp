@@ -2,11 +2,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <mutex>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
 #include <gmock/gmock-matchers.h>
 
+#include <userver/concurrent/variable.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
@@ -145,6 +148,72 @@ UTEST_F(ConsumerTest, OneConsumerPartitionDistribution) {
     EXPECT_EQ(partitions.size(), 1ull);
 }
 
+UTEST_F_MT(ConsumerTest, ProcessPartitionsConcurrently, 4) {
+    constexpr std::size_t kMessagesPerPartition{4};
+    constexpr std::size_t kMessagesCount{kMessagesPerPartition * kNumPartitionsLargeTopic};
+
+    std::vector<kafka::utest::Message> messages;
+    messages.reserve(kMessagesCount);
+    for (std::size_t i{0}; i < kMessagesCount; ++i) {
+        messages.push_back(kafka::utest::Message{
+            kLargeTopic1, fmt::format("key-{}", i), fmt::format("msg-{}", i), /*partition=*/i % kNumPartitionsLargeTopic
+        });
+    }
+    for (std::size_t i{0}; i < kMessagesPerPartition; ++i) {
+        // Strict order of keys inside each partition
+        SendMessages(utils::span{messages}.subspan(i * kNumPartitionsLargeTopic).first(kNumPartitionsLargeTopic));
+    }
+
+    kafka::impl::ConsumerExecutionParams params{
+        /*max_batch_size=*/kMessagesCount,
+        /*poll_timeout=*/utest::kMaxTestWaitTime / 4};
+    params.process_partitions_concurrently = true;
+    auto consumer = MakeConsumer("kafka-consumer", {kLargeTopic1}, kafka::impl::ConsumerConfiguration{}, params);
+    auto consumer_scope = consumer.MakeConsumerScope();
+
+    struct Received {
+        std::vector<kafka::utest::Message> messages;
+        bool mixed_partitions{false};
+    };
+    concurrent::Variable<Received, std::mutex> received;
+    engine::SingleUseEvent consumed_event;
+    consumer_scope.Start([&](kafka::MessageBatchView batch) {
+        auto received_ptr = received.Lock();
+        for (const auto& message : batch) {
+            received_ptr->mixed_partitions |= message.GetPartition() != batch[0].GetPartition();
+            received_ptr->messages.push_back(kafka::utest::Message{
+                message.GetTopic(),
+                std::string{message.GetKey()},
+                std::string{message.GetPayload()},
+                message.GetPartition()});
+        }
+        if (received_ptr->messages.size() == kMessagesCount) {
+            consumed_event.Send();
+        }
+    });
+
+    UEXPECT_NO_THROW(consumed_event.Wait());
+    consumer_scope.Stop();
+
+    const auto received_ptr = received.Lock();
+    EXPECT_FALSE(received_ptr->mixed_partitions);
+    EXPECT_THAT(received_ptr->messages, ::testing::UnorderedElementsAreArray(messages));
+
+    for (std::size_t partition{0}; partition < kNumPartitionsLargeTopic; ++partition) {
+        std::vector<std::string> keys;
+        for (const auto& message : received_ptr->messages) {
+            if (message.partition == partition) {
+                keys.push_back(message.key);
+            }
+        }
+        std::vector<std::string> expected_keys;
+        for (std::size_t i{0}; i < kMessagesPerPartition; ++i) {
+            expected_keys.push_back(fmt::format("key-{}", i * kNumPartitionsLargeTopic + partition));
+        }
+        EXPECT_EQ(keys, expected_keys) << partition;
+    }
+}
+
 UTEST_F(ConsumerTest, OneConsumerRereadAfterCommit) {
     const auto topic = GenerateTopic();
     const std::vector<kafka::utest::Message> kTestMessages{
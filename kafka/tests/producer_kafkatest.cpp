@@ -1,6 +1,7 @@
 #include <userver/kafka/utest/kafka_fixture.hpp>
 
 #include <deque>
+#include <string>
 #include <vector>
 
 #include <fmt/format.h>
@@ -193,6 +194,50 @@ UTEST_F(ProducerTest, OneProducerManySendAsync) {
     /// [Producer batch send async]
 }
 
+UTEST_F(ProducerTest, OneProducerSendBatch) {
+    constexpr std::size_t kSendCount{1000};
+
+    auto producer = MakeProducer("kafka-producer");
+    const auto topic = GenerateTopic();
+
+    /// [Producer send batch]
+    std::vector<std::string> keys;
+    std::vector<std::string> payloads;
+    keys.reserve(kSendCount);
+    payloads.reserve(kSendCount);
+    std::vector<kafka::ProducerMessageView> messages;
+    messages.reserve(kSendCount);
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        keys.push_back(fmt::format("test-key-{}", send));
+        payloads.push_back(fmt::format("test-msg-{}", send));
+        messages.push_back(kafka::ProducerMessageView{keys.back(), payloads.back()});
+    }
+
+    UEXPECT_NO_THROW(producer.SendBatch(topic, messages));
+    /// [Producer send batch]
+
+    UEXPECT_NO_THROW(producer.SendBatch(topic, {}));
+}
+
+UTEST_F(ProducerTest, SendBatchPartialFailure) {
+    auto producer = MakeProducer("kafka-producer");
+    const auto topic = GenerateTopic();
+
+    const std::vector<kafka::ProducerMessageView> messages{
+        {"test-key-0", "test-msg-0"},
+        {"test-key-1", "test-msg-1", /*partition=*/100500},
+        {"test-key-2", "test-msg-2"},
+    };
+
+    try {
+        producer.SendBatch(topic, messages);
+        ADD_FAILURE() << "SendBatch must throw";
+    } catch (const kafka::SendBatchException& e) {
+        EXPECT_EQ(e.GetFailedMessages(), std::vector<std::size_t>{1});
+        EXPECT_FALSE(e.IsRetryable());
+    }
+}
+
 UTEST_F(ProducerTest, ManyProducersManySendSync) {
     constexpr std::size_t kProducerCount{4};
     constexpr std::size_t kSendCount{100};
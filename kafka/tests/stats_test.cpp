@@ -0,0 +1,69 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/kafka/impl/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kStatistics = R"({
+  "name": "rdkafka#consumer-1",
+  "type": "consumer",
+  "ts": 5016483227792,
+  "rxmsgs": 9,
+  "brokers": {
+    "localhost:9092/0": {
+      "name": "localhost:9092/0",
+      "toppars": {"lt-1-0": {"topic": "lt-1", "partition": 0}}
+    }
+  },
+  "topics": {
+    "lt-1": {
+      "topic": "lt-1",
+      "age": 5006,
+      "batchsize": {"min": 0, "max": 0, "p99": 0},
+      "partitions": {
+        "0": {"partition": 0, "consumer_lag": 3, "lo_offset": 0, "hi_offset": 12, "committed_offset": -1001},
+        "1": {"partition": 1, "consumer_lag": -1, "lo_offset": -1, "hi_offset": -1},
+        "2": {"partition": 2, "consumer_lag": 5, "msgq_cnt": 0},
+        "-1": {"partition": -1, "consumer_lag": 100}
+      }
+    },
+    "lt-2": {
+      "topic": "lt-2",
+      "partitions": {"0": {"partition": 0, "consumer_lag": -1}}
+    },
+    "tt-1": {
+      "topic": "tt-1",
+      "partitions": {"0": {"partition": 0, "consumer_lag": 0, "consumer_lag_stored": 7}}
+    }
+  },
+  "cgrp": {"state": "up", "rebalance_cnt": 1, "assignment_size": 4, "topics": {"consumer_lag": 42}}
+})";
+
+}  // namespace
+
+TEST(KafkaStats, ParseLibrdkafkaStats) {
+    const auto stats = kafka::impl::ParseLibrdkafkaStats(kStatistics);
+
+    const std::unordered_map<std::string, std::int64_t> expected{{"lt-1", 8}, {"tt-1", 0}};
+    EXPECT_EQ(stats.topics_consumer_lag, expected);
+}
+
+TEST(KafkaStats, ParseLibrdkafkaStatsInvalid) {
+    EXPECT_THROW(kafka::impl::ParseLibrdkafkaStats(R"({"topics": {)"), formats::json::parser::ParseError);
+    EXPECT_THROW(kafka::impl::ParseLibrdkafkaStats(R"({} {})"), formats::json::parser::ParseError);
+}
+
+TEST(KafkaStats, AccountLibrdkafkaStats) {
+    kafka::impl::Stats stats;
+    stats.topics_stats["lt-2"]->consumer_lag = 10;
+
+    kafka::impl::AccountLibrdkafkaStats(stats, kafka::impl::ParseLibrdkafkaStats(kStatistics));
+    EXPECT_EQ(stats.topics_stats["lt-1"]->consumer_lag, 8);
+    EXPECT_EQ(stats.topics_stats["lt-2"]->consumer_lag, -1);
+    EXPECT_EQ(stats.topics_stats["tt-1"]->consumer_lag, 0);
+}
+
+USERVER_NAMESPACE_END
@@ -39,6 +39,10 @@ class ListBucketError : public std::runtime_error {
     using runtime_error::runtime_error;
 };
 
+class MultipartUploadError : public std::runtime_error {
+    using runtime_error::runtime_error;
+};
+
 /// Connection settings - retries, timeouts, and so on
 struct ConnectionCfg {
     explicit ConnectionCfg(
@@ -61,6 +65,13 @@ struct ObjectMeta {
     std::string last_modified;
 };
 
+/// Uploaded part of a multipart upload,
+/// https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompletedPart.html
+struct MultipartUploadPart {
+    int part_number{0};
+    std::string etag;
+};
+
 /// Represents a connection to s3 api. This object is only forward-declared,
 /// with private implementation (mostly because it is very very ugly)
 class S3Connection;
@@ -156,6 +167,34 @@ public:
     virtual std::string
     CopyObject(std::string_view key_from, std::string_view key_to, const std::optional<Meta>& meta = std::nullopt) = 0;
 
+    /// @brief Starts a multipart upload of an object
+    /// @returns id of the upload
+    /// @see https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateMultipartUpload.html
+    virtual std::string CreateMultipartUpload(
+        std::string_view path,
+        const std::optional<Meta>& meta = std::nullopt,
+        std::string_view content_type = "application/octet-stream"
+    ) const = 0;
+
+    /// @brief Uploads a part of a multipart upload, parts may be uploaded
+    /// concurrently
+    /// @returns ETag of the part
+    /// @see https://docs.aws.amazon.com/AmazonS3/latest/API/API_UploadPart.html
+    virtual std::string
+    UploadPart(std::string_view path, std::string_view upload_id, int part_number, std::string data) const = 0;
+
+    /// @brief Assembles the object from the uploaded parts
+    /// @see https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompleteMultipartUpload.html
+    virtual void CompleteMultipartUpload(
+        std::string_view path,
+        std::string_view upload_id,
+        const std::vector<MultipartUploadPart>& parts
+    ) const = 0;
+
+    /// @brief Drops the upload and its uploaded parts
+    /// @see https://docs.aws.amazon.com/AmazonS3/latest/API/API_AbortMultipartUpload.html
+    virtual void AbortMultipartUpload(std::string_view path, std::string_view upload_id) const = 0;
+
     virtual std::optional<HeadersDataResponse>
     GetObjectHead(std::string_view path, const HeaderDataRequest& request = HeaderDataRequest()) const = 0;
 
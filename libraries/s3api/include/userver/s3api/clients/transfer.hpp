@@ -0,0 +1,127 @@
+#pragma once
+
+/// @file userver/s3api/clients/transfer.hpp
+/// @brief Streaming multipart upload and ranged parallel download of large
+/// S3 objects
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <userver/s3api/clients/s3api.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace s3api {
+
+/// Settings of the multipart upload and of the ranged download
+struct TransferSettings {
+    /// Minimal size of a part of a multipart upload, except the last one
+    static constexpr std::size_t kMinPartSize = 5 * 1024 * 1024;
+
+    /// Size of the uploaded parts and of the downloaded ranges
+    std::size_t part_size{8 * 1024 * 1024};
+
+    /// Maximum number of parts being transferred in parallel. The memory usage
+    /// is bounded by `(max_concurrent_parts + 1) * part_size`.
+    std::size_t max_concurrent_parts{4};
+};
+
+/// @brief Uploads an object of an unknown size by parts of
+/// `TransferSettings::part_size` bytes, up to
+/// `TransferSettings::max_concurrent_parts` parts are uploaded concurrently.
+///
+/// Write() returns as soon as the data is buffered or a part upload is
+/// started, and waits only if all the allowed uploads are running. The object
+/// appears in the bucket after Complete(). If the uploader is destroyed
+/// without a successful Complete(), the upload is aborted.
+///
+/// ## Example:
+///
+/// @code
+/// s3api::MultipartUploader uploader{client, "dumps/big.bin"};
+/// while (auto chunk = ReadNextChunk()) uploader.Write(*chunk);
+/// uploader.Complete();
+/// @endcode
+class MultipartUploader final {
+public:
+    /// @throws MultipartUploadError if `part_size` is less than
+    /// `TransferSettings::kMinPartSize`
+    MultipartUploader(
+        ClientPtr client,
+        std::string path,
+        TransferSettings settings = {},
+        const std::optional<Client::Meta>& meta = std::nullopt,
+        std::string_view content_type = "application/octet-stream"
+    );
+    ~MultipartUploader();
+
+    MultipartUploader(const MultipartUploader&) = delete;
+    MultipartUploader& operator=(const MultipartUploader&) = delete;
+
+    /// @brief Appends the data to the object
+    /// @throws the errors of the previously started part uploads
+    void Write(std::string_view data);
+
+    /// @brief Uploads the rest of the data and assembles the object
+    void Complete();
+
+    /// @brief Cancels the running part uploads and drops the upload
+    void Abort();
+
+    /// @brief Returns the number of bytes passed to Write()
+    std::size_t GetWrittenSize() const noexcept { return written_size_; }
+
+private:
+    void StartPartUpload();
+    void WaitForPartUpload();
+
+    const ClientPtr client_;
+    const std::string path_;
+    const TransferSettings settings_;
+    const std::string upload_id_;
+
+    std::string buffer_;
+    std::size_t written_size_{0};
+    std::vector<MultipartUploadPart> parts_;
+    std::deque<engine::TaskWithResult<MultipartUploadPart>> part_uploads_;
+    bool is_finished_{false};
+};
+
+/// Receives the consecutive chunks of a downloaded object
+using DownloadSink = std::function<void(std::string_view)>;
+
+/// @brief Downloads an object by ranges of `TransferSettings::part_size`
+/// bytes, up to `TransferSettings::max_concurrent_parts` ranges are downloaded
+/// concurrently. The ranges are passed to the `sink` in order.
+/// @returns the size of the object
+/// @throws clients::http::HttpException if the object does not exist
+std::size_t DownloadObject(
+    const Client& client,
+    std::string_view path,
+    const DownloadSink& sink,
+    TransferSettings settings = {}
+);
+
+/// @brief Downloads an object into a file, the file is replaced only after
+/// the whole object is downloaded
+/// @param fs_task_processor task processor to run the blocking file operations
+/// @returns the size of the object
+std::size_t DownloadObjectToFile(
+    const Client& client,
+    std::string_view path,
+    const std::string& file_path,
+    engine::TaskProcessor& fs_task_processor,
+    TransferSettings settings = {}
+);
+
+}  // namespace s3api
+
+USERVER_NAMESPACE_END
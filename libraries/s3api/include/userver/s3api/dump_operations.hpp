@@ -0,0 +1,67 @@
+#pragma once
+
+/// @file userver/s3api/dump_operations.hpp
+/// @brief Shipping of cache dumps to S3 and their restoring
+
+#include <memory>
+#include <string>
+
+#include <userver/dump/config.hpp>
+#include <userver/dump/factory.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+#include <userver/s3api/clients/s3api.hpp>
+#include <userver/s3api/clients/transfer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace s3api {
+
+/// @brief dump::OperationsFactory that writes the dumps with the wrapped
+/// factory and streams a copy of each dump to S3 with a multipart upload.
+///
+/// The copy of the dump `<dump-root>/<cache-name>/<dump-name>` is stored as
+/// `<key_prefix>/<cache-name>/<dump-name>`. The copy contains the data
+/// passed to the writers of this factory, so to ship compressed or encrypted
+/// dumps wrap this factory into dump::CompressedOperationsFactory or wrap an
+/// dump::EncryptedOperationsFactory by this one. A failure of the upload is
+/// logged and does not fail the local dump.
+///
+/// The dumps are read with the wrapped factory, use RestoreLatestDump() to
+/// download the dump before the cache is started.
+class DumpOperationsFactory final : public dump::OperationsFactory {
+public:
+    DumpOperationsFactory(
+        std::unique_ptr<dump::OperationsFactory> base,
+        ClientPtr client,
+        std::string key_prefix,
+        TransferSettings settings = {}
+    );
+
+    std::unique_ptr<dump::Reader> CreateReader(std::string full_path) override;
+
+    std::unique_ptr<dump::Writer> CreateWriter(std::string full_path, tracing::ScopeTime& scope) override;
+
+private:
+    std::unique_ptr<dump::OperationsFactory> base_;
+    ClientPtr client_;
+    std::string key_prefix_;
+    TransferSettings settings_;
+};
+
+/// @brief Downloads the latest dump of the current format version shipped by
+/// DumpOperationsFactory into the dump directory of the cache, unless there
+/// is a local dump of the same name
+/// @param fs_task_processor task processor to run the blocking file operations
+/// @returns `false` if there is no suitable dump in S3
+bool RestoreLatestDump(
+    const Client& client,
+    std::string_view key_prefix,
+    const dump::Config& config,
+    engine::TaskProcessor& fs_task_processor,
+    TransferSettings settings = {}
+);
+
+}  // namespace s3api
+
+USERVER_NAMESPACE_END
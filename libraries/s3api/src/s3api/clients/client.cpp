@@ -147,6 +147,38 @@ std::vector<std::string> ParseS3DirectoriesListResponse(std::string_view s3_resp
     return result;
 }
 
+std::string ParseCreateMultipartUploadResponse(std::string_view s3_response) {
+    pugi::xml_document xml;
+    pugi::xml_parse_result parse_result = xml.load_buffer(s3_response.data(), s3_response.size());
+    if (parse_result.status != pugi::status_ok) {
+        throw MultipartUploadError(fmt::format(
+            "Failed to parse S3 create multipart upload response as xml, error: {}, response: {}",
+            parse_result.description(),
+            s3_response
+        ));
+    }
+    std::string upload_id = xml.child("InitiateMultipartUploadResult").child("UploadId").child_value();
+    if (upload_id.empty()) {
+        throw MultipartUploadError(
+            fmt::format("No UploadId in S3 create multipart upload response, response: {}", s3_response)
+        );
+    }
+    return upload_id;
+}
+
+void CheckCompleteMultipartUploadResponse(std::string_view s3_response) {
+    // S3 may report a failure of an already started assembly with 200 OK
+    pugi::xml_document xml;
+    pugi::xml_parse_result parse_result = xml.load_buffer(s3_response.data(), s3_response.size());
+    if (parse_result.status == pugi::status_ok && xml.child("Error")) {
+        throw MultipartUploadError(fmt::format(
+            "S3 failed to complete multipart upload, error: {}, response: {}",
+            xml.child("Error").child("Code").child_value(),
+            s3_response
+        ));
+    }
+}
+
 }  // namespace
 
 void ClientImpl::UpdateConfig(ConnectionCfg&& config) { conn_->UpdateConfig(std::move(config)); }
@@ -266,6 +298,53 @@ std::string ClientImpl::TryGetPartialObject(
     return RequestApi(req, "get_object", headers_data, headers_request);
 }
 
+std::string ClientImpl::CreateMultipartUpload(
+    std::string_view path,
+    const std::optional<Meta>& meta,
+    std::string_view content_type
+) const {
+    auto req = api_methods::CreateMultipartUpload(bucket_, path, content_type);
+    if (meta.has_value()) {
+        SaveMeta(req.headers, meta.value());
+    }
+    return ParseCreateMultipartUploadResponse(RequestApi(req, "create_multipart_upload"));
+}
+
+std::string
+ClientImpl::UploadPart(std::string_view path, std::string_view upload_id, int part_number, std::string data) const {
+    auto req = api_methods::UploadPart(bucket_, path, upload_id, part_number, std::move(data));
+
+    HeadersDataResponse headers_data;
+    HeaderDataRequest headers_request;
+    headers_request.headers.emplace();
+    headers_request.headers->emplace(USERVER_NAMESPACE::http::headers::kETag);
+    headers_request.need_meta = false;
+    RequestApi(req, "upload_part", &headers_data, headers_request);
+
+    auto* etag = headers_data.headers ? USERVER_NAMESPACE::utils::FindOrNullptr(
+                                            *headers_data.headers, USERVER_NAMESPACE::http::headers::kETag
+                                        )
+                                      : nullptr;
+    if (!etag) {
+        throw MultipartUploadError(fmt::format("No ETag in S3 upload part response, path: {}", path));
+    }
+    return std::move(*etag);
+}
+
+void ClientImpl::CompleteMultipartUpload(
+    std::string_view path,
+    std::string_view upload_id,
+    const std::vector<MultipartUploadPart>& parts
+) const {
+    auto req = api_methods::CompleteMultipartUpload(bucket_, path, upload_id, parts);
+    CheckCompleteMultipartUploadResponse(RequestApi(req, "complete_multipart_upload"));
+}
+
+void ClientImpl::AbortMultipartUpload(std::string_view path, std::string_view upload_id) const {
+    auto req = api_methods::AbortMultipartUpload(bucket_, path, upload_id);
+    RequestApi(req, "abort_multipart_upload");
+}
+
 std::optional<ClientImpl::HeadersDataResponse>
 ClientImpl::GetObjectHead(std::string_view path, const HeaderDataRequest& headers_request) const {
     HeadersDataResponse headers_data;
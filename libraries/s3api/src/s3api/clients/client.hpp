@@ -97,6 +97,23 @@ public:
 
     std::string CopyObject(std::string_view key_from, std::string_view key_to, const std::optional<Meta>& meta) final;
 
+    std::string CreateMultipartUpload(
+        std::string_view path,
+        const std::optional<Meta>& meta,
+        std::string_view content_type
+    ) const final;
+
+    std::string UploadPart(std::string_view path, std::string_view upload_id, int part_number, std::string data)
+        const final;
+
+    void CompleteMultipartUpload(
+        std::string_view path,
+        std::string_view upload_id,
+        const std::vector<MultipartUploadPart>& parts
+    ) const final;
+
+    void AbortMultipartUpload(std::string_view path, std::string_view upload_id) const final;
+
     std::optional<HeadersDataResponse> GetObjectHead(std::string_view path, const HeaderDataRequest& request)
         const final;
 
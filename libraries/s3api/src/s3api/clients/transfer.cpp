@@ -0,0 +1,201 @@
+#include <userver/s3api/clients/transfer.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/fs/blocking/c_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace s3api {
+
+namespace {
+
+const TransferSettings& CheckSettings(const TransferSettings& settings) {
+    if (settings.part_size < TransferSettings::kMinPartSize) {
+        throw MultipartUploadError(fmt::format(
+            "S3 multipart upload part size {} is less than the minimum of {}",
+            settings.part_size,
+            TransferSettings::kMinPartSize
+        ));
+    }
+    UINVARIANT(settings.max_concurrent_parts > 0, "max_concurrent_parts must be positive");
+    return settings;
+}
+
+std::optional<std::size_t> GetObjectSize(const Client& client, std::string_view path) {
+    Client::HeaderDataRequest request;
+    request.headers.emplace();
+    request.headers->emplace(USERVER_NAMESPACE::http::headers::kContentLength);
+    request.need_meta = false;
+
+    const auto head = client.GetObjectHead(path, request);
+    if (!head || !head->headers) return std::nullopt;
+    const auto* content_length =
+        USERVER_NAMESPACE::utils::FindOrNullptr(*head->headers, USERVER_NAMESPACE::http::headers::kContentLength);
+    if (!content_length) return std::nullopt;
+    return USERVER_NAMESPACE::utils::FromString<std::size_t>(*content_length);
+}
+
+}  // namespace
+
+MultipartUploader::MultipartUploader(
+    ClientPtr client,
+    std::string path,
+    TransferSettings settings,
+    const std::optional<Client::Meta>& meta,
+    std::string_view content_type
+)
+    : client_(std::move(client)),
+      path_(std::move(path)),
+      settings_(CheckSettings(settings)),
+      upload_id_(client_->CreateMultipartUpload(path_, meta, content_type)) {
+    buffer_.reserve(settings_.part_size);
+}
+
+MultipartUploader::~MultipartUploader() {
+    if (is_finished_) return;
+    try {
+        Abort();
+    } catch (const std::exception& e) {
+        LOG_WARNING() << "Failed to abort S3 multipart upload of '" << path_ << "': " << e;
+    }
+}
+
+void MultipartUploader::Write(std::string_view data) {
+    UINVARIANT(!is_finished_, "Write() after the multipart upload is finished");
+    written_size_ += data.size();
+    while (!data.empty()) {
+        const auto chunk_size = std::min(data.size(), settings_.part_size - buffer_.size());
+        buffer_.append(data.substr(0, chunk_size));
+        data.remove_prefix(chunk_size);
+        if (buffer_.size() == settings_.part_size) StartPartUpload();
+    }
+}
+
+void MultipartUploader::Complete() {
+    UINVARIANT(!is_finished_, "Complete() after the multipart upload is finished");
+    // S3 requires at least one part, the last part may be empty
+    if (!buffer_.empty() || parts_.size() + part_uploads_.size() == 0) StartPartUpload();
+    while (!part_uploads_.empty()) WaitForPartUpload();
+
+    client_->CompleteMultipartUpload(path_, upload_id_, parts_);
+    is_finished_ = true;
+}
+
+void MultipartUploader::Abort() {
+    if (is_finished_) return;
+    is_finished_ = true;
+    for (auto& part_upload : part_uploads_) part_upload.SyncCancel();
+    part_uploads_.clear();
+    client_->AbortMultipartUpload(path_, upload_id_);
+}
+
+void MultipartUploader::StartPartUpload() {
+    if (part_uploads_.size() >= settings_.max_concurrent_parts) WaitForPartUpload();
+
+    const int part_number = static_cast<int>(parts_.size() + part_uploads_.size() + 1);
+    std::string data;
+    data.swap(buffer_);
+    buffer_.reserve(settings_.part_size);
+
+    part_uploads_.push_back(utils::Async(
+        "s3api_upload_part",
+        [client = client_, &path = path_, &upload_id = upload_id_, part_number, data = std::move(data)]() mutable {
+            auto etag = client->UploadPart(path, upload_id, part_number, std::move(data));
+            return MultipartUploadPart{part_number, std::move(etag)};
+        }
+    ));
+}
+
+void MultipartUploader::WaitForPartUpload() {
+    UASSERT(!part_uploads_.empty());
+    auto part_upload = std::move(part_uploads_.front());
+    part_uploads_.pop_front();
+    parts_.push_back(part_upload.Get());
+}
+
+std::size_t DownloadObject(
+    const Client& client,
+    std::string_view path,
+    const DownloadSink& sink,
+    TransferSettings settings
+) {
+    UINVARIANT(settings.part_size > 0, "part_size must be positive");
+    UINVARIANT(settings.max_concurrent_parts > 0, "max_concurrent_parts must be positive");
+
+    const auto object_size = GetObjectSize(client, path);
+    if (!object_size) {
+        // Could not get the size, rethrows the error of a plain GET
+        const auto data = client.TryGetObject(path);
+        sink(data);
+        return data.size();
+    }
+
+    std::deque<engine::TaskWithResult<std::string>> range_downloads;
+    std::size_t next_range_begin = 0;
+    const auto start_range_download = [&] {
+        const auto range_end = std::min(next_range_begin + settings.part_size, *object_size) - 1;
+        range_downloads.push_back(utils::Async(
+            "s3api_download_range",
+            [&client, path, range = fmt::format("bytes={}-{}", next_range_begin, range_end)] {
+                return client.TryGetPartialObject(path, range);
+            }
+        ));
+        next_range_begin = range_end + 1;
+    };
+
+    while (next_range_begin < *object_size || !range_downloads.empty()) {
+        while (next_range_begin < *object_size && range_downloads.size() < settings.max_concurrent_parts) {
+            start_range_download();
+        }
+        auto range_download = std::move(range_downloads.front());
+        range_downloads.pop_front();
+        sink(range_download.Get());
+    }
+    return *object_size;
+}
+
+std::size_t DownloadObjectToFile(
+    const Client& client,
+    std::string_view path,
+    const std::string& file_path,
+    engine::TaskProcessor& fs_task_processor,
+    TransferSettings settings
+) {
+    const auto tmp_path = file_path + ".tmp";
+    auto file = engine::AsyncNoSpan(fs_task_processor, [&tmp_path] {
+                    return fs::blocking::CFile{
+                        tmp_path,
+                        {fs::blocking::OpenFlag::kWrite,
+                         fs::blocking::OpenFlag::kCreateIfNotExists,
+                         fs::blocking::OpenFlag::kTruncate}};
+                }).Get();
+
+    const auto object_size = DownloadObject(
+        client,
+        path,
+        [&](std::string_view data) { engine::AsyncNoSpan(fs_task_processor, [&] { file.Write(data); }).Get(); },
+        settings
+    );
+
+    engine::AsyncNoSpan(fs_task_processor, [&] {
+        file.Flush();
+        std::move(file).Close();
+        fs::blocking::Rename(tmp_path, file_path);
+    }).Get();
+    return object_size;
+}
+
+}  // namespace s3api
+
+USERVER_NAMESPACE_END
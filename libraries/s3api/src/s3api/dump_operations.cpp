@@ -0,0 +1,119 @@
+#include <userver/s3api/dump_operations.hpp>
+
+#include <algorithm>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+#include <fmt/format.h>
+
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace s3api {
+
+namespace {
+
+std::string MakeDumpKey(std::string_view key_prefix, const std::string& full_path) {
+    const boost::filesystem::path path{full_path};
+    return fmt::format("{}/{}/{}", key_prefix, path.parent_path().filename().string(), path.filename().string());
+}
+
+class UploadingWriter final : public dump::Writer {
+public:
+    UploadingWriter(std::unique_ptr<dump::Writer> base, std::unique_ptr<MultipartUploader> uploader)
+        : base_(std::move(base)), uploader_(std::move(uploader)) {}
+
+    void Finish() override {
+        base_->Finish();
+        if (!uploader_) return;
+        try {
+            uploader_->Complete();
+        } catch (const std::exception& e) {
+            LOG_ERROR() << "Failed to upload the dump to S3: " << e;
+        }
+        uploader_.reset();
+    }
+
+private:
+    void WriteRaw(std::string_view data) override {
+        dump::WriteStringViewUnsafe(*base_, data);
+        if (!uploader_) return;
+        try {
+            uploader_->Write(data);
+        } catch (const std::exception& e) {
+            LOG_ERROR() << "Failed to upload the dump to S3: " << e;
+            // The destructor aborts the upload
+            uploader_.reset();
+        }
+    }
+
+    std::unique_ptr<dump::Writer> base_;
+    std::unique_ptr<MultipartUploader> uploader_;
+};
+
+}  // namespace
+
+DumpOperationsFactory::DumpOperationsFactory(
+    std::unique_ptr<dump::OperationsFactory> base,
+    ClientPtr client,
+    std::string key_prefix,
+    TransferSettings settings
+)
+    : base_(std::move(base)), client_(std::move(client)), key_prefix_(std::move(key_prefix)), settings_(settings) {}
+
+std::unique_ptr<dump::Reader> DumpOperationsFactory::CreateReader(std::string full_path) {
+    return base_->CreateReader(std::move(full_path));
+}
+
+std::unique_ptr<dump::Writer> DumpOperationsFactory::CreateWriter(std::string full_path, tracing::ScopeTime& scope) {
+    auto key = MakeDumpKey(key_prefix_, full_path);
+    auto base = base_->CreateWriter(std::move(full_path), scope);
+
+    std::unique_ptr<MultipartUploader> uploader;
+    try {
+        uploader = std::make_unique<MultipartUploader>(client_, key, settings_);
+    } catch (const std::exception& e) {
+        LOG_ERROR() << "Failed to start the upload of the dump to S3 as '" << key << "': " << e;
+    }
+    return std::make_unique<UploadingWriter>(std::move(base), std::move(uploader));
+}
+
+bool RestoreLatestDump(
+    const Client& client,
+    std::string_view key_prefix,
+    const dump::Config& config,
+    engine::TaskProcessor& fs_task_processor,
+    TransferSettings settings
+) {
+    const auto cache_prefix = fmt::format("{}/{}/", key_prefix, config.name);
+    const auto version_suffix = fmt::format("-v{}", config.dump_format_version);
+
+    std::optional<std::string> latest_name;
+    for (const auto& object : client.ListBucketContentsParsed(cache_prefix)) {
+        std::string_view name{object.key};
+        name.remove_prefix(std::min(name.size(), cache_prefix.size()));
+        if (!utils::text::EndsWith(name, version_suffix) || name.find('/') != std::string_view::npos) continue;
+        // Dump names start with the update time, so they are ordered by it
+        if (!latest_name || name > *latest_name) latest_name.emplace(name);
+    }
+    if (!latest_name) return false;
+
+    const auto file_path = fmt::format("{}/{}", config.dump_directory, *latest_name);
+    const auto exists = engine::AsyncNoSpan(fs_task_processor, [&] {
+                            boost::filesystem::create_directories(config.dump_directory);
+                            return boost::filesystem::exists(file_path);
+                        }).Get();
+    if (exists) return true;
+
+    LOG_INFO() << "Downloading the dump of '" << config.name << "' from S3: " << cache_prefix << *latest_name;
+    DownloadObjectToFile(client, cache_prefix + *latest_name, file_path, fs_task_processor, settings);
+    return true;
+}
+
+}  // namespace s3api
+
+USERVER_NAMESPACE_END
@@ -118,6 +118,67 @@ Request CopyObject(
     return req;
 }
 
+Request CreateMultipartUpload(std::string_view bucket, std::string_view path, std::string_view content_type) {
+    Request req;
+    req.method = clients::http::HttpMethod::kPost;
+    req.bucket = bucket;
+    req.req = fmt::format("{}?uploads", path);
+
+    req.headers[USERVER_NAMESPACE::http::headers::kContentType] = content_type;
+    return req;
+}
+
+Request UploadPart(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    int part_number,
+    std::string data
+) {
+    Request req;
+    req.method = clients::http::HttpMethod::kPut;
+    req.bucket = bucket;
+    req.req = fmt::format(
+        "{}?{}",
+        path,
+        USERVER_NAMESPACE::http::MakeQuery({{"partNumber", std::to_string(part_number)}, {"uploadId", upload_id}})
+    );
+
+    req.headers[USERVER_NAMESPACE::http::headers::kContentLength] = std::to_string(data.size());
+    req.body = std::move(data);
+    return req;
+}
+
+Request CompleteMultipartUpload(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    const std::vector<MultipartUploadPart>& parts
+) {
+    Request req;
+    req.method = clients::http::HttpMethod::kPost;
+    req.bucket = bucket;
+    req.req = fmt::format("{}?{}", path, USERVER_NAMESPACE::http::MakeQuery({{"uploadId", upload_id}}));
+
+    req.body = "<CompleteMultipartUpload>";
+    for (const auto& part : parts) {
+        req.body += fmt::format("<Part><PartNumber>{}</PartNumber><ETag>{}</ETag></Part>", part.part_number, part.etag);
+    }
+    req.body += "</CompleteMultipartUpload>";
+
+    req.headers[USERVER_NAMESPACE::http::headers::kContentLength] = std::to_string(req.body.size());
+    req.headers[USERVER_NAMESPACE::http::headers::kContentType] = "application/xml";
+    return req;
+}
+
+Request AbortMultipartUpload(std::string_view bucket, std::string_view path, std::string_view upload_id) {
+    Request req;
+    req.method = clients::http::HttpMethod::kDelete;
+    req.bucket = bucket;
+    req.req = fmt::format("{}?{}", path, USERVER_NAMESPACE::http::MakeQuery({{"uploadId", upload_id}}));
+    return req;
+}
+
 }  // namespace s3api::api_methods
 
 USERVER_NAMESPACE_END
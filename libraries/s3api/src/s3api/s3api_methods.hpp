@@ -2,9 +2,11 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/http/predefined_header.hpp>
 
+#include <userver/s3api/clients/s3api.hpp>
 #include <userver/s3api/models/request.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -52,6 +54,25 @@ Request CopyObject(
     std::string_view content_type
 );
 
+Request CreateMultipartUpload(std::string_view bucket, std::string_view path, std::string_view content_type);
+
+Request UploadPart(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    int part_number,
+    std::string data
+);
+
+Request CompleteMultipartUpload(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    const std::vector<MultipartUploadPart>& parts
+);
+
+Request AbortMultipartUpload(std::string_view bucket, std::string_view path, std::string_view upload_id);
+
 }  // namespace s3api::api_methods
 
 USERVER_NAMESPACE_END
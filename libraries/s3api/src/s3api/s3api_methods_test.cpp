@@ -40,6 +40,47 @@ TEST(S3ApiMethods, GetObjectWithRange) {
     );
 }
 
+TEST(S3ApiMethods, CreateMultipartUpload) {
+    const Request request = CreateMultipartUpload("bucket", "path", "application/octet-stream");
+    EXPECT_EQ(request.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPost);
+    EXPECT_EQ(request.req, "path?uploads");
+    EXPECT_EQ(request.bucket, "bucket");
+    EXPECT_TRUE(request.body.empty());
+}
+
+TEST(S3ApiMethods, UploadPart) {
+    const Request request = UploadPart("bucket", "path", "upload_id", 3, "data");
+    EXPECT_EQ(request.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPut);
+    EXPECT_TRUE(
+        request.req == "path?partNumber=3&uploadId=upload_id" || request.req == "path?uploadId=upload_id&partNumber=3"
+    ) << request.req;
+    EXPECT_EQ(request.body, "data");
+    const std::string* content_length =
+        USERVER_NAMESPACE::utils::FindOrNullptr(request.headers, USERVER_NAMESPACE::http::headers::kContentLength);
+    ASSERT_NE(content_length, nullptr);
+    EXPECT_EQ(*content_length, "4");
+}
+
+TEST(S3ApiMethods, CompleteMultipartUpload) {
+    const Request request =
+        CompleteMultipartUpload("bucket", "path", "upload_id", {{1, "\"etag1\""}, {2, "\"etag2\""}});
+    EXPECT_EQ(request.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPost);
+    EXPECT_EQ(request.req, "path?uploadId=upload_id");
+    EXPECT_EQ(
+        request.body,
+        "<CompleteMultipartUpload>"
+        "<Part><PartNumber>1</PartNumber><ETag>\"etag1\"</ETag></Part>"
+        "<Part><PartNumber>2</PartNumber><ETag>\"etag2\"</ETag></Part>"
+        "</CompleteMultipartUpload>"
+    );
+}
+
+TEST(S3ApiMethods, AbortMultipartUpload) {
+    const Request request = AbortMultipartUpload("bucket", "path", "upload_id");
+    EXPECT_EQ(request.method, USERVER_NAMESPACE::clients::http::HttpMethod::kDelete);
+    EXPECT_EQ(request.req, "path?uploadId=upload_id");
+}
+
 }  // namespace s3api::api_methods
 
 USERVER_NAMESPACE_END
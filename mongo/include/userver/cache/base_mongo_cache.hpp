@@ -17,6 +17,7 @@
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
+#include <userver/storages/mongo/typed_cursor.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
@@ -77,7 +78,9 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   static constexpr auto kKeyField = &CachedObject::name;
 ///   // Type of kKeyField
 ///   using KeyType = std::string;
-///   // Type of cache map, e.g. unordered_map, map, bimap
+///   // Type of cache map, e.g. unordered_map, map, bimap. Use
+///   // cache::PersistentHashMap for big caches with incremental updates,
+///   // its copies share the unchanged entries.
 ///   using DataType = std::unordered_map<KeyType, ObjectType>;
 ///
 ///   // Whether the cache prefers to read from replica (if true, you might get stale data)
@@ -222,7 +225,10 @@ void MongoCache<MongoCacheTraits>::Update(
     utils::CpuRelax relax{cpu_relax_iterations_, &scope};
     std::size_t doc_count = 0;
 
-    for (const auto& doc : cursor) {
+    // The next batch is fetched while the current one is deserialized
+    storages::mongo::TypedCursor<formats::bson::Document> documents{std::move(cursor)};
+    while (const auto doc_holder = documents.Next()) {
+        const auto& doc = *doc_holder;
         ++doc_count;
 
         relax.Relax();
@@ -9,6 +9,8 @@
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/storages/mongo/pool.hpp>
+#include <userver/storages/mongo/typed_cursor.hpp>
+#include <userver/storages/mongo/write_batcher.hpp>
 #include <userver/storages/mongo/write_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -0,0 +1,96 @@
+#pragma once
+
+/// @file userver/storages/mongo/typed_cursor.hpp
+/// @brief @copybrief storages::mongo::TypedCursor
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/cursor.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// @brief Cursor that fetches and parses the documents in a background task
+/// while the caller processes the already parsed ones.
+///
+/// Documents are converted with `doc.As<T>()`, so any type with a
+/// `Parse(const formats::bson::Value&, formats::parse::To<T>)` works. With
+/// `T = formats::bson::Document` only the fetching of the next batch is
+/// overlapped with the processing.
+///
+/// At most `prefetch_size` parsed objects are kept in memory. Query and
+/// parsing errors are rethrown from Next() after all the objects parsed before
+/// the error are returned. Destroying the cursor cancels the background task.
+///
+/// ## Example:
+///
+/// @code
+/// storages::mongo::TypedCursor<MyStruct> cursor{collection.Find({})};
+/// while (auto object = cursor.Next()) {
+///     Process(*object);
+/// }
+/// @endcode
+template <typename T>
+class TypedCursor final {
+public:
+    static constexpr std::size_t kDefaultPrefetchSize = 1000;
+
+    explicit TypedCursor(Cursor cursor, std::size_t prefetch_size = kDefaultPrefetchSize);
+
+    TypedCursor(TypedCursor&&) noexcept = default;
+    TypedCursor& operator=(TypedCursor&&) noexcept = default;
+
+    /// @brief Returns the next object or std::nullopt if there are no more
+    /// @throws the query and parsing errors of the background task
+    std::optional<T> Next();
+
+private:
+    using Queue = concurrent::SpscQueue<T>;
+
+    std::shared_ptr<Queue> queue_;
+    typename Queue::Consumer consumer_;
+    // Must be destroyed first, cancels the fetching
+    engine::TaskWithResult<void> task_;
+};
+
+template <typename T>
+TypedCursor<T>::TypedCursor(Cursor cursor, std::size_t prefetch_size)
+    : queue_(Queue::Create(prefetch_size)), consumer_(queue_->GetConsumer()) {
+    task_ = utils::Async(
+        "mongo_typed_cursor",
+        [producer = queue_->GetProducer(), cursor = std::move(cursor)]() mutable {
+            for (const auto& doc : cursor) {
+                if constexpr (std::is_same_v<T, formats::bson::Document>) {
+                    if (!producer.Push(formats::bson::Document{doc})) return;
+                } else {
+                    if (!producer.Push(doc.template As<T>())) return;
+                }
+            }
+        }
+    );
+}
+
+template <typename T>
+std::optional<T> TypedCursor<T>::Next() {
+    if (!task_.IsValid()) return std::nullopt;
+
+    T value;
+    if (consumer_.Pop(value)) return value;
+
+    // The producer is gone, report its error if any
+    auto task = std::move(task_);
+    task.Get();
+    return std::nullopt;
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,121 @@
+#pragma once
+
+/// @file userver/storages/mongo/write_batcher.hpp
+/// @brief @copybrief storages::mongo::WriteBatcher
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/bulk_ops.hpp>
+#include <userver/storages/mongo/collection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// @brief Coalesces single-document writes of many tasks into unordered bulk
+/// writes to a collection.
+///
+/// Each write call blocks until the bulk containing it is executed. A bulk is
+/// executed by a background task after `max_delay` since its first write or
+/// as soon as it contains `max_batch_size` writes, whichever happens first.
+///
+/// Server errors are reported to the callers of the failed writes only, a
+/// network error or a write concern error fails all writes of the bulk. As the
+/// writes are unordered, writes to the same document from different tasks may
+/// be applied in any order. Per-write counters of WriteResult are not
+/// available, so the write methods return nothing.
+///
+/// If the calling task is cancelled, its write may still be executed.
+/// Writes pending on destruction are executed by the destructor.
+///
+/// ## Example:
+///
+/// @code
+/// storages::mongo::WriteBatcher batcher{pool->GetCollection("events"), {}};
+/// batcher.InsertOne(formats::bson::MakeDoc("event", "started"));
+/// @endcode
+class WriteBatcher final {
+public:
+    struct Settings {
+        /// Maximum number of writes in a single bulk
+        std::size_t max_batch_size{1000};
+
+        /// Maximum time a write waits for other writes to join its bulk
+        std::chrono::milliseconds max_delay{5};
+    };
+
+    WriteBatcher(Collection collection, Settings settings);
+    ~WriteBatcher();
+
+    WriteBatcher(const WriteBatcher&) = delete;
+    WriteBatcher& operator=(const WriteBatcher&) = delete;
+
+    /// Inserts a single document
+    template <typename... Options>
+    void InsertOne(formats::bson::Document document, Options&&... options);
+
+    /// @brief Replaces a single matching document
+    /// @see options::Upsert
+    template <typename... Options>
+    void ReplaceOne(formats::bson::Document selector, formats::bson::Document replacement, Options&&... options);
+
+    /// @brief Updates a single matching document
+    /// @see options::Upsert
+    template <typename... Options>
+    void UpdateOne(formats::bson::Document selector, formats::bson::Document update, Options&&... options);
+
+    /// Deletes a single matching document
+    template <typename... Options>
+    void DeleteOne(formats::bson::Document selector, Options&&... options);
+
+    /// @name Prepared sub-operation executors
+    /// @{
+    void Execute(const bulk_ops::InsertOne&);
+    void Execute(const bulk_ops::ReplaceOne&);
+    void Execute(const bulk_ops::Update&);
+    void Execute(const bulk_ops::Delete&);
+    /// @}
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+template <typename... Options>
+void WriteBatcher::InsertOne(formats::bson::Document document, Options&&... options) {
+    bulk_ops::InsertOne insert_subop(std::move(document));
+    (insert_subop.SetOption(std::forward<Options>(options)), ...);
+    Execute(insert_subop);
+}
+
+template <typename... Options>
+void WriteBatcher::ReplaceOne(
+    formats::bson::Document selector,
+    formats::bson::Document replacement,
+    Options&&... options
+) {
+    bulk_ops::ReplaceOne replace_subop(std::move(selector), std::move(replacement));
+    (replace_subop.SetOption(std::forward<Options>(options)), ...);
+    Execute(replace_subop);
+}
+
+template <typename... Options>
+void WriteBatcher::UpdateOne(formats::bson::Document selector, formats::bson::Document update, Options&&... options) {
+    bulk_ops::Update update_subop(bulk_ops::Update::Mode::kSingle, std::move(selector), std::move(update));
+    (update_subop.SetOption(std::forward<Options>(options)), ...);
+    Execute(update_subop);
+}
+
+template <typename... Options>
+void WriteBatcher::DeleteOne(formats::bson::Document selector, Options&&... options) {
+    bulk_ops::Delete delete_subop(bulk_ops::Delete::Mode::kSingle, std::move(selector));
+    (delete_subop.SetOption(std::forward<Options>(options)), ...);
+    Execute(delete_subop);
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
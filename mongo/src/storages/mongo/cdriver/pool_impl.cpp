@@ -170,6 +170,11 @@ void CommandFailed(const mongoc_apm_command_failed_t* event) {
     stats.event_stats_.failed += utils::statistics::Rate{1};
 }
 
+stats::ServerStatistics& GetServerStats(stats::ConnStats& stats, const mongoc_host_list_t* host) {
+    UASSERT(host);
+    return *stats.apm_stats_->servers[host->host_and_port];
+}
+
 void HeartbeatStarted(const mongoc_apm_server_heartbeat_started_t* event) {
     auto& stats = GetStats(mongoc_apm_server_heartbeat_started_get_context(event));
     ++stats.apm_stats_->heartbeats.start;
@@ -190,6 +195,12 @@ void HeartbeatFinished(stats::ConnStats& stats) {
 void HeartbeatSuccess(const mongoc_apm_server_heartbeat_succeeded_t* event) {
     auto& stats = GetStats(mongoc_apm_server_heartbeat_succeeded_get_context(event));
     ++stats.apm_stats_->heartbeats.success;
+    auto& server_stats = GetServerStats(stats, mongoc_apm_server_heartbeat_succeeded_get_host(event));
+    ++server_stats.heartbeats_success;
+    const std::chrono::microseconds duration{mongoc_apm_server_heartbeat_succeeded_get_duration(event)};
+    server_stats.heartbeat_timings.GetCurrentCounter().Account(
+        std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()
+    );
     LOG_LIMITED_DEBUG() << mongoc_apm_server_heartbeat_succeeded_get_host(event)->host_and_port
                         << " heartbeat succeeded";
     HeartbeatFinished(stats);
@@ -198,6 +209,7 @@ void HeartbeatSuccess(const mongoc_apm_server_heartbeat_succeeded_t* event) {
 void HeartbeatFailed(const mongoc_apm_server_heartbeat_failed_t* event) {
     auto& stats = GetStats(mongoc_apm_server_heartbeat_failed_get_context(event));
     ++stats.apm_stats_->heartbeats.failed;
+    ++GetServerStats(stats, mongoc_apm_server_heartbeat_failed_get_host(event)).heartbeats_failed;
     LOG_LIMITED_WARNING() << mongoc_apm_server_heartbeat_failed_get_host(event)->host_and_port << " heartbeat failed";
     HeartbeatFinished(stats);
 }
@@ -75,6 +75,9 @@ void DumpMetric(utils::statistics::Writer& writer, const Pool& pool) {
         apm_metrics["heartbeats-start"] = apm.heartbeats.start;
         apm_metrics["heartbeats-success"] = apm.heartbeats.success;
         apm_metrics["heartbeats-failed"] = apm.heartbeats.failed;
+        for (const auto& [server, server_stats] : apm.servers) {
+            apm_metrics["by-server"].ValueWithLabels(*server_stats, {"mongo_server", server});
+        }
     }
 }
 
@@ -127,11 +127,20 @@ struct HeartbeatsStatistics final {
     std::chrono::steady_clock::time_point hb_started{};
 };
 
+// Round trip times observed by the heartbeats, the driver selects servers
+// by them (see localThresholdMS)
+struct ServerStatistics final {
+    Counter heartbeats_success;
+    Counter heartbeats_failed;
+    AggregatedTimingsPercentile heartbeat_timings;
+};
+
 // See
 // https://mongoc.org/libmongoc/current/application-performance-monitoring.html
 struct ApmStats final {
     TopologyStatistics topology;
     HeartbeatsStatistics heartbeats;
+    rcu::RcuMap<std::string, ServerStatistics> servers;
 };
 
 struct EventStats final {
@@ -138,6 +138,12 @@ void DumpMetric(utils::statistics::Writer& writer, const PoolConnectStatistics&
     writer["queue-wait-timings-1min"] = conn_stats.queue_wait_timings_agg;
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ServerStatistics& server_stats) {
+    writer["heartbeats-success"] = server_stats.heartbeats_success;
+    writer["heartbeats-failed"] = server_stats.heartbeats_failed;
+    writer["heartbeat-timings-1min"] = server_stats.heartbeat_timings;
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const PoolStatistics& pool_stats, StatsVerbosity verbosity) {
     writer["pool"] = *pool_stats.pool;
     writer["congestion-control"] = pool_stats.congestion_control;
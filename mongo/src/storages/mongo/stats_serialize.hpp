@@ -12,6 +12,8 @@ void DumpMetric(utils::statistics::Writer& writer, const OperationStatisticsItem
 
 void DumpMetric(utils::statistics::Writer& writer, const PoolConnectStatistics& conn_stats);
 
+void DumpMetric(utils::statistics::Writer& writer, const ServerStatistics& server_stats);
+
 void DumpMetric(utils::statistics::Writer&, const PoolStatistics&, StatsVerbosity);
 
 }  // namespace storages::mongo::stats
@@ -0,0 +1,77 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace typed_cursor_test {
+
+struct Item {
+    int id{0};
+    std::string name;
+};
+
+Item Parse(const formats::bson::Value& doc, formats::parse::To<Item>) {
+    return Item{doc["_id"].As<int>(), doc["name"].As<std::string>()};
+}
+
+}  // namespace typed_cursor_test
+
+namespace {
+class TypedCursor : public MongoPoolFixture {};
+}  // namespace
+
+UTEST_F(TypedCursor, ParsesAllBatches) {
+    auto coll = GetDefaultPool().GetCollection("typed_cursor_batches");
+    // More than the first batch of 101 documents
+    constexpr int kCount = 250;
+    for (int i = 0; i < kCount; ++i) {
+        coll.InsertOne(bson::MakeDoc("_id", i, "name", std::to_string(i)));
+    }
+
+    mongo::TypedCursor<typed_cursor_test::Item> cursor{
+        coll.Find({}, mongo::options::Sort{{"_id", mongo::options::Sort::kAscending}}),
+        /*prefetch_size=*/10};
+
+    int expected_id = 0;
+    while (const auto item = cursor.Next()) {
+        EXPECT_EQ(item->id, expected_id);
+        EXPECT_EQ(item->name, std::to_string(expected_id));
+        ++expected_id;
+    }
+    EXPECT_EQ(expected_id, kCount);
+    EXPECT_FALSE(cursor.Next());
+}
+
+UTEST_F(TypedCursor, ParseErrorAfterParsedItems) {
+    auto coll = GetDefaultPool().GetCollection("typed_cursor_errors");
+    coll.InsertOne(bson::MakeDoc("_id", 1, "name", "one"));
+    coll.InsertOne(bson::MakeDoc("_id", 2, "name", 2));
+
+    mongo::TypedCursor<typed_cursor_test::Item> cursor{
+        coll.Find({}, mongo::options::Sort{{"_id", mongo::options::Sort::kAscending}})};
+
+    const auto first = cursor.Next();
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first->name, "one");
+    UEXPECT_THROW(cursor.Next(), formats::bson::TypeMismatchException);
+}
+
+UTEST_F(TypedCursor, EarlyDestruction) {
+    auto coll = GetDefaultPool().GetCollection("typed_cursor_destruction");
+    for (int i = 0; i < 250; ++i) {
+        coll.InsertOne(bson::MakeDoc("_id", i));
+    }
+
+    mongo::TypedCursor<bson::Document> cursor{coll.Find({}), /*prefetch_size=*/1};
+    EXPECT_TRUE(cursor.Next());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,163 @@
+#include <userver/storages/mongo/write_batcher.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/options.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+namespace {
+
+std::exception_ptr MakeErrorPtr(const MongoError& error, std::string prefix) {
+    try {
+        error.Throw(std::move(prefix));
+    } catch (...) {
+        return std::current_exception();
+    }
+}
+
+}  // namespace
+
+class WriteBatcher::Impl final {
+public:
+    Impl(Collection collection, Settings settings);
+    ~Impl();
+
+    template <typename SubOperation>
+    void Execute(const SubOperation& subop);
+
+private:
+    struct Batch {
+        explicit Batch(Collection& collection)
+            : bulk(collection.MakeUnorderedBulk(options::SuppressServerExceptions{})) {}
+
+        operations::Bulk bulk;
+        std::vector<engine::Promise<void>> promises;
+    };
+
+    void Run();
+    std::optional<Batch> PopBatch();
+    void FlushAll();
+    void ExecuteBatch(Batch& batch);
+
+    Collection collection_;
+    const Settings settings_;
+
+    engine::Mutex mutex_;
+    std::deque<Batch> batches_;
+
+    engine::SingleConsumerEvent has_writes_;
+    engine::SingleConsumerEvent batch_full_;
+    engine::TaskWithResult<void> task_;
+};
+
+WriteBatcher::Impl::Impl(Collection collection, Settings settings)
+    : collection_(std::move(collection)), settings_(settings) {
+    UINVARIANT(settings_.max_batch_size > 0, "max_batch_size must be positive");
+    task_ = engine::CriticalAsyncNoSpan([this] { Run(); });
+}
+
+WriteBatcher::Impl::~Impl() {
+    task_.SyncCancel();
+    // The writers are still waiting, the writes should not be lost
+    FlushAll();
+}
+
+template <typename SubOperation>
+void WriteBatcher::Impl::Execute(const SubOperation& subop) {
+    engine::Future<void> future;
+    {
+        const std::lock_guard lock{mutex_};
+        if (batches_.empty() || batches_.back().promises.size() >= settings_.max_batch_size) {
+            batches_.emplace_back(collection_);
+        }
+        auto& batch = batches_.back();
+        batch.bulk.Append(subop);
+        future = batch.promises.emplace_back().get_future();
+
+        if (batches_.size() == 1 && batch.promises.size() == 1) has_writes_.Send();
+        if (batch.promises.size() >= settings_.max_batch_size) batch_full_.Send();
+    }
+    future.get();
+}
+
+void WriteBatcher::Impl::Run() {
+    while (has_writes_.WaitForEvent()) {
+        // A signal left from the previous flush only makes the next one early
+        [[maybe_unused]] const auto is_full =
+            batch_full_.WaitForEventUntil(engine::Deadline::FromDuration(settings_.max_delay));
+        if (engine::current_task::ShouldCancel()) break;
+        FlushAll();
+    }
+}
+
+std::optional<WriteBatcher::Impl::Batch> WriteBatcher::Impl::PopBatch() {
+    const std::lock_guard lock{mutex_};
+    if (batches_.empty()) return std::nullopt;
+    auto batch = std::move(batches_.front());
+    batches_.pop_front();
+    return batch;
+}
+
+void WriteBatcher::Impl::FlushAll() {
+    while (auto batch = PopBatch()) {
+        ExecuteBatch(*batch);
+    }
+}
+
+void WriteBatcher::Impl::ExecuteBatch(Batch& batch) {
+    std::vector<std::exception_ptr> errors(batch.promises.size());
+    try {
+        const auto result = collection_.Execute(std::move(batch.bulk));
+        const auto write_concern_errors = result.WriteConcernErrors();
+        if (!write_concern_errors.empty()) {
+            std::fill(errors.begin(), errors.end(), MakeErrorPtr(write_concern_errors.front(), "Batched write failed"));
+        }
+        for (const auto& [index, error] : result.ServerErrors()) {
+            UASSERT(index < errors.size());
+            if (index < errors.size()) errors[index] = MakeErrorPtr(error, "Batched write failed");
+        }
+    } catch (const std::exception&) {
+        std::fill(errors.begin(), errors.end(), std::current_exception());
+    }
+
+    for (std::size_t i = 0; i < errors.size(); ++i) {
+        if (errors[i]) {
+            batch.promises[i].set_exception(std::move(errors[i]));
+        } else {
+            batch.promises[i].set_value();
+        }
+    }
+}
+
+WriteBatcher::WriteBatcher(Collection collection, Settings settings)
+    : impl_(std::make_unique<Impl>(std::move(collection), settings)) {}
+
+WriteBatcher::~WriteBatcher() = default;
+
+void WriteBatcher::Execute(const bulk_ops::InsertOne& subop) { impl_->Execute(subop); }
+
+void WriteBatcher::Execute(const bulk_ops::ReplaceOne& subop) { impl_->Execute(subop); }
+
+void WriteBatcher::Execute(const bulk_ops::Update& subop) { impl_->Execute(subop); }
+
+void WriteBatcher::Execute(const bulk_ops::Delete& subop) { impl_->Execute(subop); }
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,69 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+class WriteBatcher : public MongoPoolFixture {};
+}  // namespace
+
+UTEST_F_MT(WriteBatcher, ConcurrentWrites, 4) {
+    auto coll = GetDefaultPool().GetCollection("write_batcher_concurrent");
+    coll.InsertOne(bson::MakeDoc("_id", "counter", "value", 0));
+
+    mongo::WriteBatcher batcher{coll, {/*max_batch_size=*/10, /*max_delay=*/std::chrono::milliseconds{50}}};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < 50; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&batcher, i] {
+            batcher.InsertOne(bson::MakeDoc("_id", i));
+            batcher.UpdateOne(bson::MakeDoc("_id", "counter"), bson::MakeDoc("$inc", bson::MakeDoc("value", 1)));
+        }));
+    }
+    engine::WaitAllChecked(tasks);
+
+    EXPECT_EQ(coll.Count({}), 51);
+    const auto counter = coll.FindOne(bson::MakeDoc("_id", "counter"));
+    ASSERT_TRUE(counter);
+    EXPECT_EQ((*counter)["value"].As<int>(), 50);
+}
+
+UTEST_F(WriteBatcher, ServerErrorOfSingleWrite) {
+    auto coll = GetDefaultPool().GetCollection("write_batcher_errors");
+    coll.InsertOne(bson::MakeDoc("_id", 1));
+
+    mongo::WriteBatcher batcher{coll, {}};
+
+    auto duplicate = engine::AsyncNoSpan([&batcher] { batcher.InsertOne(bson::MakeDoc("_id", 1)); });
+    auto unique = engine::AsyncNoSpan([&batcher] { batcher.InsertOne(bson::MakeDoc("_id", 2)); });
+
+    UEXPECT_THROW(duplicate.Get(), mongo::DuplicateKeyException);
+    UEXPECT_NO_THROW(unique.Get());
+    EXPECT_EQ(coll.Count({}), 2);
+}
+
+UTEST_F(WriteBatcher, PendingWritesFlushedOnDestruction) {
+    auto coll = GetDefaultPool().GetCollection("write_batcher_destruction");
+
+    engine::TaskWithResult<void> task;
+    {
+        mongo::WriteBatcher batcher{coll, {/*max_batch_size=*/100, /*max_delay=*/std::chrono::hours{1}}};
+        task = engine::AsyncNoSpan([&batcher] { batcher.InsertOne(bson::MakeDoc("x", 1)); });
+        engine::Yield();
+    }
+    UEXPECT_NO_THROW(task.Get());
+    EXPECT_EQ(coll.Count({}), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -150,6 +150,38 @@ public:
         const Container& params
     ) const;
 
+    /// @brief Executes a statement on a host of host_type with default deadline.
+    /// Fills placeholders of the statements with Container::value_type in a
+    /// bulk-manner, splitting the container into several bulk executions, so
+    /// that each of them fits into `max_allowed_packet` of the server.
+    /// Container is expected to be a std::Container, Container::value_type is
+    /// expected to be an aggregate of supported types.
+    /// See @ref scripts/docs/en/userver/mysql/supported_types.md for better
+    /// understanding of `Container::value_type` requirements.
+    ///
+    /// The executions go one after another over the same connection, and are
+    /// not atomic: if one of them fails, the previous ones stay applied.
+    ///
+    /// @note Requires MariaDB 10.2.6+ as a server
+    ///
+    /// UINVARIANTs on params count mismatch, doesn't validate types.
+    /// UINVARIANTs on empty params container.
+    template <typename Container>
+    ExecutionResult
+    ExecuteBulkChunked(ClusterHostType host_type, const Query& query, const Container& params) const;
+
+    /// @brief Executes a statement on a host of host_type with provided
+    /// CommandControl, splitting the params into several bulk executions.
+    /// The deadline is for all the executions.
+    /// @see ExecuteBulkChunked
+    template <typename Container>
+    ExecutionResult ExecuteBulkChunked(
+        OptionalCommandControl command_control,
+        ClusterHostType host_type,
+        const Query& query,
+        const Container& params
+    ) const;
+
     // TODO : don't require Container to be const, so Convert can move
     // clang-format off
   /// @brief Executes a statement on a host of host_type with default deadline,
@@ -283,6 +315,13 @@ private:
         std::optional<std::size_t> batch_size
     ) const;
 
+    ExecutionResult DoExecuteChunked(
+        OptionalCommandControl command_control,
+        ClusterHostType host_type,
+        const Query& query,
+        impl::io::InsertChunkerBase& chunker
+    ) const;
+
     std::unique_ptr<infra::topology::TopologyBase> topology_;
 };
 
@@ -339,6 +378,26 @@ StatementResultSet Cluster::ExecuteBulk(
     return DoExecute(command_control, host_type, query.GetStatement(), params_binder, std::nullopt);
 }
 
+template <typename Container>
+ExecutionResult Cluster::ExecuteBulkChunked(ClusterHostType host_type, const Query& query, const Container& params)
+    const {
+    return ExecuteBulkChunked(std::nullopt, host_type, query, params);
+}
+
+template <typename Container>
+ExecutionResult Cluster::ExecuteBulkChunked(
+    OptionalCommandControl command_control,
+    ClusterHostType host_type,
+    const Query& query,
+    const Container& params
+) const {
+    UINVARIANT(!params.empty(), "Empty params in bulk execution");
+
+    auto chunker = impl::BindHelper::BindContainerAsChunkedParams(params);
+
+    return DoExecuteChunked(command_control, host_type, query, chunker);
+}
+
 template <typename MapTo, typename Container>
 StatementResultSet Cluster::ExecuteBulkMapped(ClusterHostType host_type, const Query& query, const Container& params)
     const {
@@ -49,6 +49,9 @@ namespace storages::mysql {
 /// -------------------------|---------------------------------------------|---------------
 /// initial_pool_size        | initial connection pool size (per host)     | 5
 /// max_pool_size            | maximum connection pool size (per host)     | 10
+/// statements_cache_size    | prepared statements cached per connection   | 20
+/// statements_warmup        | statements prepared on every new connection | []
+/// warmup_hot_statements    | also prepare statements most used by pool   | true
 ///
 // clang-format on
 class Component final : public components::ComponentBase {
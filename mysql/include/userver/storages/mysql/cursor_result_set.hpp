@@ -2,6 +2,8 @@
 
 /// @file userver/storages/mysql/cursor_result_set.hpp
 
+#include <vector>
+
 #include <userver/storages/mysql/statement_result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,8 +32,22 @@ public:
     template <typename RowCallback>
     void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
 
+    /// @brief Fetches the next `batch_size` rows from cursor.
+    ///
+    /// Usable for processing the rows chunk by chunk, when the processing
+    /// itself is done in batches: only one chunk is kept in memory.
+    ///
+    /// @returns the fetched rows, an empty vector once the cursor is exhausted.
+    std::vector<T> FetchChunk();
+
 private:
+    using Extractor = impl::io::TypedExtractor<std::vector<T>, T, RowTag>;
+
     StatementResultSet result_set_;
+    // Output bindings of the statement point into the extractor, so the
+    // same extractor is used for all the fetches
+    Extractor extractor_{};
+    bool exhausted_{false};
 };
 
 template <typename T>
@@ -50,23 +66,30 @@ void CursorResultSet<T>::ForEach(
     // TODO : think about separate deadline here
     [[maybe_unused]] engine::Deadline deadline
 ) && {
-    using IntermediateStorage = std::vector<T>;
-
-    bool keep_going = true;
-    auto extractor = impl::io::TypedExtractor<IntermediateStorage, T, RowTag>{};
-
-    while (keep_going) {
+    while (!exhausted_) {
         tracing::ScopeTime fetch{impl::tracing::kFetchScope};
-        keep_going = result_set_.FetchResult(extractor);
+        exhausted_ = !result_set_.FetchResult(extractor_);
 
         fetch.Reset(impl::tracing::kForEachScope);
-        IntermediateStorage data{extractor.ExtractData()};
+        std::vector<T> data{extractor_.ExtractData()};
         for (auto&& row : data) {
             row_callback(std::move(row));
         }
     }
 }
 
+template <typename T>
+std::vector<T> CursorResultSet<T>::FetchChunk() {
+    std::vector<T> data;
+    // The last fetch may return no rows while not knowing it's the last one
+    while (data.empty() && !exhausted_) {
+        tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+        exhausted_ = !result_set_.FetchResult(extractor_);
+        data = extractor_.ExtractData();
+    }
+    return data;
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <boost/pfr/core.hpp>
 
 #include <userver/storages/mysql/impl/io/insert_binder.hpp>
+#include <userver/storages/mysql/impl/io/insert_chunker.hpp>
 #include <userver/storages/mysql/impl/io/params_binder.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +34,11 @@ public:
         return io::InsertBinder{rows};
     }
 
+    template <typename Container>
+    static io::InsertChunker<Container> BindContainerAsChunkedParams(const Container& rows) {
+        return io::InsertChunker<Container>{rows};
+    }
+
     template <typename MapTo, typename Container>
     static io::InsertBinder<Container, MapTo> BindContainerAsParamsMapped(const Container& rows) {
         return io::InsertBinder<Container, MapTo>{rows};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/utils/meta.hpp>
+
+#include <userver/storages/mysql/impl/io/insert_binder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl::io {
+
+// Approximate size of a field in a bulk execution packet
+template <typename T>
+std::size_t EstimateFieldSize(const T& field) {
+    // length-encoded prefix or a null indicator
+    constexpr std::size_t kFieldOverhead = 9;
+
+    if constexpr (meta::kIsOptional<T>) {
+        return field.has_value() ? EstimateFieldSize(*field) : kFieldOverhead;
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        return std::string_view{field}.size() + kFieldOverhead;
+    } else {
+        return sizeof(T) + kFieldOverhead;
+    }
+}
+
+template <typename Row>
+std::size_t EstimateRowSize(const Row& row) {
+    std::size_t size = 0;
+    boost::pfr::for_each_field(row, [&size](const auto& field) { size += EstimateFieldSize(field); });
+    return size;
+}
+
+// Non-owning part of a container, suitable for InsertBinder
+template <typename Iterator>
+struct ContainerRange final {
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using const_iterator = Iterator;
+
+    const_iterator begin() const { return first; }
+    const_iterator end() const { return last; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    Iterator first;
+    Iterator last;
+    std::size_t count;
+};
+
+class InsertChunkerBase {
+public:
+    // Binds the rows following the previous chunk, so that their estimated
+    // size doesn't exceed max_chunk_size (but at least one row is bound).
+    // Returns nullptr once all the rows are bound.
+    virtual ParamsBinderBase* BindNextChunk(std::size_t max_chunk_size) = 0;
+
+protected:
+    ~InsertChunkerBase() = default;
+};
+
+template <typename Container>
+class InsertChunker final : public InsertChunkerBase {
+public:
+    explicit InsertChunker(const Container& container) : next_it_{container.begin()}, end_it_{container.end()} {}
+
+    ParamsBinderBase* BindNextChunk(std::size_t max_chunk_size) final {
+        binder_.reset();
+        if (next_it_ == end_it_) return nullptr;
+
+        const auto first = next_it_;
+        std::size_t count = 0;
+        std::size_t chunk_size = 0;
+        while (next_it_ != end_it_) {
+            const auto row_size = EstimateRowSize(*next_it_);
+            if (count != 0 && chunk_size + row_size > max_chunk_size) break;
+            chunk_size += row_size;
+            ++count;
+            ++next_it_;
+        }
+
+        range_.emplace(Range{first, next_it_, count});
+        return &binder_.emplace(*range_);
+    }
+
+private:
+    using Range = ContainerRange<typename Container::const_iterator>;
+
+    typename Container::const_iterator next_it_;
+    const typename Container::const_iterator end_it_;
+
+    std::optional<Range> range_;
+    std::optional<InsertBinder<Range>> binder_;
+};
+
+}  // namespace storages::mysql::impl::io
+
+USERVER_NAMESPACE_END
@@ -102,6 +102,31 @@ StatementResultSet Cluster::DoExecute(
     return {std::move(connection), std::move(fetcher), std::move(span)};
 }
 
+ExecutionResult Cluster::DoExecuteChunked(
+    OptionalCommandControl command_control,
+    ClusterHostType host_type,
+    const Query& query,
+    impl::io::InsertChunkerBase& chunker
+) const {
+    const auto deadline = GetDeadline(command_control, GetDefaultCommandControl());
+
+    tracing::Span span{impl::tracing::kExecuteSpan};
+
+    auto connection = topology_->SelectPool(host_type).Acquire(deadline);
+
+    // Leave a half of the packet for the protocol overhead and for the errors
+    // of the rows size estimation
+    const auto max_chunk_size = connection->GetMaxAllowedPacket(deadline) / 2;
+
+    ExecutionResult result{};
+    while (auto* params = chunker.BindNextChunk(max_chunk_size)) {
+        const auto fetcher = connection->ExecuteStatement(query.GetStatement(), *params, deadline, std::nullopt);
+        result.rows_affected += fetcher.RowsAffected();
+        if (result.last_insert_id == 0) result.last_insert_id = fetcher.LastInsertId();
+    }
+    return result;
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
@@ -58,6 +58,21 @@ properties:
         type: integer
         description: maximum number of created connections
         defaultDescription: 10
+    statements_cache_size:
+        type: integer
+        description: maximum number of prepared statements cached per connection
+        defaultDescription: 20
+    statements_warmup:
+        type: array
+        description: statements prepared on every new connection before it is used
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: statement text, exactly as it is executed
+    warmup_hot_statements:
+        type: boolean
+        description: whether to prepare the statements most used by the pool on every new connection
+        defaultDescription: true
 )");
 }
 
@@ -10,6 +10,7 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/scope_time.hpp>
+#include <userver/utils/from_string.hpp>
 
 #include <storages/mysql/impl/metadata/native_client_info.hpp>
 #include <storages/mysql/impl/metadata/server_info.hpp>
@@ -106,9 +107,12 @@ Connection::Connection(
     const settings::EndpointInfo& endpoint_info,
     const settings::AuthSettings& auth_settings,
     const settings::ConnectionSettings& connection_settings,
-    engine::Deadline deadline
+    engine::Deadline deadline,
+    HotStatements* hot_statements
 )
-    : socket_{-1, 0}, statements_cache_{*this, connection_settings.statements_cache_size} {
+    : socket_{-1, 0},
+      statements_cache_{*this, connection_settings.statements_cache_size},
+      hot_statements_{hot_statements} {
     { auto _ = mysql_local_scope.Use(); }
 
     InitSocket(resolver, endpoint_info, auth_settings, connection_settings, deadline);
@@ -125,6 +129,22 @@ Connection::~Connection() {
     Close(engine::Deadline::FromDuration(kDefaultCloseTimeout));
 }
 
+std::size_t Connection::WarmupStatements(const std::vector<std::string>& statements, engine::Deadline deadline) {
+    std::size_t prepared = 0;
+    for (const auto& statement : statements) {
+        try {
+            auto guard = GetBrokenGuard();
+            guard.Execute([this, &statement, deadline] { statements_cache_.PrepareStatement(statement, deadline); });
+            ++prepared;
+        } catch (const std::exception& ex) {
+            // A broken connection is of no use, let the pool drop it
+            if (IsBroken()) throw;
+            LOG_WARNING() << "Failed to prepare statement '" << statement << "' in advance: " << ex;
+        }
+    }
+    return prepared;
+}
+
 QueryResult Connection::ExecuteQuery(const std::string& query, engine::Deadline deadline) {
     auto guard = GetBrokenGuard();
 
@@ -200,6 +220,17 @@ std::string Connection::GetNativeError(std::string_view prefix) {
 
 const metadata::ServerInfo& Connection::GetServerInfo() const { return server_info_; }
 
+std::size_t Connection::GetMaxAllowedPacket(engine::Deadline deadline) {
+    if (!max_allowed_packet_.has_value()) {
+        auto result = ExecuteQuery("SELECT @@max_allowed_packet", deadline);
+        if (result.RowsCount() != 1 || result.GetRow(0).FieldsCount() != 1) {
+            throw MySQLException{0, "Unexpected result of max_allowed_packet query"};
+        }
+        max_allowed_packet_.emplace(utils::FromString<std::size_t>(result.GetRow(0).GetField(0)));
+    }
+    return *max_allowed_packet_;
+}
+
 BrokenGuard Connection::GetBrokenGuard() { return BrokenGuard{*this}; }
 
 void Connection::NotifyBroken() { broken_.store(true); }
@@ -319,6 +350,7 @@ Statement& Connection::PrepareStatement(
     engine::Deadline deadline,
     std::optional<std::size_t> batch_size
 ) {
+    if (hot_statements_) hot_statements_->Account(statement);
     auto& mysql_statement = statements_cache_.PrepareStatement(statement, deadline);
 
     if (batch_size.has_value()) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -10,6 +11,7 @@
 #include <storages/mysql/impl/mariadb_include.hpp>
 
 #include <storages/mysql/impl/broken_guard.hpp>
+#include <storages/mysql/impl/hot_statements.hpp>
 #include <storages/mysql/impl/metadata/server_info.hpp>
 #include <storages/mysql/impl/query_result.hpp>
 #include <storages/mysql/impl/socket.hpp>
@@ -39,10 +41,15 @@ public:
         const settings::EndpointInfo& endpoint_info,
         const settings::AuthSettings& auth_settings,
         const settings::ConnectionSettings& connection_settings,
-        engine::Deadline deadline
+        engine::Deadline deadline,
+        HotStatements* hot_statements = nullptr
     );
     ~Connection();
 
+    // Prepares the statements ahead of their first execution, statements
+    // that fail to prepare are skipped. Returns the number of prepared ones.
+    std::size_t WarmupStatements(const std::vector<std::string>& statements, engine::Deadline deadline);
+
     QueryResult ExecuteQuery(const std::string& query, engine::Deadline deadline);
 
     StatementFetcher ExecuteStatement(
@@ -66,6 +73,9 @@ public:
 
     const metadata::ServerInfo& GetServerInfo() const;
 
+    // Queries max_allowed_packet of the server on the first call
+    std::size_t GetMaxAllowedPacket(engine::Deadline deadline);
+
     BrokenGuard GetBrokenGuard();
 
     // There are places (destructors, basically) where we want to run some
@@ -101,8 +111,10 @@ private:
     MYSQL mysql_{};
 
     metadata::ServerInfo server_info_{};
+    std::optional<std::size_t> max_allowed_packet_;
 
     StatementsCache statements_cache_;
+    HotStatements* hot_statements_;
 };
 
 }  // namespace impl
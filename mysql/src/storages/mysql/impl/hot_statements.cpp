@@ -0,0 +1,43 @@
+#include <storages/mysql/impl/hot_statements.hpp>
+
+#include <algorithm>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+HotStatements::HotStatements(std::size_t max_tracked) : max_tracked_{max_tracked} {}
+
+void HotStatements::Account(const std::string& statement) {
+    if (const auto usage = usages_.Get(statement)) {
+        usage->fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Statements generated on the fly shouldn't grow the map indefinitely,
+    // the ones that made it first are most likely the hot ones anyway
+    if (usages_.SizeApprox() >= max_tracked_) return;
+    usages_.Emplace(statement, 0).value->fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<std::string> HotStatements::GetHottest(std::size_t count) const {
+    std::vector<std::pair<std::uint64_t, std::string>> usages;
+    for (const auto& [statement, usage] : usages_) {
+        usages.emplace_back(usage->load(std::memory_order_relaxed), statement);
+    }
+
+    count = std::min(count, usages.size());
+    std::partial_sort(usages.begin(), usages.begin() + count, usages.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first > rhs.first;
+    });
+
+    std::vector<std::string> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) result.push_back(std::move(usages[i].second));
+    return result;
+}
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/rcu/rcu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+// Pool-wide usage counters of prepared statements, so that a new connection
+// could prepare the frequently used statements before it's handed out.
+class HotStatements final {
+public:
+    explicit HotStatements(std::size_t max_tracked);
+
+    void Account(const std::string& statement);
+
+    // Returns at most `count` most used statements, most used first
+    std::vector<std::string> GetHottest(std::size_t count) const;
+
+private:
+    const std::size_t max_tracked_;
+
+    mutable rcu::RcuMap<std::string, std::atomic<std::uint64_t>> usages_;
+};
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include <storages/mysql/infra/pool.hpp>
 
 #include <chrono>
+#include <iterator>
+#include <unordered_set>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -22,6 +24,8 @@ constexpr std::chrono::milliseconds kPoolSizeMonitorInterval{2000};
 constexpr std::chrono::milliseconds kPingerInterval{1000};
 constexpr std::chrono::milliseconds kPingTimeout{200};
 
+constexpr std::size_t kMaxTrackedStatements{1000};
+
 }  // namespace
 
 std::shared_ptr<Pool> Pool::Create(clients::dns::Resolver& resolver, const settings::PoolSettings& pool_settings) {
@@ -51,6 +55,7 @@ Pool::Pool(clients::dns::Resolver& resolver, const settings::PoolSettings& pool_
           ConnectionPoolBase<impl::Connection, Pool>{pool_settings.max_pool_size, kMaxSimultaneouslyConnectingClients},
       resolver_{resolver},
       settings_{pool_settings},
+      hot_statements_{kMaxTrackedStatements},
       monitor_{*this} {
     try {
         Init(settings_.initial_pool_size, kConnectionSetupTimeout);
@@ -63,8 +68,14 @@ Pool::Pool(clients::dns::Resolver& resolver, const settings::PoolSettings& pool_
 Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
     try {
         auto connection_ptr = std::make_unique<impl::Connection>(
-            resolver_, settings_.endpoint_info, settings_.auth_settings, settings_.connection_settings, deadline
+            resolver_,
+            settings_.endpoint_info,
+            settings_.auth_settings,
+            settings_.connection_settings,
+            deadline,
+            &hot_statements_
         );
+        connection_ptr->WarmupStatements(GetWarmupStatements(), deadline);
         monitor_.AccountSuccess();
 
         return connection_ptr;
@@ -74,6 +85,29 @@ Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
     }
 }
 
+std::vector<std::string> Pool::GetWarmupStatements() const {
+    const auto& connection_settings = settings_.connection_settings;
+    const auto capacity = connection_settings.statements_cache_size;
+
+    std::vector<std::string> statements;
+    std::unordered_set<std::string> seen;
+    for (const auto& statement : connection_settings.statements_warmup) {
+        if (statements.size() < capacity && seen.insert(statement).second) statements.push_back(statement);
+    }
+    if (!connection_settings.warmup_hot_statements) return statements;
+
+    std::vector<std::string> hottest;
+    for (auto& statement : hot_statements_.GetHottest(capacity)) {
+        if (statements.size() + hottest.size() >= capacity) break;
+        if (!seen.count(statement)) hottest.push_back(std::move(statement));
+    }
+    // Least used statements go first, so that they are the first ones evicted
+    statements.insert(
+        statements.end(), std::make_move_iterator(hottest.rbegin()), std::make_move_iterator(hottest.rend())
+    );
+    return statements;
+}
+
 void Pool::AccountConnectionAcquired() { ++stats_.acquired; }
 void Pool::AccountConnectionReleased() { ++stats_.released; }
 void Pool::AccountConnectionCreated() { ++stats_.created; }
@@ -2,6 +2,8 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/engine/deadline.hpp>
@@ -10,6 +12,7 @@
 
 #include <userver/drivers/impl/connection_pool_base.hpp>
 
+#include <storages/mysql/impl/hot_statements.hpp>
 #include <storages/mysql/infra/connection_ptr.hpp>
 #include <storages/mysql/infra/statistics.hpp>
 #include <storages/mysql/settings/settings.hpp>
@@ -40,6 +43,7 @@ private:
     friend class drivers::impl::ConnectionPoolBase<impl::Connection, Pool>;
 
     ConnectionUniquePtr DoCreateConnection(engine::Deadline deadline);
+    std::vector<std::string> GetWarmupStatements() const;
 
     void AccountConnectionAcquired();
     void AccountConnectionReleased();
@@ -81,6 +85,8 @@ private:
 
     PoolConnectionStatistics stats_{};
 
+    impl::HotStatements hot_statements_;
+
     PoolMonitor monitor_;
 };
 
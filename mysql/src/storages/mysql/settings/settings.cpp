@@ -49,6 +49,8 @@ ConnectionSettings Parse(const yaml_config::YamlConfig& doc, formats::parse::To<
     ConnectionSettings settings{};
     // TODO : named const
     settings.statements_cache_size = doc["statements_cache_size"].As<std::size_t>(20);
+    settings.statements_warmup = doc["statements_warmup"].As<std::vector<std::string>>({});
+    settings.warmup_hot_statements = doc["warmup_hot_statements"].As<bool>(true);
     // TODO
     settings.use_secure_connection = false;
     // TODO
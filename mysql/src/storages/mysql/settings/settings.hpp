@@ -32,6 +32,11 @@ struct ConnectionSettings final {
     bool use_compression;
 
     IpMode ip_mode;
+
+    // statements prepared on every new connection
+    std::vector<std::string> statements_warmup;
+    // whether to also prepare the statements most used by the pool
+    bool warmup_hot_statements;
 };
 
 ConnectionSettings Parse(const yaml_config::YamlConfig& doc, formats::parse::To<ConnectionSettings>);
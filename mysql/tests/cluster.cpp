@@ -76,6 +76,29 @@ UTEST(Cluster, InsertMany) {
     EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cluster, InsertManyChunked) {
+    ClusterWrapper cluster{};
+    TmpTable table{cluster, "Id INT NOT NULL, Value LONGTEXT NOT NULL"};
+
+    // Exceeds the default max_allowed_packet of the server
+    constexpr int kRowsCount = 40;
+    const std::string large_value(1024 * 1024, 'a');
+
+    std::vector<Row> rows_to_insert;
+    rows_to_insert.reserve(kRowsCount);
+    for (int i = 0; i < kRowsCount; ++i) {
+        rows_to_insert.push_back({i, large_value});
+    }
+
+    const auto result = cluster->ExecuteBulkChunked(
+        ClusterHostType::kPrimary, table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"), rows_to_insert
+    );
+    EXPECT_EQ(result.rows_affected, kRowsCount);
+
+    const auto db_rows = table.DefaultExecute("SELECT Id, Value FROM {}").AsVector<Row>();
+    EXPECT_EQ(db_rows, rows_to_insert);
+}
+
 UTEST(Cluster, UpdateMany) {
     ClusterWrapper cluster{};
     TmpTable table{cluster, "Id INT PRIMARY KEY, Value TEXT NOT NULL"};
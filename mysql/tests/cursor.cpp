@@ -42,6 +42,35 @@ UTEST(Cursor, Works) {
     EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cursor, FetchChunk) {
+    ClusterWrapper cluster{};
+    TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+    constexpr std::size_t rows_count = 20;
+    std::vector<Row> rows_to_insert;
+    rows_to_insert.reserve(rows_count);
+    for (std::size_t i = 0; i < rows_count; ++i) {
+        rows_to_insert.push_back({static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+    }
+    cluster->ExecuteBulk(
+        ClusterHostType::kPrimary, table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"), rows_to_insert
+    );
+
+    auto cursor = cluster->GetCursor<Row>(
+        ClusterHostType::kPrimary, 7, table.FormatWithTableName("SELECT Id, Value FROM {} ORDER BY Id")
+    );
+
+    std::vector<Row> db_rows;
+    std::vector<std::size_t> chunk_sizes;
+    for (auto chunk = cursor.FetchChunk(); !chunk.empty(); chunk = cursor.FetchChunk()) {
+        chunk_sizes.push_back(chunk.size());
+        db_rows.insert(db_rows.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+    }
+    EXPECT_EQ(chunk_sizes, (std::vector<std::size_t>{7, 7, 6}));
+    EXPECT_EQ(db_rows, rows_to_insert);
+    EXPECT_TRUE(cursor.FetchChunk().empty());
+}
+
 // https://bugs.mysql.com/bug.php?id=109380
 UTEST(Cursor, StatementReuseWorks) {
     ClusterWrapper cluster{};
@@ -0,0 +1,31 @@
+#include <userver/utest/utest.hpp>
+
+#include <storages/mysql/impl/hot_statements.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::tests {
+
+UTEST(HotStatements, Hottest) {
+    impl::HotStatements hot_statements{10};
+    for (int i = 0; i < 3; ++i) hot_statements.Account("SELECT 3");
+    hot_statements.Account("SELECT 1");
+    for (int i = 0; i < 2; ++i) hot_statements.Account("SELECT 2");
+
+    EXPECT_EQ(hot_statements.GetHottest(2), (std::vector<std::string>{"SELECT 3", "SELECT 2"}));
+    EXPECT_EQ(hot_statements.GetHottest(10), (std::vector<std::string>{"SELECT 3", "SELECT 2", "SELECT 1"}));
+}
+
+UTEST(HotStatements, MaxTracked) {
+    impl::HotStatements hot_statements{2};
+    hot_statements.Account("SELECT 1");
+    hot_statements.Account("SELECT 2");
+    for (int i = 0; i < 5; ++i) hot_statements.Account("SELECT 3");
+    hot_statements.Account("SELECT 2");
+
+    EXPECT_EQ(hot_statements.GetHottest(3), (std::vector<std::string>{"SELECT 2", "SELECT 1"}));
+}
+
+}  // namespace storages::mysql::tests
+
+USERVER_NAMESPACE_END
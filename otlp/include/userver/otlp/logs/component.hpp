@@ -29,6 +29,9 @@ class Logger;
 /// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
 /// max-queue-size | Maximum async queue size | 65535
 /// max-batch-delay | Maximum batch delay | 100ms
+/// traces-max-queue-size | Maximum count of spans buffered for sending, the rest are dropped | 65535
+/// traces-max-batch-size | Maximum count of spans in a single export request | 1024
+/// traces-gzip | Compress the span export requests with gzip | true
 /// service-name | Service name | unknown_service
 /// attributes | Extra attributes for OTLP, object of key/value strings | -
 /// sinks | List of sinks | -
@@ -55,6 +58,7 @@ private:
     std::shared_ptr<Logger> logger_;
     logging::LoggerRef old_logger_;
     utils::statistics::Entry statistics_holder_;
+    utils::statistics::Entry span_exporter_statistics_holder_;
 };
 
 }  // namespace otlp
@@ -46,6 +46,10 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
         config["attributes-mapping"].As<std::unordered_map<std::string, std::string>>({});
     logger_config.logs_sink = config["sinks"]["logs"].As<SinkType>(SinkType::kOtlp);
     logger_config.tracing_sink = config["sinks"]["tracing"].As<SinkType>(SinkType::kOtlp);
+    logger_config.span_exporter.max_queue_size = config["traces-max-queue-size"].As<size_t>(65535);
+    logger_config.span_exporter.max_batch_size = config["traces-max-batch-size"].As<size_t>(1024);
+    logger_config.span_exporter.max_batch_delay = logger_config.max_batch_delay;
+    logger_config.span_exporter.gzip_compression = config["traces-gzip"].As<bool>(true);
 
     logger_ = std::make_shared<Logger>(std::move(client), std::move(trace_client), std::move(logger_config));
     // We must init after the default logger is initialized
@@ -86,6 +90,12 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
             statistics_storage->GetStorage().RegisterWriter("logger", [this](utils::statistics::Writer& writer) {
                 writer.ValueWithLabels(logger_->GetStatistics(), {"logger", "default"});
             });
+        span_exporter_statistics_holder_ = statistics_storage->GetStorage().RegisterWriter(
+            "otlp.span-exporter",
+            [this](utils::statistics::Writer& writer) {
+                if (const auto* stats = logger_->GetSpanExporterStatistics()) writer = *stats;
+            }
+        );
     }
 }
 
@@ -119,6 +129,18 @@ properties:
     max-batch-delay:
         type: string
         description: max delay between send batches (e.g. 100ms or 1s)
+    traces-max-queue-size:
+        type: integer
+        description: max count of spans buffered for sending, the rest are dropped
+        defaultDescription: 65535
+    traces-max-batch-size:
+        type: integer
+        description: max count of spans in a single export request
+        defaultDescription: 1024
+    traces-gzip:
+        type: boolean
+        description: compress the span export requests with gzip
+        defaultDescription: true
     service-name:
         type: string
         description: service name
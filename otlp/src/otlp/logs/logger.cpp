@@ -6,13 +6,12 @@
 #include <userver/engine/async.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/formats/parse/to.hpp>
+#include <userver/logging/binary_log.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/logger.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
-#include <userver/utils/encoding/tskv_parser_read.hpp>
-#include <userver/utils/overloaded.hpp>
 #include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -24,7 +23,29 @@ constexpr std::string_view kTelemetrySdkLanguage = "telemetry.sdk.language";
 constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
 constexpr std::string_view kServiceName = "service.name";
 
-const std::string kTimestampFormat = "%Y-%m-%dT%H:%M:%E*S";
+logging::Format GetLoggerFormat(const LoggerConfig& config) {
+    // Records shipped to OTLP are converted from the binary records tag by tag,
+    // without formatting them into TSKV and parsing back
+    if (config.logs_sink == SinkType::kDefault && config.tracing_sink == SinkType::kDefault) {
+        return logging::Format::kTskv;
+    }
+    return logging::Format::kBinary;
+}
+
+logging::DecodedLogFormat GetDecodedLogFormat(logging::Format format) {
+    switch (format) {
+        case logging::Format::kLtsv:
+            return logging::DecodedLogFormat::kLtsv;
+        case logging::Format::kJson:
+            return logging::DecodedLogFormat::kJson;
+        default:
+            return logging::DecodedLogFormat::kTskv;
+    }
+}
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point timestamp) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()).count();
+}
 }  // namespace
 
 SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType>) {
@@ -46,20 +67,25 @@ Logger::Logger(
     opentelemetry::proto::collector::trace::v1::TraceServiceClient trace_client,
     LoggerConfig&& config
 )
-    : LoggerBase(logging::Format::kTskv),
+    : LoggerBase(GetLoggerFormat(config)),
       config_(std::move(config)),
       queue_(Queue::Create(config_.max_queue_size)),
       queue_producer_(queue_->GetMultiProducer()) {
     SetLevel(config_.log_level);
     std::cerr << "OTLP logger has started\n";
 
-    sender_task_ = engine::CriticalAsyncNoSpan([this,
-                                                consumer = queue_->GetConsumer(),
-                                                log_client = std::move(client),
-                                                trace_client = std::move(trace_client)]() mutable {
-        SendingLoop(consumer, log_client, trace_client);
-    });
-    ;
+    if (config_.tracing_sink == SinkType::kBoth || config_.tracing_sink == SinkType::kOtlp) {
+        ::opentelemetry::proto::resource::v1::Resource resource;
+        FillAttributes(resource);
+        span_exporter_ =
+            std::make_unique<SpanExporter>(std::move(trace_client), std::move(resource), config_.span_exporter);
+    }
+
+    sender_task_ = engine::CriticalAsyncNoSpan(
+        [this, consumer = queue_->GetConsumer(), log_client = std::move(client)]() mutable {
+            SendingLoop(consumer, log_client);
+        }
+    );
 }
 
 Logger::~Logger() { Stop(); }
@@ -67,10 +93,15 @@ Logger::~Logger() { Stop(); }
 void Logger::Stop() noexcept {
     sender_task_.SyncCancel();
     sender_task_ = {};
+    if (span_exporter_) span_exporter_->Stop();
 }
 
 const logging::impl::LogStatistics& Logger::GetStatistics() const { return stats_; }
 
+const SpanExporterStatistics* Logger::GetSpanExporterStatistics() const {
+    return span_exporter_ ? &span_exporter_->GetStatistics() : nullptr;
+}
+
 void Logger::PrependCommonTags(logging::impl::TagWriter writer) const {
     logging::impl::default_::PrependCommonTags(writer);
 }
@@ -79,50 +110,39 @@ bool Logger::DoShouldLog(logging::Level level) const noexcept { return logging::
 
 void Logger::Log(logging::Level level, std::string_view msg) {
     if (config_.logs_sink == SinkType::kDefault || config_.logs_sink == SinkType::kBoth) {
-        if (default_logger_) default_logger_->Log(level, msg);
+        ForwardToDefaultLogger(level, msg, /*is_trace=*/false);
         if (config_.logs_sink == SinkType::kDefault) {
             return;
         }
     }
 
-    utils::encoding::TskvParser parser{msg};
+    const logging::BinaryLogRecordView record{msg};
 
     ::opentelemetry::proto::logs::v1::LogRecord log_record;
-    std::chrono::system_clock::time_point timestamp;
 
     ++stats_.by_level[static_cast<int>(level)];
 
-    [[maybe_unused]] auto parse_ok =
-        utils::encoding::TskvReadRecord(parser, [&](std::string_view key, std::string_view value) {
-            if (key == "text") {
-                log_record.mutable_body()->set_string_value(grpc::string(std::string{value}));
-                return true;
-            }
-            if (key == "trace_id") {
-                log_record.set_trace_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "span_id") {
-                log_record.set_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "timestamp") {
-                timestamp = utils::datetime::LocalTimezoneStringtime(std::string{value}, kTimestampFormat);
-                return true;
-            }
-            if (key == "level") {
-                log_record.set_severity_text(grpc::string(std::string{value}));
-                return true;
-            }
-
-            auto attributes = log_record.add_attributes();
-            attributes->set_key(std::string{MapAttribute(key)});
-            attributes->mutable_value()->set_string_value(std::string{value});
-            return true;
-        });
-
-    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch());
-    log_record.set_time_unix_nano(nanoseconds.count());
+    log_record.set_severity_text(grpc::string(logging::ToUpperCaseString(record.GetLevel())));
+    log_record.set_time_unix_nano(ToUnixNano(record.GetTimestamp()));
+
+    record.VisitTags([&](std::string_view key, std::string_view value) {
+        if (key == "text") {
+            log_record.mutable_body()->set_string_value(grpc::string(value));
+            return;
+        }
+        if (key == "trace_id") {
+            log_record.set_trace_id(utils::encoding::FromHex(value));
+            return;
+        }
+        if (key == "span_id") {
+            log_record.set_span_id(utils::encoding::FromHex(value));
+            return;
+        }
+
+        auto attributes = log_record.add_attributes();
+        attributes->set_key(std::string{MapAttribute(key)});
+        attributes->mutable_value()->set_string_value(std::string{value});
+    });
 
     // Drop a log if overflown
     auto ok = queue_producer_.PushNoblock(std::move(log_record));
@@ -133,67 +153,79 @@ void Logger::Log(logging::Level level, std::string_view msg) {
 
 void Logger::Trace(logging::Level level, std::string_view msg) {
     if (config_.tracing_sink == SinkType::kDefault || config_.tracing_sink == SinkType::kBoth) {
-        if (default_logger_) default_logger_->Trace(level, msg);
+        ForwardToDefaultLogger(level, msg, /*is_trace=*/true);
         if (config_.tracing_sink == SinkType::kDefault) {
             return;
         }
     }
 
-    utils::encoding::TskvParser parser{msg};
+    const logging::BinaryLogRecordView record{msg};
 
     ::opentelemetry::proto::trace::v1::Span span;
 
-    std::string start_timestamp;
-    std::string total_time;
-
-    [[maybe_unused]] auto parse_ok =
-        utils::encoding::TskvReadRecord(parser, [&](std::string_view key, std::string_view value) {
-            if (key == "trace_id") {
-                span.set_trace_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "span_id") {
-                span.set_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "parent_id") {
-                span.set_parent_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "stopwatch_name") {
-                span.set_name(std::string(value));
-                return true;
-            }
-            if (key == "total_time") {
-                total_time = value;
-                return true;
-            }
-            if (key == "start_timestamp") {
-                start_timestamp = value;
-                return true;
-            }
-            if (key == "timestamp" || key == "text") {
-                return true;
-            }
-
-            auto attributes = span.add_attributes();
-            attributes->set_key(std::string{MapAttribute(key)});
-            attributes->mutable_value()->set_string_value(std::string{value});
-            return true;
-        });
-
-    auto start_timestamp_double = std::stod(start_timestamp);
+    std::string_view start_timestamp;
+    std::string_view total_time;
+
+    record.VisitTags([&](std::string_view key, std::string_view value) {
+        if (key == "trace_id") {
+            span.set_trace_id(utils::encoding::FromHex(value));
+            return;
+        }
+        if (key == "span_id") {
+            span.set_span_id(utils::encoding::FromHex(value));
+            return;
+        }
+        if (key == "parent_id") {
+            span.set_parent_span_id(utils::encoding::FromHex(value));
+            return;
+        }
+        if (key == "stopwatch_name") {
+            span.set_name(std::string(value));
+            return;
+        }
+        if (key == "total_time") {
+            total_time = value;
+            return;
+        }
+        if (key == "start_timestamp") {
+            start_timestamp = value;
+            return;
+        }
+        if (key == "text") {
+            return;
+        }
+
+        auto attributes = span.add_attributes();
+        attributes->set_key(std::string{MapAttribute(key)});
+        attributes->mutable_value()->set_string_value(std::string{value});
+    });
+
+    auto start_timestamp_double = std::stod(std::string{start_timestamp});
+    auto total_time_double = std::stod(std::string{total_time});
     span.set_start_time_unix_nano(start_timestamp_double * 1'000'000'000);
-    span.set_end_time_unix_nano((start_timestamp_double + std::stod(total_time) / 1'000) * 1'000'000'000LL);
+    span.set_end_time_unix_nano((start_timestamp_double + total_time_double / 1'000) * 1'000'000'000LL);
 
-    // Drop a trace if overflown
-    auto ok = queue_producer_.PushNoblock(std::move(span));
-    if (!ok) {
-        ++stats_.dropped;
+    span_exporter_->Export(std::move(span));
+}
+
+void Logger::ForwardToDefaultLogger(logging::Level level, std::string_view msg, bool is_trace) {
+    if (!default_logger_) return;
+
+    std::string converted;
+    const auto default_format = default_logger_->GetFormat();
+    if (GetFormat() == logging::Format::kBinary && default_format != logging::Format::kBinary) {
+        logging::DecodeBinaryLog(msg, GetDecodedLogFormat(default_format), converted);
+        msg = converted;
+    }
+
+    if (is_trace) {
+        default_logger_->Trace(level, msg);
+    } else {
+        default_logger_->Log(level, msg);
     }
 }
 
-void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client) {
+void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client) {
     // Create dummy span to completely disable logging in current coroutine
     tracing::Span span("");
     span.SetLocalLogLevel(logging::Level::kNone);
@@ -203,39 +235,17 @@ void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, Trace
     auto scope_logs = resource_logs->add_scope_logs();
     FillAttributes(*resource_logs->mutable_resource());
 
-    ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest trace_request;
-    auto resource_spans = trace_request.add_resource_spans();
-    auto scope_spans = resource_spans->add_scope_spans();
-    FillAttributes(*resource_spans->mutable_resource());
-
-    Action action{};
-    while (consumer.Pop(action)) {
+    ::opentelemetry::proto::logs::v1::LogRecord log_record;
+    while (consumer.Pop(log_record)) {
         scope_logs->clear_log_records();
-        scope_spans->clear_spans();
 
         auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
 
         do {
-            std::visit(
-                utils::Overloaded{
-                    [&scope_spans](const opentelemetry::proto::trace::v1::Span& action) {
-                        auto span = scope_spans->add_spans();
-                        *span = action;
-                    },
-                    [&scope_logs](const opentelemetry::proto::logs::v1::LogRecord& action) {
-                        auto log_records = scope_logs->add_log_records();
-                        *log_records = action;
-                    }},
-                action
-            );
-        } while (consumer.Pop(action, deadline));
-
-        if (config_.logs_sink == SinkType::kBoth || config_.logs_sink == SinkType::kOtlp) {
-            DoLog(log_request, log_client);
-        }
-        if (config_.tracing_sink == SinkType::kBoth || config_.tracing_sink == SinkType::kOtlp) {
-            DoTrace(trace_request, trace_client);
-        }
+            *scope_logs->add_log_records() = std::move(log_record);
+        } while (consumer.Pop(log_record, deadline));
+
+        DoLog(log_request, log_client);
     }
 }
 
@@ -280,21 +290,6 @@ void Logger::DoLog(
     // TODO: count exceptions
 }
 
-void Logger::DoTrace(
-    const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
-    TraceClient& trace_client
-) {
-    try {
-        auto response = trace_client.SyncExport(request);
-    } catch (const ugrpc::client::RpcCancelledError&) {
-        std::cerr << "Stopping OTLP sender task\n";
-        throw;
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to write down OTLP trace(s): " << e.what() << typeid(e).name() << "\n";
-    }
-    // TODO: count exceptions
-}
-
 std::string_view Logger::MapAttribute(std::string_view attr) const {
     for (const auto& [key, value] : config_.attributes_mapping) {
         if (key == attr) return value;
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <variant>
 
 #include <opentelemetry/proto/collector/logs/v1/logs_service_client.usrv.pb.hpp>
 #include <opentelemetry/proto/collector/trace/v1/trace_service_client.usrv.pb.hpp>
@@ -13,6 +12,8 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include "span_exporter.hpp"
+
 USERVER_NAMESPACE_BEGIN
 
 namespace otlp {
@@ -30,6 +31,7 @@ struct LoggerConfig {
     std::unordered_map<std::string, std::string> extra_attributes;
     std::unordered_map<std::string, std::string> attributes_mapping;
     logging::Level log_level{logging::Level::kInfo};
+    SpanExporterConfig span_exporter;
 };
 
 class Logger final : public logging::impl::LoggerBase {
@@ -51,26 +53,25 @@ public:
 
     const logging::impl::LogStatistics& GetStatistics() const;
 
+    /// nullptr if the spans are not sent via OTLP
+    const SpanExporterStatistics* GetSpanExporterStatistics() const;
+
     void SetDefaultLogger(logging::LoggerPtr default_logger) { default_logger_ = default_logger; }
 
 protected:
     bool DoShouldLog(logging::Level level) const noexcept override;
 
 private:
-    using Action = std::variant<::opentelemetry::proto::logs::v1::LogRecord, ::opentelemetry::proto::trace::v1::Span>;
-    using Queue = concurrent::NonFifoMpscQueue<Action>;
+    using Queue = concurrent::NonFifoMpscQueue<::opentelemetry::proto::logs::v1::LogRecord>;
 
-    void SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client);
+    void SendingLoop(Queue::Consumer& consumer, LogClient& log_client);
+
+    void ForwardToDefaultLogger(logging::Level level, std::string_view msg, bool is_trace);
 
     void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
 
     void DoLog(const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request, LogClient& client);
 
-    void DoTrace(
-        const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
-        TraceClient& trace_client
-    );
-
     std::string_view MapAttribute(std::string_view attr) const;
 
     logging::impl::LogStatistics stats_;
@@ -78,6 +79,7 @@ private:
     std::shared_ptr<Queue> queue_;
     Queue::MultiProducer queue_producer_;
     logging::LoggerPtr default_logger_{};
+    std::unique_ptr<SpanExporter> span_exporter_;
     engine::Task sender_task_;  // Must be the last member
 };
 
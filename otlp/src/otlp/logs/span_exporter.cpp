@@ -0,0 +1,150 @@
+#include "span_exporter.hpp"
+
+#include <iostream>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+struct LocalThreadBuffer final {
+    std::uint64_t exporter_id{0};
+    void* buffer{nullptr};
+};
+
+compiler::ThreadLocal local_thread_buffer = [] { return LocalThreadBuffer{}; };
+
+std::atomic<std::uint64_t> last_exporter_id{0};
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const SpanExporterStatistics& stats) {
+    writer["exported"] = stats.exported;
+    writer["dropped"] = stats.dropped;
+    writer["export_errors"] = stats.export_errors;
+}
+
+SpanExporter::SpanExporter(
+    TraceClient client,
+    opentelemetry::proto::resource::v1::Resource&& resource,
+    SpanExporterConfig config
+)
+    : config_(config), exporter_id_(++last_exporter_id) {
+    auto* resource_spans = request_.add_resource_spans();
+    *resource_spans->mutable_resource() = std::move(resource);
+    scope_spans_ = resource_spans->add_scope_spans();
+
+    sender_task_ = engine::CriticalAsyncNoSpan([this, client = std::move(client)]() mutable { SendingLoop(client); });
+}
+
+SpanExporter::~SpanExporter() {
+    Stop();
+    for (std::size_t i = 0; i < thread_buffers_count_.load(); ++i) {
+        delete thread_buffers_[i];
+    }
+}
+
+void SpanExporter::Stop() noexcept {
+    sender_task_.SyncCancel();
+    sender_task_ = {};
+}
+
+void SpanExporter::Export(opentelemetry::proto::trace::v1::Span&& span) {
+    // The bound is approximate, the spans being taken by the sender are
+    // already subtracted
+    if (buffered_.fetch_add(1, std::memory_order_relaxed) >= config_.max_queue_size) {
+        buffered_.fetch_sub(1, std::memory_order_relaxed);
+        ++stats_.dropped;
+        return;
+    }
+
+    auto& buffer = GetThreadBuffer();
+    std::size_t size = 0;
+    {
+        const std::lock_guard lock{buffer.mutex};
+        buffer.spans.push_back(std::move(span));
+        size = buffer.spans.size();
+    }
+    if (size == config_.max_batch_size) batch_ready_event_.Send();
+}
+
+SpanExporter::ThreadBuffer& SpanExporter::GetThreadBuffer() {
+    // Threads outside of task processors may be short-lived, their buffers
+    // would be never reused
+    if (!engine::current_task::IsTaskProcessorThread()) return fallback_buffer_;
+
+    auto local_buffer = local_thread_buffer.Use();
+    if (local_buffer->exporter_id != exporter_id_) {
+        local_buffer->buffer = RegisterThreadBuffer();
+        local_buffer->exporter_id = exporter_id_;
+    }
+    return local_buffer->buffer ? *static_cast<ThreadBuffer*>(local_buffer->buffer) : fallback_buffer_;
+}
+
+SpanExporter::ThreadBuffer* SpanExporter::RegisterThreadBuffer() {
+    const std::lock_guard lock{thread_buffers_mutex_};
+    const auto count = thread_buffers_count_.load(std::memory_order_relaxed);
+    if (count == thread_buffers_.size()) return nullptr;
+
+    thread_buffers_[count] = new ThreadBuffer();
+    thread_buffers_count_.store(count + 1, std::memory_order_release);
+    return thread_buffers_[count];
+}
+
+void SpanExporter::SendingLoop(TraceClient& client) {
+    // Create dummy span to completely disable logging in current coroutine
+    tracing::Span span("");
+    span.SetLocalLogLevel(logging::Level::kNone);
+
+    while (batch_ready_event_.WaitForEventFor(config_.max_batch_delay) ||
+           !engine::current_task::ShouldCancel()) {
+        const auto count = thread_buffers_count_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i <= count; ++i) {
+            auto& buffer = i < count ? *thread_buffers_[i] : fallback_buffer_;
+            {
+                const std::lock_guard lock{buffer.mutex};
+                if (buffer.spans.empty()) continue;
+                taken_.swap(buffer.spans);
+            }
+            buffered_.fetch_sub(taken_.size(), std::memory_order_relaxed);
+
+            for (auto& taken_span : taken_) {
+                *scope_spans_->add_spans() = std::move(taken_span);
+                if (static_cast<std::size_t>(scope_spans_->spans_size()) == config_.max_batch_size) SendBatch(client);
+            }
+            // The capacity goes back to the thread buffer on the next swap
+            taken_.clear();
+        }
+        if (scope_spans_->spans_size() != 0) SendBatch(client);
+    }
+}
+
+void SpanExporter::SendBatch(TraceClient& client) {
+    const auto size = scope_spans_->spans_size();
+    try {
+        auto context = std::make_unique<grpc::ClientContext>();
+        if (config_.gzip_compression) context->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+        [[maybe_unused]] auto response = client.SyncExport(request_, std::move(context));
+        stats_.exported += utils::statistics::Rate{static_cast<std::uint64_t>(size)};
+    } catch (const ugrpc::client::RpcCancelledError&) {
+        std::cerr << "Stopping OTLP span exporter task\n";
+        throw;
+    } catch (const std::exception& e) {
+        ++stats_.export_errors;
+        stats_.dropped += utils::statistics::Rate{static_cast<std::uint64_t>(size)};
+        std::cerr << "Failed to write down OTLP trace(s): " << e.what() << "\n";
+    }
+    scope_spans_->clear_spans();
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
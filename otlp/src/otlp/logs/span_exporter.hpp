@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <opentelemetry/proto/collector/trace/v1/trace_service_client.usrv.pb.hpp>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+struct SpanExporterConfig {
+    // Max spans buffered for sending, the rest are dropped
+    std::size_t max_queue_size{65535};
+    std::size_t max_batch_size{1024};
+    std::chrono::milliseconds max_batch_delay{100};
+    bool gzip_compression{true};
+};
+
+struct SpanExporterStatistics final {
+    utils::statistics::RateCounter exported{};
+    utils::statistics::RateCounter dropped{};
+    utils::statistics::RateCounter export_errors{};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const SpanExporterStatistics& stats);
+
+/// Accumulates the completed spans in the per-thread buffers and sends them
+/// in batches via a dedicated task, so that the span completion does not
+/// contend on a shared queue.
+class SpanExporter final {
+public:
+    using TraceClient = opentelemetry::proto::collector::trace::v1::TraceServiceClient;
+    using ExportRequest = opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest;
+
+    /// `resource` is sent with each batch
+    SpanExporter(TraceClient client, opentelemetry::proto::resource::v1::Resource&& resource, SpanExporterConfig config);
+
+    ~SpanExporter();
+
+    SpanExporter(const SpanExporter&) = delete;
+    SpanExporter& operator=(const SpanExporter&) = delete;
+
+    /// Never blocks, may be called from any thread. The span is dropped if
+    /// the buffers are full.
+    void Export(opentelemetry::proto::trace::v1::Span&& span);
+
+    void Stop() noexcept;
+
+    const SpanExporterStatistics& GetStatistics() const noexcept { return stats_; }
+
+private:
+    struct ThreadBuffer final {
+        std::mutex mutex;
+        std::vector<opentelemetry::proto::trace::v1::Span> spans;
+    };
+
+    static constexpr std::size_t kMaxThreadBuffers = 256;
+
+    ThreadBuffer& GetThreadBuffer();
+    ThreadBuffer* RegisterThreadBuffer();
+
+    void SendingLoop(TraceClient& client);
+    void SendBatch(TraceClient& client);
+
+    const SpanExporterConfig config_;
+    const std::uint64_t exporter_id_;
+    SpanExporterStatistics stats_;
+    std::atomic<std::size_t> buffered_{0};
+    engine::SingleConsumerEvent batch_ready_event_;
+
+    // Thread buffers are only appended, and are destroyed with the exporter.
+    // Threads without a buffer of their own share the fallback one.
+    std::mutex thread_buffers_mutex_;
+    std::array<ThreadBuffer*, kMaxThreadBuffers> thread_buffers_{};
+    std::atomic<std::size_t> thread_buffers_count_{0};
+    ThreadBuffer fallback_buffer_;
+
+    // The data of the sending task
+    ExportRequest request_;
+    opentelemetry::proto::trace::v1::ScopeSpans* scope_spans_{nullptr};
+    std::vector<opentelemetry::proto::trace::v1::Span> taken_;
+
+    engine::Task sender_task_;  // Must be the last member
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
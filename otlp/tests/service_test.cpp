@@ -3,6 +3,7 @@
 #include <vector>
 
 #include <otlp/logs/logger.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
 
 #include <userver/ugrpc/tests/service_fixtures.hpp>
@@ -151,4 +152,24 @@ UTEST_F(LogServiceTest, SmokeTrace) {
     EXPECT_LE(span.end_time_unix_nano(), timestamp2.count());
 }
 
+UTEST_F_MT(LogServiceTest, TraceBatches, 4) {
+    constexpr std::size_t kTasks = 4;
+    constexpr std::size_t kSpansPerTask = 1000;
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kTasks; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([] {
+            for (std::size_t j = 0; j < kSpansPerTask; ++j) {
+                tracing::Span span("batched_span");
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    while (GetService2().spans.size() < kTasks * kSpansPerTask) {
+        engine::SleepFor(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(GetService2().spans.size(), kTasks * kSpansPerTask);
+}
+
 USERVER_NAMESPACE_END
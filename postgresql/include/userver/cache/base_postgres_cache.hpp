@@ -6,10 +6,14 @@
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <map>
+#include <optional>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -23,9 +27,11 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -66,6 +72,7 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// full-update-partitions | number of key ranges to fetch and parse in parallel on full update, requires `kFullUpdatePartitionField` in policy | 1
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -91,6 +98,27 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Updated Example
 ///
+/// Full updates of big caches may be sped up by setting the
+/// `full-update-partitions` static option and `kFullUpdatePartitionField` in
+/// policy. The key range of the field is split into the partitions that are
+/// fetched over separate connections and parsed concurrently.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Partitioned Full Update Example
+///
+/// Incremental updates start from a copy of the current cache data. For big
+/// caches use cache::PersistentHashMap as CacheContainer: its copy is O(1)
+/// and an update allocates memory only for the changed entries.
+///
+/// Incremental updates publish the keys of the fetched rows as
+/// cache::ChangeSet::updated, if the CacheContainer is keyed by kKeyMember.
+/// Derived caches may subscribe to them with
+/// components::CachingComponentBase::UpdateAndListenChanges to avoid
+/// recomputing everything on each update.
+///
+/// Caches that are scanned as a whole by filters and aggregations may use
+/// cache::ColumnarTable as CacheContainer, it stores each field of ValueType
+/// in a separate contiguous column.
+///
 /// In case one provides a custom CacheContainer within Policy, it is notified
 /// of Update completion via its public member function OnWritesDone, if any.
 /// See the following code snippet for an example of usage:
@@ -160,6 +188,12 @@ using HasWhere = decltype(T::kWhere);
 template <typename T>
 inline constexpr bool kHasWhere = meta::kIsDetected<HasWhere, T>;
 
+// Full update partition field in policy
+template <typename T>
+using HasFullUpdatePartitionField = decltype(T::kFullUpdatePartitionField);
+template <typename T>
+inline constexpr bool kHasFullUpdatePartitionField = meta::kIsDetected<HasFullUpdatePartitionField, T>;
+
 // Update field
 template <typename T>
 using HasUpdatedField = decltype(T::kUpdatedField);
@@ -370,6 +404,24 @@ inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+
+// Inclusive range of the full update partition field values
+struct KeyRange {
+    std::int64_t lower;
+    std::int64_t upper;
+};
+
+// Splits [min, max] into at most `count` ranges of equal length, the last
+// range is not bounded from above to catch up with the rows inserted after
+// the bounds were fetched
+std::vector<KeyRange> SplitKeyRange(std::int64_t min, std::int64_t max, std::size_t count);
+
+template <typename ValueType>
+struct PartitionData {
+    std::vector<ValueType> values;
+    std::size_t rows_count{0};
+    std::size_t parse_failures{0};
+};
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -401,6 +453,12 @@ public:
 
 private:
     using CachedData = std::unique_ptr<DataType>;
+    using ChangeSetType = typename BaseType::ChangeSetType;
+
+    // Incremental updates publish the keys of the fetched rows if the cache
+    // container is keyed by kKeyMember
+    constexpr static bool kPublishesChanges =
+        std::is_same_v<typename ChangeSetType::KeyType, pg_cache::detail::KeyMemberType<PolicyType>>;
 
     UpdatedFieldType GetLastUpdated(std::chrono::system_clock::time_point last_update, const DataType& cache) const;
 
@@ -417,12 +475,28 @@ private:
     void CacheResults(
         storages::postgres::ResultSet res,
         CachedData& data_cache,
+        ChangeSetType* changes,
         cache::UpdateStatisticsScope& stats_scope,
         tracing::ScopeTime& scope
     );
 
+    std::size_t FetchPartitioned(
+        storages::postgres::Cluster& cluster,
+        std::chrono::milliseconds timeout,
+        DataType& data_cache,
+        cache::UpdateStatisticsScope& stats_scope,
+        tracing::ScopeTime& scope
+    );
+    pg_cache::detail::PartitionData<ValueType> FetchPartition(
+        storages::postgres::Cluster& cluster,
+        std::chrono::milliseconds timeout,
+        pg_cache::detail::KeyRange range
+    );
+
     static storages::postgres::Query GetAllQuery();
     static storages::postgres::Query GetDeltaQuery();
+    static storages::postgres::Query GetPartitionBoundsQuery();
+    static storages::postgres::Query GetPartitionQuery();
 
     std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
 
@@ -432,6 +506,7 @@ private:
     const std::chrono::milliseconds full_update_timeout_;
     const std::chrono::milliseconds incremental_update_timeout_;
     const std::size_t chunk_size_;
+    const std::size_t full_update_partitions_;
     std::size_t cpu_relax_iterations_parse_{0};
     std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -448,7 +523,8 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
       incremental_update_timeout_{config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
           pg_cache::detail::kDefaultIncrementalUpdateTimeout
       )},
-      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)} {
+      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)},
+      full_update_partitions_{config["full-update-partitions"].As<size_t>(1)} {
     UINVARIANT(
         !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
         "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -462,6 +538,16 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
             config.Name() + "' cache"
         );
     }
+    if (full_update_partitions_ == 0) {
+        throw std::logic_error("'full-update-partitions' must be positive in config of '" + config.Name() + "' cache");
+    }
+    if (full_update_partitions_ > 1 && !pg_cache::detail::kHasFullUpdatePartitionField<PostgreCachePolicy>) {
+        throw std::logic_error(
+            "Partitioned full updates are requested in config but no partition "
+            "field is specified in traits of '" +
+            config.Name() + "' cache"
+        );
+    }
     if (correction_.count() < 0) {
         throw std::logic_error(
             "Refusing to set forward (negative) update correction requested in "
@@ -524,6 +610,40 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
     }
 }
 
+template <typename PostgreCachePolicy>
+storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetPartitionBoundsQuery() {
+    if constexpr (pg_cache::detail::kHasFullUpdatePartitionField<PostgreCachePolicy>) {
+        const auto query = GetAllQuery();
+        return {
+            fmt::format(
+                "select min({0})::bigint, max({0})::bigint from ({1}) as cache_partition",
+                PostgreCachePolicy::kFullUpdatePartitionField,
+                query.Statement()
+            ),
+            query.GetName()};
+    } else {
+        return {};
+    }
+}
+
+template <typename PostgreCachePolicy>
+storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetPartitionQuery() {
+    if constexpr (pg_cache::detail::kHasFullUpdatePartitionField<PostgreCachePolicy>) {
+        const auto query = GetAllQuery();
+        // The subquery is flattened by the planner, so the condition may use
+        // an index on the field
+        return {
+            fmt::format(
+                "select * from ({1}) as cache_partition where {0} between $1 and $2",
+                PostgreCachePolicy::kFullUpdatePartitionField,
+                query.Statement()
+            ),
+            query.GetName()};
+    } else {
+        return {};
+    }
+}
+
 template <typename PostgreCachePolicy>
 std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(const ComponentConfig& config) {
     static constexpr std::string_view kUpdateCorrection = "update-correction";
@@ -562,6 +682,13 @@ void PostgreCache<PostgreCachePolicy>::Update(
     const std::chrono::milliseconds timeout =
         (type == cache::UpdateType::kFull) ? full_update_timeout_ : incremental_update_timeout_;
 
+    // Changes are relative to the current data, so they are only known for
+    // incremental updates on top of it
+    std::optional<ChangeSetType> change_set;
+    if constexpr (kPublishesChanges) {
+        if (type == cache::UpdateType::kIncremental && this->GetUnsafe()) change_set.emplace();
+    }
+
     // COPY current cached data
     auto scope = tracing::Span::CurrentSpan().CreateScopeTime(std::string{pg_cache::detail::kCopyStage});
     auto data_cache = GetDataSnapshot(type, scope);
@@ -572,7 +699,9 @@ void PostgreCache<PostgreCachePolicy>::Update(
     size_t changes = 0;
     // Iterate clusters
     for (auto& cluster : clusters_) {
-        if (chunk_size_ > 0) {
+        if (type == cache::UpdateType::kFull && full_update_partitions_ > 1) {
+            changes += FetchPartitioned(*cluster, timeout, *data_cache, stats_scope, scope);
+        } else if (chunk_size_ > 0) {
             auto trx = cluster->Begin(
                 kClusterHostTypeFlags,
                 pg::Transaction::RO,
@@ -585,7 +714,7 @@ void PostgreCache<PostgreCachePolicy>::Update(
                 stats_scope.IncreaseDocumentsReadCount(res.Size());
 
                 scope.Reset(std::string{pg_cache::detail::kParseStage});
-                CacheResults(res, data_cache, stats_scope, scope);
+                CacheResults(res, data_cache, change_set ? &*change_set : nullptr, stats_scope, scope);
                 changes += res.Size();
             }
             trx.Commit();
@@ -605,7 +734,7 @@ void PostgreCache<PostgreCachePolicy>::Update(
             stats_scope.IncreaseDocumentsReadCount(res.Size());
 
             scope.Reset(std::string{pg_cache::detail::kParseStage});
-            CacheResults(res, data_cache, stats_scope, scope);
+            CacheResults(res, data_cache, change_set ? &*change_set : nullptr, stats_scope, scope);
             changes += res.Size();
         }
     }
@@ -641,7 +770,11 @@ void PostgreCache<PostgreCachePolicy>::Update(
         // Set current cache
         pg_cache::detail::OnWritesDone(*data_cache);
         stats_scope.Finish(data_cache->size());
-        this->Set(std::move(data_cache));
+        if (change_set) {
+            this->Set(std::move(data_cache), std::move(*change_set));
+        } else {
+            this->Set(std::move(data_cache));
+        }
     } else {
         stats_scope.FinishNoChanges();
     }
@@ -656,6 +789,7 @@ template <typename PostgreCachePolicy>
 void PostgreCache<PostgreCachePolicy>::CacheResults(
     storages::postgres::ResultSet res,
     CachedData& data_cache,
+    [[maybe_unused]] ChangeSetType* changes,
     cache::UpdateStatisticsScope& stats_scope,
     tracing::ScopeTime& scope
 ) {
@@ -665,6 +799,15 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
         relax.Relax();
         try {
             using pg_cache::detail::CacheInsertOrAssign;
+            if constexpr (kPublishesChanges) {
+                if (changes) {
+                    auto value = pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p);
+                    auto key = std::invoke(PostgreCachePolicy::kKeyMember, value);
+                    CacheInsertOrAssign(*data_cache, std::move(value), PostgreCachePolicy::kKeyMember);
+                    changes->updated.push_back(std::move(key));
+                    continue;
+                }
+            }
             CacheInsertOrAssign(
                 *data_cache, pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p), PostgreCachePolicy::kKeyMember
             );
@@ -676,6 +819,102 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
     }
 }
 
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchPartitioned(
+    storages::postgres::Cluster& cluster,
+    std::chrono::milliseconds timeout,
+    DataType& data_cache,
+    cache::UpdateStatisticsScope& stats_scope,
+    tracing::ScopeTime& scope
+) {
+    namespace pg = storages::postgres;
+    using Bounds = std::tuple<std::optional<std::int64_t>, std::optional<std::int64_t>>;
+
+    scope.Reset(std::string{pg_cache::detail::kFetchStage});
+    const auto [min, max] =
+        cluster
+            .Execute(
+                kClusterHostTypeFlags,
+                pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
+                GetPartitionBoundsQuery()
+            )
+            .template AsSingleRow<Bounds>();
+    if (!min || !max) return 0;
+
+    // Both fetch and parse happen in the partition tasks
+    std::vector<engine::TaskWithResult<pg_cache::detail::PartitionData<ValueType>>> tasks;
+    for (const auto range : pg_cache::detail::SplitKeyRange(*min, *max, full_update_partitions_)) {
+        tasks.push_back(utils::Async("pg_cache_partition", [this, &cluster, timeout, range] {
+            return FetchPartition(cluster, timeout, range);
+        }));
+    }
+    auto partitions = engine::GetAll(tasks);
+
+    scope.Reset(std::string{pg_cache::detail::kParseStage});
+    std::size_t rows_count = 0;
+    std::size_t values_count = 0;
+    for (const auto& partition : partitions) {
+        rows_count += partition.rows_count;
+        values_count += partition.values.size();
+        stats_scope.IncreaseDocumentsReadCount(partition.rows_count);
+        if (partition.parse_failures) stats_scope.IncreaseDocumentsParseFailures(partition.parse_failures);
+    }
+    if constexpr (meta::kIsReservable<DataType>) {
+        data_cache.reserve(data_cache.size() + values_count);
+    }
+
+    utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
+    for (auto& partition : partitions) {
+        for (auto& value : partition.values) {
+            relax.Relax();
+            using pg_cache::detail::CacheInsertOrAssign;
+            CacheInsertOrAssign(data_cache, std::move(value), PostgreCachePolicy::kKeyMember);
+        }
+    }
+    return rows_count;
+}
+
+template <typename PostgreCachePolicy>
+pg_cache::detail::PartitionData<typename PostgreCache<PostgreCachePolicy>::ValueType>
+PostgreCache<PostgreCachePolicy>::FetchPartition(
+    storages::postgres::Cluster& cluster,
+    std::chrono::milliseconds timeout,
+    pg_cache::detail::KeyRange range
+) {
+    namespace pg = storages::postgres;
+    pg_cache::detail::PartitionData<ValueType> partition;
+
+    const auto parse = [this, &partition](const pg::ResultSet& res) {
+        partition.rows_count += res.Size();
+        partition.values.reserve(partition.values.size() + res.Size());
+        auto values = res.AsSetOf<RawValueType>(pg::kRowTag);
+        utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+        for (auto p = values.begin(); p != values.end(); ++p) {
+            relax.Relax();
+            try {
+                partition.values.push_back(pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
+            } catch (const std::exception& e) {
+                ++partition.parse_failures;
+                LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                            << compiler::GetTypeName<ValueType>() << "': " << e.what();
+            }
+        }
+    };
+
+    const pg::CommandControl cc{timeout, pg_cache::detail::kStatementTimeoutOff};
+    if (chunk_size_ > 0) {
+        auto trx = cluster.Begin(kClusterHostTypeFlags, pg::Transaction::RO, cc);
+        auto portal = trx.MakePortal(GetPartitionQuery(), range.lower, range.upper);
+        while (portal) {
+            parse(portal.Fetch(chunk_size_));
+        }
+        trx.Commit();
+    } else {
+        parse(cluster.Execute(kClusterHostTypeFlags, cc, GetPartitionQuery(), range.lower, range.upper));
+    }
+    return partition;
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope) {
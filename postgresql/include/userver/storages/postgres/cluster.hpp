@@ -21,7 +21,9 @@
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/statistics.hpp>
+#include <userver/storages/postgres/streamed_result.hpp>
 #include <userver/storages/postgres/transaction.hpp>
+#include <userver/storages/postgres/typed_query.hpp>
 
 /// @page pg_topology uPg: Cluster topology discovery
 ///
@@ -175,6 +177,12 @@ public:
     /// @brief Execute a statement at host of specified type.
     /// @note You must specify at least one role from ClusterHostType here
     ///
+    /// With `statement-batching` enabled in the component static config, the
+    /// statements to standby hosts (no ClusterHostType::kMaster in flags) that
+    /// have only built-in types of arguments are merged with the concurrent
+    /// statements of other tasks into pipelined batches, see
+    /// storages::postgres::StatementBatchingSettings.
+    ///
     /// @snippet storages/postgres/tests/landing_test.cpp Exec sample
     ///
     /// @warning Do NOT create a query string manually by embedding arguments!
@@ -193,6 +201,26 @@ public:
     template <typename... Args>
     ResultSet Execute(ClusterHostTypeFlags, OptionalCommandControl, const Query& query, const Args&... args);
 
+    /// @brief Execute a statement with parameters of compile time fixed types
+    /// and specified host selection rules.
+    ///
+    /// @see storages::postgres::TypedQuery
+    template <typename... Args>
+    ResultSet
+    Execute(ClusterHostTypeFlags, const TypedQuery<Args...>& query, const detail::TypeIdentity<Args>&... args);
+
+    /// @brief Execute a statement with parameters of compile time fixed types,
+    /// specified host selection rules and command control settings.
+    ///
+    /// @see storages::postgres::TypedQuery
+    template <typename... Args>
+    ResultSet Execute(
+        ClusterHostTypeFlags,
+        OptionalCommandControl,
+        const TypedQuery<Args...>& query,
+        const detail::TypeIdentity<Args>&... args
+    );
+
     /// @brief Execute a statement with stored arguments and specified host
     /// selection rules.
     ///
@@ -215,9 +243,50 @@ public:
     );
     /// @}
 
+    /// @name Streamed single-statement query
+    /// @{
+
+    /// @brief Execute a statement with stored arguments and specified host
+    /// selection rules, passing the rows to the consumer by chunks of at most
+    /// `chunk_size` rows as they are received. Returns the number of rows.
+    ///
+    /// Unlike Execute, the whole result is never held in memory, so large
+    /// results (e.g. for cache full updates) are parsed incrementally. A
+    /// transaction is not required. With libpq older than 17 each chunk
+    /// contains a single row.
+    ///
+    /// The connection is closed if the consumer throws, as the rest of
+    /// the rows can not be skipped without reading them.
+    ///
+    /// @snippet storages/postgres/tests/streamed_result_pgtest.cpp Execute streamed
+    ///
+    /// @note You must specify at least one role from ClusterHostType here
+    std::size_t ExecuteStreamed(
+        ClusterHostTypeFlags flags,
+        const Query& query,
+        const ParameterStore& store,
+        ResultChunkConsumer consumer,
+        std::size_t chunk_size = kDefaultStreamedChunkSize
+    );
+
+    /// @brief Execute a statement with stored arguments, specified host
+    /// selection rules and command control settings, passing the rows to the
+    /// consumer by chunks as they are received. Returns the number of rows.
+    std::size_t ExecuteStreamed(
+        ClusterHostTypeFlags flags,
+        OptionalCommandControl statement_cmd_ctl,
+        const Query& query,
+        const ParameterStore& store,
+        ResultChunkConsumer consumer,
+        std::size_t chunk_size = kDefaultStreamedChunkSize
+    );
+    /// @}
+
     /// @brief Listen for notifications on channel
-    /// @warning Each NotifyScope owns a single connection taken from the pool,
-    /// which effectively decreases the number of usable connections
+    ///
+    /// All the listeners on the master host share a single connection taken
+    /// from its pool. If the connection breaks, the channels are listened
+    /// again on a new connection, notifications sent in the meantime are lost.
     NotifyScope Listen(std::string_view channel, OptionalCommandControl = {});
 
     /// Replaces globally updated command control with a static user-provided one
@@ -249,6 +318,9 @@ public:
 private:
     detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+    bool IsStatementBatchingEnabled(ClusterHostTypeFlags) const;
+    ResultSet ExecuteBatched(ClusterHostTypeFlags, OptionalCommandControl, const Query&, const ParameterStore&);
+
     OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
     OptionalCommandControl GetHandlersCmdCtl(OptionalCommandControl cmd_ctl) const;
 
@@ -271,6 +343,44 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if constexpr (((io::IsTypeMappedToSystem<Args>() || io::IsTypeMappedToSystemArray<Args>()) && ...)) {
+        if (IsStatementBatchingEnabled(flags)) {
+            ParameterStore store;
+            (store.PushBack(args), ...);
+            return ExecuteBatched(flags, statement_cmd_ctl, query, store);
+        }
+    }
+    auto ntrx = Start(flags, statement_cmd_ctl);
+    return ntrx.Execute(statement_cmd_ctl, query, args...);
+}
+
+template <typename... Args>
+ResultSet Cluster::Execute(
+    ClusterHostTypeFlags flags,
+    const TypedQuery<Args...>& query,
+    const detail::TypeIdentity<Args>&... args
+) {
+    return Execute(flags, OptionalCommandControl{}, query, args...);
+}
+
+template <typename... Args>
+ResultSet Cluster::Execute(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const TypedQuery<Args...>& query,
+    const detail::TypeIdentity<Args>&... args
+) {
+    if (!statement_cmd_ctl && query.GetQuery().GetName()) {
+        statement_cmd_ctl = GetQueryCmdCtl(query.GetQuery().GetName()->GetUnderlying());
+    }
+    statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if constexpr (!TypedQuery<Args...>::Parameters::kHasUserTypes) {
+        if (IsStatementBatchingEnabled(flags)) {
+            ParameterStore store;
+            (store.PushBack(args), ...);
+            return ExecuteBatched(flags, statement_cmd_ctl, query.GetQuery(), store);
+        }
+    }
     auto ntrx = Start(flags, statement_cmd_ctl);
     return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
@@ -44,6 +44,12 @@ enum class ClusterHostType {
 
     /// Chooses a host with the lowest RTT
     kNearest = 0x10,
+
+    /// Chooses the host with the lowest expected query latency out of two
+    /// random hosts. The expected latency is an exponentially weighted moving
+    /// average of the host query execution time multiplied by the number of
+    /// its busy connections, so both slow and overloaded hosts are avoided
+    kFastest = 0x20,
     /// @}
 };
 
@@ -54,7 +60,10 @@ constexpr ClusterHostTypeFlags kClusterHostRolesMask{
     ClusterHostType::kSyncSlave,
     ClusterHostType::kSlave};
 
-constexpr ClusterHostTypeFlags kClusterHostStrategyMask{ClusterHostType::kRoundRobin, ClusterHostType::kNearest};
+constexpr ClusterHostTypeFlags kClusterHostStrategyMask{
+    ClusterHostType::kRoundRobin,
+    ClusterHostType::kNearest,
+    ClusterHostType::kFastest};
 
 std::string ToString(ClusterHostType);
 std::string ToString(ClusterHostTypeFlags);
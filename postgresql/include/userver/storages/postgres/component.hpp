@@ -129,12 +129,20 @@ namespace components {
 /// monitoring-dbalias      | name of the database for monitorings                                          | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                                          | 200
 /// max_statement_metrics   | limit of exported metrics for named statements                                | 0
+/// prepared-statements-warmup-size | number of recently prepared statements of the pool to prepare on every new connection | 0
+/// warmup-statements       | statements to prepare on every new connection                                 | []
 /// min_pool_size           | number of connections created initially                                       | 4
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// autoscaling_enabled     | scale the number of connections by acquire wait time, also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | false
+/// autoscaling_target_wait_ms | autoscaling adds connections while 95th percentile of acquire wait time exceeds this value | 5
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
+/// statement-batching.enabled | merge concurrent Cluster::Execute calls to standby hosts into pipelined batches | false
+/// statement-batching.max-batch-size | maximum number of statements in a single batch                     | 16
+/// statement-batching.max-concurrent-batches | maximum number of concurrently executed batches per host   | 4
+/// read-your-writes       | route the reads after a commit only to the hosts that have replayed it, see storages::postgres::GetReadYourWritesToken() | false
 
 // clang-format on
 
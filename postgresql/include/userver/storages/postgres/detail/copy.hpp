@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Encoded rows are sent to the server in chunks of about this size
+inline constexpr std::size_t kCopyChunkSize = 64 * 1024;
+
+/// Appends the encoded rows to the chunk, returns false when there are
+/// no more rows
+using CopyInChunkProducer = USERVER_NAMESPACE::utils::function_ref<bool(std::vector<char>& chunk)>;
+
+/// Receives a single encoded row of the binary COPY format
+using CopyOutRowConsumer = USERVER_NAMESPACE::utils::function_ref<void(io::FieldBuffer row)>;
+
+/// Appends a row in the binary COPY format: the number of fields followed
+/// by the fields in the same format as the binary query parameters
+template <typename Row>
+void WriteCopyRow(const UserTypes& types, std::vector<char>& buffer, const Row& row) {
+    using RowType = io::RowType<Row>;
+    io::WriteBuffer(types, buffer, static_cast<Smallint>(RowType::size));
+    std::apply(
+        [&types, &buffer](const auto&... fields) { (io::WriteRawBinary(types, buffer, fields), ...); },
+        RowType::GetTuple(row)
+    );
+}
+
+/// Parses a row in the binary COPY format
+template <typename Row>
+void ReadCopyRow(io::FieldBuffer buffer, Row& row, const io::TypeBufferCategory& categories) {
+    using RowType = io::RowType<Row>;
+    Smallint field_count{0};
+    buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+    if (field_count != static_cast<Smallint>(RowType::size)) {
+        throw InvalidTupleSizeRequested(field_count, RowType::size);
+    }
+
+    std::apply(
+        [&buffer, &categories](auto&... fields) {
+            (buffer.ReadRaw(fields, categories, io::traits::kTypeBufferCategory<std::decay_t<decltype(fields)>>), ...);
+        },
+        RowType::GetTuple(row)
+    );
+    if (buffer.length != 0) {
+        throw InvalidInputBufferSize(fmt::format("Unconsumed bytes in COPY row: {}", buffer.length));
+    }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
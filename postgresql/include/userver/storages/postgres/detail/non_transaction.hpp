@@ -7,6 +7,8 @@
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/streamed_result.hpp>
+#include <userver/storages/postgres/typed_query.hpp>
 
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
@@ -49,6 +51,20 @@ public:
         return DoExecute(query, detail::QueryParameters{params}, statement_cmd_ctl);
     }
 
+    /// Execute statement with parameters of compile time fixed types and
+    /// per-statement command control.
+    ///
+    /// Suspends coroutine for execution.
+    template <typename... Args>
+    ResultSet Execute(
+        OptionalCommandControl statement_cmd_ctl,
+        const TypedQuery<Args...>& query,
+        const detail::TypeIdentity<Args>&... args
+    ) {
+        const typename TypedQuery<Args...>::Parameters params{GetConnectionUserTypes(), args...};
+        return DoExecute(query.GetQuery(), detail::QueryParameters{params}, statement_cmd_ctl);
+    }
+
     /// Execute statement with stored arguments.
     ///
     /// Suspends coroutine for execution.
@@ -61,6 +77,18 @@ public:
     /// Suspends coroutine for execution.
     ResultSet
     Execute(OptionalCommandControl statement_cmd_ctl, const std::string& statement, const ParameterStore& store);
+
+    /// Execute statement with stored arguments passing the rows to the
+    /// consumer by chunks as they are received, returns the number of rows.
+    ///
+    /// Suspends coroutine for execution.
+    std::size_t ExecuteStreamed(
+        OptionalCommandControl statement_cmd_ctl,
+        const Query& query,
+        const ParameterStore& store,
+        ResultChunkConsumer consumer,
+        std::size_t chunk_size
+    );
     /// @}
 private:
     ResultSet
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/array_types.hpp>
+#include <userver/storages/postgres/io/nullable_traits.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+#include <userver/storages/postgres/io/type_mapping.hpp>
+
+#include <userver/storages/postgres/io/supported_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+template <typename T>
+struct TypeIdentityImpl {
+    using type = T;
+};
+
+/// Used to disable the template argument deduction from the parameters
+template <typename T>
+using TypeIdentity = typename TypeIdentityImpl<T>::type;
+
+/// Size of the parameter values buffer that does not require a heap allocation
+inline constexpr std::size_t kTypedQueryInlineBufferSize = 256;
+
+template <typename T>
+inline constexpr bool kIsTypedParamMappedToSystem = io::IsTypeMappedToSystem<T>() || io::IsTypeMappedToSystemArray<T>();
+
+/// @brief Query parameters with the types known in compile time.
+///
+/// In contrast to StaticQueryParameters all the values are written to a single
+/// buffer with inline storage, the parameter formats are a compile time
+/// constant and the type oids are obtained once per set of types, unless some
+/// of the types are mapped to user types.
+template <typename... Args>
+class TypedQueryParameters {
+public:
+    static constexpr std::size_t kSize = sizeof...(Args);
+    static constexpr bool kHasUserTypes = !(kIsTypedParamMappedToSystem<Args> && ...);
+
+    explicit TypedQueryParameters(const UserTypes& types, const Args&... args) {
+        if constexpr (kHasUserTypes) {
+            param_types_buffer_ = param_types_.data();
+        } else {
+            param_types_buffer_ = GetSystemTypes(types).data();
+        }
+        std::size_t index = 0;
+        (Write(index++, types, args), ...);
+
+        for (std::size_t i = 0; i < kSize; ++i) {
+            if (offsets_[i] == kNullOffset) {
+                param_buffers_[i] = nullptr;
+            } else if (param_lengths_[i] == 0) {
+                param_buffers_[i] = kEmptyBuffer;
+            } else {
+                param_buffers_[i] = buffer_.data() + offsets_[i];
+            }
+        }
+    }
+
+    TypedQueryParameters(const TypedQueryParameters&) = delete;
+    TypedQueryParameters(TypedQueryParameters&&) = delete;
+    TypedQueryParameters& operator=(const TypedQueryParameters&) = delete;
+    TypedQueryParameters& operator=(TypedQueryParameters&&) = delete;
+
+    std::size_t Size() const { return kSize; }
+    const char* const* ParamBuffers() const { return param_buffers_.data(); }
+    const Oid* ParamTypesBuffer() const { return param_types_buffer_; }
+    const int* ParamLengthsBuffer() const { return param_lengths_.data(); }
+    static const int* ParamFormatsBuffer() { return kParamFormats.data(); }
+
+    /// Size of the buffer with all the parameter values
+    std::size_t BufferSize() const { return buffer_.size(); }
+
+private:
+    using OidList = std::array<Oid, kSize>;
+    using IntList = std::array<int, kSize>;
+    using BufferType = boost::container::small_vector<char, kTypedQueryInlineBufferSize>;
+
+    static constexpr std::size_t kNullOffset = std::numeric_limits<std::size_t>::max();
+    static constexpr const char* kEmptyBuffer = "";
+    static constexpr IntList kParamFormats = [] {
+        IntList formats{};
+        for (auto& format : formats) format = io::kPgBinaryDataFormat;
+        return formats;
+    }();
+
+    static const OidList& GetSystemTypes(const UserTypes& types) {
+        // System type oids do not depend on the connection user types
+        static const OidList kTypes{io::CppToPg<Args>::GetOid(types)...};
+        return kTypes;
+    }
+
+    template <typename T>
+    void Write(std::size_t index, const UserTypes& types, const T& arg) {
+        static_assert(io::traits::kIsMappedToPg<T> || std::is_enum_v<T>, "Type doesn't have mapping to Postgres type.");
+        static_assert(
+            io::traits::kIsMappedToPg<T> || !std::is_enum_v<T>,
+            "Type doesn't have mapping to Postgres type. "
+            "Enums should be either streamed as their underlying value via the "
+            "`template<> struct CanUseEnumAsStrongTypedef<T>: std::true_type {};` "
+            "specialization or as a PostgreSQL datatype via the "
+            "`template<> struct CppToUserPg<T> : EnumMappingBase<R> { ... };` "
+            "specialization. "
+            "See page `uPg: Supported data types` for more information."
+        );
+        if constexpr (kHasUserTypes) {
+            param_types_[index] = io::CppToPg<T>::GetOid(types);
+        }
+        if constexpr (io::traits::kIsNullable<T>) {
+            if (io::traits::GetSetNull<T>::IsNull(arg)) {
+                offsets_[index] = kNullOffset;
+                param_lengths_[index] = io::kPgNullBufferSize;
+                return;
+            }
+        }
+        const auto offset = buffer_.size();
+        io::WriteBuffer(types, buffer_, arg);
+        offsets_[index] = offset;
+        param_lengths_[index] = buffer_.size() - offset;
+    }
+
+    BufferType buffer_;
+    std::array<std::size_t, kSize> offsets_{};
+    std::array<const char*, kSize> param_buffers_{};
+    IntList param_lengths_{};
+    // Filled only if there are user types, otherwise the type oids are shared
+    std::conditional_t<kHasUserTypes, OidList, std::array<Oid, 0>> param_types_{};
+    const Oid* param_types_buffer_{nullptr};
+};
+
+template <>
+class TypedQueryParameters<> : public StaticQueryParameters<0> {
+public:
+    explicit TypedQueryParameters(const UserTypes&) {}
+
+    static std::size_t BufferSize() { return 0; }
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
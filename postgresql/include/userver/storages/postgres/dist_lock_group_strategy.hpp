@@ -0,0 +1,39 @@
+#pragma once
+
+/// @file userver/storages/postgres/dist_lock_group_strategy.hpp
+/// @brief @copybrief storages::postgres::DistLockGroupStrategy
+
+#include <userver/dist_lock/dist_lock_group_strategy.hpp>
+#include <userver/dist_lock/dist_lock_settings.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Postgres distributed locking strategy for dist_lock::DistLockGroup
+///
+/// Acquires and prolongs a batch of locks with a single multi-row upsert into
+/// the same table as storages::postgres::DistLockStrategy uses.
+class DistLockGroupStrategy final : public dist_lock::DistLockGroupStrategyBase {
+public:
+    DistLockGroupStrategy(ClusterPtr cluster, const std::string& table, const dist_lock::DistLockSettings& settings);
+
+    std::vector<bool> AcquireMany(const std::vector<dist_lock::GroupLockRequest>& requests) override;
+
+    void Release(const std::string& lock_name, const std::string& locker_id) override;
+
+    void UpdateCommandControl(CommandControl cc);
+
+private:
+    ClusterPtr cluster_;
+    rcu::Variable<CommandControl> cc_;
+    const std::string acquire_query_;
+    const std::string release_query_;
+    const std::string owner_prefix_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
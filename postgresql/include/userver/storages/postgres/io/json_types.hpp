@@ -53,7 +53,14 @@ struct JsonFormatter : BufferFormatterBase<JsonValue> {
             buffer.push_back(kJsonbVersion);
         }
 
-        detail::JsonValueToBuffer(static_cast<const formats::json::Value&>(this->value), buffer);
+        const auto& value = static_cast<const formats::json::Value&>(this->value);
+        if constexpr (std::is_same_v<Buffer, std::vector<char>> || std::is_same_v<Buffer, std::string>) {
+            detail::JsonValueToBuffer(value, buffer);
+        } else {
+            std::string json;
+            detail::JsonValueToBuffer(value, json);
+            buffer.insert(buffer.end(), json.begin(), json.end());
+        }
     }
 };
 
@@ -16,6 +16,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::io {
 
+namespace detail {
+
+inline constexpr std::size_t kUuidSize = 16;
+
+void WriteUuidBytes(const boost::uuids::uuid& value, char* buffer);
+
+}  // namespace detail
+
 template <>
 struct BufferFormatter<boost::uuids::uuid> : detail::BufferFormatterBase<boost::uuids::uuid> {
     using BaseType = detail::BufferFormatterBase<boost::uuids::uuid>;
@@ -23,6 +31,13 @@ struct BufferFormatter<boost::uuids::uuid> : detail::BufferFormatterBase<boost::
 
     void operator()(const UserTypes&, std::vector<char>& buf) const;
     void operator()(const UserTypes&, std::string& buf) const;
+
+    template <typename Buffer>
+    void operator()(const UserTypes&, Buffer& buf) const {
+        const auto size = buf.size();
+        buf.resize(size + detail::kUuidSize);
+        detail::WriteUuidBytes(value, buf.data() + size);
+    }
 };
 
 template <>
@@ -3,6 +3,8 @@
 /// @file userver/storages/postgres/notify.hpp
 /// @brief Asynchronous notifications
 
+#include <memory>
+
 #include <userver/storages/postgres/options.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -11,7 +13,7 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::postgres {
 
 namespace detail {
-class ConnectionPtr;
+class NotificationSubscriber;
 }
 
 struct Notification {
@@ -22,8 +24,9 @@ struct Notification {
 /// @brief RAII scope for receiving notifications.
 ///
 /// Used for waiting for notifications on PostgreSQL connections. Created by
-/// calling storages::postgres::Cluster::Listen(). Exclusively holds a
-/// connection from a pool.
+/// calling storages::postgres::Cluster::Listen(). All the scopes of a host
+/// share a single connection from its pool, notifications are delivered to
+/// every scope that listens on the channel.
 ///
 /// Non-copyable.
 ///
@@ -36,7 +39,7 @@ struct Notification {
 /// @endcode
 class [[nodiscard]] NotifyScope final {
 public:
-    NotifyScope(detail::ConnectionPtr conn, std::string_view channel, OptionalCommandControl cmd_ctl);
+    explicit NotifyScope(std::unique_ptr<detail::NotificationSubscriber> subscriber);
 
     ~NotifyScope();
 
@@ -51,7 +54,7 @@ public:
 
 private:
     struct Impl;
-    USERVER_NAMESPACE::utils::FastPimpl<Impl, 80, 8> pimpl_;
+    USERVER_NAMESPACE::utils::FastPimpl<Impl, 8, 8> pimpl_;
 };
 
 }  // namespace storages::postgres
@@ -8,6 +8,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/congestion_control/controllers/linear.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
@@ -151,6 +152,9 @@ inline constexpr std::size_t kDefaultPoolMaxQueueSize = 200;
 /// Default limit for concurrent establishing connections number
 inline constexpr std::size_t kDefaultConnectingLimit = 0;
 
+/// Default acquire wait time the pool autoscaling keeps connections count for
+inline constexpr auto kDefaultAutoscalingTargetWait = std::chrono::milliseconds{5};
+
 /// @brief PostgreSQL topology options
 ///
 /// Dynamic option @ref POSTGRES_TOPOLOGY_SETTINGS
@@ -179,9 +183,18 @@ struct PoolSettings {
     /// Limits number of concurrent establishing connections (0 - unlimited)
     std::size_t connecting_limit{kDefaultConnectingLimit};
 
+    /// Scale the number of connections between min_size and max_size by the
+    /// acquire wait time, see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md
+    bool autoscaling_enabled{false};
+
+    /// Autoscaling opens new connections while the 95th percentile of acquire
+    /// wait time exceeds this value
+    std::chrono::milliseconds autoscaling_target_wait{kDefaultAutoscalingTargetWait};
+
     bool operator==(const PoolSettings& rhs) const {
         return min_size == rhs.min_size && max_size == rhs.max_size && max_queue_size == rhs.max_queue_size &&
-               connecting_limit == rhs.connecting_limit;
+               connecting_limit == rhs.connecting_limit && autoscaling_enabled == rhs.autoscaling_enabled &&
+               autoscaling_target_wait == rhs.autoscaling_target_wait;
     }
 };
 
@@ -249,11 +262,19 @@ struct ConnectionSettings {
     /// Execute discard all after establishing a new connection
     DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+    /// This many recently prepared statements of the pool are prepared on
+    /// every new connection in advance, 0 disables the warmup
+    std::size_t prepared_warmup_size = 0;
+
+    /// Statements to prepare on every new connection in advance
+    std::vector<std::string> warmup_statements{};
+
     /// Helps keep track of the changes in settings
     SettingsVersion version{0U};
 
     bool operator==(const ConnectionSettings& rhs) const {
-        return !RequiresConnectionReset(rhs) && recent_errors_threshold == rhs.recent_errors_threshold;
+        return !RequiresConnectionReset(rhs) && recent_errors_threshold == rhs.recent_errors_threshold &&
+               prepared_warmup_size == rhs.prepared_warmup_size && warmup_statements == rhs.warmup_statements;
     }
 
     bool operator!=(const ConnectionSettings& rhs) const { return !(*this == rhs); }
@@ -278,6 +299,26 @@ struct StatementMetricsSettings final {
     bool operator==(const StatementMetricsSettings& other) const { return max_statements == other.max_statements; }
 };
 
+/// Default maximum number of statements in a single batch
+inline constexpr std::size_t kDefaultStatementBatchMaxSize = 16;
+/// Default maximum number of batches executed concurrently on a host
+inline constexpr std::size_t kDefaultStatementBatchMaxConcurrency = 4;
+
+/// @brief Settings for merging single-statement queries into pipelined batches
+///
+/// Static option `statement-batching` of components::Postgres
+struct StatementBatchingSettings final {
+    /// Merge concurrent Cluster::Execute calls to standby hosts into batches
+    bool enabled{false};
+
+    /// Maximum number of statements sent in a single batch
+    std::size_t max_batch_size{kDefaultStatementBatchMaxSize};
+
+    /// Maximum number of batches executed concurrently on a host, the number
+    /// of connections used by the batched statements is limited by this value
+    std::size_t max_concurrent_batches{kDefaultStatementBatchMaxConcurrency};
+};
+
 /// Initialization modes
 enum class InitMode {
     kSync = 0,
@@ -314,6 +355,13 @@ struct ClusterSettings {
 
     /// congestion control settings
     congestion_control::v2::LinearController::StaticConfig cc_config;
+
+    /// settings for batching of single-statement queries
+    StatementBatchingSettings statement_batching_settings;
+
+    /// route the reads of a task that has committed a write transaction only
+    /// to the standbys that have already replayed that write
+    bool read_your_writes = false;
 };
 
 }  // namespace storages::postgres
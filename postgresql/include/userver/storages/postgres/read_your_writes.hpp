@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file userver/storages/postgres/read_your_writes.hpp
+/// @brief Propagation of the read-your-writes consistency between services
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Returns the commit positions of the write transactions of the
+/// current task and its parents, or an empty string if there were no writes.
+///
+/// With `read-your-writes` enabled in the static config of components::Postgres
+/// the commit LSN of each read-write transaction is remembered in the
+/// engine::TaskInheritedVariable of the current task, and the subsequent reads
+/// of the task and its subtasks are routed only to the standby hosts that have
+/// replayed that LSN, falling back to the master.
+///
+/// Pass the token to another service (e.g. in an HTTP header) and apply it
+/// there with SetReadYourWritesToken() to get the same guarantee for the reads
+/// of that service from the same database.
+std::string GetReadYourWritesToken();
+
+/// @brief Makes the reads of the current task and its subtasks see the writes
+/// described by the token obtained from GetReadYourWritesToken().
+///
+/// Malformed parts of the token are ignored.
+void SetReadYourWritesToken(std::string_view token);
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -237,9 +237,19 @@ public:
     size_type To(T&& val) const {
         using ValueType = typename std::decay<T>::type;
         auto fb = GetBuffer();
-        return ReadNullable(fb, std::forward<T>(val), io::traits::IsNullable<ValueType>{});
+        return ReadNullable(fb, GetTypeBufferCategories(), std::forward<T>(val), io::traits::IsNullable<ValueType>{});
     }
 
+    /// @cond
+    // Same as To() for the buffer fetched beforehand, used for the bulk
+    // decoding in TypedResultSet
+    template <typename T>
+    size_type To(const io::FieldBuffer& buffer, const io::TypeBufferCategory& categories, T&& val) const {
+        using ValueType = typename std::decay<T>::type;
+        return ReadNullable(buffer, categories, std::forward<T>(val), io::traits::IsNullable<ValueType>{});
+    }
+    /// @endcond
+
 private:
     io::FieldBuffer GetBuffer() const;
     std::string_view Name() const;
@@ -247,33 +257,43 @@ private:
     const io::TypeBufferCategory& GetTypeBufferCategories() const;
 
     template <typename T>
-    size_type ReadNullable(const io::FieldBuffer& fb, T&& val, std::true_type) const {
+    size_type ReadNullable(
+        const io::FieldBuffer& fb,
+        const io::TypeBufferCategory& categories,
+        T&& val,
+        std::true_type
+    ) const {
         using ValueType = typename std::decay<T>::type;
         using NullSetter = io::traits::GetSetNull<ValueType>;
         if (fb.is_null) {
             NullSetter::SetNull(val);
         } else {
-            Read(fb, std::forward<T>(val));
+            Read(fb, categories, std::forward<T>(val));
         }
         return fb.length;
     }
 
     template <typename T>
-    size_type ReadNullable(const io::FieldBuffer& buffer, T&& val, std::false_type) const {
+    size_type ReadNullable(
+        const io::FieldBuffer& buffer,
+        const io::TypeBufferCategory& categories,
+        T&& val,
+        std::false_type
+    ) const {
         if (buffer.is_null) {
             throw FieldValueIsNull{field_index_, Name(), val};
         } else {
-            Read(buffer, std::forward<T>(val));
+            Read(buffer, categories, std::forward<T>(val));
         }
         return buffer.length;
     }
 
     template <typename T>
-    void Read(const io::FieldBuffer& buffer, T&& val) const {
+    void Read(const io::FieldBuffer& buffer, const io::TypeBufferCategory& categories, T&& val) const {
         using ValueType = typename std::decay<T>::type;
         io::traits::CheckParser<ValueType>();
         try {
-            io::ReadBuffer(buffer, std::forward<T>(val), GetTypeBufferCategories());
+            io::ReadBuffer(buffer, std::forward<T>(val), categories);
         } catch (InvalidInputBufferSize& ex) {
             // InvalidInputBufferSize is not descriptive. Enriching with OID information and C++ types info
             ex.AddMsgPrefix(fmt::format(
@@ -322,6 +342,8 @@ public:
     size_type Length() const;
 
     /// Read the field's buffer into user-provided variable.
+    /// `std::string_view` and views of `bytea` reference the field's buffer
+    /// without copying and are valid as long as the result set is alive.
     /// @throws FieldValueIsNull If the field is null and the C++ type is
     ///                           not nullable.
     template <typename T>
@@ -599,6 +621,14 @@ private:
 ///   // Process row data
 /// }
 /// ```
+/// @brief Options of the parallel decoding of big result sets, see
+/// ResultSet::AsContainer
+struct ParallelDecoding final {
+    /// The rows are decoded in the chunks of this size by separate tasks of
+    /// the current task processor
+    std::size_t rows_per_task{100'000};
+};
+
 class ResultSet {
 public:
     using size_type = std::size_t;
@@ -692,6 +722,13 @@ public:
     template <typename Container>
     Container AsContainer(RowTag) const;
 
+    /// @brief Extract data into a container, decoding the row ranges in
+    /// parallel. Worth it for the huge result sets, e.g. for cache updates.
+    template <typename Container>
+    Container AsContainer(ParallelDecoding parallel) const;
+    template <typename Container>
+    Container AsContainer(RowTag, ParallelDecoding parallel) const;
+
     /// @brief Extract first row into user type.
     /// A single row result set is expected, will throw an exception when result
     /// set size != 1
@@ -718,6 +755,17 @@ private:
     void FillBufferCategories(const UserTypes& types);
     void SetBufferCategoriesFrom(const ResultSet&);
 
+    //@{
+    /** @name Bulk decoding for TypedResultSet */
+    /// @throws ResultSetError if any of the first `field_count` fields is in
+    /// the text format
+    void CheckBinaryFormat(size_type field_count) const;
+    /// Fills the buffers of the first `field_count` fields of the row without
+    /// the checks
+    void FetchRowBuffers(size_type row, io::FieldBuffer* buffers, size_type field_count) const;
+    const io::TypeBufferCategory& GetTypeBufferCategories() const;
+    //@}
+
     template <typename T, typename Tag>
     friend class TypedResultSet;
     friend class ConnectionImpl;
@@ -953,38 +1001,28 @@ template <typename Container>
 Container ResultSet::AsContainer() const {
     detail::AssertSaneTypeToDeserialize<Container>();
     using ValueType = typename Container::value_type;
-    Container c;
-    if constexpr (io::traits::kCanReserve<Container>) {
-        c.reserve(Size());
-    }
-    auto res = AsSetOf<ValueType>();
-
-    auto inserter = io::traits::Inserter(c);
-    auto row_it = res.begin();
-    for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
-        *inserter = *row_it;
-    }
-
-    return c;
+    return AsSetOf<ValueType>().template AsContainer<Container>();
 }
 
 template <typename Container>
 Container ResultSet::AsContainer(RowTag) const {
     detail::AssertSaneTypeToDeserialize<Container>();
     using ValueType = typename Container::value_type;
-    Container c;
-    if constexpr (io::traits::kCanReserve<Container>) {
-        c.reserve(Size());
-    }
-    auto res = AsSetOf<ValueType>(kRowTag);
+    return AsSetOf<ValueType>(kRowTag).template AsContainer<Container>();
+}
 
-    auto inserter = io::traits::Inserter(c);
-    auto row_it = res.begin();
-    for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
-        *inserter = *row_it;
-    }
+template <typename Container>
+Container ResultSet::AsContainer(ParallelDecoding parallel) const {
+    detail::AssertSaneTypeToDeserialize<Container>();
+    using ValueType = typename Container::value_type;
+    return AsSetOf<ValueType>().template AsContainer<Container>(parallel);
+}
 
-    return c;
+template <typename Container>
+Container ResultSet::AsContainer(RowTag, ParallelDecoding parallel) const {
+    detail::AssertSaneTypeToDeserialize<Container>();
+    using ValueType = typename Container::value_type;
+    return AsSetOf<ValueType>(kRowTag).template AsContainer<Container>(parallel);
 }
 
 template <typename T>
@@ -101,6 +101,16 @@ struct InstanceTopologyStatistics {
     MmaAccumulator replication_lag;
 };
 
+/// @brief Template latency-aware host selection statistics storage
+template <typename Counter>
+struct InstanceBalancingStatistics {
+    /// Number of times the instance was chosen by ClusterHostType::kFastest
+    Counter selected = 0;
+    /// Exponentially weighted moving average of query execution time, in
+    /// microseconds
+    Counter query_latency_ewma_us = 0;
+};
+
 /// @brief Template instance statistics storage
 template <typename Counter, typename PercentileAccumulator, typename MmaAccumulator>
 struct InstanceStatisticsTemplate {
@@ -110,6 +120,8 @@ struct InstanceStatisticsTemplate {
     TransactionStatistics<Counter, PercentileAccumulator> transaction;
     /// Topology statistics
     InstanceTopologyStatistics<MmaAccumulator> topology;
+    /// Latency-aware host selection statistics
+    InstanceBalancingStatistics<Counter> balancing;
     /// Error caused by pool exhaustion
     Counter pool_exhaust_errors = 0;
     /// Error caused by queue size overflow
@@ -188,6 +200,9 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
         topology.roundtrip_time = topology_stats.roundtrip_time.GetStatsForPeriod();
         topology.replication_lag = topology_stats.replication_lag.GetStatsForPeriod();
 
+        balancing.selected = stats.balancing.selected;
+        balancing.query_latency_ewma_us = stats.balancing.query_latency_ewma_us;
+
         pool_exhaust_errors = stats.pool_exhaust_errors;
         queue_size_errors = stats.queue_size_errors;
         connection_percentile = stats.connection_percentile.GetStatsForPeriod();
@@ -0,0 +1,26 @@
+#pragma once
+
+/// @file userver/storages/postgres/streamed_result.hpp
+/// @brief Definitions for receiving results of statements by chunks of rows
+
+#include <cstddef>
+
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// Default maximum number of rows in a chunk of a streamed result
+inline constexpr std::size_t kDefaultStreamedChunkSize = 1000;
+
+/// @brief Receives consecutive chunks of rows of a streamed result.
+///
+/// Each chunk is a separate ResultSet with the same fields, it may be kept
+/// after the call. Exception thrown from the consumer stops the execution.
+using ResultChunkConsumer = USERVER_NAMESPACE::utils::function_ref<void(ResultSet&& chunk)>;
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
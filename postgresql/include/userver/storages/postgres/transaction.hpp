@@ -3,10 +3,12 @@
 /// @file userver/storages/postgres/transaction.hpp
 /// @brief Transactions
 
+#include <functional>
 #include <memory>
 #include <string>
 
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/copy.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -15,6 +17,7 @@
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/typed_query.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -156,6 +159,10 @@ public:
     );
 
     void SetName(std::string name);
+
+    // Called with the connection right after a successful commit, must not
+    // throw
+    void SetAfterCommitHook(std::function<void(detail::Connection&)> hook);
     /// @endcond
 
     Transaction(Transaction&&) noexcept;
@@ -192,6 +199,28 @@ public:
         return DoExecute(query, detail::QueryParameters{params}, statement_cmd_ctl);
     }
 
+    /// Execute statement with parameters of compile time fixed types.
+    ///
+    /// Suspends coroutine for execution.
+    template <typename... Args>
+    ResultSet Execute(const TypedQuery<Args...>& query, const detail::TypeIdentity<Args>&... args) {
+        return Execute(OptionalCommandControl{}, query, args...);
+    }
+
+    /// Execute statement with parameters of compile time fixed types and
+    /// per-statement command control.
+    ///
+    /// Suspends coroutine for execution.
+    template <typename... Args>
+    ResultSet Execute(
+        OptionalCommandControl statement_cmd_ctl,
+        const TypedQuery<Args...>& query,
+        const detail::TypeIdentity<Args>&... args
+    ) {
+        const typename TypedQuery<Args...>::Parameters params{GetConnectionUserTypes(), args...};
+        return DoExecute(query.GetQuery(), detail::QueryParameters{params}, statement_cmd_ctl);
+    }
+
     /// Execute statement with stored parameters.
     ///
     /// Suspends coroutine for execution.
@@ -267,6 +296,46 @@ public:
         std::size_t chunk_rows = kDefaultRowsInChunk
     );
 
+    /// @brief Copy the rows of a container into a table with a
+    /// `COPY ... FROM STDIN (FORMAT binary)` statement.
+    ///
+    /// The rows are encoded with the same type mapping as the statement
+    /// parameters and are sent to the server in chunks as they are encoded,
+    /// without materializing a giant parameter array.
+    ///
+    /// @returns the number of copied rows
+    ///
+    /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+    template <typename Container>
+    std::size_t CopyIn(const Query& query, const Container& rows) {
+        return CopyIn(OptionalCommandControl{}, query, rows);
+    }
+
+    /// @brief Copy the rows of a container into a table with a
+    /// `COPY ... FROM STDIN (FORMAT binary)` statement and per-statement
+    /// command control.
+    template <typename Container>
+    std::size_t CopyIn(OptionalCommandControl statement_cmd_ctl, const Query& query, const Container& rows);
+
+    /// @brief Stream the rows of a `COPY ... TO STDOUT (FORMAT binary)`
+    /// statement to the handler, one `Row` at a time.
+    ///
+    /// The result set is never materialized as a whole. If the handler throws,
+    /// the connection is closed as the rest of the data can not be skipped.
+    ///
+    /// @returns the number of copied rows
+    ///
+    /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+    template <typename Row, typename Handler>
+    std::size_t CopyOut(const Query& query, Handler&& handler) {
+        return CopyOut<Row>(OptionalCommandControl{}, query, std::forward<Handler>(handler));
+    }
+
+    /// @brief Stream the rows of a `COPY ... TO STDOUT (FORMAT binary)`
+    /// statement to the handler with per-statement command control.
+    template <typename Row, typename Handler>
+    std::size_t CopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query, Handler&& handler);
+
     /// Create a portal for fetching results of a statement with arbitrary
     /// parameters.
     template <typename... Args>
@@ -324,10 +393,16 @@ private:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    std::size_t
+    DoCopyIn(const Query& query, detail::CopyInChunkProducer producer, OptionalCommandControl statement_cmd_ctl);
+    std::size_t
+    DoCopyOut(const Query& query, detail::CopyOutRowConsumer consumer, OptionalCommandControl statement_cmd_ctl);
+
     const UserTypes& GetConnectionUserTypes() const;
 
     std::string name_;
     detail::ConnectionPtr conn_;
+    std::function<void(detail::Connection&)> after_commit_hook_;
 };
 
 template <typename Container>
@@ -370,6 +445,39 @@ void Transaction::ExecuteDecomposeBulk(
     });
 }
 
+template <typename Container>
+std::size_t
+Transaction::CopyIn(OptionalCommandControl statement_cmd_ctl, const Query& query, const Container& rows) {
+    const auto& types = GetConnectionUserTypes();
+    auto it = std::begin(rows);
+    const auto end = std::end(rows);
+    return DoCopyIn(
+        query,
+        [&types, &it, &end](std::vector<char>& chunk) {
+            while (it != end && chunk.size() < detail::kCopyChunkSize) {
+                detail::WriteCopyRow(types, chunk, *it);
+                ++it;
+            }
+            return it != end;
+        },
+        std::move(statement_cmd_ctl)
+    );
+}
+
+template <typename Row, typename Handler>
+std::size_t Transaction::CopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query, Handler&& handler) {
+    const auto& categories = GetConnectionUserTypes().GetTypeBufferCategories();
+    return DoCopyOut(
+        query,
+        [&categories, &handler](io::FieldBuffer buffer) {
+            Row row{};
+            detail::ReadCopyRow(buffer, row, categories);
+            handler(std::move(row));
+        },
+        std::move(statement_cmd_ctl)
+    );
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
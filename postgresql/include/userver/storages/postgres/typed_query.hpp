@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/storages/postgres/typed_query.hpp
+/// @brief @copybrief storages::postgres::TypedQuery
+
+#include <utility>
+
+#include <userver/storages/postgres/detail/typed_query_parameters.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Query with the parameter types fixed at compile time.
+///
+/// Parameters of a TypedQuery are encoded into a single buffer with inline
+/// storage, so executing it with small parameters does not allocate. Parameter
+/// formats are compile time constants and the type oids of the built-in types
+/// are computed once per set of types.
+///
+/// Arguments passed to Execute are converted to the declared types.
+///
+/// @code
+/// const storages::postgres::TypedQuery<int, std::string> kSelectValue{
+///     storages::postgres::Query{"SELECT value FROM table WHERE id = $1 AND key = $2"}
+/// };
+/// auto res = cluster->Execute(ClusterHostType::kSlave, kSelectValue, 42, key);
+/// @endcode
+template <typename... Args>
+class TypedQuery {
+public:
+    using Parameters = detail::TypedQueryParameters<Args...>;
+
+    explicit TypedQuery(Query query) : query_{std::move(query)} {}
+
+    const Query& GetQuery() const noexcept { return query_; }
+
+    static constexpr std::size_t ParamsCount() noexcept { return sizeof...(Args); }
+
+private:
+    Query query_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
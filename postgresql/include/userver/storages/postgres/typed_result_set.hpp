@@ -3,8 +3,15 @@
 /// @file userver/storages/postgres/typed_result_set.hpp
 /// @brief Typed PostgreSQL results
 
+#include <algorithm>
+#include <array>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/storages/postgres/detail/typed_rows.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
@@ -140,6 +147,18 @@ namespace storages::postgres {
 ///
 /// @endcode
 ///
+/// @par Huge result sets
+///
+/// AsContainer resolves the columns once per result set, so it is faster than
+/// iterating over the rows. For the result sets of millions of rows, e.g. in
+/// caches, the decoding may be split between several tasks of the current
+/// task processor:
+///
+/// @code
+/// auto data = generic_result.AsContainer<std::vector<MyRowType>>(
+///     kRowTag, storages::postgres::ParallelDecoding{100'000});
+/// @endcode
+///
 ///
 /// ----------
 ///
@@ -210,14 +229,161 @@ public:
     // NOLINTNEXTLINE(readability-const-return-type)
     reference operator[](size_type) const&& { ReportMisuse(); }
     //@}
+
+    /// @brief Decode all the rows into a container.
+    ///
+    /// Unlike the iteration over the rows, the columns are checked and
+    /// resolved once per result set and the field buffers of a row are fetched
+    /// at once.
+    template <typename Container>
+    Container AsContainer() const;
+
+    /// @brief Decode all the rows into a container, the ranges of
+    /// ParallelDecoding::rows_per_task rows are decoded by separate tasks of
+    /// the current task processor.
+    template <typename Container>
+    Container AsContainer(ParallelDecoding parallel) const;
+
 private:
+    static constexpr std::size_t kFieldCount = [] {
+        if constexpr (std::is_same_v<ExtractionTag, RowTag>) {
+            return io::RowType<T>::size;
+        } else {
+            return std::size_t{1};
+        }
+    }();
+    using FieldBuffers = std::array<io::FieldBuffer, kFieldCount>;
+
     [[noreturn]] static void ReportMisuse() {
         static_assert(!sizeof(T), "keep the TypedResultSet before using, please");
     }
 
+    // Performs the checks of Row::To() once for all the rows
+    void CheckColumns() const;
+    void DecodeRows(size_type begin, size_type end, value_type* values) const;
+    void DecodeRow(size_type row, const io::TypeBufferCategory& categories, value_type& value) const;
+    template <typename Tuple, std::size_t... Indexes>
+    void DecodeFields(
+        size_type row,
+        const FieldBuffers& buffers,
+        const io::TypeBufferCategory& categories,
+        Tuple&& tuple,
+        std::index_sequence<Indexes...>
+    ) const;
+
     ResultSet result_;
 };
 
+template <typename T, typename ExtractionTag>
+template <typename Container>
+Container TypedResultSet<T, ExtractionTag>::AsContainer() const {
+    Container c;
+    if constexpr (io::traits::kCanReserve<Container>) {
+        c.reserve(Size());
+    }
+    if (IsEmpty()) return c;
+
+    CheckColumns();
+    const auto& categories = result_.GetTypeBufferCategories();
+    auto inserter = io::traits::Inserter(c);
+    for (size_type row = 0; row < Size(); ++row, ++inserter) {
+        value_type value{};
+        DecodeRow(row, categories, value);
+        *inserter = std::move(value);
+    }
+    return c;
+}
+
+template <typename T, typename ExtractionTag>
+template <typename Container>
+Container TypedResultSet<T, ExtractionTag>::AsContainer(ParallelDecoding parallel) const {
+    const auto size = Size();
+    if (parallel.rows_per_task == 0 || size <= parallel.rows_per_task) {
+        return AsContainer<Container>();
+    }
+
+    CheckColumns();
+    std::vector<value_type> values(size);
+    {
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve((size - 1) / parallel.rows_per_task + 1);
+        for (size_type begin = 0; begin < size; begin += parallel.rows_per_task) {
+            const auto end = std::min(size, begin + parallel.rows_per_task);
+            tasks.push_back(engine::AsyncNoSpan([this, begin, end, &values] { DecodeRows(begin, end, values.data()); })
+            );
+        }
+        engine::WaitAllChecked(tasks);
+    }
+
+    if constexpr (std::is_same_v<Container, std::vector<value_type>>) {
+        return values;
+    } else {
+        Container c;
+        if constexpr (io::traits::kCanReserve<Container>) {
+            c.reserve(size);
+        }
+        auto inserter = io::traits::Inserter(c);
+        for (auto& value : values) {
+            *inserter = std::move(value);
+            ++inserter;
+        }
+        return c;
+    }
+}
+
+template <typename T, typename ExtractionTag>
+void TypedResultSet<T, ExtractionTag>::CheckColumns() const {
+    const auto field_count = result_.FieldCount();
+    if (kFieldCount > field_count) {
+        throw InvalidTupleSizeRequested(field_count, kFieldCount);
+    }
+    if constexpr (std::is_same_v<ExtractionTag, RowTag>) {
+        if (kFieldCount < field_count) {
+            LOG_LIMITED_WARNING() << "Row size is greater that the number of data members in "
+                                     "C++ user datatype "
+                                  << compiler::GetTypeName<T>();
+        }
+    }
+    result_.CheckBinaryFormat(kFieldCount);
+}
+
+template <typename T, typename ExtractionTag>
+void TypedResultSet<T, ExtractionTag>::DecodeRows(size_type begin, size_type end, value_type* values) const {
+    const auto& categories = result_.GetTypeBufferCategories();
+    for (auto row = begin; row < end; ++row) {
+        DecodeRow(row, categories, values[row]);
+    }
+}
+
+template <typename T, typename ExtractionTag>
+void TypedResultSet<T, ExtractionTag>::DecodeRow(
+    size_type row,
+    const io::TypeBufferCategory& categories,
+    value_type& value
+) const {
+    FieldBuffers buffers;
+    result_.FetchRowBuffers(row, buffers.data(), kFieldCount);
+    if constexpr (std::is_same_v<ExtractionTag, RowTag>) {
+        DecodeFields(
+            row, buffers, categories, io::RowType<T>::GetTuple(value), std::make_index_sequence<kFieldCount>{}
+        );
+    } else {
+        FieldView{*result_.pimpl_, row, 0}.To(buffers[0], categories, value);
+    }
+}
+
+template <typename T, typename ExtractionTag>
+template <typename Tuple, std::size_t... Indexes>
+void TypedResultSet<T, ExtractionTag>::DecodeFields(
+    size_type row,
+    const FieldBuffers& buffers,
+    const io::TypeBufferCategory& categories,
+    Tuple&& tuple,
+    std::index_sequence<Indexes...>
+) const {
+    (FieldView{*result_.pimpl_, row, Indexes}.To(buffers[Indexes], categories, std::get<Indexes>(tuple)), ...);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
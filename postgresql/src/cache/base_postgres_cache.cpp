@@ -1,10 +1,42 @@
 #include <userver/cache/base_postgres_cache.hpp>
 
+#include <limits>
+
+#include <userver/utils/assert.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-namespace components::impl {
+namespace components {
+
+namespace pg_cache::detail {
+
+std::vector<KeyRange> SplitKeyRange(std::int64_t min, std::int64_t max, std::size_t count) {
+    UASSERT(min <= max);
+    UASSERT(count > 0);
+
+    // Unsigned arithmetic to avoid overflows on wide ranges
+    const auto span = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min);
+    const auto step = span / count + 1;
+
+    std::vector<KeyRange> ranges;
+    ranges.reserve(count);
+    auto lower = static_cast<std::uint64_t>(min);
+    for (std::size_t i = 0; i < count; ++i) {
+        const bool is_last = (i + 1 == count) || (static_cast<std::uint64_t>(max) - lower < step);
+        if (is_last) {
+            ranges.push_back({static_cast<std::int64_t>(lower), std::numeric_limits<std::int64_t>::max()});
+            break;
+        }
+        ranges.push_back({static_cast<std::int64_t>(lower), static_cast<std::int64_t>(lower + step - 1)});
+        lower += step;
+    }
+    return ranges;
+}
+
+}  // namespace pg_cache::detail
+
+namespace impl {
 
 std::string GetPostgreCacheSchema() {
     return R"(
@@ -28,6 +60,11 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    full-update-partitions:
+        type: integer
+        description: number of key ranges to fetch and parse in parallel on full update
+        defaultDescription: 1
+        minimum: 1
     pgcomponent:
         type: string
         description: PostgreSQL component name
@@ -35,6 +72,8 @@ properties:
 )";
 }
 
-}  // namespace components::impl
+}  // namespace impl
+
+}  // namespace components
 
 USERVER_NAMESPACE_END
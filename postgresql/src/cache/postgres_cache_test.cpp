@@ -2,8 +2,14 @@
 
 #include <userver/cache/base_postgres_cache.hpp>
 
+#include <cstdint>
+#include <limits>
+
 #include <boost/functional/hash.hpp>
+#include <gtest/gtest.h>
 
+#include <userver/cache/columnar_table.hpp>
+#include <userver/cache/persistent_hash_map.hpp>
 #include <userver/components/minimal_server_component_list.hpp>
 #include <userver/utils/projected_set.hpp>
 
@@ -277,6 +283,49 @@ struct PostgresExamplePolicy7 {
     using CacheContainer = utils::ProjectedUnorderedSet<ValueType, kKeyMember>;
 };
 
+// Tests PersistentHashMap as container
+struct PostgresExamplePolicy8 {
+    static constexpr std::string_view kName = "my-pg-cache";
+    using ValueType = MyStructure;
+    static constexpr auto kKeyMember = &MyStructure::id;
+    static constexpr const char* kQuery = "select id, bar, updated from test.my_data";
+    static constexpr const char* kUpdatedField = "updated";
+    using UpdatedFieldType = storages::postgres::TimePointTz;
+    using CacheContainer = cache::PersistentHashMap<int, MyStructure>;
+};
+
+/*! [Pg Cache Policy Partitioned Full Update Example] */
+struct PostgresExamplePolicy9 {
+    static constexpr std::string_view kName = "my-pg-cache";
+    using ValueType = MyStructure;
+    static constexpr auto kKeyMember = &MyStructure::id;
+    static constexpr const char* kQuery = "select id, bar, updated from test.my_data";
+    static constexpr const char* kUpdatedField = "updated";
+    using UpdatedFieldType = storages::postgres::TimePointTz;
+
+    // Integral column of the query to split the full update by, with the
+    // `full-update-partitions: 8` static option the [min(id), max(id)]
+    // range is fetched by 8 parallel queries. Rows with NULL in the column
+    // are skipped.
+    static constexpr const char* kFullUpdatePartitionField = "id";
+};
+/*! [Pg Cache Policy Partitioned Full Update Example] */
+
+/*! [Pg Cache Policy Columnar Container Example] */
+struct PostgresExamplePolicy10 {
+    static constexpr std::string_view kName = "my-pg-cache";
+    using ValueType = MyStructure;
+    static constexpr auto kKeyMember = &MyStructure::id;
+    static constexpr const char* kQuery = "select id, bar, updated from test.my_data";
+    static constexpr const char* kUpdatedField = "updated";
+    using UpdatedFieldType = storages::postgres::TimePointTz;
+
+    // Fields of MyStructure are stored in separate columns, `id` (the first
+    // field) is the key column
+    using CacheContainer = cache::ColumnarTable<MyStructure>;
+};
+/*! [Pg Cache Policy Columnar Container Example] */
+
 // Instantiation test
 using MyCache1 = PostgreCache<PostgresExamplePolicy>;
 using MyCache2 = PostgreCache<PostgresExamplePolicy2>;
@@ -286,6 +335,9 @@ using MyTrivialCache = PostgreCache<PostgresTrivialPolicy>;
 using MyCache5 = PostgreCache<PostgresExamplePolicy5>;
 using MyCache6 = PostgreCache<PostgresExamplePolicy6>;
 using MyCache7 = PostgreCache<PostgresExamplePolicy7>;
+using MyCache8 = PostgreCache<PostgresExamplePolicy8>;
+using MyCache9 = PostgreCache<PostgresExamplePolicy9>;
+using MyCache10 = PostgreCache<PostgresExamplePolicy10>;
 
 // NB: field access required for actual instantiation
 static_assert(MyCache1::kIncrementalUpdates);
@@ -295,6 +347,11 @@ static_assert(MyCache4::kIncrementalUpdates);
 static_assert(MyCache5::kIncrementalUpdates);
 static_assert(MyCache6::kIncrementalUpdates);
 static_assert(MyCache7::kIncrementalUpdates);
+static_assert(MyCache8::kIncrementalUpdates);
+static_assert(MyCache9::kIncrementalUpdates);
+static_assert(MyCache10::kIncrementalUpdates);
+static_assert(pg_cache::detail::kHasFullUpdatePartitionField<PostgresExamplePolicy9>);
+static_assert(!pg_cache::detail::kHasFullUpdatePartitionField<PostgresExamplePolicy8>);
 
 namespace pg = storages::postgres;
 static_assert(MyCache1::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
@@ -304,6 +361,8 @@ static_assert(MyCache4::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache5::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache6::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache7::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
+static_assert(MyCache8::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
+static_assert(MyCache9::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 
 // Update() instantiation test
 [[maybe_unused]] void
@@ -316,6 +375,32 @@ VerifyUpdateCompiles(const components::ComponentConfig& config, const components
     MyCache5 cache5{config, context};
     MyCache6 cache6{config, context};
     MyCache7 cache7{config, context};
+    MyCache8 cache8{config, context};
+    MyCache9 cache9{config, context};
+}
+
+TEST(PostgreCache, SplitKeyRange) {
+    using pg_cache::detail::SplitKeyRange;
+    constexpr auto kMax = std::numeric_limits<std::int64_t>::max();
+    constexpr auto kMin = std::numeric_limits<std::int64_t>::min();
+
+    const auto ranges = SplitKeyRange(1, 100, 4);
+    ASSERT_EQ(ranges.size(), 4);
+    EXPECT_EQ(ranges[0].lower, 1);
+    EXPECT_EQ(ranges[0].upper, 25);
+    EXPECT_EQ(ranges[1].lower, 26);
+    EXPECT_EQ(ranges[3].upper, kMax);
+
+    // Not splitting below a single key
+    EXPECT_EQ(SplitKeyRange(5, 6, 8).size(), 2);
+    EXPECT_EQ(SplitKeyRange(5, 5, 8).size(), 1);
+
+    const auto wide = SplitKeyRange(kMin, kMax, 3);
+    ASSERT_EQ(wide.size(), 3);
+    EXPECT_EQ(wide[0].lower, kMin);
+    EXPECT_EQ(wide[1].lower, wide[0].upper + 1);
+    EXPECT_EQ(wide[2].lower, wide[1].upper + 1);
+    EXPECT_EQ(wide[2].upper, kMax);
 }
 
 inline auto SampleOfComponentRegistration() {
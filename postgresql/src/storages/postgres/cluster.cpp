@@ -122,10 +122,52 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if (IsStatementBatchingEnabled(flags)) {
+        return ExecuteBatched(flags, statement_cmd_ctl, query, store);
+    }
     auto ntrx = Start(flags, statement_cmd_ctl);
     return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
+std::size_t Cluster::ExecuteStreamed(
+    ClusterHostTypeFlags flags,
+    const Query& query,
+    const ParameterStore& store,
+    ResultChunkConsumer consumer,
+    std::size_t chunk_size
+) {
+    return ExecuteStreamed(flags, OptionalCommandControl{}, query, store, consumer, chunk_size);
+}
+
+std::size_t Cluster::ExecuteStreamed(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    const ParameterStore& store,
+    ResultChunkConsumer consumer,
+    std::size_t chunk_size
+) {
+    if (!statement_cmd_ctl && query.GetName()) {
+        statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
+    }
+    statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    auto ntrx = Start(flags, statement_cmd_ctl);
+    return ntrx.ExecuteStreamed(statement_cmd_ctl, query, store, consumer, chunk_size);
+}
+
+bool Cluster::IsStatementBatchingEnabled(ClusterHostTypeFlags flags) const {
+    return pimpl_->IsStatementBatchingEnabled(flags);
+}
+
+ResultSet Cluster::ExecuteBatched(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    const ParameterStore& store
+) {
+    return pimpl_->ExecuteBatched(flags, statement_cmd_ctl, query, detail::QueryParameters{store.GetInternalData()});
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
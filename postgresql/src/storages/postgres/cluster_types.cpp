@@ -32,6 +32,8 @@ const char* ToStringRaw(ClusterHostType ht) {
             return "round-robin";
         case ClusterHostType::kNearest:
             return "nearest";
+        case ClusterHostType::kFastest:
+            return "fastest";
     }
     const auto msg = fmt::format("invalid host type {} in ToStringRaw", USERVER_NAMESPACE::utils::UnderlyingValue(ht));
     UASSERT_MSG(false, msg);
@@ -50,7 +52,8 @@ std::string ToString(ClusterHostTypeFlags flags) {
           ClusterHostType::kSyncSlave,
           ClusterHostType::kSlave,
           ClusterHostType::kRoundRobin,
-          ClusterHostType::kNearest}) {
+          ClusterHostType::kNearest,
+          ClusterHostType::kFastest}) {
         if (flags & role) {
             if (!result.empty()) result += '|';
             result += ToStringRaw(role);
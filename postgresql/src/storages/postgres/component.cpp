@@ -86,6 +86,16 @@ Postgres::Postgres(const ComponentConfig& config, const ComponentContext& contex
     initial_settings_.topology_settings.max_replication_lag =
         config["max_replication_lag"].As<std::chrono::milliseconds>(storages::postgres::kDefaultMaxReplicationLag);
 
+    const auto batching_config = config["statement-batching"];
+    auto& batching_settings = initial_settings_.statement_batching_settings;
+    batching_settings.enabled = batching_config["enabled"].As<bool>(false);
+    batching_settings.max_batch_size =
+        batching_config["max-batch-size"].As<std::size_t>(storages::postgres::kDefaultStatementBatchMaxSize);
+    batching_settings.max_concurrent_batches = batching_config["max-concurrent-batches"].As<std::size_t>(
+        storages::postgres::kDefaultStatementBatchMaxConcurrency
+    );
+    initial_settings_.read_your_writes = config["read-your-writes"].As<bool>(false);
+
     initial_settings_.pool_settings =
         pg_config.pool_settings.GetOptional(name_).value_or(config.As<storages::postgres::PoolSettings>());
     initial_settings_.conn_settings =
@@ -254,6 +264,18 @@ properties:
         type: boolean
         description: execute discard all on new connections
         defaultDescription: true
+    prepared-statements-warmup-size:
+        type: integer
+        minimum: 0
+        description: number of recently prepared statements of the pool to prepare on every new connection
+        defaultDescription: 0
+    warmup-statements:
+        type: array
+        description: statements to prepare on every new connection
+        defaultDescription: empty
+        items:
+            type: string
+            description: statement text
     monitoring-dbalias:
         type: string
         description: name of the database for monitorings
@@ -303,12 +325,48 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    autoscaling_enabled:
+        type: boolean
+        description: scale the number of connections between min_pool_size and max_pool_size by acquire wait time
+        defaultDescription: false
+    autoscaling_target_wait_ms:
+        type: integer
+        minimum: 0
+        description: autoscaling adds connections while 95th percentile of acquire wait time exceeds this value
+        defaultDescription: 5
     connlimit_mode:
         type: string
         enum:
          - auto
          - manual
         description: how to learn the `max_pool_size`
+    statement-batching:
+        type: object
+        description: |
+            merging of concurrent single-statement queries to standby hosts into
+            pipelined batches executed on a single connection
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: enable statement batching
+                defaultDescription: false
+            max-batch-size:
+                type: integer
+                minimum: 1
+                description: maximum number of statements in a single batch
+                defaultDescription: 16
+            max-concurrent-batches:
+                type: integer
+                minimum: 1
+                description: maximum number of concurrently executed batches per host
+                defaultDescription: 4
+    read-your-writes:
+        type: boolean
+        description: |
+            after a write transaction route the reads of the task and its
+            subtasks only to the hosts that have replayed the commit LSN
+        defaultDescription: false
 )");
 }
 
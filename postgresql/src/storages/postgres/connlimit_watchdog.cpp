@@ -1,5 +1,8 @@
 #include <storages/postgres/connlimit_watchdog.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include <storages/postgres/detail/cluster_impl.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/utils/from_string.hpp>
@@ -15,6 +18,27 @@ constexpr size_t kReservedConn = 5;
 
 constexpr int kMaxStepsWithError = 3;
 constexpr size_t kFallbackConnlimit = 20;
+
+// With the pool autoscaling the instances report the number of connections
+// they need instead of their connlimit. Each instance is guaranteed a fair
+// share of connections, and the instances that need more than that split the
+// unused part of the fair shares of the others.
+size_t CalculateAutoscalingConnlimit(size_t max_connections, const std::vector<int>& others_demand, size_t demand) {
+    const auto fair_share = std::max<size_t>(max_connections / (others_demand.size() + 1), 1);
+    if (demand < fair_share) return fair_share;
+
+    size_t unused = 0;
+    size_t busy_instances = 1;
+    for (const auto other_demand : others_demand) {
+        if (other_demand >= 0 && static_cast<size_t>(other_demand) < fair_share) {
+            unused += fair_share - other_demand;
+        } else {
+            ++busy_instances;
+        }
+    }
+    return fair_share + unused / busy_instances;
+}
+
 }  // namespace
 
 ConnlimitWatchdog::ConnlimitWatchdog(
@@ -78,22 +102,37 @@ void ConnlimitWatchdog::Step() {
         else
             max_connections = 1;
 
+        const auto demand = cluster_.GetConnectionsDemand();
         trx.Execute(
             "INSERT INTO u_clients (hostname, updated, max_connections) VALUES "
             "($1, "
             "NOW(), $2) ON CONFLICT (hostname) DO UPDATE SET updated = NOW(), "
             "max_connections = $2",
             kHostname,
-            static_cast<int>(GetConnlimit())
+            static_cast<int>(demand.value_or(GetConnlimit()))
         );
-        auto instances = trx.Execute(
-                                "SELECT count(*) FROM u_clients WHERE updated >= "
-                                "NOW() - make_interval(secs => 15)"
-        )
-                             .AsSingleRow<int>();
-        if (instances == 0) instances = 1;
-
-        auto connlimit = max_connections / instances;
+
+        size_t connlimit = 0;
+        size_t instances = 0;
+        if (demand) {
+            const auto others_demand = trx.Execute(
+                                              "SELECT max_connections FROM u_clients WHERE updated >= "
+                                              "NOW() - make_interval(secs => 15) AND hostname != $1",
+                                              kHostname
+            )
+                                           .AsContainer<std::vector<int>>();
+            instances = others_demand.size() + 1;
+            connlimit = CalculateAutoscalingConnlimit(max_connections, others_demand, *demand);
+        } else {
+            instances = trx.Execute(
+                               "SELECT count(*) FROM u_clients WHERE updated >= "
+                               "NOW() - make_interval(secs => 15)"
+            )
+                            .AsSingleRow<int>();
+            if (instances == 0) instances = 1;
+            connlimit = max_connections / instances;
+        }
+
         if (connlimit == 0) connlimit = 1;
         LOG((connlimit_ == connlimit) ? logging::Level::kDebug : logging::Level::kWarning)
             << "max_connections = " << max_connections << ", instances = " << instances
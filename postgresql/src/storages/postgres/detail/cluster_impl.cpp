@@ -1,14 +1,19 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
+#include <storages/postgres/detail/read_your_writes.hpp>
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
+#include <storages/postgres/io/pg_type_parsers.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -20,6 +25,23 @@ namespace storages::postgres::detail {
 
 namespace {
 
+// Versions before 10 use the old function names
+constexpr int kWalFunctionsRenameVersion = 100000;
+const Query kCurrentWalInsertLsn{"SELECT pg_current_wal_insert_lsn()"};
+const Query kCurrentXlogInsertLocation{"SELECT pg_current_xlog_insert_location()"};
+
+// COMMIT does not report the LSN of its record. The insert position right
+// after the commit is not less than that, so it is safe to wait for.
+void CaptureCommitLsn(const std::string& cluster_key, Connection& conn) noexcept {
+    try {
+        const auto& query =
+            conn.GetServerVersion() >= kWalFunctionsRenameVersion ? kCurrentWalInsertLsn : kCurrentXlogInsertLocation;
+        RememberCommitLsn(cluster_key, conn.Execute(query).AsSingleRow<Lsn>());
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to get the commit LSN, the subsequent reads may not see the write: " << e;
+    }
+}
+
 ClusterHostType Fallback(ClusterHostType ht) {
     switch (ht) {
         case ClusterHostType::kMaster:
@@ -31,15 +53,50 @@ ClusterHostType Fallback(ClusterHostType ht) {
         case ClusterHostType::kNone:
         case ClusterHostType::kRoundRobin:
         case ClusterHostType::kNearest:
+        case ClusterHostType::kFastest:
             throw ClusterError("Invalid ClusterHostType value for fallback " + ToString(ht));
     }
     UINVARIANT(false, "Unexpected cluster host type");
 }
 
+// Power of two choices: the better of two random hosts avoids both the slow
+// hosts and herding of all the clients on the currently best one
+size_t SelectFastestDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools
+) {
+    // Once in a while the worse host is chosen to refresh its latency estimate
+    constexpr std::size_t kExplorationRate = 64;
+
+    if (indices.size() == 1) {
+        UASSERT(indices.front() < host_pools.size());
+        host_pools[indices.front()]->AccountSelected();
+        return indices.front();
+    }
+
+    const auto first_pos = USERVER_NAMESPACE::utils::RandRange(indices.size());
+    auto second_pos = USERVER_NAMESPACE::utils::RandRange(indices.size() - 1);
+    if (second_pos >= first_pos) ++second_pos;
+
+    auto best = indices[first_pos];
+    auto other = indices[second_pos];
+    UASSERT(best < host_pools.size() && other < host_pools.size());
+    if (host_pools[other]->GetExpectedQueryLatency() < host_pools[best]->GetExpectedQueryLatency()) {
+        std::swap(best, other);
+    }
+    if (USERVER_NAMESPACE::utils::RandRange(kExplorationRate) == 0) {
+        std::swap(best, other);
+    }
+
+    host_pools[best]->AccountSelected();
+    return best;
+}
+
 size_t SelectDsnIndex(
     const topology::TopologyBase::DsnIndices& indices,
     ClusterHostTypeFlags flags,
-    std::atomic<uint32_t>& rr_host_idx
+    std::atomic<uint32_t>& rr_host_idx,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools
 ) {
     UASSERT(!indices.empty());
     if (indices.empty()) {
@@ -49,6 +106,10 @@ size_t SelectDsnIndex(
     const auto strategy_flags = flags & kClusterHostStrategyMask;
     LOG_TRACE() << "Applying " << strategy_flags << " strategy";
 
+    if (strategy_flags == ClusterHostType::kFastest) {
+        return SelectFastestDsnIndex(indices, host_pools);
+    }
+
     size_t idx_pos = 0;
     if (!strategy_flags || strategy_flags == ClusterHostType::kRoundRobin) {
         if (indices.size() != 1) {
@@ -81,7 +142,10 @@ ClusterImpl::ClusterImpl(
       bg_task_processor_(bg_task_processor),
       rr_host_idx_(0),
       config_source_(std::move(config_source)),
-      connlimit_watchdog_(*this, testsuite_tasks, shard_number, [this]() { OnConnlimitChanged(); }) {
+      connlimit_watchdog_(*this, testsuite_tasks, shard_number, [this]() { OnConnlimitChanged(); }),
+      statement_batching_settings_(cluster_settings.statement_batching_settings),
+      read_your_writes_(cluster_settings.read_your_writes),
+      read_your_writes_key_(MakeReadYourWritesKey(cluster_settings.db_name, shard_number)) {
     if (dsns.empty()) {
         throw ClusterError("Cannot create a cluster from an empty DSN list");
     } else if (dsns.size() == 1) {
@@ -135,6 +199,11 @@ ClusterImpl::ClusterImpl(
     }
     LOG_DEBUG() << "Pools initialized";
 
+    notification_hubs_.reserve(host_pools_.size());
+    for (const auto& pool : host_pools_) {
+        notification_hubs_.push_back(std::make_shared<NotificationHub>(pool));
+    }
+
     // Do not use IsConnlimitModeAuto() here because we don't care about
     // the current dynamic config value
     if (cluster_settings.connlimit_mode == ConnlimitMode::kAuto) {
@@ -145,7 +214,12 @@ ClusterImpl::ClusterImpl(
     }
 }
 
-ClusterImpl::~ClusterImpl() { connlimit_watchdog_.Stop(); }
+ClusterImpl::~ClusterImpl() {
+    for (const auto& hub : notification_hubs_) {
+        hub->Stop();
+    }
+    connlimit_watchdog_.Stop();
+}
 
 ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     auto cluster_stats = std::make_unique<ClusterStatistics>();
@@ -234,7 +308,19 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags)
         if (alive_dsn_indices->empty()) {
             throw ClusterUnavailable("None of cluster hosts are available");
         }
-        dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+        const auto* dsn_indices = &*alive_dsn_indices;
+        topology::TopologyBase::DsnIndices caught_up_indices;
+        const auto required_lsn = GetReadYourWritesLsn();
+        if (required_lsn != kUnknownLsn) {
+            // The master is always caught up, so the list is empty only if it is unavailable
+            caught_up_indices = topology_->FilterCaughtUp(*dsn_indices, required_lsn);
+            if (caught_up_indices.empty()) {
+                LOG_LIMITED_WARNING() << "No host has replayed the writes of the task, reading possibly stale data";
+            } else {
+                dsn_indices = &caught_up_indices;
+            }
+        }
+        dsn_index = SelectDsnIndex(*dsn_indices, flags, rr_host_idx_, host_pools_);
     } else {
         auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
         auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -252,8 +338,24 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags)
                 fmt::format("Pool for {} (requested: {}) is not available", ToString(host_role), ToString(role_flags))
             );
         }
+        const auto* dsn_indices = &dsn_indices_it->second;
+        topology::TopologyBase::DsnIndices caught_up_indices;
+        const auto required_lsn = GetReadYourWritesLsn();
+        if (host_role != ClusterHostType::kMaster && required_lsn != kUnknownLsn) {
+            caught_up_indices = topology_->FilterCaughtUp(*dsn_indices, required_lsn);
+            if (!caught_up_indices.empty()) {
+                dsn_indices = &caught_up_indices;
+            } else if (const auto master_it = dsn_indices_by_type->find(ClusterHostType::kMaster);
+                       master_it != dsn_indices_by_type->end() && !master_it->second.empty()) {
+                LOG_DEBUG() << "No " << host_role << " has replayed the writes of the task, falling back to master";
+                host_role = ClusterHostType::kMaster;
+                dsn_indices = &master_it->second;
+            } else {
+                LOG_LIMITED_WARNING() << "No host has replayed the writes of the task, reading possibly stale data";
+            }
+        }
         LOG_TRACE() << "Starting transaction on " << host_role;
-        dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+        dsn_index = SelectDsnIndex(*dsn_indices, flags, rr_host_idx_, host_pools_);
     }
 
     UASSERT(dsn_index < host_pools_.size());
@@ -274,7 +376,15 @@ ClusterImpl::Begin(ClusterHostTypeFlags flags, const TransactionOptions& options
         }
         flags = ClusterHostType::kMaster | flags.Clear(kClusterHostRolesMask);
     }
-    return FindPool(flags)->Begin(options, cmd_ctl);
+    auto trx = FindPool(flags)->Begin(options, cmd_ctl);
+    if (read_your_writes_ && !options.IsReadOnly()) {
+        trx.SetAfterCommitHook([&key = read_your_writes_key_](Connection& conn) { CaptureCommitLsn(key, conn); });
+    }
+    return trx;
+}
+
+Lsn ClusterImpl::GetReadYourWritesLsn() const {
+    return read_your_writes_ ? GetRequiredLsn(read_your_writes_key_) : kUnknownLsn;
 }
 
 NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags, OptionalCommandControl cmd_ctl) {
@@ -285,8 +395,32 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags, OptionalCommandCon
     return FindPool(flags)->Start(cmd_ctl);
 }
 
+bool ClusterImpl::IsStatementBatchingEnabled(ClusterHostTypeFlags flags) const {
+    // Only the statements to standbys are known to be read-only
+    const auto role_flags = flags & kClusterHostRolesMask;
+    return statement_batching_settings_.enabled && role_flags && !(role_flags & ClusterHostType::kMaster);
+}
+
+ResultSet ClusterImpl::ExecuteBatched(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl cmd_ctl,
+    const Query& query,
+    const QueryParameters& params
+) {
+    UASSERT(IsStatementBatchingEnabled(flags));
+    LOG_TRACE() << "Requested batched statement on " << flags;
+    return FindPool(flags)->ExecuteBatched(query, params, cmd_ctl, statement_batching_settings_);
+}
+
 NotifyScope ClusterImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
-    return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
+    return GetNotificationHub(FindPool(ClusterHostType::kMaster)).Listen(channel, cmd_ctl);
+}
+
+NotificationHub& ClusterImpl::GetNotificationHub(const ConnectionPoolPtr& pool) {
+    UASSERT(notification_hubs_.size() == host_pools_.size());
+    const auto it = std::find(host_pools_.begin(), host_pools_.end(), pool);
+    UINVARIANT(it != host_pools_.end(), "Notification hub is missing for the pool");
+    return *notification_hubs_[it - host_pools_.begin()];
 }
 
 QueryQueue ClusterImpl::CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout) {
@@ -339,6 +473,17 @@ void ClusterImpl::SetPoolSettings(const PoolSettings& new_settings) {
 
 void ClusterImpl::SetTopologySettings(const TopologySettings& settings) { topology_->SetTopologySettings(settings); }
 
+std::optional<std::size_t> ClusterImpl::GetConnectionsDemand() const {
+    const auto cluster_settings = cluster_settings_.Read();
+    if (!cluster_settings->pool_settings.autoscaling_enabled) return std::nullopt;
+
+    std::size_t demand = 0;
+    for (const auto& pool : host_pools_) {
+        demand = std::max(demand, pool->GetAutoscalingTarget());
+    }
+    return demand;
+}
+
 void ClusterImpl::OnConnlimitChanged() {
     auto max_size = connlimit_watchdog_.GetConnlimit();
     auto cluster = cluster_settings_.StartWrite();
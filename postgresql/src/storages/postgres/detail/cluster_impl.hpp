@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -12,6 +13,7 @@
 #include <userver/testsuite/tasks.hpp>
 
 #include <storages/postgres/connlimit_watchdog.hpp>
+#include <storages/postgres/detail/notification_hub.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
 #include <storages/postgres/detail/pool.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
@@ -51,6 +53,11 @@ public:
 
     NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+    bool IsStatementBatchingEnabled(ClusterHostTypeFlags) const;
+
+    ResultSet
+    ExecuteBatched(ClusterHostTypeFlags, OptionalCommandControl, const Query& query, const QueryParameters& params);
+
     NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
     QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout);
@@ -76,6 +83,10 @@ public:
 
     std::string GetDbName() const;
 
+    /// Connections count required by the pool autoscaling, the maximum across
+    /// the hosts. std::nullopt if the autoscaling is disabled.
+    std::optional<std::size_t> GetConnectionsDemand() const;
+
 private:
     void OnConnlimitChanged();
 
@@ -84,16 +95,24 @@ private:
     using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
     ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+    // The LSN of the writes of the current task that the read must see
+    Lsn GetReadYourWritesLsn() const;
+    NotificationHub& GetNotificationHub(const ConnectionPoolPtr& pool);
 
     DefaultCommandControls default_cmd_ctls_;
     rcu::Variable<ClusterSettings> cluster_settings_;
     std::unique_ptr<topology::TopologyBase> topology_;
     engine::TaskProcessor& bg_task_processor_;
     std::vector<ConnectionPoolPtr> host_pools_;
+    // One hub per host, share the connection among the listeners of the host
+    std::vector<std::shared_ptr<NotificationHub>> notification_hubs_;
     std::atomic<uint32_t> rr_host_idx_;
     dynamic_config::Source config_source_;
     ConnlimitWatchdog connlimit_watchdog_;
     std::atomic<bool> connlimit_mode_auto_enabled_;
+    const StatementBatchingSettings statement_batching_settings_;
+    const bool read_your_writes_;
+    const std::string read_your_writes_key_;
 };
 
 }  // namespace storages::postgres::detail
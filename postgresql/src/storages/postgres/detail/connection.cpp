@@ -136,6 +136,25 @@ std::vector<ResultSet> Connection::GatherPipeline(TimeoutDuration timeout, const
     return pimpl_->GatherPipeline(timeout, descriptions);
 }
 
+std::vector<ResultSet> Connection::GatherPipeline(
+    TimeoutDuration timeout,
+    const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>& errors
+) {
+    return pimpl_->GatherPipeline(timeout, descriptions, &errors);
+}
+
+std::size_t Connection::WarmUpPreparedStatements(
+    const std::vector<PreparedStatementTemplate>& statements,
+    TimeoutDuration timeout
+) {
+    return pimpl_->WarmUpPreparedStatements(statements, timeout);
+}
+
+std::vector<PreparedStatementTemplate> Connection::TakeNewPreparedStatements() {
+    return pimpl_->TakeNewPreparedStatements();
+}
+
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
     return Execute(query, detail::QueryParameters{store.GetInternalData()});
 }
@@ -162,6 +181,24 @@ ResultSet Connection::PortalExecute(
     return pimpl_->PortalExecute(statement_id, portal_name, n_rows, std::move(statement_cmd_ctl));
 }
 
+std::size_t Connection::CopyIn(const Query& query, CopyInChunkProducer producer, OptionalCommandControl cmd_ctl) {
+    return pimpl_->CopyIn(query, producer, std::move(cmd_ctl));
+}
+
+std::size_t Connection::CopyOut(const Query& query, CopyOutRowConsumer consumer, OptionalCommandControl cmd_ctl) {
+    return pimpl_->CopyOut(query, consumer, std::move(cmd_ctl));
+}
+
+std::size_t Connection::ExecuteStreamed(
+    const Query& query,
+    const QueryParameters& params,
+    std::size_t chunk_size,
+    ResultChunkConsumer consumer,
+    OptionalCommandControl cmd_ctl
+) {
+    return pimpl_->ExecuteStreamed(query, params, chunk_size, consumer, std::move(cmd_ctl));
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) { pimpl_->CancelAndCleanup(timeout); }
 
 bool Connection::Cleanup(TimeoutDuration timeout) { return pimpl_->Cleanup(timeout); }
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <string>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -13,6 +14,7 @@
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
+#include <userver/storages/postgres/detail/copy.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
@@ -20,8 +22,10 @@
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/streamed_result.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <storages/postgres/detail/size_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -230,6 +234,27 @@ public:
 
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
+    /// Like GatherPipeline, but a failed query does not stop reading the results
+    /// of the subsequent queries: its error is stored in `errors` and an empty
+    /// result set is returned in its place
+    std::vector<ResultSet> GatherPipeline(
+        TimeoutDuration timeout,
+        const std::vector<ResultSet>& descriptions,
+        std::vector<std::exception_ptr>& errors
+    );
+
+    /// Prepare the statements in advance, in a single round-trip if libpq
+    /// supports pipelining. Statements that fail to prepare are skipped.
+    /// Returns the number of newly prepared statements.
+    std::size_t WarmUpPreparedStatements(
+        const std::vector<PreparedStatementTemplate>& statements,
+        TimeoutDuration timeout
+    );
+
+    /// Statements prepared since the previous call, tracked only
+    /// if ConnectionSettings::prepared_warmup_size is not 0
+    std::vector<PreparedStatementTemplate> TakeNewPreparedStatements();
+
     template <typename... T>
     ResultSet Execute(const Query& query, const T&... args) {
         detail::StaticQueryParameters<sizeof...(args)> params;
@@ -256,6 +281,24 @@ public:
     );
     ResultSet PortalExecute(StatementId, const std::string& portal_name, std::uint32_t n_rows, OptionalCommandControl);
 
+    /// Run a `COPY ... FROM STDIN (FORMAT binary)` statement sending the data
+    /// supplied by the producer, returns the number of copied rows
+    std::size_t CopyIn(const Query& query, CopyInChunkProducer producer, OptionalCommandControl);
+
+    /// Run a `COPY ... TO STDOUT (FORMAT binary)` statement passing each row
+    /// to the consumer, returns the number of copied rows
+    std::size_t CopyOut(const Query& query, CopyOutRowConsumer consumer, OptionalCommandControl);
+
+    /// Execute a statement passing its rows to the consumer by chunks of at
+    /// most `chunk_size` rows as they are received, returns the number of rows
+    std::size_t ExecuteStreamed(
+        const Query& query,
+        const QueryParameters& params,
+        std::size_t chunk_size,
+        ResultChunkConsumer consumer,
+        OptionalCommandControl
+    );
+
     /// Send cancel to the database backend
     /// Try to return connection to idle state discarding all results.
     /// If there is a transaction in progress - roll it back.
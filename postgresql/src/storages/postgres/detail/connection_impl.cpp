@@ -5,6 +5,7 @@
 
 #include <string>
 #include <string_view>
+#include <utility>
 #include <userver/error_injection/hook.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/testpoint.hpp>
@@ -39,6 +40,12 @@ constexpr std::string_view kStatementVacuum = "vacuum";
 constexpr std::string_view kStatementListen = "listen {}";
 constexpr std::string_view kStatementUnlisten = "unlisten {}";
 
+// Signature, flags field and header extension length of the binary COPY format
+constexpr std::string_view kCopyBinarySignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr std::string_view kCopyBinaryHeader{"PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19};
+// Field count of -1 marks the end of the binary COPY data
+constexpr std::string_view kCopyBinaryTrailer{"\377\377", 2};
+
 const Query kSetConfigQuery{fmt::format("SELECT set_config($1, $2, $3) as {}", kSetConfigQueryResultName)};
 
 // we hope lc_messages is en_US, we don't control it anyway
@@ -52,6 +59,24 @@ std::size_t QueryHash(const std::string& statement, const QueryParameters& param
     return res;
 }
 
+// Returns the data that follows the binary COPY header
+std::string_view SkipCopyBinaryHeader(std::string_view data) {
+    constexpr std::size_t kFixedHeaderSize = kCopyBinarySignature.size() + 2 * sizeof(std::int32_t);
+    if (data.size() < kFixedHeaderSize || data.substr(0, kCopyBinarySignature.size()) != kCopyBinarySignature) {
+        throw LogicError{"COPY TO STDOUT data is not in the binary format, add (FORMAT binary) to the statement"};
+    }
+    std::uint32_t extension_size = 0;
+    for (std::size_t i = kFixedHeaderSize - sizeof(std::int32_t); i < kFixedHeaderSize; ++i) {
+        extension_size = (extension_size << 8) | static_cast<unsigned char>(data[i]);
+    }
+    data.remove_prefix(kFixedHeaderSize);
+    if (data.size() < extension_size) {
+        throw LogicError{"Truncated header of the binary COPY TO STDOUT data"};
+    }
+    data.remove_prefix(extension_size);
+    return data;
+}
+
 class CountExecute {
 public:
     CountExecute(Connection::Statistics& stats) : stats_(stats) {
@@ -68,8 +93,10 @@ public:
         stats_.last_execute_finish = now;
     }
 
-    void AccountResult(ResultSet& result) {
-        if (result.FieldCount()) ++stats_.reply_total;
+    void AccountResult(ResultSet& result) { AccountReply(result.FieldCount() != 0); }
+
+    void AccountReply(bool has_fields) {
+        if (has_fields) ++stats_.reply_total;
         completed_ = true;
     }
 
@@ -512,6 +539,204 @@ ResultSet ConnectionImpl::PortalExecute(
     );
 }
 
+std::size_t ConnectionImpl::CopyIn(const Query& query, CopyInChunkProducer producer, OptionalCommandControl cmd_ctl) {
+    CheckBusy();
+
+    // COPY is not allowed in the pipeline mode
+    auto pipeline_guard = std::optional<ScopeGuard>{};
+    if (IsPipelineActive()) {
+        conn_wrapper_.ExitPipelineMode();
+        pipeline_guard.emplace([this]() { conn_wrapper_.EnterPipelineMode(); });
+    }
+
+    auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(ExecuteTimeout(cmd_ctl));
+    SetStatementTimeout(std::move(cmd_ctl));
+
+    const auto& statement = query.Statement();
+    auto network_timeout = std::chrono::duration_cast<std::chrono::milliseconds>(deadline.TimeLeft());
+    CheckDeadlineReached(deadline);
+    auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime(scopes::kCopy);
+    CountExecute count_execute(stats_);
+
+    try {
+        conn_wrapper_.SendQuery(statement, scope);
+        conn_wrapper_.WaitCopyStart(deadline, scope, PGRES_COPY_IN);
+
+        std::vector<char> chunk;
+        chunk.reserve(kCopyChunkSize);
+        chunk.insert(chunk.end(), kCopyBinaryHeader.begin(), kCopyBinaryHeader.end());
+        for (bool has_more = true; has_more;) {
+            try {
+                has_more = producer(chunk);
+            } catch (const std::exception& e) {
+                // Make the server fail the COPY, so the connection stays usable
+                conn_wrapper_.PutCopyEnd(deadline, e.what());
+                try {
+                    conn_wrapper_.WaitResult(deadline, scope, nullptr);
+                } catch (const Error&) {
+                    // the server reports the error passed to PutCopyEnd
+                }
+                throw;
+            }
+            if (!has_more) {
+                chunk.insert(chunk.end(), kCopyBinaryTrailer.begin(), kCopyBinaryTrailer.end());
+            }
+            if (!chunk.empty()) {
+                conn_wrapper_.PutCopyData({chunk.data(), chunk.size()}, deadline, scope);
+                chunk.clear();
+            }
+        }
+        conn_wrapper_.PutCopyEnd(deadline);
+    } catch (const ConnectionTimeoutError& e) {
+        ++stats_.execute_timeout;
+        LOG_LIMITED_WARNING() << "Statement `" << statement << "` network timeout error: " << e << ". "
+                              << "Network timeout was " << network_timeout.count() << "ms";
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    }
+
+    return WaitResult(statement, deadline, network_timeout, count_execute, span, scope, nullptr).RowsAffected();
+}
+
+std::size_t ConnectionImpl::CopyOut(const Query& query, CopyOutRowConsumer consumer, OptionalCommandControl cmd_ctl) {
+    CheckBusy();
+
+    // COPY is not allowed in the pipeline mode
+    auto pipeline_guard = std::optional<ScopeGuard>{};
+    if (IsPipelineActive()) {
+        conn_wrapper_.ExitPipelineMode();
+        pipeline_guard.emplace([this]() { conn_wrapper_.EnterPipelineMode(); });
+    }
+
+    auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(ExecuteTimeout(cmd_ctl));
+    SetStatementTimeout(std::move(cmd_ctl));
+
+    const auto& statement = query.Statement();
+    auto network_timeout = std::chrono::duration_cast<std::chrono::milliseconds>(deadline.TimeLeft());
+    CheckDeadlineReached(deadline);
+    auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime(scopes::kCopy);
+    CountExecute count_execute(stats_);
+
+    conn_wrapper_.SendQuery(statement, scope);
+    try {
+        conn_wrapper_.WaitCopyStart(deadline, scope, PGRES_COPY_OUT);
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    }
+
+    try {
+        bool is_header_read = false;
+        bool is_trailer_read = false;
+        while (auto data = conn_wrapper_.GetCopyData(deadline, scope)) {
+            std::string_view message{data.buffer.get(), data.size};
+            if (!is_header_read) {
+                message = SkipCopyBinaryHeader(message);
+                is_header_read = true;
+            }
+            if (message.empty() || is_trailer_read) continue;
+            if (message == kCopyBinaryTrailer) {
+                is_trailer_read = true;
+                continue;
+            }
+            io::FieldBuffer row;
+            row.length = message.size();
+            row.buffer = reinterpret_cast<const std::uint8_t*>(message.data());
+            consumer(row);
+        }
+    } catch (const ConnectionTimeoutError& e) {
+        ++stats_.execute_timeout;
+        LOG_LIMITED_WARNING() << "Statement `" << statement << "` network timeout error: " << e << ". "
+                              << "Network timeout was " << network_timeout.count() << "ms";
+        span.AddTag(tracing::kErrorFlag, true);
+        conn_wrapper_.MarkAsBroken();
+        throw;
+    } catch (const std::exception&) {
+        // The rest of the COPY data can not be skipped without reading it
+        span.AddTag(tracing::kErrorFlag, true);
+        conn_wrapper_.MarkAsBroken();
+        throw;
+    }
+
+    return WaitResult(statement, deadline, network_timeout, count_execute, span, scope, nullptr).RowsAffected();
+}
+
+std::size_t ConnectionImpl::ExecuteStreamed(
+    const Query& query,
+    const QueryParameters& params,
+    std::size_t chunk_size,
+    ResultChunkConsumer consumer,
+    OptionalCommandControl cmd_ctl
+) {
+    UINVARIANT(chunk_size > 0, "Chunk size of a streamed result must be positive");
+    CheckBusy();
+
+    // The rows are read as they arrive, without waiting for the pipeline sync
+    auto pipeline_guard = std::optional<ScopeGuard>{};
+    if (IsPipelineActive()) {
+        conn_wrapper_.ExitPipelineMode();
+        pipeline_guard.emplace([this]() { conn_wrapper_.EnterPipelineMode(); });
+    }
+
+    auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(ExecuteTimeout(cmd_ctl));
+    SetStatementTimeout(std::move(cmd_ctl));
+
+    const auto& statement = query.Statement();
+    auto network_timeout = std::chrono::duration_cast<std::chrono::milliseconds>(deadline.TimeLeft());
+    CheckDeadlineReached(deadline);
+    auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime(scopes::kExec);
+    CountExecute count_execute(stats_);
+
+    conn_wrapper_.SendQuery(statement, params, scope);
+    conn_wrapper_.SetChunkedRowsMode(chunk_size);
+
+    std::size_t rows_count = 0;
+    // Buffer categories are the same for all the chunks
+    std::optional<ResultSet> description;
+    while (true) {
+        std::optional<ResultSet> chunk;
+        try {
+            chunk = conn_wrapper_.WaitRowsChunk(deadline, scope);
+        } catch (const ConnectionTimeoutError& e) {
+            ++stats_.execute_timeout;
+            LOG_LIMITED_WARNING() << "Statement `" << statement << "` network timeout error: " << e << ". "
+                                  << "Network timeout was " << network_timeout.count() << "ms";
+            span.AddTag(tracing::kErrorFlag, true);
+            throw;
+        } catch (const std::exception&) {
+            span.AddTag(tracing::kErrorFlag, true);
+            throw;
+        }
+        if (!chunk) break;
+
+        if (description) {
+            chunk->SetBufferCategoriesFrom(*description);
+        } else {
+            FillBufferCategories(*chunk);
+            description = *chunk;
+        }
+        rows_count += chunk->Size();
+
+        try {
+            consumer(std::move(*chunk));
+        } catch (const std::exception&) {
+            // The rest of the rows can not be skipped without reading them
+            span.AddTag(tracing::kErrorFlag, true);
+            conn_wrapper_.MarkAsBroken();
+            throw;
+        }
+    }
+
+    count_execute.AccountReply(description.has_value());
+    return rows_count;
+}
+
 void ConnectionImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     ExecuteCommandNoPrepare(
         fmt::format(kStatementListen, conn_wrapper_.EscapeIdentifier(channel)),
@@ -780,6 +1005,10 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
     if (!statement_info) {
         prepared_.Put(query_id, {query_id, statement, statement_name, std::move(res)});
         statement_info = prepared_.Get(query_id);
+        if (settings_.prepared_warmup_size > 0) {
+            const auto* types = params.ParamTypesBuffer();
+            new_prepared_.push_back({statement, std::vector<Oid>(types, types + params.Size())});
+        }
     } else {
         statement_info->description = std::move(res);
     }
@@ -881,8 +1110,11 @@ void ConnectionImpl::AddIntoPipeline(
     conn_wrapper_.PutPipelineSync();
 }
 
-std::vector<ResultSet>
-ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+std::vector<ResultSet> ConnectionImpl::GatherPipeline(
+    TimeoutDuration timeout,
+    const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>* errors
+) {
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
     CheckDeadlineReached(deadline);
 
@@ -893,15 +1125,153 @@ ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<Result
         }
     }
 
-    auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+    auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions, errors);
 
-    for (auto& single_result : result) {
-        FillBufferCategories(single_result);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        if (errors && (*errors)[i]) continue;
+        FillBufferCategories(result[i]);
     }
 
     return result;
 }
 
+std::size_t ConnectionImpl::WarmUpPreparedStatements(
+    const std::vector<PreparedStatementTemplate>& statements,
+    TimeoutDuration timeout
+) {
+    if (statements.empty() || !ArePreparedStatementsEnabled() || IsInTransaction()) return 0;
+
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
+    CheckDeadlineReached(deadline);
+    DiscardOldPreparedStatements(deadline);
+
+    tracing::Span span{scopes::kPrepare};
+    conn_wrapper_.FillSpanTags(span, {timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+
+    struct PendingStatement {
+        const PreparedStatementTemplate* statement_template;
+        std::string statement_name;
+    };
+    std::vector<PendingStatement> pending;
+    std::unordered_set<std::string> pending_names;
+    for (const auto& statement_template : statements) {
+        if (prepared_.GetSize() + pending.size() >= settings_.max_prepared_cache_size) break;
+
+        const QueryParameters params{statement_template};
+        const auto query_hash = QueryHash(statement_template.statement, params);
+        if (prepared_.Get(Connection::StatementId{query_hash})) continue;
+
+        auto statement_name = "q" + std::to_string(query_hash) + "_" + uuid_;
+        if (pending_names.insert(statement_name).second) {
+            pending.push_back({&statement_template, std::move(statement_name)});
+        }
+    }
+    if (pending.empty()) return 0;
+
+    std::vector<ResultSet> descriptions;
+    descriptions.reserve(pending.size());
+#if LIBPQ_HAS_PIPELINING
+    std::optional<ScopeGuard> pipeline_guard;
+    if (!IsPipelineActive()) {
+        conn_wrapper_.EnterPipelineMode();
+        pipeline_guard.emplace([this]() { conn_wrapper_.ExitPipelineMode(); });
+    }
+
+    // Each statement is in a separate pipeline segment, so that a failed one
+    // doesn't abort the others
+    for (const auto& [statement_template, statement_name] : pending) {
+        const QueryParameters params{*statement_template};
+        conn_wrapper_.SendPrepare(statement_name, statement_template->statement, params, scope);
+        conn_wrapper_.SendDescribePrepared(statement_name, scope);
+        conn_wrapper_.PutPipelineSync();
+    }
+
+    std::vector<std::exception_ptr> errors;
+    auto results =
+        conn_wrapper_.GatherPipeline(deadline, std::vector<const PGresult*>(pending.size() * 2, nullptr), &errors);
+
+    // A failed Parse aborts the rest of its segment, so there is a single
+    // error result for such statement instead of Parse and Describe results
+    std::size_t pos = 0;
+    for (const auto& [statement_template, statement_name] : pending) {
+        if (pos < results.size() && errors[pos]) {
+            try {
+                std::rethrow_exception(errors[pos]);
+            } catch (const Error& e) {
+                LOG_WARNING() << "Failed to warm up prepared statement `" << statement_template->statement
+                              << "`: " << e;
+            }
+            descriptions.emplace_back(nullptr);
+            pos += 1;
+        } else if (pos + 1 < results.size() && !errors[pos + 1]) {
+            descriptions.push_back(std::move(results[pos + 1]));
+            pos += 2;
+        } else {
+            break;
+        }
+    }
+    if (pos != results.size()) {
+        // Can't match the results to the statements, any of them
+        // will be described again on the first use
+        LOG_WARNING() << "Unexpected " << results.size() << " results for the warmup of " << pending.size()
+                      << " prepared statements";
+        return 0;
+    }
+#else
+    for (const auto& [statement_template, statement_name] : pending) {
+        try {
+            const QueryParameters params{*statement_template};
+            conn_wrapper_.SendPrepare(statement_name, statement_template->statement, params, scope);
+            conn_wrapper_.WaitResult(deadline, scope, nullptr);
+            conn_wrapper_.SendDescribePrepared(statement_name, scope);
+            descriptions.push_back(conn_wrapper_.WaitResult(deadline, scope, nullptr));
+        } catch (const ConnectionError&) {
+            throw;
+        } catch (const Error& e) {
+            LOG_WARNING() << "Failed to warm up prepared statement: " << e;
+            descriptions.emplace_back(nullptr);
+        }
+    }
+#endif
+
+    std::size_t prepared_count = 0;
+    for (std::size_t i = 0; i < descriptions.size(); ++i) {
+        auto& res = descriptions[i];
+        if (!res.pimpl_) continue;
+        const auto& [statement_template, statement_name] = pending[i];
+
+        try {
+            FillBufferCategories(res);
+            res.GetRowDescription().CheckBinaryFormat(db_types_);
+        } catch (const Error& e) {
+            LOG_WARNING() << "Skipping the warmup of statement `" << statement_template->statement << "`: " << e;
+            continue;
+        }
+
+        // Executions with the types inferred by the server hit the cache
+        PreparedStatementTemplate described{statement_template->statement, statement_template->param_types};
+        if (described.param_types.empty()) {
+            for (std::size_t param = 0; param < res.pimpl_->ParamCount(); ++param) {
+                described.param_types.push_back(res.pimpl_->GetParamTypeOid(param));
+            }
+        }
+        const Connection::StatementId query_id{QueryHash(described.statement, QueryParameters{described})};
+        if (prepared_.Get(query_id)) continue;
+
+        prepared_.Put(query_id, {query_id, described.statement, statement_name, std::move(res)});
+        ++prepared_count;
+    }
+    stats_.parse_total += static_cast<Connection::Statistics::Counter>(descriptions.size());
+
+    LOG_DEBUG() << "Warmed up " << prepared_count << " prepared statements out of " << statements.size();
+    return prepared_count;
+}
+
+std::vector<PreparedStatementTemplate> ConnectionImpl::TakeNewPreparedStatements() {
+    return std::exchange(new_prepared_, {});
+}
+
 ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query, engine::Deadline deadline) {
     static const QueryParameters kNoParams;
     return ExecuteCommandNoPrepare(query, kNoParams, deadline);
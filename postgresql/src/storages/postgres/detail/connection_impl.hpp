@@ -20,6 +20,7 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -89,7 +90,17 @@ public:
         const ResultSet& description,
         tracing::ScopeTime& scope
     );
-    std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+    std::vector<ResultSet> GatherPipeline(
+        TimeoutDuration timeout,
+        const std::vector<ResultSet>& descriptions,
+        std::vector<std::exception_ptr>* errors = nullptr
+    );
+
+    std::size_t WarmUpPreparedStatements(
+        const std::vector<PreparedStatementTemplate>& statements,
+        TimeoutDuration timeout
+    );
+    std::vector<PreparedStatementTemplate> TakeNewPreparedStatements();
 
     void Begin(
         const TransactionOptions& options,
@@ -116,6 +127,17 @@ public:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    std::size_t CopyIn(const Query& query, CopyInChunkProducer producer, OptionalCommandControl cmd_ctl);
+    std::size_t CopyOut(const Query& query, CopyOutRowConsumer consumer, OptionalCommandControl cmd_ctl);
+
+    std::size_t ExecuteStreamed(
+        const Query& query,
+        const QueryParameters& params,
+        std::size_t chunk_size,
+        ResultChunkConsumer consumer,
+        OptionalCommandControl cmd_ctl
+    );
+
     void Listen(std::string_view channel, OptionalCommandControl);
     void Unlisten(std::string_view channel, OptionalCommandControl);
     Notification WaitNotify(engine::Deadline deadline);
@@ -208,6 +230,8 @@ private:
     Connection::Statistics stats_;
     PGConnectionWrapper conn_wrapper_;
     PreparedStatements prepared_;
+    // Statements prepared since the last TakeNewPreparedStatements call
+    std::vector<PreparedStatementTemplate> new_prepared_;
     UserTypes db_types_;
     bool is_in_recovery_ = true;
     bool is_read_only_ = true;
@@ -65,6 +65,26 @@ ResultSet NonTransaction::DoExecute(
     }
 }
 
+std::size_t NonTransaction::ExecuteStreamed(
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    const ParameterStore& store,
+    ResultChunkConsumer consumer,
+    std::size_t chunk_size
+) {
+    StatementStats stats{query, conn_};
+    try {
+        const auto rows_count = conn_->ExecuteStreamed(
+            query, detail::QueryParameters{store.GetInternalData()}, chunk_size, consumer, statement_cmd_ctl
+        );
+        stats.AccountStatementExecution();
+        return rows_count;
+    } catch (const std::exception& e) {
+        stats.AccountStatementError();
+        throw;
+    }
+}
+
 const UserTypes& NonTransaction::GetConnectionUserTypes() const { return conn_->GetUserTypes(); }
 
 }  // namespace storages::postgres::detail
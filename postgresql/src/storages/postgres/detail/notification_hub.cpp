@@ -0,0 +1,198 @@
+#include <storages/postgres/detail/notification_hub.hpp>
+
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// New subscriptions are listened not later than the poll interval
+constexpr std::chrono::milliseconds kNotifyPollInterval{50};
+constexpr std::chrono::seconds kAcquireTimeout{1};
+constexpr std::chrono::milliseconds kReconnectInterval{100};
+
+}  // namespace
+
+NotificationSubscriber::NotificationSubscriber(std::shared_ptr<NotificationHub> hub, std::string_view channel)
+    : hub_{std::move(hub)}, channel_{channel}, subscription_{hub_->Subscribe(*this)} {}
+
+NotificationSubscriber::~NotificationSubscriber() {
+    subscription_.Unsubscribe();
+    hub_->Unsubscribe(channel_);
+}
+
+Notification NotificationSubscriber::WaitNotify(engine::Deadline deadline) {
+    std::unique_lock lock{mutex_};
+    if (!queue_cv_.WaitUntil(lock, deadline, [this] { return !queue_.empty(); })) {
+        throw ConnectionTimeoutError{"No notifications received in WaitNotify"};
+    }
+    auto notification = std::move(queue_.front());
+    queue_.pop_front();
+    return notification;
+}
+
+void NotificationSubscriber::OnNotification(const Notification& notification) {
+    {
+        std::lock_guard lock{mutex_};
+        queue_.push_back(notification);
+    }
+    queue_cv_.NotifyOne();
+}
+
+NotificationHub::ChannelData::ChannelData(std::string_view channel)
+    : event_channel{fmt::format("pg_notify_{}", channel)} {}
+
+NotificationHub::NotificationHub(std::shared_ptr<ConnectionPool> pool) : pool_{std::move(pool)} { UASSERT(pool_); }
+
+NotificationHub::~NotificationHub() { Stop(); }
+
+NotifyScope NotificationHub::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
+    auto subscriber = std::make_unique<NotificationSubscriber>(shared_from_this(), channel);
+    const auto deadline = engine::Deadline::FromDuration(
+        cmd_ctl ? cmd_ctl->execute : pool_->GetDefaultCommandControl().execute
+    );
+
+    std::unique_lock lock{mutex_};
+    if (!task_.IsValid()) {
+        task_ = engine::CriticalAsyncNoSpan([this] { Run(); });
+    }
+    channels_changed_.Send();
+
+    const auto& data = *channels_.at(std::string{channel});
+    const bool is_listening = listening_cv_.WaitUntil(lock, deadline, [&data] { return data.is_listening; });
+    lock.unlock();
+
+    if (!is_listening) {
+        throw ConnectionTimeoutError{fmt::format("Timed out while starting to listen on channel '{}'", channel)};
+    }
+    LOG_DEBUG() << "Start listening on channel '" << channel << "'";
+    return NotifyScope{std::move(subscriber)};
+}
+
+void NotificationHub::Stop() {
+    {
+        std::lock_guard lock{mutex_};
+        is_stopped_ = true;
+    }
+    if (task_.IsValid()) task_.SyncCancel();
+}
+
+concurrent::AsyncEventSubscriberScope NotificationHub::Subscribe(NotificationSubscriber& subscriber) {
+    std::lock_guard lock{mutex_};
+    if (is_stopped_) {
+        throw LogicError{"Listen is called on a stopped cluster"};
+    }
+    auto& data = channels_[subscriber.channel_];
+    if (!data) data = std::make_unique<ChannelData>(subscriber.channel_);
+    ++data->subscribers_count;
+    return data->event_channel.AddListener(
+        &subscriber, "pg_notify_subscriber", &NotificationSubscriber::OnNotification
+    );
+}
+
+void NotificationHub::Unsubscribe(const std::string& channel) {
+    std::lock_guard lock{mutex_};
+    const auto it = channels_.find(channel);
+    UASSERT(it != channels_.end() && it->second->subscribers_count > 0);
+    if (it == channels_.end()) return;
+    if (--it->second->subscribers_count == 0) {
+        LOG_DEBUG() << "Stop listening on channel '" << channel << "'";
+        channels_changed_.Send();
+    }
+}
+
+void NotificationHub::Run() {
+    ConnectionPtr conn{nullptr};
+    while (!engine::current_task::ShouldCancel()) {
+        bool has_channels = false;
+        {
+            std::lock_guard lock{mutex_};
+            has_channels = !channels_.empty();
+        }
+        if (!has_channels) {
+            // The connection is returned to the pool when nobody listens
+            conn = ConnectionPtr{nullptr};
+            [[maybe_unused]] const auto is_changed = channels_changed_.WaitForEvent();
+            continue;
+        }
+
+        try {
+            if (!conn || conn->IsBroken()) {
+                conn = ConnectionPtr{nullptr};
+                ResetListening();
+                conn = pool_->Acquire(engine::Deadline::FromDuration(kAcquireTimeout));
+            }
+            SyncChannels(*conn);
+            Dispatch(conn->WaitNotify(engine::Deadline::FromDuration(kNotifyPollInterval)));
+        } catch (const ConnectionTimeoutError&) {
+            // No notifications within the poll interval
+        } catch (const std::exception& e) {
+            if (engine::current_task::ShouldCancel()) break;
+            LOG_LIMITED_WARNING() << "Notifications connection failed, listening again: " << e;
+            if (conn) conn->MarkAsBroken();
+            engine::InterruptibleSleepFor(kReconnectInterval);
+        }
+    }
+}
+
+void NotificationHub::SyncChannels(Connection& conn) {
+    std::vector<std::string> to_listen;
+    std::vector<std::string> to_unlisten;
+    {
+        std::lock_guard lock{mutex_};
+        for (auto it = channels_.begin(); it != channels_.end();) {
+            const auto& data = *it->second;
+            if (data.subscribers_count == 0) {
+                if (data.is_listening) to_unlisten.push_back(it->first);
+                it = channels_.erase(it);
+                continue;
+            }
+            if (!data.is_listening) to_listen.push_back(it->first);
+            ++it;
+        }
+    }
+
+    for (const auto& channel : to_unlisten) {
+        conn.Unlisten(channel, {});
+    }
+    for (const auto& channel : to_listen) {
+        conn.Listen(channel, {});
+        std::lock_guard lock{mutex_};
+        const auto it = channels_.find(channel);
+        if (it != channels_.end()) it->second->is_listening = true;
+    }
+    if (!to_listen.empty()) listening_cv_.NotifyAll();
+}
+
+void NotificationHub::ResetListening() {
+    std::lock_guard lock{mutex_};
+    for (auto& [_, data] : channels_) {
+        data->is_listening = false;
+    }
+}
+
+void NotificationHub::Dispatch(const Notification& notification) {
+    ChannelData* data = nullptr;
+    {
+        std::lock_guard lock{mutex_};
+        const auto it = channels_.find(notification.channel);
+        if (it != channels_.end()) data = it->second.get();
+    }
+    // Channels are erased only by this task, so the data is alive
+    if (data) data->event_channel.SendEvent(notification);
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
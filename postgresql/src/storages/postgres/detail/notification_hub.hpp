@@ -0,0 +1,103 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/concurrent/async_event_channel.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/postgres/notify.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class Connection;
+class ConnectionPool;
+class NotificationHub;
+
+/// Receives the notifications of a single channel from a NotificationHub
+class NotificationSubscriber final {
+public:
+    NotificationSubscriber(std::shared_ptr<NotificationHub> hub, std::string_view channel);
+    ~NotificationSubscriber();
+
+    NotificationSubscriber(const NotificationSubscriber&) = delete;
+    NotificationSubscriber& operator=(const NotificationSubscriber&) = delete;
+
+    Notification WaitNotify(engine::Deadline deadline);
+
+private:
+    friend class NotificationHub;
+
+    void OnNotification(const Notification& notification);
+
+    const std::shared_ptr<NotificationHub> hub_;
+    const std::string channel_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable queue_cv_;
+    std::deque<Notification> queue_;
+
+    concurrent::AsyncEventSubscriberScope subscription_;
+};
+
+/// @brief Multiplexes the LISTEN of all the subscribers over a single
+/// connection of a pool.
+///
+/// The connection is acquired on the first subscription and is held until the
+/// last channel is unlistened. If the connection breaks, a new one is acquired
+/// and all the channels are listened again. Notifications sent while there was
+/// no connection are lost.
+class NotificationHub final : public std::enable_shared_from_this<NotificationHub> {
+public:
+    explicit NotificationHub(std::shared_ptr<ConnectionPool> pool);
+    ~NotificationHub();
+
+    NotificationHub(const NotificationHub&) = delete;
+    NotificationHub& operator=(const NotificationHub&) = delete;
+
+    /// Subscribes to the channel, returns after the channel is listened
+    NotifyScope Listen(std::string_view channel, OptionalCommandControl cmd_ctl);
+
+    void Stop();
+
+private:
+    friend class NotificationSubscriber;
+
+    struct ChannelData {
+        explicit ChannelData(std::string_view channel);
+
+        concurrent::AsyncEventChannel<const Notification&> event_channel;
+        std::size_t subscribers_count{0};
+        bool is_listening{false};
+    };
+
+    concurrent::AsyncEventSubscriberScope Subscribe(NotificationSubscriber& subscriber);
+    void Unsubscribe(const std::string& channel);
+
+    void Run();
+    void SyncChannels(Connection& conn);
+    void ResetListening();
+    void Dispatch(const Notification& notification);
+
+    const std::shared_ptr<ConnectionPool> pool_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable listening_cv_;
+    std::unordered_map<std::string, std::unique_ptr<ChannelData>> channels_;
+    bool is_stopped_{false};
+
+    engine::SingleConsumerEvent channels_changed_;
+    engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -559,9 +559,125 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
     return result;
 }
 
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline, tracing::ScopeTime& scope, ExecStatusType expected) {
+    scope.Reset(scopes::kLibpqWaitCopyStart);
+    Flush(deadline);
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    const auto status = handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+    if (status == expected) return;
+
+    if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT || status == PGRES_COPY_BOTH) {
+        PGCW_LOG_LIMITED_ERROR() << "PostgreSQL COPY command has unexpected direction " << PQresStatus(status);
+        CloseWithError(LogicError{"Unexpected direction of the COPY command"});
+    }
+
+    // Not a COPY command, the rest of the results are discarded and the
+    // statement error, if any, is thrown
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+        PQclear(pg_res);
+    }
+    MakeResult(std::move(handle));
+    throw LogicError{"The statement is not a COPY FROM STDIN / COPY TO STDOUT command"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqPutCopyData);
+    while (true) {
+        const int put_res = PQputCopyData(conn_, data.data(), static_cast<int>(data.size()));
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(std::string{"PQputCopyData execution error: "} + PQerrorMessage(conn_));
+        }
+        // The output buffer is full
+        Flush(deadline);
+    }
+    // Flushing every chunk keeps the memory usage bounded when the server is
+    // slower than the producer
+    Flush(deadline);
+    UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(Deadline deadline, const char* error_message) {
+    while (true) {
+        const int put_res = PQputCopyEnd(conn_, error_message);
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(std::string{"PQputCopyEnd execution error: "} + PQerrorMessage(conn_));
+        }
+        Flush(deadline);
+    }
+    Flush(deadline);
+    UpdateLastUse();
+}
+
+PGConnectionWrapper::CopyData PGConnectionWrapper::GetCopyData(Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqGetCopyData);
+    while (true) {
+        char* buffer = nullptr;
+        const int get_res = PQgetCopyData(conn_, &buffer, /* async */ 1);
+        if (get_res > 0) {
+            return CopyData{CopyBuffer{buffer, &PQfreemem}, static_cast<std::size_t>(get_res)};
+        }
+        if (get_res == -1) return {};
+        if (get_res < -1) {
+            HandleSocketPostClose();
+            throw CommandError(std::string{"PQgetCopyData execution error: "} + PQerrorMessage(conn_));
+        }
+
+        // No complete row is available yet
+        HandleSocketPostClose();
+        if (!WaitSocketReadable(deadline)) {
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while reading COPY data");
+            }
+            PGCW_LOG_LIMITED_WARNING() << "Timeout while reading COPY data from PostgreSQL connection";
+            throw ConnectionTimeoutError("Timed out while reading COPY data");
+        }
+        CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+        UpdateLastUse();
+    }
+}
+
+void PGConnectionWrapper::SetChunkedRowsMode([[maybe_unused]] std::size_t chunk_size) {
+#if USERVER_LIBPQ_VERSION >= 170000
+    CheckError<CommandError>("PQsetChunkedRowsMode", PQsetChunkedRowsMode(conn_, static_cast<int>(chunk_size)));
+#else
+    CheckError<CommandError>("PQsetSingleRowMode", PQsetSingleRowMode(conn_));
+#endif
+}
+
+std::optional<ResultSet> PGConnectionWrapper::WaitRowsChunk(Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    if (!handle) return std::nullopt;
+
+    const auto status = PQresultStatus(handle.get());
+#if USERVER_LIBPQ_VERSION >= 170000
+    const bool is_chunk = (status == PGRES_SINGLE_TUPLE || status == PGRES_TUPLES_CHUNK);
+#else
+    const bool is_chunk = (status == PGRES_SINGLE_TUPLE);
+#endif
+    if (is_chunk) {
+        UpdateLastUse();
+        return ResultSet{std::make_shared<detail::ResultWrapper>(std::move(handle))};
+    }
+
+    // The final result of the query, it has no rows in the chunked rows mode
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+        PQclear(pg_res);
+    }
+    auto res = MakeResult(std::move(handle));
+    if (res.IsEmpty()) return std::nullopt;
+    return res;
+}
+
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
     [[maybe_unused]] Deadline deadline,
-    const std::vector<const PGresult*>& descriptions
+    const std::vector<const PGresult*>& descriptions,
+    [[maybe_unused]] std::vector<std::exception_ptr>* errors
 ) {
     UASSERT(!descriptions.empty());
 
@@ -571,6 +687,7 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
     Flush(deadline);
 
     std::vector<ResultSet> result{};
+    if (errors) errors->clear();
     const PGresult* current_description = descriptions.front();
 
     std::size_t null_res_counter{0};
@@ -605,7 +722,17 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                 return first_field_name != nullptr && std::string_view{first_field_name} == kSetConfigQueryResultName;
             }();
             if (!is_set_config_response) {
-                result.push_back(MakeResult(std::move(handle)));
+                if (errors) {
+                    try {
+                        result.push_back(MakeResult(std::move(handle)));
+                        errors->emplace_back();
+                    } catch (const Error&) {
+                        result.emplace_back(nullptr);
+                        errors->push_back(std::current_exception());
+                    }
+                } else {
+                    result.push_back(MakeResult(std::move(handle)));
+                }
             }
         }
 
@@ -680,9 +807,9 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
         case PGRES_COPY_IN:
         case PGRES_COPY_OUT:
         case PGRES_COPY_BOTH:
-            PGCW_LOG_LIMITED_ERROR() << "PostgreSQL COPY command invoked which is not implemented"
+            PGCW_LOG_LIMITED_ERROR() << "PostgreSQL COPY command invoked outside of CopyIn/CopyOut"
                                      << logging::LogExtra::Stacktrace();
-            CloseWithError(NotImplemented{"Copy is not implemented"});
+            CloseWithError(NotImplemented{"Copy is supported only via Transaction::CopyIn/CopyOut"});
         case PGRES_BAD_RESPONSE:
             CloseWithError(ConnectionError{"Failed to parse server response"});
         case PGRES_NONFATAL_ERROR: {
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
 #include <string_view>
 
 #include <libpq-fe.h>
@@ -29,6 +33,15 @@ public:
     using Deadline = engine::Deadline;
     using Duration = Deadline::TimePoint::clock::duration;
     using ResultHandle = detail::ResultWrapper::ResultHandle;
+    using CopyBuffer = std::unique_ptr<char, decltype(&PQfreemem)>;
+
+    /// A single message of the COPY TO STDOUT data, empty when the data is over
+    struct CopyData {
+        CopyBuffer buffer{nullptr, &PQfreemem};
+        std::size_t size{0};
+
+        explicit operator bool() const { return buffer != nullptr; }
+    };
 
     PGConnectionWrapper(
         engine::TaskProcessor& tp,
@@ -113,10 +126,49 @@ public:
     /// Will return result or throw an exception
     ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&, const PGresult* description);
 
+    /// @brief Wait for the server to switch the connection to the COPY state
+    /// with the `expected` direction.
+    ///
+    /// @throws LogicError if the statement is not a COPY FROM STDIN / TO STDOUT
+    /// or an exception of the statement error
+    void WaitCopyStart(Deadline deadline, tracing::ScopeTime&, ExecStatusType expected);
+
+    /// @brief Wrapper for PQputCopyData, flushes the data to the socket
+    void PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQputCopyEnd, a non-null `error_message` makes the
+    /// server fail the COPY
+    void PutCopyEnd(Deadline deadline, const char* error_message = nullptr);
+
+    /// @brief Wrapper for PQgetCopyData
+    CopyData GetCopyData(Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Switch the query that was just sent to receiving its rows by
+    /// chunks of at most `chunk_size` rows. With libpq older than 17 each
+    /// chunk contains a single row.
+    void SetChunkedRowsMode(std::size_t chunk_size);
+
+    /// @brief Wait for the next chunk of rows of a query in the chunked rows
+    /// mode.
+    ///
+    /// Returns std::nullopt when all the rows were received, throws
+    /// an exception of the statement error.
+    std::optional<ResultSet> WaitRowsChunk(Deadline deadline, tracing::ScopeTime&);
+
     /// @brief Wait for notification
     Notification WaitNotify(Deadline deadline);
 
-    std::vector<ResultSet> GatherPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
+    /// @brief Read the results of all the queries in the pipeline.
+    ///
+    /// If `errors` is null, the first failed query error is thrown. Otherwise
+    /// the errors of the failed queries are stored in `errors` with empty
+    /// result sets in their place, and the results of the rest of the queries
+    /// are still read.
+    std::vector<ResultSet> GatherPipeline(
+        Deadline deadline,
+        const std::vector<const PGresult*>& descriptions,
+        std::vector<std::exception_ptr>* errors = nullptr
+    );
 
     /// Consume input from connection
     void ConsumeInput(Deadline deadline, const PGresult* description);
@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/pool.hpp>
 
+#include <algorithm>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/cc_config.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
@@ -35,6 +37,14 @@ constexpr std::chrono::seconds kMaxIdleDuration{15};
 constexpr const char* kMaintainTaskName = "pg_maintain";
 
 constexpr std::chrono::seconds kConnectingTimeout{2};
+
+constexpr std::chrono::seconds kAutoscalingInterval{1};
+constexpr const char* kAutoscalingTaskName = "pg_autoscaling";
+// Acquire wait time is taken for the current and the previous statistics epoch
+constexpr std::chrono::seconds kAutoscalingWaitPeriod{5};
+constexpr std::size_t kAutoscalingWaitPercentile = 95;
+// The target grows by a quarter, but at least by one connection
+constexpr std::size_t kAutoscalingGrowthDivisor = 4;
 constexpr auto kPendingConnectsMax{1};
 
 // Max idle connections that can be dropped in one run of maintenance task
@@ -95,6 +105,7 @@ ConnectionPool::ConnectionPool(
       size_semaphore_{settings.max_size},
       connecting_semaphore_{settings.connecting_limit ? settings.connecting_limit : kUnlimitedConnecting},
       wait_count_{0},
+      autoscaling_target_{settings.min_size},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
       ei_settings_(std::move(ei_settings)),
@@ -268,6 +279,76 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
     stats_.transaction.return_to_pool_percentile.GetCurrentCounter().Account(
         std::chrono::duration_cast<std::chrono::milliseconds>(now - conn_stats.trx_end_time).count()
     );
+
+    if (conn_stats.execute_total > 0) {
+        AccountQueryLatency(
+            std::chrono::duration_cast<std::chrono::microseconds>(conn_stats.sum_query_duration) /
+            conn_stats.execute_total
+        );
+    }
+}
+
+void ConnectionPool::AccountQueryLatency(std::chrono::microseconds latency) {
+    // Same smoothing as for TCP round-trip time estimation (RFC 6298)
+    constexpr std::int64_t kSmoothingFactor = 8;
+
+    const auto sample = std::max<std::int64_t>(latency.count(), 1);
+    auto current = query_latency_ewma_us_.load(std::memory_order_relaxed);
+    std::int64_t updated = 0;
+    do {
+        updated = current == 0 ? sample : current + (sample - current) / kSmoothingFactor;
+    } while (!query_latency_ewma_us_.compare_exchange_weak(current, updated, std::memory_order_relaxed));
+}
+
+std::chrono::microseconds ConnectionPool::GetExpectedQueryLatency() const {
+    const auto busy = static_cast<std::int64_t>(stats_.connection.used.Load());
+    return std::chrono::microseconds{query_latency_ewma_us_.load(std::memory_order_relaxed) * (busy + 1)};
+}
+
+void ConnectionPool::AccountSelected() { ++stats_.balancing.selected; }
+
+std::size_t ConnectionPool::GetAutoscalingTarget() const {
+    const auto settings = settings_.Read();
+    return GetMinConnections(*settings);
+}
+
+void ConnectionPool::AutoscaleConnections() {
+    const auto settings = settings_.Read();
+    if (!settings->autoscaling_enabled) return;
+
+    const auto size = size_semaphore_.UsedApprox();
+    const std::size_t used = stats_.connection.used.Load();
+    const std::chrono::milliseconds wait{stats_.acquire_percentile.GetStatsForPeriod(kAutoscalingWaitPeriod, true)
+                                             .GetPercentile(kAutoscalingWaitPercentile)};
+
+    const auto old_target = std::clamp(autoscaling_target_.load(), settings->min_size, settings->max_size);
+    auto target = old_target;
+    // Slow acquisitions are of no concern while there are idle connections,
+    // they are from the past epochs that are already accounted
+    if (wait_count_ > 0 || (wait > settings->autoscaling_target_wait && used >= target)) {
+        target = std::min(settings->max_size, target + std::max<std::size_t>(1, target / kAutoscalingGrowthDivisor));
+    } else if (wait * 2 <= settings->autoscaling_target_wait && used < target && target > settings->min_size) {
+        // Shrink gradually, one connection at a time
+        --target;
+    }
+    if (target != old_target) {
+        LOG_DEBUG() << "Autoscaling target of pool " << DsnCutPassword(dsn_) << " changed from " << old_target
+                    << " to " << target << ", acquire wait time " << wait.count() << "ms";
+    }
+    autoscaling_target_ = target;
+
+    if (size < target) {
+        for (auto i = size; i < target; ++i) {
+            TryCreateConnectionAsync();
+        }
+    } else if (size > target) {
+        Connection* connection = nullptr;
+        if (queue_.pop(connection)) {
+            LOG_DEBUG() << "Autoscaling drops an idle connection to `" << DsnCutPassword(dsn_) << '`';
+            connection->Close();
+            DeleteConnection(connection);
+        }
+    }
 }
 
 void ConnectionPool::Release(Connection* connection) {
@@ -280,6 +361,7 @@ void ConnectionPool::Release(Connection* connection) {
     if (!connection->IsInTransaction()) {
         connection_stats.emplace(connection->GetStatsAndReset());
     }
+    auto new_prepared_statements = connection->TakeNewPreparedStatements();
 
     if (!connection->IsConnected() || connection->IsBroken()) {
         DeleteBrokenConnection(connection);
@@ -304,6 +386,10 @@ void ConnectionPool::Release(Connection* connection) {
     if (connection_stats.has_value()) {
         AccountConnectionStats(std::move(*connection_stats));
     }
+    if (!new_prepared_statements.empty()) {
+        const auto conn_settings = conn_settings_.Read();
+        prepared_registry_.Account(std::move(new_prepared_statements), conn_settings->prepared_warmup_size);
+    }
 }
 
 const InstanceStatistics& ConnectionPool::GetStatistics() const {
@@ -312,6 +398,7 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
     stats_.connection.waiting = wait_count_.load(std::memory_order_relaxed);
     stats_.connection.maximum = settings->max_size;
     stats_.connection.max_queue_size = settings->max_queue_size;
+    stats_.balancing.query_latency_ewma_us = query_latency_ewma_us_.load(std::memory_order_relaxed);
     return stats_;
 }
 
@@ -331,11 +418,15 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
     return NonTransaction{std::move(conn), start_time};
 }
 
-NotifyScope ConnectionPool::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
-    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
-    auto conn = Acquire(deadline);
-    UASSERT(conn);
-    return NotifyScope{std::move(conn), channel, cmd_ctl};
+ResultSet ConnectionPool::ExecuteBatched(
+    const Query& query,
+    const QueryParameters& params,
+    OptionalCommandControl cmd_ctl,
+    const StatementBatchingSettings& settings
+) {
+    const auto statement_cmd_ctl = cmd_ctl.value_or(GetDefaultCommandControl());
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(statement_cmd_ctl.execute);
+    return batcher_.Execute(query, params, statement_cmd_ctl, deadline, settings);
 }
 
 TimeoutDuration ConnectionPool::GetExecuteTimeout(OptionalCommandControl cmd_ctl) const {
@@ -444,10 +535,31 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
     // Clean up the statistics and not account it
     [[maybe_unused]] const auto& stats = connection->GetStatsAndReset();
 
+    WarmUpPreparedStatements(*connection, *conn_settings);
+    if (connection->IsBroken()) {
+        ++stats_.connection.error_total;
+        DeleteConnection(connection.release());
+        return false;
+    }
+
     Push(connection.release());
     return true;
 }
 
+void ConnectionPool::WarmUpPreparedStatements(Connection& connection, const ConnectionSettings& settings) {
+    if (settings.prepared_statements == ConnectionSettings::kNoPreparedStatements) return;
+
+    const auto statements = prepared_registry_.GetWarmupStatements(settings);
+    if (statements.empty()) return;
+
+    try {
+        const auto prepared_count = connection.WarmUpPreparedStatements(statements, GetExecuteTimeout({}));
+        LOG_DEBUG() << "Prepared " << prepared_count << " statements on a new connection";
+    } catch (const Error& e) {
+        LOG_LIMITED_WARNING() << "Failed to warm up prepared statements on a new connection: " << e;
+    }
+}
+
 void ConnectionPool::TryCreateConnectionAsync() {
     auto conn_settings = conn_settings_.Read();
     // Checking errors is more expensive than incrementing an atomic, so we
@@ -465,13 +577,19 @@ void ConnectionPool::TryCreateConnectionAsync() {
 void ConnectionPool::CheckMinPoolSizeUnderflow() {
     auto settings = settings_.Read();
     auto count = size_semaphore_.UsedApprox();
-    if (count < settings->min_size) {
-        LOG_DEBUG() << "Current pool size is less than min_size (" << count << " < " << settings->min_size
+    const auto min_size = GetMinConnections(*settings);
+    if (count < min_size) {
+        LOG_DEBUG() << "Current pool size is less than min_size (" << count << " < " << min_size
                     << "). Create new connection.";
         TryCreateConnectionAsync();
     }
 }
 
+std::size_t ConnectionPool::GetMinConnections(const PoolSettings& settings) const {
+    if (!settings.autoscaling_enabled) return settings.min_size;
+    return std::clamp(autoscaling_target_.load(), settings.min_size, settings.max_size);
+}
+
 void ConnectionPool::Push(Connection* connection) {
     // However unlikely, this could happen when we return connection after
     // asynchronous cleanup routine.
@@ -667,7 +785,7 @@ void ConnectionPool::MaintainConnections() {
                 break;
             }
             stale_connection = conn->GetIdleDuration() >= kMaxIdleDuration;
-            if (count > settings->min_size && drop_left > 0) {
+            if (count > GetMinConnections(*settings) && drop_left > 0) {
                 --drop_left;
                 --stats_.connection.used;
                 LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_) << '`';
@@ -696,9 +814,15 @@ void ConnectionPool::StartMaintainTask() {
     using Flags = USERVER_NAMESPACE::utils::PeriodicTask::Flags;
 
     ping_task_.Start(kMaintainTaskName, {kMaintainInterval, Flags::kStrong}, [this] { MaintainConnections(); });
+    autoscaling_task_.Start(kAutoscalingTaskName, {kAutoscalingInterval, Flags::kStrong}, [this] {
+        AutoscaleConnections();
+    });
 }
 
-void ConnectionPool::StopMaintainTask() { ping_task_.Stop(); }
+void ConnectionPool::StopMaintainTask() {
+    autoscaling_task_.Stop();
+    ping_task_.Stop();
+}
 
 void ConnectionPool::StopConnectTasks() {
     const auto task_count = connect_task_storage_.ActiveTasksApprox();
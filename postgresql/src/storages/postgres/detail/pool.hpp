@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -32,7 +34,9 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <storages/postgres/detail/size_guard.hpp>
+#include <storages/postgres/detail/statement_batcher.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -81,11 +85,35 @@ public:
     void Release(Connection* connection);
 
     const InstanceStatistics& GetStatistics() const;
+
+    /// Expected query latency for the latency-aware host selection: moving
+    /// average of query execution time multiplied by the number of busy
+    /// connections plus one. Zero until the first query is executed.
+    std::chrono::microseconds GetExpectedQueryLatency() const;
+
+    /// Account that the host was chosen by the latency-aware host selection
+    void AccountSelected();
+
+    /// Number of connections the autoscaling keeps open, not less than
+    /// PoolSettings::min_size
+    std::size_t GetAutoscalingTarget() const;
+
+    /// Adjusts the autoscaling target by the acquire wait time and opens or
+    /// closes a connection to reach it. Runs periodically, public for tests.
+    void AutoscaleConnections();
+
     [[nodiscard]] Transaction Begin(const TransactionOptions& options, OptionalCommandControl trx_cmd_ctl = {});
 
     [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
-    NotifyScope Listen(std::string_view channel, OptionalCommandControl cmd_ctl = {});
+    /// Execute a single statement in a batch with the statements of other tasks
+    ResultSet ExecuteBatched(
+        const Query& query,
+        const QueryParameters& params,
+        OptionalCommandControl cmd_ctl,
+        const StatementBatchingSettings& settings
+    );
+
 
     CommandControl GetDefaultCommandControl() const;
 
@@ -110,9 +138,11 @@ private:
 
     [[nodiscard]] engine::TaskWithResult<bool> Connect(engine::SemaphoreLock);
     bool DoConnect(engine::SemaphoreLock);
+    void WarmUpPreparedStatements(Connection& connection, const ConnectionSettings& settings);
 
     void TryCreateConnectionAsync();
     void CheckMinPoolSizeUnderflow();
+    std::size_t GetMinConnections(const PoolSettings& settings) const;
 
     void Push(Connection* connection);
     Connection* Pop(engine::Deadline);
@@ -126,6 +156,7 @@ private:
     void DropOutdatedConnection(Connection* connection);
 
     void AccountConnectionStats(Connection::Statistics stats);
+    void AccountQueryLatency(std::chrono::microseconds latency);
 
     Connection* AcquireImmediate();
     void MaintainConnections();
@@ -148,19 +179,24 @@ private:
     concurrent::BackgroundTaskStorageCore connect_task_storage_;
     concurrent::BackgroundTaskStorageCore close_task_storage_;
     USERVER_NAMESPACE::utils::PeriodicTask ping_task_;
+    USERVER_NAMESPACE::utils::PeriodicTask autoscaling_task_;
     engine::Mutex wait_mutex_;
     engine::ConditionVariable conn_available_;
     boost::lockfree::queue<Connection*> queue_;
     engine::Semaphore size_semaphore_;
     engine::Semaphore connecting_semaphore_;
     std::atomic<size_t> wait_count_;
+    std::atomic<std::size_t> autoscaling_target_;
+    std::atomic<std::int64_t> query_latency_ewma_us_{0};
     DefaultCommandControls default_cmd_ctls_;
     testsuite::PostgresControl testsuite_pg_ctl_;
     const error_injection::Settings ei_settings_;
     RecentCounter recent_conn_errors_;
     USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
     detail::StatementStatsStorage sts_;
+    PreparedStatementsRegistry prepared_registry_;
     dynamic_config::Source config_source_;
+    StatementBatcher batcher_{*this};
 
     // Congestion control stuff
     cc::Sensor cc_sensor_;
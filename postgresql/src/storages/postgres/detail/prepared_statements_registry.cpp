@@ -0,0 +1,67 @@
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+
+#include <functional>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// LruMap can't be empty, the actual limit is set on every Account call
+constexpr std::size_t kInitialMaxSize = 1;
+
+std::size_t TemplateHash(const PreparedStatementTemplate& statement) {
+    auto res = QueryParameters{statement}.TypeHash();
+    boost::hash_combine(res, std::hash<std::string>()(statement.statement));
+    return res;
+}
+
+}  // namespace
+
+PreparedStatementsRegistry::PreparedStatementsRegistry() : statements_{kInitialMaxSize}, max_size_{kInitialMaxSize} {}
+
+void PreparedStatementsRegistry::Account(std::vector<PreparedStatementTemplate>&& statements, std::size_t max_size) {
+    if (statements.empty() || max_size == 0) return;
+
+    std::lock_guard lock{mutex_};
+    if (max_size_ != max_size) {
+        statements_.SetMaxSize(max_size);
+        max_size_ = max_size;
+    }
+    for (auto& statement : statements) {
+        const auto hash = TemplateHash(statement);
+        statements_.Put(hash, std::move(statement));
+    }
+}
+
+std::vector<PreparedStatementTemplate> PreparedStatementsRegistry::GetWarmupStatements(
+    const ConnectionSettings& settings
+) const {
+    std::vector<PreparedStatementTemplate> result;
+    result.reserve(settings.warmup_statements.size() + settings.prepared_warmup_size);
+    for (const auto& statement : settings.warmup_statements) {
+        result.push_back({statement, {}});
+    }
+
+    if (settings.prepared_warmup_size == 0) return result;
+
+    const auto configured_count = result.size();
+    {
+        std::lock_guard lock{mutex_};
+        statements_.VisitAll([&](const std::size_t&, const PreparedStatementTemplate& statement) {
+            if (result.size() - configured_count < settings.prepared_warmup_size) {
+                result.push_back(statement);
+            }
+        });
+    }
+    return result;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
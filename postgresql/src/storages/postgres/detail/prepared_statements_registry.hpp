@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Statement text with the parameter types it is prepared with. Could be used
+/// as a params holder for QueryParameters, which then has no parameter values.
+struct PreparedStatementTemplate {
+    std::string statement;
+    /// Empty for the statements with parameter types inferred by the server
+    std::vector<Oid> param_types;
+
+    std::size_t Size() const { return param_types.size(); }
+    const Oid* ParamTypesBuffer() const { return param_types.empty() ? nullptr : param_types.data(); }
+    static const char* const* ParamBuffers() { return nullptr; }
+    static const int* ParamLengthsBuffer() { return nullptr; }
+    static const int* ParamFormatsBuffer() { return nullptr; }
+};
+
+/// Pool-wide storage of the recently prepared statements that are prepared
+/// in advance on the new connections of the pool.
+class PreparedStatementsRegistry final {
+public:
+    PreparedStatementsRegistry();
+
+    /// Remembers the statements prepared by a connection, keeps at most
+    /// `max_size` of the most recent ones
+    void Account(std::vector<PreparedStatementTemplate>&& statements, std::size_t max_size);
+
+    /// Returns the statements to prepare on a new connection: the configured
+    /// warmup statements followed by the recently prepared ones
+    std::vector<PreparedStatementTemplate> GetWarmupStatements(const ConnectionSettings& settings) const;
+
+private:
+    mutable engine::Mutex mutex_;
+    cache::LruMap<std::size_t, PreparedStatementTemplate> statements_;
+    std::size_t max_size_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <storages/postgres/internal_pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Identifies the cluster in the read-your-writes tokens
+std::string MakeReadYourWritesKey(std::string_view db_name, int shard_number);
+
+/// Remembers the commit LSN of the cluster for the current task and its
+/// subtasks, the LSN never goes back
+void RememberCommitLsn(std::string_view cluster_key, Lsn lsn);
+
+/// The LSN that a host must have replayed to serve the reads of the current
+/// task, kUnknownLsn if there were no writes
+Lsn GetRequiredLsn(std::string_view cluster_key);
+
+/// Formats the LSN in the PostgreSQL text representation, e.g. `16/B374D848`
+std::string LsnToString(Lsn lsn);
+
+/// Parses the PostgreSQL text representation of the LSN
+std::optional<Lsn> ParseLsn(std::string_view str);
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <storages/postgres/detail/pg_message_severity.hpp>
 #include <userver/storages/postgres/io/traits.hpp>
@@ -245,6 +246,10 @@ bool ResultWrapper::IsFieldNull(std::size_t row, std::size_t col) const { return
 
 Oid ResultWrapper::GetFieldTypeOid(std::size_t col) const { return PQftype(handle_.get(), col); }
 
+std::size_t ResultWrapper::ParamCount() const { return PQnparams(handle_.get()); }
+
+Oid ResultWrapper::GetParamTypeOid(std::size_t param) const { return PQparamtype(handle_.get(), param); }
+
 io::BufferCategory ResultWrapper::GetFieldBufferCategory(std::size_t col) const {
     return cached_buffer_categories_->data[col];
 }
@@ -253,12 +258,29 @@ std::size_t ResultWrapper::GetFieldLength(std::size_t row, std::size_t col) cons
     return PQgetlength(handle_.get(), row, col);
 }
 
-io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row, std::size_t col) const {
+void ResultWrapper::CheckBinaryFormat(std::size_t col) const {
     if (PQfformat(handle_.get(), col) != io::kPgBinaryDataFormat) {
         throw ResultSetError{
             fmt::format("Column with index {} has text format\n", col) +
             logging::stacktrace_cache::to_string(boost::stacktrace::stacktrace{})};
     }
+}
+
+void ResultWrapper::GetRowFieldBuffers(std::size_t row, io::FieldBuffer* buffers, std::size_t count) const {
+    UASSERT(row < RowCount());
+    UASSERT(count <= FieldCount());
+    const auto& categories = cached_buffer_categories_->data;
+    for (std::size_t col = 0; col < count; ++col) {
+        buffers[col] = io::FieldBuffer{
+            IsFieldNull(row, col),
+            categories[col],
+            GetFieldLength(row, col),
+            reinterpret_cast<const std::uint8_t*>(PQgetvalue(handle_.get(), row, col))};
+    }
+}
+
+io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row, std::size_t col) const {
+    CheckBinaryFormat(col);
     return io::FieldBuffer{
         IsFieldNull(row, col),
         GetFieldBufferCategory(col),
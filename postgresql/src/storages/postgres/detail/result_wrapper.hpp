@@ -46,6 +46,16 @@ public:
     bool IsFieldNull(std::size_t row, std::size_t col) const;
     std::size_t GetFieldLength(std::size_t row, std::size_t col) const;
     io::FieldBuffer GetFieldBuffer(std::size_t row, std::size_t col) const;
+    void CheckBinaryFormat(std::size_t col) const;
+    // Same as GetFieldBuffer() for the first `count` fields of the row, the
+    // format of the fields must be checked beforehand
+    void GetRowFieldBuffers(std::size_t row, io::FieldBuffer* buffers, std::size_t count) const;
+    //@}
+
+    //@{
+    /** @name Prepared statement description */
+    std::size_t ParamCount() const;
+    Oid GetParamTypeOid(std::size_t param) const;
     //@}
 
     //@{
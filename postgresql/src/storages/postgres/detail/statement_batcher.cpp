@@ -0,0 +1,257 @@
+#include <storages/postgres/detail/statement_batcher.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <optional>
+
+#include <fmt/format.h>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/statement_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+const std::string kBatchSpanName = "pg_statement_batch";
+
+}  // namespace
+
+struct StatementBatcher::Statement final {
+    // Modified under the batcher mutex only
+    enum class State {
+        kQueued,
+        kLeader,
+        kInFlight,
+        kDone,
+    };
+
+    Statement(const Query& query, const QueryParameters& params, CommandControl cmd_ctl, engine::Deadline deadline)
+        : query{query}, params{params}, cmd_ctl{cmd_ctl}, deadline{deadline} {}
+
+    // Network timeout is the time left till the deadline of the statement
+    CommandControl GetRemainingCommandControl() const {
+        const auto time_left = std::chrono::duration_cast<TimeoutDuration>(deadline.TimeLeft());
+        return CommandControl{std::max(time_left, TimeoutDuration::zero()), cmd_ctl.statement};
+    }
+
+    const Query& query;
+    const QueryParameters& params;
+    const CommandControl cmd_ctl;
+    const engine::Deadline deadline;
+
+    ResultSet result{nullptr};
+    std::exception_ptr error;
+
+    State state{State::kQueued};
+    engine::SingleConsumerEvent event;
+};
+
+StatementBatcher::StatementBatcher(ConnectionPool& pool) : pool_{pool} {}
+
+ResultSet StatementBatcher::Execute(
+    const Query& query,
+    const QueryParameters& params,
+    CommandControl cmd_ctl,
+    engine::Deadline deadline,
+    const StatementBatchingSettings& settings
+) {
+    Statement statement{query, params, cmd_ctl, deadline};
+
+    bool is_leader = false;
+    {
+        const std::lock_guard lock{mutex_};
+        if (leaders_count_ < settings.max_concurrent_batches) {
+            ++leaders_count_;
+            statement.state = Statement::State::kLeader;
+            is_leader = true;
+        } else {
+            queue_.push_back(&statement);
+        }
+    }
+
+    if (!is_leader) is_leader = WaitForTurn(statement);
+    if (is_leader) RunBatch(statement, settings);
+
+    if (statement.error) std::rethrow_exception(statement.error);
+    return std::move(statement.result);
+}
+
+bool StatementBatcher::WaitForTurn(Statement& statement) {
+    [[maybe_unused]] const bool is_signaled = statement.event.WaitForEventUntil(statement.deadline);
+
+    std::unique_lock lock{mutex_};
+    if (statement.state == Statement::State::kQueued) {
+        const auto it = std::find(queue_.begin(), queue_.end(), &statement);
+        UASSERT(it != queue_.end());
+        queue_.erase(it);
+        lock.unlock();
+
+        if (engine::current_task::ShouldCancel()) {
+            throw PoolError("Task was cancelled while waiting for a statement batch");
+        }
+        throw PoolError("Deadline reached while waiting for a statement batch");
+    }
+
+    // The batch leader references the statement until the batch is done
+    while (statement.state == Statement::State::kInFlight) {
+        lock.unlock();
+        const engine::TaskCancellationBlocker block_cancel;
+        [[maybe_unused]] const bool is_done = statement.event.WaitForEvent();
+        lock.lock();
+    }
+    return statement.state == Statement::State::kLeader;
+}
+
+void StatementBatcher::RunBatch(Statement& leader, const StatementBatchingSettings& settings) {
+    std::vector<Statement*> batch;
+
+    std::optional<ConnectionPtr> conn;
+    try {
+        conn.emplace(pool_.Acquire(leader.deadline));
+    } catch (const std::exception&) {
+        leader.error = std::current_exception();
+    }
+
+    if (conn) {
+        batch.reserve(settings.max_batch_size);
+        {
+            const std::lock_guard lock{mutex_};
+            leader.state = Statement::State::kInFlight;
+            batch.push_back(&leader);
+            while (!queue_.empty() && batch.size() < settings.max_batch_size) {
+                auto* statement = queue_.front();
+                queue_.pop_front();
+                statement->state = Statement::State::kInFlight;
+                batch.push_back(statement);
+            }
+        }
+
+        (*conn)->Start(SteadyClock::now());
+        if (batch.size() > 1 && (*conn)->IsPipelineActive() && (*conn)->ArePreparedStatementsEnabled()) {
+            ExecutePipelined(*conn, batch);
+        } else {
+            ExecuteOneByOne(*conn, batch);
+        }
+        (*conn)->Finish();
+        conn.reset();
+    }
+
+    const std::lock_guard lock{mutex_};
+    leader.state = Statement::State::kDone;
+    for (auto* statement : batch) {
+        if (statement == &leader) continue;
+        // The statement may be destroyed right after the notification
+        statement->state = Statement::State::kDone;
+        statement->event.Send();
+    }
+    PassLeadership();
+}
+
+void StatementBatcher::PassLeadership() {
+    if (queue_.empty()) {
+        UASSERT(leaders_count_ > 0);
+        --leaders_count_;
+        return;
+    }
+    auto* next_leader = queue_.front();
+    queue_.pop_front();
+    next_leader->state = Statement::State::kLeader;
+    next_leader->event.Send();
+}
+
+void StatementBatcher::ExecuteOneByOne(ConnectionPtr& conn, const std::vector<Statement*>& batch) {
+    for (auto* statement : batch) {
+        StatementStats stats{statement->query, conn};
+        try {
+            statement->result = conn->Execute(
+                statement->query, statement->params, OptionalCommandControl{statement->GetRemainingCommandControl()}
+            );
+            stats.AccountStatementExecution();
+        } catch (const std::exception&) {
+            stats.AccountStatementError();
+            statement->error = std::current_exception();
+        }
+    }
+}
+
+void StatementBatcher::ExecutePipelined(ConnectionPtr& conn, const std::vector<Statement*>& batch) {
+    tracing::Span span{kBatchSpanName};
+    auto scope = span.CreateScopeTime();
+
+    // Statements are prepared before any of them is added into the pipeline,
+    // as preparing waits for the results of the connection
+    std::vector<Statement*> prepared;
+    std::vector<Connection::PreparedStatementMeta> metas;
+    prepared.reserve(batch.size());
+    metas.reserve(batch.size());
+    for (auto* statement : batch) {
+        try {
+            metas.push_back(conn->PrepareStatement(
+                statement->query, statement->params, statement->GetRemainingCommandControl().execute
+            ));
+            prepared.push_back(statement);
+        } catch (const std::exception&) {
+            statement->error = std::current_exception();
+        }
+    }
+    if (prepared.empty()) return;
+
+    std::vector<StatementStats> stats;
+    stats.reserve(prepared.size());
+    std::vector<ResultSet> descriptions;
+    descriptions.reserve(prepared.size());
+    try {
+        auto batch_timeout = TimeoutDuration::zero();
+        for (std::size_t i = 0; i < prepared.size(); ++i) {
+            auto* statement = prepared[i];
+            const auto cmd_ctl = statement->GetRemainingCommandControl();
+            batch_timeout = std::max(batch_timeout, cmd_ctl.execute);
+            stats.emplace_back(statement->query, conn);
+            conn->AddIntoPipeline(cmd_ctl, metas[i].statement_name, statement->params, metas[i].description, scope);
+            descriptions.push_back(std::move(metas[i].description));
+        }
+
+        std::vector<std::exception_ptr> errors;
+        auto results = conn->GatherPipeline(batch_timeout, descriptions, errors);
+        if (results.size() != prepared.size()) {
+            throw RuntimeError{fmt::format(
+                "Statement batch results count mismatch: expected {}, got {}", prepared.size(), results.size()
+            )};
+        }
+        for (std::size_t i = 0; i < prepared.size(); ++i) {
+            if (errors[i]) {
+                stats[i].AccountStatementError();
+                prepared[i]->error = errors[i];
+            } else {
+                stats[i].AccountStatementExecution();
+                prepared[i]->result = std::move(results[i]);
+            }
+        }
+    } catch (const std::exception&) {
+        // The connection failed, none of the results can be trusted
+        span.AddTag(tracing::kErrorFlag, true);
+        const auto error = std::current_exception();
+        for (std::size_t i = 0; i < prepared.size(); ++i) {
+            if (i < stats.size()) stats[i].AccountStatementError();
+            prepared[i]->result = ResultSet{nullptr};
+            prepared[i]->error = error;
+        }
+    }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class ConnectionPool;
+
+/// @brief Merges independent single-statement queries issued concurrently by
+/// different tasks into pipelined batches executed on a single connection.
+///
+/// At most `max_concurrent_batches` statements act as batch leaders at a time,
+/// the rest are queued. A leader acquires a connection, takes the queued
+/// statements (up to `max_batch_size` in total) and executes them in a single
+/// pipeline, each in its own implicit transaction. When the batch is done,
+/// the leadership is passed to the first queued statement, so no delay is
+/// added to gather a batch: batches grow only while the connections are busy.
+///
+/// A statement that is still queued when its deadline is reached fails with
+/// PoolError. The batch network timeout is the latest deadline of its
+/// statements, statement timeouts are applied to each statement separately.
+///
+/// Connections without pipelining or prepared statements execute the batch
+/// statements one by one, which still limits the number of used connections.
+class StatementBatcher final {
+public:
+    explicit StatementBatcher(ConnectionPool& pool);
+
+    StatementBatcher(const StatementBatcher&) = delete;
+    StatementBatcher& operator=(const StatementBatcher&) = delete;
+
+    ResultSet Execute(
+        const Query& query,
+        const QueryParameters& params,
+        CommandControl cmd_ctl,
+        engine::Deadline deadline,
+        const StatementBatchingSettings& settings
+    );
+
+private:
+    struct Statement;
+
+    // Returns true if the statement became a batch leader
+    bool WaitForTurn(Statement& statement);
+    void RunBatch(Statement& leader, const StatementBatchingSettings& settings);
+    void PassLeadership();
+
+    static void ExecuteOneByOne(ConnectionPtr& conn, const std::vector<Statement*>& batch);
+    static void ExecutePipelined(ConnectionPtr& conn, const std::vector<Statement*>& batch);
+
+    ConnectionPool& pool_;
+    engine::Mutex mutex_;
+    std::deque<Statement*> queue_;
+    std::size_t leaders_count_{0};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -40,6 +40,10 @@ void TopologyBase::SetTopologySettings(const TopologySettings& settings) { topol
 
 const testsuite::PostgresControl& TopologyBase::GetTestsuiteControl() const { return testsuite_pg_ctl_; }
 
+TopologyBase::DsnIndices TopologyBase::FilterCaughtUp(const DsnIndices& indices, Lsn /*lsn*/) const {
+    return indices;
+}
+
 std::unique_ptr<Connection> TopologyBase::MakeTopologyConnection(DsnIndex idx) {
     UASSERT(idx < dsns_.size());
     return Connection::Connect(
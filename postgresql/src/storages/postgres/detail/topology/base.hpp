@@ -6,6 +6,7 @@
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/internal_pg_types.hpp>
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -53,6 +54,10 @@ public:
     // Returns statistics for each DSN in DsnList
     virtual const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics() const = 0;
 
+    /// Hosts from `indices` that have replayed the WAL up to `lsn` according
+    /// to the last discovery, the master is always considered caught up
+    virtual DsnIndices FilterCaughtUp(const DsnIndices& indices, Lsn lsn) const;
+
 protected:
     std::unique_ptr<Connection> MakeTopologyConnection(DsnIndex);
 
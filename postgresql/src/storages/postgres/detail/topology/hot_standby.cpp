@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
@@ -173,6 +174,15 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices() cons
 
 const std::vector<decltype(InstanceStatistics::topology)>& HotStandby::GetDsnStatistics() const { return dsn_stats_; }
 
+TopologyBase::DsnIndices HotStandby::FilterCaughtUp(const DsnIndices& indices, Lsn lsn) const {
+    const auto replayed_lsns = replayed_lsns_.Read();
+    DsnIndices result;
+    for (const auto idx : indices) {
+        if (idx < replayed_lsns->size() && (*replayed_lsns)[idx] >= lsn) result.push_back(idx);
+    }
+    return result;
+}
+
 void HotStandby::RunDiscovery() {
     std::vector<engine::TaskWithResult<void>> tasks;
     tasks.reserve(GetDsnList().size());
@@ -269,6 +279,15 @@ void HotStandby::RunDiscovery() {
     std::sort(alive_dsn_indices.begin(), alive_dsn_indices.end(), [this](DsnIndex lhs, DsnIndex rhs) {
         return host_states_[lhs].roundtrip_time < host_states_[rhs].roundtrip_time;
     });
+    // The replay LSN only grows, so a stale value is safe to compare against.
+    // Writes are visible on the master right away.
+    std::vector<Lsn> replayed_lsns(host_states_.size(), kUnknownLsn);
+    for (DsnIndex idx : alive_dsn_indices) {
+        const auto& state = host_states_[idx];
+        replayed_lsns[idx] =
+            state.role == ClusterHostType::kMaster ? Lsn{std::numeric_limits<std::uint64_t>::max()} : state.wal_lsn;
+    }
+
     DsnIndicesByType dsn_indices_by_type;
     for (DsnIndex idx : alive_dsn_indices) {
         const auto& state = host_states_[idx];
@@ -282,6 +301,7 @@ void HotStandby::RunDiscovery() {
     }
     dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
     alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
+    replayed_lsns_.Assign(std::move(replayed_lsns));
 }
 
 void HotStandby::RunCheck(DsnIndex idx) {
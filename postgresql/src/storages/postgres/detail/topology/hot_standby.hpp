@@ -32,6 +32,7 @@ public:
     rcu::ReadablePtr<DsnIndicesByType> GetDsnIndicesByType() const override;
     rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const override;
     const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics() const override;
+    DsnIndices FilterCaughtUp(const DsnIndices& indices, Lsn lsn) const override;
 
 private:
     struct HostState;
@@ -42,6 +43,8 @@ private:
     std::vector<HostState> host_states_;
     rcu::Variable<DsnIndicesByType> dsn_indices_by_type_;
     rcu::Variable<DsnIndices> alive_dsn_indices_;
+    // Replayed LSN of each host, the maximum one for the master
+    rcu::Variable<std::vector<Lsn>> replayed_lsns_;
     std::vector<decltype(InstanceStatistics::topology)> dsn_stats_;
     USERVER_NAMESPACE::utils::PeriodicTask discovery_task_;
 };
@@ -6,6 +6,12 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::io {
 
+static_assert(detail::kUuidSize == boost::uuids::uuid::static_size());
+
+void detail::WriteUuidBytes(const boost::uuids::uuid& value, char* buffer) {
+    std::copy(value.begin(), value.end(), buffer);
+}
+
 void BufferFormatter<boost::uuids::uuid>::operator()(const UserTypes&, std::vector<char>& buf) const {
     std::copy(value.begin(), value.end(), std::back_inserter(buf));
 }
@@ -69,6 +69,10 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
                                       ? ConnectionSettings::kDiscardAll
                                       : ConnectionSettings::kDiscardNone;
 
+    settings.prepared_warmup_size =
+        config["prepared-statements-warmup-size"].template As<size_t>(settings.prepared_warmup_size);
+    settings.warmup_statements = config["warmup-statements"].template As<std::vector<std::string>>({});
+
     return settings;
 }
 
@@ -101,6 +105,10 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
     result.max_size = config["max_pool_size"].template As<size_t>(result.max_size);
     result.max_queue_size = config["max_queue_size"].template As<size_t>(result.max_queue_size);
     result.connecting_limit = config["connecting_limit"].template As<size_t>(result.connecting_limit);
+    result.autoscaling_enabled = config["autoscaling_enabled"].template As<bool>(result.autoscaling_enabled);
+    result.autoscaling_target_wait = config["autoscaling_target_wait_ms"].template As<std::chrono::milliseconds>(
+        result.autoscaling_target_wait
+    );
 
     if (result.max_size == 0) throw InvalidConfig{"max_pool_size must be greater than 0"};
     if (result.max_size < result.min_size) throw InvalidConfig{"max_pool_size cannot be less than min_pool_size"};
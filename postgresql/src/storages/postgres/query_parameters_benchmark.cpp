@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/detail/typed_query_parameters.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+
+const pg::UserTypes types;
+
+void PgStaticQueryParametersWrite(benchmark::State& state) {
+    const pg::Integer id = 42;
+    const pg::Bigint value = 100500;
+    const std::string key = "some reasonably long key";
+    const double ratio = 0.5;
+    for (auto _ : state) {
+        pg::detail::StaticQueryParameters<4> params;
+        params.Write(types, id, value, key, ratio);
+        benchmark::DoNotOptimize(params.ParamBuffers());
+    }
+}
+
+void PgTypedQueryParametersWrite(benchmark::State& state) {
+    const pg::Integer id = 42;
+    const pg::Bigint value = 100500;
+    const std::string key = "some reasonably long key";
+    const double ratio = 0.5;
+    for (auto _ : state) {
+        const pg::detail::TypedQueryParameters<pg::Integer, pg::Bigint, std::string, double> params{
+            types, id, value, key, ratio};
+        benchmark::DoNotOptimize(params.ParamBuffers());
+    }
+}
+
+BENCHMARK(PgStaticQueryParametersWrite);
+BENCHMARK(PgTypedQueryParametersWrite);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
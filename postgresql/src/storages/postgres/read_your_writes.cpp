@@ -0,0 +1,124 @@
+#include <userver/storages/postgres/read_your_writes.hpp>
+
+#include <charconv>
+#include <cstdint>
+#include <map>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/read_your_writes.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+constexpr char kEntrySeparator = ',';
+constexpr char kKeySeparator = '=';
+
+// The values of a TaskInheritedVariable are shared with the subtasks, so the
+// map is copied on modification
+using LsnByCluster = std::map<std::string, Lsn, std::less<>>;
+
+engine::TaskInheritedVariable<LsnByCluster> kCommitLsns;
+
+std::optional<std::uint32_t> ParseHex(std::string_view str) {
+    std::uint32_t result = 0;
+    const auto* const end = str.data() + str.size();
+    const auto [ptr, ec] = std::from_chars(str.data(), end, result, 16);
+    if (str.empty() || ec != std::errc{} || ptr != end) return std::nullopt;
+    return result;
+}
+
+void UpdateLsn(LsnByCluster& lsns, std::string_view cluster_key, Lsn lsn) {
+    const auto it = lsns.find(cluster_key);
+    if (it == lsns.end()) {
+        lsns.emplace(std::string{cluster_key}, lsn);
+    } else if (it->second < lsn) {
+        it->second = lsn;
+    }
+}
+
+}  // namespace
+
+namespace detail {
+
+std::string MakeReadYourWritesKey(std::string_view db_name, int shard_number) {
+    return fmt::format("{}:{}", db_name, shard_number);
+}
+
+void RememberCommitLsn(std::string_view cluster_key, Lsn lsn) {
+    if (lsn == kUnknownLsn) return;
+
+    const auto* current = kCommitLsns.GetOptional();
+    auto lsns = current ? *current : LsnByCluster{};
+    UpdateLsn(lsns, cluster_key, lsn);
+    kCommitLsns.Set(std::move(lsns));
+}
+
+Lsn GetRequiredLsn(std::string_view cluster_key) {
+    const auto* lsns = kCommitLsns.GetOptional();
+    if (!lsns) return kUnknownLsn;
+
+    const auto it = lsns->find(cluster_key);
+    return it == lsns->end() ? kUnknownLsn : it->second;
+}
+
+std::string LsnToString(Lsn lsn) {
+    return fmt::format("{:X}/{:X}", lsn.GetUnderlying() >> 32, lsn.GetUnderlying() & 0xFFFFFFFF);
+}
+
+std::optional<Lsn> ParseLsn(std::string_view str) {
+    const auto slash_pos = str.find('/');
+    if (slash_pos == std::string_view::npos) return std::nullopt;
+
+    const auto high = ParseHex(str.substr(0, slash_pos));
+    const auto low = ParseHex(str.substr(slash_pos + 1));
+    if (!high || !low) return std::nullopt;
+    return Lsn{(std::uint64_t{*high} << 32) | *low};
+}
+
+}  // namespace detail
+
+std::string GetReadYourWritesToken() {
+    const auto* lsns = kCommitLsns.GetOptional();
+    if (!lsns) return {};
+
+    std::string token;
+    for (const auto& [cluster_key, lsn] : *lsns) {
+        if (!token.empty()) token += kEntrySeparator;
+        token += cluster_key;
+        token += kKeySeparator;
+        token += detail::LsnToString(lsn);
+    }
+    return token;
+}
+
+void SetReadYourWritesToken(std::string_view token) {
+    const auto* current = kCommitLsns.GetOptional();
+    auto lsns = current ? *current : LsnByCluster{};
+
+    while (!token.empty()) {
+        const auto entry_end = token.find(kEntrySeparator);
+        const auto entry = token.substr(0, entry_end);
+        token.remove_prefix(entry_end == std::string_view::npos ? token.size() : entry_end + 1);
+
+        const auto key_end = entry.rfind(kKeySeparator);
+        const auto lsn =
+            key_end == std::string_view::npos ? std::nullopt : detail::ParseLsn(entry.substr(key_end + 1));
+        if (!lsn || key_end == 0) {
+            LOG_LIMITED_WARNING() << "Ignoring malformed read-your-writes token entry '" << entry << '\'';
+            continue;
+        }
+        if (*lsn != kUnknownLsn) UpdateLsn(lsns, entry.substr(0, key_end), *lsn);
+    }
+
+    if (!lsns.empty()) kCommitLsns.Set(std::move(lsns));
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -220,6 +220,18 @@ void ResultSet::FillBufferCategories(const UserTypes& types) { pimpl_->FillBuffe
 
 void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) { pimpl_->SetTypeBufferCategories(*dsc.pimpl_); }
 
+void ResultSet::CheckBinaryFormat(size_type field_count) const {
+    for (size_type col = 0; col < field_count; ++col) {
+        pimpl_->CheckBinaryFormat(col);
+    }
+}
+
+void ResultSet::FetchRowBuffers(size_type row, io::FieldBuffer* buffers, size_type field_count) const {
+    pimpl_->GetRowFieldBuffers(row, buffers, field_count);
+}
+
+const io::TypeBufferCategory& ResultSet::GetTypeBufferCategories() const { return pimpl_->GetTypeBufferCategories(); }
+
 Row::size_type Row::IndexOfName(const std::string& name) const { return res_->IndexOfName(name); }
 
 FieldView Row::GetFieldView(size_type index) const { return FieldView{*res_, row_index_, index}; }
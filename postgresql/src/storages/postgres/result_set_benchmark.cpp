@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/bytea.hpp>
+#include <userver/utils/span.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+constexpr std::int64_t kRowsCount = 50;
+
+pg::ResultSet SelectBlobs(pg::detail::Connection& conn, std::int64_t blob_size) {
+    return conn.Execute(
+        "select repeat('x', $1)::bytea from generate_series(1, $2)", static_cast<int>(blob_size), kRowsCount
+    );
+}
+
+template <typename Bytes>
+void ReadBlobs(benchmark::State& state, pg::detail::Connection& conn) {
+    const auto res = SelectBlobs(conn, state.range(0));
+    for (auto _ : state) {
+        for (auto row : res) {
+            Bytes bytes;
+            row[0].To(pg::Bytea(bytes));
+            benchmark::DoNotOptimize(bytes);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * kRowsCount * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(PgConnection, ByteaReadString)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] { ReadBlobs<std::string>(state, GetConnection()); });
+}
+BENCHMARK_REGISTER_F(PgConnection, ByteaReadString)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK_DEFINE_F(PgConnection, ByteaReadStringView)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] { ReadBlobs<std::string_view>(state, GetConnection()); });
+}
+BENCHMARK_REGISTER_F(PgConnection, ByteaReadStringView)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+BENCHMARK_DEFINE_F(PgConnection, ByteaReadSpan)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] { ReadBlobs<utils::span<const std::byte>>(state, GetConnection()); });
+}
+BENCHMARK_REGISTER_F(PgConnection, ByteaReadSpan)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+using DecodedRow = std::tuple<std::int64_t, std::string, std::optional<double>>;
+
+pg::ResultSet SelectRows(pg::detail::Connection& conn, std::int64_t rows_count) {
+    return conn.Execute(
+        "select i, 'name-' || i, case when i % 2 = 0 then i::double precision end "
+        "from generate_series(1, $1) i",
+        rows_count
+    );
+}
+
+BENCHMARK_DEFINE_F(PgConnection, DecodeRowsIteration)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = SelectRows(GetConnection(), state.range(0));
+        for (auto _ : state) {
+            std::vector<DecodedRow> rows;
+            rows.reserve(res.Size());
+            for (auto row : res.AsSetOf<DecodedRow>(pg::kRowTag)) {
+                rows.push_back(std::move(row));
+            }
+            benchmark::DoNotOptimize(rows);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, DecodeRowsIteration)->RangeMultiplier(10)->Range(1000, 1'000'000);
+
+BENCHMARK_DEFINE_F(PgConnection, DecodeRowsAsContainer)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = SelectRows(GetConnection(), state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(res.AsContainer<std::vector<DecodedRow>>(pg::kRowTag));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, DecodeRowsAsContainer)->RangeMultiplier(10)->Range(1000, 1'000'000);
+
+BENCHMARK_DEFINE_F(PgConnection, DecodeRowsAsContainerParallel)(benchmark::State& state) {
+    RunStandalone(state, 4, [this, &state] {
+        const auto res = SelectRows(GetConnection(), state.range(0));
+        const pg::ParallelDecoding parallel{static_cast<std::size_t>(state.range(0) / 4)};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(res.AsContainer<std::vector<DecodedRow>>(pg::kRowTag, parallel));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, DecodeRowsAsContainerParallel)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1'000'000)
+    ->UseRealTime();
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -51,6 +51,10 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
     writer["prepared-per-connection"] = stats.connection.prepared_statements;
     writer["roundtrip-time"] = stats.topology.roundtrip_time;
     writer["replication-lag"] = stats.topology.replication_lag;
+    if (auto balancing = writer["balancing"]) {
+        balancing["selected"] = stats.balancing.selected;
+        balancing["query-latency-ewma-us"] = stats.balancing.query_latency_ewma_us;
+    }
     if (!stats.per_statement_stats.empty()) {
         for (const auto& [stmt, stmt_stats] : stats.per_statement_stats) {
             writer["statement_timings"].ValueWithLabels(stmt_stats.timings, {"postgresql_query", stmt});
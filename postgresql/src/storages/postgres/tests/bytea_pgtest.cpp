@@ -13,6 +13,7 @@ namespace static_test {
 
 static_assert(tt::kIsByteaCompatible<std::string>);
 static_assert(tt::kIsByteaCompatible<std::string_view>);
+static_assert(tt::kIsByteaCompatible<utils::span<const std::byte>>);
 static_assert(tt::kIsByteaCompatible<std::vector<char>>);
 static_assert(tt::kIsByteaCompatible<std::vector<unsigned char>>);
 static_assert(!tt::kIsByteaCompatible<std::vector<bool>>);
@@ -29,6 +30,7 @@ const pg::UserTypes types;
 const std::string kFooBar = "foo\0bar"s;
 
 using TestByteaWrapper = pg::ByteaWrapper<std::vector<unsigned char>>;
+using ByteaView = utils::span<const std::byte>;
 
 TEST(PostgreIO, Bytea) {
     {
@@ -71,6 +73,17 @@ TEST(PostgreIO, Bytea) {
         UEXPECT_NO_THROW(io::ReadBuffer(fb, pg::Bytea(tgt_str)));
         EXPECT_EQ(bin_str, tgt_str);
     }
+    {
+        pg::test::Buffer buffer;
+        const ByteaView bin_view = utils::as_bytes(utils::span<const char>{kFooBar});
+        UEXPECT_NO_THROW(io::WriteBuffer(types, buffer, pg::Bytea(bin_view)));
+        EXPECT_EQ(kFooBar.size(), buffer.size());
+        auto fb = pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kPlainBuffer);
+        ByteaView tgt_view;
+        UEXPECT_NO_THROW(io::ReadBuffer(fb, pg::Bytea(tgt_view)));
+        ASSERT_EQ(tgt_view.size(), kFooBar.size());
+        EXPECT_EQ(reinterpret_cast<const char*>(tgt_view.data()), buffer.data());
+    }
 }
 
 UTEST_P(PostgreConnection, ByteaRoundtrip) {
@@ -157,6 +170,24 @@ UTEST_P(PostgreConnection, ByteaRoundTripTypes) {
     }
 }
 
+UTEST_P(PostgreConnection, ByteaView) {
+    CheckConnection(GetConn());
+
+    /// [bytea_view]
+    const auto res = GetConn()->Execute("select i, repeat('foo', i)::bytea from generate_series(1, 10) i");
+
+    // rows reference the buffer of the result set, no data is copied
+    using RowType = std::tuple<int, pg::ByteaWrapper<utils::span<const std::byte>>>;
+    for (const auto& [i, blob] : res.AsSetOf<RowType>()) {
+        EXPECT_EQ(blob.bytes.size(), static_cast<std::size_t>(i) * 3);
+    }
+
+    utils::span<const std::byte> view;
+    res[0][1].To(pg::Bytea(view));
+    /// [bytea_view]
+    EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(view.data()), view.size()), "foo");
+}
+
 UTEST_P(PostgreConnection, ByteaWrapperRowType) {
     CheckConnection(GetConn());
 
@@ -10,6 +10,7 @@
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -180,6 +181,8 @@ UTEST_F(PostgreCluster, ClusterSlaveRO) {
     );
     CheckRoTransaction(cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest}, pg::Transaction::RO)
     );
+    CheckRoTransaction(cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kFastest}, pg::Transaction::RO)
+    );
 
     UEXPECT_THROW(
         cluster.Begin(
@@ -246,6 +249,23 @@ UTEST_F(PostgreCluster, SingleQuery) {
     EXPECT_EQ(1, res.Size());
 }
 
+UTEST_F(PostgreCluster, TypedQuery) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
+
+    const pg::TypedQuery<int, std::string, std::optional<int>> query{
+        pg::Query{"SELECT $1 + 1, $2 || 'bar', $3 IS NULL"}};
+
+    auto res = cluster.Execute(pg::ClusterHostType::kMaster, query, 41, "foo", std::nullopt);
+    ASSERT_EQ(1, res.Size());
+    EXPECT_EQ((res.Front().As<int, std::string, bool>()), std::make_tuple(42, std::string{"foobar"}, true));
+
+    auto trx = cluster.Begin(pg::ClusterHostType::kMaster, {});
+    res = trx.Execute(query, 1, std::string{}, 2);
+    EXPECT_EQ((res.Front().As<int, std::string, bool>()), std::make_tuple(2, std::string{"bar"}, false));
+    trx.Commit();
+}
+
 UTEST_F(PostgreCluster, HostSelectionSingleQuery) {
     testsuite::TestsuiteTasks testsuite_tasks{true};
     auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
@@ -398,4 +418,84 @@ UTEST_F(PostgreCluster, ListenNotify) {
     );
 }
 
+UTEST_F(PostgreCluster, ListenNotifySharedConnection) {
+    constexpr auto kFirstChannel = std::string_view{"first"};
+    constexpr auto kSecondChannel = std::string_view{"second"};
+    static const auto kNotifyDeadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    // All the scopes share a single connection, the other one executes
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2, testsuite_tasks);
+
+    auto first_scope = cluster.Listen(kFirstChannel);
+    auto first_scope_copy = cluster.Listen(kFirstChannel);
+    auto second_scope = cluster.Listen(kSecondChannel);
+
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, 'a')", kFirstChannel));
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, 'b')", kSecondChannel));
+
+    for (auto* scope : {&first_scope, &first_scope_copy}) {
+        const auto ntf = scope->WaitNotify(kNotifyDeadline);
+        EXPECT_EQ(ntf.channel, kFirstChannel);
+        EXPECT_EQ(ntf.payload, "a");
+    }
+    const auto ntf = second_scope.WaitNotify(kNotifyDeadline);
+    EXPECT_EQ(ntf.channel, kSecondChannel);
+    EXPECT_EQ(ntf.payload, "b");
+
+    {
+        [[maybe_unused]] auto unused = std::move(first_scope);
+    }
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, 'c')", kFirstChannel));
+    EXPECT_EQ(first_scope_copy.WaitNotify(kNotifyDeadline).payload, "c");
+    UEXPECT_THROW(
+        second_scope.WaitNotify(engine::Deadline::FromDuration(std::chrono::milliseconds{50})),
+        pg::ConnectionTimeoutError
+    );
+}
+
+UTEST_F(PostgreCluster, FastestHostSelection) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
+
+    constexpr std::uint32_t kQueriesCount = 10;
+    for (std::uint32_t i = 0; i < kQueriesCount; ++i) {
+        UEXPECT_NO_THROW(cluster.Execute({pg::ClusterHostType::kMaster, pg::ClusterHostType::kFastest}, "SELECT 1"));
+    }
+
+    const auto stats = cluster.GetStatistics();
+    EXPECT_EQ(stats->master.stats.balancing.selected, kQueriesCount);
+    EXPECT_GT(stats->master.stats.balancing.query_latency_ewma_us, 0);
+
+    UEXPECT_THROW(
+        cluster.Execute(
+            {pg::ClusterHostType::kMaster, pg::ClusterHostType::kFastest, pg::ClusterHostType::kNearest}, "SELECT 1"
+        ),
+        pg::LogicError
+    );
+}
+
+UTEST_F(PostgreCluster, ExecuteStreamed) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
+
+    /// [Execute streamed]
+    std::vector<int> ids;
+    const auto rows_count = cluster.ExecuteStreamed(
+        pg::ClusterHostType::kMaster,
+        "SELECT i FROM generate_series(1, $1) i",
+        pg::ParameterStore{}.PushBack(10000),
+        [&ids](pg::ResultSet&& chunk) {
+            for (auto row : chunk) ids.push_back(row.As<int>());
+        },
+        /*chunk_size=*/100
+    );
+    /// [Execute streamed]
+
+    EXPECT_EQ(rows_count, 10000);
+    ASSERT_EQ(ids.size(), 10000);
+    EXPECT_EQ(ids.front(), 1);
+    EXPECT_EQ(ids.back(), 10000);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,122 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+/// [CopyIn]
+struct CopyRow final {
+    int id{};
+    std::string value;
+};
+
+std::size_t CopyRowsIn(pg::Transaction& trx, const std::vector<CopyRow>& rows) {
+    return trx.CopyIn("COPY copy_test (id, value) FROM STDIN (FORMAT binary)", rows);
+}
+/// [CopyIn]
+
+/// [CopyOut]
+std::vector<CopyRow> CopyRowsOut(pg::Transaction& trx) {
+    std::vector<CopyRow> rows;
+    trx.CopyOut<CopyRow>("COPY copy_test (id, value) TO STDOUT (FORMAT binary)", [&rows](CopyRow&& row) {
+        rows.push_back(std::move(row));
+    });
+    return rows;
+}
+/// [CopyOut]
+
+std::vector<CopyRow> MakeRows(std::size_t count) {
+    std::vector<CopyRow> rows;
+    rows.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rows.push_back({static_cast<int>(i), "value " + std::to_string(i)});
+    }
+    return rows;
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyInOut) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+
+    // Several chunks of the COPY data
+    const auto rows = MakeRows(20000);
+
+    pg::Transaction trx{std::move(GetConn())};
+    EXPECT_EQ(CopyRowsIn(trx, rows), rows.size());
+
+    auto res = trx.Execute("select count(*) from copy_test");
+    EXPECT_EQ(rows.size(), res.Front().As<pg::Bigint>(pg::kFieldTag));
+
+    const auto copied = CopyRowsOut(trx);
+    ASSERT_EQ(copied.size(), rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        EXPECT_EQ(copied[i].id, rows[i].id);
+        EXPECT_EQ(copied[i].value, rows[i].value);
+    }
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyEmpty) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    EXPECT_EQ(CopyRowsIn(trx, {}), 0);
+    EXPECT_TRUE(CopyRowsOut(trx).empty());
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyErrors) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    const std::vector<CopyRow> rows = MakeRows(10);
+
+    UEXPECT_THROW(trx.CopyIn("select 1", rows), pg::LogicError);
+    // Wrong direction
+    UEXPECT_THROW(trx.CopyIn("COPY copy_test TO STDOUT (FORMAT binary)", rows), pg::LogicError);
+}
+
+UTEST_P(PostgreConnection, CopyInProducerError) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+
+    UEXPECT_THROW(
+        GetConn()->CopyIn(
+            "COPY copy_test (id, value) FROM STDIN (FORMAT binary)",
+            [](std::vector<char>&) -> bool { throw std::runtime_error{"producer failed"}; },
+            {}
+        ),
+        std::runtime_error
+    );
+
+    // The connection is still usable
+    auto res = GetConn()->Execute("select count(*) from copy_test");
+    EXPECT_EQ(0, res.Front().As<pg::Bigint>(pg::kFieldTag));
+}
+
+UTEST_P(PostgreConnection, CopyOutTypeMismatch) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer, value text)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    CopyRowsIn(trx, MakeRows(10));
+    UEXPECT_THROW(
+        trx.CopyOut<std::tuple<int>>("COPY copy_test (id, value) TO STDOUT (FORMAT binary)", [](std::tuple<int>&&) {}),
+        pg::InvalidTupleSizeRequested
+    );
+}
+
+USERVER_NAMESPACE_END
@@ -12,6 +12,7 @@
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/query_queue.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -615,6 +616,138 @@ UTEST_P(PostgrePool, ForQueryQueueBeingNonTransactional) {
     EXPECT_EQ(inserted_values.front(), 1);
 }
 
+UTEST_P(PostgrePool, StatementBatching) {
+    auto pool = pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        GetTaskProcessor(),
+        "",
+        GetParam(),
+        {1, 1, 10},
+        kCachePreparedStatements,
+        {},
+        GetTestCmdCtls(),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource()
+    );
+
+    pg::StatementBatchingSettings settings;
+    settings.enabled = true;
+    settings.max_batch_size = 8;
+    settings.max_concurrent_batches = 1;
+
+    constexpr int kStatementsCount = 50;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kStatementsCount);
+    for (int i = 0; i < kStatementsCount; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&pool, &settings, i] {
+            pg::ParameterStore store;
+            store.PushBack(i);
+            if (i % 10 == 0) {
+                // A failed statement does not affect the rest of the batch
+                UEXPECT_THROW(
+                    pool->ExecuteBatched(
+                        "SELECT 1 / ($1 - $1)", pg::detail::QueryParameters{store.GetInternalData()}, {}, settings
+                    ),
+                    pg::Error
+                );
+                return;
+            }
+            const auto res = pool->ExecuteBatched(
+                "SELECT $1::integer", pg::detail::QueryParameters{store.GetInternalData()}, {}, settings
+            );
+            EXPECT_EQ(i, res.AsSingleRow<int>());
+        }));
+    }
+    for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+
+    EXPECT_EQ(pool->GetStatistics().connection.open_total, 1);
+}
+
+UTEST_P(PostgrePool, PreparedStatementsWarmup) {
+    auto conn_settings = kCachePreparedStatements;
+    conn_settings.prepared_warmup_size = 10;
+    conn_settings.warmup_statements = {"SELECT 2", "SELECT * FROM missing_warmup_table"};
+
+    auto pool = pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        GetTaskProcessor(),
+        "",
+        GetParam(),
+        {1, 2, 10},
+        conn_settings,
+        {},
+        GetTestCmdCtls(),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource()
+    );
+
+    {
+        pg::detail::ConnectionPtr conn{nullptr};
+        UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+        UEXPECT_NO_THROW(conn->Execute("SELECT $1::integer", 1));
+    }
+
+    pg::detail::ConnectionPtr first{nullptr};
+    UASSERT_NO_THROW(first = pool->Acquire(MakeDeadline()));
+    // The new connection parses the statement used on the first one and the
+    // configured ones, the invalid statement is skipped
+    pg::detail::ConnectionPtr second{nullptr};
+    UASSERT_NO_THROW(second = pool->Acquire(MakeDeadline()));
+    EXPECT_EQ(pool->GetStatistics().connection.open_total, 2);
+    EXPECT_EQ(second->GetStatsAndReset().parse_total, 3);
+
+    UEXPECT_NO_THROW(second->Execute("SELECT $1::integer", 2));
+    UEXPECT_NO_THROW(second->Execute("SELECT 2"));
+    EXPECT_EQ(second->GetStatsAndReset().parse_total, 0);
+    EXPECT_FALSE(second->IsBroken());
+}
+
+UTEST_P(PostgrePool, AutoscalingShrinksIdleConnections) {
+    pg::PoolSettings settings{1, 4, 10};
+    settings.autoscaling_enabled = true;
+    settings.autoscaling_target_wait = std::chrono::seconds{1};
+
+    auto pool = pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        GetTaskProcessor(),
+        "",
+        GetParam(),
+        settings,
+        kCachePreparedStatements,
+        {},
+        GetTestCmdCtls(),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource()
+    );
+    EXPECT_EQ(pool->GetAutoscalingTarget(), 1);
+
+    {
+        std::vector<pg::detail::ConnectionPtr> connections;
+        for (int i = 0; i < 3; ++i) {
+            UEXPECT_NO_THROW(connections.push_back(pool->Acquire(MakeDeadline())));
+        }
+        EXPECT_EQ(pool->GetStatistics().connection.active, 3);
+    }
+
+    // Idle connections are closed one at a time
+    pool->AutoscaleConnections();
+    EXPECT_EQ(pool->GetStatistics().connection.active, 2);
+    pool->AutoscaleConnections();
+    EXPECT_EQ(pool->GetStatistics().connection.active, 1);
+    pool->AutoscaleConnections();
+    EXPECT_EQ(pool->GetStatistics().connection.active, 1);
+    EXPECT_EQ(pool->GetAutoscalingTarget(), 1);
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     PoolTests,
     PostgrePool,
@@ -1,6 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <string_view>
+
+#include <boost/uuid/uuid.hpp>
+
+#include <userver/formats/json/value_builder.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/detail/typed_query_parameters.hpp>
+#include <userver/storages/postgres/io/json_types.hpp>
+#include <userver/storages/postgres/io/uuid.hpp>
 #include <userver/storages/postgres/io/user_types.hpp>
 #include <userver/utest/assert_macros.hpp>
 
@@ -115,6 +124,62 @@ TEST(PostgreIO, OutputFloatStatic) {
     EXPECT_EQ(static_cast<pg::Oid>(pg::io::PredefinedOids::kFloat4), params.ParamTypesBuffer()[0]);
 }
 
+TEST(PostgreIO, OutputTyped) {
+    const pg::Smallint s{42};
+    const pg::Integer i{42};
+    const std::string str{"foo"};
+    const std::optional<pg::Bigint> null;
+
+    const pg::detail::TypedQueryParameters<pg::Smallint, pg::Integer, std::string, std::optional<pg::Bigint>> params{
+        types, s, i, str, null};
+    pg::detail::StaticQueryParameters<4> expected;
+    expected.Write(types, s, i, str, null);
+
+    ASSERT_EQ(expected.Size(), params.Size());
+    for (std::size_t idx = 0; idx < params.Size(); ++idx) {
+        EXPECT_EQ(expected.ParamTypesBuffer()[idx], params.ParamTypesBuffer()[idx]);
+        EXPECT_EQ(expected.ParamFormatsBuffer()[idx], params.ParamFormatsBuffer()[idx]);
+        ASSERT_EQ(expected.ParamLengthsBuffer()[idx], params.ParamLengthsBuffer()[idx]);
+        if (expected.ParamBuffers()[idx] == nullptr) {
+            EXPECT_EQ(nullptr, params.ParamBuffers()[idx]) << "Null parameter";
+        } else {
+            EXPECT_EQ(
+                std::string_view(expected.ParamBuffers()[idx], expected.ParamLengthsBuffer()[idx]),
+                std::string_view(params.ParamBuffers()[idx], params.ParamLengthsBuffer()[idx])
+            );
+        }
+    }
+    EXPECT_EQ(2 + 4 + 3, params.BufferSize()) << "Values are written to a single buffer";
+}
+
+TEST(PostgreIO, OutputTypedSharedOids) {
+    const pg::detail::TypedQueryParameters<pg::Integer, double> first{types, 1, 2.0};
+    const pg::detail::TypedQueryParameters<pg::Integer, double> second{types, 3, 4.0};
+
+    EXPECT_EQ(first.ParamTypesBuffer(), second.ParamTypesBuffer()) << "Oids of system types are computed once";
+    EXPECT_EQ(static_cast<pg::Oid>(pg::io::PredefinedOids::kInt4), first.ParamTypesBuffer()[0]);
+    EXPECT_EQ(static_cast<pg::Oid>(pg::io::PredefinedOids::kFloat8), first.ParamTypesBuffer()[1]);
+}
+
+TEST(PostgreIO, OutputTypedLargeValues) {
+    const std::string large(pg::detail::kTypedQueryInlineBufferSize * 2, 'a');
+    const boost::uuids::uuid uuid{};
+    formats::json::ValueBuilder json;
+    json["key"] = "value";
+
+    const pg::detail::TypedQueryParameters<std::string, boost::uuids::uuid, formats::json::Value> params{
+        types, large, uuid, json.ExtractValue()};
+
+    ASSERT_EQ(3, params.Size());
+    EXPECT_EQ(large.size(), params.ParamLengthsBuffer()[0]);
+    EXPECT_EQ(large, std::string_view(params.ParamBuffers()[0], params.ParamLengthsBuffer()[0]));
+    EXPECT_EQ(16, params.ParamLengthsBuffer()[1]);
+    EXPECT_EQ(
+        R"({"key":"value"})",
+        std::string_view(params.ParamBuffers()[2], params.ParamLengthsBuffer()[2]).substr(1)
+    ) << "Jsonb version is the first byte";
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <userver/storages/postgres/read_your_writes.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <storages/postgres/detail/read_your_writes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+TEST(PostgreReadYourWrites, LsnText) {
+    EXPECT_EQ(pg::detail::LsnToString(pg::Lsn{0x16B374D848}), "16/B374D848");
+    EXPECT_EQ(pg::detail::LsnToString(pg::kUnknownLsn), "0/0");
+
+    EXPECT_EQ(pg::detail::ParseLsn("16/B374D848"), pg::Lsn{0x16B374D848});
+    EXPECT_EQ(pg::detail::ParseLsn("FFFFFFFF/FFFFFFFF"), pg::Lsn{0xFFFFFFFFFFFFFFFF});
+    EXPECT_EQ(pg::detail::ParseLsn("16"), std::nullopt);
+    EXPECT_EQ(pg::detail::ParseLsn("16/"), std::nullopt);
+    EXPECT_EQ(pg::detail::ParseLsn("/16"), std::nullopt);
+    EXPECT_EQ(pg::detail::ParseLsn("16/XYZ"), std::nullopt);
+    EXPECT_EQ(pg::detail::ParseLsn("100000000/0"), std::nullopt);
+}
+
+UTEST(PostgreReadYourWrites, NoWrites) {
+    EXPECT_EQ(pg::GetReadYourWritesToken(), "");
+    EXPECT_EQ(pg::detail::GetRequiredLsn("db:0"), pg::kUnknownLsn);
+}
+
+UTEST(PostgreReadYourWrites, LsnNeverGoesBack) {
+    const auto key = pg::detail::MakeReadYourWritesKey("db", 0);
+    pg::detail::RememberCommitLsn(key, pg::Lsn{20});
+    pg::detail::RememberCommitLsn(key, pg::Lsn{10});
+    EXPECT_EQ(pg::detail::GetRequiredLsn(key), pg::Lsn{20});
+    EXPECT_EQ(pg::detail::GetRequiredLsn(pg::detail::MakeReadYourWritesKey("db", 1)), pg::kUnknownLsn);
+}
+
+UTEST(PostgreReadYourWrites, Subtasks) {
+    pg::detail::RememberCommitLsn("db:0", pg::Lsn{10});
+
+    engine::AsyncNoSpan([] {
+        EXPECT_EQ(pg::detail::GetRequiredLsn("db:0"), pg::Lsn{10});
+        // Does not affect the parent
+        pg::detail::RememberCommitLsn("db:0", pg::Lsn{20});
+        EXPECT_EQ(pg::detail::GetRequiredLsn("db:0"), pg::Lsn{20});
+    }).Get();
+
+    EXPECT_EQ(pg::detail::GetRequiredLsn("db:0"), pg::Lsn{10});
+}
+
+UTEST(PostgreReadYourWrites, Token) {
+    pg::detail::RememberCommitLsn("db:0", pg::Lsn{0x1000000AB});
+    pg::detail::RememberCommitLsn("other:1", pg::Lsn{0xCD});
+    EXPECT_EQ(pg::GetReadYourWritesToken(), "db:0=1/AB,other:1=0/CD");
+}
+
+UTEST(PostgreReadYourWrites, SetToken) {
+    // The token came from another service
+    pg::SetReadYourWritesToken("db:0=1/AB,other:1=0/CD");
+    EXPECT_EQ(pg::detail::GetRequiredLsn("db:0"), pg::Lsn{0x1000000AB});
+    EXPECT_EQ(pg::detail::GetRequiredLsn("other:1"), pg::Lsn{0xCD});
+    EXPECT_EQ(pg::GetReadYourWritesToken(), "db:0=1/AB,other:1=0/CD");
+}
+
+UTEST(PostgreReadYourWrites, TokenMerge) {
+    pg::detail::RememberCommitLsn("db:0", pg::Lsn{0x20});
+    pg::SetReadYourWritesToken("db:0=0/10,db:1=0/30");
+    EXPECT_EQ(pg::detail::GetRequiredLsn("db:0"), pg::Lsn{0x20});
+    EXPECT_EQ(pg::detail::GetRequiredLsn("db:1"), pg::Lsn{0x30});
+}
+
+UTEST(PostgreReadYourWrites, MalformedToken) {
+    pg::SetReadYourWritesToken("garbage,=0/10,db:0=1/,db:1=0/10,,db:2");
+    EXPECT_EQ(pg::GetReadYourWritesToken(), "db:1=0/10");
+
+    pg::SetReadYourWritesToken("");
+    EXPECT_EQ(pg::GetReadYourWritesToken(), "db:1=0/10");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,124 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+std::size_t ExecuteStreamed(
+    pg::detail::ConnectionPtr& conn,
+    const pg::Query& query,
+    std::size_t chunk_size,
+    pg::ResultChunkConsumer consumer
+) {
+    return conn->ExecuteStreamed(query, {}, chunk_size, consumer, {});
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, StreamedResult) {
+    CheckConnection(GetConn());
+
+    constexpr std::size_t kChunkSize = 64;
+    std::vector<int> ids;
+    std::size_t chunks_count = 0;
+    const auto rows_count = ExecuteStreamed(
+        GetConn(),
+        "SELECT i, 'value ' || i AS value FROM generate_series(1, 1000) i",
+        kChunkSize,
+        [&](pg::ResultSet&& chunk) {
+            EXPECT_LE(chunk.Size(), kChunkSize);
+            EXPECT_EQ(chunk.FieldCount(), 2);
+            ++chunks_count;
+            for (auto row : chunk) {
+                const auto [id, value] = row.As<int, std::string>();
+                EXPECT_EQ(value, "value " + std::to_string(id));
+                ids.push_back(id);
+            }
+        }
+    );
+
+    EXPECT_EQ(rows_count, 1000);
+    EXPECT_GE(chunks_count, 1000 / kChunkSize);
+    ASSERT_EQ(ids.size(), 1000);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        EXPECT_EQ(ids[i], static_cast<int>(i + 1));
+    }
+
+    // The connection is usable after the streamed result
+    UEXPECT_NO_THROW(GetConn()->Execute("SELECT 1"));
+}
+
+UTEST_P(PostgreConnection, StreamedResultParameters) {
+    CheckConnection(GetConn());
+
+    pg::ParameterStore params;
+    params.PushBack(10).PushBack(std::string{"foo"});
+
+    std::size_t rows_count = 0;
+    GetConn()->ExecuteStreamed(
+        "SELECT $2::text FROM generate_series(1, $1)",
+        pg::detail::QueryParameters{params.GetInternalData()},
+        pg::kDefaultStreamedChunkSize,
+        [&rows_count](pg::ResultSet&& chunk) {
+            for (auto row : chunk) {
+                EXPECT_EQ(row.As<std::string>(), "foo");
+                ++rows_count;
+            }
+        },
+        {}
+    );
+    EXPECT_EQ(rows_count, 10);
+}
+
+UTEST_P(PostgreConnection, StreamedResultEmpty) {
+    CheckConnection(GetConn());
+
+    bool is_called = false;
+    const auto consumer = [&is_called](pg::ResultSet&&) { is_called = true; };
+    EXPECT_EQ(ExecuteStreamed(GetConn(), "SELECT 1 WHERE false", 10, consumer), 0);
+    EXPECT_FALSE(is_called);
+
+    EXPECT_EQ(ExecuteStreamed(GetConn(), "CREATE TEMPORARY TABLE streamed_test(id integer)", 10, consumer), 0);
+    EXPECT_FALSE(is_called);
+}
+
+UTEST_P(PostgreConnection, StreamedResultServerError) {
+    CheckConnection(GetConn());
+
+    UEXPECT_THROW(
+        ExecuteStreamed(GetConn(), "SELECT 1 / (500 - i) FROM generate_series(1, 1000) i", 10, [](pg::ResultSet&&) {}),
+        pg::Error
+    );
+
+    // The rest of the results are read, the connection can be reused
+    EXPECT_FALSE(GetConn()->IsBroken());
+    UEXPECT_NO_THROW(GetConn()->Execute("SELECT 1"));
+}
+
+UTEST_P(PostgreConnection, StreamedResultConsumerError) {
+    CheckConnection(GetConn());
+
+    UEXPECT_THROW(
+        ExecuteStreamed(
+            GetConn(),
+            "SELECT i FROM generate_series(1, 1000) i",
+            10,
+            [](pg::ResultSet&&) { throw std::runtime_error{"consumer failed"}; }
+        ),
+        std::runtime_error
+    );
+
+    // The rest of the rows were not read
+    EXPECT_TRUE(GetConn()->IsBroken());
+}
+
+USERVER_NAMESPACE_END
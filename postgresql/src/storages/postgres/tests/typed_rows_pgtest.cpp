@@ -218,6 +218,46 @@ UTEST_P(PostgreConnection, TypedResultTupleSample) {
     /// [RowTagSippet]
 }
 
+UTEST_P(PostgreConnection, TypedResultParallelDecoding) {
+    using MyTuple = std::tuple<int, std::string, std::optional<double>>;
+    using MyStruct = static_test::MyStructWithOptional;
+
+    CheckConnection(GetConn());
+    const auto res = GetConn()->Execute(
+        "select i, i::text, case when i % 2 = 0 then i::double precision end from generate_series(1, 1000) i"
+    );
+
+    const auto expected = res.AsContainer<std::vector<MyTuple>>(pg::kRowTag);
+    ASSERT_EQ(expected.size(), 1000);
+    EXPECT_EQ(expected[1], MyTuple(2, "2", 2.0));
+    EXPECT_EQ(expected[2], MyTuple(3, "3", std::nullopt));
+
+    for (std::size_t rows_per_task : {0, 1, 7, 999, 1000, 5000}) {
+        EXPECT_EQ(
+            res.AsContainer<std::vector<MyTuple>>(pg::kRowTag, pg::ParallelDecoding{rows_per_task}), expected
+        );
+    }
+
+    const auto tuple_set = res.AsContainer<std::set<MyTuple>>(pg::kRowTag, pg::ParallelDecoding{100});
+    EXPECT_EQ(tuple_set, std::set<MyTuple>(expected.begin(), expected.end()));
+
+    const auto structs = res.AsContainer<std::deque<MyStruct>>(pg::kRowTag, pg::ParallelDecoding{100});
+    ASSERT_EQ(structs.size(), expected.size());
+    EXPECT_EQ(structs.back().int_member, 1000);
+
+    const auto ints = GetConn()->Execute("select i from generate_series(1, 1000) i");
+    const auto int_vec = ints.AsContainer<std::vector<int>>(pg::ParallelDecoding{100});
+    ASSERT_EQ(int_vec.size(), 1000);
+    EXPECT_EQ(int_vec[999], 1000);
+
+    using TooBigTuple = std::tuple<int, std::string, double, int>;
+    UEXPECT_THROW(
+        res.AsContainer<std::vector<TooBigTuple>>(pg::kRowTag, pg::ParallelDecoding{100}), pg::InvalidTupleSizeRequested
+    );
+    const auto nulls = GetConn()->Execute("select null::integer from generate_series(1, 1000)");
+    UEXPECT_THROW(nulls.AsContainer<std::vector<int>>(pg::ParallelDecoding{100}), pg::FieldValueIsNull);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
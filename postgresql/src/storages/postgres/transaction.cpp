@@ -27,6 +27,10 @@ Transaction::Transaction(
 
 void Transaction::SetName(std::string name) { name_ = std::move(name); }
 
+void Transaction::SetAfterCommitHook(std::function<void(detail::Connection&)> hook) {
+    after_commit_hook_ = std::move(hook);
+}
+
 Transaction::Transaction(Transaction&&) noexcept = default;
 
 Transaction::~Transaction() {
@@ -81,6 +85,58 @@ ResultSet Transaction::DoExecute(
     }
 }
 
+std::size_t Transaction::DoCopyIn(
+    const Query& query,
+    detail::CopyInChunkProducer producer,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyIn called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    detail::StatementStats stats{query, conn_};
+    try {
+        auto rows = conn_->CopyIn(query, producer, std::move(statement_cmd_ctl));
+        stats.AccountStatementExecution();
+        return rows;
+    } catch (const std::exception& e) {
+        stats.AccountStatementError();
+        throw;
+    }
+}
+
+std::size_t Transaction::DoCopyOut(
+    const Query& query,
+    detail::CopyOutRowConsumer consumer,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyOut called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    detail::StatementStats stats{query, conn_};
+    try {
+        auto rows = conn_->CopyOut(query, consumer, std::move(statement_cmd_ctl));
+        stats.AccountStatementExecution();
+        return rows;
+    } catch (const std::exception& e) {
+        stats.AccountStatementError();
+        throw;
+    }
+}
+
 Portal Transaction::MakePortal(
     const PortalName& portal_name,
     const Query& query,
@@ -131,6 +187,7 @@ void Transaction::Commit() {
         conn_->Commit();
         // in case of exception inside commit let it fly and don't release the
         // connection holder to allow for rolling back later
+        if (after_commit_hook_) after_commit_hook_(*conn_);
         conn_ = detail::ConnectionPtr{nullptr};
     } else {
         LOG_LIMITED_ERROR() << "Commit after transaction finished" << logging::LogExtra::Stacktrace();
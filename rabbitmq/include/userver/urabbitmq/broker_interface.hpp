@@ -4,6 +4,7 @@
 /// @brief A bunch of interface classes
 
 #include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/flags.hpp>
@@ -166,6 +167,35 @@ public:
         engine::Deadline deadline
     ) = 0;
 
+    /// @brief Publish a batch of messages to an exchange and
+    /// await confirmation of all of them from the broker
+    ///
+    /// The messages are published back to back without waiting for the
+    /// confirmations of the previous ones, and the broker is free to confirm
+    /// them all at once, which is much faster than a PublishReliable per
+    /// message. If any of the messages is not confirmed, the whole batch is
+    /// considered failed, although some of the messages might be delivered.
+    ///
+    /// @param exchange the exchange to publish to
+    /// @param routing_key the routing key
+    /// @param messages the messages to send
+    /// @param deadline execution deadline
+    virtual void PublishReliableBatch(
+        const Exchange& exchange,
+        const std::string& routing_key,
+        const std::vector<std::string>& messages,
+        MessageType type,
+        engine::Deadline deadline
+    ) = 0;
+
+    /// @brief overload of PublishReliableBatch
+    virtual void PublishReliableBatch(
+        const Exchange& exchange,
+        const std::string& routing_key,
+        const std::vector<std::string>& messages,
+        engine::Deadline deadline
+    ) = 0;
+
 protected:
     ~IReliableChannelInterface();
 };
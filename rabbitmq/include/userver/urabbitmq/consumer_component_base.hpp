@@ -38,6 +38,8 @@ namespace urabbitmq {
 /// rabbit_name      | Name of the RabbitMQ component to use for consumption
 /// queue            | Name of the queue to consume from
 /// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// max_prefetch_count | if greater than prefetch_count, the prefetch grows at runtime up to this value, 0 by default
+/// ack_batch_size   | maximum number of messages acknowledged with a single `basic.ack multiple`, 1 by default
 ///
 // clang-format on
 class ConsumerComponentBase : public components::ComponentBase {
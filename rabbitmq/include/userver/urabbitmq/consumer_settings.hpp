@@ -24,6 +24,17 @@ struct ConsumerSettings final {
     /// Settings this value to 1 basically makes a consumer synchronous, which
     /// could be of use for some workloads
     std::uint16_t prefetch_count;
+
+    /// If greater than `prefetch_count`, the prefetch is adjusted at runtime
+    /// up to this value: it grows while all the prefetched messages are being
+    /// processed and the throughput doesn't degrade
+    std::uint16_t max_prefetch_count{0};
+
+    /// Maximum number of processed messages acknowledged at once with a
+    /// single `basic.ack multiple`. Messages are acknowledged in the order of
+    /// delivery, so a slow message delays the acks of the following ones.
+    /// 1 means that every message is acknowledged as soon as it's processed.
+    std::size_t ack_batch_size{1};
 };
 
 }  // namespace urabbitmq
@@ -1,5 +1,6 @@
 #include "utils_rmqtest.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <userver/engine/sleep.hpp>
@@ -153,6 +154,50 @@ UTEST(Consumer, ExhaustesQueue) {
     consumer.Wait();
 }
 
+UTEST(Consumer, PublishReliableBatchWorks) {
+    ClientWrapper client{};
+    client.SetupRmqEntities();
+    const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+    const size_t messages_count = 1000;
+    std::vector<std::string> messages;
+    for (size_t i = 0; i < messages_count; ++i) messages.push_back(std::to_string(i));
+    client->PublishReliableBatch(
+        client.GetExchange(), client.GetRoutingKey(), messages, urabbitmq::MessageType::kTransient, client.GetDeadline()
+    );
+
+    Consumer consumer{client.Get(), settings};
+    consumer.ExpectConsume(messages_count);
+    consumer.Start();
+
+    auto consumed = consumer.Wait();
+    std::sort(consumed.begin(), consumed.end());
+    std::sort(messages.begin(), messages.end());
+    EXPECT_EQ(consumed, messages);
+}
+
+UTEST(Consumer, BatchedAcksWork) {
+    ClientWrapper client{};
+    client.SetupRmqEntities();
+    const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10, 100, 20};
+
+    const size_t messages_count = 1000;
+    std::vector<std::string> messages;
+    for (size_t i = 0; i < messages_count; ++i) messages.push_back(std::to_string(i));
+    client->PublishReliableBatch(
+        client.GetExchange(), client.GetRoutingKey(), messages, urabbitmq::MessageType::kTransient, client.GetDeadline()
+    );
+
+    Consumer consumer{client.Get(), settings};
+    consumer.ExpectConsume(messages_count);
+    consumer.Start();
+
+    auto consumed = consumer.Wait();
+    std::sort(consumed.begin(), consumed.end());
+    std::sort(messages.begin(), messages.end());
+    EXPECT_EQ(consumed, messages);
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
     ClientWrapper client{};
     client.SetupRmqEntities();
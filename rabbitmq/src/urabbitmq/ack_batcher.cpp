@@ -0,0 +1,60 @@
+#include <urabbitmq/ack_batcher.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <urabbitmq/impl/amqp_channel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+AckBatcher::AckBatcher(impl::AmqpChannel& channel, std::size_t batch_size)
+    : channel_{channel}, batch_size_{std::max<std::size_t>(batch_size, 1)} {}
+
+void AckBatcher::SetBatchSize(std::size_t batch_size) { batch_size_ = std::max<std::size_t>(batch_size, 1); }
+
+void AckBatcher::Ack(std::uint64_t delivery_tag, bool is_idle) { Settle(delivery_tag, true, is_idle); }
+
+void AckBatcher::Reject(std::uint64_t delivery_tag, bool is_idle) {
+    // Requeued messages are not acknowledged by `multiple`, reject them right
+    // away so that other consumers could pick them up
+    channel_.Reject(delivery_tag, true, {});
+    Settle(delivery_tag, false, is_idle);
+}
+
+void AckBatcher::Flush() {
+    std::lock_guard lock{mutex_};
+    DoFlush();
+}
+
+void AckBatcher::Settle(std::uint64_t delivery_tag, bool success, bool is_idle) {
+    // Acks are sent under the lock, as a `multiple` ack of an already
+    // acknowledged tag is a channel error
+    std::lock_guard lock{mutex_};
+
+    settled_.emplace(delivery_tag, success);
+    while (!settled_.empty() && settled_.begin()->first == next_delivery_tag_) {
+        if (settled_.begin()->second) {
+            pending_ack_tag_ = next_delivery_tag_;
+            ++pending_acks_;
+        }
+        settled_.erase(settled_.begin());
+        ++next_delivery_tag_;
+    }
+
+    if (pending_acks_ >= batch_size_.load() || is_idle) DoFlush();
+}
+
+void AckBatcher::DoFlush() {
+    if (pending_ack_tag_ == last_acked_tag_) return;
+
+    channel_.Ack(pending_ack_tag_, {}, /*multiple=*/true);
+    last_acked_tag_ = pending_ack_tag_;
+    for (std::size_t i = 0; i < pending_acks_; ++i) channel_.AccountMessageConsumed();
+    pending_acks_ = 0;
+}
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
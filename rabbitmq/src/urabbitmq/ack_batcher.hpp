@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+namespace impl {
+class AmqpChannel;
+}
+
+// Acknowledges the consumed messages with `basic.ack multiple`. Messages are
+// processed concurrently and complete out of order, so only the contiguous
+// prefix of the settled delivery tags is acknowledged.
+class AckBatcher final {
+public:
+    AckBatcher(impl::AmqpChannel& channel, std::size_t batch_size);
+
+    void SetBatchSize(std::size_t batch_size);
+
+    // `is_idle` tells that no other messages are being processed, so nothing
+    // else would trigger the acknowledgement of the pending ones
+    void Ack(std::uint64_t delivery_tag, bool is_idle);
+    void Reject(std::uint64_t delivery_tag, bool is_idle);
+
+    void Flush();
+
+private:
+    void Settle(std::uint64_t delivery_tag, bool success, bool is_idle);
+    void DoFlush();
+
+    impl::AmqpChannel& channel_;
+    std::atomic<std::size_t> batch_size_;
+
+    engine::Mutex mutex_;
+    // Delivery tags of a channel start from 1 and are consecutive
+    std::uint64_t next_delivery_tag_{1};
+    // Settled tags that follow an unsettled one, the value is the success
+    std::map<std::uint64_t, bool> settled_;
+    std::uint64_t last_acked_tag_{0};
+    std::uint64_t pending_ack_tag_{0};
+    std::size_t pending_acks_{0};
+};
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
@@ -88,6 +88,19 @@ void Client::PublishReliable(
     awaiter.Wait(deadline);
 }
 
+void Client::PublishReliableBatch(
+    const Exchange& exchange,
+    const std::string& routing_key,
+    const std::vector<std::string>& messages,
+    MessageType type,
+    engine::Deadline deadline
+) {
+    auto awaiter = ConnectionHelper::PublishReliableBatch(
+        impl_->GetConnection(deadline), exchange, routing_key, messages, type, deadline
+    );
+    awaiter.Wait(deadline);
+}
+
 AdminChannel Client::GetAdminChannel(engine::Deadline deadline) { return {impl_->GetConnection(deadline)}; }
 
 Channel Client::GetChannel(engine::Deadline deadline) { return {impl_->GetConnection(deadline)}; }
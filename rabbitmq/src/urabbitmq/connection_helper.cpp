@@ -85,6 +85,19 @@ impl::ResponseAwaiter ConnectionHelper::PublishReliable(
     });
 }
 
+impl::ResponseAwaiter ConnectionHelper::PublishReliableBatch(
+    const ConnectionPtr& connection,
+    const Exchange& exchange,
+    const std::string& routing_key,
+    const std::vector<std::string>& messages,
+    MessageType type,
+    engine::Deadline deadline
+) {
+    return WithSpan("reliable_publish_batch", [&] {
+        return connection->GetReliableChannel().PublishBatch(exchange, routing_key, messages, type, deadline);
+    });
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
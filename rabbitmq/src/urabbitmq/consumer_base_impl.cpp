@@ -1,5 +1,6 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
 #include <string>
 
 #include <fmt/format.h>
@@ -20,6 +21,14 @@ namespace urabbitmq {
 namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
+constexpr std::chrono::milliseconds kPrefetchTuningInterval{1000};
+constexpr std::chrono::milliseconds kSetQosTimeout{500};
+
+// Acks are held back while the messages occupy the prefetch window, so a
+// batch should leave room for the new deliveries
+std::size_t GetAckBatchSize(std::size_t ack_batch_size, uint16_t prefetch_count) {
+    return std::min<std::size_t>(ack_batch_size, std::max(prefetch_count / 2, 1));
+}
 
 }  // namespace
 
@@ -27,18 +36,26 @@ ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection, const ConsumerSet
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
       prefetch_count_{settings.prefetch_count},
+      ack_batch_size_{settings.ack_batch_size},
       connection_ptr_{std::move(connection)},
       channel_{connection_ptr_->GetChannel()} {
     // We take ownership of the connection, because if it remains pooled
     // things get messy with lifetimes and callbacks
     connection_ptr_.Adopt();
+
+    if (ack_batch_size_ > 1) {
+        ack_batcher_.emplace(channel_, GetAckBatchSize(ack_batch_size_, prefetch_count_));
+    }
+    if (settings.max_prefetch_count > settings.prefetch_count) {
+        prefetch_tuner_.emplace(settings.prefetch_count, settings.max_prefetch_count);
+    }
 }
 
 ConsumerBaseImpl::~ConsumerBaseImpl() { Stop(); }
 
 void ConsumerBaseImpl::Start(DispatchCallback cb) {
     const auto start_deadline = engine::Deadline::FromDuration(kStartTimeout);
-    channel_.SetQos(prefetch_count_, start_deadline);
+    channel_.SetQos(prefetch_count_, start_deadline, /*per_channel=*/prefetch_tuner_.has_value());
 
     dispatch_callback_ = std::move(cb);
 
@@ -65,11 +82,16 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
         start_deadline
     );
 
+    if (prefetch_tuner_) {
+        prefetch_tuner_task_.Start("rabbitmq_prefetch_tuner", {kPrefetchTuningInterval}, [this] { TunePrefetch(); });
+    }
+
     LOG_INFO() << "Started a consumer for '" << queue_name_ << "' queue";
 }
 
 void ConsumerBaseImpl::Stop() {
     stopped_ = true;
+    prefetch_tuner_task_.Stop();
     try {
         channel_.CancelConsumer(consumer_tag_);
     } catch (const std::exception&) {
@@ -79,6 +101,14 @@ void ConsumerBaseImpl::Stop() {
     // Cancel all the active dispatched tasks
     bts_.CancelAndWait();
 
+    if (ack_batcher_) {
+        try {
+            ack_batcher_->Flush();
+        } catch (const std::exception&) {
+            // The messages will be redelivered, nothing we can do about it
+        }
+    }
+
     // Destroy the connection: at this point all the remaining tasks are stopped,
     // consumer is either stopped or in unknown state - that could happen if we
     // didn't receive onSuccess callback yet.
@@ -98,6 +128,10 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
     consumed.metadata.exchange = message.exchange();
     consumed.metadata.routingKey = message.routingkey();
 
+    if (++in_flight_ >= prefetch_count_.load(std::memory_order_relaxed)) {
+        saturated_.store(true, std::memory_order_relaxed);
+    }
+
     bts_.Detach(engine::AsyncNoSpan(
         dispatcher_,
         [this,
@@ -115,21 +149,49 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
                 LOG_ERROR() << "Failed to process the consumed message, " << ex.what() << "; would requeue";
             }
 
-            try {
-                if (success) {
-                    channel_.Ack(delivery_tag, {});
-                    channel_.AccountMessageConsumed();
-                } else {
-                    channel_.Reject(delivery_tag, true, {});
-                }
-            } catch (const std::exception& ex) {
-                LOG_WARNING() << "Failed to " << (success ? "ack" : "requeue")
-                              << " the message, it will be requeued by RabbitMQ at some point";
-            }
+            Settle(delivery_tag, success);
         }
     ));
 }
 
+void ConsumerBaseImpl::Settle(uint64_t delivery_tag, bool success) {
+    const bool is_idle = --in_flight_ == 0;
+    processed_.fetch_add(1, std::memory_order_relaxed);
+
+    try {
+        if (ack_batcher_) {
+            if (success) {
+                ack_batcher_->Ack(delivery_tag, is_idle);
+            } else {
+                ack_batcher_->Reject(delivery_tag, is_idle);
+            }
+        } else if (success) {
+            channel_.Ack(delivery_tag, {});
+            channel_.AccountMessageConsumed();
+        } else {
+            channel_.Reject(delivery_tag, true, {});
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to " << (success ? "ack" : "requeue")
+                      << " the message, it will be requeued by RabbitMQ at some point";
+    }
+}
+
+void ConsumerBaseImpl::TunePrefetch() {
+    UASSERT(prefetch_tuner_);
+    const auto processed = processed_.exchange(0, std::memory_order_relaxed);
+    const auto saturated = saturated_.exchange(false, std::memory_order_relaxed);
+
+    const auto new_prefetch = prefetch_tuner_->OnInterval(processed, saturated);
+    if (!new_prefetch) return;
+
+    LOG_INFO() << "Changing prefetch_count of the consumer for '" << queue_name_ << "' queue from "
+               << prefetch_count_.load() << " to " << *new_prefetch;
+    channel_.SetQos(*new_prefetch, engine::Deadline::FromDuration(kSetQosTimeout), /*per_channel=*/true);
+    prefetch_count_ = *new_prefetch;
+    if (ack_batcher_) ack_batcher_->SetBatchSize(GetAckBatchSize(ack_batch_size_, *new_prefetch));
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
 
+#include <urabbitmq/ack_batcher.hpp>
 #include <urabbitmq/connection_ptr.hpp>
+#include <urabbitmq/prefetch_tuner.hpp>
 
 #include <userver/urabbitmq/consumer_settings.hpp>
 
@@ -33,10 +37,13 @@ public:
 private:
     void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
     void Stop();
+    void Settle(uint64_t delivery_tag, bool success);
+    void TunePrefetch();
 
     engine::TaskProcessor& dispatcher_;
     const std::string queue_name_;
-    uint16_t prefetch_count_;
+    std::atomic<uint16_t> prefetch_count_;
+    const std::size_t ack_batch_size_;
 
     ConnectionPtr connection_ptr_;
     impl::AmqpChannel& channel_;
@@ -45,6 +52,14 @@ private:
 
     DispatchCallback dispatch_callback_;
 
+    std::optional<AckBatcher> ack_batcher_;
+    std::optional<PrefetchTuner> prefetch_tuner_;
+    utils::PeriodicTask prefetch_tuner_task_;
+
+    std::atomic<std::size_t> in_flight_{0};
+    std::atomic<std::size_t> processed_{0};
+    std::atomic<bool> saturated_{false};
+
     std::atomic<bool> stopped_{false};
 
     // Underlying channel errored, just restart the consumer
@@ -17,6 +17,8 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config, formats::parse::To
     ConsumerSettings settings;
     settings.queue = Queue{config["queue"].As<std::string>()};
     settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
+    settings.max_prefetch_count = config["max_prefetch_count"].As<uint16_t>(0);
+    settings.ack_batch_size = config["ack_batch_size"].As<std::size_t>(1);
 
     UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
 
@@ -81,6 +83,15 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    max_prefetch_count:
+        type: integer
+        description: if greater than prefetch_count, the prefetch is tuned at runtime up to this value
+        defaultDescription: 0
+    ack_batch_size:
+        type: integer
+        description: maximum number of messages acknowledged at once
+        defaultDescription: 1
+        minimum: 1
 )");
 }
 
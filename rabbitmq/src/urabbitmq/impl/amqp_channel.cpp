@@ -1,5 +1,6 @@
 #include "amqp_channel.hpp"
 
+#include <atomic>
 #include <optional>
 
 #include <userver/engine/task/task.hpp>
@@ -185,10 +186,10 @@ void AmqpChannel::Publish(
     // We don't account publish here, because there's no way to ensure success
 }
 
-void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
+void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline, bool multiple) {
     // No way to acknowledge success, no way to handle synchronous errors
     auto channel = conn_.GetChannel(deadline);
-    channel->ack(delivery_tag);
+    channel->ack(delivery_tag, multiple ? AMQP::multiple : 0);
 }
 
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline) {
@@ -197,12 +198,13 @@ void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue, engine::Deadline d
     channel->reject(delivery_tag, requeue ? AMQP::requeue : 0);
 }
 
-void AmqpChannel::SetQos(uint16_t prefetch_count, engine::Deadline deadline) {
+void AmqpChannel::SetQos(uint16_t prefetch_count, engine::Deadline deadline, bool per_channel) {
     auto deferred = DeferredWrapper::Create();
 
     {
         auto channel = conn_.GetChannel(deadline);
-        deferred->Wrap(channel->setQos(prefetch_count));
+        // RabbitMQ reinterprets `global` as a per-channel limit
+        deferred->Wrap(channel->setQos(prefetch_count, per_channel));
     }
 
     deferred->Wait(deadline);
@@ -262,6 +264,43 @@ ResponseAwaiter AmqpReliableChannel::Publish(
     return awaiter;
 }
 
+ResponseAwaiter AmqpReliableChannel::PublishBatch(
+    const Exchange& exchange,
+    const std::string& routing_key,
+    const std::vector<std::string>& messages,
+    MessageType type,
+    engine::Deadline deadline
+) {
+    const auto headers = CreateHeaders();
+    auto awaiter = conn_.GetAwaiter(deadline);
+    if (messages.empty()) {
+        awaiter.GetWrapper()->Ok();
+        return awaiter;
+    }
+
+    auto pending = std::make_shared<std::atomic<std::size_t>>(messages.size());
+    {
+        auto reliable = conn_.GetReliableChannel(deadline);
+
+        // The frames are pipelined, the broker acknowledges them with cumulative
+        // (multiple=true) acks which the tagger unrolls into per-message callbacks
+        for (const auto& message : messages) {
+            AMQP::Envelope envelope{message.data(), message.size()};
+            envelope.setPersistent(type == MessageType::kPersistent);
+            envelope.setHeaders(headers);
+
+            reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
+                .onAck([this, pending, deferred = awaiter.GetWrapper()] {
+                    AccountMessagePublished();
+                    if (pending->fetch_sub(1) == 1) deferred->Ok();
+                })
+                .onError([deferred = awaiter.GetWrapper()](const char* error) { deferred->Fail(error); });
+        }
+    }
+
+    return awaiter;
+}
+
 void AmqpReliableChannel::AccountMessagePublished() { conn_.GetStatistics().AccountMessagePublished(); }
 
 }  // namespace urabbitmq::impl
@@ -2,6 +2,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
@@ -16,6 +18,7 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace urabbitmq {
+class AckBatcher;
 class ConsumerBaseImpl;
 
 namespace statistics {
@@ -60,11 +63,13 @@ public:
         engine::Deadline deadline
     );
 
-    void Ack(uint64_t delivery_tag, engine::Deadline deadline);
+    void Ack(uint64_t delivery_tag, engine::Deadline deadline, bool multiple = false);
 
     void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
-    void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
+    // `per_channel` limit could be changed while the consumer is running,
+    // the per-consumer one applies only to the consumers started afterwards
+    void SetQos(uint16_t prefetch_count, engine::Deadline deadline, bool per_channel = false);
 
     using ErrorCb = std::function<void(const char*)>;
     using SuccessCb = std::function<void(const std::string&)>;
@@ -82,6 +87,7 @@ public:
 private:
     void AccountMessageConsumed();
 
+    friend class urabbitmq::AckBatcher;
     friend class urabbitmq::ConsumerBaseImpl;
 
     AmqpConnection& conn_;
@@ -100,6 +106,16 @@ public:
         engine::Deadline deadline
     );
 
+    // Publishes all the messages under a single channel lock, the awaiter is
+    // signaled once all of them are confirmed or any of them fails
+    ResponseAwaiter PublishBatch(
+        const Exchange& exchange,
+        const std::string& routing_key,
+        const std::vector<std::string>& messages,
+        MessageType type,
+        engine::Deadline deadline
+    );
+
 private:
     void AccountMessagePublished();
 
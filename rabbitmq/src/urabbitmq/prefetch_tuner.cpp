@@ -0,0 +1,60 @@
+#include <urabbitmq/prefetch_tuner.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+namespace {
+
+// Throughput drop after a growth that is considered a degradation
+constexpr double kDegradationRatio = 0.9;
+// Intervals to wait after a reverted growth before trying again
+constexpr std::size_t kCooldownIntervals = 30;
+
+}  // namespace
+
+PrefetchTuner::PrefetchTuner(std::uint16_t min_prefetch, std::uint16_t max_prefetch)
+    : min_prefetch_{min_prefetch},
+      max_prefetch_{std::max(min_prefetch, max_prefetch)},
+      prefetch_{min_prefetch},
+      previous_prefetch_{min_prefetch} {
+    UINVARIANT(min_prefetch_ > 0, "prefetch_count is set to zero");
+}
+
+std::uint16_t PrefetchTuner::GetPrefetch() const { return prefetch_; }
+
+std::optional<std::uint16_t> PrefetchTuner::OnInterval(std::size_t processed, bool saturated) {
+    const auto previous_processed = std::exchange(previous_processed_, processed);
+
+    if (probing_) {
+        probing_ = false;
+        if (processed < previous_processed * kDegradationRatio) {
+            cooldown_intervals_ = kCooldownIntervals;
+            prefetch_ = previous_prefetch_;
+            return prefetch_;
+        }
+    }
+
+    if (cooldown_intervals_ > 0) {
+        --cooldown_intervals_;
+        return std::nullopt;
+    }
+
+    if (!saturated || prefetch_ >= max_prefetch_) return std::nullopt;
+
+    previous_prefetch_ = prefetch_;
+    prefetch_ = static_cast<std::uint16_t>(
+        std::min<std::size_t>(max_prefetch_, std::max<std::size_t>(prefetch_ + 1, prefetch_ * 3 / 2))
+    );
+    probing_ = true;
+    return prefetch_;
+}
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
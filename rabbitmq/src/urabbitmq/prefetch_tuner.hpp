@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+// Hill climbing over the prefetch count: the prefetch grows while the
+// consumer uses the whole window and the throughput doesn't degrade, and is
+// reverted if it does.
+class PrefetchTuner final {
+public:
+    PrefetchTuner(std::uint16_t min_prefetch, std::uint16_t max_prefetch);
+
+    std::uint16_t GetPrefetch() const;
+
+    // Called periodically with the number of messages processed since the
+    // previous call and whether all of the prefetched messages were being
+    // processed at some point. Returns the new prefetch if it should change.
+    std::optional<std::uint16_t> OnInterval(std::size_t processed, bool saturated);
+
+private:
+    const std::uint16_t min_prefetch_;
+    const std::uint16_t max_prefetch_;
+
+    std::uint16_t prefetch_;
+    std::uint16_t previous_prefetch_;
+    std::size_t previous_processed_{0};
+    bool probing_{false};
+    std::size_t cooldown_intervals_{0};
+};
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
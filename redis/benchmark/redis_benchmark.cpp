@@ -1,10 +1,14 @@
+#include <chrono>
 #include <deque>
 #include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include <storages/redis/client_impl.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/storages/redis/base.hpp>
 #include <userver/utils/rand.hpp>
 #include <utils/gbench_auxilary.hpp>
@@ -67,6 +71,48 @@ BENCHMARK_DEFINE_TEMPLATE_F(Redis, PipelineGrind)(benchmark::State& state) {
     });
 }
 
+// Many coroutines send commands concurrently, compares the ops/s and the count
+// of commands written to a connection per ev loop iteration with and without
+// the commands buffering.
+BENCHMARK_DEFINE_F(Redis, ConcurrentSet)(benchmark::State& state) {
+    RunStandalone([this, &state] {
+        const auto concurrency = state.range(0);
+        const std::chrono::microseconds buffering_interval{state.range(1)};
+        if (buffering_interval.count()) {
+            CommandsBufferingSettings buffering_settings;
+            buffering_settings.buffering_enabled = true;
+            buffering_settings.watch_command_timer_interval = buffering_interval;
+            GetSentinel()->SetCommandsBufferingSettings(buffering_settings);
+        }
+
+        const MetricsSettings metrics_settings;
+        const auto stats_before = GetSentinel()->GetStatistics(metrics_settings).GetShardGroupTotalStatistics();
+
+        const auto client = GetClient();
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(concurrency);
+        for (auto _ : state) {
+            for (auto i = 0; i < concurrency; ++i) {
+                tasks.push_back(engine::AsyncNoSpan([&client, i] {
+                    client->Set("key" + std::to_string(i), "value", {}).Get();
+                }));
+            }
+            for (auto& task : tasks) task.Get();
+            tasks.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * concurrency);
+
+        const auto stats_after = GetSentinel()->GetStatistics(metrics_settings).GetShardGroupTotalStatistics();
+        const auto batches =
+            stats_after.commands_batches.Load().value - stats_before.commands_batches.Load().value;
+        const auto commands =
+            stats_after.batched_commands.Load().value - stats_before.batched_commands.Load().value;
+        state.counters["commands_per_batch"] = batches ? static_cast<double>(commands) / batches : 0;
+    });
+}
+
+BENCHMARK_REGISTER_F(Redis, ConcurrentSet)->Args({64, 0})->Args({64, 100})->Args({256, 0})->Args({256, 100});
+
 BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Ping)->RangeMultiplier(2)->Range(4, 32);
 
 BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Set)->Args({16, 1024})->Args({32, 1024});
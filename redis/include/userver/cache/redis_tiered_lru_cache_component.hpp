@@ -0,0 +1,235 @@
+#pragma once
+
+/// @file userver/cache/redis_tiered_lru_cache_component.hpp
+/// @brief @copybrief cache::RedisTieredLruCacheComponent
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/cache/lru_cache_component_base.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/dump/meta.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl {
+
+struct RedisTierSettings final {
+    /// Prepended to the serialized cache keys
+    std::string key_prefix;
+
+    /// TTL of the values in Redis
+    std::chrono::milliseconds ttl{std::chrono::minutes{10}};
+
+    /// Max count of the values being written to Redis at once, the rest are
+    /// not written
+    std::size_t max_pending_writes{1000};
+
+    /// Command control of the reads, should be small compared to DoGetByKey
+    storages::redis::CommandControl command_control{};
+};
+
+struct RedisTierStatistics final {
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> errors{0};
+    std::atomic<std::uint64_t> writes{0};
+    std::atomic<std::uint64_t> write_errors{0};
+    std::atomic<std::uint64_t> writes_skipped{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const RedisTierStatistics& stats);
+
+/// Shared Redis tier of a cache. Errors are never thrown, they are counted
+/// and treated as misses.
+class RedisTier final {
+public:
+    RedisTier(storages::redis::ClientPtr client, RedisTierSettings settings);
+
+    RedisTier(const components::ComponentConfig& config, const components::ComponentContext& context);
+
+    ~RedisTier();
+
+    std::string MakeKey(std::string_view serialized_key) const;
+
+    std::optional<std::string> Get(const std::string& key);
+
+    /// Writes the value in background
+    void WriteBack(std::string key, std::string value);
+
+    /// The value read from Redis could not be parsed, e.g. the value format
+    /// was changed
+    void AccountParseError() noexcept;
+
+    const RedisTierStatistics& GetStatistics() const noexcept { return stats_; }
+
+private:
+    const storages::redis::ClientPtr client_;
+    const RedisTierSettings settings_;
+    RedisTierStatistics stats_;
+
+    // Must be the last field
+    concurrent::BackgroundTaskStorage write_tasks_;
+};
+
+/// dump::Writer that appends to a string
+class StringWriter final : public dump::Writer {
+public:
+    void Finish() override {}
+
+    std::string Extract() && { return std::move(data_); }
+
+private:
+    void WriteRaw(std::string_view data) override { data_.append(data); }
+
+    std::string data_;
+};
+
+/// dump::Reader that reads from a string
+class StringReader final : public dump::Reader {
+public:
+    explicit StringReader(std::string_view data) : unread_data_(data) {}
+
+    void Finish() override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    std::string_view unread_data_;
+};
+
+template <typename T>
+std::string SerializeForRedis(const T& value) {
+    StringWriter writer;
+    writer.Write(value);
+    writer.Finish();
+    return std::move(writer).Extract();
+}
+
+template <typename T>
+T ParseFromRedis(std::string_view data) {
+    StringReader reader(data);
+    auto value = reader.Read<T>();
+    reader.Finish();
+    return value;
+}
+
+std::string GetRedisTieredLruCacheComponentSchema();
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Base class for LRU-cache components with a second cache tier in
+/// Redis, shared by all the instances of a service
+///
+/// On a miss in the in-process cache::ExpirableLruCache the value is looked
+/// up in Redis, and only then DoGetByKey is called. The values obtained from
+/// DoGetByKey are written to Redis in background. So after a deploy the new
+/// instances warm up from Redis instead of all of them querying the database.
+///
+/// Keys and values are serialized via the @ref scripts/docs/en/userver/cache_dumps.md "dump"
+/// customization points, so both must be dumpable. Make sure to change
+/// `redis-key-prefix` if the serialization format of the values changes.
+///
+/// Redis errors and timeouts are treated as misses.
+///
+/// ## Static options:
+/// All the options of cache::LruCacheComponent and:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// redis-name | name of the Redis database in components::Redis | --
+/// redis-key-prefix | prefix of the Redis keys | `<component name>:`
+/// redis-ttl | TTL of the values in Redis | 10m
+/// redis-timeout | timeout of a single Redis read | 50ms
+/// redis-max-pending-writes | max count of the values being written to Redis at once, the rest are skipped | 1000
+///
+/// ## Statistics:
+/// Along with the cache::LruCacheComponent metrics, `redis-tier.hits`,
+/// `redis-tier.misses`, `redis-tier.errors`, `redis-tier.writes`,
+/// `redis-tier.write-errors` and `redis-tier.writes-skipped` are reported.
+
+// clang-format on
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class RedisTieredLruCacheComponent : public LruCacheComponent<Key, Value, Hash, Equal> {
+    static_assert(
+        dump::kIsDumpable<Key> && dump::kIsDumpable<Value>,
+        "Keys and values of RedisTieredLruCacheComponent must be dumpable"
+    );
+
+public:
+    RedisTieredLruCacheComponent(const components::ComponentConfig& config, const components::ComponentContext& context);
+
+    ~RedisTieredLruCacheComponent() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+protected:
+    Value GetByKey(const Key& key) final;
+
+private:
+    impl::RedisTier redis_tier_;
+
+    // Subscriptions must be the last fields.
+    utils::statistics::Entry statistics_holder_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+RedisTieredLruCacheComponent<Key, Value, Hash, Equal>::RedisTieredLruCacheComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : LruCacheComponent<Key, Value, Hash, Equal>(config, context), redis_tier_(config, context) {
+    statistics_holder_ =
+        impl::RegisterOnStatisticsStorage(context, this->GetName(), [this](utils::statistics::Writer& writer) {
+            writer["redis-tier"] = redis_tier_.GetStatistics();
+        });
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+RedisTieredLruCacheComponent<Key, Value, Hash, Equal>::~RedisTieredLruCacheComponent() {
+    statistics_holder_.Unregister();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value RedisTieredLruCacheComponent<Key, Value, Hash, Equal>::GetByKey(const Key& key) {
+    auto redis_key = redis_tier_.MakeKey(impl::SerializeForRedis(key));
+
+    if (auto data = redis_tier_.Get(redis_key)) {
+        try {
+            return impl::ParseFromRedis<Value>(*data);
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "Failed to parse the value of cache " << this->GetName() << " from Redis: " << ex;
+            redis_tier_.AccountParseError();
+        }
+    }
+
+    auto value = this->DoGetByKey(key);
+    redis_tier_.WriteBack(std::move(redis_key), impl::SerializeForRedis(value));
+    return value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+yaml_config::Schema RedisTieredLruCacheComponent<Key, Value, Hash, Equal>::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<LruCacheComponent<Key, Value, Hash, Equal>>(
+        impl::GetRedisTieredLruCacheComponentSchema()
+    );
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -115,11 +115,14 @@ struct CommandsBufferingSettings {
     bool buffering_enabled{false};
     size_t commands_buffering_threshold{0};
     std::chrono::microseconds watch_command_timer_interval{0};
+    /// Max count of commands in the output buffer of a connection, the rest
+    /// wait until it is written to the socket. 0 means no limit
+    size_t max_batch_size{0};
 
     constexpr bool operator==(const CommandsBufferingSettings& o) const {
         return buffering_enabled == o.buffering_enabled &&
                commands_buffering_threshold == o.commands_buffering_threshold &&
-               watch_command_timer_interval == o.watch_command_timer_interval;
+               watch_command_timer_interval == o.watch_command_timer_interval && max_batch_size == o.max_batch_size;
     }
 };
 
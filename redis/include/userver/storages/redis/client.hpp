@@ -244,6 +244,23 @@ public:
     virtual RequestMset
     Mset(std::vector<std::pair<std::string, std::string>> key_values, const CommandControl& command_control) = 0;
 
+    /// @brief MGET of the keys from any shards.
+    ///
+    /// Keys are grouped by shard (by hash slot in RedisCluster mode) and the
+    /// MGET requests for all the groups are sent in parallel. Values are
+    /// returned in the order of the keys, failures of some groups are reported
+    /// in MgetAcrossShardsReply::errors instead of an exception.
+    RequestMgetAcrossShards MgetAcrossShards(std::vector<std::string> keys, const CommandControl& command_control);
+
+    /// @brief MSET of the keys to any shards.
+    ///
+    /// Same as MgetAcrossShards(), the keys of the failed groups are reported
+    /// in MsetAcrossShardsReply::errors. There is no atomicity across groups.
+    RequestMsetAcrossShards MsetAcrossShards(
+        std::vector<std::pair<std::string, std::string>> key_values,
+        const CommandControl& command_control
+    );
+
     virtual TransactionPtr Multi() = 0;
 
     virtual TransactionPtr Multi(Transaction::CheckShards check_shards) = 0;
@@ -333,6 +350,36 @@ public:
 
     virtual RequestType Type(std::string key, const CommandControl& command_control) = 0;
 
+    virtual RequestXack Xack(
+        std::string key,
+        std::string group,
+        std::vector<std::string> ids,
+        const CommandControl& command_control
+    ) = 0;
+
+    /// Appends an entry with an auto-generated ID, returns the ID
+    virtual RequestXadd Xadd(
+        std::string key,
+        std::vector<std::pair<std::string, std::string>> fields,
+        const CommandControl& command_control
+    ) = 0;
+
+    /// XGROUP CREATE with MKSTREAM, fails with a BUSYGROUP error if the group
+    /// already exists
+    virtual RequestXgroupCreate
+    XgroupCreate(std::string key, std::string group, std::string id, const CommandControl& command_control) = 0;
+
+    /// XREADGROUP of a single stream, `id` is ">" for the new entries or
+    /// an ID to read the pending entries of the consumer after it
+    virtual RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::string id,
+        size_t count,
+        const CommandControl& command_control
+    ) = 0;
+
     virtual RequestZadd
     Zadd(std::string key, double score, std::string member, const CommandControl& command_control) = 0;
 
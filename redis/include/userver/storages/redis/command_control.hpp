@@ -81,6 +81,11 @@ struct CommandControl {
 
         /// Send requests to 'best_dc_count' Redis instances with the min ping
         kNearestServerPing,
+
+        /// Send requests to the less loaded of two random Redis instances,
+        /// the load is estimated by the latency of the recent replies and the
+        /// count of the running commands
+        kAdaptiveLatency,
     };
 
     /// Timeout for a single attempt to execute command
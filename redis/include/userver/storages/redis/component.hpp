@@ -26,6 +26,7 @@ namespace storages {}
 /// Redis client and helpers
 namespace storages::redis {
 
+class ClientSideCache;
 class SubscribeClientImpl;
 
 namespace impl {
@@ -65,6 +66,8 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache_size | max count of keys for the GET, HGET and MGET results cache invalidated via CLIENT TRACKING, 0 to disable; not supported for RedisCluster | 0
+/// groups.[].connections_per_instance | connections to each instance spread across the redis threads; the commands with the same first key share a connection; only for RedisCluster | 1
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -161,6 +164,7 @@ private:
     std::unordered_map<std::string, std::shared_ptr<storages::redis::impl::Sentinel>> sentinels_;
     std::unordered_map<std::string, std::shared_ptr<storages::redis::Client>> clients_;
     std::unordered_map<std::string, std::shared_ptr<storages::redis::SubscribeClientImpl>> subscribe_clients_;
+    std::unordered_map<std::string, std::shared_ptr<storages::redis::ClientSideCache>> client_side_caches_;
 
     dynamic_config::Source config_;
     concurrent::AsyncEventSubscriberScope config_subscription_;
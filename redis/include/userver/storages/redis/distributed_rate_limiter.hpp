@@ -0,0 +1,125 @@
+#pragma once
+
+/// @file userver/storages/redis/distributed_rate_limiter.hpp
+/// @brief @copybrief storages::redis::DistributedRateLimiter
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/utils/token_bucket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief Settings of the storages::redis::DistributedRateLimiter
+struct DistributedRateLimiterSettings final {
+    /// Redis key of the global bucket, shared by all the instances
+    std::string key;
+
+    /// Global refill rate of the bucket, tokens per second
+    double rate{0};
+
+    /// Global capacity of the bucket
+    std::size_t burst{0};
+
+    /// Tokens leased from the global bucket by a single Redis request
+    std::size_t lease_size{1000};
+
+    /// A new lease is requested in background when the count of local tokens
+    /// drops to `lease_size * refill_threshold`
+    double refill_threshold{0.2};
+
+    /// Local tokens that were not used during this time are dropped, so that
+    /// idle instances do not hold the global quota
+    std::chrono::milliseconds lease_ttl{std::chrono::seconds{1}};
+
+    /// Delay before the next lease after a failed or a partially granted one
+    std::chrono::milliseconds lease_retry_interval{100};
+
+    /// Per-instance rate that is used while Redis is unavailable, zero rejects
+    /// all the requests without leased tokens
+    double fallback_rate{0};
+
+    /// Command control of the lease requests
+    CommandControl command_control{};
+};
+
+// clang-format off
+/// @brief Rate limiter with a global quota that is shared by all the instances
+/// of a service through Redis.
+///
+/// The global token bucket is stored in Redis and is updated by a Lua script.
+/// Each instance leases `lease_size` tokens at once and spends them locally
+/// without any Redis requests. The next lease is requested in background
+/// before the local tokens run out, so Obtain() never waits for Redis and one
+/// Redis request is made per `lease_size` obtained tokens.
+///
+/// While Redis is unavailable, the tokens are obtained from a local
+/// utils::TokenBucket with the `fallback_rate`.
+///
+/// ## Example usage:
+///
+/// @code
+/// // In the component constructor
+/// limiter_.emplace(redis_client, storages::redis::DistributedRateLimiterSettings{
+///     "rate-limit:my-handler", /*rate=*/50'000, /*burst=*/50'000});
+///
+/// // In the handler
+/// if (!limiter_->Obtain()) {
+///     throw server::handlers::ExceptionWithCode<
+///         server::handlers::HandlerErrorCode::kTooManyRequests>();
+/// }
+/// @endcode
+// clang-format on
+class DistributedRateLimiter final {
+public:
+    /// @brief Starts leasing the first batch of tokens in background
+    /// @note Must be called from a coroutine, the leases are requested from
+    /// background tasks of the current task processor.
+    DistributedRateLimiter(ClientPtr client, DistributedRateLimiterSettings settings);
+
+    /// @brief Cancels and waits for the pending lease
+    ~DistributedRateLimiter();
+
+    DistributedRateLimiter(const DistributedRateLimiter&) = delete;
+    DistributedRateLimiter& operator=(const DistributedRateLimiter&) = delete;
+
+    /// @returns true if a token was successfully obtained, never waits for Redis
+    [[nodiscard]] bool Obtain();
+
+    /// @returns count of the leased tokens that are not spent yet (might be
+    /// inaccurate as the result is stale)
+    std::size_t GetLocalTokensApprox() const noexcept;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    bool IsLeaseExpired(Clock::time_point now) const noexcept;
+    void StartLease(Clock::time_point now);
+    void Lease();
+
+    const ClientPtr client_;
+    const DistributedRateLimiterSettings settings_;
+    const std::int64_t refill_threshold_tokens_;
+
+    std::atomic<std::int64_t> tokens_{0};
+    std::atomic<Clock::time_point> lease_deadline_{};
+    std::atomic<Clock::time_point> next_lease_allowed_{};
+    std::atomic<bool> lease_in_flight_{false};
+    std::atomic<bool> redis_unavailable_{false};
+
+    utils::TokenBucket fallback_;
+
+    // Must be the last field
+    concurrent::BackgroundTaskStorage lease_tasks_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -63,6 +63,10 @@ ParseReplyDataArray(ReplyData&& array_data, const std::string& request_descripti
 std::vector<GeoPoint>
 ParseReplyDataArray(ReplyData&& array_data, const std::string& request_description, To<std::vector<GeoPoint>>);
 
+/// Parses XREADGROUP reply of a single stream, nil reply means no entries
+std::vector<StreamEntry>
+Parse(ReplyData&& reply_data, const std::string& request_description, To<std::vector<StreamEntry>>);
+
 std::string Parse(ReplyData&& reply_data, const std::string& request_description, To<std::string>);
 
 double Parse(ReplyData&& reply_data, const std::string& request_description, To<double>);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -94,6 +96,39 @@ enum class StatusOk { kOk };
 
 enum class StatusPong { kPong };
 
+/// Entry of a Redis stream
+struct StreamEntry final {
+    /// Entry ID in the `<milliseconds>-<sequence>` format
+    std::string id;
+    /// Field-value pairs of the entry, empty for the entries that were deleted
+    /// from the stream while being pending
+    std::vector<std::pair<std::string, std::string>> fields;
+
+    bool operator==(const StreamEntry& rhs) const { return id == rhs.id && fields == rhs.fields; }
+
+    bool operator!=(const StreamEntry& rhs) const { return !(*this == rhs); }
+};
+
+/// Failed part of a request that was split across shards
+struct PartialRequestError final {
+    /// Indices of the request keys that were sent in the failed part
+    std::vector<std::size_t> key_indices;
+    std::string message;
+};
+
+/// Reply of Client::MgetAcrossShards
+struct MgetAcrossShardsReply final {
+    /// Values in the order of the requested keys, values of the keys from the
+    /// failed parts are std::nullopt
+    std::vector<std::optional<std::string>> values;
+    std::vector<PartialRequestError> errors;
+};
+
+/// Reply of Client::MsetAcrossShards
+struct MsetAcrossShardsReply final {
+    std::vector<PartialRequestError> errors;
+};
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
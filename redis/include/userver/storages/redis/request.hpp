@@ -34,6 +34,17 @@ public:
 
     ReplyType Get(const std::string& request_description = {}) { return impl_->Get(request_description); }
 
+    /// @brief Like Get(), but returns the status of a failed request (e.g. a
+    /// timeout) instead of throwing RequestFailedException.
+    ///
+    /// Single-shard requests report the failures without creating exceptions,
+    /// which matters when a degraded Redis makes errors the common case.
+    /// Replies that could not be parsed and the cancellation of the waiting
+    /// task are still reported by exceptions.
+    ExpectedReply<ReplyType> TryGet(const std::string& request_description = {}) {
+        return impl_->TryGet(request_description);
+    }
+
     /// @cond
     /// Internal helper for WaitAny/WaitAll
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return impl_->TryGetContextAccessor(); }
@@ -184,7 +195,9 @@ using RequestLrange = Request<std::vector<std::string>>;
 using RequestLrem = Request<size_t>;
 using RequestLtrim = Request<StatusOk, void>;
 using RequestMget = Request<std::vector<std::optional<std::string>>>;
+using RequestMgetAcrossShards = Request<MgetAcrossShardsReply>;
 using RequestMset = Request<StatusOk, void>;
+using RequestMsetAcrossShards = Request<MsetAcrossShardsReply>;
 using RequestPersist = Request<PersistReply>;
 using RequestPexpire = Request<ExpireReply>;
 using RequestPing = Request<StatusPong, void>;
@@ -212,6 +225,10 @@ using RequestStrlen = Request<size_t>;
 using RequestTime = Request<std::chrono::system_clock::time_point>;
 using RequestTtl = Request<TtlReply>;
 using RequestType = Request<KeyType>;
+using RequestXack = Request<size_t>;
+using RequestXadd = Request<std::string>;
+using RequestXgroupCreate = Request<StatusOk, void>;
+using RequestXreadgroup = Request<std::vector<StreamEntry>>;
 using RequestZadd = Request<size_t>;
 using RequestZaddIncr = Request<double>;
 using RequestZaddIncrExisting = Request<std::optional<double>>;
@@ -1,11 +1,16 @@
 #pragma once
 
 #include <string>
+#include <type_traits>
+#include <variant>
 
 #include <userver/engine/impl/context_accessor.hpp>
+#include <userver/storages/redis/exception.hpp>
 #include <userver/storages/redis/reply_fwd.hpp>
+#include <userver/storages/redis/reply_status.hpp>
 #include <userver/storages/redis/reply_types.hpp>
 #include <userver/storages/redis/scan_tag.hpp>
+#include <userver/utils/expected.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +23,11 @@ namespace storages::redis {
 // RequestDataBase <- RequestDataImpl
 // RequestDataBase <- MockRequestDataBase <- UserMockRequestData
 
+/// Result of Request::TryGet(), std::monostate stands for the `void` replies
+template <typename ReplyType>
+using ExpectedReply =
+    utils::expected<std::conditional_t<std::is_void_v<ReplyType>, std::monostate, ReplyType>, ReplyStatus>;
+
 template <typename ReplyType>
 class RequestDataBase {
 public:
@@ -27,6 +37,20 @@ public:
 
     virtual ReplyType Get(const std::string& request_description) = 0;
 
+    // The implementations that do not override it still throw internally
+    virtual ExpectedReply<ReplyType> TryGet(const std::string& request_description) {
+        try {
+            if constexpr (std::is_void_v<ReplyType>) {
+                Get(request_description);
+                return std::monostate{};
+            } else {
+                return Get(request_description);
+            }
+        } catch (const RequestFailedException& ex) {
+            return utils::unexpected{ex.GetStatus()};
+        }
+    }
+
     virtual ReplyPtr GetRaw() = 0;
 
     virtual engine::impl::ContextAccessor* TryGetContextAccessor() noexcept = 0;
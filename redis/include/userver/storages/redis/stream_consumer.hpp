@@ -0,0 +1,69 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer.hpp
+/// @brief @copybrief storages::redis::StreamConsumerScope
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <userver/storages/redis/reply_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+class StreamConsumer;
+
+// clang-format off
+/// @brief RAII class to consume the Redis Streams with a consumer group,
+/// retrieved from storages::redis::StreamConsumerComponent.
+///
+/// Each stream is read by its own task with XREADGROUP COUNT `max_batch_size`,
+/// the callback is invoked on each non-empty batch. After the callback returns,
+/// all the entries of the batch are acknowledged by a single XACK that is sent
+/// without waiting for the reply, in parallel with the next XREADGROUP.
+///
+/// If the callback throws, the batch is not acknowledged and is read again from
+/// the pending entries of the consumer after `restart_after_failure_delay`.
+/// The pending entries are also read first after each start, so the processing
+/// should be idempotent.
+///
+/// @note Must be placed as one of the last fields in the consumer component.
+/// Make sure to add a comment before the field:
+///
+/// @code
+/// // Subscription must be the last field! Add new fields above this comment.
+/// @endcode
+// clang-format on
+class StreamConsumerScope final {
+public:
+    /// @brief Callback that is invoked on each read batch of the stream
+    using Callback = std::function<void(const std::string& stream, std::vector<StreamEntry>& entries)>;
+
+    /// @brief Stops the consumer (if not yet stopped).
+    ~StreamConsumerScope();
+
+    StreamConsumerScope(StreamConsumerScope&&) noexcept = delete;
+    StreamConsumerScope& operator=(StreamConsumerScope&&) noexcept = delete;
+
+    /// @brief Creates the consumer group if requested by the static config and
+    /// starts reading the streams.
+    void Start(Callback callback);
+
+    /// @brief Stops reading the streams, waits for the running callbacks.
+    ///
+    /// Called in the destructor of StreamConsumerScope automatically.
+    void Stop() noexcept;
+
+private:
+    friend class StreamConsumerComponent;
+
+    explicit StreamConsumerScope(StreamConsumer& consumer);
+
+    StreamConsumer& consumer_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer_component.hpp
+/// @brief @copybrief storages::redis::StreamConsumerComponent
+
+#include <memory>
+#include <string_view>
+
+#include <userver/components/component_base.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+// clang-format off
+/// @ingroup userver_components
+///
+/// @brief Redis Streams consumer group component.
+///
+/// Reads the streams of a Redis cluster of components::Redis as a member of
+/// a consumer group. See storages::redis::StreamConsumerScope for the details.
+///
+/// ## Static options:
+/// Name                        | Description                                                          | Default value
+/// --------------------------- | -------------------------------------------------------------------- | ---------------
+/// redis_component             | name of the components::Redis component                              | redis
+/// db                          | name of the Redis cluster in the components::Redis                   | --
+/// streams                     | list of the stream keys to read                                      | --
+/// group                       | consumer group name                                                  | --
+/// consumer                    | consumer name, must be unique within the group                       | --
+/// create_group                | create the consumer group (and the stream) if it does not exist      | true
+/// max_batch_size              | maximum number of entries passed to a single callback invocation     | 100
+/// poll_interval               | sleep interval after reading no entries                              | 100ms
+/// restart_after_failure_delay | sleep interval after a failure of the callback or of a Redis request | 1s
+/// task_processor              | task processor to read the streams and to run the callbacks          | main-task-processor
+///
+/// ## Metrics
+///
+/// Per stream, labeled with `redis_stream`:
+/// - `messages` and `batches` - consumed rates;
+/// - `acks` - acknowledged entries rate;
+/// - `callback_errors`, `redis_errors` - failures rates;
+/// - `lag_ms` - time since the last consumed entry was added to the stream.
+// clang-format on
+class StreamConsumerComponent final : public components::ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of storages::redis::StreamConsumerComponent
+    static constexpr std::string_view kName{"redis-stream-consumer"};
+
+    StreamConsumerComponent(const components::ComponentConfig& config, const components::ComponentContext& context);
+    ~StreamConsumerComponent() override;
+
+    /// @brief Returns consumer instance.
+    /// @see storages::redis::StreamConsumerScope
+    StreamConsumerScope GetConsumer();
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<StreamConsumer> consumer_;
+
+    /// @note Subscriptions must be the last fields! Add new fields above this
+    /// comment.
+    utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace storages::redis
+
+template <>
+inline constexpr bool components::kHasValidate<storages::redis::StreamConsumerComponent> = true;
+
+USERVER_NAMESPACE_END
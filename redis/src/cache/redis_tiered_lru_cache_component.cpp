@@ -0,0 +1,142 @@
+#include <userver/cache/redis_tiered_lru_cache_component.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+namespace {
+
+constexpr std::chrono::milliseconds kDefaultTimeout{50};
+
+RedisTierSettings ParseRedisTierSettings(const components::ComponentConfig& config) {
+    RedisTierSettings settings;
+    settings.key_prefix = config["redis-key-prefix"].As<std::string>(config.Name() + ":");
+    settings.ttl = config["redis-ttl"].As<std::chrono::milliseconds>(settings.ttl);
+    settings.max_pending_writes = config["redis-max-pending-writes"].As<std::size_t>(settings.max_pending_writes);
+
+    const auto timeout = config["redis-timeout"].As<std::chrono::milliseconds>(kDefaultTimeout);
+    settings.command_control.timeout_single = timeout;
+    settings.command_control.timeout_all = timeout;
+    settings.command_control.max_retries = 1;
+    return settings;
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const RedisTierStatistics& stats) {
+    writer["hits"] = stats.hits.load();
+    writer["misses"] = stats.misses.load();
+    writer["errors"] = stats.errors.load();
+    writer["writes"] = stats.writes.load();
+    writer["write-errors"] = stats.write_errors.load();
+    writer["writes-skipped"] = stats.writes_skipped.load();
+}
+
+RedisTier::RedisTier(storages::redis::ClientPtr client, RedisTierSettings settings)
+    : client_(std::move(client)), settings_(std::move(settings)) {
+    UINVARIANT(client_, "Redis client must be set");
+}
+
+RedisTier::RedisTier(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : RedisTier(
+          context.FindComponent<components::Redis>().GetClient(config["redis-name"].As<std::string>()),
+          ParseRedisTierSettings(config)
+      ) {}
+
+RedisTier::~RedisTier() = default;
+
+std::string RedisTier::MakeKey(std::string_view serialized_key) const {
+    std::string key;
+    key.reserve(settings_.key_prefix.size() + serialized_key.size());
+    key.append(settings_.key_prefix);
+    key.append(serialized_key);
+    return key;
+}
+
+std::optional<std::string> RedisTier::Get(const std::string& key) {
+    try {
+        auto value = client_->Get(key, settings_.command_control).Get();
+        ++(value ? stats_.hits : stats_.misses);
+        return value;
+    } catch (const std::exception& ex) {
+        LOG_LIMITED_WARNING() << "Failed to read a cache value from Redis: " << ex;
+        ++stats_.errors;
+        return std::nullopt;
+    }
+}
+
+void RedisTier::WriteBack(std::string key, std::string value) {
+    if (write_tasks_.ActiveTasksApprox() >= static_cast<std::int64_t>(settings_.max_pending_writes)) {
+        ++stats_.writes_skipped;
+        return;
+    }
+
+    write_tasks_.AsyncDetach("redis-tier-write", [this, key = std::move(key), value = std::move(value)]() mutable {
+        try {
+            client_->Set(std::move(key), std::move(value), settings_.ttl, storages::redis::CommandControl{}).Get();
+            ++stats_.writes;
+        } catch (const std::exception& ex) {
+            LOG_LIMITED_WARNING() << "Failed to write a cache value to Redis: " << ex;
+            ++stats_.write_errors;
+        }
+    });
+}
+
+void RedisTier::AccountParseError() noexcept {
+    // The value was accounted as a hit
+    --stats_.hits;
+    ++stats_.errors;
+}
+
+void StringReader::Finish() {
+    if (!unread_data_.empty()) {
+        throw dump::Error(fmt::format("Unexpected {} bytes of trailing data in Redis value", unread_data_.size()));
+    }
+}
+
+std::string_view StringReader::ReadRaw(std::size_t max_size) {
+    const auto result = unread_data_.substr(0, max_size);
+    unread_data_.remove_prefix(result.size());
+    return result;
+}
+
+std::string GetRedisTieredLruCacheComponentSchema() {
+    return R"(
+type: object
+description: Base class for LRU-cache components with a Redis tier
+additionalProperties: false
+properties:
+    redis-name:
+        type: string
+        description: name of the Redis database in components::Redis
+    redis-key-prefix:
+        type: string
+        description: prefix of the Redis keys
+        defaultDescription: <component name>:
+    redis-ttl:
+        type: string
+        description: TTL of the values in Redis
+        defaultDescription: 10m
+    redis-timeout:
+        type: string
+        description: timeout of a single Redis read
+        defaultDescription: 50ms
+    redis-max-pending-writes:
+        type: integer
+        description: max count of the values being written to Redis at once, the rest are skipped
+        defaultDescription: 1000
+)";
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
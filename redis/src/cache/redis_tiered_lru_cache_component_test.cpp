@@ -0,0 +1,86 @@
+#include <userver/cache/redis_tiered_lru_cache_component.hpp>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using testing::_;
+
+cache::impl::RedisTierSettings MakeSettings() {
+    cache::impl::RedisTierSettings settings;
+    settings.key_prefix = "test-cache:";
+    settings.ttl = std::chrono::seconds{5};
+    return settings;
+}
+
+}  // namespace
+
+TEST(RedisTier, Serialization) {
+    const std::vector<std::string> value{"first", "second", ""};
+    const auto data = cache::impl::SerializeForRedis(value);
+    EXPECT_EQ(cache::impl::ParseFromRedis<std::vector<std::string>>(data), value);
+
+    EXPECT_ANY_THROW(cache::impl::ParseFromRedis<std::vector<std::string>>(data + "garbage"));
+    EXPECT_ANY_THROW(cache::impl::ParseFromRedis<std::vector<std::string>>(data.substr(0, data.size() / 2)));
+}
+
+UTEST(RedisTier, GetCountsHitsAndErrors) {
+    auto client = std::make_shared<storages::redis::GMockClient>();
+    cache::impl::RedisTier tier(client, MakeSettings());
+
+    const auto key = tier.MakeKey("key");
+    EXPECT_EQ(key, "test-cache:key");
+
+    EXPECT_CALL(*client, Get(key, _))
+        .WillOnce([](auto, auto) {
+            return storages::redis::CreateMockRequest<storages::redis::RequestGet>(std::string{"value"});
+        })
+        .WillOnce([](auto, auto) {
+            return storages::redis::CreateMockRequest<storages::redis::RequestGet>(std::nullopt);
+        })
+        .WillOnce([](auto, auto) { return storages::redis::CreateMockRequestTimeout<storages::redis::RequestGet>(); });
+
+    EXPECT_EQ(tier.Get(key), "value");
+    EXPECT_EQ(tier.Get(key), std::nullopt);
+    EXPECT_EQ(tier.Get(key), std::nullopt);
+
+    const auto& stats = tier.GetStatistics();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.errors, 1);
+}
+
+UTEST(RedisTier, WriteBack) {
+    auto client = std::make_shared<storages::redis::GMockClient>();
+    cache::impl::RedisTier tier(client, MakeSettings());
+
+    EXPECT_CALL(*client, Set("test-cache:key", "value", std::chrono::milliseconds{5000}, _))
+        .WillOnce([](auto, auto, auto, auto) {
+            return storages::redis::CreateMockRequest<storages::redis::RequestSet>();
+        });
+
+    tier.WriteBack("test-cache:key", "value");
+
+    const auto& stats = tier.GetStatistics();
+    while (stats.writes == 0) engine::SleepFor(std::chrono::milliseconds{1});
+    EXPECT_EQ(stats.write_errors, 0);
+}
+
+UTEST(RedisTier, WriteBackSkippedWhenOverloaded) {
+    auto settings = MakeSettings();
+    settings.max_pending_writes = 0;
+    auto client = std::make_shared<storages::redis::GMockClient>();
+    cache::impl::RedisTier tier(client, std::move(settings));
+
+    EXPECT_CALL(*client, Set(_, _, testing::An<std::chrono::milliseconds>(), _)).Times(0);
+    tier.WriteBack("test-cache:key", "value");
+    EXPECT_EQ(tier.GetStatistics().writes_skipped, 1);
+}
+
+USERVER_NAMESPACE_END
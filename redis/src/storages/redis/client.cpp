@@ -1,11 +1,49 @@
 #include <userver/storages/redis/client.hpp>
 
+#include <algorithm>
+#include <unordered_map>
+
+#include <boost/crc.hpp>
+
 #include <storages/redis/impl/sentinel.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
+
+#include "request_data_impl.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+namespace {
+
+size_t HashSlot(const std::string& key) {
+    size_t start = 0;
+    size_t len = 0;
+    impl::GetRedisKey(key, &start, &len);
+    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
+}
+
+// Multi-key commands of RedisCluster require all the keys in one hash slot
+template <typename T, typename GetKey>
+std::vector<std::pair<std::vector<T>, std::vector<size_t>>>
+GroupByShard(const Client& client, std::vector<T>&& items, GetKey get_key) {
+    const bool is_cluster = client.IsInClusterMode();
+    std::unordered_map<size_t, size_t> group_by_id;
+    std::vector<std::pair<std::vector<T>, std::vector<size_t>>> groups;
+    for (size_t i = 0; i < items.size(); ++i) {
+        const auto& key = get_key(items[i]);
+        const auto group_id = is_cluster ? HashSlot(key) : client.ShardByKey(key);
+        const auto [it, inserted] = group_by_id.emplace(group_id, groups.size());
+        if (inserted) groups.emplace_back();
+        auto& [group_items, indices] = groups[it->second];
+        group_items.push_back(std::move(items[i]));
+        indices.push_back(i);
+    }
+    return groups;
+}
+
+}  // namespace
+
 std::string CreateTmpKey(const std::string& key, std::string prefix) {
     return impl::Sentinel::CreateTmpKey(key, std::move(prefix));
 }
@@ -26,6 +64,34 @@ Client::Zscore(std::string key, std::string member, RetryNilFromMaster, const Co
     return Zscore(std::move(key), std::move(member), command_control.MergeWith(kRetryNilFromMaster));
 }
 
+RequestMgetAcrossShards
+Client::MgetAcrossShards(std::vector<std::string> keys, const CommandControl& command_control) {
+    using DataImpl = ScatterGatherRequestDataImpl<RequestMget, MgetAcrossShardsReply>;
+    const auto keys_count = keys.size();
+    std::vector<DataImpl::Part> parts;
+    const auto get_key = [](const std::string& key) -> const std::string& { return key; };
+    for (auto& [group_keys, indices] : GroupByShard(*this, std::move(keys), get_key)) {
+        parts.push_back({Mget(std::move(group_keys), command_control), std::move(indices)});
+    }
+    return RequestMgetAcrossShards(std::make_unique<DataImpl>(std::move(parts), keys_count));
+}
+
+RequestMsetAcrossShards Client::MsetAcrossShards(
+    std::vector<std::pair<std::string, std::string>> key_values,
+    const CommandControl& command_control
+) {
+    using DataImpl = ScatterGatherRequestDataImpl<RequestMset, MsetAcrossShardsReply>;
+    const auto keys_count = key_values.size();
+    std::vector<DataImpl::Part> parts;
+    const auto get_key = [](const std::pair<std::string, std::string>& key_value) -> const std::string& {
+        return key_value.first;
+    };
+    for (auto& [group_key_values, indices] : GroupByShard(*this, std::move(key_values), get_key)) {
+        parts.push_back({Mset(std::move(group_key_values), command_control), std::move(indices)});
+    }
+    return RequestMsetAcrossShards(std::make_unique<DataImpl>(std::move(parts), keys_count));
+}
+
 void Client::Publish(std::string channel, std::string message, const CommandControl& command_control) {
     return Publish(std::move(channel), std::move(message), command_control, PubShard::kZeroShard);
 }
@@ -4,6 +4,7 @@
 
 #include <storages/redis/impl/sentinel.hpp>
 
+#include "client_side_cache.hpp"
 #include "impl/command_control_impl.hpp"
 #include "request_impl.hpp"
 #include "transaction_impl.hpp"
@@ -36,10 +37,20 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         );
 }
 
+ReplyPtr MakeCachedReply(std::string cmd, std::optional<std::string> value) {
+    return std::make_shared<Reply>(std::move(cmd), value ? ReplyData{std::move(*value)} : ReplyData::CreateNil());
+}
+
 }  // namespace
 
-ClientImpl::ClientImpl(std::shared_ptr<impl::Sentinel> sentinel, std::optional<size_t> force_shard_idx)
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+ClientImpl::ClientImpl(
+    std::shared_ptr<impl::Sentinel> sentinel,
+    std::optional<size_t> force_shard_idx,
+    std::shared_ptr<ClientSideCache> client_side_cache
+)
+    : redis_client_(std::move(sentinel)),
+      force_shard_idx_(force_shard_idx),
+      client_side_cache_(std::move(client_side_cache)) {}
 
 void ClientImpl::WaitConnectedOnce(RedisWaitConnected wait_connected) {
     redis_client_->WaitConnectedOnce(wait_connected);
@@ -55,7 +66,7 @@ const std::string& ClientImpl::GetAnyKeyForShard(size_t shard_idx) const {
 }
 
 std::shared_ptr<Client> ClientImpl::GetClientForShard(size_t shard_idx) {
-    return std::make_shared<ClientImpl>(redis_client_, shard_idx);
+    return std::make_shared<ClientImpl>(redis_client_, shard_idx, client_side_cache_);
 }
 
 std::optional<size_t> ClientImpl::GetForcedShardIdx() const { return force_shard_idx_; }
@@ -346,6 +357,19 @@ RequestGeosearch ClientImpl::Geosearch(
 
 RequestGet ClientImpl::Get(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    if (UseClientSideCache(command_control)) {
+        if (auto cached = client_side_cache_->GetValue(key)) {
+            return CreateDummyRequest<RequestGet>(MakeCachedReply("get", std::move(cached->value)));
+        }
+        // Taken before sending the request to drop the values invalidated meanwhile
+        const auto generation = client_side_cache_->GetGeneration();
+        return CreateCachingRequest<RequestGet>(
+            MakeRequest(CmdArgs{"get", key}, shard, false, GetCommandControl(command_control)),
+            [cache = client_side_cache_, generation, key = std::move(key)](const std::optional<std::string>& value) {
+                cache->PutValue(generation, key, value);
+            }
+        );
+    }
     return CreateRequest<RequestGet>(
         MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control))
     );
@@ -382,6 +406,21 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field, const Com
 
 RequestHget ClientImpl::Hget(std::string key, std::string field, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    if (UseClientSideCache(command_control)) {
+        if (auto cached = client_side_cache_->GetHashField(key, field)) {
+            return CreateDummyRequest<RequestHget>(MakeCachedReply("hget", std::move(cached->value)));
+        }
+        // Taken before sending the request to drop the values invalidated meanwhile
+        const auto generation = client_side_cache_->GetGeneration();
+        return CreateCachingRequest<RequestHget>(
+            MakeRequest(CmdArgs{"hget", key, field}, shard, false, GetCommandControl(command_control)),
+            [cache = client_side_cache_, generation, key = std::move(key), field = std::move(field)](
+                const std::optional<std::string>& value
+            ) {
+                cache->PutHashField(generation, key, field, value);
+            }
+        );
+    }
     return CreateRequest<RequestHget>(
         MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control))
     );
@@ -573,6 +612,36 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys, const CommandControl
     auto make_request = [this, shard, cc = GetCommandControl(command_control)](auto keys) {
         return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
     };
+    if (UseClientSideCache(command_control)) {
+        // Served from the cache only if all the keys are cached
+        ReplyData::Array cached_values;
+        cached_values.reserve(keys.size());
+        for (const auto& key : keys) {
+            auto cached = client_side_cache_->GetValue(key);
+            if (!cached) break;
+            cached_values.push_back(
+                cached->value ? ReplyData{std::move(*cached->value)} : ReplyData::CreateNil()
+            );
+        }
+        if (cached_values.size() == keys.size()) {
+            return CreateDummyRequest<RequestMget>(std::make_shared<Reply>("mget", std::move(cached_values)));
+        }
+
+        const auto generation = client_side_cache_->GetGeneration();
+        auto requested_keys = keys;
+        auto fill_cache = [cache = client_side_cache_, generation, keys = std::move(requested_keys)](
+                              const std::vector<std::optional<std::string>>& values
+                          ) {
+            if (values.size() != keys.size()) return;
+            for (size_t i = 0; i < keys.size(); ++i) cache->PutValue(generation, keys[i], values[i]);
+        };
+        if (max_chunk_size >= keys.size()) {
+            return CreateCachingRequest<RequestMget>(make_request(std::move(keys)), std::move(fill_cache));
+        }
+        return CreateCachingAggregateRequest<RequestMget>(
+            MakeRequestChunks(max_chunk_size, std::move(keys), make_request), std::move(fill_cache)
+        );
+    }
     if (max_chunk_size >= keys.size()) {
         return CreateRequest<RequestMget>(make_request(std::move(keys)));
     }
@@ -885,6 +954,75 @@ RequestType ClientImpl::Type(std::string key, const CommandControl& command_cont
     );
 }
 
+RequestXack ClientImpl::Xack(
+    std::string key,
+    std::string group,
+    std::vector<std::string> ids,
+    const CommandControl& command_control
+) {
+    if (ids.empty()) return CreateDummyRequest<RequestXack>(std::make_shared<Reply>("xack", 0));
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXack>(MakeRequest(
+        CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXadd ClientImpl::Xadd(
+    std::string key,
+    std::vector<std::pair<std::string, std::string>> fields,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXadd>(MakeRequest(
+        CmdArgs{"xadd", std::move(key), "*", std::move(fields)}, shard, true, GetCommandControl(command_control)
+    ));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key,
+    std::string group,
+    std::string id,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXgroupCreate>(MakeRequest(
+        CmdArgs{"xgroup", "create", std::move(key), std::move(group), std::move(id), "mkstream"},
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key,
+    std::string group,
+    std::string consumer,
+    std::string id,
+    size_t count,
+    const CommandControl& command_control
+) {
+    auto shard = ShardByKey(key, command_control);
+    return CreateRequest<RequestXreadgroup>(MakeRequest(
+        CmdArgs{
+            "xreadgroup",
+            "group",
+            std::move(group),
+            std::move(consumer),
+            "count",
+            count,
+            "streams",
+            std::move(key),
+            std::move(id),
+        },
+        shard,
+        true,
+        GetCommandControl(command_control)
+    ));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
     return CreateRequest<RequestZadd>(MakeRequest(
@@ -1169,6 +1307,11 @@ impl::Request ClientImpl::MakeRequest(
     return redis_client_->MakeRequest(std::move(args), shard, master, command_control, replies_to_skip);
 }
 
+bool ClientImpl::UseClientSideCache(const CommandControl& cc) const {
+    // Requests to the specific servers are not served from the cache
+    return client_side_cache_ && !cc.force_request_to_master.value_or(false) && !cc.force_server_id;
+}
+
 CommandControl ClientImpl::GetCommandControl(const CommandControl& cc) const {
     return redis_client_->GetCommandControl(cc);
 }
@@ -23,12 +23,17 @@ class Sentinel;
 
 namespace storages::redis {
 
+class ClientSideCache;
 class TransactionImpl;
 
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class ClientImpl final : public Client, public std::enable_shared_from_this<ClientImpl> {
 public:
-    explicit ClientImpl(std::shared_ptr<impl::Sentinel> sentinel, std::optional<size_t> force_shard_idx = std::nullopt);
+    explicit ClientImpl(
+        std::shared_ptr<impl::Sentinel> sentinel,
+        std::optional<size_t> force_shard_idx = std::nullopt,
+        std::shared_ptr<ClientSideCache> client_side_cache = nullptr
+    );
 
     void WaitConnectedOnce(RedisWaitConnected wait_connected) override;
 
@@ -321,6 +326,31 @@ public:
 
     RequestType Type(std::string key, const CommandControl& command_control) override;
 
+    RequestXack Xack(
+        std::string key,
+        std::string group,
+        std::vector<std::string> ids,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXadd Xadd(
+        std::string key,
+        std::vector<std::pair<std::string, std::string>> fields,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXgroupCreate
+    XgroupCreate(std::string key, std::string group, std::string id, const CommandControl& command_control) override;
+
+    RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::string id,
+        size_t count,
+        const CommandControl& command_control
+    ) override;
+
     RequestZadd Zadd(std::string key, double score, std::string member, const CommandControl& command_control) override;
 
     RequestZadd Zadd(
@@ -457,6 +487,8 @@ private:
 
     CommandControl GetCommandControl(const CommandControl& cc) const;
 
+    bool UseClientSideCache(const CommandControl& cc) const;
+
     size_t GetPublishShard(PubShard policy, const PublishSettings& settings);
 
     size_t ShardByKey(const std::string& key, const CommandControl& cc) const;
@@ -466,6 +498,7 @@ private:
     std::shared_ptr<impl::Sentinel> redis_client_;
     std::atomic<int> publish_shard_{0};
     const std::optional<size_t> force_shard_idx_;
+    const std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace storages::redis
@@ -96,6 +96,38 @@ UTEST_F(RedisClientTest, Mget) {
     EXPECT_EQ(*result[1], "bar");
 }
 
+UTEST_F(RedisClientTest, MgetMsetAcrossShards) {
+    auto client = GetClient();
+    auto mset_result = client->MsetAcrossShards({{"key0", "foo"}, {"key1", "bar"}, {"key2", "baz"}}, {}).Get();
+    EXPECT_TRUE(mset_result.errors.empty());
+
+    auto result = client->MgetAcrossShards({"key2", "missing", "key0", "key1"}, {}).Get();
+    EXPECT_TRUE(result.errors.empty());
+    ASSERT_EQ(result.values.size(), 4);
+    EXPECT_EQ(result.values[0], "baz");
+    EXPECT_EQ(result.values[1], std::nullopt);
+    EXPECT_EQ(result.values[2], "foo");
+    EXPECT_EQ(result.values[3], "bar");
+}
+
+UTEST_F(RedisClientTest, Streams) {
+    auto client = GetClient();
+    UEXPECT_NO_THROW(client->XgroupCreate("stream", "group", "$", {}).Get());
+    UEXPECT_THROW(client->XgroupCreate("stream", "group", "$", {}).Get(), storages::redis::ParseReplyException);
+
+    const auto id = client->Xadd("stream", {{"field", "value"}}, {}).Get();
+    auto entries = client->Xreadgroup("stream", "group", "consumer", ">", 10, {}).Get();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].id, id);
+    EXPECT_EQ(entries[0].fields, (std::vector<std::pair<std::string, std::string>>{{"field", "value"}}));
+    EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer", ">", 10, {}).Get().empty());
+
+    // Not acknowledged entries are pending
+    EXPECT_EQ(client->Xreadgroup("stream", "group", "consumer", "0", 10, {}).Get().size(), 1);
+    EXPECT_EQ(client->Xack("stream", "group", {id}, {}).Get(), 1);
+    EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer", "0", 10, {}).Get().empty());
+}
+
 UTEST_F(RedisClientTest, Unlink) {
     auto client = GetClient();
     client->Set("key0", "foo", {}).Get();
@@ -0,0 +1,92 @@
+#include "client_side_cache.hpp"
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// Hashes with a lot of queried fields should not consume the whole cache
+constexpr std::size_t kMaxCachedHashFields = 1024;
+
+}  // namespace
+
+ClientSideCache::ClientSideCache(std::size_t max_size) : values_(max_size), hashes_(max_size) {
+    UASSERT(max_size > 0);
+}
+
+ClientSideCache::Generation ClientSideCache::GetGeneration() const noexcept { return generation_.load(); }
+
+std::optional<ClientSideCacheValue> ClientSideCache::GetValue(const std::string& key) {
+    std::lock_guard lock(mutex_);
+    const auto* value = values_.Get(key);
+    AccountLookup(value != nullptr);
+    if (!value) return std::nullopt;
+    return ClientSideCacheValue{*value};
+}
+
+std::optional<ClientSideCacheValue>
+ClientSideCache::GetHashField(const std::string& key, const std::string& field) {
+    std::lock_guard lock(mutex_);
+    const auto* fields = hashes_.Get(key);
+    const auto it = fields ? fields->find(field) : HashFields::const_iterator{};
+    const bool hit = fields && it != fields->end();
+    AccountLookup(hit);
+    if (!hit) return std::nullopt;
+    return ClientSideCacheValue{it->second};
+}
+
+void ClientSideCache::PutValue(Generation generation, const std::string& key, std::optional<std::string> value) {
+    std::lock_guard lock(mutex_);
+    if (generation != generation_.load()) return;
+    values_.Put(key, std::move(value));
+}
+
+void ClientSideCache::PutHashField(
+    Generation generation,
+    const std::string& key,
+    const std::string& field,
+    std::optional<std::string> value
+) {
+    std::lock_guard lock(mutex_);
+    if (generation != generation_.load()) return;
+    auto* fields = hashes_.Get(key);
+    if (!fields) fields = hashes_.Emplace(key);
+    if (fields->size() >= kMaxCachedHashFields && !fields->count(field)) return;
+    (*fields)[field] = std::move(value);
+}
+
+void ClientSideCache::Invalidate(const std::optional<std::vector<std::string>>& keys) {
+    std::lock_guard lock(mutex_);
+    ++generation_;
+    if (!keys) {
+        values_.Clear();
+        hashes_.Clear();
+        ++flushes_;
+        return;
+    }
+    for (const auto& key : *keys) {
+        values_.Erase(key);
+        hashes_.Erase(key);
+    }
+    invalidations_ += keys->size();
+}
+
+void ClientSideCache::AccountLookup(bool hit) noexcept { ++(hit ? hits_ : misses_); }
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache) {
+    writer["hits"] = cache.hits_.load();
+    writer["misses"] = cache.misses_.load();
+    writer["invalidations"] = cache.invalidations_.load();
+    writer["flushes"] = cache.flushes_.load();
+
+    std::lock_guard lock(cache.mutex_);
+    writer["size"] = cache.values_.GetSize() + cache.hashes_.GetSize();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
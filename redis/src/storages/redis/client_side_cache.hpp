@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// Value of a key or of a hash field known to the cache, std::nullopt
+/// means that the key or the field does not exist
+struct ClientSideCacheValue {
+    std::optional<std::string> value;
+};
+
+/// @brief Bounded near-cache of GET and HGET results, kept up to date by the
+/// invalidation messages of the Redis CLIENT TRACKING.
+///
+/// Invalidate() is called from the ev threads, so all the methods are cheap and
+/// are guarded by a std::mutex. To avoid caching a value that was invalidated
+/// while the request was in flight, the callers take the generation before
+/// sending a request and pass it to Put*(), the value is dropped if any
+/// invalidation happened since then.
+class ClientSideCache final {
+public:
+    using Generation = std::uint64_t;
+
+    explicit ClientSideCache(std::size_t max_size);
+
+    Generation GetGeneration() const noexcept;
+
+    std::optional<ClientSideCacheValue> GetValue(const std::string& key);
+    std::optional<ClientSideCacheValue> GetHashField(const std::string& key, const std::string& field);
+
+    void PutValue(Generation generation, const std::string& key, std::optional<std::string> value);
+    void PutHashField(
+        Generation generation,
+        const std::string& key,
+        const std::string& field,
+        std::optional<std::string> value
+    );
+
+    /// Drops the keys from the cache, std::nullopt drops everything
+    void Invalidate(const std::optional<std::vector<std::string>>& keys);
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache);
+
+private:
+    using HashFields = std::unordered_map<std::string, std::optional<std::string>>;
+
+    void AccountLookup(bool hit) noexcept;
+
+    mutable std::mutex mutex_;
+    cache::LruMap<std::string, std::optional<std::string>> values_;
+    cache::LruMap<std::string, HashFields> hashes_;
+    std::atomic<Generation> generation_{0};
+
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+    std::atomic<std::uint64_t> invalidations_{0};
+    std::atomic<std::uint64_t> flushes_{0};
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
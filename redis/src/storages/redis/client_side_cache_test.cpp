@@ -0,0 +1,91 @@
+#include <storages/redis/client_side_cache.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::ClientSideCache;
+
+}  // namespace
+
+TEST(ClientSideCache, GetPut) {
+    ClientSideCache cache{10};
+    EXPECT_FALSE(cache.GetValue("key"));
+
+    cache.PutValue(cache.GetGeneration(), "key", "value");
+    cache.PutValue(cache.GetGeneration(), "missing", std::nullopt);
+
+    const auto cached = cache.GetValue("key");
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(cached->value, "value");
+
+    const auto cached_missing = cache.GetValue("missing");
+    ASSERT_TRUE(cached_missing);
+    EXPECT_EQ(cached_missing->value, std::nullopt);
+}
+
+TEST(ClientSideCache, HashFields) {
+    ClientSideCache cache{10};
+    cache.PutHashField(cache.GetGeneration(), "hash", "field", "value");
+
+    const auto cached = cache.GetHashField("hash", "field");
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(cached->value, "value");
+    EXPECT_FALSE(cache.GetHashField("hash", "other"));
+    EXPECT_FALSE(cache.GetValue("hash"));
+
+    cache.Invalidate(std::vector<std::string>{"hash"});
+    EXPECT_FALSE(cache.GetHashField("hash", "field"));
+}
+
+TEST(ClientSideCache, Invalidate) {
+    ClientSideCache cache{10};
+    cache.PutValue(cache.GetGeneration(), "key1", "value1");
+    cache.PutValue(cache.GetGeneration(), "key2", "value2");
+
+    cache.Invalidate(std::vector<std::string>{"key1"});
+    EXPECT_FALSE(cache.GetValue("key1"));
+    EXPECT_TRUE(cache.GetValue("key2"));
+
+    cache.Invalidate(std::nullopt);
+    EXPECT_FALSE(cache.GetValue("key2"));
+}
+
+TEST(ClientSideCache, StaleFillIsDropped) {
+    ClientSideCache cache{10};
+    const auto generation = cache.GetGeneration();
+
+    // The key was changed while the request was in flight
+    cache.Invalidate(std::vector<std::string>{"key"});
+    cache.PutValue(generation, "key", "stale");
+    EXPECT_FALSE(cache.GetValue("key"));
+
+    cache.PutValue(cache.GetGeneration(), "key", "fresh");
+    ASSERT_TRUE(cache.GetValue("key"));
+}
+
+UTEST(ClientSideCache, Metrics) {
+    ClientSideCache cache{10};
+    cache.PutValue(cache.GetGeneration(), "key", "value");
+    EXPECT_TRUE(cache.GetValue("key"));
+    EXPECT_FALSE(cache.GetValue("other"));
+    cache.Invalidate(std::vector<std::string>{"key", "other"});
+    cache.Invalidate(std::nullopt);
+
+    utils::statistics::Storage storage;
+    auto holder = storage.RegisterWriter("cache", [&](utils::statistics::Writer& writer) { writer = cache; });
+
+    const utils::statistics::Snapshot snapshot{storage, "cache"};
+    EXPECT_EQ(snapshot.SingleMetric("hits").AsInt(), 1);
+    EXPECT_EQ(snapshot.SingleMetric("misses").AsInt(), 1);
+    EXPECT_EQ(snapshot.SingleMetric("invalidations").AsInt(), 2);
+    EXPECT_EQ(snapshot.SingleMetric("flushes").AsInt(), 1);
+    EXPECT_EQ(snapshot.SingleMetric("size").AsInt(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -31,6 +31,7 @@
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
 #include "client_impl.hpp"
+#include "client_side_cache.hpp"
 #include "redis_secdist.hpp"
 #include "subscribe_client_impl.hpp"
 #include "userver/storages/redis/base.hpp"
@@ -65,6 +66,8 @@ struct RedisGroup {
     std::string config_name;
     std::string sharding_strategy;
     bool allow_reads_from_master{false};
+    std::size_t client_side_cache_size{0};
+    std::size_t connections_per_instance{1};
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisGroup>) {
@@ -73,6 +76,8 @@ RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisG
     config.config_name = value["config_name"].As<std::string>();
     config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
     config.allow_reads_from_master = value["allow_reads_from_master"].As<bool>(false);
+    config.client_side_cache_size = value["client_side_cache_size"].As<std::size_t>(0);
+    config.connections_per_instance = value["connections_per_instance"].As<std::size_t>(1);
     return config;
 }
 
@@ -213,11 +218,25 @@ void Redis::Connect(
             redis_group.db,
             storages::redis::impl::KeyShardFactory{redis_group.sharding_strategy},
             cc,
-            testsuite_redis_control
+            testsuite_redis_control,
+            redis_group.client_side_cache_size > 0,
+            redis_group.connections_per_instance
         );
         if (sentinel) {
             sentinels_.emplace(redis_group.db, sentinel);
-            const auto& client = std::make_shared<storages::redis::ClientImpl>(sentinel);
+            std::shared_ptr<storages::redis::ClientSideCache> client_side_cache;
+            if (redis_group.client_side_cache_size > 0 && !sentinel->IsInClusterMode()) {
+                client_side_cache =
+                    std::make_shared<storages::redis::ClientSideCache>(redis_group.client_side_cache_size);
+                sentinel->signal_keys_invalidated.connect(
+                    [client_side_cache](const std::optional<std::vector<std::string>>& keys) {
+                        client_side_cache->Invalidate(keys);
+                    }
+                );
+                client_side_caches_.emplace(redis_group.db, client_side_cache);
+            }
+            const auto& client =
+                std::make_shared<storages::redis::ClientImpl>(sentinel, std::nullopt, std::move(client_side_cache));
             clients_.emplace(redis_group.db, client);
         } else {
             LOG_WARNING() << "skip redis client for " << redis_group.db;
@@ -276,6 +295,9 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
     for (const auto& [name, redis] : sentinels_) {
         writer.ValueWithLabels(redis->GetStatistics(*settings), {"redis_database", name});
     }
+    for (const auto& [name, cache] : client_side_caches_) {
+        writer["client_side_cache"].ValueWithLabels(*cache, {"redis_database", name});
+    }
     auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
     threads_writer.ValueWithLabels(*thread_pools_->GetRedisThreadPool(), {});
     threads_writer.ValueWithLabels(thread_pools_->GetSentinelThreadPool(), {});
@@ -386,6 +408,18 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache_size:
+                    type: integer
+                    description: max count of cached GET, HGET and MGET results, 0 to disable the client-side cache
+                    defaultDescription: 0
+                    minimum: 0
+                connections_per_instance:
+                    type: integer
+                    description: |
+                        connections to each instance, spread across the redis
+                        threads; only for RedisCluster sharding_strategy
+                    defaultDescription: 1
+                    minimum: 1
     metrics_level:
         type: string
         description: set metrics detail level
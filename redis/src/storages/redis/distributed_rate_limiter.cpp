@@ -0,0 +1,149 @@
+#include <userver/storages/redis/distributed_rate_limiter.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// KEYS[1] - the bucket, ARGV: rate (tokens per second), burst, requested tokens.
+// Returns the count of granted tokens.
+//
+// The time is taken from the Redis server, so the clocks of the instances do
+// not matter. Milliseconds are used as Lua 5.1 tostring() keeps only 14
+// significant digits.
+constexpr std::string_view kLeaseScript = R"(
+redis.replicate_commands()
+
+local rate = tonumber(ARGV[1]) / 1000
+local burst = tonumber(ARGV[2])
+local requested = tonumber(ARGV[3])
+
+local time = redis.call('TIME')
+local now = tonumber(time[1]) * 1000 + math.floor(tonumber(time[2]) / 1000)
+
+local state = redis.call('HMGET', KEYS[1], 'tokens', 'updated')
+local tokens = tonumber(state[1]) or burst
+local updated = tonumber(state[2]) or now
+if now > updated then
+    tokens = math.min(burst, tokens + (now - updated) * rate)
+    updated = now
+end
+
+local granted = math.max(0, math.min(requested, math.floor(tokens)))
+tokens = tokens - granted
+
+redis.call('HSET', KEYS[1], 'tokens', tostring(tokens), 'updated', tostring(updated))
+redis.call('PEXPIRE', KEYS[1], math.ceil(burst / rate) + 1000)
+return granted
+)";
+
+utils::TokenBucket MakeFallbackBucket(double rate) {
+    if (rate <= 0) return utils::TokenBucket{};
+
+    const auto interval =
+        std::chrono::duration_cast<utils::TokenBucket::Duration>(std::chrono::duration<double>{1.0 / rate});
+    return utils::TokenBucket{
+        static_cast<std::size_t>(std::max(1.0, rate)),
+        {1, std::max(interval, utils::TokenBucket::Duration{1})},
+    };
+}
+
+}  // namespace
+
+DistributedRateLimiter::DistributedRateLimiter(ClientPtr client, DistributedRateLimiterSettings settings)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      refill_threshold_tokens_(static_cast<std::int64_t>(settings_.lease_size * settings_.refill_threshold)),
+      fallback_(MakeFallbackBucket(settings_.fallback_rate)) {
+    UINVARIANT(client_, "Redis client is required");
+    UINVARIANT(settings_.rate > 0, "Rate of the distributed rate limiter must be positive");
+    UINVARIANT(settings_.burst > 0, "Burst of the distributed rate limiter must be positive");
+    UINVARIANT(settings_.lease_size > 0, "Lease size of the distributed rate limiter must be positive");
+
+    StartLease(Clock::now());
+}
+
+DistributedRateLimiter::~DistributedRateLimiter() { lease_tasks_.CancelAndWait(); }
+
+bool DistributedRateLimiter::Obtain() {
+    const auto now = Clock::now();
+
+    if (!IsLeaseExpired(now)) {
+        auto tokens = tokens_.load(std::memory_order_relaxed);
+        while (tokens > 0) {
+            if (tokens_.compare_exchange_weak(tokens, tokens - 1, std::memory_order_relaxed)) {
+                if (tokens - 1 <= refill_threshold_tokens_) StartLease(now);
+                return true;
+            }
+        }
+    }
+
+    StartLease(now);
+    return redis_unavailable_.load(std::memory_order_relaxed) && fallback_.Obtain();
+}
+
+std::size_t DistributedRateLimiter::GetLocalTokensApprox() const noexcept {
+    if (IsLeaseExpired(Clock::now())) return 0;
+    return static_cast<std::size_t>(std::max<std::int64_t>(tokens_.load(std::memory_order_relaxed), 0));
+}
+
+bool DistributedRateLimiter::IsLeaseExpired(Clock::time_point now) const noexcept {
+    return now >= lease_deadline_.load(std::memory_order_relaxed);
+}
+
+void DistributedRateLimiter::StartLease(Clock::time_point now) {
+    if (now < next_lease_allowed_.load(std::memory_order_relaxed)) return;
+    if (lease_in_flight_.exchange(true, std::memory_order_acquire)) return;
+
+    lease_tasks_.AsyncDetach("redis_rate_limiter_lease", [this] {
+        Lease();
+        lease_in_flight_.store(false, std::memory_order_release);
+    });
+}
+
+void DistributedRateLimiter::Lease() {
+    const auto requested = static_cast<std::int64_t>(settings_.lease_size);
+
+    std::int64_t granted = 0;
+    try {
+        granted = client_
+                      ->Eval<std::int64_t>(
+                          std::string{kLeaseScript},
+                          {settings_.key},
+                          {fmt::to_string(settings_.rate), std::to_string(settings_.burst), std::to_string(requested)},
+                          settings_.command_control
+                      )
+                      .Get("lease of rate limiter tokens");
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to lease the tokens of '" << settings_.key << "' from Redis: " << e;
+        redis_unavailable_.store(true, std::memory_order_relaxed);
+        next_lease_allowed_.store(Clock::now() + settings_.lease_retry_interval, std::memory_order_relaxed);
+        return;
+    }
+    redis_unavailable_.store(false, std::memory_order_relaxed);
+
+    const auto now = Clock::now();
+    if (IsLeaseExpired(now)) {
+        // The tokens of the previous lease were not used in time
+        tokens_.store(granted, std::memory_order_relaxed);
+    } else {
+        tokens_.fetch_add(granted, std::memory_order_relaxed);
+    }
+    lease_deadline_.store(now + settings_.lease_ttl, std::memory_order_relaxed);
+
+    if (granted < requested) {
+        // The global bucket is depleted, do not make a Redis request per Obtain()
+        next_lease_allowed_.store(now + settings_.lease_retry_interval, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
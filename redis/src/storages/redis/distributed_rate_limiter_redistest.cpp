@@ -0,0 +1,57 @@
+#include <storages/redis/client_redistest.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/distributed_rate_limiter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+storages::redis::DistributedRateLimiterSettings MakeSettings() {
+    storages::redis::DistributedRateLimiterSettings settings;
+    settings.key = "distributed_rate_limiter";
+    // Practically no refill during the test
+    settings.rate = 0.001;
+    settings.burst = 10;
+    settings.lease_size = 4;
+    settings.lease_ttl = std::chrono::minutes{1};
+    settings.lease_retry_interval = std::chrono::milliseconds{1};
+    return settings;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientTest, DistributedRateLimiterSharesQuota) {
+    storages::redis::DistributedRateLimiter first{GetClient(), MakeSettings()};
+    storages::redis::DistributedRateLimiter second{GetClient(), MakeSettings()};
+
+    std::size_t obtained_first = 0;
+    std::size_t obtained_second = 0;
+    for (int i = 0; i < 500; ++i) {
+        obtained_first += first.Obtain();
+        obtained_second += second.Obtain();
+        engine::SleepFor(std::chrono::milliseconds{1});
+    }
+
+    EXPECT_EQ(obtained_first + obtained_second, 10);
+    EXPECT_GT(obtained_first, 0);
+    EXPECT_GT(obtained_second, 0);
+    EXPECT_EQ(first.GetLocalTokensApprox(), 0);
+    EXPECT_EQ(second.GetLocalTokensApprox(), 0);
+}
+
+UTEST_F(RedisClientTest, DistributedRateLimiterPrefetch) {
+    auto settings = MakeSettings();
+    settings.burst = 1000;
+    settings.lease_size = 100;
+    storages::redis::DistributedRateLimiter limiter{GetClient(), settings};
+
+    while (limiter.GetLocalTokensApprox() == 0) engine::SleepFor(std::chrono::milliseconds{1});
+
+    // Next leases are requested before the local tokens run out
+    for (int i = 0; i < 90; ++i) ASSERT_TRUE(limiter.Obtain());
+    while (limiter.GetLocalTokensApprox() <= 10) engine::SleepFor(std::chrono::milliseconds{1});
+    EXPECT_EQ(limiter.GetLocalTokensApprox(), 110);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+#include <storages/redis/impl/redis.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+/// Load estimation of an instance for CommandControl::Strategy::kAdaptiveLatency,
+/// less is better
+inline double GetAdaptiveLoadScore(const Redis& instance) {
+    // +1 to distinguish the loads of the instances without any replies yet
+    const auto latency = static_cast<double>(instance.GetCommandLatency().count()) + 1;
+    return latency * static_cast<double>(instance.GetRunningCommands() + 1);
+}
+
+/// @brief Returns the index in `candidates` of the better of two random
+/// candidates ("power of two choices").
+///
+/// Unlike choosing the best candidate, this does not send all the requests to
+/// a single instance while its load estimation lags behind.
+template <typename GetScore>
+std::size_t ChooseOfTwoRandom(std::size_t candidates_count, const GetScore& get_score) {
+    UASSERT(candidates_count > 0);
+    if (candidates_count == 1) return 0;
+
+    const auto first = utils::RandRange(candidates_count);
+    auto second = utils::RandRange(candidates_count - 1);
+    if (second >= first) ++second;
+    return get_score(second) < get_score(first) ? second : first;
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
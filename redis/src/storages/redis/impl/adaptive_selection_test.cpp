@@ -0,0 +1,38 @@
+#include <storages/redis/impl/adaptive_selection.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using storages::redis::impl::ChooseOfTwoRandom;
+
+TEST(AdaptiveSelection, Single) {
+    EXPECT_EQ(ChooseOfTwoRandom(1, [](std::size_t) { return 1.0; }), 0);
+}
+
+TEST(AdaptiveSelection, NeverChoosesWorst) {
+    const std::vector<double> scores{10.0, 1.0, 1000.0, 5.0};
+    for (int i = 0; i < 1000; ++i) {
+        const auto idx = ChooseOfTwoRandom(scores.size(), [&scores](std::size_t i) { return scores[i]; });
+        ASSERT_LT(idx, scores.size());
+        EXPECT_NE(idx, 2);
+    }
+}
+
+TEST(AdaptiveSelection, PrefersLessLoaded) {
+    const std::vector<double> scores{1.0, 100.0};
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(ChooseOfTwoRandom(scores.size(), [&scores](std::size_t i) { return scores[i]; }), 0);
+    }
+}
+
+TEST(AdaptiveSelection, SpreadsEqualLoad) {
+    const std::vector<double> scores(3, 1.0);
+    std::vector<int> chosen(scores.size(), 0);
+    for (int i = 0; i < 3000; ++i) {
+        ++chosen[ChooseOfTwoRandom(scores.size(), [&scores](std::size_t i) { return scores[i]; })];
+    }
+    for (const auto count : chosen) EXPECT_GT(count, 0);
+}
+
+USERVER_NAMESPACE_END
@@ -157,7 +157,8 @@ public:
         std::string shard_group_name,
         Password password,
         const std::vector<std::string>& /*shards*/,
-        const std::vector<ConnectionInfo>& conns
+        const std::vector<ConnectionInfo>& conns,
+        std::size_t connections_per_instance
     )
         : ev_thread_(sentinel_thread_control),
           redis_thread_pool_(redis_thread_pool),
@@ -165,6 +166,7 @@ public:
           password_(std::move(password)),
           shards_names_(MakeShardNames()),
           conns_(conns),
+          connections_per_instance_(connections_per_instance),
           update_topology_timer_(
               ev_thread_,
               [this] { UpdateClusterTopology(); },
@@ -371,6 +373,7 @@ private:
     Password password_;
     std::shared_ptr<const std::vector<std::string>> shards_names_;
     std::vector<ConnectionInfo> conns_;
+    const std::size_t connections_per_instance_;
     std::shared_ptr<Shard> sentinels_;
 
     std::atomic_size_t current_topology_version_{0};
@@ -655,7 +658,8 @@ std::shared_ptr<RedisConnectionHolder> ClusterTopologyHolder::CreateRedisInstanc
         password_,
         buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
         *replication_monitoring_settings_ptr,
-        *retry_budget_settings_ptr
+        *retry_budget_settings_ptr,
+        connections_per_instance_
     );
 }
 
@@ -769,7 +773,8 @@ ClusterSentinelImpl::ClusterSentinelImpl(
     ReadyChangeCallback ready_callback,
     std::unique_ptr<KeyShard>&& /*key_shard*/,
     dynamic_config::Source dynamic_config_source,
-    ConnectionMode /*mode*/
+    ConnectionMode /*mode*/,
+    std::size_t connections_per_instance
 )
     : sentinel_obj_(sentinel),
       ev_thread_(sentinel_thread_control),
@@ -778,9 +783,15 @@ ClusterSentinelImpl::ClusterSentinelImpl(
           [this] { ProcessWaitingCommands(); },
           kSentinelGetHostsCheckInterval
       )),
-      topology_holder_(std::make_shared<
-                       ClusterTopologyHolder>(ev_thread_, redis_thread_pool, shard_group_name, password, shards, conns)
-      ),
+      topology_holder_(std::make_shared<ClusterTopologyHolder>(
+          ev_thread_,
+          redis_thread_pool,
+          shard_group_name,
+          password,
+          shards,
+          conns,
+          connections_per_instance
+      )),
       shard_group_name_(std::move(shard_group_name)),
       conns_(conns),
       ready_callback_(std::move(ready_callback)),
@@ -30,7 +30,8 @@ public:
         ReadyChangeCallback ready_callback,
         std::unique_ptr<KeyShard>&& key_shard,
         dynamic_config::Source dynamic_config_source,
-        ConnectionMode mode = ConnectionMode::kCommands
+        ConnectionMode mode = ConnectionMode::kCommands,
+        std::size_t connections_per_instance = 1
     );
     ~ClusterSentinelImpl() override;
 
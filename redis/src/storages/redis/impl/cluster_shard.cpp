@@ -2,11 +2,14 @@
 
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/adaptive_selection.hpp>
+
 #include "command_control_impl.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +22,7 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
     switch (control.strategy) {
         case CommandControl::Strategy::kEveryDc:
         case CommandControl::Strategy::kDefault:
+        case CommandControl::Strategy::kAdaptiveLatency:
             return false;
         case CommandControl::Strategy::kLocalDcConductor:
         case CommandControl::Strategy::kNearestServerPing:
@@ -75,7 +79,7 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
     const auto read_only = command->read_only;
 
     if (!read_only || !cc.force_server_id.IsAny()) {
-        if (const auto& instance = GetAvailableServer(command->control, read_only); instance) {
+        if (const auto& instance = GetAvailableServer(*command); instance) {
             return instance->AsyncCommand(command);
         }
         return false;
@@ -96,7 +100,15 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
 
         size_t idx = SentinelImpl::kDefaultPrevInstanceIdx;
         const auto instance = GetInstance(
-            available_servers, is_retry, start_idx, attempt, is_nearest_ping_server, cc.best_dc_count, &idx
+            *command,
+            available_servers,
+            is_retry,
+            start_idx,
+            attempt,
+            is_nearest_ping_server,
+            cc.strategy == CommandControl::Strategy::kAdaptiveLatency,
+            cc.best_dc_count,
+            &idx
         );
         if (!instance) {
             continue;
@@ -111,25 +123,36 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
 }
 
 void ClusterShard::GetStatistics(bool master, const MetricsSettings& settings, ShardStatistics& stats) const {
-    auto add_to_stats = [&settings, &stats](const auto& instance) {
-        if (!instance) {
-            return;
+    auto add_to_stats = [&settings, &stats](const RedisConnectionPtr& connection) {
+        impl::InstanceStatistics* inst_stats = nullptr;
+        for (const auto& instance : connection->GetAll()) {
+            if (!instance) {
+                continue;
+            }
+            if (!inst_stats) {
+                auto host_port = instance->GetServerHost() + ":" + std::to_string(instance->GetServerPort());
+                auto it = stats.instances.emplace(std::move(host_port), impl::InstanceStatistics(settings));
+                inst_stats = &it.first->second;
+                inst_stats->Fill(instance->GetStatistics());
+                stats.shard_total.Add(*inst_stats);
+                continue;
+            }
+            // Connections to the same instance are reported together
+            impl::InstanceStatistics connection_stats(settings);
+            connection_stats.Fill(instance->GetStatistics());
+            inst_stats->Add(connection_stats);
+            stats.shard_total.Add(connection_stats);
         }
-        auto master_host_port = instance->GetServerHost() + ":" + std::to_string(instance->GetServerPort());
-        auto it = stats.instances.emplace(std::move(master_host_port), impl::InstanceStatistics(settings));
-        auto& inst_stats = it.first->second;
-        inst_stats.Fill(instance->GetStatistics());
-        stats.shard_total.Add(inst_stats);
     };
 
     if (master) {
         if (master_) {
-            add_to_stats(master_->Get());
+            add_to_stats(master_);
         }
     } else {
         for (const auto& instance : replicas_) {
             if (instance) {
-                add_to_stats(instance->Get());
+                add_to_stats(instance);
             }
         }
     }
@@ -160,21 +183,21 @@ void ClusterShard::GetNearestServersPing(
     );
 }
 
-ClusterShard::RedisPtr ClusterShard::GetAvailableServer(const CommandControl& command_control, bool read_only) const {
-    if (!read_only) {
+ClusterShard::RedisPtr ClusterShard::GetAvailableServer(const Command& command) const {
+    if (!command.read_only) {
         if (!master_) {
             return {};
         }
-        return master_->Get();
+        return master_->Get(command);
     }
 
-    const CommandControlImpl cc{command_control};
+    const CommandControlImpl cc{command.control};
     if (cc.force_server_id.IsAny()) {
         return {};
     }
 
     if (master_) {
-        auto master = master_->Get();
+        auto master = master_->Get(command);
         if (master->GetServerId() == cc.force_server_id) {
             return master;
         }
@@ -184,7 +207,7 @@ ClusterShard::RedisPtr ClusterShard::GetAvailableServer(const CommandControl& co
         if (!replica_connection) {
             continue;
         }
-        auto replica = replica_connection->Get();
+        auto replica = replica_connection->Get(command);
         if (replica->GetServerId() == cc.force_server_id) {
             return replica;
         }
@@ -217,15 +240,18 @@ std::vector<ClusterShard::RedisConnectionPtr> ClusterShard::GetAvailableServers(
 }
 
 ClusterShard::RedisPtr ClusterShard::GetInstance(
+    const Command& command,
     const std::vector<RedisConnectionPtr>& instances,
     bool retry,
     size_t start_idx,
     size_t attempt,
     bool is_nearest_ping_server,
+    bool is_adaptive,
     size_t best_dc_count,
     size_t* pinstance_idx
 ) {
     RedisPtr ret;
+    std::vector<std::pair<size_t, RedisPtr>> candidates;
     const auto end = (is_nearest_ping_server && attempt == 0 && best_dc_count)
                          ? std::min(instances.size(), best_dc_count)
                          : instances.size();
@@ -235,14 +261,28 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
         if (!cur) {
             continue;
         }
-        const auto& cur_inst = cur->Get();
+        const auto& cur_inst = cur->Get(command);
 
+        if (is_adaptive) {
+            if (cur_inst && cur_inst->IsAvailable() && !cur_inst->IsDestroying() && (!retry || cur_inst->CanRetry())) {
+                candidates.emplace_back(idx, cur_inst);
+            }
+            continue;
+        }
         if (cur_inst && cur_inst->IsAvailable() && (!retry || cur_inst->CanRetry()) &&
             (!ret || ret->IsDestroying() || cur_inst->GetRunningCommands() < ret->GetRunningCommands())) {
             if (pinstance_idx) *pinstance_idx = idx;
             ret = cur_inst;
         }
     }
+
+    if (!candidates.empty()) {
+        auto& [chosen_idx, chosen] = candidates[ChooseOfTwoRandom(candidates.size(), [&candidates](size_t i) {
+            return GetAdaptiveLoadScore(*candidates[i].second);
+        })];
+        if (pinstance_idx) *pinstance_idx = chosen_idx;
+        ret = std::move(chosen);
+    }
     return ret;
 }
 
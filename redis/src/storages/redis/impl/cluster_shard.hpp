@@ -48,14 +48,16 @@ private:
     /// Return suitable instance if it is the only suitable instance.
     /// If there no suitable or multiple suitable instances then method return
     /// nullptr
-    RedisPtr GetAvailableServer(const CommandControl& command_control, bool read_only) const;
+    RedisPtr GetAvailableServer(const Command& command) const;
     std::vector<RedisConnectionPtr> GetAvailableServers(const CommandControl& command_control) const;
     static RedisPtr GetInstance(
+        const Command& command,
         const std::vector<RedisConnectionPtr>& instances,
         bool is_retry,
         size_t start_idx,
         size_t attempt,
         bool is_nearest_ping_server,
+        bool is_adaptive,
         size_t best_dc_count,
         size_t* pinstance_idx
     );
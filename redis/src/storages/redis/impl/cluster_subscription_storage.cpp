@@ -26,7 +26,7 @@ void SubscribeImplImpl(
     SubscriptionId id
 ) {
     const auto& channel = channel_name.channel;
-    const std::lock_guard<std::mutex> lock(storage_impl.mutex_);
+    const std::lock_guard<std::shared_mutex> lock(storage_impl.mutex_);
     auto find_res = map.find(channel);
     if (find_res == map.end()) {
         const size_t selected_shard_idx = ClusterTopology::kUnknownShard;
@@ -115,7 +115,7 @@ void ClusterSubscriptionStorage::Unsubscribe(SubscriptionId subscription_id) {
 
 void ClusterSubscriptionStorage::Stop() {
     {
-        const std::unique_lock<std::mutex> lock(storage_impl_.mutex_);
+        const std::unique_lock<std::shared_mutex> lock(storage_impl_.mutex_);
         storage_impl_.callback_map_.clear();
         storage_impl_.pattern_callback_map_.clear();
         storage_impl_.sharded_callback_map_.clear();
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <deque>
+#include <iterator>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -28,6 +29,7 @@
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/reply_builder.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/reply.hpp>
 
@@ -40,6 +42,8 @@ namespace {
 
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
+// Replies are much more frequent than pings, so the older values fade faster
+const auto kCommandLatencyExp = 0.9;
 const size_t kMissedPingStreakThresholdDefault = 3;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
@@ -165,6 +169,9 @@ public:
     bool IsAvailable() const { return GetState() == Redis::State::kConnected && !IsDestroying() && !IsSyncing(); }
     bool CanRetry() const;
     std::chrono::milliseconds GetPingLatency() const { return std::chrono::milliseconds(ping_latency_ms_); }
+    std::chrono::microseconds GetCommandLatency() const {
+        return std::chrono::microseconds(static_cast<std::int64_t>(command_latency_us_.load()));
+    }
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
@@ -189,6 +196,8 @@ private:
     static void OnRedisReply(redisAsyncContext* c, void* r, void* privdata) noexcept;
     static void OnConnect(const redisAsyncContext* c, int status) noexcept;
     static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
+    static void OnPushReply(redisAsyncContext* c, void* r) noexcept;
+    static void OnOutputBufferFlushed(void* privdata) noexcept;
     static void OnTimerPing(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnTimerInfo(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnConnectTimeout(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
@@ -196,6 +205,7 @@ private:
 
     void OnConnectImpl(int status);
     void OnDisconnectImpl(int status);
+    void OnPushReplyImpl(const redisReply* redis_reply);
     bool InitSecureConnection();
     void InvokeCommand(const CommandPtr& command, ReplyPtr&& reply);
     void InvokeCommandError(
@@ -209,6 +219,7 @@ private:
     void CommandLoopImpl();
     void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status, const char* errstr);
     void AccountPingLatency(std::chrono::milliseconds latency);
+    void AccountCommandLatency(const CommandPtr& command, const ReplyPtr& reply);
     void AccountRtt();
     void OnTimerPingImpl();
     void OnTimerInfoImpl();
@@ -222,7 +233,10 @@ private:
     void ProcessCommand(const CommandPtr& command);
 
     void Authenticate();
+    void OnAuthenticated();
     void SendReadOnly();
+    void EnableClientTracking();
+    void FinishHandshake();
     void FreeCommands();
 
     static void LogSocketErrorReply(const CommandPtr& command, const ReplyPtr& reply);
@@ -277,11 +291,13 @@ private:
     std::atomic_bool enable_replication_monitoring_ = false;
     std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
     const bool send_readonly_;
+    const bool client_tracking_;
     const ConnectionSecurity connection_security_;
     std::chrono::milliseconds ping_interval_{2000};
     std::chrono::milliseconds ping_timeout_{4000};
     std::chrono::milliseconds info_replication_interval_{2000};
     std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
+    std::atomic<double> command_latency_us_{0};
     logging::LogExtra log_extra_;
     bool watch_command_timer_started_ = false;
     Statistics statistics_;
@@ -335,6 +351,8 @@ size_t Redis::GetRunningCommands() const { return impl_->GetRunningCommands(); }
 
 std::chrono::milliseconds Redis::GetPingLatency() const { return impl_->GetPingLatency(); }
 
+std::chrono::microseconds Redis::GetCommandLatency() const { return impl_->GetCommandLatency(); }
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -369,6 +387,7 @@ Redis::RedisImpl::RedisImpl(
       ev_thread_control_(thread_control),
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
+      client_tracking_(redis_settings.client_tracking),
       connection_security_(redis_settings.connection_security),
       server_id_(ServerId::Generate()),
       retry_budget_(utils::RetryBudgetSettings{100, 0.1, false}) {
@@ -452,6 +471,8 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port, const Password
         context_ = nullptr;
         return false;
     }
+    // Bulk strings are moved into ReplyData instead of being copied
+    context_->c.reader->fn = GetReplyObjectFunctions();
 
     ev_thread_control_.RunInEvLoopBlocking([this, &host]() {
         bool err = false;
@@ -463,9 +484,14 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port, const Password
         };
         if (!err) Attach();
         if (!err) CheckError(redisLibevAttach(ev_thread_control_.GetEvLoop(), context_), "redisLibevAttach");
+        // hiredis stops the write watcher once its output buffer is written out
+        if (!err) context_->ev.delWrite = OnOutputBufferFlushed;
         if (!err) CheckError(redisAsyncSetConnectCallback(context_, OnConnect), "redisAsyncSetConnectCallback");
         if (!err)
             CheckError(redisAsyncSetDisconnectCallback(context_, OnDisconnect), "redisAsyncSetDisconnectCallback");
+#ifdef REDIS_REPLY_PUSH
+        if (!err && client_tracking_) redisAsyncSetPushCallback(context_, OnPushReply);
+#endif
         SetState(err ? State::kInitError : State::kInit);
     });
     return true;
@@ -502,6 +528,7 @@ void Redis::RedisImpl::InvokeCommand(const CommandPtr& command, ReplyPtr&& reply
 
     const CommandControlImpl cc{command->control};
     if (cc.account_in_statistics) statistics_.AccountReplyReceived(reply, command);
+    if (!subscriber_) AccountCommandLatency(command, reply);
     reply->server = server_;
     if (reply->status == ReplyStatus::kTimeoutError) {
         reply->log_extra.Extend("timeout_ms", cc.timeout_single.count());
@@ -623,6 +650,20 @@ void Redis::RedisImpl::AccountPingLatency(std::chrono::milliseconds latency) {
                 << ping_latency_ms_.load() << "ms" << log_extra;
 }
 
+void Redis::RedisImpl::AccountCommandLatency(const CommandPtr& command, const ReplyPtr& reply) {
+    // Timed out commands are accounted too, so a stuck instance is avoided by
+    // the adaptive strategy even without any replies. Other errors may happen
+    // before the command is sent.
+    if (reply->status != ReplyStatus::kOk && reply->status != ReplyStatus::kTimeoutError) return;
+
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - command->GetStartHandlingTime()
+    );
+    const auto prev = command_latency_us_.load();
+    command_latency_us_ =
+        (prev == 0 ? latency.count() : prev * kCommandLatencyExp + latency.count() * (1 - kCommandLatencyExp));
+}
+
 void Redis::RedisImpl::AccountRtt() {
     auto rtt = GetSocketPeerRtt(context_->c.fd);
     if (rtt) {
@@ -779,6 +820,7 @@ void Redis::RedisImpl::SetState(State state) {
         LOG_INFO() << "skipped SetState() from " << StateToString(state_) << " to " << StateToString(state);
         return;
     }
+    const bool was_connected = (state_ == State::kConnected);
     LOG(StateChangeToLogLevel(state_, state))
         << log_extra_ << "Redis server connection state for server=" << GetServer()
         << " (server_id=" << GetServerId().GetId() << ") changed from " << StateToString(state_) << " to "
@@ -796,7 +838,12 @@ void Redis::RedisImpl::SetState(State state) {
     } else if (state == State::kInitError || state == State::kDisconnectError || state == State::kDisconnected)
         Disconnect();
 
-    if (redis_obj_) redis_obj_->signal_state_change(state);
+    if (redis_obj_) {
+        // Invalidations are lost with the connection, so everything that was
+        // tracked by it is invalidated
+        if (client_tracking_ && was_connected) redis_obj_->signal_keys_invalidated(std::nullopt);
+        redis_obj_->signal_state_change(state);
+    }
 }
 
 void Redis::RedisImpl::FreeCommands() {
@@ -856,6 +903,19 @@ void Redis::RedisImpl::OnNewCommandImpl() {
     }
 }
 
+void Redis::RedisImpl::OnOutputBufferFlushed(void* privdata) noexcept {
+    redisLibevDelWrite(privdata);
+
+    auto* events = static_cast<redisLibevEvents*>(privdata);
+    auto* impl = static_cast<Redis::RedisImpl*>(events->context->data);
+    UASSERT(impl != nullptr);
+    // Commands held back by max_batch_size go into the next write. The loop is
+    // not run from here, as hiredis is in the middle of handling the write.
+    if (impl->commands_size_.load() != 0 && impl->commands_buffering_settings_.Get()->max_batch_size) {
+        impl->ev_thread_control_.Send(impl->watch_command_);
+    }
+}
+
 void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
     auto* impl = static_cast<Redis::RedisImpl*>(w->data);
     UASSERT(impl != nullptr);
@@ -872,16 +932,37 @@ void Redis::RedisImpl::CommandLoopImpl() {
             ev_thread_control_.Stop(watch_command_timer_);
         }
     }
+    const auto max_batch_size = commands_buffering_settings_.Get()->max_batch_size;
+    if (max_batch_size && context_ && sdslen(context_->c.obuf) != 0) {
+        // The previous batch is not written yet, OnOutputBufferFlushed() runs
+        // the loop again once it is
+        return;
+    }
     std::deque<CommandPtr> commands;
     {
         std::lock_guard<std::mutex> lock(command_mutex_);
-        commands_size_ -= commands_.size();
-        std::swap(commands_, commands);
+        if (max_batch_size && commands_.size() > max_batch_size) {
+            // The rest waits until hiredis flushes the current batch
+            const auto batch_end = commands_.begin() + static_cast<std::ptrdiff_t>(max_batch_size);
+            std::move(commands_.begin(), batch_end, std::back_inserter(commands));
+            commands_.erase(commands_.begin(), batch_end);
+        } else {
+            std::swap(commands_, commands);
+        }
+        commands_size_ -= commands.size();
     }
     LOG_TRACE() << "commands size=" << commands.size();
+    // hiredis appends the commands to a single output buffer that is written
+    // to the socket when it becomes writable
+    if (!commands.empty()) statistics_.AccountCommandsBatch(commands.size());
     for (auto& command : commands) {
         ProcessCommand(command);
     }
+    if (max_batch_size && commands_size_.load() != 0 && (!context_ || sdslen(context_->c.obuf) == 0)) {
+        // Nothing was appended to the output buffer, so no flush will pick up
+        // the rest of the commands
+        ev_thread_control_.Send(watch_command_);
+    }
 }
 
 void Redis::RedisImpl::OnConnect(const redisAsyncContext* c, int status) noexcept {
@@ -945,6 +1026,39 @@ void Redis::RedisImpl::OnDisconnectImpl(int status) {
     self_.reset();
 }
 
+void Redis::RedisImpl::OnPushReply(redisAsyncContext* c, void* r) noexcept {
+    auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+    UASSERT(impl != nullptr);
+    try {
+        if (r) impl->OnPushReplyImpl(static_cast<const redisReply*>(r));
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "OnPushReplyImpl() failed: " << ex;
+    }
+}
+
+void Redis::RedisImpl::OnPushReplyImpl(const redisReply* redis_reply) {
+    // Invalidation message is ["invalidate", [key, ...]], a nil instead of
+    // the keys is sent on FLUSHALL/FLUSHDB
+    const ReplyData data{redis_reply};
+    if (!data.IsArray() || data.GetArray().size() != 2) return;
+    const auto& message = data.GetArray();
+    if (!message[0].IsString() || message[0].GetString() != "invalidate") return;
+    if (!redis_obj_) return;
+
+    if (message[1].IsNil()) {
+        redis_obj_->signal_keys_invalidated(std::nullopt);
+        return;
+    }
+    if (!message[1].IsArray()) return;
+
+    std::vector<std::string> keys;
+    keys.reserve(message[1].GetArray().size());
+    for (const auto& key : message[1].GetArray()) {
+        if (key.IsString()) keys.push_back(key.GetString());
+    }
+    redis_obj_->signal_keys_invalidated(std::move(keys));
+}
+
 bool Redis::RedisImpl::InitSecureConnection() {
 #ifdef USERVER_FEATURE_REDIS_TLS
     if (!ssl_context_) {
@@ -971,19 +1085,13 @@ bool Redis::RedisImpl::InitSecureConnection() {
 
 void Redis::RedisImpl::Authenticate() {
     if (password_.GetUnderlying().empty()) {
-        if (send_readonly_)
-            SendReadOnly();
-        else
-            SetState(State::kConnected);
+        OnAuthenticated();
     } else {
         ProcessCommand(PrepareCommand(
             CmdArgs{"AUTH", password_.GetUnderlying()},
             [this](const CommandPtr&, ReplyPtr reply) {
                 if (*reply && reply->data.IsStatus()) {
-                    if (send_readonly_)
-                        SendReadOnly();
-                    else
-                        SetState(State::kConnected);
+                    OnAuthenticated();
                 } else {
                     if (*reply) {
                         if (reply->IsUnknownCommandError()) {
@@ -1009,11 +1117,25 @@ void Redis::RedisImpl::Authenticate() {
     }
 }
 
+void Redis::RedisImpl::OnAuthenticated() {
+    if (send_readonly_)
+        SendReadOnly();
+    else
+        FinishHandshake();
+}
+
+void Redis::RedisImpl::FinishHandshake() {
+    if (client_tracking_)
+        EnableClientTracking();
+    else
+        SetState(State::kConnected);
+}
+
 void Redis::RedisImpl::SendReadOnly() {
     LOG_DEBUG() << "Send READONLY command to slave " << GetServerId().GetDescription() << " in cluster mode";
     ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&, ReplyPtr reply) {
         if (*reply && reply->data.IsStatus()) {
-            SetState(State::kConnected);
+            FinishHandshake();
         } else {
             if (*reply) {
                 LOG_LIMITED_ERROR() << log_extra_ << "READONLY failed: response type=" << reply->data.GetTypeString()
@@ -1027,6 +1149,41 @@ void Redis::RedisImpl::SendReadOnly() {
     }));
 }
 
+void Redis::RedisImpl::EnableClientTracking() {
+#ifdef REDIS_REPLY_PUSH
+    LOG_DEBUG() << "Enable client tracking on " << GetServerId().GetDescription();
+    const auto on_error = [this](std::string_view command, const ReplyPtr& reply) {
+        if (*reply) {
+            LOG_LIMITED_ERROR() << log_extra_ << command << " failed: response type=" << reply->data.GetTypeString()
+                                << " msg=" << reply->data.ToDebugString();
+        } else {
+            LOG_LIMITED_ERROR() << command << " failed with status=" << reply->status << " (" << reply->status_string
+                                << ") " << log_extra_;
+        }
+        Disconnect();
+    };
+    ProcessCommand(PrepareCommand(CmdArgs{"HELLO", "3"}, [this, on_error](const CommandPtr&, ReplyPtr reply) {
+        if (!*reply || reply->data.IsError()) {
+            on_error("HELLO 3", reply);
+            return;
+        }
+        ProcessCommand(PrepareCommand(
+            CmdArgs{"CLIENT", "TRACKING", "ON"},
+            [this, on_error](const CommandPtr&, ReplyPtr reply) {
+                if (*reply && reply->data.IsStatus()) {
+                    SetState(State::kConnected);
+                } else {
+                    on_error("CLIENT TRACKING ON", reply);
+                }
+            }
+        ));
+    }));
+#else
+    LOG_LIMITED_ERROR() << log_extra_ << "Client tracking requires hiredis with RESP3 support";
+    Disconnect();
+#endif
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r, void* privdata) noexcept {
     auto* impl = static_cast<Redis::RedisImpl*>(c->data);
     UASSERT(impl != nullptr);
@@ -1053,7 +1210,9 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
     ev_thread_control_.Stop(data->second->timer);
     pcommand = data->second.get();
 
-    auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply, NativeToReplyStatus(status), errstr ? errstr : "");
+    auto reply = std::make_shared<Reply>(pcommand->cmd, ExtractReplyData(redis_reply));
+    reply->status = NativeToReplyStatus(status);
+    reply->status_string = errstr ? errstr : "";
 
     // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
     // 'unsubscribe' reply can be received as a reply to the second subscribe
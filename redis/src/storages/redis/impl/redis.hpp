@@ -2,6 +2,9 @@
 
 #include <cstring>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <boost/signals2/signal.hpp>
 
@@ -36,6 +39,8 @@ public:
     bool AsyncCommand(const CommandPtr& command);
     size_t GetRunningCommands() const;
     std::chrono::milliseconds GetPingLatency() const;
+    /// Exponentially weighted moving average of the command reply times
+    std::chrono::microseconds GetCommandLatency() const;
     bool IsDestroying() const;
     std::string GetServerHost() const;
     uint16_t GetServerPort() const;
@@ -55,6 +60,11 @@ public:
     boost::signals2::signal<void(State)> signal_state_change;
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     boost::signals2::signal<void()> signal_not_in_cluster_mode;
+    /// Keys invalidated by the server with the client tracking enabled,
+    /// std::nullopt means that all the keys must be invalidated.
+    /// Called from the ev thread.
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    boost::signals2::signal<void(const std::optional<std::vector<std::string>>&)> signal_keys_invalidated;
 
 private:
     class RedisImpl;
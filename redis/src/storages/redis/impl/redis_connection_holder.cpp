@@ -1,9 +1,32 @@
 #include "redis_connection_holder.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+#include <userver/utils/assert.hpp>
+
+#include <storages/redis/impl/command.hpp>
+
+#include "command_control_impl.hpp"
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis::impl {
 
+namespace {
+
+// The commands with the same first key go to the same connection
+const std::string* GetOrderingKey(const Command& command) {
+    for (const auto& args : command.args.args) {
+        if (args.empty() || args.front() == "MULTI") continue;
+        return args.size() > 1 ? &args[1] : nullptr;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
 RedisConnectionHolder::RedisConnectionHolder(
     const engine::ev::ThreadControl& sentinel_thread_control,
     const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool,
@@ -12,7 +35,8 @@ RedisConnectionHolder::RedisConnectionHolder(
     Password password,
     CommandsBufferingSettings buffering_settings,
     ReplicationMonitoringSettings replication_monitoring_settings,
-    utils::RetryBudgetSettings retry_budget_settings
+    utils::RetryBudgetSettings retry_budget_settings,
+    std::size_t connections_count
 )
     : commands_buffering_settings_(std::move(buffering_settings)),
       replication_monitoring_settings_(std::move(replication_monitoring_settings)),
@@ -22,6 +46,7 @@ RedisConnectionHolder::RedisConnectionHolder(
       host_(host),
       port_(port),
       password_(std::move(password)),
+      connections_(std::max<std::size_t>(connections_count, 1)),
       connection_check_timer_(
           ev_thread_,
           [this] { EnsureConnected(); },
@@ -29,7 +54,7 @@ RedisConnectionHolder::RedisConnectionHolder(
       ) {
     // https://github.com/boostorg/signals2/issues/59
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
-    CreateConnection();
+    for (std::size_t i = 0; i < connections_.size(); ++i) CreateConnection(i);
     ev_thread_.RunInEvLoopAsync([this] { connection_check_timer_.Start(); });
 }
 
@@ -37,30 +62,70 @@ RedisConnectionHolder::~RedisConnectionHolder() {
     ev_thread_.RunInEvLoopBlocking([this] { connection_check_timer_.Stop(); });
 }
 
-std::shared_ptr<Redis> RedisConnectionHolder::Get() const { return redis_.ReadCopy(); }
+std::shared_ptr<Redis> RedisConnectionHolder::Get() const { return connections_[0].ReadCopy(); }
+
+std::shared_ptr<Redis> RedisConnectionHolder::Get(const Command& command) const {
+    if (connections_.size() == 1) return Get();
+
+    const CommandControlImpl cc{command.control};
+    if (!cc.force_server_id.IsAny()) {
+        for (const auto& connection : connections_) {
+            auto redis = connection.ReadCopy();
+            if (redis && redis->GetServerId() == cc.force_server_id) return redis;
+        }
+        return Get();
+    }
+
+    if (const auto* key = GetOrderingKey(command)) {
+        const auto idx = std::hash<std::string_view>{}(*key) % connections_.size();
+        auto redis = connections_[idx].ReadCopy();
+        if (redis && redis->IsAvailable()) return redis;
+    }
+
+    std::shared_ptr<Redis> result;
+    for (const auto& connection : connections_) {
+        auto redis = connection.ReadCopy();
+        if (!redis || !redis->IsAvailable()) continue;
+        if (!result || redis->GetRunningCommands() < result->GetRunningCommands()) result = std::move(redis);
+    }
+    return result ? result : Get();
+}
+
+std::vector<std::shared_ptr<Redis>> RedisConnectionHolder::GetAll() const {
+    std::vector<std::shared_ptr<Redis>> result;
+    result.reserve(connections_.size());
+    for (const auto& connection : connections_) result.push_back(connection.ReadCopy());
+    return result;
+}
 
 void RedisConnectionHolder::EnsureConnected() {
-    auto redis = redis_.ReadCopy();
-    if (redis && (redis->GetState() == Redis::State::kConnected || redis->GetState() == Redis::State::kInit)) {
-        return;
+    for (std::size_t i = 0; i < connections_.size(); ++i) {
+        auto redis = connections_[i].ReadCopy();
+        if (redis && (redis->GetState() == Redis::State::kConnected || redis->GetState() == Redis::State::kInit)) {
+            continue;
+        }
+        // https://github.com/boostorg/signals2/issues/59
+        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
+        CreateConnection(i);
     }
-    // https://github.com/boostorg/signals2/issues/59
-    // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
-    CreateConnection();
 }
 
-void RedisConnectionHolder::CreateConnection() {
+void RedisConnectionHolder::CreateConnection(std::size_t idx) {
+    UASSERT(idx < connections_.size());
     RedisCreationSettings settings;
     /// Here we allow read from replicas possibly stale data.
     /// This does not affect connections to masters
     settings.send_readonly = true;
+    // Each Redis takes the next thread of the pool
     auto instance = std::make_shared<Redis>(redis_thread_pool_, settings);
-    instance->signal_state_change.connect([weak_ptr{weak_from_this()}](Redis::State state) {
-        const auto ptr = weak_ptr.lock();
-        if (!ptr) return;
+    if (idx == 0) {
+        instance->signal_state_change.connect([weak_ptr{weak_from_this()}](Redis::State state) {
+            const auto ptr = weak_ptr.lock();
+            if (!ptr) return;
 
-        ptr->signal_state_change(state);
-    });
+            ptr->signal_state_change(state);
+        });
+    }
 
     {
         auto settings_ptr = commands_buffering_settings_.Lock();
@@ -78,29 +143,29 @@ void RedisConnectionHolder::CreateConnection() {
     }
 
     instance->Connect({host_}, port_, password_);
-    redis_.Assign(std::move(instance));
+    connections_[idx].Assign(std::move(instance));
 }
 
 void RedisConnectionHolder::SetReplicationMonitoringSettings(ReplicationMonitoringSettings settings) {
     auto ptr = replication_monitoring_settings_.Lock();
     *ptr = settings;
-    redis_.ReadCopy()->SetReplicationMonitoringSettings(std::move(settings));
+    for (const auto& connection : connections_) connection.ReadCopy()->SetReplicationMonitoringSettings(settings);
 }
 
 void RedisConnectionHolder::SetCommandsBufferingSettings(CommandsBufferingSettings settings) {
     auto ptr = commands_buffering_settings_.Lock();
     *ptr = settings;
-    redis_.ReadCopy()->SetCommandsBufferingSettings(std::move(settings));
+    for (const auto& connection : connections_) connection.ReadCopy()->SetCommandsBufferingSettings(settings);
 }
 
 void RedisConnectionHolder::SetRetryBudgetSettings(utils::RetryBudgetSettings settings) {
     auto ptr = retry_budget_settings_.Lock();
     *ptr = settings;
-    redis_.ReadCopy()->SetRetryBudgetSettings(std::move(settings));
+    for (const auto& connection : connections_) connection.ReadCopy()->SetRetryBudgetSettings(settings);
 }
 
 Redis::State RedisConnectionHolder::GetState() const {
-    auto ptr = redis_.Read();
+    auto ptr = connections_[0].Read();
     return ptr->get()->GetState();
 }
 
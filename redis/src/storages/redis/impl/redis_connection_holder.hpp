@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <vector>
 
 #include <engine/ev/watcher/periodic_watcher.hpp>
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
@@ -7,13 +8,17 @@
 #include <storages/redis/impl/sentinel.hpp>
 #include <userver/concurrent/variable.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/fixed_array.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis::impl {
 
-/// This class holds redis connection and automatically reconnects if
-/// disconnected
+/// This class holds redis connections to the instance and automatically
+/// reconnects if disconnected.
+///
+/// Multiple connections are spread across the threads of the redis thread pool
+/// to scale the throughput of a single hot instance beyond one ev thread.
 class RedisConnectionHolder : public std::enable_shared_from_this<RedisConnectionHolder> {
 public:
     RedisConnectionHolder(
@@ -24,14 +29,27 @@ public:
         Password password,
         CommandsBufferingSettings buffering_settings,
         ReplicationMonitoringSettings replication_monitoring_settings,
-        utils::RetryBudgetSettings retry_budget_settings
+        utils::RetryBudgetSettings retry_budget_settings,
+        std::size_t connections_count = 1
     );
     ~RedisConnectionHolder();
     RedisConnectionHolder(const RedisConnectionHolder&) = delete;
     RedisConnectionHolder& operator=(const RedisConnectionHolder&) = delete;
 
+    /// The first connection, its state represents the state of the instance
     std::shared_ptr<Redis> Get() const;
 
+    /// The connection for the command:
+    /// - the one with the forced server_id if there is such a connection;
+    /// - the same connection for the commands with the same first key, so that
+    ///   the per-key sequences and transactions are not reordered;
+    /// - the connection with the least outstanding commands otherwise.
+    /// Falls back to any available connection.
+    std::shared_ptr<Redis> Get(const Command& command) const;
+
+    /// All the connections, e.g. to gather their statistics
+    std::vector<std::shared_ptr<Redis>> GetAll() const;
+
     void SetReplicationMonitoringSettings(ReplicationMonitoringSettings settings);
     void SetCommandsBufferingSettings(CommandsBufferingSettings settings);
     void SetRetryBudgetSettings(utils::RetryBudgetSettings settings);
@@ -42,7 +60,9 @@ public:
     boost::signals2::signal<void(Redis::State)> signal_state_change;
 
 private:
-    void CreateConnection();
+    using RedisVariable = rcu::Variable<std::shared_ptr<Redis>, rcu::BlockingRcuTraits>;
+
+    void CreateConnection(std::size_t idx);
     /// Checks if redis connected. If not recreate connection
     void EnsureConnected();
 
@@ -54,7 +74,7 @@ private:
     const std::string host_;
     const uint16_t port_;
     const Password password_;
-    rcu::Variable<std::shared_ptr<Redis>, rcu::BlockingRcuTraits> redis_;
+    utils::FixedArray<RedisVariable> connections_;
     engine::ev::PeriodicWatcher connection_check_timer_;
 };
 
@@ -11,6 +11,9 @@ namespace storages::redis {
 struct RedisCreationSettings {
     ConnectionSecurity connection_security = ConnectionSecurity::kNone;
     bool send_readonly{false};
+    /// Switch the connection to RESP3 and enable CLIENT TRACKING, the
+    /// invalidated keys are reported via Redis::signal_keys_invalidated
+    bool client_tracking{false};
 };
 
 }  // namespace storages::redis
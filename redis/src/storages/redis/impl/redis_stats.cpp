@@ -21,6 +21,7 @@ const std::string_view kCommandTypes[] = {
     "append",
     "auth",
     "bitop",
+    "client",
     "cluster",
     "dbsize",
     "decr",
@@ -36,6 +37,7 @@ const std::string_view kCommandTypes[] = {
     "get",
     "getset",
     "hdel",
+    "hello",
     "hexists",
     "hget",
     "hgetall",
@@ -96,6 +98,10 @@ const std::string_view kCommandTypes[] = {
     "type",
     "unlink",
     "unsubscribe",
+    "xack",
+    "xadd",
+    "xgroup",
+    "xreadgroup",
     "zadd",
     "zcard",
     "zcount",
@@ -181,6 +187,11 @@ void Statistics::AccountError(ReplyStatus code) { error_count[static_cast<int>(c
 
 void Statistics::AccountPing(std::chrono::milliseconds ping) { last_ping_ms = ping.count(); }
 
+void Statistics::AccountCommandsBatch(size_t commands_count) {
+    ++commands_batches;
+    batched_commands += utils::statistics::Rate{commands_count};
+}
+
 InstanceStatistics SentinelStatistics::GetShardGroupTotalStatistics() const { return shard_group_total; }
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats, bool real_instance) {
@@ -191,6 +202,8 @@ void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& sta
 
     writer["reconnects"] = stats.reconnects.Load().value;
     writer["reconnects.v2"] = stats.reconnects;
+    writer["commands_batches"] = stats.commands_batches;
+    writer["batched_commands"] = stats.batched_commands;
 
     if (stats.settings.IsRequestSizesEnabled()) {
         writer["request_sizes"] = stats.request_size_percentile;
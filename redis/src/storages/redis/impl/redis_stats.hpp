@@ -35,12 +35,15 @@ public:
     void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
     void AccountPing(std::chrono::milliseconds ping);
     void AccountError(ReplyStatus code);
+    void AccountCommandsBatch(size_t commands_count);
 
     using Percentile = utils::statistics::Percentile<2048>;
     using RecentPeriod = utils::statistics::RecentPeriod<Percentile, Percentile, utils::datetime::SteadyClock>;
 
     std::atomic<RedisState> state{RedisState::kInit};
     utils::statistics::RateCounter reconnects{0};
+    utils::statistics::RateCounter commands_batches{0};
+    utils::statistics::RateCounter batched_commands{0};
     std::atomic<std::chrono::milliseconds> session_start_time{};
     RecentPeriod request_size_percentile;
     RecentPeriod reply_size_percentile;
@@ -59,6 +62,8 @@ struct InstanceStatistics {
     void Fill(const Statistics& other) {
         state = other.state.load(std::memory_order_relaxed);
         reconnects = other.reconnects;
+        commands_batches = other.commands_batches;
+        batched_commands = other.batched_commands;
         session_start_time = other.session_start_time.load(std::memory_order_relaxed);
         request_size_percentile = other.request_size_percentile.GetStatsForPeriod();
         reply_size_percentile = other.reply_size_percentile.GetStatsForPeriod();
@@ -76,6 +81,8 @@ struct InstanceStatistics {
 
     void Add(const InstanceStatistics& other) {
         reconnects += other.reconnects;
+        commands_batches += other.commands_batches;
+        batched_commands += other.batched_commands;
         request_size_percentile.Add(other.request_size_percentile);
         reply_size_percentile.Add(other.reply_size_percentile);
         timings_percentile.Add(other.timings_percentile);
@@ -89,6 +96,8 @@ struct InstanceStatistics {
     const MetricsSettings& settings;
     RedisState state{RedisState::kInit};
     utils::statistics::RateCounter reconnects{};
+    utils::statistics::RateCounter commands_batches{};
+    utils::statistics::RateCounter batched_commands{};
     std::chrono::milliseconds session_start_time{};
     Statistics::Percentile request_size_percentile;
     Statistics::Percentile reply_size_percentile;
@@ -0,0 +1,181 @@
+#include <storages/redis/impl/reply_builder.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <hiredis/hiredis.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+struct ReplyNode : redisReply {
+    std::string storage;
+};
+
+void* Attach(const redisReadTask* task, std::unique_ptr<ReplyNode> node) noexcept {
+    redisReply* reply = node.release();
+    if (task->parent) {
+        auto* parent = static_cast<redisReply*>(task->parent->obj);
+        parent->element[task->idx] = reply;
+    }
+    return reply;
+}
+
+void* CreateString(const redisReadTask* task, char* str, size_t len) noexcept {
+    try {
+        auto node = std::make_unique<ReplyNode>();
+        node->type = task->type;
+#ifdef REDIS_REPLY_PUSH
+        if (task->type == REDIS_REPLY_VERB) {
+            // Verbatim strings are prefixed with the 'txt:' like encoding,
+            // the reader checks that the prefix is there
+            std::memcpy(node->vtype, str, 3);
+            str += 4;
+            len -= 4;
+        }
+#endif
+        node->storage.assign(str, len);
+        node->str = node->storage.data();
+        node->len = len;
+        return Attach(task, std::move(node));
+    } catch (const std::bad_alloc&) {
+        // The reader reports out of memory on nullptr
+        return nullptr;
+    }
+}
+
+void* CreateArray(const redisReadTask* task, size_t elements) noexcept {
+    try {
+        auto node = std::make_unique<ReplyNode>();
+        node->type = task->type;
+        if (elements > 0) node->element = new redisReply*[elements]{};
+        node->elements = elements;
+        return Attach(task, std::move(node));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) noexcept {
+    try {
+        auto node = std::make_unique<ReplyNode>();
+        node->type = REDIS_REPLY_INTEGER;
+        node->integer = value;
+        return Attach(task, std::move(node));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* CreateNil(const redisReadTask* task) noexcept {
+    try {
+        auto node = std::make_unique<ReplyNode>();
+        node->type = REDIS_REPLY_NIL;
+        return Attach(task, std::move(node));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+#ifdef REDIS_REPLY_PUSH
+void* CreateDouble(const redisReadTask* task, double value, char* str, size_t len) noexcept {
+    try {
+        auto node = std::make_unique<ReplyNode>();
+        node->type = REDIS_REPLY_DOUBLE;
+        node->dval = value;
+        node->storage.assign(str, len);
+        node->str = node->storage.data();
+        node->len = len;
+        return Attach(task, std::move(node));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* CreateBool(const redisReadTask* task, int value) noexcept {
+    try {
+        auto node = std::make_unique<ReplyNode>();
+        node->type = REDIS_REPLY_BOOL;
+        node->integer = value != 0;
+        return Attach(task, std::move(node));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+#endif
+
+void FreeReply(void* ptr) noexcept {
+    auto* reply = static_cast<redisReply*>(ptr);
+    if (!reply) return;
+    for (size_t i = 0; i < reply->elements; ++i) FreeReply(reply->element[i]);
+    delete[] reply->element;
+    delete static_cast<ReplyNode*>(reply);
+}
+
+std::string TakeString(redisReply& reply) {
+    auto& node = static_cast<ReplyNode&>(reply);
+    std::string result = std::move(node.storage);
+    node.storage.clear();
+    // hiredis may still look at the reply before freeing it
+    node.str = node.storage.data();
+    node.len = 0;
+    return result;
+}
+
+redisReplyObjectFunctions kReplyObjectFunctions{
+    CreateString,
+    CreateArray,
+    CreateInteger,
+#ifdef REDIS_REPLY_PUSH
+    CreateDouble,
+#endif
+    CreateNil,
+#ifdef REDIS_REPLY_PUSH
+    CreateBool,
+#endif
+    FreeReply,
+};
+
+}  // namespace
+
+redisReplyObjectFunctions* GetReplyObjectFunctions() { return &kReplyObjectFunctions; }
+
+ReplyData ExtractReplyData(redisReply* reply) {
+    if (!reply) return ReplyData{reply};
+
+    switch (reply->type) {
+        case REDIS_REPLY_STRING:
+#ifdef REDIS_REPLY_PUSH
+        case REDIS_REPLY_DOUBLE:
+        case REDIS_REPLY_BIGNUM:
+        case REDIS_REPLY_VERB:
+#endif
+            return ReplyData{TakeString(*reply)};
+        case REDIS_REPLY_STATUS:
+            return ReplyData::CreateStatus(TakeString(*reply));
+        case REDIS_REPLY_ERROR:
+            return ReplyData::CreateError(TakeString(*reply));
+        case REDIS_REPLY_ARRAY:
+#ifdef REDIS_REPLY_PUSH
+        case REDIS_REPLY_MAP:
+        case REDIS_REPLY_SET:
+        case REDIS_REPLY_PUSH:
+#endif
+        {
+            ReplyData::Array array;
+            array.reserve(reply->elements);
+            for (size_t i = 0; i < reply->elements; ++i) array.push_back(ExtractReplyData(reply->element[i]));
+            return ReplyData{std::move(array)};
+        }
+        default:
+            return ReplyData{reply};
+    }
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
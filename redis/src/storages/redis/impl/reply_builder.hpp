@@ -0,0 +1,24 @@
+#pragma once
+
+#include <userver/storages/redis/reply.hpp>
+
+struct redisReplyObjectFunctions;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+/// @brief Reply object builder for the hiredis reader.
+///
+/// Builds the same redisReply trees as the default hiredis builder, but keeps
+/// the payloads in std::string, so ExtractReplyData() moves them into the
+/// ReplyData instead of copying.
+redisReplyObjectFunctions* GetReplyObjectFunctions();
+
+/// Converts the reply built with GetReplyObjectFunctions() into ReplyData,
+/// the strings of the reply are moved out and left empty
+ReplyData ExtractReplyData(redisReply* reply);
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <storages/redis/impl/reply_builder.hpp>
+
+#include <memory>
+#include <string_view>
+
+#include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::ReplyData;
+using storages::redis::impl::ExtractReplyData;
+using storages::redis::impl::GetReplyObjectFunctions;
+
+struct ReaderDeleter {
+    void operator()(redisReader* reader) const noexcept { redisReaderFree(reader); }
+};
+
+struct ReplyDeleter {
+    void operator()(redisReply* reply) const noexcept { GetReplyObjectFunctions()->freeObject(reply); }
+};
+
+using ReplyPtr = std::unique_ptr<redisReply, ReplyDeleter>;
+
+ReplyPtr Read(std::string_view data) {
+    std::unique_ptr<redisReader, ReaderDeleter> reader{redisReaderCreateWithFunctions(GetReplyObjectFunctions())};
+    EXPECT_EQ(redisReaderFeed(reader.get(), data.data(), data.size()), REDIS_OK);
+
+    void* reply = nullptr;
+    EXPECT_EQ(redisReaderGetReply(reader.get(), &reply), REDIS_OK);
+    return ReplyPtr{static_cast<redisReply*>(reply)};
+}
+
+}  // namespace
+
+TEST(ReplyBuilder, String) {
+    const auto reply = Read("$5\r\nvalue\r\n");
+    ASSERT_TRUE(reply);
+    ASSERT_EQ(reply->type, REDIS_REPLY_STRING);
+    EXPECT_EQ(std::string_view(reply->str, reply->len), "value");
+
+    const auto data = ExtractReplyData(reply.get());
+    ASSERT_TRUE(data.IsString());
+    EXPECT_EQ(data.GetString(), "value");
+    EXPECT_EQ(reply->len, 0);
+}
+
+TEST(ReplyBuilder, StatusAndError) {
+    const auto status = ExtractReplyData(Read("+OK\r\n").get());
+    ASSERT_TRUE(status.IsStatus());
+    EXPECT_EQ(status.GetStatus(), "OK");
+
+    const auto error = ExtractReplyData(Read("-MOVED 3999 127.0.0.1:6381\r\n").get());
+    ASSERT_TRUE(error.IsError());
+    EXPECT_TRUE(error.IsErrorMoved());
+}
+
+TEST(ReplyBuilder, Scalars) {
+    const auto integer = ExtractReplyData(Read(":-42\r\n").get());
+    ASSERT_TRUE(integer.IsInt());
+    EXPECT_EQ(integer.GetInt(), -42);
+
+    EXPECT_TRUE(ExtractReplyData(Read("$-1\r\n").get()).IsNil());
+}
+
+TEST(ReplyBuilder, NestedArray) {
+    const auto data = ExtractReplyData(Read("*3\r\n$3\r\nfoo\r\n*2\r\n:1\r\n$-1\r\n$0\r\n\r\n").get());
+    ASSERT_TRUE(data.IsArray());
+    ASSERT_EQ(data.GetSize(), 3);
+    EXPECT_EQ(data[0].GetString(), "foo");
+    ASSERT_TRUE(data[1].IsArray());
+    EXPECT_EQ(data[1][0].GetInt(), 1);
+    EXPECT_TRUE(data[1][1].IsNil());
+    EXPECT_EQ(data[2].GetString(), "");
+}
+
+TEST(ReplyBuilder, EmptyArray) {
+    const auto data = ExtractReplyData(Read("*0\r\n").get());
+    ASSERT_TRUE(data.IsArray());
+    EXPECT_EQ(data.GetSize(), 0);
+}
+
+USERVER_NAMESPACE_END
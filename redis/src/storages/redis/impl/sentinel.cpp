@@ -71,7 +71,9 @@ Sentinel::Sentinel(
     std::unique_ptr<KeyShard>&& key_shard,
     CommandControl command_control,
     const testsuite::RedisControl& testsuite_redis_control,
-    ConnectionMode mode
+    ConnectionMode mode,
+    bool client_tracking,
+    std::size_t connections_per_instance
 )
     : shard_group_name_(shard_group_name),
       thread_pools_(thread_pools),
@@ -87,6 +89,10 @@ Sentinel::Sentinel(
 
     sentinel_thread_control_->RunInEvLoopBlocking([&]() {
         if (!key_shard) {
+            if (client_tracking) {
+                LOG_WARNING() << "Client tracking is not supported in RedisCluster mode, shard_group_name="
+                              << shard_group_name;
+            }
             impl_ = std::make_unique<ClusterSentinelImpl>(
                 *sentinel_thread_control_,
                 thread_pools_->GetRedisThreadPool(),
@@ -100,9 +106,15 @@ Sentinel::Sentinel(
                 std::move(ready_callback),
                 std::move(key_shard),
                 dynamic_config_source,
-                mode
+                mode,
+                connections_per_instance
             );
         } else {
+            if (connections_per_instance > 1) {
+                LOG_WARNING() << "Multiple connections per instance are supported only in RedisCluster mode, "
+                                 "shard_group_name="
+                              << shard_group_name;
+            }
             impl_ = std::make_unique<SentinelImpl>(
                 *sentinel_thread_control_,
                 thread_pools_->GetRedisThreadPool(),
@@ -116,7 +128,8 @@ Sentinel::Sentinel(
                 std::move(ready_callback),
                 std::move(key_shard),
                 dynamic_config_source,
-                mode
+                mode,
+                client_tracking
             );
         }
     });
@@ -147,7 +160,9 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     const std::string& client_name,
     KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    bool client_tracking,
+    std::size_t connections_per_instance
 ) {
     auto ready_callback = [](size_t shard, const std::string& shard_name, bool ready) {
         LOG_INFO() << "redis: ready_callback:"
@@ -163,7 +178,9 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
         std::move(ready_callback),
         std::move(key_shard_factory),
         command_control,
-        testsuite_redis_control
+        testsuite_redis_control,
+        client_tracking,
+        connections_per_instance
     );
 }
 
@@ -176,7 +193,9 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     Sentinel::ReadyChangeCallback ready_callback,
     KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    bool client_tracking,
+    std::size_t connections_per_instance
 ) {
     const auto& password = settings.password;
 
@@ -213,7 +232,10 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
             dynamic_config_source,
             std::move(key_shard),
             command_control,
-            testsuite_redis_control
+            testsuite_redis_control,
+            ConnectionMode::kCommands,
+            client_tracking,
+            connections_per_instance
         );
         client->Start();
     }
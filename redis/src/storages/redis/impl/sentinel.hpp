@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/signals2.hpp>
 
@@ -73,7 +75,9 @@ public:
         std::unique_ptr<KeyShard>&& key_shard = nullptr,
         CommandControl command_control = {},
         const testsuite::RedisControl& testsuite_redis_control = {},
-        ConnectionMode mode = ConnectionMode::kCommands
+        ConnectionMode mode = ConnectionMode::kCommands,
+        bool client_tracking = false,
+        std::size_t connections_per_instance = 1
     );
     virtual ~Sentinel();
 
@@ -103,7 +107,9 @@ public:
         const std::string& client_name,
         KeyShardFactory key_shard_factory,
         const CommandControl& command_control = {},
-        const testsuite::RedisControl& testsuite_redis_control = {}
+        const testsuite::RedisControl& testsuite_redis_control = {},
+        bool client_tracking = false,
+        std::size_t connections_per_instance = 1
     );
     static std::shared_ptr<Sentinel> CreateSentinel(
         const std::shared_ptr<ThreadPools>& thread_pools,
@@ -114,7 +120,9 @@ public:
         ReadyChangeCallback ready_callback,
         KeyShardFactory key_shard_factory,
         const CommandControl& command_control = {},
-        const testsuite::RedisControl& testsuite_redis_control = {}
+        const testsuite::RedisControl& testsuite_redis_control = {},
+        bool client_tracking = false,
+        std::size_t connections_per_instance = 1
     );
 
     void Restart();
@@ -151,6 +159,10 @@ public:
     boost::signals2::signal<void()> signal_not_in_cluster_mode;
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     boost::signals2::signal<void(size_t shards_count)> signal_topology_changed;
+    /// Emitted from the ev threads if the client tracking is enabled,
+    /// std::nullopt means that all the keys are invalidated
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    boost::signals2::signal<void(const std::optional<std::vector<std::string>>&)> signal_keys_invalidated;
 
     Request MakeRequest(
         CmdArgs&& args,
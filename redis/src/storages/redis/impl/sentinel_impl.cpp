@@ -67,7 +67,8 @@ SentinelImpl::SentinelImpl(
     ReadyChangeCallback ready_callback,
     std::unique_ptr<KeyShard>&& key_shard,
     dynamic_config::Source dynamic_config_source,
-    ConnectionMode mode
+    ConnectionMode mode,
+    bool client_tracking
 )
     : sentinel_obj_(sentinel),
       ev_thread_(sentinel_thread_control),
@@ -82,6 +83,7 @@ SentinelImpl::SentinelImpl(
       cluster_mode_failed_(false),
       key_shard_(std::move(key_shard)),
       connection_mode_(mode),
+      client_tracking_(client_tracking),
       slot_info_(IsInClusterMode() ? std::make_unique<SlotInfo>() : nullptr),
       dynamic_config_source_(dynamic_config_source) {
     for (size_t i = 0; i < init_shards_->size(); ++i) {
@@ -194,6 +196,7 @@ void SentinelImpl::InitShards(
         shard_options.shard_name = shard;
         shard_options.shard_group_name = shard_group_name_;
         shard_options.cluster_mode = IsInClusterMode();
+        shard_options.client_tracking = client_tracking_;
         shard_options.ready_change_callback = [i, shard, ready_callback](bool ready) {
             if (ready_callback) ready_callback(i, shard, ready);
         };
@@ -201,6 +204,11 @@ void SentinelImpl::InitShards(
         object->SignalInstanceStateChange().connect([this](ServerId, Redis::State state) {
             if (state != Redis::State::kInit) ev_thread_.Send(watch_state_);
         });
+        if (client_tracking_) {
+            object->SignalKeysInvalidated().connect([this](const std::optional<std::vector<std::string>>& keys) {
+                sentinel_obj_.signal_keys_invalidated(keys);
+            });
+        }
         object->SignalInstanceReady().connect([this, i](ServerId, bool read_only) {
             LOG_TRACE() << "Signaled kConnected to sentinel: shard_idx=" << i << ", master=" << !read_only;
             if (!read_only)
@@ -107,7 +107,8 @@ public:
         ReadyChangeCallback ready_callback,
         std::unique_ptr<KeyShard>&& key_shard,
         dynamic_config::Source dynamic_config_source,
-        ConnectionMode mode = ConnectionMode::kCommands
+        ConnectionMode mode = ConnectionMode::kCommands,
+        bool client_tracking = false
     );
     ~SentinelImpl() override;
 
@@ -270,6 +271,7 @@ private:
     std::atomic<size_t> current_slots_shard_ = 0;
     utils::SwappingSmart<KeyShard> key_shard_;
     ConnectionMode connection_mode_;
+    const bool client_tracking_;
     std::unique_ptr<SlotInfo> slot_info_;
     SentinelStatisticsInternal statistics_internal_;
     utils::SwappingSmart<KeysForShards> keys_for_shards_;
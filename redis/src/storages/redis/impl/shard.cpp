@@ -8,6 +8,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/retry_budget.hpp>
 
+#include <storages/redis/impl/adaptive_selection.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <userver/storages/redis/base.hpp>
 
@@ -53,7 +54,8 @@ Shard::Shard(Options options)
     : shard_name_(std::move(options.shard_name)),
       shard_group_name_(std::move(options.shard_group_name)),
       ready_change_callback_(std::move(options.ready_change_callback)),
-      cluster_mode_(options.cluster_mode) {
+      cluster_mode_(options.cluster_mode),
+      client_tracking_(options.client_tracking) {
     for (const auto& conn : options.connection_infos) {
         connection_infos_.emplace_back(conn);
     }
@@ -102,7 +104,8 @@ Shard::GetAvailableServers(const CommandControl& command_control, bool with_mast
 
     switch (cc.strategy) {
         case CommandControl::Strategy::kEveryDc:
-        case CommandControl::Strategy::kDefault: {
+        case CommandControl::Strategy::kDefault:
+        case CommandControl::Strategy::kAdaptiveLatency: {
             std::vector<unsigned char> result(instances_.size(), 0);
             for (size_t i = 0; i < instances_.size(); i++) {
                 result[i] = instances_[i].info.IsReadOnly() ? with_slaves : with_masters;
@@ -158,9 +161,11 @@ std::shared_ptr<Redis> Shard::GetInstance(
     bool may_fallback_to_any,
     size_t skip_idx,
     bool read_only,
+    bool is_adaptive,
     size_t* pinstance_idx
 ) {
     std::shared_ptr<Redis> instance;
+    std::vector<size_t> candidates;
 
     auto end = instances_.size();
     size_t cur = ++current_;
@@ -172,6 +177,13 @@ std::shared_ptr<Redis> Shard::GetInstance(
             continue;
 
         const auto& cur_inst = instances_[instance_idx].instance;
+        if (is_adaptive) {
+            if (cur_inst && cur_inst->IsAvailable() && !cur_inst->IsDestroying() &&
+                (!is_retry || cur_inst->CanRetry())) {
+                candidates.push_back(instance_idx);
+            }
+            continue;
+        }
         if (cur_inst && cur_inst->IsAvailable() && (!is_retry || cur_inst->CanRetry()) &&
             (!instance || instance->IsDestroying() || cur_inst->GetRunningCommands() < instance->GetRunningCommands()
             )) {
@@ -180,6 +192,14 @@ std::shared_ptr<Redis> Shard::GetInstance(
         }
     }
 
+    if (!candidates.empty()) {
+        const auto chosen = candidates[ChooseOfTwoRandom(candidates.size(), [this, &candidates](size_t i) {
+            return GetAdaptiveLoadScore(*instances_[candidates[i]].instance);
+        })];
+        if (pinstance_idx) *pinstance_idx = chosen;
+        instance = instances_[chosen].instance;
+    }
+
     // nothing found
     return instance;
 }
@@ -218,7 +238,15 @@ bool Shard::AsyncCommand(CommandPtr command) {
          */
         const bool may_fallback_to_any = (attempt != 0 && cc.force_server_id.IsAny());
 
-        instance = GetInstance(available_servers, is_retry, may_fallback_to_any, skip_idx, command->read_only, &idx);
+        instance = GetInstance(
+            available_servers,
+            is_retry,
+            may_fallback_to_any,
+            skip_idx,
+            command->read_only,
+            cc.strategy == CommandControl::Strategy::kAdaptiveLatency,
+            &idx
+        );
         command->instance_idx = idx;
 
         if (instance) {
@@ -263,7 +291,8 @@ bool Shard::ProcessCreation(const std::shared_ptr<engine::ev::ThreadPool>& redis
     // https://github.com/boostorg/signals2/issues/59
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
     for (const auto& id : need_to_create) {
-        const auto redis_settings = RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+        const auto redis_settings =
+            RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(), client_tracking_};
         ConnectionStatus entry{
             id,
             std::make_shared<Redis>(
@@ -282,6 +311,11 @@ bool Shard::ProcessCreation(const std::shared_ptr<engine::ev::ThreadPool>& redis
             signal_instance_state_change_(server_id, state);
         });
         entry.instance->signal_not_in_cluster_mode.connect([this]() { signal_not_in_cluster_mode_(); });
+        if (client_tracking_) {
+            entry.instance->signal_keys_invalidated.connect(
+                [this](const std::optional<std::vector<std::string>>& keys) { signal_keys_invalidated_(keys); }
+            );
+        }
         entry.info.Connect(*entry.instance);
 
         add_clean_wait.push_back(std::move(entry));
@@ -395,6 +429,10 @@ boost::signals2::signal<void()>& Shard::SignalNotInClusterMode() { return signal
 
 boost::signals2::signal<void(ServerId, bool)>& Shard::SignalInstanceReady() { return signal_instance_ready_; }
 
+boost::signals2::signal<void(const std::optional<std::vector<std::string>>&)>& Shard::SignalKeysInvalidated() {
+    return signal_keys_invalidated_;
+}
+
 void Shard::SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings) {
     std::shared_lock lock(mutex_);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <set>
 #include <shared_mutex>
 #include <string>
@@ -63,6 +64,7 @@ public:
         std::string shard_name;
         std::string shard_group_name;
         bool cluster_mode{false};
+        bool client_tracking{false};
         std::function<void(bool ready)> ready_change_callback;
         std::vector<ConnectionInfo> connection_infos;
     };
@@ -81,6 +83,7 @@ public:
         bool may_fallback_to_any,
         size_t skip_idx,
         bool read_only,
+        bool is_adaptive,
         size_t* pinstance_idx
     );
     void Clean();
@@ -94,6 +97,7 @@ public:
     boost::signals2::signal<void(ServerId, Redis::State)>& SignalInstanceStateChange();
     boost::signals2::signal<void()>& SignalNotInClusterMode();
     boost::signals2::signal<void(ServerId, bool)>& SignalInstanceReady();
+    boost::signals2::signal<void(const std::optional<std::vector<std::string>>&)>& SignalKeysInvalidated();
 
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
@@ -125,12 +129,14 @@ private:
     boost::signals2::signal<void(ServerId, Redis::State)> signal_instance_state_change_;
     boost::signals2::signal<void()> signal_not_in_cluster_mode_;
     boost::signals2::signal<void(ServerId, bool)> signal_instance_ready_;
+    boost::signals2::signal<void(const std::optional<std::vector<std::string>>&)> signal_keys_invalidated_;
 
     utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
     utils::SwappingSmart<utils::RetryBudgetSettings> retry_budget_settings_;
 
     bool prev_connected_ = false;
     const bool cluster_mode_ = false;
+    const bool client_tracking_ = false;
 };
 
 }  // namespace storages::redis::impl
@@ -60,7 +60,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     RebalanceState state(shard_idx, weights);
     if (!state.sum_weights) return;
 
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::lock_guard<std::shared_mutex> lock(mutex_);
     if (!callback_map_.empty() || !pattern_callback_map_.empty()) {
         LOG_INFO() << "Start rebalance for shard " << shard_idx;
 
@@ -137,7 +137,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
 
 template <typename CallbackMap, typename PcallbackMap>
 size_t SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>::GetChannelsCountApprox() const {
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::lock_guard<std::shared_mutex> lock(mutex_);
     return callback_map_.size() + pattern_callback_map_.size() + sharded_callback_map_.size();
 }
 
@@ -160,7 +160,7 @@ PubsubShardStatistics SubscriptionStorageBase::SubscriptionStorageImpl<CallbackM
     shard_stats.by_channel.reserve(GetChannelsCountApprox());
 
     {
-        const std::lock_guard<std::mutex> lock(mutex_);
+        const std::lock_guard<std::shared_mutex> lock(mutex_);
         for (const auto& channel_item : callback_map_) {
             const auto& channel_info = channel_item.second;
             const auto& info = channel_info.GetInfo(shard_idx);
@@ -279,7 +279,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     event.type = event_type;
     event.server_id = server_id;
 
-    const std::lock_guard<std::mutex> lock(mutex_);
+    const std::lock_guard<std::shared_mutex> lock(mutex_);
     fsm->OnEvent(event);
     ReadActions(fsm, channel_name);
 }
@@ -322,7 +322,7 @@ bool SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     SubscriptionId subscription_id,
     bool sharded
 ) {
-    std::unique_lock<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     for (auto& it1 : callback_map) {
         const auto& key = it1.first;
         auto& m = it1.second;
@@ -433,6 +433,13 @@ CommandPtr SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, Pcallba
     );
 }
 
+template <typename CallbackMap, typename PcallbackMap>
+std::mutex& SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>::GetDispatchMutex(
+    const std::string& channel
+) {
+    return dispatch_mutexes_[std::hash<std::string>{}(channel) % kDispatchMutexesCount];
+}
+
 template <typename CallbackMap, typename PcallbackMap>
 void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>::OnMessage(
     ServerId server_id,
@@ -442,7 +449,8 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
 ) {
     size_t discarded{0};
     try {
-        const std::lock_guard<std::mutex> lock(mutex_);
+        const std::shared_lock<std::shared_mutex> lock(mutex_);
+        const std::lock_guard<std::mutex> dispatch_lock(GetDispatchMutex(channel));
         auto& m = callback_map_.at(channel);
         for (const auto& it : m.callbacks) {
             try {
@@ -477,7 +485,8 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
 ) {
     size_t discarded{0};
     try {
-        const std::lock_guard<std::mutex> lock(mutex_);
+        const std::shared_lock<std::shared_mutex> lock(mutex_);
+        const std::lock_guard<std::mutex> dispatch_lock(GetDispatchMutex(pattern));
         auto& m = pattern_callback_map_.at(pattern);
         for (const auto& it : m.callbacks) {
             try {
@@ -511,7 +520,8 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
 ) {
     size_t discarded{0};
     try {
-        const std::lock_guard<std::mutex> lock(mutex_);
+        const std::shared_lock<std::shared_mutex> lock(mutex_);
+        const std::lock_guard<std::mutex> dispatch_lock(GetDispatchMutex(channel));
         auto& m = sharded_callback_map_.at(channel);
         for (const auto& it : m.callbacks) {
             try {
@@ -633,7 +643,7 @@ template <typename CallbackMap, typename PcallbackMap>
 void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>::SetCommandControl(
     const CommandControl& control
 ) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::shared_mutex> lock(mutex_);
     common_command_control_ = control;
     common_command_control_.max_retries = 1;
 }
@@ -646,7 +656,7 @@ SubscriptionToken SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap,
 ) {
     size_t id = 0;
     {
-        const std::lock_guard<std::mutex> lock(mutex_);
+        const std::lock_guard<std::shared_mutex> lock(mutex_);
         id = GetNextSubscriptionId();
     }
     SubscriptionToken token(implemented_.shared_from_this(), id);
@@ -663,7 +673,7 @@ SubscriptionToken SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap,
 ) {
     size_t id = 0;
     {
-        const std::lock_guard<std::mutex> lock(mutex_);
+        const std::lock_guard<std::shared_mutex> lock(mutex_);
         id = GetNextSubscriptionId();
     }
     SubscriptionToken token(implemented_.shared_from_this(), id);
@@ -680,7 +690,7 @@ SubscriptionToken SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap,
 ) {
     size_t id = 0;
     {
-        const std::lock_guard<std::mutex> lock(mutex_);
+        const std::lock_guard<std::shared_mutex> lock(mutex_);
         id = GetNextSubscriptionId();
     }
     SubscriptionToken token(implemented_.shared_from_this(), id);
@@ -758,7 +768,7 @@ void SubscriptionStorage::Unsubscribe(SubscriptionId subscription_id) { storage_
 
 void SubscriptionStorage::Stop() {
     {
-        std::unique_lock<std::mutex> lock(storage_impl_.mutex_);
+        std::unique_lock<std::shared_mutex> lock(storage_impl_.mutex_);
         storage_impl_.callback_map_.clear();
         storage_impl_.pattern_callback_map_.clear();
         storage_impl_.sharded_callback_map_.clear();
@@ -788,7 +798,7 @@ void SubscriptionStorage::DoRebalance(size_t shard_idx, ServerWeights weights) {
 }
 
 void SubscriptionStorage::SwitchToNonClusterMode() {
-    const std::lock_guard<std::mutex> lock(storage_impl_.mutex_);
+    const std::lock_guard<std::shared_mutex> lock(storage_impl_.mutex_);
     UASSERT(is_cluster_mode_);
     is_cluster_mode_ = false;
     LOG_INFO() << "SwitchToNonClusterMode for subscription storage";
@@ -851,7 +861,7 @@ void SubscriptionStorage::SubscribeImpl(
     /// have to subscribe to every shard to be able to receive published message.
     /// In cluster mode subscribe to only one shard because we do not use
     /// previously mentioned workaround. So each instance in cluster is connected
-    const std::lock_guard<std::mutex> lock(storage_impl_.mutex_);
+    const std::lock_guard<std::shared_mutex> lock(storage_impl_.mutex_);
     auto insert_res = storage_impl_.callback_map_.emplace(channel, ChannelInfo());
     auto& map_iter = *insert_res.first;
     auto& channel_info = map_iter.second;
@@ -902,7 +912,7 @@ void SubscriptionStorage::PsubscribeImpl(
     CommandControl control,
     SubscriptionId id
 ) {
-    const std::lock_guard<std::mutex> lock(storage_impl_.mutex_);
+    const std::lock_guard<std::shared_mutex> lock(storage_impl_.mutex_);
     auto insert_res = storage_impl_.pattern_callback_map_.emplace(pattern, PChannelInfo());
     auto& map_iter = *insert_res.first;
     auto& channel_info = map_iter.second;
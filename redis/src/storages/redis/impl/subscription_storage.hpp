@@ -1,8 +1,10 @@
 #pragma once
 
+#include <array>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -212,8 +214,16 @@ protected:
         SubscriptionToken
         Psubscribe(const std::string& channel, Sentinel::UserPmessageCallback cb, CommandControl control);
         SubscriptionId GetNextSubscriptionId();
-
-        mutable std::mutex mutex_;
+        std::mutex& GetDispatchMutex(const std::string& channel);
+
+        // Messages of distinct channels are dispatched in parallel: the dispatch
+        // takes the shared lock of the mutex_ and the mutex of the channel hash
+        // stripe, that serializes callbacks and statistics of each channel. Any
+        // other access to the maps takes the exclusive lock, so unsubscribed
+        // callbacks are never called.
+        static constexpr size_t kDispatchMutexesCount = 16;
+        mutable std::shared_mutex mutex_;
+        std::array<std::mutex, kDispatchMutexesCount> dispatch_mutexes_;
         CommandCb subscribe_callback_;
         CommandCb unsubscribe_callback_;
         ShardedCommandCb sharded_subscribe_callback_;
@@ -209,6 +209,42 @@ ParseReplyDataArray(ReplyData&& array_data, [[maybe_unused]] const std::string&
     return result;
 }
 
+std::vector<StreamEntry>
+Parse(ReplyData&& reply_data, const std::string& request_description, To<std::vector<StreamEntry>>) {
+    if (reply_data.IsNil()) return {};
+    reply_data.ExpectArray(request_description);
+
+    // [[stream, entries]] in RESP2, {stream: entries} map flattened into
+    // [stream, entries] in RESP3
+    auto* streams = &reply_data;
+    if (reply_data.GetSize() == 1 && reply_data[0].IsArray()) streams = &reply_data[0];
+    if (streams->GetSize() != 2 || !(*streams)[1].IsArray()) {
+        throw ParseReplyException(
+            "Unexpected reply to '" + request_description + "', expected entries of a single stream, got " +
+            reply_data.ToDebugString()
+        );
+    }
+
+    auto& entries = (*streams)[1].GetArray();
+    std::vector<StreamEntry> result;
+    result.reserve(entries.size());
+    for (auto& entry : entries) {
+        if (!entry.IsArray() || entry.GetSize() != 2 || !entry[0].IsString()) {
+            throw ParseReplyException(
+                "Unexpected stream entry in reply to '" + request_description + "': " + entry.ToDebugString()
+            );
+        }
+        StreamEntry& stream_entry = result.emplace_back();
+        stream_entry.id = std::move(entry[0].GetString());
+        if (entry[1].IsNil()) continue;
+        entry[1].ExpectArray(request_description);
+        stream_entry.fields = ParseReplyDataArray(
+            std::move(entry[1]), request_description, To<std::vector<std::pair<std::string, std::string>>>{}
+        );
+    }
+    return result;
+}
+
 std::string Parse(ReplyData&& reply_data, const std::string& request_description, To<std::string>) {
     reply_data.ExpectString(request_description);
     return std::move(reply_data.GetString());
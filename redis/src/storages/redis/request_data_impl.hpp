@@ -1,7 +1,11 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <userver/storages/redis/base.hpp>
 #include <userver/storages/redis/impl/request.hpp>
@@ -9,6 +13,7 @@
 
 #include <userver/storages/redis/client.hpp>
 #include <userver/storages/redis/parse_reply.hpp>
+#include <userver/storages/redis/reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
 #include "client_impl.hpp"
@@ -69,6 +74,18 @@ public:
         return ParseReply<Result, ReplyType>(std::move(reply), request_description);
     }
 
+    ExpectedReply<ReplyType> TryGet(const std::string& request_description) override {
+        auto reply = GetReply();
+        if (!reply->IsOk()) return utils::unexpected{reply->status};
+
+        if constexpr (std::is_void_v<ReplyType>) {
+            ParseReply<Result, ReplyType>(std::move(reply), request_description);
+            return std::monostate{};
+        } else {
+            return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+        }
+    }
+
     ReplyPtr GetRaw() override { return GetReply(); }
 
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
@@ -134,6 +151,102 @@ private:
     ReplyPtr reply_;
 };
 
+/// Gathers the results of the parts of a request split across shards,
+/// failures of the parts are reported in the reply instead of an exception
+template <typename PartRequest, typename ReplyType>
+class ScatterGatherRequestDataImpl final : public RequestDataBase<ReplyType> {
+public:
+    struct Part {
+        PartRequest request;
+        std::vector<std::size_t> key_indices;
+    };
+
+    ScatterGatherRequestDataImpl(std::vector<Part>&& parts, std::size_t keys_count)
+        : parts_(std::move(parts)), keys_count_(keys_count) {}
+
+    void Wait() override {
+        for (auto& part : parts_) part.request.Wait();
+    }
+
+    ReplyType Get(const std::string& request_description) override {
+        ReplyType result;
+        constexpr bool kHasValues = !std::is_void_v<decltype(std::declval<PartRequest&>().Get())>;
+        if constexpr (kHasValues) result.values.resize(keys_count_);
+
+        for (auto& part : parts_) {
+            try {
+                if constexpr (kHasValues) {
+                    auto values = part.request.Get(request_description);
+                    if (values.size() != part.key_indices.size()) {
+                        throw ParseReplyException(
+                            "Unexpected values count in the reply of " + request_description
+                        );
+                    }
+                    for (std::size_t i = 0; i < values.size(); ++i) {
+                        result.values[part.key_indices[i]] = std::move(values[i]);
+                    }
+                } else {
+                    part.request.Get(request_description);
+                }
+            } catch (const Exception& ex) {
+                result.errors.push_back({std::move(part.key_indices), ex.what()});
+            }
+        }
+        return result;
+    }
+
+    ReplyPtr GetRaw() override {
+        UASSERT_MSG(false, "Unsupported");
+        return {};
+    }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        UASSERT_MSG(false, "Not implemented");
+        return nullptr;
+    }
+
+private:
+    std::vector<Part> parts_;
+    const std::size_t keys_count_;
+};
+
+/// Passes the result of the request to the callback, used to fill the
+/// ClientSideCache
+template <typename ReplyType>
+class CachingRequestDataImpl final : public RequestDataBase<ReplyType> {
+    using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
+
+public:
+    using Callback = std::function<void(const ReplyType&)>;
+
+    CachingRequestDataImpl(RequestDataPtr&& request, Callback on_result)
+        : request_(std::move(request)), on_result_(std::move(on_result)) {}
+
+    void Wait() override { request_->Wait(); }
+
+    ReplyType Get(const std::string& request_description) override {
+        auto result = request_->Get(request_description);
+        on_result_(result);
+        return result;
+    }
+
+    ExpectedReply<ReplyType> TryGet(const std::string& request_description) override {
+        auto result = request_->TryGet(request_description);
+        if (result.has_value()) on_result_(result.value());
+        return result;
+    }
+
+    ReplyPtr GetRaw() override { return request_->GetRaw(); }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        return request_->TryGetContextAccessor();
+    }
+
+private:
+    RequestDataPtr request_;
+    Callback on_result_;
+};
+
 template <ScanTag scan_tag>
 class RequestScanData final : public RequestScanDataBase<scan_tag> {
 public:
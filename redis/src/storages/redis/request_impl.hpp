@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include <userver/storages/redis/impl/request.hpp>
 
@@ -42,6 +44,33 @@ CreateDummyRequest(ReplyPtr&& reply, storages::redis::Request<Result, ReplyType>
     );
 }
 
+template <typename Result, typename ReplyType = Result>
+storages::redis::Request<Result, ReplyType> CreateCachingRequest(
+    impl::Request&& request,
+    typename CachingRequestDataImpl<ReplyType>::Callback on_result,
+    storages::redis::Request<Result, ReplyType>* /* for ADL */
+) {
+    return storages::redis::Request<Result, ReplyType>(std::make_unique<CachingRequestDataImpl<ReplyType>>(
+        std::make_unique<RequestDataImpl<Result, ReplyType>>(std::move(request)), std::move(on_result)
+    ));
+}
+
+template <typename Result, typename ReplyType = Result>
+storages::redis::Request<Result, ReplyType> CreateCachingAggregateRequest(
+    std::vector<impl::Request>&& requests,
+    typename CachingRequestDataImpl<ReplyType>::Callback on_result,
+    storages::redis::Request<Result, ReplyType>* /* for ADL */
+) {
+    std::vector<std::unique_ptr<RequestDataBase<ReplyType>>> req_data;
+    req_data.reserve(requests.size());
+    for (auto& request : requests) {
+        req_data.push_back(std::make_unique<RequestDataImpl<Result, ReplyType>>(std::move(request)));
+    }
+    return storages::redis::Request<Result, ReplyType>(std::make_unique<CachingRequestDataImpl<ReplyType>>(
+        std::make_unique<AggregateRequestDataImpl<Result, ReplyType>>(std::move(req_data)), std::move(on_result)
+    ));
+}
+
 }  // namespace impl
 
 template <typename Request>
@@ -56,6 +85,21 @@ Request CreateAggregateRequest(std::vector<impl::Request>&& requests) {
     return impl::CreateAggregateRequest(std::move(requests), tmp);
 }
 
+template <typename Request>
+Request CreateCachingRequest(impl::Request&& request, std::function<void(const typename Request::Reply&)> on_result) {
+    Request* tmp = nullptr;
+    return impl::CreateCachingRequest(std::move(request), std::move(on_result), tmp);
+}
+
+template <typename Request>
+Request CreateCachingAggregateRequest(
+    std::vector<impl::Request>&& requests,
+    std::function<void(const typename Request::Reply&)> on_result
+) {
+    Request* tmp = nullptr;
+    return impl::CreateCachingAggregateRequest(std::move(requests), std::move(on_result), tmp);
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
     Request* tmp = nullptr;
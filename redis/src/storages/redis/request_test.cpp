@@ -13,4 +13,18 @@ TEST(ScanRequest, PostfixIncrementCorrect) {
     EXPECT_EQ(it, scan_request.end());
 }
 
+TEST(RedisRequest, TryGet) {
+    auto request = storages::redis::CreateMockRequest<storages::redis::RequestGet>("value");
+    const auto reply = request.TryGet();
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply.value(), "value");
+}
+
+TEST(RedisRequest, TryGetTimeout) {
+    auto request = storages::redis::CreateMockRequestTimeout<storages::redis::RequestSet>();
+    const auto reply = request.TryGet();
+    ASSERT_FALSE(reply.has_value());
+    EXPECT_EQ(reply.error(), storages::redis::ReplyStatus::kTimeoutError);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,181 @@
+#include <storages/redis/stream_consumer.hpp>
+
+#include <string_view>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/exception.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// XREADGROUP ID to read the entries that were never delivered to the group
+const std::string kNewEntriesId = ">";
+// XREADGROUP ID to read the pending entries of the consumer
+const std::string kPendingEntriesId = "0";
+
+}  // namespace
+
+std::chrono::milliseconds GetStreamEntryAge(const std::string& id, std::chrono::system_clock::time_point now) {
+    const std::string_view id_view{id};
+    std::int64_t added_ms = 0;
+    try {
+        added_ms = utils::FromString<std::int64_t>(id_view.substr(0, id_view.find('-')));
+    } catch (const std::exception&) {
+        return std::chrono::milliseconds{0};
+    }
+    const auto age = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() - added_ms;
+    return std::chrono::milliseconds{std::max<std::int64_t>(age, 0)};
+}
+
+StreamConsumerScope::StreamConsumerScope(StreamConsumer& consumer) : consumer_(consumer) {}
+
+StreamConsumerScope::~StreamConsumerScope() { Stop(); }
+
+void StreamConsumerScope::Start(Callback callback) { consumer_.Start(std::move(callback)); }
+
+void StreamConsumerScope::Stop() noexcept { consumer_.Stop(); }
+
+StreamConsumer::StreamConsumer(
+    std::shared_ptr<Client> client,
+    StreamConsumerSettings settings,
+    engine::TaskProcessor& task_processor
+)
+    : client_(std::move(client)), settings_(std::move(settings)), task_processor_(task_processor) {
+    UASSERT(client_);
+    UINVARIANT(settings_.max_batch_size > 0, "max_batch_size must be positive");
+    for (const auto& stream : settings_.streams) statistics_[stream];
+}
+
+StreamConsumer::~StreamConsumer() { Stop(); }
+
+void StreamConsumer::Start(StreamConsumerScope::Callback callback) {
+    UINVARIANT(tasks_.empty(), "StreamConsumer is already started");
+    UINVARIANT(callback, "Callback must be set");
+    callback_ = std::move(callback);
+
+    tasks_.reserve(settings_.streams.size());
+    for (const auto& stream : settings_.streams) {
+        auto& stats = statistics_.at(stream);
+        tasks_.push_back(utils::CriticalAsync(task_processor_, "redis-stream-consumer", [this, &stream, &stats] {
+            Run(stream, stats);
+        }));
+    }
+}
+
+void StreamConsumer::Stop() noexcept {
+    for (auto& task : tasks_) task.SyncCancel();
+    tasks_.clear();
+}
+
+void StreamConsumer::Run(const std::string& stream, StreamStatistics& stats) {
+    bool is_group_created = !settings_.create_group;
+    // Entries that were read but not acknowledged before, e.g. by the previous
+    // instance of the service, are processed first
+    const std::string* read_id = &kPendingEntriesId;
+    std::optional<RequestXack> ack;
+
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            if (!is_group_created) {
+                CreateGroup(stream);
+                is_group_created = true;
+            }
+
+            // Pending entries are not returned after the XACK of them, so the
+            // XACK must be done before the read
+            if (read_id == &kPendingEntriesId) WaitAck(ack, stats);
+
+            auto entries = client_
+                               ->Xreadgroup(
+                                   stream,
+                                   settings_.group,
+                                   settings_.consumer,
+                                   *read_id,
+                                   settings_.max_batch_size,
+                                   command_control_
+                               )
+                               .Get();
+            if (entries.empty()) {
+                if (read_id == &kPendingEntriesId) {
+                    read_id = &kNewEntriesId;
+                } else {
+                    WaitAck(ack, stats);
+                    engine::InterruptibleSleepFor(settings_.poll_interval);
+                }
+                continue;
+            }
+
+            stats.lag_ms = GetStreamEntryAge(entries.back().id, std::chrono::system_clock::now()).count();
+            try {
+                callback_(stream, entries);
+            } catch (const std::exception& e) {
+                ++stats.callback_errors;
+                LOG_ERROR() << "Callback of the Redis stream '" << stream << "' consumer failed: " << e;
+                read_id = &kPendingEntriesId;
+                engine::InterruptibleSleepFor(settings_.restart_after_failure_delay);
+                continue;
+            }
+
+            ++stats.batches;
+            stats.messages += utils::statistics::Rate{entries.size()};
+
+            // The previous XACK was pipelined with the XREADGROUP
+            WaitAck(ack, stats);
+            std::vector<std::string> ids;
+            ids.reserve(entries.size());
+            for (auto& entry : entries) ids.push_back(std::move(entry.id));
+            ack.emplace(client_->Xack(stream, settings_.group, std::move(ids), command_control_));
+        } catch (const std::exception& e) {
+            if (engine::current_task::ShouldCancel()) break;
+            ++stats.redis_errors;
+            LOG_LIMITED_WARNING() << "Failed to consume the Redis stream '" << stream << "': " << e;
+            read_id = &kPendingEntriesId;
+            ack.reset();
+            engine::InterruptibleSleepFor(settings_.restart_after_failure_delay);
+        }
+    }
+}
+
+void StreamConsumer::CreateGroup(const std::string& stream) {
+    try {
+        client_->XgroupCreate(stream, settings_.group, "$", command_control_).Get();
+        LOG_INFO() << "Created consumer group '" << settings_.group << "' of the Redis stream '" << stream << "'";
+    } catch (const ParseReplyException& e) {
+        if (std::string_view{e.what()}.find("BUSYGROUP") == std::string_view::npos) throw;
+    }
+}
+
+void StreamConsumer::WaitAck(std::optional<RequestXack>& ack, StreamStatistics& stats) {
+    if (!ack) return;
+    auto request = std::move(*ack);
+    ack.reset();
+    stats.acks += utils::statistics::Rate{request.Get()};
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const StreamStatistics& stats) {
+    writer["messages"] = stats.messages;
+    writer["batches"] = stats.batches;
+    writer["acks"] = stats.acks;
+    writer["callback_errors"] = stats.callback_errors;
+    writer["redis_errors"] = stats.redis_errors;
+    writer["lag_ms"] = stats.lag_ms.load();
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const StreamConsumer& consumer) {
+    for (const auto& [stream, stats] : consumer.statistics_) {
+        writer.ValueWithLabels(stats, {"redis_stream", stream});
+    }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/storages/redis/request.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct StreamConsumerSettings {
+    std::vector<std::string> streams;
+    std::string group;
+    std::string consumer;
+    bool create_group{true};
+    std::size_t max_batch_size{100};
+    std::chrono::milliseconds poll_interval{100};
+    std::chrono::milliseconds restart_after_failure_delay{1000};
+};
+
+struct StreamStatistics {
+    utils::statistics::RateCounter messages;
+    utils::statistics::RateCounter batches;
+    utils::statistics::RateCounter acks;
+    utils::statistics::RateCounter callback_errors;
+    utils::statistics::RateCounter redis_errors;
+    std::atomic<std::int64_t> lag_ms{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const StreamStatistics& stats);
+
+/// Reads the streams of StreamConsumerSettings, a task per stream
+class StreamConsumer final {
+public:
+    StreamConsumer(
+        std::shared_ptr<Client> client,
+        StreamConsumerSettings settings,
+        engine::TaskProcessor& task_processor
+    );
+    ~StreamConsumer();
+
+    void Start(StreamConsumerScope::Callback callback);
+    void Stop() noexcept;
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const StreamConsumer& consumer);
+
+private:
+    void Run(const std::string& stream, StreamStatistics& stats);
+    void CreateGroup(const std::string& stream);
+    void WaitAck(std::optional<RequestXack>& ack, StreamStatistics& stats);
+
+    const std::shared_ptr<Client> client_;
+    const StreamConsumerSettings settings_;
+    engine::TaskProcessor& task_processor_;
+    const CommandControl command_control_;
+
+    std::unordered_map<std::string, StreamStatistics> statistics_;
+
+    StreamConsumerScope::Callback callback_;
+    std::vector<engine::TaskWithResult<void>> tasks_;
+};
+
+/// Time since the entry was added to the stream, 0 for the IDs that were set
+/// explicitly to something other than a timestamp
+std::chrono::milliseconds GetStreamEntryAge(const std::string& id, std::chrono::system_clock::time_point now);
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <userver/storages/redis/stream_consumer_component.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <storages/redis/stream_consumer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+StreamConsumerSettings ParseSettings(const components::ComponentConfig& config) {
+    StreamConsumerSettings settings;
+    settings.streams = config["streams"].As<std::vector<std::string>>();
+    settings.group = config["group"].As<std::string>();
+    settings.consumer = config["consumer"].As<std::string>();
+    settings.create_group = config["create_group"].As<bool>(settings.create_group);
+    settings.max_batch_size = config["max_batch_size"].As<std::size_t>(settings.max_batch_size);
+    settings.poll_interval = config["poll_interval"].As<std::chrono::milliseconds>(settings.poll_interval);
+    settings.restart_after_failure_delay =
+        config["restart_after_failure_delay"].As<std::chrono::milliseconds>(settings.restart_after_failure_delay);
+    return settings;
+}
+
+}  // namespace
+
+StreamConsumerComponent::StreamConsumerComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : components::ComponentBase(config, context),
+      consumer_(std::make_unique<StreamConsumer>(
+          context
+              .FindComponent<components::Redis>(
+                  config["redis_component"].As<std::string>(components::Redis::kName)
+              )
+              .GetClient(config["db"].As<std::string>()),
+          ParseSettings(config),
+          context.GetTaskProcessor(config["task_processor"].As<std::string>("main-task-processor"))
+      )) {
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+    statistics_holder_ = storage.RegisterWriter(config.Name(), [this](utils::statistics::Writer& writer) {
+        writer = *consumer_;
+    });
+}
+
+StreamConsumerComponent::~StreamConsumerComponent() {
+    statistics_holder_.Unregister();
+    consumer_->Stop();
+}
+
+StreamConsumerScope StreamConsumerComponent::GetConsumer() { return StreamConsumerScope{*consumer_}; }
+
+yaml_config::Schema StreamConsumerComponent::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: Redis Streams consumer group component
+additionalProperties: false
+properties:
+    redis_component:
+        type: string
+        description: name of the components::Redis component
+        defaultDescription: redis
+    db:
+        type: string
+        description: name of the Redis cluster in the components::Redis
+    streams:
+        type: array
+        description: list of the stream keys to read
+        items:
+            type: string
+            description: stream key
+    group:
+        type: string
+        description: consumer group name
+    consumer:
+        type: string
+        description: consumer name, must be unique within the group
+    create_group:
+        type: boolean
+        description: create the consumer group (and the stream) if it does not exist
+        defaultDescription: true
+    max_batch_size:
+        type: integer
+        description: maximum number of entries passed to a single callback invocation
+        defaultDescription: 100
+        minimum: 1
+    poll_interval:
+        type: string
+        description: sleep interval after reading no entries
+        defaultDescription: 100ms
+    restart_after_failure_delay:
+        type: string
+        description: sleep interval after a failure of the callback or of a Redis request
+        defaultDescription: 1s
+    task_processor:
+        type: string
+        description: task processor to read the streams and to run the callbacks
+        defaultDescription: main-task-processor
+)");
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
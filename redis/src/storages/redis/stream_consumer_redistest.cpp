@@ -0,0 +1,55 @@
+#include <storages/redis/client_redistest.hpp>
+#include <storages/redis/stream_consumer.hpp>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/storages/redis/client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+storages::redis::StreamConsumerSettings MakeSettings() {
+    storages::redis::StreamConsumerSettings settings;
+    settings.streams = {"stream"};
+    settings.group = "group";
+    settings.consumer = "consumer";
+    settings.poll_interval = std::chrono::milliseconds{10};
+    settings.restart_after_failure_delay = std::chrono::milliseconds{10};
+    return settings;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientTest, StreamConsumer) {
+    auto client = GetClient();
+    storages::redis::StreamConsumer consumer{client, MakeSettings(), engine::current_task::GetTaskProcessor()};
+
+    std::vector<std::string> values;
+    engine::SingleConsumerEvent consumed;
+    bool fail_once = true;
+    consumer.Start([&](const std::string& stream, std::vector<storages::redis::StreamEntry>& entries) {
+        EXPECT_EQ(stream, "stream");
+        // The failed batch is read again from the pending entries
+        if (std::exchange(fail_once, false)) throw std::runtime_error("fail");
+        for (auto& entry : entries) values.push_back(entry.fields.at(0).second);
+        if (values.size() == 2) consumed.Send();
+    });
+
+    // Wait for the group to be created
+    while (client->Exists("stream", {}).Get() == 0) engine::SleepFor(std::chrono::milliseconds{1});
+    client->Xadd("stream", {{"field", "1"}}, {}).Get();
+    client->Xadd("stream", {{"field", "2"}}, {}).Get();
+
+    ASSERT_TRUE(consumed.WaitForEventFor(utest::kMaxTestWaitTime));
+    EXPECT_EQ(values, (std::vector<std::string>{"1", "2"}));
+
+    // XACK is sent in background
+    while (!client->Xreadgroup("stream", "group", "consumer", "0", 10, {}).Get().empty()) {
+        engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    consumer.Stop();
+}
+
+USERVER_NAMESPACE_END
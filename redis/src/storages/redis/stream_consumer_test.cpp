@@ -0,0 +1,59 @@
+#include <storages/redis/stream_consumer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/storages/redis/exception.hpp>
+#include <userver/storages/redis/parse_reply.hpp>
+#include <userver/storages/redis/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::ReplyData;
+using storages::redis::StreamEntry;
+
+std::vector<StreamEntry> ParseEntries(ReplyData data) {
+    return Parse(std::move(data), "xreadgroup", storages::redis::To<std::vector<StreamEntry>>{});
+}
+
+ReplyData MakeEntries() {
+    return ReplyData{ReplyData::Array{
+        ReplyData{ReplyData::Array{ReplyData{"1-0"}, ReplyData{ReplyData::Array{ReplyData{"f"}, ReplyData{"v"}}}}},
+        ReplyData{ReplyData::Array{ReplyData{"2-0"}, ReplyData::CreateNil()}},
+    }};
+}
+
+const std::vector<StreamEntry> kExpectedEntries{{"1-0", {{"f", "v"}}}, {"2-0", {}}};
+
+}  // namespace
+
+TEST(StreamConsumer, ParseNil) { EXPECT_TRUE(ParseEntries(ReplyData::CreateNil()).empty()); }
+
+TEST(StreamConsumer, ParseResp2) {
+    auto reply = ReplyData{ReplyData::Array{ReplyData{ReplyData::Array{ReplyData{"stream"}, MakeEntries()}}}};
+    EXPECT_EQ(ParseEntries(std::move(reply)), kExpectedEntries);
+}
+
+TEST(StreamConsumer, ParseResp3) {
+    auto reply = ReplyData{ReplyData::Array{ReplyData{"stream"}, MakeEntries()}};
+    EXPECT_EQ(ParseEntries(std::move(reply)), kExpectedEntries);
+}
+
+TEST(StreamConsumer, ParseInvalid) {
+    EXPECT_THROW(ParseEntries(ReplyData{"stream"}), storages::redis::ParseReplyException);
+    EXPECT_THROW(
+        ParseEntries(ReplyData{ReplyData::Array{ReplyData{"stream"}, ReplyData{"entries"}}}),
+        storages::redis::ParseReplyException
+    );
+}
+
+TEST(StreamConsumer, EntryAge) {
+    using storages::redis::GetStreamEntryAge;
+    const auto now = std::chrono::system_clock::time_point{std::chrono::milliseconds{10'000}};
+    EXPECT_EQ(GetStreamEntryAge("9000-5", now), std::chrono::milliseconds{1000});
+    EXPECT_EQ(GetStreamEntryAge("11000-0", now), std::chrono::milliseconds{0});
+    EXPECT_EQ(GetStreamEntryAge("invalid", now), std::chrono::milliseconds{0});
+}
+
+USERVER_NAMESPACE_END
@@ -310,6 +310,31 @@ public:
 
     RequestType Type(std::string key, const CommandControl& command_control) override;
 
+    RequestXack Xack(
+        std::string key,
+        std::string group,
+        std::vector<std::string> ids,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXadd Xadd(
+        std::string key,
+        std::vector<std::pair<std::string, std::string>> fields,
+        const CommandControl& command_control
+    ) override;
+
+    RequestXgroupCreate
+    XgroupCreate(std::string key, std::string group, std::string id, const CommandControl& command_control) override;
+
+    RequestXreadgroup Xreadgroup(
+        std::string key,
+        std::string group,
+        std::string consumer,
+        std::string id,
+        size_t count,
+        const CommandControl& command_control
+    ) override;
+
     RequestZadd Zadd(std::string key, double score, std::string member, const CommandControl& command_control) override;
 
     RequestZadd Zadd(
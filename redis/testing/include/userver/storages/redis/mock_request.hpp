@@ -74,6 +74,10 @@ public:
         throw RequestFailedException(request_description, ReplyStatus::kTimeoutError);
     }
 
+    ExpectedReply<ReplyType> TryGet(const std::string& /*request_description*/) override {
+        return utils::unexpected{ReplyStatus::kTimeoutError};
+    }
+
     ReplyPtr GetRaw() override {
         UASSERT_MSG(false, "not supported in mocked request");
         return nullptr;
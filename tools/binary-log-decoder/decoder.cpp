@@ -0,0 +1,105 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <userver/logging/binary_log.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+constexpr std::size_t kReadChunkSize = 1 << 16;
+
+struct Config {
+    std::string format = "tskv";
+    std::vector<std::string> files;
+};
+
+Config ParseConfig(int argc, char** argv) {
+    namespace po = boost::program_options;
+
+    Config config;
+    po::options_description desc("Decodes logs written with `format: binary` into a text format.\nAllowed options");
+    desc.add_options()("help,h", "produce help message")(
+        "format,f", po::value(&config.format)->default_value(config.format), "output format (tskv, ltsv, json)"
+    )("files", po::value(&config.files), "binary log files to decode, stdin is read if none are specified");
+
+    po::positional_options_description pos_desc;
+    pos_desc.add("files", -1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(pos_desc).run(), vm);
+        po::notify(vm);
+    } catch (const std::exception& ex) {
+        std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+        exit(1);
+    }
+
+    if (vm.count("help")) {
+        std::cout << desc << '\n';
+        exit(0);
+    }
+
+    return config;
+}
+
+logging::DecodedLogFormat ParseFormat(const std::string& format) {
+    if (format == "tskv") return logging::DecodedLogFormat::kTskv;
+    if (format == "ltsv") return logging::DecodedLogFormat::kLtsv;
+    if (format == "json") return logging::DecodedLogFormat::kJson;
+
+    std::cerr << "Unknown output format '" << format << "', expected one of: tskv, ltsv, json\n";
+    exit(1);
+}
+
+// Returns false if the input ends with a partial record
+bool Decode(std::istream& input, logging::DecodedLogFormat format) {
+    std::string data;
+    std::string decoded;
+    std::vector<char> chunk(kReadChunkSize);
+
+    while (input) {
+        input.read(chunk.data(), chunk.size());
+        data.append(chunk.data(), input.gcount());
+
+        decoded.clear();
+        data.erase(0, logging::DecodeBinaryLog(data, format, decoded));
+        std::cout << decoded;
+    }
+    return data.empty();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto config = ParseConfig(argc, argv);
+    const auto format = ParseFormat(config.format);
+
+    bool has_partial_records = false;
+    try {
+        if (config.files.empty()) {
+            has_partial_records = !Decode(std::cin, format);
+        }
+        for (const auto& file_name : config.files) {
+            std::ifstream file{file_name, std::ios::binary};
+            if (!file) {
+                std::cerr << "Cannot open '" << file_name << "'\n";
+                return 1;
+            }
+            if (!Decode(file, format)) {
+                std::cerr << "'" << file_name << "' ends with a partial record, the record is skipped\n";
+                has_partial_records = true;
+            }
+        }
+    } catch (const logging::BinaryLogDecodeError& ex) {
+        std::cerr << "Failed to decode: " << ex.what() << '\n';
+        return 1;
+    }
+
+    return has_partial_records ? 2 : 0;
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <userver/cache/impl/lru.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// Count-min sketch of 4-bit counters, that estimates the access frequency of
+/// the keys during the recent `10 * capacity` accesses
+class FrequencySketch final {
+public:
+    explicit FrequencySketch(std::size_t capacity) { SetCapacity(capacity); }
+
+    void SetCapacity(std::size_t capacity) {
+        std::size_t words = 8;
+        while (words < capacity) words *= 2;
+        table_.assign(words, 0);
+        sample_size_ = std::max<std::size_t>(capacity, 1) * 10;
+        additions_ = 0;
+    }
+
+    void RecordAccess(std::size_t hash) noexcept {
+        bool added = false;
+        ForEachCounter(hash, [this, &added](std::size_t index, unsigned shift) {
+            auto& word = table_[index];
+            if (((word >> shift) & kCounterMax) != kCounterMax) {
+                word += std::uint64_t{1} << shift;
+                added = true;
+            }
+        });
+
+        if (added && ++additions_ == sample_size_) Age();
+    }
+
+    unsigned GetFrequency(std::size_t hash) const noexcept {
+        auto frequency = static_cast<unsigned>(kCounterMax);
+        ForEachCounter(hash, [this, &frequency](std::size_t index, unsigned shift) {
+            frequency = std::min(frequency, static_cast<unsigned>((table_[index] >> shift) & kCounterMax));
+        });
+        return frequency;
+    }
+
+    void Clear() noexcept {
+        std::fill(table_.begin(), table_.end(), 0);
+        additions_ = 0;
+    }
+
+private:
+    static constexpr std::uint64_t kCounterMax = 15;
+    static constexpr std::size_t kDepth = 4;
+
+    static std::uint64_t Mix(std::uint64_t x) noexcept {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    template <typename Func>
+    void ForEachCounter(std::size_t hash, Func func) const noexcept {
+        // Double hashing, the high 4 bits select the counter within the word
+        const auto h1 = Mix(hash);
+        const auto h2 = Mix(h1) | 1;
+        const auto mask = table_.size() - 1;
+        for (std::size_t i = 0; i < kDepth; ++i) {
+            const auto h = h1 + i * h2;
+            func(h & mask, static_cast<unsigned>(h >> 60) * 4);
+        }
+    }
+
+    // Halves all the counters, so that the sketch forgets the old accesses
+    void Age() noexcept {
+        for (auto& word : table_) word = (word >> 1) & 0x7777777777777777ULL;
+        additions_ /= 2;
+    }
+
+    std::vector<std::uint64_t> table_;
+    std::size_t sample_size_{0};
+    std::size_t additions_{0};
+};
+
+/// W-TinyLFU: new entries go to a small LRU window. Entries evicted from the
+/// window compete with the eviction candidates of the main segmented LRU, and
+/// the one with higher estimated access frequency stays.
+template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+class TinyLfuBase final {
+public:
+    using NodeType = std::unique_ptr<LruNode<T, U>>;
+
+    explicit TinyLfuBase(std::size_t max_size, const Hash& hash = Hash(), const Equal& equal = Equal())
+        : hash_(hash),
+          sketch_(max_size),
+          window_(1, hash, equal),
+          probation_(1, hash, equal),
+          protected_(1, hash, equal) {
+        SetMaxSize(max_size);
+    }
+
+    TinyLfuBase(TinyLfuBase&& other) noexcept = default;
+    TinyLfuBase& operator=(TinyLfuBase&& other) noexcept = default;
+
+    TinyLfuBase(const TinyLfuBase&) = delete;
+    TinyLfuBase& operator=(const TinyLfuBase&) = delete;
+
+    bool Put(const T& key, U value) {
+        sketch_.RecordAccess(hash_(key));
+        if (auto* existing = Find(key)) {
+            *existing = std::move(value);
+            return false;
+        }
+
+        window_.InsertNode(std::make_unique<LruNode<T, U>>(T{key}, std::move(value)));
+        EvictFromWindow();
+        return true;
+    }
+
+    template <typename... Args>
+    U* Emplace(const T& key, Args&&... args) {
+        sketch_.RecordAccess(hash_(key));
+        if (auto* existing = Find(key)) return existing;
+
+        auto& value = window_.InsertNode(std::make_unique<LruNode<T, U>>(T{key}, std::forward<Args>(args)...));
+        EvictFromWindow();
+        return &value;
+    }
+
+    void Erase(const T& key) {
+        window_.Erase(key);
+        probation_.Erase(key);
+        protected_.Erase(key);
+    }
+
+    U* Get(const T& key) {
+        sketch_.RecordAccess(hash_(key));
+        return Find(key);
+    }
+
+    U* GetLeastUsedValue() {
+        if (auto* value = probation_.GetLeastUsedValue()) return value;
+        if (auto* value = protected_.GetLeastUsedValue()) return value;
+        return window_.GetLeastUsedValue();
+    }
+
+    void SetMaxSize(std::size_t new_max_size) {
+        UASSERT(new_max_size > 0);
+        new_max_size = std::max<std::size_t>(new_max_size, 1);
+        if (new_max_size != max_size_) sketch_.SetCapacity(new_max_size);
+        max_size_ = new_max_size;
+        window_size_ = std::max<std::size_t>(max_size_ / 100, 1);
+        const auto main_size = max_size_ - window_size_;
+        protected_size_ = main_size * 4 / 5;
+
+        while (protected_.GetSize() > protected_size_) probation_.InsertNode(protected_.ExtractLeastUsedNode());
+        while (window_.GetSize() > window_size_) probation_.InsertNode(window_.ExtractLeastUsedNode());
+        while (GetMainSize() > main_size) {
+            if (!probation_.ExtractLeastUsedNode()) protected_.ExtractLeastUsedNode();
+        }
+
+        window_.SetMaxSize(window_size_);
+        probation_.SetMaxSize(std::max<std::size_t>(main_size, 1));
+        protected_.SetMaxSize(std::max<std::size_t>(protected_size_, 1));
+    }
+
+    void Clear() noexcept {
+        window_.Clear();
+        probation_.Clear();
+        protected_.Clear();
+        sketch_.Clear();
+    }
+
+    template <typename Function>
+    void VisitAll(Function&& func) const {
+        window_.VisitAll(func);
+        probation_.VisitAll(func);
+        protected_.VisitAll(func);
+    }
+
+    template <typename Function>
+    void VisitAll(Function&& func) {
+        window_.VisitAll(func);
+        probation_.VisitAll(func);
+        protected_.VisitAll(func);
+    }
+
+    std::size_t GetSize() const { return window_.GetSize() + GetMainSize(); }
+
+    std::size_t GetCapacity() const { return max_size_; }
+
+    /// Returns the count of entries that were not admitted to the main LRU
+    std::size_t GetAdmissionRejects() const noexcept { return admission_rejects_; }
+
+private:
+    std::size_t GetMainSize() const { return probation_.GetSize() + protected_.GetSize(); }
+
+    U* Find(const T& key) {
+        if (auto* value = window_.Get(key)) return value;
+        if (auto* value = protected_.Get(key)) return value;
+
+        auto node = probation_.ExtractNode(key);
+        if (!node) return nullptr;
+        if (protected_size_ == 0) return &probation_.InsertNode(std::move(node));
+
+        auto& value = protected_.InsertNode(std::move(node));
+        if (protected_.GetSize() > protected_size_) probation_.InsertNode(protected_.ExtractLeastUsedNode());
+        return &value;
+    }
+
+    void EvictFromWindow() {
+        if (window_.GetSize() <= window_size_) return;
+
+        auto candidate = window_.ExtractLeastUsedNode();
+        if (GetMainSize() < max_size_ - window_size_) {
+            probation_.InsertNode(std::move(candidate));
+            return;
+        }
+        if (max_size_ == window_size_) return;
+
+        auto& victim_part = probation_.GetSize() != 0 ? probation_ : protected_;
+        const auto* victim_key = victim_part.GetLeastUsedKey();
+        UASSERT(victim_key);
+        if (sketch_.GetFrequency(hash_(candidate->GetKey())) > sketch_.GetFrequency(hash_(*victim_key))) {
+            victim_part.ExtractLeastUsedNode();
+            probation_.InsertNode(std::move(candidate));
+        } else {
+            ++admission_rejects_;
+        }
+    }
+
+    Hash hash_;
+    FrequencySketch sketch_;
+    LruBase<T, U, Hash, Equal> window_;
+    LruBase<T, U, Hash, Equal> probation_;
+    LruBase<T, U, Hash, Equal> protected_;
+    std::size_t max_size_{0};
+    std::size_t window_size_{0};
+    std::size_t protected_size_{0};
+    std::size_t admission_rejects_{0};
+};
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,11 @@
 /// @file userver/cache/lru_map.hpp
 /// @brief @copybrief cache::LruMap
 
+#include <type_traits>
+
 #include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/tiny_lfu.hpp>
+#include <userver/cache/policy.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,7 +18,16 @@ namespace cache {
 ///
 /// LRU key value storage (LRU cache), thread safety matches Standard Library
 /// thread safety
-template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+///
+/// With `Policy == CachePolicy::kTinyLFU` new keys may be not admitted to the
+/// cache if they are accessed less frequently than the ones they would evict,
+/// see cache::CachePolicy.
+template <
+    typename T,
+    typename U,
+    typename Hash = std::hash<T>,
+    typename Equal = std::equal_to<T>,
+    CachePolicy Policy = CachePolicy::kLRU>
 class LruMap final {
 public:
     explicit LruMap(size_t max_size, const Hash& hash = Hash(), const Equal& equal = Equal())
@@ -58,6 +71,14 @@ public:
     /// @warning Returned pointer may be freed on the next map access!
     U* GetLeastUsed() { return impl_.GetLeastUsedValue(); }
 
+    /// Returns pointer to the least recently used key;
+    /// returns nullptr if LRU is empty. Only available for CachePolicy::kLRU.
+    /// @warning Returned pointer may be freed on the next map access!
+    const T* GetLeastUsedKey() const {
+        static_assert(Policy == CachePolicy::kLRU, "Not implemented for the policy");
+        return impl_.GetLeastUsedKey();
+    }
+
     /// Sets the max size of the LRU, truncates values if new_max_size < GetSize()
     void SetMaxSize(size_t new_max_size) { return impl_.SetMaxSize(new_max_size); }
 
@@ -80,8 +101,22 @@ public:
 
     std::size_t GetCapacity() const { return impl_.GetCapacity(); }
 
+    /// Returns the count of keys that were evicted from the cache by the
+    /// admission policy instead of the least used ones, always 0 for kLRU
+    std::size_t GetAdmissionRejects() const noexcept {
+        if constexpr (Policy == CachePolicy::kTinyLFU) {
+            return impl_.GetAdmissionRejects();
+        } else {
+            return 0;
+        }
+    }
+
 private:
-    impl::LruBase<T, U, Hash, Equal> impl_;
+    std::conditional_t<
+        Policy == CachePolicy::kTinyLFU,
+        impl::TinyLfuBase<T, U, Hash, Equal>,
+        impl::LruBase<T, U, Hash, Equal>>
+        impl_;
 };
 
 }  // namespace cache
@@ -0,0 +1,451 @@
+#pragma once
+
+/// @file userver/cache/persistent_hash_map.hpp
+/// @brief @copybrief cache::PersistentHashMap
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Hash map with structural sharing (hash array mapped trie)
+///
+/// Copying the map is O(1): the copy shares all the nodes with the original.
+/// Modification copies only the nodes on the path to the modified entry,
+/// O(log32(size)) nodes, the rest of the nodes stay shared.
+///
+/// That makes the map a good fit for caches with incremental updates, e.g.
+/// components::PostgreCache and components::MongoCache: copying the current
+/// snapshot and applying a handful of changes to it allocates memory only
+/// for the changed paths instead of copying the whole container. The price is
+/// lookup speed: a lookup in a big map takes a few dependent memory reads per
+/// trie level and is several times slower than in std::unordered_map.
+///
+/// @snippet cache/persistent_hash_map_test.cpp  Sample persistent hash map
+///
+/// Thread safety matches Standard Library thread safety, different copies of
+/// the map may be used concurrently. Iteration is const only, modify the
+/// values via operator[] or insert_or_assign().
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class PersistentHashMap final {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    explicit PersistentHashMap(const Hash& hash = Hash(), const Equal& equal = Equal()) : hash_(hash), equal_(equal) {}
+
+    PersistentHashMap(const PersistentHashMap&) = default;
+    PersistentHashMap(PersistentHashMap&& other) noexcept
+        : root_(std::move(other.root_)),
+          size_(std::exchange(other.size_, 0)),
+          hash_(std::move(other.hash_)),
+          equal_(std::move(other.equal_)) {}
+    PersistentHashMap& operator=(const PersistentHashMap&) = default;
+    PersistentHashMap& operator=(PersistentHashMap&& other) noexcept {
+        PersistentHashMap{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator begin() const { return const_iterator{root_.get()}; }
+    const_iterator end() const noexcept { return const_iterator{}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    const_iterator find(const Key& key) const;
+    size_type count(const Key& key) const { return FindLeaf(key) ? 1 : 0; }
+    bool contains(const Key& key) const { return FindLeaf(key) != nullptr; }
+
+    /// @throws std::out_of_range if there is no such key
+    const Value& at(const Key& key) const;
+
+    /// Returns a reference to the value of the key, default-constructs the
+    /// value if there is none. Unshares the path to the value.
+    Value& operator[](const Key& key);
+
+    /// @returns true if the key is a new one
+    template <typename K, typename M>
+    bool insert_or_assign(K&& key, M&& value);
+
+    /// Inserts the value if there is no such key
+    /// @returns true if the value was inserted
+    bool insert(value_type value);
+
+    /// @returns the number of erased entries
+    size_type erase(const Key& key);
+
+    void clear() noexcept {
+        root_.reset();
+        size_ = 0;
+    }
+
+    friend bool operator==(const PersistentHashMap& lhs, const PersistentHashMap& rhs) {
+        if (lhs.size_ != rhs.size_) return false;
+        if (lhs.root_ == rhs.root_) return true;
+        for (const auto& [key, value] : lhs) {
+            const auto* leaf = rhs.FindLeaf(key);
+            if (!leaf || !(leaf->value.second == value)) return false;
+        }
+        return true;
+    }
+
+    friend bool operator!=(const PersistentHashMap& lhs, const PersistentHashMap& rhs) { return !(lhs == rhs); }
+
+    void swap(PersistentHashMap& other) noexcept {
+        using std::swap;
+        swap(root_, other.root_);
+        swap(size_, other.size_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+    }
+
+private:
+    static constexpr std::size_t kBitsPerLevel = 5;
+    static constexpr std::size_t kHashBits = sizeof(std::size_t) * 8;
+    // Nodes at this depth have no hash bits left and hold colliding leaves
+    static constexpr std::size_t kMaxDepth = (kHashBits + kBitsPerLevel - 1) / kBitsPerLevel;
+
+    struct Leaf final {
+        std::size_t hash;
+        value_type value;
+    };
+    using LeafPtr = std::shared_ptr<Leaf>;
+
+    struct Node;
+    using NodePtr = std::shared_ptr<Node>;
+
+    // Exactly one of the pointers is set
+    struct Slot final {
+        NodePtr node;
+        LeafPtr leaf;
+    };
+
+    // Non-root nodes always contain either a subnode or at least two leaves
+    struct Node final {
+        // Not used in collision nodes
+        std::uint32_t bitmap{0};
+        // Ordered by fragment
+        std::vector<Slot> slots;
+    };
+
+    static std::uint32_t FragmentBit(std::size_t hash, std::size_t depth) noexcept {
+        return std::uint32_t{1} << ((hash >> (depth * kBitsPerLevel)) & ((1U << kBitsPerLevel) - 1));
+    }
+
+    static std::size_t SlotIndex(const Node& node, std::uint32_t bit) noexcept {
+        return __builtin_popcount(node.bitmap & (bit - 1));
+    }
+
+    // Nodes referenced from a single place belong to this map only and may be
+    // modified in place, others are copied
+    static Node& Unshare(NodePtr& node) {
+        if (!node) {
+            node = std::make_shared<Node>();
+        } else if (node.use_count() != 1) {
+            node = std::make_shared<Node>(*node);
+        }
+        return *node;
+    }
+
+    static Leaf& Unshare(LeafPtr& leaf) {
+        if (leaf.use_count() != 1) leaf = std::make_shared<Leaf>(*leaf);
+        return *leaf;
+    }
+
+    const Leaf* FindLeaf(const Key& key) const;
+
+    // Unshares the path to the key and returns its leaf slot. Leaf made by
+    // `make_leaf` is inserted if there is no such key.
+    template <typename MakeLeaf>
+    std::pair<LeafPtr*, bool> FindOrInsert(std::size_t hash, const Key& key, MakeLeaf&& make_leaf);
+
+    static void EraseFrom(NodePtr& node_ptr, std::size_t depth, std::size_t hash, const Key& key, const Equal& equal);
+
+    NodePtr root_;
+    size_type size_{0};
+    Hash hash_;
+    Equal equal_;
+};
+
+/// Forward iterator over the entries of the map in no particular order
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentHashMap<Key, Value, Hash, Equal>::const_iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename PersistentHashMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    const_iterator() noexcept = default;
+
+    reference operator*() const { return Current().leaf->value; }
+    pointer operator->() const { return &Current().leaf->value; }
+
+    const_iterator& operator++() {
+        ++path_[depth_ - 1].index;
+        Settle();
+        return *this;
+    }
+
+    const_iterator operator++(int) {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept {
+        if (depth_ != other.depth_) return false;
+        return depth_ == 0 || (path_[depth_ - 1].node == other.path_[depth_ - 1].node &&
+                               path_[depth_ - 1].index == other.path_[depth_ - 1].index);
+    }
+    bool operator!=(const const_iterator& other) const noexcept { return !(*this == other); }
+
+private:
+    friend class PersistentHashMap;
+
+    struct Frame final {
+        const Node* node{nullptr};
+        std::size_t index{0};
+    };
+
+    explicit const_iterator(const Node* root) {
+        if (!root) return;
+        path_[depth_++] = Frame{root, 0};
+        Settle();
+    }
+
+    const Slot& Current() const { return path_[depth_ - 1].node->slots[path_[depth_ - 1].index]; }
+
+    // Moves to the nearest leaf starting from the current position
+    void Settle() {
+        while (depth_ > 0) {
+            auto& frame = path_[depth_ - 1];
+            if (frame.index == frame.node->slots.size()) {
+                if (--depth_ > 0) ++path_[depth_ - 1].index;
+                continue;
+            }
+            const auto& slot = frame.node->slots[frame.index];
+            if (!slot.node) return;
+            path_[depth_++] = Frame{slot.node.get(), 0};
+        }
+    }
+
+    std::array<Frame, kMaxDepth + 1> path_{};
+    std::size_t depth_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::FindLeaf(const Key& key) const -> const Leaf* {
+    const Node* node = root_.get();
+    const auto hash = hash_(key);
+    for (std::size_t depth = 0; node; ++depth) {
+        if (depth == kMaxDepth) {
+            for (const auto& slot : node->slots) {
+                if (equal_(slot.leaf->value.first, key)) return slot.leaf.get();
+            }
+            return nullptr;
+        }
+
+        const auto bit = FragmentBit(hash, depth);
+        if (!(node->bitmap & bit)) return nullptr;
+        const auto& slot = node->slots[SlotIndex(*node, bit)];
+        if (!slot.node) {
+            return slot.leaf->hash == hash && equal_(slot.leaf->value.first, key) ? slot.leaf.get() : nullptr;
+        }
+        node = slot.node.get();
+    }
+    return nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::find(const Key& key) const -> const_iterator {
+    const_iterator it;
+    const Node* node = root_.get();
+    const auto hash = hash_(key);
+    for (std::size_t depth = 0; node; ++depth) {
+        std::size_t index = 0;
+        if (depth == kMaxDepth) {
+            for (; index < node->slots.size(); ++index) {
+                if (equal_(node->slots[index].leaf->value.first, key)) break;
+            }
+            if (index == node->slots.size()) return end();
+        } else {
+            const auto bit = FragmentBit(hash, depth);
+            if (!(node->bitmap & bit)) return end();
+            index = SlotIndex(*node, bit);
+        }
+
+        it.path_[it.depth_++] = typename const_iterator::Frame{node, index};
+        const auto& slot = node->slots[index];
+        if (!slot.node) {
+            if (slot.leaf->hash != hash || !equal_(slot.leaf->value.first, key)) return end();
+            return it;
+        }
+        node = slot.node.get();
+    }
+    return end();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& PersistentHashMap<Key, Value, Hash, Equal>::at(const Key& key) const {
+    const auto* leaf = FindLeaf(key);
+    if (!leaf) throw std::out_of_range("No such key in PersistentHashMap");
+    return leaf->value.second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value& PersistentHashMap<Key, Value, Hash, Equal>::operator[](const Key& key) {
+    const auto hash = hash_(key);
+    auto [leaf, inserted] = FindOrInsert(hash, key, [&] {
+        return std::make_shared<Leaf>(Leaf{hash, value_type{key, Value{}}});
+    });
+    if (inserted) {
+        ++size_;
+    } else {
+        Unshare(*leaf);
+    }
+    return (*leaf)->value.second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename K, typename M>
+bool PersistentHashMap<Key, Value, Hash, Equal>::insert_or_assign(K&& key, M&& value) {
+    const Key& key_ref = key;
+    const auto hash = hash_(key_ref);
+    auto [leaf, inserted] = FindOrInsert(hash, key_ref, [&] {
+        return std::make_shared<Leaf>(Leaf{hash, value_type{std::forward<K>(key), std::forward<M>(value)}});
+    });
+    if (inserted) {
+        ++size_;
+    } else if (leaf->use_count() == 1) {
+        (*leaf)->value.second = std::forward<M>(value);
+    } else {
+        // Not copying the old value just to overwrite it
+        *leaf = std::make_shared<Leaf>(Leaf{hash, value_type{(*leaf)->value.first, std::forward<M>(value)}});
+    }
+    return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentHashMap<Key, Value, Hash, Equal>::insert(value_type value) {
+    if (contains(value.first)) return false;
+    const auto hash = hash_(value.first);
+    const Key& key = value.first;
+    FindOrInsert(hash, key, [&] { return std::make_shared<Leaf>(Leaf{hash, std::move(value)}); });
+    ++size_;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::erase(const Key& key) -> size_type {
+    // Not unsharing the path to a missing key
+    if (!contains(key)) return 0;
+    EraseFrom(root_, 0, hash_(key), key, equal_);
+    if (--size_ == 0) root_.reset();
+    return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename MakeLeaf>
+auto PersistentHashMap<Key, Value, Hash, Equal>::FindOrInsert(std::size_t hash, const Key& key, MakeLeaf&& make_leaf)
+    -> std::pair<LeafPtr*, bool> {
+    NodePtr* node_ptr = &root_;
+    for (std::size_t depth = 0;; ++depth) {
+        auto& node = Unshare(*node_ptr);
+
+        if (depth == kMaxDepth) {
+            for (auto& slot : node.slots) {
+                if (equal_(slot.leaf->value.first, key)) return {&slot.leaf, false};
+            }
+            auto leaf = make_leaf();
+            node.slots.push_back(Slot{nullptr, std::move(leaf)});
+            return {&node.slots.back().leaf, true};
+        }
+
+        const auto bit = FragmentBit(hash, depth);
+        const auto index = SlotIndex(node, bit);
+        if (!(node.bitmap & bit)) {
+            auto leaf = make_leaf();
+            node.slots.insert(node.slots.begin() + index, Slot{nullptr, std::move(leaf)});
+            node.bitmap |= bit;
+            return {&node.slots[index].leaf, true};
+        }
+
+        auto& slot = node.slots[index];
+        if (!slot.node) {
+            if (slot.leaf->hash == hash && equal_(slot.leaf->value.first, key)) return {&slot.leaf, false};
+
+            // Pushing the existing leaf one level down, the loop continues
+            // from the new node
+            auto child = std::make_shared<Node>();
+            const auto child_depth = depth + 1;
+            if (child_depth != kMaxDepth) child->bitmap = FragmentBit(slot.leaf->hash, child_depth);
+            child->slots.push_back(Slot{nullptr, std::move(slot.leaf)});
+            slot.node = std::move(child);
+        }
+        node_ptr = &slot.node;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentHashMap<Key, Value, Hash, Equal>::EraseFrom(
+    NodePtr& node_ptr,
+    std::size_t depth,
+    std::size_t hash,
+    const Key& key,
+    const Equal& equal
+) {
+    auto& node = Unshare(node_ptr);
+
+    if (depth == kMaxDepth) {
+        for (auto it = node.slots.begin(); it != node.slots.end(); ++it) {
+            if (equal(it->leaf->value.first, key)) {
+                node.slots.erase(it);
+                return;
+            }
+        }
+        return;
+    }
+
+    const auto bit = FragmentBit(hash, depth);
+    const auto index = SlotIndex(node, bit);
+    auto& slot = node.slots[index];
+    if (!slot.node) {
+        node.slots.erase(node.slots.begin() + index);
+        node.bitmap &= ~bit;
+        return;
+    }
+
+    EraseFrom(slot.node, depth + 1, hash, key, equal);
+    auto& child_slots = slot.node->slots;
+    if (child_slots.size() == 1 && !child_slots.front().node) {
+        // A lone leaf is pulled up to keep the trie compact
+        slot.leaf = std::move(child_slots.front().leaf);
+        slot.node.reset();
+    }
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
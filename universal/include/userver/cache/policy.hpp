@@ -0,0 +1,23 @@
+#pragma once
+
+/// @file userver/cache/policy.hpp
+/// @brief @copybrief cache::CachePolicy
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// Eviction policy of cache::LruMap and cache::NWayLRU
+enum class CachePolicy {
+    /// Evicts the least recently used entries
+    kLRU,
+    /// W-TinyLFU: new entries are kept in a small LRU window, and then are
+    /// admitted to the main segmented LRU only if they are accessed more
+    /// frequently than the entry they are about to evict. Protects the hot
+    /// entries from one-hit wonders on scans.
+    kTinyLFU,
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__has_feature)
+
+#if __has_feature(address_sanitizer)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_HAS_ASAN 1
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_HAS_ASAN 0
+#endif
+
+#else
+
+#if defined(__SANITIZE_ADDRESS__)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_HAS_ASAN 1
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_HAS_ASAN 0
+#endif
+
+#endif
+
+#if USERVER_IMPL_HAS_ASAN
+#include <sanitizer/asan_interface.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compiler::impl {
+
+/// Marks the memory as addressable, e.g. after it was used as a stack by
+/// another thread of execution that did not return
+inline void AsanUnpoisonMemoryRegion([[maybe_unused]] const void* address, [[maybe_unused]] std::size_t size) {
+#if USERVER_IMPL_HAS_ASAN
+    __asan_unpoison_memory_region(address, size);
+#endif
+}
+
+}  // namespace compiler::impl
+
+USERVER_NAMESPACE_END
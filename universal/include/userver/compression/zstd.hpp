@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +11,171 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+/// Default zstd compression level, same as ZSTD_CLEVEL_DEFAULT
+inline constexpr int kDefaultLevel = 3;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a single zstd frame.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// @brief Pre-digested zstd dictionary for compression and decompression.
+///
+/// Dictionaries greatly improve the compression ratio of small similar
+/// payloads. They are trained offline, e.g. with `zstd --train samples/*`, and
+/// are shipped to the service as a file or as a secdist value. The same
+/// dictionary must be used for compression and decompression.
+///
+/// Copies share the digested dictionary, it is safe to use a Dictionary from
+/// multiple threads.
+class Dictionary final {
+public:
+    /// @param content raw dictionary, as produced by `zstd --train`
+    /// @param level compression level of the data compressed with the
+    /// dictionary
+    /// @throws CompressionError if the dictionary is malformed
+    explicit Dictionary(std::string_view content, int level = kDefaultLevel);
+
+    /// Reads the dictionary from the file, blocks the current thread.
+    /// @throws CompressionError if the dictionary is malformed
+    /// @throws std::runtime_error if the file could not be read
+    static Dictionary FromFile(const std::string& path, int level = kDefaultLevel);
+
+    /// The ID of the dictionary that is written into the compressed frames, 0
+    /// for raw content dictionaries.
+    unsigned GetId() const noexcept;
+
+private:
+    friend class Compressor;
+    friend class Decompressor;
+    friend class StreamCompressor;
+    friend class StreamDecompressor;
+
+    struct Impl;
+
+    std::shared_ptr<const Impl> impl_;
+};
+
+/// @brief Compressor that reuses its zstd context between the calls.
+///
+/// Use it instead of zstd::Compress() to compress many payloads with the same
+/// settings, e.g. keep one per thread or per connection. Not thread-safe.
+class Compressor final {
+public:
+    /// @throws CompressionError
+    explicit Compressor(int level = kDefaultLevel);
+
+    Compressor(Compressor&&) noexcept;
+    Compressor& operator=(Compressor&&) noexcept;
+    ~Compressor();
+
+    /// Compresses large buffers by `workers` threads spawned by zstd, 0 means
+    /// compression in the calling thread. Compress() still blocks until the
+    /// whole buffer is compressed, so do that in a task processor that is
+    /// allowed to block.
+    /// @throws CompressionError if zstd is built without multithreading support
+    void SetWorkers(int workers);
+
+    /// Compresses the data into a single zstd frame.
+    /// @throws CompressionError
+    std::string Compress(std::string_view data);
+
+    /// Compresses the data into a single zstd frame with the dictionary, the
+    /// compression level of the dictionary is used.
+    /// @throws CompressionError
+    std::string Compress(std::string_view data, const Dictionary& dictionary);
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Decompressor that reuses its zstd context between the calls.
+///
+/// Not thread-safe.
+class Decompressor final {
+public:
+    /// @throws DecompressionError
+    Decompressor();
+
+    Decompressor(Decompressor&&) noexcept;
+    Decompressor& operator=(Decompressor&&) noexcept;
+    ~Decompressor();
+
+    /// Decompresses the data.
+    /// @throws DecompressionError
+    std::string Decompress(std::string_view compressed, std::size_t max_size);
+
+    /// Decompresses the data that was compressed with the dictionary.
+    /// @throws DecompressionError
+    std::string Decompress(std::string_view compressed, std::size_t max_size, const Dictionary& dictionary);
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+/// Incremental zstd compressor. Output of each Compress() call is flushed, so
+/// the peer is able to decompress it without waiting for the rest of the data.
+class StreamCompressor final {
+public:
+    /// @throws CompressionError
+    explicit StreamCompressor(int level = kDefaultLevel);
+
+    /// Compresses the stream with the dictionary.
+    /// @throws CompressionError
+    explicit StreamCompressor(const Dictionary& dictionary);
+
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// Compresses the next chunk of data.
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// Ends the zstd frame, no Compress() calls are allowed after that.
+    /// @throws CompressionError
+    std::string Finish();
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+/// Incremental zstd decompressor, accepts the compressed data in chunks of
+/// any size.
+class StreamDecompressor final {
+public:
+    /// @param max_size limit for the total size of the decompressed data
+    /// @throws DecompressionError
+    explicit StreamDecompressor(std::size_t max_size);
+
+    /// Decompresses the stream that was compressed with the dictionary.
+    /// @throws DecompressionError
+    StreamDecompressor(std::size_t max_size, const Dictionary& dictionary);
+
+    StreamDecompressor(StreamDecompressor&&) noexcept;
+    StreamDecompressor& operator=(StreamDecompressor&&) noexcept;
+    ~StreamDecompressor();
+
+    /// Decompresses the next chunk, returns the data that could be
+    /// decompressed so far.
+    /// @throws DecompressionError, TooBigError
+    std::string Decompress(std::string_view chunk);
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
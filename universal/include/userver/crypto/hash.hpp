@@ -4,7 +4,13 @@
 /// @brief @copybrief crypto::hash
 /// @ingroup userver_universal
 
+#include <memory>
+#include <string>
 #include <string_view>
+#include <vector>
+
+#include <userver/crypto/basic_types.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -79,6 +85,45 @@ std::string HmacSha384(std::string_view key, std::string_view message, OutputEnc
 /// @throws CryptoException internal library exception
 std::string HmacSha512(std::string_view key, std::string_view message, OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief HMAC calculator for many messages signed with the same key
+///
+/// The padded key is hashed once on construction, so calculating a HMAC of a
+/// short message is about twice as fast as with crypto::hash::HmacSha256 and
+/// the alike. Calculate() and CalculateBatch() may be called concurrently.
+///
+/// ## Example:
+///
+/// @code
+/// const crypto::hash::Hmac hmac{crypto::DigestSize::k256, key};
+/// for (const auto& request : requests) Sign(request, hmac.Calculate(request.body));
+/// @endcode
+class Hmac final {
+public:
+    /// @param digest_size selects SHA-1 (k160), SHA-256, SHA-384 or SHA-512
+    /// @param key HMAC key
+    /// @throws CryptoException internal library exception
+    Hmac(DigestSize digest_size, std::string_view key);
+
+    Hmac(Hmac&&) noexcept;
+    Hmac& operator=(Hmac&&) noexcept;
+    ~Hmac();
+
+    /// @brief Calculates HMAC of the message, encodes result with `encoding`
+    /// algorithm
+    /// @throws CryptoException internal library exception
+    std::string Calculate(std::string_view message, OutputEncoding encoding = OutputEncoding::kHex) const;
+
+    /// @brief Calculates HMACs of the messages, the results are in the same
+    /// order as the messages
+    /// @throws CryptoException internal library exception
+    std::vector<std::string>
+    CalculateBatch(utils::span<const std::string_view> messages, OutputEncoding encoding = OutputEncoding::kHex) const;
+
+private:
+    class Impl;
+    std::unique_ptr<const Impl> impl_;
+};
+
 /// Broken cryptographic hashes, must not be used except for compatibility
 namespace weak {
 
@@ -18,8 +18,10 @@
 // Licence:     BSD
 // ==================================================================
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <ios>
 #include <iosfwd>
@@ -1214,6 +1216,35 @@ void TrimTrailingZeros(int64_t& after, int& after_precision);
 
 std::string ToString(int64_t before, int64_t after, int precision, const FormatOptions& format_options);
 
+/// Size of the FormatUnpacked buffer: sign, 19 integral digits, dot,
+/// kMaxDecimalDigits fractional digits and 7 chars of room for the 8-char
+/// stores
+inline constexpr std::size_t kFormatBufferSize = 1 + 19 + 1 + kMaxDecimalDigits + 7;
+
+/// Writes `before` and `after_digits` fractional digits of `after` into `out`
+/// of kFormatBufferSize, without the dot if `after_digits` is 0. Digits are
+/// produced 8 at a time.
+/// @returns count of the written chars
+std::size_t FormatUnpacked(char* out, bool is_negative, uint64_t before, uint64_t after, int after_digits) noexcept;
+
+template <int Prec, typename RoundPolicy>
+std::size_t Format(char* out, Decimal<Prec, RoundPolicy> dec, int after_digits, bool remove_trailing_zeros) {
+    auto [before, after] = AsUnpacked(dec, after_digits);
+    if (remove_trailing_zeros) TrimTrailingZeros(after, after_digits);
+
+    // Negation in uint64_t does not overflow on kMinInt64
+    const bool is_negative = after_digits > 0 ? dec.Sign() == -1 : before < 0;
+    const auto abs_before = static_cast<uint64_t>(before);
+    const auto abs_after = static_cast<uint64_t>(after);
+    return FormatUnpacked(
+        out,
+        is_negative,
+        before < 0 ? 0 - abs_before : abs_before,
+        after < 0 ? 0 - abs_after : abs_after,
+        after_digits
+    );
+}
+
 }  // namespace impl
 
 template <int Prec, typename RoundPolicy>
@@ -1249,7 +1280,8 @@ constexpr Decimal<Prec, RoundPolicy> Decimal<Prec, RoundPolicy>::FromStringPermi
 /// @see ToStringFixed
 template <int Prec, typename RoundPolicy>
 std::string ToString(Decimal<Prec, RoundPolicy> dec) {
-    return fmt::to_string(dec);
+    char buffer[impl::kFormatBufferSize];
+    return std::string(buffer, impl::Format(buffer, dec, Prec, true));
 }
 
 /// @brief Converts Decimal to a string
@@ -1283,7 +1315,8 @@ std::string ToString(const Decimal<Prec, RoundPolicy>& dec, const FormatOptions&
 /// @see ToStringFixed
 template <int Prec, typename RoundPolicy>
 std::string ToStringTrailingZeros(Decimal<Prec, RoundPolicy> dec) {
-    return fmt::format(FMT_COMPILE("{:f}"), dec);
+    char buffer[impl::kFormatBufferSize];
+    return std::string(buffer, impl::Format(buffer, dec, Prec, false));
 }
 
 /// @brief Converts Decimal to a string with exactly `NewPrec` decimal digits
@@ -1427,21 +1460,11 @@ public:
 
     template <typename FormatContext>
     auto format(const USERVER_NAMESPACE::decimal64::Decimal<Prec, RoundPolicy>& dec, FormatContext& ctx) const {
-        int after_digits = custom_precision_.value_or(Prec);
-        auto [before, after] = USERVER_NAMESPACE::decimal64::impl::AsUnpacked(dec, after_digits);
-        if (remove_trailing_zeros_) {
-            USERVER_NAMESPACE::decimal64::impl::TrimTrailingZeros(after, after_digits);
-        }
-
-        if (after_digits > 0) {
-            if (dec.Sign() == -1) {
-                return fmt::format_to(ctx.out(), FMT_COMPILE("-{}.{:0{}}"), -before, -after, after_digits);
-            } else {
-                return fmt::format_to(ctx.out(), FMT_COMPILE("{}.{:0{}}"), before, after, after_digits);
-            }
-        } else {
-            return fmt::format_to(ctx.out(), FMT_COMPILE("{}"), before);
-        }
+        char buffer[USERVER_NAMESPACE::decimal64::impl::kFormatBufferSize];
+        const auto size = USERVER_NAMESPACE::decimal64::impl::Format(
+            buffer, dec, custom_precision_.value_or(Prec), remove_trailing_zeros_
+        );
+        return std::copy(buffer, buffer + size, ctx.out());
     }
 
 private:
@@ -0,0 +1,76 @@
+#pragma once
+
+/// @file userver/formats/json/arena.hpp
+/// @brief @copybrief formats::json::Arena
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief Reusable monotonic memory for formats::json::ValueBuilder and
+/// formats::json::StringBuilder.
+///
+/// Strings, arrays and objects of the builders constructed over the arena are
+/// allocated from it, freeing them is a no-op. Reset() makes all the memory
+/// reusable at once, so an arena that lives as long as a task (e.g. in an
+/// engine::TaskLocalVariable) and is reset after each request does almost no
+/// heap allocations after warm-up.
+///
+/// @warning Values built over the arena (including the ones extracted from
+/// the builder and the ones they were moved into) reference its memory and
+/// must be destroyed before Reset() or destruction of the arena. Use
+/// formats::json::Value::Clone() to get an owning Value.
+///
+/// The arena is not thread-safe.
+class Arena final {
+public:
+    static constexpr std::size_t kDefaultInitialCapacity = 16 * 1024;
+
+    explicit Arena(std::size_t initial_capacity = kDefaultInitialCapacity);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// @brief Makes all the memory reusable. If the memory was grown since the
+    /// previous reset, it is coalesced into a single block of the total size.
+    void Reset() noexcept;
+
+    /// @brief Returns the total size of the allocated memory blocks.
+    std::size_t GetCapacity() const noexcept;
+
+    /// @brief Returns the size of memory used since the last Reset().
+    std::size_t GetUsedSize() const noexcept;
+
+    /// @cond
+    // Returns `size` bytes aligned to alignof(std::max_align_t)
+    void* Allocate(std::size_t size);
+
+    // Grows or shrinks the latest allocation in place, if possible
+    bool TryResizeLast(void* ptr, std::size_t new_size) noexcept;
+    /// @endcond
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    void AddBlock(std::size_t min_size);
+
+    std::vector<Block> blocks_;
+    std::size_t current_{0};
+    std::size_t offset_{0};
+    std::size_t used_in_previous_{0};
+    void* last_{nullptr};
+};
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -40,6 +40,8 @@ public:
 
     void OnMembersChange();
 
+    Allocator& GetAllocator() const;
+
 private:
     struct JsonPath;
     struct Impl;
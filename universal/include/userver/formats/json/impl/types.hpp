@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string_view>
 #include <type_traits>
 
 #include <userver/formats/common/type.hpp>
@@ -23,12 +25,35 @@ namespace formats::json {
 using formats::common::Type;
 
 class Value;
+class Arena;
 
 namespace impl {
+
+/// rapidjson allocator that allocates either from the heap or from the
+/// formats::json::Arena. The blocks of both kinds may be mixed in a single
+/// document, Free tells them apart by the address alignment.
+class Allocator final {
+public:
+    static constexpr bool kNeedFree = true;
+
+    Allocator() noexcept = default;
+    explicit Allocator(Arena& arena) noexcept : arena_(&arena) {}
+
+    void* Malloc(std::size_t size);
+    void* Realloc(void* original_ptr, std::size_t original_size, std::size_t new_size);
+    static void Free(void* ptr) noexcept;
+
+    bool operator==(const Allocator& other) const noexcept { return arena_ == other.arena_; }
+    bool operator!=(const Allocator& other) const noexcept { return arena_ != other.arena_; }
+
+private:
+    Arena* arena_{nullptr};
+};
+
 // rapidjson integration
 using UTF8 = ::rapidjson::UTF8<char>;
-using Value = ::rapidjson::GenericValue<UTF8, ::rapidjson::CrtAllocator>;
-using Document = ::rapidjson::GenericDocument<UTF8, ::rapidjson::CrtAllocator, ::rapidjson::CrtAllocator>;
+using Value = ::rapidjson::GenericValue<UTF8, Allocator>;
+using Document = ::rapidjson::GenericDocument<UTF8, Allocator, ::rapidjson::CrtAllocator>;
 
 class VersionedValuePtr final {
 public:
@@ -60,6 +85,16 @@ public:
     size_t Version() const;
     void BumpVersion();
 
+    Allocator& GetAllocator() const;
+
+    /// Enables the member lookups by hash in big objects, the tree must not be
+    /// modified anymore
+    void EnableMemberIndexes();
+
+    /// @returns the first member of the `object` from this tree with the `key`,
+    /// nullptr if none
+    const impl::Value* FindMember(const impl::Value& object, std::string_view key) const;
+
 private:
     struct Data;
 
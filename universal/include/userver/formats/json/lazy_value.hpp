@@ -0,0 +1,142 @@
+#pragma once
+
+/// @file userver/formats/json/lazy_value.hpp
+/// @brief @copybrief formats::json::LazyValue
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief Non-owning on-demand view of a JSON document.
+///
+/// Unlike formats::json::Value, no DOM is built on construction: the document
+/// is only validated and every lookup scans the original text, skipping the
+/// members that are not needed without allocating them. This is beneficial
+/// if only a few fields are read out of a large document.
+///
+/// `As<T>()` uses `Parse(const LazyValue&, formats::parse::To<T>)` if it is
+/// provided, otherwise the referenced subtree is parsed into a
+/// formats::json::Value and `Parse` for it is used, so all the types parsable
+/// from formats::json::Value (including the chaotic-generated ones) work.
+///
+/// @warning The view references the document text, it must outlive all the
+/// LazyValue instances referring to it.
+/// @note Duplicate keys are not detected, the first one wins.
+class LazyValue final {
+public:
+    // No `ParseException` alias on purpose: LazyValue is not a full-featured
+    // format value, see formats::common::kIsFormatValue.
+
+    /// @brief Validates the `doc` and creates a view of its root.
+    /// @throws ParseException if `doc` is not a valid JSON
+    explicit LazyValue(std::string_view doc);
+
+    /// @brief Access member by key for read.
+    /// @throw TypeMismatchException if value is not missing and is not object.
+    LazyValue operator[](std::string_view key) const;
+
+    /// @brief Access array member by index for read.
+    /// @throw TypeMismatchException if value is not an array.
+    /// @throw OutOfBoundsException if index is greater or equal than size.
+    /// @note The array is scanned from the beginning on each access, use
+    /// ForEachElement to iterate over it.
+    LazyValue operator[](std::size_t index) const;
+
+    /// @brief Returns array size or object members count.
+    /// @throw TypeMismatchException if not an array or an object.
+    std::size_t GetSize() const;
+
+    /// @brief Calls `func` for each element of the array.
+    /// @throw TypeMismatchException if not an array.
+    void ForEachElement(utils::function_ref<void(const LazyValue&)> func) const;
+
+    /// @brief Calls `func` for each member of the object with its unescaped
+    /// key.
+    /// @throw TypeMismatchException if not an object.
+    void ForEachMember(utils::function_ref<void(std::string_view key, const LazyValue&)> func) const;
+
+    /// @brief Returns true if the object has a member with the `key`.
+    /// @throw TypeMismatchException if not a missing value or an object.
+    bool HasMember(std::string_view key) const;
+
+    /// @brief Returns true if *this holds nothing. When `IsMissing()` returns
+    /// `true` any attempt to get the actual value or iterate over *this will
+    /// throw MemberMissingException.
+    bool IsMissing() const noexcept { return raw_.data() == nullptr; }
+
+    bool IsNull() const noexcept;
+    bool IsBool() const noexcept;
+    bool IsNumber() const noexcept;
+    bool IsString() const noexcept;
+    bool IsArray() const noexcept;
+    bool IsObject() const noexcept;
+
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    void CheckNotMissing() const;
+
+    /// @brief Returns the JSON text of the value, as it is in the document.
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    std::string_view GetRawJson() const;
+
+    /// @brief Parses the referenced subtree into a formats::json::Value.
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    Value ToValue() const;
+
+    /// @brief Returns full path to this value.
+    std::string GetPath() const { return path_.empty() ? std::string{"/"} : path_; }
+
+    /// @brief Extracts the specified type with strict type checks.
+    template <typename T>
+    T As() const;
+
+    /// @brief Extracts the specified type, returns the `default_value` if
+    /// `this->IsMissing() || this->IsNull()`.
+    template <typename T, typename Default>
+    T As(Default&& default_value) const;
+
+private:
+    struct Unchecked {};
+
+    LazyValue(Unchecked, std::string_view raw, std::string path) noexcept;
+
+    static LazyValue MakeMissing(std::string path) noexcept;
+
+    void CheckType(int expected_type) const;
+
+    // Points into the document, nullptr data for a missing value
+    std::string_view raw_;
+    std::string path_;
+};
+
+template <typename T>
+T LazyValue::As() const {
+    if constexpr (formats::common::impl::kHasParse<LazyValue, T>) {
+        return Parse(*this, formats::parse::To<T>{});
+    } else {
+        return ToValue().As<T>();
+    }
+}
+
+template <typename T, typename Default>
+T LazyValue::As(Default&& default_value) const {
+    if (IsMissing() || IsNull()) {
+        return T(std::forward<Default>(default_value));
+    }
+    return As<T>();
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -39,6 +39,12 @@ public:
     using Value = formats::json::Value;
 
     StringBuilder();
+
+    /// @brief Constructs the builder that keeps the resulting string in the
+    /// `arena`. The builder and the results of GetStringView() must not
+    /// outlive formats::json::Arena::Reset() or the `arena`.
+    explicit StringBuilder(Arena& arena);
+
     ~StringBuilder();
 
     /// Construct this guard on new object start and its destructor will end the
@@ -84,7 +90,7 @@ public:
 
 private:
     struct Impl;
-    utils::FastPimpl<Impl, 112, 8> impl_;
+    utils::FastPimpl<Impl, 120, 8> impl_;
 };
 
 void WriteToStream(bool value, StringBuilder& sw);
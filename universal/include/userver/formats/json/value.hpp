@@ -4,6 +4,7 @@
 /// @brief @copybrief formats::json::Value
 
 #include <chrono>
+#include <string>
 #include <string_view>
 #include <type_traits>
 
@@ -23,6 +24,15 @@ namespace logging {
 class LogHelper;
 }  // namespace logging
 
+namespace formats::json {
+class Value;
+}  // namespace formats::json
+
+namespace formats::msgpack {
+formats::json::Value FromString(std::string_view data);
+std::string ToString(const formats::json::Value& doc);
+}  // namespace formats::msgpack
+
 namespace formats::json {
 namespace impl {
 class InlineObjectBuilder;
@@ -335,6 +345,9 @@ private:
     friend std::string ToStableString(formats::json::Value&&);
     friend std::string ToPrettyString(const formats::json::Value& doc, PrettyFormat format);
     friend logging::LogHelper& operator<<(logging::LogHelper&, const Value&);
+
+    friend formats::json::Value formats::msgpack::FromString(std::string_view);
+    friend std::string formats::msgpack::ToString(const formats::json::Value&);
 };
 
 template <typename T>
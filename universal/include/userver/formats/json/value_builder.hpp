@@ -55,6 +55,15 @@ public:
     /// Constructs a valueBuilder that holds default value for provided `type`.
     ValueBuilder(formats::common::Type type);
 
+    /// @brief Constructs a ValueBuilder that holds default value for provided
+    /// `type` and allocates all the members of the tree from the `arena`.
+    ///
+    /// The resulting formats::json::Value references the `arena` memory, so it
+    /// and its copies must be destroyed before formats::json::Arena::Reset()
+    /// or destruction of the `arena`. Use formats::json::Value::Clone() to get an independent copy.
+    /// @see formats::json::Arena
+    explicit ValueBuilder(Arena& arena, formats::common::Type type = formats::common::Type::kNull);
+
     /// @brief Transfers the `ValueBuilder` object
     /// @see formats::common::TransferTag for the transfer semantics
     ValueBuilder(common::TransferTag, ValueBuilder&&) noexcept;
@@ -186,8 +195,8 @@ private:
 
     explicit ValueBuilder(impl::MutableValueWrapper) noexcept;
 
-    static void Copy(impl::Value& to, const ValueBuilder& from);
-    static void Move(impl::Value& to, ValueBuilder&& from);
+    void Copy(impl::Value& to, const ValueBuilder& from);
+    void Move(impl::Value& to, ValueBuilder&& from);
 
     impl::Value& AddMember(std::string_view key, CheckMemberExists);
 
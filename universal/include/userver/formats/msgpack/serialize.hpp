@@ -0,0 +1,41 @@
+#pragma once
+
+/// @file userver/formats/msgpack/serialize.hpp
+/// @brief MessagePack encoding of formats::json::Value
+/// @ingroup userver_universal userver_formats
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief MessagePack binary encoding of the JSON documents
+///
+/// MessagePack is used as an alternative wire format for formats::json::Value,
+/// so that all the existing `Parse`/`Serialize` customizations of the user and
+/// chaotic types work unchanged:
+///
+/// @code
+/// auto value = formats::msgpack::FromString(request_body).As<MyType>();
+/// auto body = formats::msgpack::ToString(formats::json::ValueBuilder{value}.ExtractValue());
+/// @endcode
+///
+/// Integers are encoded in the shortest form, doubles as float64. On parsing
+/// `bin` values are treated as strings, map keys must be strings, `ext` values
+/// and non-finite floats are rejected.
+///
+/// HTTP bodies in this encoding use http::content_type::kApplicationMsgpack.
+namespace formats::msgpack {
+
+/// @brief Parse MessagePack data into a JSON document
+/// @throws formats::json::ParseException on invalid or unsupported data
+formats::json::Value FromString(std::string_view data);
+
+/// Serialize JSON document to MessagePack
+std::string ToString(const formats::json::Value& doc);
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
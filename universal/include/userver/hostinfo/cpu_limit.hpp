@@ -17,8 +17,12 @@ namespace hostinfo {
 /// `std::thread::hardware_concurrency` this method considers container limits
 /// and may return fractional values.
 ///
-/// Uses:
-///   * CPU_LIMIT environment variable (example: `CPU_LIMIT=1.95c`).
+/// Uses, in order:
+///   * CPU_LIMIT environment variable (example: `CPU_LIMIT=1.95c`);
+///   * CPU quota of the cgroup (`cpu.max` of cgroup v2 or `cpu.cfs_quota_us`
+///     and `cpu.cfs_period_us` of cgroup v1).
+///
+/// The value is read once and cached.
 std::optional<double> CpuLimit();
 
 /// @brief Returns true if the current process is run in container (CPU_LIMIT
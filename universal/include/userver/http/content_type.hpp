@@ -91,6 +91,7 @@ namespace content_type {
 
 extern const ContentType kApplicationOctetStream;
 extern const ContentType kApplicationJson;
+extern const ContentType kApplicationMsgpack;
 extern const ContentType kTextPlain;
 
 }  // namespace content_type
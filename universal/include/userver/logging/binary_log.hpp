@@ -0,0 +1,77 @@
+#pragma once
+
+/// @file userver/logging/binary_log.hpp
+/// @brief Decoding of the logging::Format::kBinary logs
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <userver/logging/level.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+/// Text formats that logging::Format::kBinary records are decoded to
+enum class DecodedLogFormat {
+    kTskv,
+    kLtsv,
+    /// One JSON object per line, all the values are strings
+    kJson,
+};
+
+/// Thrown by logging::DecodeBinaryLog on a malformed input
+class BinaryLogDecodeError final : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/// @brief Decodes the records of logging::Format::kBinary, appending a line
+/// per record to `out`.
+///
+/// Timestamps are written in the local time zone of the decoding process.
+///
+/// @returns the count of consumed bytes of `data`. An incomplete record on the
+/// end of `data` is not consumed, it should be passed again along with the
+/// next chunk of the log.
+/// @throws BinaryLogDecodeError
+std::size_t DecodeBinaryLog(std::string_view data, DecodedLogFormat format, std::string& out);
+
+/// @brief Zero-copy view of a single logging::Format::kBinary record.
+///
+/// A logger with logging::Format::kBinary receives such records in
+/// logging::impl::LoggerBase::Log and logging::impl::LoggerBase::Trace. The
+/// view allows to encode the tags directly into a structured form (JSON,
+/// protobuf, ...) without formatting the record into text and parsing it back.
+class BinaryLogRecordView final {
+public:
+    using TagVisitor = utils::function_ref<void(std::string_view key, std::string_view value)>;
+
+    /// @param record the whole record, including its size prefix
+    /// @throws BinaryLogDecodeError
+    explicit BinaryLogRecordView(std::string_view record);
+
+    std::chrono::system_clock::time_point GetTimestamp() const noexcept { return timestamp_; }
+
+    Level GetLevel() const noexcept { return level_; }
+
+    /// @brief Calls `visitor(key, value)` for each tag in the order of writing.
+    ///
+    /// Timestamp and level are not passed to the visitor. Keys and values are
+    /// not escaped, and are valid as long as the record is.
+    /// @throws BinaryLogDecodeError
+    void VisitTags(TagVisitor visitor) const;
+
+private:
+    std::chrono::system_clock::time_point timestamp_;
+    Level level_{};
+    std::string_view tags_;
+};
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
@@ -10,7 +10,15 @@ USERVER_NAMESPACE_BEGIN
 namespace logging {
 
 /// Log formats
-enum class Format { kTskv, kLtsv, kRaw };
+enum class Format {
+    kTskv,
+    kLtsv,
+    kRaw,
+    /// Compact length-prefixed binary records, that are cheaper to write than
+    /// the text formats. Use logging::DecodeBinaryLog or the
+    /// `userver-tool-binary-log-decoder` tool to convert them to text.
+    kBinary,
+};
 
 /// Parse Format enum from string
 Format FormatFromString(std::string_view format_str);
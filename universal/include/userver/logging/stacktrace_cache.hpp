@@ -13,6 +13,16 @@ namespace logging::stacktrace_cache {
 /// @see GlobalEnableStacktrace
 std::string to_string(const boost::stacktrace::stacktrace& st);
 
+/// @brief Get cached stacktrace without symbolizing it on the caller's thread.
+///
+/// Returns the symbolized stacktrace if the same frames were symbolized
+/// before. Otherwise returns the raw frame addresses and schedules the
+/// symbolization on a background thread, so that the next calls with the same
+/// frames get the symbolized text. The number of the cached stacktraces and
+/// of the scheduled ones is bounded.
+/// @see GlobalEnableStacktrace
+std::string to_string_async(const boost::stacktrace::stacktrace& st);
+
 /// Enable/disable stacktraces. If disabled, stacktrace_cache::to_string()
 /// returns with a const string.
 ///
@@ -0,0 +1,46 @@
+#pragma once
+
+/// @file userver/utils/arena_containers.hpp
+/// @brief Small-buffer containers that take the rest of the memory from
+/// utils::MonotonicArena.
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include <boost/container/flat_map.hpp>
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/monotonic_arena.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Vector that stores up to `N` elements inline and takes the memory
+/// for more elements from utils::MonotonicArena.
+///
+/// Construct it from `allocator_type{utils::ArenaAllocator<T>{arena}}`.
+///
+/// @snippet universal/src/utils/monotonic_arena_test.cpp  Sample ArenaSmallVector
+template <typename T, std::size_t N>
+using ArenaSmallVector = boost::container::small_vector<T, N, ArenaAllocator<T>>;
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Sorted vector based map that stores up to `N` elements inline and
+/// takes the memory for more elements from utils::MonotonicArena.
+///
+/// Insertion is O(size()), so the map should only be used for a small and
+/// bounded number of elements, that are not controlled by the remote side.
+/// `Compare` is transparent by default, allowing lookups by std::string_view
+/// in maps with std::string keys.
+template <typename Key, typename Value, std::size_t N, typename Compare = std::less<>>
+using ArenaSmallFlatMap = boost::container::
+    flat_map<Key, Value, Compare, ArenaSmallVector<std::pair<Key, Value>, N>>;
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <utility>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -13,12 +14,24 @@ namespace utils {
 /// @ingroup userver_universal
 ///
 /// @brief Holds the key and its hash for faster comparisons and hashing
+///
+/// @see utils::MakeCachedHash
 template <class Key>
 struct CachedHash final {
     std::size_t hash;
     Key key;
 };
 
+/// @brief Hashes the key with `hash` and makes a utils::CachedHash of it.
+///
+/// For string keys from trusted sources utils::FastStringHash is a fast choice
+/// of `hash`.
+template <class Key, class Hash = std::hash<std::decay_t<Key>>>
+CachedHash<std::decay_t<Key>> MakeCachedHash(Key&& key, const Hash& hash = Hash{}) {
+    const std::size_t key_hash = hash(std::as_const(key));
+    return CachedHash<std::decay_t<Key>>{key_hash, std::forward<Key>(key)};
+}
+
 /// @brief Compares utils::CachedHash by hash first and then by keys
 template <class T>
 constexpr bool operator==(const CachedHash<T>& x, const CachedHash<T>& y) {
@@ -0,0 +1,49 @@
+#pragma once
+
+/// @file userver/utils/datetime/tsc_clock.hpp
+/// @brief @copybrief utils::datetime::TscClock
+
+#include <chrono>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+/// @ingroup userver_universal
+///
+/// @brief Steady clock that reads the CPU timestamp counter without going
+/// through the vDSO, for measuring short durations on hot paths.
+///
+/// The TSC is used only on x86_64 Linux with an invariant TSC that is also the
+/// current kernel clocksource, otherwise the clock is a plain
+/// std::chrono::steady_clock. The TSC frequency is calibrated against the
+/// std::chrono::steady_clock during the first ~50ms after the first now()
+/// call, until then std::chrono::steady_clock is used as well.
+///
+/// The clock is not slewed by NTP, so durations may differ from the
+/// std::chrono::steady_clock ones by a few ppm. The epoch differs from the
+/// std::chrono::steady_clock one, so do not mix the time points of the clocks
+/// (e.g. for engine::Deadline).
+struct TscClock final {
+    using duration = std::chrono::steady_clock::duration;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<TscClock, duration>;
+
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept;
+
+    /// @returns std::chrono::system_clock::now() with a per-thread cache that
+    /// is synchronized with the system clock every few milliseconds and is
+    /// advanced by the TSC in between. Falls back to
+    /// std::chrono::system_clock::now() if the TSC is not used.
+    static std::chrono::system_clock::time_point WallNow() noexcept;
+
+    /// @returns whether the TSC is used (calibration has completed)
+    static bool IsTscUsed() noexcept;
+};
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
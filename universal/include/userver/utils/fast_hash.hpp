@@ -0,0 +1,34 @@
+#pragma once
+
+/// @file userver/utils/fast_hash.hpp
+/// @brief @copybrief utils::FastHash
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal
+///
+/// @brief Fast non-cryptographic 64-bit hash of bytes (wyhash algorithm)
+///
+/// Much faster than the cryptographic hashes and SipHash on short keys, so it
+/// suits in-memory caches and utils::CachedHash. The hash is not resistant to
+/// hash flooding, use utils::StrCaseHash for keys from untrusted input.
+std::uint64_t FastHash(std::string_view data, std::uint64_t seed = 0) noexcept;
+
+/// @ingroup userver_universal
+///
+/// @brief utils::FastHash based hasher for string keys of unordered containers
+struct FastStringHash final {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view str) const noexcept { return FastHash(str); }
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+/// @file userver/utils/huge_page_allocator.hpp
+/// @brief @copybrief utils::HugePageAllocator
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl {
+
+/// Minimal allocation size that is served by HugePageAllocator from the
+/// huge-page-backed regions
+inline constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+
+void* AllocateHugePageAware(std::size_t bytes, std::size_t alignment);
+
+void DeallocateHugePageAware(void* ptr, std::size_t bytes, std::size_t alignment) noexcept;
+
+}  // namespace impl
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Standard-compatible allocator that backs big allocations with
+/// transparent huge pages.
+///
+/// Allocations of at least 2 MiB are served with 2 MiB aligned mmap regions
+/// marked with `madvise(MADV_HUGEPAGE)`, so that the TLB covers them with
+/// fewer entries. Smaller allocations are forwarded to `operator new`.
+///
+/// Useful for the big contiguous parts of the cache containers: vectors,
+/// bucket arrays of hash maps and the like, e.g.
+/// `std::vector<Item, utils::HugePageAllocator<Item>>` as the data of a
+/// components::CachingComponentBase. Node based containers allocate in small
+/// pieces and do not benefit from it.
+///
+/// Requires transparent huge pages to be in the `madvise` or `always` mode,
+/// see /sys/kernel/mm/transparent_hugepage/enabled. Otherwise works as a
+/// regular allocator.
+template <typename T>
+class HugePageAllocator {
+public:
+    using value_type = T;
+
+    HugePageAllocator() noexcept = default;
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(impl::AllocateHugePageAware(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        impl::DeallocateHugePageAware(ptr, n * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const HugePageAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const HugePageAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
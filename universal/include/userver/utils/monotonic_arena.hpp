@@ -0,0 +1,150 @@
+#pragma once
+
+/// @file userver/utils/monotonic_arena.hpp
+/// @brief @copybrief utils::MonotonicArena
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Monotonic (bump pointer) memory arena, similar to
+/// std::pmr::monotonic_buffer_resource.
+///
+/// Allocation is a pointer increment, deallocation is a no-op and all the
+/// memory is released at once in the destructor or in Release(). Allocations
+/// are served from the initial buffer first (if any), then from heap blocks of
+/// geometrically growing size.
+///
+/// Suits the data that is built once and dies all together, for example the
+/// data owned by a single request. Use utils::ArenaAllocator to place
+/// standard containers into the arena.
+///
+/// The arena is not thread-safe.
+class MonotonicArena {
+public:
+    /// Creates an arena without an initial buffer, the first heap block is
+    /// allocated on the first allocation.
+    MonotonicArena() noexcept;
+
+    /// Creates an arena that serves the first allocations from `buffer`. The
+    /// `buffer` should outlive the arena.
+    MonotonicArena(void* buffer, std::size_t size) noexcept;
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena();
+
+    /// @brief Returns `size` bytes of memory aligned to `alignment`.
+    /// @throws std::bad_alloc
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+        UASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0, "alignment should be a power of 2");
+
+        const auto aligned = (reinterpret_cast<std::uintptr_t>(current_) + alignment - 1) & ~(alignment - 1);
+        const auto end = reinterpret_cast<std::uintptr_t>(end_);
+        if (current_ && aligned <= end && end - aligned >= size) {
+            current_ = reinterpret_cast<char*>(aligned + size);
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        return AllocateSlow(size, alignment);
+    }
+
+    /// Frees all the heap blocks and makes the initial buffer available for
+    /// allocations again. All the memory previously returned from Allocate()
+    /// becomes invalid.
+    void Release() noexcept;
+
+    /// Returns the total size of the heap blocks owned by the arena.
+    std::size_t GetHeapBytes() const noexcept { return heap_bytes_; }
+
+private:
+    struct BlockHeader;
+
+    void* AllocateSlow(std::size_t size, std::size_t alignment);
+
+    char* initial_buffer_{nullptr};
+    std::size_t initial_size_{0};
+
+    char* current_{nullptr};
+    char* end_{nullptr};
+
+    BlockHeader* blocks_{nullptr};
+    std::size_t next_block_size_{0};
+    std::size_t heap_bytes_{0};
+};
+
+namespace impl {
+
+template <std::size_t Size>
+struct InlineArenaBuffer {
+    alignas(std::max_align_t) char buffer[Size];
+};
+
+}  // namespace impl
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief utils::MonotonicArena with an initial buffer of `BufferSize` bytes
+/// stored inside the object. No heap allocations are made until the buffer is
+/// exhausted.
+template <std::size_t BufferSize>
+class InlineMonotonicArena final : private impl::InlineArenaBuffer<BufferSize>, public MonotonicArena {
+public:
+    InlineMonotonicArena() noexcept : MonotonicArena(this->buffer, BufferSize) {}
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Standard-compatible allocator that takes memory from a
+/// utils::MonotonicArena, similar to std::pmr::polymorphic_allocator.
+///
+/// Deallocation is a no-op, the memory is reclaimed by the arena. The
+/// arena should outlive all the containers that use the allocator.
+///
+/// @snippet universal/src/utils/monotonic_arena_test.cpp  Sample ArenaAllocator
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena& arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(&other.GetArena()) {}
+
+    T* allocate(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    MonotonicArena& GetArena() const noexcept { return *arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == &other.GetArena();
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    MonotonicArena* arena_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
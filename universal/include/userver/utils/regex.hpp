@@ -3,7 +3,10 @@
 /// @file userver/utils/regex.hpp
 /// @brief @copybrief utils::regex
 
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -16,6 +19,10 @@ class match_results;
 /// @ingroup userver_universal userver_containers
 ///
 /// @brief Small alias for boost::regex / std::regex without huge includes
+///
+/// If userver is built with `USERVER_FEATURE_RE2`, the linear-time RE2 engine
+/// is used instead of boost::regex. RE2 does not support backreferences and
+/// lookarounds.
 class regex final {
 public:
     regex();
@@ -72,6 +79,37 @@ private:
     friend std::string regex_replace(std::string_view str, const regex& pattern, std::string_view repl);
 };
 
+/// @ingroup userver_universal userver_containers
+///
+/// @brief A set of regular expressions to match a string against all of them
+/// at once.
+///
+/// With `USERVER_FEATURE_RE2` the whole set is matched in a single pass over
+/// the string, which is much faster than matching the patterns one by one
+/// when there are hundreds of them.
+class regex_set final {
+public:
+    /// @throws std::runtime_error if any of the patterns is invalid
+    explicit regex_set(const std::vector<std::string>& patterns);
+
+    ~regex_set();
+
+    regex_set(regex_set&&) noexcept;
+    regex_set& operator=(regex_set&&) noexcept;
+
+    /// @returns the number of patterns in the set
+    std::size_t size() const noexcept;
+
+private:
+    struct Impl;
+    utils::FastPimpl<Impl, 24, 8> impl_;
+
+    friend bool regex_match(std::string_view str, const regex_set& patterns);
+    friend bool regex_match(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched);
+    friend bool regex_search(std::string_view str, const regex_set& patterns);
+    friend bool regex_search(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched);
+};
+
 /// @brief Determines whether the regular expression matches the entire target
 /// character sequence
 bool regex_match(std::string_view str, const regex& pattern);
@@ -92,6 +130,24 @@ bool regex_search(std::string_view str, const regex& pattern);
 /// with repl
 std::string regex_replace(std::string_view str, const regex& pattern, std::string_view repl);
 
+/// @brief Determines whether any of the regular expressions matches the entire
+/// target character sequence
+bool regex_match(std::string_view str, const regex_set& patterns);
+
+/// @brief Fills `matched` with the ascending indices of the regular expressions
+/// that match the entire target character sequence
+/// @returns true if any of the regular expressions matched
+bool regex_match(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched);
+
+/// @brief Determines whether any of the regular expressions matches anywhere
+/// in the target character sequence
+bool regex_search(std::string_view str, const regex_set& patterns);
+
+/// @brief Fills `matched` with the ascending indices of the regular expressions
+/// that match anywhere in the target character sequence
+/// @returns true if any of the regular expressions matched
+bool regex_search(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
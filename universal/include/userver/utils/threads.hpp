@@ -4,6 +4,9 @@
 /// @brief Functions to work with OS threads.
 /// @ingroup userver_universal
 
+#include <cstddef>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
@@ -19,6 +22,11 @@ void SetCurrentThreadIdleScheduling();
 /// @throws std::system_error
 void SetCurrentThreadLowPriorityScheduling();
 
+/// @brief Restrict the OS thread to run only on the specified CPUs.
+/// Does nothing on platforms without sched_setaffinity.
+/// @throws std::system_error
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -3,7 +3,10 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -563,6 +566,12 @@ private:
 
 }  // namespace impl
 
+template <const auto& Map>
+class TrivialHashBiMap;
+
+template <const auto& Map>
+class TrivialHashSet;
+
 /// @ingroup userver_universal userver_containers
 ///
 /// @brief Bidirectional unordered map for trivial types, including string
@@ -589,7 +598,8 @@ private:
 ///
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample empty bimap
 ///
-/// For a single value Case statements see @ref utils::TrivialSet.
+/// For a single value Case statements see @ref utils::TrivialSet. For
+/// mappings with many cases see @ref utils::TrivialHashBiMap.
 template <typename BuilderFunc>
 class TrivialBiMap final {
     using TypesPair = std::invoke_result_t<const BuilderFunc&, impl::SwitchTypesDetector>;
@@ -762,6 +772,9 @@ public:
     constexpr iterator cend() const { return end(); }
 
 private:
+    template <const auto& Map>
+    friend class TrivialHashBiMap;
+
     const BuilderFunc func_;
 };
 
@@ -824,19 +837,432 @@ public:
     }
 
 private:
+    template <const auto& Set>
+    friend class TrivialHashSet;
+
     const BuilderFunc func_;
 };
 
 template <typename BuilderFunc>
 TrivialSet(BuilderFunc) -> TrivialSet<BuilderFunc>;
 
-/// @brief Parses and returns whatever is specified by `map` from a
-/// `formats::*::Value`.
-/// @throws ExceptionType or `Value::Exception` by default, if `value` is not a
-/// string, or if `value` is not contained in `map`.
-/// @see @ref scripts/docs/en/userver/formats.md
-template <typename ExceptionType = void, typename Value, typename BuilderFunc>
-auto ParseFromValueString(const Value& value, TrivialBiMap<BuilderFunc> map) {
+namespace impl {
+
+// Mappings with more cases are looked up via PerfectHashIndex in
+// utils::TrivialHashBiMap and utils::TrivialHashSet.
+inline constexpr std::size_t kTrivialHashMinSize = 32;
+
+template <typename T>
+inline constexpr bool kIsPerfectHashable =
+    std::is_same_v<T, std::string_view> || std::is_integral_v<T> || std::is_enum_v<T>;
+
+constexpr std::uint64_t MixPerfectHash(std::uint64_t x) noexcept {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+template <std::size_t... Indices>
+constexpr std::uint64_t LoadPerfectHashWord(const char* data, std::index_sequence<Indices...>) noexcept {
+    return ((std::uint64_t{static_cast<unsigned char>(data[Indices])} << (Indices * 8)) | ...);
+}
+
+// Compilers merge the shifts into a single unaligned load
+template <std::size_t Size>
+constexpr std::uint64_t LoadPerfectHashWord(const char* data) noexcept {
+    return LoadPerfectHashWord(data, std::make_index_sequence<Size>{});
+}
+
+inline constexpr std::uint64_t kPerfectHashMultiplier = 0x9e3779b97f4a7c15ULL;
+
+constexpr std::uint64_t CombinePerfectHash(std::uint64_t hash, std::uint64_t word) noexcept {
+    hash = (hash ^ word) * kPerfectHashMultiplier;
+    return hash ^ (hash >> 32);
+}
+
+template <typename T>
+constexpr std::uint64_t PerfectHash(T value) noexcept {
+    static_assert(kIsPerfectHashable<T>);
+
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        const auto* data = value.data();
+        const auto size = value.size();
+        std::uint64_t hash = size * kPerfectHashMultiplier;
+
+        // Fixed size loads only; the tail words overlap with the previous ones
+        if (size >= 8) {
+            for (std::size_t i = 0; i + 8 < size; i += 8) {
+                hash = CombinePerfectHash(hash, LoadPerfectHashWord<8>(data + i));
+            }
+            hash = CombinePerfectHash(hash, LoadPerfectHashWord<8>(data + size - 8));
+        } else if (size >= 4) {
+            hash = CombinePerfectHash(
+                hash, (LoadPerfectHashWord<4>(data) << 32) | LoadPerfectHashWord<4>(data + size - 4)
+            );
+        } else if (size > 0) {
+            const std::uint64_t word = (std::uint64_t{static_cast<unsigned char>(data[0])} << 16) |
+                                       (std::uint64_t{static_cast<unsigned char>(data[size / 2])} << 8) |
+                                       static_cast<unsigned char>(data[size - 1]);
+            hash = CombinePerfectHash(hash, word);
+        }
+        return MixPerfectHash(hash);
+    } else if constexpr (std::is_enum_v<T>) {
+        return MixPerfectHash(static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(value)));
+    } else {
+        return MixPerfectHash(static_cast<std::uint64_t>(value));
+    }
+}
+
+constexpr std::size_t PerfectHashSlotsCount(std::size_t keys_count) noexcept {
+    std::size_t slots = 2;
+    while (slots < keys_count + keys_count / 4 + 1) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+constexpr std::size_t PerfectHashBucketsCount(std::size_t keys_count) noexcept { return keys_count / 2 + 1; }
+
+// Hash-and-displace perfect hashing: keys are split into buckets by their
+// hash, then for each bucket (largest first) a `pilot` is searched for, that
+// places all the keys of the bucket into free slots. A lookup is a hash
+// computation, two array reads and a single comparison of keys.
+//
+// Only the first of the equal keys is indexed, just like the linear search
+// in utils::TrivialBiMap finds the first matching Case.
+template <std::size_t Slots, std::size_t Buckets>
+class PerfectHashIndex final {
+public:
+    template <typename Key, std::size_t Size>
+    constexpr explicit PerfectHashIndex(const std::array<Key, Size>& keys) {
+        static_assert((Slots & (Slots - 1)) == 0, "Slots count should be a power of 2");
+
+        for (auto& slot : slots_) {
+            slot = kInvalidSize;
+        }
+
+        std::array<std::uint64_t, Size> hashes{};
+        std::array<std::size_t, Buckets + 1> offsets{};
+        for (std::size_t i = 0; i < Size; ++i) {
+            hashes[i] = PerfectHash(keys[i]);
+            ++offsets[BucketOf(hashes[i]) + 1];
+        }
+
+        std::size_t max_bucket_size = 0;
+        for (std::size_t bucket = 0; bucket < Buckets; ++bucket) {
+            if (offsets[bucket + 1] > max_bucket_size) max_bucket_size = offsets[bucket + 1];
+            offsets[bucket + 1] += offsets[bucket];
+        }
+
+        std::array<std::size_t, Size> members{};
+        std::array<std::size_t, Buckets + 1> cursors = offsets;
+        for (std::size_t i = 0; i < Size; ++i) {
+            members[cursors[BucketOf(hashes[i])]++] = i;
+        }
+
+        std::array<std::size_t, Size> unique{};
+        for (std::size_t bucket_size = max_bucket_size; bucket_size > 0; --bucket_size) {
+            for (std::size_t bucket = 0; bucket < Buckets; ++bucket) {
+                if (offsets[bucket + 1] - offsets[bucket] != bucket_size) continue;
+
+                std::size_t unique_count = 0;
+                for (std::size_t i = offsets[bucket]; i < offsets[bucket + 1]; ++i) {
+                    bool is_duplicate = false;
+                    for (std::size_t j = 0; j < unique_count; ++j) {
+                        is_duplicate = is_duplicate || keys[unique[j]] == keys[members[i]];
+                    }
+                    if (!is_duplicate) unique[unique_count++] = members[i];
+                }
+
+                PlaceBucket(bucket, hashes, unique, unique_count);
+            }
+        }
+    }
+
+    /// Returns the index of the only key that may be equal to the key with
+    /// `hash`, or kInvalidSize.
+    constexpr std::size_t FindCandidate(std::uint64_t hash) const noexcept {
+        return slots_[SlotOf(hash, pilots_[BucketOf(hash)])];
+    }
+
+private:
+    static constexpr std::uint64_t kMaxPilot = 1 << 20;
+
+    static constexpr std::size_t kSlotsShift = [] {
+        std::size_t shift = 64;
+        for (std::size_t slots = Slots; slots > 1; slots /= 2) --shift;
+        return shift;
+    }();
+
+    static constexpr std::size_t BucketOf(std::uint64_t hash) noexcept {
+        return static_cast<std::size_t>(((hash >> 32) * Buckets) >> 32);
+    }
+
+    // Takes the high bits of the product, they depend on all the bits of the
+    // hash and of the pilot value
+    static constexpr std::size_t SlotOf(std::uint64_t hash, std::uint64_t pilot_value) noexcept {
+        return static_cast<std::size_t>(((hash ^ pilot_value) * kPerfectHashMultiplier) >> kSlotsShift);
+    }
+
+    static constexpr std::uint64_t GetPilotValue(std::uint64_t pilot) noexcept { return MixPerfectHash(pilot); }
+
+    template <std::size_t Size>
+    constexpr void PlaceBucket(
+        std::size_t bucket,
+        const std::array<std::uint64_t, Size>& hashes,
+        const std::array<std::size_t, Size>& keys,
+        std::size_t keys_count
+    ) {
+        for (std::uint64_t pilot = 0; pilot < kMaxPilot; ++pilot) {
+            const auto pilot_value = GetPilotValue(pilot);
+
+            std::size_t placed = 0;
+            for (; placed < keys_count; ++placed) {
+                const auto slot = SlotOf(hashes[keys[placed]], pilot_value);
+                if (slots_[slot] != kInvalidSize) break;
+                slots_[slot] = keys[placed];
+            }
+
+            if (placed == keys_count) {
+                pilots_[bucket] = pilot_value;
+                return;
+            }
+
+            for (std::size_t i = 0; i < placed; ++i) {
+                slots_[SlotOf(hashes[keys[i]], pilot_value)] = kInvalidSize;
+            }
+        }
+
+        UINVARIANT(false, "Failed to build a perfect hash for utils::TrivialHashBiMap or utils::TrivialHashSet");
+    }
+
+    std::array<std::uint64_t, Buckets> pilots_{};
+    std::array<std::size_t, Slots> slots_{};
+};
+
+// Returns kInvalidSize if the keys are not going to be looked up via hash
+template <bool IsHashed, typename Key, std::size_t Size>
+constexpr auto MakePerfectHashIndexIf(const std::array<Key, Size>& keys) {
+    if constexpr (IsHashed && kIsPerfectHashable<Key>) {
+        return PerfectHashIndex<PerfectHashSlotsCount(Size), PerfectHashBucketsCount(Size)>{keys};
+    } else {
+        return kInvalidSize;
+    }
+}
+
+template <typename First, typename Second, std::size_t Size>
+class CaseCollector final {
+public:
+    constexpr CaseCollector& Case(First first, Second second) noexcept {
+        firsts_[size_] = first;
+        seconds_[size_] = second;
+        ++size_;
+        return *this;
+    }
+
+    template <typename T, typename U>
+    constexpr CaseCollector& Type() {
+        return *this;
+    }
+
+    [[nodiscard]] constexpr const std::array<First, Size>& GetFirsts() const noexcept { return firsts_; }
+
+    [[nodiscard]] constexpr const std::array<Second, Size>& GetSeconds() const noexcept { return seconds_; }
+
+private:
+    std::array<First, Size> firsts_{};
+    std::array<Second, Size> seconds_{};
+    std::size_t size_{0};
+};
+
+template <typename First, std::size_t Size>
+class CaseCollector<First, void, Size> final {
+public:
+    constexpr CaseCollector& Case(First first) noexcept {
+        firsts_[size_] = first;
+        ++size_;
+        return *this;
+    }
+
+    template <typename T, typename U = void>
+    constexpr CaseCollector& Type() {
+        return *this;
+    }
+
+    [[nodiscard]] constexpr const std::array<First, Size>& GetFirsts() const noexcept { return firsts_; }
+
+private:
+    std::array<First, Size> firsts_{};
+    std::size_t size_{0};
+};
+
+}  // namespace impl
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief utils::TrivialBiMap with lookups via a compile-time perfect hash.
+///
+/// Lookups in utils::TrivialBiMap compare the key with each Case, that
+/// becomes noticeable for maps with dozens or hundreds of cases. For such
+/// maps wrap a `constexpr` utils::TrivialBiMap into utils::TrivialHashBiMap:
+///
+/// @snippet universal/src/utils/trivial_map_test.cpp  sample hash bimap
+///
+/// The perfect hash is built at compile time, lookups take O(1) and do at
+/// most one comparison of keys. Maps with 32 or less cases, ICase lookups and
+/// lookups by keys that are not strings, integers or enums are forwarded to
+/// the wrapped utils::TrivialBiMap.
+template <const auto& Map>
+class TrivialHashBiMap final {
+    using MapType = std::remove_cv_t<std::remove_reference_t<decltype(Map)>>;
+
+public:
+    using First = typename MapType::First;
+    using Second = typename MapType::Second;
+    using value_type = typename MapType::value_type;
+
+    template <class T>
+    using MappedTypeFor = typename MapType::template MappedTypeFor<T>;
+
+    constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
+        if constexpr (kIsHashed && impl::kIsPerfectHashable<First>) {
+            const auto index = kFirstIndex.FindCandidate(impl::PerfectHash(value));
+            if (index == impl::kInvalidSize || !(kCases.GetFirsts()[index] == value)) return std::nullopt;
+            return kCases.GetSeconds()[index];
+        } else {
+            return Map.TryFindByFirst(value);
+        }
+    }
+
+    constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
+        if constexpr (kIsHashed && impl::kIsPerfectHashable<Second>) {
+            const auto index = kSecondIndex.FindCandidate(impl::PerfectHash(value));
+            if (index == impl::kInvalidSize || !(kCases.GetSeconds()[index] == value)) return std::nullopt;
+            return kCases.GetFirsts()[index];
+        } else {
+            return Map.TryFindBySecond(value);
+        }
+    }
+
+    template <class T>
+    constexpr std::optional<MappedTypeFor<T>> TryFind(T value) const noexcept {
+        static_assert(
+            !std::is_convertible_v<T, First> || !std::is_convertible_v<T, Second>,
+            "Ambiguous conversion, use TryFindByFirst/TryFindBySecond instead"
+        );
+
+        if constexpr (std::is_convertible_v<T, First>) {
+            return TryFindByFirst(value);
+        } else {
+            return TryFindBySecond(value);
+        }
+    }
+
+    /// @copydoc TrivialBiMap::TryFindICaseByFirst
+    constexpr std::optional<Second> TryFindICaseByFirst(std::string_view value) const noexcept {
+        return Map.TryFindICaseByFirst(value);
+    }
+
+    /// @copydoc TrivialBiMap::TryFindICaseBySecond
+    constexpr std::optional<First> TryFindICaseBySecond(std::string_view value) const noexcept {
+        return Map.TryFindICaseBySecond(value);
+    }
+
+    /// @copydoc TrivialBiMap::TryFindICase
+    constexpr std::optional<MappedTypeFor<std::string_view>> TryFindICase(std::string_view value) const noexcept {
+        return Map.TryFindICase(value);
+    }
+
+    /// Returns count of Case's in mapping
+    constexpr std::size_t size() const noexcept { return kSize; }
+
+    /// @copydoc TrivialBiMap::Describe
+    std::string Describe() const { return Map.Describe(); }
+
+    /// @copydoc TrivialBiMap::DescribeFirst
+    std::string DescribeFirst() const { return Map.DescribeFirst(); }
+
+    /// @copydoc TrivialBiMap::DescribeSecond
+    std::string DescribeSecond() const { return Map.DescribeSecond(); }
+
+    /// @copydoc TrivialBiMap::DescribeByType
+    template <typename T>
+    std::string DescribeByType() const {
+        return Map.template DescribeByType<T>();
+    }
+
+    constexpr value_type GetValuesByIndex(std::size_t index) const {
+        UASSERT(index < kSize);
+        return value_type{kCases.GetFirsts()[index], kCases.GetSeconds()[index]};
+    }
+
+    constexpr auto begin() const { return Map.begin(); }
+    constexpr auto end() const { return Map.end(); }
+    constexpr auto cbegin() const { return Map.cbegin(); }
+    constexpr auto cend() const { return Map.cend(); }
+
+private:
+    static constexpr std::size_t kSize = Map.size();
+    static constexpr bool kIsHashed = kSize > impl::kTrivialHashMinSize;
+
+    static constexpr auto kCases =
+        Map.func_([]() { return impl::CaseCollector<First, Second, kSize>{}; });
+
+    static constexpr auto kFirstIndex = impl::MakePerfectHashIndexIf<kIsHashed>(kCases.GetFirsts());
+    static constexpr auto kSecondIndex = impl::MakePerfectHashIndexIf<kIsHashed>(kCases.GetSeconds());
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief utils::TrivialSet with lookups via a compile-time perfect hash.
+///
+/// See utils::TrivialHashBiMap for details.
+template <const auto& Set>
+class TrivialHashSet final {
+    using SetType = std::remove_cv_t<std::remove_reference_t<decltype(Set)>>;
+
+public:
+    using First = typename SetType::First;
+
+    constexpr bool Contains(First value) const noexcept { return GetIndex(value).has_value(); }
+
+    constexpr bool ContainsICase(std::string_view value) const noexcept { return Set.ContainsICase(value); }
+
+    constexpr std::size_t size() const noexcept { return kSize; }
+
+    /// @copydoc TrivialSet::Describe
+    std::string Describe() const { return Set.Describe(); }
+
+    /// @copydoc TrivialSet::GetIndex
+    constexpr std::optional<std::size_t> GetIndex(First value) const {
+        if constexpr (kIsHashed && impl::kIsPerfectHashable<First>) {
+            const auto index = kIndex.FindCandidate(impl::PerfectHash(value));
+            if (index == impl::kInvalidSize || !(kValues.GetFirsts()[index] == value)) return std::nullopt;
+            return index;
+        } else {
+            return Set.GetIndex(value);
+        }
+    }
+
+    /// @copydoc TrivialSet::GetIndexICase
+    constexpr std::optional<std::size_t> GetIndexICase(First value) const { return Set.GetIndexICase(value); }
+
+private:
+    static constexpr std::size_t kSize = Set.size();
+    static constexpr bool kIsHashed = kSize > impl::kTrivialHashMinSize;
+
+    static constexpr auto kValues = Set.func_([]() { return impl::CaseCollector<First, void, kSize>{}; });
+
+    static constexpr auto kIndex = impl::MakePerfectHashIndexIf<kIsHashed>(kValues.GetFirsts());
+};
+
+namespace impl {
+
+template <typename ExceptionType, typename Value, typename Map>
+auto ParseFromValueStringImpl(const Value& value, const Map& map) {
     if constexpr (!std::is_void_v<ExceptionType>) {
         if (!value.IsString()) {
             throw ExceptionType(fmt::format("Invalid value at '{}': expected a string", value.GetPath()));
@@ -858,6 +1284,24 @@ auto ParseFromValueString(const Value& value, TrivialBiMap<BuilderFunc> map) {
     ));
 }
 
+}  // namespace impl
+
+/// @brief Parses and returns whatever is specified by `map` from a
+/// `formats::*::Value`.
+/// @throws ExceptionType or `Value::Exception` by default, if `value` is not a
+/// string, or if `value` is not contained in `map`.
+/// @see @ref scripts/docs/en/userver/formats.md
+template <typename ExceptionType = void, typename Value, typename BuilderFunc>
+auto ParseFromValueString(const Value& value, TrivialBiMap<BuilderFunc> map) {
+    return impl::ParseFromValueStringImpl<ExceptionType>(value, map);
+}
+
+/// @overload
+template <typename ExceptionType = void, typename Value, const auto& Map>
+auto ParseFromValueString(const Value& value, TrivialHashBiMap<Map> map) {
+    return impl::ParseFromValueStringImpl<ExceptionType>(value, map);
+}
+
 namespace impl {
 
 // @brief Converts `value` to `std::string_view` using `map`. If `value` is not
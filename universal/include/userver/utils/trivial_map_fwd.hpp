@@ -1,8 +1,8 @@
 #pragma once
 
 /// @file userver/utils/trivial_map_fwd.hpp
-/// @brief Forward declarations of utils::TrivialBiMap and utils::TrivialSet
-/// types.
+/// @brief Forward declarations of utils::TrivialBiMap, utils::TrivialSet,
+/// utils::TrivialHashBiMap and utils::TrivialHashSet types.
 /// @ingroup userver_universal
 
 USERVER_NAMESPACE_BEGIN
@@ -15,6 +15,12 @@ class TrivialBiMap;
 template <typename BuilderFunc>
 class TrivialSet;
 
+template <const auto& Map>
+class TrivialHashBiMap;
+
+template <const auto& Set>
+class TrivialHashSet;
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -24,6 +25,10 @@ namespace yaml_config {
 using Exception = formats::yaml::Exception;
 using ParseException = formats::yaml::ParseException;
 
+namespace impl {
+class ConfigIndex;
+}  // namespace impl
+
 /// @ingroup userver_formats userver_universal
 ///
 /// @brief Datatype that represents YAML with substituted variables
@@ -92,6 +97,10 @@ public:
     YamlConfig() = default;
 
     /// YamlConfig = config + config_vars
+    ///
+    /// Indexes the whole `yaml` and `config_vars` once, the configs returned
+    /// by operator[] reuse that index, so prefer passing them around to
+    /// constructing new YamlConfig from their Yaml().
     YamlConfig(formats::yaml::Value yaml, formats::yaml::Value config_vars, Mode mode = Mode::kSecure);
 
     /// Get the plain Yaml without substitutions. It may contain raw references.
@@ -197,10 +206,22 @@ public:
     const_iterator end() const;
 
 private:
+    YamlConfig(
+        formats::yaml::Value yaml,
+        formats::yaml::Value config_vars,
+        Mode mode,
+        std::shared_ptr<const impl::ConfigIndex> index,
+        std::shared_ptr<const impl::ConfigIndex> config_vars_index
+    );
+
     formats::yaml::Value yaml_;
     formats::yaml::Value config_vars_;
     Mode mode_{Mode::kSecure};
 
+    // Hashed members and resolved substitutions, shared with the child configs
+    std::shared_ptr<const impl::ConfigIndex> index_;
+    std::shared_ptr<const impl::ConfigIndex> config_vars_index_;
+
     friend bool Parse(const YamlConfig& value, formats::parse::To<bool>);
     friend int64_t Parse(const YamlConfig& value, formats::parse::To<int64_t>);
     friend uint64_t Parse(const YamlConfig& value, formats::parse::To<uint64_t>);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <unordered_map>
+
+#include <userver/cache/persistent_hash_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Entries changed by a single incremental update
+constexpr int kChangedCount = 10;
+
+template <typename Map>
+Map FillMap(int elements_count) {
+    Map map;
+    for (int i = 0; i < elements_count; ++i) {
+        map.insert_or_assign(i, i);
+    }
+    return map;
+}
+
+// Copy of the snapshot followed by a handful of changes, as in caches with
+// incremental updates
+template <typename Map>
+void IncrementalUpdate(benchmark::State& state) {
+    const auto snapshot = FillMap<Map>(state.range(0));
+    int key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        auto map = snapshot;
+        for (int i = 0; i < kChangedCount; ++i) {
+            map.insert_or_assign(key, i);
+            key = (key + 7919) % state.range(0);
+        }
+        benchmark::DoNotOptimize(map);
+    }
+}
+
+template <typename Map>
+void Find(benchmark::State& state) {
+    const auto map = FillMap<Map>(state.range(0));
+    int key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(map.count(key));
+        key = (key + 7919) % state.range(0);
+    }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(IncrementalUpdate, std::unordered_map<int, int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(IncrementalUpdate, cache::PersistentHashMap<int, int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(Find, std::unordered_map<int, int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(Find, cache::PersistentHashMap<int, int>)->Range(1 << 10, 1 << 20);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,140 @@
+#include <userver/cache/persistent_hash_map.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::PersistentHashMap<int, std::string>;
+
+// Makes all the keys collide, and some of them to differ in low bits only
+struct BadHash {
+    std::size_t operator()(int key) const noexcept { return key % 3; }
+};
+
+template <typename Map>
+std::map<typename Map::key_type, typename Map::mapped_type> ToStdMap(const Map& map) {
+    return {map.begin(), map.end()};
+}
+
+}  // namespace
+
+TEST(PersistentHashMap, Basic) {
+    Map map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(1), map.end());
+
+    EXPECT_TRUE(map.insert_or_assign(1, "one"));
+    EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+    EXPECT_TRUE(map.insert({2, "two"}));
+    EXPECT_FALSE(map.insert({2, "dos"}));
+    map[3] = "three";
+
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at(1), "uno");
+    EXPECT_EQ(map.find(2)->second, "two");
+    EXPECT_EQ(map.count(3), 1);
+    EXPECT_FALSE(map.contains(4));
+    EXPECT_THROW(map.at(4), std::out_of_range);
+
+    EXPECT_EQ(map.erase(4), 0);
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_FALSE(map.contains(1));
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentHashMap, CopiesAreIndependent) {
+    /// [Sample persistent hash map]
+    cache::PersistentHashMap<int, std::string> snapshot;
+    for (int i = 0; i < 1000; ++i) snapshot.insert_or_assign(i, std::to_string(i));
+
+    // O(1), shares all the nodes with the snapshot
+    auto updated = snapshot;
+    // Unshares just the nodes on the paths to the keys
+    updated.insert_or_assign(10, "ten");
+    updated[2000] = "two thousand";
+    updated.erase(20);
+
+    EXPECT_EQ(snapshot.at(10), "10");
+    EXPECT_EQ(updated.at(10), "ten");
+    /// [Sample persistent hash map]
+
+    EXPECT_EQ(snapshot.size(), 1000);
+    EXPECT_FALSE(snapshot.contains(2000));
+    EXPECT_TRUE(snapshot.contains(20));
+
+    EXPECT_EQ(updated.size(), 1000);
+    EXPECT_EQ(updated.at(2000), "two thousand");
+    EXPECT_FALSE(updated.contains(20));
+}
+
+TEST(PersistentHashMap, Iteration) {
+    Map map;
+    std::map<int, std::string> expected;
+    for (int i = 0; i < 5000; i += 3) {
+        map.insert_or_assign(i, std::to_string(i));
+        expected.emplace(i, std::to_string(i));
+    }
+
+    EXPECT_EQ(ToStdMap(map), expected);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(map.begin(), map.end())), map.size());
+}
+
+TEST(PersistentHashMap, Collisions) {
+    cache::PersistentHashMap<int, int, BadHash> map;
+    for (int i = 0; i < 10; ++i) map.insert_or_assign(i, i);
+
+    auto copy = map;
+    for (int i = 0; i < 10; i += 2) EXPECT_EQ(copy.erase(i), 1);
+    copy[1] = 100;
+
+    EXPECT_EQ(map.size(), 10);
+    EXPECT_EQ(copy.size(), 5);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(map.at(i), i);
+        EXPECT_EQ(copy.contains(i), i % 2 == 1);
+    }
+    EXPECT_EQ(copy.at(1), 100);
+    EXPECT_EQ(ToStdMap(copy).size(), 5);
+}
+
+TEST(PersistentHashMap, MatchesUnorderedMap) {
+    std::minstd_rand rng{42};
+    std::uniform_int_distribution<int> key_distribution{0, 2000};
+
+    cache::PersistentHashMap<int, int> map;
+    std::unordered_map<int, int> expected;
+    auto snapshot = map;
+    auto expected_snapshot = expected;
+
+    for (int i = 0; i < 20000; ++i) {
+        const auto key = key_distribution(rng);
+        if (i % 3 == 0) {
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+        } else {
+            EXPECT_EQ(map.insert_or_assign(key, i), expected.insert_or_assign(key, i).second);
+        }
+
+        if (i % 1000 == 0) {
+            snapshot = map;
+            expected_snapshot = expected;
+        }
+    }
+
+    EXPECT_EQ(map.size(), expected.size());
+    EXPECT_EQ(ToStdMap(map), (std::map<int, int>{expected.begin(), expected.end()}));
+    EXPECT_EQ(ToStdMap(snapshot), (std::map<int, int>{expected_snapshot.begin(), expected_snapshot.end()}));
+}
+
+USERVER_NAMESPACE_END
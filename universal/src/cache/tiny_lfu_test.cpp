@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using TinyLfu = cache::LruMap<int, int, std::hash<int>, std::equal_to<int>, cache::CachePolicy::kTinyLFU>;
+
+template <typename Map>
+std::map<int, int> ToStdMap(const Map& cache) {
+    std::map<int, int> result;
+    cache.VisitAll([&result](int key, int value) { result.emplace(key, value); });
+    return result;
+}
+
+// Hot keys are requested on every other access, the rest are unique scan keys
+template <typename Map>
+double GetHotKeysHitRate(Map& cache) {
+    constexpr int kHotKeys = 50;
+    std::minstd_rand rng{42};
+    std::uniform_int_distribution<int> hot_key_distribution{0, kHotKeys - 1};
+
+    std::size_t hits = 0;
+    std::size_t total = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const auto key = (i % 2 == 0) ? hot_key_distribution(rng) : kHotKeys + i;
+        const bool is_hit = cache.Get(key) != nullptr;
+        if (!is_hit) cache.Put(key, key);
+        if (key < kHotKeys && i > 10000) {
+            hits += is_hit;
+            ++total;
+        }
+    }
+    return static_cast<double>(hits) / total;
+}
+
+}  // namespace
+
+TEST(TinyLfu, SetGet) {
+    TinyLfu cache(10);
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_TRUE(cache.Put(1, 2));
+    EXPECT_EQ(2, cache.GetOr(1, -1));
+    EXPECT_FALSE(cache.Put(1, 3));
+    EXPECT_EQ(3, cache.GetOr(1, -1));
+    EXPECT_EQ(1, cache.GetSize());
+    EXPECT_EQ(10, cache.GetCapacity());
+
+    cache.Erase(1);
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfu, SizeLimit) {
+    TinyLfu cache(100);
+    for (int i = 0; i < 1000; ++i) {
+        cache.Put(i, i);
+        EXPECT_LE(cache.GetSize(), 100);
+    }
+    EXPECT_EQ(cache.GetSize(), 100);
+
+    const auto values = ToStdMap(cache);
+    EXPECT_EQ(values.size(), 100);
+    for (const auto& [key, value] : values) EXPECT_EQ(key, value);
+    EXPECT_GT(cache.GetAdmissionRejects(), 0);
+    EXPECT_LE(cache.GetAdmissionRejects() + cache.GetSize(), 1000);
+
+    cache.SetMaxSize(10);
+    EXPECT_EQ(cache.GetSize(), 10);
+    cache.Clear();
+    EXPECT_EQ(cache.GetSize(), 0);
+}
+
+TEST(TinyLfu, SingleElement) {
+    TinyLfu cache(1);
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+    EXPECT_EQ(cache.GetSize(), 1);
+    EXPECT_EQ(cache.GetOr(2, -1), 2);
+}
+
+TEST(TinyLfu, FrequentKeysAreKept) {
+    TinyLfu cache(10);
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 5; ++j) cache.Put(i, i);
+    }
+
+    // One-hit wonders do not evict the frequently used keys
+    for (int i = 100; i < 200; ++i) cache.Put(i, i);
+    for (int i = 0; i < 9; ++i) EXPECT_NE(cache.Get(i), nullptr) << i;
+    EXPECT_GT(cache.GetAdmissionRejects(), 90);
+}
+
+TEST(TinyLfu, ScanResistance) {
+    cache::LruMap<int, int> lru(100);
+    TinyLfu tiny_lfu(100);
+
+    const auto lru_hit_rate = GetHotKeysHitRate(lru);
+    const auto tiny_lfu_hit_rate = GetHotKeysHitRate(tiny_lfu);
+    EXPECT_GT(tiny_lfu_hit_rate, 0.95);
+    EXPECT_GT(tiny_lfu_hit_rate, lru_hit_rate);
+}
+
+USERVER_NAMESPACE_END
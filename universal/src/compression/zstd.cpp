@@ -1,7 +1,13 @@
 #include <userver/compression/zstd.hpp>
 
+#include <algorithm>
 #include <memory>
 
+#include <userver/compiler/thread_local.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
 #include <zstd.h>
 #include <zstd_errors.h>
 
@@ -12,56 +18,96 @@ namespace compression::zstd {
 namespace {
 // The same size as in ZSTD_DStreamOutSize();
 const size_t kDecompressBufferSize = ZSTD_DStreamOutSize();
-}  // namespace
 
-std::string DecompressStream(std::string_view compressed, size_t max_size) {
-    std::string decompressed;
-    std::string buf(kDecompressBufferSize, '\0');
+struct CCtxDeleter final {
+    void operator()(ZSTD_CCtx* ptr) const noexcept { ZSTD_freeCCtx(ptr); }
+};
 
-    auto* stream = ZSTD_createDStream();
-    if (stream == nullptr) {
-        throw std::runtime_error("Couldn't create ZSTD decompression stream");
-    }
-    auto stream_del = [](ZSTD_DStream* ptr) { ZSTD_freeDStream(ptr); };
-    auto stream_guard = std::unique_ptr<ZSTD_DStream, decltype(stream_del)>(stream, stream_del);
+struct DCtxDeleter final {
+    void operator()(ZSTD_DCtx* ptr) const noexcept { ZSTD_freeDCtx(ptr); }
+};
 
-    {
-        const auto err_code = ZSTD_DCtx_reset(stream, ZSTD_ResetDirective::ZSTD_reset_session_and_parameters);
-        if (ZSTD_isError(err_code)) {
-            throw ErrWithCode(ZSTD_getErrorName(err_code));
-        }
+using CCtxPtr = std::unique_ptr<ZSTD_CCtx, CCtxDeleter>;
+using DCtxPtr = std::unique_ptr<ZSTD_DCtx, DCtxDeleter>;
+
+// Contexts reused by Compress and Decompress. They do not suspend, so a
+// context is never shared.
+compiler::ThreadLocal local_cctx = [] { return CCtxPtr{}; };
+compiler::ThreadLocal local_dctx = [] { return DCtxPtr{}; };
+
+// A reused context keeps the workspace for the largest level and window it
+// has seen. A context that grew over this limit is freed after the call, so
+// that a rare big call does not pin the memory in every worker thread.
+constexpr std::size_t kMaxRetainedContextSize = 4 * 1024 * 1024;
+
+CCtxPtr MakeCCtx() {
+    CCtxPtr ctx{ZSTD_createCCtx()};
+    if (!ctx) {
+        throw CompressionError("Couldn't create ZSTD compression context");
     }
+    return ctx;
+}
 
-    for (size_t cur_pos(0); cur_pos < compressed.size();) {
-        ZSTD_inBuffer input{
-            compressed.data() + cur_pos, std::min(kDecompressBufferSize, compressed.size() - cur_pos), 0};
+DCtxPtr MakeDCtx() {
+    DCtxPtr ctx{ZSTD_createDCtx()};
+    if (!ctx) {
+        throw std::runtime_error("Couldn't create ZSTD decompression stream");
+    }
+    return ctx;
+}
 
-        while (input.pos < input.size) {
-            ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+void CheckCompression(std::size_t ret) {
+    if (ZSTD_isError(ret)) {
+        throw CompressionError(ZSTD_getErrorName(ret));
+    }
+}
 
-            if (const auto ret = ZSTD_decompressStream(stream, &output, &input); ZSTD_isError(ret)) {
-                throw ErrWithCode(ZSTD_getErrorName(ret));
-            }
+void CheckDecompression(std::size_t ret) {
+    if (ZSTD_isError(ret)) {
+        throw ErrWithCode(ZSTD_getErrorName(ret));
+    }
+}
 
-            decompressed.append(static_cast<char*>(output.dst), output.pos);
-        }
+// Appends the output of ZSTD_decompressStream for the whole `input`
+void DecompressChunk(ZSTD_DCtx* ctx, ZSTD_inBuffer& input, std::string& decompressed, size_t max_size) {
+    std::string buf(kDecompressBufferSize, '\0');
+    while (true) {
+        ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+        CheckDecompression(ZSTD_decompressStream(ctx, &output, &input));
 
+        decompressed.append(static_cast<char*>(output.dst), output.pos);
         if (decompressed.size() > max_size) {
             throw TooBigError();
         }
+        // A full output buffer means that some data may be left unflushed
+        if (input.pos == input.size && output.pos < output.size) break;
+    }
+}
 
+std::string DecompressStream(ZSTD_DCtx* ctx, std::string_view compressed, size_t max_size) {
+    std::string decompressed;
+    for (size_t cur_pos(0); cur_pos < compressed.size();) {
+        ZSTD_inBuffer input{
+            compressed.data() + cur_pos, std::min(kDecompressBufferSize, compressed.size() - cur_pos), 0};
+        DecompressChunk(ctx, input, decompressed, max_size);
         cur_pos += input.size;
     }
 
     return decompressed;
 }
 
-std::string Decompress(std::string_view compressed, size_t max_size) {
+std::string
+DoDecompress(ZSTD_DCtx* ctx, std::string_view compressed, size_t max_size, const ZSTD_DDict* dictionary) {
+    CheckDecompression(ZSTD_DCtx_reset(ctx, ZSTD_ResetDirective::ZSTD_reset_session_and_parameters));
+    if (dictionary) {
+        CheckDecompression(ZSTD_DCtx_refDDict(ctx, dictionary));
+    }
+
     const auto decompressed_size = ZSTD_getFrameContentSize(compressed.data(), compressed.size());
 
     switch (decompressed_size) {
         case ZSTD_CONTENTSIZE_UNKNOWN:
-            return DecompressStream(compressed, max_size);
+            return DecompressStream(ctx, compressed, max_size);
         case ZSTD_CONTENTSIZE_ERROR:
             throw std::runtime_error("Error while getting size");
         default:
@@ -71,12 +117,205 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     }
 
     std::string decompressed(decompressed_size, '\0');
-    if (const auto ret =
-            ZSTD_decompress(decompressed.data(), decompressed.capacity(), compressed.data(), compressed.size());
-        ZSTD_isError(ret)) {
-        throw ErrWithCode(ZSTD_getErrorName(ret));
+    // Uses the dictionary referenced by the context
+    CheckDecompression(
+        ZSTD_decompressDCtx(ctx, decompressed.data(), decompressed.size(), compressed.data(), compressed.size())
+    );
+
+    return decompressed;
+}
+
+std::string DoCompress(ZSTD_CCtx* ctx, std::string_view data) {
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto ret = ZSTD_compress2(ctx, compressed.data(), compressed.size(), data.data(), data.size());
+    CheckCompression(ret);
+    compressed.resize(ret);
+    return compressed;
+}
+
+}  // namespace
+
+struct Dictionary::Impl final {
+    struct CDictDeleter final {
+        void operator()(ZSTD_CDict* ptr) const noexcept { ZSTD_freeCDict(ptr); }
+    };
+
+    struct DDictDeleter final {
+        void operator()(ZSTD_DDict* ptr) const noexcept { ZSTD_freeDDict(ptr); }
+    };
+
+    std::unique_ptr<ZSTD_CDict, CDictDeleter> cdict;
+    std::unique_ptr<ZSTD_DDict, DDictDeleter> ddict;
+};
+
+Dictionary::Dictionary(std::string_view content, int level) {
+    auto impl = std::make_shared<Impl>();
+    // Both digested dictionaries copy the content
+    impl->cdict.reset(ZSTD_createCDict(content.data(), content.size(), level));
+    impl->ddict.reset(ZSTD_createDDict(content.data(), content.size()));
+    if (!impl->cdict || !impl->ddict) {
+        throw CompressionError("Couldn't load ZSTD dictionary");
     }
+    impl_ = std::move(impl);
+}
+
+Dictionary Dictionary::FromFile(const std::string& path, int level) {
+    return Dictionary{fs::blocking::ReadFileContents(path), level};
+}
+
+unsigned Dictionary::GetId() const noexcept { return ZSTD_getDictID_fromDDict(impl_->ddict.get()); }
 
+std::string Decompress(std::string_view compressed, size_t max_size) {
+    auto ctx = local_dctx.Use();
+    if (!*ctx) *ctx = MakeDCtx();
+    const utils::FastScopeGuard release_guard{[&ctx]() noexcept {
+        if (ZSTD_sizeof_DCtx(ctx->get()) > kMaxRetainedContextSize) ctx->reset();
+    }};
+    return DoDecompress(ctx->get(), compressed, max_size, nullptr);
+}
+
+std::string Compress(std::string_view data, int level) {
+    auto ctx = local_cctx.Use();
+    if (!*ctx) *ctx = MakeCCtx();
+    const utils::FastScopeGuard release_guard{[&ctx]() noexcept {
+        if (ZSTD_sizeof_CCtx(ctx->get()) > kMaxRetainedContextSize) ctx->reset();
+    }};
+    CheckCompression(ZSTD_CCtx_reset(ctx->get(), ZSTD_reset_session_and_parameters));
+    CheckCompression(ZSTD_CCtx_setParameter(ctx->get(), ZSTD_c_compressionLevel, level));
+    return DoCompress(ctx->get(), data);
+}
+
+struct Compressor::Impl final {
+    CCtxPtr ctx{MakeCCtx()};
+};
+
+Compressor::Compressor(int level) : impl_(std::make_unique<Impl>()) {
+    CheckCompression(ZSTD_CCtx_setParameter(impl_->ctx.get(), ZSTD_c_compressionLevel, level));
+}
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+Compressor::~Compressor() = default;
+
+void Compressor::SetWorkers(int workers) {
+    CheckCompression(ZSTD_CCtx_setParameter(impl_->ctx.get(), ZSTD_c_nbWorkers, workers));
+}
+
+std::string Compressor::Compress(std::string_view data) {
+    CheckCompression(ZSTD_CCtx_reset(impl_->ctx.get(), ZSTD_reset_session_only));
+    return DoCompress(impl_->ctx.get(), data);
+}
+
+std::string Compressor::Compress(std::string_view data, const Dictionary& dictionary) {
+    auto* ctx = impl_->ctx.get();
+    CheckCompression(ZSTD_CCtx_reset(ctx, ZSTD_reset_session_only));
+    CheckCompression(ZSTD_CCtx_refCDict(ctx, dictionary.impl_->cdict.get()));
+    // The context must not keep a reference to the dictionary
+    const utils::FastScopeGuard unref_guard{[ctx]() noexcept { ZSTD_CCtx_refCDict(ctx, nullptr); }};
+    return DoCompress(ctx, data);
+}
+
+struct Decompressor::Impl final {
+    DCtxPtr ctx{MakeDCtx()};
+};
+
+Decompressor::Decompressor() : impl_(std::make_unique<Impl>()) {}
+
+Decompressor::Decompressor(Decompressor&&) noexcept = default;
+
+Decompressor& Decompressor::operator=(Decompressor&&) noexcept = default;
+
+Decompressor::~Decompressor() = default;
+
+std::string Decompressor::Decompress(std::string_view compressed, std::size_t max_size) {
+    return DoDecompress(impl_->ctx.get(), compressed, max_size, nullptr);
+}
+
+std::string
+Decompressor::Decompress(std::string_view compressed, std::size_t max_size, const Dictionary& dictionary) {
+    return DoDecompress(impl_->ctx.get(), compressed, max_size, dictionary.impl_->ddict.get());
+}
+
+struct StreamCompressor::Impl final {
+    CCtxPtr ctx{MakeCCtx()};
+    // Keeps the referenced dictionary alive
+    std::shared_ptr<const Dictionary::Impl> dictionary;
+    bool finished{false};
+
+    std::string Process(std::string_view chunk, ZSTD_EndDirective directive) {
+        UASSERT_MSG(!finished, "StreamCompressor is used after Finish()");
+
+        ZSTD_inBuffer input{chunk.data(), chunk.size(), 0};
+        std::string result;
+        std::string buf(ZSTD_CStreamOutSize(), '\0');
+        while (true) {
+            ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+            // Returns the amount of data remaining to be flushed
+            const auto remaining = ZSTD_compressStream2(ctx.get(), &output, &input, directive);
+            CheckCompression(remaining);
+            result.append(buf.data(), output.pos);
+            if (remaining == 0 && input.pos == input.size) break;
+        }
+        return result;
+    }
+};
+
+StreamCompressor::StreamCompressor(int level) : impl_(std::make_unique<Impl>()) {
+    CheckCompression(ZSTD_CCtx_setParameter(impl_->ctx.get(), ZSTD_c_compressionLevel, level));
+}
+
+StreamCompressor::StreamCompressor(const Dictionary& dictionary) : impl_(std::make_unique<Impl>()) {
+    impl_->dictionary = dictionary.impl_;
+    CheckCompression(ZSTD_CCtx_refCDict(impl_->ctx.get(), impl_->dictionary->cdict.get()));
+}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::Compress(std::string_view chunk) {
+    if (chunk.empty()) return {};
+    return impl_->Process(chunk, ZSTD_e_flush);
+}
+
+std::string StreamCompressor::Finish() {
+    auto result = impl_->Process({}, ZSTD_e_end);
+    impl_->finished = true;
+    return result;
+}
+
+struct StreamDecompressor::Impl final {
+    DCtxPtr ctx{MakeDCtx()};
+    std::shared_ptr<const Dictionary::Impl> dictionary;
+    std::size_t max_size{0};
+    std::size_t decompressed_size{0};
+};
+
+StreamDecompressor::StreamDecompressor(std::size_t max_size) : impl_(std::make_unique<Impl>()) {
+    impl_->max_size = max_size;
+}
+
+StreamDecompressor::StreamDecompressor(std::size_t max_size, const Dictionary& dictionary)
+    : StreamDecompressor(max_size) {
+    impl_->dictionary = dictionary.impl_;
+    CheckDecompression(ZSTD_DCtx_refDDict(impl_->ctx.get(), impl_->dictionary->ddict.get()));
+}
+
+StreamDecompressor::StreamDecompressor(StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor& StreamDecompressor::operator=(StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor::~StreamDecompressor() = default;
+
+std::string StreamDecompressor::Decompress(std::string_view chunk) {
+    std::string decompressed;
+    ZSTD_inBuffer input{chunk.data(), chunk.size(), 0};
+    DecompressChunk(impl_->ctx.get(), input, decompressed, impl_->max_size - impl_->decompressed_size);
+    impl_->decompressed_size += decompressed.size();
     return decompressed;
 }
 
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <random>
+#include <string>
 
 #include <zstd.h>
 #include <userver/compression/zstd.hpp>
@@ -44,4 +45,83 @@ static void ZstdDecompress(benchmark::State& state) {
 }
 BENCHMARK(ZstdDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+namespace {
+
+std::string MakeSimilarRecord(std::size_t i) {
+    return R"({"user_id":)" + std::to_string(i) + R"(,"status":"active","country":"NL","tags":["a","b"]})";
+}
+
+compression::zstd::Dictionary MakeRecordsDictionary() {
+    std::string content;
+    for (std::size_t i = 0; i < 16; ++i) content += MakeSimilarRecord(i);
+    return compression::zstd::Dictionary{content};
+}
+
+}  // namespace
+
+static void ZstdCompressSmallFreeFunction(benchmark::State& state) {
+    std::size_t i = 0;
+    std::size_t compressed_size = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        compressed_size += compression::zstd::Compress(MakeSimilarRecord(i++)).size();
+    }
+    state.counters["compressed_bytes"] = benchmark::Counter(compressed_size, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(ZstdCompressSmallFreeFunction);
+
+static void ZstdCompressSmallReusedContext(benchmark::State& state) {
+    compression::zstd::Compressor compressor;
+    std::size_t i = 0;
+    std::size_t compressed_size = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        compressed_size += compressor.Compress(MakeSimilarRecord(i++)).size();
+    }
+    state.counters["compressed_bytes"] = benchmark::Counter(compressed_size, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(ZstdCompressSmallReusedContext);
+
+static void ZstdCompressSmallDictionary(benchmark::State& state) {
+    const auto dictionary = MakeRecordsDictionary();
+    compression::zstd::Compressor compressor;
+    std::size_t i = 0;
+    std::size_t compressed_size = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        compressed_size += compressor.Compress(MakeSimilarRecord(i++), dictionary).size();
+    }
+    state.counters["compressed_bytes"] = benchmark::Counter(compressed_size, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(ZstdCompressSmallDictionary);
+
+static void ZstdDecompressSmallDictionary(benchmark::State& state) {
+    const auto dictionary = MakeRecordsDictionary();
+    const auto data = MakeSimilarRecord(42);
+    const auto compressed = compression::zstd::Compressor{}.Compress(data, dictionary);
+
+    compression::zstd::Decompressor decompressor;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decompressor.Decompress(compressed, data.size(), dictionary));
+    }
+}
+BENCHMARK(ZstdDecompressSmallDictionary);
+
+// Argument: the number of zstd worker threads
+static void ZstdCompressLargeWorkers(benchmark::State& state) {
+    std::string data;
+    for (std::size_t i = 0; data.size() < (16 << 20); ++i) data += MakeSimilarRecord(i);
+
+    compression::zstd::Compressor compressor;
+    try {
+        compressor.SetWorkers(state.range(0));
+    } catch (const compression::CompressionError& ex) {
+        state.SkipWithError(ex.what());
+        return;
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(compressor.Compress(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(ZstdCompressLargeWorkers)->Arg(0)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
 USERVER_NAMESPACE_END
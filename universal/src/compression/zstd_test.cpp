@@ -60,4 +60,124 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, CompressRoundTrip) {
+    std::string data;
+    for (int i = 0; i < 10000; ++i) {
+        data += std::to_string(i % 97);
+    }
+
+    const auto compressed = compression::zstd::Compress(data);
+    EXPECT_LT(compressed.size(), data.size());
+    EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+    EXPECT_EQ(compression::zstd::Decompress(compression::zstd::Compress(""), 1), "");
+}
+
+TEST(Zstd, CompressHighLevelThenDefault) {
+    std::string data;
+    for (int i = 0; i < 300000; ++i) {
+        data += std::to_string(i % 997);
+    }
+
+    // The thread-local context outgrows the retained size limit here and is
+    // recreated by the following calls
+    const auto compressed_high = compression::zstd::Compress(data, 19);
+    EXPECT_EQ(compression::zstd::Decompress(compressed_high, data.size()), data);
+
+    const auto compressed = compression::zstd::Compress(data);
+    EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+    EXPECT_LE(compressed_high.size(), compressed.size());
+}
+
+TEST(Zstd, StreamCompressor) {
+    const std::string data(10000, 'x');
+    compression::zstd::StreamCompressor compressor;
+
+    std::string compressed = compressor.Compress(std::string_view{data}.substr(0, 100));
+    EXPECT_FALSE(compressed.empty()) << "Every chunk should be flushed";
+    compressed += compressor.Compress(std::string_view{data}.substr(100));
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+}
+
+namespace {
+
+std::string MakeRecord(int i) {
+    return R"({"user_id":)" + std::to_string(i) + R"(,"status":"active","country":"NL","tags":["a","b"]})";
+}
+
+// A raw content dictionary, trained dictionaries work the same way
+compression::zstd::Dictionary MakeDictionary() {
+    std::string content;
+    for (int i = 0; i < 10; ++i) content += MakeRecord(i);
+    return compression::zstd::Dictionary{content};
+}
+
+}  // namespace
+
+TEST(Zstd, CompressorReuse) {
+    compression::zstd::Compressor compressor;
+    compression::zstd::Decompressor decompressor;
+
+    for (int i = 0; i < 10; ++i) {
+        const auto data = MakeRecord(i);
+        const auto compressed = compressor.Compress(data);
+        EXPECT_EQ(decompressor.Decompress(compressed, data.size()), data);
+        EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+    }
+}
+
+TEST(Zstd, Dictionary) {
+    const auto dictionary = MakeDictionary();
+    compression::zstd::Compressor compressor;
+    compression::zstd::Decompressor decompressor;
+
+    const auto data = MakeRecord(42);
+    const auto with_dictionary = compressor.Compress(data, dictionary);
+    EXPECT_LT(with_dictionary.size(), compressor.Compress(data).size());
+    EXPECT_EQ(decompressor.Decompress(with_dictionary, data.size(), dictionary), data);
+
+    EXPECT_THROW(decompressor.Decompress(with_dictionary, data.size()), compression::DecompressionError);
+    EXPECT_THROW(decompressor.Decompress(with_dictionary, data.size() / 2, dictionary), compression::TooBigError);
+
+    // The dictionary is not kept by the compressor after the call
+    const auto compressed = compressor.Compress(data);
+    EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+}
+
+TEST(Zstd, MultithreadedCompression) {
+    compression::zstd::Compressor compressor;
+    try {
+        compressor.SetWorkers(2);
+    } catch (const compression::CompressionError&) {
+        GTEST_SKIP() << "zstd is built without multithreading support";
+    }
+
+    std::string data;
+    for (int i = 0; i < 100'000; ++i) data += MakeRecord(i);
+
+    const auto compressed = compressor.Compress(data);
+    EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+}
+
+TEST(Zstd, StreamDecompressor) {
+    const auto dictionary = MakeDictionary();
+    std::string data;
+    for (int i = 0; i < 1000; ++i) data += MakeRecord(i);
+
+    compression::zstd::StreamCompressor compressor{dictionary};
+    std::string compressed = compressor.Compress(data);
+    compressed += compressor.Finish();
+
+    compression::zstd::StreamDecompressor decompressor{data.size(), dictionary};
+    std::string decompressed;
+    for (std::size_t pos = 0; pos < compressed.size(); pos += 7) {
+        decompressed += decompressor.Decompress(std::string_view{compressed}.substr(pos, 7));
+    }
+    EXPECT_EQ(decompressed, data);
+
+    compression::zstd::StreamDecompressor small_decompressor{data.size() / 2, dictionary};
+    EXPECT_THROW(small_decompressor.Decompress(compressed), compression::TooBigError);
+}
+
 USERVER_NAMESPACE_END
@@ -1,9 +1,21 @@
 #include <userver/crypto/base64.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+
 #include <cryptopp/base64.h>
 
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
 #include <userver/crypto/exception.hpp>
 
+#include <crypto/base64_cryptopp.hpp>
+
 #ifdef CRYPTOPP_NO_GLOBAL_BYTE
 using CryptoPP::byte;
 #endif
@@ -15,7 +27,7 @@ namespace crypto::base64 {
 namespace {
 
 template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
+std::string CryptoPPEncode(std::string_view data, Pad pad) {
     std::string response;
     try {
         Base64Encoder encoder(new CryptoPP::StringSink(response));
@@ -31,7 +43,7 @@ std::string Base64Encode(std::string_view data, Pad pad) {
 }
 
 template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
+std::string CryptoPPDecode(std::string_view data) {
     std::string response;
     try {
         Base64Decoder decoder(new CryptoPP::StringSink(response));
@@ -42,18 +54,252 @@ std::string Base64Decode(std::string_view data) {
     return response;
 }
 
+constexpr std::string_view kLettersAndDigits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+static_assert(kLettersAndDigits.size() == 62);
+
+// The alphabets differ only in the last two characters
+struct Alphabet final {
+    constexpr Alphabet(char char62, char char63) : char62(char62), char63(char63), chars(), values() {
+        for (std::size_t i = 0; i < kLettersAndDigits.size(); ++i) chars[i] = kLettersAndDigits[i];
+        chars[62] = char62;
+        chars[63] = char63;
+
+        for (auto& value : values) value = -1;
+        for (std::size_t i = 0; i < chars.size(); ++i) values[static_cast<unsigned char>(chars[i])] = i;
+    }
+
+    char char62;
+    char char63;
+    std::array<char, 64> chars;
+    // -1 for the characters out of the alphabet
+    std::array<std::int8_t, 256> values;
+};
+
+constexpr Alphabet kBase64Alphabet{'+', '/'};
+constexpr Alphabet kBase64UrlAlphabet{'-', '_'};
+
+#ifdef __SSSE3__
+
+// Encoding and decoding of 12 bytes <-> 16 characters at once, see
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html and
+// http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+
+// Splits the lowest 12 bytes into 16 sextets
+__m128i UnpackSextets(__m128i data) noexcept {
+    data = _mm_shuffle_epi8(data, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    const auto t0 = _mm_and_si128(data, _mm_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const auto t2 = _mm_and_si128(data, _mm_set1_epi32(0x003f03f0));
+    const auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+__m128i SextetsToChars(__m128i sextets, const Alphabet& alphabet) noexcept {
+    // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    auto offset_index = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+    const auto is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), sextets);
+    offset_index = _mm_or_si128(offset_index, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+
+    const auto offsets = _mm_setr_epi8(
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        alphabet.char62 - 62,
+        alphabet.char63 - 63,
+        'A',
+        0,
+        0
+    );
+    return _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, offset_index));
+}
+
+__m128i InRange(__m128i chars, char first, char last) noexcept {
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8(last + 1))
+    );
+}
+
+// Returns false if any of the 16 characters is out of the alphabet
+bool CharsToSextets(__m128i chars, const Alphabet& alphabet, __m128i& sextets) noexcept {
+    const auto is_upper = InRange(chars, 'A', 'Z');
+    const auto is_lower = InRange(chars, 'a', 'z');
+    const auto is_digit = InRange(chars, '0', '9');
+    const auto is_62 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet.char62));
+    const auto is_63 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet.char63));
+
+    const auto is_valid =
+        _mm_or_si128(_mm_or_si128(is_upper, is_lower), _mm_or_si128(is_digit, _mm_or_si128(is_62, is_63)));
+    if (_mm_movemask_epi8(is_valid) != 0xffff) return false;
+
+    const auto offset = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128(is_upper, _mm_set1_epi8(-'A')),
+            _mm_and_si128(is_lower, _mm_set1_epi8(static_cast<char>(26 - 'a')))
+        ),
+        _mm_or_si128(
+            _mm_and_si128(is_digit, _mm_set1_epi8(52 - '0')),
+            _mm_or_si128(
+                _mm_and_si128(is_62, _mm_set1_epi8(static_cast<char>(62 - alphabet.char62))),
+                _mm_and_si128(is_63, _mm_set1_epi8(static_cast<char>(63 - alphabet.char63)))
+            )
+        )
+    );
+    sextets = _mm_add_epi8(chars, offset);
+    return true;
+}
+
+// Packs 16 sextets into the lowest 12 bytes
+__m128i PackSextets(__m128i sextets) noexcept {
+    const auto pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+    const auto quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+#endif
+
+std::string Encode(std::string_view data, Pad pad, const Alphabet& alphabet) {
+    const auto full_groups = data.size() / 3;
+    const auto tail_size = data.size() % 3;
+    std::size_t size = full_groups * 4;
+    if (tail_size != 0) size += (pad == Pad::kWith ? 4 : tail_size + 1);
+
+    std::string result(size, '\0');
+    const auto* in = reinterpret_cast<const unsigned char*>(data.data());
+    const auto* const in_end = in + full_groups * 3;
+    auto* out = result.data();
+
+#ifdef __SSSE3__
+    // Loads 16 bytes to encode 12 of them
+    while (data.size() - (in - reinterpret_cast<const unsigned char*>(data.data())) >= 16) {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), SextetsToChars(UnpackSextets(bytes), alphabet));
+        in += 12;
+        out += 16;
+    }
+#endif
+
+    for (; in != in_end; in += 3, out += 4) {
+        const std::uint32_t group = (in[0] << 16) | (in[1] << 8) | in[2];
+        out[0] = alphabet.chars[(group >> 18) & 0x3f];
+        out[1] = alphabet.chars[(group >> 12) & 0x3f];
+        out[2] = alphabet.chars[(group >> 6) & 0x3f];
+        out[3] = alphabet.chars[group & 0x3f];
+    }
+
+    if (tail_size != 0) {
+        const std::uint32_t group = (in[0] << 16) | (tail_size == 2 ? in[1] << 8 : 0);
+        out[0] = alphabet.chars[(group >> 18) & 0x3f];
+        out[1] = alphabet.chars[(group >> 12) & 0x3f];
+        if (tail_size == 2) out[2] = alphabet.chars[(group >> 6) & 0x3f];
+        if (pad == Pad::kWith) {
+            if (tail_size == 1) out[2] = '=';
+            out[3] = '=';
+        }
+    }
+
+    return result;
+}
+
+// Decodes the input that consists only of the alphabet characters with an
+// optional padding, returns std::nullopt on any other input
+std::optional<std::string> TryDecode(std::string_view data, const Alphabet& alphabet) {
+    for (int i = 0; i < 2 && !data.empty() && data.back() == '='; ++i) data.remove_suffix(1);
+
+    // A single character carries only 6 bits and does not make up a byte
+    const auto tail_size = data.size() % 4;
+    const auto size = data.size() / 4 * 3 + (tail_size > 1 ? tail_size - 1 : 0);
+    std::string result(size, '\0');
+
+    const auto* in = reinterpret_cast<const unsigned char*>(data.data());
+    const auto* const in_end = in + data.size() - tail_size;
+    auto* out = result.data();
+
+#ifdef __SSSE3__
+    for (; in_end - in >= 16; in += 16, out += 12) {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        __m128i sextets;
+        if (!CharsToSextets(chars, alphabet, sextets)) return std::nullopt;
+
+        alignas(16) char bytes[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(bytes), PackSextets(sextets));
+        std::memcpy(out, bytes, 12);
+    }
+#endif
+
+    const auto value = [&alphabet](unsigned char c) { return alphabet.values[c]; };
+    for (; in != in_end; in += 4, out += 3) {
+        const std::int32_t v0 = value(in[0]);
+        const std::int32_t v1 = value(in[1]);
+        const std::int32_t v2 = value(in[2]);
+        const std::int32_t v3 = value(in[3]);
+        if ((v0 | v1 | v2 | v3) < 0) return std::nullopt;
+
+        const std::int32_t group = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+        out[0] = static_cast<char>(group >> 16);
+        out[1] = static_cast<char>(group >> 8);
+        out[2] = static_cast<char>(group);
+    }
+
+    if (tail_size > 1) {
+        std::int32_t group = 0;
+        for (std::size_t i = 0; i < tail_size; ++i) {
+            const auto sextet = value(in[i]);
+            if (sextet < 0) return std::nullopt;
+            group |= sextet << (18 - 6 * i);
+        }
+        out[0] = static_cast<char>(group >> 16);
+        if (tail_size == 3) out[1] = static_cast<char>(group >> 8);
+    } else if (tail_size == 1 && value(*in) < 0) {
+        return std::nullopt;
+    }
+
+    return result;
+}
+
 }  // namespace
 
-std::string Base64Encode(std::string_view data, Pad pad) { return Base64Encode<CryptoPP::Base64Encoder>(data, pad); }
+namespace impl {
 
-std::string Base64Decode(std::string_view data) { return Base64Decode<CryptoPP::Base64Decoder>(data); }
+std::string CryptoPPBase64Encode(std::string_view data, Pad pad) {
+    return CryptoPPEncode<CryptoPP::Base64Encoder>(data, pad);
+}
+
+std::string CryptoPPBase64Decode(std::string_view data) { return CryptoPPDecode<CryptoPP::Base64Decoder>(data); }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
-std::string Base64UrlEncode(std::string_view data, Pad pad) {
-    return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+std::string CryptoPPBase64UrlEncode(std::string_view data, Pad pad) {
+    return CryptoPPEncode<CryptoPP::Base64URLEncoder>(data, pad);
+}
+
+std::string CryptoPPBase64UrlDecode(std::string_view data) { return CryptoPPDecode<CryptoPP::Base64URLDecoder>(data); }
+#endif
+
+}  // namespace impl
+
+std::string Base64Encode(std::string_view data, Pad pad) { return Encode(data, pad, kBase64Alphabet); }
+
+std::string Base64Decode(std::string_view data) {
+    auto result = TryDecode(data, kBase64Alphabet);
+    if (result) return std::move(*result);
+    return impl::CryptoPPBase64Decode(data);
 }
 
-std::string Base64UrlDecode(std::string_view data) { return Base64Decode<CryptoPP::Base64URLDecoder>(data); }
+#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+std::string Base64UrlEncode(std::string_view data, Pad pad) { return Encode(data, pad, kBase64UrlAlphabet); }
+
+std::string Base64UrlDecode(std::string_view data) {
+    auto result = TryDecode(data, kBase64UrlAlphabet);
+    if (result) return std::move(*result);
+    return impl::CryptoPPBase64UrlDecode(data);
+}
 #endif
 
 }  // namespace crypto::base64
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/utils/rand.hpp>
+
+#include <crypto/base64_cryptopp.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string GenerateData(std::size_t size) {
+    std::string result(size, '\0');
+    for (auto& c : result) c = static_cast<char>(utils::RandRange(256));
+    return result;
+}
+
+}  // namespace
+
+void base64_encode(benchmark::State& state) {
+    const auto data = GenerateData(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::Base64Encode(data));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_encode)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+void base64_encode_cryptopp(benchmark::State& state) {
+    const auto data = GenerateData(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::impl::CryptoPPBase64Encode(data, crypto::base64::Pad::kWith));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_encode_cryptopp)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+void base64_decode(benchmark::State& state) {
+    const auto encoded = crypto::base64::Base64Encode(GenerateData(state.range(0)));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::Base64Decode(encoded));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_decode)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+void base64_decode_cryptopp(benchmark::State& state) {
+    const auto encoded = crypto::base64::Base64Encode(GenerateData(state.range(0)));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::impl::CryptoPPBase64Decode(encoded));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_decode_cryptopp)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+void base64_url_encode(benchmark::State& state) {
+    const auto data = GenerateData(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::Base64UrlEncode(data, crypto::base64::Pad::kWithout));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_url_encode)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+void base64_url_decode(benchmark::State& state) {
+    const auto encoded = crypto::base64::Base64UrlEncode(GenerateData(state.range(0)), crypto::base64::Pad::kWithout);
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::Base64UrlDecode(encoded));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_url_decode)->RangeMultiplier(16)->Range(64, 1 << 20);
+#endif
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <userver/crypto/base64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto::base64::impl {
+
+// Crypto++ based implementations. They skip the characters that are out of
+// the alphabet, the vectorized decoders fall back to them on such input.
+std::string CryptoPPBase64Encode(std::string_view data, Pad pad);
+
+std::string CryptoPPBase64Decode(std::string_view data);
+
+#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+std::string CryptoPPBase64UrlEncode(std::string_view data, Pad pad);
+
+std::string CryptoPPBase64UrlDecode(std::string_view data);
+#endif
+
+}  // namespace crypto::base64::impl
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,10 @@
 
 #include <userver/crypto/base64.hpp>
 
+#include <string>
+
+#include <crypto/base64_cryptopp.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 TEST(Crypto, Base64) {
@@ -15,12 +19,41 @@ TEST(Crypto, Base64) {
     EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64MatchesCryptoPP) {
+    std::string data;
+    for (int size = 0; size < 100; ++size) {
+        data.push_back(static_cast<char>(size * 37 + 11));
+        for (const auto pad : {crypto::base64::Pad::kWith, crypto::base64::Pad::kWithout}) {
+            const auto encoded = crypto::base64::Base64Encode(data, pad);
+            EXPECT_EQ(encoded, crypto::base64::impl::CryptoPPBase64Encode(data, pad));
+            EXPECT_EQ(crypto::base64::Base64Decode(encoded), data);
+        }
+    }
+}
+
+TEST(Crypto, Base64DecodeSkipsInvalidCharacters) {
+    const std::string encoded = crypto::base64::Base64Encode("some longer text that is vectorized");
+    const std::string with_line_breaks = encoded.substr(0, 20) + "\n" + encoded.substr(20);
+    EXPECT_EQ(crypto::base64::Base64Decode(with_line_breaks), "some longer text that is vectorized");
+    EXPECT_EQ(
+        crypto::base64::Base64Decode(with_line_breaks), crypto::base64::impl::CryptoPPBase64Decode(with_line_breaks)
+    );
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
     EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
     EXPECT_EQ("U_8", crypto::base64::Base64UrlEncode("S\xff", crypto::base64::Pad::kWithout));
     EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8"));
     EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8="));
+
+    std::string data;
+    for (int size = 0; size < 100; ++size) {
+        data.push_back(static_cast<char>(size * 53 + 7));
+        const auto encoded = crypto::base64::Base64UrlEncode(data, crypto::base64::Pad::kWithout);
+        EXPECT_EQ(encoded, crypto::base64::impl::CryptoPPBase64UrlEncode(data, crypto::base64::Pad::kWithout));
+        EXPECT_EQ(crypto::base64::Base64UrlDecode(encoded), data);
+    }
 }
 #endif
 
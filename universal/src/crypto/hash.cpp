@@ -1,17 +1,17 @@
 #include <userver/crypto/hash.hpp>
 
+#include <algorithm>
 #include <array>
+#include <variant>
 
-#include <cryptopp/base64.h>
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 #include <cryptopp/blake2.h>
 #endif
-#include <cryptopp/filters.h>
-#include <cryptopp/hex.h>
-#include <cryptopp/hmac.h>
 #include <cryptopp/sha.h>
 
+#include <userver/crypto/base64.hpp>
 #include <userver/crypto/exception.hpp>
+#include <userver/utils/encoding/hex.hpp>
 
 #include <cryptopp/md5.h>
 
@@ -33,47 +33,69 @@ public:
 #endif
 
 std::string EncodeArray(const byte* ptr, size_t length, crypto::hash::OutputEncoding encoding) {
-    std::string response;
+    const std::string_view data{reinterpret_cast<const char*>(ptr), length};
     switch (encoding) {
-        case crypto::hash::OutputEncoding::kBinary: {
-            response = std::string(reinterpret_cast<const char*>(ptr), length);
-            break;
-        }
-        case crypto::hash::OutputEncoding::kBase16: {
-            CryptoPP::HexEncoder encoder(new CryptoPP::StringSink(response), false);
-            encoder.PutMessageEnd(ptr, length);
-            break;
+        case crypto::hash::OutputEncoding::kBinary:
+            return std::string{data};
+        case crypto::hash::OutputEncoding::kBase16:
+            return utils::encoding::ToHex(data);
+        case crypto::hash::OutputEncoding::kBase64:
+            return crypto::base64::Base64Encode(data);
+    }
+    return {};
+}
+
+// HMAC with the hash states after the inner and the outer padded keys
+// precomputed, so that only the message and the inner digest are hashed
+template <typename HashAlgorithm>
+class PrecomputedHmac final {
+public:
+    explicit PrecomputedHmac(std::string_view key) {
+        constexpr auto kBlockSize = HashAlgorithm::BLOCKSIZE;
+        std::array<byte, kBlockSize> padded_key{};
+        if (key.size() > kBlockSize) {
+            HashAlgorithm{}.CalculateDigest(padded_key.data(), reinterpret_cast<const byte*>(key.data()), key.size());
+        } else {
+            std::copy(key.begin(), key.end(), padded_key.begin());
         }
-        case crypto::hash::OutputEncoding::kBase64: {
-            CryptoPP::Base64Encoder encoder(new CryptoPP::StringSink(response), false);
-            encoder.PutMessageEnd(ptr, length);
-            break;
+
+        std::array<byte, kBlockSize> pad{};
+        for (std::size_t i = 0; i < kBlockSize; ++i) pad[i] = padded_key[i] ^ 0x36;
+        inner_.Update(pad.data(), pad.size());
+        for (std::size_t i = 0; i < kBlockSize; ++i) pad[i] = padded_key[i] ^ 0x5c;
+        outer_.Update(pad.data(), pad.size());
+    }
+
+    std::string Calculate(std::string_view message, crypto::hash::OutputEncoding encoding) const {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
+        std::array<byte, HashAlgorithm::DIGESTSIZE> digest;
+        try {
+            auto inner = inner_;
+            inner.Update(reinterpret_cast<const byte*>(message.data()), message.size());
+            inner.Final(digest.data());
+
+            auto outer = outer_;
+            outer.Update(digest.data(), digest.size());
+            outer.Final(digest.data());
+        } catch (const CryptoPP::Exception& exc) {
+            throw crypto::CryptoException(exc.what());
         }
+
+        return EncodeArray(digest.data(), digest.size(), encoding);
     }
-    return response;
-}
 
-std::string EncodeString(std::string_view data, crypto::hash::OutputEncoding encoding) {
-    return EncodeArray(reinterpret_cast<const byte*>(data.data()), data.size(), encoding);
-}
+private:
+    HashAlgorithm inner_;
+    HashAlgorithm outer_;
+};
 
 template <typename HashAlgorithm>
 std::string CalculateHmac(std::string_view key, std::string_view data, crypto::hash::OutputEncoding encoding) {
-    std::string mac;
-
     try {
-        CryptoPP::HMAC<HashAlgorithm> hmac(reinterpret_cast<const byte*>(key.data()), key.size());
-        CryptoPP::StringSource ss_key(
-            reinterpret_cast<const byte*>(data.data()),
-            data.size(),
-            true,
-            new CryptoPP::HashFilter(hmac, new CryptoPP::StringSink(mac))
-        );
+        return PrecomputedHmac<HashAlgorithm>{key}.Calculate(data, encoding);
     } catch (const CryptoPP::Exception& exc) {
         throw crypto::CryptoException(exc.what());
     }
-
-    return EncodeString(mac, encoding);
 }
 
 template <typename HashAlgorithm>
@@ -94,6 +116,62 @@ std::string CalculateHash(std::string_view data, crypto::hash::OutputEncoding en
 
 namespace crypto::hash {
 
+class Hmac::Impl final {
+public:
+    Impl(DigestSize digest_size, std::string_view key) : hmac_(MakeHmac(digest_size, key)) {}
+
+    std::string Calculate(std::string_view message, OutputEncoding encoding) const {
+        return std::visit([&](const auto& hmac) { return hmac.Calculate(message, encoding); }, hmac_);
+    }
+
+private:
+    using Variant = std::variant<
+        PrecomputedHmac<CryptoPP::SHA1>,
+        PrecomputedHmac<CryptoPP::SHA256>,
+        PrecomputedHmac<CryptoPP::SHA384>,
+        PrecomputedHmac<CryptoPP::SHA512>>;
+
+    static Variant MakeHmac(DigestSize digest_size, std::string_view key) {
+        try {
+            switch (digest_size) {
+                case DigestSize::k160:
+                    return PrecomputedHmac<CryptoPP::SHA1>{key};
+                case DigestSize::k256:
+                    return PrecomputedHmac<CryptoPP::SHA256>{key};
+                case DigestSize::k384:
+                    return PrecomputedHmac<CryptoPP::SHA384>{key};
+                case DigestSize::k512:
+                    return PrecomputedHmac<CryptoPP::SHA512>{key};
+            }
+        } catch (const CryptoPP::Exception& exc) {
+            throw CryptoException(exc.what());
+        }
+        throw CryptoException("Unknown HMAC digest size");
+    }
+
+    Variant hmac_;
+};
+
+Hmac::Hmac(DigestSize digest_size, std::string_view key) : impl_(std::make_unique<const Impl>(digest_size, key)) {}
+
+Hmac::Hmac(Hmac&&) noexcept = default;
+
+Hmac& Hmac::operator=(Hmac&&) noexcept = default;
+
+Hmac::~Hmac() = default;
+
+std::string Hmac::Calculate(std::string_view message, OutputEncoding encoding) const {
+    return impl_->Calculate(message, encoding);
+}
+
+std::vector<std::string> Hmac::CalculateBatch(utils::span<const std::string_view> messages, OutputEncoding encoding)
+    const {
+    std::vector<std::string> result;
+    result.reserve(messages.size());
+    for (const auto message : messages) result.push_back(impl_->Calculate(message, encoding));
+    return result;
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 std::string Blake2b128(std::string_view data, OutputEncoding encoding) {
     return CalculateHash<AlgoBlake2b128>(data, encoding);
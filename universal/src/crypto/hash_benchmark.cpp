@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/crypto/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kKey = "some-request-signing-key";
+
+}  // namespace
+
+void hmac_sha256(benchmark::State& state) {
+    const std::string message(state.range(0), 'm');
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::hash::HmacSha256(kKey, message));
+    }
+}
+BENCHMARK(hmac_sha256)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+void hmac_sha256_reusable(benchmark::State& state) {
+    const std::string message(state.range(0), 'm');
+    const crypto::hash::Hmac hmac{crypto::DigestSize::k256, kKey};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(hmac.Calculate(message));
+    }
+}
+BENCHMARK(hmac_sha256_reusable)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+void hmac_sha256_batch(benchmark::State& state) {
+    const std::string message(64, 'm');
+    const std::vector<std::string_view> messages(state.range(0), message);
+    const crypto::hash::Hmac hmac{crypto::DigestSize::k256, kKey};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(hmac.CalculateBatch(messages, crypto::hash::OutputEncoding::kBinary));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(hmac_sha256_batch)->RangeMultiplier(8)->Range(1, 512);
+
+void sha256(benchmark::State& state) {
+    const std::string message(state.range(0), 'm');
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::hash::Sha256(message));
+    }
+}
+BENCHMARK(sha256)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,9 @@
 
 #include <userver/crypto/hash.hpp>
 
+#include <string>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 TEST(Crypto, Sha1) {
@@ -92,6 +95,45 @@ TEST(Crypto, Hmac) {
     );
 }
 
+TEST(Crypto, HmacLongKey) {
+    const std::string key(200, 'k');
+    EXPECT_EQ(
+        "051efe5097868224da86cf064aa37f650d01ed25e42a2527ea7db099c5a629c3",
+        crypto::hash::HmacSha256(key, "test", crypto::hash::OutputEncoding::kHex)
+    );
+    EXPECT_EQ(
+        "5bf723c3440fbd1b812faa7d6949eb30c90e6228d31da2f54f40cb9efcfe4bde808046a0"
+        "5ef62a1d338d66907ee4cac51a68a0e1dde3fb62344b29fc98b3f9b1",
+        crypto::hash::HmacSha512(key, "test", crypto::hash::OutputEncoding::kHex)
+    );
+}
+
+TEST(Crypto, HmacReusable) {
+    const crypto::hash::Hmac hmac_sha256{crypto::DigestSize::k256, "key"};
+    EXPECT_EQ("6e9ef29b75fffc5b7abae527d58fdadb2fe42e7219011976917343065f58ed4a", hmac_sha256.Calculate("message"));
+    EXPECT_EQ("6e9ef29b75fffc5b7abae527d58fdadb2fe42e7219011976917343065f58ed4a", hmac_sha256.Calculate("message"));
+    EXPECT_EQ(
+        crypto::hash::HmacSha256("key", "test", crypto::hash::OutputEncoding::kBase64),
+        hmac_sha256.Calculate("test", crypto::hash::OutputEncoding::kBase64)
+    );
+
+    const crypto::hash::Hmac hmac_sha1{crypto::DigestSize::k160, "key"};
+    EXPECT_EQ("f42bb0eeb018ebbd4597ae7213711ec60760843f", hmac_sha1.Calculate({}));
+
+    const crypto::hash::Hmac hmac_sha384{crypto::DigestSize::k384, "secret"};
+    EXPECT_EQ(crypto::hash::HmacSha384("secret", "", crypto::hash::OutputEncoding::kHex), hmac_sha384.Calculate(""));
+}
+
+TEST(Crypto, HmacBatch) {
+    const crypto::hash::Hmac hmac{crypto::DigestSize::k512, "test"};
+    const std::vector<std::string_view> messages{"test", "", "message"};
+    const auto result = hmac.CalculateBatch(messages);
+    ASSERT_EQ(result.size(), messages.size());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(result[i], crypto::hash::HmacSha512("test", messages[i]));
+    }
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 TEST(Crypto, Blake2b128) {
     EXPECT_EQ(
@@ -39,6 +39,54 @@ std::string_view ErrorDescription(ParseErrorCode error_code) {
     UINVARIANT(false, "Unexpected decimal64 error code");
 }
 
+constexpr uint64_t kZeroChars = 0x3030303030303030;
+
+// Chars of 8 decimal digits of `value` < 10^8, the first digit in the lowest
+// byte
+uint64_t EightDigitsToChars(uint32_t value) noexcept {
+    // 4-digit halves in 32-bit lanes
+    uint64_t chunk = (value / 10'000) | (uint64_t{value % 10'000} << 32);
+    // 2-digit quarters in 16-bit lanes, x * 10486 >> 20 == x / 100 for x < 10^4
+    const uint64_t hundreds = ((chunk * 10486) >> 20) & 0x0000007F0000007F;
+    chunk = hundreds | ((chunk - hundreds * 100) << 16);
+    // Digits in 8-bit lanes, x * 103 >> 10 == x / 10 for x < 100
+    const uint64_t tens = ((chunk * 103) >> 10) & 0x000F000F000F000F;
+    chunk = tens | ((chunk - tens * 10) << 8);
+    return chunk + kZeroChars;
+}
+
+// Stores all 8 chars, the caller's buffer must have room for them
+void StoreEightChars(char* out, uint64_t chars) noexcept {
+    for (int i = 0; i < 8; ++i) out[i] = static_cast<char>(chars >> (8 * i));
+}
+
+constexpr auto kEightDigitsChunk = static_cast<uint64_t>(kPow10<8>);
+
+// Writes `value` without leading zeros
+char* WriteDigits(char* out, uint64_t value) noexcept {
+    if (value >= kEightDigitsChunk) {
+        out = WriteDigits(out, value / kEightDigitsChunk);
+        StoreEightChars(out, EightDigitsToChars(value % kEightDigitsChunk));
+        return out + 8;
+    }
+
+    const auto chars = EightDigitsToChars(value);
+    const int leading_zeros = value == 0 ? 7 : __builtin_ctzll(chars - kZeroChars) / 8;
+    StoreEightChars(out, chars >> (8 * leading_zeros));
+    return out + 8 - leading_zeros;
+}
+
+// Writes exactly `digit_count` least significant digits of `value`
+char* WriteFixedDigits(char* out, uint64_t value, int digit_count) noexcept {
+    if (digit_count > 8) {
+        out = WriteFixedDigits(out, value / kEightDigitsChunk, digit_count - 8);
+        value %= kEightDigitsChunk;
+        digit_count = 8;
+    }
+    StoreEightChars(out, EightDigitsToChars(value) >> (8 * (8 - digit_count)));
+    return out + digit_count;
+}
+
 }  // namespace
 
 std::string GetErrorMessage(std::string_view source, std::string_view path, size_t position, ParseErrorCode reason) {
@@ -131,6 +179,20 @@ std::string ToString(int64_t before, int64_t after, int precision, const FormatO
     return result;
 }
 
+std::size_t FormatUnpacked(char* out, bool is_negative, uint64_t before, uint64_t after, int after_digits) noexcept {
+    UASSERT(after_digits >= 0 && after_digits <= kMaxDecimalDigits);
+    char* current = out;
+    *current = '-';
+    current += is_negative;
+
+    current = WriteDigits(current, before);
+    if (after_digits > 0) {
+        *current++ = '.';
+        current = WriteFixedDigits(current, after, after_digits);
+    }
+    return current - out;
+}
+
 }  // namespace impl
 
 }  // namespace decimal64
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Dec4 = decimal64::Decimal<4>;
+
+constexpr std::size_t kValuesCount = 1024;
+
+// Prices, like "1234.56", with `integral_digits` digits before the dot
+std::vector<Dec4> GenerateValues(int integral_digits) {
+    std::vector<Dec4> result;
+    result.reserve(kValuesCount);
+    const auto max_unbiased = decimal64::Pow10(integral_digits + Dec4::kDecimalPoints);
+    for (std::size_t i = 0; i < kValuesCount; ++i) {
+        const auto value = static_cast<int64_t>(utils::RandRange(static_cast<uint64_t>(max_unbiased)));
+        result.push_back(Dec4::FromUnbiased(i % 2 ? value : -value));
+    }
+    return result;
+}
+
+std::vector<std::string> GenerateStrings(int integral_digits) {
+    std::vector<std::string> result;
+    result.reserve(kValuesCount);
+    for (const auto& value : GenerateValues(integral_digits)) result.push_back(decimal64::ToString(value));
+    return result;
+}
+
+}  // namespace
+
+void decimal64_parse(benchmark::State& state) {
+    const auto strings = GenerateStrings(state.range(0));
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(Dec4{strings[i++ % kValuesCount]});
+    }
+}
+BENCHMARK(decimal64_parse)->DenseRange(2, 14, 4);
+
+void decimal64_parse_permissive(benchmark::State& state) {
+    const auto strings = GenerateStrings(state.range(0));
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(Dec4::FromStringPermissive(strings[i++ % kValuesCount]));
+    }
+}
+BENCHMARK(decimal64_parse_permissive)->DenseRange(2, 14, 4);
+
+void decimal64_to_string(benchmark::State& state) {
+    const auto values = GenerateValues(state.range(0));
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::ToString(values[i++ % kValuesCount]));
+    }
+}
+BENCHMARK(decimal64_to_string)->DenseRange(2, 14, 4);
+
+void decimal64_to_string_trailing_zeros(benchmark::State& state) {
+    const auto values = GenerateValues(state.range(0));
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::ToStringTrailingZeros(values[i++ % kValuesCount]));
+    }
+}
+BENCHMARK(decimal64_to_string_trailing_zeros)->DenseRange(2, 14, 4);
+
+void decimal64_fmt_format_to(benchmark::State& state) {
+    const auto values = GenerateValues(state.range(0));
+    fmt::memory_buffer buffer;
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "{}", values[i++ % kValuesCount]);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(decimal64_fmt_format_to)->DenseRange(2, 14, 4);
+
+USERVER_NAMESPACE_END
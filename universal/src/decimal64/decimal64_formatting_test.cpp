@@ -1,5 +1,6 @@
 #include <userver/decimal64/decimal64.hpp>
 
+#include <limits>
 #include <sstream>
 
 #include <gtest/gtest.h>
@@ -35,6 +36,21 @@ TEST(Decimal64, ToString) {
     EXPECT_EQ(decimal64::ToString(decimal64::Decimal<0>{"1"}), "1");
 }
 
+TEST(Decimal64, ToStringDigitChunks) {
+    // Digits are formatted 8 at a time, check the chunk boundaries
+    using Dec0 = decimal64::Decimal<0>;
+    using Dec18 = decimal64::Decimal<18>;
+    EXPECT_EQ(decimal64::ToString(Dec0{"12345678"}), "12345678");
+    EXPECT_EQ(decimal64::ToString(Dec0{"123456789"}), "123456789");
+    EXPECT_EQ(decimal64::ToString(Dec0{"-10000000000000000"}), "-10000000000000000");
+    EXPECT_EQ(decimal64::ToString(Dec0::FromUnbiased(std::numeric_limits<int64_t>::max())), "9223372036854775807");
+    EXPECT_EQ(decimal64::ToString(Dec0::FromUnbiased(std::numeric_limits<int64_t>::min())), "-9223372036854775808");
+    EXPECT_EQ(decimal64::ToString(Dec18{"0.000000012345678"}), "0.000000012345678");
+    EXPECT_EQ(decimal64::ToString(Dec18{"-8.1"}), "-8.1");
+    EXPECT_EQ(decimal64::ToStringTrailingZeros(Dec18{"-0.1"}), "-0.100000000000000000");
+    EXPECT_EQ(decimal64::ToStringTrailingZeros(Dec4{"123456789.0001"}), "123456789.0001");
+}
+
 TEST(Decimal64, ToStringFormatOptions) {
     // clang-format off
   Dec4 dec4{"1034.1234"};
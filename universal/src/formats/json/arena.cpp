@@ -0,0 +1,85 @@
+#include <userver/formats/json/arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace {
+
+constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+constexpr std::size_t AlignUp(std::size_t size) noexcept { return (size + kAlignment - 1) & ~(kAlignment - 1); }
+
+}  // namespace
+
+Arena::Arena(std::size_t initial_capacity) { AddBlock(std::max(initial_capacity, kAlignment)); }
+
+Arena::~Arena() = default;
+
+void Arena::Reset() noexcept {
+    if (blocks_.size() > 1) {
+        const auto capacity = GetCapacity();
+        try {
+            Block block{std::unique_ptr<std::byte[]>(new std::byte[capacity]), capacity};
+            blocks_.clear();
+            blocks_.push_back(std::move(block));
+        } catch (const std::bad_alloc&) {
+            // Keep the existing blocks
+        }
+    }
+    current_ = 0;
+    offset_ = 0;
+    used_in_previous_ = 0;
+    last_ = nullptr;
+}
+
+std::size_t Arena::GetCapacity() const noexcept {
+    std::size_t capacity = 0;
+    for (const auto& block : blocks_) capacity += block.size;
+    return capacity;
+}
+
+std::size_t Arena::GetUsedSize() const noexcept { return used_in_previous_ + offset_; }
+
+void* Arena::Allocate(std::size_t size) {
+    size = AlignUp(size);
+    while (blocks_[current_].size - offset_ < size) {
+        used_in_previous_ += offset_;
+        offset_ = 0;
+        if (++current_ == blocks_.size()) {
+            AddBlock(size);
+        }
+    }
+
+    last_ = blocks_[current_].data.get() + offset_;
+    offset_ += size;
+    return last_;
+}
+
+bool Arena::TryResizeLast(void* ptr, std::size_t new_size) noexcept {
+    if (ptr == nullptr || ptr != last_) return false;
+
+    auto& block = blocks_[current_];
+    const auto start = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - block.data.get());
+    new_size = AlignUp(new_size);
+    if (block.size - start < new_size) return false;
+
+    offset_ = start + new_size;
+    return true;
+}
+
+void Arena::AddBlock(std::size_t min_size) {
+    const auto size = std::max(AlignUp(min_size), blocks_.empty() ? std::size_t{0} : blocks_.back().size * 2);
+    blocks_.push_back(Block{std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+    UASSERT(reinterpret_cast<std::uintptr_t>(blocks_.back().data.get()) % kAlignment == 0);
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/arena.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+formats::json::ValueBuilder FillBuilder(formats::json::Arena& arena) {
+    formats::json::ValueBuilder builder{arena, formats::common::Type::kObject};
+    builder["key"] = "a string that does not fit into the short string optimization";
+    builder["number"] = 42;
+    for (int i = 0; i < 100; ++i) {
+        builder["array"].PushBack(i);
+    }
+    builder["object"]["nested"] = formats::json::FromString(R"({"a":[1,2,3],"b":"value"})");
+    return builder;
+}
+
+constexpr std::string_view kExpectedPrefix =
+    R"({"key":"a string that does not fit into the short string optimization","number":42,"array":[0,1,2,)";
+
+}  // namespace
+
+TEST(FormatsJsonArena, Allocate) {
+    formats::json::Arena arena{64};
+    EXPECT_EQ(arena.GetCapacity(), 64);
+    EXPECT_EQ(arena.GetUsedSize(), 0);
+
+    auto* first = static_cast<std::byte*>(arena.Allocate(10));
+    auto* second = static_cast<std::byte*>(arena.Allocate(10));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(std::max_align_t), 0);
+    EXPECT_GE(second - first, 10);
+    EXPECT_GE(arena.GetUsedSize(), 20);
+
+    EXPECT_FALSE(arena.TryResizeLast(first, 20));
+    EXPECT_TRUE(arena.TryResizeLast(second, 30));
+    EXPECT_FALSE(arena.TryResizeLast(second, 1000));
+
+    arena.Allocate(1000);
+    EXPECT_GE(arena.GetCapacity(), 1064);
+
+    const auto capacity = arena.GetCapacity();
+    arena.Reset();
+    EXPECT_EQ(arena.GetUsedSize(), 0);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+
+    // All the memory is in a single block after Reset
+    auto* big = arena.Allocate(capacity);
+    EXPECT_TRUE(arena.TryResizeLast(big, capacity));
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+}
+
+TEST(FormatsJsonArena, ValueBuilder) {
+    formats::json::Arena arena{128};
+
+    for (int i = 0; i < 3; ++i) {
+        {
+            auto builder = FillBuilder(arena);
+            const auto value = builder.ExtractValue();
+            EXPECT_EQ(formats::json::ToString(value).rfind(kExpectedPrefix, 0), 0);
+            EXPECT_EQ(value["object"]["nested"]["b"].As<std::string>(), "value");
+            EXPECT_EQ(value["array"].GetSize(), 100);
+            EXPECT_GT(arena.GetUsedSize(), 0);
+        }
+        arena.Reset();
+    }
+}
+
+TEST(FormatsJsonArena, ValueBuilderClone) {
+    formats::json::Value owning;
+    std::string expected;
+    {
+        formats::json::Arena arena;
+        auto value = FillBuilder(arena).ExtractValue();
+        expected = formats::json::ToString(value);
+        owning = value.Clone();
+    }
+    EXPECT_EQ(formats::json::ToString(owning), expected);
+}
+
+TEST(FormatsJsonArena, ValueBuilderMixedAllocations) {
+    formats::json::Arena arena;
+    formats::json::ValueBuilder builder{arena};
+
+    // Heap allocated root is moved into the arena tree
+    formats::json::ValueBuilder heap_builder;
+    heap_builder["heap"] = "some long string value allocated on the heap";
+    builder["from_heap"] = std::move(heap_builder);
+    builder["from_arena"] = "some long string value allocated in the arena";
+    builder["from_arena"] = "and reassigned";
+
+    const auto value = builder.ExtractValue();
+    EXPECT_EQ(
+        formats::json::ToString(value),
+        R"({"from_heap":{"heap":"some long string value allocated on the heap"},"from_arena":"and reassigned"})"
+    );
+}
+
+TEST(FormatsJsonArena, StringBuilder) {
+    formats::json::Arena arena{32};
+
+    for (int i = 0; i < 3; ++i) {
+        {
+            formats::json::StringBuilder sb{arena};
+            {
+                const formats::json::StringBuilder::ObjectGuard guard{sb};
+                sb.Key("key");
+                WriteToStream(std::string(1000, 'a'), sb);
+            }
+            EXPECT_EQ(sb.GetString(), R"({"key":")" + std::string(1000, 'a') + R"("})");
+        }
+        arena.Reset();
+    }
+    EXPECT_GE(arena.GetCapacity(), 1000);
+}
+
+USERVER_NAMESPACE_END
@@ -72,6 +72,9 @@ using TreeStack = boost::container::small_vector<TreeIterFrame, kInitialStackDep
 std::string MakePath(const Value* root, const Value* node, int node_depth);
 /// Transform nodes onto stack into string
 std::string ExtractPath(const TreeStack& stack);
+/// Throw ParseException if some object of `root` has duplicate keys or
+/// `root` is nested too deep
+void CheckKeyUniqueness(const Value* root);
 }  // namespace formats::json::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <formats/json/impl/member_index.hpp>
+
+#include <mutex>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+const Value* MemberIndexes::FindMember(const Value& object, std::string_view key) const {
+    UASSERT(object.IsObject());
+
+    if (object.MemberCount() < kMinIndexedMembers || !enabled_.load(std::memory_order_relaxed)) {
+        const auto it = object.FindMember(Value(::rapidjson::StringRef(key.data(), key.size())));
+        return it == object.MemberEnd() ? nullptr : &it->value;
+    }
+
+    const auto& index = GetIndex(object);
+    const auto it = index.find(key);
+    return it == index.end() ? nullptr : &object.MemberBegin()[it->second].value;
+}
+
+const MemberIndexes::Index& MemberIndexes::GetIndex(const Value& object) const {
+    {
+        const std::shared_lock lock(mutex_);
+        const auto it = indexes_.find(&object);
+        if (it != indexes_.end()) return *it->second;
+    }
+
+    // Built outside of the lock, a concurrent build of the same index is rare
+    // and harmless
+    auto index = std::make_unique<Index>(object.MemberCount());
+    for (::rapidjson::SizeType i = 0; i < object.MemberCount(); ++i) {
+        const auto& name = object.MemberBegin()[i].name;
+        // emplace keeps the first of the duplicate keys, as FindMember does
+        index->emplace(std::string_view{name.GetString(), name.GetStringLength()}, i);
+    }
+
+    const std::lock_guard lock(mutex_);
+    return *indexes_.emplace(&object, std::move(index)).first->second;
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <rapidjson/document.h>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Objects with fewer members are scanned linearly: rapidjson compares the
+/// lengths of the keys first and memcmp is vectorized, so the scan is cheaper
+/// than hashing the key
+inline constexpr std::size_t kMinIndexedMembers = 32;
+
+/// Hash indexes of the big objects of a tree, each one is built on the first
+/// lookup in the object. Only used once the tree is not modified anymore.
+class MemberIndexes final {
+public:
+    MemberIndexes() = default;
+    MemberIndexes(const MemberIndexes&) = delete;
+    MemberIndexes& operator=(const MemberIndexes&) = delete;
+
+    /// Must only be called if nothing may modify the tree anymore
+    void Enable() noexcept { enabled_.store(true, std::memory_order_relaxed); }
+
+    /// @returns the first member of the `object` with the `key`, nullptr if none
+    const Value* FindMember(const Value& object, std::string_view key) const;
+
+private:
+    using Index = std::unordered_map<std::string_view, ::rapidjson::SizeType>;
+
+    const Index& GetIndex(const Value& object) const;
+
+    std::atomic<bool> enabled_{false};
+    mutable std::shared_mutex mutex_;
+    mutable std::unordered_map<const Value*, std::unique_ptr<const Index>> indexes_;
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -111,7 +111,11 @@ std::string MutableValueWrapper::GetPath() const {
     return impl_->path ? JsonPath::ToString(impl_->path) : common::kPathRoot;
 }
 
-formats::json::Value MutableValueWrapper::ExtractValue() && { return std::move(impl_->value); }
+formats::json::Value MutableValueWrapper::ExtractValue() && {
+    // No child ValueBuilder is able to modify the tree anymore
+    if (impl_->value.holder_.IsUnique()) impl_->value.holder_.EnableMemberIndexes();
+    return std::move(impl_->value);
+}
 
 void MutableValueWrapper::OnMembersChange() {
     UASSERT(impl_->value.holder_.Version() == impl_->current_version);
@@ -119,6 +123,8 @@ void MutableValueWrapper::OnMembersChange() {
     impl_->current_version = impl_->value.holder_.Version();
 }
 
+Allocator& MutableValueWrapper::GetAllocator() const { return impl_->value.holder_.GetAllocator(); }
+
 void MutableValueWrapper::EnsureCurrent() const {
     if (impl_->value.holder_.Version() == impl_->current_version) {
         return;
@@ -1,17 +1,101 @@
 #include <formats/json/impl/types_impl.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <userver/formats/json/arena.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace formats::json::impl {
 
+namespace {
+
+// Heap blocks are aligned to kHeapAlignment and arena blocks are shifted from
+// it by kArenaOffset, so that Free tells them apart without a header and heap
+// blocks have no overhead.
+constexpr std::size_t kHeapAlignment = alignof(std::max_align_t);
+constexpr std::size_t kArenaOffset = kHeapAlignment / 2;
+static_assert(kArenaOffset >= sizeof(void*), "rapidjson needs the pointer alignment");
+
+constexpr std::size_t AlignUp(std::size_t size) noexcept { return (size + kHeapAlignment - 1) & ~(kHeapAlignment - 1); }
+
+bool IsHeapAligned(void* ptr) noexcept { return reinterpret_cast<std::uintptr_t>(ptr) % kHeapAlignment == 0; }
+
+bool IsArenaBlock(void* ptr) noexcept { return reinterpret_cast<std::uintptr_t>(ptr) % kHeapAlignment == kArenaOffset; }
+
+void* ToArenaPtr(void* block) noexcept { return static_cast<std::byte*>(block) + kArenaOffset; }
+
+void* ToArenaBlock(void* ptr) noexcept { return static_cast<std::byte*>(ptr) - kArenaOffset; }
+
+// malloc is not required to align the small blocks to max_align_t, but does so
+// for the sizes that are multiples of it
+void* HeapMalloc(std::size_t size) {
+    size = AlignUp(size);
+    void* ptr = std::malloc(size);
+    if (ptr && !IsHeapAligned(ptr)) {
+        std::free(ptr);
+        ptr = std::aligned_alloc(kHeapAlignment, size);
+    }
+    if (!ptr) throw std::bad_alloc{};
+    return ptr;
+}
+
+void* HeapRealloc(void* original_ptr, std::size_t original_size, std::size_t new_size) {
+    new_size = AlignUp(new_size);
+    void* ptr = std::realloc(original_ptr, new_size);
+    if (!ptr) throw std::bad_alloc{};
+    if (!IsHeapAligned(ptr)) {
+        void* aligned_ptr = std::aligned_alloc(kHeapAlignment, new_size);
+        if (!aligned_ptr) {
+            std::free(ptr);
+            throw std::bad_alloc{};
+        }
+        std::memcpy(aligned_ptr, ptr, std::min(original_size, new_size));
+        std::free(ptr);
+        ptr = aligned_ptr;
+    }
+    return ptr;
+}
+
+}  // namespace
+
+void* Allocator::Malloc(std::size_t size) {
+    if (!size) return nullptr;
+    if (arena_) return ToArenaPtr(arena_->Allocate(size + kArenaOffset));
+    return HeapMalloc(size);
+}
+
+void* Allocator::Realloc(void* original_ptr, std::size_t original_size, std::size_t new_size) {
+    if (!original_ptr) return Malloc(new_size);
+    if (!new_size) {
+        Free(original_ptr);
+        return nullptr;
+    }
+
+    if (!IsArenaBlock(original_ptr)) return HeapRealloc(original_ptr, original_size, new_size);
+
+    if (arena_ && arena_->TryResizeLast(ToArenaBlock(original_ptr), new_size + kArenaOffset)) return original_ptr;
+    if (new_size <= original_size) return original_ptr;
+
+    void* new_ptr = Malloc(new_size);
+    std::memcpy(new_ptr, original_ptr, original_size);
+    return new_ptr;
+}
+
+void Allocator::Free(void* ptr) noexcept {
+    if (!IsArenaBlock(ptr)) std::free(ptr);
+}
+
 VersionedValuePtr::Data::Data(Document&& doc) : Data(static_cast<Value&&>(doc)) {
     static_assert(
-        // NOLINTNEXTLINE(misc-redundant-expression)
-        std::is_same_v<::rapidjson::CrtAllocator, Value::AllocatorType> &&
-            std::is_same_v<::rapidjson::CrtAllocator, Document::AllocatorType>,
-        "Both Document and Value must use CrtAllocator for the fast move"
+        std::is_same_v<Value::AllocatorType, Document::AllocatorType>,
+        "Both Document and Value must use the same allocator for the fast move"
     );
 }
 
@@ -47,6 +131,21 @@ size_t VersionedValuePtr::Version() const { return data_ ? data_->version.load()
 
 void VersionedValuePtr::BumpVersion() { ++data_->version; }
 
+void VersionedValuePtr::EnableMemberIndexes() {
+    UASSERT(data_);
+    data_->member_indexes.Enable();
+}
+
+const Value* VersionedValuePtr::FindMember(const Value& object, std::string_view key) const {
+    UASSERT(data_);
+    return data_->member_indexes.FindMember(object, key);
+}
+
+Allocator& VersionedValuePtr::GetAllocator() const {
+    UASSERT(data_);
+    return data_->allocator;
+}
+
 }  // namespace formats::json::impl
 
 USERVER_NAMESPACE_END
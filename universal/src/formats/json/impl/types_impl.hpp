@@ -4,6 +4,8 @@
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/member_index.hpp>
+
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -23,9 +25,15 @@ struct VersionedValuePtr::Data {
     // native rapidjson value
     Value native;
 
+    // allocator for the new members of the document
+    Allocator allocator;
+
     // version of internal rapidjson structures (member arrays)
     // used in ValueBuilder to avoid UAF, ignored in read-only Value
     std::atomic<size_t> version{0};
+
+    // used in read-only Value for the lookups in big objects
+    MemberIndexes member_indexes;
 };
 
 template <typename... Args>
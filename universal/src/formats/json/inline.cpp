@@ -18,9 +18,7 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json::impl {
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
-
-static_assert(std::is_empty_v<::rapidjson::CrtAllocator>, "allocator has no state");
+Allocator g_allocator;
 
 impl::Value WrapStringView(std::string_view key) {
     // GenericValue ctor has an invalid type for size
@@ -0,0 +1,280 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+#include <fmt/format.h>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace {
+
+// All the functions below operate on a document already validated by the
+// rapidjson::Reader, so no bounds or syntax checks are required besides the
+// end of the text.
+
+bool IsWhitespace(char c) noexcept { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+std::size_t SkipWhitespace(std::string_view text, std::size_t pos) noexcept {
+    while (pos < text.size() && IsWhitespace(text[pos])) ++pos;
+    return pos;
+}
+
+// `pos` points to the opening quote, returns the position after the closing one
+std::size_t SkipString(std::string_view text, std::size_t pos) noexcept {
+    UASSERT(text[pos] == '"');
+    for (++pos; pos < text.size(); ++pos) {
+        if (text[pos] == '\\') {
+            ++pos;
+        } else if (text[pos] == '"') {
+            return pos + 1;
+        }
+    }
+    return text.size();
+}
+
+// `pos` points to the first character of a value, returns the position after
+// its last character
+std::size_t SkipValue(std::string_view text, std::size_t pos) noexcept {
+    switch (text[pos]) {
+        case '"':
+            return SkipString(text, pos);
+        case '{':
+        case '[': {
+            std::size_t depth = 0;
+            while (pos < text.size()) {
+                const char c = text[pos];
+                if (c == '"') {
+                    pos = SkipString(text, pos);
+                    continue;
+                }
+                if (c == '{' || c == '[') {
+                    ++depth;
+                } else if (c == '}' || c == ']') {
+                    if (--depth == 0) return pos + 1;
+                }
+                ++pos;
+            }
+            return text.size();
+        }
+        default:
+            while (pos < text.size() && !IsWhitespace(text[pos]) && text[pos] != ',' && text[pos] != ']' &&
+                   text[pos] != '}') {
+                ++pos;
+            }
+            return pos;
+    }
+}
+
+int GetType(std::string_view raw) noexcept {
+    UASSERT(!raw.empty());
+    switch (raw.front()) {
+        case 'n':
+            return impl::nullValue;
+        case 't':
+        case 'f':
+            return impl::booleanValue;
+        case '"':
+            return impl::stringValue;
+        case '[':
+            return impl::arrayValue;
+        case '{':
+            return impl::objectValue;
+        default:
+            return raw.find_first_of(".eE") == std::string_view::npos ? impl::intValue : impl::realValue;
+    }
+}
+
+std::string UnescapeKey(std::string_view quoted_key) {
+    UASSERT(quoted_key.size() >= 2);
+    const auto key = quoted_key.substr(1, quoted_key.size() - 2);
+    if (key.find('\\') == std::string_view::npos) return std::string{key};
+    return FromString(quoted_key).As<std::string>();
+}
+
+// Calls `func(key_raw, value_raw)` for each member, stops if it returns false
+template <typename Func>
+void VisitMembers(std::string_view text, Func&& func) {
+    UASSERT(text.front() == '{');
+    auto pos = SkipWhitespace(text, 1);
+    while (pos < text.size() && text[pos] != '}') {
+        const auto key_end = SkipString(text, pos);
+        const auto key = text.substr(pos, key_end - pos);
+
+        pos = SkipWhitespace(text, key_end);
+        UASSERT(text[pos] == ':');
+        pos = SkipWhitespace(text, pos + 1);
+
+        const auto value_end = SkipValue(text, pos);
+        if (!func(key, text.substr(pos, value_end - pos))) return;
+
+        pos = SkipWhitespace(text, value_end);
+        if (pos < text.size() && text[pos] == ',') pos = SkipWhitespace(text, pos + 1);
+    }
+}
+
+// Calls `func(value_raw)` for each element, stops if it returns false
+template <typename Func>
+void VisitElements(std::string_view text, Func&& func) {
+    UASSERT(text.front() == '[');
+    auto pos = SkipWhitespace(text, 1);
+    while (pos < text.size() && text[pos] != ']') {
+        const auto value_end = SkipValue(text, pos);
+        if (!func(text.substr(pos, value_end - pos))) return;
+
+        pos = SkipWhitespace(text, value_end);
+        if (pos < text.size() && text[pos] == ',') pos = SkipWhitespace(text, pos + 1);
+    }
+}
+
+bool KeyEquals(std::string_view quoted_key, std::string_view key) {
+    const auto raw_key = quoted_key.substr(1, quoted_key.size() - 2);
+    if (raw_key.find('\\') == std::string_view::npos) return raw_key == key;
+    return UnescapeKey(quoted_key) == key;
+}
+
+}  // namespace
+
+LazyValue::LazyValue(std::string_view doc) {
+    if (doc.empty()) {
+        throw ParseException("JSON document is empty");
+    }
+
+    ::rapidjson::Reader reader;
+    ::rapidjson::MemoryStream stream{doc.data(), doc.size()};
+    ::rapidjson::BaseReaderHandler<> handler;
+    const auto ok = reader.Parse<::rapidjson::kParseDefaultFlags | ::rapidjson::kParseIterativeFlag>(stream, handler);
+    if (!ok) {
+        throw ParseException(
+            fmt::format("JSON parse error at offset {}: {}", ok.Offset(), ::rapidjson::GetParseError_En(ok.Code()))
+        );
+    }
+
+    const auto begin = SkipWhitespace(doc, 0);
+    raw_ = doc.substr(begin, SkipValue(doc, begin) - begin);
+}
+
+LazyValue::LazyValue(Unchecked, std::string_view raw, std::string path) noexcept
+    : raw_(raw), path_(std::move(path)) {}
+
+LazyValue LazyValue::MakeMissing(std::string path) noexcept { return LazyValue{Unchecked{}, {}, std::move(path)}; }
+
+LazyValue LazyValue::operator[](std::string_view key) const {
+    auto child_path = common::MakeChildPath(path_, key);
+    if (IsMissing()) return MakeMissing(std::move(child_path));
+    CheckType(impl::objectValue);
+
+    std::string_view result;
+    VisitMembers(raw_, [&](std::string_view member_key, std::string_view value) {
+        if (!KeyEquals(member_key, key)) return true;
+        result = value;
+        return false;
+    });
+
+    if (result.data() == nullptr) return MakeMissing(std::move(child_path));
+    return LazyValue{Unchecked{}, result, std::move(child_path)};
+}
+
+LazyValue LazyValue::operator[](std::size_t index) const {
+    CheckType(impl::arrayValue);
+
+    std::size_t current = 0;
+    std::string_view result;
+    VisitElements(raw_, [&](std::string_view value) {
+        if (current++ != index) return true;
+        result = value;
+        return false;
+    });
+
+    if (result.data() == nullptr) throw OutOfBoundsException(index, GetSize(), GetPath());
+    return LazyValue{Unchecked{}, result, common::MakeChildPath(path_, index)};
+}
+
+std::size_t LazyValue::GetSize() const {
+    CheckNotMissing();
+    std::size_t size = 0;
+    if (IsObject()) {
+        VisitMembers(raw_, [&size](std::string_view, std::string_view) {
+            ++size;
+            return true;
+        });
+    } else {
+        CheckType(impl::arrayValue);
+        VisitElements(raw_, [&size](std::string_view) {
+            ++size;
+            return true;
+        });
+    }
+    return size;
+}
+
+void LazyValue::ForEachElement(utils::function_ref<void(const LazyValue&)> func) const {
+    CheckType(impl::arrayValue);
+    std::size_t index = 0;
+    VisitElements(raw_, [&](std::string_view value) {
+        func(LazyValue{Unchecked{}, value, common::MakeChildPath(path_, index++)});
+        return true;
+    });
+}
+
+void LazyValue::ForEachMember(utils::function_ref<void(std::string_view key, const LazyValue&)> func) const {
+    CheckType(impl::objectValue);
+    VisitMembers(raw_, [&](std::string_view quoted_key, std::string_view value) {
+        const auto key = UnescapeKey(quoted_key);
+        func(key, LazyValue{Unchecked{}, value, common::MakeChildPath(path_, key)});
+        return true;
+    });
+}
+
+bool LazyValue::HasMember(std::string_view key) const { return !(*this)[key].IsMissing(); }
+
+bool LazyValue::IsNull() const noexcept { return !IsMissing() && GetType(raw_) == impl::nullValue; }
+
+bool LazyValue::IsBool() const noexcept { return !IsMissing() && GetType(raw_) == impl::booleanValue; }
+
+bool LazyValue::IsNumber() const noexcept {
+    if (IsMissing()) return false;
+    const auto type = GetType(raw_);
+    return type == impl::intValue || type == impl::realValue;
+}
+
+bool LazyValue::IsString() const noexcept { return !IsMissing() && GetType(raw_) == impl::stringValue; }
+
+bool LazyValue::IsArray() const noexcept { return !IsMissing() && GetType(raw_) == impl::arrayValue; }
+
+bool LazyValue::IsObject() const noexcept { return !IsMissing() && GetType(raw_) == impl::objectValue; }
+
+void LazyValue::CheckNotMissing() const {
+    if (IsMissing()) {
+        throw MemberMissingException(GetPath());
+    }
+}
+
+std::string_view LazyValue::GetRawJson() const {
+    CheckNotMissing();
+    return raw_;
+}
+
+Value LazyValue::ToValue() const {
+    CheckNotMissing();
+    return FromString(raw_);
+}
+
+void LazyValue::CheckType(int expected_type) const {
+    CheckNotMissing();
+    const auto actual_type = GetType(raw_);
+    if (actual_type != expected_type) {
+        throw TypeMismatchException(actual_type, expected_type, GetPath());
+    }
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,126 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kDoc = R"({
+    "skipped": {"nested": [1, 2, {"deep": "x"}], "str": "with } and ] and \"quotes\""},
+    "int": 42,
+    "double": -1.5e3,
+    "bool": true,
+    "null": null,
+    "str": "a\nb",
+    "escaped": "key",
+    "array": [1, "two", [3], {"four": 4}],
+    "empty_array": [ ],
+    "empty_object": { }
+})";
+
+struct Selected final {
+    int int_field{};
+    std::string str_field;
+};
+
+Selected Parse(const formats::json::LazyValue& value, formats::parse::To<Selected>) {
+    return {value["int"].As<int>(), value["str"].As<std::string>()};
+}
+
+}  // namespace
+
+TEST(FormatsJsonLazyValue, Members) {
+    const formats::json::LazyValue json{kDoc};
+
+    EXPECT_TRUE(json.IsObject());
+    EXPECT_EQ(json.GetSize(), 10);
+    EXPECT_EQ(json["int"].As<int>(), 42);
+    EXPECT_DOUBLE_EQ(json["double"].As<double>(), -1500.0);
+    EXPECT_TRUE(json["bool"].As<bool>());
+    EXPECT_TRUE(json["null"].IsNull());
+    EXPECT_EQ(json["str"].As<std::string>(), "a\nb");
+    EXPECT_EQ(json["escaped"].As<std::string>(), "key");
+    EXPECT_EQ(json["skipped"]["nested"][2]["deep"].As<std::string>(), "x");
+    EXPECT_EQ(json["skipped"]["str"].As<std::string>(), "with } and ] and \"quotes\"");
+
+    EXPECT_TRUE(json.HasMember("int"));
+    EXPECT_FALSE(json.HasMember("missing"));
+    EXPECT_TRUE(json["missing"]["deeper"].IsMissing());
+    EXPECT_EQ(json["missing"].As<int>(7), 7);
+    EXPECT_EQ(json["null"].As<int>(8), 8);
+
+    EXPECT_EQ(json["skipped"]["nested"].GetRawJson(), R"([1, 2, {"deep": "x"}])");
+}
+
+TEST(FormatsJsonLazyValue, Arrays) {
+    const formats::json::LazyValue json{kDoc};
+    const auto array = json["array"];
+
+    EXPECT_TRUE(array.IsArray());
+    EXPECT_EQ(array.GetSize(), 4);
+    EXPECT_EQ(array[1].As<std::string>(), "two");
+    EXPECT_EQ(array[3]["four"].As<int>(), 4);
+    EXPECT_EQ(array.As<std::vector<formats::json::Value>>().size(), 4);
+
+    std::vector<std::string> raw_elements;
+    array.ForEachElement([&](const formats::json::LazyValue& element) {
+        raw_elements.emplace_back(element.GetRawJson());
+    });
+    EXPECT_EQ(raw_elements, (std::vector<std::string>{"1", R"("two")", "[3]", R"({"four": 4})"}));
+
+    EXPECT_EQ(json["empty_array"].GetSize(), 0);
+    EXPECT_EQ(json["empty_object"].GetSize(), 0);
+}
+
+TEST(FormatsJsonLazyValue, ForEachMember) {
+    const formats::json::LazyValue json{R"({"a": 1, "b\"c": [2]})"};
+
+    std::vector<std::string> keys;
+    json.ForEachMember([&](std::string_view key, const formats::json::LazyValue& value) {
+        keys.emplace_back(key);
+        EXPECT_EQ(value.GetPath(), std::string{key});
+    });
+    EXPECT_EQ(keys, (std::vector<std::string>{"a", "b\"c"}));
+}
+
+TEST(FormatsJsonLazyValue, Parse) {
+    const formats::json::LazyValue json{kDoc};
+
+    const auto selected = json.As<Selected>();
+    EXPECT_EQ(selected.int_field, 42);
+    EXPECT_EQ(selected.str_field, "a\nb");
+
+    EXPECT_EQ(json["skipped"].ToValue(), formats::json::FromString(json["skipped"].GetRawJson()));
+}
+
+TEST(FormatsJsonLazyValue, Errors) {
+    EXPECT_THROW(formats::json::LazyValue{""}, formats::json::ParseException);
+    EXPECT_THROW(formats::json::LazyValue{R"({"a": )"}, formats::json::ParseException);
+    EXPECT_THROW(formats::json::LazyValue{R"({"a": 1} 2)"}, formats::json::ParseException);
+
+    const formats::json::LazyValue json{kDoc};
+    EXPECT_THROW(json["int"]["x"], formats::json::TypeMismatchException);
+    EXPECT_THROW(json[0], formats::json::TypeMismatchException);
+    EXPECT_THROW(json["array"][4], formats::json::OutOfBoundsException);
+    EXPECT_THROW(json["missing"].As<int>(), formats::json::MemberMissingException);
+    EXPECT_THROW(json["str"].As<int>(), formats::json::TypeMismatchException);
+
+    try {
+        json["skipped"]["missing"].CheckNotMissing();
+        FAIL();
+    } catch (const formats::json::MemberMissingException& e) {
+        EXPECT_EQ(e.GetPath(), "skipped.missing");
+    }
+}
+
+TEST(FormatsJsonLazyValue, Scalars) {
+    EXPECT_EQ(formats::json::LazyValue{" 12 "}.As<int>(), 12);
+    EXPECT_EQ(formats::json::LazyValue{R"("s")"}.As<std::string>(), "s");
+    EXPECT_TRUE(formats::json::LazyValue{"null"}.IsNull());
+}
+
+USERVER_NAMESPACE_END
@@ -1,4 +1,6 @@
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -184,4 +186,50 @@ void json_object_wide_object_operator_equals(benchmark::State& state) {
 }
 BENCHMARK(json_object_wide_object_operator_equals)->DenseRange(4, 16, 4)->Range(32, 8192)->RangeMultiplier(2);
 
+// Read every member of a parsed object with `state.range(0)` members, the
+// last members are the most expensive ones to find with a linear search
+void json_wide_object_member_access(benchmark::State& state) {
+    const std::size_t size = state.range(0);
+
+    formats::json::ValueBuilder builder{formats::json::Type::kObject};
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < size; ++i) {
+        keys.push_back("some_field_name_" + std::to_string(i));
+        builder[keys.back()] = i;
+    }
+    const auto json = formats::json::FromString(formats::json::ToString(builder.ExtractValue()));
+
+    for ([[maybe_unused]] auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto& key : keys) sum += json[key].As<std::size_t>();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+BENCHMARK(json_wide_object_member_access)->RangeMultiplier(2)->Range(4, 512);
+
+// Parse a request body of approximately `state.range(0)` bytes and read a
+// field of every element, as a typical handler does
+void json_parse_and_access_members(benchmark::State& state) {
+    const std::size_t target_size = state.range(0);
+
+    std::string body = "[";
+    for (std::size_t i = 0; body.size() < target_size; ++i) {
+        if (i != 0) body += ",\n  ";
+        body += R"({"id": )" + std::to_string(i) + R"(, "name": "some name", "values": [1, 2, 3], "ok": true})";
+    }
+    body += "]";
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto json = formats::json::FromString(body);
+        std::int64_t sum = 0;
+        for (const auto& item : json) {
+            sum += item["id"].As<std::int64_t>();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * body.size()));
+}
+BENCHMARK(json_parse_and_access_members)->RangeMultiplier(32)->Range(1 << 10, 10 << 20);
+
 USERVER_NAMESPACE_END
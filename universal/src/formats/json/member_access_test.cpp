@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <sstream>
+#include <string>
 
+#include <fmt/format.h>
+
+#include <userver/formats/common/items.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/inline.hpp>
 #include <userver/formats/json/serialize.hpp>
@@ -119,4 +123,61 @@ TEST_F(FormatsJsonSpecificMemberAccess, OutOfBoundsExceptionAccessToAttributes)
     }
 }
 
+TEST(FormatsJsonBigObject, MemberLookup) {
+    constexpr int kMembers = 300;
+    std::string doc = "{";
+    for (int i = 0; i < kMembers; ++i) {
+        if (i != 0) doc += ',';
+        doc += fmt::format(R"("key{}": {})", i, i);
+    }
+    doc += '}';
+
+    for (const auto& json : {formats::json::FromString(doc), formats::json::FromString(doc).Clone()}) {
+        for (int i = 0; i < kMembers; ++i) {
+            const auto key = "key" + std::to_string(i);
+            ASSERT_TRUE(json.HasMember(key));
+            EXPECT_EQ(json[key].As<int>(), i);
+            EXPECT_EQ(json[key].GetPath(), key);
+        }
+        EXPECT_FALSE(json.HasMember("key"));
+        EXPECT_TRUE(json["key"].IsMissing());
+        EXPECT_TRUE(json["key300"].IsMissing());
+
+        // Iteration order is kept
+        int expected = 0;
+        for (const auto& [name, value] : formats::common::Items(json)) {
+            EXPECT_EQ(name, "key" + std::to_string(expected));
+            EXPECT_EQ(value.As<int>(), expected);
+            ++expected;
+        }
+        EXPECT_EQ(expected, kMembers);
+    }
+}
+
+TEST(FormatsJsonBigObject, DuplicateKeys) {
+    formats::json::ValueBuilder builder{formats::json::Type::kObject};
+    for (int i = 0; i < 100; ++i) builder.EmplaceNocheck("key" + std::to_string(i), i);
+    builder.EmplaceNocheck("key42", -1);
+    const auto json = builder.ExtractValue();
+
+    // The first one is found, as with the linear search
+    EXPECT_EQ(json["key42"].As<int>(), 42);
+    EXPECT_EQ(json.GetSize(), 101u);
+}
+
+TEST(FormatsJsonBigObject, ModifiedByBuilder) {
+    formats::json::ValueBuilder builder{formats::json::Type::kObject};
+    for (int i = 0; i < 100; ++i) builder["key" + std::to_string(i)] = i;
+
+    EXPECT_TRUE(builder.HasMember("key10"));
+    builder.Remove("key10");
+    EXPECT_FALSE(builder.HasMember("key10"));
+    builder["key10"] = -10;
+    EXPECT_TRUE(builder.HasMember("key99"));
+
+    const auto json = builder.ExtractValue();
+    EXPECT_EQ(json["key10"].As<int>(), -10);
+    EXPECT_EQ(json["key11"].As<int>(), 11);
+}
+
 USERVER_NAMESPACE_END
@@ -10,7 +10,7 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json::parser {
 
 namespace {
-::rapidjson::CrtAllocator g_allocator;
+json::impl::Allocator g_allocator;
 }  // namespace
 
 struct JsonValueParser::Impl {
@@ -96,7 +96,9 @@ void JsonValueParser::MaybePopSelf() {
         auto generator = [](const auto&) { return true; };
         impl_->raw_value_.Populate(generator);
 
-        this->SetResult(Value{json::impl::VersionedValuePtr::Create(std::move(impl_->raw_value_))});
+        auto holder = json::impl::VersionedValuePtr::Create(std::move(impl_->raw_value_));
+        holder.EnableMemberIndexes();
+        this->SetResult(Value{std::move(holder)});
     }
 }
 
@@ -23,12 +23,12 @@ std::string ToStdString(const impl::Value& value) {
 
 namespace impl {
 
-using SchemaDocument = rapidjson::GenericSchemaDocument<impl::Value, rapidjson::CrtAllocator>;
+using SchemaDocument = rapidjson::GenericSchemaDocument<impl::Value, impl::Allocator>;
 
 using SchemaValidator = rapidjson::GenericSchemaValidator<
     impl::SchemaDocument,
     rapidjson::BaseReaderHandler<impl::UTF8, void>,
-    rapidjson::CrtAllocator>;
+    impl::Allocator>;
 
 }  // namespace impl
 
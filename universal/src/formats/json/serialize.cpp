@@ -29,70 +29,14 @@ namespace formats::json {
 
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
-
-std::string_view AsStringView(const impl::Value& jval) { return {jval.GetString(), jval.GetStringLength()}; }
-
-void CheckKeyUniqueness(const impl::Value* root) {
-    using KeysStack = boost::container::small_vector<std::string_view, impl::kInitialStackDepth>;
-
-    impl::TreeStack stack;
-    const impl::Value* value = root;
-
-    stack.emplace_back();  // fake "top" frame to avoid extra checks for an empty
-                           // stack inside walker loop
-    KeysStack keys;
-    std::size_t depth = 0;
-    for (;;) {
-        stack.back().Advance();
-        if (value->IsObject()) {
-            const std::size_t count = value->MemberCount();
-            const auto begin = value->MemberBegin();
-            if (count > keys.size()) {
-                keys.resize(count);
-            }
-            for (std::size_t i = 0; i < count; ++i) {
-                keys[i] = AsStringView(begin[i].name);
-            }
-            std::sort(keys.begin(), keys.begin() + count, [](const auto& lhs, const auto& rhs) {
-                const auto lhs_size = lhs.size();
-                const auto rhs_size = rhs.size();
-                // We don't need a complete lexicographical order here,
-                // and we believe that this comparison is faster in general.
-                // Think of it as of a clustering by size.
-                return std::tie(lhs_size, lhs) < std::tie(rhs_size, rhs);
-            });
-            const auto* cons_eq_element = std::adjacent_find(keys.data(), keys.data() + count);
-            if (cons_eq_element != keys.data() + count) {
-                throw ParseException(
-                    "Duplicate key: " + std::string(*cons_eq_element) + " at " + impl::ExtractPath(stack)
-                );
-            }
-        }
-
-        if ((value->IsObject() && value->MemberCount() > 0) || (value->IsArray() && value->Size() > 0)) {
-            depth++;
-            if (depth >= kDepthParseLimit) {
-                throw ParseException("Exceeded maximum allowed JSON depth of: " + std::to_string(kDepthParseLimit));
-            }
-            // descend
-            stack.emplace_back(value);
-        } else {
-            while (!stack.back().HasMoreElements()) {
-                depth--;
-                stack.pop_back();
-                if (stack.empty()) return;
-            }
-        }
-
-        value = stack.back().CurrentValue();
-    }
-}
+impl::Allocator g_allocator;
 
 impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
-    CheckKeyUniqueness(&json);
+    impl::CheckKeyUniqueness(&json);
 
-    return impl::VersionedValuePtr::Create(std::move(json));
+    auto holder = impl::VersionedValuePtr::Create(std::move(json));
+    holder.EnableMemberIndexes();
+    return holder;
 }
 
 }  // namespace
@@ -1186,6 +1186,49 @@ BENCHMARK(DeepWidthJson);
 
 namespace {
 
+// Array of typical API objects, serialized either compactly or pretty-printed,
+// of approximately `target_size` bytes
+std::string MakeRealisticJson(std::size_t target_size, bool pretty) {
+    formats::json::ValueBuilder items{formats::common::Type::kArray};
+    std::size_t size = 0;
+    for (std::size_t i = 0; size < target_size; ++i) {
+        formats::json::ValueBuilder item;
+        item["id"] = i;
+        item["name"] = "item name number " + std::to_string(i);
+        item["description"] = "A somewhat longer text field with spaces, \"escapes\" and unicode: \u00e9";
+        item["price"] = 1234.5678 + i;
+        item["in_stock"] = i % 2 == 0;
+        item["tags"] = std::vector<std::string>{"first", "second", "third"};
+        item["dimensions"]["width"] = 10;
+        item["dimensions"]["height"] = 20.5;
+
+        auto item_value = item.ExtractValue();
+        size += formats::json::ToString(item_value).size();
+        items.PushBack(std::move(item_value));
+    }
+
+    const auto json = items.ExtractValue();
+    return pretty ? formats::json::ToPrettyString(json) : formats::json::ToString(json);
+}
+
+}  // namespace
+
+// Realistic payloads from 1 KB to 10 MB, shows parsing throughput
+void ParseRealisticJson(benchmark::State& state) {
+    const auto json_string = MakeRealisticJson(state.range(0), state.range(1));
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto json = formats::json::FromString(json_string);
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * json_string.size()));
+}
+BENCHMARK(ParseRealisticJson)
+    ->ArgNames({"size", "pretty"})
+    ->ArgsProduct({{1 << 10, 32 << 10, 1 << 20, 10 << 20}, {0, 1}});
+
+namespace {
+
 struct InnerObject final {
     std::variant<int, bool, std::vector<std::string>, std::string> value;
 };
@@ -19,14 +19,20 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json {
 
 struct StringBuilder::Impl {
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+    using Buffer = rapidjson::GenericStringBuffer<impl::UTF8, impl::Allocator>;
+
+    impl::Allocator allocator;
+    Buffer buffer{&allocator};
+    rapidjson::Writer<Buffer> writer{buffer};
 
     Impl() = default;
+    explicit Impl(Arena& arena) : allocator(arena) {}
 };
 
 StringBuilder::StringBuilder() = default;
 
+StringBuilder::StringBuilder(Arena& arena) : impl_(arena) {}
+
 StringBuilder::~StringBuilder() = default;
 
 std::string_view StringBuilder::GetStringView() const {
@@ -40,7 +40,7 @@ static_assert(
     "userver support chat"
 );
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
 template <typename T>
 auto CheckedNotTooNegative(T x, const Value& value) {
@@ -132,9 +132,9 @@ Value Value::operator[](std::string_view key) const {
     if (!IsMissing()) {
         CheckObjectOrNull();
         if (IsObject()) {
-            auto it = GetNative().FindMember(impl::Value(::rapidjson::StringRef(key.data(), key.size())));
-            if (it != GetNative().MemberEnd()) {
-                return {EmplaceEnabler{}, holder_, root_ptr_for_path_, &it->value, depth_ + 1};
+            const auto* member = holder_.FindMember(GetNative(), key);
+            if (member) {
+                return {EmplaceEnabler{}, holder_, root_ptr_for_path_, member, depth_ + 1};
             }
         }
 
@@ -351,7 +351,7 @@ std::string Value::ConvertTo<std::string>() const {
 bool Value::HasMember(std::string_view key) const {
     if (IsMissing()) return false;
     CheckObjectOrNull();
-    return IsObject() && GetNative().HasMember(impl::Value(::rapidjson::StringRef(key.data(), key.size())));
+    return IsObject() && holder_.FindMember(GetNative(), key) != nullptr;
 }
 
 std::string Value::GetPath() const {
@@ -367,7 +367,11 @@ void Value::DropRootPath() {
     depth_ = 0;
 }
 
-Value Value::Clone() const { return Value{impl::VersionedValuePtr::Create(GetNative(), g_allocator)}; }
+Value Value::Clone() const {
+    auto holder = impl::VersionedValuePtr::Create(GetNative(), g_allocator);
+    holder.EnableMemberIndexes();
+    return Value{std::move(holder)};
+}
 
 void Value::EnsureNotMissing() const {
     // We should never get here if the value is missing, in the first place.
@@ -32,16 +32,23 @@ rapidjson::Type ToNativeType(Type type) {
     }
 }
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
 }  // namespace
 
 ValueBuilder::ValueBuilder(Type type) : value_(impl::VersionedValuePtr::Create(ToNativeType(type))) {}
 
+ValueBuilder::ValueBuilder(Arena& arena, Type type) : ValueBuilder(type) {
+    value_.GetAllocator() = impl::Allocator{arena};
+}
+
 ValueBuilder::ValueBuilder(const ValueBuilder& other) { Copy(value_->GetNative(), other); }
 
 // NOLINTNEXTLINE(performance-noexcept-move-constructor)
-ValueBuilder::ValueBuilder(ValueBuilder&& other) { Move(value_->GetNative(), std::move(other)); }
+ValueBuilder::ValueBuilder(ValueBuilder&& other) {
+    if (other.value_->IsRoot()) value_.GetAllocator() = other.value_.GetAllocator();
+    Move(value_->GetNative(), std::move(other));
+}
 
 ValueBuilder::ValueBuilder(bool t) : value_(impl::VersionedValuePtr::Create(t)) {}
 
@@ -178,7 +185,7 @@ void ValueBuilder::Resize(std::size_t size) {
     const auto old_capacity = native.Capacity();
 
     if (size > old_capacity) {
-        native.Reserve(size, g_allocator);
+        native.Reserve(size, value_.GetAllocator());
         if (old_capacity) {
             value_.OnMembersChange();
         }
@@ -187,7 +194,7 @@ void ValueBuilder::Resize(std::size_t size) {
         native.PopBack();
     }
     for (size_t curr_size = native.Size(); curr_size < size; ++curr_size) {
-        native.PushBack(impl::Value{}, g_allocator);
+        native.PushBack(impl::Value{}, value_.GetAllocator());
     }
 }
 
@@ -201,7 +208,7 @@ void ValueBuilder::PushBack(ValueBuilder&& bld) {
     // notify wrapper when elements capacity (and thus location) changes
     const auto checked_push_back = [this, &native](auto&& value) {
         const auto old_capacity = native.Capacity();
-        native.PushBack(value, g_allocator);
+        native.PushBack(value, value_.GetAllocator());
         if (old_capacity && old_capacity != native.Capacity()) {
             value_.OnMembersChange();
         }
@@ -225,7 +232,7 @@ formats::json::Value ValueBuilder::ExtractValue() {
 }
 
 void ValueBuilder::Copy(impl::Value& to, const ValueBuilder& from) {
-    to.CopyFrom(from.value_->GetNative(), g_allocator);
+    to.CopyFrom(from.value_->GetNative(), value_.GetAllocator());
 }
 
 void ValueBuilder::Move(impl::Value& to, ValueBuilder&& from) {
@@ -251,7 +258,7 @@ impl::Value& ValueBuilder::AddMember(std::string_view key, CheckMemberExists che
 
     // notify wrapper when members capacity (and thus location) changes
     const auto old_capacity = native.MemberCapacity();
-    native.AddMember(impl::Value(key.data(), key.size(), g_allocator), impl::Value{}, g_allocator);
+    native.AddMember(impl::Value(key.data(), key.size(), value_.GetAllocator()), impl::Value{}, value_.GetAllocator());
     if (old_capacity && old_capacity != native.MemberCapacity()) {
         value_.OnMembersChange();
     }
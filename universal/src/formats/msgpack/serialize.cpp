@@ -0,0 +1,428 @@
+#include <userver/formats/msgpack/serialize.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <boost/container/small_vector.hpp>
+
+#include <formats/json/impl/json_tree.hpp>
+#include <formats/json/impl/types_impl.hpp>
+#include <userver/formats/json/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+namespace {
+
+using formats::json::ParseException;
+namespace impl = formats::json::impl;
+
+impl::Allocator g_allocator;
+
+// https://github.com/msgpack/msgpack/blob/master/spec.md#formats
+enum Marker : std::uint8_t {
+    kPositiveFixintMax = 0x7f,
+    kFixmap = 0x80,
+    kFixarray = 0x90,
+    kFixstr = 0xa0,
+    kNil = 0xc0,
+    kFalse = 0xc2,
+    kTrue = 0xc3,
+    kBin8 = 0xc4,
+    kBin16 = 0xc5,
+    kBin32 = 0xc6,
+    kFloat32 = 0xca,
+    kFloat64 = 0xcb,
+    kUint8 = 0xcc,
+    kUint16 = 0xcd,
+    kUint32 = 0xce,
+    kUint64 = 0xcf,
+    kInt8 = 0xd0,
+    kInt16 = 0xd1,
+    kInt32 = 0xd2,
+    kInt64 = 0xd3,
+    kStr8 = 0xd9,
+    kStr16 = 0xda,
+    kStr32 = 0xdb,
+    kArray16 = 0xdc,
+    kArray32 = 0xdd,
+    kMap16 = 0xde,
+    kMap32 = 0xdf,
+    kNegativeFixintMin = 0xe0,
+};
+
+constexpr std::size_t kFixmapMaxSize = 0x0f;
+constexpr std::size_t kFixarrayMaxSize = 0x0f;
+constexpr std::size_t kFixstrMaxSize = 0x1f;
+
+template <typename T>
+void WriteBigEndian(std::string& out, T value) {
+    static_assert(std::is_unsigned_v<T>);
+    char buffer[sizeof(T)];
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        buffer[i] = static_cast<char>(value >> (8 * (sizeof(T) - 1 - i)));
+    }
+    out.append(buffer, sizeof(T));
+}
+
+void WriteMarker(std::string& out, std::uint8_t marker) { out.push_back(static_cast<char>(marker)); }
+
+void WriteSize(std::string& out, std::size_t size, std::uint8_t marker16, std::uint8_t marker32) {
+    if (size <= std::numeric_limits<std::uint16_t>::max()) {
+        WriteMarker(out, marker16);
+        WriteBigEndian(out, static_cast<std::uint16_t>(size));
+    } else {
+        WriteMarker(out, marker32);
+        WriteBigEndian(out, static_cast<std::uint32_t>(size));
+    }
+}
+
+void WriteUint(std::string& out, std::uint64_t value) {
+    if (value <= kPositiveFixintMax) {
+        WriteMarker(out, static_cast<std::uint8_t>(value));
+    } else if (value <= std::numeric_limits<std::uint8_t>::max()) {
+        WriteMarker(out, kUint8);
+        WriteBigEndian(out, static_cast<std::uint8_t>(value));
+    } else if (value <= std::numeric_limits<std::uint16_t>::max()) {
+        WriteMarker(out, kUint16);
+        WriteBigEndian(out, static_cast<std::uint16_t>(value));
+    } else if (value <= std::numeric_limits<std::uint32_t>::max()) {
+        WriteMarker(out, kUint32);
+        WriteBigEndian(out, static_cast<std::uint32_t>(value));
+    } else {
+        WriteMarker(out, kUint64);
+        WriteBigEndian(out, value);
+    }
+}
+
+void WriteInt(std::string& out, std::int64_t value) {
+    if (value >= 0) {
+        WriteUint(out, static_cast<std::uint64_t>(value));
+    } else if (value >= -32) {
+        WriteMarker(out, static_cast<std::uint8_t>(value));
+    } else if (value >= std::numeric_limits<std::int8_t>::min()) {
+        WriteMarker(out, kInt8);
+        WriteBigEndian(out, static_cast<std::uint8_t>(value));
+    } else if (value >= std::numeric_limits<std::int16_t>::min()) {
+        WriteMarker(out, kInt16);
+        WriteBigEndian(out, static_cast<std::uint16_t>(value));
+    } else if (value >= std::numeric_limits<std::int32_t>::min()) {
+        WriteMarker(out, kInt32);
+        WriteBigEndian(out, static_cast<std::uint32_t>(value));
+    } else {
+        WriteMarker(out, kInt64);
+        WriteBigEndian(out, static_cast<std::uint64_t>(value));
+    }
+}
+
+void WriteDouble(std::string& out, double value) {
+    std::uint64_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value));
+    std::memcpy(&bits, &value, sizeof(value));
+    WriteMarker(out, kFloat64);
+    WriteBigEndian(out, bits);
+}
+
+void WriteString(std::string& out, const impl::Value& value) {
+    const std::size_t size = value.GetStringLength();
+    if (size <= kFixstrMaxSize) {
+        WriteMarker(out, kFixstr | static_cast<std::uint8_t>(size));
+    } else if (size <= std::numeric_limits<std::uint8_t>::max()) {
+        WriteMarker(out, kStr8);
+        WriteBigEndian(out, static_cast<std::uint8_t>(size));
+    } else {
+        WriteSize(out, size, kStr16, kStr32);
+    }
+    out.append(value.GetString(), size);
+}
+
+// Writes the value or the header of the container, non-empty containers
+// are pushed to the stack to write their elements
+void WriteValue(std::string& out, const impl::Value& value, impl::TreeStack& stack) {
+    if (value.IsObject()) {
+        const std::size_t size = value.MemberCount();
+        if (size <= kFixmapMaxSize) {
+            WriteMarker(out, kFixmap | static_cast<std::uint8_t>(size));
+        } else {
+            WriteSize(out, size, kMap16, kMap32);
+        }
+        if (size != 0) stack.emplace_back(&value);
+    } else if (value.IsArray()) {
+        const std::size_t size = value.Size();
+        if (size <= kFixarrayMaxSize) {
+            WriteMarker(out, kFixarray | static_cast<std::uint8_t>(size));
+        } else {
+            WriteSize(out, size, kArray16, kArray32);
+        }
+        if (size != 0) stack.emplace_back(&value);
+    } else if (value.IsString()) {
+        WriteString(out, value);
+    } else if (value.IsDouble()) {
+        WriteDouble(out, value.GetDouble());
+    } else if (value.IsInt64()) {
+        WriteInt(out, value.GetInt64());
+    } else if (value.IsUint64()) {
+        WriteUint(out, value.GetUint64());
+    } else if (value.IsBool()) {
+        WriteMarker(out, value.GetBool() ? kTrue : kFalse);
+    } else {
+        WriteMarker(out, kNil);
+    }
+}
+
+class Reader final {
+public:
+    explicit Reader(std::string_view data) : data_(data) {}
+
+    bool IsEnd() const noexcept { return pos_ == data_.size(); }
+
+    std::uint8_t ReadMarker() { return static_cast<std::uint8_t>(Read(1)[0]); }
+
+    template <typename T>
+    T ReadBigEndian() {
+        static_assert(std::is_unsigned_v<T>);
+        const auto* bytes = reinterpret_cast<const unsigned char*>(Read(sizeof(T)));
+        T result = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            result = static_cast<T>((result << 8) | bytes[i]);
+        }
+        return result;
+    }
+
+    std::string_view ReadString(std::uint8_t marker) {
+        std::size_t size = 0;
+        if ((marker & 0xe0) == kFixstr) {
+            size = marker & kFixstrMaxSize;
+        } else if (marker == kStr8 || marker == kBin8) {
+            size = ReadBigEndian<std::uint8_t>();
+        } else if (marker == kStr16 || marker == kBin16) {
+            size = ReadBigEndian<std::uint16_t>();
+        } else if (marker == kStr32 || marker == kBin32) {
+            size = ReadBigEndian<std::uint32_t>();
+        } else {
+            Fail(fmt::format("expected a string, got marker 0x{:02x}", marker));
+        }
+        return {Read(size), size};
+    }
+
+    [[noreturn]] void Fail(std::string_view message) const {
+        throw ParseException(fmt::format("MessagePack parse error at offset {}: {}", pos_, message));
+    }
+
+private:
+    const char* Read(std::size_t size) {
+        if (data_.size() - pos_ < size) {
+            Fail("unexpected end of data");
+        }
+        const char* result = data_.data() + pos_;
+        pos_ += size;
+        return result;
+    }
+
+    std::string_view data_;
+    std::size_t pos_{0};
+};
+
+bool IsStringMarker(std::uint8_t marker) {
+    return (marker & 0xe0) == kFixstr || marker == kStr8 || marker == kStr16 || marker == kStr32 ||
+           marker == kBin8 || marker == kBin16 || marker == kBin32;
+}
+
+// Produces SAX events of rapidjson for impl::Document::Populate
+class Generator final {
+public:
+    explicit Generator(std::string_view data) : reader_(data) {}
+
+    template <typename Handler>
+    bool operator()(Handler& handler) {
+        ReadValue(handler);
+        while (!stack_.empty()) {
+            auto& frame = stack_.back();
+            if (frame.remaining == 0) {
+                if (frame.is_object) {
+                    handler.EndObject(frame.size);
+                } else {
+                    handler.EndArray(frame.size);
+                }
+                stack_.pop_back();
+                continue;
+            }
+
+            --frame.remaining;
+            if (frame.is_object) {
+                const auto key = reader_.ReadString(reader_.ReadMarker());
+                handler.Key(key.data(), static_cast<rapidjson::SizeType>(key.size()), /*copy=*/true);
+            }
+            ReadValue(handler);
+        }
+
+        if (!reader_.IsEnd()) {
+            reader_.Fail("trailing data after the document");
+        }
+        return true;
+    }
+
+private:
+    struct Frame {
+        rapidjson::SizeType size;
+        rapidjson::SizeType remaining;
+        bool is_object;
+    };
+
+    template <typename Handler>
+    void ReadValue(Handler& handler) {
+        const std::uint8_t marker = reader_.ReadMarker();
+        if (marker <= kPositiveFixintMax) {
+            handler.Uint64(marker);
+        } else if (marker >= kNegativeFixintMin) {
+            handler.Int64(static_cast<std::int8_t>(marker));
+        } else if ((marker & 0xf0) == kFixmap) {
+            StartContainer(handler, marker & kFixmapMaxSize, /*is_object=*/true);
+        } else if ((marker & 0xf0) == kFixarray) {
+            StartContainer(handler, marker & kFixarrayMaxSize, /*is_object=*/false);
+        } else if (IsStringMarker(marker)) {
+            const auto value = reader_.ReadString(marker);
+            handler.String(value.data(), static_cast<rapidjson::SizeType>(value.size()), /*copy=*/true);
+        } else {
+            switch (marker) {
+                case kNil:
+                    handler.Null();
+                    break;
+                case kFalse:
+                    handler.Bool(false);
+                    break;
+                case kTrue:
+                    handler.Bool(true);
+                    break;
+                case kFloat32:
+                    ReadDouble(handler, BitCast<float>(reader_.ReadBigEndian<std::uint32_t>()));
+                    break;
+                case kFloat64:
+                    ReadDouble(handler, BitCast<double>(reader_.ReadBigEndian<std::uint64_t>()));
+                    break;
+                case kUint8:
+                    handler.Uint64(reader_.ReadBigEndian<std::uint8_t>());
+                    break;
+                case kUint16:
+                    handler.Uint64(reader_.ReadBigEndian<std::uint16_t>());
+                    break;
+                case kUint32:
+                    handler.Uint64(reader_.ReadBigEndian<std::uint32_t>());
+                    break;
+                case kUint64:
+                    handler.Uint64(reader_.ReadBigEndian<std::uint64_t>());
+                    break;
+                case kInt8:
+                    handler.Int64(static_cast<std::int8_t>(reader_.ReadBigEndian<std::uint8_t>()));
+                    break;
+                case kInt16:
+                    handler.Int64(static_cast<std::int16_t>(reader_.ReadBigEndian<std::uint16_t>()));
+                    break;
+                case kInt32:
+                    handler.Int64(static_cast<std::int32_t>(reader_.ReadBigEndian<std::uint32_t>()));
+                    break;
+                case kInt64:
+                    handler.Int64(static_cast<std::int64_t>(reader_.ReadBigEndian<std::uint64_t>()));
+                    break;
+                case kArray16:
+                    StartContainer(handler, reader_.ReadBigEndian<std::uint16_t>(), /*is_object=*/false);
+                    break;
+                case kArray32:
+                    StartContainer(handler, reader_.ReadBigEndian<std::uint32_t>(), /*is_object=*/false);
+                    break;
+                case kMap16:
+                    StartContainer(handler, reader_.ReadBigEndian<std::uint16_t>(), /*is_object=*/true);
+                    break;
+                case kMap32:
+                    StartContainer(handler, reader_.ReadBigEndian<std::uint32_t>(), /*is_object=*/true);
+                    break;
+                default:
+                    reader_.Fail(fmt::format("unsupported marker 0x{:02x}", marker));
+            }
+        }
+    }
+
+    template <typename Handler>
+    void StartContainer(Handler& handler, rapidjson::SizeType size, bool is_object) {
+        if (stack_.size() + 1 >= json::kDepthParseLimit) {
+            reader_.Fail(fmt::format("exceeded maximum allowed depth of {}", json::kDepthParseLimit));
+        }
+        if (is_object) {
+            handler.StartObject();
+        } else {
+            handler.StartArray();
+        }
+        stack_.push_back(Frame{size, size, is_object});
+    }
+
+    template <typename Handler>
+    void ReadDouble(Handler& handler, double value) {
+        if (!std::isfinite(value)) {
+            reader_.Fail("non-finite floating point value");
+        }
+        handler.Double(value);
+    }
+
+    template <typename To, typename From>
+    static To BitCast(From from) noexcept {
+        static_assert(sizeof(To) == sizeof(From));
+        To to;
+        std::memcpy(&to, &from, sizeof(to));
+        return to;
+    }
+
+    Reader reader_;
+    boost::container::small_vector<Frame, impl::kInitialStackDepth> stack_;
+};
+
+}  // namespace
+
+formats::json::Value FromString(std::string_view data) {
+    if (data.empty()) {
+        throw ParseException("MessagePack document is empty");
+    }
+
+    impl::Document json{&g_allocator};
+    Generator generator{data};
+    json.Populate(generator);
+    impl::CheckKeyUniqueness(&json);
+
+    return formats::json::Value{impl::VersionedValuePtr::Create(std::move(json))};
+}
+
+std::string ToString(const formats::json::Value& doc) {
+    std::string out;
+    impl::TreeStack stack;
+
+    WriteValue(out, doc.GetNative(), stack);
+    while (!stack.empty()) {
+        auto& frame = stack.back();
+        if (!frame.HasMoreElements()) {
+            stack.pop_back();
+            continue;
+        }
+
+        const auto* container = frame.container();
+        const auto index = frame.CurrentIndex();
+        frame.Advance();
+        if (container->IsObject()) {
+            const auto& member = container->MemberBegin()[index];
+            WriteString(out, member.name);
+            WriteValue(out, member.value, stack);
+        } else {
+            WriteValue(out, container->Begin()[index], stack);
+        }
+    }
+
+    return out;
+}
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
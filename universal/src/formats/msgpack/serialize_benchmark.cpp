@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/msgpack/serialize.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Array of `count` typical API objects
+formats::json::Value MakeItems(std::size_t count) {
+    formats::json::ValueBuilder items{formats::common::Type::kArray};
+    for (std::size_t i = 0; i < count; ++i) {
+        formats::json::ValueBuilder item;
+        item["id"] = i;
+        item["name"] = "item name number " + std::to_string(i);
+        item["price"] = 1234.5678 + i;
+        item["in_stock"] = i % 2 == 0;
+        item["tags"] = std::vector<std::string>{"first", "second", "third"};
+        item["dimensions"]["width"] = 10;
+        item["dimensions"]["height"] = 20.5;
+        items.PushBack(std::move(item));
+    }
+    return items.ExtractValue();
+}
+
+}  // namespace
+
+void MsgpackVsJsonToString(benchmark::State& state) {
+    const auto value = MakeItems(state.range(0));
+    const bool is_msgpack = state.range(1);
+
+    std::size_t size = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        auto result = is_msgpack ? formats::msgpack::ToString(value) : formats::json::ToString(value);
+        size = result.size();
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["bytes"] = size;
+}
+BENCHMARK(MsgpackVsJsonToString)->ArgNames({"items", "msgpack"})->ArgsProduct({{1, 64, 4096}, {0, 1}});
+
+void MsgpackVsJsonFromString(benchmark::State& state) {
+    const auto value = MakeItems(state.range(0));
+    const bool is_msgpack = state.range(1);
+    const auto data = is_msgpack ? formats::msgpack::ToString(value) : formats::json::ToString(value);
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto result = is_msgpack ? formats::msgpack::FromString(data) : formats::json::FromString(data);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["bytes"] = data.size();
+}
+BENCHMARK(MsgpackVsJsonFromString)->ArgNames({"items", "msgpack"})->ArgsProduct({{1, 64, 4096}, {0, 1}});
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/msgpack/serialize.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::string_literals;
+
+formats::json::Value Roundtrip(const formats::json::Value& value) {
+    return formats::msgpack::FromString(formats::msgpack::ToString(value));
+}
+
+}  // namespace
+
+TEST(FormatsMsgpack, Scalars) {
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("null")), "\xc0");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("true")), "\xc3");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("false")), "\xc2");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("5")), "\x05");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("-1")), "\xff");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("200")), "\xcc\xc8");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("-200")), "\xd1\xff\x38");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("1.5")), "\xcb\x3f\xf8\0\0\0\0\0\0"s);
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString(R"("ab")")), "\xa2\x61\x62");
+}
+
+TEST(FormatsMsgpack, Containers) {
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("[]")), "\x90");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("{}")), "\x80");
+    EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString(R"({"a":[1,null]})")), "\x81\xa1\x61\x92\x01\xc0");
+
+    const auto value = formats::msgpack::FromString("\x82\xa1x\x01\xa1y\x92\xc3\xa0");
+    EXPECT_EQ(value, formats::json::FromString(R"({"x":1,"y":[true,""]})"));
+}
+
+TEST(FormatsMsgpack, Roundtrip) {
+    const auto json = formats::json::FromString(R"({
+        "int": -123456789,
+        "uint": 18446744073709551615,
+        "min": -9223372036854775808,
+        "double": 0.1,
+        "string": "a string that is longer than thirty one characters",
+        "nested": {"array": [1, 2, 3, {"deep": [[], {}]}], "empty": ""},
+        "null": null
+    })");
+    const auto result = Roundtrip(json);
+    EXPECT_EQ(result, json);
+    EXPECT_EQ(result["uint"].As<std::uint64_t>(), std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(result["min"].As<std::int64_t>(), std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(result["double"].As<double>(), 0.1);
+}
+
+TEST(FormatsMsgpack, LargeContainers) {
+    std::vector<std::string> strings(70000, std::string(300, 'x'));
+    std::map<std::string, int> map;
+    for (int i = 0; i < 20; ++i) map.emplace(std::to_string(i), i);
+
+    formats::json::ValueBuilder builder;
+    builder["strings"] = strings;
+    builder["map"] = map;
+    const auto json = builder.ExtractValue();
+
+    const auto result = Roundtrip(json);
+    EXPECT_EQ(result["strings"].As<std::vector<std::string>>(), strings);
+    EXPECT_EQ((result["map"].As<std::map<std::string, int>>()), map);
+}
+
+TEST(FormatsMsgpack, ParseTypes) {
+    const auto value = formats::msgpack::FromString(
+        "\x99\xce\xff\xff\xff\xff\xd0\x80\xd2\x80\0\0\0\xca\x3f\xc0\0\0\xc4\x02\x01\x02\xd9\x01z\xcd\x01\0\xe0\x00"s
+    );
+    ASSERT_EQ(value.GetSize(), 9);
+    EXPECT_EQ(value[0].As<std::uint32_t>(), std::numeric_limits<std::uint32_t>::max());
+    EXPECT_EQ(value[1].As<int>(), -128);
+    EXPECT_EQ(value[2].As<std::int32_t>(), std::numeric_limits<std::int32_t>::min());
+    EXPECT_EQ(value[3].As<double>(), 1.5);
+    EXPECT_EQ(value[4].As<std::string>(), "\x01\x02");
+    EXPECT_EQ(value[5].As<std::string>(), "z");
+    EXPECT_EQ(value[6].As<int>(), 256);
+    EXPECT_EQ(value[7].As<int>(), -32);
+    EXPECT_EQ(value[8].As<int>(), 0);
+}
+
+TEST(FormatsMsgpack, ParseErrors) {
+    using formats::json::ParseException;
+
+    EXPECT_THROW(formats::msgpack::FromString(""), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\x92\x01"), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\xa3\x61\x62"), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\x01\x02"), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\x81\x01\x01"), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\xd4\x01\x01"), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\xc1"), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\xcb\x7f\xf0\0\0\0\0\0\0"s), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString("\x82\xa1x\x01\xa1x\x02"), ParseException);
+    EXPECT_THROW(formats::msgpack::FromString(std::string(1000, '\x91') + '\xc0'), ParseException);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,133 @@
+#include <hostinfo/cgroup.hpp>
+
+#include <charconv>
+#include <string>
+#include <thread>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/hostinfo/cpu_limit.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace hostinfo::impl {
+
+namespace {
+
+// In a container the cgroup of the process is mounted at the root
+constexpr std::string_view kCgroupV2Path = "/sys/fs/cgroup/";
+constexpr std::string_view kCgroupV1CpuPaths[] = {"/sys/fs/cgroup/cpu/", "/sys/fs/cgroup/cpu,cpuacct/"};
+
+std::string_view Trim(std::string_view str) {
+    const auto begin = str.find_first_not_of(" \t\n");
+    if (begin == std::string_view::npos) return {};
+    const auto end = str.find_last_not_of(" \t\n");
+    return str.substr(begin, end - begin + 1);
+}
+
+std::optional<std::int64_t> ParseInt(std::string_view str) {
+    str = Trim(str);
+    std::int64_t result = 0;
+    const auto* const end = str.data() + str.size();
+    const auto [ptr, ec] = std::from_chars(str.data(), end, result);
+    if (str.empty() || ec != std::errc{} || ptr != end) return std::nullopt;
+    return result;
+}
+
+std::optional<double> QuotaToCpus(std::optional<std::int64_t> quota, std::optional<std::int64_t> period) {
+    // A negative quota means "unlimited" in cgroup v1
+    if (!quota || !period || *quota <= 0 || *period <= 0) return std::nullopt;
+    return static_cast<double>(*quota) / static_cast<double>(*period);
+}
+
+std::optional<std::string> TryReadFile(const std::string& path) {
+    if (!fs::blocking::FileExists(path)) return std::nullopt;
+    try {
+        return fs::blocking::ReadFileContents(path);
+    } catch (const std::exception& ex) {
+        LOG_LIMITED_DEBUG() << "Failed to read '" << path << "': " << ex;
+        return std::nullopt;
+    }
+}
+
+}  // namespace
+
+std::optional<double> ParseCgroupV2CpuMax(std::string_view cpu_max) {
+    cpu_max = Trim(cpu_max);
+    const auto space_pos = cpu_max.find(' ');
+    if (space_pos == std::string_view::npos) return std::nullopt;
+
+    // "max" means "unlimited"
+    return QuotaToCpus(ParseInt(cpu_max.substr(0, space_pos)), ParseInt(cpu_max.substr(space_pos + 1)));
+}
+
+std::optional<double> ParseCgroupV1CpuQuota(std::string_view quota_us, std::string_view period_us) {
+    return QuotaToCpus(ParseInt(quota_us), ParseInt(period_us));
+}
+
+CgroupCpuStat ParseCgroupCpuStat(std::string_view cpu_stat) {
+    CgroupCpuStat result;
+    while (!cpu_stat.empty()) {
+        const auto line_end = cpu_stat.find('\n');
+        const auto line = cpu_stat.substr(0, line_end);
+        cpu_stat.remove_prefix(line_end == std::string_view::npos ? cpu_stat.size() : line_end + 1);
+
+        const auto space_pos = line.find(' ');
+        if (space_pos == std::string_view::npos) continue;
+        const auto key = line.substr(0, space_pos);
+        const auto value = ParseInt(line.substr(space_pos + 1));
+        if (!value) continue;
+
+        if (key == "nr_periods") {
+            result.periods = value;
+        } else if (key == "nr_throttled") {
+            result.throttled_periods = value;
+        } else if (key == "throttled_usec") {
+            // cgroup v2
+            result.throttled_sec = *value / 1e6;
+        } else if (key == "throttled_time") {
+            // cgroup v1
+            result.throttled_sec = *value / 1e9;
+        }
+    }
+    return result;
+}
+
+std::optional<double> ReadCgroupCpuLimit() {
+    if (const auto cpu_max = TryReadFile(std::string{kCgroupV2Path} + "cpu.max")) {
+        return ParseCgroupV2CpuMax(*cpu_max);
+    }
+
+    for (const auto path : kCgroupV1CpuPaths) {
+        const auto quota = TryReadFile(std::string{path} + "cpu.cfs_quota_us");
+        const auto period = TryReadFile(std::string{path} + "cpu.cfs_period_us");
+        if (quota && period) return ParseCgroupV1CpuQuota(*quota, *period);
+    }
+    return std::nullopt;
+}
+
+CgroupCpuStat ReadCgroupCpuStat() {
+    // cgroup v2 has cpu.stat in the root even without the cpu controller, but
+    // without the throttling fields
+    if (const auto cpu_stat = TryReadFile(std::string{kCgroupV2Path} + "cpu.stat")) {
+        return ParseCgroupCpuStat(*cpu_stat);
+    }
+
+    for (const auto path : kCgroupV1CpuPaths) {
+        if (const auto cpu_stat = TryReadFile(std::string{path} + "cpu.stat")) {
+            return ParseCgroupCpuStat(*cpu_stat);
+        }
+    }
+    return {};
+}
+
+double GetAvailableCpus() {
+    if (const auto cpu_limit = CpuLimit()) return *cpu_limit;
+
+    const auto hw_concurrency = std::thread::hardware_concurrency();
+    return hw_concurrency ? hw_concurrency : 1;
+}
+
+}  // namespace hostinfo::impl
+
+USERVER_NAMESPACE_END
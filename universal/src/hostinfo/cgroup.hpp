@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace hostinfo::impl {
+
+/// CFS bandwidth control statistics of the cgroup, see `cpu.stat`
+struct CgroupCpuStat {
+    std::optional<std::int64_t> periods;
+    std::optional<std::int64_t> throttled_periods;
+    std::optional<double> throttled_sec;
+};
+
+/// Parses cgroup v2 `cpu.max`, e.g. "150000 100000" gives 1.5
+std::optional<double> ParseCgroupV2CpuMax(std::string_view cpu_max);
+
+/// Parses cgroup v1 `cpu.cfs_quota_us` and `cpu.cfs_period_us`
+std::optional<double> ParseCgroupV1CpuQuota(std::string_view quota_us, std::string_view period_us);
+
+/// Parses `cpu.stat` of both cgroup v1 and v2
+CgroupCpuStat ParseCgroupCpuStat(std::string_view cpu_stat);
+
+/// Reads the CPU quota of the cgroup of the process, std::nullopt if unlimited
+/// or unknown. Not cached, so that the quota changes are visible.
+std::optional<double> ReadCgroupCpuLimit();
+
+/// Reads `cpu.stat` of the cgroup of the process
+CgroupCpuStat ReadCgroupCpuStat();
+
+/// Number of CPUs to size the thread pools for: hostinfo::CpuLimit() if
+/// known, std::thread::hardware_concurrency() otherwise
+double GetAvailableCpus();
+
+}  // namespace hostinfo::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#include <hostinfo/cgroup.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Cgroup, V2CpuMax) {
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("150000 100000\n"), 1.5);
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("50000 100000"), 0.5);
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("max 100000\n"), std::nullopt);
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax(""), std::nullopt);
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("100000"), std::nullopt);
+}
+
+TEST(Cgroup, V1CpuQuota) {
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV1CpuQuota("200000\n", "100000\n"), 2.0);
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV1CpuQuota("-1\n", "100000\n"), std::nullopt);
+    EXPECT_EQ(hostinfo::impl::ParseCgroupV1CpuQuota("200000", "0"), std::nullopt);
+}
+
+TEST(Cgroup, V2CpuStat) {
+    const auto stat = hostinfo::impl::ParseCgroupCpuStat(
+        "usage_usec 8000000\n"
+        "user_usec 6000000\n"
+        "system_usec 2000000\n"
+        "nr_periods 100\n"
+        "nr_throttled 20\n"
+        "throttled_usec 1500000\n"
+    );
+    EXPECT_EQ(stat.periods, 100);
+    EXPECT_EQ(stat.throttled_periods, 20);
+    EXPECT_EQ(stat.throttled_sec, 1.5);
+}
+
+TEST(Cgroup, V1CpuStat) {
+    const auto stat = hostinfo::impl::ParseCgroupCpuStat(
+        "nr_periods 100\n"
+        "nr_throttled 20\n"
+        "throttled_time 2500000000\n"
+    );
+    EXPECT_EQ(stat.periods, 100);
+    EXPECT_EQ(stat.throttled_periods, 20);
+    EXPECT_EQ(stat.throttled_sec, 2.5);
+}
+
+TEST(Cgroup, NoCpuController) {
+    const auto stat = hostinfo::impl::ParseCgroupCpuStat("usage_usec 8000000\nuser_usec 6000000\n");
+    EXPECT_EQ(stat.periods, std::nullopt);
+    EXPECT_EQ(stat.throttled_periods, std::nullopt);
+    EXPECT_EQ(stat.throttled_sec, std::nullopt);
+}
+
+USERVER_NAMESPACE_END
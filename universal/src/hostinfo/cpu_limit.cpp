@@ -3,6 +3,7 @@
 #include <optional>
 #include <string>
 
+#include <hostinfo/cgroup.hpp>
 #include <userver/logging/log.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -38,10 +39,25 @@ std::optional<double> CpuLimitRtc() {
     return {};
 }
 
+std::optional<double> CpuLimitCgroup() {
+    try {
+        auto limit = impl::ReadCgroupCpuLimit();
+        if (limit) LOG_INFO() << "Using CPU quota of the cgroup as the CPU limit: " << *limit;
+        return limit;
+    } catch (const std::exception& e) {
+        LOG_ERROR() << "Failed to read the CPU quota of the cgroup: " << e;
+    }
+    return {};
+}
+
 }  // namespace
 
 std::optional<double> CpuLimit() {
-    static const auto limit = CpuLimitRtc();
+    static const auto limit = [] {
+        auto result = CpuLimitRtc();
+        if (!result) result = CpuLimitCgroup();
+        return result;
+    }();
     return limit;
 }
 
@@ -237,6 +237,7 @@ namespace content_type {
 
 const ContentType kApplicationOctetStream = "application/octet-stream";
 const ContentType kApplicationJson = "application/json; charset=utf-8";
+const ContentType kApplicationMsgpack = "application/msgpack";
 const ContentType kTextPlain = "text/plain; charset=utf-8";
 
 }  // namespace content_type
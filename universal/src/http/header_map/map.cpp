@@ -183,12 +183,22 @@ inline Map::FindResult Map::FindResult::None() noexcept { return FindResult{0, k
 Map::Map() { static_assert(IsPowerOf2(kOnStackPositionsCount)); }
 
 void Map::Reserve(std::size_t capacity) {
-    // We don't touch positions here because:
-    // 1. it's a small vector with capacity probably big enough anyway
-    // 2. we know better how it should be managed
-    //
-    // for entries tho we can reserve, why not
     entries_.reserve(capacity);
+
+    // Positions are only sized up front for an empty map: there is nothing
+    // to rehash yet, and the growth from the on-stack storage to the heap
+    // happens once instead of on every doubling. For a non-empty map
+    // we know better how it should be managed.
+    if (capacity == 0 || !entries_.empty() || danger_.IsYellow() || danger_.IsRed()) return;
+
+    std::size_t new_raw_capacity = kOnStackPositionsCount;
+    while (UsableCapacity(new_raw_capacity) < capacity && new_raw_capacity < Traits::kMaxSize) {
+        new_raw_capacity *= 2;
+    }
+    if (new_raw_capacity <= positions_.size()) return;
+
+    mask_ = static_cast<Traits::Size>(new_raw_capacity - 1);
+    positions_.assign(new_raw_capacity, Pos::None());
 }
 
 std::size_t Map::Size() const noexcept { return entries_.size(); }
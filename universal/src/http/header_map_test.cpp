@@ -206,6 +206,25 @@ TEST(HeaderMap, Resize) {
     }
 }
 
+TEST(HeaderMap, Reserve) {
+    constexpr std::size_t kHeadersCount = 100;
+
+    HeaderMap map{};
+    map.reserve(kHeadersCount);
+    for (std::size_t i = 0; i < kHeadersCount; ++i) {
+        map.emplace(std::to_string(i), std::to_string(i));
+    }
+    // non-empty map is not rehashed by reserve
+    map.reserve(kHeadersCount * 4);
+
+    EXPECT_EQ(map.size(), kHeadersCount);
+    for (std::size_t i = 0; i < kHeadersCount; ++i) {
+        const auto it = map.find(std::to_string(i));
+        ASSERT_NE(it, map.end());
+        ASSERT_EQ(it->second, std::to_string(i));
+    }
+}
+
 TEST(HeaderMap, CaseInsensitiveFind) {
     HeaderMap map{};
 
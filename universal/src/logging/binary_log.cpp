@@ -0,0 +1,194 @@
+#include <userver/logging/binary_log.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#include <fmt/chrono.h>
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <logging/binary_log_encoding.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+namespace {
+
+class PayloadReader final {
+public:
+    explicit PayloadReader(std::string_view payload) noexcept : payload_(payload) {}
+
+    bool IsEmpty() const noexcept { return payload_.empty(); }
+
+    std::string_view GetRest() const noexcept { return payload_; }
+
+    std::uint8_t ReadByte() {
+        if (payload_.empty()) throw BinaryLogDecodeError("Unexpected end of the binary log record");
+        const auto result = static_cast<std::uint8_t>(payload_.front());
+        payload_.remove_prefix(1);
+        return result;
+    }
+
+    std::uint64_t ReadVarint() {
+        std::uint64_t result = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const auto byte = ReadByte();
+            result |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) return result;
+        }
+        throw BinaryLogDecodeError("Too long varint in the binary log record");
+    }
+
+    std::string_view ReadBytes(std::uint64_t size) {
+        if (size > payload_.size()) throw BinaryLogDecodeError("Unexpected end of the binary log record");
+        const auto result = payload_.substr(0, size);
+        payload_.remove_prefix(size);
+        return result;
+    }
+
+private:
+    std::string_view payload_;
+};
+
+struct Tag final {
+    std::string_view key;
+    std::string_view value;
+};
+
+Tag ReadTag(PayloadReader& reader) {
+    const auto key_ref = reader.ReadVarint();
+    std::string_view key;
+    if (key_ref & 1) {
+        const auto well_known_key = impl::binary::FindWellKnownKey(key_ref >> 1);
+        if (!well_known_key) {
+            throw BinaryLogDecodeError(fmt::format("Unknown key id {} in the binary log record", key_ref >> 1));
+        }
+        key = *well_known_key;
+    } else {
+        key = reader.ReadBytes(key_ref >> 1);
+    }
+    return {key, reader.ReadBytes(reader.ReadVarint())};
+}
+
+std::string FormatTimestamp(std::chrono::system_clock::time_point timestamp) {
+    const auto timestamp_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(timestamp.time_since_epoch()).count();
+    const auto seconds = static_cast<std::time_t>(timestamp_us / 1'000'000);
+    return fmt::format(FMT_COMPILE("{:%FT%T}.{:06}"), fmt::localtime(seconds), timestamp_us % 1'000'000);
+}
+
+void DecodeTextRecord(const BinaryLogRecordView& record, bool ltsv, std::string& out) {
+    const char separator = ltsv ? ':' : utils::encoding::kTskvKeyValueSeparator;
+    if (!ltsv) out.append("tskv\t");
+    out.append("timestamp");
+    out.push_back(separator);
+    out.append(FormatTimestamp(record.GetTimestamp()));
+    out.push_back(utils::encoding::kTskvPairsSeparator);
+    out.append("level");
+    out.push_back(separator);
+    out.append(ToUpperCaseString(record.GetLevel()));
+
+    record.VisitTags([&out, separator](std::string_view key, std::string_view value) {
+        out.push_back(utils::encoding::kTskvPairsSeparator);
+        utils::encoding::EncodeTskv(out, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+        out.push_back(separator);
+        utils::encoding::EncodeTskv(out, value, utils::encoding::EncodeTskvMode::kValue);
+    });
+    out.push_back('\n');
+}
+
+void DecodeJsonRecord(const BinaryLogRecordView& record, std::string& out) {
+    formats::json::StringBuilder builder;
+    {
+        const formats::json::StringBuilder::ObjectGuard guard{builder};
+        builder.Key("timestamp");
+        builder.WriteString(FormatTimestamp(record.GetTimestamp()));
+        builder.Key("level");
+        builder.WriteString(ToUpperCaseString(record.GetLevel()));
+        record.VisitTags([&builder](std::string_view key, std::string_view value) {
+            builder.Key(key);
+            builder.WriteString(value);
+        });
+    }
+    out.append(builder.GetStringView());
+    out.push_back('\n');
+}
+
+void DecodeRecord(std::string_view data, DecodedLogFormat format, std::string& out) {
+    const BinaryLogRecordView record{data};
+    switch (format) {
+        case DecodedLogFormat::kTskv:
+            DecodeTextRecord(record, /*ltsv=*/false, out);
+            return;
+        case DecodedLogFormat::kLtsv:
+            DecodeTextRecord(record, /*ltsv=*/true, out);
+            return;
+        case DecodedLogFormat::kJson:
+            DecodeJsonRecord(record, out);
+            return;
+    }
+    throw BinaryLogDecodeError("Invalid DecodedLogFormat enum value");
+}
+
+std::uint32_t ReadRecordSize(std::string_view data) noexcept {
+    UASSERT(data.size() >= impl::binary::kRecordSizeBytes);
+    std::uint32_t payload_size = 0;
+    for (std::size_t i = 0; i < impl::binary::kRecordSizeBytes; ++i) {
+        payload_size |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(data[i])) << (i * 8);
+    }
+    return payload_size;
+}
+
+}  // namespace
+
+BinaryLogRecordView::BinaryLogRecordView(std::string_view record) {
+    if (record.size() < impl::binary::kRecordSizeBytes ||
+        ReadRecordSize(record) != record.size() - impl::binary::kRecordSizeBytes) {
+        throw BinaryLogDecodeError("Size of the binary log record does not match its size prefix");
+    }
+
+    PayloadReader reader{record.substr(impl::binary::kRecordSizeBytes)};
+    const auto version = reader.ReadByte();
+    if (version != impl::binary::kVersion) {
+        throw BinaryLogDecodeError(fmt::format("Unsupported binary log record version {}", version));
+    }
+    const std::chrono::microseconds timestamp{static_cast<std::chrono::microseconds::rep>(reader.ReadVarint())};
+    timestamp_ = std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(timestamp)};
+    const auto level = reader.ReadByte();
+    if (level > static_cast<std::uint8_t>(Level::kNone)) {
+        throw BinaryLogDecodeError(fmt::format("Unknown log level {} in the binary log record", level));
+    }
+    level_ = static_cast<Level>(level);
+    tags_ = reader.GetRest();
+}
+
+void BinaryLogRecordView::VisitTags(TagVisitor visitor) const {
+    PayloadReader reader{tags_};
+    while (!reader.IsEmpty()) {
+        const auto tag = ReadTag(reader);
+        visitor(tag.key, tag.value);
+    }
+}
+
+std::size_t DecodeBinaryLog(std::string_view data, DecodedLogFormat format, std::string& out) {
+    std::size_t consumed = 0;
+    while (data.size() - consumed >= impl::binary::kRecordSizeBytes) {
+        const auto record_size = impl::binary::kRecordSizeBytes + ReadRecordSize(data.substr(consumed));
+        if (data.size() - consumed < record_size) break;
+
+        DecodeRecord(data.substr(consumed, record_size), format, out);
+        consumed += record_size;
+    }
+    return consumed;
+}
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
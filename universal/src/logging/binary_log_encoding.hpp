@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+// Record of logging::Format::kBinary:
+//
+//   record    := size:u32le payload
+//   payload   := version:u8 timestamp_us:varint level:u8 tag*
+//   tag       := key_ref:varint value_size:varint value
+//   key_ref   := (well_known_key_id << 1) | 1
+//              | (key_size << 1) key
+//
+// Records do not depend on each other, so that a file remains decodable after
+// rotation or truncation.
+
+inline constexpr std::uint8_t kVersion = 1;
+inline constexpr std::size_t kRecordSizeBytes = 4;
+inline constexpr std::size_t kMaxVarintBytes = 10;
+
+// Keys written by the framework into each record or into each span record.
+// Ids must never change, only appending is allowed.
+inline constexpr utils::TrivialBiMap kWellKnownKeys = [](auto selector) {
+    return selector()
+        .Case("text", 0)
+        .Case("module", 1)
+        .Case("task_id", 2)
+        .Case("thread_id", 3)
+        .Case("trace_id", 4)
+        .Case("span_id", 5)
+        .Case("parent_id", 6)
+        .Case("link", 7)
+        .Case("stopwatch_name", 8)
+        .Case("total_time", 9)
+        .Case("stopwatch_units", 10)
+        .Case("start_timestamp", 11)
+        .Case("span_ref_type", 12)
+        .Case("span_kind", 13)
+        .Case("tags", 14);
+};
+
+inline std::optional<int> FindWellKnownKeyId(std::string_view key) noexcept {
+    return kWellKnownKeys.TryFindByFirst(key);
+}
+
+inline std::optional<std::string_view> FindWellKnownKey(std::uint64_t id) noexcept {
+    return kWellKnownKeys.TryFindBySecond(static_cast<int>(id));
+}
+
+// Returns the end of the written varint, `destination` must have at least
+// GetVarintSize(value) bytes
+inline char* WriteVarint(char* destination, std::uint64_t value) noexcept {
+    while (value >= 0x80) {
+        *(destination++) = static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    *(destination++) = static_cast<char>(value);
+    return destination;
+}
+
+inline std::size_t GetVarintSize(std::uint64_t value) noexcept {
+    std::size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+template <typename Buffer>
+void AppendVarint(Buffer& buffer, std::uint64_t value) {
+    const auto old_size = buffer.size();
+    buffer.resize(old_size + kMaxVarintBytes);
+    auto* const end = WriteVarint(buffer.data() + old_size, value);
+    buffer.resize(end - buffer.data());
+}
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
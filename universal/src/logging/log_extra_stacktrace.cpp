@@ -1,5 +1,6 @@
 #include <logging/log_extra_stacktrace.hpp>
 
+#include <atomic>
 #include <string>
 
 #include <boost/stacktrace.hpp>
@@ -16,6 +17,14 @@ namespace {
 
 const std::string kTraceKey = "stacktrace";
 
+std::atomic<bool> async_symbolization{false};
+
+std::string ToString(const boost::stacktrace::stacktrace& trace, utils::Flags<LogExtraStacktraceFlags> flags) {
+    if (flags & LogExtraStacktraceFlags::kNoCache) return boost::stacktrace::to_string(trace);
+    if (async_symbolization.load(std::memory_order_relaxed)) return stacktrace_cache::to_string_async(trace);
+    return stacktrace_cache::to_string(trace);
+}
+
 }  // namespace
 
 void ExtendLogExtraWithStacktrace(
@@ -26,8 +35,7 @@ void ExtendLogExtraWithStacktrace(
     try {
         log_extra.Extend(
             kTraceKey,
-            (flags & LogExtraStacktraceFlags::kNoCache) ? boost::stacktrace::to_string(trace)
-                                                        : stacktrace_cache::to_string(trace),
+            ToString(trace, flags),
             (flags & LogExtraStacktraceFlags::kFrozen) ? LogExtra::ExtendType::kFrozen : LogExtra::ExtendType::kNormal
         );
     } catch (const std::exception& e) {
@@ -39,6 +47,10 @@ void ExtendLogExtraWithStacktrace(LogExtra& log_extra, utils::Flags<LogExtraStac
     ExtendLogExtraWithStacktrace(log_extra, boost::stacktrace::stacktrace{}, flags);
 }
 
+void SetAsyncStacktraceSymbolization(bool enable) noexcept {
+    async_symbolization.store(enable, std::memory_order_relaxed);
+}
+
 bool ShouldLogStacktrace() noexcept { return ShouldLog(logging::Level::kDebug); }
 
 bool LoggerShouldLogStacktrace(logging::LoggerRef logger) noexcept {
@@ -27,6 +27,10 @@ void ExtendLogExtraWithStacktrace(
 /// by current stack inside the function call
 void ExtendLogExtraWithStacktrace(LogExtra& log_extra, utils::Flags<LogExtraStacktraceFlags> = {}) noexcept;
 
+/// @brief Makes the cached stacktraces symbolized on a background thread,
+/// see logging::stacktrace_cache::to_string_async
+void SetAsyncStacktraceSymbolization(bool enable) noexcept;
+
 /// @brief Checks if Debug level logging is enabled since
 /// logging stacktrace is slow
 bool ShouldLogStacktrace() noexcept;
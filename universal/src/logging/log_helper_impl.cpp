@@ -1,6 +1,7 @@
 #include "log_helper_impl.hpp"
 
 #include <array>
+#include <cstring>
 
 #include <fmt/chrono.h>
 #include <fmt/compile.h>
@@ -10,8 +11,11 @@
 #include <userver/compiler/thread_local.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/datetime/tsc_clock.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
+#include <logging/binary_log_encoding.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging {
@@ -22,6 +26,7 @@ char GetSeparatorFromLogger(LoggerRef logger) {
     switch (logger.GetFormat()) {
         case Format::kTskv:
         case Format::kRaw:
+        case Format::kBinary:
             return '=';
         case Format::kLtsv:
             return ':';
@@ -81,6 +86,7 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s, std::stre
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(std::max(level, logger_->GetLevel())),
+      is_binary_(logger_->GetFormat() == Format::kBinary),
       key_value_separator_(GetSeparatorFromLogger(*logger_)) {
     static_assert(
         sizeof(LogHelper::Impl) < 4096,
@@ -98,7 +104,7 @@ void LogHelper::Impl::PutMessageBegin() {
     switch (logger_->GetFormat()) {
         case Format::kTskv: {
             constexpr std::string_view kTemplate = "tskv\ttimestamp=0000-00-00T00:00:00.000000\tlevel=";
-            const auto now = TimePoint::clock::now();
+            const auto now = utils::datetime::TscClock::WallNow();
             const auto level_string = logging::ToUpperCaseString(level_);
             msg_.resize(kTemplate.size() + level_string.size());
             fmt::format_to(
@@ -112,7 +118,7 @@ void LogHelper::Impl::PutMessageBegin() {
         }
         case Format::kLtsv: {
             constexpr std::string_view kTemplate = "timestamp:0000-00-00T00:00:00.000000\tlevel:";
-            const auto now = TimePoint::clock::now();
+            const auto now = utils::datetime::TscClock::WallNow();
             const auto level_string = logging::ToUpperCaseString(level_);
             msg_.resize(kTemplate.size() + level_string.size());
             fmt::format_to(
@@ -128,14 +134,36 @@ void LogHelper::Impl::PutMessageBegin() {
             msg_.append(std::string_view{"tskv"});
             return;
         }
+        case Format::kBinary: {
+            // No strftime and no level names, the decoder does that
+            const auto now = utils::datetime::TscClock::WallNow();
+            const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch());
+            // The record size is written in PutMessageEnd
+            msg_.resize(impl::binary::kRecordSizeBytes);
+            msg_.push_back(static_cast<char>(impl::binary::kVersion));
+            impl::binary::AppendVarint(msg_, static_cast<std::uint64_t>(timestamp.count()));
+            msg_.push_back(static_cast<char>(level_));
+            return;
+        }
     }
     UASSERT_MSG(false, "Invalid value of Format enum");
 }
 
-void LogHelper::Impl::PutMessageEnd() { msg_.push_back('\n'); }
+void LogHelper::Impl::PutMessageEnd() {
+    if (is_binary_) {
+        const auto payload_size = static_cast<std::uint32_t>(msg_.size() - impl::binary::kRecordSizeBytes);
+        for (std::size_t i = 0; i < impl::binary::kRecordSizeBytes; ++i) {
+            msg_.data()[i] = static_cast<char>((payload_size >> (i * 8)) & 0xff);
+        }
+        return;
+    }
+    msg_.push_back('\n');
+}
 
 void LogHelper::Impl::PutKey(std::string_view key) {
-    if (!utils::encoding::ShouldKeyBeEscaped(key)) {
+    if (is_binary_) {
+        PutBinaryKey(key);
+    } else if (!utils::encoding::ShouldKeyBeEscaped(key)) {
         PutRawKey(key);
     } else {
         UASSERT(!std::exchange(is_within_value_, true));
@@ -147,6 +175,11 @@ void LogHelper::Impl::PutKey(std::string_view key) {
 }
 
 void LogHelper::Impl::PutRawKey(std::string_view key) {
+    if (is_binary_) {
+        PutBinaryKey(key);
+        return;
+    }
+
     UASSERT(!std::exchange(is_within_value_, true));
     CheckRepeatedKeys(key);
     const auto old_size = msg_.size();
@@ -161,11 +194,19 @@ void LogHelper::Impl::PutRawKey(std::string_view key) {
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
     UASSERT(is_within_value_);
+    if (is_binary_) {
+        msg_.append(value);
+        return;
+    }
     utils::encoding::EncodeTskv(msg_, value, utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
     UASSERT(is_within_value_);
+    if (is_binary_) {
+        msg_.push_back(text_part);
+        return;
+    }
     utils::encoding::EncodeTskv(fmt::appender(msg_), text_part, utils::encoding::EncodeTskvMode::kValue);
 }
 
@@ -174,7 +215,10 @@ LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
     return msg_;
 }
 
-void LogHelper::Impl::MarkValueEnd() noexcept { UASSERT(std::exchange(is_within_value_, false)); }
+void LogHelper::Impl::MarkValueEnd() noexcept {
+    UASSERT(std::exchange(is_within_value_, false));
+    if (value_begin_ != 0) MarkBinaryValueEnd();
+}
 
 void LogHelper::Impl::MarkAsTrace() noexcept { is_trace_ = true; }
 
@@ -208,6 +252,42 @@ void LogHelper::Impl::MarkAsBroken() noexcept { logger_ = nullptr; }
 
 bool LogHelper::Impl::IsBroken() const noexcept { return !logger_; }
 
+void LogHelper::Impl::PutBinaryKey(std::string_view key) {
+    UASSERT(!std::exchange(is_within_value_, true));
+    CheckRepeatedKeys(key);
+
+    if (const auto id = impl::binary::FindWellKnownKeyId(key)) {
+        impl::binary::AppendVarint(msg_, (static_cast<std::uint64_t>(*id) << 1) | 1);
+    } else {
+        impl::binary::AppendVarint(msg_, static_cast<std::uint64_t>(key.size()) << 1);
+        msg_.append(key);
+    }
+
+    // Most of the values are shorter than 128 bytes, so a single byte is
+    // reserved for the size. Longer values are moved in MarkBinaryValueEnd.
+    msg_.push_back('\0');
+    value_begin_ = msg_.size();
+}
+
+void LogHelper::Impl::MarkBinaryValueEnd() noexcept {
+    UASSERT(value_begin_ != 0);
+    auto value_size = msg_.size() - value_begin_;
+    auto size_bytes = impl::binary::GetVarintSize(value_size);
+    if (size_bytes > 1) {
+        try {
+            msg_.resize(msg_.size() + size_bytes - 1);
+            std::memmove(msg_.data() + value_begin_ + size_bytes - 1, msg_.data() + value_begin_, value_size);
+        } catch (const std::bad_alloc&) {
+            // The value is truncated to fit the reserved byte
+            value_size = 0x7f;
+            size_bytes = 1;
+            msg_.resize(value_begin_ + value_size);
+        }
+    }
+    impl::binary::WriteVarint(msg_.data() + value_begin_ - 1, value_size);
+    value_begin_ = 0;
+}
+
 void LogHelper::Impl::CheckRepeatedKeys([[maybe_unused]] std::string_view raw_key) {
     UASSERT_MSG(
         debug_tag_keys_->insert(std::string{raw_key}).second, fmt::format("Repeated tag in logs: '{}'", raw_key)
@@ -37,7 +37,7 @@ public:
     void PutValuePart(char text_part);
     LogBuffer& GetBufferForRawValuePart() noexcept;
 
-    bool IsWithinValue() const noexcept { return is_within_value_; }
+    bool IsWithinValue() const noexcept { return is_within_value_ || value_begin_ != 0; }
     void MarkValueEnd() noexcept;
 
     LogExtra& GetLogExtra() { return extra_; }
@@ -80,13 +80,20 @@ private:
 
     void CheckRepeatedKeys(std::string_view raw_key);
 
+    void PutBinaryKey(std::string_view key);
+    void MarkBinaryValueEnd() noexcept;
+
     impl::LoggerBase* logger_;
     const Level level_;
+    const bool is_binary_;
     const char key_value_separator_;
     LogBuffer msg_;
     std::optional<LazyInitedStream> lazy_stream_;
     LogExtra extra_;
     std::size_t initial_length_{0};
+    // Start of the current value for Format::kBinary, its size is written
+    // right before it when the value ends
+    std::size_t value_begin_{0};
     bool is_within_value_{false};
     bool is_trace_{false};
     std::optional<std::unordered_set<std::string>> debug_tag_keys_;
@@ -1,7 +1,13 @@
 #include <userver/logging/stacktrace_cache.hpp>
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <fmt/format.h>
 #include <boost/functional/hash.hpp>
@@ -10,6 +16,7 @@
 #include <userver/cache/lru_map.hpp>
 #include <userver/compiler/thread_local.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
 
 namespace std {
 
@@ -30,6 +37,9 @@ namespace {
 
 constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
 
+constexpr std::size_t kMaxSymbolizedStacktraces = 1000;
+constexpr std::size_t kMaxPendingStacktraces = 100;
+
 std::atomic<bool> stacktrace_enabled{true};
 
 compiler::ThreadLocal local_frame_name_cache = [] {
@@ -50,6 +60,91 @@ const std::string& ToStringCachedFiltered(boost::stacktrace::frame frame) {
     return *ptr;
 }
 
+std::string AddressesToString(const boost::stacktrace::stacktrace& st) {
+    std::string res;
+    res.reserve(24 * st.size());
+
+    size_t i = 0;
+    for (const auto frame : st) {
+        if (i < 10) {
+            res += ' ';
+        }
+        res += fmt::to_string(i);
+        res += '#';
+        res += ' ';
+        res += fmt::format("{}", frame.address());
+        res += '\n';
+        i++;
+    }
+
+    return res;
+}
+
+// Symbolizes stacktraces on a dedicated thread, that is started on the first
+// use. Stacktraces are identified by the hash of their frames.
+class AsyncSymbolizer final {
+public:
+    AsyncSymbolizer() : symbolized_(kMaxSymbolizedStacktraces) {}
+
+    ~AsyncSymbolizer() {
+        {
+            const std::lock_guard lock{mutex_};
+            is_stopping_ = true;
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) thread_.join();
+    }
+
+    std::optional<std::string> TryGetOrSchedule(const boost::stacktrace::stacktrace& st) {
+        const auto hash = boost::stacktrace::hash_value(st);
+        {
+            const std::lock_guard lock{mutex_};
+            if (const auto* text = symbolized_.Get(hash)) return *text;
+            if (is_stopping_ || pending_.size() >= kMaxPendingStacktraces || !pending_hashes_.insert(hash).second) {
+                return std::nullopt;
+            }
+            pending_.emplace_back(hash, st);
+            if (!thread_.joinable()) thread_ = std::thread([this] { Run(); });
+        }
+        cv_.notify_one();
+        return std::nullopt;
+    }
+
+private:
+    void Run() {
+        utils::SetCurrentThreadName("stacktrace-sym");
+
+        std::unique_lock lock{mutex_};
+        while (true) {
+            cv_.wait(lock, [this] { return is_stopping_ || !pending_.empty(); });
+            if (is_stopping_) return;
+
+            auto [hash, st] = std::move(pending_.front());
+            pending_.pop_front();
+
+            lock.unlock();
+            auto text = to_string(st);
+            lock.lock();
+
+            symbolized_.Put(hash, std::move(text));
+            pending_hashes_.erase(hash);
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    cache::LruMap<std::size_t, std::string> symbolized_;
+    std::deque<std::pair<std::size_t, boost::stacktrace::stacktrace>> pending_;
+    std::unordered_set<std::size_t> pending_hashes_;
+    bool is_stopping_{false};
+    std::thread thread_;
+};
+
+AsyncSymbolizer& GetAsyncSymbolizer() {
+    static AsyncSymbolizer symbolizer;
+    return symbolizer;
+}
+
 }  // namespace
 
 std::string to_string(const boost::stacktrace::stacktrace& st) {
@@ -86,6 +181,16 @@ std::string to_string(const boost::stacktrace::stacktrace& st) {
     return res;
 }
 
+std::string to_string_async(const boost::stacktrace::stacktrace& st) {
+    if (!stacktrace_enabled.load()) {
+        return "<unknown>";
+    }
+
+    auto symbolized = GetAsyncSymbolizer().TryGetOrSchedule(st);
+    if (symbolized) return std::move(*symbolized);
+    return AddressesToString(st);
+}
+
 bool GlobalEnableStacktrace(bool enable) { return stacktrace_enabled.exchange(enable); }
 
 StacktraceGuard::StacktraceGuard(bool enabled) : old_(logging::stacktrace_cache::GlobalEnableStacktrace(enabled)) {}
@@ -0,0 +1,178 @@
+#include <userver/utils/datetime/tsc_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__) && defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define USERVER_IMPL_TSC_CLOCK_SUPPORTED
+#endif
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+namespace {
+
+constexpr auto kCalibrationPeriod = std::chrono::milliseconds{50};
+constexpr auto kWallSyncPeriod = std::chrono::milliseconds{10};
+
+// Nanoseconds per tick are stored as a fixed-point number
+constexpr int kMultiplierShift = 32;
+
+struct Calibration final {
+    std::uint64_t base_ticks{0};
+    std::int64_t base_ns{0};
+    std::uint64_t multiplier{0};
+};
+
+std::uint64_t ReadTsc() noexcept {
+#ifdef USERVER_IMPL_TSC_CLOCK_SUPPORTED
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+std::int64_t TicksToNanoseconds(std::int64_t ticks, std::uint64_t multiplier) noexcept {
+    return static_cast<std::int64_t>((static_cast<__int128>(ticks) * multiplier) >> kMultiplierShift);
+}
+
+std::int64_t ToNanoseconds(std::chrono::steady_clock::time_point time) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+struct ClockSample final {
+    std::uint64_t ticks{0};
+    std::int64_t ns{0};
+};
+
+// Brackets the TSC read with two steady_clock reads, so that a slow first
+// steady_clock call or a preemption does not skew the calibration
+ClockSample SampleClocks() noexcept {
+    const auto before_ns = ToNanoseconds(std::chrono::steady_clock::now());
+    const auto ticks = ReadTsc();
+    const auto after_ns = ToNanoseconds(std::chrono::steady_clock::now());
+    return {ticks, before_ns + (after_ns - before_ns) / 2};
+}
+
+bool IsTscReliable() noexcept {
+#ifdef USERVER_IMPL_TSC_CLOCK_SUPPORTED
+    // Invariant TSC runs at a constant rate in all the ACPI P-, C- and T-states
+    constexpr unsigned kInvariantTscBit = 1U << 8;
+    unsigned eax = 0;
+    unsigned ebx = 0;
+    unsigned ecx = 0;
+    unsigned edx = 0;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || !(edx & kInvariantTscBit)) return false;
+
+    // The kernel switches away from the TSC if it finds it unstable or not
+    // synchronized between the CPUs
+    try {
+        std::ifstream clocksource{"/sys/devices/system/clocksource/clocksource0/current_clocksource"};
+        std::string name;
+        clocksource >> name;
+        return name == "tsc";
+    } catch (const std::exception&) {
+        return false;
+    }
+#else
+    return false;
+#endif
+}
+
+class TscState final {
+public:
+    TscState() noexcept : enabled_(IsTscReliable()), start_(SampleClocks()) {}
+
+    const Calibration* Get() noexcept { return published_.load(std::memory_order_acquire); }
+
+    const Calibration* TryCalibrate(std::chrono::steady_clock::time_point steady_now) noexcept {
+        if (!enabled_) return nullptr;
+        if (ToNanoseconds(steady_now) - start_.ns < std::chrono::nanoseconds{kCalibrationPeriod}.count()) {
+            return nullptr;
+        }
+        if (calibrating_.exchange(true, std::memory_order_relaxed)) return Get();
+
+        const auto sample = SampleClocks();
+        // Should never happen with an invariant TSC, the clock stays on
+        // steady_clock forever
+        if (sample.ticks <= start_.ticks) return nullptr;
+
+        const auto elapsed_ns = static_cast<unsigned __int128>(sample.ns - start_.ns);
+        calibration_.base_ticks = sample.ticks;
+        calibration_.base_ns = sample.ns;
+        calibration_.multiplier =
+            static_cast<std::uint64_t>((elapsed_ns << kMultiplierShift) / (sample.ticks - start_.ticks));
+        published_.store(&calibration_, std::memory_order_release);
+        return &calibration_;
+    }
+
+private:
+    const bool enabled_;
+    const ClockSample start_;
+    std::atomic<bool> calibrating_{false};
+    Calibration calibration_;
+    std::atomic<const Calibration*> published_{nullptr};
+};
+
+TscState& GetTscState() noexcept {
+    static TscState state;
+    return state;
+}
+
+const Calibration* GetCalibration() noexcept {
+#ifdef USERVER_IMPL_TSC_CLOCK_SUPPORTED
+    auto& state = GetTscState();
+    if (const auto* calibration = state.Get()) return calibration;
+    return state.TryCalibrate(std::chrono::steady_clock::now());
+#else
+    return nullptr;
+#endif
+}
+
+struct WallAnchor final {
+    std::uint64_t ticks{0};
+    std::chrono::system_clock::time_point time{};
+};
+
+compiler::ThreadLocal local_wall_anchor = [] { return WallAnchor{}; };
+
+}  // namespace
+
+TscClock::time_point TscClock::now() noexcept {
+    const auto* calibration = GetCalibration();
+    if (!calibration) return time_point{std::chrono::steady_clock::now().time_since_epoch()};
+
+    const auto ticks = static_cast<std::int64_t>(ReadTsc() - calibration->base_ticks);
+    const std::chrono::nanoseconds ns{calibration->base_ns + TicksToNanoseconds(ticks, calibration->multiplier)};
+    return time_point{std::chrono::duration_cast<duration>(ns)};
+}
+
+std::chrono::system_clock::time_point TscClock::WallNow() noexcept {
+    const auto* calibration = GetCalibration();
+    if (!calibration) return std::chrono::system_clock::now();
+
+    const auto ticks = ReadTsc();
+    auto anchor = local_wall_anchor.Use();
+    const std::chrono::nanoseconds elapsed{
+        TicksToNanoseconds(static_cast<std::int64_t>(ticks - anchor->ticks), calibration->multiplier)};
+    // Resynchronizing picks up the NTP adjustments and the clock steps
+    if (anchor->ticks == 0 || elapsed < std::chrono::nanoseconds::zero() || elapsed >= kWallSyncPeriod) {
+        anchor->ticks = ticks;
+        anchor->time = std::chrono::system_clock::now();
+        return anchor->time;
+    }
+    return anchor->time + std::chrono::duration_cast<std::chrono::system_clock::duration>(elapsed);
+}
+
+bool TscClock::IsTscUsed() noexcept { return GetCalibration() != nullptr; }
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,30 @@
+#include <userver/utils/datetime/tsc_clock.hpp>
+
+#include <chrono>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+void tsc_clock_benchmark(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::TscClock::now());
+    }
+}
+BENCHMARK(tsc_clock_benchmark);
+
+void system_clock_benchmark(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(std::chrono::system_clock::now());
+    }
+}
+BENCHMARK(system_clock_benchmark);
+
+void tsc_clock_wall_benchmark(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::TscClock::WallNow());
+    }
+}
+BENCHMARK(tsc_clock_wall_benchmark);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,44 @@
+#include <userver/utils/datetime/tsc_clock.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kTolerance = std::chrono::milliseconds{20};
+
+}  // namespace
+
+TEST(TscClock, Monotonic) {
+    // Covers the switch from steady_clock to the TSC
+    const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds{100};
+    auto prev = utils::datetime::TscClock::now();
+    while (std::chrono::steady_clock::now() < until) {
+        const auto now = utils::datetime::TscClock::now();
+        ASSERT_LE(prev, now);
+        prev = now;
+    }
+}
+
+TEST(TscClock, MatchesSteadyClock) {
+    const auto start = utils::datetime::TscClock::now();
+    const auto steady_start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    const auto elapsed = utils::datetime::TscClock::now() - start;
+    const auto steady_elapsed = std::chrono::steady_clock::now() - steady_start;
+
+    EXPECT_LT(std::chrono::abs(elapsed - steady_elapsed), kTolerance);
+}
+
+TEST(TscClock, WallNow) {
+    for (int i = 0; i < 3; ++i) {
+        const auto wall = utils::datetime::TscClock::WallNow();
+        EXPECT_LT(std::chrono::abs(wall - std::chrono::system_clock::now()), kTolerance);
+        std::this_thread::sleep_for(std::chrono::milliseconds{15});
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -107,6 +107,32 @@ bool IsXDigit(unsigned char x_digit) noexcept {
 #ifdef __SSSE3__
 const auto kLow4BitsMask = _mm_set1_epi8(0xf);
 const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+__m128i InRange(__m128i chars, char first, char last) noexcept {
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8(last + 1))
+    );
+}
+
+/// Converts 16 hex characters into 8 bytes stored in the lowest half of
+/// `bytes`. Returns false if any of the characters is not a hex character.
+bool FromHex16(const char* encoded, __m128i& bytes) noexcept {
+    const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded));
+    const auto is_digit = InRange(chars, '0', '9');
+    // 'A'-'F' become 'a'-'f', digits are not affected
+    const auto lowercase = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const auto is_letter = InRange(lowercase, 'a', 'f');
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff) return false;
+
+    const auto values = _mm_or_si128(
+        _mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+        _mm_and_si128(is_letter, _mm_sub_epi8(lowercase, _mm_set1_epi8('a' - 10)))
+    );
+    // (high << 4) | low for each pair of characters
+    const auto pairs = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+    bytes = _mm_packus_epi16(pairs, pairs);
+    return true;
+}
 #endif
 
 }  // namespace detail
@@ -137,7 +163,27 @@ void ToHex(std::string_view input, std::string& out) noexcept {
     auto* dst = out.data();
 
 #ifdef __SSSE3__
-    while (last - first >= 8) {
+    while (last - first >= 16) {
+        const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+
+        // 4 high bits and 4 low bits of each byte
+        const auto high = _mm_and_si128(_mm_srli_epi64(data, 4), detail::kLow4BitsMask);
+        const auto low = _mm_and_si128(data, detail::kLow4BitsMask);
+
+        // interleave them into h4(b0), l4(b0), h4(b1), l4(b1), ... and gather
+        // kXdigits as specified by them
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(detail::kDigitsMask, _mm_unpacklo_epi8(high, low))
+        );
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(dst + 16), _mm_shuffle_epi8(detail::kDigitsMask, _mm_unpackhi_epi8(high, low))
+        );
+
+        first += 16;
+        dst += 32;
+    }
+
+    if (last - first >= 8) {
         // we only take 8 bytes because each byte transforms into 2 bytes
         // (first digit comes from 4 high bits, second comes from 4 low bits)
         const auto eight_bytes_of_data = _mm_loadu_si64(first);
@@ -186,6 +232,19 @@ size_t FromHex(std::string_view encoded, std::string& out) noexcept {
     const char* first = encoded.data();
     const char* pair_ptr = first;
     const char* last = first + encoded.size();
+    out.reserve(out.size() + FromHexUpperBound(encoded.size()));
+
+#ifdef __SSSE3__
+    for (; last - pair_ptr >= 16; pair_ptr += 16) {
+        __m128i bytes;
+        // the rest is processed pair by pair to find out where it ends
+        if (!detail::FromHex16(pair_ptr, bytes)) break;
+
+        alignas(16) char decoded[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(decoded), bytes);
+        out.append(decoded, 8);
+    }
+#endif
     for (; pair_ptr != last; pair_ptr += 2) {
         if (!detail::IsXDigit(pair_ptr[0])) {
             break;
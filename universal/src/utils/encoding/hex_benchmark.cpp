@@ -42,4 +42,26 @@ void to_hex_benchmark_no_alloc(benchmark::State& state) {
 }
 BENCHMARK(to_hex_benchmark_no_alloc)->RangeMultiplier(2)->Range(8, 512);
 
+void to_hex_benchmark_large(benchmark::State& state) {
+    const auto source = GenerateSource(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::encoding::ToHex(source));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(to_hex_benchmark_large)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+void from_hex_benchmark(benchmark::State& state) {
+    const auto encoded = utils::encoding::ToHex(GenerateSource(state.range(0)));
+
+    std::string out;
+    for ([[maybe_unused]] auto _ : state) {
+        out.clear();
+        benchmark::DoNotOptimize(utils::encoding::FromHex(encoded, out));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(from_hex_benchmark)->RangeMultiplier(16)->Range(64, 1 << 20);
+
 USERVER_NAMESPACE_END
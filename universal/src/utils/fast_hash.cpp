@@ -0,0 +1,112 @@
+#include <userver/utils/fast_hash.hpp>
+
+#include <cstring>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+// https://github.com/wangyi-fudan/wyhash
+constexpr std::uint64_t kSecret[4] = {
+    0x2d358dccaa6c78a5ull,
+    0x8bb84b93962eacc9ull,
+    0x4b33a62ed433d4a3ull,
+    0x4d5a2da51de1aa47ull,
+};
+
+// 128-bit product of `a` and `b`, the low half in `a` and the high half in `b`
+void Multiply(std::uint64_t& a, std::uint64_t& b) noexcept {
+#ifdef __SIZEOF_INT128__
+    const auto product = static_cast<unsigned __int128>(a) * b;
+    a = static_cast<std::uint64_t>(product);
+    b = static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t ha = a >> 32;
+    const std::uint64_t hb = b >> 32;
+    const std::uint64_t la = static_cast<std::uint32_t>(a);
+    const std::uint64_t lb = static_cast<std::uint32_t>(b);
+    const std::uint64_t rh = ha * hb;
+    const std::uint64_t rm0 = ha * lb;
+    const std::uint64_t rm1 = hb * la;
+    const std::uint64_t rl = la * lb;
+    const std::uint64_t t = rl + (rm0 << 32);
+    std::uint64_t carry = t < rl;
+    const std::uint64_t low = t + (rm1 << 32);
+    carry += low < t;
+    a = low;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+std::uint64_t Mix(std::uint64_t a, std::uint64_t b) noexcept {
+    Multiply(a, b);
+    return a ^ b;
+}
+
+std::uint64_t Read8(const unsigned char* p) noexcept {
+    std::uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+std::uint64_t Read4(const unsigned char* p) noexcept {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+std::uint64_t Read3(const unsigned char* p, std::size_t size) noexcept {
+    return (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[size >> 1]} << 8) | p[size - 1];
+}
+
+}  // namespace
+
+std::uint64_t FastHash(std::string_view data, std::uint64_t seed) noexcept {
+    const auto* p = reinterpret_cast<const unsigned char*>(data.data());
+    const auto size = data.size();
+    seed ^= Mix(seed ^ kSecret[0], kSecret[1]);
+
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    if (size <= 16) {
+        if (size >= 4) {
+            const auto offset = (size >> 3) << 2;
+            a = (Read4(p) << 32) | Read4(p + offset);
+            b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - offset);
+        } else if (size > 0) {
+            a = Read3(p, size);
+        }
+    } else {
+        auto remaining = size;
+        if (remaining > 48) {
+            auto seed1 = seed;
+            auto seed2 = seed;
+            do {
+                seed = Mix(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+                seed1 = Mix(Read8(p + 16) ^ kSecret[2], Read8(p + 24) ^ seed1);
+                seed2 = Mix(Read8(p + 32) ^ kSecret[3], Read8(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = Mix(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+            remaining -= 16;
+            p += 16;
+        }
+        a = Read8(p + remaining - 16);
+        b = Read8(p + remaining - 8);
+    }
+
+    a ^= kSecret[1];
+    b ^= seed;
+    Multiply(a, b);
+    return Mix(a ^ kSecret[0] ^ size, b ^ kSecret[1]);
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <string>
+
+#include <userver/utils/fast_hash.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string GenerateKey(std::size_t size) {
+    std::string result;
+    result.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) result.push_back('a' + i % 26);
+    return result;
+}
+
+}  // namespace
+
+void fast_hash(benchmark::State& state) {
+    const auto key = GenerateKey(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::FastHash(key));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fast_hash)->RangeMultiplier(4)->Range(4, 4096);
+
+void std_hash(benchmark::State& state) {
+    const auto key = GenerateKey(state.range(0));
+    const std::hash<std::string_view> hash;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(hash(key));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(std_hash)->RangeMultiplier(4)->Range(4, 4096);
+
+void sip_hash(benchmark::State& state) {
+    const auto key = GenerateKey(state.range(0));
+    const utils::StrCaseHash hash;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(hash(key));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sip_hash)->RangeMultiplier(4)->Range(4, 4096);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <userver/utils/fast_hash.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/cached_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(FastHash, Deterministic) {
+    EXPECT_EQ(utils::FastHash("some key"), utils::FastHash("some key"));
+    EXPECT_EQ(utils::FastHash("some key", 42), utils::FastHash("some key", 42));
+    EXPECT_NE(utils::FastHash("some key", 1), utils::FastHash("some key", 2));
+    EXPECT_NE(utils::FastHash(""), utils::FastHash(std::string_view{"\0", 1}));
+}
+
+TEST(FastHash, AllLengths) {
+    // covers all the branches of the implementation
+    std::string data;
+    std::unordered_set<std::uint64_t> hashes;
+    for (int i = 0; i < 200; ++i) {
+        hashes.insert(utils::FastHash(data));
+        data.push_back(static_cast<char>('a' + i % 26));
+    }
+    EXPECT_EQ(hashes.size(), 200);
+}
+
+TEST(FastHash, NoCollisions) {
+    std::unordered_set<std::uint64_t> hashes;
+    constexpr int kKeysCount = 100'000;
+    for (int i = 0; i < kKeysCount; ++i) {
+        hashes.insert(utils::FastHash("key-" + std::to_string(i)));
+    }
+    EXPECT_EQ(hashes.size(), kKeysCount);
+}
+
+TEST(FastHash, UnorderedMap) {
+    std::unordered_map<std::string, int, utils::FastStringHash> map;
+    map["foo"] = 1;
+    map["bar"] = 2;
+    EXPECT_EQ(map.at("foo"), 1);
+    EXPECT_EQ(map.at("bar"), 2);
+    EXPECT_EQ(map.count("baz"), 0);
+}
+
+TEST(FastHash, CachedHash) {
+    const auto cached = utils::MakeCachedHash(std::string{"key"}, utils::FastStringHash{});
+    EXPECT_EQ(cached.hash, utils::FastHash("key"));
+    EXPECT_EQ(cached.key, "key");
+
+    const auto default_cached = utils::MakeCachedHash(42);
+    EXPECT_EQ(default_cached.hash, std::hash<int>{}(42));
+}
+
+USERVER_NAMESPACE_END
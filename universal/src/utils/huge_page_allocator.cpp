@@ -0,0 +1,57 @@
+#include <userver/utils/huge_page_allocator.hpp>
+
+#include <sys/mman.h>
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace {
+
+constexpr std::size_t RoundUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+void* AllocateHugePageAware(std::size_t bytes, std::size_t alignment) {
+    if (bytes < kHugePageSize || alignment > kHugePageSize) {
+        return ::operator new(bytes, std::align_val_t{alignment});
+    }
+
+    const auto size = RoundUp(bytes, kHugePageSize);
+    // mmap only guarantees the alignment of the regular pages, the excess is
+    // unmapped right away
+    const auto mapping_size = size + kHugePageSize;
+    void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) throw std::bad_alloc();
+
+    const auto mapping_begin = reinterpret_cast<std::uintptr_t>(mapping);
+    const auto begin = RoundUp(mapping_begin, kHugePageSize);
+    if (begin != mapping_begin) ::munmap(mapping, begin - mapping_begin);
+    const auto end = begin + size;
+    const auto mapping_end = mapping_begin + mapping_size;
+    if (end != mapping_end) ::munmap(reinterpret_cast<void*>(end), mapping_end - end);
+
+    auto* const ptr = reinterpret_cast<void*>(begin);
+#ifdef MADV_HUGEPAGE
+    // Failure means that the huge pages are disabled, the memory still works
+    ::madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+    return ptr;
+}
+
+void DeallocateHugePageAware(void* ptr, std::size_t bytes, std::size_t alignment) noexcept {
+    if (bytes < kHugePageSize || alignment > kHugePageSize) {
+        ::operator delete(ptr, std::align_val_t{alignment});
+        return;
+    }
+
+    ::munmap(ptr, RoundUp(bytes, kHugePageSize));
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#include <userver/utils/huge_page_allocator.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(HugePageAllocator, SmallAllocations) {
+    std::vector<int, utils::HugePageAllocator<int>> values;
+    for (int i = 0; i < 1000; ++i) values.push_back(i);
+    EXPECT_EQ(values[999], 999);
+}
+
+TEST(HugePageAllocator, BigAllocations) {
+    std::vector<std::uint64_t, utils::HugePageAllocator<std::uint64_t>> values(1024 * 1024, 42);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.data()) % utils::impl::kHugePageSize, 0u);
+    EXPECT_EQ(values.back(), 42u);
+
+    values.resize(3 * 1024 * 1024, 1);
+    EXPECT_EQ(values.front(), 42u);
+    EXPECT_EQ(values.back(), 1u);
+}
+
+TEST(HugePageAllocator, HashMap) {
+    using Map = std::unordered_map<
+        int,
+        int,
+        std::hash<int>,
+        std::equal_to<>,
+        utils::HugePageAllocator<std::pair<const int, int>>>;
+    Map map;
+    map.reserve(1024 * 1024);
+    for (int i = 0; i < 1000; ++i) map.emplace(i, i * 2);
+    EXPECT_EQ(map.at(500), 1000);
+}
+
+USERVER_NAMESPACE_END
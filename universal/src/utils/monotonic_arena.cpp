@@ -0,0 +1,80 @@
+#include <userver/utils/monotonic_arena.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kMinBlockSize = 1024;
+constexpr std::size_t kMaxBlockSize = 64 * 1024;
+
+}  // namespace
+
+struct alignas(std::max_align_t) MonotonicArena::BlockHeader final {
+    BlockHeader* next;
+    std::size_t size;
+};
+
+MonotonicArena::MonotonicArena() noexcept : next_block_size_(kMinBlockSize) {}
+
+MonotonicArena::MonotonicArena(void* buffer, std::size_t size) noexcept
+    : initial_buffer_(static_cast<char*>(buffer)),
+      initial_size_(size),
+      current_(initial_buffer_),
+      end_(initial_buffer_ + size),
+      next_block_size_(std::clamp(size * 2, kMinBlockSize, kMaxBlockSize)) {}
+
+MonotonicArena::~MonotonicArena() { Release(); }
+
+void MonotonicArena::Release() noexcept {
+    while (blocks_) {
+        auto* next = blocks_->next;
+        ::operator delete(blocks_);
+        blocks_ = next;
+    }
+
+    current_ = initial_buffer_;
+    end_ = initial_buffer_ + initial_size_;
+    next_block_size_ = std::clamp(initial_size_ * 2, kMinBlockSize, kMaxBlockSize);
+    heap_bytes_ = 0;
+}
+
+void* MonotonicArena::AllocateSlow(std::size_t size, std::size_t alignment) {
+    // Over-aligned requests may need up to `alignment` extra bytes
+    const auto extra = alignment > alignof(BlockHeader) ? alignment : 0;
+    if (size > std::numeric_limits<std::size_t>::max() - sizeof(BlockHeader) - extra) {
+        throw std::bad_alloc();
+    }
+
+    const auto block_size = std::max(next_block_size_, sizeof(BlockHeader) + extra + size);
+    auto* block = static_cast<BlockHeader*>(::operator new(block_size));
+    block->next = blocks_;
+    block->size = block_size;
+    blocks_ = block;
+    heap_bytes_ += block_size;
+
+    // Huge requests get a dedicated block and keep the current block for the
+    // subsequent allocations
+    const bool is_dedicated = block_size > next_block_size_;
+    if (!is_dedicated) {
+        next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+    }
+
+    auto* data = reinterpret_cast<char*>(block + 1);
+    const auto aligned = (reinterpret_cast<std::uintptr_t>(data) + alignment - 1) & ~(alignment - 1);
+    auto* result = reinterpret_cast<char*>(aligned);
+    UASSERT(result + size <= reinterpret_cast<char*>(block) + block_size);
+
+    if (!is_dedicated) {
+        current_ = result + size;
+        end_ = reinterpret_cast<char*>(block) + block_size;
+    }
+    return result;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,129 @@
+#include <userver/utils/monotonic_arena.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/arena_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool IsAligned(const void* ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(MonotonicArena, InlineBuffer) {
+    utils::InlineMonotonicArena<256> arena;
+
+    auto* a = arena.Allocate(1, 1);
+    auto* b = arena.Allocate(8, 8);
+    auto* c = arena.Allocate(3, 1);
+    auto* d = arena.Allocate(16, 16);
+
+    EXPECT_TRUE(IsAligned(b, 8));
+    EXPECT_TRUE(IsAligned(d, 16));
+    EXPECT_LT(a, b);
+    EXPECT_LT(b, c);
+    EXPECT_LT(c, d);
+    EXPECT_EQ(arena.GetHeapBytes(), 0);
+
+    arena.Allocate(512);
+    EXPECT_GT(arena.GetHeapBytes(), 0);
+
+    arena.Release();
+    EXPECT_EQ(arena.GetHeapBytes(), 0);
+    EXPECT_EQ(arena.Allocate(1, 1), a);
+}
+
+TEST(MonotonicArena, HeapBlocks) {
+    utils::MonotonicArena arena;
+
+    std::vector<char*> allocations;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        auto* ptr = static_cast<char*>(arena.Allocate(i % 100 + 1, alignof(std::uint64_t)));
+        EXPECT_TRUE(IsAligned(ptr, alignof(std::uint64_t)));
+        std::fill(ptr, ptr + i % 100 + 1, static_cast<char>(i));
+        allocations.push_back(ptr);
+    }
+
+    for (std::size_t i = 0; i < allocations.size(); ++i) {
+        EXPECT_EQ(allocations[i][i % 100], static_cast<char>(i));
+    }
+}
+
+TEST(MonotonicArena, HugeAllocations) {
+    utils::InlineMonotonicArena<64> arena;
+
+    auto* small = static_cast<char*>(arena.Allocate(8));
+    auto* huge = static_cast<char*>(arena.Allocate(1024 * 1024, 64));
+    EXPECT_TRUE(IsAligned(huge, 64));
+    huge[1024 * 1024 - 1] = 'x';
+
+    // Huge allocations do not waste the current block
+    auto* next = static_cast<char*>(arena.Allocate(8));
+    EXPECT_EQ(next, small + 16);
+}
+
+TEST(ArenaAllocator, Containers) {
+    /// [Sample ArenaAllocator]
+    utils::InlineMonotonicArena<1024> arena;
+
+    using Allocator = utils::ArenaAllocator<std::pair<const std::string, int>>;
+    std::unordered_map<std::string, int, std::hash<std::string>, std::equal_to<>, Allocator> map{
+        0, std::hash<std::string>{}, std::equal_to<>{}, Allocator{arena}};
+
+    map.emplace("first", 1);
+    map.emplace("second", 2);
+    /// [Sample ArenaAllocator]
+
+    EXPECT_EQ(map.at("first"), 1);
+    EXPECT_EQ(map.at("second"), 2);
+    EXPECT_EQ(arena.GetHeapBytes(), 0);
+    EXPECT_EQ(map.get_allocator(), utils::ArenaAllocator<int>{arena});
+}
+
+TEST(ArenaAllocator, SmallVector) {
+    /// [Sample ArenaSmallVector]
+    utils::MonotonicArena arena;
+    using Vector = utils::ArenaSmallVector<int, 4>;
+    Vector values{Vector::allocator_type{utils::ArenaAllocator<int>{arena}}};
+
+    values.push_back(1);
+    values.push_back(2);
+    EXPECT_EQ(arena.GetHeapBytes(), 0);
+    /// [Sample ArenaSmallVector]
+
+    for (int i = 3; i <= 100; ++i) values.push_back(i);
+    EXPECT_GT(arena.GetHeapBytes(), 0);
+    EXPECT_EQ(values.size(), 100);
+    EXPECT_EQ(values.front(), 1);
+    EXPECT_EQ(values.back(), 100);
+}
+
+TEST(ArenaAllocator, SmallFlatMap) {
+    utils::MonotonicArena arena;
+    using Map = utils::ArenaSmallFlatMap<std::string, std::size_t, 2>;
+    Map map{Map::allocator_type{utils::ArenaAllocator<void>{arena}}};
+
+    map["b"] = 1;
+    map["a"] = 0;
+    map["c"] = 2;
+
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map.begin()->first, "a");
+
+    const auto it = map.find(std::string_view{"c"});
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, 2);
+    EXPECT_EQ(map.find(std::string_view{"d"}), map.end());
+}
+
+USERVER_NAMESPACE_END
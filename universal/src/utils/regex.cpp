@@ -1,13 +1,267 @@
 #include <userver/utils/regex.hpp>
 
+#include <algorithm>
 #include <iterator>
-
+#include <memory>
+#include <stdexcept>
+
+#ifdef USERVER_IMPL_FEATURE_RE2
+#include <fmt/format.h>
+#include <re2/re2.h>
+#include <re2/set.h>
+#else
 #include <boost/regex.hpp>
+#endif
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+#ifdef USERVER_IMPL_FEATURE_RE2
+
+namespace {
+
+re2::StringPiece ToStringPiece(std::string_view str) noexcept { return {str.data(), str.size()}; }
+
+re2::RE2::Options MakeOptions() {
+    re2::RE2::Options options;
+    options.set_log_errors(false);
+    return options;
+}
+
+std::shared_ptr<const re2::RE2> Compile(std::string_view pattern) {
+    auto result = std::make_shared<const re2::RE2>(ToStringPiece(pattern), MakeOptions());
+    if (!result->ok()) {
+        throw std::runtime_error(fmt::format("Invalid regular expression '{}': {}", pattern, result->error()));
+    }
+    return result;
+}
+
+const std::shared_ptr<const re2::RE2>& GetEmptyRegex() {
+    static const auto kEmpty = Compile({});
+    return kEmpty;
+}
+
+using Groups = std::vector<re2::StringPiece>;
+
+bool DoMatch(std::string_view str, const re2::RE2& pattern, re2::RE2::Anchor anchor, Groups& groups) {
+    groups.assign(pattern.NumberOfCapturingGroups() + 1, re2::StringPiece{});
+    const auto text = ToStringPiece(str);
+    return pattern.Match(text, 0, text.size(), anchor, groups.data(), static_cast<int>(groups.size()));
+}
+
+bool DoMatch(std::string_view str, const re2::RE2& pattern, re2::RE2::Anchor anchor) {
+    const auto text = ToStringPiece(str);
+    return pattern.Match(text, 0, text.size(), anchor, nullptr, 0);
+}
+
+// Supports the `$&`, `$N`, `${N}` and `$$` placeholders of the boost::regex
+// default (perl) format
+void AppendReplacement(std::string& res, std::string_view repl, const Groups& groups) {
+    const auto append_group = [&](std::size_t index) {
+        if (index < groups.size()) res.append(groups[index].data(), groups[index].size());
+    };
+    const auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+
+    for (std::size_t i = 0; i < repl.size(); ++i) {
+        if (repl[i] != '$' || i + 1 == repl.size()) {
+            res.push_back(repl[i]);
+            continue;
+        }
+
+        const char next = repl[i + 1];
+        if (next == '$') {
+            res.push_back('$');
+            ++i;
+        } else if (next == '&') {
+            append_group(0);
+            ++i;
+        } else if (is_digit(next)) {
+            std::size_t index = 0;
+            while (i + 1 < repl.size() && is_digit(repl[i + 1])) {
+                index = index * 10 + (repl[i + 1] - '0');
+                ++i;
+            }
+            append_group(index);
+        } else if (next == '{' && repl.find('}', i + 2) != std::string_view::npos) {
+            const auto close = repl.find('}', i + 2);
+            const auto digits = repl.substr(i + 2, close - i - 2);
+            if (digits.empty() || !std::all_of(digits.begin(), digits.end(), is_digit)) {
+                res.push_back('$');
+                continue;
+            }
+            std::size_t index = 0;
+            for (const char c : digits) index = index * 10 + (c - '0');
+            append_group(index);
+            i = close;
+        } else {
+            res.push_back('$');
+        }
+    }
+}
+
+}  // namespace
+
+struct regex::Impl {
+    std::shared_ptr<const re2::RE2> r;
+
+    Impl() : r(GetEmptyRegex()) {}
+    explicit Impl(std::string_view pattern) : r(Compile(pattern)) {}
+};
+
+regex::regex() = default;
+
+regex::regex(std::string_view pattern) : impl_(regex::Impl(pattern)) {}
+
+regex::~regex() = default;
+
+regex::regex(const regex&) = default;
+
+regex::regex(regex&& r) noexcept { impl_->r.swap(r.impl_->r); }
+
+regex& regex::operator=(const regex&) = default;
+
+regex& regex::operator=(regex&& r) noexcept {
+    impl_->r.swap(r.impl_->r);
+    return *this;
+}
+
+bool regex::operator==(const regex& other) const { return impl_->r->pattern() == other.impl_->r->pattern(); }
+
+std::string regex::str() const { return impl_->r->pattern(); }
+
+////////////////////////////////////////////////////////////////
+
+struct match_results::Impl {
+    Groups groups;
+
+    Impl() = default;
+};
+
+match_results::match_results() = default;
+
+match_results::~match_results() = default;
+
+match_results::match_results(const match_results&) = default;
+
+match_results& match_results::operator=(const match_results&) = default;
+
+std::size_t match_results::size() const { return impl_->groups.size(); }
+
+std::string_view match_results::operator[](int sub) const {
+    const auto& group = impl_->groups[sub];
+    return {group.data(), group.size()};
+}
+
+////////////////////////////////////////////////////////////////
+
+bool regex_match(std::string_view str, const regex& pattern) {
+    return DoMatch(str, *pattern.impl_->r, re2::RE2::ANCHOR_BOTH);
+}
+
+bool regex_match(std::string_view str, match_results& m, const regex& pattern) {
+    return DoMatch(str, *pattern.impl_->r, re2::RE2::ANCHOR_BOTH, m.impl_->groups);
+}
+
+bool regex_search(std::string_view str, const regex& pattern) {
+    return DoMatch(str, *pattern.impl_->r, re2::RE2::UNANCHORED);
+}
+
+bool regex_search(std::string_view str, match_results& m, const regex& pattern) {
+    return DoMatch(str, *pattern.impl_->r, re2::RE2::UNANCHORED, m.impl_->groups);
+}
+
+std::string regex_replace(std::string_view str, const regex& pattern, std::string_view repl) {
+    std::string res;
+    res.reserve(str.size() + str.size() / 4);
+
+    const auto& r = *pattern.impl_->r;
+    const auto text = ToStringPiece(str);
+    Groups groups(r.NumberOfCapturingGroups() + 1);
+
+    std::size_t pos = 0;
+    while (pos <= str.size() &&
+           r.Match(text, pos, text.size(), re2::RE2::UNANCHORED, groups.data(), static_cast<int>(groups.size()))) {
+        const auto match_begin = static_cast<std::size_t>(groups[0].data() - text.data());
+        const auto match_end = match_begin + groups[0].size();
+        res.append(str.substr(pos, match_begin - pos));
+        AppendReplacement(res, repl, groups);
+
+        if (match_end == match_begin) {
+            // Step over a character after an empty match, as boost::regex does
+            if (match_end < str.size()) res.push_back(str[match_end]);
+            pos = match_end + 1;
+        } else {
+            pos = match_end;
+        }
+    }
+    if (pos < str.size()) res.append(str.substr(pos));
+
+    return res;
+}
+
+////////////////////////////////////////////////////////////////
+
+namespace {
+
+std::unique_ptr<re2::RE2::Set> CompileSet(const std::vector<std::string>& patterns, re2::RE2::Anchor anchor) {
+    auto set = std::make_unique<re2::RE2::Set>(MakeOptions(), anchor);
+    for (const auto& pattern : patterns) {
+        std::string error;
+        if (set->Add(ToStringPiece(pattern), &error) < 0) {
+            throw std::runtime_error(fmt::format("Invalid regular expression '{}': {}", pattern, error));
+        }
+    }
+    if (!set->Compile()) throw std::runtime_error("Not enough memory to compile the set of regular expressions");
+    return set;
+}
+
+bool DoMatch(std::string_view str, const re2::RE2::Set& set, std::vector<std::size_t>& matched) {
+    std::vector<int> indices;
+    const bool is_matched = set.Match(ToStringPiece(str), &indices);
+    matched.assign(indices.begin(), indices.end());
+    std::sort(matched.begin(), matched.end());
+    return is_matched;
+}
+
+}  // namespace
+
+struct regex_set::Impl {
+    std::unique_ptr<re2::RE2::Set> match_set;
+    std::unique_ptr<re2::RE2::Set> search_set;
+    std::size_t size;
+
+    explicit Impl(const std::vector<std::string>& patterns)
+        : match_set(CompileSet(patterns, re2::RE2::ANCHOR_BOTH)),
+          search_set(CompileSet(patterns, re2::RE2::UNANCHORED)),
+          size(patterns.size()) {}
+};
+
+regex_set::regex_set(const std::vector<std::string>& patterns) : impl_(patterns) {}
+
+std::size_t regex_set::size() const noexcept { return impl_->size; }
+
+bool regex_match(std::string_view str, const regex_set& patterns) {
+    // RE2::Set fails to match an empty set
+    return patterns.impl_->size != 0 && patterns.impl_->match_set->Match(ToStringPiece(str), nullptr);
+}
+
+bool regex_match(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched) {
+    matched.clear();
+    return patterns.impl_->size != 0 && DoMatch(str, *patterns.impl_->match_set, matched);
+}
+
+bool regex_search(std::string_view str, const regex_set& patterns) {
+    return patterns.impl_->size != 0 && patterns.impl_->search_set->Match(ToStringPiece(str), nullptr);
+}
+
+bool regex_search(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched) {
+    matched.clear();
+    return patterns.impl_->size != 0 && DoMatch(str, *patterns.impl_->search_set, matched);
+}
+
+#else
+
 struct regex::Impl {
     boost::regex r;
 
@@ -86,6 +340,62 @@ std::string regex_replace(std::string_view str, const regex& pattern, std::strin
     return res;
 }
 
+////////////////////////////////////////////////////////////////
+
+// boost::regex has no set matching, the patterns are tried one by one
+struct regex_set::Impl {
+    std::vector<boost::regex> regexes;
+
+    explicit Impl(const std::vector<std::string>& patterns) {
+        regexes.reserve(patterns.size());
+        for (const auto& pattern : patterns) regexes.emplace_back(pattern);
+    }
+};
+
+regex_set::regex_set(const std::vector<std::string>& patterns) : impl_(patterns) {}
+
+std::size_t regex_set::size() const noexcept { return impl_->regexes.size(); }
+
+bool regex_match(std::string_view str, const regex_set& patterns) {
+    const auto& regexes = patterns.impl_->regexes;
+    return std::any_of(regexes.begin(), regexes.end(), [str](const boost::regex& r) {
+        return boost::regex_match(str.begin(), str.end(), r);
+    });
+}
+
+bool regex_match(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched) {
+    matched.clear();
+    const auto& regexes = patterns.impl_->regexes;
+    for (std::size_t i = 0; i < regexes.size(); ++i) {
+        if (boost::regex_match(str.begin(), str.end(), regexes[i])) matched.push_back(i);
+    }
+    return !matched.empty();
+}
+
+bool regex_search(std::string_view str, const regex_set& patterns) {
+    const auto& regexes = patterns.impl_->regexes;
+    return std::any_of(regexes.begin(), regexes.end(), [str](const boost::regex& r) {
+        return boost::regex_search(str.begin(), str.end(), r);
+    });
+}
+
+bool regex_search(std::string_view str, const regex_set& patterns, std::vector<std::size_t>& matched) {
+    matched.clear();
+    const auto& regexes = patterns.impl_->regexes;
+    for (std::size_t i = 0; i < regexes.size(); ++i) {
+        if (boost::regex_search(str.begin(), str.end(), regexes[i])) matched.push_back(i);
+    }
+    return !matched.empty();
+}
+
+#endif
+
+regex_set::~regex_set() = default;
+
+regex_set::regex_set(regex_set&&) noexcept = default;
+
+regex_set& regex_set::operator=(regex_set&&) noexcept = default;
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/utils/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kEmailPattern = R"([a-z0-9._%+-]+@[a-z0-9.-]+\.[a-z]{2,})";
+constexpr std::string_view kPathPattern = R"(/v[0-9]+/users/([0-9]+)/orders/([a-z0-9-]+))";
+
+std::vector<std::string> GenerateRoutePatterns(std::size_t count) {
+    std::vector<std::string> patterns;
+    patterns.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        patterns.push_back(fmt::format(R"(/v1/service{}/[a-z]+/[0-9]+)", i));
+    }
+    return patterns;
+}
+
+}  // namespace
+
+void regex_match_email(benchmark::State& state) {
+    const utils::regex r{kEmailPattern};
+    const std::string str = "some.user+tag@mail.example.com";
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::regex_match(str, r));
+    }
+}
+BENCHMARK(regex_match_email);
+
+void regex_match_with_groups(benchmark::State& state) {
+    const utils::regex r{kPathPattern};
+    const std::string str = "/v2/users/1234567/orders/abc-def-42";
+    utils::match_results m;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::regex_match(str, m, r));
+    }
+}
+BENCHMARK(regex_match_with_groups);
+
+void regex_search_long(benchmark::State& state) {
+    const utils::regex r{kEmailPattern};
+    const std::string str = std::string(state.range(0), 'x') + " user@example.com";
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::regex_search(str, r));
+    }
+}
+BENCHMARK(regex_search_long)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+void regex_replace_words(benchmark::State& state) {
+    const utils::regex r{"[0-9]+"};
+    const std::string str = "id=123, count=45, offset=6789, limit=10";
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::regex_replace(str, r, "N"));
+    }
+}
+BENCHMARK(regex_replace_words);
+
+void regex_match_each_route(benchmark::State& state) {
+    std::vector<utils::regex> regexes;
+    for (const auto& pattern : GenerateRoutePatterns(state.range(0))) regexes.emplace_back(pattern);
+    const auto str = fmt::format("/v1/service{}/orders/42", state.range(0) - 1);
+
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto& r : regexes) {
+            benchmark::DoNotOptimize(utils::regex_match(str, r));
+        }
+    }
+}
+BENCHMARK(regex_match_each_route)->RangeMultiplier(4)->Range(4, 1024);
+
+void regex_match_route_set(benchmark::State& state) {
+    const utils::regex_set set{GenerateRoutePatterns(state.range(0))};
+    const auto str = fmt::format("/v1/service{}/orders/42", state.range(0) - 1);
+    std::vector<std::size_t> matched;
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::regex_match(str, set, matched));
+    }
+}
+BENCHMARK(regex_match_route_set)->RangeMultiplier(4)->Range(4, 1024);
+
+USERVER_NAMESPACE_END
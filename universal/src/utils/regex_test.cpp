@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include <userver/utils/regex.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -76,4 +79,50 @@ TEST(Regex, MatchWithResult) {
     EXPECT_EQ(res, str);
 }
 
+TEST(Regex, ReplaceWithGroups) {
+    utils::regex r("([a-z]+)=([0-9]+)");
+    EXPECT_EQ(utils::regex_replace("a=1, bc=23", r, "$2:$1"), "1:a, 23:bc");
+    EXPECT_EQ(utils::regex_replace("a=1", r, "[$&]"), "[a=1]");
+}
+
+TEST(RegexSet, Empty) {
+    const utils::regex_set set{{}};
+    std::vector<std::size_t> matched{42};
+    EXPECT_EQ(set.size(), 0);
+    EXPECT_FALSE(utils::regex_match("abc", set));
+    EXPECT_FALSE(utils::regex_search("abc", set, matched));
+    EXPECT_TRUE(matched.empty());
+}
+
+TEST(RegexSet, Match) {
+    const utils::regex_set set{{"/v1/[a-z]+", "/v1/users", "/v2/.*"}};
+    std::vector<std::size_t> matched;
+    EXPECT_EQ(set.size(), 3);
+
+    EXPECT_TRUE(utils::regex_match("/v1/users", set, matched));
+    EXPECT_EQ(matched, (std::vector<std::size_t>{0, 1}));
+
+    EXPECT_TRUE(utils::regex_match("/v2/users/42", set, matched));
+    EXPECT_EQ(matched, std::vector<std::size_t>{2});
+
+    EXPECT_FALSE(utils::regex_match("/v1/users/42", set, matched));
+    EXPECT_TRUE(matched.empty());
+    EXPECT_FALSE(utils::regex_match("/v1/users/42", set));
+    EXPECT_TRUE(utils::regex_match("/v1/orders", set));
+}
+
+TEST(RegexSet, Search) {
+    const utils::regex_set set{{"[0-9]{3}", "^id", "x$"}};
+    std::vector<std::size_t> matched;
+
+    EXPECT_TRUE(utils::regex_search("id-123", set, matched));
+    EXPECT_EQ(matched, (std::vector<std::size_t>{0, 1}));
+
+    EXPECT_TRUE(utils::regex_search("box", set));
+    EXPECT_FALSE(utils::regex_search("no-id-12", set, matched));
+    EXPECT_TRUE(matched.empty());
+}
+
+TEST(RegexSet, Invalid) { EXPECT_ANY_THROW(utils::regex_set({"(unclosed"})); }
+
 USERVER_NAMESPACE_END
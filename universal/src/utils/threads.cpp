@@ -17,6 +17,7 @@
 #endif
 
 #include <algorithm>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -74,6 +75,26 @@ void SetCurrentThreadLowPriorityScheduling() {
     utils::CheckSyscall(::setpriority(PRIO_PROCESS, 0, kLowPriority), "setting thread scheduling parameters");
 }
 
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus) {
+#ifdef __linux__
+    if (cpus.empty()) return;
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            throw std::runtime_error(fmt::format("CPU index {} is out of range, max is {}", cpu, CPU_SETSIZE - 1));
+        }
+        CPU_SET(cpu, &cpu_set);
+    }
+
+    static constexpr ::pid_t kThisThreadPid = 0;
+    utils::CheckSyscall(::sched_setaffinity(kThisThreadPid, sizeof(cpu_set), &cpu_set), "setting thread CPU affinity");
+#else
+    (void)cpus;
+#endif
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -112,6 +112,8 @@ constexpr int kHugeTrivialBiMapValues[] = {
 
 constexpr auto kHugeTrivialBiMapAlt = utils::MakeTrivialBiMap<kHugeTrivialBiMapKeys, kHugeTrivialBiMapValues>();
 
+constexpr utils::TrivialHashBiMap<kHugeTrivialBiMap> kHugeTrivialHashBiMap;
+
 const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_hello", 1}, {"aaaaaaaaaaaaaaaa_world", 2}, {"aaaaaaaaaaaaaaaa_a", 3},
     {"aaaaaaaaaaaaaaaa_b", 4},     {"aaaaaaaaaaaaaaaa_c", 5},     {"aaaaaaaaaaaaaaaa_d", 6},
@@ -397,6 +399,35 @@ void MappingHugeTrivialBiMapZip(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeTrivialBiMapZip);
 
+void MappingHugeTrivialHashBiMap(benchmark::State& state) {
+    auto hello = MyLaunder("aaaaaaaaaaaaaaaa_hello");
+    auto world = MyLaunder("aaaaaaaaaaaaaaaa_world");
+    auto a = MyLaunder("aaaaaaaaaaaaaaaa_a");
+    auto b = MyLaunder("aaaaaaaaaaaaaaaa_b");
+    auto c = MyLaunder("aaaaaaaaaaaaaaaa_c");
+
+    auto d = MyLaunder("aaaaaaaaaaaaaaaa_d");
+    auto e = MyLaunder("aaaaaaaaaaaaaaaa_e");
+    auto f9 = MyLaunder("aaaaaaaaaaaaaaaa_f9");
+    auto z = MyLaunder("aaaaaaaaaaaaaaaa_z");
+    auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(hello));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(world));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(a));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(b));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(c));
+
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(d));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(e));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(f9));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(z));
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(z9));
+    }
+}
+BENCHMARK(MappingHugeTrivialHashBiMap);
+
 void MappingHugeUnordered(benchmark::State& state) {
     auto hello = MyLaunder("aaaaaaaaaaaaaaaa_hello");
     auto world = MyLaunder("aaaaaaaaaaaaaaaa_world");
@@ -435,6 +466,15 @@ void MappingHugeTrivialBiMapLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeTrivialBiMapLast);
 
+void MappingHugeTrivialHashBiMapLast(benchmark::State& state) {
+    auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(kHugeTrivialHashBiMap.TryFind(z9));
+    }
+}
+BENCHMARK(MappingHugeTrivialHashBiMapLast);
+
 void MappingHugeUnorderedLast(benchmark::State& state) {
     auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
 
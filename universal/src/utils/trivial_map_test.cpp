@@ -325,4 +325,107 @@ TEST(TrivialBiMap, Empty) {
     EXPECT_EQ(sum, 0);
 }
 
+/// [sample hash bimap]
+constexpr utils::TrivialBiMap kManyToInt = [](auto selector) {
+    return selector()
+        .Case("zero", 0)
+        .Case("one", 1)
+        .Case("two", 2)
+        .Case("three", 3)
+        .Case("four", 4)
+        .Case("five", 5)
+        .Case("six", 6)
+        .Case("seven", 7)
+        .Case("eight", 8)
+        .Case("nine", 9)
+        .Case("ten", 10)
+        .Case("eleven", 11)
+        .Case("twelve", 12)
+        .Case("thirteen", 13)
+        .Case("fourteen", 14)
+        .Case("fifteen", 15)
+        .Case("sixteen", 16)
+        .Case("seventeen", 17)
+        .Case("eighteen", 18)
+        .Case("nineteen", 19)
+        .Case("twenty", 20)
+        .Case("twenty one", 21)
+        .Case("twenty two", 22)
+        .Case("twenty three", 23)
+        .Case("twenty four", 24)
+        .Case("twenty five", 25)
+        .Case("twenty six", 26)
+        .Case("twenty seven", 27)
+        .Case("twenty eight", 28)
+        .Case("twenty nine", 29)
+        .Case("thirty", 30)
+        .Case("thirty one", 31)
+        .Case("thirty two", 32)
+        .Case("thirty three", 33)
+        .Case("thirty three again", 33)
+        .Case("thirty", 42);
+};
+
+constexpr utils::TrivialHashBiMap<kManyToInt> kManyToIntHashed;
+/// [sample hash bimap]
+
+TEST(TrivialHashBiMap, Basic) {
+    static_assert(kManyToIntHashed.TryFind("thirty two") == 32);
+    static_assert(kManyToIntHashed.TryFind(17) == "seventeen");
+
+    EXPECT_EQ(kManyToIntHashed.size(), 36);
+    for (const auto [first, second] : kManyToInt) {
+        EXPECT_EQ(kManyToIntHashed.TryFindByFirst(first), kManyToInt.TryFindByFirst(first)) << first;
+        EXPECT_EQ(kManyToIntHashed.TryFindBySecond(second), kManyToInt.TryFindBySecond(second)) << second;
+    }
+
+    EXPECT_EQ(kManyToIntHashed.TryFind("thirty"), 30);
+    EXPECT_EQ(kManyToIntHashed.TryFind(33), "thirty three");
+    EXPECT_EQ(kManyToIntHashed.TryFind(42), "thirty");
+
+    EXPECT_EQ(kManyToIntHashed.TryFind(""), std::nullopt);
+    EXPECT_EQ(kManyToIntHashed.TryFind("thirty four"), std::nullopt);
+    EXPECT_EQ(kManyToIntHashed.TryFind("Thirty"), std::nullopt);
+    EXPECT_EQ(kManyToIntHashed.TryFind(-1), std::nullopt);
+    EXPECT_EQ(kManyToIntHashed.TryFind(100), std::nullopt);
+
+    EXPECT_EQ(kManyToIntHashed.TryFindICase("Thirty"), 30);
+
+    const auto values = kManyToIntHashed.GetValuesByIndex(35);
+    EXPECT_EQ(values.first, "thirty");
+    EXPECT_EQ(values.second, 42);
+}
+
+TEST(TrivialHashBiMap, Small) {
+    static constexpr utils::TrivialHashBiMap<kToInt> kMap;
+
+    EXPECT_EQ(kMap.TryFind("two"), 2);
+    EXPECT_EQ(kMap.TryFind(4), "four");
+    EXPECT_EQ(kMap.TryFind("ten"), std::nullopt);
+    EXPECT_EQ(kMap.size(), 5);
+}
+
+constexpr std::string_view kManyNames[] = {
+    "zero",         "one",         "two",          "three",        "four",         "five",
+    "six",          "seven",       "eight",        "nine",         "ten",          "eleven",
+    "twelve",       "thirteen",    "fourteen",     "fifteen",      "sixteen",      "seventeen",
+    "eighteen",     "nineteen",    "twenty",       "twenty one",   "twenty two",   "twenty three",
+    "twenty four",  "twenty five", "twenty six",   "twenty seven", "twenty eight", "twenty nine",
+    "thirty",       "thirty one",  "thirty two",   "thirty three", "thirty three again", "thirty",
+};
+
+constexpr auto kManyNamesSet = utils::MakeTrivialSet<kManyNames>();
+
+TEST(TrivialHashSet, Basic) {
+    static constexpr utils::TrivialHashSet<kManyNamesSet> kSet;
+
+    EXPECT_EQ(kSet.size(), 36);
+    EXPECT_TRUE(kSet.Contains("nineteen"));
+    EXPECT_FALSE(kSet.Contains("ninety"));
+    EXPECT_EQ(kSet.GetIndex("zero"), 0);
+    EXPECT_EQ(kSet.GetIndex("thirty"), 30);
+    EXPECT_EQ(kSet.GetIndex("thirty three again"), 34);
+    EXPECT_EQ(kSet.GetIndex("ninety"), std::nullopt);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#include <yaml_config/impl/config_index.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace yaml_config::impl {
+
+namespace {
+
+ConfigIndex::Entry MakeEntry(const formats::yaml::Value& value, const ConfigIndex* config_vars) {
+    ConfigIndex::Entry entry{value, ConfigIndex::Build(value, config_vars), nullptr};
+
+    if (config_vars && IsSubstitution(value)) {
+        const auto* var = config_vars->FindMember(GetSubstitutionVarName(value));
+        if (var) {
+            auto var_data = var->value.CloneWithReplacedPath(value.GetPath());
+            // Strip substitutions off to disallow nested substitutions
+            auto index = ConfigIndex::Build(var_data, nullptr);
+            entry.substitution =
+                std::make_unique<const ConfigIndex::Entry>(ConfigIndex::Entry{std::move(var_data), std::move(index), nullptr}
+                );
+        }
+    }
+
+    return entry;
+}
+
+}  // namespace
+
+ConfigIndex::ConfigIndex(const formats::yaml::Value& yaml, const ConfigIndex* config_vars) {
+    if (yaml.IsArray()) {
+        elements_.reserve(yaml.GetSize());
+        for (const auto& element : yaml) {
+            elements_.push_back(MakeEntry(element, config_vars));
+        }
+        return;
+    }
+
+    members_.reserve(yaml.GetSize());
+    for (auto it = yaml.begin(); it != yaml.end(); ++it) {
+        // yaml-cpp returns the first of the duplicate keys, so does emplace
+        members_.emplace(it.GetName(), MakeEntry(*it, config_vars));
+    }
+}
+
+std::unique_ptr<const ConfigIndex> ConfigIndex::Build(const formats::yaml::Value& yaml, const ConfigIndex* config_vars) {
+    if (!yaml.IsObject() && !yaml.IsArray()) return nullptr;
+    return std::make_unique<const ConfigIndex>(yaml, config_vars);
+}
+
+const ConfigIndex::Entry* ConfigIndex::FindMember(std::string_view key) const {
+    return utils::impl::FindTransparentOrNullptr(members_, key);
+}
+
+const ConfigIndex::Entry* ConfigIndex::GetElement(std::size_t index) const {
+    return index < elements_.size() ? &elements_[index] : nullptr;
+}
+
+bool IsSubstitution(const formats::yaml::Value& value) {
+    if (!value.IsString()) return false;
+    const auto& str = value.As<std::string>();
+    return !str.empty() && str.front() == '$';
+}
+
+std::string GetSubstitutionVarName(const formats::yaml::Value& value) { return value.As<std::string>().substr(1); }
+
+}  // namespace yaml_config::impl
+
+USERVER_NAMESPACE_END
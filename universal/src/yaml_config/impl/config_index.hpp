@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/yaml/value.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace yaml_config::impl {
+
+// Immutable lookup tables of a parsed YAML tree. yaml-cpp searches map keys
+// linearly and converts every key node to a string on the way, so
+// YamlConfig lookups go through the hashed members of this index instead.
+// `$variables` that are present in config_vars are resolved at build time.
+class ConfigIndex final {
+public:
+    struct Entry final {
+        formats::yaml::Value value;
+
+        // nullptr for values that are neither objects nor arrays
+        std::unique_ptr<const ConfigIndex> index;
+
+        // `$variable` value taken from config_vars, if the value is a
+        // substitution and config_vars has such a variable
+        std::unique_ptr<const Entry> substitution;
+    };
+
+    ConfigIndex(const formats::yaml::Value& yaml, const ConfigIndex* config_vars);
+
+    // Returns nullptr if `yaml` is neither an object nor an array
+    static std::unique_ptr<const ConfigIndex> Build(const formats::yaml::Value& yaml, const ConfigIndex* config_vars);
+
+    const Entry* FindMember(std::string_view key) const;
+
+    const Entry* GetElement(std::size_t index) const;
+
+private:
+    utils::impl::TransparentMap<std::string, Entry> members_;
+    std::vector<Entry> elements_;
+};
+
+bool IsSubstitution(const formats::yaml::Value& value);
+
+std::string GetSubstitutionVarName(const formats::yaml::Value& value);
+
+}  // namespace yaml_config::impl
+
+USERVER_NAMESPACE_END
@@ -12,19 +12,17 @@
 #include <userver/utils/string_to_duration.hpp>
 #include <userver/utils/text_light.hpp>
 
+#include <yaml_config/impl/config_index.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace yaml_config {
 
 namespace {
 
-bool IsSubstitution(const formats::yaml::Value& value) {
-    if (!value.IsString()) return false;
-    const auto& str = value.As<std::string>();
-    return !str.empty() && str.front() == '$';
-}
-
-std::string GetSubstitutionVarName(const formats::yaml::Value& value) { return value.As<std::string>().substr(1); }
+using impl::GetSubstitutionVarName;
+using impl::IsSubstitution;
+using IndexPtr = std::shared_ptr<const impl::ConfigIndex>;
 
 std::string GetEnvName(std::string_view str) { return std::string{str} + "#env"; }
 
@@ -38,6 +36,21 @@ YamlConfig MakeMissingConfig(const YamlConfig& config, Field field) {
     return {formats::yaml::Value()[path], {}};
 }
 
+// Shares the ownership of the whole index tree
+IndexPtr MakeChildIndex(const IndexPtr& parent, const impl::ConfigIndex* child) {
+    if (!child) return {};
+    return IndexPtr{parent, child};
+}
+
+// yaml[key] that uses the hashed lookup if the index is available
+formats::yaml::Value GetMember(const formats::yaml::Value& yaml, const impl::ConfigIndex* index, std::string_view key) {
+    if (!index) return yaml[key];
+
+    const auto* entry = index->FindMember(key);
+    if (entry) return entry->value;
+    return formats::yaml::Value()[formats::common::MakeChildPath(yaml.GetPath(), key)];
+}
+
 void AssertEnvMode(YamlConfig::Mode mode) {
     if (mode == YamlConfig::Mode::kSecure) {
         throw std::runtime_error(
@@ -88,84 +101,89 @@ std::optional<formats::yaml::Value> GetFromFileImpl(const formats::yaml::Value&
 
 std::optional<YamlConfig> GetSharpCommandValue(
     const formats::yaml::Value& yaml,
+    const impl::ConfigIndex* index,
     YamlConfig::Mode mode,
     std::string_view key,
     bool met_substitution
 ) {
-    const auto env_name = yaml[GetEnvName(key)];
+    const auto path = formats::common::MakeChildPath(yaml.GetPath(), key);
+
+    const auto env_name = GetMember(yaml, index, GetEnvName(key));
     auto env_value = GetFromEnvImpl(env_name, mode);
     if (env_value) {
-        env_value = env_value->CloneWithReplacedPath(yaml[key].GetPath());
+        env_value = env_value->CloneWithReplacedPath(std::string{path});
         // Strip substitutions off to disallow nested substitutions
         return YamlConfig{std::move(*env_value), {}, YamlConfig::Mode::kSecure};
     }
 
-    const auto file_name = yaml[GetFileName(key)];
+    const auto file_name = GetMember(yaml, index, GetFileName(key));
     auto file_value = GetFromFileImpl(file_name, mode);
     if (file_value) {
-        file_value = file_value->CloneWithReplacedPath(yaml[key].GetPath());
+        file_value = file_value->CloneWithReplacedPath(std::string{path});
         // Strip substitutions off to disallow nested substitutions
         return YamlConfig{std::move(*file_value), {}, YamlConfig::Mode::kSecure};
     }
 
     if (met_substitution || !env_name.IsMissing() || !file_name.IsMissing()) {
-        const auto fallback_name = GetFallbackName(key);
-        if (yaml.HasMember(fallback_name)) {
+        const auto fallback = GetMember(yaml, index, GetFallbackName(key));
+        if (!fallback.IsMissing()) {
             LOG_INFO() << "using fallback value for '" << key << '\'';
             // Strip substitutions off to disallow nested substitutions
-            return YamlConfig{
-                yaml[fallback_name].CloneWithReplacedPath(yaml[key].GetPath()), {}, YamlConfig::Mode::kSecure};
+            return YamlConfig{fallback.CloneWithReplacedPath(std::string{path}), {}, YamlConfig::Mode::kSecure};
         }
     }
 
     return {};
 }
 
-std::optional<YamlConfig> GetYamlConfig(
-    const formats::yaml::Value& yaml,
+std::optional<YamlConfig> GetSubstitutionValue(
+    const formats::yaml::Value& value,
     const formats::yaml::Value& config_vars,
-    YamlConfig::Mode mode,
-    std::string_view key
+    const impl::ConfigIndex* config_vars_index,
+    YamlConfig::Mode mode
 ) {
-    auto value = yaml[key];
-
-    const bool is_substitution = IsSubstitution(value);
-    if (is_substitution) {
-        const auto var_name = GetSubstitutionVarName(value);
-        auto var_data = config_vars[var_name];
-        if (!var_data.IsMissing()) {
-            var_data = var_data.CloneWithReplacedPath(value.GetPath());
-            // Strip substitutions off to disallow nested substitutions
-            return YamlConfig{std::move(var_data), {}, YamlConfig::Mode::kSecure};
-        }
-
-        auto res = GetSharpCommandValue(
-            config_vars,
-            mode,
-            var_name,
-            /*met_substitution*/ false
-        );
-        if (res) {
-            return YamlConfig{res->Yaml().CloneWithReplacedPath(value.GetPath()), {}, YamlConfig::Mode::kSecure};
-        }
-    }
-
-    if (!value.IsMissing() && !is_substitution) {
-        return YamlConfig{std::move(value), config_vars, mode};
+    const auto var_name = GetSubstitutionVarName(value);
+    auto var_data = GetMember(config_vars, config_vars_index, var_name);
+    if (!var_data.IsMissing()) {
+        var_data = var_data.CloneWithReplacedPath(value.GetPath());
+        // Strip substitutions off to disallow nested substitutions
+        return YamlConfig{std::move(var_data), {}, YamlConfig::Mode::kSecure};
     }
 
-    return GetSharpCommandValue(
-        yaml,
+    auto res = GetSharpCommandValue(
+        config_vars,
+        config_vars_index,
         mode,
-        key,
-        /*met_substitution*/ is_substitution
+        var_name,
+        /*met_substitution*/ false
     );
+    if (res) {
+        return YamlConfig{res->Yaml().CloneWithReplacedPath(value.GetPath()), {}, YamlConfig::Mode::kSecure};
+    }
+
+    return {};
 }
 
 }  // namespace
 
 YamlConfig::YamlConfig(formats::yaml::Value yaml, formats::yaml::Value config_vars, Mode mode)
-    : yaml_(std::move(yaml)), config_vars_(std::move(config_vars)), mode_(mode) {}
+    : yaml_(std::move(yaml)), config_vars_(std::move(config_vars)), mode_(mode) {
+    config_vars_index_ = impl::ConfigIndex::Build(config_vars_, nullptr);
+    index_ = impl::ConfigIndex::Build(yaml_, config_vars_index_.get());
+}
+
+YamlConfig::YamlConfig(
+    formats::yaml::Value yaml,
+    formats::yaml::Value config_vars,
+    Mode mode,
+    std::shared_ptr<const impl::ConfigIndex> index,
+    std::shared_ptr<const impl::ConfigIndex> config_vars_index
+)
+    : yaml_(std::move(yaml)),
+      config_vars_(std::move(config_vars)),
+      mode_(mode),
+      index_(std::move(index)),
+      config_vars_index_(std::move(config_vars_index)) {}
 
 const formats::yaml::Value& YamlConfig::Yaml() const { return yaml_; }
 
@@ -176,42 +194,70 @@ YamlConfig YamlConfig::operator[](std::string_view key) const {
         return MakeMissingConfig(*this, key);
     }
 
-    auto yaml_config = GetYamlConfig(yaml_, config_vars_, mode_, key);
-    if (yaml_config) {
-        return std::move(*yaml_config);
+    const auto* entry = index_ ? index_->FindMember(key) : nullptr;
+    if (entry && entry->substitution) {
+        const auto& substitution = *entry->substitution;
+        return {substitution.value, {}, Mode::kSecure, MakeChildIndex(index_, substitution.index.get()), {}};
+    }
+
+    auto value = entry ? entry->value : GetMember(yaml_, index_.get(), key);
+
+    const bool is_substitution = IsSubstitution(value);
+    if (is_substitution) {
+        auto res = GetSubstitutionValue(value, config_vars_, config_vars_index_.get(), mode_);
+        if (res) {
+            return std::move(*res);
+        }
+    }
+
+    if (!value.IsMissing() && !is_substitution) {
+        return {
+            std::move(value),
+            config_vars_,
+            mode_,
+            MakeChildIndex(index_, entry ? entry->index.get() : nullptr),
+            config_vars_index_};
+    }
+
+    auto res = GetSharpCommandValue(
+        yaml_,
+        index_.get(),
+        mode_,
+        key,
+        /*met_substitution*/ is_substitution
+    );
+    if (res) {
+        return std::move(*res);
     }
 
     return MakeMissingConfig(*this, key);
 }
 
 YamlConfig YamlConfig::operator[](size_t index) const {
-    auto value = yaml_[index];
-
-    if (IsSubstitution(value)) {
-        const auto var_name = GetSubstitutionVarName(value);
+    const auto* entry = index_ ? index_->GetElement(index) : nullptr;
+    if (entry && entry->substitution) {
+        const auto& substitution = *entry->substitution;
+        return {substitution.value, {}, Mode::kSecure, MakeChildIndex(index_, substitution.index.get()), {}};
+    }
 
-        auto var_data = config_vars_[var_name];
-        if (!var_data.IsMissing()) {
-            var_data = var_data.CloneWithReplacedPath(value.GetPath());
-            // Strip substitutions off to disallow nested substitutions
-            return YamlConfig{std::move(var_data), {}, Mode::kSecure};
-        }
+    auto value = entry ? entry->value : yaml_[index];
 
-        auto res = GetSharpCommandValue(
-            config_vars_,
-            mode_,
-            var_name,
-            /*met_substitution*/ false
-        );
+    if (IsSubstitution(value)) {
+        auto res = GetSubstitutionValue(value, config_vars_, config_vars_index_.get(), mode_);
         if (res) {
-            return YamlConfig{res->Yaml().CloneWithReplacedPath(value.GetPath()), {}, YamlConfig::Mode::kSecure};
+            return std::move(*res);
         }
 
         // Avoid parsing $substitution as a string
         return MakeMissingConfig(*this, index)[value.As<std::string>()];
     }
 
-    return {std::move(value), config_vars_};
+    return {
+        std::move(value),
+        config_vars_,
+        Mode::kSecure,
+        MakeChildIndex(index_, entry ? entry->index.get() : nullptr),
+        config_vars_index_};
 }
 
 std::size_t YamlConfig::GetSize() const { return yaml_.GetSize(); }
@@ -250,7 +296,10 @@ void YamlConfig::CheckString() const { yaml_.CheckString(); }
 
 void YamlConfig::CheckObjectOrArrayOrNull() const { yaml_.CheckObjectOrArrayOrNull(); }
 
-bool YamlConfig::HasMember(std::string_view key) const { return yaml_.HasMember(key); }
+bool YamlConfig::HasMember(std::string_view key) const {
+    if (index_ && yaml_.IsObject()) return index_->FindMember(key) != nullptr;
+    return yaml_.HasMember(key);
+}
 
 std::string YamlConfig::GetPath() const { return yaml_.GetPath(); }
 
@@ -41,6 +41,35 @@ TEST(YamlConfig, SampleVars) {
     /// [sample vars]
 }
 
+TEST(YamlConfig, IndexedVars) {
+    auto node = formats::yaml::FromString(R"(
+    elements:
+      - $variable
+      - inner:
+            some: $object
+    )");
+    auto vars = formats::yaml::FromString(R"(
+    variable: 42
+    object:
+        field: $variable
+    )");
+
+    const yaml_config::YamlConfig yaml(std::move(node), vars);
+    const auto elements = yaml["elements"];
+    EXPECT_EQ(elements[0].As<int>(), 42);
+    EXPECT_EQ(elements[0].GetPath(), "elements[0]");
+
+    const auto object = elements[1]["inner"]["some"];
+    EXPECT_TRUE(object.HasMember("field"));
+    EXPECT_FALSE(object.HasMember("other"));
+    EXPECT_EQ(object.GetPath(), "elements[1].inner.some");
+    // Nested substitutions are not allowed
+    EXPECT_TRUE(object["field"].IsMissing());
+
+    EXPECT_TRUE(yaml["missing"].IsMissing());
+    EXPECT_EQ(yaml["missing"]["deeper"].GetPath(), "missing.deeper");
+}
+
 TEST(YamlConfig, SampleVarsFallback) {
     auto node = formats::yaml::FromString(R"(
     some_element:
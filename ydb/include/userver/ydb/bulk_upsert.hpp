@@ -0,0 +1,167 @@
+#pragma once
+
+/// @file userver/ydb/bulk_upsert.hpp
+/// @brief @copybrief ydb::BulkUpsertWriter
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/pfr/core.hpp>
+#include <ydb-cpp-sdk/client/value/value.h>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utils/meta.hpp>
+
+#include <userver/ydb/io/traits.hpp>
+#include <userver/ydb/settings.hpp>
+#include <userver/ydb/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+class TableClient;
+
+/// Settings of ydb::BulkUpsertWriter
+struct BulkUpsertSettings final {
+    /// Approximate size of the rows sent by a single BulkUpsert
+    std::size_t max_batch_bytes{8 * 1024 * 1024};
+
+    /// Maximum number of BulkUpsert requests executed in parallel. The memory
+    /// usage is bounded by about `(max_concurrent_upserts + 1) * max_batch_bytes`.
+    std::size_t max_concurrent_upserts{4};
+};
+
+namespace impl {
+
+// Approximate size of a value in a BulkUpsert request
+template <typename T>
+std::size_t EstimateValueSize(const T& value) {
+    if constexpr (meta::kIsOptional<T>) {
+        return value.has_value() ? EstimateValueSize(*value) : 1;
+    } else if constexpr (std::is_same_v<T, Utf8>) {
+        return value.GetUnderlying().size();
+    } else if constexpr (std::is_same_v<T, JsonDocument>) {
+        return formats::json::ToString(value.GetUnderlying()).size();
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        return std::string_view{value}.size();
+    } else if constexpr (meta::kIsRange<T>) {
+        std::size_t size = 0;
+        for (const auto& item : value) size += EstimateValueSize(item);
+        return size;
+    } else if constexpr (std::is_aggregate_v<T> && !std::is_array_v<T>) {
+        std::size_t size = 0;
+        boost::pfr::for_each_field(value, [&size](const auto& field) { size += EstimateValueSize(field); });
+        return size;
+    } else {
+        return sizeof(T);
+    }
+}
+
+class BulkUpsertWriterBase {
+protected:
+    BulkUpsertWriterBase(
+        TableClient& table_client,
+        std::string table,
+        BulkUpsertSettings settings,
+        OperationSettings operation_settings
+    );
+    ~BulkUpsertWriterBase();
+
+    // Waits for the oldest upsert if `max_concurrent_upserts` are running
+    void StartUpsert(NYdb::TValue&& rows);
+    void WaitForAllUpserts();
+
+    const BulkUpsertSettings& GetSettings() const noexcept { return settings_; }
+
+private:
+    void WaitForUpsert();
+
+    TableClient& table_client_;
+    const std::string table_;
+    const BulkUpsertSettings settings_;
+    const OperationSettings operation_settings_;
+    std::deque<engine::TaskWithResult<void>> upserts_;
+};
+
+}  // namespace impl
+
+/// @brief Streams rows into a table by BulkUpsert requests of about
+/// `BulkUpsertSettings::max_batch_bytes` bytes, up to
+/// `BulkUpsertSettings::max_concurrent_upserts` requests run in parallel.
+///
+/// `Row` is written through ydb::ValueTraits, so it is typically a struct
+/// with the fields named after the columns. Write() returns as soon as the
+/// row is added to the current batch or the batch upsert is started, and
+/// waits only if all the allowed upserts are running. Rows that are not
+/// written by a successful Finish() may be lost, the destructor cancels the
+/// running upserts.
+///
+/// ## Example:
+///
+/// @code
+/// ydb::BulkUpsertWriter<Row> writer{table_client, "my_table"};
+/// for (const auto& row : LoadRows()) writer.Write(row);
+/// writer.Finish();
+/// @endcode
+template <typename Row>
+class BulkUpsertWriter final : private impl::BulkUpsertWriterBase {
+public:
+    BulkUpsertWriter(
+        TableClient& table_client,
+        std::string table,
+        BulkUpsertSettings settings = {},
+        OperationSettings operation_settings = {}
+    )
+        : BulkUpsertWriterBase(table_client, std::move(table), settings, std::move(operation_settings)) {}
+
+    BulkUpsertWriter(const BulkUpsertWriter&) = delete;
+    BulkUpsertWriter& operator=(const BulkUpsertWriter&) = delete;
+
+    /// @brief Adds the row to the current batch
+    /// @throws the errors of the previously started upserts
+    void Write(const Row& row) {
+        if (!batch_builder_) {
+            batch_builder_.emplace();
+            batch_builder_->BeginList();
+        }
+        batch_builder_->AddListItem();
+        ydb::Write(*batch_builder_, row);
+        ++written_rows_;
+
+        batch_bytes_ += impl::EstimateValueSize(row);
+        if (batch_bytes_ >= GetSettings().max_batch_bytes) Flush();
+    }
+
+    /// @brief Upserts the rest of the rows and waits for all the upserts
+    void Finish() {
+        Flush();
+        WaitForAllUpserts();
+    }
+
+    /// @brief Returns the number of rows passed to Write()
+    std::size_t GetWrittenRows() const noexcept { return written_rows_; }
+
+private:
+    void Flush() {
+        if (!batch_builder_) return;
+        batch_builder_->EndList();
+        auto rows = batch_builder_->Build();
+        batch_builder_.reset();
+        batch_bytes_ = 0;
+        StartUpsert(std::move(rows));
+    }
+
+    std::optional<NYdb::TValueBuilder> batch_builder_;
+    std::size_t batch_bytes_{0};
+    std::size_t written_rows_{0};
+};
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
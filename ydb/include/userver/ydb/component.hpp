@@ -54,6 +54,9 @@ class Driver;
 /// databases.<dbname>.prefer_local_dc | prefer making requests to local DataCenter | false
 /// databases.<dbname>.aliases | list of alias names for this database | []
 /// databases.<dbname>.sync_start | fail on boot time if YDB is not accessible | true
+/// databases.<dbname>.prewarm_pool_size | number of sessions created on boot, capped by max_pool_size | 0
+/// databases.<dbname>.prewarm_queries | data queries prepared on every prewarmed session | []
+/// databases.<dbname>.keep_alive_idle_threshold | idle time after which a session is kept alive by a request | 10m
 /// databases.<dbname>.by-database-timings-buckets-ms | histogram bounds for by-database timing metrics | 40 buckets with +20% increment per step
 /// databases.<dbname>.by-query-timings-buckets-ms | histogram bounds for by-query timing metrics | 15 buckets with +100% increment per step
 
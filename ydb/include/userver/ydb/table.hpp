@@ -107,6 +107,7 @@ public:
     PreparedArgsBuilder GetBuilder() const;
 
     /// Efficiently write large ranges of table data.
+    /// @see ydb::BulkUpsertWriter for datasets that do not fit into a single request
     void BulkUpsert(std::string_view table, NYdb::TValue&& rows, OperationSettings settings = {});
 
     /// Efficiently write large ranges of table data.
@@ -161,6 +162,8 @@ private:
 
     void Select1();
 
+    void PrewarmPool(std::uint32_t size, const std::vector<std::string>& queries);
+
     NYdb::NTable::TExecDataQuerySettings ToExecQuerySettings(QuerySettings query_settings) const;
 
     template <typename... Args>
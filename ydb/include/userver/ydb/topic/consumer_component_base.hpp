@@ -0,0 +1,77 @@
+#pragma once
+
+/// @file userver/ydb/topic/consumer_component_base.hpp
+/// @brief @copybrief ydb::TopicConsumerComponentBase
+
+#include <memory>
+#include <vector>
+
+#include <userver/components/component_base.hpp>
+
+#include <ydb-cpp-sdk/client/topic/client.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+namespace impl {
+class TopicConsumer;
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Base class for components that consume YDB topics
+///
+/// Inherit from TopicConsumerComponentBase and implement Process(). The
+/// partitions are processed concurrently on the `task-processor`, the
+/// messages of a partition are processed in order, one batch at a time.
+/// Processed messages are committed by batches of `commit-batch-size`
+/// messages or once the partition has no more data buffered.
+///
+/// Reading stops while `max-buffered-bytes` of the received data is not
+/// yet processed. If Process() throws, the read session is restarted and
+/// the uncommitted messages are read again.
+///
+/// ## Static options:
+/// name           | Description  | Default value
+/// -------------- | ------------ | -------------
+/// dbname | the key of the database within ydb component (NOT the actual database path) | --
+/// consumer-name | name of the topic consumer | --
+/// topics | paths of the topics to read | --
+/// task-processor | the name of the TaskProcessor for running Process | main-task-processor
+/// max-concurrent-partitions | maximum number of partitions processed at the same time | 16
+/// commit-batch-size | maximum number of processed messages of a partition to commit at once | 1000
+/// max-buffered-bytes | maximum size of the received but not yet processed data | 64Mi
+/// restart-session-delay | backoff before recreating the read session after a failure | 1s
+/// close-session-timeout | time to wait for the commit acknowledgments on session close | 3s
+
+// clang-format on
+class TopicConsumerComponentBase : public components::ComponentBase {
+public:
+    TopicConsumerComponentBase(const components::ComponentConfig&, const components::ComponentContext&);
+    ~TopicConsumerComponentBase() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+protected:
+    using Message = NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent::TMessage;
+
+    /// Override this function to process a batch of messages of a single
+    /// partition. The messages are committed after Process() returns.
+    virtual void Process(const std::vector<Message>& messages) = 0;
+
+    /// Must be called at the end of the constructor of the derived component.
+    void Start();
+
+    /// Must be called in the destructor of the derived component.
+    void Stop() noexcept;
+
+private:
+    std::unique_ptr<impl::TopicConsumer> consumer_;
+};
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
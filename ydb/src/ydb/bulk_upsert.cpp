@@ -0,0 +1,52 @@
+#include <userver/ydb/bulk_upsert.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/ydb/table.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb::impl {
+
+BulkUpsertWriterBase::BulkUpsertWriterBase(
+    TableClient& table_client,
+    std::string table,
+    BulkUpsertSettings settings,
+    OperationSettings operation_settings
+)
+    : table_client_(table_client),
+      table_(std::move(table)),
+      settings_(settings),
+      operation_settings_(std::move(operation_settings)) {
+    UINVARIANT(settings_.max_batch_bytes > 0, "max_batch_bytes must be positive");
+    UINVARIANT(settings_.max_concurrent_upserts > 0, "max_concurrent_upserts must be positive");
+}
+
+BulkUpsertWriterBase::~BulkUpsertWriterBase() {
+    for (auto& upsert : upserts_) upsert.SyncCancel();
+}
+
+void BulkUpsertWriterBase::StartUpsert(NYdb::TValue&& rows) {
+    if (upserts_.size() >= settings_.max_concurrent_upserts) WaitForUpsert();
+
+    upserts_.push_back(utils::Async(
+        "ydb_bulk_upsert",
+        [&table_client = table_client_, &table = table_, settings = operation_settings_, rows = std::move(rows)](
+        ) mutable { table_client.BulkUpsert(table, std::move(rows), std::move(settings)); }
+    ));
+}
+
+void BulkUpsertWriterBase::WaitForAllUpserts() {
+    while (!upserts_.empty()) WaitForUpsert();
+}
+
+void BulkUpsertWriterBase::WaitForUpsert() {
+    UASSERT(!upserts_.empty());
+    auto upsert = std::move(upserts_.front());
+    upserts_.pop_front();
+    upsert.Get();
+}
+
+}  // namespace ydb::impl
+
+USERVER_NAMESPACE_END
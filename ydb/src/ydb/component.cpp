@@ -251,6 +251,22 @@ properties:
                     type: boolean
                     defaultDescription: true
                     description: fail to boot if YDB is not available
+                prewarm_pool_size:
+                    type: integer
+                    minimum: 0
+                    defaultDescription: 0
+                    description: number of sessions created on start, before the first request
+                prewarm_queries:
+                    type: array
+                    description: data queries prepared on every prewarmed session
+                    defaultDescription: '[]'
+                    items:
+                        type: string
+                        description: YQL query text, exactly as it is executed
+                keep_alive_idle_threshold:
+                    type: string
+                    description: idle time after which a session is checked by a keep-alive request
+                    defaultDescription: SDK default (10m)
                 aliases:
                     description: list of aliases for this database
                     type: array
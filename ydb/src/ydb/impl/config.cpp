@@ -44,6 +44,11 @@ TableSettings ParseTableSettings(const yaml_config::YamlConfig& dbconfig, const
 
     result.sync_start = dbconfig["sync_start"].As<bool>(result.sync_start);
 
+    result.prewarm_pool_size = dbconfig["prewarm_pool_size"].As<std::uint32_t>(result.prewarm_pool_size);
+    result.prewarm_queries = dbconfig["prewarm_queries"].As<std::vector<std::string>>(result.prewarm_queries);
+    result.keep_alive_idle_threshold =
+        dbconfig["keep_alive_idle_threshold"].As<std::optional<std::chrono::milliseconds>>();
+
     result.by_database_timings_buckets =
         dbconfig["by-database-timings-buckets-ms"].As<std::optional<std::vector<double>>>();
     result.by_query_timings_buckets = dbconfig["by-query-timings-buckets-ms"].As<std::optional<std::vector<double>>>();
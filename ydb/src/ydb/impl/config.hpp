@@ -33,6 +33,9 @@ struct TableSettings {
     std::uint32_t get_session_retry_limit{5};
     bool keep_in_query_cache{true};
     bool sync_start{true};
+    std::uint32_t prewarm_pool_size{0};
+    std::vector<std::string> prewarm_queries{};
+    std::optional<std::chrono::milliseconds> keep_alive_idle_threshold{};
     std::optional<std::vector<double>> by_database_timings_buckets{};
     std::optional<std::vector<double>> by_query_timings_buckets{};
 };
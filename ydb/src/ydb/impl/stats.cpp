@@ -126,6 +126,13 @@ void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
 
         writer["transactions-total"] = total;
     }
+
+    if (auto prewarm = writer["prewarm"]) {
+        prewarm["sessions"] = stats.prewarmed_sessions;
+        prewarm["session-errors"] = stats.prewarm_session_errors;
+        prewarm["prepared-queries"] = stats.prepared_queries;
+        prewarm["prepare-query-errors"] = stats.prepare_query_errors;
+    }
 }
 
 }  // namespace ydb::impl
@@ -54,6 +54,11 @@ struct Stats final {
     StatsCounters unnamed_queries;
     rcu::RcuMap<std::string, StatsCounters> by_query;
     rcu::RcuMap<std::string, StatsCounters> by_transaction;
+
+    utils::statistics::RateCounter prewarmed_sessions;
+    utils::statistics::RateCounter prewarm_session_errors;
+    utils::statistics::RateCounter prepared_queries;
+    utils::statistics::RateCounter prepare_query_errors;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
@@ -0,0 +1,331 @@
+#include <ydb/impl/topic_consumer.hpp>
+
+#include <atomic>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+#include <userver/ydb/exceptions.hpp>
+#include <userver/ydb/impl/cast.hpp>
+#include <userver/ydb/topic.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb::impl {
+
+namespace {
+
+using TReadSessionEvent = NYdb::NTopic::TReadSessionEvent;
+
+NYdb::NTopic::TReadSessionSettings MakeReadSessionSettings(const TopicConsumerSettings& settings) {
+    NYdb::NTopic::TReadSessionSettings read_session_settings;
+    read_session_settings.ConsumerName(impl::ToString(settings.consumer_name));
+    for (const auto& topic_path : settings.topics) {
+        read_session_settings.AppendTopics(impl::ToString(topic_path));
+    }
+    read_session_settings.MaxMemoryUsageBytes(settings.max_buffered_bytes);
+    return read_session_settings;
+}
+
+std::size_t GetDataSize(const TReadSessionEvent::TDataReceivedEvent& event) {
+    std::size_t size = 0;
+    for (const auto& message : event.GetMessages()) size += message.GetData().size();
+    return size;
+}
+
+struct Partition final {
+    struct Data final {
+        TReadSessionEvent::TDataReceivedEvent event;
+        std::size_t size;
+    };
+
+    std::uint64_t id;
+    std::deque<Data> queue;
+    std::optional<TReadSessionEvent::TStopPartitionSessionEvent> stop_event;
+    bool is_running{false};
+    bool is_lost{false};
+};
+
+// Serves a single read session, destroyed when the session is closed
+class SessionReader final {
+public:
+    SessionReader(
+        TopicReadSession& session,
+        engine::TaskProcessor& task_processor,
+        const TopicConsumerSettings& settings,
+        const TopicConsumer::Callback& callback
+    )
+        : session_(session),
+          task_processor_(task_processor),
+          settings_(settings),
+          callback_(callback),
+          partitions_sema_(settings.max_concurrent_partitions) {}
+
+    bool IsClosed() const { return is_closed_; }
+
+    void Run() {
+        while (!engine::current_task::ShouldCancel() && !is_closed_) {
+            if (!WaitForBufferSpace()) break;
+            auto events = session_.GetEvents();
+            for (auto& event : events) HandleEvent(event);
+        }
+    }
+
+private:
+    bool WaitForBufferSpace() {
+        std::unique_lock lock{mutex_};
+        return buffer_cv_.Wait(lock, [this] { return buffered_bytes_ < settings_.max_buffered_bytes || is_failed_; });
+    }
+
+    void HandleEvent(TReadSessionEvent::TEvent& event) {
+        std::visit(
+            utils::Overloaded{
+                [this](TReadSessionEvent::TDataReceivedEvent& e) { OnData(std::move(e)); },
+                [this](TReadSessionEvent::TStartPartitionSessionEvent& e) {
+                    const auto id = e.GetPartitionSession()->GetPartitionSessionId();
+                    {
+                        const std::lock_guard lock{mutex_};
+                        auto partition = std::make_shared<Partition>();
+                        partition->id = id;
+                        partitions_[id] = std::move(partition);
+                    }
+                    e.Confirm();
+                },
+                [this](TReadSessionEvent::TStopPartitionSessionEvent& e) { OnStop(std::move(e)); },
+                [this](TReadSessionEvent::TPartitionSessionClosedEvent& e) {
+                    OnLost(e.GetPartitionSession()->GetPartitionSessionId());
+                },
+                [this](NYdb::NTopic::TSessionClosedEvent& e) {
+                    is_closed_ = true;
+                    if (!e.IsSuccess() && !is_failed_) {
+                        throw std::runtime_error{"Session closed unsuccessfully: " + e.GetIssues().ToString()};
+                    }
+                },
+                [](auto&) {},
+            },
+            event
+        );
+    }
+
+    void OnData(TReadSessionEvent::TDataReceivedEvent&& event) {
+        const auto id = event.GetPartitionSession()->GetPartitionSessionId();
+        const auto size = GetDataSize(event);
+
+        const std::lock_guard lock{mutex_};
+        const auto it = partitions_.find(id);
+        if (it == partitions_.end()) return;
+
+        auto& partition = it->second;
+        partition->queue.push_back({std::move(event), size});
+        buffered_bytes_ += size;
+        if (!partition->is_running) {
+            partition->is_running = true;
+            bts_.Detach(utils::Async(task_processor_, "ydb_topic_partition", [this, partition] {
+                RunPartition(*partition);
+            }));
+        }
+    }
+
+    void OnStop(TReadSessionEvent::TStopPartitionSessionEvent&& event) {
+        {
+            const std::lock_guard lock{mutex_};
+            const auto it = partitions_.find(event.GetPartitionSession()->GetPartitionSessionId());
+            if (it != partitions_.end() && it->second->is_running) {
+                // Confirmed once the queued messages are processed and committed
+                it->second->stop_event.emplace(std::move(event));
+                return;
+            }
+            if (it != partitions_.end()) partitions_.erase(it);
+        }
+        event.Confirm();
+    }
+
+    void OnLost(std::uint64_t id) {
+        const std::lock_guard lock{mutex_};
+        const auto it = partitions_.find(id);
+        if (it == partitions_.end()) return;
+
+        // The offsets could not be committed anymore
+        for (const auto& data : it->second->queue) buffered_bytes_ -= data.size;
+        it->second->queue.clear();
+        it->second->is_lost = true;
+        partitions_.erase(it);
+        buffer_cv_.NotifyAll();
+    }
+
+    void RunPartition(Partition& partition) {
+        const engine::SemaphoreLock partition_lock{partitions_sema_};
+        if (!partition_lock.OwnsLock()) return;
+
+        std::optional<NYdb::NTopic::TDeferredCommit> commit;
+        std::size_t uncommitted = 0;
+        const auto flush = [&] {
+            if (commit) commit->Commit();
+            commit.reset();
+            uncommitted = 0;
+        };
+
+        while (!engine::current_task::ShouldCancel()) {
+            std::optional<Partition::Data> data;
+            {
+                const std::lock_guard lock{mutex_};
+                if (partition.is_lost) return;
+                if (!partition.queue.empty()) {
+                    data.emplace(std::move(partition.queue.front()));
+                    partition.queue.pop_front();
+                }
+            }
+
+            if (!data) {
+                if (uncommitted > 0) {
+                    flush();
+                    continue;
+                }
+                if (FinishPartition(partition)) return;
+                continue;
+            }
+
+            try {
+                callback_(data->event.GetMessages());
+            } catch (const std::exception& ex) {
+                LOG_ERROR() << "Failed to process topic messages, restarting the read session: " << ex;
+                Fail();
+                return;
+            }
+
+            if (!commit) commit.emplace();
+            commit->Add(data->event);
+            uncommitted += data->event.GetMessagesCount();
+            ReleaseBufferSpace(data->size);
+            if (uncommitted >= settings_.commit_batch_size) flush();
+        }
+    }
+
+    // Returns false if more data arrived meanwhile
+    bool FinishPartition(Partition& partition) {
+        std::optional<TReadSessionEvent::TStopPartitionSessionEvent> stop_event;
+        {
+            const std::lock_guard lock{mutex_};
+            if (!partition.queue.empty()) return false;
+            partition.is_running = false;
+            if (partition.stop_event) {
+                stop_event = std::move(partition.stop_event);
+                partitions_.erase(partition.id);
+            }
+        }
+        if (stop_event) stop_event->Confirm();
+        return true;
+    }
+
+    void ReleaseBufferSpace(std::size_t size) {
+        const std::lock_guard lock{mutex_};
+        buffered_bytes_ -= size;
+        buffer_cv_.NotifyAll();
+    }
+
+    void Fail() {
+        if (is_failed_.exchange(true)) return;
+        {
+            const std::lock_guard lock{mutex_};
+            buffer_cv_.NotifyAll();
+        }
+        // Wakes up the reader with a TSessionClosedEvent
+        session_.Close(std::chrono::milliseconds::zero());
+    }
+
+    TopicReadSession& session_;
+    engine::TaskProcessor& task_processor_;
+    const TopicConsumerSettings& settings_;
+    const TopicConsumer::Callback& callback_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable buffer_cv_;
+    std::unordered_map<std::uint64_t, std::shared_ptr<Partition>> partitions_;
+    std::size_t buffered_bytes_{0};
+
+    engine::Semaphore partitions_sema_;
+    bool is_closed_{false};
+    std::atomic<bool> is_failed_{false};
+
+    // Must be the last member, the tasks refer to the ones above
+    concurrent::BackgroundTaskStorageCore bts_;
+};
+
+}  // namespace
+
+TopicConsumerSettings Parse(const yaml_config::YamlConfig& config, formats::parse::To<TopicConsumerSettings>) {
+    TopicConsumerSettings settings;
+    settings.consumer_name = config["consumer-name"].As<std::string>();
+    settings.topics = config["topics"].As<std::vector<std::string>>();
+    settings.max_concurrent_partitions =
+        config["max-concurrent-partitions"].As<std::size_t>(settings.max_concurrent_partitions);
+    settings.commit_batch_size = config["commit-batch-size"].As<std::size_t>(settings.commit_batch_size);
+    settings.max_buffered_bytes = config["max-buffered-bytes"].As<std::size_t>(settings.max_buffered_bytes);
+    settings.restart_session_delay =
+        config["restart-session-delay"].As<std::chrono::milliseconds>(settings.restart_session_delay);
+    settings.close_session_timeout =
+        config["close-session-timeout"].As<std::chrono::milliseconds>(settings.close_session_timeout);
+    return settings;
+}
+
+TopicConsumer::TopicConsumer(
+    std::shared_ptr<TopicClient> topic_client,
+    engine::TaskProcessor& task_processor,
+    TopicConsumerSettings settings,
+    Callback callback
+)
+    : topic_client_(std::move(topic_client)),
+      task_processor_(task_processor),
+      settings_(std::move(settings)),
+      callback_(std::move(callback)) {
+    UINVARIANT(settings_.max_concurrent_partitions > 0, "max-concurrent-partitions must be positive");
+    UINVARIANT(settings_.commit_batch_size > 0, "commit-batch-size must be positive");
+}
+
+TopicConsumer::~TopicConsumer() { Stop(); }
+
+void TopicConsumer::Start() {
+    read_task_ = utils::CriticalAsync(task_processor_, "ydb_topic_consumer", [this] { Run(); });
+}
+
+void TopicConsumer::Stop() noexcept {
+    if (read_task_.IsValid()) read_task_.SyncCancel();
+}
+
+void TopicConsumer::Run() {
+    const auto read_session_settings = MakeReadSessionSettings(settings_);
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            auto session = topic_client_->CreateReadSession(read_session_settings);
+            bool is_closed = false;
+            {
+                SessionReader reader{session, task_processor_, settings_, callback_};
+                try {
+                    reader.Run();
+                } catch (const ydb::OperationCancelledError&) {
+                }
+                is_closed = reader.IsClosed();
+            }
+            if (!is_closed) session.Close(settings_.close_session_timeout);
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "Topic read session failed: " << ex;
+        }
+
+        engine::InterruptibleSleepFor(settings_.restart_session_delay);
+    }
+}
+
+}  // namespace ydb::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ydb-cpp-sdk/client/topic/client.h>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+class TopicClient;
+}  // namespace ydb
+
+namespace ydb::impl {
+
+struct TopicConsumerSettings final {
+    std::string consumer_name;
+    std::vector<std::string> topics;
+
+    // Partitions processed at the same time, each one sequentially
+    std::size_t max_concurrent_partitions{16};
+    // Processed messages of a partition committed at once
+    std::size_t commit_batch_size{1000};
+    // Received but not yet processed data, reading stops above the limit
+    std::size_t max_buffered_bytes{64 * 1024 * 1024};
+    std::chrono::milliseconds restart_session_delay{1000};
+    std::chrono::milliseconds close_session_timeout{3000};
+};
+
+TopicConsumerSettings Parse(const yaml_config::YamlConfig& config, formats::parse::To<TopicConsumerSettings>);
+
+using TopicMessage = NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent::TMessage;
+
+// Reads the topics in a restarting read session and processes the partitions
+// concurrently. Messages of a partition are processed in order, a failure
+// restarts the session, so that the uncommitted messages are read again.
+class TopicConsumer final {
+public:
+    using Callback = std::function<void(const std::vector<TopicMessage>& messages)>;
+
+    TopicConsumer(
+        std::shared_ptr<TopicClient> topic_client,
+        engine::TaskProcessor& task_processor,
+        TopicConsumerSettings settings,
+        Callback callback
+    );
+    ~TopicConsumer();
+
+    void Start();
+    void Stop() noexcept;
+
+private:
+    void Run();
+
+    const std::shared_ptr<TopicClient> topic_client_;
+    engine::TaskProcessor& task_processor_;
+    const TopicConsumerSettings settings_;
+    const Callback callback_;
+
+    engine::TaskWithResult<void> read_task_;
+};
+
+}  // namespace ydb::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/ydb/table.hpp>
 
+#include <algorithm>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
@@ -53,6 +55,9 @@ TableClient::TableClient(
     NYdb::NTable::TSessionPoolSettings session_config;
     session_config.MaxActiveSessions(settings.max_pool_size).MinPoolSize(settings.min_pool_size);
     session_config.RetryLimit(settings.get_session_retry_limit);
+    if (settings.keep_alive_idle_threshold) {
+        session_config.KeepAliveIdleThreshold(*settings.keep_alive_idle_threshold);
+    }
 
     NYdb::NTable::TClientSettings client_config;
     client_config.SessionPoolSettings(session_config);
@@ -63,6 +68,9 @@ TableClient::TableClient(
         LOG_DEBUG() << "Synchronously starting ydb client with name '" << driver_->GetDbName() << "'";
         Select1();
     }
+    if (settings.prewarm_pool_size > 0) {
+        PrewarmPool(std::min(settings.prewarm_pool_size, settings.max_pool_size), settings.prewarm_queries);
+    }
 }
 
 TableClient::~TableClient() {
@@ -166,6 +174,53 @@ void TableClient::Select1() {
     }
 }
 
+void TableClient::PrewarmPool(std::uint32_t size, const std::vector<std::string>& queries) {
+    LOG_INFO() << "Prewarming " << size << " sessions of ydb client with name '" << driver_->GetDbName() << "'";
+
+    NYdb::NTable::TCreateSessionSettings session_settings;
+    session_settings.ClientTimeout(default_settings_.get_session_timeout_ms);
+
+    // All the sessions are held at once, so that the pool has to create them
+    std::vector<NYdb::NTable::TAsyncCreateSessionResult> session_futures;
+    session_futures.reserve(size);
+    for (std::uint32_t i = 0; i < size; ++i) {
+        session_futures.push_back(table_client_->GetSession(session_settings));
+    }
+
+    std::vector<NYdb::NTable::TSession> sessions;
+    sessions.reserve(size);
+    for (auto& future : session_futures) {
+        auto result = impl::GetFutureValueUnchecked(std::move(future));
+        if (!result.IsSuccess()) {
+            ++stats_->prewarm_session_errors;
+            LOG_WARNING() << "Failed to prewarm a ydb session: " << result.GetIssues().ToString();
+            continue;
+        }
+        ++stats_->prewarmed_sessions;
+        sessions.push_back(result.GetSession());
+    }
+
+    // Prepared queries are cached both by the server and by the session, so
+    // that the subsequent executions of the same text skip the compilation
+    std::vector<NYdb::NTable::TAsyncPrepareQueryResult> prepare_futures;
+    prepare_futures.reserve(sessions.size() * queries.size());
+    for (auto& session : sessions) {
+        for (const auto& query : queries) {
+            prepare_futures.push_back(session.PrepareDataQuery(impl::ToString(query)));
+        }
+    }
+
+    for (auto& future : prepare_futures) {
+        const auto result = impl::GetFutureValueUnchecked(std::move(future));
+        if (!result.IsSuccess()) {
+            ++stats_->prepare_query_errors;
+            LOG_WARNING() << "Failed to prepare a ydb query: " << result.GetIssues().ToString();
+            continue;
+        }
+        ++stats_->prepared_queries;
+    }
+}
+
 NYdb::NTable::TTableClient& TableClient::GetNativeTableClient() { return *table_client_; }
 
 utils::RetryBudget& TableClient::GetRetryBudget() { return driver_->GetRetryBudget(); }
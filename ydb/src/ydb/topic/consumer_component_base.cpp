@@ -0,0 +1,93 @@
+#include <userver/ydb/topic/consumer_component_base.hpp>
+
+#include <optional>
+#include <string>
+
+#include <userver/components/component.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/ydb/component.hpp>
+
+#include <ydb/impl/topic_consumer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+TopicConsumerComponentBase::TopicConsumerComponentBase(
+    const components::ComponentConfig& component_config,
+    const components::ComponentContext& component_context
+)
+    : components::ComponentBase(component_config, component_context) {
+    const auto database = component_config["dbname"].As<std::string>();
+    auto topic_client = component_context.FindComponent<YdbComponent>().GetTopicClient(database);
+
+    const auto task_processor_name = component_config["task-processor"].As<std::optional<std::string>>();
+    auto& task_processor = task_processor_name.has_value() ? component_context.GetTaskProcessor(*task_processor_name)
+                                                           : engine::current_task::GetTaskProcessor();
+
+    consumer_ = std::make_unique<impl::TopicConsumer>(
+        std::move(topic_client),
+        task_processor,
+        component_config.As<impl::TopicConsumerSettings>(),
+        [this](const std::vector<Message>& messages) { Process(messages); }
+    );
+}
+
+TopicConsumerComponentBase::~TopicConsumerComponentBase() = default;
+
+void TopicConsumerComponentBase::Start() { consumer_->Start(); }
+
+void TopicConsumerComponentBase::Stop() noexcept { consumer_->Stop(); }
+
+yaml_config::Schema TopicConsumerComponentBase::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: YDB topic consumer component
+additionalProperties: false
+properties:
+    dbname:
+        type: string
+        description: the key of the database within ydb component (NOT the actual database path)
+    consumer-name:
+        type: string
+        description: name of the topic consumer
+    topics:
+        type: array
+        description: paths of the topics to read
+        items:
+            type: string
+            description: topic path
+    task-processor:
+        type: string
+        description: the name of the TaskProcessor for running Process
+        defaultDescription: the default TaskProcessor, typically main-task-processor
+    max-concurrent-partitions:
+        type: integer
+        description: maximum number of partitions processed at the same time
+        defaultDescription: 16
+        minimum: 1
+    commit-batch-size:
+        type: integer
+        description: maximum number of processed messages of a partition to commit at once
+        defaultDescription: 1000
+        minimum: 1
+    max-buffered-bytes:
+        type: integer
+        description: maximum size of the received but not yet processed data
+        defaultDescription: 67108864
+        minimum: 1
+    restart-session-delay:
+        type: string
+        description: backoff before recreating the read session after a failure
+        defaultDescription: 1s
+    close-session-timeout:
+        type: string
+        description: time to wait for the commit acknowledgments on session close
+        defaultDescription: 3s
+  )");
+}
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
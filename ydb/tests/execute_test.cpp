@@ -577,4 +577,27 @@ UTEST_F(YdbExecute, CursorThrow) {
     UASSERT_THROW(cursor.GetFirstRow(), ydb::EmptyResponseError);
 }
 
+UTEST_F(YdbExecute, PrewarmPool) {
+    ydb::impl::TableSettings table_settings;
+    table_settings.min_pool_size = 3;
+    table_settings.prewarm_pool_size = 3;
+    table_settings.prewarm_queries = {"SELECT 1;", "SELECT 2;"};
+
+    const ydb::OperationSettings query_params = {
+        3,                                      // retries
+        std::chrono::seconds{10},               // operation_timeout_ms
+        std::chrono::seconds{10},               // cancel_after_ms
+        std::chrono::seconds{10},               // client_timeout_ms
+        ydb::TransactionMode::kSerializableRW,  // tx_mode
+        std::chrono::seconds{10},               // get_session_timeout_ms
+    };
+    ydb::TableClient table_client{table_settings, query_params, dynamic_config::GetDefaultSource(), GetDriverPtr()};
+
+    EXPECT_EQ(table_client.GetNativeTableClient().GetCurrentPoolSize(), 3);
+    EXPECT_EQ(table_client.GetNativeTableClient().GetActiveSessionCount(), 0);
+
+    const auto response = table_client.ExecuteDataQuery(ydb::Query{"SELECT 2;"});
+    EXPECT_EQ(response.GetSingleCursor().GetFirstRow().Get<std::int32_t>(0), 2);
+}
+
 USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <boost/range/irange.hpp>
 
 #include <userver/utest/utest.hpp>
+#include <userver/ydb/bulk_upsert.hpp>
 
 #include "small_table.hpp"
 #include "test_utils.hpp"
@@ -74,4 +75,17 @@ UTEST_F(YdbListIO, BulkUpsertEmptyRangeOfStructs) {
     AssertArePreFilledRows(result.GetSingleCursor(), {});
 }
 
+UTEST_F(YdbListIO, BulkUpsertWriter) {
+    CreateTable("test_table", false);
+
+    // A batch per row, at most 2 batches in flight
+    ydb::BulkUpsertWriter<tests::RowValue> writer{GetTableClient(), "test_table", {1, 2}};
+    for (const auto& row : kPreFilledRows) writer.Write(row);
+    writer.Finish();
+    EXPECT_EQ(writer.GetWrittenRows(), kPreFilledRows.size());
+
+    auto result = GetTableClient().ExecuteDataQuery(kSelectAllRows);
+    AssertArePreFilledRows(result.GetSingleCursor(), {1, 2, 3});
+}
+
 USERVER_NAMESPACE_END
@@ -29,11 +29,14 @@ public:
 
     impl::Driver& GetDriver() { return *driver_; }
 
+    std::shared_ptr<impl::Driver> GetDriverPtr() { return driver_; }
+
     ydb::TableClient& GetTableClient() { return *table_client_; }
 
     NYdb::NTable::TTableClient& GetNativeTableClient() { return table_client_->GetNativeTableClient(); }
 
     ydb::TopicClient& GetTopicClient() { return *topic_client_; }
+    std::shared_ptr<ydb::TopicClient> GetTopicClientPtr() { return topic_client_; }
 
     NYdb::NTopic::TTopicClient& GetNativeTopicClient() { return topic_client_->GetNativeTopicClient(); }
 
@@ -1,9 +1,14 @@
 #include <userver/utest/utest.hpp>
 
+#include <atomic>
+
 #include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/ydb/impl/cast.hpp>
 
+#include <ydb/impl/topic_consumer.hpp>
+
 #include "test_utils.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -170,4 +175,40 @@ UTEST_F(YdbTopicFixture, DescribeTopic) {
     DropConsumer(kTopicPath, kConsumerName);
 }
 
+UTEST_F(YdbTopicFixture, TopicConsumer) {
+    AddConsumer(kTopicPath, kConsumerName);
+
+    ydb::impl::TopicConsumerSettings settings;
+    settings.consumer_name = kConsumerName;
+    settings.topics = {kTopicPath};
+    settings.commit_batch_size = 1;
+
+    std::atomic<std::size_t> messages_count{0};
+    engine::SingleConsumerEvent all_received;
+    ydb::impl::TopicConsumer consumer{
+        GetTopicClientPtr(),
+        engine::current_task::GetTaskProcessor(),
+        settings,
+        [&](const std::vector<ydb::impl::TopicMessage>& messages) {
+            if (messages_count += messages.size(); messages_count >= 2) all_received.Send();
+        }};
+    consumer.Start();
+
+    GetTableClient().ExecuteDataQuery(fmt::format(
+        R"-(
+      INSERT INTO {} (key, value)
+      VALUES
+        (123, "qwe"),
+        (321, "xyz");
+    )-",
+        kTable
+    ));
+
+    ASSERT_TRUE(all_received.WaitForEventFor(utest::kMaxTestWaitTime));
+    consumer.Stop();
+    EXPECT_EQ(messages_count, 2);
+
+    DropConsumer(kTopicPath, kConsumerName);
+}
+
 USERVER_NAMESPACE_END